@@ -118,7 +118,7 @@ shader_cache_write_program_metadata(struct gl_context *ctx,
       disk_cache_put_key(cache, prog->Shaders[i]->sha1);
       memcpy(cache_item_metadata.keys[i], prog->Shaders[i]->sha1,
              sizeof(cache_key));
-      if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+      if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
          _mesa_sha1_format(sha1_buf, prog->Shaders[i]->sha1);
          fprintf(stderr, "marking shader: %s\n", sha1_buf);
       }
@@ -127,7 +127,7 @@ shader_cache_write_program_metadata(struct gl_context *ctx,
    disk_cache_put(cache, prog->data->sha1, metadata.data, metadata.size,
                   &cache_item_metadata);
 
-   if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+   if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
       _mesa_sha1_format(sha1_buf, prog->data->sha1);
       fprintf(stderr, "putting program metadata in cache: %s\n", sha1_buf);
    }
@@ -219,7 +219,7 @@ shader_cache_read_program_metadata(struct gl_context *ctx,
       return false;
    }
 
-   if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+   if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
       _mesa_sha1_format(sha1buf, prog->data->sha1);
       fprintf(stderr, "loading shader program meta data from cache: %s\n",
               sha1buf);
@@ -236,7 +236,7 @@ shader_cache_read_program_metadata(struct gl_context *ctx,
        */
       assert(!"Invalid GLSL shader disk cache item!");
 
-      if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+      if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
          fprintf(stderr, "Error reading program from cache (invalid GLSL "
                  "cache item)\n");
       }
@@ -260,7 +260,7 @@ shader_cache_read_program_metadata(struct gl_context *ctx,
    for (unsigned i = 0; i < prog->NumShaders; i++) {
       if (prog->Shaders[i]->CompileStatus == compiled_no_opts) {
          disk_cache_put_key(cache, prog->Shaders[i]->sha1);
-         if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+         if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
             _mesa_sha1_format(sha1_buf, prog->Shaders[i]->sha1);
             fprintf(stderr, "re-marking shader: %s\n", sha1_buf);
          }
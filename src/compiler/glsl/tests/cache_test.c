@@ -21,7 +21,11 @@
  * IN THE SOFTWARE.
  */
 
-/* A collection of unit tests for cache.c */
+/* A collection of unit tests for cache.c
+ *
+ * "./cache_test bench [entries] [size]" instead times a cold and a warm
+ * start of the directory and the single-file backends.
+ */
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -34,9 +38,11 @@
 #include <limits.h>
 #include <time.h>
 #include <unistd.h>
+#include <fcntl.h>
 
 #include "util/mesa-sha1.h"
 #include "util/disk_cache.h"
+#include "util/macros.h"
 
 bool error = false;
 
@@ -258,6 +264,8 @@ test_put_and_get(void)
    uint8_t one_KB_key[20], one_MB_key[20];
    int count;
 
+   /* Keep lookups on disk, so that they see evictions. */
+   setenv("MESA_GLSL_CACHE_MEMORY_SIZE", "0", 1);
    cache = disk_cache_create("test", "make_check", 0);
 
    disk_cache_compute_key(cache, blob, sizeof(blob), blob_key);
@@ -424,6 +432,8 @@ test_put_and_get(void)
    expect_equal(count, 1, "eviction after overflow with MAX_SIZE=1M");
 
    disk_cache_destroy(cache);
+
+   unsetenv("MESA_GLSL_CACHE_MEMORY_SIZE");
 }
 
 static void
@@ -477,20 +487,317 @@ test_put_key_and_get_key(void)
 
    disk_cache_destroy(cache);
 }
+
+static void
+test_single_file(void)
+{
+   struct disk_cache *cache, *cache2;
+   char blob[] = "This is a blob of thirty-seven bytes";
+   uint8_t blob_key[20];
+   uint8_t *big[4];
+   uint8_t big_key[4][20];
+   char *result;
+   size_t size;
+   unsigned i, j;
+
+   setenv("MESA_GLSL_CACHE_SINGLE_FILE", "true", 1);
+   setenv("MESA_GLSL_CACHE_MAX_SIZE", "1M", 1);
+   setenv("MESA_GLSL_CACHE_MEMORY_SIZE", "0", 1);
+   cache = disk_cache_create("test", "make_check", 0);
+   expect_non_null(cache, "disk_cache_create with single file");
+
+   disk_cache_compute_key(cache, blob, sizeof(blob), blob_key);
+   disk_cache_put(cache, blob_key, blob, sizeof(blob), NULL);
+   wait_until_file_written(cache, blob_key);
+
+   result = disk_cache_get(cache, blob_key, &size);
+   expect_equal_str(blob, result, "single file disk_cache_get (pointer)");
+   expect_equal(size, sizeof(blob), "single file disk_cache_get (size)");
+   free(result);
+
+   disk_cache_remove(cache, blob_key);
+   expect_true(!does_cache_contain(cache, blob_key),
+               "single file disk_cache_remove");
+
+   /* Random data doesn't compress, so four 300KB items can't all fit in
+    * 1MB and the least recently used one has to go.
+    */
+   srand(42);
+   for (i = 0; i < 4; i++) {
+      big[i] = malloc(300 * 1024);
+      for (j = 0; j < 300 * 1024; j++)
+         big[i][j] = rand();
+
+      disk_cache_compute_key(cache, big[i], 300 * 1024, big_key[i]);
+      disk_cache_put(cache, big_key[i], big[i], 300 * 1024, NULL);
+      wait_until_file_written(cache, big_key[i]);
+      free(big[i]);
+   }
+
+   expect_true(!does_cache_contain(cache, big_key[0]),
+               "single file eviction of least recently used item");
+   for (i = 1; i < 4; i++) {
+      expect_true(does_cache_contain(cache, big_key[i]),
+                  "single file eviction keeps recently used items");
+   }
+
+   /* A second cache object sees what the first one wrote. */
+   cache2 = disk_cache_create("test", "make_check", 0);
+   expect_true(does_cache_contain(cache2, big_key[3]),
+               "single file shared between cache objects");
+
+   disk_cache_destroy(cache2);
+   disk_cache_destroy(cache);
+
+   unsetenv("MESA_GLSL_CACHE_SINGLE_FILE");
+   unsetenv("MESA_GLSL_CACHE_MEMORY_SIZE");
+}
+
+static void
+test_cache_image(void)
+{
+   struct disk_cache *cache;
+   char blob[] = "This is a blob of thirty-seven bytes";
+   uint8_t blob_key[20];
+   uint8_t key_a[20] = {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,
+                         10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+   char *result;
+   size_t size;
+   bool ok;
+
+   /* Warm a cache, export it, and check that a cache in an empty directory
+    * finds everything through the image.
+    */
+   setenv("MESA_GLSL_CACHE_DIR", CACHE_TEST_TMP "/image-source", 1);
+   cache = disk_cache_create("test", "make_check", 0);
+
+   disk_cache_compute_key(cache, blob, sizeof(blob), blob_key);
+   disk_cache_put(cache, blob_key, blob, sizeof(blob), NULL);
+   wait_until_file_written(cache, blob_key);
+   disk_cache_put_key(cache, key_a);
+
+   disk_cache_destroy(cache);
+
+   ok = disk_cache_export_image(CACHE_TEST_TMP "/image-source/"
+                                CACHE_DIR_NAME,
+                                CACHE_TEST_TMP "/test.mesa_cache");
+   expect_true(ok, "disk_cache_export_image");
+
+   setenv("MESA_GLSL_CACHE_DIR", CACHE_TEST_TMP "/image-target", 1);
+   setenv("MESA_GLSL_CACHE_IMAGES", CACHE_TEST_TMP "/test.mesa_cache", 1);
+   cache = disk_cache_create("test", "make_check", 0);
+
+   result = disk_cache_get(cache, blob_key, &size);
+   expect_equal_str(blob, result, "disk_cache_get from image (pointer)");
+   expect_equal(size, sizeof(blob), "disk_cache_get from image (size)");
+   free(result);
+
+   expect_true(disk_cache_has_key(cache, key_a),
+               "disk_cache_has_key from image");
+
+   disk_cache_destroy(cache);
+
+   unsetenv("MESA_GLSL_CACHE_IMAGES");
+}
+
+static void
+test_compression_and_memory(void)
+{
+   struct disk_cache *cache, *cache2;
+   uint8_t *blob;
+   uint8_t blob_key[20];
+   char *result;
+   size_t size;
+
+   /* Compressible data, large enough to be compressed. */
+   blob = calloc(1, 64 * 1024);
+
+   setenv("MESA_GLSL_CACHE_DIR", CACHE_TEST_TMP "/compression", 1);
+   setenv("MESA_GLSL_CACHE_COMPRESSION", "none", 1);
+   cache = disk_cache_create("test", "make_check", 0);
+
+   disk_cache_compute_key(cache, blob, 64 * 1024, blob_key);
+   disk_cache_put(cache, blob_key, blob, 64 * 1024, NULL);
+   wait_until_file_written(cache, blob_key);
+
+   /* A cache that compresses reads back uncompressed entries. */
+   unsetenv("MESA_GLSL_CACHE_COMPRESSION");
+   cache2 = disk_cache_create("test", "make_check", 0);
+
+   result = disk_cache_get(cache2, blob_key, &size);
+   expect_true(result && memcmp(result, blob, 64 * 1024) == 0,
+               "disk_cache_get of uncompressed entry (pointer)");
+   expect_equal(size, 64 * 1024, "disk_cache_get of uncompressed entry (size)");
+   free(result);
+
+   /* Once read, an entry is served from memory even if it is gone from
+    * disk.
+    */
+   disk_cache_remove(cache, blob_key);
+   expect_true(does_cache_contain(cache2, blob_key),
+               "disk_cache_get from memory after removal from disk");
+
+   disk_cache_remove(cache2, blob_key);
+   expect_true(!does_cache_contain(cache2, blob_key),
+               "disk_cache_remove drops the entry from memory");
+
+   disk_cache_destroy(cache2);
+   disk_cache_destroy(cache);
+   free(blob);
+}
+
+static uint64_t bench_files, bench_bytes;
+
+/* Callback for nftw: write a file back and drop it from the page cache, so
+ * that the next read has to go to the disk, as after a reboot.
+ */
+static int
+evict_entry(const char *path,
+            const struct stat *sb,
+            int typeflag,
+            struct FTW *ftwbuf)
+{
+   int fd;
+
+   if (typeflag != FTW_F)
+      return 0;
+
+   bench_files++;
+   bench_bytes += sb->st_size;
+
+   fd = open(path, O_RDONLY);
+   if (fd >= 0) {
+      fdatasync(fd);
+      posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+      close(fd);
+   }
+   return 0;
+}
+
+static double
+bench_now(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/* Read every entry back with a new cache object, like a new process does,
+ * and return the time taken in ms.
+ */
+static double
+bench_start(uint8_t (*keys)[20], unsigned entries)
+{
+   struct disk_cache *cache;
+   unsigned i, misses = 0;
+   double start;
+
+   start = bench_now();
+   cache = disk_cache_create("bench", "make_check", 0);
+   for (i = 0; i < entries; i++) {
+      if (!does_cache_contain(cache, keys[i]))
+         misses++;
+   }
+   disk_cache_destroy(cache);
+
+   if (misses)
+      fprintf(stderr, "Error: %u of %u entries missing\n", misses, entries);
+
+   return bench_now() - start;
+}
+
+static void
+bench(unsigned entries, unsigned size)
+{
+   static const char *const backends[] = { "directory", "single file" };
+   uint8_t (*keys)[20] = malloc(entries * sizeof(*keys));
+   uint8_t *blob = malloc(size);
+   unsigned b, i, j;
+
+   if (!keys || !blob)
+      return;
+
+   setenv("MESA_GLSL_CACHE_DIR", CACHE_TEST_TMP "/bench", 1);
+   setenv("MESA_GLSL_CACHE_MAX_SIZE", "1G", 1);
+   setenv("MESA_GLSL_CACHE_MEMORY_SIZE", "0", 1);
+   mkdir(CACHE_TEST_TMP, 0755);
+
+   printf("%u entries of %u bytes\n", entries, size);
+   printf("%-12s %10s %10s %10s %8s %10s\n",
+          "backend", "put ms", "cold ms", "warm ms", "files", "KB");
+
+   for (b = 0; b < ARRAY_SIZE(backends); b++) {
+      struct disk_cache *cache;
+      double put, cold, warm;
+
+      if (b == 1)
+         setenv("MESA_GLSL_CACHE_SINGLE_FILE", "true", 1);
+
+      /* Shader binaries compress about 2:1, so half of each entry is
+       * random and the other half is repeated.
+       */
+      srand(42);
+      put = bench_now();
+      cache = disk_cache_create("bench", "make_check", 0);
+      for (i = 0; i < entries; i++) {
+         for (j = 0; j < size; j++)
+            blob[j] = j < size / 2 ? rand() : blob[j % 64];
+         memcpy(blob, &i, sizeof(i));
+
+         disk_cache_compute_key(cache, blob, size, keys[i]);
+         disk_cache_put(cache, keys[i], blob, size, NULL);
+      }
+      /* Entries are written in order by a single thread. */
+      for (i = 0; i < 6000 && !does_cache_contain(cache, keys[entries - 1]);
+           i++)
+         usleep(10000);
+      disk_cache_destroy(cache);
+      put = bench_now() - put;
+
+      bench_files = bench_bytes = 0;
+      nftw(CACHE_TEST_TMP "/bench", evict_entry, 64, FTW_PHYS);
+      cold = bench_start(keys, entries);
+      warm = bench_start(keys, entries);
+
+      printf("%-12s %10.1f %10.1f %10.1f %8" PRIu64 " %10" PRIu64 "\n",
+             backends[b], put, cold, warm, bench_files, bench_bytes / 1024);
+
+      rmrf_local(CACHE_TEST_TMP "/bench");
+   }
+
+   unsetenv("MESA_GLSL_CACHE_SINGLE_FILE");
+   unsetenv("MESA_GLSL_CACHE_MEMORY_SIZE");
+   free(blob);
+   free(keys);
+}
 #endif /* ENABLE_SHADER_CACHE */
 
 int
-main(void)
+main(int argc, char **argv)
 {
 #ifdef ENABLE_SHADER_CACHE
    int err;
 
+   if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+      bench(argc > 2 ? atoi(argv[2]) : 5000,
+            argc > 3 ? atoi(argv[3]) : 6 * 1024);
+      rmrf_local(CACHE_TEST_TMP);
+      return error ? 1 : 0;
+   }
+
    test_disk_cache_create();
 
    test_put_and_get();
 
    test_put_key_and_get_key();
 
+   test_single_file();
+
+   test_cache_image();
+
+   test_compression_and_memory();
+
    err = rmrf_local(CACHE_TEST_TMP);
    expect_equal(err, 0, "Removing " CACHE_TEST_TMP " again");
 #endif /* ENABLE_SHADER_CACHE */
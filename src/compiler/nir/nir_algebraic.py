@@ -495,6 +495,143 @@ class SearchAndReplace(object):
 
       BitSizeValidator(varset).validate(self.search, self.replace)
 
+class TreeAutomaton(object):
+   """A bottom-up tree automaton matching the search expressions of all the
+   transforms in a pass at once.
+
+   Every SSA value in the shader is assigned a state, computed from the
+   opcode of the instruction producing it and the states of its sources.  A
+   state stands for the set of "items", the subexpressions of the search
+   patterns, which the value may match.  Items only record the shape of a
+   pattern: variables match anything, constants and constant variables match
+   any load_const, and bit sizes, conditions, constant values and repeated
+   variables are ignored.  Commutative opcodes match their sources in either
+   order, as in nir_search.  A transform can only apply to an instruction
+   whose state contains the item for its search expression, so those are the
+   only transforms nir_replace_instr() needs to try there.
+
+   The state of an ALU instruction is looked up in a per-opcode table.  To
+   keep the tables small, the states of the sources are first narrowed down,
+   again per opcode, to the items which appear as a source of that opcode in
+   some pattern, and the table is indexed by these "filtered" states.
+   """
+   def __init__(self, transforms):
+      self.items = {}
+      self.num_items = 0
+      self.wildcard = self._get_item('__wildcard', ())
+      self.const = self._get_item('__const', ())
+
+      # The opcodes appearing in the patterns, in a stable order, and for
+      # each one the set of items appearing as its sources.
+      self.opcodes = []
+      self.child_items = {}
+
+      self.root_items = [self._add_pattern(xform.search)
+                         for xform in transforms]
+
+      self._build_tables()
+
+   def _get_item(self, opcode, children):
+      """Return the item for an opcode and a tuple of child items, creating
+      it if needed.  Items are small integers so that the numbering of the
+      states doesn't depend on hashing."""
+      key = (opcode, children)
+      if key not in self.items:
+         item = self.num_items
+         self.num_items += 1
+         self.items[key] = item
+         if opcode in opcodes and len(children) == 2 and \
+            'commutative' in opcodes[opcode].algebraic_properties:
+            self.items[(opcode, (children[1], children[0]))] = item
+
+      return self.items[key]
+
+   def _add_pattern(self, val):
+      if isinstance(val, Constant):
+         return self.const
+      elif isinstance(val, Variable):
+         return self.const if val.is_constant else self.wildcard
+
+      assert isinstance(val, Expression)
+      children = tuple(self._add_pattern(src) for src in val.sources)
+      if val.opcode not in self.child_items:
+         self.opcodes.append(val.opcode)
+         self.child_items[val.opcode] = set()
+      self.child_items[val.opcode].update(children)
+
+      return self._get_item(val.opcode, children)
+
+   def _build_tables(self):
+      # States are frozensets of items.  State 0 is used for anything which
+      # isn't an ALU instruction nor a load_const.
+      self.states = []
+      state_index = {}
+
+      def get_state(items):
+         if items not in state_index:
+            state_index[items] = len(self.states)
+            self.states.append(items)
+         return state_index[items]
+
+      assert get_state(frozenset([self.wildcard])) == 0
+      self.const_state = get_state(frozenset([self.wildcard, self.const]))
+
+      # For each opcode, the list of distinct filtered states, the index in
+      # that list of the filtered version of every state, and the transition
+      # table mapping a tuple of filtered source states to a state.
+      self.filtered_states = dict((op, []) for op in self.opcodes)
+      self.filter = dict((op, []) for op in self.opcodes)
+      self.table = dict((op, {}) for op in self.opcodes)
+      filtered_index = dict((op, {}) for op in self.opcodes)
+
+      # Adding transitions can create new states, which can create new
+      # filtered states, which require new transitions.  Iterate until
+      # nothing changes.
+      num_filtered = 0
+      while num_filtered < len(self.states):
+         for state in self.states[num_filtered:]:
+            for op in self.opcodes:
+               filtered = state & self.child_items[op]
+               if filtered not in filtered_index[op]:
+                  filtered_index[op][filtered] = len(self.filtered_states[op])
+                  self.filtered_states[op].append(filtered)
+               self.filter[op].append(filtered_index[op][filtered])
+         num_filtered = len(self.states)
+
+         for op in self.opcodes:
+            filtered_states = self.filtered_states[op]
+            num_srcs = opcodes[op].num_inputs
+            for srcs in itertools.product(range(len(filtered_states)),
+                                          repeat=num_srcs):
+               if srcs in self.table[op]:
+                  continue
+
+               items = set([self.wildcard])
+               for children in itertools.product(
+                     *[sorted(filtered_states[src]) for src in srcs]):
+                  item = self.items.get((op, children))
+                  if item is not None:
+                     items.add(item)
+
+               self.table[op][srcs] = get_state(frozenset(items))
+
+      # The per-opcode tables and the state indices are emitted as uint16_t.
+      assert len(self.states) < (1 << 16)
+
+   def flat_table(self, op):
+      """The transition table for op as a row-major array, indexed by the
+      filtered states of the sources."""
+      num_srcs = opcodes[op].num_inputs
+      return [self.table[op][srcs] for srcs in
+              itertools.product(range(len(self.filtered_states[op])),
+                                repeat=num_srcs)]
+
+   def state_transforms(self, state):
+      """The indices of the transforms which may match a value in the given
+      state, in their original order."""
+      return [i for (i, item) in enumerate(self.root_items)
+              if item in self.states[state]]
+
 _algebraic_pass_template = mako.template.Template("""
 #include "nir.h"
 #include "nir_search.h"
@@ -509,27 +646,122 @@ struct transform {
    unsigned condition_offset;
 };
 
+struct transform_list {
+   const struct transform *xforms;
+   unsigned num_xforms;
+};
+
+/* Automaton transitions for an opcode.  The state of an instruction is
+ * table[f(src0) * n^(k-1) + ... + f(src(k-1))], where f maps the state of a
+ * source through filter and n is num_filtered_states.
+ */
+struct per_op_table {
+   const uint16_t *filter;
+   unsigned num_filtered_states;
+   const uint16_t *table;
+};
+
 #endif
 
-% for (opcode, xform_list) in xform_dict.iteritems():
-% for xform in xform_list:
+% for xform in xforms:
    ${xform.search.render()}
    ${xform.replace.render()}
 % endfor
 
-static const struct transform ${pass_name}_${opcode}_xforms[] = {
+% for (i, xform_list) in enumerate(xform_lists):
+static const struct transform ${pass_name}_xforms_${i}[] = {
 % for xform in xform_list:
    { &${xform.search.name}, ${xform.replace.c_ptr}, ${xform.condition_index} },
 % endfor
 };
+
+% endfor
+/* The transforms to try on an instruction, indexed by its state. */
+static const struct transform_list ${pass_name}_state_xforms[] = {
+% for i in state_xform_lists:
+% if i is None:
+   { NULL, 0 },
+% else:
+   { ${pass_name}_xforms_${i}, ARRAY_SIZE(${pass_name}_xforms_${i}) },
+% endif
+% endfor
+};
+
+% for (i, filter) in enumerate(filters):
+static const uint16_t ${pass_name}_filter_${i}[] = {
+% for row in c_rows(filter):
+   ${row}
 % endfor
+};
+
+% endfor
+% for op in automaton.opcodes:
+static const uint16_t ${pass_name}_table_${op}[] = {
+% for row in c_rows(automaton.flat_table(op)):
+   ${row}
+% endfor
+};
+
+% endfor
+static const struct per_op_table ${pass_name}_table[nir_num_opcodes] = {
+% for op in automaton.opcodes:
+   [nir_op_${op}] = {
+      .filter = ${pass_name}_filter_${op_filter[op]},
+      .num_filtered_states = ${len(automaton.filtered_states[op])},
+      .table = ${pass_name}_table_${op},
+   },
+% endfor
+};
+
+/* Compute the state of every SSA value defined in the block.  Values which
+ * aren't produced by an ALU instruction are left in state 0, which matches
+ * only variables.
+ */
+static void
+${pass_name}_pre_block(nir_block *block, uint16_t *states)
+{
+   nir_foreach_instr(instr, block) {
+      switch (instr->type) {
+      case nir_instr_type_alu: {
+         nir_alu_instr *alu = nir_instr_as_alu(instr);
+         const struct per_op_table *tbl = &${pass_name}_table[alu->op];
+
+         if (!alu->dest.dest.is_ssa || tbl->table == NULL)
+            break;
+
+         unsigned index = 0;
+         for (unsigned i = 0; i < nir_op_infos[alu->op].num_inputs; i++) {
+            unsigned src_state = alu->src[i].src.is_ssa ?
+                                 states[alu->src[i].src.ssa->index] : 0;
+            index = index * tbl->num_filtered_states + tbl->filter[src_state];
+         }
+
+         states[alu->dest.dest.ssa.index] = tbl->table[index];
+         break;
+      }
+
+      case nir_instr_type_load_const: {
+         nir_load_const_instr *load_const = nir_instr_as_load_const(instr);
+         states[load_const->def.index] = ${automaton.const_state};
+         break;
+      }
+
+      default:
+         break;
+      }
+   }
+}
 
 static bool
 ${pass_name}_block(nir_block *block, const bool *condition_flags,
-                   void *mem_ctx)
+                   const uint16_t *states, void *mem_ctx)
 {
    bool progress = false;
 
+   /* Instructions inserted by nir_replace_instr() land after the iterator,
+    * so every instruction visited here still has the state computed for it
+    * before any replacement was made.
+    */
    nir_foreach_instr_reverse_safe(instr, block) {
       if (instr->type != nir_instr_type_alu)
          continue;
@@ -538,22 +770,17 @@ ${pass_name}_block(nir_block *block, const bool *condition_flags,
       if (!alu->dest.dest.is_ssa)
          continue;
 
-      switch (alu->op) {
-      % for opcode in xform_dict.keys():
-      case nir_op_${opcode}:
-         for (unsigned i = 0; i < ARRAY_SIZE(${pass_name}_${opcode}_xforms); i++) {
-            const struct transform *xform = &${pass_name}_${opcode}_xforms[i];
-            if (condition_flags[xform->condition_offset] &&
-                nir_replace_instr(alu, xform->search, xform->replace,
-                                  mem_ctx)) {
-               progress = true;
-               break;
-            }
+      const struct transform_list *list =
+         &${pass_name}_state_xforms[states[alu->dest.dest.ssa.index]];
+
+      for (unsigned i = 0; i < list->num_xforms; i++) {
+         const struct transform *xform = &list->xforms[i];
+         if (condition_flags[xform->condition_offset] &&
+             nir_replace_instr(alu, xform->search, xform->replace,
+                               mem_ctx)) {
+            progress = true;
+            break;
          }
-         break;
-      % endfor
-      default:
-         break;
       }
    }
 
@@ -566,10 +793,18 @@ ${pass_name}_impl(nir_function_impl *impl, const bool *condition_flags)
    void *mem_ctx = ralloc_parent(impl);
    bool progress = false;
 
+   uint16_t *states = calloc(impl->ssa_alloc, sizeof(*states));
+
+   nir_foreach_block(block, impl) {
+      ${pass_name}_pre_block(block, states);
+   }
+
    nir_foreach_block_reverse(block, impl) {
-      progress |= ${pass_name}_block(block, condition_flags, mem_ctx);
+      progress |= ${pass_name}_block(block, condition_flags, states, mem_ctx);
    }
 
+   free(states);
+
    if (progress)
       nir_metadata_preserve(impl, nir_metadata_block_index |
                                   nir_metadata_dominance);
@@ -599,9 +834,14 @@ ${pass_name}(nir_shader *shader)
 }
 """)
 
+def _c_rows(values, per_row=16):
+   """Split a list of integers into lines of a C array initializer."""
+   return [' '.join(str(v) + ',' for v in values[i:i + per_row])
+           for i in range(0, len(values), per_row)]
+
 class AlgebraicPass(object):
    def __init__(self, pass_name, transforms):
-      self.xform_dict = {}
+      self.xforms = []
       self.pass_name = pass_name
 
       error = False
@@ -618,15 +858,45 @@ class AlgebraicPass(object):
                error = True
                continue
 
-         if xform.search.opcode not in self.xform_dict:
-            self.xform_dict[xform.search.opcode] = []
-
-         self.xform_dict[xform.search.opcode].append(xform)
+         self.xforms.append(xform)
 
       if error:
          sys.exit(1)
 
+      self.automaton = TreeAutomaton(self.xforms)
+
    def render(self):
+      # Many states share the same list of transforms, and many opcodes the
+      # same filter, so emit each distinct one only once.
+      xform_lists = []
+      xform_list_index = {}
+      state_xform_lists = []
+      for state in range(len(self.automaton.states)):
+         indices = tuple(self.automaton.state_transforms(state))
+         if not indices:
+            state_xform_lists.append(None)
+            continue
+         if indices not in xform_list_index:
+            xform_list_index[indices] = len(xform_lists)
+            xform_lists.append([self.xforms[i] for i in indices])
+         state_xform_lists.append(xform_list_index[indices])
+
+      filters = []
+      filter_index = {}
+      op_filter = {}
+      for op in self.automaton.opcodes:
+         filter = tuple(self.automaton.filter[op])
+         if filter not in filter_index:
+            filter_index[filter] = len(filters)
+            filters.append(list(filter))
+         op_filter[op] = filter_index[filter]
+
       return _algebraic_pass_template.render(pass_name=self.pass_name,
-                                             xform_dict=self.xform_dict,
+                                             xforms=self.xforms,
+                                             xform_lists=xform_lists,
+                                             state_xform_lists=state_xform_lists,
+                                             filters=filters,
+                                             op_filter=op_filter,
+                                             automaton=self.automaton,
+                                             c_rows=_c_rows,
                                              condition_list=condition_list)
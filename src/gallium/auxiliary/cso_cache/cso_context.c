@@ -1694,6 +1694,39 @@ cso_draw_vbo(struct cso_context *cso,
    }
 }
 
+/**
+ * Draw several ranges sharing the rest of \p info, as
+ * pipe_context::multi_draw does.  Falls back to one draw per range when the
+ * driver doesn't implement multi_draw or u_vbuf is translating vertices.
+ */
+void
+cso_multi_draw(struct cso_context *cso,
+               const struct pipe_draw_info *info,
+               const struct pipe_draw_start_count *draws,
+               unsigned num_draws)
+{
+   struct pipe_context *pipe = cso->pipe;
+
+   if (!cso->vbuf && pipe->multi_draw) {
+      pipe->multi_draw(pipe, info, draws, num_draws);
+   } else {
+      struct pipe_draw_info draw_info = *info;
+      unsigned i;
+
+      for (i = 0; i < num_draws; i++) {
+         draw_info.start = draws[i].start;
+         draw_info.count = draws[i].count;
+         draw_info.index_bias = info->index_size ? draws[i].index_bias : 0;
+         draw_info.drawid = info->drawid + i;
+         if (!info->index_size) {
+            draw_info.min_index = draws[i].start;
+            draw_info.max_index = draws[i].start + draws[i].count - 1;
+         }
+         cso_draw_vbo(cso, &draw_info);
+      }
+   }
+}
+
 void
 cso_draw_arrays(struct cso_context *cso, uint mode, uint start, uint count)
 {
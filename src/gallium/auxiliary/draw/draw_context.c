@@ -1027,6 +1027,41 @@ draw_set_mapped_texture(struct draw_context *draw,
 #endif
 }
 
+void
+draw_set_disk_cache_callbacks(struct draw_context *draw,
+                              void *data_cookie,
+                              draw_disk_cache_find_shader_func find_shader,
+                              draw_disk_cache_insert_shader_func insert_shader)
+{
+   draw->disk_cache_cookie = data_cookie;
+   draw->disk_cache_find_shader = find_shader;
+   draw->disk_cache_insert_shader = insert_shader;
+}
+
+/**
+ * Let the draw module share its generated code with other draw contexts
+ * through the given cache.  The cache must outlive the draw context.
+ */
+void
+draw_set_shared_code_cache(struct draw_context *draw,
+                           struct lp_code_cache *code_cache)
+{
+   draw->code_cache = code_cache;
+}
+
+/**
+ * Let the draw module optimize new shader variants on the given compiler
+ * threads, using quickly compiled code meanwhile.  The optimized code is
+ * published in the compiler's code cache, so this only makes sense
+ * together with draw_set_shared_code_cache().
+ */
+void
+draw_set_async_compiler(struct draw_context *draw,
+                        struct lp_async_compiler *compiler)
+{
+   draw->async_compiler = compiler;
+}
+
 /**
  * XXX: Results for PIPE_SHADER_CAP_MAX_TEXTURE_SAMPLERS because there are two
  * different ways of setting textures, and drivers typically only support one.
@@ -49,6 +49,7 @@ struct draw_fragment_shader;
 struct tgsi_sampler;
 struct tgsi_image;
 struct tgsi_buffer;
+struct lp_cached_code;
 
 /*
  * structure to contain driver internal information 
@@ -72,6 +73,36 @@ struct draw_context *draw_create_with_llvm_context(struct pipe_context *pipe,
 
 struct draw_context *draw_create_no_llvm(struct pipe_context *pipe);
 
+/**
+ * Hooks letting the driver cache the draw module's LLVM object code.
+ * find_shader fills in the cached code for the given key, if any;
+ * insert_shader stores freshly compiled code under the key.
+ */
+typedef void (*draw_disk_cache_find_shader_func)(void *cookie,
+                                                 struct lp_cached_code *cache,
+                                                 unsigned char ir_sha1_cache_key[20]);
+typedef void (*draw_disk_cache_insert_shader_func)(void *cookie,
+                                                   struct lp_cached_code *cache,
+                                                   unsigned char ir_sha1_cache_key[20]);
+
+void
+draw_set_disk_cache_callbacks(struct draw_context *draw,
+                              void *data_cookie,
+                              draw_disk_cache_find_shader_func find_shader,
+                              draw_disk_cache_insert_shader_func insert_shader);
+
+struct lp_code_cache;
+
+void
+draw_set_shared_code_cache(struct draw_context *draw,
+                           struct lp_code_cache *code_cache);
+
+struct lp_async_compiler;
+
+void
+draw_set_async_compiler(struct draw_context *draw,
+                        struct lp_async_compiler *compiler);
+
 void draw_destroy( struct draw_context *draw );
 
 void draw_flush(struct draw_context *draw);
@@ -267,6 +298,11 @@ draw_set_mapped_so_targets(struct draw_context *draw,
 void draw_vbo(struct draw_context *draw,
               const struct pipe_draw_info *info);
 
+void draw_multi_draw(struct draw_context *draw,
+                     const struct pipe_draw_info *info,
+                     const struct pipe_draw_start_count *draws,
+                     unsigned num_draws);
+
 
 /*******************************************************************************
  * Driver backend interface 
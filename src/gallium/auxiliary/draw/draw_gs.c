@@ -369,6 +369,8 @@ llvm_gs_prepare(struct draw_geometry_shader *shader,
                 const void *constants[PIPE_MAX_CONSTANT_BUFFERS],
                 const unsigned constants_size[PIPE_MAX_CONSTANT_BUFFERS])
 {
+   if (shader->current_variant)
+      draw_gs_llvm_update_variant_code(shader->current_variant);
 }
 
 static unsigned
@@ -43,20 +43,29 @@
 #include "gallivm/lp_bld_flow.h"
 #include "gallivm/lp_bld_debug.h"
 #include "gallivm/lp_bld_tgsi.h"
+#include "gallivm/lp_bld_nir.h"
 #include "gallivm/lp_bld_printf.h"
 #include "gallivm/lp_bld_intr.h"
 #include "gallivm/lp_bld_init.h"
+#include "gallivm/lp_bld_code_cache.h"
+#include "gallivm/lp_bld_async.h"
 #include "gallivm/lp_bld_type.h"
 #include "gallivm/lp_bld_pack.h"
 #include "gallivm/lp_bld_format.h"
 
 #include "tgsi/tgsi_exec.h"
 #include "tgsi/tgsi_dump.h"
+#include "tgsi/tgsi_parse.h"
+
+#include "compiler/blob.h"
+#include "compiler/nir/nir.h"
+#include "compiler/nir/nir_serialize.h"
 
 #include "util/u_math.h"
 #include "util/u_pointer.h"
 #include "util/u_string.h"
 #include "util/simple_list.h"
+#include "util/mesa-sha1.h"
 
 
 #define DEBUG_STORE 0
@@ -539,6 +548,38 @@ draw_llvm_destroy(struct draw_llvm *llvm)
 }
 
 
+/**
+ * Compute the key under which a variant's object code is cached: the
+ * shader IR, the variant key and the vertex header layout.
+ */
+static void
+draw_get_ir_cache_key(const struct pipe_shader_state *state,
+                      const void *key, unsigned key_size,
+                      unsigned num_attribs,
+                      unsigned char ir_sha1_cache_key[20])
+{
+   struct mesa_sha1 ctx;
+
+   _mesa_sha1_init(&ctx);
+   if (state->type == PIPE_SHADER_IR_NIR) {
+      struct blob blob;
+
+      blob_init(&blob);
+      nir_serialize(&blob, state->ir.nir);
+      _mesa_sha1_update(&ctx, blob.data, blob.size);
+      blob_finish(&blob);
+   }
+   else {
+      _mesa_sha1_update(&ctx, state->tokens,
+                        tgsi_num_tokens(state->tokens) *
+                        sizeof(struct tgsi_token));
+   }
+   _mesa_sha1_update(&ctx, key, key_size);
+   _mesa_sha1_update(&ctx, &num_attribs, sizeof(num_attribs));
+   _mesa_sha1_final(&ctx, ir_sha1_cache_key);
+}
+
+
 /**
  * Create LLVM-generated code for a vertex shader.
  */
@@ -550,8 +591,12 @@ draw_llvm_create_variant(struct draw_llvm *llvm,
    struct draw_llvm_variant *variant;
    struct llvm_vertex_shader *shader =
       llvm_vertex_shader(llvm->draw->vs.vertex_shader);
+   struct draw_context *draw = llvm->draw;
    LLVMTypeRef vertex_header;
    char module_name[64];
+   struct lp_cached_code cached = { 0 };
+   unsigned char ir_sha1_cache_key[20];
+   boolean needs_caching = FALSE;
 
    variant = MALLOC(sizeof *variant +
                     shader->variant_key_size -
@@ -561,18 +606,46 @@ draw_llvm_create_variant(struct draw_llvm *llvm,
 
    variant->llvm = llvm;
    variant->shader = shader;
+   variant->gallivm = NULL;
+   variant->code = NULL;
+   variant->job = NULL;
+
+   memcpy(&variant->key, key, shader->variant_key_size);
+
+   if (draw->code_cache || draw->async_compiler ||
+       draw->disk_cache_find_shader) {
+      draw_get_ir_cache_key(&shader->base.state,
+                            key, shader->variant_key_size, num_inputs,
+                            ir_sha1_cache_key);
+   }
+
+   /* Another context may have generated the same code already. */
+   if (draw->code_cache) {
+      variant->code = lp_code_cache_find(draw->code_cache, ir_sha1_cache_key);
+      if (variant->code) {
+         variant->jit_func = (draw_jit_vert_func) variant->code->functions[0];
+         goto done;
+      }
+   }
 
    util_snprintf(module_name, sizeof(module_name), "draw_llvm_vs_variant%u",
                  variant->shader->variants_cached);
 
-   variant->gallivm = gallivm_create(module_name, llvm->context);
+   if (draw->disk_cache_find_shader) {
+      draw->disk_cache_find_shader(draw->disk_cache_cookie,
+                                   &cached, ir_sha1_cache_key);
+      needs_caching = !cached.data_size;
+   }
 
-   create_jit_types(variant);
+   variant->gallivm = gallivm_create(module_name, llvm->context, &cached);
 
-   memcpy(&variant->key, key, shader->variant_key_size);
+   create_jit_types(variant);
 
    if (gallivm_debug & (GALLIVM_DEBUG_TGSI | GALLIVM_DEBUG_IR)) {
-      tgsi_dump(llvm->draw->vs.vertex_shader->state.tokens, 0);
+      if (shader->base.state.type == PIPE_SHADER_IR_NIR)
+         nir_print_shader(shader->base.state.ir.nir, stderr);
+      else
+         tgsi_dump(shader->base.state.tokens, 0);
       draw_llvm_dump_variant_key(&variant->key);
    }
 
@@ -582,13 +655,41 @@ draw_llvm_create_variant(struct draw_llvm *llvm,
 
    draw_llvm_generate(llvm, variant);
 
+   /* Unless the code came from the disk cache, optimize it in the
+    * background, and make do with quickly compiled code meanwhile.
+    */
+   if (draw->async_compiler && !cached.data_size) {
+      variant->job = lp_async_compile(draw->async_compiler, variant->gallivm,
+                                      &variant->function, 1,
+                                      ir_sha1_cache_key);
+   }
+
    gallivm_compile_module(variant->gallivm);
 
    variant->jit_func = (draw_jit_vert_func)
          gallivm_jit_function(variant->gallivm, variant->function);
 
+   if (needs_caching && draw->disk_cache_insert_shader)
+      draw->disk_cache_insert_shader(draw->disk_cache_cookie,
+                                     &cached, ir_sha1_cache_key);
    gallivm_free_ir(variant->gallivm);
+   free(cached.data);
+
+   /* Hand the code over to the screen so other contexts can use it. */
+   if (draw->code_cache && !variant->job) {
+      func_pointer jit_func = (func_pointer) variant->jit_func;
+
+      variant->code = lp_code_cache_add(draw->code_cache, ir_sha1_cache_key,
+                                        variant->gallivm, &jit_func, 1, 0);
+      variant->gallivm = NULL;
+      if (!variant->code) {
+         FREE(variant);
+         return NULL;
+      }
+      variant->jit_func = (draw_jit_vert_func) variant->code->functions[0];
+   }
 
+done:
    variant->list_item_global.base = variant;
    variant->list_item_local.base = variant;
    /*variant->no = */shader->variants_created++;
@@ -610,26 +711,46 @@ generate_vs(struct draw_llvm_variant *variant,
             boolean clamp_vertex_color)
 {
    struct draw_llvm *llvm = variant->llvm;
-   const struct tgsi_token *tokens = llvm->draw->vs.vertex_shader->state.tokens;
+   const struct pipe_shader_state *state = &llvm->draw->vs.vertex_shader->state;
    LLVMValueRef consts_ptr =
       draw_jit_context_vs_constants(variant->gallivm, context_ptr);
    LLVMValueRef num_consts_ptr =
       draw_jit_context_num_vs_constants(variant->gallivm, context_ptr);
 
-   lp_build_tgsi_soa(variant->gallivm,
-                     tokens,
-                     vs_type,
-                     NULL /*struct lp_build_mask_context *mask*/,
-                     consts_ptr,
-                     num_consts_ptr,
-                     system_values,
-                     inputs,
-                     outputs,
-                     context_ptr,
-                     NULL,
-                     draw_sampler,
-                     &llvm->draw->vs.vertex_shader->info,
-                     NULL);
+   if (state->type == PIPE_SHADER_IR_NIR) {
+      MAYBE_UNUSED boolean translated;
+      translated = lp_build_nir_soa(variant->gallivm,
+                                    state->ir.nir,
+                                    vs_type,
+                                    NULL /*struct lp_build_mask_context *mask*/,
+                                    consts_ptr,
+                                    num_consts_ptr,
+                                    system_values,
+                                    inputs,
+                                    outputs,
+                                    context_ptr,
+                                    NULL,
+                                    draw_sampler,
+                                    &llvm->draw->vs.vertex_shader->info,
+                                    NULL);
+      /* checked by is_nir_shader_supported() when the program was linked */
+      assert(translated);
+   } else
+      lp_build_tgsi_soa(variant->gallivm,
+                        state->tokens,
+                        vs_type,
+                        NULL /*struct lp_build_mask_context *mask*/,
+                        consts_ptr,
+                        num_consts_ptr,
+                        system_values,
+                        inputs,
+                        outputs,
+                        context_ptr,
+                        NULL,
+                        draw_sampler,
+                        &llvm->draw->vs.vertex_shader->info,
+                        NULL,
+                        NULL);
 
    {
       LLVMValueRef out;
@@ -1574,8 +1695,8 @@ draw_llvm_generate(struct draw_llvm *llvm, struct draw_llvm_variant *variant)
 
    memset(&system_values, 0, sizeof(system_values));
 
-   util_snprintf(func_name, sizeof(func_name), "draw_llvm_vs_variant%u",
-                 variant->shader->variants_cached);
+   /* Fixed name, as cached object code is looked up by symbol name. */
+   util_snprintf(func_name, sizeof(func_name), "draw_llvm_vs_variant");
 
    i = 0;
    arg_types[i++] = get_context_ptr_type(variant);       /* context */
@@ -2151,6 +2272,30 @@ draw_llvm_set_sampler_state(struct draw_context *draw,
 }
 
 
+/**
+ * Switch the variant over to its optimized code, if that has been
+ * compiled in the background by now.
+ */
+void
+draw_llvm_update_variant_code(struct draw_llvm_variant *variant)
+{
+   if (!variant->job || !lp_async_job_is_done(variant->job))
+      return;
+
+   if (variant->job->code) {
+      lp_shared_code_reference(&variant->code, variant->job->code);
+      variant->jit_func = (draw_jit_vert_func) variant->code->functions[0];
+
+      /* Vertex shading is synchronous, nothing uses the old code now. */
+      gallivm_destroy(variant->gallivm);
+      variant->gallivm = NULL;
+   }
+
+   lp_async_job_destroy(variant->job);
+   variant->job = NULL;
+}
+
+
 void
 draw_llvm_destroy_variant(struct draw_llvm_variant *variant)
 {
@@ -2161,7 +2306,11 @@ draw_llvm_destroy_variant(struct draw_llvm_variant *variant)
                     variant->shader->variants_cached, llvm->nr_variants);
    }
 
-   gallivm_destroy(variant->gallivm);
+   if (variant->job)
+      lp_async_job_destroy(variant->job);
+   if (variant->gallivm)
+      gallivm_destroy(variant->gallivm);
+   lp_shared_code_reference(&variant->code, NULL);
 
    remove_from_list(&variant->list_item_local);
    variant->shader->variants_cached--;
@@ -2254,8 +2403,8 @@ draw_gs_llvm_generate(struct draw_llvm *llvm,
 
    memset(&system_values, 0, sizeof(system_values));
 
-   util_snprintf(func_name, sizeof(func_name), "draw_llvm_gs_variant%u",
-                 variant->shader->variants_cached);
+   /* Fixed name, as cached object code is looked up by symbol name. */
+   util_snprintf(func_name, sizeof(func_name), "draw_llvm_gs_variant");
 
    assert(variant->vertex_header_ptr_type);
 
@@ -2356,7 +2505,8 @@ draw_gs_llvm_generate(struct draw_llvm *llvm,
                      NULL,
                      sampler,
                      &llvm->draw->gs.geometry_shader->info,
-                     (const struct lp_build_tgsi_gs_iface *)&gs_iface);
+                     (const struct lp_build_tgsi_gs_iface *)&gs_iface,
+                     NULL);
 
    sampler->destroy(sampler);
 
@@ -2376,8 +2526,12 @@ draw_gs_llvm_create_variant(struct draw_llvm *llvm,
    struct draw_gs_llvm_variant *variant;
    struct llvm_geometry_shader *shader =
       llvm_geometry_shader(llvm->draw->gs.geometry_shader);
+   struct draw_context *draw = llvm->draw;
    LLVMTypeRef vertex_header;
    char module_name[64];
+   struct lp_cached_code cached = { 0 };
+   unsigned char ir_sha1_cache_key[20];
+   boolean needs_caching = FALSE;
 
    variant = MALLOC(sizeof *variant +
                     shader->variant_key_size -
@@ -2387,15 +2541,40 @@ draw_gs_llvm_create_variant(struct draw_llvm *llvm,
 
    variant->llvm = llvm;
    variant->shader = shader;
+   variant->gallivm = NULL;
+   variant->code = NULL;
+   variant->job = NULL;
+
+   memcpy(&variant->key, key, shader->variant_key_size);
+
+   if (draw->code_cache || draw->async_compiler ||
+       draw->disk_cache_find_shader) {
+      draw_get_ir_cache_key(&shader->base.state,
+                            key, shader->variant_key_size, num_outputs,
+                            ir_sha1_cache_key);
+   }
+
+   /* Another context may have generated the same code already. */
+   if (draw->code_cache) {
+      variant->code = lp_code_cache_find(draw->code_cache, ir_sha1_cache_key);
+      if (variant->code) {
+         variant->jit_func = (draw_gs_jit_func) variant->code->functions[0];
+         goto done;
+      }
+   }
 
    util_snprintf(module_name, sizeof(module_name), "draw_llvm_gs_variant%u",
                  variant->shader->variants_cached);
 
-   variant->gallivm = gallivm_create(module_name, llvm->context);
+   if (draw->disk_cache_find_shader) {
+      draw->disk_cache_find_shader(draw->disk_cache_cookie,
+                                   &cached, ir_sha1_cache_key);
+      needs_caching = !cached.data_size;
+   }
 
-   create_gs_jit_types(variant);
+   variant->gallivm = gallivm_create(module_name, llvm->context, &cached);
 
-   memcpy(&variant->key, key, shader->variant_key_size);
+   create_gs_jit_types(variant);
 
    vertex_header = create_jit_vertex_header(variant->gallivm, num_outputs);
 
@@ -2403,13 +2582,41 @@ draw_gs_llvm_create_variant(struct draw_llvm *llvm,
 
    draw_gs_llvm_generate(llvm, variant);
 
+   /* Unless the code came from the disk cache, optimize it in the
+    * background, and make do with quickly compiled code meanwhile.
+    */
+   if (draw->async_compiler && !cached.data_size) {
+      variant->job = lp_async_compile(draw->async_compiler, variant->gallivm,
+                                      &variant->function, 1,
+                                      ir_sha1_cache_key);
+   }
+
    gallivm_compile_module(variant->gallivm);
 
    variant->jit_func = (draw_gs_jit_func)
          gallivm_jit_function(variant->gallivm, variant->function);
 
+   if (needs_caching && draw->disk_cache_insert_shader)
+      draw->disk_cache_insert_shader(draw->disk_cache_cookie,
+                                     &cached, ir_sha1_cache_key);
    gallivm_free_ir(variant->gallivm);
+   free(cached.data);
+
+   /* Hand the code over to the screen so other contexts can use it. */
+   if (draw->code_cache && !variant->job) {
+      func_pointer jit_func = (func_pointer) variant->jit_func;
+
+      variant->code = lp_code_cache_add(draw->code_cache, ir_sha1_cache_key,
+                                        variant->gallivm, &jit_func, 1, 0);
+      variant->gallivm = NULL;
+      if (!variant->code) {
+         FREE(variant);
+         return NULL;
+      }
+      variant->jit_func = (draw_gs_jit_func) variant->code->functions[0];
+   }
 
+done:
    variant->list_item_global.base = variant;
    variant->list_item_local.base = variant;
    /*variant->no = */shader->variants_created++;
@@ -2418,6 +2625,29 @@ draw_gs_llvm_create_variant(struct draw_llvm *llvm,
    return variant;
 }
 
+/**
+ * Switch the variant over to its optimized code, if that has been
+ * compiled in the background by now.
+ */
+void
+draw_gs_llvm_update_variant_code(struct draw_gs_llvm_variant *variant)
+{
+   if (!variant->job || !lp_async_job_is_done(variant->job))
+      return;
+
+   if (variant->job->code) {
+      lp_shared_code_reference(&variant->code, variant->job->code);
+      variant->jit_func = (draw_gs_jit_func) variant->code->functions[0];
+
+      /* Geometry shading is synchronous, nothing uses the old code now. */
+      gallivm_destroy(variant->gallivm);
+      variant->gallivm = NULL;
+   }
+
+   lp_async_job_destroy(variant->job);
+   variant->job = NULL;
+}
+
 void
 draw_gs_llvm_destroy_variant(struct draw_gs_llvm_variant *variant)
 {
@@ -2428,7 +2658,11 @@ draw_gs_llvm_destroy_variant(struct draw_gs_llvm_variant *variant)
                     variant->shader->variants_cached, llvm->nr_gs_variants);
    }
 
-   gallivm_destroy(variant->gallivm);
+   if (variant->job)
+      lp_async_job_destroy(variant->job);
+   if (variant->gallivm)
+      gallivm_destroy(variant->gallivm);
+   lp_shared_code_reference(&variant->code, NULL);
 
    remove_from_list(&variant->list_item_local);
    variant->shader->variants_cached--;
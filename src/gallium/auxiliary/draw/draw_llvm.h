@@ -371,8 +371,17 @@ struct draw_gs_llvm_variant_list_item
 
 struct draw_llvm_variant
 {
+   /* Only valid while generating code, or while holding the quickly
+    * compiled code of a variant optimized in the background.
+    */
    struct gallivm_state *gallivm;
 
+   /* The generated code, shared with other contexts */
+   struct lp_shared_code *code;
+
+   /* Background compilation of the optimized code, if pending */
+   struct lp_async_job *job;
+
    /* LLVM JIT builder types */
    LLVMTypeRef context_ptr_type;
    LLVMTypeRef buffer_ptr_type;
@@ -395,8 +404,17 @@ struct draw_llvm_variant
 
 struct draw_gs_llvm_variant
 {
+   /* Only valid while generating code, or while holding the quickly
+    * compiled code of a variant optimized in the background.
+    */
    struct gallivm_state *gallivm;
 
+   /* The generated code, shared with other contexts */
+   struct lp_shared_code *code;
+
+   /* Background compilation of the optimized code, if pending */
+   struct lp_async_job *job;
+
    /* LLVM JIT builder types */
    LLVMTypeRef context_ptr_type;
    LLVMTypeRef vertex_header_ptr_type;
@@ -483,6 +501,9 @@ draw_llvm_create_variant(struct draw_llvm *llvm,
 void
 draw_llvm_destroy_variant(struct draw_llvm_variant *variant);
 
+void
+draw_llvm_update_variant_code(struct draw_llvm_variant *variant);
+
 struct draw_llvm_variant_key *
 draw_llvm_make_variant_key(struct draw_llvm *llvm, char *store);
 
@@ -498,6 +519,9 @@ draw_gs_llvm_create_variant(struct draw_llvm *llvm,
 void
 draw_gs_llvm_destroy_variant(struct draw_gs_llvm_variant *variant);
 
+void
+draw_gs_llvm_update_variant_code(struct draw_gs_llvm_variant *variant);
+
 struct draw_gs_llvm_variant_key *
 draw_gs_llvm_make_variant_key(struct draw_llvm *llvm, char *store);
 
@@ -46,6 +46,8 @@
 
 #include "tgsi/tgsi_scan.h"
 
+#include "draw_context.h"
+
 #ifdef HAVE_LLVM
 struct gallivm_state;
 #endif
@@ -326,6 +328,21 @@ struct draw_context
 
    struct draw_llvm *llvm;
 
+   /** Optional driver hooks for caching generated code, see
+    * draw_set_disk_cache_callbacks().
+    */
+   void *disk_cache_cookie;
+   draw_disk_cache_find_shader_func disk_cache_find_shader;
+   draw_disk_cache_insert_shader_func disk_cache_insert_shader;
+
+   /** Optional cache of generated code shared between contexts, see
+    * draw_set_shared_code_cache().
+    */
+   struct lp_code_cache *code_cache;
+
+   /** Optional compiler threads, see draw_set_async_compiler(). */
+   struct lp_async_compiler *async_compiler;
+
    /** Texture sampler and sampler view state.
     * Note that we have arrays indexed by shader type.  At this time
     * we only handle vertex and geometry shaders in the draw module, but
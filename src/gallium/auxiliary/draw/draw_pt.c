@@ -449,44 +449,24 @@ resolve_draw_info(const struct pipe_draw_info *raw_info,
 }
 
 /**
- * Draw vertex arrays.
- * This is the main entrypoint into the drawing module.  If drawing an indexed
- * primitive, the draw_set_indexes() function should have already been called
- * to specify the element/index buffer information.
+ * Set up the state shared by the draws of a draw_vbo() or draw_multi_draw()
+ * call.
+ *
+ * \return false if nothing can be drawn
  */
-void
-draw_vbo(struct draw_context *draw,
-         const struct pipe_draw_info *info)
+static boolean
+draw_begin(struct draw_context *draw, const struct pipe_draw_info *info)
 {
-   unsigned instance;
    unsigned index_limit;
-   unsigned count;
-   unsigned fpstate = util_fpstate_get();
-   struct pipe_draw_info resolved_info;
-
-   /* Make sure that denorms are treated like zeros. This is 
-    * the behavior required by D3D10. OpenGL doesn't care.
-    */
-   util_fpstate_set_denorms_to_zero(fpstate);
-
-   resolve_draw_info(info, &resolved_info, &(draw->pt.vertex_buffer[0]));
-   info = &resolved_info;
 
    assert(info->instance_count > 0);
    if (info->index_size)
       assert(draw->pt.user.elts);
 
-   count = info->count;
-
-   draw->pt.user.eltBias = info->index_bias;
    draw->pt.user.min_index = info->min_index;
    draw->pt.user.max_index = info->max_index;
    draw->pt.user.eltSize = info->index_size ? draw->pt.user.eltSizeIB : 0;
 
-   if (0)
-      debug_printf("draw_vbo(mode=%u start=%u count=%u):\n",
-                   info->mode, info->start, count);
-
    if (0)
       tgsi_dump(draw->vs.vertex_shader->state.tokens, 0);
 
@@ -512,9 +492,6 @@ draw_vbo(struct draw_context *draw,
       }
    }
 
-   if (0)
-      draw_print_arrays(draw, info->mode, info->start, MIN2(count, 20));
-
    index_limit = util_draw_max_index(draw->pt.vertex_buffer,
                                      draw->pt.vertex_element,
                                      draw->pt.nr_vertex_elements,
@@ -526,8 +503,7 @@ draw_vbo(struct draw_context *draw,
       if (index_limit == 0) {
          /* one of the buffers is too small to do any valid drawing */
          debug_warning("draw: VBO too small to draw anything\n");
-         util_fpstate_set(fpstate);
-         return;
+         return FALSE;
       }
    }
 
@@ -537,12 +513,42 @@ draw_vbo(struct draw_context *draw,
    }
 
    draw->pt.max_index = index_limit - 1;
-   draw->start_index = info->start;
 
    /*
     * TODO: We could use draw->pt.max_index to further narrow
     * the min_index/max_index hints given by the state tracker.
     */
+   return TRUE;
+}
+
+
+static void
+draw_end(struct draw_context *draw)
+{
+   /* If requested emit the pipeline statistics for this run */
+   if (draw->collect_statistics) {
+      draw->render->pipeline_statistics(draw->render, &draw->statistics);
+   }
+}
+
+
+/**
+ * Draw all the instances of one range.
+ */
+static void
+draw_instances(struct draw_context *draw, const struct pipe_draw_info *info)
+{
+   unsigned instance;
+
+   if (0)
+      debug_printf("draw_vbo(mode=%u start=%u count=%u):\n",
+                   info->mode, info->start, info->count);
+
+   if (0)
+      draw_print_arrays(draw, info->mode, info->start, MIN2(info->count, 20));
+
+   draw->pt.user.eltBias = info->index_bias;
+   draw->start_index = info->start;
 
    for (instance = 0; instance < info->instance_count; instance++) {
       unsigned instance_idx = instance + info->start_instance;
@@ -561,13 +567,81 @@ draw_vbo(struct draw_context *draw,
          draw_pt_arrays_restart(draw, info);
       }
       else {
-         draw_pt_arrays(draw, info->mode, info->start, count);
+         draw_pt_arrays(draw, info->mode, info->start, info->count);
       }
    }
+}
 
-   /* If requested emit the pipeline statistics for this run */
-   if (draw->collect_statistics) {
-      draw->render->pipeline_statistics(draw->render, &draw->statistics);
+
+/**
+ * Draw vertex arrays.
+ * This is the main entrypoint into the drawing module.  If drawing an indexed
+ * primitive, the draw_set_indexes() function should have already been called
+ * to specify the element/index buffer information.
+ */
+void
+draw_vbo(struct draw_context *draw,
+         const struct pipe_draw_info *info)
+{
+   unsigned fpstate = util_fpstate_get();
+   struct pipe_draw_info resolved_info;
+
+   /* Make sure that denorms are treated like zeros. This is 
+    * the behavior required by D3D10. OpenGL doesn't care.
+    */
+   util_fpstate_set_denorms_to_zero(fpstate);
+
+   resolve_draw_info(info, &resolved_info, &(draw->pt.vertex_buffer[0]));
+   info = &resolved_info;
+
+   if (draw_begin(draw, info)) {
+      draw_instances(draw, info);
+      draw_end(draw);
+   }
+
+   util_fpstate_set(fpstate);
+}
+
+
+/**
+ * Draw several ranges sharing the rest of \p info, with the semantics of
+ * pipe_context::multi_draw.  The setup done by draw_vbo() for every call is
+ * only done once here, and the front end and middle end stay prepared
+ * across the draws since the primitive type doesn't change.
+ */
+void
+draw_multi_draw(struct draw_context *draw,
+                const struct pipe_draw_info *info,
+                const struct pipe_draw_start_count *draws,
+                unsigned num_draws)
+{
+   unsigned fpstate = util_fpstate_get();
+   struct pipe_draw_info draw_info = *info;
+   unsigned i;
+
+   assert(!info->indirect);
+   assert(!info->count_from_stream_output);
+
+   util_fpstate_set_denorms_to_zero(fpstate);
+
+   if (draw_begin(draw, info)) {
+      for (i = 0; i < num_draws; i++) {
+         draw_info.start = draws[i].start;
+         draw_info.count = draws[i].count;
+         draw_info.drawid = info->drawid + i;
+
+         if (info->index_size) {
+            draw_info.index_bias = draws[i].index_bias;
+         } else {
+            draw_info.index_bias = 0;
+            draw->pt.user.min_index = draws[i].start;
+            draw->pt.user.max_index = draws[i].start + draws[i].count - 1;
+         }
+
+         draw_instances(draw, &draw_info);
+      }
+      draw_end(draw);
    }
+
    util_fpstate_set(fpstate);
 }
@@ -25,9 +25,11 @@
  *
  **************************************************************************/
 
+#include "util/u_cpu_detect.h"
 #include "util/u_math.h"
 #include "util/u_memory.h"
 #include "util/u_prim.h"
+#include "util/u_queue.h"
 #include "draw/draw_context.h"
 #include "draw/draw_gs.h"
 #include "draw/draw_vbuf.h"
@@ -40,6 +42,42 @@
 #include "gallivm/lp_bld_debug.h"
 
 
+/**
+ * Fetches with at least twice this many vertices have their vertex
+ * shading split into chunks which are run in parallel by the worker
+ * threads.  Below that the queueing overhead outweighs the gain.
+ */
+#define LLVM_VS_MIN_CHUNK_SIZE 256
+
+/** Upper bound on the number of vertex shading worker threads */
+#define LLVM_VS_MAX_THREADS 16
+
+/**
+ * Max fetch count when the prim pipeline is needed.  The vertex buffer
+ * is only temporary in that case, so allow bigger segments when there
+ * are worker threads to spread them over.
+ */
+#define LLVM_MAX_FETCH_VERTICES 4096
+#define LLVM_MAX_FETCH_VERTICES_PARALLEL 16384
+
+
+struct llvm_middle_end;
+
+/**
+ * One chunk of a fetch, shaded by a worker thread.
+ */
+struct llvm_vs_job {
+   struct llvm_middle_end *fpme;
+   struct vertex_header *verts;
+   const unsigned *elts;
+   unsigned count;
+   unsigned start_or_maxelt;
+   unsigned vid_base;
+   boolean clipped;
+   struct util_queue_fence fence;
+};
+
+
 struct llvm_middle_end {
    struct draw_pt_middle_end base;
    struct draw_context *draw;
@@ -57,6 +95,13 @@ struct llvm_middle_end {
 
    struct draw_llvm *llvm;
    struct draw_llvm_variant *current_variant;
+
+   /* Worker threads for vertex shading of large fetches.  The queue is
+    * only started by the first fetch big enough to be split.
+    */
+   unsigned num_vs_threads;
+   struct util_queue vs_queue;
+   struct llvm_vs_job vs_jobs[LLVM_VS_MAX_THREADS];
 };
 
 
@@ -179,11 +224,12 @@ llvm_middle_end_prepare( struct draw_pt_middle_end *middle,
       draw_pt_emit_prepare( fpme->emit, out_prim,
                             max_vertices );
 
-      *max_vertices = MAX2( *max_vertices, 4096 );
+      *max_vertices = MAX2( *max_vertices, LLVM_MAX_FETCH_VERTICES );
    }
    else {
       /* limit max fetches by limiting max_vertices */
-      *max_vertices = 4096;
+      *max_vertices = fpme->num_vs_threads ? LLVM_MAX_FETCH_VERTICES_PARALLEL :
+                                             LLVM_MAX_FETCH_VERTICES;
    }
 
    /* Get the number of float[4] attributes per vertex.
@@ -347,6 +393,126 @@ emit(struct pt_emit *emit,
 }
 
 
+static boolean
+llvm_middle_end_shade(struct llvm_middle_end *fpme,
+                      struct vertex_header *verts,
+                      unsigned count,
+                      unsigned start_or_maxelt,
+                      unsigned vid_base,
+                      const unsigned *elts)
+{
+   struct draw_context *draw = fpme->draw;
+
+   return fpme->current_variant->jit_func(&fpme->llvm->jit_context,
+                                          verts,
+                                          draw->pt.user.vbuffer,
+                                          count,
+                                          start_or_maxelt,
+                                          fpme->vertex_size,
+                                          draw->pt.vertex_buffer,
+                                          draw->instance_id,
+                                          vid_base,
+                                          draw->start_instance,
+                                          elts);
+}
+
+
+static void
+llvm_vs_job_execute(void *data, int thread_index)
+{
+   struct llvm_vs_job *job = (struct llvm_vs_job *) data;
+
+   job->clipped = llvm_middle_end_shade(job->fpme, job->verts, job->count,
+                                        job->start_or_maxelt, job->vid_base,
+                                        job->elts);
+}
+
+
+static boolean
+llvm_middle_end_init_vs_queue(struct llvm_middle_end *fpme)
+{
+   unsigned i;
+
+   if (util_queue_is_initialized(&fpme->vs_queue))
+      return TRUE;
+
+   if (!util_queue_init(&fpme->vs_queue, "drawvs", LLVM_VS_MAX_THREADS,
+                        fpme->num_vs_threads, 0)) {
+      return FALSE;
+   }
+
+   for (i = 0; i < ARRAY_SIZE(fpme->vs_jobs); i++)
+      util_queue_fence_init(&fpme->vs_jobs[i].fence);
+
+   return TRUE;
+}
+
+
+/**
+ * Run the vertex shader over a large fetch by splitting it into chunks
+ * shaded concurrently by the worker threads and the calling thread.
+ *
+ * Every chunk writes its own contiguous slice of the output vertex
+ * buffer, so the result is identical to a single jit_func call and the
+ * following stages still see the vertices in order.  Chunk sizes are a
+ * multiple of the shader's SoA vector length since the generated code
+ * stores whole vectors past the end of the last partial one.
+ */
+static boolean
+llvm_middle_end_shade_parallel(struct llvm_middle_end *fpme,
+                               struct vertex_header *verts,
+                               boolean linear,
+                               unsigned count,
+                               unsigned start_or_maxelt,
+                               unsigned vid_base,
+                               const unsigned *elts)
+{
+   const unsigned vector_length = lp_native_vector_width / 32;
+   unsigned num_chunks, chunk_size, offset, i;
+   boolean clipped;
+
+   if (!llvm_middle_end_init_vs_queue(fpme)) {
+      fpme->num_vs_threads = 0;
+      return llvm_middle_end_shade(fpme, verts, count, start_or_maxelt,
+                                   vid_base, elts);
+   }
+
+   num_chunks = MIN2(fpme->num_vs_threads + 1, count / LLVM_VS_MIN_CHUNK_SIZE);
+   chunk_size = align(DIV_ROUND_UP(count, num_chunks), vector_length);
+   num_chunks = DIV_ROUND_UP(count, chunk_size);
+
+   /* The calling thread shades the first chunk, the workers the rest. */
+   for (i = 1, offset = chunk_size; i < num_chunks; i++, offset += chunk_size) {
+      struct llvm_vs_job *job = &fpme->vs_jobs[i - 1];
+
+      job->fpme = fpme;
+      job->verts = (struct vertex_header *)
+         ((char *) verts + offset * fpme->vertex_size);
+      job->count = MIN2(chunk_size, count - offset);
+      job->start_or_maxelt = linear ? start_or_maxelt + offset :
+                                      start_or_maxelt;
+      job->vid_base = vid_base;
+      job->elts = elts ? elts + offset : NULL;
+      job->clipped = FALSE;
+
+      util_queue_add_job(&fpme->vs_queue, job, &job->fence,
+                         llvm_vs_job_execute, NULL);
+   }
+
+   clipped = llvm_middle_end_shade(fpme, verts, MIN2(chunk_size, count),
+                                   start_or_maxelt, vid_base, elts);
+
+   for (i = 1; i < num_chunks; i++) {
+      struct llvm_vs_job *job = &fpme->vs_jobs[i - 1];
+
+      util_queue_fence_wait(&job->fence);
+      clipped |= job->clipped;
+   }
+
+   return clipped;
+}
+
+
 static void
 llvm_pipeline_generic(struct draw_pt_middle_end *middle,
                       const struct draw_fetch_info *fetch_info,
@@ -397,17 +563,23 @@ llvm_pipeline_generic(struct draw_pt_middle_end *middle,
       vid_base = draw->pt.user.eltBias;
       elts = fetch_info->elts;
    }
-   clipped = fpme->current_variant->jit_func(&fpme->llvm->jit_context,
-                                             llvm_vert_info.verts,
-                                             draw->pt.user.vbuffer,
-                                             fetch_info->count,
-                                             start_or_maxelt,
-                                             fpme->vertex_size,
-                                             draw->pt.vertex_buffer,
-                                             draw->instance_id,
-                                             vid_base,
-                                             draw->start_instance,
-                                             elts);
+
+   /* Pick up vertex shader code optimized in the background. */
+   draw_llvm_update_variant_code(fpme->current_variant);
+
+   if (fpme->num_vs_threads &&
+       fetch_info->count >= 2 * LLVM_VS_MIN_CHUNK_SIZE) {
+      clipped = llvm_middle_end_shade_parallel(fpme, llvm_vert_info.verts,
+                                               fetch_info->linear,
+                                               fetch_info->count,
+                                               start_or_maxelt,
+                                               vid_base, elts);
+   }
+   else {
+      clipped = llvm_middle_end_shade(fpme, llvm_vert_info.verts,
+                                      fetch_info->count,
+                                      start_or_maxelt, vid_base, elts);
+   }
 
    /* Finished with fetch and vs:
     */
@@ -597,6 +769,13 @@ static void
 llvm_middle_end_destroy(struct draw_pt_middle_end *middle)
 {
    struct llvm_middle_end *fpme = llvm_middle_end(middle);
+   unsigned i;
+
+   if (util_queue_is_initialized(&fpme->vs_queue)) {
+      util_queue_destroy(&fpme->vs_queue);
+      for (i = 0; i < ARRAY_SIZE(fpme->vs_jobs); i++)
+         util_queue_fence_destroy(&fpme->vs_jobs[i].fence);
+   }
 
    if (fpme->fetch)
       draw_pt_fetch_destroy( fpme->fetch );
@@ -658,6 +837,12 @@ draw_pt_fetch_pipeline_or_emit_llvm(struct draw_context *draw)
 
    fpme->current_variant = NULL;
 
+   /* Leave one cpu for the calling thread, which shades a chunk too. */
+   fpme->num_vs_threads =
+      debug_get_num_option("DRAW_VS_THREADS",
+                           MIN2(util_cpu_caps.nr_cpus, LLVM_VS_MAX_THREADS + 1) - 1);
+   fpme->num_vs_threads = MIN2(fpme->num_vs_threads, LLVM_VS_MAX_THREADS);
+
    return &fpme->base;
 
  fail:
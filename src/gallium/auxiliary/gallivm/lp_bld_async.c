@@ -0,0 +1,277 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+
+#include "util/u_atomic.h"
+#include "util/u_memory.h"
+#include "util/u_string.h"
+
+#include "lp_bld_init.h"
+#include "lp_bld_type.h"
+#include "lp_bld_async.h"
+
+#include <llvm-c/BitReader.h>
+#include <llvm-c/BitWriter.h>
+
+
+struct lp_async_compiler
+{
+   struct util_queue queue;
+
+   struct lp_code_cache *code_cache;
+   lp_async_cache_insert_func cache_insert;
+   void *cache_cookie;
+
+   unsigned num_pending;
+   unsigned num_compiled;
+};
+
+
+/**
+ * Create a pool of num_threads compiler threads.
+ * The optimized code is published in code_cache, and, unless it embeds
+ * process-specific addresses, passed to cache_insert if not NULL.
+ * \return NULL if num_threads is zero or on failure
+ */
+struct lp_async_compiler *
+lp_async_compiler_create(unsigned num_threads,
+                         struct lp_code_cache *code_cache,
+                         lp_async_cache_insert_func cache_insert,
+                         void *cache_cookie)
+{
+   struct lp_async_compiler *compiler;
+
+   if (!num_threads)
+      return NULL;
+
+   compiler = CALLOC_STRUCT(lp_async_compiler);
+   if (!compiler)
+      return NULL;
+
+   if (!util_queue_init(&compiler->queue, "lpjit", 32, num_threads,
+                        UTIL_QUEUE_INIT_RESIZE_IF_FULL |
+                        UTIL_QUEUE_INIT_USE_MINIMUM_PRIORITY)) {
+      FREE(compiler);
+      return NULL;
+   }
+
+   compiler->code_cache = code_cache;
+   compiler->cache_insert = cache_insert;
+   compiler->cache_cookie = cache_cookie;
+
+   return compiler;
+}
+
+
+/**
+ * Destroy the compiler pool.  All jobs must have been destroyed already.
+ */
+void
+lp_async_compiler_destroy(struct lp_async_compiler *compiler)
+{
+   if (!compiler)
+      return;
+
+   assert(!compiler->num_pending);
+   util_queue_destroy(&compiler->queue);
+   FREE(compiler);
+}
+
+
+/** Number of jobs queued or being compiled. */
+unsigned
+lp_async_compiler_num_pending(struct lp_async_compiler *compiler)
+{
+   return compiler ? p_atomic_read(&compiler->num_pending) : 0;
+}
+
+
+/** Number of modules compiled in the background so far. */
+unsigned
+lp_async_compiler_num_compiled(struct lp_async_compiler *compiler)
+{
+   return compiler ? p_atomic_read(&compiler->num_compiled) : 0;
+}
+
+
+/**
+ * Compiler thread function: rebuild the module from its bitcode in a
+ * private LLVM context, optimize and compile it.
+ */
+static void
+async_job_execute(void *data, int thread_index)
+{
+   struct lp_async_job *job = (struct lp_async_job *) data;
+   struct lp_async_compiler *compiler = job->compiler;
+   struct lp_cached_code cached = { 0 };
+   func_pointer functions[LP_SHARED_CODE_MAX_FUNCTIONS] = { NULL };
+   struct gallivm_state *gallivm;
+   LLVMContextRef context;
+   unsigned nr_instrs;
+   unsigned i;
+
+   context = LLVMContextCreate();
+   if (!context)
+      goto done;
+
+   gallivm = gallivm_create(job->module_name, context, &cached);
+   if (!gallivm) {
+      LLVMContextDispose(context);
+      goto done;
+   }
+
+   LLVMDisposeModule(gallivm->module);
+   gallivm->module = NULL;
+#if HAVE_LLVM >= 0x0400
+   if (LLVMParseBitcodeInContext2(context, job->bitcode, &gallivm->module)) {
+#else
+   if (LLVMParseBitcodeInContext(context, job->bitcode, &gallivm->module,
+                                 NULL)) {
+#endif
+      gallivm_destroy(gallivm);
+      LLVMContextDispose(context);
+      goto done;
+   }
+
+   gallivm_compile_module(gallivm);
+
+   nr_instrs = lp_build_count_ir_module(gallivm->module);
+
+   for (i = 0; i < job->num_functions; i++) {
+      if (job->function_names[i]) {
+         LLVMValueRef func = LLVMGetNamedFunction(gallivm->module,
+                                                  job->function_names[i]);
+         assert(func);
+         if (func)
+            functions[i] = gallivm_jit_function(gallivm, func);
+      }
+   }
+
+   cached.dont_cache = cached.dont_cache || job->dont_cache;
+   if (compiler->cache_insert)
+      compiler->cache_insert(compiler->cache_cookie, &cached, job->key);
+   gallivm_free_ir(gallivm);
+   free(cached.data);
+
+   /* The generated code doesn't need the context anymore. */
+   LLVMContextDispose(context);
+
+   job->code = lp_code_cache_add(compiler->code_cache, job->key, gallivm,
+                                 functions, job->num_functions, nr_instrs);
+   p_atomic_inc(&compiler->num_compiled);
+
+done:
+   job->done = TRUE;
+   p_atomic_dec(&compiler->num_pending);
+}
+
+
+/**
+ * Queue an optimized compilation of gallivm's module, whose IR must be
+ * complete, and switch gallivm itself to quick compilation.
+ *
+ * The functions are looked up by name in the optimized module, so they
+ * must have unique names.  NULL entries are allowed, and result in NULL
+ * code functions.
+ *
+ * \return the job, or NULL on failure, in which case gallivm is left
+ *         untouched
+ */
+struct lp_async_job *
+lp_async_compile(struct lp_async_compiler *compiler,
+                 struct gallivm_state *gallivm,
+                 const LLVMValueRef *functions,
+                 unsigned num_functions,
+                 const unsigned char key[20])
+{
+   struct lp_async_job *job;
+   unsigned i;
+
+   assert(num_functions <= LP_SHARED_CODE_MAX_FUNCTIONS);
+   assert(!gallivm->compiled);
+
+   job = CALLOC_STRUCT(lp_async_job);
+   if (!job)
+      return NULL;
+
+   job->bitcode = LLVMWriteBitcodeToMemoryBuffer(gallivm->module);
+   if (!job->bitcode) {
+      FREE(job);
+      return NULL;
+   }
+
+   job->compiler = compiler;
+   job->module_name = strdup(gallivm->module_name ?
+                             gallivm->module_name : "async");
+   for (i = 0; i < num_functions; i++) {
+      if (functions[i])
+         job->function_names[i] = strdup(LLVMGetValueName(functions[i]));
+   }
+   job->num_functions = num_functions;
+   memcpy(job->key, key, sizeof job->key);
+
+   /* Only the optimized code goes to the persistent cache. */
+   if (gallivm->cache) {
+      job->dont_cache = gallivm->cache->dont_cache;
+      gallivm->cache = NULL;
+   } else {
+      job->dont_cache = TRUE;
+   }
+   gallivm->quick = TRUE;
+
+   util_queue_fence_init(&job->fence);
+   p_atomic_inc(&compiler->num_pending);
+   util_queue_add_job(&compiler->queue, job, &job->fence,
+                      async_job_execute, NULL);
+
+   return job;
+}
+
+
+/**
+ * Destroy a job, cancelling it if it hasn't started yet, and waiting for
+ * it otherwise.  Drops the job's reference to the optimized code.
+ */
+void
+lp_async_job_destroy(struct lp_async_job *job)
+{
+   unsigned i;
+
+   util_queue_drop_job(&job->compiler->queue, &job->fence);
+   if (!job->done)
+      p_atomic_dec(&job->compiler->num_pending);
+
+   lp_shared_code_reference(&job->code, NULL);
+
+   util_queue_fence_destroy(&job->fence);
+   LLVMDisposeMemoryBuffer(job->bitcode);
+   for (i = 0; i < job->num_functions; i++)
+      free(job->function_names[i]);
+   free(job->module_name);
+   FREE(job);
+}
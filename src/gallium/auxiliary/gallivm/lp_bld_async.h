@@ -0,0 +1,126 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+/**
+ * @file
+ * Background compilation of optimized code.
+ *
+ * Optimizing and compiling a big shader can take long enough to cause
+ * visible hitches when done on the draw path.  lp_async_compile() instead
+ * hands a copy of the module, as bitcode, to a pool of compiler threads
+ * and marks the original module for quick compilation without
+ * optimizations.  The caller uses the quickly compiled code until the
+ * optimized code shows up in the job, and then switches over to it.
+ */
+
+#ifndef LP_BLD_ASYNC_H
+#define LP_BLD_ASYNC_H
+
+
+#include "pipe/p_compiler.h"
+#include "util/u_queue.h"
+
+#include "lp_bld.h"
+#include "lp_bld_code_cache.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+struct gallivm_state;
+struct lp_cached_code;
+struct lp_async_compiler;
+
+
+/**
+ * Stores newly compiled object code in a persistent cache, see
+ * lp_async_compiler_create().
+ */
+typedef void (*lp_async_cache_insert_func)(void *cookie,
+                                           struct lp_cached_code *cache,
+                                           unsigned char key[20]);
+
+
+struct lp_async_job
+{
+   struct util_queue_fence fence;
+   struct lp_async_compiler *compiler;
+
+   char *module_name;
+   LLVMMemoryBufferRef bitcode;
+   char *function_names[LP_SHARED_CODE_MAX_FUNCTIONS];
+   unsigned num_functions;
+   unsigned char key[20];
+   boolean dont_cache;
+   boolean done;
+
+   /** The optimized code, valid once the job is done; NULL on failure */
+   struct lp_shared_code *code;
+};
+
+
+struct lp_async_compiler *
+lp_async_compiler_create(unsigned num_threads,
+                         struct lp_code_cache *code_cache,
+                         lp_async_cache_insert_func cache_insert,
+                         void *cache_cookie);
+
+void
+lp_async_compiler_destroy(struct lp_async_compiler *compiler);
+
+unsigned
+lp_async_compiler_num_pending(struct lp_async_compiler *compiler);
+
+unsigned
+lp_async_compiler_num_compiled(struct lp_async_compiler *compiler);
+
+struct lp_async_job *
+lp_async_compile(struct lp_async_compiler *compiler,
+                 struct gallivm_state *gallivm,
+                 const LLVMValueRef *functions,
+                 unsigned num_functions,
+                 const unsigned char key[20]);
+
+void
+lp_async_job_destroy(struct lp_async_job *job);
+
+
+static inline boolean
+lp_async_job_is_done(struct lp_async_job *job)
+{
+   return util_queue_fence_is_signalled(&job->fence);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LP_BLD_ASYNC_H */
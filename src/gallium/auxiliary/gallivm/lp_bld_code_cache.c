@@ -0,0 +1,269 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+#include "c11/threads.h"
+#include "util/hash_table.h"
+#include "util/u_inlines.h"
+#include "util/u_memory.h"
+
+#include "lp_bld_init.h"
+#include "lp_bld_code_cache.h"
+
+
+struct lp_code_cache
+{
+   mtx_t mutex;
+
+   /** key -> struct lp_shared_code */
+   struct hash_table *entries;
+
+   /** Cached entries, most recently used first */
+   struct list_head lru;
+
+   unsigned num_entries;
+   unsigned max_entries;
+
+   unsigned hits;
+   unsigned misses;
+   unsigned evictions;
+};
+
+
+static uint32_t
+key_hash(const void *key)
+{
+   /* The keys are SHA-1 digests already. */
+   uint32_t hash;
+   memcpy(&hash, key, sizeof hash);
+   return hash;
+}
+
+
+static bool
+key_equal(const void *a, const void *b)
+{
+   return memcmp(a, b, 20) == 0;
+}
+
+
+static void
+shared_code_destroy(struct lp_shared_code *code)
+{
+   assert(!code->cached);
+   gallivm_destroy(code->gallivm);
+   FREE(code);
+}
+
+
+void
+lp_shared_code_reference(struct lp_shared_code **ptr,
+                         struct lp_shared_code *code)
+{
+   struct lp_shared_code *old = *ptr;
+
+   if (pipe_reference(old ? &old->reference : NULL,
+                      code ? &code->reference : NULL)) {
+      shared_code_destroy(old);
+   }
+   *ptr = code;
+}
+
+
+/**
+ * Drop the cache's reference to an entry.  Must be called with the
+ * mutex held.  The code itself lives on while variants still use it.
+ */
+static void
+evict_entry(struct lp_code_cache *cache, struct lp_shared_code *code)
+{
+   struct hash_entry *entry;
+
+   entry = _mesa_hash_table_search(cache->entries, code->key);
+   assert(entry);
+   _mesa_hash_table_remove(cache->entries, entry);
+
+   LIST_DEL(&code->lru);
+   code->cached = FALSE;
+   cache->num_entries--;
+
+   lp_shared_code_reference(&code, NULL);
+}
+
+
+struct lp_code_cache *
+lp_code_cache_create(unsigned max_entries)
+{
+   struct lp_code_cache *cache;
+
+   cache = CALLOC_STRUCT(lp_code_cache);
+   if (!cache)
+      return NULL;
+
+   cache->entries = _mesa_hash_table_create(NULL, key_hash, key_equal);
+   if (!cache->entries) {
+      FREE(cache);
+      return NULL;
+   }
+
+   (void) mtx_init(&cache->mutex, mtx_plain);
+   LIST_INITHEAD(&cache->lru);
+   cache->max_entries = MAX2(max_entries, 1);
+
+   return cache;
+}
+
+
+void
+lp_code_cache_destroy(struct lp_code_cache *cache)
+{
+   if (!cache)
+      return;
+
+   while (!LIST_IS_EMPTY(&cache->lru)) {
+      struct lp_shared_code *code =
+         LIST_ENTRY(struct lp_shared_code, cache->lru.next, lru);
+      evict_entry(cache, code);
+   }
+
+   _mesa_hash_table_destroy(cache->entries, NULL);
+   mtx_destroy(&cache->mutex);
+   FREE(cache);
+}
+
+
+/**
+ * Look up the code generated for key.
+ * \return a new reference to the code, or NULL if not cached
+ */
+struct lp_shared_code *
+lp_code_cache_find(struct lp_code_cache *cache,
+                   const unsigned char key[20])
+{
+   struct lp_shared_code *code = NULL;
+   struct hash_entry *entry;
+
+   mtx_lock(&cache->mutex);
+
+   entry = _mesa_hash_table_search(cache->entries, key);
+   if (entry) {
+      struct lp_shared_code *found = entry->data;
+
+      /* move to the head of the LRU list */
+      LIST_DEL(&found->lru);
+      LIST_ADD(&found->lru, &cache->lru);
+
+      lp_shared_code_reference(&code, found);
+      cache->hits++;
+   } else {
+      cache->misses++;
+   }
+
+   mtx_unlock(&cache->mutex);
+
+   return code;
+}
+
+
+/**
+ * Add newly generated code to the cache, taking ownership of gallivm,
+ * whose IR must have been freed already.
+ *
+ * If another context added code for the same key in the meantime, that
+ * code is returned instead and gallivm is destroyed.
+ *
+ * \return a new reference to the code, or NULL on allocation failure
+ *         (in which case gallivm is destroyed too)
+ */
+struct lp_shared_code *
+lp_code_cache_add(struct lp_code_cache *cache,
+                  const unsigned char key[20],
+                  struct gallivm_state *gallivm,
+                  const func_pointer *functions,
+                  unsigned num_functions,
+                  unsigned nr_instrs)
+{
+   struct lp_shared_code *code, *ret = NULL;
+   struct hash_entry *entry;
+   unsigned i;
+
+   assert(num_functions <= LP_SHARED_CODE_MAX_FUNCTIONS);
+
+   code = CALLOC_STRUCT(lp_shared_code);
+   if (!code) {
+      gallivm_destroy(gallivm);
+      return NULL;
+   }
+
+   pipe_reference_init(&code->reference, 1);
+   memcpy(code->key, key, sizeof code->key);
+   code->gallivm = gallivm;
+   for (i = 0; i < num_functions; i++)
+      code->functions[i] = functions[i];
+   code->nr_instrs = nr_instrs;
+
+   mtx_lock(&cache->mutex);
+
+   entry = _mesa_hash_table_search(cache->entries, key);
+   if (entry) {
+      lp_shared_code_reference(&ret, entry->data);
+      mtx_unlock(&cache->mutex);
+      lp_shared_code_reference(&code, NULL);
+      return ret;
+   }
+
+   /* The cache keeps the initial reference. */
+   _mesa_hash_table_insert(cache->entries, code->key, code);
+   LIST_ADD(&code->lru, &cache->lru);
+   code->cached = TRUE;
+   cache->num_entries++;
+   lp_shared_code_reference(&ret, code);
+
+   while (cache->num_entries > cache->max_entries) {
+      struct lp_shared_code *oldest =
+         LIST_ENTRY(struct lp_shared_code, cache->lru.prev, lru);
+      evict_entry(cache, oldest);
+      cache->evictions++;
+   }
+
+   mtx_unlock(&cache->mutex);
+
+   return ret;
+}
+
+
+void
+lp_code_cache_get_stats(struct lp_code_cache *cache,
+                        unsigned *hits, unsigned *misses,
+                        unsigned *evictions)
+{
+   mtx_lock(&cache->mutex);
+   *hits = cache->hits;
+   *misses = cache->misses;
+   *evictions = cache->evictions;
+   mtx_unlock(&cache->mutex);
+}
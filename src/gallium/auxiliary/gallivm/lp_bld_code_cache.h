@@ -0,0 +1,112 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * @file
+ * Thread-safe cache of JIT-compiled code, shared between contexts.
+ *
+ * Generated code doesn't depend on the LLVM context it was built in, so
+ * once compiled it can be used by any context of the same screen.  Each
+ * entry owns the gallivm_state holding the code and is reference counted:
+ * the cache holds one reference while the entry is cached, and every
+ * shader variant using the code holds another.  When the cache is full
+ * the least recently used entries are dropped from it, and their code is
+ * freed once the last variant using it goes away.
+ */
+
+#ifndef LP_BLD_CODE_CACHE_H
+#define LP_BLD_CODE_CACHE_H
+
+
+#include "pipe/p_compiler.h"
+#include "pipe/p_state.h"
+#include "util/list.h"
+#include "util/u_pointer.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+struct gallivm_state;
+struct lp_code_cache;
+
+
+#define LP_SHARED_CODE_MAX_FUNCTIONS 2
+
+
+struct lp_shared_code
+{
+   struct pipe_reference reference;
+
+   /** SHA-1 of everything the code was generated from */
+   unsigned char key[20];
+
+   struct gallivm_state *gallivm;
+   func_pointer functions[LP_SHARED_CODE_MAX_FUNCTIONS];
+   unsigned nr_instrs;
+
+   /* Protected by the cache mutex */
+   struct list_head lru;
+   boolean cached;
+};
+
+
+struct lp_code_cache *
+lp_code_cache_create(unsigned max_entries);
+
+void
+lp_code_cache_destroy(struct lp_code_cache *cache);
+
+struct lp_shared_code *
+lp_code_cache_find(struct lp_code_cache *cache,
+                   const unsigned char key[20]);
+
+struct lp_shared_code *
+lp_code_cache_add(struct lp_code_cache *cache,
+                  const unsigned char key[20],
+                  struct gallivm_state *gallivm,
+                  const func_pointer *functions,
+                  unsigned num_functions,
+                  unsigned nr_instrs);
+
+void
+lp_code_cache_get_stats(struct lp_code_cache *cache,
+                        unsigned *hits, unsigned *misses,
+                        unsigned *evictions);
+
+void
+lp_shared_code_reference(struct lp_shared_code **ptr,
+                         struct lp_shared_code *code);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LP_BLD_CODE_CACHE_H */
@@ -54,6 +54,11 @@ struct lp_build_context;
 
 #define LP_BUILD_FORMAT_CACHE_SIZE 128
 
+/*
+ * Largest block dimension of cacheable formats (ASTC 12x12).
+ */
+#define LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM 12
+
 /*
  * Note: cache_data needs 16 byte alignment.
  */
@@ -165,6 +170,9 @@ lp_build_fetch_subsampled_rgba_aos(struct gallivm_state *gallivm,
                                    LLVMValueRef j);
 
 
+boolean
+lp_build_format_cacheable(const struct util_format_description *format_desc);
+
 LLVMValueRef
 lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
                              const struct util_format_description *format_desc,
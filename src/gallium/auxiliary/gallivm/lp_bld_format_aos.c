@@ -725,10 +725,10 @@ lp_build_fetch_rgba_aos(struct gallivm_state *gallivm,
    }
 
    /*
-    * s3tc rgb formats
+    * block compressed formats (s3tc, etc, bptc, astc) through the cache
     */
 
-   if (format_desc->layout == UTIL_FORMAT_LAYOUT_S3TC && cache) {
+   if (cache && lp_build_format_cacheable(format_desc)) {
       struct lp_type tmp_type;
       LLVMValueRef tmp;
 
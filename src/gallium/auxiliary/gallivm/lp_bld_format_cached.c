@@ -32,7 +32,9 @@
 #include "lp_bld_flow.h"
 #include "lp_bld_swizzle.h"
 
+#include "util/u_format.h"
 #include "util/u_math.h"
+#include "util/u_memory.h"
 
 
 /**
@@ -42,8 +44,9 @@
  * Especially for bilinear filtering, texel reuse is very high hence even
  * a small cache helps.
  * The elements in the cache are the decoded blocks - currently things
- * are restricted to formats which are 4x4 block based, and the decoded
- * texels must fit into 4x8 bits.
+ * are restricted to formats whose decoded texels fit into 4x8 bits.
+ * Each cache line holds 4x4 texels, formats with bigger blocks (ASTC)
+ * are cached per 4x4 subtile.
  * The cache is direct mapped so hitrates aren't all that great and cache
  * thrashing could happen.
  *
@@ -75,35 +78,19 @@ update_cache_access(struct gallivm_state *gallivm,
 
 
 static void
-store_cached_block(struct gallivm_state *gallivm,
-                   LLVMValueRef *col,
-                   LLVMValueRef tag_value,
-                   LLVMValueRef hash_index,
-                   LLVMValueRef cache)
+store_cached_tag(struct gallivm_state *gallivm,
+                 LLVMValueRef tag_value,
+                 LLVMValueRef hash_index,
+                 LLVMValueRef cache)
 {
    LLVMBuilderRef builder = gallivm->builder;
    LLVMValueRef ptr, indices[3];
-   LLVMTypeRef type_ptr4x32;
-   unsigned count;
 
-   type_ptr4x32 = LLVMPointerType(LLVMVectorType(LLVMInt32TypeInContext(gallivm->context), 4), 0);
    indices[0] = lp_build_const_int32(gallivm, 0);
    indices[1] = lp_build_const_int32(gallivm, LP_BUILD_FORMAT_CACHE_MEMBER_TAGS);
    indices[2] = hash_index;
    ptr = LLVMBuildGEP(builder, cache, indices, ARRAY_SIZE(indices), "");
    LLVMBuildStore(builder, tag_value, ptr);
-
-   indices[1] = lp_build_const_int32(gallivm, LP_BUILD_FORMAT_CACHE_MEMBER_DATA);
-   hash_index = LLVMBuildMul(builder, hash_index,
-                             lp_build_const_int32(gallivm, 16), "");
-   for (count = 0; count < 4; count++) {
-      indices[2] = hash_index;
-      ptr = LLVMBuildGEP(builder, cache, indices, ARRAY_SIZE(indices), "");
-      ptr = LLVMBuildBitCast(builder, ptr, type_ptr4x32, "");
-      LLVMBuildStore(builder, col[count], ptr);
-      hash_index = LLVMBuildAdd(builder, hash_index,
-                                lp_build_const_int32(gallivm, 4), "");
-   }
 }
 
 
@@ -139,10 +126,44 @@ lookup_tag_data(struct gallivm_state *gallivm,
 }
 
 
+/**
+ * Decode a whole block and copy the 4x4 texel subtile starting at (x, y)
+ * into dst (with a row stride of 16 bytes).
+ * Used for formats with blocks larger than 4x4 (ASTC), which are cached
+ * as a number of independent 4x4 subtiles.
+ */
+static void
+fill_cached_subtile(const struct util_format_description *format_desc,
+                    uint8_t *dst,
+                    const uint8_t *src,
+                    unsigned x,
+                    unsigned y)
+{
+   const unsigned bw = format_desc->block.width;
+   const unsigned bh = format_desc->block.height;
+   uint8_t tmp[LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM *
+               LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM * 4];
+   unsigned j;
+
+   assert(bw <= LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM);
+   assert(bh <= LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM);
+
+   format_desc->unpack_rgba_8unorm(tmp, bw * 4, src, 0, bw, bh);
+
+   for (j = 0; j < 4 && y + j < bh; ++j) {
+      memcpy(dst + j * 16, tmp + ((y + j) * bw + x) * 4,
+             MIN2(4, bw - x) * 4);
+   }
+}
+
+
 static void
 update_cached_block(struct gallivm_state *gallivm,
                     const struct util_format_description *format_desc,
                     LLVMValueRef ptr_addr,
+                    LLVMValueRef subtile_x,
+                    LLVMValueRef subtile_y,
+                    LLVMValueRef tag_value,
                     LLVMValueRef hash_index,
                     LLVMValueRef cache)
 
@@ -151,87 +172,98 @@ update_cached_block(struct gallivm_state *gallivm,
    LLVMTypeRef i8t = LLVMInt8TypeInContext(gallivm->context);
    LLVMTypeRef pi8t = LLVMPointerType(i8t, 0);
    LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
-   LLVMTypeRef i32x4 = LLVMVectorType(LLVMInt32TypeInContext(gallivm->context), 4);
-   LLVMValueRef function;
-   LLVMValueRef tag_value, tmp_ptr;
-   LLVMValueRef col[4];
-   unsigned i, j;
+   LLVMValueRef function, dst_ptr, indices[3];
+   const boolean subtiled = format_desc->block.width != 4 ||
+                            format_desc->block.height != 4;
+
+   assert(format_desc->unpack_rgba_8unorm);
 
    /*
-    * Use format_desc->fetch_rgba_8unorm() for each pixel in the block.
-    * This doesn't actually make any sense whatsoever, someone would need
-    * to write a function doing this for all pixels in a block (either as
-    * an external c function or with generated code). Don't ask.
+    * Decode straight into the cache line. The cache line is laid out as
+    * a 4x4 block of rgba8 texels in row-major order, exactly what
+    * unpack_rgba_8unorm() produces with a destination stride of 16 bytes.
     */
+   indices[0] = lp_build_const_int32(gallivm, 0);
+   indices[1] = lp_build_const_int32(gallivm, LP_BUILD_FORMAT_CACHE_MEMBER_DATA);
+   indices[2] = LLVMBuildMul(builder, hash_index,
+                             lp_build_const_int32(gallivm, 16), "");
+   dst_ptr = LLVMBuildGEP(builder, cache, indices, ARRAY_SIZE(indices), "");
+   dst_ptr = LLVMBuildBitCast(builder, dst_ptr, pi8t, "");
 
-   {
+   if (!subtiled) {
       /*
        * Function to call looks like:
-       *   fetch(uint8_t *dst, const uint8_t *src, unsigned i, unsigned j)
+       *   unpack(uint8_t *dst, unsigned dst_stride,
+       *          const uint8_t *src, unsigned src_stride,
+       *          unsigned width, unsigned height)
        */
-      LLVMTypeRef ret_type;
-      LLVMTypeRef arg_types[4];
+      LLVMTypeRef arg_types[6];
       LLVMTypeRef function_type;
+      LLVMValueRef args[6];
 
-      assert(format_desc->fetch_rgba_8unorm);
-
-      ret_type = LLVMVoidTypeInContext(gallivm->context);
       arg_types[0] = pi8t;
-      arg_types[1] = pi8t;
-      arg_types[2] = i32t;
+      arg_types[1] = i32t;
+      arg_types[2] = pi8t;
       arg_types[3] = i32t;
-      function_type = LLVMFunctionType(ret_type, arg_types,
-                                       ARRAY_SIZE(arg_types), 0);
+      arg_types[4] = i32t;
+      arg_types[5] = i32t;
+      function_type = LLVMFunctionType(LLVMVoidTypeInContext(gallivm->context),
+                                       arg_types, ARRAY_SIZE(arg_types), 0);
 
-      /* make const pointer for the C fetch_rgba_8unorm function */
+      /* make const pointer for the C unpack_rgba_8unorm function */
       function = lp_build_const_int_pointer(gallivm,
-         func_to_pointer((func_pointer) format_desc->fetch_rgba_8unorm));
+         func_to_pointer((func_pointer) format_desc->unpack_rgba_8unorm));
 
       /* cast the callee pointer to the function's type */
       function = LLVMBuildBitCast(builder, function,
                                   LLVMPointerType(function_type, 0),
                                   "cast callee");
+
+      /*
+       * Note we actually supply a pointer to the start of the block,
+       * not the start of the texture, so the src stride is irrelevant.
+       */
+      args[0] = dst_ptr;
+      args[1] = lp_build_const_int32(gallivm, 16);
+      args[2] = ptr_addr;
+      args[3] = lp_build_const_int32(gallivm, 0);
+      args[4] = lp_build_const_int32(gallivm, 4);
+      args[5] = lp_build_const_int32(gallivm, 4);
+      LLVMBuildCall(builder, function, args, ARRAY_SIZE(args), "");
    }
+   else {
+      /*
+       * Function to call is fill_cached_subtile().
+       */
+      LLVMTypeRef arg_types[5];
+      LLVMTypeRef function_type;
+      LLVMValueRef args[5];
 
-   tmp_ptr = lp_build_array_alloca(gallivm, i32x4,
-                                   lp_build_const_int32(gallivm, 16),
-                                   "tmp_decode_store");
-   tmp_ptr = LLVMBuildBitCast(builder, tmp_ptr, pi8t, "");
+      arg_types[0] = pi8t;
+      arg_types[1] = pi8t;
+      arg_types[2] = pi8t;
+      arg_types[3] = i32t;
+      arg_types[4] = i32t;
+      function_type = LLVMFunctionType(LLVMVoidTypeInContext(gallivm->context),
+                                       arg_types, ARRAY_SIZE(arg_types), 0);
 
-   /*
-    * Invoke format_desc->fetch_rgba_8unorm() for each pixel.
-    * This is going to be really really slow.
-    * Note: the block store format is actually
-    * x0y0x0y1x0y2x0y3 x1y0x1y1x1y2x1y3 ...
-    */
-   for (i = 0; i < 4; ++i) {
-      for (j = 0; j < 4; ++j) {
-         LLVMValueRef args[4];
-         LLVMValueRef dst_offset = lp_build_const_int32(gallivm, (i * 4 + j) * 4);
-
-         /*
-          * Note we actually supply a pointer to the start of the block,
-          * not the start of the texture.
-          */
-         args[0] = LLVMBuildGEP(gallivm->builder, tmp_ptr, &dst_offset, 1, "");
-         args[1] = ptr_addr;
-         args[2] = LLVMConstInt(i32t, i, 0);
-         args[3] = LLVMConstInt(i32t, j, 0);
-         LLVMBuildCall(builder, function, args, ARRAY_SIZE(args), "");
-      }
-   }
+      function = lp_build_const_int_pointer(gallivm,
+         func_to_pointer((func_pointer) fill_cached_subtile));
+      function = LLVMBuildBitCast(builder, function,
+                                  LLVMPointerType(function_type, 0),
+                                  "cast callee");
 
-   /* Finally store the block - pointless mem copy + update tag. */
-   tmp_ptr = LLVMBuildBitCast(builder, tmp_ptr, LLVMPointerType(i32x4, 0), "");
-   for (i = 0; i < 4; ++i) {
-      LLVMValueRef tmp_offset = lp_build_const_int32(gallivm, i);
-      LLVMValueRef ptr = LLVMBuildGEP(gallivm->builder, tmp_ptr, &tmp_offset, 1, "");
-      col[i] = LLVMBuildLoad(builder, ptr, "");
+      args[0] = LLVMBuildBitCast(builder,
+                                 lp_build_const_int_pointer(gallivm, format_desc),
+                                 pi8t, "");
+      args[1] = dst_ptr;
+      args[2] = ptr_addr;
+      args[3] = subtile_x;
+      args[4] = subtile_y;
+      LLVMBuildCall(builder, function, args, ARRAY_SIZE(args), "");
    }
 
-   tag_value = LLVMBuildPtrToInt(gallivm->builder, ptr_addr,
-                                 LLVMInt64TypeInContext(gallivm->context), "");
-   store_cached_block(gallivm, col, tag_value, hash_index, cache);
+   store_cached_tag(gallivm, tag_value, hash_index, cache);
 }
 
 
@@ -255,20 +287,45 @@ lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
    unsigned count, low_bit, log2size;
    LLVMValueRef color, offset_stored, addr, ptr_addrtrunc, tmp;
    LLVMValueRef ij_index, hash_index, hash_mask, block_index;
+   LLVMValueRef subtile = NULL, subtile_x = NULL, subtile_y = NULL;
    LLVMTypeRef i8t = LLVMInt8TypeInContext(gallivm->context);
    LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
    LLVMTypeRef i64t = LLVMInt64TypeInContext(gallivm->context);
+   const unsigned subtiles_x = DIV_ROUND_UP(format_desc->block.width, 4);
+   const unsigned subtiles_y = DIV_ROUND_UP(format_desc->block.height, 4);
+   const boolean subtiled = format_desc->block.width != 4 ||
+                            format_desc->block.height != 4;
    struct lp_type type;
    struct lp_build_context bld32;
    memset(&type, 0, sizeof type);
    type.width = 32;
    type.length = n;
 
-   assert(format_desc->block.width == 4);
-   assert(format_desc->block.height == 4);
+   assert(lp_build_format_cacheable(format_desc));
 
    lp_build_context_init(&bld32, gallivm, type);
 
+   /*
+    * Blocks bigger than 4x4 are cached as independent 4x4 subtiles,
+    * each with its own tag (the block address with the subtile number
+    * in the low bits, which are always zero for a 16 byte aligned block).
+    */
+   if (subtiled) {
+      subtile_x = LLVMBuildLShr(builder, i,
+                                lp_build_const_int_vec(gallivm, type, 2), "");
+      subtile_y = LLVMBuildLShr(builder, j,
+                                lp_build_const_int_vec(gallivm, type, 2), "");
+      subtile = LLVMBuildMul(builder, subtile_y,
+                             lp_build_const_int_vec(gallivm, type, subtiles_x), "");
+      subtile = LLVMBuildAdd(builder, subtile, subtile_x, "");
+      subtile_x = LLVMBuildShl(builder, subtile_x,
+                               lp_build_const_int_vec(gallivm, type, 2), "");
+      subtile_y = LLVMBuildShl(builder, subtile_y,
+                               lp_build_const_int_vec(gallivm, type, 2), "");
+      i = LLVMBuildAnd(builder, i, lp_build_const_int_vec(gallivm, type, 3), "");
+      j = LLVMBuildAnd(builder, j, lp_build_const_int_vec(gallivm, type, 3), "");
+   }
+
    /*
     * compute hash - we use direct mapped cache, the hash function could
     *                be better but it needs to be simple
@@ -291,6 +348,13 @@ lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
    ptr_addrtrunc = LLVMBuildAdd(builder, offset, ptr_addrtrunc, "");
    ptr_addrtrunc = LLVMBuildLShr(builder, ptr_addrtrunc,
                                  lp_build_const_int_vec(gallivm, type, low_bit), "");
+   if (subtiled) {
+      /* give the subtiles of a block consecutive slots */
+      ptr_addrtrunc = LLVMBuildMul(builder, ptr_addrtrunc,
+                                   lp_build_const_int_vec(gallivm, type,
+                                                          subtiles_x * subtiles_y), "");
+      ptr_addrtrunc = LLVMBuildAdd(builder, ptr_addrtrunc, subtile, "");
+   }
    /* This only really makes sense for size 64,128,256 */
    hash_index = ptr_addrtrunc;
    ptr_addrtrunc = LLVMBuildLShr(builder, ptr_addrtrunc,
@@ -302,8 +366,9 @@ lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
 
    hash_mask = lp_build_const_int_vec(gallivm, type, LP_BUILD_FORMAT_CACHE_SIZE - 1);
    hash_index = LLVMBuildAnd(builder, hash_index, hash_mask, "");
-   ij_index = LLVMBuildShl(builder, i, lp_build_const_int_vec(gallivm, type, 2), "");
-   ij_index = LLVMBuildAdd(builder, ij_index, j, "");
+   /* cached blocks are stored row-major */
+   ij_index = LLVMBuildShl(builder, j, lp_build_const_int_vec(gallivm, type, 2), "");
+   ij_index = LLVMBuildAdd(builder, ij_index, i, "");
    block_index = LLVMBuildShl(builder, hash_index,
                               lp_build_const_int_vec(gallivm, type, 4), "");
    block_index = LLVMBuildAdd(builder, ij_index, block_index, "");
@@ -311,25 +376,37 @@ lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
    if (n > 1) {
       color = LLVMGetUndef(LLVMVectorType(i32t, n));
       for (count = 0; count < n; count++) {
-         LLVMValueRef index, cond, colorx;
+         LLVMValueRef index, cond, colorx, tagx;
          LLVMValueRef block_indexx, hash_indexx, addrx, offsetx, ptr_addrx;
+         LLVMValueRef subtile_xx = NULL, subtile_yx = NULL;
          struct lp_build_if_state if_ctx;
 
          index = lp_build_const_int32(gallivm, count);
          offsetx = LLVMBuildExtractElement(builder, offset, index, "");
          addrx = LLVMBuildZExt(builder, offsetx, i64t, "");
          addrx = LLVMBuildAdd(builder, addrx, addr, "");
+         tagx = addrx;
+         if (subtiled) {
+            tmp = LLVMBuildExtractElement(builder, subtile, index, "");
+            tmp = LLVMBuildZExt(builder, tmp, i64t, "");
+            tagx = LLVMBuildShl(builder, addrx, LLVMConstInt(i64t, 4, 0), "");
+            tagx = LLVMBuildOr(builder, tagx, tmp, "");
+            subtile_xx = LLVMBuildExtractElement(builder, subtile_x, index, "");
+            subtile_yx = LLVMBuildExtractElement(builder, subtile_y, index, "");
+         }
          block_indexx = LLVMBuildExtractElement(builder, block_index, index, "");
          hash_indexx = LLVMBuildLShr(builder, block_indexx,
                                      lp_build_const_int32(gallivm, 4), "");
          offset_stored = lookup_tag_data(gallivm, cache, hash_indexx);
-         cond = LLVMBuildICmp(builder, LLVMIntNE, offset_stored, addrx, "");
+         cond = LLVMBuildICmp(builder, LLVMIntNE, offset_stored, tagx, "");
 
          lp_build_if(&if_ctx, gallivm, cond);
          {
             ptr_addrx = LLVMBuildIntToPtr(builder, addrx,
                                           LLVMPointerType(i8t, 0), "");
-            update_cached_block(gallivm, format_desc, ptr_addrx, hash_indexx, cache);
+            update_cached_block(gallivm, format_desc, ptr_addrx,
+                                subtile_xx, subtile_yx, tagx,
+                                hash_indexx, cache);
 #if LP_BUILD_FORMAT_CACHE_DEBUG
             update_cache_access(gallivm, cache, 1,
                                 LP_BUILD_FORMAT_CACHE_MEMBER_ACCESS_MISS);
@@ -344,18 +421,26 @@ lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
       }
    }
    else {
-      LLVMValueRef cond;
+      LLVMValueRef cond, tag;
       struct lp_build_if_state if_ctx;
 
       tmp = LLVMBuildZExt(builder, offset, i64t, "");
       addr = LLVMBuildAdd(builder, tmp, addr, "");
+      tag = addr;
+      if (subtiled) {
+         tmp = LLVMBuildZExt(builder, subtile, i64t, "");
+         tag = LLVMBuildShl(builder, addr, LLVMConstInt(i64t, 4, 0), "");
+         tag = LLVMBuildOr(builder, tag, tmp, "");
+      }
       offset_stored = lookup_tag_data(gallivm, cache, hash_index);
-      cond = LLVMBuildICmp(builder, LLVMIntNE, offset_stored, addr, "");
+      cond = LLVMBuildICmp(builder, LLVMIntNE, offset_stored, tag, "");
 
       lp_build_if(&if_ctx, gallivm, cond);
       {
          tmp = LLVMBuildIntToPtr(builder, addr, LLVMPointerType(i8t, 0), "");
-         update_cached_block(gallivm, format_desc, tmp, hash_index, cache);
+         update_cached_block(gallivm, format_desc, tmp,
+                             subtile_x, subtile_y, tag,
+                             hash_index, cache);
 #if LP_BUILD_FORMAT_CACHE_DEBUG
          update_cache_access(gallivm, cache, 1,
                              LP_BUILD_FORMAT_CACHE_MEMBER_ACCESS_MISS);
@@ -372,3 +457,33 @@ lp_build_fetch_cached_texels(struct gallivm_state *gallivm,
    return LLVMBuildBitCast(builder, color, LLVMVectorType(i8t, n * 4), "");
 }
 
+
+/**
+ * Whether texels of this format can be fetched through the block cache:
+ * block compressed formats whose decoded texels fit into 4x8 bits and
+ * which have an unpack_rgba_8unorm() to decode whole blocks with.
+ */
+boolean
+lp_build_format_cacheable(const struct util_format_description *format_desc)
+{
+   const struct util_format_description *linear_desc;
+
+   switch (format_desc->layout) {
+   case UTIL_FORMAT_LAYOUT_S3TC:
+   case UTIL_FORMAT_LAYOUT_ETC:
+   case UTIL_FORMAT_LAYOUT_BPTC:
+   case UTIL_FORMAT_LAYOUT_ASTC:
+      break;
+   default:
+      return FALSE;
+   }
+
+   if (format_desc->block.width > LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM ||
+       format_desc->block.height > LP_BUILD_FORMAT_CACHE_MAX_BLOCK_DIM ||
+       !format_desc->unpack_rgba_8unorm) {
+      return FALSE;
+   }
+
+   linear_desc = util_format_description(util_format_linear(format_desc->format));
+   return util_format_fits_8unorm(linear_desc);
+}
@@ -133,7 +133,7 @@ create_pass_manager(struct gallivm_state *gallivm)
       free(td_str);
    }
 
-   if ((gallivm_debug & GALLIVM_DEBUG_NO_OPT) == 0) {
+   if ((gallivm_debug & GALLIVM_DEBUG_NO_OPT) == 0 && !gallivm->quick) {
       /* These are the passes currently listed in llvm-c/Transforms/Scalar.h,
        * but there are more on SVN.
        * TODO: Add more passes.
@@ -176,6 +176,13 @@ gallivm_free_ir(struct gallivm_state *gallivm)
       LLVMDisposeModule(gallivm->module);
    }
 
+   /* The object cache must outlive the engine, but nothing else. */
+   if (gallivm->cache) {
+      lp_free_objcache(gallivm->cache->jit_obj_cache);
+      gallivm->cache->jit_obj_cache = NULL;
+      gallivm->cache = NULL;
+   }
+
    FREE(gallivm->module_name);
 
    if (!use_mcjit) {
@@ -224,7 +231,7 @@ init_gallivm_engine(struct gallivm_state *gallivm)
       char *error = NULL;
       int ret;
 
-      if (gallivm_debug & GALLIVM_DEBUG_NO_OPT) {
+      if ((gallivm_debug & GALLIVM_DEBUG_NO_OPT) || gallivm->quick) {
          optlevel = None;
       }
       else {
@@ -233,6 +240,7 @@ init_gallivm_engine(struct gallivm_state *gallivm)
 
       ret = lp_build_create_jit_compiler_for_module(&gallivm->engine,
                                                     &gallivm->code,
+                                                    gallivm->cache,
                                                     gallivm->module,
                                                     gallivm->memorymgr,
                                                     (unsigned) optlevel,
@@ -285,7 +293,7 @@ fail:
  */
 static boolean
 init_gallivm_state(struct gallivm_state *gallivm, const char *name,
-                   LLVMContextRef context)
+                   LLVMContextRef context, struct lp_cached_code *cache)
 {
    assert(!gallivm->context);
    assert(!gallivm->module);
@@ -294,6 +302,7 @@ init_gallivm_state(struct gallivm_state *gallivm, const char *name,
       return FALSE;
 
    gallivm->context = context;
+   gallivm->cache = cache;
 
    if (!gallivm->context)
       goto fail;
@@ -365,9 +374,6 @@ init_gallivm_state(struct gallivm_state *gallivm, const char *name,
       }
    }
 
-   if (!create_pass_manager(gallivm))
-      goto fail;
-
    return TRUE;
 
 fail:
@@ -493,15 +499,18 @@ lp_build_init(void)
 
 /**
  * Create a new gallivm_state object.
+ * \param cache  optional object code cache, see struct lp_cached_code;
+ *               only referenced until gallivm_free_ir()
  */
 struct gallivm_state *
-gallivm_create(const char *name, LLVMContextRef context)
+gallivm_create(const char *name, LLVMContextRef context,
+               struct lp_cached_code *cache)
 {
    struct gallivm_state *gallivm;
 
    gallivm = CALLOC_STRUCT(gallivm_state);
    if (gallivm) {
-      if (!init_gallivm_state(gallivm, name, context)) {
+      if (!init_gallivm_state(gallivm, name, context, cache)) {
          FREE(gallivm);
          gallivm = NULL;
       }
@@ -550,13 +559,17 @@ gallivm_verify_function(struct gallivm_state *gallivm,
 
 /**
  * Compile a module.
- * This does IR optimization on all functions in the module.
+ * This does IR optimization on all functions in the module, unless
+ * gallivm->quick is set.
+ * When the module's object code is supplied by the cache, optimization
+ * is skipped as the IR is only needed to look up the functions.
  */
 void
 gallivm_compile_module(struct gallivm_state *gallivm)
 {
    LLVMValueRef func;
    int64_t time_begin = 0;
+   int64_t cache_time_begin = 0;
 
    assert(!gallivm->compiled);
 
@@ -565,9 +578,21 @@ gallivm_compile_module(struct gallivm_state *gallivm)
       gallivm->builder = NULL;
    }
 
+   if (gallivm->cache) {
+      cache_time_begin = os_time_get();
+      if (gallivm->cache->data_size)
+         goto skip_cached;
+   }
+
    if (gallivm_debug & GALLIVM_DEBUG_PERF)
       time_begin = os_time_get();
 
+   /* Created only now, as the optimization level may change until here. */
+   if (!create_pass_manager(gallivm)) {
+      assert(0);
+      return;
+   }
+
    /* Run optimization passes */
    LLVMInitializeFunctionPassManager(gallivm->passmgr);
    func = LLVMGetFirstFunction(gallivm->module);
@@ -611,6 +636,7 @@ gallivm_compile_module(struct gallivm_state *gallivm)
                    filename);
    }
 
+skip_cached:
    if (use_mcjit) {
       /* Setting the module's DataLayout to an empty string will cause the
        * ExecutionEngine to copy to the DataLayout string from its target
@@ -639,6 +665,9 @@ gallivm_compile_module(struct gallivm_state *gallivm)
 
    ++gallivm->compiled;
 
+   if (gallivm->cache)
+      gallivm->cache->compile_time += os_time_get() - cache_time_begin;
+
    if (gallivm_debug & GALLIVM_DEBUG_ASM) {
       LLVMValueRef llvm_func = LLVMGetFirstFunction(gallivm->module);
 
@@ -684,13 +713,19 @@ gallivm_jit_function(struct gallivm_state *gallivm,
    assert(gallivm->compiled);
    assert(gallivm->engine);
 
-   if (gallivm_debug & GALLIVM_DEBUG_PERF)
+   if ((gallivm_debug & GALLIVM_DEBUG_PERF) || gallivm->cache)
       time_begin = os_time_get();
 
+   /* With MCJIT this is where code generation (or loading the cached
+    * object code) actually happens, on the first call.
+    */
    code = LLVMGetPointerToGlobal(gallivm->engine, func);
    assert(code);
    jit_func = pointer_to_func(code);
 
+   if (gallivm->cache)
+      gallivm->cache->compile_time += os_time_get() - time_begin;
+
    if (gallivm_debug & GALLIVM_DEBUG_PERF) {
       int64_t time_end = os_time_get();
       int time_msec = (int)(time_end - time_begin) / 1000;
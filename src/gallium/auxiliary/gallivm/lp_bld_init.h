@@ -39,6 +39,25 @@
 extern "C" {
 #endif
 
+/**
+ * Object code of a compiled module, used to cache it across processes.
+ *
+ * If data_size is non-zero when the module gets compiled the object code
+ * is loaded from data instead of being generated, otherwise data receives
+ * the newly generated object code (malloc'ed, to be freed by the owner).
+ * dont_cache gets set while building IR which embeds process-specific
+ * addresses, as such object code can't be reused by another process.
+ */
+struct lp_cached_code
+{
+   void *data;
+   size_t data_size;
+   boolean dont_cache;
+   int64_t compile_time;   /**< usecs spent generating or loading code */
+   void *jit_obj_cache;
+};
+
+
 struct gallivm_state
 {
    char *module_name;
@@ -50,7 +69,9 @@ struct gallivm_state
    LLVMBuilderRef builder;
    LLVMMCJITMemoryManagerRef memorymgr;
    struct lp_generated_code *code;
+   struct lp_cached_code *cache;
    unsigned compiled;
+   boolean quick;   /**< compile fast, without optimizations */
 };
 
 
@@ -59,7 +80,8 @@ lp_build_init(void);
 
 
 struct gallivm_state *
-gallivm_create(const char *name, LLVMContextRef context);
+gallivm_create(const char *name, LLVMContextRef context,
+               struct lp_cached_code *cache);
 
 void
 gallivm_destroy(struct gallivm_state *gallivm);
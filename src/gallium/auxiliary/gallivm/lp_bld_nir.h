@@ -0,0 +1,93 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+/**
+ * @file
+ * NIR to LLVM IR translation, structure of arrays layout.
+ *
+ * This is the NIR counterpart of lp_build_tgsi_soa().  Shaders go through
+ * lp_build_nir_prepare() once, when the state is created, which lowers
+ * them to scalar ALU operations, explicit I/O intrinsics and, where control
+ * flow merges values, to registers.  lp_build_nir_soa() can then be called
+ * for each variant without modifying the shader.
+ *
+ * Not every NIR construct is translated: lp_build_nir_check() tells whether
+ * a prepared shader is fully supported, and shaders that aren't must be
+ * compiled from TGSI instead.
+ */
+
+#ifndef LP_BLD_NIR_H
+#define LP_BLD_NIR_H
+
+
+#include "lp_bld.h"
+#include "lp_bld_tgsi.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+struct nir_shader;
+struct nir_shader_compiler_options;
+
+
+extern const struct nir_shader_compiler_options lp_build_nir_options;
+
+
+void
+lp_build_nir_prepare(struct nir_shader *nir);
+
+
+boolean
+lp_build_nir_check(struct nir_shader *nir);
+
+
+boolean
+lp_build_nir_soa(struct gallivm_state *gallivm,
+                 struct nir_shader *nir,
+                 struct lp_type type,
+                 struct lp_build_mask_context *mask,
+                 LLVMValueRef consts_ptr,
+                 LLVMValueRef const_sizes_ptr,
+                 const struct lp_bld_tgsi_system_values *system_values,
+                 const LLVMValueRef (*inputs)[4],
+                 LLVMValueRef (*outputs)[4],
+                 LLVMValueRef context_ptr,
+                 LLVMValueRef thread_data_ptr,
+                 struct lp_build_sampler_soa *sampler,
+                 const struct tgsi_shader_info *info,
+                 const struct lp_build_tgsi_mem_iface *mem_iface);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LP_BLD_NIR_H */
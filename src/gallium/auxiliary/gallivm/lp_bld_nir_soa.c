@@ -0,0 +1,2342 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * @file
+ * NIR to LLVM IR translation -- SoA.
+ *
+ * Every NIR SSA value becomes one LLVM vector per component, holding the
+ * value for all the pixels/vertices processed at once.  Control flow is
+ * turned into execution masks exactly like the TGSI translator does, so
+ * divergent ifs run both sides and loops keep iterating while any lane is
+ * alive.
+ *
+ * That only works if no SSA value defined in a predicated region is read
+ * after lanes stopped updating it, which is why lp_build_nir_prepare()
+ * converts loops to LCSSA form and then phi webs to registers: the copies
+ * are placed at the end of the predecessor blocks, before break/continue,
+ * and registers are only ever written through the execution mask.
+ */
+
+#include "pipe/p_config.h"
+#include "pipe/p_shader_tokens.h"
+#include "util/u_debug.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "tgsi/tgsi_scan.h"
+#include "compiler/nir/nir.h"
+#include "compiler/nir_types.h"
+#include "lp_bld_type.h"
+#include "lp_bld_const.h"
+#include "lp_bld_arit.h"
+#include "lp_bld_bitarit.h"
+#include "lp_bld_conv.h"
+#include "lp_bld_init.h"
+#include "lp_bld_intr.h"
+#include "lp_bld_logic.h"
+#include "lp_bld_flow.h"
+#include "lp_bld_quad.h"
+#include "lp_bld_tgsi.h"
+#include "lp_bld_limits.h"
+#include "lp_bld_debug.h"
+#include "lp_bld_sample.h"
+#include "lp_bld_struct.h"
+#include "lp_bld_nir.h"
+
+
+const struct nir_shader_compiler_options lp_build_nir_options = {
+   .lower_scmp = true,
+   .lower_ffma = true,
+   .lower_flrp32 = true,
+   .lower_flrp64 = true,
+   .lower_fmod32 = true,
+   .lower_fmod64 = true,
+   .lower_bitfield_extract = true,
+   .lower_bitfield_insert = true,
+   .lower_uadd_carry = true,
+   .lower_usub_borrow = true,
+   .lower_extract_byte = true,
+   .lower_extract_word = true,
+   .lower_pack_half_2x16 = true,
+   .lower_pack_unorm_2x16 = true,
+   .lower_pack_snorm_2x16 = true,
+   .lower_pack_unorm_4x8 = true,
+   .lower_pack_snorm_4x8 = true,
+   .lower_unpack_half_2x16 = true,
+   .lower_unpack_unorm_2x16 = true,
+   .lower_unpack_snorm_2x16 = true,
+   .lower_unpack_unorm_4x8 = true,
+   .lower_unpack_snorm_4x8 = true,
+   .native_integers = true,
+   .max_unroll_iterations = 32,
+};
+
+
+static int
+type_size(const struct glsl_type *type)
+{
+   return glsl_count_attribute_slots(type, false);
+}
+
+
+/**
+ * Convert every loop not nested in another loop to LCSSA form.
+ * nir_convert_loop_to_lcssa() takes care of the nested ones itself.
+ */
+static void
+convert_loops_to_lcssa(struct exec_list *cf_list)
+{
+   foreach_list_typed(nir_cf_node, node, node, cf_list) {
+      switch (node->type) {
+      case nir_cf_node_if: {
+         nir_if *nif = nir_cf_node_as_if(node);
+         convert_loops_to_lcssa(&nif->then_list);
+         convert_loops_to_lcssa(&nif->else_list);
+         break;
+      }
+      case nir_cf_node_loop:
+         nir_convert_loop_to_lcssa(nir_cf_node_as_loop(node));
+         break;
+      default:
+         break;
+      }
+   }
+}
+
+
+/**
+ * Lower a shader to the form lp_build_nir_soa() consumes.
+ *
+ * Must be called once before translation; the driver owns the shader
+ * afterwards and translating it doesn't modify it any further.
+ */
+void
+lp_build_nir_prepare(struct nir_shader *nir)
+{
+   bool progress;
+
+   NIR_PASS_V(nir, nir_lower_io,
+              nir_var_shader_in | nir_var_shader_out | nir_var_uniform,
+              type_size, (nir_lower_io_options)0);
+   {
+      nir_lower_tex_options tex_options;
+      memset(&tex_options, 0, sizeof tex_options);
+      tex_options.lower_txp = ~0;
+      NIR_PASS_V(nir, nir_lower_tex, &tex_options);
+   }
+
+   do {
+      progress = false;
+      NIR_PASS(progress, nir, nir_copy_prop);
+      NIR_PASS(progress, nir, nir_opt_dce);
+      NIR_PASS(progress, nir, nir_opt_cse);
+      NIR_PASS(progress, nir, nir_opt_algebraic);
+      NIR_PASS(progress, nir, nir_opt_constant_folding);
+   } while (progress);
+
+   NIR_PASS_V(nir, nir_lower_alu_to_scalar);
+   NIR_PASS_V(nir, nir_copy_prop);
+   NIR_PASS_V(nir, nir_opt_dce);
+   NIR_PASS_V(nir, nir_lower_locals_to_regs);
+
+   nir_foreach_function(func, nir) {
+      if (func->impl)
+         convert_loops_to_lcssa(&func->impl->body);
+   }
+
+   NIR_PASS_V(nir, nir_convert_from_ssa, true);
+   nir_sweep(nir);
+
+   nir_foreach_function(func, nir) {
+      if (func->impl) {
+         nir_index_local_regs(func->impl);
+         nir_index_ssa_defs(func->impl);
+      }
+   }
+}
+
+
+/*
+ * What lp_build_nir_soa() translates.  lp_build_nir_check() rejects shaders
+ * using anything else, so that they can go through TGSI instead.
+ */
+
+static boolean
+alu_op_supported(nir_op op)
+{
+   switch (op) {
+   case nir_op_vec2:
+   case nir_op_vec3:
+   case nir_op_vec4:
+   case nir_op_fmov:
+   case nir_op_imov:
+   case nir_op_f2f32:
+   case nir_op_i2i32:
+   case nir_op_u2u32:
+   case nir_op_fneg:
+   case nir_op_ineg:
+   case nir_op_inot:
+   case nir_op_fsign:
+   case nir_op_isign:
+   case nir_op_fabs:
+   case nir_op_iabs:
+   case nir_op_fsat:
+   case nir_op_frcp:
+   case nir_op_frsq:
+   case nir_op_fsqrt:
+   case nir_op_fexp2:
+   case nir_op_flog2:
+   case nir_op_ftrunc:
+   case nir_op_fceil:
+   case nir_op_ffloor:
+   case nir_op_ffract:
+   case nir_op_fround_even:
+   case nir_op_fsin:
+   case nir_op_fcos:
+   case nir_op_fddx:
+   case nir_op_fddx_fine:
+   case nir_op_fddx_coarse:
+   case nir_op_fddy:
+   case nir_op_fddy_fine:
+   case nir_op_fddy_coarse:
+   case nir_op_f2b:
+   case nir_op_i2b:
+   case nir_op_b2f:
+   case nir_op_b2i:
+   case nir_op_f2i32:
+   case nir_op_f2u32:
+   case nir_op_i2f32:
+   case nir_op_u2f32:
+   case nir_op_fadd:
+   case nir_op_iadd:
+   case nir_op_fsub:
+   case nir_op_isub:
+   case nir_op_fmul:
+   case nir_op_imul:
+   case nir_op_imul_high:
+   case nir_op_umul_high:
+   case nir_op_fdiv:
+   case nir_op_idiv:
+   case nir_op_udiv:
+   case nir_op_umod:
+   case nir_op_irem:
+   case nir_op_imod:
+   case nir_op_fpow:
+   case nir_op_ldexp:
+   case nir_op_flt:
+   case nir_op_fge:
+   case nir_op_feq:
+   case nir_op_fne:
+   case nir_op_ilt:
+   case nir_op_ige:
+   case nir_op_ieq:
+   case nir_op_ine:
+   case nir_op_ult:
+   case nir_op_uge:
+   case nir_op_ishl:
+   case nir_op_ishr:
+   case nir_op_ushr:
+   case nir_op_iand:
+   case nir_op_ior:
+   case nir_op_ixor:
+   case nir_op_fmin:
+   case nir_op_fmax:
+   case nir_op_imin:
+   case nir_op_imax:
+   case nir_op_umin:
+   case nir_op_umax:
+   case nir_op_fcsel:
+   case nir_op_bcsel:
+   case nir_op_bfm:
+   case nir_op_bfi:
+   case nir_op_ubfe:
+   case nir_op_ibfe:
+   case nir_op_bit_count:
+   case nir_op_find_lsb:
+   case nir_op_ufind_msb:
+   case nir_op_ifind_msb:
+   case nir_op_bitfield_reverse:
+   case nir_op_pack_half_2x16_split:
+   case nir_op_unpack_half_2x16_split_x:
+   case nir_op_unpack_half_2x16_split_y:
+      return TRUE;
+   default:
+      return FALSE;
+   }
+}
+
+
+static boolean
+intrinsic_supported(nir_intrinsic_op op)
+{
+   switch (op) {
+   case nir_intrinsic_load_input:
+   case nir_intrinsic_load_output:
+   case nir_intrinsic_store_output:
+   case nir_intrinsic_load_uniform:
+   case nir_intrinsic_load_ubo:
+   case nir_intrinsic_load_ssbo:
+   case nir_intrinsic_store_ssbo:
+   case nir_intrinsic_ssbo_atomic_add:
+   case nir_intrinsic_ssbo_atomic_imin:
+   case nir_intrinsic_ssbo_atomic_umin:
+   case nir_intrinsic_ssbo_atomic_imax:
+   case nir_intrinsic_ssbo_atomic_umax:
+   case nir_intrinsic_ssbo_atomic_and:
+   case nir_intrinsic_ssbo_atomic_or:
+   case nir_intrinsic_ssbo_atomic_xor:
+   case nir_intrinsic_ssbo_atomic_exchange:
+   case nir_intrinsic_ssbo_atomic_comp_swap:
+   case nir_intrinsic_get_buffer_size:
+   case nir_intrinsic_discard:
+   case nir_intrinsic_discard_if:
+   case nir_intrinsic_load_vertex_id:
+   case nir_intrinsic_load_vertex_id_zero_base:
+   case nir_intrinsic_load_base_vertex:
+   case nir_intrinsic_load_instance_id:
+   case nir_intrinsic_load_invocation_id:
+   case nir_intrinsic_load_primitive_id:
+   case nir_intrinsic_load_base_instance:
+   case nir_intrinsic_load_draw_id:
+   case nir_intrinsic_memory_barrier:
+   case nir_intrinsic_memory_barrier_atomic_counter:
+   case nir_intrinsic_memory_barrier_buffer:
+   case nir_intrinsic_memory_barrier_image:
+   case nir_intrinsic_memory_barrier_shared:
+   case nir_intrinsic_group_memory_barrier:
+   case nir_intrinsic_barrier:
+      return TRUE;
+   default:
+      return FALSE;
+   }
+}
+
+
+static boolean
+tex_supported(const nir_tex_instr *instr)
+{
+   unsigned i;
+
+   switch (instr->op) {
+   case nir_texop_tex:
+   case nir_texop_txb:
+   case nir_texop_txl:
+   case nir_texop_txd:
+   case nir_texop_txf:
+   case nir_texop_txf_ms:
+   case nir_texop_tg4:
+   case nir_texop_lod:
+   case nir_texop_txs:
+   case nir_texop_query_levels:
+      break;
+   default:
+      return FALSE;
+   }
+
+   for (i = 0; i < instr->num_srcs; i++) {
+      switch (instr->src[i].src_type) {
+      case nir_tex_src_coord:
+      case nir_tex_src_comparator:
+      case nir_tex_src_offset:
+      case nir_tex_src_bias:
+      case nir_tex_src_lod:
+      case nir_tex_src_ms_index:
+      case nir_tex_src_ddx:
+      case nir_tex_src_ddy:
+         break;
+      default:
+         return FALSE;
+      }
+   }
+
+   return nir_dest_bit_size(instr->dest) == 32;
+}
+
+
+static bool
+src_is_32bit(nir_src *src, void *data)
+{
+   return nir_src_bit_size(*src) == 32;
+}
+
+
+static bool
+def_is_32bit(nir_ssa_def *def, void *data)
+{
+   return def->bit_size == 32;
+}
+
+
+/**
+ * Whether the translator handles the instruction.  Only 32-bit values are
+ * supported.
+ */
+static boolean
+instr_supported(nir_instr *instr)
+{
+   switch (instr->type) {
+   case nir_instr_type_alu: {
+      nir_alu_instr *alu = nir_instr_as_alu(instr);
+
+      if (!alu_op_supported(alu->op) ||
+          nir_dest_bit_size(alu->dest.dest) != 32)
+         return FALSE;
+      break;
+   }
+   case nir_instr_type_intrinsic: {
+      nir_intrinsic_instr *intr = nir_instr_as_intrinsic(instr);
+
+      if (!intrinsic_supported(intr->intrinsic) ||
+          (nir_intrinsic_infos[intr->intrinsic].has_dest &&
+           nir_dest_bit_size(intr->dest) != 32))
+         return FALSE;
+      break;
+   }
+   case nir_instr_type_tex:
+      if (!tex_supported(nir_instr_as_tex(instr)))
+         return FALSE;
+      break;
+   case nir_instr_type_jump:
+      switch (nir_instr_as_jump(instr)->type) {
+      case nir_jump_break:
+      case nir_jump_continue:
+         break;
+      default:
+         return FALSE;
+      }
+      break;
+   case nir_instr_type_load_const:
+   case nir_instr_type_ssa_undef:
+      break;
+   default:
+      /* phis and parallel copies are gone after nir_convert_from_ssa */
+      return FALSE;
+   }
+
+   return nir_foreach_src(instr, src_is_32bit, NULL) &&
+          nir_foreach_ssa_def(instr, def_is_32bit, NULL);
+}
+
+
+/**
+ * Check that lp_build_nir_soa() can translate every instruction of a shader
+ * prepared by lp_build_nir_prepare().
+ */
+boolean
+lp_build_nir_check(struct nir_shader *nir)
+{
+   nir_function_impl *impl = nir_shader_get_entrypoint(nir);
+
+   nir_foreach_register(reg, &impl->registers) {
+      if (reg->bit_size != 32)
+         return FALSE;
+   }
+
+   nir_foreach_block(block, impl) {
+      nir_foreach_instr(instr, block) {
+         if (!instr_supported(instr)) {
+            if (gallivm_debug & GALLIVM_DEBUG_PERF) {
+               debug_printf("gallivm: unsupported NIR instruction: ");
+               nir_print_instr(instr, stderr);
+               debug_printf("\n");
+            }
+            return FALSE;
+         }
+      }
+   }
+
+   return TRUE;
+}
+
+
+struct lp_build_nir_soa_context
+{
+   struct lp_build_context base;
+   struct lp_build_context int_bld;
+   struct lp_build_context uint_bld;
+
+   const struct tgsi_shader_info *info;
+   struct lp_build_mask_context *mask;
+   struct lp_exec_mask exec_mask;
+   const struct lp_bld_tgsi_system_values *system_values;
+
+   LLVMValueRef consts_ptr;
+   LLVMValueRef const_sizes_ptr;
+   LLVMValueRef consts[LP_MAX_TGSI_CONST_BUFFERS];
+   LLVMValueRef consts_sizes[LP_MAX_TGSI_CONST_BUFFERS];
+
+   const LLVMValueRef (*inputs)[TGSI_NUM_CHANNELS];
+   LLVMValueRef (*outputs)[TGSI_NUM_CHANNELS];
+
+   const struct lp_build_sampler_soa *sampler;
+   const struct lp_build_tgsi_mem_iface *mem_iface;
+   LLVMValueRef context_ptr;
+   LLVMValueRef thread_data_ptr;
+   LLVMValueRef mem_dummy_ptr;
+
+   /** One vector per SSA def component, indexed by def index * 4 + chan */
+   LLVMValueRef *ssa_defs;
+
+   /** Storage of the NIR registers, arrays of int vectors */
+   LLVMValueRef *regs;
+
+   /** Set when something lp_build_nir_check() rejects was found */
+   boolean unsupported;
+};
+
+
+static struct lp_build_context *
+get_alu_bld(struct lp_build_nir_soa_context *bld, nir_alu_type type)
+{
+   switch (nir_alu_type_get_base_type(type)) {
+   case nir_type_float:
+      return &bld->base;
+   case nir_type_int:
+      return &bld->int_bld;
+   default:
+      return &bld->uint_bld;
+   }
+}
+
+
+static LLVMValueRef
+cast_to(struct lp_build_context *bld, LLVMValueRef val)
+{
+   return LLVMBuildBitCast(bld->gallivm->builder, val, bld->vec_type, "");
+}
+
+
+static LLVMValueRef
+exec_mask_value(struct lp_build_nir_soa_context *bld)
+{
+   if (bld->exec_mask.has_mask)
+      return bld->exec_mask.exec_mask;
+   return LLVMConstAllOnes(bld->int_bld.vec_type);
+}
+
+
+static unsigned
+dest_num_components(const nir_dest *dest)
+{
+   return dest->is_ssa ? dest->ssa.num_components :
+                         dest->reg.reg->num_components;
+}
+
+
+static LLVMValueRef get_src(struct lp_build_nir_soa_context *bld,
+                            nir_src src, unsigned chan);
+
+
+/**
+ * Element index vector into a register array with an indirect offset,
+ * clamped to the array bounds.
+ */
+static LLVMValueRef
+reg_indirect_index(struct lp_build_nir_soa_context *bld,
+                   const nir_register *reg, unsigned base_offset,
+                   const nir_src *indirect, unsigned chan)
+{
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   struct gallivm_state *gallivm = uint_bld->gallivm;
+   unsigned num_elems = MAX2(reg->num_array_elems, 1);
+   LLVMValueRef index;
+
+   index = cast_to(uint_bld, get_src(bld, *indirect, 0));
+   index = lp_build_add(uint_bld, index,
+                        lp_build_const_int_vec(gallivm, uint_bld->type,
+                                               base_offset));
+   index = lp_build_min(uint_bld, index,
+                        lp_build_const_int_vec(gallivm, uint_bld->type,
+                                               num_elems - 1));
+   index = lp_build_mul_imm(uint_bld, index, reg->num_components);
+   return lp_build_add(uint_bld, index,
+                       lp_build_const_int_vec(gallivm, uint_bld->type, chan));
+}
+
+
+static LLVMValueRef
+get_reg_src(struct lp_build_nir_soa_context *bld,
+            const nir_reg_src *src, unsigned chan)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   const nir_register *reg = src->reg;
+   LLVMValueRef storage = bld->regs[reg->index];
+   LLVMValueRef index, res;
+   unsigned lane;
+
+   if (!src->indirect) {
+      index = lp_build_const_int32(gallivm,
+                                   src->base_offset * reg->num_components +
+                                   chan);
+      return LLVMBuildLoad(builder,
+                           LLVMBuildGEP(builder, storage, &index, 1, ""), "");
+   }
+
+   index = reg_indirect_index(bld, reg, src->base_offset, src->indirect,
+                              chan);
+   res = bld->int_bld.undef;
+   for (lane = 0; lane < bld->int_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef elem = LLVMBuildExtractElement(builder, index,
+                                                  lane_idx, "");
+      LLVMValueRef vec = LLVMBuildLoad(builder,
+                                       LLVMBuildGEP(builder, storage,
+                                                    &elem, 1, ""), "");
+      res = LLVMBuildInsertElement(builder, res,
+                                   LLVMBuildExtractElement(builder, vec,
+                                                           lane_idx, ""),
+                                   lane_idx, "");
+   }
+   return res;
+}
+
+
+static void
+store_reg(struct lp_build_nir_soa_context *bld,
+          const nir_reg_dest *dest, unsigned chan, LLVMValueRef val)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   const nir_register *reg = dest->reg;
+   LLVMValueRef storage = bld->regs[reg->index];
+   LLVMValueRef index, mask;
+   unsigned lane;
+
+   val = cast_to(&bld->int_bld, val);
+
+   if (!dest->indirect) {
+      index = lp_build_const_int32(gallivm,
+                                   dest->base_offset * reg->num_components +
+                                   chan);
+      lp_exec_mask_store(&bld->exec_mask, &bld->int_bld, val,
+                         LLVMBuildGEP(builder, storage, &index, 1, ""));
+      return;
+   }
+
+   /* Scatter, each lane only updates its own element of the target */
+   index = reg_indirect_index(bld, reg, dest->base_offset, dest->indirect,
+                              chan);
+   mask = exec_mask_value(bld);
+   for (lane = 0; lane < bld->int_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef elem, ptr, old, res, active;
+
+      elem = LLVMBuildExtractElement(builder, index, lane_idx, "");
+      ptr = LLVMBuildGEP(builder, storage, &elem, 1, "");
+      old = LLVMBuildLoad(builder, ptr, "");
+      res = LLVMBuildInsertElement(builder, old,
+                                   LLVMBuildExtractElement(builder, val,
+                                                           lane_idx, ""),
+                                   lane_idx, "");
+      active = LLVMBuildICmp(builder, LLVMIntNE,
+                             LLVMBuildExtractElement(builder, mask,
+                                                     lane_idx, ""),
+                             lp_build_const_int32(gallivm, 0), "");
+      LLVMBuildStore(builder, LLVMBuildSelect(builder, active, res, old, ""),
+                     ptr);
+   }
+}
+
+
+static LLVMValueRef
+get_src(struct lp_build_nir_soa_context *bld, nir_src src, unsigned chan)
+{
+   if (src.is_ssa) {
+      LLVMValueRef val = bld->ssa_defs[src.ssa->index * 4 + chan];
+      return val ? val : bld->int_bld.undef;
+   }
+   return get_reg_src(bld, &src.reg, chan);
+}
+
+
+static void
+assign_dest(struct lp_build_nir_soa_context *bld,
+            const nir_dest *dest, unsigned chan, LLVMValueRef val)
+{
+   if (dest->is_ssa)
+      bld->ssa_defs[dest->ssa.index * 4 + chan] = val;
+   else
+      store_reg(bld, &dest->reg, chan, val);
+}
+
+
+static void
+assign_undef(struct lp_build_nir_soa_context *bld,
+             const nir_dest *dest)
+{
+   unsigned chan;
+
+   for (chan = 0; chan < dest_num_components(dest); chan++)
+      assign_dest(bld, dest, chan, bld->base.undef);
+}
+
+
+static LLVMValueRef
+get_alu_src(struct lp_build_nir_soa_context *bld,
+            const nir_alu_src *src, unsigned chan, nir_alu_type type)
+{
+   struct lp_build_context *alu_bld = get_alu_bld(bld, type);
+   LLVMValueRef val = cast_to(alu_bld, get_src(bld, src->src, chan));
+
+   if (src->abs)
+      val = lp_build_abs(alu_bld, val);
+   if (src->negate)
+      val = lp_build_negate(alu_bld, val);
+   return val;
+}
+
+
+static LLVMValueRef
+emit_bit_intrinsic(struct lp_build_nir_soa_context *bld,
+                   const char *root, LLVMValueRef a, boolean zero_undef_arg)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMTypeRef vec_type = bld->uint_bld.vec_type;
+   LLVMValueRef args[2];
+   char name[64];
+
+   lp_format_intrinsic(name, sizeof name, root, vec_type);
+   args[0] = a;
+   args[1] = LLVMConstInt(LLVMInt1TypeInContext(gallivm->context), 0, 0);
+   return lp_build_intrinsic(gallivm->builder, name, vec_type, args,
+                             zero_undef_arg ? 2 : 1, 0);
+}
+
+
+/**
+ * Integer division and modulo. Division by zero is defined the way the
+ * TGSI translator defines it: ~0 for unsigned results, 0 for idiv.
+ */
+static LLVMValueRef
+emit_int_div(struct lp_build_nir_soa_context *bld, nir_op op,
+             LLVMValueRef a, LLVMValueRef b)
+{
+   struct lp_build_context *int_bld = &bld->int_bld;
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   LLVMBuilderRef builder = bld->base.gallivm->builder;
+   LLVMValueRef div_mask, divisor, res;
+
+   b = cast_to(uint_bld, b);
+   div_mask = lp_build_cmp(uint_bld, PIPE_FUNC_EQUAL, b, uint_bld->zero);
+   /* avoid the SIGFPE, the result is overridden below anyway */
+   divisor = LLVMBuildOr(builder, div_mask, b, "");
+
+   switch (op) {
+   case nir_op_idiv:
+      res = lp_build_div(int_bld, cast_to(int_bld, a),
+                         cast_to(int_bld, divisor));
+      return LLVMBuildAnd(builder, LLVMBuildNot(builder, div_mask, ""),
+                          cast_to(uint_bld, res), "");
+   case nir_op_udiv:
+      res = lp_build_div(uint_bld, cast_to(uint_bld, a), divisor);
+      break;
+   case nir_op_umod:
+      res = lp_build_mod(uint_bld, cast_to(uint_bld, a), divisor);
+      break;
+   case nir_op_irem:
+      res = lp_build_mod(int_bld, cast_to(int_bld, a),
+                         cast_to(int_bld, divisor));
+      break;
+   case nir_op_imod: {
+      /* the result takes the sign of the divisor */
+      LLVMValueRef rem, fixup;
+
+      rem = lp_build_mod(int_bld, cast_to(int_bld, a),
+                         cast_to(int_bld, divisor));
+      fixup = LLVMBuildAnd(builder,
+                           lp_build_cmp(int_bld, PIPE_FUNC_NOTEQUAL,
+                                        rem, int_bld->zero),
+                           lp_build_cmp(int_bld, PIPE_FUNC_LESS,
+                                        LLVMBuildXor(builder, rem,
+                                                     cast_to(int_bld, b), ""),
+                                        int_bld->zero), "");
+      res = lp_build_select(int_bld, fixup,
+                            lp_build_add(int_bld, rem, cast_to(int_bld, b)),
+                            rem);
+      break;
+   }
+   default:
+      assert(0);
+      return uint_bld->undef;
+   }
+
+   return LLVMBuildOr(builder, div_mask, cast_to(uint_bld, res), "");
+}
+
+
+static LLVMValueRef
+emit_bitfield_reverse(struct lp_build_nir_soa_context *bld, LLVMValueRef a)
+{
+   static const uint32_t masks[] = {
+      0x55555555, 0x33333333, 0x0f0f0f0f, 0x00ff00ff, 0x0000ffff
+   };
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   struct gallivm_state *gallivm = uint_bld->gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   unsigned i;
+
+   for (i = 0; i < ARRAY_SIZE(masks); i++) {
+      LLVMValueRef mask = lp_build_const_int_vec(gallivm, uint_bld->type,
+                                                 masks[i]);
+      LLVMValueRef shift = lp_build_const_int_vec(gallivm, uint_bld->type,
+                                                  1 << i);
+      LLVMValueRef lo, hi;
+
+      lo = LLVMBuildAnd(builder, LLVMBuildLShr(builder, a, shift, ""),
+                        mask, "");
+      hi = LLVMBuildShl(builder, LLVMBuildAnd(builder, a, mask, ""),
+                        shift, "");
+      a = LLVMBuildOr(builder, lo, hi, "");
+   }
+   return a;
+}
+
+
+static LLVMValueRef
+emit_alu_op(struct lp_build_nir_soa_context *bld, nir_op op,
+            LLVMValueRef src[4])
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   struct lp_build_context *base = &bld->base;
+   struct lp_build_context *int_bld = &bld->int_bld;
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   LLVMValueRef thirty_one = lp_build_const_int_vec(gallivm, uint_bld->type,
+                                                    31);
+   LLVMValueRef tmp, hi;
+
+   switch (op) {
+   case nir_op_fmov:
+   case nir_op_imov:
+   case nir_op_f2f32:
+   case nir_op_i2i32:
+   case nir_op_u2u32:
+      return src[0];
+   case nir_op_fneg:
+      return lp_build_negate(base, src[0]);
+   case nir_op_ineg:
+      return lp_build_negate(int_bld, src[0]);
+   case nir_op_inot:
+      return LLVMBuildNot(builder, src[0], "");
+   case nir_op_fsign:
+      return lp_build_sgn(base, src[0]);
+   case nir_op_isign:
+      return lp_build_sgn(int_bld, src[0]);
+   case nir_op_fabs:
+      return lp_build_abs(base, src[0]);
+   case nir_op_iabs:
+      return lp_build_abs(int_bld, src[0]);
+   case nir_op_fsat:
+      return lp_build_clamp_zero_one_nanzero(base, src[0]);
+   case nir_op_frcp:
+      return lp_build_rcp(base, src[0]);
+   case nir_op_frsq:
+      return lp_build_rsqrt(base, src[0]);
+   case nir_op_fsqrt:
+      return lp_build_sqrt(base, src[0]);
+   case nir_op_fexp2:
+      return lp_build_exp2(base, src[0]);
+   case nir_op_flog2:
+      return lp_build_log2_safe(base, src[0]);
+   case nir_op_ftrunc:
+      return lp_build_trunc(base, src[0]);
+   case nir_op_fceil:
+      return lp_build_ceil(base, src[0]);
+   case nir_op_ffloor:
+      return lp_build_floor(base, src[0]);
+   case nir_op_ffract:
+      return lp_build_fract(base, src[0]);
+   case nir_op_fround_even:
+      return lp_build_round(base, src[0]);
+   case nir_op_fsin:
+      return lp_build_sin(base, src[0]);
+   case nir_op_fcos:
+      return lp_build_cos(base, src[0]);
+   case nir_op_fddx:
+   case nir_op_fddx_fine:
+   case nir_op_fddx_coarse:
+      return lp_build_ddx(base, src[0]);
+   case nir_op_fddy:
+   case nir_op_fddy_fine:
+   case nir_op_fddy_coarse:
+      return lp_build_ddy(base, src[0]);
+
+   case nir_op_f2b:
+      return lp_build_cmp(base, PIPE_FUNC_NOTEQUAL, src[0], base->zero);
+   case nir_op_i2b:
+      return lp_build_cmp(int_bld, PIPE_FUNC_NOTEQUAL, src[0],
+                          int_bld->zero);
+   case nir_op_b2f:
+      return cast_to(base, LLVMBuildAnd(builder, src[0],
+                                        cast_to(uint_bld, base->one), ""));
+   case nir_op_b2i:
+      return LLVMBuildAnd(builder, src[0], uint_bld->one, "");
+   case nir_op_f2i32:
+      return lp_build_itrunc(base, src[0]);
+   case nir_op_f2u32:
+      return LLVMBuildFPToUI(builder, src[0], uint_bld->vec_type, "");
+   case nir_op_i2f32:
+      return LLVMBuildSIToFP(builder, src[0], base->vec_type, "");
+   case nir_op_u2f32:
+      return LLVMBuildUIToFP(builder, src[0], base->vec_type, "");
+
+   case nir_op_fadd:
+      return lp_build_add(base, src[0], src[1]);
+   case nir_op_iadd:
+      return lp_build_add(int_bld, src[0], src[1]);
+   case nir_op_fsub:
+      return lp_build_sub(base, src[0], src[1]);
+   case nir_op_isub:
+      return lp_build_sub(int_bld, src[0], src[1]);
+   case nir_op_fmul:
+      return lp_build_mul(base, src[0], src[1]);
+   case nir_op_imul:
+      return lp_build_mul(int_bld, src[0], src[1]);
+   case nir_op_imul_high:
+      lp_build_mul_32_lohi(int_bld, src[0], src[1], &hi);
+      return hi;
+   case nir_op_umul_high:
+      lp_build_mul_32_lohi(uint_bld, src[0], src[1], &hi);
+      return hi;
+   case nir_op_fdiv:
+      return lp_build_div(base, src[0], src[1]);
+   case nir_op_idiv:
+   case nir_op_udiv:
+   case nir_op_umod:
+   case nir_op_irem:
+   case nir_op_imod:
+      return emit_int_div(bld, op, src[0], src[1]);
+   case nir_op_fpow:
+      return lp_build_pow(base, src[0], src[1]);
+   case nir_op_ldexp:
+      return lp_build_mul(base, src[0],
+                          lp_build_exp2(base,
+                                        LLVMBuildSIToFP(builder, src[1],
+                                                        base->vec_type, "")));
+
+   case nir_op_flt:
+      return lp_build_cmp_ordered(base, PIPE_FUNC_LESS, src[0], src[1]);
+   case nir_op_fge:
+      return lp_build_cmp_ordered(base, PIPE_FUNC_GEQUAL, src[0], src[1]);
+   case nir_op_feq:
+      return lp_build_cmp_ordered(base, PIPE_FUNC_EQUAL, src[0], src[1]);
+   case nir_op_fne:
+      return lp_build_cmp(base, PIPE_FUNC_NOTEQUAL, src[0], src[1]);
+   case nir_op_ilt:
+      return lp_build_cmp(int_bld, PIPE_FUNC_LESS, src[0], src[1]);
+   case nir_op_ige:
+      return lp_build_cmp(int_bld, PIPE_FUNC_GEQUAL, src[0], src[1]);
+   case nir_op_ieq:
+      return lp_build_cmp(int_bld, PIPE_FUNC_EQUAL, src[0], src[1]);
+   case nir_op_ine:
+      return lp_build_cmp(int_bld, PIPE_FUNC_NOTEQUAL, src[0], src[1]);
+   case nir_op_ult:
+      return lp_build_cmp(uint_bld, PIPE_FUNC_LESS, src[0], src[1]);
+   case nir_op_uge:
+      return lp_build_cmp(uint_bld, PIPE_FUNC_GEQUAL, src[0], src[1]);
+
+   case nir_op_ishl:
+      return LLVMBuildShl(builder, src[0],
+                          LLVMBuildAnd(builder, src[1], thirty_one, ""), "");
+   case nir_op_ishr:
+      return LLVMBuildAShr(builder, src[0],
+                           LLVMBuildAnd(builder, src[1], thirty_one, ""), "");
+   case nir_op_ushr:
+      return LLVMBuildLShr(builder, src[0],
+                           LLVMBuildAnd(builder, src[1], thirty_one, ""), "");
+   case nir_op_iand:
+      return LLVMBuildAnd(builder, src[0], src[1], "");
+   case nir_op_ior:
+      return LLVMBuildOr(builder, src[0], src[1], "");
+   case nir_op_ixor:
+      return LLVMBuildXor(builder, src[0], src[1], "");
+
+   case nir_op_fmin:
+      return lp_build_min_ext(base, src[0], src[1],
+                              GALLIVM_NAN_RETURN_OTHER);
+   case nir_op_fmax:
+      return lp_build_max_ext(base, src[0], src[1],
+                              GALLIVM_NAN_RETURN_OTHER);
+   case nir_op_imin:
+      return lp_build_min(int_bld, src[0], src[1]);
+   case nir_op_imax:
+      return lp_build_max(int_bld, src[0], src[1]);
+   case nir_op_umin:
+      return lp_build_min(uint_bld, src[0], src[1]);
+   case nir_op_umax:
+      return lp_build_max(uint_bld, src[0], src[1]);
+
+   case nir_op_fcsel:
+      return lp_build_select(base,
+                             lp_build_cmp(base, PIPE_FUNC_NOTEQUAL,
+                                          src[0], base->zero),
+                             src[1], src[2]);
+   case nir_op_bcsel:
+      return lp_build_select(uint_bld, src[0], src[1], src[2]);
+
+   case nir_op_bfm:
+      /* ((1 << bits) - 1) << offset */
+      tmp = LLVMBuildShl(builder, uint_bld->one,
+                         LLVMBuildAnd(builder, src[0], thirty_one, ""), "");
+      tmp = LLVMBuildSub(builder, tmp, uint_bld->one, "");
+      return LLVMBuildShl(builder, tmp,
+                          LLVMBuildAnd(builder, src[1], thirty_one, ""), "");
+   case nir_op_bfi:
+      /* (insert << lsb(mask)) & mask | base & ~mask */
+      tmp = emit_bit_intrinsic(bld, "llvm.cttz", src[0], TRUE);
+      tmp = LLVMBuildShl(builder, src[1],
+                         LLVMBuildAnd(builder, tmp, thirty_one, ""), "");
+      tmp = LLVMBuildAnd(builder, tmp, src[0], "");
+      return LLVMBuildOr(builder, tmp,
+                         LLVMBuildAnd(builder, src[2],
+                                      LLVMBuildNot(builder, src[0], ""), ""),
+                         "");
+   case nir_op_ubfe:
+      tmp = LLVMBuildShl(builder, uint_bld->one,
+                         LLVMBuildAnd(builder, src[2], thirty_one, ""), "");
+      tmp = LLVMBuildSub(builder, tmp, uint_bld->one, "");
+      return LLVMBuildAnd(builder,
+                          LLVMBuildLShr(builder, src[0],
+                                        LLVMBuildAnd(builder, src[1],
+                                                     thirty_one, ""), ""),
+                          tmp, "");
+   case nir_op_ibfe: {
+      /* shift the field to the top, then arithmetic shift it back down */
+      LLVMValueRef thirty_two = lp_build_const_int_vec(gallivm, int_bld->type,
+                                                       32);
+      LLVMValueRef bits = LLVMBuildAnd(builder, src[2], thirty_one, "");
+
+      tmp = LLVMBuildSub(builder, thirty_two,
+                         LLVMBuildAdd(builder, src[1], bits, ""), "");
+      tmp = LLVMBuildShl(builder, src[0],
+                         LLVMBuildAnd(builder, tmp, thirty_one, ""), "");
+      tmp = LLVMBuildAShr(builder, tmp,
+                          LLVMBuildAnd(builder,
+                                       LLVMBuildSub(builder, thirty_two,
+                                                    bits, ""),
+                                       thirty_one, ""), "");
+      return lp_build_select(int_bld,
+                             lp_build_cmp(int_bld, PIPE_FUNC_EQUAL,
+                                          bits, int_bld->zero),
+                             int_bld->zero, tmp);
+   }
+   case nir_op_bit_count:
+      return emit_bit_intrinsic(bld, "llvm.ctpop", src[0], FALSE);
+   case nir_op_find_lsb:
+      tmp = emit_bit_intrinsic(bld, "llvm.cttz", src[0], TRUE);
+      return lp_build_select(uint_bld,
+                             lp_build_cmp(uint_bld, PIPE_FUNC_EQUAL,
+                                          src[0], uint_bld->zero),
+                             LLVMConstAllOnes(uint_bld->vec_type), tmp);
+   case nir_op_ufind_msb:
+      /* ctlz returns 32 for zero, which yields -1 */
+      tmp = emit_bit_intrinsic(bld, "llvm.ctlz", src[0], TRUE);
+      return LLVMBuildSub(builder, thirty_one, tmp, "");
+   case nir_op_ifind_msb:
+      tmp = lp_build_select(int_bld,
+                            lp_build_cmp(int_bld, PIPE_FUNC_LESS,
+                                         src[0], int_bld->zero),
+                            LLVMBuildNot(builder, src[0], ""), src[0]);
+      tmp = emit_bit_intrinsic(bld, "llvm.ctlz", tmp, TRUE);
+      return LLVMBuildSub(builder, thirty_one, tmp, "");
+   case nir_op_bitfield_reverse:
+      return emit_bitfield_reverse(bld, src[0]);
+
+   case nir_op_pack_half_2x16_split:
+      tmp = LLVMBuildZExt(builder, lp_build_float_to_half(gallivm, src[0]),
+                          uint_bld->vec_type, "");
+      hi = LLVMBuildZExt(builder, lp_build_float_to_half(gallivm, src[1]),
+                         uint_bld->vec_type, "");
+      return LLVMBuildOr(builder, tmp,
+                         LLVMBuildShl(builder, hi,
+                                      lp_build_const_int_vec(gallivm,
+                                                             uint_bld->type,
+                                                             16), ""), "");
+   case nir_op_unpack_half_2x16_split_x:
+   case nir_op_unpack_half_2x16_split_y: {
+      LLVMTypeRef i16_vec_type =
+         LLVMVectorType(LLVMInt16TypeInContext(gallivm->context),
+                        uint_bld->type.length);
+
+      tmp = src[0];
+      if (op == nir_op_unpack_half_2x16_split_y)
+         tmp = LLVMBuildLShr(builder, tmp,
+                             lp_build_const_int_vec(gallivm, uint_bld->type,
+                                                    16), "");
+      return lp_build_half_to_float(gallivm,
+                                    LLVMBuildTrunc(builder, tmp,
+                                                   i16_vec_type, ""));
+   }
+
+   default:
+      bld->unsupported = TRUE;
+      return base->undef;
+   }
+}
+
+
+static void
+visit_alu(struct lp_build_nir_soa_context *bld, nir_alu_instr *instr)
+{
+   const nir_op_info *info = &nir_op_infos[instr->op];
+   unsigned write_mask = instr->dest.write_mask;
+   unsigned chan, i;
+
+   if (instr->dest.dest.is_ssa)
+      write_mask = (1 << instr->dest.dest.ssa.num_components) - 1;
+
+   for (chan = 0; chan < 4; chan++) {
+      LLVMValueRef src[4], res;
+
+      if (!(write_mask & (1 << chan)))
+         continue;
+
+      switch (instr->op) {
+      case nir_op_vec2:
+      case nir_op_vec3:
+      case nir_op_vec4:
+         res = get_src(bld, instr->src[chan].src,
+                       instr->src[chan].swizzle[0]);
+         break;
+      default:
+         for (i = 0; i < info->num_inputs; i++) {
+            unsigned swz = info->input_sizes[i] ? instr->src[i].swizzle[0] :
+                                                  instr->src[i].swizzle[chan];
+            src[i] = get_alu_src(bld, &instr->src[i], swz,
+                                 info->input_types[i]);
+         }
+         res = emit_alu_op(bld, instr->op, src);
+         if (instr->dest.saturate)
+            res = lp_build_clamp_zero_one_nanzero(&bld->base,
+                                                  cast_to(&bld->base, res));
+         break;
+      }
+
+      assign_dest(bld, &instr->dest.dest, chan, res);
+   }
+}
+
+
+static void
+visit_load_const(struct lp_build_nir_soa_context *bld,
+                 nir_load_const_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   unsigned chan;
+
+   for (chan = 0; chan < instr->def.num_components; chan++) {
+      bld->ssa_defs[instr->def.index * 4 + chan] =
+         lp_build_const_int_vec(gallivm, bld->int_bld.type,
+                                instr->value.i32[chan]);
+   }
+}
+
+
+static void
+visit_ssa_undef(struct lp_build_nir_soa_context *bld,
+                nir_ssa_undef_instr *instr)
+{
+   unsigned chan;
+
+   for (chan = 0; chan < instr->def.num_components; chan++)
+      bld->ssa_defs[instr->def.index * 4 + chan] = bld->int_bld.undef;
+}
+
+
+/*
+ * Shader memory access, see the equivalent helpers of the TGSI translator.
+ * Accesses are scalarized per lane, and inactive or out of bounds lanes
+ * are redirected to a scratch location.
+ */
+
+static LLVMValueRef
+mem_dummy_ptr(struct lp_build_nir_soa_context *bld)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMTypeRef i8t = LLVMInt8TypeInContext(gallivm->context);
+
+   if (!bld->mem_dummy_ptr) {
+      bld->mem_dummy_ptr = lp_build_alloca(gallivm, LLVMArrayType(i8t, 16),
+                                           "mem_dummy");
+   }
+   return LLVMBuildBitCast(gallivm->builder, bld->mem_dummy_ptr,
+                           LLVMPointerType(i8t, 0), "");
+}
+
+
+static LLVMValueRef
+mem_lane_ptr(struct lp_build_nir_soa_context *bld,
+             LLVMValueRef base_ptr, LLVMValueRef size,
+             LLVMValueRef offset, LLVMValueRef active,
+             LLVMValueRef *in_bounds)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
+   LLVMValueRef four = lp_build_const_int32(gallivm, 4);
+   LLVMValueRef ok, ptr;
+
+   /* offset + 4 <= size, written so that it can't wrap around */
+   ok = LLVMBuildICmp(builder, LLVMIntULE, four, size, "");
+   ok = LLVMBuildAnd(builder, ok,
+                     LLVMBuildICmp(builder, LLVMIntULE, offset,
+                                   LLVMBuildSub(builder, size, four, ""),
+                                   ""), "");
+   *in_bounds = ok;
+   if (active)
+      ok = LLVMBuildAnd(builder, ok, active, "");
+
+   ptr = LLVMBuildGEP(builder, base_ptr, &offset, 1, "");
+   ptr = LLVMBuildSelect(builder, ok, ptr, mem_dummy_ptr(bld), "");
+   return LLVMBuildBitCast(builder, ptr, LLVMPointerType(i32t, 0), "");
+}
+
+
+static void
+mem_lane_buffer(struct lp_build_nir_soa_context *bld,
+                LLVMValueRef index, unsigned lane,
+                LLVMValueRef *base_ptr, LLVMValueRef *size)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   const struct lp_build_tgsi_mem_iface *iface = bld->mem_iface;
+
+   if (iface && iface->buffer) {
+      index = LLVMBuildExtractElement(gallivm->builder, index,
+                                      lp_build_const_int32(gallivm, lane), "");
+      iface->buffer(iface, gallivm, index, base_ptr, size);
+   }
+   else {
+      *base_ptr = mem_dummy_ptr(bld);
+      *size = lp_build_const_int32(gallivm, 0);
+   }
+}
+
+
+static LLVMValueRef
+mem_lane_active(struct lp_build_nir_soa_context *bld,
+                LLVMValueRef mask, unsigned lane)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+
+   return LLVMBuildICmp(builder, LLVMIntNE,
+                        LLVMBuildExtractElement(builder, mask,
+                                                lp_build_const_int32(gallivm,
+                                                                     lane),
+                                                ""),
+                        lp_build_const_int32(gallivm, 0), "");
+}
+
+
+/**
+ * Lanes allowed to have side effects: alive and executing.
+ */
+static LLVMValueRef
+mem_active_mask(struct lp_build_nir_soa_context *bld)
+{
+   LLVMBuilderRef builder = bld->base.gallivm->builder;
+   LLVMValueRef mask = bld->mask ? lp_build_mask_value(bld->mask) :
+                                   LLVMConstAllOnes(bld->int_bld.vec_type);
+
+   if (bld->exec_mask.has_mask)
+      mask = LLVMBuildAnd(builder, mask, bld->exec_mask.exec_mask, "");
+   return mask;
+}
+
+
+static void
+visit_load_ssbo(struct lp_build_nir_soa_context *bld,
+                nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef index = cast_to(&bld->uint_bld, get_src(bld, instr->src[0], 0));
+   LLVMValueRef offset = cast_to(&bld->uint_bld,
+                                 get_src(bld, instr->src[1], 0));
+   LLVMValueRef result[4];
+   unsigned num_components = dest_num_components(&instr->dest);
+   unsigned chan, lane;
+
+   for (chan = 0; chan < num_components; chan++)
+      result[chan] = bld->uint_bld.undef;
+
+   for (lane = 0; lane < bld->uint_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef base_ptr, size, lane_offset;
+
+      mem_lane_buffer(bld, index, lane, &base_ptr, &size);
+      lane_offset = LLVMBuildExtractElement(builder, offset, lane_idx, "");
+
+      for (chan = 0; chan < num_components; chan++) {
+         LLVMValueRef ptr, in_bounds, value;
+
+         ptr = mem_lane_ptr(bld, base_ptr, size,
+                            LLVMBuildAdd(builder, lane_offset,
+                                         lp_build_const_int32(gallivm,
+                                                              4 * chan), ""),
+                            NULL, &in_bounds);
+         value = LLVMBuildLoad(builder, ptr, "");
+         value = LLVMBuildSelect(builder, in_bounds, value,
+                                 lp_build_const_int32(gallivm, 0), "");
+         result[chan] = LLVMBuildInsertElement(builder, result[chan], value,
+                                               lane_idx, "");
+      }
+   }
+
+   for (chan = 0; chan < num_components; chan++)
+      assign_dest(bld, &instr->dest, chan, result[chan]);
+}
+
+
+static void
+visit_store_ssbo(struct lp_build_nir_soa_context *bld,
+                 nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   unsigned write_mask = nir_intrinsic_write_mask(instr);
+   LLVMValueRef index = cast_to(&bld->uint_bld, get_src(bld, instr->src[1], 0));
+   LLVMValueRef offset = cast_to(&bld->uint_bld,
+                                 get_src(bld, instr->src[2], 0));
+   LLVMValueRef mask = mem_active_mask(bld);
+   LLVMValueRef value[4];
+   unsigned chan, lane;
+
+   for (chan = 0; chan < 4; chan++) {
+      if (write_mask & (1 << chan))
+         value[chan] = cast_to(&bld->uint_bld,
+                               get_src(bld, instr->src[0], chan));
+   }
+
+   for (lane = 0; lane < bld->uint_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef base_ptr, size, lane_offset, active;
+
+      mem_lane_buffer(bld, index, lane, &base_ptr, &size);
+      lane_offset = LLVMBuildExtractElement(builder, offset, lane_idx, "");
+      active = mem_lane_active(bld, mask, lane);
+
+      for (chan = 0; chan < 4; chan++) {
+         LLVMValueRef ptr, in_bounds;
+
+         if (!(write_mask & (1 << chan)))
+            continue;
+
+         ptr = mem_lane_ptr(bld, base_ptr, size,
+                            LLVMBuildAdd(builder, lane_offset,
+                                         lp_build_const_int32(gallivm,
+                                                              4 * chan), ""),
+                            active, &in_bounds);
+         LLVMBuildStore(builder,
+                        LLVMBuildExtractElement(builder, value[chan],
+                                                lane_idx, ""),
+                        ptr);
+      }
+   }
+}
+
+
+static void
+visit_ssbo_atomic(struct lp_build_nir_soa_context *bld,
+                  nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef index = cast_to(&bld->uint_bld, get_src(bld, instr->src[0], 0));
+   LLVMValueRef offset = cast_to(&bld->uint_bld,
+                                 get_src(bld, instr->src[1], 0));
+   LLVMValueRef value = cast_to(&bld->uint_bld,
+                                get_src(bld, instr->src[2], 0));
+   LLVMValueRef value2 = NULL;
+   LLVMValueRef mask = mem_active_mask(bld);
+   LLVMValueRef result = bld->uint_bld.undef;
+   LLVMAtomicRMWBinOp op = LLVMAtomicRMWBinOpAdd;
+   unsigned lane;
+
+   switch (instr->intrinsic) {
+   case nir_intrinsic_ssbo_atomic_comp_swap:
+      value2 = cast_to(&bld->uint_bld, get_src(bld, instr->src[3], 0));
+      break;
+   case nir_intrinsic_ssbo_atomic_add:
+      op = LLVMAtomicRMWBinOpAdd;
+      break;
+   case nir_intrinsic_ssbo_atomic_exchange:
+      op = LLVMAtomicRMWBinOpXchg;
+      break;
+   case nir_intrinsic_ssbo_atomic_and:
+      op = LLVMAtomicRMWBinOpAnd;
+      break;
+   case nir_intrinsic_ssbo_atomic_or:
+      op = LLVMAtomicRMWBinOpOr;
+      break;
+   case nir_intrinsic_ssbo_atomic_xor:
+      op = LLVMAtomicRMWBinOpXor;
+      break;
+   case nir_intrinsic_ssbo_atomic_umin:
+      op = LLVMAtomicRMWBinOpUMin;
+      break;
+   case nir_intrinsic_ssbo_atomic_umax:
+      op = LLVMAtomicRMWBinOpUMax;
+      break;
+   case nir_intrinsic_ssbo_atomic_imin:
+      op = LLVMAtomicRMWBinOpMin;
+      break;
+   case nir_intrinsic_ssbo_atomic_imax:
+      op = LLVMAtomicRMWBinOpMax;
+      break;
+   default:
+      assert(0);
+      break;
+   }
+
+   for (lane = 0; lane < bld->uint_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef base_ptr, size, ptr, in_bounds, old;
+      LLVMValueRef lane_value = LLVMBuildExtractElement(builder, value,
+                                                        lane_idx, "");
+
+      mem_lane_buffer(bld, index, lane, &base_ptr, &size);
+      ptr = mem_lane_ptr(bld, base_ptr, size,
+                         LLVMBuildExtractElement(builder, offset,
+                                                 lane_idx, ""),
+                         mem_lane_active(bld, mask, lane), &in_bounds);
+      if (value2) {
+         old = LLVMBuildAtomicCmpXchg(builder, ptr, lane_value,
+                                      LLVMBuildExtractElement(builder, value2,
+                                                              lane_idx, ""),
+                                      LLVMAtomicOrderingSequentiallyConsistent,
+                                      LLVMAtomicOrderingSequentiallyConsistent,
+                                      FALSE);
+         old = LLVMBuildExtractValue(builder, old, 0, "");
+      }
+      else {
+         old = LLVMBuildAtomicRMW(builder, op, ptr, lane_value,
+                                  LLVMAtomicOrderingSequentiallyConsistent,
+                                  FALSE);
+      }
+      old = LLVMBuildSelect(builder, in_bounds, old,
+                            lp_build_const_int32(gallivm, 0), "");
+      result = LLVMBuildInsertElement(builder, result, old, lane_idx, "");
+   }
+
+   assign_dest(bld, &instr->dest, 0, result);
+}
+
+
+static void
+visit_get_buffer_size(struct lp_build_nir_soa_context *bld,
+                      nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMValueRef index = cast_to(&bld->uint_bld, get_src(bld, instr->src[0], 0));
+   LLVMValueRef result = bld->uint_bld.undef;
+   unsigned lane;
+
+   for (lane = 0; lane < bld->uint_bld.type.length; lane++) {
+      LLVMValueRef base_ptr, size;
+
+      mem_lane_buffer(bld, index, lane, &base_ptr, &size);
+      result = LLVMBuildInsertElement(gallivm->builder, result, size,
+                                      lp_build_const_int32(gallivm, lane),
+                                      "");
+   }
+
+   assign_dest(bld, &instr->dest, 0, result);
+}
+
+
+/**
+ * Per-lane load of 32 bit elements of a constant buffer. Lanes whose
+ * vec4 index is beyond the buffer size get 0, as with TGSI.
+ */
+static LLVMValueRef
+gather_consts(struct lp_build_nir_soa_context *bld,
+              LLVMValueRef consts_ptr, LLVMValueRef num_consts,
+              LLVMValueRef indexes)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   LLVMValueRef overflow_mask, res;
+   unsigned lane;
+
+   overflow_mask = lp_build_compare(gallivm, uint_bld->type, PIPE_FUNC_GEQUAL,
+                                    lp_build_shr_imm(uint_bld, indexes, 2),
+                                    lp_build_broadcast_scalar(uint_bld,
+                                                              num_consts));
+   indexes = lp_build_select(uint_bld, overflow_mask, uint_bld->zero, indexes);
+
+   res = bld->base.undef;
+   for (lane = 0; lane < uint_bld->type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef index = LLVMBuildExtractElement(builder, indexes,
+                                                   lane_idx, "");
+      LLVMValueRef scalar = LLVMBuildLoad(builder,
+                                          LLVMBuildGEP(builder, consts_ptr,
+                                                       &index, 1, ""), "");
+      res = LLVMBuildInsertElement(builder, res, scalar, lane_idx, "");
+   }
+
+   res = cast_to(uint_bld, res);
+   return LLVMBuildAnd(builder, res, LLVMBuildNot(builder, overflow_mask, ""),
+                       "");
+}
+
+
+static LLVMValueRef
+load_const_element(struct lp_build_nir_soa_context *bld,
+                   LLVMValueRef consts_ptr, unsigned index)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef idx = lp_build_const_int32(gallivm, index);
+
+   return lp_build_broadcast_scalar(&bld->base,
+                                    LLVMBuildLoad(builder,
+                                                  LLVMBuildGEP(builder,
+                                                               consts_ptr,
+                                                               &idx, 1, ""),
+                                                  ""));
+}
+
+
+static void
+visit_load_uniform(struct lp_build_nir_soa_context *bld,
+                   nir_intrinsic_instr *instr)
+{
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   nir_const_value *offset = nir_src_as_const_value(instr->src[0]);
+   unsigned base = nir_intrinsic_base(instr);
+   unsigned chan;
+
+   for (chan = 0; chan < dest_num_components(&instr->dest); chan++) {
+      LLVMValueRef res;
+
+      if (offset) {
+         res = load_const_element(bld, bld->consts[0],
+                                  (base + offset->u32[0]) * 4 + chan);
+      }
+      else {
+         LLVMValueRef indexes = cast_to(uint_bld,
+                                        get_src(bld, instr->src[0], 0));
+         indexes = lp_build_add(uint_bld, indexes,
+                                lp_build_const_int_vec(gallivm,
+                                                       uint_bld->type, base));
+         indexes = lp_build_shl_imm(uint_bld, indexes, 2);
+         indexes = lp_build_add(uint_bld, indexes,
+                                lp_build_const_int_vec(gallivm,
+                                                       uint_bld->type, chan));
+         res = gather_consts(bld, bld->consts[0], bld->consts_sizes[0],
+                             indexes);
+      }
+      assign_dest(bld, &instr->dest, chan, res);
+   }
+}
+
+
+static void
+visit_load_ubo(struct lp_build_nir_soa_context *bld,
+               nir_intrinsic_instr *instr)
+{
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   nir_const_value *block = nir_src_as_const_value(instr->src[0]);
+   nir_const_value *offset = nir_src_as_const_value(instr->src[1]);
+   LLVMValueRef consts_ptr, num_consts;
+   unsigned chan;
+
+   /* UBOs are bound after the default uniform block */
+   if (block) {
+      unsigned idx = MIN2(block->u32[0] + 1, LP_MAX_TGSI_CONST_BUFFERS - 1);
+      consts_ptr = bld->consts[idx];
+      num_consts = bld->consts_sizes[idx];
+   }
+   else {
+      /* dynamically uniform, so the first lane is as good as any */
+      LLVMValueRef idx = LLVMBuildExtractElement(builder,
+                                                 get_src(bld, instr->src[0],
+                                                         0),
+                                                 lp_build_const_int32(gallivm,
+                                                                      0), "");
+      idx = LLVMBuildAdd(builder, idx, lp_build_const_int32(gallivm, 1), "");
+      idx = LLVMBuildSelect(builder,
+                            LLVMBuildICmp(builder, LLVMIntULT, idx,
+                                          lp_build_const_int32(gallivm,
+                                             LP_MAX_TGSI_CONST_BUFFERS), ""),
+                            idx,
+                            lp_build_const_int32(gallivm,
+                                                 LP_MAX_TGSI_CONST_BUFFERS - 1),
+                            "");
+      consts_ptr = lp_build_array_get(gallivm, bld->consts_ptr, idx);
+      num_consts = lp_build_array_get(gallivm, bld->const_sizes_ptr, idx);
+   }
+
+   for (chan = 0; chan < dest_num_components(&instr->dest); chan++) {
+      LLVMValueRef indexes;
+
+      if (offset) {
+         indexes = lp_build_const_int_vec(gallivm, uint_bld->type,
+                                          offset->u32[0] / 4 + chan);
+      }
+      else {
+         indexes = cast_to(uint_bld, get_src(bld, instr->src[1], 0));
+         indexes = lp_build_shr_imm(uint_bld, indexes, 2);
+         indexes = lp_build_add(uint_bld, indexes,
+                                lp_build_const_int_vec(gallivm,
+                                                       uint_bld->type, chan));
+      }
+      assign_dest(bld, &instr->dest, chan,
+                  gather_consts(bld, consts_ptr, num_consts, indexes));
+   }
+}
+
+
+/**
+ * Slot index vector of an indirectly addressed input or output.
+ */
+static LLVMValueRef
+io_indirect_index(struct lp_build_nir_soa_context *bld,
+                  nir_src offset, unsigned base)
+{
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+
+   return lp_build_add(uint_bld, cast_to(uint_bld, get_src(bld, offset, 0)),
+                       lp_build_const_int_vec(uint_bld->gallivm,
+                                              uint_bld->type, base));
+}
+
+
+static void
+visit_load_input(struct lp_build_nir_soa_context *bld,
+                 nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   const struct tgsi_shader_info *info = bld->info;
+   nir_const_value *offset = nir_src_as_const_value(instr->src[0]);
+   unsigned base = nir_intrinsic_base(instr);
+   unsigned component = nir_intrinsic_component(instr);
+   unsigned i, slot;
+
+   for (i = 0; i < dest_num_components(&instr->dest); i++) {
+      unsigned chan = component + i;
+      LLVMValueRef res = bld->base.undef;
+
+      if (offset) {
+         slot = base + offset->u32[0];
+         if (slot < PIPE_MAX_SHADER_INPUTS && bld->inputs[slot][chan])
+            res = bld->inputs[slot][chan];
+
+         /* llvmpipe interpolates the facing as +1/-1 */
+         if (info->processor == PIPE_SHADER_FRAGMENT &&
+             slot < info->num_inputs &&
+             info->input_semantic_name[slot] == TGSI_SEMANTIC_FACE)
+            res = lp_build_cmp(&bld->base, PIPE_FUNC_GREATER, res,
+                               bld->base.zero);
+      }
+      else {
+         LLVMValueRef index = io_indirect_index(bld, instr->src[0], base);
+
+         for (slot = base; slot < info->num_inputs; slot++) {
+            if (!bld->inputs[slot][chan])
+               continue;
+            res = lp_build_select(&bld->base,
+                                  lp_build_cmp(&bld->uint_bld,
+                                               PIPE_FUNC_EQUAL, index,
+                                               lp_build_const_int_vec(gallivm,
+                                                  bld->uint_bld.type, slot)),
+                                  bld->inputs[slot][chan], res);
+         }
+      }
+      assign_dest(bld, &instr->dest, i, res);
+   }
+}
+
+
+static void
+visit_load_output(struct lp_build_nir_soa_context *bld,
+                  nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   const struct tgsi_shader_info *info = bld->info;
+   nir_const_value *offset = nir_src_as_const_value(instr->src[0]);
+   unsigned base = nir_intrinsic_base(instr);
+   unsigned component = nir_intrinsic_component(instr);
+   unsigned i, slot;
+
+   for (i = 0; i < dest_num_components(&instr->dest); i++) {
+      unsigned chan = component + i;
+      LLVMValueRef res = bld->base.undef;
+
+      if (offset) {
+         slot = base + offset->u32[0];
+         if (slot < info->num_outputs)
+            res = LLVMBuildLoad(builder, bld->outputs[slot][chan], "");
+      }
+      else {
+         LLVMValueRef index = io_indirect_index(bld, instr->src[0], base);
+
+         for (slot = base; slot < info->num_outputs; slot++) {
+            res = lp_build_select(&bld->base,
+                                  lp_build_cmp(&bld->uint_bld,
+                                               PIPE_FUNC_EQUAL, index,
+                                               lp_build_const_int_vec(gallivm,
+                                                  bld->uint_bld.type, slot)),
+                                  LLVMBuildLoad(builder,
+                                                bld->outputs[slot][chan], ""),
+                                  res);
+         }
+      }
+      assign_dest(bld, &instr->dest, i, res);
+   }
+}
+
+
+static void
+visit_store_output(struct lp_build_nir_soa_context *bld,
+                   nir_intrinsic_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   const struct tgsi_shader_info *info = bld->info;
+   nir_const_value *offset = nir_src_as_const_value(instr->src[1]);
+   unsigned base = nir_intrinsic_base(instr);
+   unsigned component = nir_intrinsic_component(instr);
+   unsigned write_mask = nir_intrinsic_write_mask(instr);
+   unsigned i, slot;
+
+   for (i = 0; i < 4; i++) {
+      unsigned chan = component + i;
+      LLVMValueRef val;
+
+      if (!(write_mask & (1 << i)))
+         continue;
+
+      val = cast_to(&bld->base, get_src(bld, instr->src[0], i));
+
+      if (offset) {
+         slot = base + offset->u32[0];
+         if (slot < info->num_outputs)
+            lp_exec_mask_store(&bld->exec_mask, &bld->base, val,
+                               bld->outputs[slot][chan]);
+      }
+      else {
+         LLVMValueRef index = io_indirect_index(bld, instr->src[1], base);
+         LLVMValueRef mask = exec_mask_value(bld);
+
+         for (slot = base; slot < info->num_outputs; slot++) {
+            LLVMValueRef ptr = bld->outputs[slot][chan];
+            LLVMValueRef sel;
+
+            sel = lp_build_cmp(&bld->uint_bld, PIPE_FUNC_EQUAL, index,
+                               lp_build_const_int_vec(gallivm,
+                                                      bld->uint_bld.type,
+                                                      slot));
+            sel = LLVMBuildAnd(builder, sel, mask, "");
+            LLVMBuildStore(builder,
+                           lp_build_select(&bld->base, sel, val,
+                                           LLVMBuildLoad(builder, ptr, "")),
+                           ptr);
+         }
+      }
+   }
+}
+
+
+static void
+emit_kill(struct lp_build_nir_soa_context *bld, LLVMValueRef cond)
+{
+   LLVMBuilderRef builder = bld->base.gallivm->builder;
+   LLVMValueRef mask;
+
+   if (!bld->mask)
+      return;
+
+   /* lanes that survive */
+   if (cond)
+      mask = LLVMBuildNot(builder, cond, "");
+   else
+      mask = LLVMConstNull(bld->int_bld.vec_type);
+
+   if (bld->exec_mask.has_mask) {
+      mask = LLVMBuildOr(builder, mask,
+                         LLVMBuildNot(builder, bld->exec_mask.exec_mask,
+                                      "kilp"), "");
+   }
+
+   lp_build_mask_update(bld->mask, mask);
+   lp_build_mask_check(bld->mask);
+}
+
+
+static void
+visit_intrinsic(struct lp_build_nir_soa_context *bld,
+                nir_intrinsic_instr *instr)
+{
+   const struct lp_bld_tgsi_system_values *sv = bld->system_values;
+   struct lp_build_context *uint_bld = &bld->uint_bld;
+   LLVMBuilderRef builder = bld->base.gallivm->builder;
+
+   switch (instr->intrinsic) {
+   case nir_intrinsic_load_input:
+      visit_load_input(bld, instr);
+      break;
+   case nir_intrinsic_load_output:
+      visit_load_output(bld, instr);
+      break;
+   case nir_intrinsic_store_output:
+      visit_store_output(bld, instr);
+      break;
+   case nir_intrinsic_load_uniform:
+      visit_load_uniform(bld, instr);
+      break;
+   case nir_intrinsic_load_ubo:
+      visit_load_ubo(bld, instr);
+      break;
+   case nir_intrinsic_load_ssbo:
+      visit_load_ssbo(bld, instr);
+      break;
+   case nir_intrinsic_store_ssbo:
+      visit_store_ssbo(bld, instr);
+      break;
+   case nir_intrinsic_ssbo_atomic_add:
+   case nir_intrinsic_ssbo_atomic_imin:
+   case nir_intrinsic_ssbo_atomic_umin:
+   case nir_intrinsic_ssbo_atomic_imax:
+   case nir_intrinsic_ssbo_atomic_umax:
+   case nir_intrinsic_ssbo_atomic_and:
+   case nir_intrinsic_ssbo_atomic_or:
+   case nir_intrinsic_ssbo_atomic_xor:
+   case nir_intrinsic_ssbo_atomic_exchange:
+   case nir_intrinsic_ssbo_atomic_comp_swap:
+      visit_ssbo_atomic(bld, instr);
+      break;
+   case nir_intrinsic_get_buffer_size:
+      visit_get_buffer_size(bld, instr);
+      break;
+
+   case nir_intrinsic_discard:
+      emit_kill(bld, NULL);
+      break;
+   case nir_intrinsic_discard_if:
+      emit_kill(bld, cast_to(&bld->int_bld, get_src(bld, instr->src[0], 0)));
+      break;
+
+   case nir_intrinsic_load_vertex_id:
+      assign_dest(bld, &instr->dest, 0, sv->vertex_id);
+      break;
+   case nir_intrinsic_load_vertex_id_zero_base:
+      assign_dest(bld, &instr->dest, 0, sv->vertex_id_nobase);
+      break;
+   case nir_intrinsic_load_base_vertex:
+      assign_dest(bld, &instr->dest, 0, sv->basevertex);
+      break;
+   case nir_intrinsic_load_instance_id:
+      assign_dest(bld, &instr->dest, 0,
+                  lp_build_broadcast_scalar(uint_bld, sv->instance_id));
+      break;
+   case nir_intrinsic_load_invocation_id:
+      assign_dest(bld, &instr->dest, 0,
+                  lp_build_broadcast_scalar(uint_bld, sv->invocation_id));
+      break;
+   case nir_intrinsic_load_primitive_id:
+      assign_dest(bld, &instr->dest, 0, sv->prim_id);
+      break;
+   case nir_intrinsic_load_base_instance:
+   case nir_intrinsic_load_draw_id:
+      assign_dest(bld, &instr->dest, 0, uint_bld->zero);
+      break;
+
+   case nir_intrinsic_memory_barrier:
+   case nir_intrinsic_memory_barrier_atomic_counter:
+   case nir_intrinsic_memory_barrier_buffer:
+   case nir_intrinsic_memory_barrier_image:
+   case nir_intrinsic_memory_barrier_shared:
+   case nir_intrinsic_group_memory_barrier:
+      LLVMBuildFence(builder, LLVMAtomicOrderingSequentiallyConsistent,
+                     FALSE, "");
+      break;
+   case nir_intrinsic_barrier:
+      if (bld->mem_iface && bld->mem_iface->barrier)
+         bld->mem_iface->barrier(bld->mem_iface, bld->base.gallivm);
+      break;
+
+   default:
+      bld->unsupported = TRUE;
+      if (nir_intrinsic_infos[instr->intrinsic].has_dest)
+         assign_undef(bld, &instr->dest);
+      break;
+   }
+}
+
+
+static unsigned
+tex_target(const nir_tex_instr *instr)
+{
+   switch (instr->sampler_dim) {
+   case GLSL_SAMPLER_DIM_1D:
+      return instr->is_array ? PIPE_TEXTURE_1D_ARRAY : PIPE_TEXTURE_1D;
+   case GLSL_SAMPLER_DIM_2D:
+   case GLSL_SAMPLER_DIM_EXTERNAL:
+   case GLSL_SAMPLER_DIM_MS:
+      return instr->is_array ? PIPE_TEXTURE_2D_ARRAY : PIPE_TEXTURE_2D;
+   case GLSL_SAMPLER_DIM_3D:
+      return PIPE_TEXTURE_3D;
+   case GLSL_SAMPLER_DIM_CUBE:
+      return instr->is_array ? PIPE_TEXTURE_CUBE_ARRAY : PIPE_TEXTURE_CUBE;
+   case GLSL_SAMPLER_DIM_RECT:
+      return PIPE_TEXTURE_RECT;
+   case GLSL_SAMPLER_DIM_BUF:
+      return PIPE_BUFFER;
+   default:
+      assert(0);
+      return PIPE_TEXTURE_2D;
+   }
+}
+
+
+/**
+ * Whether the lod source is the same for all lanes.
+ */
+static enum lp_sampler_lod_property
+tex_lod_property(struct lp_build_nir_soa_context *bld, nir_src src)
+{
+   if (src.is_ssa) {
+      nir_instr *parent = src.ssa->parent_instr;
+
+      if (parent->type == nir_instr_type_load_const)
+         return LP_SAMPLER_LOD_SCALAR;
+      if (parent->type == nir_instr_type_intrinsic) {
+         nir_intrinsic_instr *intr = nir_instr_as_intrinsic(parent);
+         if (intr->intrinsic == nir_intrinsic_load_uniform &&
+             nir_src_as_const_value(intr->src[0]))
+            return LP_SAMPLER_LOD_SCALAR;
+      }
+   }
+
+   if (bld->info->processor == PIPE_SHADER_FRAGMENT &&
+       !(gallivm_debug & GALLIVM_DEBUG_NO_QUAD_LOD))
+      return LP_SAMPLER_LOD_PER_QUAD;
+   return LP_SAMPLER_LOD_PER_ELEMENT;
+}
+
+
+static void
+visit_txs(struct lp_build_nir_soa_context *bld, nir_tex_instr *instr)
+{
+   struct lp_sampler_size_query_params params;
+   LLVMValueRef sizes[4];
+   int lod_src = nir_tex_instr_src_index(instr, nir_tex_src_lod);
+   unsigned chan;
+
+   memset(&params, 0, sizeof params);
+   params.int_type = bld->int_bld.type;
+   params.texture_unit = instr->texture_index;
+   params.target = tex_target(instr);
+   params.context_ptr = bld->context_ptr;
+   params.is_sviewinfo = TRUE;
+   params.lod_property = LP_SAMPLER_LOD_SCALAR;
+   params.sizes_out = sizes;
+
+   if (instr->sampler_dim != GLSL_SAMPLER_DIM_BUF &&
+       instr->sampler_dim != GLSL_SAMPLER_DIM_RECT) {
+      if (lod_src >= 0) {
+         params.explicit_lod = cast_to(&bld->int_bld,
+                                       get_src(bld, instr->src[lod_src].src,
+                                               0));
+         params.lod_property = tex_lod_property(bld, instr->src[lod_src].src);
+      }
+      else {
+         params.explicit_lod = bld->int_bld.zero;
+      }
+   }
+
+   bld->sampler->emit_size_query(bld->sampler, bld->base.gallivm, &params);
+
+   if (instr->op == nir_texop_query_levels) {
+      assign_dest(bld, &instr->dest, 0, sizes[3]);
+      return;
+   }
+   for (chan = 0; chan < dest_num_components(&instr->dest); chan++)
+      assign_dest(bld, &instr->dest, chan, sizes[chan]);
+}
+
+
+static void
+visit_tex(struct lp_build_nir_soa_context *bld, nir_tex_instr *instr)
+{
+   struct gallivm_state *gallivm = bld->base.gallivm;
+   LLVMValueRef coords[5];
+   LLVMValueRef offsets[3] = { NULL };
+   LLVMValueRef texel[4];
+   LLVMValueRef lod = NULL;
+   struct lp_derivatives derivs;
+   struct lp_sampler_params params;
+   enum lp_sampler_lod_property lod_property = LP_SAMPLER_LOD_SCALAR;
+   unsigned sample_key, dims, i, chan;
+   boolean is_fetch = instr->op == nir_texop_txf ||
+                      instr->op == nir_texop_txf_ms;
+   struct lp_build_context *coord_bld = is_fetch ? &bld->int_bld : &bld->base;
+
+   if (!bld->sampler) {
+      _debug_printf("warning: found texture instruction but no sampler generator supplied\n");
+      bld->unsupported = TRUE;
+      assign_undef(bld, &instr->dest);
+      return;
+   }
+
+   switch (instr->op) {
+   case nir_texop_tex:
+   case nir_texop_txb:
+   case nir_texop_txl:
+   case nir_texop_txd:
+      sample_key = LP_SAMPLER_OP_TEXTURE << LP_SAMPLER_OP_TYPE_SHIFT;
+      break;
+   case nir_texop_txf:
+   case nir_texop_txf_ms:
+      sample_key = LP_SAMPLER_OP_FETCH << LP_SAMPLER_OP_TYPE_SHIFT;
+      break;
+   case nir_texop_tg4:
+      sample_key = LP_SAMPLER_OP_GATHER << LP_SAMPLER_OP_TYPE_SHIFT;
+      break;
+   case nir_texop_lod:
+      sample_key = LP_SAMPLER_OP_LODQ << LP_SAMPLER_OP_TYPE_SHIFT;
+      break;
+   case nir_texop_txs:
+   case nir_texop_query_levels:
+      visit_txs(bld, instr);
+      return;
+   default:
+      bld->unsupported = TRUE;
+      assign_undef(bld, &instr->dest);
+      return;
+   }
+
+   switch (instr->sampler_dim) {
+   case GLSL_SAMPLER_DIM_1D:
+   case GLSL_SAMPLER_DIM_BUF:
+      dims = 1;
+      break;
+   case GLSL_SAMPLER_DIM_3D:
+   case GLSL_SAMPLER_DIM_CUBE:
+      dims = 3;
+      break;
+   default:
+      dims = 2;
+      break;
+   }
+
+   for (i = 0; i < 5; i++)
+      coords[i] = coord_bld->undef;
+
+   memset(&params, 0, sizeof params);
+
+   for (i = 0; i < instr->num_srcs; i++) {
+      nir_src src = instr->src[i].src;
+
+      switch (instr->src[i].src_type) {
+      case nir_tex_src_coord:
+         for (chan = 0; chan < dims; chan++)
+            coords[chan] = cast_to(coord_bld, get_src(bld, src, chan));
+         /* the layer goes to the 3rd slot, except for cube arrays */
+         if (instr->is_array) {
+            unsigned layer = instr->sampler_dim == GLSL_SAMPLER_DIM_CUBE ?
+                             3 : 2;
+            coords[layer] = cast_to(coord_bld, get_src(bld, src, dims));
+         }
+         break;
+      case nir_tex_src_comparator:
+         sample_key |= LP_SAMPLER_SHADOW;
+         coords[4] = cast_to(&bld->base, get_src(bld, src, 0));
+         break;
+      case nir_tex_src_offset:
+         sample_key |= LP_SAMPLER_OFFSETS;
+         for (chan = 0; chan < MIN2(dims, 3); chan++)
+            offsets[chan] = cast_to(&bld->int_bld, get_src(bld, src, chan));
+         break;
+      case nir_tex_src_bias:
+         sample_key |= LP_SAMPLER_LOD_BIAS << LP_SAMPLER_LOD_CONTROL_SHIFT;
+         lod = cast_to(&bld->base, get_src(bld, src, 0));
+         lod_property = tex_lod_property(bld, src);
+         break;
+      case nir_tex_src_lod:
+         if (is_fetch &&
+             (instr->sampler_dim == GLSL_SAMPLER_DIM_BUF ||
+              instr->sampler_dim == GLSL_SAMPLER_DIM_MS))
+            break;
+         sample_key |= LP_SAMPLER_LOD_EXPLICIT << LP_SAMPLER_LOD_CONTROL_SHIFT;
+         lod = cast_to(is_fetch ? &bld->int_bld : &bld->base,
+                       get_src(bld, src, 0));
+         lod_property = tex_lod_property(bld, src);
+         break;
+      case nir_tex_src_ms_index:
+         coords[3] = cast_to(&bld->int_bld, get_src(bld, src, 0));
+         break;
+      case nir_tex_src_ddx:
+         for (chan = 0; chan < dims; chan++)
+            derivs.ddx[chan] = cast_to(&bld->base, get_src(bld, src, chan));
+         break;
+      case nir_tex_src_ddy:
+         for (chan = 0; chan < dims; chan++)
+            derivs.ddy[chan] = cast_to(&bld->base, get_src(bld, src, chan));
+         break;
+      default:
+         bld->unsupported = TRUE;
+         break;
+      }
+   }
+
+   if (instr->op == nir_texop_txd) {
+      sample_key |= LP_SAMPLER_LOD_DERIVATIVES << LP_SAMPLER_LOD_CONTROL_SHIFT;
+      params.derivs = &derivs;
+      if (bld->info->processor == PIPE_SHADER_FRAGMENT &&
+          !(gallivm_debug & GALLIVM_DEBUG_NO_QUAD_LOD))
+         lod_property = LP_SAMPLER_LOD_PER_QUAD;
+      else
+         lod_property = LP_SAMPLER_LOD_PER_ELEMENT;
+   }
+   sample_key |= lod_property << LP_SAMPLER_LOD_PROPERTY_SHIFT;
+
+   params.type = bld->base.type;
+   params.sample_key = sample_key;
+   params.texture_index = instr->texture_index;
+   /* fetches don't use the sampler, keep it in range */
+   params.sampler_index = is_fetch ? 0 : instr->sampler_index;
+   params.context_ptr = bld->context_ptr;
+   params.thread_data_ptr = bld->thread_data_ptr;
+   params.coords = coords;
+   params.offsets = offsets;
+   params.lod = lod;
+   params.texel = texel;
+
+   bld->sampler->emit_tex_sample(bld->sampler, gallivm, &params);
+
+   for (chan = 0; chan < dest_num_components(&instr->dest); chan++)
+      assign_dest(bld, &instr->dest, chan, texel[chan]);
+}
+
+
+static void
+visit_jump(struct lp_build_nir_soa_context *bld, nir_jump_instr *instr)
+{
+   switch (instr->type) {
+   case nir_jump_break:
+      lp_exec_break(&bld->exec_mask, NULL);
+      break;
+   case nir_jump_continue:
+      lp_exec_continue(&bld->exec_mask);
+      break;
+   default:
+      bld->unsupported = TRUE;
+      break;
+   }
+}
+
+
+static bool
+assign_undef_def(nir_ssa_def *def, void *data)
+{
+   struct lp_build_nir_soa_context *bld = data;
+   unsigned chan;
+
+   for (chan = 0; chan < def->num_components; chan++)
+      bld->ssa_defs[def->index * 4 + chan] = bld->int_bld.undef;
+   return true;
+}
+
+
+static void
+visit_block(struct lp_build_nir_soa_context *bld, nir_block *block)
+{
+   nir_foreach_instr(instr, block) {
+      if (!instr_supported(instr)) {
+         bld->unsupported = TRUE;
+         nir_foreach_ssa_def(instr, assign_undef_def, bld);
+         continue;
+      }
+
+      switch (instr->type) {
+      case nir_instr_type_alu:
+         visit_alu(bld, nir_instr_as_alu(instr));
+         break;
+      case nir_instr_type_load_const:
+         visit_load_const(bld, nir_instr_as_load_const(instr));
+         break;
+      case nir_instr_type_ssa_undef:
+         visit_ssa_undef(bld, nir_instr_as_ssa_undef(instr));
+         break;
+      case nir_instr_type_intrinsic:
+         visit_intrinsic(bld, nir_instr_as_intrinsic(instr));
+         break;
+      case nir_instr_type_tex:
+         visit_tex(bld, nir_instr_as_tex(instr));
+         break;
+      case nir_instr_type_jump:
+         visit_jump(bld, nir_instr_as_jump(instr));
+         break;
+      default:
+         bld->unsupported = TRUE;
+         break;
+      }
+   }
+}
+
+
+static void visit_cf_list(struct lp_build_nir_soa_context *bld,
+                          struct exec_list *list);
+
+
+static void
+visit_if(struct lp_build_nir_soa_context *bld, nir_if *nif)
+{
+   LLVMValueRef cond = cast_to(&bld->int_bld, get_src(bld, nif->condition, 0));
+
+   lp_exec_mask_cond_push(&bld->exec_mask, cond);
+   visit_cf_list(bld, &nif->then_list);
+   lp_exec_mask_cond_invert(&bld->exec_mask);
+   visit_cf_list(bld, &nif->else_list);
+   lp_exec_mask_cond_pop(&bld->exec_mask);
+}
+
+
+static void
+visit_loop(struct lp_build_nir_soa_context *bld, nir_loop *loop)
+{
+   lp_exec_bgnloop(&bld->exec_mask);
+   visit_cf_list(bld, &loop->body);
+   lp_exec_endloop(bld->base.gallivm, &bld->exec_mask);
+}
+
+
+static void
+visit_cf_list(struct lp_build_nir_soa_context *bld, struct exec_list *list)
+{
+   foreach_list_typed(nir_cf_node, node, node, list) {
+      switch (node->type) {
+      case nir_cf_node_block:
+         visit_block(bld, nir_cf_node_as_block(node));
+         break;
+      case nir_cf_node_if:
+         visit_if(bld, nir_cf_node_as_if(node));
+         break;
+      case nir_cf_node_loop:
+         visit_loop(bld, nir_cf_node_as_loop(node));
+         break;
+      default:
+         assert(0);
+         break;
+      }
+   }
+}
+
+
+/**
+ * Translate a shader prepared by lp_build_nir_prepare().
+ * \return FALSE if the shader uses something lp_build_nir_check() rejects,
+ *         in which case the generated code is garbage
+ */
+boolean
+lp_build_nir_soa(struct gallivm_state *gallivm,
+                 struct nir_shader *nir,
+                 struct lp_type type,
+                 struct lp_build_mask_context *mask,
+                 LLVMValueRef consts_ptr,
+                 LLVMValueRef const_sizes_ptr,
+                 const struct lp_bld_tgsi_system_values *system_values,
+                 const LLVMValueRef (*inputs)[TGSI_NUM_CHANNELS],
+                 LLVMValueRef (*outputs)[TGSI_NUM_CHANNELS],
+                 LLVMValueRef context_ptr,
+                 LLVMValueRef thread_data_ptr,
+                 struct lp_build_sampler_soa *sampler,
+                 const struct tgsi_shader_info *info,
+                 const struct lp_build_tgsi_mem_iface *mem_iface)
+{
+   struct lp_build_nir_soa_context bld;
+   nir_function_impl *impl = nir_shader_get_entrypoint(nir);
+   unsigned i, chan;
+
+   assert(type.length <= LP_MAX_VECTOR_LENGTH);
+
+   memset(&bld, 0, sizeof bld);
+   lp_build_context_init(&bld.base, gallivm, type);
+   lp_build_context_init(&bld.int_bld, gallivm, lp_int_type(type));
+   lp_build_context_init(&bld.uint_bld, gallivm, lp_uint_type(type));
+   bld.info = info;
+   bld.mask = mask;
+   bld.system_values = system_values;
+   bld.consts_ptr = consts_ptr;
+   bld.const_sizes_ptr = const_sizes_ptr;
+   bld.inputs = inputs;
+   bld.outputs = outputs;
+   bld.sampler = sampler;
+   bld.mem_iface = mem_iface;
+   bld.context_ptr = context_ptr;
+   bld.thread_data_ptr = thread_data_ptr;
+
+   lp_exec_mask_init(&bld.exec_mask, &bld.int_bld);
+
+   /*
+    * Fetch all constant buffer pointers upfront, for the same compile time
+    * reasons given in the TGSI translator.
+    */
+   for (i = 0; i < LP_MAX_TGSI_CONST_BUFFERS; i++) {
+      LLVMValueRef index = lp_build_const_int32(gallivm, i);
+      bld.consts[i] = lp_build_array_get(gallivm, consts_ptr, index);
+      bld.consts_sizes[i] = lp_build_array_get(gallivm, const_sizes_ptr,
+                                               index);
+   }
+
+   for (i = 0; i < info->num_outputs; i++) {
+      for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++)
+         outputs[i][chan] = lp_build_alloca(gallivm, bld.base.vec_type,
+                                            "output");
+   }
+
+   bld.ssa_defs = CALLOC(impl->ssa_alloc * 4, sizeof(LLVMValueRef));
+   bld.regs = CALLOC(MAX2(impl->reg_alloc, 1), sizeof(LLVMValueRef));
+
+   nir_foreach_register(reg, &impl->registers) {
+      unsigned size = MAX2(reg->num_array_elems, 1) * reg->num_components;
+
+      if (reg->bit_size != 32)
+         bld.unsupported = TRUE;
+      bld.regs[reg->index] =
+         lp_build_array_alloca(gallivm, bld.int_bld.vec_type,
+                               lp_build_const_int32(gallivm, size), "reg");
+   }
+
+   visit_cf_list(&bld, &impl->body);
+
+   FREE(bld.regs);
+   FREE(bld.ssa_defs);
+   lp_exec_mask_fini(&bld.exec_mask);
+
+   return !bld.unsupported;
+}
@@ -118,6 +118,7 @@ lp_sampler_static_texture_state(struct lp_static_texture_state *state,
    state->pot_height        = util_is_power_of_two(texture->height0);
    state->pot_depth         = util_is_power_of_two(texture->depth0);
    state->level_zero_only   = !view->u.tex.last_level;
+   state->nr_samples        = texture->nr_samples;
 
    /*
     * the layer / element / level parameters are all either dynamic
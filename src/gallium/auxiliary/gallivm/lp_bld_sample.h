@@ -143,6 +143,7 @@ struct lp_static_texture_state
    unsigned pot_height:1;
    unsigned pot_depth:1;
    unsigned level_zero_only:1;
+   unsigned nr_samples:5;    /**< for multisample textures, else 0 or 1 */
 };
 
 
@@ -240,6 +241,19 @@ struct lp_sampler_dynamic_state
                  LLVMValueRef context_ptr,
                  unsigned texture_unit);
 
+   /**
+    * Obtain stride in bytes between the samples of a multisample texture
+    * (returns int32).
+    *
+    * It's optional: multisample textures only return their first sample
+    * if it's NULL.
+    */
+   LLVMValueRef
+   (*sample_stride)(const struct lp_sampler_dynamic_state *state,
+                    struct gallivm_state *gallivm,
+                    LLVMValueRef context_ptr,
+                    unsigned texture_unit);
+
    /** Obtain pointer to base of texture */
    LLVMValueRef
    (*base_ptr)(const struct lp_sampler_dynamic_state *state,
@@ -2334,19 +2334,31 @@ lp_build_clamp_border_color(struct lp_build_sample_context *bld,
    }
    else {
       /* cannot figure this out from format description */
-      if (format_desc->layout == UTIL_FORMAT_LAYOUT_S3TC) {
-         /* s3tc formats are always unorm */
+      if (format_desc->layout == UTIL_FORMAT_LAYOUT_S3TC ||
+          format_desc->layout == UTIL_FORMAT_LAYOUT_ASTC) {
+         /* s3tc and (ldr) astc formats are always unorm */
          min_clamp = vec4_bld.zero;
          max_clamp = vec4_bld.one;
       }
       else if (format_desc->layout == UTIL_FORMAT_LAYOUT_RGTC ||
-               format_desc->layout == UTIL_FORMAT_LAYOUT_ETC) {
+               format_desc->layout == UTIL_FORMAT_LAYOUT_ETC ||
+               format_desc->layout == UTIL_FORMAT_LAYOUT_BPTC) {
          switch (format_desc->format) {
          case PIPE_FORMAT_RGTC1_UNORM:
          case PIPE_FORMAT_RGTC2_UNORM:
          case PIPE_FORMAT_LATC1_UNORM:
          case PIPE_FORMAT_LATC2_UNORM:
          case PIPE_FORMAT_ETC1_RGB8:
+         case PIPE_FORMAT_ETC2_RGB8:
+         case PIPE_FORMAT_ETC2_SRGB8:
+         case PIPE_FORMAT_ETC2_RGB8A1:
+         case PIPE_FORMAT_ETC2_SRGB8A1:
+         case PIPE_FORMAT_ETC2_RGBA8:
+         case PIPE_FORMAT_ETC2_SRGBA8:
+         case PIPE_FORMAT_ETC2_R11_UNORM:
+         case PIPE_FORMAT_ETC2_RG11_UNORM:
+         case PIPE_FORMAT_BPTC_RGBA_UNORM:
+         case PIPE_FORMAT_BPTC_SRGBA:
             min_clamp = vec4_bld.zero;
             max_clamp = vec4_bld.one;
             break;
@@ -2354,9 +2366,16 @@ lp_build_clamp_border_color(struct lp_build_sample_context *bld,
          case PIPE_FORMAT_RGTC2_SNORM:
          case PIPE_FORMAT_LATC1_SNORM:
          case PIPE_FORMAT_LATC2_SNORM:
+         case PIPE_FORMAT_ETC2_R11_SNORM:
+         case PIPE_FORMAT_ETC2_RG11_SNORM:
             min_clamp = lp_build_const_vec(gallivm, vec4_type, -1.0F);
             max_clamp = vec4_bld.one;
             break;
+         case PIPE_FORMAT_BPTC_RGB_UFLOAT:
+            min_clamp = vec4_bld.zero;
+            break;
+         case PIPE_FORMAT_BPTC_RGB_FLOAT:
+            break;
          default:
             assert(0);
             break;
@@ -2681,6 +2700,30 @@ lp_build_fetch_texel(struct lp_build_sample_context *bld,
                             lp_build_get_mip_offsets(bld, ilevel));
    }
 
+   /* The samples of multisample textures are stored one after the other */
+   if (bld->static_texture_state->nr_samples > 1 &&
+       bld->dynamic_state->sample_stride) {
+      LLVMValueRef sample = coords[3];
+      LLVMValueRef sample_stride;
+
+      out1 = lp_build_cmp(int_coord_bld, PIPE_FUNC_LESS,
+                          sample, int_coord_bld->zero);
+      out_of_bounds = lp_build_or(int_coord_bld, out_of_bounds, out1);
+      out1 = lp_build_cmp(int_coord_bld, PIPE_FUNC_GEQUAL, sample,
+                          lp_build_const_int_vec(bld->gallivm,
+                                                 int_coord_bld->type,
+                                                 bld->static_texture_state->nr_samples));
+      out_of_bounds = lp_build_or(int_coord_bld, out_of_bounds, out1);
+
+      sample_stride = bld->dynamic_state->sample_stride(bld->dynamic_state,
+                                                        bld->gallivm,
+                                                        bld->context_ptr,
+                                                        texture_unit);
+      sample_stride = lp_build_broadcast_scalar(int_coord_bld, sample_stride);
+      offset = lp_build_add(int_coord_bld, offset,
+                            lp_build_mul(int_coord_bld, sample, sample_stride));
+   }
+
    offset = lp_build_andnot(int_coord_bld, offset, out_of_bounds);
 
    lp_build_fetch_rgba_soa(bld->gallivm,
@@ -3397,6 +3440,22 @@ get_target_info(enum pipe_texture_target target,
 /**
  * Generate the function body for a texture sampling function.
  */
+/**
+ * Whether the texture function takes a sample index (in coords[3]), which
+ * is the case for texel fetches from multisample textures.
+ */
+static boolean
+sample_takes_ms_index(const struct lp_static_texture_state *static_texture_state,
+                      unsigned sample_key)
+{
+   unsigned op_type = (sample_key & LP_SAMPLER_OP_TYPE_MASK) >>
+                         LP_SAMPLER_OP_TYPE_SHIFT;
+
+   return op_type == LP_SAMPLER_OP_FETCH &&
+          static_texture_state->nr_samples > 1;
+}
+
+
 static void
 lp_build_sample_gen_func(struct gallivm_state *gallivm,
                          const struct lp_static_texture_state *static_texture_state,
@@ -3433,7 +3492,7 @@ lp_build_sample_gen_func(struct gallivm_state *gallivm,
    if (dynamic_state->cache_ptr) {
       const struct util_format_description *format_desc;
       format_desc = util_format_description(static_texture_state->format);
-      if (format_desc && format_desc->layout == UTIL_FORMAT_LAYOUT_S3TC) {
+      if (format_desc && lp_build_format_cacheable(format_desc)) {
          need_cache = TRUE;
       }
    }
@@ -3453,6 +3512,9 @@ lp_build_sample_gen_func(struct gallivm_state *gallivm,
    if (layer) {
       coords[layer] = LLVMGetParam(function, num_param++);
    }
+   if (sample_takes_ms_index(static_texture_state, sample_key)) {
+      coords[3] = LLVMGetParam(function, num_param++);
+   }
    if (sample_key & LP_SAMPLER_SHADOW) {
       coords[4] = LLVMGetParam(function, num_param++);
    }
@@ -3548,7 +3610,7 @@ lp_build_sample_soa_func(struct gallivm_state *gallivm,
    if (dynamic_state->cache_ptr) {
       const struct util_format_description *format_desc;
       format_desc = util_format_description(static_texture_state->format);
-      if (format_desc && format_desc->layout == UTIL_FORMAT_LAYOUT_S3TC) {
+      if (format_desc && lp_build_format_cacheable(format_desc)) {
          /*
           * This is not 100% correct, if we have cache but the
           * util_format_s3tc_prefer is true the cache won't get used
@@ -3592,6 +3654,9 @@ lp_build_sample_soa_func(struct gallivm_state *gallivm,
          arg_types[num_param++] = LLVMTypeOf(coords[layer]);
          assert(LLVMTypeOf(coords[0]) == LLVMTypeOf(coords[layer]));
       }
+      if (sample_takes_ms_index(static_texture_state, sample_key)) {
+         arg_types[num_param++] = LLVMTypeOf(coords[3]);
+      }
       if (sample_key & LP_SAMPLER_SHADOW) {
          arg_types[num_param++] = LLVMTypeOf(coords[0]);
       }
@@ -3653,6 +3718,9 @@ lp_build_sample_soa_func(struct gallivm_state *gallivm,
    if (layer) {
       args[num_args++] = coords[layer];
    }
+   if (sample_takes_ms_index(static_texture_state, sample_key)) {
+      args[num_args++] = coords[3];
+   }
    if (sample_key & LP_SAMPLER_SHADOW) {
       args[num_args++] = coords[4];
    }
@@ -170,6 +170,61 @@ struct lp_bld_tgsi_system_values {
    LLVMValueRef prim_id;
    LLVMValueRef basevertex;
    LLVMValueRef invocation_id;
+   LLVMValueRef thread_id[3];      /**< compute only, vectors */
+   LLVMValueRef block_id[3];       /**< compute only, scalars */
+   LLVMValueRef grid_size[3];      /**< compute only, scalars */
+   LLVMValueRef block_size[3];     /**< compute only, scalars */
+};
+
+
+/**
+ * Image layout, as returned by lp_build_tgsi_mem_iface::image.
+ *
+ * Coordinates are checked against width/height/depth and turned into a
+ * byte offset with the row and image strides, so for 1D arrays height is
+ * the number of layers and row_stride the layer stride, and for 2D arrays
+ * and cube maps depth is the number of layers.
+ */
+struct lp_build_image_layout
+{
+   enum pipe_format format;        /**< static, part of the variant key */
+   LLVMValueRef base_ptr;          /**< i8 *, never NULL */
+   LLVMValueRef width;
+   LLVMValueRef height;
+   LLVMValueRef depth;
+   LLVMValueRef row_stride;
+   LLVMValueRef img_stride;
+};
+
+
+/**
+ * Shader memory code generation interface.
+ *
+ * Provides the storage behind the BUFFER, MEMORY (shared) and IMAGE
+ * register files and the implementation of BARRIER. All values returned
+ * are scalars, sizes are in bytes. Callbacks may be NULL if the shader
+ * stage can't access the corresponding resources.
+ */
+struct lp_build_tgsi_mem_iface
+{
+   void (*buffer)(const struct lp_build_tgsi_mem_iface *iface,
+                  struct gallivm_state *gallivm,
+                  LLVMValueRef index,
+                  LLVMValueRef *base_ptr,
+                  LLVMValueRef *size);
+
+   void (*shared)(const struct lp_build_tgsi_mem_iface *iface,
+                  struct gallivm_state *gallivm,
+                  LLVMValueRef *base_ptr,
+                  LLVMValueRef *size);
+
+   void (*image)(const struct lp_build_tgsi_mem_iface *iface,
+                 struct gallivm_state *gallivm,
+                 unsigned unit,
+                 struct lp_build_image_layout *layout);
+
+   void (*barrier)(const struct lp_build_tgsi_mem_iface *iface,
+                   struct gallivm_state *gallivm);
 };
 
 
@@ -230,7 +285,8 @@ lp_build_tgsi_soa(struct gallivm_state *gallivm,
                   LLVMValueRef thread_data_ptr,
                   struct lp_build_sampler_soa *sampler,
                   const struct tgsi_shader_info *info,
-                  const struct lp_build_tgsi_gs_iface *gs_iface);
+                  const struct lp_build_tgsi_gs_iface *gs_iface,
+                  const struct lp_build_tgsi_mem_iface *mem_iface);
 
 
 void
@@ -306,6 +362,24 @@ struct lp_exec_mask {
    int function_stack_size;
 };
 
+/*
+ * Execution mask helpers, shared by the TGSI and NIR SoA translators.
+ */
+void lp_exec_mask_init(struct lp_exec_mask *mask, struct lp_build_context *bld);
+void lp_exec_mask_fini(struct lp_exec_mask *mask);
+void lp_exec_mask_cond_push(struct lp_exec_mask *mask, LLVMValueRef val);
+void lp_exec_mask_cond_invert(struct lp_exec_mask *mask);
+void lp_exec_mask_cond_pop(struct lp_exec_mask *mask);
+void lp_exec_bgnloop(struct lp_exec_mask *mask);
+void lp_exec_break(struct lp_exec_mask *mask,
+                   struct lp_build_tgsi_context *bld_base);
+void lp_exec_continue(struct lp_exec_mask *mask);
+void lp_exec_endloop(struct gallivm_state *gallivm, struct lp_exec_mask *mask);
+void lp_exec_mask_store(struct lp_exec_mask *mask,
+                        struct lp_build_context *bld_store,
+                        LLVMValueRef val,
+                        LLVMValueRef dst_ptr);
+
 struct lp_build_tgsi_inst_list
 {
    struct tgsi_full_instruction *instructions;
@@ -438,6 +512,10 @@ struct lp_build_tgsi_soa_context
    struct lp_build_context elem_bld;
 
    const struct lp_build_tgsi_gs_iface *gs_iface;
+   const struct lp_build_tgsi_mem_iface *mem_iface;
+
+   /** Scratch location out of bounds memory accesses are redirected to */
+   LLVMValueRef mem_dummy_ptr;
    LLVMValueRef emitted_prims_vec_ptr;
    LLVMValueRef total_emitted_vertices_vec_ptr;
    LLVMValueRef emitted_vertices_vec_ptr;
@@ -48,11 +48,14 @@
 #include "tgsi/tgsi_util.h"
 #include "tgsi/tgsi_scan.h"
 #include "tgsi/tgsi_strings.h"
+#include "util/u_format.h"
 #include "lp_bld_tgsi_action.h"
 #include "lp_bld_type.h"
 #include "lp_bld_const.h"
 #include "lp_bld_arit.h"
 #include "lp_bld_bitarit.h"
+#include "lp_bld_conv.h"
+#include "lp_bld_format.h"
 #include "lp_bld_gather.h"
 #include "lp_bld_init.h"
 #include "lp_bld_logic.h"
@@ -195,7 +198,7 @@ lp_exec_mask_function_init(struct lp_exec_mask *mask, int function_idx)
       ctx->loop_limiter);
 }
 
-static void lp_exec_mask_init(struct lp_exec_mask *mask, struct lp_build_context *bld)
+void lp_exec_mask_init(struct lp_exec_mask *mask, struct lp_build_context *bld)
 {
    mask->bld = bld;
    mask->has_mask = FALSE;
@@ -213,7 +216,7 @@ static void lp_exec_mask_init(struct lp_exec_mask *mask, struct lp_build_context
    lp_exec_mask_function_init(mask, 0);
 }
 
-static void
+void
 lp_exec_mask_fini(struct lp_exec_mask *mask)
 {
    FREE(mask->function_stack);
@@ -263,8 +266,8 @@ static void lp_exec_mask_update(struct lp_exec_mask *mask)
                      has_ret_mask);
 }
 
-static void lp_exec_mask_cond_push(struct lp_exec_mask *mask,
-                                   LLVMValueRef val)
+void lp_exec_mask_cond_push(struct lp_exec_mask *mask,
+                            LLVMValueRef val)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    struct function_ctx *ctx = func_ctx(mask);
@@ -285,7 +288,7 @@ static void lp_exec_mask_cond_push(struct lp_exec_mask *mask,
    lp_exec_mask_update(mask);
 }
 
-static void lp_exec_mask_cond_invert(struct lp_exec_mask *mask)
+void lp_exec_mask_cond_invert(struct lp_exec_mask *mask)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    struct function_ctx *ctx = func_ctx(mask);
@@ -308,7 +311,7 @@ static void lp_exec_mask_cond_invert(struct lp_exec_mask *mask)
    lp_exec_mask_update(mask);
 }
 
-static void lp_exec_mask_cond_pop(struct lp_exec_mask *mask)
+void lp_exec_mask_cond_pop(struct lp_exec_mask *mask)
 {
    struct function_ctx *ctx = func_ctx(mask);
    assert(ctx->cond_stack_size);
@@ -319,7 +322,7 @@ static void lp_exec_mask_cond_pop(struct lp_exec_mask *mask)
    lp_exec_mask_update(mask);
 }
 
-static void lp_exec_bgnloop(struct lp_exec_mask *mask)
+void lp_exec_bgnloop(struct lp_exec_mask *mask)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    struct function_ctx *ctx = func_ctx(mask);
@@ -352,8 +355,8 @@ static void lp_exec_bgnloop(struct lp_exec_mask *mask)
    lp_exec_mask_update(mask);
 }
 
-static void lp_exec_break(struct lp_exec_mask *mask,
-                          struct lp_build_tgsi_context * bld_base)
+void lp_exec_break(struct lp_exec_mask *mask,
+                   struct lp_build_tgsi_context * bld_base)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    struct function_ctx *ctx = func_ctx(mask);
@@ -402,7 +405,7 @@ static void lp_exec_break(struct lp_exec_mask *mask,
    lp_exec_mask_update(mask);
 }
 
-static void lp_exec_continue(struct lp_exec_mask *mask)
+void lp_exec_continue(struct lp_exec_mask *mask)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    LLVMValueRef exec_mask = LLVMBuildNot(builder,
@@ -417,8 +420,8 @@ static void lp_exec_continue(struct lp_exec_mask *mask)
 }
 
 
-static void lp_exec_endloop(struct gallivm_state *gallivm,
-                            struct lp_exec_mask *mask)
+void lp_exec_endloop(struct gallivm_state *gallivm,
+                     struct lp_exec_mask *mask)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    struct function_ctx *ctx = func_ctx(mask);
@@ -727,10 +730,10 @@ static void lp_exec_default(struct lp_exec_mask *mask,
  * should be stored into the address
  * (0 means don't store this bit, 1 means do store).
  */
-static void lp_exec_mask_store(struct lp_exec_mask *mask,
-                               struct lp_build_context *bld_store,
-                               LLVMValueRef val,
-                               LLVMValueRef dst_ptr)
+void lp_exec_mask_store(struct lp_exec_mask *mask,
+                        struct lp_build_context *bld_store,
+                        LLVMValueRef val,
+                        LLVMValueRef dst_ptr)
 {
    LLVMBuilderRef builder = mask->bld->gallivm->builder;
    LLVMValueRef exec_mask = mask->has_mask ? mask->exec_mask : NULL;
@@ -1647,6 +1650,36 @@ emit_fetch_system_value(
       atype = TGSI_TYPE_UNSIGNED;
       break;
 
+   case TGSI_SEMANTIC_THREAD_ID:
+      res = swizzle < 3 ? bld->system_values.thread_id[swizzle] :
+                          bld_base->uint_bld.zero;
+      atype = TGSI_TYPE_UNSIGNED;
+      break;
+
+   case TGSI_SEMANTIC_BLOCK_ID:
+      res = swizzle < 3 ?
+            lp_build_broadcast_scalar(&bld_base->uint_bld,
+                                      bld->system_values.block_id[swizzle]) :
+            bld_base->uint_bld.zero;
+      atype = TGSI_TYPE_UNSIGNED;
+      break;
+
+   case TGSI_SEMANTIC_GRID_SIZE:
+      res = swizzle < 3 ?
+            lp_build_broadcast_scalar(&bld_base->uint_bld,
+                                      bld->system_values.grid_size[swizzle]) :
+            bld_base->uint_bld.zero;
+      atype = TGSI_TYPE_UNSIGNED;
+      break;
+
+   case TGSI_SEMANTIC_BLOCK_SIZE:
+      res = swizzle < 3 ?
+            lp_build_broadcast_scalar(&bld_base->uint_bld,
+                                      bld->system_values.block_size[swizzle]) :
+            bld_base->uint_bld.zero;
+      atype = TGSI_TYPE_UNSIGNED;
+      break;
+
    default:
       assert(!"unexpected semantic in emit_fetch_system_value");
       res = bld_base->base.zero;
@@ -2479,10 +2512,6 @@ emit_fetch_texels( struct lp_build_tgsi_soa_context *bld,
       explicit_lod = lp_build_emit_fetch(&bld->bld_base, inst, 0, 3);
       lod_property = lp_build_lod_property(&bld->bld_base, inst, 0);
    }
-   /*
-    * XXX: for real msaa support, the w component (or src2.x for sample_i_ms)
-    * would be the sample index.
-    */
 
    for (i = 0; i < dims; i++) {
       coords[i] = lp_build_emit_fetch(&bld->bld_base, inst, 0, i);
@@ -2494,6 +2523,18 @@ emit_fetch_texels( struct lp_build_tgsi_soa_context *bld,
    if (layer_coord)
       coords[2] = lp_build_emit_fetch(&bld->bld_base, inst, 0, layer_coord);
 
+   /*
+    * The sample index of msaa targets is the w component (or src2.x for
+    * sample_i_ms), passed in coords[3].
+    */
+   if (target == TGSI_TEXTURE_2D_MSAA ||
+       target == TGSI_TEXTURE_2D_ARRAY_MSAA) {
+      if (inst->Instruction.Opcode == TGSI_OPCODE_SAMPLE_I_MS)
+         coords[3] = lp_build_emit_fetch(&bld->bld_base, inst, 2, TGSI_CHAN_X);
+      else
+         coords[3] = lp_build_emit_fetch(&bld->bld_base, inst, 0, TGSI_CHAN_W);
+   }
+
    if (inst->Texture.NumOffsets == 1) {
       unsigned dim;
       sample_key |= LP_SAMPLER_OFFSETS;
@@ -3310,6 +3351,798 @@ mask_vec(struct lp_build_tgsi_context *bld_base)
                        exec_mask->exec_mask, "");
 }
 
+/*
+ * Shader memory access: LOAD, STORE, ATOM* and RESQ on the BUFFER, MEMORY
+ * and IMAGE register files.
+ *
+ * Accesses are scalarized per lane. Rather than branching around inactive
+ * and out of bounds lanes, their accesses are redirected to a scratch
+ * location, which keeps the code straight-line while guaranteeing such
+ * lanes never touch the resource.
+ */
+
+static LLVMValueRef
+mem_dummy_ptr(struct lp_build_tgsi_soa_context *bld)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   LLVMTypeRef i8t = LLVMInt8TypeInContext(gallivm->context);
+
+   /* big enough for the largest texel, lives in the entry block */
+   if (!bld->mem_dummy_ptr) {
+      bld->mem_dummy_ptr = lp_build_alloca(gallivm, LLVMArrayType(i8t, 16),
+                                           "mem_dummy");
+   }
+   return LLVMBuildBitCast(gallivm->builder, bld->mem_dummy_ptr,
+                           LLVMPointerType(i8t, 0), "");
+}
+
+
+/**
+ * Pointer to base_ptr + offset if 'ok', else to scratch memory.
+ */
+static LLVMValueRef
+mem_select_ptr(struct lp_build_tgsi_soa_context *bld,
+               LLVMValueRef base_ptr, LLVMValueRef offset,
+               LLVMValueRef ok, LLVMTypeRef elem_type)
+{
+   LLVMBuilderRef builder = bld->bld_base.base.gallivm->builder;
+   LLVMValueRef ptr;
+
+   ptr = LLVMBuildGEP(builder, base_ptr, &offset, 1, "");
+   ptr = LLVMBuildSelect(builder, ok, ptr, mem_dummy_ptr(bld), "");
+   return LLVMBuildBitCast(builder, ptr, LLVMPointerType(elem_type, 0), "");
+}
+
+
+/**
+ * Pointer for one lane accessing 'bytes' bytes at 'offset' of a resource
+ * of 'size' bytes. 'in_bounds' is set to whether the access fits; the
+ * pointer refers to scratch if it doesn't or if the lane isn't active.
+ */
+static LLVMValueRef
+mem_lane_ptr(struct lp_build_tgsi_soa_context *bld,
+             LLVMValueRef base_ptr, LLVMValueRef size,
+             LLVMValueRef offset, unsigned bytes,
+             LLVMValueRef active, LLVMTypeRef elem_type,
+             LLVMValueRef *in_bounds)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef bytes_val = lp_build_const_int32(gallivm, bytes);
+   LLVMValueRef ok;
+
+   /* offset + bytes <= size, written so that it can't wrap around */
+   ok = LLVMBuildICmp(builder, LLVMIntULE, bytes_val, size, "");
+   ok = LLVMBuildAnd(builder, ok,
+                     LLVMBuildICmp(builder, LLVMIntULE, offset,
+                                   LLVMBuildSub(builder, size, bytes_val, ""),
+                                   ""), "");
+   *in_bounds = ok;
+   if (active)
+      ok = LLVMBuildAnd(builder, ok, active, "");
+
+   return mem_select_ptr(bld, base_ptr, offset, ok, elem_type);
+}
+
+
+/**
+ * Buffer index vector of a BUFFER resource register, NULL for MEMORY.
+ */
+static LLVMValueRef
+mem_resource_index(struct lp_build_tgsi_soa_context *bld,
+                   unsigned file, unsigned index, boolean indirect,
+                   const struct tgsi_ind_register *indirect_reg)
+{
+   if (file != TGSI_FILE_BUFFER)
+      return NULL;
+
+   if (indirect)
+      return get_indirect_index(bld, file, index, indirect_reg);
+
+   return lp_build_const_int_vec(bld->bld_base.base.gallivm,
+                                 bld->bld_base.uint_bld.type, index);
+}
+
+
+/**
+ * Base pointer and size of the buffer or shared memory accessed by a lane.
+ */
+static void
+mem_lane_resource(struct lp_build_tgsi_soa_context *bld,
+                  LLVMValueRef index, unsigned lane,
+                  LLVMValueRef *base_ptr, LLVMValueRef *size)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   const struct lp_build_tgsi_mem_iface *iface = bld->mem_iface;
+
+   if (index && iface->buffer) {
+      index = LLVMBuildExtractElement(gallivm->builder, index,
+                                      lp_build_const_int32(gallivm, lane), "");
+      iface->buffer(iface, gallivm, index, base_ptr, size);
+   }
+   else if (!index && iface->shared) {
+      iface->shared(iface, gallivm, base_ptr, size);
+   }
+   else {
+      *base_ptr = mem_dummy_ptr(bld);
+      *size = lp_build_const_int32(gallivm, 0);
+   }
+}
+
+
+static LLVMValueRef
+mem_lane_active(struct lp_build_tgsi_soa_context *bld,
+                LLVMValueRef mask, unsigned lane)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef active;
+
+   active = LLVMBuildExtractElement(builder, mask,
+                                    lp_build_const_int32(gallivm, lane), "");
+   return LLVMBuildICmp(builder, LLVMIntNE, active,
+                        lp_build_const_int32(gallivm, 0), "");
+}
+
+
+static LLVMValueRef
+fetch_uint(struct lp_build_tgsi_context *bld_base,
+           const struct tgsi_full_instruction *inst,
+           unsigned src_op, unsigned chan)
+{
+   return LLVMBuildBitCast(bld_base->base.gallivm->builder,
+                           lp_build_emit_fetch(bld_base, inst, src_op, chan),
+                           bld_base->uint_bld.vec_type, "");
+}
+
+
+static LLVMValueRef
+emit_atomic_op(struct gallivm_state *gallivm, unsigned opcode,
+               LLVMValueRef ptr, LLVMValueRef value, LLVMValueRef value2)
+{
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMAtomicRMWBinOp op;
+
+   switch (opcode) {
+   case TGSI_OPCODE_ATOMCAS:
+   {
+      LLVMValueRef res;
+      res = LLVMBuildAtomicCmpXchg(builder, ptr, value, value2,
+                                   LLVMAtomicOrderingSequentiallyConsistent,
+                                   LLVMAtomicOrderingSequentiallyConsistent,
+                                   FALSE);
+      return LLVMBuildExtractValue(builder, res, 0, "");
+   }
+   case TGSI_OPCODE_ATOMUADD:
+      op = LLVMAtomicRMWBinOpAdd;
+      break;
+   case TGSI_OPCODE_ATOMXCHG:
+      op = LLVMAtomicRMWBinOpXchg;
+      break;
+   case TGSI_OPCODE_ATOMAND:
+      op = LLVMAtomicRMWBinOpAnd;
+      break;
+   case TGSI_OPCODE_ATOMOR:
+      op = LLVMAtomicRMWBinOpOr;
+      break;
+   case TGSI_OPCODE_ATOMXOR:
+      op = LLVMAtomicRMWBinOpXor;
+      break;
+   case TGSI_OPCODE_ATOMUMIN:
+      op = LLVMAtomicRMWBinOpUMin;
+      break;
+   case TGSI_OPCODE_ATOMUMAX:
+      op = LLVMAtomicRMWBinOpUMax;
+      break;
+   case TGSI_OPCODE_ATOMIMIN:
+      op = LLVMAtomicRMWBinOpMin;
+      break;
+   case TGSI_OPCODE_ATOMIMAX:
+      op = LLVMAtomicRMWBinOpMax;
+      break;
+   default:
+      assert(0);
+      return lp_build_const_int32(gallivm, 0);
+   }
+
+   return LLVMBuildAtomicRMW(builder, op, ptr, value,
+                             LLVMAtomicOrderingSequentiallyConsistent,
+                             FALSE);
+}
+
+
+static void
+image_layout(struct lp_build_tgsi_soa_context *bld, unsigned unit,
+             struct lp_build_image_layout *layout)
+{
+   memset(layout, 0, sizeof *layout);
+   layout->format = PIPE_FORMAT_NONE;
+   if (bld->mem_iface->image)
+      bld->mem_iface->image(bld->mem_iface, bld->bld_base.base.gallivm,
+                            unit, layout);
+}
+
+
+static unsigned
+image_num_coords(unsigned target)
+{
+   switch (target) {
+   case TGSI_TEXTURE_BUFFER:
+   case TGSI_TEXTURE_1D:
+      return 1;
+   case TGSI_TEXTURE_2D:
+   case TGSI_TEXTURE_RECT:
+   case TGSI_TEXTURE_1D_ARRAY:
+      return 2;
+   default:
+      return 3;
+   }
+}
+
+
+/**
+ * Byte offsets of the texels addressed by the coordinates in source
+ * 'coord_src'. Out of bounds lanes get offset zero and are cleared in
+ * 'in_bounds'.
+ */
+static LLVMValueRef
+image_offsets(struct lp_build_tgsi_soa_context *bld,
+              const struct tgsi_full_instruction *inst,
+              unsigned coord_src,
+              const struct lp_build_image_layout *layout,
+              LLVMValueRef *in_bounds)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   struct lp_build_context *uint_bld = &bld->bld_base.uint_bld;
+   unsigned blocksize = util_format_get_blocksize(layout->format);
+   unsigned num_coords = image_num_coords(inst->Memory.Texture);
+   LLVMValueRef dims[3], strides[3];
+   LLVMValueRef offset = uint_bld->zero;
+   LLVMValueRef ok = NULL;
+   unsigned i;
+
+   dims[0] = layout->width;
+   dims[1] = layout->height;
+   dims[2] = layout->depth;
+   strides[0] = lp_build_const_int32(gallivm, blocksize);
+   strides[1] = layout->row_stride;
+   strides[2] = layout->img_stride;
+
+   for (i = 0; i < num_coords; i++) {
+      LLVMValueRef coord = fetch_uint(&bld->bld_base, inst, coord_src, i);
+      LLVMValueRef inside;
+
+      /* unsigned compare catches negative coordinates too */
+      inside = lp_build_cmp(uint_bld, PIPE_FUNC_LESS, coord,
+                            lp_build_broadcast_scalar(uint_bld, dims[i]));
+      ok = ok ? LLVMBuildAnd(gallivm->builder, ok, inside, "") : inside;
+      coord = lp_build_mul(uint_bld, coord,
+                           lp_build_broadcast_scalar(uint_bld, strides[i]));
+      offset = lp_build_add(uint_bld, offset, coord);
+   }
+
+   *in_bounds = ok;
+   return lp_build_select(uint_bld, ok, offset, uint_bld->zero);
+}
+
+
+/**
+ * Convert SoA rgba values to the packed texel layout of an image format,
+ * returning the number of dwords (with sub-dword texels in the first one),
+ * or zero if the format can't be stored to.
+ */
+static unsigned
+image_pack(struct lp_build_tgsi_soa_context *bld,
+           const struct util_format_description *desc,
+           LLVMValueRef rgba[4],
+           LLVMValueRef packed[4])
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   struct lp_build_context *float_bld = &bld->bld_base.base;
+   struct lp_build_context *int_bld = &bld->bld_base.int_bld;
+   struct lp_build_context *uint_bld = &bld->bld_base.uint_bld;
+   LLVMBuilderRef builder = gallivm->builder;
+   unsigned num_dwords = MAX2(desc->block.bits / 32, 1);
+   unsigned c, i;
+
+   if (desc->format == PIPE_FORMAT_R11G11B10_FLOAT) {
+      packed[0] = lp_build_float_to_r11g11b10(gallivm, rgba);
+      return 1;
+   }
+
+   if (desc->layout != UTIL_FORMAT_LAYOUT_PLAIN ||
+       desc->colorspace != UTIL_FORMAT_COLORSPACE_RGB ||
+       desc->block.bits > 128 ||
+       (desc->block.bits > 32 && desc->block.bits % 32))
+      return 0;
+
+   for (i = 0; i < num_dwords; i++)
+      packed[i] = uint_bld->zero;
+
+   for (c = 0; c < desc->nr_channels; c++) {
+      const struct util_format_channel_description *chan = &desc->channel[c];
+      unsigned width = chan->size;
+      LLVMValueRef value = NULL;
+
+      for (i = 0; i < 4; i++) {
+         if (desc->swizzle[i] == c)
+            value = rgba[i];
+      }
+      if (!value || chan->type == UTIL_FORMAT_TYPE_VOID)
+         continue;
+      if (width > 32 || chan->shift % 32 + width > 32)
+         return 0;
+
+      switch (chan->type) {
+      case UTIL_FORMAT_TYPE_FLOAT:
+         if (width == 32) {
+            value = LLVMBuildBitCast(builder, value, uint_bld->vec_type, "");
+         }
+         else if (width == 16) {
+            value = lp_build_float_to_half(gallivm, value);
+            value = LLVMBuildZExt(builder, value, uint_bld->vec_type, "");
+         }
+         else {
+            return 0;
+         }
+         break;
+      case UTIL_FORMAT_TYPE_UNSIGNED:
+         if (chan->normalized) {
+            value = lp_build_clamped_float_to_unsigned_norm(gallivm,
+                                                            float_bld->type,
+                                                            width, value);
+         }
+         else {
+            value = LLVMBuildBitCast(builder, value, uint_bld->vec_type, "");
+            if (width < 32) {
+               value = lp_build_min(uint_bld, value,
+                                    lp_build_const_int_vec(gallivm,
+                                                           uint_bld->type,
+                                                           (1u << width) - 1));
+            }
+         }
+         break;
+      case UTIL_FORMAT_TYPE_SIGNED:
+         if (chan->normalized) {
+            double scale = (double)((1u << (width - 1)) - 1);
+            value = lp_build_clamp(float_bld, value,
+                                   lp_build_const_vec(gallivm, float_bld->type,
+                                                      -1.0),
+                                   float_bld->one);
+            value = lp_build_mul(float_bld, value,
+                                 lp_build_const_vec(gallivm, float_bld->type,
+                                                    scale));
+            value = lp_build_iround(float_bld, value);
+         }
+         else {
+            value = LLVMBuildBitCast(builder, value, int_bld->vec_type, "");
+            if (width < 32) {
+               int max = (1 << (width - 1)) - 1;
+               value = lp_build_clamp(int_bld, value,
+                                      lp_build_const_int_vec(gallivm,
+                                                             int_bld->type,
+                                                             -max - 1),
+                                      lp_build_const_int_vec(gallivm,
+                                                             int_bld->type,
+                                                             max));
+            }
+         }
+         value = LLVMBuildBitCast(builder, value, uint_bld->vec_type, "");
+         break;
+      default:
+         return 0;
+      }
+
+      if (width < 32) {
+         value = LLVMBuildAnd(builder, value,
+                              lp_build_const_int_vec(gallivm, uint_bld->type,
+                                                     (1u << width) - 1), "");
+      }
+      if (chan->shift % 32) {
+         value = LLVMBuildShl(builder, value,
+                              lp_build_const_int_vec(gallivm, uint_bld->type,
+                                                     chan->shift % 32), "");
+      }
+      packed[chan->shift / 32] = LLVMBuildOr(builder, packed[chan->shift / 32],
+                                             value, "");
+   }
+
+   return num_dwords;
+}
+
+
+static void
+emit_image_load(struct lp_build_tgsi_soa_context *bld,
+                const struct tgsi_full_instruction *inst,
+                LLVMValueRef *output)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   struct lp_build_context *uint_bld = &bld->bld_base.uint_bld;
+   LLVMBuilderRef builder = gallivm->builder;
+   const struct util_format_description *desc;
+   struct lp_build_image_layout layout;
+   struct lp_type fetch_type;
+   LLVMValueRef offset, in_bounds, rgba[4];
+   unsigned chan;
+
+   image_layout(bld, inst->Src[0].Register.Index, &layout);
+   if (layout.format == PIPE_FORMAT_NONE) {
+      for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++)
+         output[chan] = bld->bld_base.base.zero;
+      return;
+   }
+
+   desc = util_format_description(layout.format);
+   offset = image_offsets(bld, inst, 1, &layout, &in_bounds);
+
+   if (util_format_is_pure_uint(layout.format))
+      fetch_type = uint_bld->type;
+   else if (util_format_is_pure_sint(layout.format))
+      fetch_type = bld->bld_base.int_bld.type;
+   else
+      fetch_type = bld->bld_base.base.type;
+
+   lp_build_fetch_rgba_soa(gallivm, desc, fetch_type, TRUE,
+                           layout.base_ptr, offset, NULL, NULL, NULL, rgba);
+
+   for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
+      LLVMValueRef value;
+      value = LLVMBuildBitCast(builder, rgba[chan], uint_bld->vec_type, "");
+      value = lp_build_select(uint_bld, in_bounds, value, uint_bld->zero);
+      output[chan] = LLVMBuildBitCast(builder, value,
+                                      bld->bld_base.base.vec_type, "");
+   }
+}
+
+
+static void
+emit_image_store(struct lp_build_tgsi_soa_context *bld,
+                 const struct tgsi_full_instruction *inst)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   struct lp_build_context *uint_bld = &bld->bld_base.uint_bld;
+   LLVMBuilderRef builder = gallivm->builder;
+   const struct util_format_description *desc;
+   struct lp_build_image_layout layout;
+   LLVMValueRef offset, in_bounds, ok, rgba[4], packed[4];
+   LLVMTypeRef elem_type;
+   unsigned num_dwords, chan, lane, i;
+
+   image_layout(bld, inst->Dst[0].Register.Index, &layout);
+   if (layout.format == PIPE_FORMAT_NONE)
+      return;
+
+   desc = util_format_description(layout.format);
+   for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
+      rgba[chan] = LLVMBuildBitCast(builder,
+                                    lp_build_emit_fetch(&bld->bld_base, inst,
+                                                        1, chan),
+                                    bld->bld_base.base.vec_type, "");
+   }
+   num_dwords = image_pack(bld, desc, rgba, packed);
+   if (!num_dwords)
+      return;
+
+   offset = image_offsets(bld, inst, 0, &layout, &in_bounds);
+   ok = LLVMBuildAnd(builder, in_bounds, mask_vec(&bld->bld_base), "");
+   elem_type = LLVMIntTypeInContext(gallivm->context,
+                                    MIN2(desc->block.bits, 32));
+
+   for (lane = 0; lane < uint_bld->type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef ptr;
+
+      ptr = mem_select_ptr(bld, layout.base_ptr,
+                           LLVMBuildExtractElement(builder, offset,
+                                                   lane_idx, ""),
+                           mem_lane_active(bld, ok, lane), elem_type);
+      for (i = 0; i < num_dwords; i++) {
+         LLVMValueRef value, index = lp_build_const_int32(gallivm, i);
+         value = LLVMBuildExtractElement(builder, packed[i], lane_idx, "");
+         value = LLVMBuildTrunc(builder, value, elem_type, "");
+         LLVMBuildStore(builder, value,
+                        LLVMBuildGEP(builder, ptr, &index, 1, ""));
+      }
+   }
+}
+
+
+static void
+emit_image_atomic(struct lp_build_tgsi_soa_context *bld,
+                  const struct tgsi_full_instruction *inst,
+                  LLVMValueRef *output)
+{
+   struct gallivm_state *gallivm = bld->bld_base.base.gallivm;
+   struct lp_build_context *uint_bld = &bld->bld_base.uint_bld;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
+   struct lp_build_image_layout layout;
+   LLVMValueRef offset, in_bounds, ok, value, value2 = NULL;
+   LLVMValueRef result = uint_bld->undef;
+   unsigned lane;
+
+   image_layout(bld, inst->Src[0].Register.Index, &layout);
+   if (layout.format != PIPE_FORMAT_R32_UINT &&
+       layout.format != PIPE_FORMAT_R32_SINT) {
+      output[0] = bld->bld_base.base.zero;
+      return;
+   }
+
+   offset = image_offsets(bld, inst, 1, &layout, &in_bounds);
+   ok = LLVMBuildAnd(builder, in_bounds, mask_vec(&bld->bld_base), "");
+   value = fetch_uint(&bld->bld_base, inst, 2, TGSI_CHAN_X);
+   if (inst->Instruction.Opcode == TGSI_OPCODE_ATOMCAS)
+      value2 = fetch_uint(&bld->bld_base, inst, 3, TGSI_CHAN_X);
+
+   for (lane = 0; lane < uint_bld->type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef ptr, old;
+
+      ptr = mem_select_ptr(bld, layout.base_ptr,
+                           LLVMBuildExtractElement(builder, offset,
+                                                   lane_idx, ""),
+                           mem_lane_active(bld, ok, lane), i32t);
+      old = emit_atomic_op(gallivm, inst->Instruction.Opcode, ptr,
+                           LLVMBuildExtractElement(builder, value,
+                                                   lane_idx, ""),
+                           value2 ? LLVMBuildExtractElement(builder, value2,
+                                                            lane_idx, "") :
+                                    NULL);
+      result = LLVMBuildInsertElement(builder, result, old, lane_idx, "");
+   }
+
+   result = lp_build_select(uint_bld, in_bounds, result, uint_bld->zero);
+   output[0] = LLVMBuildBitCast(builder, result,
+                                bld->bld_base.base.vec_type, "");
+}
+
+
+static void
+load_emit(
+   const struct lp_build_tgsi_action * action,
+   struct lp_build_tgsi_context * bld_base,
+   struct lp_build_emit_data * emit_data)
+{
+   struct lp_build_tgsi_soa_context * bld = lp_soa_context(bld_base);
+   struct gallivm_state *gallivm = bld_base->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
+   const struct tgsi_full_instruction *inst = emit_data->inst;
+   const struct tgsi_full_src_register *res = &inst->Src[0];
+   LLVMValueRef index, offset, result[TGSI_NUM_CHANNELS];
+   unsigned chan, lane;
+
+   if (res->Register.File == TGSI_FILE_IMAGE) {
+      emit_image_load(bld, inst, emit_data->output);
+      return;
+   }
+
+   index = mem_resource_index(bld, res->Register.File, res->Register.Index,
+                              res->Register.Indirect, &res->Indirect);
+   offset = fetch_uint(bld_base, inst, 1, TGSI_CHAN_X);
+
+   for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++)
+      result[chan] = bld_base->uint_bld.undef;
+
+   for (lane = 0; lane < bld_base->uint_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef base_ptr, size, lane_offset;
+
+      mem_lane_resource(bld, index, lane, &base_ptr, &size);
+      lane_offset = LLVMBuildExtractElement(builder, offset, lane_idx, "");
+
+      TGSI_FOR_EACH_DST0_ENABLED_CHANNEL(inst, chan) {
+         LLVMValueRef chan_offset, ptr, in_bounds, value;
+
+         chan_offset = LLVMBuildAdd(builder, lane_offset,
+                                    lp_build_const_int32(gallivm, 4 * chan),
+                                    "");
+         ptr = mem_lane_ptr(bld, base_ptr, size, chan_offset, 4, NULL, i32t,
+                            &in_bounds);
+         value = LLVMBuildLoad(builder, ptr, "");
+         value = LLVMBuildSelect(builder, in_bounds, value,
+                                 lp_build_const_int32(gallivm, 0), "");
+         result[chan] = LLVMBuildInsertElement(builder, result[chan], value,
+                                               lane_idx, "");
+      }
+   }
+
+   TGSI_FOR_EACH_DST0_ENABLED_CHANNEL(inst, chan) {
+      emit_data->output[chan] = LLVMBuildBitCast(builder, result[chan],
+                                                 bld_base->base.vec_type, "");
+   }
+}
+
+
+static void
+store_emit(
+   const struct lp_build_tgsi_action * action,
+   struct lp_build_tgsi_context * bld_base,
+   struct lp_build_emit_data * emit_data)
+{
+   struct lp_build_tgsi_soa_context * bld = lp_soa_context(bld_base);
+   struct gallivm_state *gallivm = bld_base->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
+   const struct tgsi_full_instruction *inst = emit_data->inst;
+   const struct tgsi_full_dst_register *res = &inst->Dst[0];
+   LLVMValueRef index, offset, exec_mask, value[TGSI_NUM_CHANNELS];
+   unsigned chan, lane;
+
+   if (res->Register.File == TGSI_FILE_IMAGE) {
+      emit_image_store(bld, inst);
+      return;
+   }
+
+   index = mem_resource_index(bld, res->Register.File, res->Register.Index,
+                              res->Register.Indirect, &res->Indirect);
+   offset = fetch_uint(bld_base, inst, 0, TGSI_CHAN_X);
+   exec_mask = mask_vec(bld_base);
+
+   TGSI_FOR_EACH_DST0_ENABLED_CHANNEL(inst, chan) {
+      value[chan] = fetch_uint(bld_base, inst, 1, chan);
+   }
+
+   for (lane = 0; lane < bld_base->uint_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef base_ptr, size, lane_offset, active;
+
+      mem_lane_resource(bld, index, lane, &base_ptr, &size);
+      lane_offset = LLVMBuildExtractElement(builder, offset, lane_idx, "");
+      active = mem_lane_active(bld, exec_mask, lane);
+
+      TGSI_FOR_EACH_DST0_ENABLED_CHANNEL(inst, chan) {
+         LLVMValueRef chan_offset, ptr, in_bounds;
+
+         chan_offset = LLVMBuildAdd(builder, lane_offset,
+                                    lp_build_const_int32(gallivm, 4 * chan),
+                                    "");
+         ptr = mem_lane_ptr(bld, base_ptr, size, chan_offset, 4, active, i32t,
+                            &in_bounds);
+         LLVMBuildStore(builder,
+                        LLVMBuildExtractElement(builder, value[chan],
+                                                lane_idx, ""),
+                        ptr);
+      }
+   }
+}
+
+
+static void
+atomic_emit(
+   const struct lp_build_tgsi_action * action,
+   struct lp_build_tgsi_context * bld_base,
+   struct lp_build_emit_data * emit_data)
+{
+   struct lp_build_tgsi_soa_context * bld = lp_soa_context(bld_base);
+   struct gallivm_state *gallivm = bld_base->base.gallivm;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMTypeRef i32t = LLVMInt32TypeInContext(gallivm->context);
+   const struct tgsi_full_instruction *inst = emit_data->inst;
+   const struct tgsi_full_src_register *res = &inst->Src[0];
+   LLVMValueRef index, offset, exec_mask, value, value2 = NULL;
+   LLVMValueRef result = bld_base->uint_bld.undef;
+   unsigned lane;
+
+   if (res->Register.File == TGSI_FILE_IMAGE) {
+      emit_image_atomic(bld, inst, emit_data->output);
+      return;
+   }
+
+   index = mem_resource_index(bld, res->Register.File, res->Register.Index,
+                              res->Register.Indirect, &res->Indirect);
+   offset = fetch_uint(bld_base, inst, 1, TGSI_CHAN_X);
+   value = fetch_uint(bld_base, inst, 2, TGSI_CHAN_X);
+   if (inst->Instruction.Opcode == TGSI_OPCODE_ATOMCAS)
+      value2 = fetch_uint(bld_base, inst, 3, TGSI_CHAN_X);
+   exec_mask = mask_vec(bld_base);
+
+   for (lane = 0; lane < bld_base->uint_bld.type.length; lane++) {
+      LLVMValueRef lane_idx = lp_build_const_int32(gallivm, lane);
+      LLVMValueRef base_ptr, size, ptr, in_bounds, old;
+
+      mem_lane_resource(bld, index, lane, &base_ptr, &size);
+      ptr = mem_lane_ptr(bld, base_ptr, size,
+                         LLVMBuildExtractElement(builder, offset,
+                                                 lane_idx, ""),
+                         4, mem_lane_active(bld, exec_mask, lane), i32t,
+                         &in_bounds);
+      old = emit_atomic_op(gallivm, inst->Instruction.Opcode, ptr,
+                           LLVMBuildExtractElement(builder, value,
+                                                   lane_idx, ""),
+                           value2 ? LLVMBuildExtractElement(builder, value2,
+                                                            lane_idx, "") :
+                                    NULL);
+      old = LLVMBuildSelect(builder, in_bounds, old,
+                            lp_build_const_int32(gallivm, 0), "");
+      result = LLVMBuildInsertElement(builder, result, old, lane_idx, "");
+   }
+
+   emit_data->output[0] = LLVMBuildBitCast(builder, result,
+                                           bld_base->base.vec_type, "");
+}
+
+
+static void
+resq_emit(
+   const struct lp_build_tgsi_action * action,
+   struct lp_build_tgsi_context * bld_base,
+   struct lp_build_emit_data * emit_data)
+{
+   struct lp_build_tgsi_soa_context * bld = lp_soa_context(bld_base);
+   struct gallivm_state *gallivm = bld_base->base.gallivm;
+   struct lp_build_context *uint_bld = &bld_base->uint_bld;
+   LLVMBuilderRef builder = gallivm->builder;
+   const struct tgsi_full_instruction *inst = emit_data->inst;
+   const struct tgsi_full_src_register *res = &inst->Src[0];
+   LLVMValueRef result[TGSI_NUM_CHANNELS];
+   unsigned chan;
+
+   result[1] = result[2] = result[3] = uint_bld->zero;
+
+   if (res->Register.File == TGSI_FILE_IMAGE) {
+      struct lp_build_image_layout layout;
+
+      image_layout(bld, res->Register.Index, &layout);
+      if (layout.format == PIPE_FORMAT_NONE) {
+         result[0] = uint_bld->zero;
+      }
+      else {
+         LLVMValueRef depth = layout.depth;
+         /* cube arrays report the number of cubes */
+         if (inst->Memory.Texture == TGSI_TEXTURE_CUBE_ARRAY)
+            depth = LLVMBuildUDiv(builder, depth,
+                                  lp_build_const_int32(gallivm, 6), "");
+         result[0] = lp_build_broadcast_scalar(uint_bld, layout.width);
+         result[1] = lp_build_broadcast_scalar(uint_bld, layout.height);
+         result[2] = lp_build_broadcast_scalar(uint_bld, depth);
+      }
+   }
+   else {
+      LLVMValueRef index, base_ptr, size;
+      unsigned lane;
+
+      index = mem_resource_index(bld, res->Register.File,
+                                 res->Register.Index,
+                                 res->Register.Indirect, &res->Indirect);
+      result[0] = uint_bld->undef;
+      for (lane = 0; lane < uint_bld->type.length; lane++) {
+         mem_lane_resource(bld, index, lane, &base_ptr, &size);
+         result[0] = LLVMBuildInsertElement(builder, result[0], size,
+                                            lp_build_const_int32(gallivm,
+                                                                 lane), "");
+      }
+   }
+
+   TGSI_FOR_EACH_DST0_ENABLED_CHANNEL(inst, chan) {
+      emit_data->output[chan] = LLVMBuildBitCast(builder, result[chan],
+                                                 bld_base->base.vec_type, "");
+   }
+}
+
+
+static void
+membar_emit(
+   const struct lp_build_tgsi_action * action,
+   struct lp_build_tgsi_context * bld_base,
+   struct lp_build_emit_data * emit_data)
+{
+   LLVMBuildFence(bld_base->base.gallivm->builder,
+                  LLVMAtomicOrderingSequentiallyConsistent, FALSE, "");
+}
+
+
+static void
+barrier_emit(
+   const struct lp_build_tgsi_action * action,
+   struct lp_build_tgsi_context * bld_base,
+   struct lp_build_emit_data * emit_data)
+{
+   struct lp_build_tgsi_soa_context * bld = lp_soa_context(bld_base);
+
+   bld->mem_iface->barrier(bld->mem_iface, bld_base->base.gallivm);
+}
+
 static void
 increment_vec_ptr_by_mask(struct lp_build_tgsi_context * bld_base,
                           LLVMValueRef ptr,
@@ -3782,7 +4615,8 @@ lp_build_tgsi_soa(struct gallivm_state *gallivm,
                   LLVMValueRef thread_data_ptr,
                   struct lp_build_sampler_soa *sampler,
                   const struct tgsi_shader_info *info,
-                  const struct lp_build_tgsi_gs_iface *gs_iface)
+                  const struct lp_build_tgsi_gs_iface *gs_iface,
+                  const struct lp_build_tgsi_mem_iface *mem_iface)
 {
    struct lp_build_tgsi_soa_context bld;
 
@@ -3938,6 +4772,26 @@ lp_build_tgsi_soa(struct gallivm_state *gallivm,
                                 max_output_vertices);
    }
 
+   if (mem_iface) {
+      bld.mem_iface = mem_iface;
+      bld.bld_base.op_actions[TGSI_OPCODE_LOAD].emit = load_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_STORE].emit = store_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_RESQ].emit = resq_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMUADD].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMXCHG].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMCAS].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMAND].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMOR].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMXOR].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMUMIN].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMUMAX].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMIMIN].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_ATOMIMAX].emit = atomic_emit;
+      bld.bld_base.op_actions[TGSI_OPCODE_MEMBAR].emit = membar_emit;
+      if (mem_iface->barrier)
+         bld.bld_base.op_actions[TGSI_OPCODE_BARRIER].emit = barrier_emit;
+   }
+
    lp_exec_mask_init(&bld.exec_mask, &bld.bld_base.int_bld);
 
    bld.system_values = *system_values;
@@ -0,0 +1,420 @@
+/*
+ * Copyright 2018 VMware, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * Fill in a tgsi_shader_info from a NIR shader, so that drivers and the
+ * draw module can consume NIR shaders through the same summary they get
+ * from tgsi_scan_shader() for TGSI.
+ *
+ * The shader is expected to come from the state tracker, after
+ * st_finalize_nir(): varyings have their driver_location assigned and
+ * follow the generic slot layout used when the driver doesn't ask for
+ * TGSI_SEMANTIC_TEXCOORD, and samplers have been lowered to indices.
+ */
+
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "compiler/nir/nir.h"
+#include "compiler/nir_types.h"
+#include "tgsi/tgsi_from_mesa.h"
+#include "tgsi/tgsi_scan.h"
+#include "nir_to_tgsi_info.h"
+
+
+/**
+ * Components of each slot covered by a variable.
+ */
+static unsigned
+var_usage_mask(const nir_variable *var)
+{
+   const struct glsl_type *type = glsl_without_array(var->type);
+   unsigned num_components;
+
+   if (!glsl_type_is_vector_or_scalar(type) &&
+       !glsl_type_is_matrix(type))
+      return TGSI_WRITEMASK_XYZW;
+
+   num_components = glsl_get_vector_elements(type);
+   if (glsl_type_is_64bit(type))
+      num_components *= 2;
+
+   return (u_bit_consecutive(0, MIN2(num_components, 4)) <<
+           var->data.location_frac) & TGSI_WRITEMASK_XYZW;
+}
+
+
+/**
+ * Semantic of a varying slot, matching what st/mesa emits in TGSI when the
+ * driver doesn't advertise PIPE_CAP_TGSI_TEXCOORD.
+ */
+static void
+varying_semantic(gl_varying_slot slot,
+                 unsigned *semantic_name, unsigned *semantic_index)
+{
+   if (slot >= VARYING_SLOT_VAR0 && slot < VARYING_SLOT_PATCH0) {
+      /* st_nir_fixup_varying_slots() already moved texcoords into VARn */
+      *semantic_name = TGSI_SEMANTIC_GENERIC;
+      *semantic_index = slot - VARYING_SLOT_VAR0;
+   }
+   else if (slot == VARYING_SLOT_PNTC) {
+      *semantic_name = TGSI_SEMANTIC_GENERIC;
+      *semantic_index = 8;
+   }
+   else if (slot == VARYING_SLOT_FACE) {
+      *semantic_name = TGSI_SEMANTIC_FACE;
+      *semantic_index = 0;
+   }
+   else {
+      tgsi_get_gl_varying_semantic(slot, false,
+                                   semantic_name, semantic_index);
+   }
+}
+
+
+static unsigned
+fs_input_interpolate(const nir_variable *var, unsigned semantic_name)
+{
+   switch (semantic_name) {
+   case TGSI_SEMANTIC_POSITION:
+      return TGSI_INTERPOLATE_LINEAR;
+   case TGSI_SEMANTIC_FACE:
+      return TGSI_INTERPOLATE_CONSTANT;
+   default:
+      break;
+   }
+
+   if (var->data.location == VARYING_SLOT_PNTC)
+      return TGSI_INTERPOLATE_LINEAR;
+
+   switch (var->data.interpolation) {
+   case INTERP_MODE_FLAT:
+      return TGSI_INTERPOLATE_CONSTANT;
+   case INTERP_MODE_NOPERSPECTIVE:
+      return TGSI_INTERPOLATE_LINEAR;
+   case INTERP_MODE_SMOOTH:
+      return TGSI_INTERPOLATE_PERSPECTIVE;
+   case INTERP_MODE_NONE:
+   default:
+      if (semantic_name == TGSI_SEMANTIC_COLOR)
+         return TGSI_INTERPOLATE_COLOR;
+      return TGSI_INTERPOLATE_PERSPECTIVE;
+   }
+}
+
+
+static void
+scan_inputs(const nir_shader *nir, struct tgsi_shader_info *info)
+{
+   nir_foreach_variable(var, &nir->inputs) {
+      unsigned num_slots =
+         glsl_count_attribute_slots(var->type,
+                                    nir->info.stage == MESA_SHADER_VERTEX);
+      unsigned usage_mask = var_usage_mask(var);
+      unsigned i;
+
+      for (i = 0; i < num_slots; i++) {
+         unsigned slot = var->data.driver_location + i;
+         unsigned semantic_name = TGSI_SEMANTIC_GENERIC;
+         unsigned semantic_index = slot;
+
+         if (slot >= PIPE_MAX_SHADER_INPUTS)
+            break;
+
+         if (nir->info.stage == MESA_SHADER_FRAGMENT) {
+            varying_semantic(var->data.location + i,
+                             &semantic_name, &semantic_index);
+
+            info->input_interpolate[slot] =
+               fs_input_interpolate(var, semantic_name);
+            info->input_interpolate_loc[slot] =
+               var->data.sample ? TGSI_INTERPOLATE_LOC_SAMPLE :
+               var->data.centroid ? TGSI_INTERPOLATE_LOC_CENTROID :
+               TGSI_INTERPOLATE_LOC_CENTER;
+
+            switch (semantic_name) {
+            case TGSI_SEMANTIC_POSITION:
+               info->reads_position = TRUE;
+               info->properties[TGSI_PROPERTY_FS_COORD_PIXEL_CENTER] =
+                  var->data.pixel_center_integer;
+               usage_mask = TGSI_WRITEMASK_XYZW;
+               break;
+            case TGSI_SEMANTIC_FACE:
+               info->uses_frontface = TRUE;
+               usage_mask = TGSI_WRITEMASK_X;
+               break;
+            case TGSI_SEMANTIC_PRIMID:
+               info->uses_primid = TRUE;
+               break;
+            case TGSI_SEMANTIC_COLOR:
+               info->colors_read |= usage_mask << (4 * semantic_index);
+               break;
+            }
+         }
+         else {
+            usage_mask = TGSI_WRITEMASK_XYZW;
+         }
+
+         info->input_semantic_name[slot] = semantic_name;
+         info->input_semantic_index[slot] = semantic_index;
+         info->input_usage_mask[slot] |= usage_mask;
+         info->num_inputs = MAX2(info->num_inputs, slot + 1);
+      }
+   }
+}
+
+
+static void
+scan_outputs(const nir_shader *nir, struct tgsi_shader_info *info)
+{
+   nir_foreach_variable(var, &nir->outputs) {
+      unsigned num_slots = glsl_count_attribute_slots(var->type, false);
+      unsigned usage_mask = var_usage_mask(var);
+      unsigned i;
+
+      for (i = 0; i < num_slots; i++) {
+         unsigned slot = var->data.driver_location + i;
+         unsigned semantic_name, semantic_index;
+
+         if (slot >= PIPE_MAX_SHADER_OUTPUTS)
+            break;
+
+         if (nir->info.stage == MESA_SHADER_FRAGMENT) {
+            tgsi_get_gl_frag_result_semantic(var->data.location + i,
+                                             &semantic_name,
+                                             &semantic_index);
+            /* dual source blending writes the second color as index 1 */
+            semantic_index += var->data.index;
+
+            switch (var->data.location) {
+            case FRAG_RESULT_COLOR:
+               info->properties[TGSI_PROPERTY_FS_COLOR0_WRITES_ALL_CBUFS] = 1;
+               break;
+            case FRAG_RESULT_DEPTH:
+               info->writes_z = TRUE;
+               break;
+            case FRAG_RESULT_STENCIL:
+               info->writes_stencil = TRUE;
+               break;
+            case FRAG_RESULT_SAMPLE_MASK:
+               info->writes_samplemask = TRUE;
+               break;
+            default:
+               break;
+            }
+            if (semantic_name == TGSI_SEMANTIC_COLOR)
+               info->colors_written |= 1 << semantic_index;
+         }
+         else {
+            varying_semantic(var->data.location + i,
+                             &semantic_name, &semantic_index);
+
+            switch (semantic_name) {
+            case TGSI_SEMANTIC_POSITION:
+               info->writes_position = TRUE;
+               break;
+            case TGSI_SEMANTIC_PSIZE:
+               info->writes_psize = TRUE;
+               break;
+            case TGSI_SEMANTIC_EDGEFLAG:
+               info->writes_edgeflag = TRUE;
+               break;
+            case TGSI_SEMANTIC_CLIPVERTEX:
+               info->writes_clipvertex = TRUE;
+               break;
+            case TGSI_SEMANTIC_PRIMID:
+               info->writes_primid = TRUE;
+               break;
+            case TGSI_SEMANTIC_VIEWPORT_INDEX:
+               info->writes_viewport_index = TRUE;
+               break;
+            case TGSI_SEMANTIC_LAYER:
+               info->writes_layer = TRUE;
+               break;
+            }
+         }
+
+         info->output_semantic_name[slot] = semantic_name;
+         info->output_semantic_index[slot] = semantic_index;
+         info->output_usagemask[slot] |= usage_mask;
+         info->num_outputs = MAX2(info->num_outputs, slot + 1);
+      }
+   }
+
+   info->num_written_clipdistance = nir->info.clip_distance_array_size;
+   info->num_written_culldistance = nir->info.cull_distance_array_size;
+   info->clipdist_writemask =
+      u_bit_consecutive(0, info->num_written_clipdistance);
+   info->culldist_writemask =
+      u_bit_consecutive(0, info->num_written_culldistance);
+}
+
+
+static void
+scan_tex(const nir_tex_instr *tex, struct tgsi_shader_info *info)
+{
+   unsigned unit = tex->texture_index;
+
+   if (unit >= PIPE_MAX_SAMPLERS)
+      return;
+
+   info->file_mask[TGSI_FILE_SAMPLER] |= 1 << unit;
+   info->file_max[TGSI_FILE_SAMPLER] =
+      MAX2(info->file_max[TGSI_FILE_SAMPLER], (int)unit);
+   info->samplers_declared |= 1 << unit;
+   if (tex->sampler_dim == GLSL_SAMPLER_DIM_MS)
+      info->is_msaa_sampler[unit] = TRUE;
+   info->num_memory_instructions++;
+}
+
+
+static void
+scan_intrinsic(const nir_intrinsic_instr *intr,
+               struct tgsi_shader_info *info)
+{
+   switch (intr->intrinsic) {
+   case nir_intrinsic_discard:
+   case nir_intrinsic_discard_if:
+      info->uses_kill = TRUE;
+      break;
+   case nir_intrinsic_load_ssbo:
+   case nir_intrinsic_get_buffer_size:
+      info->num_memory_instructions++;
+      break;
+   case nir_intrinsic_store_ssbo:
+   case nir_intrinsic_ssbo_atomic_add:
+   case nir_intrinsic_ssbo_atomic_imin:
+   case nir_intrinsic_ssbo_atomic_umin:
+   case nir_intrinsic_ssbo_atomic_imax:
+   case nir_intrinsic_ssbo_atomic_umax:
+   case nir_intrinsic_ssbo_atomic_and:
+   case nir_intrinsic_ssbo_atomic_or:
+   case nir_intrinsic_ssbo_atomic_xor:
+   case nir_intrinsic_ssbo_atomic_exchange:
+   case nir_intrinsic_ssbo_atomic_comp_swap:
+      info->writes_memory = TRUE;
+      info->num_memory_instructions++;
+      break;
+   case nir_intrinsic_load_instance_id:
+      info->uses_instanceid = TRUE;
+      break;
+   case nir_intrinsic_load_vertex_id:
+      info->uses_vertexid = TRUE;
+      break;
+   case nir_intrinsic_load_vertex_id_zero_base:
+      info->uses_vertexid_nobase = TRUE;
+      break;
+   case nir_intrinsic_load_base_vertex:
+      info->uses_basevertex = TRUE;
+      break;
+   case nir_intrinsic_load_primitive_id:
+      info->uses_primid = TRUE;
+      break;
+   case nir_intrinsic_load_invocation_id:
+      info->uses_invocationid = TRUE;
+      break;
+   case nir_intrinsic_barrier:
+      info->opcode_count[TGSI_OPCODE_BARRIER]++;
+      break;
+   default:
+      break;
+   }
+}
+
+
+static void
+scan_alu(const nir_alu_instr *alu, struct tgsi_shader_info *info)
+{
+   switch (alu->op) {
+   case nir_op_fddx:
+   case nir_op_fddy:
+   case nir_op_fddx_fine:
+   case nir_op_fddy_fine:
+   case nir_op_fddx_coarse:
+   case nir_op_fddy_coarse:
+      info->uses_derivatives = TRUE;
+      break;
+   default:
+      break;
+   }
+
+   if (nir_dest_bit_size(alu->dest.dest) == 64)
+      info->uses_doubles = TRUE;
+}
+
+
+void
+nir_tgsi_scan_shader(const struct nir_shader *nir,
+                     struct tgsi_shader_info *info)
+{
+   unsigned i;
+
+   memset(info, 0, sizeof *info);
+   for (i = 0; i < TGSI_FILE_COUNT; i++)
+      info->file_max[i] = -1;
+   for (i = 0; i < ARRAY_SIZE(info->const_file_max); i++)
+      info->const_file_max[i] = -1;
+
+   info->processor = pipe_shader_type_from_mesa(nir->info.stage);
+
+   scan_inputs(nir, info);
+   scan_outputs(nir, info);
+
+   info->file_max[TGSI_FILE_INPUT] = (int)info->num_inputs - 1;
+   info->file_max[TGSI_FILE_OUTPUT] = (int)info->num_outputs - 1;
+   info->file_count[TGSI_FILE_INPUT] = info->num_inputs;
+   info->file_count[TGSI_FILE_OUTPUT] = info->num_outputs;
+
+   if (nir->info.stage == MESA_SHADER_FRAGMENT) {
+      info->properties[TGSI_PROPERTY_FS_EARLY_DEPTH_STENCIL] =
+         nir->info.fs.early_fragment_tests;
+      info->uses_kill |= nir->info.fs.uses_discard;
+   }
+
+   nir_foreach_function(function, nir) {
+      if (!function->impl)
+         continue;
+
+      nir_foreach_block(block, function->impl) {
+         nir_foreach_instr(instr, block) {
+            info->num_instructions++;
+
+            switch (instr->type) {
+            case nir_instr_type_alu:
+               scan_alu(nir_instr_as_alu(instr), info);
+               break;
+            case nir_instr_type_tex:
+               scan_tex(nir_instr_as_tex(instr), info);
+               break;
+            case nir_instr_type_intrinsic:
+               scan_intrinsic(nir_instr_as_intrinsic(instr), info);
+               break;
+            default:
+               break;
+            }
+         }
+      }
+   }
+
+   info->file_count[TGSI_FILE_SAMPLER] =
+      util_bitcount(info->file_mask[TGSI_FILE_SAMPLER]);
+}
@@ -58,6 +58,8 @@
 #include "tgsi/tgsi_parse.h"
 #include "tgsi/tgsi_util.h"
 #include "tgsi_exec.h"
+#include "tgsi_exec_simd.h"
+#include "util/u_debug.h"
 #include "util/u_half.h"
 #include "util/u_memory.h"
 #include "util/u_math.h"
@@ -1276,6 +1278,29 @@ tgsi_exec_machine_bind_shader(
 }
 
 
+DEBUG_GET_ONCE_NUM_OPTION(exec_simd_channels, "TGSI_EXEC_SIMD_CHANNELS",
+                          TGSI_NUM_CHANNELS)
+
+/**
+ * Pick the ALU kernels doing the most channels per call that the CPU
+ * supports, up to TGSI_EXEC_SIMD_CHANNELS.  Zero disables them.
+ */
+static const struct tgsi_exec_simd *
+get_simd(void)
+{
+   unsigned channels = MIN2(debug_get_option_exec_simd_channels(),
+                            TGSI_NUM_CHANNELS);
+
+   for (channels = util_next_power_of_two(channels + 1) / 2;
+        channels >= 1; channels /= 2) {
+      const struct tgsi_exec_simd *simd = tgsi_exec_get_simd(channels);
+      if (simd)
+         return simd;
+   }
+   return NULL;
+}
+
+
 struct tgsi_exec_machine *
 tgsi_exec_machine_create(enum pipe_shader_type shader_type)
 {
@@ -1291,6 +1316,7 @@ tgsi_exec_machine_create(enum pipe_shader_type shader_type)
    mach->ShaderType = shader_type;
    mach->Addrs = &mach->Temps[TGSI_EXEC_TEMP_ADDR];
    mach->MaxGeometryShaderOutputs = TGSI_MAX_TOTAL_VERTICES;
+   mach->Simd = get_simd();
 
    if (shader_type != PIPE_SHADER_COMPUTE) {
       mach->Inputs = align_malloc(sizeof(struct tgsi_exec_vector) * PIPE_MAX_SHADER_INPUTS, 16);
@@ -3024,6 +3050,150 @@ exec_declaration(struct tgsi_exec_machine *mach,
 typedef void (* micro_unary_op)(union tgsi_exec_channel *dst,
                                 const union tgsi_exec_channel *src);
 
+/**
+ * Return the register a SIMD kernel can read directly, without going
+ * through fetch_source(), or NULL if the source needs swizzling, modifiers
+ * or addressing.
+ */
+static const struct tgsi_exec_vector *
+simd_src_reg(const struct tgsi_exec_machine *mach,
+             const struct tgsi_full_src_register *reg)
+{
+   if (reg->Register.Indirect ||
+       reg->Register.Dimension ||
+       reg->Register.Absolute ||
+       reg->Register.Negate ||
+       reg->Register.SwizzleX != TGSI_SWIZZLE_X ||
+       reg->Register.SwizzleY != TGSI_SWIZZLE_Y ||
+       reg->Register.SwizzleZ != TGSI_SWIZZLE_Z ||
+       reg->Register.SwizzleW != TGSI_SWIZZLE_W)
+      return NULL;
+
+   switch (reg->Register.File) {
+   case TGSI_FILE_TEMPORARY:
+      return &mach->Temps[reg->Register.Index];
+   case TGSI_FILE_INPUT:
+      return mach->Inputs ? &mach->Inputs[reg->Register.Index] : NULL;
+   default:
+      return NULL;
+   }
+}
+
+/**
+ * Return the register a SIMD kernel can write directly, without going
+ * through store_dest(), or NULL.  Only whole temporaries with all the
+ * quad's lanes enabled qualify.
+ */
+static struct tgsi_exec_vector *
+simd_dst_reg(struct tgsi_exec_machine *mach,
+             const struct tgsi_full_instruction *inst)
+{
+   const struct tgsi_full_dst_register *reg = &inst->Dst[0];
+
+   if (reg->Register.File != TGSI_FILE_TEMPORARY ||
+       reg->Register.Indirect ||
+       reg->Register.Dimension ||
+       reg->Register.WriteMask != TGSI_WRITEMASK_XYZW ||
+       inst->Instruction.Saturate ||
+       mach->ExecMask != (1 << TGSI_QUAD_SIZE) - 1)
+      return NULL;
+
+   return &mach->Temps[reg->Register.Index];
+}
+
+/**
+ * Execute a vector instruction with the machine's SIMD kernel for the
+ * opcode, if there is one.  Each kernel call covers Simd->channels
+ * channels of the quad.  Plain temporaries and inputs are operated on in
+ * place, anything else goes through the usual fetch and store.  Kernels
+ * work element by element, so the destination may alias a source.
+ * \return FALSE if the instruction must be run per channel instead
+ */
+static boolean
+exec_vector_simd(struct tgsi_exec_machine *mach,
+                 const struct tgsi_full_instruction *inst,
+                 uint num_src,
+                 enum tgsi_exec_datatype dst_datatype,
+                 enum tgsi_exec_datatype src_datatype)
+{
+   const struct tgsi_exec_simd *simd = mach->Simd;
+   const uint opcode = inst->Instruction.Opcode;
+   const uint writemask = inst->Dst[0].Register.WriteMask;
+   const struct tgsi_exec_vector *src[3];
+   struct tgsi_exec_vector src_tmp[3];
+   struct tgsi_exec_vector *dst;
+   struct tgsi_exec_vector dst_tmp;
+   uint step, chan, i;
+
+   if (!simd)
+      return FALSE;
+
+   switch (num_src) {
+   case 1:
+      if (!simd->unary[opcode])
+         return FALSE;
+      break;
+   case 2:
+      if (!simd->binary[opcode])
+         return FALSE;
+      break;
+   default:
+      if (!simd->trinary[opcode])
+         return FALSE;
+      break;
+   }
+
+   step = simd->channels;
+
+   for (i = 0; i < num_src; i++) {
+      src[i] = simd_src_reg(mach, &inst->Src[i]);
+      if (src[i])
+         continue;
+
+      for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
+         if (writemask & (1 << chan)) {
+            fetch_source(mach, &src_tmp[i].xyzw[chan], &inst->Src[i], chan,
+                         src_datatype);
+         } else if (step > 1) {
+            /* masked channels still go through the kernel, keep them sane */
+            memset(&src_tmp[i].xyzw[chan], 0, sizeof(src_tmp[i].xyzw[chan]));
+         }
+      }
+      src[i] = &src_tmp[i];
+   }
+
+   dst = simd_dst_reg(mach, inst);
+
+   for (chan = 0; chan < TGSI_NUM_CHANNELS; chan += step) {
+      union tgsi_exec_channel *d = dst ? &dst->xyzw[chan] : &dst_tmp.xyzw[chan];
+
+      if (!(writemask & (((1 << step) - 1) << chan)))
+         continue;
+
+      switch (num_src) {
+      case 1:
+         simd->unary[opcode](d, &src[0]->xyzw[chan]);
+         break;
+      case 2:
+         simd->binary[opcode](d, &src[0]->xyzw[chan], &src[1]->xyzw[chan]);
+         break;
+      default:
+         simd->trinary[opcode](d, &src[0]->xyzw[chan], &src[1]->xyzw[chan],
+                               &src[2]->xyzw[chan]);
+         break;
+      }
+   }
+
+   if (!dst) {
+      for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
+         if (writemask & (1 << chan)) {
+            store_dest(mach, &dst_tmp.xyzw[chan], &inst->Dst[0], inst, chan, dst_datatype);
+         }
+      }
+   }
+   return TRUE;
+}
+
 static void
 exec_scalar_unary(struct tgsi_exec_machine *mach,
                   const struct tgsi_full_instruction *inst,
@@ -3054,6 +3224,9 @@ exec_vector_unary(struct tgsi_exec_machine *mach,
    unsigned int chan;
    struct tgsi_exec_vector dst;
 
+   if (exec_vector_simd(mach, inst, 1, dst_datatype, src_datatype))
+      return;
+
    for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
       if (inst->Dst[0].Register.WriteMask & (1 << chan)) {
          union tgsi_exec_channel src;
@@ -3104,6 +3277,9 @@ exec_vector_binary(struct tgsi_exec_machine *mach,
    unsigned int chan;
    struct tgsi_exec_vector dst;
 
+   if (exec_vector_simd(mach, inst, 2, dst_datatype, src_datatype))
+      return;
+
    for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
       if (inst->Dst[0].Register.WriteMask & (1 << chan)) {
          union tgsi_exec_channel src[2];
@@ -3135,6 +3311,9 @@ exec_vector_trinary(struct tgsi_exec_machine *mach,
    unsigned int chan;
    struct tgsi_exec_vector dst;
 
+   if (exec_vector_simd(mach, inst, 3, dst_datatype, src_datatype))
+      return;
+
    for (chan = 0; chan < TGSI_NUM_CHANNELS; chan++) {
       if (inst->Dst[0].Register.WriteMask & (1 << chan)) {
          union tgsi_exec_channel src[3];
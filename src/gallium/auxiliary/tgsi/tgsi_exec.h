@@ -450,6 +450,9 @@ struct tgsi_exec_machine
 
    boolean UsedGeometryShader;
 
+   /** Vectorized ALU kernels, or NULL to run every opcode per channel */
+   const struct tgsi_exec_simd *Simd;
+
    int pc;
 };
 
@@ -0,0 +1,369 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * SSE and AVX versions of the vector ALU opcodes.
+ *
+ * The kernels are compiled with per-function target attributes, so they're
+ * available whatever -m flags the rest of gallium is built with, and are
+ * only handed out when util_cpu_caps says the CPU can run them.
+ *
+ * FMA is deliberately never enabled: MAD and LRP must round twice, the way
+ * the C code does.
+ */
+
+#include "pipe/p_config.h"
+#include "c11/threads.h"
+#include "util/u_cpu_detect.h"
+#include "tgsi_exec.h"
+#include "tgsi_exec_simd.h"
+
+
+#if (defined(PIPE_ARCH_X86) || defined(PIPE_ARCH_X86_64)) && \
+    (defined(__clang__) || \
+     (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+
+#include <immintrin.h>
+
+#define HAVE_SIMD_KERNELS 1
+
+#define TARGET(isa) __attribute__((target(isa)))
+
+
+/*
+ * Kernel generators.  The registers are read and written with unaligned
+ * loads and stores since tgsi_exec_vectors are only 4-byte aligned when
+ * they live on the stack.  "count" vectors of "step" floats are processed.
+ */
+
+#define UNARY(name, isa, vec, step, count, load, store, expr)             \
+static void TARGET(isa)                                                   \
+name(union tgsi_exec_channel *dst,                                        \
+     const union tgsi_exec_channel *src)                                  \
+{                                                                         \
+   float *d = (float *) dst;                                              \
+   const float *s = (const float *) src;                                  \
+   unsigned i;                                                            \
+                                                                          \
+   for (i = 0; i < (count); i++) {                                        \
+      const vec a = load(s + i * (step));                                 \
+      store(d + i * (step), (expr));                                      \
+   }                                                                      \
+}
+
+#define BINARY(name, isa, vec, step, count, load, store, expr)            \
+static void TARGET(isa)                                                   \
+name(union tgsi_exec_channel *dst,                                        \
+     const union tgsi_exec_channel *src0,                                 \
+     const union tgsi_exec_channel *src1)                                 \
+{                                                                         \
+   float *d = (float *) dst;                                              \
+   const float *s0 = (const float *) src0;                                \
+   const float *s1 = (const float *) src1;                                \
+   unsigned i;                                                            \
+                                                                          \
+   for (i = 0; i < (count); i++) {                                        \
+      const vec a = load(s0 + i * (step));                                \
+      const vec b = load(s1 + i * (step));                                \
+      store(d + i * (step), (expr));                                      \
+   }                                                                      \
+}
+
+#define TRINARY(name, isa, vec, step, count, load, store, expr)           \
+static void TARGET(isa)                                                   \
+name(union tgsi_exec_channel *dst,                                        \
+     const union tgsi_exec_channel *src0,                                 \
+     const union tgsi_exec_channel *src1,                                 \
+     const union tgsi_exec_channel *src2)                                 \
+{                                                                         \
+   float *d = (float *) dst;                                              \
+   const float *s0 = (const float *) src0;                                \
+   const float *s1 = (const float *) src1;                                \
+   const float *s2 = (const float *) src2;                                \
+   unsigned i;                                                            \
+                                                                          \
+   for (i = 0; i < (count); i++) {                                        \
+      const vec a = load(s0 + i * (step));                                \
+      const vec b = load(s1 + i * (step));                                \
+      const vec c = load(s2 + i * (step));                                \
+      store(d + i * (step), (expr));                                      \
+   }                                                                      \
+}
+
+
+/*
+ * SSE: one channel per call.
+ */
+
+#define SSE_UNARY(name, isa, expr) \
+   UNARY(sse_##name, isa, __m128, 4, 1, _mm_loadu_ps, _mm_storeu_ps, expr)
+#define SSE_BINARY(name, isa, expr) \
+   BINARY(sse_##name, isa, __m128, 4, 1, _mm_loadu_ps, _mm_storeu_ps, expr)
+#define SSE_TRINARY(name, isa, expr) \
+   TRINARY(sse_##name, isa, __m128, 4, 1, _mm_loadu_ps, _mm_storeu_ps, expr)
+
+#define SSE_INT(op, a, b) \
+   _mm_castsi128_ps(op(_mm_castps_si128(a), _mm_castps_si128(b)))
+
+#define SSE_SET(cmp) \
+   _mm_and_ps((cmp), _mm_set1_ps(1.0f))
+
+SSE_BINARY(add, "sse2", _mm_add_ps(a, b))
+SSE_BINARY(mul, "sse2", _mm_mul_ps(a, b))
+/* minps/maxps return the second operand for NaNs, like a < b ? a : b */
+SSE_BINARY(min, "sse2", _mm_min_ps(a, b))
+SSE_BINARY(max, "sse2", _mm_max_ps(a, b))
+SSE_BINARY(slt, "sse2", SSE_SET(_mm_cmplt_ps(a, b)))
+SSE_BINARY(sle, "sse2", SSE_SET(_mm_cmple_ps(a, b)))
+SSE_BINARY(sgt, "sse2", SSE_SET(_mm_cmpgt_ps(a, b)))
+SSE_BINARY(sge, "sse2", SSE_SET(_mm_cmpge_ps(a, b)))
+SSE_BINARY(seq, "sse2", SSE_SET(_mm_cmpeq_ps(a, b)))
+SSE_BINARY(sne, "sse2", SSE_SET(_mm_cmpneq_ps(a, b)))
+SSE_BINARY(fslt, "sse2", _mm_cmplt_ps(a, b))
+SSE_BINARY(fsge, "sse2", _mm_cmpge_ps(a, b))
+SSE_BINARY(fseq, "sse2", _mm_cmpeq_ps(a, b))
+SSE_BINARY(fsne, "sse2", _mm_cmpneq_ps(a, b))
+SSE_BINARY(and, "sse2", _mm_and_ps(a, b))
+SSE_BINARY(or, "sse2", _mm_or_ps(a, b))
+SSE_BINARY(xor, "sse2", _mm_xor_ps(a, b))
+SSE_BINARY(uadd, "sse2", SSE_INT(_mm_add_epi32, a, b))
+SSE_TRINARY(mad, "sse2", _mm_add_ps(_mm_mul_ps(a, b), c))
+SSE_TRINARY(lrp, "sse2", _mm_add_ps(_mm_mul_ps(a, _mm_sub_ps(b, c)), c))
+
+SSE_UNARY(flr, "sse4.1", _mm_floor_ps(a))
+SSE_UNARY(ceil, "sse4.1", _mm_ceil_ps(a))
+SSE_UNARY(frc, "sse4.1", _mm_sub_ps(a, _mm_floor_ps(a)))
+SSE_UNARY(trunc, "sse4.1",
+          _mm_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+SSE_UNARY(rnd, "sse4.1",
+          _mm_round_ps(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC))
+SSE_BINARY(imax, "sse4.1", SSE_INT(_mm_max_epi32, a, b))
+SSE_BINARY(imin, "sse4.1", SSE_INT(_mm_min_epi32, a, b))
+SSE_BINARY(umax, "sse4.1", SSE_INT(_mm_max_epu32, a, b))
+SSE_BINARY(umin, "sse4.1", SSE_INT(_mm_min_epu32, a, b))
+SSE_BINARY(umul, "sse4.1", SSE_INT(_mm_mullo_epi32, a, b))
+
+
+/*
+ * AVX: two channels, or a whole register, per call.
+ */
+
+#define AVX_UNARY(name, isa, expr)                                        \
+   UNARY(avx_##name##_2, isa, __m256, 8, 1,                               \
+         _mm256_loadu_ps, _mm256_storeu_ps, expr)                         \
+   UNARY(avx_##name##_4, isa, __m256, 8, 2,                               \
+         _mm256_loadu_ps, _mm256_storeu_ps, expr)
+#define AVX_BINARY(name, isa, expr)                                       \
+   BINARY(avx_##name##_2, isa, __m256, 8, 1,                              \
+          _mm256_loadu_ps, _mm256_storeu_ps, expr)                        \
+   BINARY(avx_##name##_4, isa, __m256, 8, 2,                              \
+          _mm256_loadu_ps, _mm256_storeu_ps, expr)
+#define AVX_TRINARY(name, isa, expr)                                      \
+   TRINARY(avx_##name##_2, isa, __m256, 8, 1,                             \
+           _mm256_loadu_ps, _mm256_storeu_ps, expr)                       \
+   TRINARY(avx_##name##_4, isa, __m256, 8, 2,                             \
+           _mm256_loadu_ps, _mm256_storeu_ps, expr)
+
+#define AVX_INT(op, a, b) \
+   _mm256_castsi256_ps(op(_mm256_castps_si256(a), _mm256_castps_si256(b)))
+
+#define AVX_CMP(a, b, pred) \
+   _mm256_cmp_ps(a, b, pred)
+
+#define AVX_SET(cmp) \
+   _mm256_and_ps((cmp), _mm256_set1_ps(1.0f))
+
+AVX_BINARY(add, "avx", _mm256_add_ps(a, b))
+AVX_BINARY(mul, "avx", _mm256_mul_ps(a, b))
+AVX_BINARY(min, "avx", _mm256_min_ps(a, b))
+AVX_BINARY(max, "avx", _mm256_max_ps(a, b))
+AVX_BINARY(slt, "avx", AVX_SET(AVX_CMP(a, b, _CMP_LT_OQ)))
+AVX_BINARY(sle, "avx", AVX_SET(AVX_CMP(a, b, _CMP_LE_OQ)))
+AVX_BINARY(sgt, "avx", AVX_SET(AVX_CMP(a, b, _CMP_GT_OQ)))
+AVX_BINARY(sge, "avx", AVX_SET(AVX_CMP(a, b, _CMP_GE_OQ)))
+AVX_BINARY(seq, "avx", AVX_SET(AVX_CMP(a, b, _CMP_EQ_OQ)))
+/* unordered, so that NaN != NaN like in C */
+AVX_BINARY(sne, "avx", AVX_SET(AVX_CMP(a, b, _CMP_NEQ_UQ)))
+AVX_BINARY(fslt, "avx", AVX_CMP(a, b, _CMP_LT_OQ))
+AVX_BINARY(fsge, "avx", AVX_CMP(a, b, _CMP_GE_OQ))
+AVX_BINARY(fseq, "avx", AVX_CMP(a, b, _CMP_EQ_OQ))
+AVX_BINARY(fsne, "avx", AVX_CMP(a, b, _CMP_NEQ_UQ))
+AVX_BINARY(and, "avx", _mm256_and_ps(a, b))
+AVX_BINARY(or, "avx", _mm256_or_ps(a, b))
+AVX_BINARY(xor, "avx", _mm256_xor_ps(a, b))
+AVX_TRINARY(mad, "avx", _mm256_add_ps(_mm256_mul_ps(a, b), c))
+AVX_TRINARY(lrp, "avx",
+            _mm256_add_ps(_mm256_mul_ps(a, _mm256_sub_ps(b, c)), c))
+AVX_UNARY(flr, "avx", _mm256_floor_ps(a))
+AVX_UNARY(ceil, "avx", _mm256_ceil_ps(a))
+AVX_UNARY(frc, "avx", _mm256_sub_ps(a, _mm256_floor_ps(a)))
+AVX_UNARY(trunc, "avx",
+          _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC))
+AVX_UNARY(rnd, "avx",
+          _mm256_round_ps(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC))
+
+/* 256-bit integer ops need AVX2 */
+AVX_BINARY(uadd, "avx2", AVX_INT(_mm256_add_epi32, a, b))
+AVX_BINARY(imax, "avx2", AVX_INT(_mm256_max_epi32, a, b))
+AVX_BINARY(imin, "avx2", AVX_INT(_mm256_min_epi32, a, b))
+AVX_BINARY(umax, "avx2", AVX_INT(_mm256_max_epu32, a, b))
+AVX_BINARY(umin, "avx2", AVX_INT(_mm256_min_epu32, a, b))
+AVX_BINARY(umul, "avx2", AVX_INT(_mm256_mullo_epi32, a, b))
+
+
+static struct tgsi_exec_simd simd_sse;
+static struct tgsi_exec_simd simd_avx_2;
+static struct tgsi_exec_simd simd_avx_4;
+static once_flag simd_once = ONCE_FLAG_INIT;
+
+#define SET_SSE(kind, opcode, name) \
+   simd_sse.kind[TGSI_OPCODE_##opcode] = sse_##name
+
+#define SET_AVX(kind, opcode, name)                                       \
+   do {                                                                   \
+      simd_avx_2.kind[TGSI_OPCODE_##opcode] = avx_##name##_2;             \
+      simd_avx_4.kind[TGSI_OPCODE_##opcode] = avx_##name##_4;             \
+   } while (0)
+
+static void
+simd_init(void)
+{
+   util_cpu_detect();
+
+   if (util_cpu_caps.has_sse2) {
+      simd_sse.channels = 1;
+      simd_sse.name = util_cpu_caps.has_sse4_1 ? "sse4.1" : "sse2";
+
+      SET_SSE(binary, ADD, add);
+      SET_SSE(binary, MUL, mul);
+      SET_SSE(binary, MIN, min);
+      SET_SSE(binary, MAX, max);
+      SET_SSE(binary, SLT, slt);
+      SET_SSE(binary, SLE, sle);
+      SET_SSE(binary, SGT, sgt);
+      SET_SSE(binary, SGE, sge);
+      SET_SSE(binary, SEQ, seq);
+      SET_SSE(binary, SNE, sne);
+      SET_SSE(binary, FSLT, fslt);
+      SET_SSE(binary, FSGE, fsge);
+      SET_SSE(binary, FSEQ, fseq);
+      SET_SSE(binary, FSNE, fsne);
+      SET_SSE(binary, AND, and);
+      SET_SSE(binary, OR, or);
+      SET_SSE(binary, XOR, xor);
+      SET_SSE(binary, UADD, uadd);
+      SET_SSE(trinary, MAD, mad);
+      SET_SSE(trinary, LRP, lrp);
+
+      if (util_cpu_caps.has_sse4_1) {
+         SET_SSE(unary, FLR, flr);
+         SET_SSE(unary, CEIL, ceil);
+         SET_SSE(unary, FRC, frc);
+         SET_SSE(unary, TRUNC, trunc);
+         SET_SSE(unary, ROUND, rnd);
+         SET_SSE(binary, IMAX, imax);
+         SET_SSE(binary, IMIN, imin);
+         SET_SSE(binary, UMAX, umax);
+         SET_SSE(binary, UMIN, umin);
+         SET_SSE(binary, UMUL, umul);
+      }
+   }
+
+   if (util_cpu_caps.has_avx) {
+      simd_avx_2.channels = 2;
+      simd_avx_4.channels = 4;
+      simd_avx_2.name = simd_avx_4.name =
+         util_cpu_caps.has_avx2 ? "avx2" : "avx";
+
+      SET_AVX(binary, ADD, add);
+      SET_AVX(binary, MUL, mul);
+      SET_AVX(binary, MIN, min);
+      SET_AVX(binary, MAX, max);
+      SET_AVX(binary, SLT, slt);
+      SET_AVX(binary, SLE, sle);
+      SET_AVX(binary, SGT, sgt);
+      SET_AVX(binary, SGE, sge);
+      SET_AVX(binary, SEQ, seq);
+      SET_AVX(binary, SNE, sne);
+      SET_AVX(binary, FSLT, fslt);
+      SET_AVX(binary, FSGE, fsge);
+      SET_AVX(binary, FSEQ, fseq);
+      SET_AVX(binary, FSNE, fsne);
+      SET_AVX(binary, AND, and);
+      SET_AVX(binary, OR, or);
+      SET_AVX(binary, XOR, xor);
+      SET_AVX(trinary, MAD, mad);
+      SET_AVX(trinary, LRP, lrp);
+      SET_AVX(unary, FLR, flr);
+      SET_AVX(unary, CEIL, ceil);
+      SET_AVX(unary, FRC, frc);
+      SET_AVX(unary, TRUNC, trunc);
+      SET_AVX(unary, ROUND, rnd);
+
+      if (util_cpu_caps.has_avx2) {
+         SET_AVX(binary, UADD, uadd);
+         SET_AVX(binary, IMAX, imax);
+         SET_AVX(binary, IMIN, imin);
+         SET_AVX(binary, UMAX, umax);
+         SET_AVX(binary, UMIN, umin);
+         SET_AVX(binary, UMUL, umul);
+      }
+   }
+}
+
+#endif /* HAVE_SIMD_KERNELS */
+
+
+const struct tgsi_exec_simd *
+tgsi_exec_get_simd(unsigned channels)
+{
+#ifdef HAVE_SIMD_KERNELS
+   const struct tgsi_exec_simd *simd;
+
+   call_once(&simd_once, simd_init);
+
+   switch (channels) {
+   case 1:
+      simd = &simd_sse;
+      break;
+   case 2:
+      simd = &simd_avx_2;
+      break;
+   case 4:
+      simd = &simd_avx_4;
+      break;
+   default:
+      return NULL;
+   }
+
+   return simd->channels ? simd : NULL;
+#else
+   (void) channels;
+   return NULL;
+#endif
+}
@@ -0,0 +1,91 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * Vectorized ALU kernels for the TGSI interpreter.
+ *
+ * The machine still runs one quad (TGSI_QUAD_SIZE invocations) at a time.
+ * A kernel computes one, two or all four consecutive channels of a
+ * tgsi_exec_vector per call, for the whole quad.  The kernels give
+ * bit-identical results to the micro_*() functions in tgsi_exec.c (no FMA,
+ * no approximate rcp/rsq).
+ */
+
+#ifndef TGSI_EXEC_SIMD_H
+#define TGSI_EXEC_SIMD_H
+
+#include "pipe/p_compiler.h"
+#include "pipe/p_shader_tokens.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+
+union tgsi_exec_channel;
+
+typedef void (* tgsi_simd_unary_func)(union tgsi_exec_channel *dst,
+                                      const union tgsi_exec_channel *src);
+
+typedef void (* tgsi_simd_binary_func)(union tgsi_exec_channel *dst,
+                                       const union tgsi_exec_channel *src0,
+                                       const union tgsi_exec_channel *src1);
+
+typedef void (* tgsi_simd_trinary_func)(union tgsi_exec_channel *dst,
+                                        const union tgsi_exec_channel *src0,
+                                        const union tgsi_exec_channel *src1,
+                                        const union tgsi_exec_channel *src2);
+
+/**
+ * Kernels covering the same number of channels, indexed by TGSI opcode.
+ * NULL entries are left to the per-channel code in tgsi_exec.c.
+ */
+struct tgsi_exec_simd
+{
+   unsigned channels;
+   const char *name;
+
+   tgsi_simd_unary_func unary[TGSI_OPCODE_LAST];
+   tgsi_simd_binary_func binary[TGSI_OPCODE_LAST];
+   tgsi_simd_trinary_func trinary[TGSI_OPCODE_LAST];
+};
+
+
+/**
+ * Return the kernels doing the given number of channels (1, 2 or 4) per
+ * call on the CPU we're running on, or NULL if the CPU or the compiler
+ * can't do that.
+ */
+const struct tgsi_exec_simd *
+tgsi_exec_get_simd(unsigned channels);
+
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* TGSI_EXEC_SIMD_H */
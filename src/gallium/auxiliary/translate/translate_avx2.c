@@ -0,0 +1,631 @@
+/*
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * on the rights to use, copy, modify, merge, publish, distribute, sub
+ * license, and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.  IN NO EVENT SHALL
+ * VMWARE AND/OR THEIR SUPPLIERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * AVX2 vertex fetch and conversion.
+ *
+ * Vertices are processed eight at a time, one vertex per 32-bit lane: the
+ * input dwords of an element are gathered (or staged through memory when
+ * the element size isn't a multiple of 4), every channel is unpacked and
+ * converted to float in parallel, and the result is transposed back to
+ * one vertex per store.
+ *
+ * This covers the conversions translate_sse can't do -- half floats and
+ * packed 10_10_10_2 -- and all the normalized/scaled 8, 16 and 32-bit
+ * integer formats, to R32[G32[B32[A32]]]_FLOAT outputs.  Elements with the
+ * same input and output format are copied.  Keys made only of copies are
+ * left to translate_sse, and anything else to translate_generic.
+ *
+ * Conversions round exactly like the u_format code used by
+ * translate_generic (no FMA, one multiply by the normalization factor).
+ */
+
+
+#include "pipe/p_config.h"
+#include "pipe/p_compiler.h"
+#include "util/u_cpu_detect.h"
+#include "util/u_memory.h"
+#include "util/u_math.h"
+#include "util/u_format.h"
+
+#include "translate.h"
+
+
+#if (defined(PIPE_ARCH_X86) || defined(PIPE_ARCH_X86_64)) && \
+    (defined(__clang__) || \
+     (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+
+#include <immintrin.h>
+
+#define TARGET __attribute__((target("avx2,f16c")))
+
+#define NR_LANES 8
+
+
+struct translate_avx2_channel {
+   enum util_format_type type;
+   boolean normalized;
+   unsigned size;
+   unsigned dword;
+   unsigned shift;
+   float scale;
+};
+
+struct translate_avx2_element {
+   enum translate_element_type type;
+   unsigned buffer;
+   unsigned input_offset;
+   unsigned instance_divisor;
+   unsigned output_offset;
+
+   const uint8_t *input_ptr;
+   unsigned input_stride;
+   unsigned max_index;
+
+   /** Bytes to copy when input and output formats match, or 0 */
+   unsigned copy_size;
+
+   unsigned input_size;
+   unsigned nr_dwords;
+   /** Whether the current buffer can be read with 32-bit gathers */
+   boolean gather;
+
+   unsigned nr_channels;
+   struct translate_avx2_channel channel[4];
+
+   /** Output channels, taken from the input channel or PIPE_SWIZZLE_0/1 */
+   unsigned nr_outputs;
+   unsigned swizzle[4];
+};
+
+struct translate_avx2 {
+   struct translate translate;
+
+   struct translate_avx2_element element[TRANSLATE_MAX_ATTRIBS];
+   unsigned nr_elements;
+};
+
+
+static struct translate_avx2 *
+translate_avx2(struct translate *translate)
+{
+   return (struct translate_avx2 *)translate;
+}
+
+
+/**
+ * Unpack one channel of eight vertices from their input dwords and
+ * convert it to float.
+ */
+static inline __m256 TARGET
+convert_channel(const __m256i rows[4],
+                const struct translate_avx2_channel *c)
+{
+   __m256i v = rows[c->dword];
+   __m256 f;
+
+   if (c->size < 32) {
+      if (c->type == UTIL_FORMAT_TYPE_SIGNED) {
+         /* sign extend */
+         v = _mm256_sll_epi32(v, _mm_cvtsi32_si128(32 - c->shift - c->size));
+         v = _mm256_sra_epi32(v, _mm_cvtsi32_si128(32 - c->size));
+      } else {
+         v = _mm256_srl_epi32(v, _mm_cvtsi32_si128(c->shift));
+         v = _mm256_and_si256(v, _mm256_set1_epi32((1 << c->size) - 1));
+      }
+   }
+
+   switch (c->type) {
+   case UTIL_FORMAT_TYPE_FLOAT:
+      if (c->size == 16) {
+         /* pack the halves to the low 128 bits */
+         __m256i h = _mm256_packus_epi32(v, v);
+         h = _mm256_permute4x64_epi64(h, _MM_SHUFFLE(0, 0, 2, 0));
+         return _mm256_cvtph_ps(_mm256_castsi256_si128(h));
+      }
+      return _mm256_castsi256_ps(v);
+
+   case UTIL_FORMAT_TYPE_UNSIGNED:
+      if (c->size == 32) {
+         /* There's no unsigned conversion.  Both halves convert exactly,
+          * so the sum is rounded only once, like (float)x.
+          */
+         __m256 hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(v, 16));
+         __m256 lo = _mm256_cvtepi32_ps(
+            _mm256_and_si256(v, _mm256_set1_epi32(0xffff)));
+         f = _mm256_add_ps(_mm256_mul_ps(hi, _mm256_set1_ps(65536.0f)), lo);
+      } else {
+         f = _mm256_cvtepi32_ps(v);
+      }
+      break;
+
+   default:
+      f = _mm256_cvtepi32_ps(v);
+      break;
+   }
+
+   if (c->normalized)
+      f = _mm256_mul_ps(f, _mm256_set1_ps(c->scale));
+
+   return f;
+}
+
+
+static inline void TARGET
+store_vertex(uint8_t *dst, __m128 v, unsigned nr_outputs)
+{
+   switch (nr_outputs) {
+   case 4:
+      _mm_storeu_ps((float *)dst, v);
+      break;
+   case 3:
+      _mm_storel_pi((__m64 *)dst, v);
+      _mm_store_ss((float *)(dst + 8), _mm_movehl_ps(v, v));
+      break;
+   case 2:
+      _mm_storel_pi((__m64 *)dst, v);
+      break;
+   default:
+      _mm_store_ss((float *)dst, v);
+      break;
+   }
+}
+
+
+/**
+ * Read an element whose size isn't a multiple of 4, so gathers could read
+ * past the end of the buffer.
+ */
+static inline void
+load_staged(uint32_t data[4], const uint8_t *src, unsigned size)
+{
+   /* constant sizes, so that the copies get inlined */
+   switch (size) {
+   case 1:
+      memcpy(data, src, 1);
+      break;
+   case 2:
+      memcpy(data, src, 2);
+      break;
+   case 3:
+      memcpy(data, src, 3);
+      break;
+   case 6:
+      memcpy(data, src, 6);
+      break;
+   default:
+      memcpy(data, src, size);
+      break;
+   }
+}
+
+
+/**
+ * Translate up to NR_LANES vertices.  Lanes past count use the index of
+ * the first vertex, so they read valid memory, but aren't stored.
+ */
+static void TARGET
+avx2_run_batch(struct translate_avx2 *p,
+               const unsigned *elts,
+               unsigned count,
+               unsigned start_instance,
+               unsigned instance_id,
+               uint8_t *vert)
+{
+   const unsigned stride = p->translate.key.output_stride;
+   unsigned attr, i, k;
+   __m256i elts_v;
+
+   if (count == NR_LANES) {
+      elts_v = _mm256_loadu_si256((const __m256i *)elts);
+   } else {
+      unsigned padded[NR_LANES];
+
+      for (i = 0; i < NR_LANES; i++)
+         padded[i] = elts[i < count ? i : 0];
+      elts_v = _mm256_loadu_si256((const __m256i *)padded);
+   }
+
+   for (attr = 0; attr < p->nr_elements; attr++) {
+      const struct translate_avx2_element *e = &p->element[attr];
+      uint8_t *dst = vert + e->output_offset;
+      unsigned index[NR_LANES];
+      __m256i index_v;
+      __m256i rows[4];
+      __m256 out[4];
+
+      if (e->type == TRANSLATE_ELEMENT_INSTANCE_ID) {
+         for (i = 0; i < count; i++) {
+            if (e->copy_size)
+               memcpy(dst + i * stride, &instance_id, 4);
+            else
+               *(float *)(dst + i * stride) = (float)instance_id;
+         }
+         continue;
+      }
+
+      if (e->instance_divisor) {
+         index_v = _mm256_set1_epi32(start_instance +
+                                     instance_id / e->instance_divisor);
+      } else {
+         /* clamp to avoid going out of bounds */
+         index_v = _mm256_min_epu32(elts_v, _mm256_set1_epi32(e->max_index));
+      }
+
+      if (e->copy_size) {
+         _mm256_storeu_si256((__m256i *)index, index_v);
+         for (i = 0; i < count; i++) {
+            memcpy(dst + i * stride,
+                   e->input_ptr + (ptrdiff_t)e->input_stride * index[i],
+                   e->copy_size);
+         }
+         continue;
+      }
+
+      if (e->gather) {
+         const __m256i offsets =
+            _mm256_mullo_epi32(index_v, _mm256_set1_epi32(e->input_stride));
+
+         for (k = 0; k < e->nr_dwords; k++) {
+            rows[k] = _mm256_i32gather_epi32(
+               (const int *)(e->input_ptr + 4 * k), offsets, 1);
+         }
+      } else {
+         uint32_t staged[4][NR_LANES];
+
+         _mm256_storeu_si256((__m256i *)index, index_v);
+         for (i = 0; i < NR_LANES; i++) {
+            uint32_t data[4] = { 0, 0, 0, 0 };
+
+            load_staged(data,
+                        e->input_ptr + (ptrdiff_t)e->input_stride * index[i],
+                        e->input_size);
+            for (k = 0; k < e->nr_dwords; k++)
+               staged[k][i] = data[k];
+         }
+         for (k = 0; k < e->nr_dwords; k++)
+            rows[k] = _mm256_loadu_si256((const __m256i *)staged[k]);
+      }
+
+      for (k = 0; k < 4; k++) {
+         const unsigned swz = e->swizzle[k];
+
+         if (k >= e->nr_outputs || swz == PIPE_SWIZZLE_0)
+            out[k] = _mm256_setzero_ps();
+         else if (swz == PIPE_SWIZZLE_1)
+            out[k] = _mm256_set1_ps(1.0f);
+         else
+            out[k] = convert_channel(rows, &e->channel[swz]);
+      }
+
+      /* back to one vertex per register */
+      {
+         __m128 lo0 = _mm256_castps256_ps128(out[0]);
+         __m128 lo1 = _mm256_castps256_ps128(out[1]);
+         __m128 lo2 = _mm256_castps256_ps128(out[2]);
+         __m128 lo3 = _mm256_castps256_ps128(out[3]);
+         __m128 hi0 = _mm256_extractf128_ps(out[0], 1);
+         __m128 hi1 = _mm256_extractf128_ps(out[1], 1);
+         __m128 hi2 = _mm256_extractf128_ps(out[2], 1);
+         __m128 hi3 = _mm256_extractf128_ps(out[3], 1);
+         __m128 v[NR_LANES];
+
+         _MM_TRANSPOSE4_PS(lo0, lo1, lo2, lo3);
+         _MM_TRANSPOSE4_PS(hi0, hi1, hi2, hi3);
+         v[0] = lo0; v[1] = lo1; v[2] = lo2; v[3] = lo3;
+         v[4] = hi0; v[5] = hi1; v[6] = hi2; v[7] = hi3;
+
+         if (e->nr_outputs == 4 && count == NR_LANES) {
+            for (i = 0; i < NR_LANES; i++)
+               _mm_storeu_ps((float *)(dst + i * stride), v[i]);
+         } else {
+            for (i = 0; i < count; i++)
+               store_vertex(dst + i * stride, v[i], e->nr_outputs);
+         }
+      }
+   }
+}
+
+
+static void PIPE_CDECL
+avx2_run_elts(struct translate *translate,
+              const unsigned *elts,
+              unsigned count,
+              unsigned start_instance,
+              unsigned instance_id,
+              void *output_buffer)
+{
+   struct translate_avx2 *p = translate_avx2(translate);
+   uint8_t *vert = output_buffer;
+   unsigned i;
+
+   for (i = 0; i < count; i += NR_LANES) {
+      avx2_run_batch(p, elts + i, MIN2(count - i, NR_LANES),
+                     start_instance, instance_id, vert);
+      vert += NR_LANES * translate->key.output_stride;
+   }
+}
+
+#define RUN_ELTS(NAME, TYPE)                                             \
+static void PIPE_CDECL                                                   \
+NAME(struct translate *translate,                                        \
+     const TYPE *elts,                                                   \
+     unsigned count,                                                     \
+     unsigned start_instance,                                            \
+     unsigned instance_id,                                               \
+     void *output_buffer)                                                \
+{                                                                        \
+   struct translate_avx2 *p = translate_avx2(translate);                 \
+   uint8_t *vert = output_buffer;                                        \
+   unsigned index[NR_LANES];                                             \
+   unsigned i, j, n;                                                     \
+                                                                         \
+   for (i = 0; i < count; i += NR_LANES) {                               \
+      n = MIN2(count - i, NR_LANES);                                     \
+      for (j = 0; j < n; j++)                                            \
+         index[j] = elts[i + j];                                         \
+      avx2_run_batch(p, index, n, start_instance, instance_id, vert);    \
+      vert += NR_LANES * translate->key.output_stride;                   \
+   }                                                                     \
+}
+
+RUN_ELTS(avx2_run_elts16, uint16_t)
+RUN_ELTS(avx2_run_elts8, uint8_t)
+
+static void PIPE_CDECL
+avx2_run(struct translate *translate,
+         unsigned start,
+         unsigned count,
+         unsigned start_instance,
+         unsigned instance_id,
+         void *output_buffer)
+{
+   struct translate_avx2 *p = translate_avx2(translate);
+   uint8_t *vert = output_buffer;
+   unsigned index[NR_LANES];
+   unsigned i, j, n;
+
+   for (i = 0; i < count; i += NR_LANES) {
+      n = MIN2(count - i, NR_LANES);
+      for (j = 0; j < n; j++)
+         index[j] = start + i + j;
+      avx2_run_batch(p, index, n, start_instance, instance_id, vert);
+      vert += NR_LANES * translate->key.output_stride;
+   }
+}
+
+
+static void
+avx2_set_buffer(struct translate *translate,
+                unsigned buf,
+                const void *ptr,
+                unsigned stride,
+                unsigned max_index)
+{
+   struct translate_avx2 *p = translate_avx2(translate);
+   unsigned i;
+
+   for (i = 0; i < p->nr_elements; i++) {
+      struct translate_avx2_element *e = &p->element[i];
+
+      if (e->type == TRANSLATE_ELEMENT_NORMAL && e->buffer == buf) {
+         e->input_ptr = (const uint8_t *)ptr + e->input_offset;
+         e->input_stride = stride;
+         e->max_index = max_index;
+
+         /* Gathers take 32-bit signed offsets, and read whole dwords.
+          * Instanced elements are staged, their index isn't clamped.
+          */
+         e->gather = !e->instance_divisor &&
+                     e->input_size == e->nr_dwords * 4 &&
+                     (uint64_t)stride * max_index + e->input_size <=
+                     INT32_MAX;
+      }
+   }
+}
+
+
+static void
+avx2_release(struct translate *translate)
+{
+   FREE(translate);
+}
+
+
+static boolean
+is_float32_output(const struct util_format_description *desc)
+{
+   unsigned i;
+
+   if (desc->layout != UTIL_FORMAT_LAYOUT_PLAIN ||
+       desc->colorspace != UTIL_FORMAT_COLORSPACE_RGB)
+      return FALSE;
+
+   for (i = 0; i < desc->nr_channels; i++) {
+      if (desc->channel[i].type != UTIL_FORMAT_TYPE_FLOAT ||
+          desc->channel[i].size != 32 ||
+          desc->channel[i].shift != i * 32 ||
+          desc->swizzle[i] != i)
+         return FALSE;
+   }
+   return TRUE;
+}
+
+
+/**
+ * Describe how to unpack an input format, returning FALSE if that needs
+ * something the batch code doesn't do.
+ */
+static boolean
+setup_input(struct translate_avx2_element *e,
+            const struct util_format_description *desc)
+{
+   unsigned i;
+
+   if (desc->layout != UTIL_FORMAT_LAYOUT_PLAIN ||
+       desc->colorspace != UTIL_FORMAT_COLORSPACE_RGB ||
+       desc->block.width != 1 || desc->block.height != 1 ||
+       desc->block.bits > 128 || (desc->block.bits & 7))
+      return FALSE;
+
+   e->input_size = desc->block.bits / 8;
+   e->nr_dwords = DIV_ROUND_UP(e->input_size, 4);
+   e->nr_channels = desc->nr_channels;
+
+   for (i = 0; i < desc->nr_channels; i++) {
+      const struct util_format_channel_description *chan = &desc->channel[i];
+      struct translate_avx2_channel *c = &e->channel[i];
+
+      c->type = chan->type;
+      c->normalized = chan->normalized;
+      c->size = chan->size;
+      c->dword = chan->shift / 32;
+      c->shift = chan->shift % 32;
+
+      if (c->shift + c->size > 32 || chan->pure_integer)
+         return FALSE;
+
+      switch (chan->type) {
+      case UTIL_FORMAT_TYPE_VOID:
+         break;
+      case UTIL_FORMAT_TYPE_FLOAT:
+         if (chan->size != 16 && chan->size != 32)
+            return FALSE;
+         break;
+      case UTIL_FORMAT_TYPE_UNSIGNED:
+      case UTIL_FORMAT_TYPE_SIGNED:
+         /* u_format converts 32-bit normalized values in double */
+         if (chan->normalized && chan->size == 32)
+            return FALSE;
+         if (chan->normalized) {
+            const unsigned bits = chan->type == UTIL_FORMAT_TYPE_SIGNED ?
+                                  chan->size - 1 : chan->size;
+            c->scale = 1.0f / (float)((1 << bits) - 1);
+         }
+         break;
+      default:
+         return FALSE;
+      }
+   }
+
+   for (i = 0; i < 4; i++) {
+      e->swizzle[i] = desc->swizzle[i];
+      if (e->swizzle[i] < 4 &&
+          desc->channel[e->swizzle[i]].type == UTIL_FORMAT_TYPE_VOID)
+         return FALSE;
+   }
+   return TRUE;
+}
+
+
+struct translate *
+translate_avx2_create(const struct translate_key *key)
+{
+   struct translate_avx2 *p;
+   boolean convert = FALSE;
+   unsigned i;
+
+   util_cpu_detect();
+   if (!util_cpu_caps.has_avx2 || !util_cpu_caps.has_f16c)
+      return NULL;
+
+   p = CALLOC_STRUCT(translate_avx2);
+   if (!p)
+      return NULL;
+
+   assert(key->nr_elements <= TRANSLATE_MAX_ATTRIBS);
+
+   p->translate.key = *key;
+   p->translate.release = avx2_release;
+   p->translate.set_buffer = avx2_set_buffer;
+   p->translate.run_elts = avx2_run_elts;
+   p->translate.run_elts16 = avx2_run_elts16;
+   p->translate.run_elts8 = avx2_run_elts8;
+   p->translate.run = avx2_run;
+
+   for (i = 0; i < key->nr_elements; i++) {
+      const struct translate_element *elem = &key->element[i];
+      struct translate_avx2_element *e = &p->element[i];
+      const struct util_format_description *input_desc;
+      const struct util_format_description *output_desc =
+         util_format_description(elem->output_format);
+
+      e->type = elem->type;
+      e->buffer = elem->input_buffer;
+      e->input_offset = elem->input_offset;
+      e->instance_divisor = elem->instance_divisor;
+      e->output_offset = elem->output_offset;
+
+      if (elem->type == TRANSLATE_ELEMENT_INSTANCE_ID) {
+         if (elem->output_format == PIPE_FORMAT_R32_USCALED ||
+             elem->output_format == PIPE_FORMAT_R32_SSCALED)
+            e->copy_size = 4;
+         else if (elem->output_format != PIPE_FORMAT_R32_FLOAT)
+            goto fail;
+         continue;
+      }
+
+      if (elem->input_format == elem->output_format) {
+         const struct util_format_description *desc = output_desc;
+
+         if (!desc || desc->block.width != 1 || desc->block.height != 1 ||
+             (desc->block.bits & 7))
+            goto fail;
+         e->copy_size = desc->block.bits / 8;
+         continue;
+      }
+
+      input_desc = util_format_description(elem->input_format);
+      if (!input_desc || !output_desc || !is_float32_output(output_desc) ||
+          !setup_input(e, input_desc))
+         goto fail;
+
+      e->nr_outputs = output_desc->nr_channels;
+      convert = TRUE;
+   }
+
+   p->nr_elements = key->nr_elements;
+
+   /* translate_sse's generated code is as good at plain copies */
+   if (!convert)
+      goto fail;
+
+   return &p->translate;
+
+ fail:
+   FREE(p);
+   return NULL;
+}
+
+
+#else
+
+struct translate *
+translate_avx2_create(const struct translate_key *key)
+{
+   return NULL;
+}
+
+#endif
@@ -61,6 +61,8 @@
 #include <signal.h>
 #include <fcntl.h>
 #include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
 #endif
 
 #ifdef PIPE_OS_UNIX
@@ -355,6 +357,63 @@ check_os_arm_support(void)
 }
 #endif /* PIPE_ARCH_ARM */
 
+#if defined(PIPE_OS_LINUX)
+/**
+ * Read the CPU to NUMA node mapping from sysfs.  Node numbers are
+ * compacted, so that nodes without any CPU (memory only) are skipped.
+ */
+static void
+get_numa_topology(void)
+{
+   unsigned node, nr_nodes = 0;
+
+   for (node = 0; node < 256; node++) {
+      char path[64], buf[1024];
+      boolean has_cpus = FALSE;
+      FILE *f;
+
+      snprintf(path, sizeof path,
+               "/sys/devices/system/node/node%u/cpulist", node);
+      f = fopen(path, "r");
+      if (!f)
+         continue;
+
+      /* The list looks like "0-15,32-47" */
+      if (fgets(buf, sizeof buf, f)) {
+         char *p = buf;
+
+         for (;;) {
+            unsigned long first, last, cpu;
+            char *end;
+
+            first = strtoul(p, &end, 10);
+            if (end == p)
+               break;
+            last = first;
+            if (*end == '-')
+               last = strtoul(end + 1, &end, 10);
+
+            for (cpu = first; cpu <= last && cpu < UTIL_MAX_CPUS; cpu++) {
+               util_cpu_caps.cpu_to_numa_node[cpu] = nr_nodes;
+               has_cpus = TRUE;
+            }
+
+            if (*end != ',')
+               break;
+            p = end + 1;
+         }
+      }
+
+      fclose(f);
+
+      if (has_cpus)
+         nr_nodes++;
+   }
+
+   util_cpu_caps.nr_numa_nodes = nr_nodes ? nr_nodes : 1;
+}
+#endif /* PIPE_OS_LINUX */
+
 void
 util_cpu_detect(void)
 {
@@ -392,6 +451,11 @@ util_cpu_detect(void)
    util_cpu_caps.nr_cpus = 1;
 #endif
 
+   util_cpu_caps.nr_numa_nodes = 1;
+#if defined(PIPE_OS_LINUX)
+   get_numa_topology();
+#endif
+
    /* Make the fallback cacheline size nonzero so that it can be
     * safely passed to align().
     */
@@ -515,6 +579,7 @@ util_cpu_detect(void)
 #ifdef DEBUG
    if (debug_get_option_dump_cpu()) {
       debug_printf("util_cpu_caps.nr_cpus = %u\n", util_cpu_caps.nr_cpus);
+      debug_printf("util_cpu_caps.nr_numa_nodes = %u\n", util_cpu_caps.nr_numa_nodes);
 
       debug_printf("util_cpu_caps.x86_cpu_type = %u\n", util_cpu_caps.x86_cpu_type);
       debug_printf("util_cpu_caps.cacheline = %u\n", util_cpu_caps.cacheline);
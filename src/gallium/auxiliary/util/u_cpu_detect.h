@@ -45,9 +45,18 @@ extern "C" {
 #endif
 
 
+/** Max number of CPUs the NUMA topology is tracked for */
+#define UTIL_MAX_CPUS 1024
+
 struct util_cpu_caps {
    unsigned nr_cpus;
 
+   /* NUMA topology.  Only detected on Linux; elsewhere all CPUs are
+    * reported on a single node.
+    */
+   unsigned nr_numa_nodes;
+   uint8_t cpu_to_numa_node[UTIL_MAX_CPUS];
+
    /* Feature flags */
    int x86_cpu_type;
    unsigned cacheline;
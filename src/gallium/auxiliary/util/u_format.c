@@ -564,9 +564,22 @@ util_format_fits_8unorm(const struct util_format_description *format_desc)
       return FALSE;
 
    case UTIL_FORMAT_LAYOUT_ETC:
-      if (format_desc->format == PIPE_FORMAT_ETC1_RGB8)
+      switch (format_desc->format) {
+      case PIPE_FORMAT_ETC1_RGB8:
+      case PIPE_FORMAT_ETC2_RGB8:
+      case PIPE_FORMAT_ETC2_RGB8A1:
+      case PIPE_FORMAT_ETC2_RGBA8:
          return TRUE;
-      return FALSE;
+      default:
+         /* the 11 bit EAC formats */
+         return FALSE;
+      }
+
+   case UTIL_FORMAT_LAYOUT_ASTC:
+      /*
+       * Only the LDR profile is supported, which is decoded to 8 bits.
+       */
+      return TRUE;
 
    case UTIL_FORMAT_LAYOUT_PLAIN:
       /*
@@ -929,6 +929,12 @@ util_format_srgb(enum pipe_format format)
       return PIPE_FORMAT_DXT5_SRGBA;
    case PIPE_FORMAT_B5G6R5_UNORM:
       return PIPE_FORMAT_B5G6R5_SRGB;
+   case PIPE_FORMAT_ETC2_RGB8:
+      return PIPE_FORMAT_ETC2_SRGB8;
+   case PIPE_FORMAT_ETC2_RGB8A1:
+      return PIPE_FORMAT_ETC2_SRGB8A1;
+   case PIPE_FORMAT_ETC2_RGBA8:
+      return PIPE_FORMAT_ETC2_SRGBA8;
    case PIPE_FORMAT_BPTC_RGBA_UNORM:
       return PIPE_FORMAT_BPTC_SRGBA;
    case PIPE_FORMAT_ASTC_4x4:
@@ -1005,6 +1011,12 @@ util_format_linear(enum pipe_format format)
       return PIPE_FORMAT_DXT5_RGBA;
    case PIPE_FORMAT_B5G6R5_SRGB:
       return PIPE_FORMAT_B5G6R5_UNORM;
+   case PIPE_FORMAT_ETC2_SRGB8:
+      return PIPE_FORMAT_ETC2_RGB8;
+   case PIPE_FORMAT_ETC2_SRGB8A1:
+      return PIPE_FORMAT_ETC2_RGB8A1;
+   case PIPE_FORMAT_ETC2_SRGBA8:
+      return PIPE_FORMAT_ETC2_RGBA8;
    case PIPE_FORMAT_BPTC_SRGBA:
       return PIPE_FORMAT_BPTC_RGBA_UNORM;
    case PIPE_FORMAT_ASTC_4x4_SRGB:
@@ -0,0 +1,1140 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * @file
+ * ASTC LDR block decoder.
+ *
+ * Follows the decoding procedure of the Khronos ASTC specification (the
+ * KHR_texture_compression_astc_ldr extension).  Only the LDR profile is
+ * implemented: blocks using HDR endpoint modes or HDR void-extent blocks
+ * decode to the error color, as do malformed blocks.  Texels are decoded
+ * to 16 bits per channel as the specification prescribes and then reduced
+ * to 8 bits (or converted to float) by the unpack/fetch entry points.
+ *
+ * There is no encoder; the pack functions are never expected to be called
+ * since the state trackers only upload pre-compressed ASTC data.
+ */
+
+
+#include "u_debug.h"
+#include "u_math.h"
+#include "u_format_astc.h"
+#include "util/format_srgb.h"
+
+
+#define ASTC_MAX_BLOCK_TEXELS  (12 * 12)
+#define ASTC_MAX_WEIGHTS       64
+#define ASTC_MAX_PARTITIONS    4
+#define ASTC_MAX_COLOR_VALUES  18
+
+
+/**
+ * Integer sequence encoding of a value range: a number of bits per value
+ * plus an optional trit or quint.
+ */
+struct astc_ise_range
+{
+   uint8_t trits;
+   uint8_t quints;
+   uint8_t bits;
+};
+
+/**
+ * All the ranges defined by the specification, in increasing order:
+ * 2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 40, 48, 64, 80, 96, 128, 160,
+ * 192 and 256 levels.
+ */
+static const struct astc_ise_range
+astc_ranges[] = {
+   { 0, 0, 1 }, { 1, 0, 0 }, { 0, 0, 2 }, { 0, 1, 0 }, { 1, 0, 1 },
+   { 0, 0, 3 }, { 0, 1, 1 }, { 1, 0, 2 }, { 0, 0, 4 }, { 0, 1, 2 },
+   { 1, 0, 3 }, { 0, 0, 5 }, { 0, 1, 3 }, { 1, 0, 4 }, { 0, 0, 6 },
+   { 0, 1, 4 }, { 1, 0, 5 }, { 0, 0, 7 }, { 0, 1, 5 }, { 1, 0, 6 },
+   { 0, 0, 8 },
+};
+
+/** Index of the 0..5 range, the smallest one allowed for color endpoints. */
+#define ASTC_MIN_COLOR_RANGE 4
+
+
+/**
+ * Decoded block parameters.
+ */
+struct astc_block
+{
+   unsigned weight_width;
+   unsigned weight_height;
+   unsigned weight_range;
+   boolean dual_plane;
+   unsigned plane2_component;
+
+   unsigned num_partitions;
+   unsigned partition_seed;
+   unsigned cem[ASTC_MAX_PARTITIONS];
+
+   /* endpoints, 8 bits per channel, per partition */
+   uint8_t endpoints[ASTC_MAX_PARTITIONS][2][4];
+
+   /* unquantized weights (0..64), interleaved when dual plane */
+   uint8_t weights[ASTC_MAX_WEIGHTS];
+};
+
+
+/**
+ * Read count bits (at most 32) starting at bit start from a 128 bit block,
+ * treating every bit at or above end as zero.
+ */
+static inline unsigned
+astc_read_bits(const uint64_t q[2], unsigned start, unsigned count,
+               unsigned end)
+{
+   uint64_t v;
+
+   if (start >= end || count == 0)
+      return 0;
+   if (start + count > end)
+      count = end - start;
+
+   if (start >= 64)
+      v = q[1] >> (start - 64);
+   else if (start == 0)
+      v = q[0];
+   else
+      v = (q[0] >> start) | (q[1] << (64 - start));
+
+   return (unsigned)(v & ((UINT64_C(1) << count) - 1));
+}
+
+
+static inline uint64_t
+astc_reverse64(uint64_t v)
+{
+   v = ((v >> 1) & UINT64_C(0x5555555555555555)) | ((v & UINT64_C(0x5555555555555555)) << 1);
+   v = ((v >> 2) & UINT64_C(0x3333333333333333)) | ((v & UINT64_C(0x3333333333333333)) << 2);
+   v = ((v >> 4) & UINT64_C(0x0f0f0f0f0f0f0f0f)) | ((v & UINT64_C(0x0f0f0f0f0f0f0f0f)) << 4);
+   v = ((v >> 8) & UINT64_C(0x00ff00ff00ff00ff)) | ((v & UINT64_C(0x00ff00ff00ff00ff)) << 8);
+   v = ((v >> 16) & UINT64_C(0x0000ffff0000ffff)) | ((v & UINT64_C(0x0000ffff0000ffff)) << 16);
+   return (v >> 32) | (v << 32);
+}
+
+
+/**
+ * Number of bits taken by count values encoded with the given range.
+ */
+static unsigned
+astc_ise_bits(unsigned range, unsigned count)
+{
+   const struct astc_ise_range *r = &astc_ranges[range];
+   unsigned bits = count * r->bits;
+
+   if (r->trits)
+      bits += (8 * count + 4) / 5;
+   if (r->quints)
+      bits += (7 * count + 2) / 3;
+
+   return bits;
+}
+
+
+static void
+astc_decode_trits(unsigned t, unsigned out[5])
+{
+   unsigned c;
+
+   if (((t >> 2) & 0x7) == 0x7) {
+      c = ((t >> 5) << 2) | (t & 0x3);
+      out[4] = 2;
+      out[3] = 2;
+   }
+   else {
+      c = t & 0x1f;
+      if (((t >> 5) & 0x3) == 0x3) {
+         out[4] = 2;
+         out[3] = (t >> 7) & 0x1;
+      }
+      else {
+         out[4] = (t >> 7) & 0x1;
+         out[3] = (t >> 5) & 0x3;
+      }
+   }
+
+   if ((c & 0x3) == 0x3) {
+      out[2] = 2;
+      out[1] = (c >> 4) & 0x1;
+      out[0] = (((c >> 3) & 0x1) << 1) | (((c >> 2) & 0x1) & ~((c >> 3) & 0x1));
+   }
+   else if (((c >> 2) & 0x3) == 0x3) {
+      out[2] = 2;
+      out[1] = 2;
+      out[0] = c & 0x3;
+   }
+   else {
+      out[2] = (c >> 4) & 0x1;
+      out[1] = (c >> 2) & 0x3;
+      out[0] = (((c >> 1) & 0x1) << 1) | ((c & 0x1) & ~((c >> 1) & 0x1));
+   }
+}
+
+
+static void
+astc_decode_quints(unsigned q, unsigned out[3])
+{
+   unsigned c;
+
+   if (((q >> 1) & 0x3) == 0x3 && ((q >> 5) & 0x3) == 0) {
+      unsigned q0 = q & 0x1;
+      out[2] = (q0 << 2) |
+               ((((q >> 4) & 0x1) & ~q0) << 1) |
+               (((q >> 3) & 0x1) & ~q0);
+      out[1] = 4;
+      out[0] = 4;
+      return;
+   }
+
+   if (((q >> 1) & 0x3) == 0x3) {
+      out[2] = 4;
+      c = (((q >> 3) & 0x3) << 3) | ((~(q >> 5) & 0x3) << 1) | (q & 0x1);
+   }
+   else {
+      out[2] = (q >> 5) & 0x3;
+      c = q & 0x1f;
+   }
+
+   if ((c & 0x7) == 0x5) {
+      out[1] = 4;
+      out[0] = (c >> 3) & 0x3;
+   }
+   else {
+      out[1] = (c >> 3) & 0x3;
+      out[0] = c & 0x7;
+   }
+}
+
+
+/**
+ * Decode count integers of the given range from the bits [start, end) of
+ * the block.  Each output holds the trit/quint in the upper part and the
+ * plain bits in the lower ones, i.e. its quantized value.
+ */
+static void
+astc_decode_ise(const uint64_t q[2], unsigned start, unsigned end,
+                unsigned range, unsigned count, uint8_t *out)
+{
+   const struct astc_ise_range *r = &astc_ranges[range];
+   unsigned pos = start;
+   unsigned i, j;
+
+   if (r->trits) {
+      static const uint8_t tbits[5] = { 2, 2, 1, 2, 1 };
+      for (i = 0; i < count; i += 5) {
+         unsigned m[5], trits[5], t = 0, shift = 0;
+         for (j = 0; j < 5; ++j) {
+            m[j] = astc_read_bits(q, pos, r->bits, end);
+            pos += r->bits;
+            t |= astc_read_bits(q, pos, tbits[j], end) << shift;
+            pos += tbits[j];
+            shift += tbits[j];
+         }
+         astc_decode_trits(t, trits);
+         for (j = 0; j < 5 && i + j < count; ++j)
+            out[i + j] = (trits[j] << r->bits) | m[j];
+      }
+   }
+   else if (r->quints) {
+      static const uint8_t qbits[3] = { 3, 2, 2 };
+      for (i = 0; i < count; i += 3) {
+         unsigned m[3], quints[3], v = 0, shift = 0;
+         for (j = 0; j < 3; ++j) {
+            m[j] = astc_read_bits(q, pos, r->bits, end);
+            pos += r->bits;
+            v |= astc_read_bits(q, pos, qbits[j], end) << shift;
+            pos += qbits[j];
+            shift += qbits[j];
+         }
+         astc_decode_quints(v, quints);
+         for (j = 0; j < 3 && i + j < count; ++j)
+            out[i + j] = (quints[j] << r->bits) | m[j];
+      }
+   }
+   else {
+      for (i = 0; i < count; ++i) {
+         out[i] = astc_read_bits(q, pos, r->bits, end);
+         pos += r->bits;
+      }
+   }
+}
+
+
+/**
+ * Replicate the low bits of value until to_bits are filled.
+ */
+static inline unsigned
+astc_replicate(unsigned value, unsigned from_bits, unsigned to_bits)
+{
+   unsigned result = 0;
+   int shift = to_bits;
+
+   if (from_bits == 0)
+      return 0;
+
+   while (shift > 0) {
+      shift -= from_bits;
+      if (shift >= 0)
+         result |= value << shift;
+      else
+         result |= value >> -shift;
+   }
+   return result;
+}
+
+
+/**
+ * Unquantize a color endpoint value to 0..255.
+ */
+static unsigned
+astc_unquantize_color(unsigned range, unsigned value)
+{
+   const struct astc_ise_range *r = &astc_ranges[range];
+   unsigned m = value & ((1 << r->bits) - 1);
+   unsigned d = value >> r->bits;
+   unsigned a, b, c, bm, t;
+
+   if (!r->trits && !r->quints)
+      return astc_replicate(m, r->bits, 8);
+
+   a = (m & 1) ? 0x1ff : 0;
+   bm = m >> 1;
+
+   if (r->trits) {
+      switch (r->bits) {
+      case 1: b = 0; c = 204; break;
+      case 2: b = bm * 0x116; c = 93; break;
+      case 3: b = bm * 0x85; c = 44; break;
+      case 4: b = bm * 0x41; c = 22; break;
+      case 5: b = (bm << 5) | (bm >> 2); c = 11; break;
+      default: b = (bm << 4) | (bm >> 4); c = 5; break;
+      }
+   }
+   else {
+      switch (r->bits) {
+      case 1: b = 0; c = 113; break;
+      case 2: b = bm * 0x10c; c = 54; break;
+      case 3: b = (bm << 7) | (bm << 1) | (bm >> 1); c = 26; break;
+      case 4: b = (bm << 6) | (bm >> 1); c = 13; break;
+      default: b = (bm << 5) | (bm >> 3); c = 6; break;
+      }
+   }
+
+   t = d * c + b;
+   t ^= a;
+   return (a & 0x80) | (t >> 2);
+}
+
+
+/**
+ * Unquantize a weight to 0..64.
+ */
+static unsigned
+astc_unquantize_weight(unsigned range, unsigned value)
+{
+   const struct astc_ise_range *r = &astc_ranges[range];
+   unsigned m = value & ((1 << r->bits) - 1);
+   unsigned d = value >> r->bits;
+   unsigned a, b, c, bm, t;
+
+   if (!r->trits && !r->quints) {
+      t = astc_replicate(m, r->bits, 6);
+   }
+   else if (r->bits == 0) {
+      static const uint8_t trit_values[3] = { 0, 32, 63 };
+      static const uint8_t quint_values[5] = { 0, 16, 32, 47, 63 };
+      t = r->trits ? trit_values[d] : quint_values[d];
+   }
+   else {
+      a = (m & 1) ? 0x7f : 0;
+      bm = m >> 1;
+
+      if (r->trits) {
+         switch (r->bits) {
+         case 1: b = 0; c = 50; break;
+         case 2: b = bm * 0x45; c = 23; break;
+         default: b = bm * 0x21; c = 11; break;
+         }
+      }
+      else {
+         switch (r->bits) {
+         case 1: b = 0; c = 28; break;
+         default: b = bm * 0x42; c = 13; break;
+         }
+      }
+
+      t = d * c + b;
+      t ^= a;
+      t = (a & 0x20) | (t >> 2);
+   }
+
+   if (t > 32)
+      ++t;
+   return t;
+}
+
+
+static inline int
+astc_clamp_byte(int v)
+{
+   return CLAMP(v, 0, 255);
+}
+
+
+static inline void
+astc_bit_transfer_signed(int *a, int *b)
+{
+   *b >>= 1;
+   *b |= *a & 0x80;
+   *a >>= 1;
+   *a &= 0x3f;
+   if (*a & 0x20)
+      *a -= 0x40;
+}
+
+
+static inline void
+astc_set_endpoint(uint8_t e[4], int r, int g, int b, int a)
+{
+   e[0] = astc_clamp_byte(r);
+   e[1] = astc_clamp_byte(g);
+   e[2] = astc_clamp_byte(b);
+   e[3] = astc_clamp_byte(a);
+}
+
+
+static inline void
+astc_set_endpoint_blue_contract(uint8_t e[4], int r, int g, int b, int a)
+{
+   astc_set_endpoint(e, (r + b) >> 1, (g + b) >> 1, b, a);
+}
+
+
+/**
+ * Decode the endpoints of one partition.  Returns FALSE for the HDR
+ * endpoint modes, which the LDR profile treats as errors.
+ */
+static boolean
+astc_decode_endpoints(unsigned cem, const int *v, uint8_t e[2][4])
+{
+   int v0, v1, v2, v3, v4, v5, v6, v7;
+
+   switch (cem) {
+   case 0:
+      astc_set_endpoint(e[0], v[0], v[0], v[0], 0xff);
+      astc_set_endpoint(e[1], v[1], v[1], v[1], 0xff);
+      return TRUE;
+
+   case 1:
+      v0 = (v[0] >> 2) | (v[1] & 0xc0);
+      v1 = MIN2(v0 + (v[1] & 0x3f), 0xff);
+      astc_set_endpoint(e[0], v0, v0, v0, 0xff);
+      astc_set_endpoint(e[1], v1, v1, v1, 0xff);
+      return TRUE;
+
+   case 4:
+      astc_set_endpoint(e[0], v[0], v[0], v[0], v[2]);
+      astc_set_endpoint(e[1], v[1], v[1], v[1], v[3]);
+      return TRUE;
+
+   case 5:
+      v0 = v[0]; v1 = v[1]; v2 = v[2]; v3 = v[3];
+      astc_bit_transfer_signed(&v1, &v0);
+      astc_bit_transfer_signed(&v3, &v2);
+      astc_set_endpoint(e[0], v0, v0, v0, v2);
+      astc_set_endpoint(e[1], v0 + v1, v0 + v1, v0 + v1, v2 + v3);
+      return TRUE;
+
+   case 6:
+      astc_set_endpoint(e[0], (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8,
+                        (v[2] * v[3]) >> 8, 0xff);
+      astc_set_endpoint(e[1], v[0], v[1], v[2], 0xff);
+      return TRUE;
+
+   case 8:
+   case 12:
+      v6 = cem == 12 ? v[6] : 0xff;
+      v7 = cem == 12 ? v[7] : 0xff;
+      if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4]) {
+         astc_set_endpoint(e[0], v[0], v[2], v[4], v6);
+         astc_set_endpoint(e[1], v[1], v[3], v[5], v7);
+      }
+      else {
+         astc_set_endpoint_blue_contract(e[0], v[1], v[3], v[5], v7);
+         astc_set_endpoint_blue_contract(e[1], v[0], v[2], v[4], v6);
+      }
+      return TRUE;
+
+   case 9:
+   case 13:
+      v0 = v[0]; v1 = v[1]; v2 = v[2]; v3 = v[3]; v4 = v[4]; v5 = v[5];
+      v6 = cem == 13 ? v[6] : 0xff;
+      v7 = cem == 13 ? v[7] : 0;
+      astc_bit_transfer_signed(&v1, &v0);
+      astc_bit_transfer_signed(&v3, &v2);
+      astc_bit_transfer_signed(&v5, &v4);
+      if (cem == 13)
+         astc_bit_transfer_signed(&v7, &v6);
+      if (v1 + v3 + v5 >= 0) {
+         astc_set_endpoint(e[0], v0, v2, v4, v6);
+         astc_set_endpoint(e[1], v0 + v1, v2 + v3, v4 + v5, v6 + v7);
+      }
+      else {
+         astc_set_endpoint_blue_contract(e[0], v0 + v1, v2 + v3, v4 + v5,
+                                         v6 + v7);
+         astc_set_endpoint_blue_contract(e[1], v0, v2, v4, v6);
+      }
+      return TRUE;
+
+   case 10:
+      astc_set_endpoint(e[0], (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8,
+                        (v[2] * v[3]) >> 8, v[4]);
+      astc_set_endpoint(e[1], v[0], v[1], v[2], v[5]);
+      return TRUE;
+
+   default:
+      /* HDR modes 2, 3, 7, 11, 14 and 15 */
+      return FALSE;
+   }
+}
+
+
+static inline uint32_t
+astc_hash52(uint32_t p)
+{
+   p ^= p >> 15;
+   p *= 0xeede0891;
+   p ^= p >> 5;
+   p += p << 16;
+   p ^= p >> 7;
+   p ^= p >> 3;
+   p ^= p << 6;
+   p ^= p >> 17;
+   return p;
+}
+
+
+/**
+ * The partition selection function of the specification, for 2D blocks.
+ */
+static unsigned
+astc_select_partition(unsigned seed, unsigned x, unsigned y,
+                      unsigned num_partitions, boolean small_block)
+{
+   uint32_t rnum;
+   uint8_t s[12];
+   unsigned sh1, sh2, sh3;
+   int a, b, c, d;
+   unsigned i;
+
+   if (small_block) {
+      x <<= 1;
+      y <<= 1;
+   }
+
+   seed += (num_partitions - 1) * 1024;
+   rnum = astc_hash52(seed);
+
+   s[0] = rnum & 0xf;
+   s[1] = (rnum >> 4) & 0xf;
+   s[2] = (rnum >> 8) & 0xf;
+   s[3] = (rnum >> 12) & 0xf;
+   s[4] = (rnum >> 16) & 0xf;
+   s[5] = (rnum >> 20) & 0xf;
+   s[6] = (rnum >> 24) & 0xf;
+   s[7] = (rnum >> 28) & 0xf;
+   s[8] = (rnum >> 18) & 0xf;
+   s[9] = (rnum >> 22) & 0xf;
+   s[10] = (rnum >> 26) & 0xf;
+   s[11] = ((rnum >> 30) | (rnum << 2)) & 0xf;
+
+   for (i = 0; i < 12; ++i)
+      s[i] *= s[i];
+
+   if (seed & 1) {
+      sh1 = (seed & 2) ? 4 : 5;
+      sh2 = (num_partitions == 3) ? 6 : 5;
+   }
+   else {
+      sh1 = (num_partitions == 3) ? 6 : 5;
+      sh2 = (seed & 2) ? 4 : 5;
+   }
+   sh3 = (seed & 0x10) ? sh1 : sh2;
+
+   for (i = 0; i < 8; ++i)
+      s[i] >>= (i & 1) ? sh2 : sh1;
+   for (i = 8; i < 12; ++i)
+      s[i] >>= sh3;
+
+   /* z is always zero for 2D blocks, so seeds 9 to 12 drop out */
+   a = (s[0] * x + s[1] * y + (rnum >> 14)) & 0x3f;
+   b = (s[2] * x + s[3] * y + (rnum >> 10)) & 0x3f;
+   c = (s[4] * x + s[5] * y + (rnum >> 6)) & 0x3f;
+   d = (s[6] * x + s[7] * y + (rnum >> 2)) & 0x3f;
+
+   if (num_partitions < 4)
+      d = 0;
+   if (num_partitions < 3)
+      c = 0;
+
+   if (a >= b && a >= c && a >= d)
+      return 0;
+   else if (b >= c && b >= d)
+      return 1;
+   else if (c >= d)
+      return 2;
+   else
+      return 3;
+}
+
+
+/**
+ * Decode the block mode field.  Returns FALSE for reserved encodings.
+ */
+static boolean
+astc_decode_block_mode(unsigned mode, struct astc_block *blk)
+{
+   unsigned r, h, d, a, b;
+
+   if ((mode & 0x3) != 0) {
+      r = ((mode & 0x3) << 1) | ((mode >> 4) & 0x1);
+      a = (mode >> 5) & 0x3;
+      b = (mode >> 7) & 0x3;
+      h = (mode >> 9) & 0x1;
+      d = (mode >> 10) & 0x1;
+
+      switch ((mode >> 2) & 0x3) {
+      case 0:
+         blk->weight_width = b + 4;
+         blk->weight_height = a + 2;
+         break;
+      case 1:
+         blk->weight_width = b + 8;
+         blk->weight_height = a + 2;
+         break;
+      case 2:
+         blk->weight_width = a + 2;
+         blk->weight_height = b + 8;
+         break;
+      default:
+         b &= 0x1;
+         if ((mode >> 8) & 0x1) {
+            blk->weight_width = b + 2;
+            blk->weight_height = a + 2;
+         }
+         else {
+            blk->weight_width = a + 2;
+            blk->weight_height = b + 6;
+         }
+         break;
+      }
+   }
+   else {
+      if ((mode & 0xf) == 0)
+         return FALSE;
+
+      r = ((mode >> 1) & 0x6) | ((mode >> 4) & 0x1);
+      a = (mode >> 5) & 0x3;
+      b = (mode >> 9) & 0x3;
+      h = (mode >> 9) & 0x1;
+      d = (mode >> 10) & 0x1;
+
+      switch ((mode >> 7) & 0x3) {
+      case 0:
+         blk->weight_width = 12;
+         blk->weight_height = a + 2;
+         break;
+      case 1:
+         blk->weight_width = a + 2;
+         blk->weight_height = 12;
+         break;
+      case 2:
+         blk->weight_width = a + 6;
+         blk->weight_height = b + 6;
+         h = 0;
+         d = 0;
+         break;
+      default:
+         switch ((mode >> 5) & 0x3) {
+         case 0:
+            blk->weight_width = 6;
+            blk->weight_height = 10;
+            break;
+         case 1:
+            blk->weight_width = 10;
+            blk->weight_height = 6;
+            break;
+         default:
+            return FALSE;
+         }
+         break;
+      }
+   }
+
+   blk->weight_range = (r - 2) + 6 * h;
+   blk->dual_plane = d;
+   return TRUE;
+}
+
+
+/**
+ * Parse the block and unquantize endpoints and weights.  Returns FALSE if
+ * the block must decode to the error color.
+ */
+static boolean
+astc_parse_block(const uint64_t q[2], unsigned bw, unsigned bh,
+                 struct astc_block *blk)
+{
+   uint8_t values[ASTC_MAX_COLOR_VALUES];
+   uint8_t raw_weights[ASTC_MAX_WEIGHTS];
+   uint64_t rq[2];
+   unsigned num_weights, weight_bits, below_weights;
+   unsigned color_start, color_bits, num_values, range;
+   unsigned i, p;
+   int v[8];
+   const uint8_t *pv;
+
+   if (!astc_decode_block_mode(astc_read_bits(q, 0, 11, 128), blk))
+      return FALSE;
+
+   if (blk->weight_width > bw || blk->weight_height > bh)
+      return FALSE;
+
+   num_weights = blk->weight_width * blk->weight_height;
+   if (blk->dual_plane)
+      num_weights *= 2;
+   if (num_weights > ASTC_MAX_WEIGHTS)
+      return FALSE;
+
+   weight_bits = astc_ise_bits(blk->weight_range, num_weights);
+   if (weight_bits < 24 || weight_bits > 96)
+      return FALSE;
+   below_weights = 128 - weight_bits;
+
+   blk->num_partitions = astc_read_bits(q, 11, 2, 128) + 1;
+   if (blk->num_partitions == 4 && blk->dual_plane)
+      return FALSE;
+
+   if (blk->num_partitions == 1) {
+      blk->partition_seed = 0;
+      blk->cem[0] = astc_read_bits(q, 13, 4, 128);
+      color_start = 17;
+   }
+   else {
+      unsigned cem = astc_read_bits(q, 23, 6, 128);
+
+      blk->partition_seed = astc_read_bits(q, 13, 10, 128);
+      color_start = 29;
+
+      if ((cem & 0x3) == 0) {
+         for (p = 0; p < blk->num_partitions; ++p)
+            blk->cem[p] = cem >> 2;
+      }
+      else {
+         unsigned extra = 3 * blk->num_partitions - 4;
+         unsigned base;
+
+         below_weights -= extra;
+         cem |= astc_read_bits(q, below_weights, extra, 128) << 6;
+
+         base = (cem & 0x3) - 1;
+         cem >>= 2;
+         for (p = 0; p < blk->num_partitions; ++p)
+            blk->cem[p] = ((base + ((cem >> p) & 0x1)) << 2) |
+                          ((cem >> (blk->num_partitions + 2 * p)) & 0x3);
+      }
+   }
+
+   if (blk->dual_plane) {
+      below_weights -= 2;
+      blk->plane2_component = astc_read_bits(q, below_weights, 2, 128);
+   }
+
+   num_values = 0;
+   for (p = 0; p < blk->num_partitions; ++p)
+      num_values += ((blk->cem[p] >> 2) + 1) * 2;
+   if (num_values > ASTC_MAX_COLOR_VALUES)
+      return FALSE;
+
+   if (below_weights < color_start)
+      return FALSE;
+   color_bits = below_weights - color_start;
+
+   for (range = ARRAY_SIZE(astc_ranges) - 1; range >= ASTC_MIN_COLOR_RANGE;
+        --range) {
+      if (astc_ise_bits(range, num_values) <= color_bits)
+         break;
+   }
+   if (range < ASTC_MIN_COLOR_RANGE)
+      return FALSE;
+
+   astc_decode_ise(q, color_start, below_weights, range, num_values, values);
+
+   pv = values;
+   for (p = 0; p < blk->num_partitions; ++p) {
+      unsigned n = ((blk->cem[p] >> 2) + 1) * 2;
+      for (i = 0; i < n; ++i)
+         v[i] = astc_unquantize_color(range, pv[i]);
+      if (!astc_decode_endpoints(blk->cem[p], v, blk->endpoints[p]))
+         return FALSE;
+      pv += n;
+   }
+
+   /* weights are stored bit-reversed from the top of the block */
+   rq[0] = astc_reverse64(q[1]);
+   rq[1] = astc_reverse64(q[0]);
+   astc_decode_ise(rq, 0, weight_bits, blk->weight_range, num_weights,
+                   raw_weights);
+   for (i = 0; i < num_weights; ++i)
+      blk->weights[i] = astc_unquantize_weight(blk->weight_range,
+                                               raw_weights[i]);
+
+   return TRUE;
+}
+
+
+/**
+ * Bilinearly infill the weight of texel (s, t) for the given plane from the
+ * weight grid.
+ */
+static inline unsigned
+astc_texel_weight(const struct astc_block *blk, unsigned bw, unsigned bh,
+                  unsigned s, unsigned t, unsigned plane)
+{
+   const unsigned ww = blk->weight_width;
+   const unsigned wh = blk->weight_height;
+   const unsigned planes = blk->dual_plane ? 2 : 1;
+   unsigned ds, dt, gs, gt, js, jt, fs, ft;
+   unsigned js1, jt1, w00, w01, w10, w11;
+   unsigned p00, p01, p10, p11;
+
+   if (ww == bw && wh == bh)
+      return blk->weights[(t * ww + s) * planes + plane];
+
+   ds = (1024 + bw / 2) / (bw - 1);
+   dt = (1024 + bh / 2) / (bh - 1);
+   gs = (ds * s * (ww - 1) + 32) >> 6;
+   gt = (dt * t * (wh - 1) + 32) >> 6;
+   js = gs >> 4;
+   fs = gs & 0xf;
+   jt = gt >> 4;
+   ft = gt & 0xf;
+
+   /* the fractional weight is zero whenever the next sample is outside */
+   js1 = MIN2(js + 1, ww - 1);
+   jt1 = MIN2(jt + 1, wh - 1);
+
+   w11 = (fs * ft + 8) >> 4;
+   w10 = ft - w11;
+   w01 = fs - w11;
+   w00 = 16 - fs - ft + w11;
+
+   p00 = blk->weights[(jt * ww + js) * planes + plane];
+   p01 = blk->weights[(jt * ww + js1) * planes + plane];
+   p10 = blk->weights[(jt1 * ww + js) * planes + plane];
+   p11 = blk->weights[(jt1 * ww + js1) * planes + plane];
+
+   return (p00 * w00 + p01 * w01 + p10 * w10 + p11 * w11 + 8) >> 4;
+}
+
+
+/**
+ * Decode a whole bw x bh block into 16 bit per channel RGBA texels.  For
+ * sRGB formats the upper 8 bits of the color channels are sRGB encoded.
+ */
+static void
+astc_decode_block(const uint8_t *src, unsigned bw, unsigned bh,
+                  boolean srgb, uint16_t (*texels)[4])
+{
+   struct astc_block blk;
+   uint64_t q[2] = { 0, 0 };
+   unsigned i, s, t, c;
+
+   for (i = 0; i < 8; ++i) {
+      q[0] |= (uint64_t)src[i] << (8 * i);
+      q[1] |= (uint64_t)src[i + 8] << (8 * i);
+   }
+
+   /* void-extent block */
+   if ((q[0] & 0x1ff) == 0x1fc) {
+      if (q[0] & 0x200) {
+         /* HDR void-extent */
+         goto error;
+      }
+      for (i = 0; i < bw * bh; ++i) {
+         for (c = 0; c < 4; ++c)
+            texels[i][c] = (q[1] >> (16 * c)) & 0xffff;
+      }
+      return;
+   }
+
+   if (!astc_parse_block(q, bw, bh, &blk))
+      goto error;
+
+   for (t = 0; t < bh; ++t) {
+      for (s = 0; s < bw; ++s) {
+         uint16_t *texel = texels[t * bw + s];
+         unsigned p = 0, w[2];
+
+         if (blk.num_partitions > 1)
+            p = astc_select_partition(blk.partition_seed, s, t,
+                                      blk.num_partitions, bw * bh < 31);
+
+         w[0] = astc_texel_weight(&blk, bw, bh, s, t, 0);
+         w[1] = blk.dual_plane ? astc_texel_weight(&blk, bw, bh, s, t, 1) :
+                                 w[0];
+
+         for (c = 0; c < 4; ++c) {
+            unsigned e0 = blk.endpoints[p][0][c];
+            unsigned e1 = blk.endpoints[p][1][c];
+            unsigned wc = (blk.dual_plane && c == blk.plane2_component) ?
+                          w[1] : w[0];
+
+            if (srgb && c < 3) {
+               e0 = (e0 << 8) | 0x80;
+               e1 = (e1 << 8) | 0x80;
+            }
+            else {
+               e0 = (e0 << 8) | e0;
+               e1 = (e1 << 8) | e1;
+            }
+
+            texel[c] = (e0 * (64 - wc) + e1 * wc + 32) >> 6;
+         }
+      }
+   }
+   return;
+
+error:
+   for (i = 0; i < bw * bh; ++i) {
+      texels[i][0] = 0xffff;
+      texels[i][1] = 0;
+      texels[i][2] = 0xffff;
+      texels[i][3] = 0xffff;
+   }
+}
+
+
+static inline void
+astc_texel_to_8unorm(uint8_t *dst, const uint16_t texel[4], boolean srgb)
+{
+   if (srgb) {
+      dst[0] = util_format_srgb_to_linear_8unorm(texel[0] >> 8);
+      dst[1] = util_format_srgb_to_linear_8unorm(texel[1] >> 8);
+      dst[2] = util_format_srgb_to_linear_8unorm(texel[2] >> 8);
+   }
+   else {
+      dst[0] = texel[0] >> 8;
+      dst[1] = texel[1] >> 8;
+      dst[2] = texel[2] >> 8;
+   }
+   dst[3] = texel[3] >> 8;
+}
+
+
+static inline void
+astc_texel_to_float(float *dst, const uint16_t texel[4], boolean srgb)
+{
+   if (srgb) {
+      dst[0] = util_format_srgb_8unorm_to_linear_float(texel[0] >> 8);
+      dst[1] = util_format_srgb_8unorm_to_linear_float(texel[1] >> 8);
+      dst[2] = util_format_srgb_8unorm_to_linear_float(texel[2] >> 8);
+   }
+   else {
+      dst[0] = texel[0] * (1.0f / 65535.0f);
+      dst[1] = texel[1] * (1.0f / 65535.0f);
+      dst[2] = texel[2] * (1.0f / 65535.0f);
+   }
+   dst[3] = texel[3] * (1.0f / 65535.0f);
+}
+
+
+void
+util_format_astc_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                    const uint8_t *src_row,
+                                    unsigned src_stride,
+                                    unsigned width, unsigned height,
+                                    unsigned bw, unsigned bh, boolean srgb)
+{
+   uint16_t texels[ASTC_MAX_BLOCK_TEXELS][4];
+   unsigned x, y, i, j;
+
+   for (y = 0; y < height; y += bh) {
+      const uint8_t *src = src_row;
+      for (x = 0; x < width; x += bw) {
+         astc_decode_block(src, bw, bh, srgb, texels);
+         for (j = 0; j < bh && y + j < height; ++j) {
+            uint8_t *dst = dst_row + (y + j) * dst_stride + x * 4;
+            for (i = 0; i < bw && x + i < width; ++i) {
+               astc_texel_to_8unorm(dst, texels[j * bw + i], srgb);
+               dst += 4;
+            }
+         }
+         src += 16;
+      }
+      src_row += src_stride;
+   }
+}
+
+
+void
+util_format_astc_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                                   const uint8_t *src_row,
+                                   unsigned src_stride,
+                                   unsigned width, unsigned height,
+                                   unsigned bw, unsigned bh, boolean srgb)
+{
+   uint16_t texels[ASTC_MAX_BLOCK_TEXELS][4];
+   unsigned x, y, i, j;
+
+   for (y = 0; y < height; y += bh) {
+      const uint8_t *src = src_row;
+      for (x = 0; x < width; x += bw) {
+         astc_decode_block(src, bw, bh, srgb, texels);
+         for (j = 0; j < bh && y + j < height; ++j) {
+            float *dst = (float *)((uint8_t *)dst_row + (y + j) * dst_stride) +
+                         x * 4;
+            for (i = 0; i < bw && x + i < width; ++i) {
+               astc_texel_to_float(dst, texels[j * bw + i], srgb);
+               dst += 4;
+            }
+         }
+         src += 16;
+      }
+      src_row += src_stride;
+   }
+}
+
+
+void
+util_format_astc_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                                   unsigned i, unsigned j,
+                                   unsigned bw, unsigned bh, boolean srgb)
+{
+   uint16_t texels[ASTC_MAX_BLOCK_TEXELS][4];
+
+   astc_decode_block(src, bw, bh, srgb, texels);
+   astc_texel_to_8unorm(dst, texels[j * bw + i], srgb);
+}
+
+
+void
+util_format_astc_fetch_rgba_float(float *dst, const uint8_t *src,
+                                  unsigned i, unsigned j,
+                                  unsigned bw, unsigned bh, boolean srgb)
+{
+   uint16_t texels[ASTC_MAX_BLOCK_TEXELS][4];
+
+   astc_decode_block(src, bw, bh, srgb, texels);
+   astc_texel_to_float(dst, texels[j * bw + i], srgb);
+}
+
+
+#define ASTC_FORMAT_FUNCS(name, bw, bh, srgb) \
+void \
+util_format_##name##_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride, \
+                                        const uint8_t *src_row, unsigned src_stride, \
+                                        unsigned width, unsigned height) \
+{ \
+   util_format_astc_unpack_rgba_8unorm(dst_row, dst_stride, src_row, src_stride, \
+                                       width, height, bw, bh, srgb); \
+} \
+\
+void \
+util_format_##name##_pack_rgba_8unorm(UNUSED uint8_t *dst_row, UNUSED unsigned dst_stride, \
+                                      UNUSED const uint8_t *src_row, UNUSED unsigned src_stride, \
+                                      UNUSED unsigned width, UNUSED unsigned height) \
+{ \
+   assert(0); \
+} \
+\
+void \
+util_format_##name##_unpack_rgba_float(float *dst_row, unsigned dst_stride, \
+                                       const uint8_t *src_row, unsigned src_stride, \
+                                       unsigned width, unsigned height) \
+{ \
+   util_format_astc_unpack_rgba_float(dst_row, dst_stride, src_row, src_stride, \
+                                      width, height, bw, bh, srgb); \
+} \
+\
+void \
+util_format_##name##_pack_rgba_float(UNUSED uint8_t *dst_row, UNUSED unsigned dst_stride, \
+                                     UNUSED const float *src_row, UNUSED unsigned src_stride, \
+                                     UNUSED unsigned width, UNUSED unsigned height) \
+{ \
+   assert(0); \
+} \
+\
+void \
+util_format_##name##_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src, \
+                                       unsigned i, unsigned j) \
+{ \
+   util_format_astc_fetch_rgba_8unorm(dst, src, i, j, bw, bh, srgb); \
+} \
+\
+void \
+util_format_##name##_fetch_rgba_float(float *dst, const uint8_t *src, \
+                                      unsigned i, unsigned j) \
+{ \
+   util_format_astc_fetch_rgba_float(dst, src, i, j, bw, bh, srgb); \
+}
+
+ASTC_FORMAT_FUNCS(astc_4x4, 4, 4, FALSE)
+ASTC_FORMAT_FUNCS(astc_5x4, 5, 4, FALSE)
+ASTC_FORMAT_FUNCS(astc_5x5, 5, 5, FALSE)
+ASTC_FORMAT_FUNCS(astc_6x5, 6, 5, FALSE)
+ASTC_FORMAT_FUNCS(astc_6x6, 6, 6, FALSE)
+ASTC_FORMAT_FUNCS(astc_8x5, 8, 5, FALSE)
+ASTC_FORMAT_FUNCS(astc_8x6, 8, 6, FALSE)
+ASTC_FORMAT_FUNCS(astc_8x8, 8, 8, FALSE)
+ASTC_FORMAT_FUNCS(astc_10x5, 10, 5, FALSE)
+ASTC_FORMAT_FUNCS(astc_10x6, 10, 6, FALSE)
+ASTC_FORMAT_FUNCS(astc_10x8, 10, 8, FALSE)
+ASTC_FORMAT_FUNCS(astc_10x10, 10, 10, FALSE)
+ASTC_FORMAT_FUNCS(astc_12x10, 12, 10, FALSE)
+ASTC_FORMAT_FUNCS(astc_12x12, 12, 12, FALSE)
+
+ASTC_FORMAT_FUNCS(astc_4x4_srgb, 4, 4, TRUE)
+ASTC_FORMAT_FUNCS(astc_5x4_srgb, 5, 4, TRUE)
+ASTC_FORMAT_FUNCS(astc_5x5_srgb, 5, 5, TRUE)
+ASTC_FORMAT_FUNCS(astc_6x5_srgb, 6, 5, TRUE)
+ASTC_FORMAT_FUNCS(astc_6x6_srgb, 6, 6, TRUE)
+ASTC_FORMAT_FUNCS(astc_8x5_srgb, 8, 5, TRUE)
+ASTC_FORMAT_FUNCS(astc_8x6_srgb, 8, 6, TRUE)
+ASTC_FORMAT_FUNCS(astc_8x8_srgb, 8, 8, TRUE)
+ASTC_FORMAT_FUNCS(astc_10x5_srgb, 10, 5, TRUE)
+ASTC_FORMAT_FUNCS(astc_10x6_srgb, 10, 6, TRUE)
+ASTC_FORMAT_FUNCS(astc_10x8_srgb, 10, 8, TRUE)
+ASTC_FORMAT_FUNCS(astc_10x10_srgb, 10, 10, TRUE)
+ASTC_FORMAT_FUNCS(astc_12x10_srgb, 12, 10, TRUE)
+ASTC_FORMAT_FUNCS(astc_12x12_srgb, 12, 12, TRUE)
@@ -0,0 +1,505 @@
+/**************************************************************************
+ *
+ * Copyright (C) 2014 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+#include "u_math.h"
+#include "u_memory.h"
+#include "u_format.h"
+#include "u_format_bptc.h"
+#include "util/format_srgb.h"
+
+#include "../../../mesa/main/texcompress_bptc_tmp.h"
+
+
+/*
+ * RGBA unorm.
+ */
+
+void
+util_format_bptc_rgba_unorm_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                               const uint8_t *src_row, unsigned src_stride,
+                                               unsigned width, unsigned height)
+{
+   decompress_rgba_unorm(width, height,
+                         src_row, src_stride,
+                         dst_row, dst_stride);
+}
+
+void
+util_format_bptc_rgba_unorm_pack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                             const uint8_t *src_row, unsigned src_stride,
+                                             unsigned width, unsigned height)
+{
+   compress_rgba_unorm(width, height,
+                       src_row, src_stride,
+                       dst_row, dst_stride);
+}
+
+void
+util_format_bptc_rgba_unorm_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                                              const uint8_t *src_row, unsigned src_stride,
+                                              unsigned width, unsigned height)
+{
+   uint8_t *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 4);
+   if (!temp_block)
+      return;
+
+   decompress_rgba_unorm(width, height,
+                         src_row, src_stride,
+                         temp_block, width * 4);
+
+   for (y = 0; y < height; ++y) {
+      float *dst = dst_row + y * dst_stride / sizeof(*dst_row);
+      const uint8_t *src = temp_block + y * width * 4;
+
+      for (x = 0; x < width * 4; ++x)
+         dst[x] = ubyte_to_float(src[x]);
+   }
+
+   FREE(temp_block);
+}
+
+void
+util_format_bptc_rgba_unorm_pack_rgba_float(uint8_t *dst_row, unsigned dst_stride,
+                                            const float *src_row, unsigned src_stride,
+                                            unsigned width, unsigned height)
+{
+   uint8_t *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 4);
+   if (!temp_block)
+      return;
+
+   for (y = 0; y < height; ++y) {
+      const float *src = src_row + y * src_stride / sizeof(*src_row);
+      uint8_t *dst = temp_block + y * width * 4;
+
+      for (x = 0; x < width * 4; ++x)
+         dst[x] = float_to_ubyte(src[x]);
+   }
+
+   compress_rgba_unorm(width, height,
+                       temp_block, width * 4,
+                       dst_row, dst_stride);
+
+   FREE(temp_block);
+}
+
+void
+util_format_bptc_rgba_unorm_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                                              unsigned i, unsigned j)
+{
+   fetch_rgba_unorm_from_block(src, dst, i + j * BLOCK_SIZE);
+}
+
+void
+util_format_bptc_rgba_unorm_fetch_rgba_float(float *dst, const uint8_t *src,
+                                             unsigned i, unsigned j)
+{
+   uint8_t temp_texel[4];
+
+   fetch_rgba_unorm_from_block(src, temp_texel, i + j * BLOCK_SIZE);
+
+   dst[0] = ubyte_to_float(temp_texel[0]);
+   dst[1] = ubyte_to_float(temp_texel[1]);
+   dst[2] = ubyte_to_float(temp_texel[2]);
+   dst[3] = ubyte_to_float(temp_texel[3]);
+}
+
+
+/*
+ * sRGBA unorm.
+ */
+
+void
+util_format_bptc_srgba_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                          const uint8_t *src_row, unsigned src_stride,
+                                          unsigned width, unsigned height)
+{
+   unsigned x, y;
+
+   decompress_rgba_unorm(width, height,
+                         src_row, src_stride,
+                         dst_row, dst_stride);
+
+   for (y = 0; y < height; ++y) {
+      uint8_t *dst = dst_row + y * dst_stride;
+
+      for (x = 0; x < width; ++x) {
+         dst[0] = util_format_srgb_to_linear_8unorm(dst[0]);
+         dst[1] = util_format_srgb_to_linear_8unorm(dst[1]);
+         dst[2] = util_format_srgb_to_linear_8unorm(dst[2]);
+         dst += 4;
+      }
+   }
+}
+
+void
+util_format_bptc_srgba_pack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                        const uint8_t *src_row, unsigned src_stride,
+                                        unsigned width, unsigned height)
+{
+   uint8_t *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 4);
+   if (!temp_block)
+      return;
+
+   for (y = 0; y < height; ++y) {
+      const uint8_t *src = src_row + y * src_stride;
+      uint8_t *dst = temp_block + y * width * 4;
+
+      for (x = 0; x < width; ++x) {
+         dst[0] = util_format_linear_to_srgb_8unorm(src[0]);
+         dst[1] = util_format_linear_to_srgb_8unorm(src[1]);
+         dst[2] = util_format_linear_to_srgb_8unorm(src[2]);
+         dst[3] = src[3];
+         src += 4;
+         dst += 4;
+      }
+   }
+
+   compress_rgba_unorm(width, height,
+                       temp_block, width * 4,
+                       dst_row, dst_stride);
+
+   FREE(temp_block);
+}
+
+void
+util_format_bptc_srgba_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                                         const uint8_t *src_row, unsigned src_stride,
+                                         unsigned width, unsigned height)
+{
+   uint8_t *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 4);
+   if (!temp_block)
+      return;
+
+   decompress_rgba_unorm(width, height,
+                         src_row, src_stride,
+                         temp_block, width * 4);
+
+   for (y = 0; y < height; ++y) {
+      float *dst = dst_row + y * dst_stride / sizeof(*dst_row);
+      const uint8_t *src = temp_block + y * width * 4;
+
+      for (x = 0; x < width; ++x) {
+         dst[0] = util_format_srgb_8unorm_to_linear_float(src[0]);
+         dst[1] = util_format_srgb_8unorm_to_linear_float(src[1]);
+         dst[2] = util_format_srgb_8unorm_to_linear_float(src[2]);
+         dst[3] = ubyte_to_float(src[3]);
+         src += 4;
+         dst += 4;
+      }
+   }
+
+   FREE(temp_block);
+}
+
+void
+util_format_bptc_srgba_pack_rgba_float(uint8_t *dst_row, unsigned dst_stride,
+                                       const float *src_row, unsigned src_stride,
+                                       unsigned width, unsigned height)
+{
+   uint8_t *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 4);
+   if (!temp_block)
+      return;
+
+   for (y = 0; y < height; ++y) {
+      const float *src = src_row + y * src_stride / sizeof(*src_row);
+      uint8_t *dst = temp_block + y * width * 4;
+
+      for (x = 0; x < width; ++x) {
+         dst[0] = util_format_linear_float_to_srgb_8unorm(src[0]);
+         dst[1] = util_format_linear_float_to_srgb_8unorm(src[1]);
+         dst[2] = util_format_linear_float_to_srgb_8unorm(src[2]);
+         dst[3] = float_to_ubyte(src[3]);
+         src += 4;
+         dst += 4;
+      }
+   }
+
+   compress_rgba_unorm(width, height,
+                       temp_block, width * 4,
+                       dst_row, dst_stride);
+
+   FREE(temp_block);
+}
+
+void
+util_format_bptc_srgba_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                                         unsigned i, unsigned j)
+{
+   fetch_rgba_unorm_from_block(src, dst, i + j * BLOCK_SIZE);
+
+   dst[0] = util_format_srgb_to_linear_8unorm(dst[0]);
+   dst[1] = util_format_srgb_to_linear_8unorm(dst[1]);
+   dst[2] = util_format_srgb_to_linear_8unorm(dst[2]);
+}
+
+void
+util_format_bptc_srgba_fetch_rgba_float(float *dst, const uint8_t *src,
+                                        unsigned i, unsigned j)
+{
+   uint8_t temp_texel[4];
+
+   fetch_rgba_unorm_from_block(src, temp_texel, i + j * BLOCK_SIZE);
+
+   dst[0] = util_format_srgb_8unorm_to_linear_float(temp_texel[0]);
+   dst[1] = util_format_srgb_8unorm_to_linear_float(temp_texel[1]);
+   dst[2] = util_format_srgb_8unorm_to_linear_float(temp_texel[2]);
+   dst[3] = ubyte_to_float(temp_texel[3]);
+}
+
+
+/*
+ * RGB float (signed and unsigned).
+ */
+
+static void
+bptc_rgb_float_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                  const uint8_t *src_row, unsigned src_stride,
+                                  unsigned width, unsigned height,
+                                  bool is_signed)
+{
+   float *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 4 * sizeof(float));
+   if (!temp_block)
+      return;
+
+   decompress_rgb_float(width, height,
+                        src_row, src_stride,
+                        temp_block, width * 4 * sizeof(float),
+                        is_signed);
+
+   for (y = 0; y < height; ++y) {
+      const float *src = temp_block + y * width * 4;
+      uint8_t *dst = dst_row + y * dst_stride;
+
+      for (x = 0; x < width * 4; ++x)
+         dst[x] = float_to_ubyte(src[x]);
+   }
+
+   FREE(temp_block);
+}
+
+static void
+bptc_rgb_float_pack_rgba_float(uint8_t *dst_row, unsigned dst_stride,
+                               const float *src_row, unsigned src_stride,
+                               unsigned width, unsigned height,
+                               bool is_signed)
+{
+   float *temp_block;
+   unsigned x, y;
+
+   /* The compressor only looks at RGB */
+   temp_block = MALLOC(width * height * 3 * sizeof(float));
+   if (!temp_block)
+      return;
+
+   for (y = 0; y < height; ++y) {
+      const float *src = src_row + y * src_stride / sizeof(*src_row);
+      float *dst = temp_block + y * width * 3;
+
+      for (x = 0; x < width; ++x) {
+         dst[0] = src[0];
+         dst[1] = src[1];
+         dst[2] = src[2];
+         src += 4;
+         dst += 3;
+      }
+   }
+
+   compress_rgb_float(width, height,
+                      temp_block, width * 3 * sizeof(float),
+                      dst_row, dst_stride,
+                      is_signed);
+
+   FREE(temp_block);
+}
+
+static void
+bptc_rgb_float_pack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                const uint8_t *src_row, unsigned src_stride,
+                                unsigned width, unsigned height,
+                                bool is_signed)
+{
+   float *temp_block;
+   unsigned x, y;
+
+   temp_block = MALLOC(width * height * 3 * sizeof(float));
+   if (!temp_block)
+      return;
+
+   for (y = 0; y < height; ++y) {
+      const uint8_t *src = src_row + y * src_stride;
+      float *dst = temp_block + y * width * 3;
+
+      for (x = 0; x < width; ++x) {
+         dst[0] = ubyte_to_float(src[0]);
+         dst[1] = ubyte_to_float(src[1]);
+         dst[2] = ubyte_to_float(src[2]);
+         src += 4;
+         dst += 3;
+      }
+   }
+
+   compress_rgb_float(width, height,
+                      temp_block, width * 3 * sizeof(float),
+                      dst_row, dst_stride,
+                      is_signed);
+
+   FREE(temp_block);
+}
+
+static void
+bptc_rgb_float_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                                 unsigned i, unsigned j, bool is_signed)
+{
+   float temp_texel[4];
+
+   fetch_rgb_float_from_block(src, temp_texel, i + j * BLOCK_SIZE, is_signed);
+
+   dst[0] = float_to_ubyte(temp_texel[0]);
+   dst[1] = float_to_ubyte(temp_texel[1]);
+   dst[2] = float_to_ubyte(temp_texel[2]);
+   dst[3] = float_to_ubyte(temp_texel[3]);
+}
+
+void
+util_format_bptc_rgb_float_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                              const uint8_t *src_row, unsigned src_stride,
+                                              unsigned width, unsigned height)
+{
+   bptc_rgb_float_unpack_rgba_8unorm(dst_row, dst_stride, src_row, src_stride,
+                                     width, height, true);
+}
+
+void
+util_format_bptc_rgb_float_pack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                            const uint8_t *src_row, unsigned src_stride,
+                                            unsigned width, unsigned height)
+{
+   bptc_rgb_float_pack_rgba_8unorm(dst_row, dst_stride, src_row, src_stride,
+                                   width, height, true);
+}
+
+void
+util_format_bptc_rgb_float_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                                             const uint8_t *src_row, unsigned src_stride,
+                                             unsigned width, unsigned height)
+{
+   decompress_rgb_float(width, height,
+                        src_row, src_stride,
+                        dst_row, dst_stride,
+                        true);
+}
+
+void
+util_format_bptc_rgb_float_pack_rgba_float(uint8_t *dst_row, unsigned dst_stride,
+                                           const float *src_row, unsigned src_stride,
+                                           unsigned width, unsigned height)
+{
+   bptc_rgb_float_pack_rgba_float(dst_row, dst_stride, src_row, src_stride,
+                                  width, height, true);
+}
+
+void
+util_format_bptc_rgb_float_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                                             unsigned i, unsigned j)
+{
+   bptc_rgb_float_fetch_rgba_8unorm(dst, src, i, j, true);
+}
+
+void
+util_format_bptc_rgb_float_fetch_rgba_float(float *dst, const uint8_t *src,
+                                            unsigned i, unsigned j)
+{
+   fetch_rgb_float_from_block(src, dst, i + j * BLOCK_SIZE, true);
+}
+
+void
+util_format_bptc_rgb_ufloat_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                               const uint8_t *src_row, unsigned src_stride,
+                                               unsigned width, unsigned height)
+{
+   bptc_rgb_float_unpack_rgba_8unorm(dst_row, dst_stride, src_row, src_stride,
+                                     width, height, false);
+}
+
+void
+util_format_bptc_rgb_ufloat_pack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                                             const uint8_t *src_row, unsigned src_stride,
+                                             unsigned width, unsigned height)
+{
+   bptc_rgb_float_pack_rgba_8unorm(dst_row, dst_stride, src_row, src_stride,
+                                   width, height, false);
+}
+
+void
+util_format_bptc_rgb_ufloat_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                                              const uint8_t *src_row, unsigned src_stride,
+                                              unsigned width, unsigned height)
+{
+   decompress_rgb_float(width, height,
+                        src_row, src_stride,
+                        dst_row, dst_stride,
+                        false);
+}
+
+void
+util_format_bptc_rgb_ufloat_pack_rgba_float(uint8_t *dst_row, unsigned dst_stride,
+                                            const float *src_row, unsigned src_stride,
+                                            unsigned width, unsigned height)
+{
+   bptc_rgb_float_pack_rgba_float(dst_row, dst_stride, src_row, src_stride,
+                                  width, height, false);
+}
+
+void
+util_format_bptc_rgb_ufloat_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                                              unsigned i, unsigned j)
+{
+   bptc_rgb_float_fetch_rgba_8unorm(dst, src, i, j, false);
+}
+
+void
+util_format_bptc_rgb_ufloat_fetch_rgba_float(float *dst, const uint8_t *src,
+                                             unsigned i, unsigned j)
+{
+   fetch_rgb_float_from_block(src, dst, i + j * BLOCK_SIZE, false);
+}
@@ -2,6 +2,7 @@
 #include "util/u_debug.h"
 #include "util/u_math.h"
 #include "u_format_etc.h"
+#include "util/format_srgb.h"
 
 /* define etc1_parse_block and etc. */
 #define UINT8_TYPE uint8_t
@@ -10,6 +11,9 @@
 #undef TAG
 #undef UINT8_TYPE
 
+/* define etc2_rgb8_parse_block and etc. */
+#include "../../../mesa/main/texcompress_etc2_tmp.h"
+
 void
 util_format_etc1_rgb8_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride, const uint8_t *src_row, unsigned src_stride, unsigned width, unsigned height)
 {
@@ -24,6 +28,18 @@ util_format_etc1_rgb8_pack_rgba_8unorm(UNUSED uint8_t *dst_row, UNUSED unsigned
    assert(0);
 }
 
+void
+util_format_etc1_rgb8_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src, unsigned i, unsigned j)
+{
+   struct etc1_block block;
+
+   assert(i < 4 && j < 4); /* check i, j against 4x4 block size */
+
+   etc1_parse_block(&block, src);
+   etc1_fetch_texel(&block, i, j, dst);
+   dst[3] = 255;
+}
+
 void
 util_format_etc1_rgb8_unpack_rgba_float(float *dst_row, unsigned dst_stride, const uint8_t *src_row, unsigned src_stride, unsigned width, unsigned height)
 {
@@ -82,3 +98,385 @@ util_format_etc1_rgb8_fetch_rgba_float(float *dst, const uint8_t *src, unsigned
    dst[2] = ubyte_to_float(tmp[2]);
    dst[3] = 1.0f;
 }
+
+
+/*
+ * ETC2 and EAC.
+ */
+
+/*
+ * The RGB(A) ETC2 formats only differ by how alpha is stored: not at all,
+ * as a punchthrough bit in the color block, or as a separate EAC block in
+ * front of the color block.
+ */
+static void
+etc2_rgba_parse_block(struct etc2_block *block, const uint8_t *src,
+                      bool punchthrough_alpha, bool eac_alpha)
+{
+   if (eac_alpha)
+      etc2_rgba8_parse_block(block, src);
+   else
+      etc2_rgb8_parse_block(block, src, punchthrough_alpha);
+}
+
+static void
+etc2_rgba_fetch_texel(const struct etc2_block *block, int x, int y,
+                      uint8_t *dst, bool punchthrough_alpha, bool eac_alpha)
+{
+   if (eac_alpha) {
+      etc2_rgba8_fetch_texel(block, x, y, dst);
+   }
+   else {
+      etc2_rgb8_fetch_texel(block, x, y, dst, punchthrough_alpha);
+      if (!punchthrough_alpha)
+         dst[3] = 255;
+   }
+}
+
+static void
+etc2_rgba_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                             const uint8_t *src_row, unsigned src_stride,
+                             unsigned width, unsigned height,
+                             bool punchthrough_alpha, bool eac_alpha,
+                             bool srgb)
+{
+   const unsigned bw = 4, bh = 4, bs = eac_alpha ? 16 : 8, comps = 4;
+   struct etc2_block block;
+   unsigned x, y, i, j;
+
+   for (y = 0; y < height; y += bh) {
+      const uint8_t *src = src_row;
+      const unsigned h = MIN2(bh, height - y);
+
+      for (x = 0; x < width; x += bw) {
+         const unsigned w = MIN2(bw, width - x);
+
+         etc2_rgba_parse_block(&block, src, punchthrough_alpha, eac_alpha);
+
+         for (j = 0; j < h; j++) {
+            uint8_t *dst = dst_row + (y + j) * dst_stride + x * comps;
+            for (i = 0; i < w; i++) {
+               etc2_rgba_fetch_texel(&block, i, j, dst,
+                                     punchthrough_alpha, eac_alpha);
+               if (srgb) {
+                  dst[0] = util_format_srgb_to_linear_8unorm(dst[0]);
+                  dst[1] = util_format_srgb_to_linear_8unorm(dst[1]);
+                  dst[2] = util_format_srgb_to_linear_8unorm(dst[2]);
+               }
+               dst += comps;
+            }
+         }
+
+         src += bs;
+      }
+
+      src_row += src_stride;
+   }
+}
+
+static void
+etc2_rgba_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                            const uint8_t *src_row, unsigned src_stride,
+                            unsigned width, unsigned height,
+                            bool punchthrough_alpha, bool eac_alpha,
+                            bool srgb)
+{
+   const unsigned bw = 4, bh = 4, bs = eac_alpha ? 16 : 8, comps = 4;
+   struct etc2_block block;
+   unsigned x, y, i, j;
+
+   for (y = 0; y < height; y += bh) {
+      const uint8_t *src = src_row;
+      const unsigned h = MIN2(bh, height - y);
+
+      for (x = 0; x < width; x += bw) {
+         const unsigned w = MIN2(bw, width - x);
+
+         etc2_rgba_parse_block(&block, src, punchthrough_alpha, eac_alpha);
+
+         for (j = 0; j < h; j++) {
+            float *dst = dst_row + (y + j) * dst_stride / sizeof(*dst_row) + x * comps;
+            uint8_t tmp[4];
+
+            for (i = 0; i < w; i++) {
+               etc2_rgba_fetch_texel(&block, i, j, tmp,
+                                     punchthrough_alpha, eac_alpha);
+               if (srgb) {
+                  dst[0] = util_format_srgb_8unorm_to_linear_float(tmp[0]);
+                  dst[1] = util_format_srgb_8unorm_to_linear_float(tmp[1]);
+                  dst[2] = util_format_srgb_8unorm_to_linear_float(tmp[2]);
+               }
+               else {
+                  dst[0] = ubyte_to_float(tmp[0]);
+                  dst[1] = ubyte_to_float(tmp[1]);
+                  dst[2] = ubyte_to_float(tmp[2]);
+               }
+               dst[3] = ubyte_to_float(tmp[3]);
+               dst += comps;
+            }
+         }
+
+         src += bs;
+      }
+
+      src_row += src_stride;
+   }
+}
+
+static void
+etc2_rgba_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                            unsigned i, unsigned j,
+                            bool punchthrough_alpha, bool eac_alpha,
+                            bool srgb)
+{
+   struct etc2_block block;
+
+   assert(i < 4 && j < 4); /* check i, j against 4x4 block size */
+
+   etc2_rgba_parse_block(&block, src, punchthrough_alpha, eac_alpha);
+   etc2_rgba_fetch_texel(&block, i, j, dst, punchthrough_alpha, eac_alpha);
+
+   if (srgb) {
+      dst[0] = util_format_srgb_to_linear_8unorm(dst[0]);
+      dst[1] = util_format_srgb_to_linear_8unorm(dst[1]);
+      dst[2] = util_format_srgb_to_linear_8unorm(dst[2]);
+   }
+}
+
+static void
+etc2_rgba_fetch_rgba_float(float *dst, const uint8_t *src,
+                           unsigned i, unsigned j,
+                           bool punchthrough_alpha, bool eac_alpha,
+                           bool srgb)
+{
+   struct etc2_block block;
+   uint8_t tmp[4];
+
+   assert(i < 4 && j < 4); /* check i, j against 4x4 block size */
+
+   etc2_rgba_parse_block(&block, src, punchthrough_alpha, eac_alpha);
+   etc2_rgba_fetch_texel(&block, i, j, tmp, punchthrough_alpha, eac_alpha);
+
+   if (srgb) {
+      dst[0] = util_format_srgb_8unorm_to_linear_float(tmp[0]);
+      dst[1] = util_format_srgb_8unorm_to_linear_float(tmp[1]);
+      dst[2] = util_format_srgb_8unorm_to_linear_float(tmp[2]);
+   }
+   else {
+      dst[0] = ubyte_to_float(tmp[0]);
+      dst[1] = ubyte_to_float(tmp[1]);
+      dst[2] = ubyte_to_float(tmp[2]);
+   }
+   dst[3] = ubyte_to_float(tmp[3]);
+}
+
+/*
+ * EAC R11 and RG11 decode to 16 bits per channel, which is then converted
+ * to the requested representation.
+ */
+static void
+eac_fetch_texel(const uint8_t *src, unsigned comps, bool is_signed,
+                int x, int y, int16_t *value)
+{
+   struct etc2_block block;
+   unsigned c;
+
+   for (c = 0; c < comps; c++) {
+      etc2_r11_parse_block(&block, src + c * 8);
+      if (is_signed)
+         etc2_signed_r11_fetch_texel(&block, x, y, (uint8_t *)&value[c]);
+      else
+         etc2_r11_fetch_texel(&block, x, y, (uint8_t *)&value[c]);
+   }
+}
+
+static inline float
+eac_to_float(int16_t value, bool is_signed)
+{
+   if (is_signed)
+      return MAX2(value * (1.0f / 32767.0f), -1.0f);
+   else
+      return (uint16_t)value * (1.0f / 65535.0f);
+}
+
+static inline uint8_t
+eac_to_ubyte(int16_t value, bool is_signed)
+{
+   if (is_signed)
+      return value > 0 ? value >> 7 : 0;
+   else
+      return (uint16_t)value >> 8;
+}
+
+static void
+eac_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride,
+                       const uint8_t *src_row, unsigned src_stride,
+                       unsigned width, unsigned height,
+                       unsigned comps, bool is_signed)
+{
+   const unsigned bw = 4, bh = 4, bs = 8 * comps;
+   unsigned x, y, i, j;
+
+   for (y = 0; y < height; y += bh) {
+      const uint8_t *src = src_row;
+      const unsigned h = MIN2(bh, height - y);
+
+      for (x = 0; x < width; x += bw) {
+         const unsigned w = MIN2(bw, width - x);
+
+         for (j = 0; j < h; j++) {
+            uint8_t *dst = dst_row + (y + j) * dst_stride + x * 4;
+            for (i = 0; i < w; i++) {
+               int16_t value[2] = { 0, 0 };
+
+               eac_fetch_texel(src, comps, is_signed, i, j, value);
+               dst[0] = eac_to_ubyte(value[0], is_signed);
+               dst[1] = comps > 1 ? eac_to_ubyte(value[1], is_signed) : 0;
+               dst[2] = 0;
+               dst[3] = 255;
+               dst += 4;
+            }
+         }
+
+         src += bs;
+      }
+
+      src_row += src_stride;
+   }
+}
+
+static void
+eac_unpack_rgba_float(float *dst_row, unsigned dst_stride,
+                      const uint8_t *src_row, unsigned src_stride,
+                      unsigned width, unsigned height,
+                      unsigned comps, bool is_signed)
+{
+   const unsigned bw = 4, bh = 4, bs = 8 * comps;
+   unsigned x, y, i, j;
+
+   for (y = 0; y < height; y += bh) {
+      const uint8_t *src = src_row;
+      const unsigned h = MIN2(bh, height - y);
+
+      for (x = 0; x < width; x += bw) {
+         const unsigned w = MIN2(bw, width - x);
+
+         for (j = 0; j < h; j++) {
+            float *dst = dst_row + (y + j) * dst_stride / sizeof(*dst_row) + x * 4;
+            for (i = 0; i < w; i++) {
+               int16_t value[2] = { 0, 0 };
+
+               eac_fetch_texel(src, comps, is_signed, i, j, value);
+               dst[0] = eac_to_float(value[0], is_signed);
+               dst[1] = comps > 1 ? eac_to_float(value[1], is_signed) : 0.0f;
+               dst[2] = 0.0f;
+               dst[3] = 1.0f;
+               dst += 4;
+            }
+         }
+
+         src += bs;
+      }
+
+      src_row += src_stride;
+   }
+}
+
+static void
+eac_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,
+                      unsigned i, unsigned j,
+                      unsigned comps, bool is_signed)
+{
+   int16_t value[2] = { 0, 0 };
+
+   assert(i < 4 && j < 4); /* check i, j against 4x4 block size */
+
+   eac_fetch_texel(src, comps, is_signed, i, j, value);
+   dst[0] = eac_to_ubyte(value[0], is_signed);
+   dst[1] = comps > 1 ? eac_to_ubyte(value[1], is_signed) : 0;
+   dst[2] = 0;
+   dst[3] = 255;
+}
+
+static void
+eac_fetch_rgba_float(float *dst, const uint8_t *src,
+                     unsigned i, unsigned j,
+                     unsigned comps, bool is_signed)
+{
+   int16_t value[2] = { 0, 0 };
+
+   assert(i < 4 && j < 4); /* check i, j against 4x4 block size */
+
+   eac_fetch_texel(src, comps, is_signed, i, j, value);
+   dst[0] = eac_to_float(value[0], is_signed);
+   dst[1] = comps > 1 ? eac_to_float(value[1], is_signed) : 0.0f;
+   dst[2] = 0.0f;
+   dst[3] = 1.0f;
+}
+
+/*
+ * There is no ETC2 encoder, these formats can only be uploaded
+ * pre-compressed (like ETC1).
+ */
+#define ETC2_FORMAT_FUNCS(name, kind, ...)                                    \
+void                                                                          \
+util_format_##name##_unpack_rgba_8unorm(uint8_t *dst_row, unsigned dst_stride, \
+                                        const uint8_t *src_row, unsigned src_stride, \
+                                        unsigned width, unsigned height)      \
+{                                                                             \
+   kind##_unpack_rgba_8unorm(dst_row, dst_stride, src_row, src_stride,        \
+                             width, height, __VA_ARGS__);                     \
+}                                                                             \
+                                                                              \
+void                                                                          \
+util_format_##name##_pack_rgba_8unorm(UNUSED uint8_t *dst_row, UNUSED unsigned dst_stride, \
+                                      UNUSED const uint8_t *src_row, UNUSED unsigned src_stride, \
+                                      UNUSED unsigned width, UNUSED unsigned height) \
+{                                                                             \
+   assert(0);                                                                 \
+}                                                                             \
+                                                                              \
+void                                                                          \
+util_format_##name##_unpack_rgba_float(float *dst_row, unsigned dst_stride,   \
+                                       const uint8_t *src_row, unsigned src_stride, \
+                                       unsigned width, unsigned height)       \
+{                                                                             \
+   kind##_unpack_rgba_float(dst_row, dst_stride, src_row, src_stride,         \
+                            width, height, __VA_ARGS__);                      \
+}                                                                             \
+                                                                              \
+void                                                                          \
+util_format_##name##_pack_rgba_float(UNUSED uint8_t *dst_row, UNUSED unsigned dst_stride, \
+                                     UNUSED const float *src_row, UNUSED unsigned src_stride, \
+                                     UNUSED unsigned width, UNUSED unsigned height) \
+{                                                                             \
+   assert(0);                                                                 \
+}                                                                             \
+                                                                              \
+void                                                                          \
+util_format_##name##_fetch_rgba_8unorm(uint8_t *dst, const uint8_t *src,      \
+                                       unsigned i, unsigned j)                \
+{                                                                             \
+   kind##_fetch_rgba_8unorm(dst, src, i, j, __VA_ARGS__);                     \
+}                                                                             \
+                                                                              \
+void                                                                          \
+util_format_##name##_fetch_rgba_float(float *dst, const uint8_t *src,         \
+                                      unsigned i, unsigned j)                 \
+{                                                                             \
+   kind##_fetch_rgba_float(dst, src, i, j, __VA_ARGS__);                      \
+}
+
+/*                name           kind       punchthrough eac_alpha srgb */
+ETC2_FORMAT_FUNCS(etc2_rgb8,     etc2_rgba, false,       false,    false)
+ETC2_FORMAT_FUNCS(etc2_srgb8,    etc2_rgba, false,       false,    true)
+ETC2_FORMAT_FUNCS(etc2_rgb8a1,   etc2_rgba, true,        false,    false)
+ETC2_FORMAT_FUNCS(etc2_srgb8a1,  etc2_rgba, true,        false,    true)
+ETC2_FORMAT_FUNCS(etc2_rgba8,    etc2_rgba, false,       true,     false)
+ETC2_FORMAT_FUNCS(etc2_srgba8,   etc2_rgba, false,       true,     true)
+
+/*                name            kind comps is_signed */
+ETC2_FORMAT_FUNCS(etc2_r11_unorm,  eac, 1,   false)
+ETC2_FORMAT_FUNCS(etc2_r11_snorm,  eac, 1,   true)
+ETC2_FORMAT_FUNCS(etc2_rg11_unorm, eac, 2,   false)
+ETC2_FORMAT_FUNCS(etc2_rg11_snorm, eac, 2,   true)
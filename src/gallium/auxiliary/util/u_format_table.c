@@ -32,6 +32,8 @@
 #include "u_format_rgtc.h"
 #include "u_format_latc.h"
 #include "u_format_etc.h"
+#include "u_format_bptc.h"
+#include "u_format_astc.h"
 
 
 #include "pipe/p_compiler.h"
@@ -38281,7 +38283,7 @@ util_format_etc1_rgb8_description = {
    UTIL_FORMAT_COLORSPACE_RGB,
    &util_format_etc1_rgb8_unpack_rgba_8unorm,
    &util_format_etc1_rgb8_pack_rgba_8unorm,
-   NULL, /* fetch_rgba_8unorm */
+   &util_format_etc1_rgb8_fetch_rgba_8unorm,
    &util_format_etc1_rgb8_unpack_rgba_float,
    &util_format_etc1_rgb8_pack_rgba_float,
    &util_format_etc1_rgb8_fetch_rgba_float,
@@ -38323,12 +38325,12 @@ util_format_etc2_rgb8_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_rgb8_unpack_rgba_8unorm,
+   &util_format_etc2_rgb8_pack_rgba_8unorm,
+   &util_format_etc2_rgb8_fetch_rgba_8unorm,
+   &util_format_etc2_rgb8_unpack_rgba_float,
+   &util_format_etc2_rgb8_pack_rgba_float,
+   &util_format_etc2_rgb8_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38367,12 +38369,12 @@ util_format_etc2_srgb8_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_srgb8_unpack_rgba_8unorm,
+   &util_format_etc2_srgb8_pack_rgba_8unorm,
+   &util_format_etc2_srgb8_fetch_rgba_8unorm,
+   &util_format_etc2_srgb8_unpack_rgba_float,
+   &util_format_etc2_srgb8_pack_rgba_float,
+   &util_format_etc2_srgb8_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38411,12 +38413,12 @@ util_format_etc2_rgb8a1_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_rgb8a1_unpack_rgba_8unorm,
+   &util_format_etc2_rgb8a1_pack_rgba_8unorm,
+   &util_format_etc2_rgb8a1_fetch_rgba_8unorm,
+   &util_format_etc2_rgb8a1_unpack_rgba_float,
+   &util_format_etc2_rgb8a1_pack_rgba_float,
+   &util_format_etc2_rgb8a1_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38455,12 +38457,12 @@ util_format_etc2_srgb8a1_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_srgb8a1_unpack_rgba_8unorm,
+   &util_format_etc2_srgb8a1_pack_rgba_8unorm,
+   &util_format_etc2_srgb8a1_fetch_rgba_8unorm,
+   &util_format_etc2_srgb8a1_unpack_rgba_float,
+   &util_format_etc2_srgb8a1_pack_rgba_float,
+   &util_format_etc2_srgb8a1_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38499,12 +38501,12 @@ util_format_etc2_rgba8_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_rgba8_unpack_rgba_8unorm,
+   &util_format_etc2_rgba8_pack_rgba_8unorm,
+   &util_format_etc2_rgba8_fetch_rgba_8unorm,
+   &util_format_etc2_rgba8_unpack_rgba_float,
+   &util_format_etc2_rgba8_pack_rgba_float,
+   &util_format_etc2_rgba8_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38543,12 +38545,12 @@ util_format_etc2_srgba8_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_srgba8_unpack_rgba_8unorm,
+   &util_format_etc2_srgba8_pack_rgba_8unorm,
+   &util_format_etc2_srgba8_fetch_rgba_8unorm,
+   &util_format_etc2_srgba8_unpack_rgba_float,
+   &util_format_etc2_srgba8_pack_rgba_float,
+   &util_format_etc2_srgba8_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38587,12 +38589,12 @@ util_format_etc2_r11_unorm_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_r11_unorm_unpack_rgba_8unorm,
+   &util_format_etc2_r11_unorm_pack_rgba_8unorm,
+   &util_format_etc2_r11_unorm_fetch_rgba_8unorm,
+   &util_format_etc2_r11_unorm_unpack_rgba_float,
+   &util_format_etc2_r11_unorm_pack_rgba_float,
+   &util_format_etc2_r11_unorm_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38631,12 +38633,12 @@ util_format_etc2_r11_snorm_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_r11_snorm_unpack_rgba_8unorm,
+   &util_format_etc2_r11_snorm_pack_rgba_8unorm,
+   &util_format_etc2_r11_snorm_fetch_rgba_8unorm,
+   &util_format_etc2_r11_snorm_unpack_rgba_float,
+   &util_format_etc2_r11_snorm_pack_rgba_float,
+   &util_format_etc2_r11_snorm_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38675,12 +38677,12 @@ util_format_etc2_rg11_unorm_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_rg11_unorm_unpack_rgba_8unorm,
+   &util_format_etc2_rg11_unorm_pack_rgba_8unorm,
+   &util_format_etc2_rg11_unorm_fetch_rgba_8unorm,
+   &util_format_etc2_rg11_unorm_unpack_rgba_float,
+   &util_format_etc2_rg11_unorm_pack_rgba_float,
+   &util_format_etc2_rg11_unorm_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38719,12 +38721,12 @@ util_format_etc2_rg11_snorm_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_etc2_rg11_snorm_unpack_rgba_8unorm,
+   &util_format_etc2_rg11_snorm_pack_rgba_8unorm,
+   &util_format_etc2_rg11_snorm_fetch_rgba_8unorm,
+   &util_format_etc2_rg11_snorm_unpack_rgba_float,
+   &util_format_etc2_rg11_snorm_pack_rgba_float,
+   &util_format_etc2_rg11_snorm_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38763,12 +38765,12 @@ util_format_bptc_rgba_unorm_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_bptc_rgba_unorm_unpack_rgba_8unorm,
+   &util_format_bptc_rgba_unorm_pack_rgba_8unorm,
+   &util_format_bptc_rgba_unorm_fetch_rgba_8unorm,
+   &util_format_bptc_rgba_unorm_unpack_rgba_float,
+   &util_format_bptc_rgba_unorm_pack_rgba_float,
+   &util_format_bptc_rgba_unorm_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38807,12 +38809,12 @@ util_format_bptc_srgba_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_bptc_srgba_unpack_rgba_8unorm,
+   &util_format_bptc_srgba_pack_rgba_8unorm,
+   &util_format_bptc_srgba_fetch_rgba_8unorm,
+   &util_format_bptc_srgba_unpack_rgba_float,
+   &util_format_bptc_srgba_pack_rgba_float,
+   &util_format_bptc_srgba_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38851,12 +38853,12 @@ util_format_bptc_rgb_float_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_bptc_rgb_float_unpack_rgba_8unorm,
+   &util_format_bptc_rgb_float_pack_rgba_8unorm,
+   &util_format_bptc_rgb_float_fetch_rgba_8unorm,
+   &util_format_bptc_rgb_float_unpack_rgba_float,
+   &util_format_bptc_rgb_float_pack_rgba_float,
+   &util_format_bptc_rgb_float_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38895,12 +38897,12 @@ util_format_bptc_rgb_ufloat_description = {
       PIPE_SWIZZLE_1	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_bptc_rgb_ufloat_unpack_rgba_8unorm,
+   &util_format_bptc_rgb_ufloat_pack_rgba_8unorm,
+   &util_format_bptc_rgb_ufloat_fetch_rgba_8unorm,
+   &util_format_bptc_rgb_ufloat_unpack_rgba_float,
+   &util_format_bptc_rgb_ufloat_pack_rgba_float,
+   &util_format_bptc_rgb_ufloat_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38939,12 +38941,12 @@ util_format_astc_4x4_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_4x4_unpack_rgba_8unorm,
+   &util_format_astc_4x4_pack_rgba_8unorm,
+   &util_format_astc_4x4_fetch_rgba_8unorm,
+   &util_format_astc_4x4_unpack_rgba_float,
+   &util_format_astc_4x4_pack_rgba_float,
+   &util_format_astc_4x4_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -38983,12 +38985,12 @@ util_format_astc_5x4_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_5x4_unpack_rgba_8unorm,
+   &util_format_astc_5x4_pack_rgba_8unorm,
+   &util_format_astc_5x4_fetch_rgba_8unorm,
+   &util_format_astc_5x4_unpack_rgba_float,
+   &util_format_astc_5x4_pack_rgba_float,
+   &util_format_astc_5x4_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39027,12 +39029,12 @@ util_format_astc_5x5_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_5x5_unpack_rgba_8unorm,
+   &util_format_astc_5x5_pack_rgba_8unorm,
+   &util_format_astc_5x5_fetch_rgba_8unorm,
+   &util_format_astc_5x5_unpack_rgba_float,
+   &util_format_astc_5x5_pack_rgba_float,
+   &util_format_astc_5x5_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39071,12 +39073,12 @@ util_format_astc_6x5_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_6x5_unpack_rgba_8unorm,
+   &util_format_astc_6x5_pack_rgba_8unorm,
+   &util_format_astc_6x5_fetch_rgba_8unorm,
+   &util_format_astc_6x5_unpack_rgba_float,
+   &util_format_astc_6x5_pack_rgba_float,
+   &util_format_astc_6x5_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39115,12 +39117,12 @@ util_format_astc_6x6_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_6x6_unpack_rgba_8unorm,
+   &util_format_astc_6x6_pack_rgba_8unorm,
+   &util_format_astc_6x6_fetch_rgba_8unorm,
+   &util_format_astc_6x6_unpack_rgba_float,
+   &util_format_astc_6x6_pack_rgba_float,
+   &util_format_astc_6x6_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39159,12 +39161,12 @@ util_format_astc_8x5_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_8x5_unpack_rgba_8unorm,
+   &util_format_astc_8x5_pack_rgba_8unorm,
+   &util_format_astc_8x5_fetch_rgba_8unorm,
+   &util_format_astc_8x5_unpack_rgba_float,
+   &util_format_astc_8x5_pack_rgba_float,
+   &util_format_astc_8x5_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39203,12 +39205,12 @@ util_format_astc_8x6_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_8x6_unpack_rgba_8unorm,
+   &util_format_astc_8x6_pack_rgba_8unorm,
+   &util_format_astc_8x6_fetch_rgba_8unorm,
+   &util_format_astc_8x6_unpack_rgba_float,
+   &util_format_astc_8x6_pack_rgba_float,
+   &util_format_astc_8x6_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39247,12 +39249,12 @@ util_format_astc_8x8_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_8x8_unpack_rgba_8unorm,
+   &util_format_astc_8x8_pack_rgba_8unorm,
+   &util_format_astc_8x8_fetch_rgba_8unorm,
+   &util_format_astc_8x8_unpack_rgba_float,
+   &util_format_astc_8x8_pack_rgba_float,
+   &util_format_astc_8x8_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39291,12 +39293,12 @@ util_format_astc_10x5_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x5_unpack_rgba_8unorm,
+   &util_format_astc_10x5_pack_rgba_8unorm,
+   &util_format_astc_10x5_fetch_rgba_8unorm,
+   &util_format_astc_10x5_unpack_rgba_float,
+   &util_format_astc_10x5_pack_rgba_float,
+   &util_format_astc_10x5_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39335,12 +39337,12 @@ util_format_astc_10x6_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x6_unpack_rgba_8unorm,
+   &util_format_astc_10x6_pack_rgba_8unorm,
+   &util_format_astc_10x6_fetch_rgba_8unorm,
+   &util_format_astc_10x6_unpack_rgba_float,
+   &util_format_astc_10x6_pack_rgba_float,
+   &util_format_astc_10x6_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39379,12 +39381,12 @@ util_format_astc_10x8_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x8_unpack_rgba_8unorm,
+   &util_format_astc_10x8_pack_rgba_8unorm,
+   &util_format_astc_10x8_fetch_rgba_8unorm,
+   &util_format_astc_10x8_unpack_rgba_float,
+   &util_format_astc_10x8_pack_rgba_float,
+   &util_format_astc_10x8_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39423,12 +39425,12 @@ util_format_astc_10x10_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x10_unpack_rgba_8unorm,
+   &util_format_astc_10x10_pack_rgba_8unorm,
+   &util_format_astc_10x10_fetch_rgba_8unorm,
+   &util_format_astc_10x10_unpack_rgba_float,
+   &util_format_astc_10x10_pack_rgba_float,
+   &util_format_astc_10x10_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39467,12 +39469,12 @@ util_format_astc_12x10_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_12x10_unpack_rgba_8unorm,
+   &util_format_astc_12x10_pack_rgba_8unorm,
+   &util_format_astc_12x10_fetch_rgba_8unorm,
+   &util_format_astc_12x10_unpack_rgba_float,
+   &util_format_astc_12x10_pack_rgba_float,
+   &util_format_astc_12x10_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39511,12 +39513,12 @@ util_format_astc_12x12_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_RGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_12x12_unpack_rgba_8unorm,
+   &util_format_astc_12x12_pack_rgba_8unorm,
+   &util_format_astc_12x12_fetch_rgba_8unorm,
+   &util_format_astc_12x12_unpack_rgba_float,
+   &util_format_astc_12x12_pack_rgba_float,
+   &util_format_astc_12x12_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39555,12 +39557,12 @@ util_format_astc_4x4_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_4x4_srgb_unpack_rgba_8unorm,
+   &util_format_astc_4x4_srgb_pack_rgba_8unorm,
+   &util_format_astc_4x4_srgb_fetch_rgba_8unorm,
+   &util_format_astc_4x4_srgb_unpack_rgba_float,
+   &util_format_astc_4x4_srgb_pack_rgba_float,
+   &util_format_astc_4x4_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39599,12 +39601,12 @@ util_format_astc_5x4_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_5x4_srgb_unpack_rgba_8unorm,
+   &util_format_astc_5x4_srgb_pack_rgba_8unorm,
+   &util_format_astc_5x4_srgb_fetch_rgba_8unorm,
+   &util_format_astc_5x4_srgb_unpack_rgba_float,
+   &util_format_astc_5x4_srgb_pack_rgba_float,
+   &util_format_astc_5x4_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39643,12 +39645,12 @@ util_format_astc_5x5_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_5x5_srgb_unpack_rgba_8unorm,
+   &util_format_astc_5x5_srgb_pack_rgba_8unorm,
+   &util_format_astc_5x5_srgb_fetch_rgba_8unorm,
+   &util_format_astc_5x5_srgb_unpack_rgba_float,
+   &util_format_astc_5x5_srgb_pack_rgba_float,
+   &util_format_astc_5x5_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39687,12 +39689,12 @@ util_format_astc_6x5_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_6x5_srgb_unpack_rgba_8unorm,
+   &util_format_astc_6x5_srgb_pack_rgba_8unorm,
+   &util_format_astc_6x5_srgb_fetch_rgba_8unorm,
+   &util_format_astc_6x5_srgb_unpack_rgba_float,
+   &util_format_astc_6x5_srgb_pack_rgba_float,
+   &util_format_astc_6x5_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39731,12 +39733,12 @@ util_format_astc_6x6_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_6x6_srgb_unpack_rgba_8unorm,
+   &util_format_astc_6x6_srgb_pack_rgba_8unorm,
+   &util_format_astc_6x6_srgb_fetch_rgba_8unorm,
+   &util_format_astc_6x6_srgb_unpack_rgba_float,
+   &util_format_astc_6x6_srgb_pack_rgba_float,
+   &util_format_astc_6x6_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39775,12 +39777,12 @@ util_format_astc_8x5_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_8x5_srgb_unpack_rgba_8unorm,
+   &util_format_astc_8x5_srgb_pack_rgba_8unorm,
+   &util_format_astc_8x5_srgb_fetch_rgba_8unorm,
+   &util_format_astc_8x5_srgb_unpack_rgba_float,
+   &util_format_astc_8x5_srgb_pack_rgba_float,
+   &util_format_astc_8x5_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39819,12 +39821,12 @@ util_format_astc_8x6_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_8x6_srgb_unpack_rgba_8unorm,
+   &util_format_astc_8x6_srgb_pack_rgba_8unorm,
+   &util_format_astc_8x6_srgb_fetch_rgba_8unorm,
+   &util_format_astc_8x6_srgb_unpack_rgba_float,
+   &util_format_astc_8x6_srgb_pack_rgba_float,
+   &util_format_astc_8x6_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39863,12 +39865,12 @@ util_format_astc_8x8_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_8x8_srgb_unpack_rgba_8unorm,
+   &util_format_astc_8x8_srgb_pack_rgba_8unorm,
+   &util_format_astc_8x8_srgb_fetch_rgba_8unorm,
+   &util_format_astc_8x8_srgb_unpack_rgba_float,
+   &util_format_astc_8x8_srgb_pack_rgba_float,
+   &util_format_astc_8x8_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39907,12 +39909,12 @@ util_format_astc_10x5_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x5_srgb_unpack_rgba_8unorm,
+   &util_format_astc_10x5_srgb_pack_rgba_8unorm,
+   &util_format_astc_10x5_srgb_fetch_rgba_8unorm,
+   &util_format_astc_10x5_srgb_unpack_rgba_float,
+   &util_format_astc_10x5_srgb_pack_rgba_float,
+   &util_format_astc_10x5_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39951,12 +39953,12 @@ util_format_astc_10x6_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x6_srgb_unpack_rgba_8unorm,
+   &util_format_astc_10x6_srgb_pack_rgba_8unorm,
+   &util_format_astc_10x6_srgb_fetch_rgba_8unorm,
+   &util_format_astc_10x6_srgb_unpack_rgba_float,
+   &util_format_astc_10x6_srgb_pack_rgba_float,
+   &util_format_astc_10x6_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -39995,12 +39997,12 @@ util_format_astc_10x8_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x8_srgb_unpack_rgba_8unorm,
+   &util_format_astc_10x8_srgb_pack_rgba_8unorm,
+   &util_format_astc_10x8_srgb_fetch_rgba_8unorm,
+   &util_format_astc_10x8_srgb_unpack_rgba_float,
+   &util_format_astc_10x8_srgb_pack_rgba_float,
+   &util_format_astc_10x8_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -40039,12 +40041,12 @@ util_format_astc_10x10_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_10x10_srgb_unpack_rgba_8unorm,
+   &util_format_astc_10x10_srgb_pack_rgba_8unorm,
+   &util_format_astc_10x10_srgb_fetch_rgba_8unorm,
+   &util_format_astc_10x10_srgb_unpack_rgba_float,
+   &util_format_astc_10x10_srgb_pack_rgba_float,
+   &util_format_astc_10x10_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -40083,12 +40085,12 @@ util_format_astc_12x10_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_12x10_srgb_unpack_rgba_8unorm,
+   &util_format_astc_12x10_srgb_pack_rgba_8unorm,
+   &util_format_astc_12x10_srgb_fetch_rgba_8unorm,
+   &util_format_astc_12x10_srgb_unpack_rgba_float,
+   &util_format_astc_12x10_srgb_pack_rgba_float,
+   &util_format_astc_12x10_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -40127,12 +40129,12 @@ util_format_astc_12x12_srgb_description = {
       PIPE_SWIZZLE_W	/* a */
    },
    UTIL_FORMAT_COLORSPACE_SRGB,
-   NULL, /* unpack_rgba_8unorm */
-   NULL, /* pack_rgba_8unorm */
-   NULL, /* fetch_rgba_8unorm */
-   NULL, /* unpack_rgba_float */
-   NULL, /* pack_rgba_float */
-   NULL, /* fetch_rgba_float */
+   &util_format_astc_12x12_srgb_unpack_rgba_8unorm,
+   &util_format_astc_12x12_srgb_pack_rgba_8unorm,
+   &util_format_astc_12x12_srgb_fetch_rgba_8unorm,
+   &util_format_astc_12x12_srgb_unpack_rgba_float,
+   &util_format_astc_12x12_srgb_pack_rgba_float,
+   &util_format_astc_12x12_srgb_fetch_rgba_float,
    NULL, /* unpack_z_32unorm */
    NULL, /* pack_z_32unorm */
    NULL, /* unpack_z_float */
@@ -2062,6 +2062,90 @@ tc_draw_vbo(struct pipe_context *_pipe, const struct pipe_draw_info *info)
    }
 }
 
+/* Keep multi_draw calls well below the size of a batch. */
+#define TC_MAX_MULTI_DRAWS 128
+
+struct tc_multi_draw {
+   struct pipe_draw_info info;
+   unsigned num_draws;
+   struct pipe_draw_start_count slot[0]; /* more will be allocated if needed */
+};
+
+static void
+tc_call_multi_draw(struct pipe_context *pipe, union tc_payload *payload)
+{
+   struct tc_multi_draw *p = (struct tc_multi_draw *)payload;
+
+   pipe->multi_draw(pipe, &p->info, p->slot, p->num_draws);
+   if (p->info.index_size)
+      pipe_resource_reference(&p->info.index.resource, NULL);
+}
+
+static void
+tc_multi_draw(struct pipe_context *_pipe, const struct pipe_draw_info *info,
+              const struct pipe_draw_start_count *draws, unsigned num_draws)
+{
+   struct threaded_context *tc = threaded_context(_pipe);
+   unsigned index_size = info->index_size;
+
+   tc_assert(!info->indirect);
+   tc_assert(!info->count_from_stream_output);
+
+   for (unsigned drawid = info->drawid; num_draws;) {
+      unsigned n = MIN2(num_draws, TC_MAX_MULTI_DRAWS);
+      struct pipe_resource *buffer = NULL;
+      unsigned first = ~0u, end = 0, offset = 0;
+
+      if (index_size && info->has_user_indices) {
+         /* Upload the indices used by all the draws at once. */
+         for (unsigned i = 0; i < n; i++) {
+            if (!draws[i].count)
+               continue;
+            first = MIN2(first, draws[i].start);
+            end = MAX2(end, draws[i].start + draws[i].count);
+         }
+         if (first < end) {
+            u_upload_data(tc->base.stream_uploader, 0,
+                          (end - first) * index_size, 4,
+                          (const uint8_t *)info->index.user +
+                          first * index_size, &offset, &buffer);
+            if (unlikely(!buffer))
+               return;
+         } else {
+            /* Nothing to draw in this chunk. */
+            draws += n;
+            num_draws -= n;
+            drawid += n;
+            continue;
+         }
+      }
+
+      struct tc_multi_draw *p =
+         tc_add_slot_based_call(tc, TC_CALL_multi_draw, tc_multi_draw, n);
+      memcpy(&p->info, info, sizeof(*info));
+      p->info.drawid = drawid;
+      p->num_draws = n;
+      memcpy(p->slot, draws, n * sizeof(draws[0]));
+
+      if (index_size) {
+         if (info->has_user_indices) {
+            p->info.has_user_indices = false;
+            p->info.index.resource = buffer;
+            for (unsigned i = 0; i < n; i++)
+               p->slot[i].start += offset / index_size - first;
+         } else {
+            p->info.index.resource = NULL;
+            tc_set_resource_reference(&p->info.index.resource,
+                                      info->index.resource);
+         }
+      }
+
+      draws += n;
+      num_draws -= n;
+      drawid += n;
+   }
+}
+
 static void
 tc_call_launch_grid(struct pipe_context *pipe, union tc_payload *payload)
 {
@@ -2564,6 +2648,7 @@ threaded_context_create(struct pipe_context *pipe,
 
    CTX_INIT(flush);
    CTX_INIT(draw_vbo);
+   CTX_INIT(multi_draw);
    CTX_INIT(launch_grid);
    CTX_INIT(resource_copy_region);
    CTX_INIT(blit);
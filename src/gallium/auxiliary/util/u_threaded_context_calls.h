@@ -25,6 +25,7 @@ CALL(buffer_subdata)
 CALL(texture_subdata)
 CALL(emit_string_marker)
 CALL(draw_vbo)
+CALL(multi_draw)
 CALL(launch_grid)
 CALL(resource_copy_region)
 CALL(blit)
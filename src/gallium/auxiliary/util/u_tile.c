@@ -442,12 +442,40 @@ pipe_get_tile_rgba_format(struct pipe_transfer *pt,
                           float *p)
 {
    unsigned dst_stride = w * 4;
+   unsigned bw = util_format_get_blockwidth(format);
+   unsigned bh = util_format_get_blockheight(format);
    void *packed;
 
    if (u_clip_tile(x, y, &w, &h, &pt->box)) {
       return;
    }
 
+   /*
+    * Tiles of compressed formats whose block size doesn't divide the tile
+    * size (e.g. ASTC 5x5) may start in the middle of a block. Decode the
+    * enclosing blocks and copy out the requested texels.
+    */
+   if (x % bw || y % bh) {
+      unsigned dx = x % bw, dy = y % bh;
+      unsigned tw = w + dx, th = h + dy;
+      unsigned row;
+      float *tmp = MALLOC(tw * th * 4 * sizeof(float));
+
+      if (!tmp) {
+         return;
+      }
+
+      pipe_get_tile_rgba_format(pt, src, x - dx, y - dy, tw, th, format, tmp);
+
+      for (row = 0; row < h; row++) {
+         memcpy(p + row * dst_stride, tmp + ((row + dy) * tw + dx) * 4,
+                w * 4 * sizeof(float));
+      }
+
+      FREE(tmp);
+      return;
+   }
+
    packed = MALLOC(util_format_get_nblocks(format, w, h) * util_format_get_blocksize(format));
    if (!packed) {
       return;
@@ -0,0 +1,172 @@
+/**************************************************************************
+ *
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+
+#include "util/u_atomic.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "util/u_queue.h"
+
+#include "lp_cs_tpool.h"
+#include "lp_limits.h"
+
+
+struct lp_cs_tpool_job
+{
+   struct lp_cs_tpool *pool;
+   struct util_queue_fence fence;
+};
+
+
+struct lp_cs_tpool
+{
+   struct util_queue queue;
+   unsigned num_threads;
+
+   /* The dispatch in progress */
+   lp_cs_tpool_task_func work;
+   void *data;
+   unsigned num_iters;
+   unsigned next_iter;
+
+   struct lp_cs_tpool_job jobs[LP_MAX_THREADS];
+
+   /* One per worker thread, plus one for the calling thread */
+   struct lp_cs_local_mem local[LP_MAX_THREADS + 1];
+};
+
+
+/**
+ * Run iterations until there are none left.
+ */
+static void
+lp_cs_tpool_work(struct lp_cs_tpool *pool, struct lp_cs_local_mem *lmem)
+{
+   unsigned iter;
+
+   while ((iter = p_atomic_inc_return(&pool->next_iter) - 1) <
+          pool->num_iters) {
+      pool->work(pool->data, iter, lmem);
+   }
+}
+
+
+static void
+lp_cs_tpool_execute(void *data, int thread_index)
+{
+   struct lp_cs_tpool_job *job = (struct lp_cs_tpool_job *) data;
+
+   lp_cs_tpool_work(job->pool, &job->pool->local[thread_index]);
+}
+
+
+/**
+ * Create a pool with the given number of worker threads.  With none, all
+ * the work happens on the calling thread.
+ */
+struct lp_cs_tpool *
+lp_cs_tpool_create(unsigned num_threads)
+{
+   struct lp_cs_tpool *pool;
+   unsigned i;
+
+   pool = CALLOC_STRUCT(lp_cs_tpool);
+   if (!pool)
+      return NULL;
+
+   num_threads = MIN2(num_threads, LP_MAX_THREADS);
+
+   if (num_threads &&
+       !util_queue_init(&pool->queue, "llvmpipe_cs", num_threads,
+                        num_threads, 0)) {
+      num_threads = 0;
+   }
+   pool->num_threads = num_threads;
+
+   for (i = 0; i < num_threads; i++) {
+      pool->jobs[i].pool = pool;
+      util_queue_fence_init(&pool->jobs[i].fence);
+   }
+
+   return pool;
+}
+
+
+void
+lp_cs_tpool_destroy(struct lp_cs_tpool *pool)
+{
+   unsigned i;
+
+   if (!pool)
+      return;
+
+   if (pool->num_threads) {
+      util_queue_destroy(&pool->queue);
+      for (i = 0; i < pool->num_threads; i++)
+         util_queue_fence_destroy(&pool->jobs[i].fence);
+   }
+
+   for (i = 0; i < ARRAY_SIZE(pool->local); i++) {
+      align_free(pool->local[i].shared);
+      FREE(pool->local[i].stacks);
+   }
+
+   FREE(pool);
+}
+
+
+/**
+ * Call work(data, i, lmem) for i in [0, num_iters), spread over the
+ * worker threads and the calling thread, and wait for all the calls to
+ * finish.  Not reentrant.
+ */
+void
+lp_cs_tpool_run(struct lp_cs_tpool *pool,
+                lp_cs_tpool_task_func work,
+                void *data,
+                unsigned num_iters)
+{
+   unsigned num_jobs, i;
+
+   pool->work = work;
+   pool->data = data;
+   pool->num_iters = num_iters;
+   pool->next_iter = 0;
+
+   num_jobs = num_iters ? MIN2(pool->num_threads, num_iters - 1) : 0;
+
+   for (i = 0; i < num_jobs; i++) {
+      util_queue_add_job(&pool->queue, &pool->jobs[i],
+                         &pool->jobs[i].fence,
+                         lp_cs_tpool_execute, NULL);
+   }
+
+   lp_cs_tpool_work(pool, &pool->local[pool->num_threads]);
+
+   for (i = 0; i < num_jobs; i++)
+      util_queue_fence_wait(&pool->jobs[i].fence);
+}
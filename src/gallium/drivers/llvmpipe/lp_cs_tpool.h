@@ -0,0 +1,78 @@
+/**************************************************************************
+ *
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * Thread pool running compute shader workgroups.
+ *
+ * Workgroups are independent of each other, so they are simply handed out
+ * one at a time to the worker threads and the calling thread until none
+ * are left.  Each thread has some memory of its own which is kept around
+ * between dispatches, for the workgroup's shared memory and the like.
+ */
+
+#ifndef LP_CS_TPOOL_H
+#define LP_CS_TPOOL_H
+
+
+#include "pipe/p_compiler.h"
+
+
+struct lp_cs_tpool;
+
+
+/**
+ * Memory private to the thread running a workgroup.
+ */
+struct lp_cs_local_mem
+{
+   void *shared;             /**< workgroup shared memory */
+   unsigned shared_size;
+
+   void *stacks;             /**< fiber stacks, see lp_state_cs.c */
+   unsigned num_stacks;
+};
+
+
+typedef void
+(*lp_cs_tpool_task_func)(void *data, unsigned iter_idx,
+                         struct lp_cs_local_mem *lmem);
+
+
+struct lp_cs_tpool *
+lp_cs_tpool_create(unsigned num_threads);
+
+void
+lp_cs_tpool_destroy(struct lp_cs_tpool *pool);
+
+void
+lp_cs_tpool_run(struct lp_cs_tpool *pool,
+                lp_cs_tpool_task_func work,
+                void *data,
+                unsigned num_iters);
+
+
+#endif /* LP_CS_TPOOL_H */
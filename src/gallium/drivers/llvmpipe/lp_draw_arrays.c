@@ -34,6 +34,8 @@
 #include "pipe/p_defines.h"
 #include "pipe/p_context.h"
 #include "util/u_draw.h"
+#include "util/u_inlines.h"
+#include "util/u_memory.h"
 #include "util/u_prim.h"
 
 #include "lp_context.h"
@@ -45,27 +47,19 @@
 
 
 /**
- * Draw vertex arrays, with optional indexing, optional instancing.
- * All the other drawing functions are implemented in terms of this function.
- * Basically, map the vertex buffers (and drawing surfaces), then hand off
- * the drawing to the 'draw' module.
+ * Map the vertex buffers, index buffer and stream output targets for the
+ * draw module, and get the rest of the vertex pipeline ready.
+ *
+ * \return the mapped indices, to be passed to llvmpipe_draw_end()
  */
-static void
-llvmpipe_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *info)
+static const void *
+llvmpipe_draw_begin(struct llvmpipe_context *lp,
+                    const struct pipe_draw_info *info)
 {
-   struct llvmpipe_context *lp = llvmpipe_context(pipe);
    struct draw_context *draw = lp->draw;
    const void *mapped_indices = NULL;
    unsigned i;
 
-   if (!llvmpipe_check_render_cond(lp))
-      return;
-
-   if (info->indirect) {
-      util_draw_indirect(pipe, info);
-      return;
-   }
-
    if (lp->dirty)
       llvmpipe_update_derived( lp );
 
@@ -125,8 +119,15 @@ llvmpipe_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *info)
    draw_collect_pipeline_statistics(draw,
                                     lp->active_statistics_queries > 0);
 
-   /* draw! */
-   draw_vbo(draw, info);
+   return mapped_indices;
+}
+
+
+static void
+llvmpipe_draw_end(struct llvmpipe_context *lp, const void *mapped_indices)
+{
+   struct draw_context *draw = lp->draw;
+   unsigned i;
 
    /*
     * unmap vertex/index buffers
@@ -156,8 +157,139 @@ llvmpipe_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *info)
 }
 
 
+/**
+ * Indirect draws, including multi-draws: read the parameters of all the
+ * draws first, then run them with the buffers mapped only once.
+ */
+static void
+llvmpipe_draw_indirect(struct llvmpipe_context *lp,
+                       const struct pipe_draw_info *info)
+{
+   struct pipe_context *pipe = &lp->pipe;
+   const struct pipe_draw_indirect_info *indirect = info->indirect;
+   const unsigned num_params = info->index_size ? 5 : 4;
+   struct pipe_transfer *transfer;
+   unsigned draw_count = indirect->draw_count;
+   const uint32_t *params;
+   uint32_t *records;
+   const void *mapped_indices;
+   unsigned i;
+
+   if (indirect->indirect_draw_count) {
+      const uint32_t *count =
+         pipe_buffer_map_range(pipe, indirect->indirect_draw_count,
+                               indirect->indirect_draw_count_offset,
+                               sizeof(uint32_t), PIPE_TRANSFER_READ,
+                               &transfer);
+      if (!transfer)
+         return;
+      draw_count = MIN2(draw_count, *count);
+      pipe_buffer_unmap(pipe, transfer);
+   }
+
+   if (!draw_count)
+      return;
+
+   params = pipe_buffer_map_range(pipe, indirect->buffer, indirect->offset,
+                                  (draw_count - 1) * indirect->stride +
+                                  num_params * sizeof(uint32_t),
+                                  PIPE_TRANSFER_READ, &transfer);
+   if (!transfer)
+      return;
+
+   records = MALLOC(draw_count * num_params * sizeof(uint32_t));
+   if (!records) {
+      pipe_buffer_unmap(pipe, transfer);
+      return;
+   }
+   for (i = 0; i < draw_count; i++) {
+      memcpy(&records[i * num_params],
+             (const uint8_t *) params + i * indirect->stride,
+             num_params * sizeof(uint32_t));
+   }
+   pipe_buffer_unmap(pipe, transfer);
+
+   mapped_indices = llvmpipe_draw_begin(lp, info);
+
+   for (i = 0; i < draw_count; i++) {
+      const uint32_t *rec = &records[i * num_params];
+      struct pipe_draw_info draw_info = *info;
+
+      draw_info.count = rec[0];
+      draw_info.instance_count = rec[1];
+      draw_info.start = info->start + rec[2];
+      draw_info.index_bias = info->index_size ? rec[3] : 0;
+      draw_info.start_instance = info->index_size ? rec[4] : rec[3];
+      draw_info.drawid = i;
+      draw_info.indirect = NULL;
+
+      if (!draw_info.count || !draw_info.instance_count)
+         continue;
+
+      if (!info->index_size) {
+         draw_info.start = rec[2];
+         draw_info.min_index = draw_info.start;
+         draw_info.max_index = draw_info.start + draw_info.count - 1;
+      }
+
+      draw_vbo(lp->draw, &draw_info);
+   }
+
+   llvmpipe_draw_end(lp, mapped_indices);
+   FREE(records);
+}
+
+
+/**
+ * Draw vertex arrays, with optional indexing, optional instancing.
+ * All the other drawing functions are implemented in terms of this function.
+ * Basically, map the vertex buffers (and drawing surfaces), then hand off
+ * the drawing to the 'draw' module.
+ */
+static void
+llvmpipe_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *info)
+{
+   struct llvmpipe_context *lp = llvmpipe_context(pipe);
+   const void *mapped_indices;
+
+   if (!llvmpipe_check_render_cond(lp))
+      return;
+
+   if (info->indirect) {
+      llvmpipe_draw_indirect(lp, info);
+      return;
+   }
+
+   mapped_indices = llvmpipe_draw_begin(lp, info);
+
+   /* draw! */
+   draw_vbo(lp->draw, info);
+
+   llvmpipe_draw_end(lp, mapped_indices);
+}
+
+
+static void
+llvmpipe_multi_draw(struct pipe_context *pipe,
+                    const struct pipe_draw_info *info,
+                    const struct pipe_draw_start_count *draws,
+                    unsigned num_draws)
+{
+   struct llvmpipe_context *lp = llvmpipe_context(pipe);
+   const void *mapped_indices;
+
+   if (!llvmpipe_check_render_cond(lp))
+      return;
+
+   mapped_indices = llvmpipe_draw_begin(lp, info);
+   draw_multi_draw(lp->draw, info, draws, num_draws);
+   llvmpipe_draw_end(lp, mapped_indices);
+}
+
+
 void
 llvmpipe_init_draw_funcs(struct llvmpipe_context *llvmpipe)
 {
    llvmpipe->pipe.draw_vbo = llvmpipe_draw_vbo;
+   llvmpipe->pipe.multi_draw = llvmpipe_multi_draw;
 }
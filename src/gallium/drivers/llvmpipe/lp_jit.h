@@ -45,6 +45,7 @@
 
 struct lp_build_format_cache;
 struct lp_fragment_shader_variant;
+struct lp_compute_shader_variant;
 struct llvmpipe_screen;
 
 
@@ -59,6 +60,7 @@ struct lp_jit_texture
    uint32_t row_stride[LP_MAX_TEXTURE_LEVELS];
    uint32_t img_stride[LP_MAX_TEXTURE_LEVELS];
    uint32_t mip_offsets[LP_MAX_TEXTURE_LEVELS];
+   uint32_t sample_stride;  /* bytes between the samples of a msaa texture */
 };
 
 
@@ -71,6 +73,17 @@ struct lp_jit_sampler
 };
 
 
+struct lp_jit_image
+{
+   const void *base;
+   uint32_t width;        /* same as number of elements */
+   uint32_t height;       /* doubles as array size for 1D arrays */
+   uint32_t depth;        /* doubles as array size */
+   uint32_t row_stride;
+   uint32_t img_stride;
+};
+
+
 struct lp_jit_viewport
 {
    float min_depth;
@@ -88,6 +101,7 @@ enum {
    LP_JIT_TEXTURE_ROW_STRIDE,
    LP_JIT_TEXTURE_IMG_STRIDE,
    LP_JIT_TEXTURE_MIP_OFFSETS,
+   LP_JIT_TEXTURE_SAMPLE_STRIDE,
    LP_JIT_TEXTURE_NUM_FIELDS  /* number of fields above */
 };
 
@@ -101,6 +115,17 @@ enum {
 };
 
 
+enum {
+   LP_JIT_IMAGE_BASE = 0,
+   LP_JIT_IMAGE_WIDTH,
+   LP_JIT_IMAGE_HEIGHT,
+   LP_JIT_IMAGE_DEPTH,
+   LP_JIT_IMAGE_ROW_STRIDE,
+   LP_JIT_IMAGE_IMG_STRIDE,
+   LP_JIT_IMAGE_NUM_FIELDS  /* number of fields above */
+};
+
+
 enum {
    LP_JIT_VIEWPORT_MIN_DEPTH,
    LP_JIT_VIEWPORT_MAX_DEPTH,
@@ -135,6 +160,11 @@ struct lp_jit_context
 
    struct lp_jit_texture textures[PIPE_MAX_SHADER_SAMPLER_VIEWS];
    struct lp_jit_sampler samplers[PIPE_MAX_SAMPLERS];
+
+   const uint32_t *ssbos[LP_MAX_SHADER_BUFFERS];
+   int num_ssbos[LP_MAX_SHADER_BUFFERS];
+
+   uint32_t sample_mask;
 };
 
 
@@ -153,6 +183,9 @@ enum {
    LP_JIT_CTX_VIEWPORTS,
    LP_JIT_CTX_TEXTURES,
    LP_JIT_CTX_SAMPLERS,
+   LP_JIT_CTX_SSBOS,
+   LP_JIT_CTX_NUM_SSBOS,
+   LP_JIT_CTX_SAMPLE_MASK,
    LP_JIT_CTX_COUNT
 };
 
@@ -187,6 +220,15 @@ enum {
 #define lp_jit_context_samplers(_gallivm, _ptr) \
    lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CTX_SAMPLERS, "samplers")
 
+#define lp_jit_context_ssbos(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CTX_SSBOS, "ssbos")
+
+#define lp_jit_context_num_ssbos(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CTX_NUM_SSBOS, "num_ssbos")
+
+#define lp_jit_context_sample_mask(_gallivm, _ptr) \
+   lp_build_struct_get(_gallivm, _ptr, LP_JIT_CTX_SAMPLE_MASK, "sample_mask")
+
 
 struct lp_jit_thread_data
 {
@@ -237,6 +279,9 @@ enum {
  * @param thread_data   task thread data
  * @param stride        color buffer row stride in bytes
  * @param depth_stride  depth buffer row stride in bytes
+ * @param sample_mask   per-sample coverage, 16 bits per sample
+ * @param sample_stride color buffer sample stride in bytes
+ * @param depth_sample_stride  depth buffer sample stride in bytes
  */
 typedef void
 (*lp_jit_frag_func)(const struct lp_jit_context *context,
@@ -251,7 +296,117 @@ typedef void
                     uint32_t mask,
                     struct lp_jit_thread_data *thread_data,
                     unsigned *stride,
-                    unsigned depth_stride);
+                    unsigned depth_stride,
+                    uint64_t sample_mask,
+                    unsigned *sample_stride,
+                    unsigned depth_sample_stride);
+
+
+/**
+ * This structure is passed directly to the generated compute shader.
+ *
+ * The same rules as for lp_jit_context apply.
+ */
+struct lp_jit_cs_context
+{
+   const float *constants[LP_MAX_TGSI_CONST_BUFFERS];
+   int num_constants[LP_MAX_TGSI_CONST_BUFFERS];
+
+   struct lp_jit_texture textures[PIPE_MAX_SHADER_SAMPLER_VIEWS];
+   struct lp_jit_sampler samplers[PIPE_MAX_SAMPLERS];
+
+   const uint32_t *ssbos[LP_MAX_SHADER_BUFFERS];
+   int num_ssbos[LP_MAX_SHADER_BUFFERS];
+
+   struct lp_jit_image images[LP_MAX_SHADER_IMAGES];
+};
+
+
+/**
+ * These enum values must match the position of the fields in the
+ * lp_jit_cs_context struct above.
+ */
+enum {
+   LP_JIT_CS_CTX_CONSTANTS = 0,
+   LP_JIT_CS_CTX_NUM_CONSTANTS,
+   LP_JIT_CS_CTX_TEXTURES,
+   LP_JIT_CS_CTX_SAMPLERS,
+   LP_JIT_CS_CTX_SSBOS,
+   LP_JIT_CS_CTX_NUM_SSBOS,
+   LP_JIT_CS_CTX_IMAGES,
+   LP_JIT_CS_CTX_COUNT
+};
+
+
+#define lp_jit_cs_context_constants(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CS_CTX_CONSTANTS, "constants")
+
+#define lp_jit_cs_context_num_constants(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CS_CTX_NUM_CONSTANTS, "num_constants")
+
+#define lp_jit_cs_context_ssbos(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CS_CTX_SSBOS, "ssbos")
+
+#define lp_jit_cs_context_num_ssbos(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CS_CTX_NUM_SSBOS, "num_ssbos")
+
+#define lp_jit_cs_context_images(_gallivm, _ptr) \
+   lp_build_struct_get_ptr(_gallivm, _ptr, LP_JIT_CS_CTX_IMAGES, "images")
+
+
+/**
+ * Per worker thread data of the compute shader. The format cache must
+ * stay first, as in lp_jit_thread_data, for the texture sampling code.
+ */
+struct lp_jit_cs_thread_data
+{
+   struct lp_build_format_cache *cache;
+   void *shared;
+   uint32_t shared_size;
+};
+
+
+enum {
+   LP_JIT_CS_THREAD_DATA_CACHE = 0,
+   LP_JIT_CS_THREAD_DATA_SHARED,
+   LP_JIT_CS_THREAD_DATA_SHARED_SIZE,
+   LP_JIT_CS_THREAD_DATA_COUNT
+};
+
+
+#define lp_jit_cs_thread_data_shared(_gallivm, _ptr) \
+   lp_build_struct_get(_gallivm, _ptr, LP_JIT_CS_THREAD_DATA_SHARED, "shared")
+
+#define lp_jit_cs_thread_data_shared_size(_gallivm, _ptr) \
+   lp_build_struct_get(_gallivm, _ptr, LP_JIT_CS_THREAD_DATA_SHARED_SIZE, \
+                       "shared_size")
+
+
+/**
+ * typedef for compute shader function
+ *
+ * Runs one vector's worth of invocations of a workgroup.
+ *
+ * @param context           jit context
+ * @param x, y, z           workgroup id
+ * @param grid_x/y/z        number of workgroups
+ * @param block_x/y/z       workgroup size
+ * @param first_invocation  linear local index of the first invocation
+ * @param thread_data       worker thread data
+ */
+typedef void
+(*lp_jit_cs_func)(const struct lp_jit_cs_context *context,
+                  uint32_t x,
+                  uint32_t y,
+                  uint32_t z,
+                  uint32_t grid_x,
+                  uint32_t grid_y,
+                  uint32_t grid_z,
+                  uint32_t block_x,
+                  uint32_t block_y,
+                  uint32_t block_z,
+                  uint32_t first_invocation,
+                  struct lp_jit_cs_thread_data *thread_data);
 
 
 void
@@ -266,4 +421,17 @@ void
 lp_jit_init_types(struct lp_fragment_shader_variant *lp);
 
 
+void
+lp_jit_init_cs_types(struct lp_compute_shader_variant *lp);
+
+
+void
+lp_jit_buffer_lookup(struct gallivm_state *gallivm,
+                     LLVMValueRef ssbos_ptr,
+                     LLVMValueRef num_ssbos_ptr,
+                     LLVMValueRef index,
+                     LLVMValueRef *base_ptr,
+                     LLVMValueRef *size);
+
+
 #endif /* LP_JIT_H */
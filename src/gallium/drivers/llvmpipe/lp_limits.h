@@ -61,7 +61,24 @@
 #define LP_MAX_WIDTH  (1 << (LP_MAX_TEXTURE_LEVELS - 1))
 
 
-#define LP_MAX_THREADS 16
+/**
+ * Number of samples of multisample surfaces.  This is the only sample
+ * count supported besides single-sampled.
+ */
+#define LP_MAX_SAMPLES 4
+
+
+/**
+ * Max number of rasterizer threads.  By default one thread per CPU is
+ * used, up to this limit; LP_NUM_THREADS overrides that.
+ */
+#define LP_MAX_THREADS 256
+
+/**
+ * Max number of threads compiling optimized shader variants in the
+ * background, see LP_COMPILE_THREADS.
+ */
+#define LP_MAX_COMPILE_THREADS 8
 
 
 /**
@@ -91,4 +108,31 @@
  */
 #define LP_MAX_SETUP_VARIANTS 64
 
+/**
+ * Max number of compiled variants (fragment, setup, vertex and geometry
+ * shaders combined) kept in the screen's code cache, which is shared by
+ * all contexts.  Code still in use by a context is kept alive regardless.
+ */
+#define LP_MAX_SHARED_VARIANTS (2 * LP_MAX_SHADER_VARIANTS)
+
+
+/**
+ * Max number of shader storage buffers per stage (fragment and compute)
+ * and of images (compute only).
+ */
+#define LP_MAX_SHADER_BUFFERS 16
+#define LP_MAX_SHADER_IMAGES 8
+
+/**
+ * Max compute workgroup size and shared memory per workgroup.
+ */
+#define LP_MAX_CS_THREADS_PER_BLOCK 1024
+#define LP_MAX_CS_SHARED_SIZE (32 * 1024)
+
+/**
+ * Stack size of each invocation chunk of a workgroup running a shader
+ * with barriers, as these are switched between at the barriers.
+ */
+#define LP_CS_FIBER_STACK_SIZE (256 * 1024)
+
 #endif /* LP_LIMITS_H */
@@ -46,6 +46,7 @@ lp_print_counters(void)
 {
    if (LP_DEBUG & DEBUG_COUNTERS) {
       unsigned total_64, total_16, total_4;
+      unsigned i;
       float p1, p2, p3, p4, p5, p6;
 
       debug_printf("llvmpipe: nr_triangles:                 %9u\n", lp_count.nr_tris);
@@ -102,6 +103,22 @@ lp_print_counters(void)
       debug_printf("llvmpipe: nr_color_tile_load:           %9u\n", lp_count.nr_color_tile_load);
       debug_printf("llvmpipe: nr_color_tile_store:          %9u\n", lp_count.nr_color_tile_store);
 
+      debug_printf("llvmpipe: nr_scene_waits:               %9u\n", lp_count.nr_scene_waits);
+
+      for (i = 0; i < LP_MAX_THREADS; i++) {
+         const struct lp_thread_counters *tc = &lp_count.thread[i];
+         int64_t total = tc->busy_time + tc->idle_time;
+
+         if (!tc->nr_bins && !total)
+            continue;
+
+         debug_printf("llvmpipe: thread %2u: bins %9u stolen %9u "
+                      "busy %8.2f ms idle %8.2f ms (%3.0f%% busy)\n",
+                      i, tc->nr_bins, tc->nr_bins_stolen,
+                      tc->busy_time / 1000000.0, tc->idle_time / 1000000.0,
+                      total ? 100.0 * tc->busy_time / total : 0.0);
+      }
+
       debug_printf("llvmpipe: nr_llvm_compiles:             %u\n", lp_count.nr_llvm_compiles);
       debug_printf("llvmpipe: total LLVM compile time:      %.2f sec\n", lp_count.llvm_compile_time / 1000000.0);
       debug_printf("llvmpipe: average LLVM compile time:    %.2f sec\n", lp_count.llvm_compile_time / 1000000.0 / lp_count.nr_llvm_compiles);
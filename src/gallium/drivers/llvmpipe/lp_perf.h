@@ -34,6 +34,21 @@
 #define LP_PERF_H
 
 #include "pipe/p_compiler.h"
+#include "lp_limits.h"
+
+
+/**
+ * Per rasterizer thread counters, to check how well the work is balanced.
+ * Each thread only touches its own entry.
+ */
+struct lp_thread_counters
+{
+   unsigned nr_bins;         /**< bins rasterized */
+   unsigned nr_bins_stolen;  /**< ... of which from another thread's range */
+   int64_t busy_time;        /**< rasterizing, in nanoseconds */
+   int64_t idle_time;        /**< waiting for work or other threads */
+};
+
 
 /**
  * Various counters
@@ -62,6 +77,10 @@ struct lp_counters
    unsigned nr_color_tile_clear;
    unsigned nr_color_tile_load;
    unsigned nr_color_tile_store;
+
+   unsigned nr_scene_waits;  /**< times binning stalled on a busy scene */
+
+   struct lp_thread_counters thread[LP_MAX_THREADS];
 };
 
 
@@ -73,10 +92,15 @@ extern struct lp_counters lp_count;
 #define LP_COUNT(counter) lp_count.counter++
 #define LP_COUNT_ADD(counter, incr)  lp_count.counter += (incr)
 #define LP_COUNT_GET(counter) (lp_count.counter)
+#define LP_COUNT_THREAD(idx, counter) lp_count.thread[idx].counter++
+#define LP_COUNT_THREAD_ADD(idx, counter, incr) \
+   lp_count.thread[idx].counter += (incr)
 #else
 #define LP_COUNT(counter)
 #define LP_COUNT_ADD(counter, incr) (void)(incr)
 #define LP_COUNT_GET(counter) 0
+#define LP_COUNT_THREAD(idx, counter) (void)(idx)
+#define LP_COUNT_THREAD_ADD(idx, counter, incr) (void)(incr)
 #endif
 
 
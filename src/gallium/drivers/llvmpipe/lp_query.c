@@ -34,6 +34,7 @@
 #include "pipe/p_defines.h"
 #include "util/u_memory.h"
 #include "util/os_time.h"
+#include "gallivm/lp_bld_async.h"
 #include "lp_context.h"
 #include "lp_flush.h"
 #include "lp_fence.h"
@@ -55,7 +56,8 @@ llvmpipe_create_query(struct pipe_context *pipe,
 {
    struct llvmpipe_query *pq;
 
-   assert(type < PIPE_QUERY_TYPES);
+   assert(type < PIPE_QUERY_TYPES || type == LP_QUERY_PENDING_COMPILES ||
+          type == LP_QUERY_ASYNC_COMPILES);
 
    pq = CALLOC_STRUCT( llvmpipe_query );
 
@@ -166,6 +168,10 @@ llvmpipe_get_query_result(struct pipe_context *pipe,
       stats->primitives_storage_needed = pq->num_primitives_generated;
    }
       break;
+   case LP_QUERY_PENDING_COMPILES:
+   case LP_QUERY_ASYNC_COMPILES:
+      *result = pq->end[0];
+      break;
    case PIPE_QUERY_PIPELINE_STATISTICS: {
       struct pipe_query_data_pipeline_statistics *stats =
          (struct pipe_query_data_pipeline_statistics *)vresult;
@@ -190,6 +196,7 @@ static boolean
 llvmpipe_begin_query(struct pipe_context *pipe, struct pipe_query *q)
 {
    struct llvmpipe_context *llvmpipe = llvmpipe_context( pipe );
+   struct llvmpipe_screen *screen = llvmpipe_screen(pipe->screen);
    struct llvmpipe_query *pq = llvmpipe_query(q);
 
    /* Check if the query is already in the scene.  If so, we need to
@@ -236,6 +243,9 @@ llvmpipe_begin_query(struct pipe_context *pipe, struct pipe_query *q)
       llvmpipe->active_occlusion_queries++;
       llvmpipe->dirty |= LP_NEW_OCCLUSION_QUERY;
       break;
+   case LP_QUERY_ASYNC_COMPILES:
+      pq->start[0] = lp_async_compiler_num_compiled(screen->async_compiler);
+      break;
    default:
       break;
    }
@@ -247,6 +257,7 @@ static bool
 llvmpipe_end_query(struct pipe_context *pipe, struct pipe_query *q)
 {
    struct llvmpipe_context *llvmpipe = llvmpipe_context( pipe );
+   struct llvmpipe_screen *screen = llvmpipe_screen(pipe->screen);
    struct llvmpipe_query *pq = llvmpipe_query(q);
 
    lp_setup_end_query(llvmpipe->setup, pq);
@@ -301,6 +312,13 @@ llvmpipe_end_query(struct pipe_context *pipe, struct pipe_query *q)
       llvmpipe->active_occlusion_queries--;
       llvmpipe->dirty |= LP_NEW_OCCLUSION_QUERY;
       break;
+   case LP_QUERY_PENDING_COMPILES:
+      pq->end[0] = lp_async_compiler_num_pending(screen->async_compiler);
+      break;
+   case LP_QUERY_ASYNC_COMPILES:
+      pq->end[0] = lp_async_compiler_num_compiled(screen->async_compiler) -
+                   pq->start[0];
+      break;
    default:
       break;
    }
@@ -35,13 +35,20 @@
 
 #include <limits.h>
 #include "os/os_thread.h"
+#include "util/u_threaded_context.h"
 #include "lp_limits.h"
 
 
 struct llvmpipe_context;
 
 
+/** Driver-specific queries, see llvmpipe_get_driver_query_info() */
+#define LP_QUERY_PENDING_COMPILES  (PIPE_QUERY_DRIVER_SPECIFIC + 0)
+#define LP_QUERY_ASYNC_COMPILES    (PIPE_QUERY_DRIVER_SPECIFIC + 1)
+
+
 struct llvmpipe_query {
+   struct threaded_query base;
    uint64_t start[LP_MAX_THREADS];  /* start count value for each thread */
    uint64_t end[LP_MAX_THREADS];    /* end count value for each thread */
    struct lp_fence *fence;          /* fence from last scene this was binned in */
@@ -33,6 +33,7 @@
 #include "util/u_pack_color.h"
 #include "util/u_string.h"
 #include "util/u_thread.h"
+#include "util/u_cpu_detect.h"
 
 #include "util/os_time.h"
 
@@ -57,6 +58,14 @@ const struct lp_rasterizer_task *jit_task = NULL;
 #endif
 
 
+const int lp_sample_pos_4x[4][2] = {
+   {  96,  32 },
+   { 224,  96 },
+   {  32, 160 },
+   { 160, 224 }
+};
+
+
 /**
  * Begin rasterizing a scene.
  * Called once per scene by one thread.
@@ -70,16 +79,32 @@ lp_rast_begin( struct lp_rasterizer *rast,
    LP_DBG(DEBUG_RAST, "%s\n", __FUNCTION__);
 
    lp_scene_begin_rasterization( scene );
-   lp_scene_bin_iter_begin( scene );
+   lp_scene_bin_iter_begin( scene, MAX2(1, rast->num_threads) );
 }
 
 
+/**
+ * Finish rasterizing a scene.
+ * Called once per scene by one thread, after all threads are done with it.
+ * The setup module recycles the scene as soon as its fence is signalled,
+ * so the scene must be completely reset before that happens.
+ */
 static void
 lp_rast_end( struct lp_rasterizer *rast )
 {
-   lp_scene_end_rasterization( rast->curr_scene );
+   struct lp_scene *scene = rast->curr_scene;
+   struct lp_fence *fence = NULL;
+
+   lp_fence_reference(&fence, scene->fence);
+
+   lp_scene_end_rasterization( scene );
 
    rast->curr_scene = NULL;
+
+   if (fence) {
+      lp_fence_signal(fence);
+      lp_fence_reference(&fence, NULL);
+   }
 }
 
 
@@ -137,6 +162,7 @@ lp_rast_clear_color(struct lp_rasterizer_task *task,
    unsigned cbuf = arg.clear_rb->cbuf;
    union util_color uc;
    enum pipe_format format;
+   unsigned s;
 
    /* we never bin clear commands for non-existing buffers */
    assert(cbuf < scene->fb.nr_cbufs);
@@ -153,17 +179,20 @@ lp_rast_clear_color(struct lp_rasterizer_task *task,
           __FUNCTION__, format, uc.ui[0], uc.ui[1], uc.ui[2], uc.ui[3]);
 
 
-   util_fill_box(scene->cbufs[cbuf].map,
-                 format,
-                 scene->cbufs[cbuf].stride,
-                 scene->cbufs[cbuf].layer_stride,
-                 task->x,
-                 task->y,
-                 0,
-                 task->width,
-                 task->height,
-                 scene->fb_max_layer + 1,
-                 &uc);
+   for (s = 0; s < scene->cbufs[cbuf].nr_samples; s++) {
+      util_fill_box(scene->cbufs[cbuf].map +
+                    s * scene->cbufs[cbuf].sample_stride,
+                    format,
+                    scene->cbufs[cbuf].stride,
+                    scene->cbufs[cbuf].layer_stride,
+                    task->x,
+                    task->y,
+                    0,
+                    task->width,
+                    task->height,
+                    scene->fb_max_layer + 1,
+                    &uc);
+   }
 
    /* this will increase for each rb which probably doesn't mean much */
    LP_COUNT(nr_color_tile_clear);
@@ -199,87 +228,91 @@ lp_rast_clear_zstencil(struct lp_rasterizer_task *task,
     */
 
    if (scene->fb.zsbuf) {
-      unsigned layer;
-      uint8_t *dst_layer = task->depth_tile;
+      unsigned layer, sample;
+      uint8_t *dst_layer;
       block_size = util_format_get_blocksize(scene->fb.zsbuf->format);
 
       clear_value &= clear_mask;
 
-      for (layer = 0; layer <= scene->fb_max_layer; layer++) {
-         dst = dst_layer;
-
-         switch (block_size) {
-         case 1:
-            assert(clear_mask == 0xff);
-            memset(dst, (uint8_t) clear_value, height * width);
-            break;
-         case 2:
-            if (clear_mask == 0xffff) {
-               for (i = 0; i < height; i++) {
-                  uint16_t *row = (uint16_t *)dst;
-                  for (j = 0; j < width; j++)
-                     *row++ = (uint16_t) clear_value;
-                  dst += dst_stride;
+      for (sample = 0; sample < scene->zsbuf.nr_samples; sample++) {
+         dst_layer = task->depth_tile + sample * scene->zsbuf.sample_stride;
+
+         for (layer = 0; layer <= scene->fb_max_layer; layer++) {
+            dst = dst_layer;
+
+            switch (block_size) {
+            case 1:
+               assert(clear_mask == 0xff);
+               memset(dst, (uint8_t) clear_value, height * width);
+               break;
+            case 2:
+               if (clear_mask == 0xffff) {
+                  for (i = 0; i < height; i++) {
+                     uint16_t *row = (uint16_t *)dst;
+                     for (j = 0; j < width; j++)
+                        *row++ = (uint16_t) clear_value;
+                     dst += dst_stride;
+                  }
                }
-            }
-            else {
-               for (i = 0; i < height; i++) {
-                  uint16_t *row = (uint16_t *)dst;
-                  for (j = 0; j < width; j++) {
-                     uint16_t tmp = ~clear_mask & *row;
-                     *row++ = clear_value | tmp;
+               else {
+                  for (i = 0; i < height; i++) {
+                     uint16_t *row = (uint16_t *)dst;
+                     for (j = 0; j < width; j++) {
+                        uint16_t tmp = ~clear_mask & *row;
+                        *row++ = clear_value | tmp;
+                     }
+                     dst += dst_stride;
                   }
-                  dst += dst_stride;
                }
-            }
-            break;
-         case 4:
-            if (clear_mask == 0xffffffff) {
-               for (i = 0; i < height; i++) {
-                  uint32_t *row = (uint32_t *)dst;
-                  for (j = 0; j < width; j++)
-                     *row++ = clear_value;
-                  dst += dst_stride;
+               break;
+            case 4:
+               if (clear_mask == 0xffffffff) {
+                  for (i = 0; i < height; i++) {
+                     uint32_t *row = (uint32_t *)dst;
+                     for (j = 0; j < width; j++)
+                        *row++ = clear_value;
+                     dst += dst_stride;
+                  }
                }
-            }
-            else {
-               for (i = 0; i < height; i++) {
-                  uint32_t *row = (uint32_t *)dst;
-                  for (j = 0; j < width; j++) {
-                     uint32_t tmp = ~clear_mask & *row;
-                     *row++ = clear_value | tmp;
+               else {
+                  for (i = 0; i < height; i++) {
+                     uint32_t *row = (uint32_t *)dst;
+                     for (j = 0; j < width; j++) {
+                        uint32_t tmp = ~clear_mask & *row;
+                        *row++ = clear_value | tmp;
+                     }
+                     dst += dst_stride;
                   }
-                  dst += dst_stride;
                }
-            }
-            break;
-         case 8:
-            clear_value64 &= clear_mask64;
-            if (clear_mask64 == 0xffffffffffULL) {
-               for (i = 0; i < height; i++) {
-                  uint64_t *row = (uint64_t *)dst;
-                  for (j = 0; j < width; j++)
-                     *row++ = clear_value64;
-                  dst += dst_stride;
+               break;
+            case 8:
+               clear_value64 &= clear_mask64;
+               if (clear_mask64 == 0xffffffffffULL) {
+                  for (i = 0; i < height; i++) {
+                     uint64_t *row = (uint64_t *)dst;
+                     for (j = 0; j < width; j++)
+                        *row++ = clear_value64;
+                     dst += dst_stride;
+                  }
                }
-            }
-            else {
-               for (i = 0; i < height; i++) {
-                  uint64_t *row = (uint64_t *)dst;
-                  for (j = 0; j < width; j++) {
-                     uint64_t tmp = ~clear_mask64 & *row;
-                     *row++ = clear_value64 | tmp;
+               else {
+                  for (i = 0; i < height; i++) {
+                     uint64_t *row = (uint64_t *)dst;
+                     for (j = 0; j < width; j++) {
+                        uint64_t tmp = ~clear_mask64 & *row;
+                        *row++ = clear_value64 | tmp;
+                     }
+                     dst += dst_stride;
                   }
-                  dst += dst_stride;
                }
-            }
-            break;
+               break;
 
-         default:
-            assert(0);
-            break;
+            default:
+               assert(0);
+               break;
+            }
+            dst_layer += scene->zsbuf.layer_stride;
          }
-         dst_layer += scene->zsbuf.layer_stride;
       }
    }
 }
@@ -321,19 +354,23 @@ lp_rast_shade_tile(struct lp_rasterizer_task *task,
       for (x = 0; x < task->width; x += 4) {
          uint8_t *color[PIPE_MAX_COLOR_BUFS];
          unsigned stride[PIPE_MAX_COLOR_BUFS];
+         unsigned sample_stride[PIPE_MAX_COLOR_BUFS];
          uint8_t *depth = NULL;
          unsigned depth_stride = 0;
+         unsigned depth_sample_stride = 0;
          unsigned i;
 
          /* color buffer */
          for (i = 0; i < scene->fb.nr_cbufs; i++){
             if (scene->fb.cbufs[i]) {
                stride[i] = scene->cbufs[i].stride;
+               sample_stride[i] = scene->cbufs[i].sample_stride;
                color[i] = lp_rast_get_color_block_pointer(task, i, tile_x + x,
                                                           tile_y + y, inputs->layer);
             }
             else {
                stride[i] = 0;
+               sample_stride[i] = 0;
                color[i] = NULL;
             }
          }
@@ -343,6 +380,7 @@ lp_rast_shade_tile(struct lp_rasterizer_task *task,
             depth = lp_rast_get_depth_block_pointer(task, tile_x + x,
                                                     tile_y + y, inputs->layer);
             depth_stride = scene->zsbuf.stride;
+            depth_sample_stride = scene->zsbuf.sample_stride;
          }
 
          /* Propagate non-interpolated raster state. */
@@ -361,7 +399,10 @@ lp_rast_shade_tile(struct lp_rasterizer_task *task,
                                             0xffff,
                                             &task->thread_data,
                                             stride,
-                                            depth_stride);
+                                            depth_stride,
+                                            ~(uint64_t)0,
+                                            sample_stride,
+                                            depth_sample_stride);
          END_JIT_CALL();
       }
    }
@@ -393,20 +434,24 @@ lp_rast_shade_tile_opaque(struct lp_rasterizer_task *task,
  * This is a bin command called during bin processing.
  * \param x  X position of quad in window coords
  * \param y  Y position of quad in window coords
+ * \param mask  coverage, 16 bits for each of the LP_MAX_SAMPLES samples
  */
 void
-lp_rast_shade_quads_mask(struct lp_rasterizer_task *task,
-                         const struct lp_rast_shader_inputs *inputs,
-                         unsigned x, unsigned y,
-                         unsigned mask)
+lp_rast_shade_quads_mask_sample(struct lp_rasterizer_task *task,
+                                const struct lp_rast_shader_inputs *inputs,
+                                unsigned x, unsigned y,
+                                uint64_t mask)
 {
    const struct lp_rast_state *state = task->state;
    struct lp_fragment_shader_variant *variant = state->variant;
    const struct lp_scene *scene = task->scene;
    uint8_t *color[PIPE_MAX_COLOR_BUFS];
    unsigned stride[PIPE_MAX_COLOR_BUFS];
+   unsigned sample_stride[PIPE_MAX_COLOR_BUFS];
    uint8_t *depth = NULL;
    unsigned depth_stride = 0;
+   unsigned depth_sample_stride = 0;
+   unsigned pixel_mask;
    unsigned i;
 
    assert(state);
@@ -424,11 +469,13 @@ lp_rast_shade_quads_mask(struct lp_rasterizer_task *task,
    for (i = 0; i < scene->fb.nr_cbufs; i++) {
       if (scene->fb.cbufs[i]) {
          stride[i] = scene->cbufs[i].stride;
+         sample_stride[i] = scene->cbufs[i].sample_stride;
          color[i] = lp_rast_get_color_block_pointer(task, i, x, y,
                                                     inputs->layer);
       }
       else {
          stride[i] = 0;
+         sample_stride[i] = 0;
          color[i] = NULL;
       }
    }
@@ -436,11 +483,16 @@ lp_rast_shade_quads_mask(struct lp_rasterizer_task *task,
    /* depth buffer */
    if (scene->zsbuf.map) {
       depth_stride = scene->zsbuf.stride;
+      depth_sample_stride = scene->zsbuf.sample_stride;
       depth = lp_rast_get_depth_block_pointer(task, x, y, inputs->layer);
    }
 
    assert(lp_check_alignment(state->jit_context.u8_blend_color, 16));
 
+   /* Pixels with any sample covered, the shader runs once for those */
+   pixel_mask = (unsigned)(mask | (mask >> 16) | (mask >> 32) | (mask >> 48)) &
+                0xffff;
+
    /*
     * The rasterizer may produce fragments outside our
     * allocated 4x4 blocks hence need to filter them out here.
@@ -463,15 +515,32 @@ lp_rast_shade_quads_mask(struct lp_rasterizer_task *task,
                                             GET_DADY(inputs),
                                             color,
                                             depth,
-                                            mask,
+                                            pixel_mask,
                                             &task->thread_data,
                                             stride,
-                                            depth_stride);
+                                            depth_stride,
+                                            mask,
+                                            sample_stride,
+                                            depth_sample_stride);
       END_JIT_CALL();
    }
 }
 
 
+/**
+ * As above, for coverage which is the same for all the samples of a pixel.
+ */
+void
+lp_rast_shade_quads_mask(struct lp_rasterizer_task *task,
+                         const struct lp_rast_shader_inputs *inputs,
+                         unsigned x, unsigned y,
+                         unsigned mask)
+{
+   lp_rast_shade_quads_mask_sample(task, inputs, x, y,
+                                   mask * 0x0001000100010001ULL);
+}
+
+
 
 /**
  * Begin a new occlusion query.
@@ -592,7 +661,15 @@ static lp_rast_cmd_func dispatch[LP_RAST_OP_MAX] =
    lp_rast_triangle_32_8,
    lp_rast_triangle_32_3_4,
    lp_rast_triangle_32_3_16,
-   lp_rast_triangle_32_4_16
+   lp_rast_triangle_32_4_16,
+   lp_rast_triangle_ms_1,
+   lp_rast_triangle_ms_2,
+   lp_rast_triangle_ms_3,
+   lp_rast_triangle_ms_4,
+   lp_rast_triangle_ms_5,
+   lp_rast_triangle_ms_6,
+   lp_rast_triangle_ms_7,
+   lp_rast_triangle_ms_8
 };
 
 
@@ -686,7 +763,9 @@ rasterize_scene(struct lp_rasterizer_task *task,
          int i, j;
 
          assert(scene);
-         while ((bin = lp_scene_bin_iter_next(scene, &i, &j))) {
+         while ((bin = lp_scene_bin_iter_next(scene, task->thread_index,
+                                              &i, &j))) {
+            LP_COUNT_THREAD(task->thread_index, nr_bins);
             if (!is_empty_bin( bin ))
                rasterize_bin(task, bin, i, j);
          }
@@ -708,10 +787,6 @@ rasterize_scene(struct lp_rasterizer_task *task,
    }
 #endif
 
-   if (scene->fence) {
-      lp_fence_signal(scene->fence);
-   }
-
    task->scene = NULL;
 }
 
@@ -741,8 +816,6 @@ lp_rast_queue_scene( struct lp_rasterizer *rast,
       lp_rast_end( rast );
 
       util_fpstate_set(fpstate);
-
-      rast->curr_scene = NULL;
    }
    else {
       /* threaded rendering! */
@@ -760,20 +833,44 @@ lp_rast_queue_scene( struct lp_rasterizer *rast,
 }
 
 
-void
-lp_rast_finish( struct lp_rasterizer *rast )
+/**
+ * Timestamp for the per-thread busy/idle counters, only taken when the
+ * counters are going to be printed.
+ */
+static inline int64_t
+thread_timestamp(void)
 {
-   if (rast->num_threads == 0) {
-      /* nothing to do */
-   }
-   else {
-      int i;
+   return (LP_DEBUG & DEBUG_COUNTERS) ? os_time_get_nano() : 0;
+}
 
-      /* wait for work to complete */
-      for (i = 0; i < rast->num_threads; i++) {
-         pipe_semaphore_wait(&rast->tasks[i].work_done);
+
+/**
+ * Per-thread initialization, done on the thread itself so that its
+ * memory is allocated from (first touched on) its own NUMA node.
+ */
+static boolean
+init_thread(struct lp_rasterizer_task *task)
+{
+   if (task->pin_to_node) {
+      uint32_t mask[UTIL_MAX_CPUS / 32];
+      unsigned cpu;
+
+      memset(mask, 0, sizeof mask);
+      for (cpu = 0; cpu < MIN2(util_cpu_caps.nr_cpus, UTIL_MAX_CPUS); cpu++) {
+         if (util_cpu_caps.cpu_to_numa_node[cpu] == task->numa_node)
+            mask[cpu / 32] |= 1u << (cpu % 32);
       }
+
+      util_set_current_thread_affinity(mask, UTIL_MAX_CPUS);
    }
+
+   task->thread_data.cache = align_malloc(sizeof(struct lp_build_format_cache),
+                                          16);
+   if (!task->thread_data.cache)
+      return FALSE;
+
+   memset(task->thread_data.cache, 0, sizeof(struct lp_build_format_cache));
+   return TRUE;
 }
 
 
@@ -782,7 +879,7 @@ lp_rast_finish( struct lp_rasterizer *rast )
  * It's a simple loop:
  *   1. wait for work
  *   2. do work
- *   3. signal that we're done
+ *   3. thread[0] signals the scene's fence
  */
 static int
 thread_function(void *init_data)
@@ -792,6 +889,7 @@ thread_function(void *init_data)
    boolean debug = false;
    char thread_name[16];
    unsigned fpstate;
+   int64_t idle_start, busy_start;
 
    util_snprintf(thread_name, sizeof thread_name, "llvmpipe-%u", task->thread_index);
    u_thread_setname(thread_name);
@@ -802,6 +900,12 @@ thread_function(void *init_data)
    fpstate = util_fpstate_get();
    util_fpstate_set_denorms_to_zero(fpstate);
 
+   /* tell lp_rast_create() we're up and whether we're usable */
+   init_thread(task);
+   pipe_semaphore_signal(&task->work_done);
+
+   idle_start = thread_timestamp();
+
    while (1) {
       /* wait for work */
       if (debug)
@@ -829,23 +933,32 @@ thread_function(void *init_data)
       if (debug)
          debug_printf("thread %d doing work\n", task->thread_index);
 
+      busy_start = thread_timestamp();
+      LP_COUNT_THREAD_ADD(task->thread_index, idle_time,
+                          busy_start - idle_start);
+
       rasterize_scene(task,
                       rast->curr_scene);
-      
+
+      idle_start = thread_timestamp();
+      LP_COUNT_THREAD_ADD(task->thread_index, busy_time,
+                          idle_start - busy_start);
+
       /* wait for all threads to finish with this scene */
       util_barrier_wait( &rast->barrier );
 
-      /* XXX: shouldn't be necessary:
+      /* thread[0]:
+       *  - unmap the framebuffer surfaces, release the scene
+       *  - signal the scene's fence
+       * Nobody waits for us otherwise, the setup module may well be
+       * binning the next scene already.
        */
       if (task->thread_index == 0) {
          lp_rast_end( rast );
       }
 
-      /* signal done with work */
       if (debug)
          debug_printf("thread %d done working\n", task->thread_index);
-
-      pipe_semaphore_signal(&task->work_done);
    }
 
 #ifdef _WIN32
@@ -858,19 +971,44 @@ thread_function(void *init_data)
 
 /**
  * Initialize semaphores and spawn the threads.
+ *
+ * On NUMA systems the threads are split into contiguous groups, one per
+ * node, and each thread is pinned to the CPUs of its node.  Neighbouring
+ * threads work on neighbouring bins (see lp_scene_bin_iter_next()), so
+ * this also keeps bin stealing mostly within a node.
+ *
+ * \return FALSE if any thread failed to initialize
  */
-static void
+static boolean
 create_rast_threads(struct lp_rasterizer *rast)
 {
+   unsigned num_nodes = util_cpu_caps.nr_numa_nodes;
+   boolean pin = num_nodes > 1 &&
+                 debug_get_bool_option("LP_NUMA_PIN", TRUE);
+   boolean ok = TRUE;
    unsigned i;
 
    /* NOTE: if num_threads is zero, we won't use any threads */
    for (i = 0; i < rast->num_threads; i++) {
-      pipe_semaphore_init(&rast->tasks[i].work_ready, 0);
-      pipe_semaphore_init(&rast->tasks[i].work_done, 0);
+      struct lp_rasterizer_task *task = &rast->tasks[i];
+
+      task->numa_node = i * num_nodes / rast->num_threads;
+      task->pin_to_node = pin;
+
+      pipe_semaphore_init(&task->work_ready, 0);
+      pipe_semaphore_init(&task->work_done, 0);
       rast->threads[i] = u_thread_create(thread_function,
-                                            (void *) &rast->tasks[i]);
+                                            (void *) task);
+   }
+
+   /* wait for the threads to have initialized themselves */
+   for (i = 0; i < rast->num_threads; i++) {
+      pipe_semaphore_wait(&rast->tasks[i].work_done);
+      if (!rast->tasks[i].thread_data.cache)
+         ok = FALSE;
    }
+
+   return ok;
 }
 
 
@@ -900,19 +1038,12 @@ lp_rast_create( unsigned num_threads )
       struct lp_rasterizer_task *task = &rast->tasks[i];
       task->rast = rast;
       task->thread_index = i;
-      task->thread_data.cache = align_malloc(sizeof(struct lp_build_format_cache),
-                                             16);
-      if (!task->thread_data.cache) {
-         goto no_thread_data_cache;
-      }
    }
 
    rast->num_threads = num_threads;
 
    rast->no_rast = debug_get_bool_option("LP_NO_RAST", FALSE);
 
-   create_rast_threads(rast);
-
    /* for synchronizing rasterization threads */
    if (rast->num_threads > 0) {
       util_barrier_init( &rast->barrier, rast->num_threads );
@@ -920,16 +1051,20 @@ lp_rast_create( unsigned num_threads )
 
    memset(lp_dummy_tile, 0, sizeof lp_dummy_tile);
 
-   return rast;
-
-no_thread_data_cache:
-   for (i = 0; i < MAX2(1, rast->num_threads); i++) {
-      if (rast->tasks[i].thread_data.cache) {
-         align_free(rast->tasks[i].thread_data.cache);
+   if (rast->num_threads == 0) {
+      /* no threads, rasterize on the calling thread */
+      if (!init_thread(&rast->tasks[0])) {
+         lp_rast_destroy(rast);
+         return NULL;
       }
    }
+   else if (!create_rast_threads(rast)) {
+      lp_rast_destroy(rast);
+      return NULL;
+   }
+
+   return rast;
 
-   lp_scene_queue_destroy(rast->full_scenes);
 no_full_scenes:
    FREE(rast);
 no_rast:
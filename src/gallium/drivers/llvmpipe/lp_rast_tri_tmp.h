@@ -35,6 +35,11 @@
  * Prototype for a 8 plane rasterizer function.  Will codegenerate
  * several of these.
  *
+ * With MULTISAMPLE (which needs RASTER_64) coverage is computed at each
+ * of the LP_MAX_SAMPLES sample positions of the pixels instead of at
+ * their centers.  The block level trivial accept/reject tests cover the
+ * whole area of the blocks so they work for both.
+ *
  * XXX: Varients for more/fewer planes.
  * XXX: Need ways of dropping planes as we descend.
  * XXX: SIMD
@@ -46,6 +51,36 @@ TAG(do_block_4)(struct lp_rasterizer_task *task,
                 int x, int y,
                 const int64_t *c)
 {
+#ifdef MULTISAMPLE
+   /*
+    * c is the edge function at the top-left pixel corner here, step it to
+    * each sample position and build one 16 bit mask per sample.
+    */
+   uint64_t mask = 0;
+   unsigned s;
+   int j;
+
+   for (s = 0; s < LP_MAX_SAMPLES; s++) {
+      unsigned smask = 0xffff;
+
+      for (j = 0; j < NR_PLANES; j++) {
+         const int64_t cs = c[j] +
+            ((IMUL64(plane[j].dcdy, lp_sample_pos_4x[s][1]) -
+              IMUL64(plane[j].dcdx, lp_sample_pos_4x[s][0])) >> FIXED_ORDER);
+
+         smask &= ~BUILD_MASK_LINEAR(((cs - 1) >> (int64_t)FIXED_ORDER),
+                                     -plane[j].dcdx >> FIXED_ORDER,
+                                     plane[j].dcdy >> FIXED_ORDER);
+      }
+
+      mask |= (uint64_t)smask << (16 * s);
+   }
+
+   /* Now pass to the shader:
+    */
+   if (mask)
+      lp_rast_shade_quads_mask_sample(task, &tri->inputs, x, y, mask);
+#else
    unsigned mask = 0xffff;
    int j;
 
@@ -65,6 +100,7 @@ TAG(do_block_4)(struct lp_rasterizer_task *task,
     */
    if (mask)
       lp_rast_shade_quads_mask(task, &tri->inputs, x, y, mask);
+#endif
 }
 
 /**
@@ -31,9 +31,11 @@
 #include "util/u_inlines.h"
 #include "util/simple_list.h"
 #include "util/u_format.h"
+#include "util/u_atomic.h"
 #include "lp_scene.h"
 #include "lp_fence.h"
 #include "lp_debug.h"
+#include "lp_perf.h"
 
 
 #define RESOURCE_REF_SZ 32
@@ -41,6 +43,7 @@
 /** List of resource references */
 struct resource_ref {
    struct pipe_resource *resource[RESOURCE_REF_SZ];
+   unsigned writeable;  /**< bitmask of resources the shaders may write */
    int count;
    struct resource_ref *next;
 };
@@ -160,6 +163,8 @@ lp_scene_begin_rasterization(struct lp_scene *scene)
       if (!cbuf) {
          scene->cbufs[i].stride = 0;
          scene->cbufs[i].layer_stride = 0;
+         scene->cbufs[i].sample_stride = 0;
+         scene->cbufs[i].nr_samples = 1;
          scene->cbufs[i].map = NULL;
          continue;
       }
@@ -169,6 +174,8 @@ lp_scene_begin_rasterization(struct lp_scene *scene)
                                                            cbuf->u.tex.level);
          scene->cbufs[i].layer_stride = llvmpipe_layer_stride(cbuf->texture,
                                                               cbuf->u.tex.level);
+         scene->cbufs[i].sample_stride = llvmpipe_sample_stride(cbuf->texture);
+         scene->cbufs[i].nr_samples = MAX2(cbuf->texture->nr_samples, 1);
 
          scene->cbufs[i].map = llvmpipe_resource_map(cbuf->texture,
                                                      cbuf->u.tex.level,
@@ -181,6 +188,8 @@ lp_scene_begin_rasterization(struct lp_scene *scene)
          unsigned pixstride = util_format_get_blocksize(cbuf->format);
          scene->cbufs[i].stride = cbuf->texture->width0;
          scene->cbufs[i].layer_stride = 0;
+         scene->cbufs[i].sample_stride = 0;
+         scene->cbufs[i].nr_samples = 1;
          scene->cbufs[i].map = lpr->data;
          scene->cbufs[i].map += cbuf->u.buf.first_element * pixstride;
          scene->cbufs[i].format_bytes = util_format_get_blocksize(cbuf->format);
@@ -191,6 +200,8 @@ lp_scene_begin_rasterization(struct lp_scene *scene)
       struct pipe_surface *zsbuf = scene->fb.zsbuf;
       scene->zsbuf.stride = llvmpipe_resource_stride(zsbuf->texture, zsbuf->u.tex.level);
       scene->zsbuf.layer_stride = llvmpipe_layer_stride(zsbuf->texture, zsbuf->u.tex.level);
+      scene->zsbuf.sample_stride = llvmpipe_sample_stride(zsbuf->texture);
+      scene->zsbuf.nr_samples = MAX2(zsbuf->texture->nr_samples, 1);
 
       scene->zsbuf.map = llvmpipe_resource_map(zsbuf->texture,
                                                zsbuf->u.tex.level,
@@ -205,6 +216,10 @@ lp_scene_begin_rasterization(struct lp_scene *scene)
 
 /**
  * Free all the temporary data in a scene.
+ * With multiple scenes in flight this is called by the rasterizer while
+ * the setup module may concurrently query the scene's resource references
+ * (see lp_scene_is_resource_referenced()), hence the locking.
+ * The scene's fence is left alone, it's owned by the setup module.
  */
 void
 lp_scene_end_rasterization(struct lp_scene *scene )
@@ -249,6 +264,8 @@ lp_scene_end_rasterization(struct lp_scene *scene )
     */
    assert(lp_scene_is_empty(scene));
 
+   mtx_lock(&scene->mutex);
+
    /* Decrement texture ref counts
     */
    {
@@ -289,8 +306,6 @@ lp_scene_end_rasterization(struct lp_scene *scene )
       list->head->used = 0;
    }
 
-   lp_fence_reference(&scene->fence, NULL);
-
    scene->resources = NULL;
    scene->scene_size = 0;
    scene->resource_reference_size = 0;
@@ -298,6 +313,8 @@ lp_scene_end_rasterization(struct lp_scene *scene )
    scene->alloc_failed = FALSE;
 
    util_unreference_framebuffer_state( &scene->fb );
+
+   mtx_unlock(&scene->mutex);
 }
 
 
@@ -370,11 +387,13 @@ lp_scene_data_size( const struct lp_scene *scene )
 
 /**
  * Add a reference to a resource by the scene.
+ * \param writeable  the scene's shaders may write the resource (SSBOs)
  */
 boolean
 lp_scene_add_resource_reference(struct lp_scene *scene,
                                 struct pipe_resource *resource,
-                                boolean initializing_scene)
+                                boolean initializing_scene,
+                                boolean writeable)
 {
    struct resource_ref *ref, **last = &scene->resources;
    int i;
@@ -386,9 +405,13 @@ lp_scene_add_resource_reference(struct lp_scene *scene,
 
       /* Search for this resource:
        */
-      for (i = 0; i < ref->count; i++)
-         if (ref->resource[i] == resource)
+      for (i = 0; i < ref->count; i++) {
+         if (ref->resource[i] == resource) {
+            if (writeable)
+               ref->writeable |= 1u << i;
             return TRUE;
+         }
+      }
 
       if (ref->count < RESOURCE_REF_SZ) {
          /* If the block is half-empty, then append the reference here.
@@ -411,6 +434,8 @@ lp_scene_add_resource_reference(struct lp_scene *scene,
 
    /* Append the reference to the reference block.
     */
+   if (writeable)
+      ref->writeable |= 1u << ref->count;
    pipe_resource_reference(&ref->resource[ref->count++], resource);
    scene->resource_reference_size += llvmpipe_resource_size(resource);
 
@@ -429,81 +454,163 @@ lp_scene_add_resource_reference(struct lp_scene *scene,
 
 /**
  * Does this scene have a reference to the given resource?
+ * The scene may be queued for or undergoing rasterization, so its render
+ * targets are checked too (they may differ from the currently bound ones).
+ * \return bitmask of LP_REFERENCED_FOR_READ/WRITE
  */
-boolean
-lp_scene_is_resource_referenced(const struct lp_scene *scene,
+unsigned
+lp_scene_is_resource_referenced(struct lp_scene *scene,
                                 const struct pipe_resource *resource)
 {
    const struct resource_ref *ref;
+   unsigned referenced = LP_UNREFERENCED;
    int i;
 
+   mtx_lock(&scene->mutex);
+
+   for (i = 0; i < scene->fb.nr_cbufs; i++) {
+      if (scene->fb.cbufs[i] && scene->fb.cbufs[i]->texture == resource) {
+         referenced = LP_REFERENCED_FOR_READ | LP_REFERENCED_FOR_WRITE;
+         goto end;
+      }
+   }
+   if (scene->fb.zsbuf && scene->fb.zsbuf->texture == resource) {
+      referenced = LP_REFERENCED_FOR_READ | LP_REFERENCED_FOR_WRITE;
+      goto end;
+   }
+
    for (ref = scene->resources; ref; ref = ref->next) {
-      for (i = 0; i < ref->count; i++)
-         if (ref->resource[i] == resource)
-            return TRUE;
+      for (i = 0; i < ref->count; i++) {
+         if (ref->resource[i] == resource) {
+            referenced = LP_REFERENCED_FOR_READ;
+            if (ref->writeable & (1u << i))
+               referenced |= LP_REFERENCED_FOR_WRITE;
+            goto end;
+         }
+      }
    }
 
-   return FALSE;
+end:
+   mtx_unlock(&scene->mutex);
+   return referenced;
 }
 
 
 
 
-/** advance curr_x,y to the next bin */
-static boolean
-next_bin(struct lp_scene *scene)
+/**
+ * Extract the even bits of a Morton code.
+ */
+static inline unsigned
+morton_compact(unsigned code)
 {
-   scene->curr_x++;
-   if (scene->curr_x >= scene->tiles_x) {
-      scene->curr_x = 0;
-      scene->curr_y++;
-   }
-   if (scene->curr_y >= scene->tiles_y) {
-      /* no more bins */
-      return FALSE;
+   code &= 0x55555555;
+   code = (code | (code >> 1)) & 0x33333333;
+   code = (code | (code >> 2)) & 0x0f0f0f0f;
+   code = (code | (code >> 4)) & 0x00ff00ff;
+   code = (code | (code >> 8)) & 0x0000ffff;
+   return code;
+}
+
+
+/**
+ * Build the list of the scene's bins in Morton order.
+ */
+static void
+build_bin_order(struct lp_scene *scene)
+{
+   unsigned dim = util_next_power_of_two(MAX2(scene->tiles_x,
+                                              scene->tiles_y));
+   unsigned code, n = 0;
+
+   for (code = 0; code < dim * dim; code++) {
+      unsigned x = morton_compact(code);
+      unsigned y = morton_compact(code >> 1);
+
+      if (x < scene->tiles_x && y < scene->tiles_y)
+         scene->bin_order[n++] = x | (y << 16);
    }
-   return TRUE;
+
+   assert(n == scene->tiles_x * scene->tiles_y);
+
+   scene->num_bins = n;
+   scene->bin_order_tiles_x = scene->tiles_x;
+   scene->bin_order_tiles_y = scene->tiles_y;
 }
 
 
+/**
+ * Prepare for iterating over the scene's bins with the given number of
+ * rasterizer threads.  Must be called before the threads start calling
+ * lp_scene_bin_iter_next().
+ */
 void
-lp_scene_bin_iter_begin( struct lp_scene *scene )
+lp_scene_bin_iter_begin( struct lp_scene *scene, unsigned num_threads )
+{
+   unsigned i;
+
+   assert(num_threads > 0 && num_threads <= LP_MAX_THREADS);
+
+   if (scene->bin_order_tiles_x != scene->tiles_x ||
+       scene->bin_order_tiles_y != scene->tiles_y)
+      build_bin_order(scene);
+
+   /* Split the bin order into one contiguous range per thread */
+   for (i = 0; i < num_threads; i++) {
+      scene->bin_ranges[i].next = i * scene->num_bins / num_threads;
+      scene->bin_ranges[i].end = (i + 1) * scene->num_bins / num_threads;
+   }
+   scene->num_bin_ranges = num_threads;
+}
+
+
+/**
+ * Take the next bin out of the given range, or return -1 if the range is
+ * exhausted.
+ */
+static inline int
+bin_range_take(struct lp_bin_range *range)
 {
-   scene->curr_x = scene->curr_y = -1;
+   int idx = p_atomic_inc_return(&range->next) - 1;
+   return idx < range->end ? idx : -1;
 }
 
 
 /**
- * Return pointer to next bin to be rendered.
- * The lp_scene::curr_x and ::curr_y fields will be advanced.
+ * Return pointer to next bin to be rendered by the given thread.
  * Multiple rendering threads will call this function to get a chunk
- * of work (a bin) to work on.
+ * of work (a bin) to work on.  Each thread first works through its own
+ * range of bins, then steals from the ranges of the other threads,
+ * starting with the neighbouring (and so spatially close) ones.
+ * Lock-free.
  */
 struct cmd_bin *
-lp_scene_bin_iter_next( struct lp_scene *scene , int *x, int *y)
+lp_scene_bin_iter_next( struct lp_scene *scene, unsigned thread,
+                        int *x, int *y )
 {
-   struct cmd_bin *bin = NULL;
+   unsigned num_ranges = scene->num_bin_ranges;
+   unsigned i;
+   int idx;
 
-   mtx_lock(&scene->mutex);
+   assert(thread < num_ranges);
+
+   idx = bin_range_take(&scene->bin_ranges[thread]);
 
-   if (scene->curr_x < 0) {
-      /* first bin */
-      scene->curr_x = 0;
-      scene->curr_y = 0;
+   for (i = 1; idx < 0 && i < num_ranges; i++) {
+      idx = bin_range_take(&scene->bin_ranges[(thread + i) % num_ranges]);
+      if (idx >= 0)
+         LP_COUNT_THREAD(thread, nr_bins_stolen);
    }
-   else if (!next_bin(scene)) {
+
+   if (idx < 0) {
       /* no more bins left */
-      goto end;
+      return NULL;
    }
 
-   bin = lp_scene_get_bin(scene, scene->curr_x, scene->curr_y);
-   *x = scene->curr_x;
-   *y = scene->curr_y;
+   *x = scene->bin_order[idx] & 0xffff;
+   *y = scene->bin_order[idx] >> 16;
 
-end:
-   /*printf("return bin %p at %d, %d\n", (void *) bin, *bin_x, *bin_y);*/
-   mtx_unlock(&scene->mutex);
-   return bin;
+   return lp_scene_get_bin(scene, *x, *y);
 }
 
 
@@ -117,6 +117,21 @@ struct data_block_list {
 
 struct resource_ref;
 
+
+/**
+ * Bin dispenser state for one rasterizer thread.
+ *
+ * Each thread starts out on its own contiguous range of the scene's bin
+ * order and, once that is exhausted, steals bins from the other threads'
+ * ranges.  Bins are handed out by atomically incrementing 'next', so no
+ * lock is needed.  Padded to a cache line to avoid false sharing.
+ */
+struct lp_bin_range {
+   int next;   /**< index into bin_order of the next bin to hand out */
+   int end;    /**< one past the last index of this range */
+   uint8_t pad[64 - 2 * sizeof(int)];
+};
+
 /**
  * All bins and bin data are contained here.
  * Per-bin data goes into the 'tile' bins.
@@ -143,6 +158,8 @@ struct lp_scene {
       unsigned stride;
       unsigned layer_stride;
       unsigned format_bytes;
+      unsigned sample_stride;
+      unsigned nr_samples;
    } zsbuf, cbufs[PIPE_MAX_COLOR_BUFS];
 
    /* The amount of layers in the fb (minimum of all attachments) */
@@ -173,7 +190,21 @@ struct lp_scene {
     */
    unsigned tiles_x, tiles_y;
 
-   int curr_x, curr_y;  /**< for iterating over bins */
+   /**
+    * Order in which bins are rasterized, as x | y << 16.  Morton (Z-curve)
+    * order, so that bins close in this list are close on screen and the
+    * contiguous range each thread gets has good cache locality.
+    * Rebuilt only when the tile dimensions change.
+    */
+   uint32_t bin_order[TILES_X * TILES_Y];
+   unsigned num_bins;
+   unsigned bin_order_tiles_x, bin_order_tiles_y;
+
+   /** Per-thread bin ranges, for iterating over bins */
+   struct lp_bin_range bin_ranges[LP_MAX_THREADS];
+   unsigned num_bin_ranges;
+
+   /** Protects the scene's resource references and framebuffer state */
    mtx_t mutex;
 
    struct cmd_bin tile[TILES_X][TILES_Y];
@@ -197,10 +228,11 @@ struct cmd_block *lp_scene_new_cmd_block( struct lp_scene *scene,
 
 boolean lp_scene_add_resource_reference(struct lp_scene *scene,
                                         struct pipe_resource *resource,
-                                        boolean initializing_scene);
+                                        boolean initializing_scene,
+                                        boolean writeable);
 
-boolean lp_scene_is_resource_referenced(const struct lp_scene *scene,
-                                        const struct pipe_resource *resource );
+unsigned lp_scene_is_resource_referenced(struct lp_scene *scene,
+                                         const struct pipe_resource *resource );
 
 
 /**
@@ -379,10 +411,11 @@ lp_scene_get_num_bins( const struct lp_scene *scene )
 
 
 void
-lp_scene_bin_iter_begin( struct lp_scene *scene );
+lp_scene_bin_iter_begin( struct lp_scene *scene, unsigned num_threads );
 
 struct cmd_bin *
-lp_scene_bin_iter_next( struct lp_scene *scene, int *x, int *y );
+lp_scene_bin_iter_next( struct lp_scene *scene, unsigned thread,
+                        int *x, int *y );
 
 
 
@@ -32,10 +32,19 @@
 #include "util/u_format.h"
 #include "util/u_string.h"
 #include "util/u_format_s3tc.h"
+#include "util/u_atomic.h"
+#include "util/disk_cache.h"
+#include "util/crc32.h"
 #include "pipe/p_defines.h"
 #include "pipe/p_screen.h"
 #include "draw/draw_context.h"
 #include "gallivm/lp_bld_type.h"
+#include "gallivm/lp_bld_init.h"
+#include "gallivm/lp_bld_debug.h"
+#include "gallivm/lp_bld_code_cache.h"
+#include "gallivm/lp_bld_async.h"
+#include "gallivm/lp_bld_nir.h"
+#include "compiler/nir/nir.h"
 
 #include "os/os_misc.h"
 #include "util/os_time.h"
@@ -46,8 +55,10 @@
 #include "lp_context.h"
 #include "lp_debug.h"
 #include "lp_public.h"
+#include "lp_query.h"
 #include "lp_limits.h"
 #include "lp_rast.h"
+#include "lp_state_cs.h"
 
 #include "state_tracker/sw_winsys.h"
 
@@ -67,6 +78,7 @@ static const struct debug_named_value lp_debug_flags[] = {
    { "fence", DEBUG_FENCE, NULL },
    { "mem", DEBUG_MEM, NULL },
    { "fs", DEBUG_FS, NULL },
+   { "cache", DEBUG_CACHE, NULL },
    DEBUG_NAMED_VALUE_END
 };
 #endif
@@ -208,7 +220,13 @@ llvmpipe_get_param(struct pipe_screen *screen, enum pipe_cap param)
    case PIPE_CAP_QUADS_FOLLOW_PROVOKING_VERTEX_CONVENTION:
       return 0;
    case PIPE_CAP_COMPUTE:
+#ifdef LP_CS_HAVE_FIBERS
+      return 1;
+#else
       return 0;
+#endif
+   case PIPE_CAP_SHADER_BUFFER_OFFSET_ALIGNMENT:
+      return 4;
    case PIPE_CAP_USER_VERTEX_BUFFERS:
       return 1;
    case PIPE_CAP_VERTEX_BUFFER_OFFSET_4BYTE_ALIGNED_ONLY:
@@ -217,6 +235,8 @@ llvmpipe_get_param(struct pipe_screen *screen, enum pipe_cap param)
    case PIPE_CAP_TGSI_TEXCOORD:
       return 0;
    case PIPE_CAP_DRAW_INDIRECT:
+   case PIPE_CAP_MULTI_DRAW_INDIRECT:
+   case PIPE_CAP_MULTI_DRAW_INDIRECT_PARAMS:
       return 1;
 
    case PIPE_CAP_CUBE_MAP_ARRAY:
@@ -224,7 +244,7 @@ llvmpipe_get_param(struct pipe_screen *screen, enum pipe_cap param)
    case PIPE_CAP_CONSTANT_BUFFER_OFFSET_ALIGNMENT:
       return 16;
    case PIPE_CAP_TEXTURE_MULTISAMPLE:
-      return 0;
+      return 1;
    case PIPE_CAP_MIN_MAP_BUFFER_ALIGNMENT:
       return 64;
    case PIPE_CAP_TEXTURE_BUFFER_OBJECTS:
@@ -314,11 +334,8 @@ llvmpipe_get_param(struct pipe_screen *screen, enum pipe_cap param)
    case PIPE_CAP_SHAREABLE_SHADERS:
    case PIPE_CAP_DRAW_PARAMETERS:
    case PIPE_CAP_TGSI_PACK_HALF_FLOAT:
-   case PIPE_CAP_MULTI_DRAW_INDIRECT:
-   case PIPE_CAP_MULTI_DRAW_INDIRECT_PARAMS:
    case PIPE_CAP_TGSI_FS_POSITION_IS_SYSVAL:
    case PIPE_CAP_TGSI_FS_FACE_IS_INTEGER_SYSVAL:
-   case PIPE_CAP_SHADER_BUFFER_OFFSET_ALIGNMENT:
    case PIPE_CAP_INVALIDATE_BUFFER:
    case PIPE_CAP_GENERATE_MIPMAP:
    case PIPE_CAP_STRING_MARKER:
@@ -366,15 +383,69 @@ llvmpipe_get_param(struct pipe_screen *screen, enum pipe_cap param)
    return 0;
 }
 
+/* The NIR translator doesn't handle 64-bit types, images or every texture
+ * opcode yet; shaders using those are rejected by
+ * llvmpipe_is_nir_shader_supported() and passed as TGSI instead.  The draw
+ * module's AA line, AA point and polygon stipple stages still need TGSI
+ * fragment shaders and are skipped for NIR ones.
+ */
+DEBUG_GET_ONCE_BOOL_OPTION(nir, "LP_NIR", TRUE)
+
+/**
+ * Whether shaders of the given stage can be translated from NIR. Vertex
+ * shaders only if the draw module compiles them with LLVM too.
+ */
+static boolean
+llvmpipe_shader_takes_nir(enum pipe_shader_type shader)
+{
+   if (!debug_get_option_nir())
+      return FALSE;
+
+   switch (shader) {
+   case PIPE_SHADER_FRAGMENT:
+      return TRUE;
+   case PIPE_SHADER_VERTEX:
+      return debug_get_bool_option("DRAW_USE_LLVM", TRUE);
+   default:
+      return FALSE;
+   }
+}
+
+
 static int
 llvmpipe_get_shader_param(struct pipe_screen *screen,
                           enum pipe_shader_type shader,
                           enum pipe_shader_cap param)
 {
+   if (llvmpipe_shader_takes_nir(shader)) {
+      switch (param) {
+      case PIPE_SHADER_CAP_PREFERRED_IR:
+         return PIPE_SHADER_IR_NIR;
+      case PIPE_SHADER_CAP_SUPPORTED_IRS:
+         return (1 << PIPE_SHADER_IR_TGSI) | (1 << PIPE_SHADER_IR_NIR);
+      default:
+         break;
+      }
+   }
+
    switch(shader)
    {
    case PIPE_SHADER_FRAGMENT:
       switch (param) {
+      case PIPE_SHADER_CAP_MAX_SHADER_BUFFERS:
+         return LP_MAX_SHADER_BUFFERS;
+      default:
+         return gallivm_get_shader_param(param);
+      }
+   case PIPE_SHADER_COMPUTE:
+      switch (param) {
+      case PIPE_SHADER_CAP_MAX_SHADER_BUFFERS:
+         return LP_MAX_SHADER_BUFFERS;
+      case PIPE_SHADER_CAP_MAX_SHADER_IMAGES:
+         return LP_MAX_SHADER_IMAGES;
+      case PIPE_SHADER_CAP_MAX_INPUTS:
+      case PIPE_SHADER_CAP_MAX_OUTPUTS:
+         return 0;
       default:
          return gallivm_get_shader_param(param);
       }
@@ -403,6 +474,88 @@ llvmpipe_get_shader_param(struct pipe_screen *screen,
    }
 }
 
+static const void *
+llvmpipe_get_compiler_options(struct pipe_screen *screen,
+                              enum pipe_shader_ir ir,
+                              enum pipe_shader_type shader)
+{
+   assert(ir == PIPE_SHADER_IR_NIR);
+   return &lp_build_nir_options;
+}
+
+static boolean
+llvmpipe_is_nir_shader_supported(struct pipe_screen *screen,
+                                 enum pipe_shader_type shader,
+                                 const void *ir)
+{
+   struct nir_shader *nir;
+   boolean supported;
+
+   /* Check what lp_build_nir_soa() will see, without touching the caller's
+    * shader.
+    */
+   nir = nir_shader_clone(NULL, (const struct nir_shader *)ir);
+   lp_build_nir_prepare(nir);
+   supported = lp_build_nir_check(nir);
+   ralloc_free(nir);
+
+   return supported;
+}
+
+static int
+llvmpipe_get_compute_param(struct pipe_screen *_screen,
+                           enum pipe_shader_ir ir_type,
+                           enum pipe_compute_cap param,
+                           void *ret)
+{
+   switch (param) {
+   case PIPE_COMPUTE_CAP_IR_TARGET:
+      return 0;
+   case PIPE_COMPUTE_CAP_MAX_GRID_SIZE:
+      if (ret) {
+         uint64_t *grid_size = ret;
+         grid_size[0] = 65535;
+         grid_size[1] = 65535;
+         grid_size[2] = 65535;
+      }
+      return 3 * sizeof(uint64_t);
+   case PIPE_COMPUTE_CAP_MAX_BLOCK_SIZE:
+      if (ret) {
+         uint64_t *block_size = ret;
+         block_size[0] = LP_MAX_CS_THREADS_PER_BLOCK;
+         block_size[1] = LP_MAX_CS_THREADS_PER_BLOCK;
+         block_size[2] = LP_MAX_CS_THREADS_PER_BLOCK;
+      }
+      return 3 * sizeof(uint64_t);
+   case PIPE_COMPUTE_CAP_MAX_THREADS_PER_BLOCK:
+      if (ret) {
+         uint64_t *max_threads_per_block = ret;
+         *max_threads_per_block = LP_MAX_CS_THREADS_PER_BLOCK;
+      }
+      return sizeof(uint64_t);
+   case PIPE_COMPUTE_CAP_MAX_LOCAL_SIZE:
+      if (ret) {
+         uint64_t *max_local_size = ret;
+         *max_local_size = LP_MAX_CS_SHARED_SIZE;
+      }
+      return sizeof(uint64_t);
+   case PIPE_COMPUTE_CAP_GRID_DIMENSION:
+   case PIPE_COMPUTE_CAP_MAX_GLOBAL_SIZE:
+   case PIPE_COMPUTE_CAP_MAX_PRIVATE_SIZE:
+   case PIPE_COMPUTE_CAP_MAX_INPUT_SIZE:
+   case PIPE_COMPUTE_CAP_MAX_MEM_ALLOC_SIZE:
+   case PIPE_COMPUTE_CAP_MAX_CLOCK_FREQUENCY:
+   case PIPE_COMPUTE_CAP_MAX_COMPUTE_UNITS:
+   case PIPE_COMPUTE_CAP_IMAGES_SUPPORTED:
+   case PIPE_COMPUTE_CAP_SUBGROUP_SIZE:
+   case PIPE_COMPUTE_CAP_ADDRESS_BITS:
+   case PIPE_COMPUTE_CAP_MAX_VARIABLE_THREADS_PER_BLOCK:
+      break;
+   }
+   return 0;
+}
+
+
 static float
 llvmpipe_get_paramf(struct pipe_screen *screen, enum pipe_capf param)
 {
@@ -461,8 +614,23 @@ llvmpipe_is_format_supported( struct pipe_screen *_screen,
           target == PIPE_TEXTURE_CUBE ||
           target == PIPE_TEXTURE_CUBE_ARRAY);
 
-   if (sample_count > 1)
-      return FALSE;
+   if (sample_count > 1) {
+      /* Only 4x, and only for what the rasterizer and the sampler handle */
+      if (sample_count != LP_MAX_SAMPLES)
+         return FALSE;
+
+      if (target != PIPE_TEXTURE_2D &&
+          target != PIPE_TEXTURE_2D_ARRAY)
+         return FALSE;
+
+      if (bind & ~(PIPE_BIND_RENDER_TARGET |
+                   PIPE_BIND_DEPTH_STENCIL |
+                   PIPE_BIND_SAMPLER_VIEW))
+         return FALSE;
+
+      if (util_format_is_compressed(format))
+         return FALSE;
+   }
 
    if (bind & PIPE_BIND_RENDER_TARGET) {
       if (format_desc->colorspace == UTIL_FORMAT_COLORSPACE_SRGB) {
@@ -521,16 +689,6 @@ llvmpipe_is_format_supported( struct pipe_screen *_screen,
       }
    }
 
-   if (format_desc->layout == UTIL_FORMAT_LAYOUT_BPTC ||
-       format_desc->layout == UTIL_FORMAT_LAYOUT_ASTC) {
-      /* Software decoding is not hooked up. */
-      return FALSE;
-   }
-
-   if (format_desc->layout == UTIL_FORMAT_LAYOUT_ETC &&
-       format != PIPE_FORMAT_ETC1_RGB8)
-      return FALSE;
-
    /*
     * Everything can be supported by u_format
     * (those without fetch_rgba_float might be not but shouldn't hit that)
@@ -540,6 +698,33 @@ llvmpipe_is_format_supported( struct pipe_screen *_screen,
 }
 
 
+static int
+llvmpipe_get_driver_query_info(struct pipe_screen *screen,
+                               unsigned index,
+                               struct pipe_driver_query_info *info)
+{
+#define QUERY(NAME, ENUM, UNITS) \
+   {NAME, ENUM, {0}, UNITS, PIPE_DRIVER_QUERY_RESULT_TYPE_AVERAGE, 0, 0x0}
+
+   static const struct pipe_driver_query_info queries[] = {
+      QUERY("pending-compiles", LP_QUERY_PENDING_COMPILES,
+            PIPE_DRIVER_QUERY_TYPE_UINT64),
+      QUERY("async-compiles", LP_QUERY_ASYNC_COMPILES,
+            PIPE_DRIVER_QUERY_TYPE_UINT64),
+   };
+#undef QUERY
+
+   if (!info)
+      return ARRAY_SIZE(queries);
+
+   if (index >= ARRAY_SIZE(queries))
+      return 0;
+
+   *info = queries[index];
+   return 1;
+}
+
+
 
 
 static void
@@ -567,19 +752,171 @@ llvmpipe_destroy_screen( struct pipe_screen *_screen )
    if (screen->rast)
       lp_rast_destroy(screen->rast);
 
+   lp_async_compiler_destroy(screen->async_compiler);
+
+   if (LP_DEBUG & DEBUG_CACHE) {
+      unsigned hits, misses, evictions;
+
+      lp_code_cache_get_stats(screen->code_cache, &hits, &misses, &evictions);
+      debug_printf("llvmpipe: shared code cache: %u hits, %u misses, "
+                   "%u evictions\n", hits, misses, evictions);
+      debug_printf("llvmpipe: disk shader cache: %u hits, %u misses, "
+                   "%.1f ms of compilation saved\n",
+                   screen->num_disk_shader_cache_hits,
+                   screen->num_disk_shader_cache_misses,
+                   screen->disk_shader_cache_time_saved / 1000.0);
+   }
+   lp_code_cache_destroy(screen->code_cache);
+
    lp_jit_screen_cleanup(screen);
 
+   disk_cache_destroy(screen->disk_shader_cache);
+
    if(winsys->destroy)
       winsys->destroy(winsys);
 
    mtx_destroy(&screen->rast_mutex);
 
+   slab_destroy_parent(&screen->pool_transfers);
+
    FREE(screen);
 }
 
 
 
 
+/**
+ * Header of a disk cache entry, followed by the object code.
+ */
+struct lp_disk_cache_entry_header {
+   int64_t compile_time;   /**< usecs it took to generate the code */
+};
+
+
+/**
+ * Create the disk cache for JIT object code.  Besides the Mesa and LLVM
+ * builds, the code depends on the CPU features and vector width used for
+ * code generation, as well as on flags which change the generated code.
+ */
+static void
+lp_disk_cache_create(struct llvmpipe_screen *screen)
+{
+   uint32_t mesa_timestamp, llvm_timestamp;
+   uint32_t cpu_hash;
+   uint64_t driver_flags;
+   char timestamp[64];
+   char renderer[64];
+
+   if (!disk_cache_get_function_timestamp(lp_disk_cache_create,
+                                          &mesa_timestamp) ||
+       !disk_cache_get_function_timestamp(LLVMLinkInMCJIT,
+                                          &llvm_timestamp))
+      return;
+
+   /* lp_build_init() has already trimmed the caps to what codegen uses.
+    * Skip the topology fields, which don't affect the code.
+    */
+   cpu_hash = util_hash_crc32(&util_cpu_caps.x86_cpu_type,
+                              sizeof(util_cpu_caps) -
+                              offsetof(struct util_cpu_caps, x86_cpu_type));
+
+   util_snprintf(timestamp, sizeof(timestamp), "%u_%u",
+                 mesa_timestamp, llvm_timestamp);
+   util_snprintf(renderer, sizeof(renderer), "llvmpipe-%u-%08x",
+                 lp_native_vector_width, cpu_hash);
+
+   driver_flags = ((uint64_t) gallivm_debug << 32) | (uint32_t) LP_PERF;
+
+   screen->disk_shader_cache = disk_cache_create(renderer, timestamp,
+                                                 driver_flags);
+}
+
+
+/**
+ * Look up previously compiled object code for the IR described by
+ * ir_sha1_cache_key.  On a hit the code is placed in cache->data, which
+ * the caller must free().
+ */
+void
+lp_disk_cache_find_shader(struct llvmpipe_screen *screen,
+                          struct lp_cached_code *cache,
+                          unsigned char ir_sha1_cache_key[20])
+{
+   const struct lp_disk_cache_entry_header *header;
+   cache_key sha1;
+   size_t size;
+   void *entry;
+
+   if (!screen->disk_shader_cache)
+      return;
+
+   disk_cache_compute_key(screen->disk_shader_cache, ir_sha1_cache_key, 20,
+                          sha1);
+   entry = disk_cache_get(screen->disk_shader_cache, sha1, &size);
+   if (!entry || size <= sizeof *header) {
+      free(entry);
+      p_atomic_inc(&screen->num_disk_shader_cache_misses);
+      return;
+   }
+
+   header = (const struct lp_disk_cache_entry_header *) entry;
+   cache->data_size = size - sizeof *header;
+   cache->data = malloc(cache->data_size);
+   if (!cache->data) {
+      cache->data_size = 0;
+      free(entry);
+      p_atomic_inc(&screen->num_disk_shader_cache_misses);
+      return;
+   }
+   memcpy(cache->data, header + 1, cache->data_size);
+
+   p_atomic_inc(&screen->num_disk_shader_cache_hits);
+   p_atomic_add(&screen->disk_shader_cache_time_saved, header->compile_time);
+   free(entry);
+}
+
+
+/**
+ * Store newly compiled object code, unless it embeds process-specific
+ * addresses.  The cache makes its own copy of the data.
+ */
+void
+lp_disk_cache_insert_shader(struct llvmpipe_screen *screen,
+                            struct lp_cached_code *cache,
+                            unsigned char ir_sha1_cache_key[20])
+{
+   struct lp_disk_cache_entry_header *header;
+   cache_key sha1;
+   size_t size;
+
+   if (!screen->disk_shader_cache || !cache->data_size || cache->dont_cache)
+      return;
+
+   size = sizeof *header + cache->data_size;
+   header = malloc(size);
+   if (!header)
+      return;
+
+   header->compile_time = cache->compile_time;
+   memcpy(header + 1, cache->data, cache->data_size);
+
+   disk_cache_compute_key(screen->disk_shader_cache, ir_sha1_cache_key, 20,
+                          sha1);
+   disk_cache_put(screen->disk_shader_cache, sha1, header, size, NULL);
+   free(header);
+}
+
+
+static void
+lp_async_cache_insert_shader(void *cookie,
+                             struct lp_cached_code *cache,
+                             unsigned char ir_sha1_cache_key[20])
+{
+   lp_disk_cache_insert_shader((struct llvmpipe_screen *) cookie, cache,
+                               ir_sha1_cache_key);
+}
+
+
 /**
  * Fence reference counting.
  */
@@ -627,6 +964,7 @@ struct pipe_screen *
 llvmpipe_create_screen(struct sw_winsys *winsys)
 {
    struct llvmpipe_screen *screen;
+   unsigned num_compile_threads;
 
    util_cpu_detect();
 
@@ -655,6 +993,9 @@ llvmpipe_create_screen(struct sw_winsys *winsys)
    screen->base.get_param = llvmpipe_get_param;
    screen->base.get_shader_param = llvmpipe_get_shader_param;
    screen->base.get_paramf = llvmpipe_get_paramf;
+   screen->base.get_compute_param = llvmpipe_get_compute_param;
+   screen->base.get_compiler_options = llvmpipe_get_compiler_options;
+   screen->base.is_nir_shader_supported = llvmpipe_is_nir_shader_supported;
    screen->base.is_format_supported = llvmpipe_is_format_supported;
 
    screen->base.context_create = llvmpipe_create_context;
@@ -663,6 +1004,7 @@ llvmpipe_create_screen(struct sw_winsys *winsys)
    screen->base.fence_finish = llvmpipe_fence_finish;
 
    screen->base.get_timestamp = llvmpipe_get_timestamp;
+   screen->base.get_driver_query_info = llvmpipe_get_driver_query_info;
 
    llvmpipe_init_screen_resource_funcs(&screen->base);
 
@@ -679,7 +1021,33 @@ llvmpipe_create_screen(struct sw_winsys *winsys)
       FREE(screen);
       return NULL;
    }
+
+   screen->code_cache = lp_code_cache_create(LP_MAX_SHARED_VARIANTS);
+   if (!screen->code_cache) {
+      lp_rast_destroy(screen->rast);
+      lp_jit_screen_cleanup(screen);
+      FREE(screen);
+      return NULL;
+   }
+
+   num_compile_threads = util_cpu_caps.nr_cpus > 1 ?
+      MIN2(util_cpu_caps.nr_cpus - 1, 2) : 0;
+#ifdef PIPE_SUBSYSTEM_EMBEDDED
+   num_compile_threads = 0;
+#endif
+   num_compile_threads = debug_get_num_option("LP_COMPILE_THREADS",
+                                              num_compile_threads);
+   num_compile_threads = MIN2(num_compile_threads, LP_MAX_COMPILE_THREADS);
+   /* Without threads, variants just get compiled on the spot. */
+   screen->async_compiler =
+      lp_async_compiler_create(num_compile_threads, screen->code_cache,
+                               lp_async_cache_insert_shader, screen);
    (void) mtx_init(&screen->rast_mutex, mtx_plain);
 
+   slab_create_parent(&screen->pool_transfers,
+                      sizeof(struct llvmpipe_transfer), 64);
+
+   lp_disk_cache_create(screen);
+
    return &screen->base;
 }
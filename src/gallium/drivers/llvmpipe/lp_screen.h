@@ -37,10 +37,15 @@
 #include "pipe/p_screen.h"
 #include "pipe/p_defines.h"
 #include "os/os_thread.h"
+#include "util/slab.h"
 #include "gallivm/lp_bld.h"
 
 
 struct sw_winsys;
+struct disk_cache;
+struct lp_cached_code;
+struct lp_code_cache;
+struct lp_async_compiler;
 
 
 struct llvmpipe_screen
@@ -57,6 +62,21 @@ struct llvmpipe_screen
 
    struct lp_rasterizer *rast;
    mtx_t rast_mutex;
+
+   /* Persistent cache of JIT object code, shared by all contexts. */
+   struct disk_cache *disk_shader_cache;
+   unsigned num_disk_shader_cache_hits;
+   unsigned num_disk_shader_cache_misses;
+   int64_t disk_shader_cache_time_saved; /**< usecs of compilation skipped */
+
+   /* JIT-compiled code shared by all contexts. */
+   struct lp_code_cache *code_cache;
+
+   /* Compiler threads optimizing new shader variants in the background. */
+   struct lp_async_compiler *async_compiler;
+
+   /* Parent pool for the threaded contexts' transfers. */
+   struct slab_parent_pool pool_transfers;
 };
 
 
@@ -69,5 +89,16 @@ llvmpipe_screen( struct pipe_screen *pipe )
 }
 
 
+void
+lp_disk_cache_find_shader(struct llvmpipe_screen *screen,
+                          struct lp_cached_code *cache,
+                          unsigned char ir_sha1_cache_key[20]);
+
+void
+lp_disk_cache_insert_shader(struct llvmpipe_screen *screen,
+                            struct lp_cached_code *cache,
+                            unsigned char ir_sha1_cache_key[20]);
+
+
 
 #endif /* LP_SCREEN_H */
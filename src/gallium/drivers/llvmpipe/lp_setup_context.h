@@ -49,14 +49,18 @@
 #define LP_SETUP_NEW_BLEND_COLOR 0x04
 #define LP_SETUP_NEW_SCISSOR     0x08
 #define LP_SETUP_NEW_VIEWPORTS   0x10
+#define LP_SETUP_NEW_SSBOS       0x20
 
 
 struct lp_setup_variant;
 
 
-/** Max number of scenes */
-/* XXX: make multiple scenes per context work, see lp_setup_rasterize_scene */
-#define MAX_SCENES 1
+/** Max number of scenes.
+ * While the rasterizer threads work on one scene the setup module can
+ * bin the next ones.  The actual number used can be lowered with the
+ * LP_NUM_SCENES env var.
+ */
+#define MAX_SCENES 4
 
 
 
@@ -87,6 +91,7 @@ struct lp_setup_context
     */
    struct draw_stage *vbuf;
    unsigned num_threads;
+   unsigned num_scenes;
    unsigned scene_idx;
    struct lp_scene *scenes[MAX_SCENES];  /**< all the scenes */
    struct lp_scene *scene;               /**< current scene being built */
@@ -100,6 +105,8 @@ struct lp_setup_context
    boolean scissor_test;
    boolean point_size_per_vertex;
    boolean rasterizer_discard;
+   boolean multisample_enable;  /**< rasterizer multisample state */
+   boolean multisample;         /**< ... and the framebuffer is multisampled */
    unsigned cullmode;
    unsigned bottom_edge_rule;
    float pixel_offset;
@@ -143,6 +150,11 @@ struct lp_setup_context
       const void *stored_data;
    } constants[LP_MAX_TGSI_CONST_BUFFERS];
 
+   /** fragment shader storage buffers */
+   struct {
+      struct pipe_shader_buffer current;
+   } ssbos[LP_MAX_SHADER_BUFFERS];
+
    struct {
       struct pipe_blend_color current;
       uint8_t *stored;
@@ -204,6 +204,19 @@ lp_rast_32_tri_tab[MAX_PLANES+1] = {
    LP_RAST_OP_TRIANGLE_32_8
 };
 
+static unsigned
+lp_rast_ms_tri_tab[MAX_PLANES+1] = {
+   0,               /* should be impossible */
+   LP_RAST_OP_MS_TRIANGLE_1,
+   LP_RAST_OP_MS_TRIANGLE_2,
+   LP_RAST_OP_MS_TRIANGLE_3,
+   LP_RAST_OP_MS_TRIANGLE_4,
+   LP_RAST_OP_MS_TRIANGLE_5,
+   LP_RAST_OP_MS_TRIANGLE_6,
+   LP_RAST_OP_MS_TRIANGLE_7,
+   LP_RAST_OP_MS_TRIANGLE_8
+};
+
 
 
 /**
@@ -384,6 +397,7 @@ do_triangle_ccw(struct lp_setup_context *setup,
    tri->inputs.frontfacing = frontfacing;
    tri->inputs.disable = FALSE;
    tri->inputs.opaque = setup->fs.current.variant->opaque;
+   tri->inputs.multisample = setup->multisample;
    tri->inputs.layer = layer;
    tri->inputs.viewport_index = viewport_index;
 
@@ -685,11 +699,16 @@ do_triangle_ccw(struct lp_setup_context *setup,
    if (nr_planes > 3) {
       /* why not just use draw_regions */
       struct lp_rast_plane *plane_s = &plane[3];
+      /*
+       * The multisample rasterizer evaluates the planes at sample
+       * positions strictly inside the pixels, not at the pixel corners.
+       */
+      const int c_adj = setup->multisample ? 0 : 1;
 
       if (s_planes[0]) {
          plane_s->dcdx = -1 << 8;
          plane_s->dcdy = 0;
-         plane_s->c = (1-scissor->x0) << 8;
+         plane_s->c = (c_adj-scissor->x0) << 8;
          plane_s->eo = 1 << 8;
          plane_s++;
       }
@@ -703,7 +722,7 @@ do_triangle_ccw(struct lp_setup_context *setup,
       if (s_planes[2]) {
          plane_s->dcdx = 0;
          plane_s->dcdy = 1 << 8;
-         plane_s->c = (1-scissor->y0) << 8;
+         plane_s->c = (c_adj-scissor->y0) << 8;
          plane_s->eo = 1 << 8;
          plane_s++;
       }
@@ -779,6 +798,8 @@ lp_setup_bin_triangle(struct lp_setup_context *setup,
    int max_szorig = ((bboxorig->x1 - (bboxorig->x0 & ~3)) |
                      (bboxorig->y1 - (bboxorig->y0 & ~3)));
    boolean use_32bits = max_szorig <= MAX_FIXED_LENGTH32;
+   const unsigned *tri_tab = tri->inputs.multisample ? lp_rast_ms_tri_tab :
+                             use_32bits ? lp_rast_32_tri_tab : lp_rast_tri_tab;
 
    /* Now apply scissor, etc to the bounding box.  Could do this
     * earlier, but it confuses the logic for tri-16 and would force
@@ -800,7 +821,10 @@ lp_setup_bin_triangle(struct lp_setup_context *setup,
       assert(iy0 == bbox->y1 / TILE_SIZE &&
 	     ix0 == bbox->x1 / TILE_SIZE);
 
-      if (nr_planes == 3) {
+      if (tri->inputs.multisample) {
+         /* No special cases for small triangles */
+      }
+      else if (nr_planes == 3) {
          if (sz < 4)
          {
             /* Triangle is contained in a single 4x4 stamp:
@@ -860,7 +884,7 @@ lp_setup_bin_triangle(struct lp_setup_context *setup,
        */
       return lp_scene_bin_cmd_with_state(
          scene, ix0, iy0, setup->fs.stored,
-         use_32bits ? lp_rast_32_tri_tab[nr_planes] : lp_rast_tri_tab[nr_planes],
+         tri_tab[nr_planes],
          lp_rast_arg_triangle(tri, (1<<nr_planes)-1));
    }
    else
@@ -935,9 +959,7 @@ lp_setup_bin_triangle(struct lp_setup_context *setup,
                
                if (!lp_scene_bin_cmd_with_state( scene, x, y,
                                                  setup->fs.stored,
-                                                 use_32bits ?
-                                                 lp_rast_32_tri_tab[count] :
-                                                 lp_rast_tri_tab[count],
+                                                 tri_tab[count],
                                                  lp_rast_arg_triangle(tri, partial) ))
                   goto fail;
 
@@ -1007,6 +1029,12 @@ calc_fixed_position(struct lp_setup_context *setup,
                     const float (*v1)[4],
                     const float (*v2)[4])
 {
+   /*
+    * With multisampling, coverage is evaluated at sample positions relative
+    * to the pixel corners rather than at the pixel centers.
+    */
+   const float pixel_offset = setup->multisample ? setup->pixel_offset - 0.5f :
+                                                   setup->pixel_offset;
    /*
     * The rounding may not be quite the same with PIPE_ARCH_SSE
     * (util_iround right now only does nearest/even on x87,
@@ -1018,7 +1046,7 @@ calc_fixed_position(struct lp_setup_context *setup,
    __m128 vxy0xy2, vxy1xy0;
    __m128i vxy0xy2i, vxy1xy0i;
    __m128i dxdy0120, x0x2y0y2, x1x0y1y0, x0120, y0120;
-   __m128 pix_offset = _mm_set1_ps(setup->pixel_offset);
+   __m128 pix_offset = _mm_set1_ps(pixel_offset);
    __m128 fixed_one = _mm_set1_ps((float)FIXED_ONE);
    v0r = _mm_castpd_ps(_mm_load_sd((double *)v0[0]));
    vxy0xy2 = _mm_loadh_pi(v0r, (__m64 *)v2[0]);
@@ -1044,14 +1072,14 @@ calc_fixed_position(struct lp_setup_context *setup,
    _mm_store_si128((__m128i *)&position->y[0], y0120);
 
 #else
-   position->x[0] = subpixel_snap(v0[0][0] - setup->pixel_offset);
-   position->x[1] = subpixel_snap(v1[0][0] - setup->pixel_offset);
-   position->x[2] = subpixel_snap(v2[0][0] - setup->pixel_offset);
+   position->x[0] = subpixel_snap(v0[0][0] - pixel_offset);
+   position->x[1] = subpixel_snap(v1[0][0] - pixel_offset);
+   position->x[2] = subpixel_snap(v2[0][0] - pixel_offset);
    position->x[3] = 0; // should be unused
 
-   position->y[0] = subpixel_snap(v0[0][1] - setup->pixel_offset);
-   position->y[1] = subpixel_snap(v1[0][1] - setup->pixel_offset);
-   position->y[2] = subpixel_snap(v2[0][1] - setup->pixel_offset);
+   position->y[0] = subpixel_snap(v0[0][1] - pixel_offset);
+   position->y[1] = subpixel_snap(v1[0][1] - pixel_offset);
+   position->y[2] = subpixel_snap(v2[0][1] - pixel_offset);
    position->y[3] = 0; // should be unused
 
    position->dx01 = position->x[0] - position->x[1];
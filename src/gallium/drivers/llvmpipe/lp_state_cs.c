@@ -0,0 +1,1059 @@
+/**************************************************************************
+ *
+ * Copyright 2010 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * @file
+ * Compute shaders.
+ *
+ * A compute shader variant is a function running one SoA vector's worth of
+ * invocations of a workgroup.  launch_grid hands the workgroups out to a
+ * pool of threads (lp_cs_tpool.c), and each thread calls the function once
+ * per vector of invocations of its workgroup.
+ *
+ * Shaders with barriers can't simply run the vectors one after the other,
+ * since all the invocations of the workgroup must reach a barrier before
+ * any of them continues.  Each vector then runs as a fiber with its own
+ * stack, and a barrier switches to the next fiber of the workgroup.  The
+ * fibers are resumed round-robin, so when the first one resumes past a
+ * barrier all the others have reached it.
+ */
+
+#include <limits.h>
+#include "pipe/p_defines.h"
+#include "util/u_inlines.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "util/u_pointer.h"
+#include "util/u_format.h"
+#include "util/u_string.h"
+#include "pipe/p_shader_tokens.h"
+#include "tgsi/tgsi_dump.h"
+#include "tgsi/tgsi_parse.h"
+#include "draw/draw_context.h"
+#include "gallivm/lp_bld_type.h"
+#include "gallivm/lp_bld_const.h"
+#include "gallivm/lp_bld_init.h"
+#include "gallivm/lp_bld_intr.h"
+#include "gallivm/lp_bld_logic.h"
+#include "gallivm/lp_bld_tgsi.h"
+#include "gallivm/lp_bld_flow.h"
+#include "gallivm/lp_bld_debug.h"
+#include "gallivm/lp_bld_struct.h"
+
+#include "lp_context.h"
+#include "lp_cs_tpool.h"
+#include "lp_debug.h"
+#include "lp_flush.h"
+#include "lp_screen.h"
+#include "lp_setup.h"
+#include "lp_state.h"
+#include "lp_state_cs.h"
+#include "lp_tex_sample.h"
+#include "lp_texture.h"
+
+#ifdef LP_CS_HAVE_FIBERS
+#include <ucontext.h>
+#endif
+
+
+/** Variants kept per compute shader */
+#define LP_MAX_CS_VARIANTS 32
+
+
+static unsigned cs_no = 0;
+
+
+/**
+ * Compute shader memory interface: shader storage buffers, shared memory,
+ * images and barriers.
+ */
+struct lp_cs_mem_iface
+{
+   struct lp_build_tgsi_mem_iface base;
+   const struct lp_compute_shader_variant_key *key;
+   LLVMValueRef context_ptr;
+   LLVMValueRef thread_data_ptr;
+};
+
+
+static void
+cs_mem_buffer(const struct lp_build_tgsi_mem_iface *iface,
+              struct gallivm_state *gallivm,
+              LLVMValueRef index,
+              LLVMValueRef *base_ptr,
+              LLVMValueRef *size)
+{
+   const struct lp_cs_mem_iface *cs_iface =
+      (const struct lp_cs_mem_iface *)iface;
+
+   lp_jit_buffer_lookup(gallivm,
+                        lp_jit_cs_context_ssbos(gallivm, cs_iface->context_ptr),
+                        lp_jit_cs_context_num_ssbos(gallivm,
+                                                    cs_iface->context_ptr),
+                        index, base_ptr, size);
+}
+
+
+static void
+cs_mem_shared(const struct lp_build_tgsi_mem_iface *iface,
+              struct gallivm_state *gallivm,
+              LLVMValueRef *base_ptr,
+              LLVMValueRef *size)
+{
+   const struct lp_cs_mem_iface *cs_iface =
+      (const struct lp_cs_mem_iface *)iface;
+
+   *base_ptr = lp_jit_cs_thread_data_shared(gallivm,
+                                            cs_iface->thread_data_ptr);
+   *size = lp_jit_cs_thread_data_shared_size(gallivm,
+                                             cs_iface->thread_data_ptr);
+}
+
+
+static void
+cs_mem_image(const struct lp_build_tgsi_mem_iface *iface,
+             struct gallivm_state *gallivm,
+             unsigned unit,
+             struct lp_build_image_layout *layout)
+{
+   const struct lp_cs_mem_iface *cs_iface =
+      (const struct lp_cs_mem_iface *)iface;
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef indices[2];
+   LLVMValueRef ptr;
+
+   if (unit >= cs_iface->key->nr_images ||
+       cs_iface->key->image_format[unit] == PIPE_FORMAT_NONE)
+      return;
+
+   indices[0] = lp_build_const_int32(gallivm, 0);
+   indices[1] = lp_build_const_int32(gallivm, unit);
+   ptr = LLVMBuildGEP(builder,
+                      lp_jit_cs_context_images(gallivm, cs_iface->context_ptr),
+                      indices, ARRAY_SIZE(indices), "");
+
+   layout->format = cs_iface->key->image_format[unit];
+   layout->base_ptr = lp_build_struct_get(gallivm, ptr, LP_JIT_IMAGE_BASE,
+                                          "image_base");
+   layout->width = lp_build_struct_get(gallivm, ptr, LP_JIT_IMAGE_WIDTH,
+                                       "image_width");
+   layout->height = lp_build_struct_get(gallivm, ptr, LP_JIT_IMAGE_HEIGHT,
+                                        "image_height");
+   layout->depth = lp_build_struct_get(gallivm, ptr, LP_JIT_IMAGE_DEPTH,
+                                       "image_depth");
+   layout->row_stride = lp_build_struct_get(gallivm, ptr,
+                                            LP_JIT_IMAGE_ROW_STRIDE,
+                                            "image_row_stride");
+   layout->img_stride = lp_build_struct_get(gallivm, ptr,
+                                            LP_JIT_IMAGE_IMG_STRIDE,
+                                            "image_img_stride");
+}
+
+
+#ifdef LP_CS_HAVE_FIBERS
+
+/**
+ * One vector of invocations of a workgroup with barriers.
+ */
+struct lp_cs_fiber
+{
+   /* Must be first, the jit code only knows about this part */
+   struct lp_jit_cs_thread_data thread_data;
+
+   ucontext_t context;
+   ucontext_t *scheduler;
+
+   const struct lp_cs_job *job;
+   unsigned x, y, z;
+   unsigned first_invocation;
+   boolean done;
+};
+
+
+/**
+ * Called by the jit code at a barrier: give the other fibers of the
+ * workgroup a chance to get there.
+ */
+static void
+lp_cs_barrier(struct lp_jit_cs_thread_data *thread_data)
+{
+   struct lp_cs_fiber *fiber = (struct lp_cs_fiber *) thread_data;
+
+   swapcontext(&fiber->context, fiber->scheduler);
+}
+
+#endif /* LP_CS_HAVE_FIBERS */
+
+
+static void
+cs_mem_barrier(const struct lp_build_tgsi_mem_iface *iface,
+               struct gallivm_state *gallivm)
+{
+#ifdef LP_CS_HAVE_FIBERS
+   const struct lp_cs_mem_iface *cs_iface =
+      (const struct lp_cs_mem_iface *)iface;
+   LLVMTypeRef arg_type = LLVMTypeOf(cs_iface->thread_data_ptr);
+   LLVMValueRef args[1];
+   LLVMValueRef func;
+
+   func = lp_build_const_func_pointer(gallivm,
+                                      func_to_pointer((func_pointer)
+                                                      lp_cs_barrier),
+                                      LLVMVoidTypeInContext(gallivm->context),
+                                      &arg_type, 1, "lp_cs_barrier");
+   args[0] = cs_iface->thread_data_ptr;
+   LLVMBuildCall(gallivm->builder, func, args, ARRAY_SIZE(args), "");
+#else
+   /* Never reached, compute shaders aren't exposed without fibers. */
+   assert(0);
+#endif
+}
+
+
+/**
+ * Generate the compute shader function.  Any change to the prototype must
+ * be reflected in lp_jit.h's lp_jit_cs_func, and vice-versa.
+ */
+static void
+generate_compute(struct llvmpipe_context *lp,
+                 struct lp_compute_shader *shader,
+                 struct lp_compute_shader_variant *variant)
+{
+   struct gallivm_state *gallivm = variant->gallivm;
+   const struct lp_compute_shader_variant_key *key = &variant->key;
+   LLVMContextRef lc = gallivm->context;
+   LLVMTypeRef int32_type = LLVMInt32TypeInContext(lc);
+   LLVMTypeRef arg_types[12];
+   LLVMTypeRef func_type;
+   LLVMValueRef function;
+   LLVMValueRef context_ptr, thread_data_ptr;
+   LLVMValueRef block_id[3], grid_size[3], block_size[3];
+   LLVMValueRef first_invocation;
+   LLVMValueRef consts_ptr, num_consts_ptr;
+   LLVMValueRef invocation, num_invocations, mask_val, tmp;
+   LLVMValueRef lane_ids[LP_MAX_VECTOR_LENGTH];
+   LLVMValueRef outputs[PIPE_MAX_SHADER_OUTPUTS][TGSI_NUM_CHANNELS];
+   LLVMBasicBlockRef block;
+   LLVMBuilderRef builder;
+   struct lp_type cs_type;
+   struct lp_build_context uint_bld;
+   struct lp_build_mask_context mask;
+   struct lp_build_sampler_soa *sampler;
+   struct lp_bld_tgsi_system_values system_values;
+   struct lp_cs_mem_iface mem_iface;
+   unsigned i;
+
+   memset(&cs_type, 0, sizeof cs_type);
+   cs_type.floating = TRUE;      /* floating point values */
+   cs_type.sign = TRUE;          /* values are signed */
+   cs_type.norm = FALSE;         /* values are not limited to [0,1] or [-1,1] */
+   cs_type.width = 32;           /* 32-bit float */
+   cs_type.length = MIN2(lp_native_vector_width / 32, 16); /* n*4 elements per vector */
+
+   arg_types[0] = variant->jit_cs_context_ptr_type;       /* context */
+   for (i = 1; i <= 10; i++)
+      arg_types[i] = int32_type;                          /* ids and sizes */
+   arg_types[11] = variant->jit_cs_thread_data_ptr_type;  /* per thread data */
+
+   func_type = LLVMFunctionType(LLVMVoidTypeInContext(lc),
+                                arg_types, ARRAY_SIZE(arg_types), 0);
+
+   function = LLVMAddFunction(gallivm->module, "cs_variant", func_type);
+   LLVMSetFunctionCallConv(function, LLVMCCallConv);
+
+   variant->function = function;
+
+   for (i = 0; i < ARRAY_SIZE(arg_types); ++i)
+      if (LLVMGetTypeKind(arg_types[i]) == LLVMPointerTypeKind)
+         lp_add_function_attr(function, i + 1, LP_FUNC_ATTR_NOALIAS);
+
+   context_ptr = LLVMGetParam(function, 0);
+   for (i = 0; i < 3; i++) {
+      block_id[i] = LLVMGetParam(function, 1 + i);
+      grid_size[i] = LLVMGetParam(function, 4 + i);
+      block_size[i] = LLVMGetParam(function, 7 + i);
+   }
+   first_invocation = LLVMGetParam(function, 10);
+   thread_data_ptr = LLVMGetParam(function, 11);
+
+   lp_build_name(context_ptr, "context");
+   lp_build_name(block_id[0], "x");
+   lp_build_name(block_id[1], "y");
+   lp_build_name(block_id[2], "z");
+   lp_build_name(grid_size[0], "grid_x");
+   lp_build_name(grid_size[1], "grid_y");
+   lp_build_name(grid_size[2], "grid_z");
+   lp_build_name(block_size[0], "block_x");
+   lp_build_name(block_size[1], "block_y");
+   lp_build_name(block_size[2], "block_z");
+   lp_build_name(first_invocation, "first_invocation");
+   lp_build_name(thread_data_ptr, "thread_data");
+
+   /*
+    * Function body
+    */
+
+   block = LLVMAppendBasicBlockInContext(lc, function, "entry");
+   builder = gallivm->builder;
+   assert(builder);
+   LLVMPositionBuilderAtEnd(builder, block);
+
+   sampler = lp_llvm_sampler_soa_create(key->state, LP_JIT_CS_CTX_TEXTURES,
+                                        LP_JIT_CS_CTX_SAMPLERS);
+
+   consts_ptr = lp_jit_cs_context_constants(gallivm, context_ptr);
+   num_consts_ptr = lp_jit_cs_context_num_constants(gallivm, context_ptr);
+
+   /* Linear index of each lane's invocation in the workgroup.  The lanes
+    * past the end of the workgroup are masked off.
+    */
+   lp_build_context_init(&uint_bld, gallivm, lp_uint_type(cs_type));
+   for (i = 0; i < cs_type.length; i++)
+      lane_ids[i] = lp_build_const_int32(gallivm, i);
+   invocation = LLVMBuildAdd(builder,
+                             lp_build_broadcast_scalar(&uint_bld,
+                                                       first_invocation),
+                             LLVMConstVector(lane_ids, cs_type.length),
+                             "invocation");
+   num_invocations = LLVMBuildMul(builder, block_size[0], block_size[1], "");
+   num_invocations = LLVMBuildMul(builder, num_invocations, block_size[2],
+                                  "num_invocations");
+   mask_val = lp_build_cmp(&uint_bld, PIPE_FUNC_LESS, invocation,
+                           lp_build_broadcast_scalar(&uint_bld,
+                                                     num_invocations));
+
+   memset(&system_values, 0, sizeof system_values);
+   tmp = lp_build_broadcast_scalar(&uint_bld, block_size[0]);
+   system_values.thread_id[0] = LLVMBuildURem(builder, invocation, tmp, "");
+   invocation = LLVMBuildUDiv(builder, invocation, tmp, "");
+   tmp = lp_build_broadcast_scalar(&uint_bld, block_size[1]);
+   system_values.thread_id[1] = LLVMBuildURem(builder, invocation, tmp, "");
+   system_values.thread_id[2] = LLVMBuildUDiv(builder, invocation, tmp, "");
+   for (i = 0; i < 3; i++) {
+      system_values.block_id[i] = block_id[i];
+      system_values.grid_size[i] = grid_size[i];
+      system_values.block_size[i] = block_size[i];
+   }
+
+   memset(&mem_iface, 0, sizeof mem_iface);
+   mem_iface.base.buffer = cs_mem_buffer;
+   mem_iface.base.shared = cs_mem_shared;
+   mem_iface.base.image = cs_mem_image;
+   if (shader->uses_barrier)
+      mem_iface.base.barrier = cs_mem_barrier;
+   mem_iface.key = key;
+   mem_iface.context_ptr = context_ptr;
+   mem_iface.thread_data_ptr = thread_data_ptr;
+
+   lp_build_mask_begin(&mask, gallivm, cs_type, mask_val);
+
+   memset(outputs, 0, sizeof outputs);
+
+   lp_build_tgsi_soa(gallivm, shader->tokens, cs_type, &mask,
+                     consts_ptr, num_consts_ptr, &system_values,
+                     NULL, outputs, context_ptr, thread_data_ptr,
+                     sampler, &shader->info.base, NULL, &mem_iface.base);
+
+   lp_build_mask_end(&mask);
+
+   sampler->destroy(sampler);
+
+   LLVMBuildRetVoid(builder);
+
+   gallivm_verify_function(gallivm, function);
+}
+
+
+static struct lp_compute_shader_variant *
+generate_variant(struct llvmpipe_context *lp,
+                 struct lp_compute_shader *shader,
+                 const struct lp_compute_shader_variant_key *key)
+{
+   struct lp_compute_shader_variant *variant;
+   char module_name[64];
+
+   variant = CALLOC_STRUCT(lp_compute_shader_variant);
+   if (!variant)
+      return NULL;
+
+   variant->shader = shader;
+   variant->no = shader->nr_variants;
+   memcpy(&variant->key, key, sizeof *key);
+
+   util_snprintf(module_name, sizeof(module_name), "cs%u_variant%u",
+                 shader->no, variant->no);
+
+   variant->gallivm = gallivm_create(module_name, lp->context, NULL);
+   if (!variant->gallivm) {
+      FREE(variant);
+      return NULL;
+   }
+
+   lp_jit_init_cs_types(variant);
+
+   generate_compute(lp, shader, variant);
+
+   gallivm_compile_module(variant->gallivm);
+
+   variant->nr_instrs = lp_build_count_ir_module(variant->gallivm->module);
+
+   variant->jit_function = (lp_jit_cs_func)
+      gallivm_jit_function(variant->gallivm, variant->function);
+
+   gallivm_free_ir(variant->gallivm);
+
+   return variant;
+}
+
+
+static void
+destroy_variant(struct lp_compute_shader_variant *variant)
+{
+   gallivm_destroy(variant->gallivm);
+   FREE(variant);
+}
+
+
+static void
+make_variant_key(struct llvmpipe_context *lp,
+                 struct lp_compute_shader *shader,
+                 struct lp_compute_shader_variant_key *key)
+{
+   const struct tgsi_shader_info *info = &shader->info.base;
+   unsigned i;
+
+   memset(key, 0, sizeof *key);
+
+   key->nr_samplers = info->file_max[TGSI_FILE_SAMPLER] + 1;
+   for (i = 0; i < key->nr_samplers; ++i) {
+      if (info->file_mask[TGSI_FILE_SAMPLER] & (1 << i)) {
+         lp_sampler_static_sampler_state(&key->state[i].sampler_state,
+                                         lp->samplers[PIPE_SHADER_COMPUTE][i]);
+      }
+   }
+
+   /* As for fragment shaders, assume dx10-style opcodes if there are
+    * sampler views at all.
+    */
+   if (info->file_max[TGSI_FILE_SAMPLER_VIEW] != -1) {
+      key->nr_sampler_views = info->file_max[TGSI_FILE_SAMPLER_VIEW] + 1;
+      for (i = 0; i < key->nr_sampler_views; ++i) {
+         if (info->file_mask[TGSI_FILE_SAMPLER_VIEW] & (1 << i)) {
+            lp_sampler_static_texture_state(&key->state[i].texture_state,
+                                            lp->sampler_views[PIPE_SHADER_COMPUTE][i]);
+         }
+      }
+   }
+   else {
+      key->nr_sampler_views = key->nr_samplers;
+      for (i = 0; i < key->nr_sampler_views; ++i) {
+         if (info->file_mask[TGSI_FILE_SAMPLER] & (1 << i)) {
+            lp_sampler_static_texture_state(&key->state[i].texture_state,
+                                            lp->sampler_views[PIPE_SHADER_COMPUTE][i]);
+         }
+      }
+   }
+
+   key->nr_images = MIN2(info->file_max[TGSI_FILE_IMAGE] + 1,
+                         LP_MAX_SHADER_IMAGES);
+   for (i = 0; i < key->nr_images; ++i) {
+      const struct pipe_image_view *image = &lp->images[PIPE_SHADER_COMPUTE][i];
+
+      key->image_format[i] = image->resource ? image->format :
+                                               PIPE_FORMAT_NONE;
+   }
+}
+
+
+/**
+ * Find or create the variant of the bound compute shader for the
+ * current state.
+ */
+static struct lp_compute_shader_variant *
+llvmpipe_update_cs(struct llvmpipe_context *lp)
+{
+   struct lp_compute_shader *shader = lp->cs;
+   struct lp_compute_shader_variant_key key;
+   struct lp_compute_shader_variant *variant, **prev;
+
+   make_variant_key(lp, shader, &key);
+
+   for (prev = &shader->variants; *prev; prev = &(*prev)->next) {
+      variant = *prev;
+      if (memcmp(&variant->key, &key, sizeof key) == 0) {
+         /* Move to the front of the list */
+         *prev = variant->next;
+         variant->next = shader->variants;
+         shader->variants = variant;
+         return variant;
+      }
+   }
+
+   /* Make room for the new variant, dropping the least recently used */
+   if (shader->nr_variants >= LP_MAX_CS_VARIANTS) {
+      for (prev = &shader->variants; (*prev)->next; prev = &(*prev)->next)
+         ;
+      destroy_variant(*prev);
+      *prev = NULL;
+      shader->nr_variants--;
+   }
+
+   variant = generate_variant(lp, shader, &key);
+   if (variant) {
+      variant->next = shader->variants;
+      shader->variants = variant;
+      shader->nr_variants++;
+   }
+
+   return variant;
+}
+
+
+static void *
+llvmpipe_create_compute_state(struct pipe_context *pipe,
+                              const struct pipe_compute_state *templ)
+{
+   struct lp_compute_shader *shader;
+
+   assert(templ->ir_type == PIPE_SHADER_IR_TGSI);
+
+   shader = CALLOC_STRUCT(lp_compute_shader);
+   if (!shader)
+      return NULL;
+
+   shader->no = cs_no++;
+
+   /* we need to keep a local copy of the tokens */
+   shader->tokens = tgsi_dup_tokens(templ->prog);
+   if (!shader->tokens) {
+      FREE(shader);
+      return NULL;
+   }
+
+   lp_build_tgsi_info(shader->tokens, &shader->info);
+
+   shader->req_local_mem = templ->req_local_mem;
+   shader->uses_barrier =
+      shader->info.base.opcode_count[TGSI_OPCODE_BARRIER] > 0;
+
+   if (LP_DEBUG & DEBUG_TGSI) {
+      debug_printf("llvmpipe: Create compute shader %u %p:\n",
+                   shader->no, (void *) shader);
+      tgsi_dump(shader->tokens, 0);
+   }
+
+   return shader;
+}
+
+
+static void
+llvmpipe_bind_compute_state(struct pipe_context *pipe, void *cs)
+{
+   struct llvmpipe_context *llvmpipe = llvmpipe_context(pipe);
+
+   llvmpipe->cs = (struct lp_compute_shader *) cs;
+}
+
+
+static void
+llvmpipe_delete_compute_state(struct pipe_context *pipe, void *cs)
+{
+   struct lp_compute_shader *shader = (struct lp_compute_shader *) cs;
+   struct lp_compute_shader_variant *variant, *next;
+
+   /* launch_grid is synchronous, so the variants aren't in use */
+   for (variant = shader->variants; variant; variant = next) {
+      next = variant->next;
+      destroy_variant(variant);
+   }
+
+   FREE((void *) shader->tokens);
+   FREE(shader);
+}
+
+
+static void
+llvmpipe_set_shader_buffers(struct pipe_context *pipe,
+                            enum pipe_shader_type shader,
+                            unsigned start,
+                            unsigned num,
+                            const struct pipe_shader_buffer *buffers)
+{
+   struct llvmpipe_context *llvmpipe = llvmpipe_context(pipe);
+   unsigned i;
+
+   assert(shader < PIPE_SHADER_TYPES);
+   assert(start + num <= ARRAY_SIZE(llvmpipe->ssbos[shader]));
+
+   for (i = 0; i < num; i++) {
+      util_copy_shader_buffer(&llvmpipe->ssbos[shader][start + i],
+                              buffers ? &buffers[i] : NULL);
+   }
+
+   if (shader == PIPE_SHADER_FRAGMENT) {
+      draw_flush(llvmpipe->draw);
+      llvmpipe->dirty |= LP_NEW_FS_SSBOS;
+   }
+}
+
+
+static void
+llvmpipe_set_shader_images(struct pipe_context *pipe,
+                           enum pipe_shader_type shader,
+                           unsigned start,
+                           unsigned num,
+                           const struct pipe_image_view *images)
+{
+   struct llvmpipe_context *llvmpipe = llvmpipe_context(pipe);
+   unsigned i;
+
+   assert(shader < PIPE_SHADER_TYPES);
+   assert(start + num <= ARRAY_SIZE(llvmpipe->images[shader]));
+
+   for (i = 0; i < num; i++) {
+      util_copy_image_view(&llvmpipe->images[shader][start + i],
+                           images ? &images[i] : NULL);
+   }
+}
+
+
+/**
+ * Fill in the jit description of an image view.  Views of display
+ * targets are left empty.
+ */
+static void
+fill_jit_image(struct lp_jit_image *jit_image,
+               const struct pipe_image_view *view)
+{
+   struct pipe_resource *res = view->resource;
+   struct llvmpipe_resource *lp_res = llvmpipe_resource(res);
+   unsigned level, first_layer, num_layers;
+
+   memset(jit_image, 0, sizeof *jit_image);
+
+   if (!res || lp_res->dt)
+      return;
+
+   if (!llvmpipe_resource_is_texture(res)) {
+      /* Everything is in elements */
+      unsigned blocksize = util_format_get_blocksize(view->format);
+
+      if (view->u.buf.offset >= res->width0)
+         return;
+
+      jit_image->base = (ubyte *) lp_res->data + view->u.buf.offset;
+      jit_image->width = MIN2(view->u.buf.size,
+                              res->width0 - view->u.buf.offset) / blocksize;
+      jit_image->height = 1;
+      jit_image->depth = 1;
+      return;
+   }
+
+   level = view->u.tex.level;
+   first_layer = view->u.tex.first_layer;
+   num_layers = view->u.tex.last_layer - first_layer + 1;
+
+   jit_image->base = (ubyte *) lp_res->tex_data + lp_res->mip_offsets[level] +
+                     first_layer * lp_res->img_stride[level];
+   jit_image->width = u_minify(res->width0, level);
+   jit_image->height = u_minify(res->height0, level);
+   jit_image->depth = 1;
+   jit_image->row_stride = lp_res->row_stride[level];
+   jit_image->img_stride = lp_res->img_stride[level];
+
+   switch (res->target) {
+   case PIPE_TEXTURE_1D_ARRAY:
+      /* layers are addressed like rows, see lp_build_image_layout */
+      jit_image->height = num_layers;
+      jit_image->row_stride = lp_res->img_stride[level];
+      break;
+   case PIPE_TEXTURE_2D_ARRAY:
+   case PIPE_TEXTURE_CUBE:
+   case PIPE_TEXTURE_CUBE_ARRAY:
+   case PIPE_TEXTURE_3D:
+      /* llvmpipe stores 3D slices like layers */
+      jit_image->depth = num_layers;
+      break;
+   default:
+      break;
+   }
+}
+
+
+/**
+ * Everything a workgroup needs, shared by the threads of a dispatch.
+ */
+struct lp_cs_job
+{
+   lp_jit_cs_func jit_function;
+   struct lp_jit_cs_context jit_context;
+   unsigned grid[3];
+   unsigned block[3];
+   unsigned first_z;               /**< of the grid slice being run */
+   unsigned num_invocations;       /**< per workgroup */
+   unsigned vector_length;
+   unsigned shared_size;
+   boolean uses_barrier;
+};
+
+
+static inline void
+cs_run_vector(const struct lp_cs_job *job,
+              unsigned x, unsigned y, unsigned z,
+              unsigned first_invocation,
+              struct lp_jit_cs_thread_data *thread_data)
+{
+   job->jit_function(&job->jit_context, x, y, z,
+                     job->grid[0], job->grid[1], job->grid[2],
+                     job->block[0], job->block[1], job->block[2],
+                     first_invocation, thread_data);
+}
+
+
+#ifdef LP_CS_HAVE_FIBERS
+
+/** Fiber and its stack, laid out one after the other */
+#define LP_CS_FIBER_SIZE \
+   (align(sizeof(struct lp_cs_fiber), 64) + LP_CS_FIBER_STACK_SIZE)
+
+
+static void
+cs_fiber_main(int ptr_lo, int ptr_hi)
+{
+   /* makecontext only passes ints */
+   uint64_t ptr = (uint64_t)(unsigned) ptr_lo |
+                  ((uint64_t)(unsigned) ptr_hi << 32);
+   struct lp_cs_fiber *fiber = (struct lp_cs_fiber *)(uintptr_t) ptr;
+
+   cs_run_vector(fiber->job, fiber->x, fiber->y, fiber->z,
+                 fiber->first_invocation, &fiber->thread_data);
+   fiber->done = TRUE;
+}
+
+
+/**
+ * Run a workgroup with barriers, one fiber per vector of invocations.
+ */
+static void
+cs_run_fibers(const struct lp_cs_job *job,
+              unsigned x, unsigned y, unsigned z,
+              const struct lp_jit_cs_thread_data *thread_data,
+              struct lp_cs_local_mem *lmem)
+{
+   unsigned num_fibers = DIV_ROUND_UP(job->num_invocations,
+                                      job->vector_length);
+   unsigned remaining, i;
+   ucontext_t scheduler;
+
+   if (lmem->num_stacks < num_fibers) {
+      FREE(lmem->stacks);
+      lmem->stacks = MALLOC(num_fibers * LP_CS_FIBER_SIZE);
+      lmem->num_stacks = lmem->stacks ? num_fibers : 0;
+      if (!lmem->stacks)
+         return;
+   }
+
+   for (i = 0; i < num_fibers; i++) {
+      ubyte *mem = (ubyte *) lmem->stacks + i * LP_CS_FIBER_SIZE;
+      struct lp_cs_fiber *fiber = (struct lp_cs_fiber *) mem;
+      uint64_t ptr = (uintptr_t) fiber;
+
+      fiber->thread_data = *thread_data;
+      fiber->scheduler = &scheduler;
+      fiber->job = job;
+      fiber->x = x;
+      fiber->y = y;
+      fiber->z = z;
+      fiber->first_invocation = i * job->vector_length;
+      fiber->done = FALSE;
+
+      getcontext(&fiber->context);
+      fiber->context.uc_stack.ss_sp = mem + align(sizeof *fiber, 64);
+      fiber->context.uc_stack.ss_size = LP_CS_FIBER_STACK_SIZE;
+      fiber->context.uc_link = &scheduler;
+      makecontext(&fiber->context, (void (*)(void)) cs_fiber_main, 2,
+                  (int)(unsigned) ptr, (int)(unsigned)(ptr >> 32));
+   }
+
+   remaining = num_fibers;
+   while (remaining) {
+      for (i = 0; i < num_fibers; i++) {
+         struct lp_cs_fiber *fiber = (struct lp_cs_fiber *)
+            ((ubyte *) lmem->stacks + i * LP_CS_FIBER_SIZE);
+
+         if (fiber->done)
+            continue;
+
+         swapcontext(&scheduler, &fiber->context);
+         if (fiber->done)
+            remaining--;
+      }
+   }
+}
+
+#endif /* LP_CS_HAVE_FIBERS */
+
+
+/**
+ * Run workgroup 'iter_idx' of the grid slice, on a pool thread.
+ */
+static void
+cs_exec_fn(void *data, unsigned iter_idx, struct lp_cs_local_mem *lmem)
+{
+   const struct lp_cs_job *job = (const struct lp_cs_job *) data;
+   struct lp_jit_cs_thread_data thread_data;
+   unsigned x, y, z, i;
+
+   x = iter_idx % job->grid[0];
+   y = (iter_idx / job->grid[0]) % job->grid[1];
+   z = iter_idx / (job->grid[0] * job->grid[1]) + job->first_z;
+
+   if (lmem->shared_size < job->shared_size) {
+      align_free(lmem->shared);
+      lmem->shared = align_malloc(job->shared_size, 16);
+      lmem->shared_size = lmem->shared ? job->shared_size : 0;
+   }
+
+   memset(&thread_data, 0, sizeof thread_data);
+   thread_data.shared = lmem->shared;
+   thread_data.shared_size = MIN2(lmem->shared_size, job->shared_size);
+
+   if (job->uses_barrier) {
+#ifdef LP_CS_HAVE_FIBERS
+      cs_run_fibers(job, x, y, z, &thread_data, lmem);
+#endif
+      return;
+   }
+
+   for (i = 0; i < job->num_invocations; i += job->vector_length)
+      cs_run_vector(job, x, y, z, i, &thread_data);
+}
+
+
+static void
+fill_grid_size(struct pipe_context *pipe,
+               const struct pipe_grid_info *info,
+               unsigned grid[3])
+{
+   struct pipe_transfer *transfer;
+   const uint32_t *params;
+
+   if (!info->indirect) {
+      grid[0] = info->grid[0];
+      grid[1] = info->grid[1];
+      grid[2] = info->grid[2];
+      return;
+   }
+
+   params = pipe_buffer_map_range(pipe, info->indirect,
+                                  info->indirect_offset,
+                                  3 * sizeof(uint32_t),
+                                  PIPE_TRANSFER_READ,
+                                  &transfer);
+   if (!params) {
+      grid[0] = grid[1] = grid[2] = 0;
+      return;
+   }
+
+   grid[0] = params[0];
+   grid[1] = params[1];
+   grid[2] = params[2];
+   pipe_buffer_unmap(pipe, transfer);
+}
+
+
+static void
+llvmpipe_launch_grid(struct pipe_context *pipe,
+                     const struct pipe_grid_info *info)
+{
+   struct llvmpipe_context *lp = llvmpipe_context(pipe);
+   struct llvmpipe_screen *screen = llvmpipe_screen(pipe->screen);
+   struct lp_compute_shader *shader = lp->cs;
+   struct lp_compute_shader_variant *variant;
+   struct lp_jit_cs_context *jit_context;
+   struct lp_cs_job *job;
+   uint64_t num_groups;
+   unsigned i;
+
+   if (!shader)
+      return;
+
+   if (!lp->cs_tpool) {
+      lp->cs_tpool = lp_cs_tpool_create(screen->num_threads);
+      if (!lp->cs_tpool)
+         return;
+   }
+
+   variant = llvmpipe_update_cs(lp);
+   if (!variant)
+      return;
+
+   job = CALLOC_STRUCT(lp_cs_job);
+   if (!job)
+      return;
+
+   fill_grid_size(pipe, info, job->grid);
+   num_groups = (uint64_t) job->grid[0] * job->grid[1] * job->grid[2];
+   if (!num_groups) {
+      FREE(job);
+      return;
+   }
+
+   /* Rendering in flight may use the resources the shader writes, or
+    * write the ones it reads.
+    */
+   llvmpipe_finish(pipe, __FUNCTION__);
+
+   job->jit_function = variant->jit_function;
+   for (i = 0; i < 3; i++)
+      job->block[i] = info->block[i];
+   job->num_invocations = info->block[0] * info->block[1] * info->block[2];
+   job->vector_length = MIN2(lp_native_vector_width / 32, 16);
+   job->shared_size = shader->req_local_mem;
+   job->uses_barrier = shader->uses_barrier;
+
+   jit_context = &job->jit_context;
+
+   for (i = 0; i < ARRAY_SIZE(jit_context->constants); i++) {
+      const struct pipe_constant_buffer *cb =
+         &lp->constants[PIPE_SHADER_COMPUTE][i];
+      const ubyte *data = NULL;
+
+      if (cb->buffer)
+         data = (const ubyte *) llvmpipe_resource_data(cb->buffer);
+      else if (cb->user_buffer)
+         data = (const ubyte *) cb->user_buffer;
+
+      if (data) {
+         unsigned size = MIN2(cb->buffer_size,
+                              LP_MAX_TGSI_CONST_BUFFER_SIZE);
+
+         jit_context->constants[i] =
+            (const float *) (data + cb->buffer_offset);
+         jit_context->num_constants[i] = size / (sizeof(float) * 4);
+      }
+   }
+
+   for (i = 0; i < lp->num_sampler_views[PIPE_SHADER_COMPUTE]; i++) {
+      const struct pipe_sampler_view *view =
+         lp->sampler_views[PIPE_SHADER_COMPUTE][i];
+
+      if (view)
+         lp_setup_fill_jit_texture(&jit_context->textures[i], view);
+   }
+
+   for (i = 0; i < lp->num_samplers[PIPE_SHADER_COMPUTE]; i++) {
+      const struct pipe_sampler_state *sampler =
+         lp->samplers[PIPE_SHADER_COMPUTE][i];
+      struct lp_jit_sampler *jit_sam = &jit_context->samplers[i];
+
+      if (sampler) {
+         jit_sam->min_lod = sampler->min_lod;
+         jit_sam->max_lod = sampler->max_lod;
+         jit_sam->lod_bias = sampler->lod_bias;
+         COPY_4V(jit_sam->border_color, sampler->border_color.f);
+      }
+   }
+
+   for (i = 0; i < ARRAY_SIZE(jit_context->ssbos); i++) {
+      const struct pipe_shader_buffer *ssbo =
+         &lp->ssbos[PIPE_SHADER_COMPUTE][i];
+
+      if (ssbo->buffer) {
+         jit_context->ssbos[i] = (const uint32_t *)
+            ((ubyte *) llvmpipe_resource_data(ssbo->buffer) +
+             ssbo->buffer_offset);
+         jit_context->num_ssbos[i] = ssbo->buffer_size;
+      }
+   }
+
+   for (i = 0; i < ARRAY_SIZE(jit_context->images); i++)
+      fill_jit_image(&jit_context->images[i],
+                     &lp->images[PIPE_SHADER_COMPUTE][i]);
+
+   /* The pool counts workgroups in 32 bits, so huge grids run a few
+    * slices at a time.
+    */
+   if (num_groups <= UINT_MAX) {
+      lp_cs_tpool_run(lp->cs_tpool, cs_exec_fn, job, (unsigned) num_groups);
+   }
+   else {
+      unsigned z = job->grid[2];
+
+      job->grid[2] = 1;
+      for (job->first_z = 0; job->first_z < z; job->first_z++) {
+         lp_cs_tpool_run(lp->cs_tpool, cs_exec_fn, job,
+                         job->grid[0] * job->grid[1]);
+      }
+   }
+
+   if (lp->active_statistics_queries) {
+      lp->pipeline_statistics.cs_invocations +=
+         num_groups * job->num_invocations;
+   }
+
+   FREE(job);
+
+   /* The shader may have written to textures */
+   screen->timestamp++;
+}
+
+
+void
+llvmpipe_init_compute_funcs(struct llvmpipe_context *llvmpipe)
+{
+   llvmpipe->pipe.create_compute_state = llvmpipe_create_compute_state;
+   llvmpipe->pipe.bind_compute_state = llvmpipe_bind_compute_state;
+   llvmpipe->pipe.delete_compute_state = llvmpipe_delete_compute_state;
+   llvmpipe->pipe.set_shader_buffers = llvmpipe_set_shader_buffers;
+   llvmpipe->pipe.set_shader_images = llvmpipe_set_shader_images;
+   llvmpipe->pipe.launch_grid = llvmpipe_launch_grid;
+}
+
+
+/**
+ * Release the compute and shader resource state of a context.
+ */
+void
+llvmpipe_cleanup_compute(struct llvmpipe_context *llvmpipe)
+{
+   unsigned i, j;
+
+   lp_cs_tpool_destroy(llvmpipe->cs_tpool);
+   llvmpipe->cs_tpool = NULL;
+
+   for (i = 0; i < ARRAY_SIZE(llvmpipe->sampler_views[0]); i++) {
+      pipe_sampler_view_reference(&llvmpipe->sampler_views[PIPE_SHADER_COMPUTE][i], NULL);
+   }
+
+   for (i = 0; i < PIPE_SHADER_TYPES; i++) {
+      for (j = 0; j < ARRAY_SIZE(llvmpipe->ssbos[i]); j++)
+         util_copy_shader_buffer(&llvmpipe->ssbos[i][j], NULL);
+      for (j = 0; j < ARRAY_SIZE(llvmpipe->images[i]); j++)
+         util_copy_image_view(&llvmpipe->images[i][j], NULL);
+   }
+}
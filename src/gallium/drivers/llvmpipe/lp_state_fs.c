@@ -64,22 +64,31 @@
 #include "util/u_pointer.h"
 #include "util/u_format.h"
 #include "util/u_dump.h"
+#include "util/u_framebuffer.h"
 #include "util/u_string.h"
 #include "util/simple_list.h"
 #include "util/u_dual_blend.h"
 #include "util/os_time.h"
+#include "util/mesa-sha1.h"
+#include "compiler/blob.h"
 #include "pipe/p_shader_tokens.h"
 #include "draw/draw_context.h"
 #include "tgsi/tgsi_dump.h"
 #include "tgsi/tgsi_scan.h"
 #include "tgsi/tgsi_parse.h"
+#include "nir/nir_to_tgsi_info.h"
+#include "compiler/nir/nir.h"
+#include "compiler/nir/nir_serialize.h"
 #include "gallivm/lp_bld_type.h"
 #include "gallivm/lp_bld_const.h"
 #include "gallivm/lp_bld_conv.h"
 #include "gallivm/lp_bld_init.h"
+#include "gallivm/lp_bld_code_cache.h"
+#include "gallivm/lp_bld_async.h"
 #include "gallivm/lp_bld_intr.h"
 #include "gallivm/lp_bld_logic.h"
 #include "gallivm/lp_bld_tgsi.h"
+#include "gallivm/lp_bld_nir.h"
 #include "gallivm/lp_bld_swizzle.h"
 #include "gallivm/lp_bld_flow.h"
 #include "gallivm/lp_bld_debug.h"
@@ -96,6 +105,7 @@
 #include "lp_context.h"
 #include "lp_debug.h"
 #include "lp_perf.h"
+#include "lp_screen.h"
 #include "lp_setup.h"
 #include "lp_state.h"
 #include "lp_tex_sample.h"
@@ -108,6 +118,18 @@
 static unsigned fs_no = 0;
 
 
+/**
+ * Whether the fragment shader doesn't do anything at all.
+ */
+static inline boolean
+shader_is_empty(const struct lp_fragment_shader *shader)
+{
+   if (shader->base.type == PIPE_SHADER_IR_NIR)
+      return shader->info.base.num_instructions == 0;
+   return shader->info.base.num_tokens <= 1;
+}
+
+
 /**
  * Expand the relevant bits of mask_input to a n*4-dword mask for the
  * n*four pixels in n 2x2 quads.  This will set the n*four elements of the
@@ -215,6 +237,33 @@ find_output_by_semantic( const struct tgsi_shader_info *info,
 }
 
 
+/**
+ * Fragment shader memory interface: shader storage buffers only.
+ */
+struct lp_fs_mem_iface
+{
+   struct lp_build_tgsi_mem_iface base;
+   LLVMValueRef context_ptr;
+};
+
+
+static void
+fs_mem_buffer(const struct lp_build_tgsi_mem_iface *iface,
+              struct gallivm_state *gallivm,
+              LLVMValueRef index,
+              LLVMValueRef *base_ptr,
+              LLVMValueRef *size)
+{
+   const struct lp_fs_mem_iface *fs_iface =
+      (const struct lp_fs_mem_iface *)iface;
+
+   lp_jit_buffer_lookup(gallivm,
+                        lp_jit_context_ssbos(gallivm, fs_iface->context_ptr),
+                        lp_jit_context_num_ssbos(gallivm, fs_iface->context_ptr),
+                        index, base_ptr, size);
+}
+
+
 /**
  * Fetch the specified lp_jit_viewport structure for a given viewport_index.
  */
@@ -287,8 +336,208 @@ lp_build_depth_clamp(struct gallivm_state *gallivm,
 }
 
 
+/**
+ * Pointer to the coverage mask of the given sample for the quad(s) of
+ * the current loop iteration.  The masks of all the samples of a stamp
+ * are kept in one array, sample after sample.
+ */
+static LLVMValueRef
+sample_mask_ptr(struct gallivm_state *gallivm,
+                LLVMValueRef sample_mask_store,
+                unsigned num_fs,
+                unsigned sample,
+                LLVMValueRef loop_counter)
+{
+   LLVMValueRef index;
+
+   index = LLVMBuildAdd(gallivm->builder, loop_counter,
+                        lp_build_const_int32(gallivm, sample * num_fs), "");
+   return LLVMBuildGEP(gallivm->builder, sample_mask_store, &index, 1, "");
+}
+
+
+/**
+ * Narrow the pixel mask down to the pixels which still have any sample
+ * covered.
+ */
+static void
+update_mask_from_samples(struct gallivm_state *gallivm,
+                         struct lp_type type,
+                         struct lp_build_mask_context *mask,
+                         LLVMValueRef sample_mask_store,
+                         unsigned num_fs,
+                         LLVMValueRef loop_counter)
+{
+   LLVMBuilderRef builder = gallivm->builder;
+   LLVMValueRef any = lp_build_const_int_vec(gallivm, type, 0);
+   unsigned s;
+
+   for (s = 0; s < LP_MAX_SAMPLES; s++) {
+      LLVMValueRef ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                         num_fs, s, loop_counter);
+      any = LLVMBuildOr(builder, any, LLVMBuildLoad(builder, ptr, ""), "");
+   }
+
+   lp_build_mask_update(mask, any);
+}
+
+
+/**
+ * Depth/stencil test each sample of a multisample depth buffer on its own.
+ *
+ * The samples are stored one after the other, depth_sample_stride bytes
+ * apart.  The fragment's depth is evaluated at the sample positions when
+ * sample_dz is given (i.e. unless the shader writes depth).  The per-sample
+ * masks are updated and the pixel mask is narrowed to the pixels with any
+ * sample passing.  When z_value etc. are given the values needed for a
+ * deferred depth write are returned per sample instead of being written.
+ */
+static void
+generate_ms_depth_stencil(struct gallivm_state *gallivm,
+                          const struct lp_fragment_shader_variant_key *key,
+                          struct lp_type type,
+                          const struct util_format_description *zs_format_desc,
+                          LLVMValueRef context_ptr,
+                          LLVMValueRef thread_data_ptr,
+                          struct lp_build_mask_context *mask,
+                          LLVMValueRef sample_mask_store,
+                          unsigned num_fs,
+                          LLVMValueRef loop_counter,
+                          LLVMValueRef stencil_refs[2],
+                          LLVMValueRef z,
+                          const LLVMValueRef *sample_dz,
+                          LLVMValueRef facing,
+                          LLVMValueRef depth_ptr,
+                          LLVMValueRef depth_stride,
+                          LLVMValueRef depth_sample_stride,
+                          boolean do_write,
+                          LLVMValueRef *z_value,
+                          LLVMValueRef *s_value,
+                          LLVMValueRef *z_fb,
+                          LLVMValueRef *s_fb)
+{
+   LLVMBuilderRef builder = gallivm->builder;
+   unsigned s;
+
+   for (s = 0; s < LP_MAX_SAMPLES; s++) {
+      struct lp_build_mask_context smask;
+      LLVMValueRef mask_ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                              num_fs, s, loop_counter);
+      LLVMValueRef offset, sample_depth_ptr, sample_z;
+      LLVMValueRef zv, sv, zfb, sfb;
+
+      offset = LLVMBuildMul(builder, depth_sample_stride,
+                            lp_build_const_int32(gallivm, s), "");
+      sample_depth_ptr = LLVMBuildGEP(builder, depth_ptr, &offset, 1, "");
+
+      sample_z = z;
+      if (sample_dz) {
+         sample_z = LLVMBuildFAdd(builder, z, sample_dz[s], "");
+      }
+      if (key->depth_clamp) {
+         sample_z = lp_build_depth_clamp(gallivm, builder, type, context_ptr,
+                                         thread_data_ptr, sample_z);
+      }
+
+      lp_build_mask_begin(&smask, gallivm, type,
+                          LLVMBuildAnd(builder,
+                                       LLVMBuildLoad(builder, mask_ptr, ""),
+                                       lp_build_mask_value(mask), ""));
+
+      lp_build_depth_stencil_load_swizzled(gallivm, type,
+                                           zs_format_desc, key->resource_1d,
+                                           sample_depth_ptr, depth_stride,
+                                           &zfb, &sfb, loop_counter);
+      lp_build_depth_stencil_test(gallivm,
+                                  &key->depth,
+                                  key->stencil,
+                                  type,
+                                  zs_format_desc,
+                                  &smask,
+                                  stencil_refs,
+                                  sample_z, zfb, sfb,
+                                  facing,
+                                  &zv, &sv,
+                                  FALSE);
+
+      if (do_write) {
+         lp_build_depth_stencil_write_swizzled(gallivm, type,
+                                               zs_format_desc, key->resource_1d,
+                                               NULL, NULL, NULL, loop_counter,
+                                               sample_depth_ptr, depth_stride,
+                                               zv, sv);
+      }
+
+      if (z_value) {
+         z_value[s] = zv;
+         s_value[s] = sv;
+         z_fb[s] = zfb;
+         s_fb[s] = sfb;
+      }
+
+      LLVMBuildStore(builder, lp_build_mask_end(&smask), mask_ptr);
+   }
+
+   update_mask_from_samples(gallivm, type, mask, sample_mask_store,
+                            num_fs, loop_counter);
+}
+
+
+/**
+ * Deferred depth/stencil write for multisampling, once the final masks
+ * are known.  See generate_ms_depth_stencil().
+ */
+static void
+generate_ms_depth_stencil_write(struct gallivm_state *gallivm,
+                                const struct lp_fragment_shader_variant_key *key,
+                                struct lp_type type,
+                                const struct util_format_description *zs_format_desc,
+                                struct lp_build_mask_context *mask,
+                                LLVMValueRef sample_mask_store,
+                                unsigned num_fs,
+                                LLVMValueRef loop_counter,
+                                LLVMValueRef depth_ptr,
+                                LLVMValueRef depth_stride,
+                                LLVMValueRef depth_sample_stride,
+                                const LLVMValueRef *z_value,
+                                const LLVMValueRef *s_value,
+                                const LLVMValueRef *z_fb,
+                                const LLVMValueRef *s_fb)
+{
+   LLVMBuilderRef builder = gallivm->builder;
+   unsigned s;
+
+   for (s = 0; s < LP_MAX_SAMPLES; s++) {
+      struct lp_build_mask_context smask;
+      LLVMValueRef mask_ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                              num_fs, s, loop_counter);
+      LLVMValueRef offset, sample_depth_ptr;
+
+      offset = LLVMBuildMul(builder, depth_sample_stride,
+                            lp_build_const_int32(gallivm, s), "");
+      sample_depth_ptr = LLVMBuildGEP(builder, depth_ptr, &offset, 1, "");
+
+      lp_build_mask_begin(&smask, gallivm, type,
+                          LLVMBuildAnd(builder,
+                                       LLVMBuildLoad(builder, mask_ptr, ""),
+                                       lp_build_mask_value(mask), ""));
+      lp_build_depth_stencil_write_swizzled(gallivm, type,
+                                            zs_format_desc, key->resource_1d,
+                                            &smask, z_fb[s], s_fb[s],
+                                            loop_counter,
+                                            sample_depth_ptr, depth_stride,
+                                            z_value[s], s_value[s]);
+      lp_build_mask_end(&smask);
+   }
+}
+
+
 /**
  * Generate the fragment shader, depth/stencil test, and alpha tests.
+ *
+ * For multisample variants sample_mask_store holds the coverage mask of
+ * each sample, which is kept up to date along the pixel mask.  The shader
+ * still only runs once per pixel.
  */
 static void
 generate_fs_loop(struct gallivm_state *gallivm,
@@ -305,10 +554,13 @@ generate_fs_loop(struct gallivm_state *gallivm,
                  LLVMValueRef depth_ptr,
                  LLVMValueRef depth_stride,
                  LLVMValueRef facing,
-                 LLVMValueRef thread_data_ptr)
+                 LLVMValueRef thread_data_ptr,
+                 LLVMValueRef sample_mask_store,
+                 unsigned num_fs,
+                 const LLVMValueRef *sample_dz,
+                 LLVMValueRef depth_sample_stride)
 {
    const struct util_format_description *zs_format_desc = NULL;
-   const struct tgsi_token *tokens = shader->base.tokens;
    struct lp_type int_type = lp_int_type(type);
    LLVMTypeRef vec_type, int_vec_type;
    LLVMValueRef mask_ptr, mask_val;
@@ -316,6 +568,8 @@ generate_fs_loop(struct gallivm_state *gallivm,
    LLVMValueRef z;
    LLVMValueRef z_value, s_value;
    LLVMValueRef z_fb, s_fb;
+   LLVMValueRef ms_z_value[LP_MAX_SAMPLES], ms_s_value[LP_MAX_SAMPLES];
+   LLVMValueRef ms_z_fb[LP_MAX_SAMPLES], ms_s_fb[LP_MAX_SAMPLES];
    LLVMValueRef stencil_refs[2];
    LLVMValueRef outputs[PIPE_MAX_SHADER_OUTPUTS][TGSI_NUM_CHANNELS];
    struct lp_build_for_loop_state loop_state;
@@ -334,11 +588,17 @@ generate_fs_loop(struct gallivm_state *gallivm,
    unsigned chan;
    unsigned cbuf;
    unsigned depth_mode;
+   unsigned s;
 
    struct lp_bld_tgsi_system_values system_values;
+   struct lp_fs_mem_iface mem_iface;
 
    memset(&system_values, 0, sizeof(system_values));
 
+   memset(&mem_iface, 0, sizeof mem_iface);
+   mem_iface.base.buffer = fs_mem_buffer;
+   mem_iface.context_ptr = context_ptr;
+
    if (key->depth.enabled ||
        key->stencil[0].enabled) {
 
@@ -370,6 +630,15 @@ generate_fs_loop(struct gallivm_state *gallivm,
          depth_mode = LATE_DEPTH_TEST | LATE_DEPTH_WRITE;
       }
 
+      /* Stores and atomics must happen for fragments failing the depth and
+       * stencil tests too, unless the shader asks for the tests to be done
+       * before it runs.
+       */
+      if (shader->info.base.properties[TGSI_PROPERTY_FS_EARLY_DEPTH_STENCIL])
+         depth_mode = EARLY_DEPTH_TEST | EARLY_DEPTH_WRITE;
+      else if (shader->info.base.writes_memory)
+         depth_mode = LATE_DEPTH_TEST | LATE_DEPTH_WRITE;
+
       if (!(key->depth.enabled && key->depth.writemask) &&
           !(key->stencil[0].enabled && (key->stencil[0].writemask ||
                                         (key->stencil[1].enabled &&
@@ -432,7 +701,22 @@ generate_fs_loop(struct gallivm_state *gallivm,
    lp_build_interp_soa_update_pos_dyn(interp, gallivm, loop_state.counter);
    z = interp->pos[2];
 
-   if (depth_mode & EARLY_DEPTH_TEST) {
+   if ((depth_mode & EARLY_DEPTH_TEST) && sample_mask_store) {
+      boolean deferred_write = (depth_mode & LATE_DEPTH_WRITE) != 0;
+
+      generate_ms_depth_stencil(gallivm, key, type, zs_format_desc,
+                                context_ptr, thread_data_ptr,
+                                &mask, sample_mask_store, num_fs,
+                                loop_state.counter, stencil_refs,
+                                z, sample_dz, facing,
+                                depth_ptr, depth_stride, depth_sample_stride,
+                                (depth_mode & EARLY_DEPTH_WRITE) != 0,
+                                deferred_write ? ms_z_value : NULL,
+                                ms_s_value, ms_z_fb, ms_s_fb);
+      if (!simple_shader)
+         lp_build_mask_check(&mask);
+   }
+   else if (depth_mode & EARLY_DEPTH_TEST) {
       /*
        * Clamp according to ARB_depth_clamp semantics.
        */
@@ -475,11 +759,22 @@ generate_fs_loop(struct gallivm_state *gallivm,
    lp_build_interp_soa_update_inputs_dyn(interp, gallivm, loop_state.counter);
 
    /* Build the actual shader */
-   lp_build_tgsi_soa(gallivm, tokens, type, &mask,
-                     consts_ptr, num_consts_ptr, &system_values,
-                     interp->inputs,
-                     outputs, context_ptr, thread_data_ptr,
-                     sampler, &shader->info.base, NULL);
+   if (shader->base.type == PIPE_SHADER_IR_NIR) {
+      MAYBE_UNUSED boolean translated;
+      translated = lp_build_nir_soa(gallivm, shader->base.ir.nir, type, &mask,
+                                    consts_ptr, num_consts_ptr, &system_values,
+                                    interp->inputs,
+                                    outputs, context_ptr, thread_data_ptr,
+                                    sampler, &shader->info.base,
+                                    &mem_iface.base);
+      /* checked by is_nir_shader_supported() when the program was linked */
+      assert(translated);
+   } else
+      lp_build_tgsi_soa(gallivm, shader->base.tokens, type, &mask,
+                        consts_ptr, num_consts_ptr, &system_values,
+                        interp->inputs,
+                        outputs, context_ptr, thread_data_ptr,
+                        sampler, &shader->info.base, NULL, &mem_iface.base);
 
    /* Alpha test */
    if (key->alpha.enabled) {
@@ -509,7 +804,31 @@ generate_fs_loop(struct gallivm_state *gallivm,
                                            TGSI_SEMANTIC_COLOR,
                                            0);
 
-      if (color0 != -1 && outputs[color0][3]) {
+      if (color0 != -1 && outputs[color0][3] && sample_mask_store) {
+         LLVMValueRef alpha = LLVMBuildLoad(builder, outputs[color0][3], "alpha");
+         struct lp_build_context bld;
+
+         lp_build_context_init(&bld, gallivm, type);
+
+         /* Sample s is covered when alpha > (s + 0.5) / samples */
+         for (s = 0; s < LP_MAX_SAMPLES; s++) {
+            LLVMValueRef ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                               num_fs, s, loop_state.counter);
+            LLVMValueRef ref = lp_build_const_vec(gallivm, type,
+                                                  (s + 0.5) / LP_MAX_SAMPLES);
+            LLVMValueRef test = lp_build_cmp(&bld, PIPE_FUNC_GREATER,
+                                             alpha, ref);
+
+            LLVMBuildStore(builder,
+                           LLVMBuildAnd(builder,
+                                        LLVMBuildLoad(builder, ptr, ""),
+                                        test, ""),
+                           ptr);
+         }
+         update_mask_from_samples(gallivm, type, &mask, sample_mask_store,
+                                  num_fs, loop_state.counter);
+      }
+      else if (color0 != -1 && outputs[color0][3]) {
          LLVMValueRef alpha = LLVMBuildLoad(builder, outputs[color0][3], "alpha");
 
          lp_build_alpha_to_coverage(gallivm, type,
@@ -528,13 +847,34 @@ generate_fs_loop(struct gallivm_state *gallivm,
 
       assert(smaski >= 0);
       smask = LLVMBuildLoad(builder, outputs[smaski][0], "smask");
-      /*
-       * Pixel is alive according to the first sample in the mask.
-       */
       smask = LLVMBuildBitCast(builder, smask, smask_bld.vec_type, "");
-      smask = lp_build_and(&smask_bld, smask, smask_bld.one);
-      smask = lp_build_cmp(&smask_bld, PIPE_FUNC_NOTEQUAL, smask, smask_bld.zero);
-      lp_build_mask_update(&mask, smask);
+      if (sample_mask_store) {
+         for (s = 0; s < LP_MAX_SAMPLES; s++) {
+            LLVMValueRef ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                               num_fs, s, loop_state.counter);
+            LLVMValueRef bit = lp_build_const_int_vec(gallivm, int_type, 1 << s);
+            LLVMValueRef test;
+
+            test = lp_build_and(&smask_bld, smask, bit);
+            test = lp_build_cmp(&smask_bld, PIPE_FUNC_NOTEQUAL, test,
+                                smask_bld.zero);
+            LLVMBuildStore(builder,
+                           LLVMBuildAnd(builder,
+                                        LLVMBuildLoad(builder, ptr, ""),
+                                        test, ""),
+                           ptr);
+         }
+         update_mask_from_samples(gallivm, type, &mask, sample_mask_store,
+                                  num_fs, loop_state.counter);
+      }
+      else {
+         /*
+          * Pixel is alive according to the first sample in the mask.
+          */
+         smask = lp_build_and(&smask_bld, smask, smask_bld.one);
+         smask = lp_build_cmp(&smask_bld, PIPE_FUNC_NOTEQUAL, smask, smask_bld.zero);
+         lp_build_mask_update(&mask, smask);
+      }
    }
 
    /* Late Z test */
@@ -545,13 +885,16 @@ generate_fs_loop(struct gallivm_state *gallivm,
       int s_out = find_output_by_semantic(&shader->info.base,
                                           TGSI_SEMANTIC_STENCIL,
                                           0);
+      const LLVMValueRef *z_offsets = sample_dz;
+
       if (pos0 != -1 && outputs[pos0][2]) {
          z = LLVMBuildLoad(builder, outputs[pos0][2], "output.z");
+         z_offsets = NULL;
       }
       /*
        * Clamp according to ARB_depth_clamp semantics.
        */
-      if (key->depth_clamp) {
+      if (key->depth_clamp && !sample_mask_store) {
          z = lp_build_depth_clamp(gallivm, builder, type, context_ptr,
                                   thread_data_ptr, z);
       }
@@ -565,24 +908,36 @@ generate_fs_loop(struct gallivm_state *gallivm,
          stencil_refs[1] = stencil_refs[0];
       }
 
-      lp_build_depth_stencil_load_swizzled(gallivm, type,
-                                           zs_format_desc, key->resource_1d,
-                                           depth_ptr, depth_stride,
-                                           &z_fb, &s_fb, loop_state.counter);
-
-      lp_build_depth_stencil_test(gallivm,
-                                  &key->depth,
-                                  key->stencil,
-                                  type,
-                                  zs_format_desc,
-                                  &mask,
-                                  stencil_refs,
-                                  z, z_fb, s_fb,
-                                  facing,
-                                  &z_value, &s_value,
-                                  !simple_shader);
+      if (sample_mask_store) {
+         generate_ms_depth_stencil(gallivm, key, type, zs_format_desc,
+                                   context_ptr, thread_data_ptr,
+                                   &mask, sample_mask_store, num_fs,
+                                   loop_state.counter, stencil_refs,
+                                   z, z_offsets, facing,
+                                   depth_ptr, depth_stride, depth_sample_stride,
+                                   (depth_mode & LATE_DEPTH_WRITE) != 0,
+                                   NULL, NULL, NULL, NULL);
+      }
+      else {
+         lp_build_depth_stencil_load_swizzled(gallivm, type,
+                                              zs_format_desc, key->resource_1d,
+                                              depth_ptr, depth_stride,
+                                              &z_fb, &s_fb, loop_state.counter);
+
+         lp_build_depth_stencil_test(gallivm,
+                                     &key->depth,
+                                     key->stencil,
+                                     type,
+                                     zs_format_desc,
+                                     &mask,
+                                     stencil_refs,
+                                     z, z_fb, s_fb,
+                                     facing,
+                                     &z_value, &s_value,
+                                     !simple_shader);
+      }
       /* Late Z write */
-      if (depth_mode & LATE_DEPTH_WRITE) {
+      if ((depth_mode & LATE_DEPTH_WRITE) && !sample_mask_store) {
          lp_build_depth_stencil_write_swizzled(gallivm, type,
                                                zs_format_desc, key->resource_1d,
                                                NULL, NULL, NULL, loop_state.counter,
@@ -597,11 +952,22 @@ generate_fs_loop(struct gallivm_state *gallivm,
        * depth value, update from zs_value with the new mask value and
        * write that out.
        */
-      lp_build_depth_stencil_write_swizzled(gallivm, type,
-                                            zs_format_desc, key->resource_1d,
-                                            &mask, z_fb, s_fb, loop_state.counter,
-                                            depth_ptr, depth_stride,
-                                            z_value, s_value);
+      if (sample_mask_store) {
+         generate_ms_depth_stencil_write(gallivm, key, type, zs_format_desc,
+                                         &mask, sample_mask_store, num_fs,
+                                         loop_state.counter,
+                                         depth_ptr, depth_stride,
+                                         depth_sample_stride,
+                                         ms_z_value, ms_s_value,
+                                         ms_z_fb, ms_s_fb);
+      }
+      else {
+         lp_build_depth_stencil_write_swizzled(gallivm, type,
+                                               zs_format_desc, key->resource_1d,
+                                               &mask, z_fb, s_fb, loop_state.counter,
+                                               depth_ptr, depth_stride,
+                                               z_value, s_value);
+      }
    }
 
 
@@ -631,12 +997,39 @@ generate_fs_loop(struct gallivm_state *gallivm,
    if (key->occlusion_count) {
       LLVMValueRef counter = lp_jit_thread_data_counter(gallivm, thread_data_ptr);
       lp_build_name(counter, "counter");
-      lp_build_occlusion_count(gallivm, type,
-                               lp_build_mask_value(&mask), counter);
+      if (sample_mask_store) {
+         /* Count the samples passing, not the pixels */
+         for (s = 0; s < LP_MAX_SAMPLES; s++) {
+            LLVMValueRef ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                               num_fs, s, loop_state.counter);
+            lp_build_occlusion_count(gallivm, type,
+                                     LLVMBuildAnd(builder,
+                                                  LLVMBuildLoad(builder, ptr, ""),
+                                                  lp_build_mask_value(&mask), ""),
+                                     counter);
+         }
+      }
+      else {
+         lp_build_occlusion_count(gallivm, type,
+                                  lp_build_mask_value(&mask), counter);
+      }
    }
 
    mask_val = lp_build_mask_end(&mask);
    LLVMBuildStore(builder, mask_val, mask_ptr);
+
+   /* Drop the samples of the pixels killed since their masks were set */
+   if (sample_mask_store) {
+      for (s = 0; s < LP_MAX_SAMPLES; s++) {
+         LLVMValueRef ptr = sample_mask_ptr(gallivm, sample_mask_store,
+                                            num_fs, s, loop_state.counter);
+         LLVMBuildStore(builder,
+                        LLVMBuildAnd(builder,
+                                     LLVMBuildLoad(builder, ptr, ""),
+                                     mask_val, ""),
+                        ptr);
+      }
+   }
    lp_build_for_loop_end(&loop_state);
 }
 
@@ -2410,10 +2803,11 @@ generate_fragment(struct llvmpipe_context *lp,
    struct lp_type blend_type;
    LLVMTypeRef fs_elem_type;
    LLVMTypeRef blend_vec_type;
-   LLVMTypeRef arg_types[13];
+   LLVMTypeRef arg_types[16];
    LLVMTypeRef func_type;
    LLVMTypeRef int32_type = LLVMInt32TypeInContext(gallivm->context);
    LLVMTypeRef int8_type = LLVMInt8TypeInContext(gallivm->context);
+   LLVMTypeRef int64_type = LLVMInt64TypeInContext(gallivm->context);
    LLVMValueRef context_ptr;
    LLVMValueRef x;
    LLVMValueRef y;
@@ -2426,16 +2820,24 @@ generate_fragment(struct llvmpipe_context *lp,
    LLVMValueRef depth_stride;
    LLVMValueRef mask_input;
    LLVMValueRef thread_data_ptr;
+   LLVMValueRef sample_mask_input;
+   LLVMValueRef sample_stride_ptr;
+   LLVMValueRef depth_sample_stride;
+   LLVMValueRef sample_mask_store = NULL;
+   LLVMValueRef sample_dz[LP_MAX_SAMPLES];
    LLVMBasicBlockRef block;
    LLVMBuilderRef builder;
    struct lp_build_sampler_soa *sampler;
    struct lp_build_interp_soa_context interp;
    LLVMValueRef fs_mask[16 / 4];
+   LLVMValueRef fs_sample_mask[LP_MAX_SAMPLES][16 / 4];
    LLVMValueRef fs_out_color[PIPE_MAX_COLOR_BUFS][TGSI_NUM_CHANNELS][16 / 4];
    LLVMValueRef function;
    LLVMValueRef facing;
    unsigned num_fs;
+   unsigned num_samples = key->multisample ? LP_MAX_SAMPLES : 1;
    unsigned i;
+   unsigned s;
    unsigned chan;
    unsigned cbuf;
    boolean cbuf0_write_all;
@@ -2486,8 +2888,9 @@ generate_fragment(struct llvmpipe_context *lp,
 
    blend_vec_type = lp_build_vec_type(gallivm, blend_type);
 
-   util_snprintf(func_name, sizeof(func_name), "fs%u_variant%u_%s",
-                 shader->no, variant->no, partial_mask ? "partial" : "whole");
+   /* Not numbered, as cached object code is looked up by symbol name. */
+   util_snprintf(func_name, sizeof(func_name), "fs_variant_%s",
+                 partial_mask ? "partial" : "whole");
 
    arg_types[0] = variant->jit_context_ptr_type;       /* context */
    arg_types[1] = int32_type;                          /* x */
@@ -2502,6 +2905,9 @@ generate_fragment(struct llvmpipe_context *lp,
    arg_types[10] = variant->jit_thread_data_ptr_type;  /* per thread data */
    arg_types[11] = LLVMPointerType(int32_type, 0);     /* stride */
    arg_types[12] = int32_type;                         /* depth_stride */
+   arg_types[13] = int64_type;                         /* sample_mask */
+   arg_types[14] = LLVMPointerType(int32_type, 0);     /* sample_stride */
+   arg_types[15] = int32_type;                         /* depth_sample_stride */
 
    func_type = LLVMFunctionType(LLVMVoidTypeInContext(gallivm->context),
                                 arg_types, ARRAY_SIZE(arg_types), 0);
@@ -2531,6 +2937,9 @@ generate_fragment(struct llvmpipe_context *lp,
    thread_data_ptr  = LLVMGetParam(function, 10);
    stride_ptr   = LLVMGetParam(function, 11);
    depth_stride = LLVMGetParam(function, 12);
+   sample_mask_input = LLVMGetParam(function, 13);
+   sample_stride_ptr = LLVMGetParam(function, 14);
+   depth_sample_stride = LLVMGetParam(function, 15);
 
    lp_build_name(context_ptr, "context");
    lp_build_name(x, "x");
@@ -2544,6 +2953,9 @@ generate_fragment(struct llvmpipe_context *lp,
    lp_build_name(thread_data_ptr, "thread_data");
    lp_build_name(stride_ptr, "stride_ptr");
    lp_build_name(depth_stride, "depth_stride");
+   lp_build_name(sample_mask_input, "sample_mask_input");
+   lp_build_name(sample_stride_ptr, "sample_stride_ptr");
+   lp_build_name(depth_sample_stride, "depth_sample_stride");
 
    /*
     * Function body
@@ -2555,7 +2967,8 @@ generate_fragment(struct llvmpipe_context *lp,
    LLVMPositionBuilderAtEnd(builder, block);
 
    /* code generated texture sampling */
-   sampler = lp_llvm_sampler_soa_create(key->state);
+   sampler = lp_llvm_sampler_soa_create(key->state, LP_JIT_CTX_TEXTURES,
+                                        LP_JIT_CTX_SAMPLERS);
 
    num_fs = 16 / fs_type.length; /* number of loops per 4x4 stamp */
    /* for 1d resources only run "upper half" of stamp */
@@ -2586,20 +2999,113 @@ generate_fragment(struct llvmpipe_context *lp,
                                a0_ptr, dadx_ptr, dady_ptr,
                                x, y);
 
-      for (i = 0; i < num_fs; i++) {
-         LLVMValueRef mask;
-         LLVMValueRef indexi = lp_build_const_int32(gallivm, i);
-         LLVMValueRef mask_ptr = LLVMBuildGEP(builder, mask_store,
-                                              &indexi, 1, "mask_ptr");
+      if (key->multisample) {
+         LLVMValueRef sample_enable[LP_MAX_SAMPLES];
+         LLVMValueRef jit_sample_mask;
+         LLVMValueRef dzdx, dzdy;
+         LLVMValueRef index;
+
+         sample_mask_store =
+            lp_build_array_alloca(gallivm, mask_type,
+                                  lp_build_const_int32(gallivm,
+                                                       num_fs * LP_MAX_SAMPLES),
+                                  "sample_mask_store");
 
-         if (partial_mask) {
-            mask = generate_quad_mask(gallivm, fs_type,
-                                      i*fs_type.length/4, mask_input);
+         /*
+          * Samples disabled by the pipe sample mask are dropped up front:
+          * enable = -((sample_mask >> s) & 1)
+          */
+         jit_sample_mask = lp_jit_context_sample_mask(gallivm, context_ptr);
+         for (s = 0; s < LP_MAX_SAMPLES; s++) {
+            LLVMValueRef bit;
+
+            bit = LLVMBuildLShr(builder, jit_sample_mask,
+                                lp_build_const_int32(gallivm, s), "");
+            bit = LLVMBuildAnd(builder, bit, lp_build_const_int32(gallivm, 1), "");
+            bit = LLVMBuildNeg(builder, bit, "");
+            sample_enable[s] = lp_build_broadcast(gallivm, mask_type, bit);
          }
-         else {
-            mask = lp_build_const_int_vec(gallivm, fs_type, ~0);
+
+         /*
+          * The position is interpolated at the pixel center, so depth at
+          * the samples is offset by the position of the sample within the
+          * pixel.
+          */
+         index = lp_build_const_int32(gallivm, 2);
+         dzdx = LLVMBuildLoad(builder,
+                              LLVMBuildGEP(builder, dadx_ptr, &index, 1, ""),
+                              "dzdx");
+         dzdy = LLVMBuildLoad(builder,
+                              LLVMBuildGEP(builder, dady_ptr, &index, 1, ""),
+                              "dzdy");
+         for (s = 0; s < LP_MAX_SAMPLES; s++) {
+            LLVMValueRef dz;
+            float sx = (float)lp_sample_pos_4x[s][0] / FIXED_ONE - 0.5f;
+            float sy = (float)lp_sample_pos_4x[s][1] / FIXED_ONE - 0.5f;
+
+            dz = LLVMBuildFMul(builder, dzdx,
+                               lp_build_const_float(gallivm, sx), "");
+            dz = LLVMBuildFAdd(builder, dz,
+                               LLVMBuildFMul(builder, dzdy,
+                                             lp_build_const_float(gallivm, sy),
+                                             ""), "");
+            sample_dz[s] = lp_build_broadcast(gallivm,
+                                              lp_build_vec_type(gallivm, fs_type),
+                                              dz);
+         }
+
+         /*
+          * The coverage of sample s is in bits [16*s, 16*s+15] of the
+          * sample mask input, laid out like the pixel mask input.
+          */
+         for (i = 0; i < num_fs; i++) {
+            LLVMValueRef mask = lp_build_const_int_vec(gallivm, fs_type, 0);
+            LLVMValueRef indexi = lp_build_const_int32(gallivm, i);
+            LLVMValueRef mask_ptr = LLVMBuildGEP(builder, mask_store,
+                                                 &indexi, 1, "mask_ptr");
+
+            for (s = 0; s < LP_MAX_SAMPLES; s++) {
+               LLVMValueRef smask;
+               LLVMValueRef indexs =
+                  lp_build_const_int32(gallivm, s * num_fs + i);
+
+               if (partial_mask) {
+                  LLVMValueRef bits;
+
+                  bits = LLVMBuildLShr(builder, sample_mask_input,
+                                       LLVMConstInt(int64_type, 16 * s, 0), "");
+                  bits = LLVMBuildTrunc(builder, bits, int32_type, "");
+                  smask = generate_quad_mask(gallivm, fs_type,
+                                             i*fs_type.length/4, bits);
+               }
+               else {
+                  smask = lp_build_const_int_vec(gallivm, fs_type, ~0);
+               }
+               smask = LLVMBuildAnd(builder, smask, sample_enable[s], "");
+               LLVMBuildStore(builder, smask,
+                              LLVMBuildGEP(builder, sample_mask_store,
+                                           &indexs, 1, ""));
+               mask = LLVMBuildOr(builder, mask, smask, "");
+            }
+            LLVMBuildStore(builder, mask, mask_ptr);
+         }
+      }
+      else {
+         for (i = 0; i < num_fs; i++) {
+            LLVMValueRef mask;
+            LLVMValueRef indexi = lp_build_const_int32(gallivm, i);
+            LLVMValueRef mask_ptr = LLVMBuildGEP(builder, mask_store,
+                                                 &indexi, 1, "mask_ptr");
+
+            if (partial_mask) {
+               mask = generate_quad_mask(gallivm, fs_type,
+                                         i*fs_type.length/4, mask_input);
+            }
+            else {
+               mask = lp_build_const_int_vec(gallivm, fs_type, ~0);
+            }
+            LLVMBuildStore(builder, mask, mask_ptr);
          }
-         LLVMBuildStore(builder, mask, mask_ptr);
       }
 
       generate_fs_loop(gallivm,
@@ -2615,13 +3121,22 @@ generate_fragment(struct llvmpipe_context *lp,
                        depth_ptr,
                        depth_stride,
                        facing,
-                       thread_data_ptr);
+                       thread_data_ptr,
+                       sample_mask_store,
+                       num_fs,
+                       sample_dz,
+                       depth_sample_stride);
 
       for (i = 0; i < num_fs; i++) {
          LLVMValueRef indexi = lp_build_const_int32(gallivm, i);
          LLVMValueRef ptr = LLVMBuildGEP(builder, mask_store,
                                          &indexi, 1, "");
          fs_mask[i] = LLVMBuildLoad(builder, ptr, "mask");
+         for (s = 0; key->multisample && s < LP_MAX_SAMPLES; s++) {
+            LLVMValueRef indexs = lp_build_const_int32(gallivm, s * num_fs + i);
+            ptr = LLVMBuildGEP(builder, sample_mask_store, &indexs, 1, "");
+            fs_sample_mask[s][i] = LLVMBuildLoad(builder, ptr, "sample_mask");
+         }
          /* This is fucked up need to reorganize things */
          for (cbuf = 0; cbuf < key->nr_cbufs; cbuf++) {
             for (chan = 0; chan < TGSI_NUM_CHANNELS; ++chan) {
@@ -2669,11 +3184,43 @@ generate_fragment(struct llvmpipe_context *lp,
                                 LLVMBuildGEP(builder, stride_ptr, &index, 1, ""),
                                 "");
 
-         generate_unswizzled_blend(gallivm, cbuf, variant,
-                                   key->cbuf_format[cbuf],
-                                   num_fs, fs_type, fs_mask, fs_out_color,
-                                   context_ptr, color_ptr, stride,
-                                   partial_mask, do_branch);
+         if (key->multisample) {
+            LLVMValueRef sample_stride;
+
+            sample_stride = LLVMBuildLoad(builder,
+                                          LLVMBuildGEP(builder, sample_stride_ptr,
+                                                       &index, 1, ""),
+                                          "");
+
+            /* Blend the shaded color into each covered sample in turn */
+            for (s = 0; s < num_samples; s++) {
+               LLVMValueRef offset, sample_color_ptr;
+
+               offset = LLVMBuildMul(builder, sample_stride,
+                                     lp_build_const_int32(gallivm, s), "");
+               sample_color_ptr =
+                  LLVMBuildBitCast(builder, color_ptr,
+                                   LLVMPointerType(int8_type, 0), "");
+               sample_color_ptr = LLVMBuildGEP(builder, sample_color_ptr,
+                                               &offset, 1, "");
+               sample_color_ptr = LLVMBuildBitCast(builder, sample_color_ptr,
+                                                   LLVMTypeOf(color_ptr), "");
+
+               generate_unswizzled_blend(gallivm, cbuf, variant,
+                                         key->cbuf_format[cbuf],
+                                         num_fs, fs_type, fs_sample_mask[s],
+                                         fs_out_color,
+                                         context_ptr, sample_color_ptr, stride,
+                                         TRUE, do_branch);
+            }
+         }
+         else {
+            generate_unswizzled_blend(gallivm, cbuf, variant,
+                                      key->cbuf_format[cbuf],
+                                      num_fs, fs_type, fs_mask, fs_out_color,
+                                      context_ptr, color_ptr, stride,
+                                      partial_mask, do_branch);
+         }
       }
    }
 
@@ -2723,6 +3270,10 @@ dump_fs_variant_key(const struct lp_fragment_shader_variant_key *key)
       debug_printf("occlusion_count = 1\n");
    }
 
+   if (key->multisample) {
+      debug_printf("multisample = 1\n");
+   }
+
    if (key->blend.logicop_enable) {
       debug_printf("blend.logicop_func = %s\n", util_str_logicop(key->blend.logicop_func, TRUE));
    }
@@ -2781,13 +3332,65 @@ lp_debug_fs_variant(const struct lp_fragment_shader_variant *variant)
 {
    debug_printf("llvmpipe: Fragment shader #%u variant #%u:\n", 
                 variant->shader->no, variant->no);
-   tgsi_dump(variant->shader->base.tokens, 0);
+   if (variant->shader->base.type == PIPE_SHADER_IR_NIR)
+      nir_print_shader(variant->shader->base.ir.nir, stderr);
+   else
+      tgsi_dump(variant->shader->base.tokens, 0);
    dump_fs_variant_key(&variant->key);
    debug_printf("variant->opaque = %u\n", variant->opaque);
    debug_printf("\n");
 }
 
 
+/**
+ * Compute the key under which a variant's object code is cached.
+ */
+static void
+lp_fs_get_ir_cache_key(const struct lp_fragment_shader *shader,
+                       const struct lp_fragment_shader_variant_key *key,
+                       unsigned char ir_sha1_cache_key[20])
+{
+   struct mesa_sha1 ctx;
+
+   _mesa_sha1_init(&ctx);
+   if (shader->base.type == PIPE_SHADER_IR_NIR) {
+      struct blob blob;
+
+      blob_init(&blob);
+      nir_serialize(&blob, shader->base.ir.nir);
+      _mesa_sha1_update(&ctx, blob.data, blob.size);
+      blob_finish(&blob);
+   }
+   else {
+      _mesa_sha1_update(&ctx, shader->base.tokens,
+                        tgsi_num_tokens(shader->base.tokens) *
+                        sizeof(struct tgsi_token));
+   }
+   _mesa_sha1_update(&ctx, key, shader->variant_key_size);
+   _mesa_sha1_final(&ctx, ir_sha1_cache_key);
+}
+
+
+/**
+ * Use the variant's shared code for rasterization.
+ */
+static void
+use_shared_code(struct lp_fragment_shader_variant *variant)
+{
+   const struct lp_shared_code *code = variant->code;
+
+   variant->jit_function[RAST_EDGE_TEST] =
+      (lp_jit_frag_func) code->functions[RAST_EDGE_TEST];
+   if (code->functions[RAST_WHOLE]) {
+      variant->jit_function[RAST_WHOLE] =
+         (lp_jit_frag_func) code->functions[RAST_WHOLE];
+   } else {
+      variant->jit_function[RAST_WHOLE] =
+         variant->jit_function[RAST_EDGE_TEST];
+   }
+}
+
+
 /**
  * Generate a new fragment shader variant from the shader code and
  * other state indicated by the key.
@@ -2797,24 +3400,20 @@ generate_variant(struct llvmpipe_context *lp,
                  struct lp_fragment_shader *shader,
                  const struct lp_fragment_shader_variant_key *key)
 {
+   struct llvmpipe_screen *screen = llvmpipe_screen(lp->pipe.screen);
    struct lp_fragment_shader_variant *variant;
    const struct util_format_description *cbuf0_format_desc = NULL;
    boolean fullcolormask;
    char module_name[64];
+   struct lp_cached_code cached = { 0 };
+   unsigned char ir_sha1_cache_key[20];
+   boolean needs_caching = FALSE;
+   func_pointer functions[2];
 
    variant = CALLOC_STRUCT(lp_fragment_shader_variant);
    if (!variant)
       return NULL;
 
-   util_snprintf(module_name, sizeof(module_name), "fs%u_variant%u",
-                 shader->no, shader->variants_created);
-
-   variant->gallivm = gallivm_create(module_name, lp->context);
-   if (!variant->gallivm) {
-      FREE(variant);
-      return NULL;
-   }
-
    variant->shader = shader;
    variant->list_item_global.base = variant;
    variant->list_item_local.base = variant;
@@ -2843,7 +3442,7 @@ generate_variant(struct llvmpipe_context *lp,
          !shader->info.base.writes_samplemask
       ? TRUE : FALSE;
 
-   if ((shader->info.base.num_tokens <= 1) &&
+   if (shader_is_empty(shader) &&
        !key->depth.enabled && !key->stencil[0].enabled) {
       variant->ps_inv_multiplier = 0;
    } else {
@@ -2854,6 +3453,31 @@ generate_variant(struct llvmpipe_context *lp,
       lp_debug_fs_variant(variant);
    }
 
+   lp_fs_get_ir_cache_key(shader, key, ir_sha1_cache_key);
+
+   /* Another context may have generated the same code already. */
+   variant->code = lp_code_cache_find(screen->code_cache, ir_sha1_cache_key);
+   if (variant->code) {
+      use_shared_code(variant);
+      variant->nr_instrs = variant->code->nr_instrs;
+      return variant;
+   }
+
+   util_snprintf(module_name, sizeof(module_name), "fs%u_variant%u",
+                 shader->no, variant->no);
+
+   if (screen->disk_shader_cache) {
+      lp_disk_cache_find_shader(screen, &cached, ir_sha1_cache_key);
+      needs_caching = !cached.data_size;
+   }
+
+   variant->gallivm = gallivm_create(module_name, lp->context, &cached);
+   if (!variant->gallivm) {
+      free(cached.data);
+      FREE(variant);
+      return NULL;
+   }
+
    lp_jit_init_types(variant);
    
    if (variant->jit_function[RAST_EDGE_TEST] == NULL)
@@ -2870,6 +3494,16 @@ generate_variant(struct llvmpipe_context *lp,
     * Compile everything
     */
 
+   /* Unless the code came from the disk cache, optimize it in the
+    * background, and make do with quickly compiled code meanwhile.
+    */
+   if (screen->async_compiler && !cached.data_size) {
+      variant->job = lp_async_compile(screen->async_compiler, variant->gallivm,
+                                      variant->function,
+                                      ARRAY_SIZE(variant->function),
+                                      ir_sha1_cache_key);
+   }
+
    gallivm_compile_module(variant->gallivm);
 
    variant->nr_instrs += lp_build_count_ir_module(variant->gallivm->module);
@@ -2888,12 +3522,78 @@ generate_variant(struct llvmpipe_context *lp,
       variant->jit_function[RAST_WHOLE] = variant->jit_function[RAST_EDGE_TEST];
    }
 
+   if (needs_caching)
+      lp_disk_cache_insert_shader(screen, &cached, ir_sha1_cache_key);
    gallivm_free_ir(variant->gallivm);
+   free(cached.data);
+
+   /* The quickly compiled code stays private to this variant. */
+   if (variant->job)
+      return variant;
+
+   /* Hand the code over to the screen so other contexts can use it. */
+   functions[RAST_EDGE_TEST] =
+      (func_pointer) variant->jit_function[RAST_EDGE_TEST];
+   functions[RAST_WHOLE] = (func_pointer) variant->jit_function[RAST_WHOLE];
+   variant->code = lp_code_cache_add(screen->code_cache, ir_sha1_cache_key,
+                                     variant->gallivm, functions,
+                                     ARRAY_SIZE(functions),
+                                     variant->nr_instrs);
+   variant->gallivm = NULL;
+   if (!variant->code) {
+      FREE(variant);
+      return NULL;
+   }
+
+   /* Use the cached code, in case another context added it first. */
+   use_shared_code(variant);
 
    return variant;
 }
 
 
+/**
+ * Switch the variants whose optimized code has been compiled in the
+ * background over to it.
+ */
+void
+llvmpipe_update_fs_variants(struct llvmpipe_context *lp)
+{
+   struct lp_fs_variant_list_item *li;
+
+   li = first_elem(&lp->fs_variants_list);
+   while (lp->nr_fs_variants_pending && !at_end(&lp->fs_variants_list, li)) {
+      struct lp_fragment_shader_variant *variant = li->base;
+
+      if (variant->job && lp_async_job_is_done(variant->job)) {
+         if (variant->job->code) {
+            lp_shared_code_reference(&variant->code, variant->job->code);
+            use_shared_code(variant);
+         }
+
+         /* Scenes in flight may still use the quickly compiled code, so
+          * that is only freed along with the variant.
+          */
+         lp_async_job_destroy(variant->job);
+         variant->job = NULL;
+         lp->nr_fs_variants_pending--;
+      }
+
+      li = next_elem(li);
+   }
+}
+
+
+static void
+free_shader_ir(struct lp_fragment_shader *shader)
+{
+   if (shader->base.type == PIPE_SHADER_IR_NIR)
+      ralloc_free(shader->base.ir.nir);
+   else
+      FREE((void *) shader->base.tokens);
+}
+
+
 static void *
 llvmpipe_create_fs_state(struct pipe_context *pipe,
                          const struct pipe_shader_state *templ)
@@ -2911,15 +3611,29 @@ llvmpipe_create_fs_state(struct pipe_context *pipe,
    shader->no = fs_no++;
    make_empty_list(&shader->variants);
 
-   /* get/save the summary info for this shader */
-   lp_build_tgsi_info(templ->tokens, &shader->info);
+   if (templ->type == PIPE_SHADER_IR_NIR) {
+      /* we take ownership of the shader */
+      struct nir_shader *nir = templ->ir.nir;
 
-   /* we need to keep a local copy of the tokens */
-   shader->base.tokens = tgsi_dup_tokens(templ->tokens);
+      lp_build_nir_prepare(nir);
+      nir_tgsi_scan_shader(nir, &shader->info.base);
 
-   shader->draw_data = draw_create_fragment_shader(llvmpipe->draw, templ);
+      shader->base.type = PIPE_SHADER_IR_NIR;
+      shader->base.ir.nir = nir;
+   }
+   else {
+      /* get/save the summary info for this shader */
+      lp_build_tgsi_info(templ->tokens, &shader->info);
+
+      /* we need to keep a local copy of the tokens */
+      shader->base.type = PIPE_SHADER_IR_TGSI;
+      shader->base.tokens = tgsi_dup_tokens(templ->tokens);
+   }
+
+   shader->draw_data = draw_create_fragment_shader(llvmpipe->draw,
+                                                   &shader->base);
    if (shader->draw_data == NULL) {
-      FREE((void *) shader->base.tokens);
+      free_shader_ir(shader);
       FREE(shader);
       return NULL;
    }
@@ -2972,7 +3686,10 @@ llvmpipe_create_fs_state(struct pipe_context *pipe,
       unsigned attrib;
       debug_printf("llvmpipe: Create fragment shader #%u %p:\n",
                    shader->no, (void *) shader);
-      tgsi_dump(templ->tokens, 0);
+      if (shader->base.type == PIPE_SHADER_IR_NIR)
+         nir_print_shader(shader->base.ir.nir, stderr);
+      else
+         tgsi_dump(shader->base.tokens, 0);
       debug_printf("usage masks:\n");
       for (attrib = 0; attrib < shader->info.base.num_inputs; ++attrib) {
          unsigned usage_mask = shader->info.base.input_usage_mask[attrib];
@@ -3024,7 +3741,13 @@ llvmpipe_remove_shader_variant(struct llvmpipe_context *lp,
                    lp->nr_fs_variants, variant->nr_instrs, lp->nr_fs_instrs);
    }
 
-   gallivm_destroy(variant->gallivm);
+   if (variant->job) {
+      lp_async_job_destroy(variant->job);
+      lp->nr_fs_variants_pending--;
+   }
+   if (variant->gallivm)
+      gallivm_destroy(variant->gallivm);
+   lp_shared_code_reference(&variant->code, NULL);
 
    /* remove from shader's list */
    remove_from_list(&variant->list_item_local);
@@ -3067,7 +3790,7 @@ llvmpipe_delete_fs_state(struct pipe_context *pipe, void *fs)
    draw_delete_fragment_shader(llvmpipe->draw, shader->draw_data);
 
    assert(shader->variants_cached == 0);
-   FREE((void *) shader->base.tokens);
+   free_shader_ir(shader);
    FREE(shader);
 }
 
@@ -3152,8 +3875,8 @@ force_dst_alpha_one(unsigned factor, boolean clamped_zero)
  * We need to generate several variants of the fragment pipeline to match
  * all the combinations of the contributing state atoms.
  *
- * TODO: there is actually no reason to tie this to context state -- the
- * generated code could be cached globally in the screen.
+ * The generated code itself isn't tied to the context: it is shared by
+ * all contexts through the screen's code cache.
  */
 static void
 make_variant_key(struct llvmpipe_context *lp,
@@ -3214,6 +3937,7 @@ make_variant_key(struct llvmpipe_context *lp,
    /* alpha.ref_value is passed in jit_context */
 
    key->flatshade = lp->rasterizer->flatshade;
+   key->multisample = util_framebuffer_get_num_samples(&lp->framebuffer) > 1;
    if (lp->active_occlusion_queries) {
       key->occlusion_count = TRUE;
    }
@@ -3443,6 +4167,8 @@ llvmpipe_update_fs(struct llvmpipe_context *lp)
          insert_at_head(&lp->fs_variants_list, &variant->list_item_global);
          lp->nr_fs_variants++;
          lp->nr_fs_instrs += variant->nr_instrs;
+         if (variant->job)
+            lp->nr_fs_variants_pending++;
          shader->variants_cached++;
       }
    }
@@ -3473,7 +4199,7 @@ llvmpipe_init_fs_funcs(struct llvmpipe_context *llvmpipe)
 boolean
 llvmpipe_rasterization_disabled(struct llvmpipe_context *lp)
 {
-   boolean null_fs = !lp->fs || lp->fs->info.base.num_tokens <= 1;
+   boolean null_fs = !lp->fs || shader_is_empty(lp->fs);
 
    return (null_fs &&
            !lp->depth_stencil->depth.enabled &&
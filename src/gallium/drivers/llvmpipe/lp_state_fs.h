@@ -77,6 +77,7 @@ struct lp_fragment_shader_variant_key
    unsigned occlusion_count:1;
    unsigned resource_1d:1;
    unsigned depth_clamp:1;
+   unsigned multisample:1;
 
    enum pipe_format zsbuf_format;
    enum pipe_format cbuf_format[PIPE_MAX_COLOR_BUFS];
@@ -100,8 +101,17 @@ struct lp_fragment_shader_variant
    boolean opaque;
    uint8_t ps_inv_multiplier;
 
+   /* Only valid while generating code, or while holding the quickly
+    * compiled code of a variant optimized in the background.
+    */
    struct gallivm_state *gallivm;
 
+   /* The generated code, shared with other contexts */
+   struct lp_shared_code *code;
+
+   /* Background compilation of the optimized code, if pending */
+   struct lp_async_job *job;
+
    LLVMTypeRef jit_context_ptr_type;
    LLVMTypeRef jit_thread_data_ptr_type;
    LLVMTypeRef jit_linear_context_ptr_type;
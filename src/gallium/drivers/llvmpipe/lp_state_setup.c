@@ -30,11 +30,13 @@
 #include "util/u_memory.h"
 #include "util/simple_list.h"
 #include "util/os_time.h"
+#include "util/mesa-sha1.h"
 #include "gallivm/lp_bld_arit.h"
 #include "gallivm/lp_bld_bitarit.h"
 #include "gallivm/lp_bld_const.h"
 #include "gallivm/lp_bld_debug.h"
 #include "gallivm/lp_bld_init.h"
+#include "gallivm/lp_bld_code_cache.h"
 #include "gallivm/lp_bld_logic.h"
 #include "gallivm/lp_bld_intr.h"
 #include "gallivm/lp_bld_flow.h"
@@ -707,15 +709,20 @@ static struct lp_setup_variant *
 generate_setup_variant(struct lp_setup_variant_key *key,
                        struct llvmpipe_context *lp)
 {
+   struct llvmpipe_screen *screen = llvmpipe_screen(lp->pipe.screen);
    struct lp_setup_variant *variant = NULL;
    struct gallivm_state *gallivm;
    struct lp_setup_args args;
-   char func_name[64];
+   struct lp_cached_code cached = { 0 };
+   unsigned char ir_sha1_cache_key[20];
+   boolean needs_caching = FALSE;
+   char module_name[64];
    LLVMTypeRef vec4f_type;
    LLVMTypeRef func_type;
    LLVMTypeRef arg_types[7];
    LLVMBasicBlockRef block;
    LLVMBuilderRef builder;
+   func_pointer jit_function;
    int64_t t0 = 0, t1;
 
    if (0)
@@ -727,10 +734,29 @@ generate_setup_variant(struct lp_setup_variant_key *key,
 
    variant->no = setup_no++;
 
-   util_snprintf(func_name, sizeof(func_name), "setup_variant_%u",
+   memcpy(&variant->key, key, key->size);
+   variant->list_item_global.base = variant;
+
+   _mesa_sha1_compute(key, key->size, ir_sha1_cache_key);
+
+   /* Another context may have generated the same code already. */
+   variant->code = lp_code_cache_find(screen->code_cache, ir_sha1_cache_key);
+   if (variant->code) {
+      variant->jit_function =
+         (lp_jit_setup_triangle) variant->code->functions[0];
+      return variant;
+   }
+
+   util_snprintf(module_name, sizeof(module_name), "setup_variant_%u",
                  variant->no);
 
-   variant->gallivm = gallivm = gallivm_create(func_name, lp->context);
+   if (screen->disk_shader_cache) {
+      lp_disk_cache_find_shader(screen, &cached, ir_sha1_cache_key);
+      needs_caching = !cached.data_size;
+   }
+
+   variant->gallivm = gallivm = gallivm_create(module_name, lp->context,
+                                               &cached);
    if (!variant->gallivm) {
       goto fail;
    }
@@ -741,9 +767,6 @@ generate_setup_variant(struct lp_setup_variant_key *key,
       t0 = os_time_get();
    }
 
-   memcpy(&variant->key, key, key->size);
-   variant->list_item_global.base = variant;
-
    /* Currently always deal with full 4-wide vertex attributes from
     * the vertices.
     */
@@ -761,7 +784,9 @@ generate_setup_variant(struct lp_setup_variant_key *key,
    func_type = LLVMFunctionType(LLVMVoidTypeInContext(gallivm->context),
                                 arg_types, ARRAY_SIZE(arg_types), 0);
 
-   variant->function = LLVMAddFunction(gallivm->module, func_name, func_type);
+   /* Not numbered, as cached object code is looked up by symbol name. */
+   variant->function = LLVMAddFunction(gallivm->module, "setup_variant",
+                                       func_type);
    if (!variant->function)
       goto fail;
 
@@ -805,7 +830,21 @@ generate_setup_variant(struct lp_setup_variant_key *key,
    if (!variant->jit_function)
       goto fail;
 
+   if (needs_caching)
+      lp_disk_cache_insert_shader(screen, &cached, ir_sha1_cache_key);
    gallivm_free_ir(variant->gallivm);
+   free(cached.data);
+   cached.data = NULL;
+   variant->function = NULL;
+
+   /* Hand the code over to the screen so other contexts can use it. */
+   jit_function = (func_pointer) variant->jit_function;
+   variant->code = lp_code_cache_add(screen->code_cache, ir_sha1_cache_key,
+                                     variant->gallivm, &jit_function, 1, 0);
+   variant->gallivm = NULL;
+   if (!variant->code)
+      goto fail;
+   variant->jit_function = (lp_jit_setup_triangle) variant->code->functions[0];
 
    /*
     * Update timing information:
@@ -825,6 +864,7 @@ fail:
       }
       FREE(variant);
    }
+   free(cached.data);
 
    return NULL;
 }
@@ -891,9 +931,7 @@ remove_setup_variant(struct llvmpipe_context *lp,
                    variant->no, lp->nr_setup_variants);
    }
 
-   if (variant->gallivm) {
-      gallivm_destroy(variant->gallivm);
-   }
+   lp_shared_code_reference(&variant->code, NULL);
 
    remove_from_list(&variant->list_item_global);
    lp->nr_setup_variants--;
@@ -57,8 +57,12 @@ struct lp_setup_variant {
    
    struct lp_setup_variant_list_item list_item_global;
 
+   /* Only valid while generating code */
    struct gallivm_state *gallivm;
 
+   /* The generated code, shared with other contexts */
+   struct lp_shared_code *code;
+
    /* XXX: this is a pointer to the LLVM IR.  Once jit_function is
     * generated, we never need to use the IR again - need to find a
     * way to release this data without destroying the generated
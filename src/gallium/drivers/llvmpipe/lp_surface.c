@@ -25,6 +25,9 @@
  * 
  **************************************************************************/
 
+#include "util/u_format.h"
+#include "util/u_inlines.h"
+#include "util/u_memory.h"
 #include "util/u_rect.h"
 #include "util/u_surface.h"
 #include "lp_context.h"
@@ -35,6 +38,40 @@
 #include "lp_query.h"
 
 
+/**
+ * Copy a box between two multisample textures with the same number of
+ * samples, sample by sample.
+ */
+static void
+lp_resource_copy_samples(struct pipe_resource *dst, unsigned dst_level,
+                         unsigned dstx, unsigned dsty, unsigned dstz,
+                         struct pipe_resource *src, unsigned src_level,
+                         const struct pipe_box *src_box)
+{
+   ubyte *dst_map = llvmpipe_resource_map(dst, dst_level, 0,
+                                          LP_TEX_USAGE_READ_WRITE);
+   ubyte *src_map = llvmpipe_resource_map(src, src_level, 0,
+                                          LP_TEX_USAGE_READ);
+   unsigned s;
+
+   for (s = 0; s < src->nr_samples; s++) {
+      util_copy_box(dst_map + s * llvmpipe_sample_stride(dst),
+                    dst->format,
+                    llvmpipe_resource_stride(dst, dst_level),
+                    llvmpipe_layer_stride(dst, dst_level),
+                    dstx, dsty, dstz,
+                    src_box->width, src_box->height, src_box->depth,
+                    src_map + s * llvmpipe_sample_stride(src),
+                    llvmpipe_resource_stride(src, src_level),
+                    llvmpipe_layer_stride(src, src_level),
+                    src_box->x, src_box->y, src_box->z);
+   }
+
+   llvmpipe_resource_unmap(src, src_level, 0);
+   llvmpipe_resource_unmap(dst, dst_level, 0);
+}
+
+
 static void
 lp_resource_copy(struct pipe_context *pipe,
                  struct pipe_resource *dst, unsigned dst_level,
@@ -56,11 +93,178 @@ lp_resource_copy(struct pipe_context *pipe,
                            FALSE, /* do_not_block */
                            "blit src");
 
+   if (src->nr_samples > 1) {
+      assert(dst->nr_samples == src->nr_samples);
+      lp_resource_copy_samples(dst, dst_level, dstx, dsty, dstz,
+                               src, src_level, src_box);
+      return;
+   }
+
    util_resource_copy_region(pipe, dst, dst_level, dstx, dsty, dstz,
                              src, src_level, src_box);
 }
 
 
+/**
+ * Resolve a box of a multisample texture into a single-sample texture of
+ * the same format.  Color samples are averaged, while for integer and
+ * depth/stencil formats the first sample is taken.
+ */
+static void
+lp_resolve_box(struct pipe_resource *dst, unsigned dst_level,
+               unsigned dstx, unsigned dsty, unsigned dstz,
+               struct pipe_resource *src, unsigned src_level,
+               unsigned srcx, unsigned srcy, unsigned srcz,
+               unsigned width, unsigned height, unsigned depth)
+{
+   const struct util_format_description *desc =
+      util_format_description(src->format);
+   const unsigned bpp = util_format_get_blocksize(src->format);
+   const unsigned nr_samples = src->nr_samples;
+   const unsigned sample_stride = llvmpipe_sample_stride(src);
+   const unsigned src_stride = llvmpipe_resource_stride(src, src_level);
+   const unsigned dst_stride = llvmpipe_resource_stride(dst, dst_level);
+   boolean first_sample = util_format_is_depth_or_stencil(src->format) ||
+                          util_format_is_pure_integer(src->format);
+   boolean bytewise = util_format_is_rgba8_variant(desc) &&
+                      desc->colorspace != UTIL_FORMAT_COLORSPACE_SRGB;
+   float *row = NULL, *sum = NULL;
+   unsigned z, y, i, s;
+
+   if (!first_sample && !bytewise) {
+      row = MALLOC(width * 4 * sizeof *row);
+      sum = MALLOC(width * 4 * sizeof *sum);
+      if (!row || !sum) {
+         FREE(row);
+         FREE(sum);
+         return;
+      }
+   }
+
+   for (z = 0; z < depth; z++) {
+      const ubyte *src_map = llvmpipe_resource_map(src, src_level, srcz + z,
+                                                   LP_TEX_USAGE_READ);
+      ubyte *dst_map = llvmpipe_resource_map(dst, dst_level, dstz + z,
+                                             LP_TEX_USAGE_READ_WRITE);
+
+      for (y = 0; y < height; y++) {
+         const ubyte *src_row = src_map + (srcy + y) * src_stride + srcx * bpp;
+         ubyte *dst_row = dst_map + (dsty + y) * dst_stride + dstx * bpp;
+
+         if (first_sample) {
+            memcpy(dst_row, src_row, width * bpp);
+         }
+         else if (bytewise) {
+            for (i = 0; i < width * bpp; i++) {
+               unsigned total = nr_samples / 2;
+               for (s = 0; s < nr_samples; s++)
+                  total += src_row[s * sample_stride + i];
+               dst_row[i] = total / nr_samples;
+            }
+         }
+         else {
+            memset(sum, 0, width * 4 * sizeof *sum);
+            for (s = 0; s < nr_samples; s++) {
+               desc->unpack_rgba_float(row, 0, src_row + s * sample_stride, 0,
+                                       width, 1);
+               for (i = 0; i < width * 4; i++)
+                  sum[i] += row[i];
+            }
+            for (i = 0; i < width * 4; i++)
+               sum[i] *= 1.0f / nr_samples;
+            desc->pack_rgba_float(dst_row, 0, sum, 0, width, 1);
+         }
+      }
+
+      llvmpipe_resource_unmap(dst, dst_level, dstz + z);
+      llvmpipe_resource_unmap(src, src_level, srcz + z);
+   }
+
+   FREE(row);
+   FREE(sum);
+}
+
+
+/**
+ * Blit from a multisample texture to a single-sample one.
+ *
+ * Straight copies are resolved in place.  Anything else (scaling, format
+ * conversion, partial masks, scissoring) is first resolved into a
+ * temporary texture which is then blitted the regular way.
+ */
+static void
+lp_blit_resolve(struct pipe_context *pipe,
+                const struct pipe_blit_info *info)
+{
+   struct pipe_resource *src = info->src.resource;
+   struct pipe_resource *dst = info->dst.resource;
+   const struct pipe_box *sbox = &info->src.box;
+   const struct pipe_box *dbox = &info->dst.box;
+   struct pipe_resource templ, *tmp;
+   struct pipe_blit_info tmp_info;
+   unsigned x0 = sbox->width < 0 ? sbox->x + sbox->width : sbox->x;
+   unsigned y0 = sbox->height < 0 ? sbox->y + sbox->height : sbox->y;
+   unsigned width = abs(sbox->width);
+   unsigned height = abs(sbox->height);
+
+   llvmpipe_flush_resource(pipe, src, info->src.level,
+                           TRUE, /* read_only */
+                           TRUE, /* cpu_access */
+                           FALSE, /* do_not_block */
+                           "resolve src");
+
+   if (src->format == dst->format &&
+       info->src.format == info->dst.format &&
+       util_format_get_mask(src->format) == info->mask &&
+       !info->scissor_enable &&
+       sbox->width == dbox->width &&
+       sbox->height == dbox->height &&
+       sbox->depth == dbox->depth &&
+       sbox->width > 0 && sbox->height > 0) {
+      llvmpipe_flush_resource(pipe, dst, info->dst.level,
+                              FALSE, /* read_only */
+                              TRUE, /* cpu_access */
+                              FALSE, /* do_not_block */
+                              "resolve dest");
+      lp_resolve_box(dst, info->dst.level, dbox->x, dbox->y, dbox->z,
+                     src, info->src.level, sbox->x, sbox->y, sbox->z,
+                     width, height, sbox->depth);
+      return;
+   }
+
+   memset(&templ, 0, sizeof templ);
+   templ.target = sbox->depth > 1 ? PIPE_TEXTURE_2D_ARRAY : PIPE_TEXTURE_2D;
+   templ.format = src->format;
+   templ.width0 = width;
+   templ.height0 = height;
+   templ.depth0 = 1;
+   templ.array_size = sbox->depth;
+   templ.bind = PIPE_BIND_SAMPLER_VIEW;
+
+   tmp = pipe->screen->resource_create(pipe->screen, &templ);
+   if (!tmp) {
+      debug_printf("llvmpipe: out of memory resolving %s\n",
+                   util_format_short_name(src->format));
+      return;
+   }
+
+   lp_resolve_box(tmp, 0, 0, 0, 0,
+                  src, info->src.level, x0, y0, sbox->z,
+                  width, height, sbox->depth);
+
+   tmp_info = *info;
+   tmp_info.src.resource = tmp;
+   tmp_info.src.level = 0;
+   tmp_info.src.box.x = sbox->width < 0 ? width : 0;
+   tmp_info.src.box.y = sbox->height < 0 ? height : 0;
+   tmp_info.src.box.z = 0;
+
+   pipe->blit(pipe, &tmp_info);
+
+   pipe_resource_reference(&tmp, NULL);
+}
+
+
 static void lp_blit(struct pipe_context *pipe,
                     const struct pipe_blit_info *blit_info)
 {
@@ -71,10 +275,8 @@ static void lp_blit(struct pipe_context *pipe,
       return;
 
    if (info.src.resource->nr_samples > 1 &&
-       info.dst.resource->nr_samples <= 1 &&
-       !util_format_is_depth_or_stencil(info.src.resource->format) &&
-       !util_format_is_pure_integer(info.src.resource->format)) {
-      debug_printf("llvmpipe: color resolve unimplemented\n");
+       info.dst.resource->nr_samples <= 1) {
+      lp_blit_resolve(pipe, &info);
       return;
    }
 
@@ -185,6 +387,51 @@ llvmpipe_surface_destroy(struct pipe_context *pipe,
 }
 
 
+/**
+ * Copy a cleared region of the first sample of a multisample surface to
+ * the other samples, as the generic clear helpers only see the first one.
+ * With a byte mask only the pixel bytes which are set in it are copied.
+ */
+static void
+lp_replicate_first_sample(struct pipe_surface *surf,
+                          const ubyte *byte_mask,
+                          unsigned x, unsigned y,
+                          unsigned width, unsigned height)
+{
+   struct pipe_resource *pt = surf->texture;
+   const unsigned level = surf->u.tex.level;
+   const unsigned bpp = util_format_get_blocksize(surf->format);
+   const unsigned stride = llvmpipe_resource_stride(pt, level);
+   const unsigned sample_stride = llvmpipe_sample_stride(pt);
+   unsigned layer, row, s, i;
+
+   for (layer = surf->u.tex.first_layer;
+        layer <= surf->u.tex.last_layer; layer++) {
+      ubyte *map = llvmpipe_resource_map(pt, level, layer,
+                                         LP_TEX_USAGE_READ_WRITE);
+
+      for (row = y; row < y + height; row++) {
+         const ubyte *src = map + row * stride + x * bpp;
+
+         for (s = 1; s < pt->nr_samples; s++) {
+            ubyte *dst = map + s * sample_stride + row * stride + x * bpp;
+
+            if (!byte_mask) {
+               memcpy(dst, src, width * bpp);
+               continue;
+            }
+            for (i = 0; i < width * bpp; i++) {
+               if (byte_mask[i % bpp])
+                  dst[i] = src[i];
+            }
+         }
+      }
+
+      llvmpipe_resource_unmap(pt, level, layer);
+   }
+}
+
+
 static void
 llvmpipe_clear_render_target(struct pipe_context *pipe,
                              struct pipe_surface *dst,
@@ -200,6 +447,9 @@ llvmpipe_clear_render_target(struct pipe_context *pipe,
 
    util_clear_render_target(pipe, dst, color,
                             dstx, dsty, width, height);
+
+   if (dst->texture->nr_samples > 1)
+      lp_replicate_first_sample(dst, NULL, dstx, dsty, width, height);
 }
 
 
@@ -221,6 +471,28 @@ llvmpipe_clear_depth_stencil(struct pipe_context *pipe,
    util_clear_depth_stencil(pipe, dst, clear_flags,
                             depth, stencil,
                             dstx, dsty, width, height);
+
+   if (dst->texture->nr_samples > 1) {
+      const struct util_format_description *desc =
+         util_format_description(dst->format);
+      ubyte byte_mask[16];
+      unsigned i, chan;
+
+      /* Only the depth or stencil bytes may have been cleared */
+      memset(byte_mask, 0, sizeof byte_mask);
+      for (i = 0; i < 2; i++) {
+         const unsigned clear_bit = i == 0 ? PIPE_CLEAR_DEPTH
+                                           : PIPE_CLEAR_STENCIL;
+
+         chan = desc->swizzle[i];
+         if (!(clear_flags & clear_bit) || chan >= 4)
+            continue;
+         memset(byte_mask + desc->channel[chan].shift / 8, 0xff,
+                desc->channel[chan].size / 8);
+      }
+
+      lp_replicate_first_sample(dst, byte_mask, dstx, dsty, width, height);
+   }
 }
 
 
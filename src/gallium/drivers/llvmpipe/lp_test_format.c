@@ -150,7 +150,7 @@ test_format_float(unsigned verbose, FILE *fp,
    unsigned i, j, k, l;
 
    context = LLVMContextCreate();
-   gallivm = gallivm_create("test_module_float", context);
+   gallivm = gallivm_create("test_module_float", context, NULL);
 
    fetch = add_fetch_rgba_test(gallivm, verbose, desc, lp_float32_vec4_type());
 
@@ -249,7 +249,7 @@ test_format_unorm8(unsigned verbose, FILE *fp,
    unsigned i, j, k, l;
 
    context = LLVMContextCreate();
-   gallivm = gallivm_create("test_module_unorm8", context);
+   gallivm = gallivm_create("test_module_unorm8", context, NULL);
 
    fetch = add_fetch_rgba_test(gallivm, verbose, desc, lp_unorm8_vec4_type());
 
@@ -381,18 +381,6 @@ test_all(unsigned verbose, FILE *fp)
       if (util_format_is_pure_integer(format))
 	 continue;
 
-      /* only have util fetch func for etc1 */
-      if (format_desc->layout == UTIL_FORMAT_LAYOUT_ETC &&
-          format != PIPE_FORMAT_ETC1_RGB8) {
-         continue;
-      }
-
-      /* missing fetch funcs */
-      if (format_desc->layout == UTIL_FORMAT_LAYOUT_BPTC ||
-          format_desc->layout == UTIL_FORMAT_LAYOUT_ASTC) {
-         continue;
-      }
-
       if (!test_one(verbose, fp, format_desc)) {
            success = FALSE;
       }
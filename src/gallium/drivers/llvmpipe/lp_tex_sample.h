@@ -44,6 +44,8 @@ struct lp_sampler_static_state;
  *
  */
 struct lp_build_sampler_soa *
-lp_llvm_sampler_soa_create(const struct lp_sampler_static_state *key);
+lp_llvm_sampler_soa_create(const struct lp_sampler_static_state *key,
+                           unsigned textures_index,
+                           unsigned samplers_index);
 
 #endif /* LP_TEX_SAMPLE_H */
@@ -37,6 +37,7 @@
 
 #include "util/u_inlines.h"
 #include "util/u_cpu_detect.h"
+#include "util/u_atomic.h"
 #include "util/u_format.h"
 #include "util/u_math.h"
 #include "util/u_memory.h"
@@ -56,6 +57,9 @@
 
 #ifdef DEBUG
 static struct llvmpipe_resource resource_list;
+/* Resources may be created and destroyed from the threaded context's
+ * application thread as well as from the driver thread. */
+static mtx_t resource_list_mutex = _MTX_INITIALIZER_NP;
 #endif
 static unsigned id_counter = 0;
 
@@ -69,7 +73,7 @@ llvmpipe_texture_layout(struct llvmpipe_screen *screen,
                         struct llvmpipe_resource *lpr,
                         boolean allocate)
 {
-   struct pipe_resource *pt = &lpr->base;
+   struct pipe_resource *pt = &lpr->base.b;
    unsigned level;
    unsigned width = pt->width0;
    unsigned height = pt->height0;
@@ -106,7 +110,7 @@ llvmpipe_texture_layout(struct llvmpipe_screen *screen,
          align_x = align_y = 1;
       else {
          align_x = LP_RASTER_BLOCK_SIZE;
-         if (llvmpipe_resource_is_1d(&lpr->base))
+         if (llvmpipe_resource_is_1d(&lpr->base.b))
             align_y = 1;
          else
             align_y = LP_RASTER_BLOCK_SIZE;
@@ -132,16 +136,16 @@ llvmpipe_texture_layout(struct llvmpipe_screen *screen,
       lpr->img_stride[level] = lpr->row_stride[level] * nblocksy;
 
       /* Number of 3D image slices, cube faces or texture array layers */
-      if (lpr->base.target == PIPE_TEXTURE_CUBE) {
+      if (lpr->base.b.target == PIPE_TEXTURE_CUBE) {
          assert(layers == 6);
       }
 
-      if (lpr->base.target == PIPE_TEXTURE_3D)
+      if (lpr->base.b.target == PIPE_TEXTURE_3D)
          num_slices = depth;
-      else if (lpr->base.target == PIPE_TEXTURE_1D_ARRAY ||
-               lpr->base.target == PIPE_TEXTURE_2D_ARRAY ||
-               lpr->base.target == PIPE_TEXTURE_CUBE ||
-               lpr->base.target == PIPE_TEXTURE_CUBE_ARRAY)
+      else if (lpr->base.b.target == PIPE_TEXTURE_1D_ARRAY ||
+               lpr->base.b.target == PIPE_TEXTURE_2D_ARRAY ||
+               lpr->base.b.target == PIPE_TEXTURE_CUBE ||
+               lpr->base.b.target == PIPE_TEXTURE_CUBE_ARRAY)
          num_slices = layers;
       else
          num_slices = 1;
@@ -166,6 +170,14 @@ llvmpipe_texture_layout(struct llvmpipe_screen *screen,
       depth = u_minify(depth, 1);
    }
 
+   lpr->sample_stride = total_size;
+   if (pt->nr_samples > 1) {
+      total_size *= pt->nr_samples;
+      if (total_size > LP_MAX_TEXTURE_SIZE) {
+         goto fail;
+      }
+   }
+
    if (allocate) {
       lpr->tex_data = align_malloc(total_size, mip_align);
       if (!lpr->tex_data) {
@@ -193,7 +205,7 @@ llvmpipe_can_create_resource(struct pipe_screen *screen,
 {
    struct llvmpipe_resource lpr;
    memset(&lpr, 0, sizeof(lpr));
-   lpr.base = *res;
+   lpr.base.b = *res;
    return llvmpipe_texture_layout(llvmpipe_screen(screen), &lpr, false);
 }
 
@@ -208,12 +220,12 @@ llvmpipe_displaytarget_layout(struct llvmpipe_screen *screen,
    /* Round up the surface size to a multiple of the tile size to
     * avoid tile clipping.
     */
-   const unsigned width = MAX2(1, align(lpr->base.width0, TILE_SIZE));
-   const unsigned height = MAX2(1, align(lpr->base.height0, TILE_SIZE));
+   const unsigned width = MAX2(1, align(lpr->base.b.width0, TILE_SIZE));
+   const unsigned height = MAX2(1, align(lpr->base.b.height0, TILE_SIZE));
 
    lpr->dt = winsys->displaytarget_create(winsys,
-                                          lpr->base.bind,
-                                          lpr->base.format,
+                                          lpr->base.b.bind,
+                                          lpr->base.b.format,
                                           width, height,
                                           64,
                                           map_front_private,
@@ -246,17 +258,19 @@ llvmpipe_resource_create_front(struct pipe_screen *_screen,
    if (!lpr)
       return NULL;
 
-   lpr->base = *templat;
-   pipe_reference_init(&lpr->base.reference, 1);
-   lpr->base.screen = &screen->base;
+   lpr->base.b = *templat;
+   pipe_reference_init(&lpr->base.b.reference, 1);
+   lpr->base.b.screen = &screen->base;
 
-   /* assert(lpr->base.bind); */
+   /* assert(lpr->base.b.bind); */
 
-   if (llvmpipe_resource_is_texture(&lpr->base)) {
-      if (lpr->base.bind & (PIPE_BIND_DISPLAY_TARGET |
+   if (llvmpipe_resource_is_texture(&lpr->base.b)) {
+      if (lpr->base.b.bind & (PIPE_BIND_DISPLAY_TARGET |
                             PIPE_BIND_SCANOUT |
                             PIPE_BIND_SHARED)) {
          /* displayable surface */
+         if (lpr->base.b.nr_samples > 1)
+            goto fail;
          if (!llvmpipe_displaytarget_layout(screen, lpr, map_front_private))
             goto fail;
       }
@@ -291,13 +305,17 @@ llvmpipe_resource_create_front(struct pipe_screen *_screen,
       memset(lpr->data, 0, bytes);
    }
 
-   lpr->id = id_counter++;
+   threaded_resource_init(&lpr->base.b);
+
+   lpr->id = p_atomic_inc_return(&id_counter);
 
 #ifdef DEBUG
+   mtx_lock(&resource_list_mutex);
    insert_at_tail(&resource_list, lpr);
+   mtx_unlock(&resource_list_mutex);
 #endif
 
-   return &lpr->base;
+   return &lpr->base.b;
 
  fail:
    FREE(lpr);
@@ -338,10 +356,13 @@ llvmpipe_resource_destroy(struct pipe_screen *pscreen,
    }
 
 #ifdef DEBUG
+   mtx_lock(&resource_list_mutex);
    if (lpr->next)
       remove_from_list(lpr);
+   mtx_unlock(&resource_list_mutex);
 #endif
 
+   threaded_resource_deinit(pt);
    FREE(lpr);
 }
 
@@ -450,17 +471,17 @@ llvmpipe_resource_from_handle(struct pipe_screen *screen,
       goto no_lpr;
    }
 
-   lpr->base = *template;
-   pipe_reference_init(&lpr->base.reference, 1);
-   lpr->base.screen = screen;
+   lpr->base.b = *template;
+   pipe_reference_init(&lpr->base.b.reference, 1);
+   lpr->base.b.screen = screen;
 
    /*
     * Looks like unaligned displaytargets work just fine,
     * at least sampler/render ones.
     */
 #if 0
-   assert(lpr->base.width0 == width);
-   assert(lpr->base.height0 == height);
+   assert(lpr->base.b.width0 == width);
+   assert(lpr->base.b.height0 == height);
 #endif
 
    lpr->dt = winsys->displaytarget_from_handle(winsys,
@@ -471,13 +492,18 @@ llvmpipe_resource_from_handle(struct pipe_screen *screen,
       goto no_dt;
    }
 
-   lpr->id = id_counter++;
+   threaded_resource_init(&lpr->base.b);
+   lpr->base.is_shared = true;
+
+   lpr->id = p_atomic_inc_return(&id_counter);
 
 #ifdef DEBUG
+   mtx_lock(&resource_list_mutex);
    insert_at_tail(&resource_list, lpr);
+   mtx_unlock(&resource_list_mutex);
 #endif
 
-   return &lpr->base;
+   return &lpr->base.b;
 
 no_dt:
    FREE(lpr);
@@ -504,6 +530,29 @@ llvmpipe_resource_get_handle(struct pipe_screen *screen,
 }
 
 
+/**
+ * Flag the fragment constants dirty if the given resource, which is about
+ * to be written by the CPU, is a currently bound fragment constant buffer.
+ */
+static void
+llvmpipe_check_constant_buffer_write(struct llvmpipe_context *llvmpipe,
+                                     struct pipe_resource *resource)
+{
+   unsigned i;
+
+   if (!(resource->bind & PIPE_BIND_CONSTANT_BUFFER))
+      return;
+
+   for (i = 0; i < ARRAY_SIZE(llvmpipe->constants[PIPE_SHADER_FRAGMENT]); ++i) {
+      if (resource == llvmpipe->constants[PIPE_SHADER_FRAGMENT][i].buffer) {
+         /* constants may have changed */
+         llvmpipe->dirty |= LP_NEW_FS_CONSTANTS;
+         break;
+      }
+   }
+}
+
+
 static void *
 llvmpipe_transfer_map( struct pipe_context *pipe,
                        struct pipe_resource *resource,
@@ -546,23 +595,19 @@ llvmpipe_transfer_map( struct pipe_context *pipe,
       }
    }
 
-   /* Check if we're mapping a current constant buffer */
+   /*
+    * Check if we're mapping a current constant buffer.  Mappings made from
+    * the threaded context's application thread must not touch the context;
+    * those are checked when the (queued) unmap reaches us instead.
+    */
    if ((usage & PIPE_TRANSFER_WRITE) &&
-       (resource->bind & PIPE_BIND_CONSTANT_BUFFER)) {
-      unsigned i;
-      for (i = 0; i < ARRAY_SIZE(llvmpipe->constants[PIPE_SHADER_FRAGMENT]); ++i) {
-         if (resource == llvmpipe->constants[PIPE_SHADER_FRAGMENT][i].buffer) {
-            /* constants may have changed */
-            llvmpipe->dirty |= LP_NEW_FS_CONSTANTS;
-            break;
-         }
-      }
-   }
+       !(usage & TC_TRANSFER_MAP_THREADED_UNSYNC))
+      llvmpipe_check_constant_buffer_write(llvmpipe, resource);
 
    lpt = CALLOC_STRUCT(llvmpipe_transfer);
    if (!lpt)
       return NULL;
-   pt = &lpt->base;
+   pt = &lpt->base.b;
    pipe_resource_reference(&pt->resource, resource);
    pt->box = *box;
    pt->level = level;
@@ -594,7 +639,7 @@ llvmpipe_transfer_map( struct pipe_context *pipe,
       printf("transfer map tex %u  mode %s\n", lpr->id, mode);
    }
 
-   format = lpr->base.format;
+   format = lpr->base.b.format;
 
    map = llvmpipe_resource_map(resource,
                                level,
@@ -625,6 +670,11 @@ llvmpipe_transfer_unmap(struct pipe_context *pipe,
 {
    assert(transfer->resource);
 
+   if ((transfer->usage & PIPE_TRANSFER_WRITE) &&
+       (transfer->usage & TC_TRANSFER_MAP_THREADED_UNSYNC))
+      llvmpipe_check_constant_buffer_write(llvmpipe_context(pipe),
+                                           transfer->resource);
+
    llvmpipe_resource_unmap(transfer->resource,
                            transfer->level,
                            transfer->box.z);
@@ -638,6 +688,93 @@ llvmpipe_transfer_unmap(struct pipe_context *pipe,
    FREE(transfer);
 }
 
+/**
+ * Re-emit the state which caches pointers into a buffer's data, after the
+ * buffer's storage has been replaced.
+ */
+static void
+llvmpipe_rebind_buffer(struct llvmpipe_context *llvmpipe,
+                       struct pipe_resource *buf)
+{
+   unsigned shader, i;
+
+   for (shader = 0; shader < PIPE_SHADER_TYPES; shader++) {
+      for (i = 0; i < ARRAY_SIZE(llvmpipe->constants[shader]); i++) {
+         if (llvmpipe->constants[shader][i].buffer == buf) {
+            if (shader == PIPE_SHADER_VERTEX ||
+                shader == PIPE_SHADER_GEOMETRY) {
+               /* The draw module holds on to the mapped pointer. */
+               struct pipe_constant_buffer cb = llvmpipe->constants[shader][i];
+               llvmpipe->pipe.set_constant_buffer(&llvmpipe->pipe, shader,
+                                                  i, &cb);
+            }
+            else {
+               llvmpipe->dirty |= LP_NEW_FS_CONSTANTS;
+            }
+         }
+      }
+   }
+
+   for (i = 0; i < llvmpipe->num_sampler_views[PIPE_SHADER_FRAGMENT]; i++) {
+      struct pipe_sampler_view *view =
+         llvmpipe->sampler_views[PIPE_SHADER_FRAGMENT][i];
+      if (view && view->texture == buf)
+         llvmpipe->dirty |= LP_NEW_SAMPLER_VIEW;
+   }
+
+   for (i = 0; i < ARRAY_SIZE(llvmpipe->ssbos[PIPE_SHADER_FRAGMENT]); i++) {
+      if (llvmpipe->ssbos[PIPE_SHADER_FRAGMENT][i].buffer == buf)
+         llvmpipe->dirty |= LP_NEW_FS_SSBOS;
+   }
+
+   /* Vertex, index and stream output buffers, vertex shader sampler views
+    * and everything compute shaders use are looked up at each draw or
+    * launch, so there's nothing to do for them.
+    */
+}
+
+
+/**
+ * Threaded context buffer invalidation: move the storage of the freshly
+ * allocated src buffer into dst, releasing dst's old storage.
+ */
+void
+llvmpipe_replace_buffer_storage(struct pipe_context *pipe,
+                                struct pipe_resource *dst,
+                                struct pipe_resource *src)
+{
+   struct llvmpipe_context *llvmpipe = llvmpipe_context(pipe);
+   struct llvmpipe_resource *lp_dst = llvmpipe_resource(dst);
+   struct llvmpipe_resource *lp_src = llvmpipe_resource(src);
+
+   assert(dst->target == PIPE_BUFFER && src->target == PIPE_BUFFER);
+   assert(!lp_dst->userBuffer && !lp_src->userBuffer);
+
+   /*
+    * The old storage may still be read by scenes which haven't been
+    * rasterized yet.  Storage buffers aren't tracked by the scenes, so
+    * those always have to wait.
+    */
+   if (dst->bind & PIPE_BIND_SHADER_BUFFER)
+      llvmpipe_finish(pipe, __FUNCTION__);
+   else
+      llvmpipe_flush_resource(pipe, dst, 0,
+                              FALSE, /* read_only */
+                              TRUE, /* cpu_access */
+                              FALSE, /* do_not_block */
+                              __FUNCTION__);
+
+   align_free(lp_dst->data);
+   lp_dst->data = lp_src->data;
+
+   /* src is about to be destroyed; it no longer owns the storage. */
+   lp_src->data = NULL;
+   lp_src->userBuffer = TRUE;
+
+   llvmpipe_rebind_buffer(llvmpipe, dst);
+}
+
+
 unsigned int
 llvmpipe_is_resource_referenced( struct pipe_context *pipe,
                                  struct pipe_resource *presource,
@@ -698,20 +835,23 @@ llvmpipe_user_buffer_create(struct pipe_screen *screen,
    if (!buffer)
       return NULL;
 
-   pipe_reference_init(&buffer->base.reference, 1);
-   buffer->base.screen = screen;
-   buffer->base.format = PIPE_FORMAT_R8_UNORM; /* ?? */
-   buffer->base.bind = bind_flags;
-   buffer->base.usage = PIPE_USAGE_IMMUTABLE;
-   buffer->base.flags = 0;
-   buffer->base.width0 = bytes;
-   buffer->base.height0 = 1;
-   buffer->base.depth0 = 1;
-   buffer->base.array_size = 1;
+   pipe_reference_init(&buffer->base.b.reference, 1);
+   buffer->base.b.screen = screen;
+   buffer->base.b.format = PIPE_FORMAT_R8_UNORM; /* ?? */
+   buffer->base.b.bind = bind_flags;
+   buffer->base.b.usage = PIPE_USAGE_IMMUTABLE;
+   buffer->base.b.flags = 0;
+   buffer->base.b.width0 = bytes;
+   buffer->base.b.height0 = 1;
+   buffer->base.b.depth0 = 1;
+   buffer->base.b.array_size = 1;
    buffer->userBuffer = TRUE;
    buffer->data = ptr;
 
-   return &buffer->base;
+   threaded_resource_init(&buffer->base.b);
+   buffer->base.is_user_ptr = true;
+
+   return &buffer->base.b;
 }
 
 
@@ -736,7 +876,7 @@ llvmpipe_get_texture_image_address(struct llvmpipe_resource *lpr,
 {
    unsigned offset;
 
-   assert(llvmpipe_resource_is_texture(&lpr->base));
+   assert(llvmpipe_resource_is_texture(&lpr->base.b));
 
    offset = lpr->mip_offsets[level];
 
@@ -775,15 +915,17 @@ llvmpipe_print_resources(void)
    unsigned n = 0, total = 0;
 
    debug_printf("LLVMPIPE: current resources:\n");
+   mtx_lock(&resource_list_mutex);
    foreach(lpr, &resource_list) {
-      unsigned size = llvmpipe_resource_size(&lpr->base);
+      unsigned size = llvmpipe_resource_size(&lpr->base.b);
       debug_printf("resource %u at %p, size %ux%ux%u: %u bytes, refcount %u\n",
                    lpr->id, (void *) lpr,
-                   lpr->base.width0, lpr->base.height0, lpr->base.depth0,
-                   size, lpr->base.reference.count);
+                   lpr->base.b.width0, lpr->base.b.height0, lpr->base.b.depth0,
+                   size, lpr->base.b.reference.count);
       total += size;
       n++;
    }
+   mtx_unlock(&resource_list_mutex);
    debug_printf("LLVMPIPE: total size of %u resources: %u\n", n, total);
 }
 #endif
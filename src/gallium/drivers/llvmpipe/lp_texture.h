@@ -31,6 +31,7 @@
 
 #include "pipe/p_state.h"
 #include "util/u_debug.h"
+#include "util/u_threaded_context.h"
 #include "lp_limits.h"
 
 
@@ -58,7 +59,7 @@ struct sw_displaytarget;
  */
 struct llvmpipe_resource
 {
-   struct pipe_resource base;
+   struct threaded_resource base;
 
    /** Row stride in bytes */
    unsigned row_stride[LP_MAX_TEXTURE_LEVELS];
@@ -68,6 +69,11 @@ struct llvmpipe_resource
    unsigned mip_offsets[LP_MAX_TEXTURE_LEVELS];
    /** allocated total size (for non-display target texture resources only) */
    unsigned total_alloc_size;
+   /**
+    * Size in bytes of one sample of a multisample texture.  The samples are
+    * stored one after the other, each laid out like a single-sample texture.
+    */
+   unsigned sample_stride;
 
    /**
     * Display target, for textures with the PIPE_BIND_DISPLAY_TARGET
@@ -99,7 +105,7 @@ struct llvmpipe_resource
 
 struct llvmpipe_transfer
 {
-   struct pipe_transfer base;
+   struct threaded_transfer base;
 
    unsigned long offset;
 };
@@ -130,6 +136,11 @@ llvmpipe_transfer(struct pipe_transfer *pt)
 void llvmpipe_init_screen_resource_funcs(struct pipe_screen *screen);
 void llvmpipe_init_context_resource_funcs(struct pipe_context *pipe);
 
+void
+llvmpipe_replace_buffer_storage(struct pipe_context *pipe,
+                                struct pipe_resource *dst,
+                                struct pipe_resource *src);
+
 
 static inline boolean
 llvmpipe_resource_is_texture(const struct pipe_resource *resource)
@@ -185,6 +196,14 @@ llvmpipe_layer_stride(struct pipe_resource *resource,
 }
 
 
+static inline unsigned
+llvmpipe_sample_stride(struct pipe_resource *resource)
+{
+   struct llvmpipe_resource *lpr = llvmpipe_resource(resource);
+   return lpr->sample_stride;
+}
+
+
 static inline unsigned
 llvmpipe_resource_stride(struct pipe_resource *resource,
                          unsigned level)
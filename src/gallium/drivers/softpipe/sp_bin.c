@@ -0,0 +1,754 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * Tile binning and threaded rasterization.
+ *
+ * The binned primitives of a scene all use the same state, a copy of the
+ * context taken when the first of them was recorded.  A scene spans draws
+ * until a state change which affects rasterization reaches
+ * softpipe_update_derived(), or until the surfaces or any object the scene
+ * points at are accessed, changed or deleted; all of these call
+ * sp_bin_flush() first.  Changes which are fully handled by the draw
+ * module, such as new vertex buffers, don't end the scene.  The fragment
+ * shader constants are copied, since user constant buffers can change
+ * without the driver being told.
+ *
+ * Every rasterizer thread has a private softpipe_context which starts as
+ * a copy of that state, and has its own setup context, quad stages,
+ * fragment shader machine, texture caches and color/depth tile caches.
+ * Tile (x, y) of the framebuffer is always rendered by the same thread,
+ * with the cliprect narrowed to the tile, so the threads never touch each
+ * other's tiles.  The threads write their tiles back to the surfaces at
+ * the end of the scene.
+ */
+
+#include "pipe/p_shader_tokens.h"
+#include "tgsi/tgsi_exec.h"
+#include "util/u_cpu_detect.h"
+#include "util/u_debug.h"
+#include "util/u_dynarray.h"
+#include "util/u_framebuffer.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "util/u_queue.h"
+#include "sp_bin.h"
+#include "sp_context.h"
+#include "sp_quad_pipe.h"
+#include "sp_setup.h"
+#include "sp_state.h"
+#include "sp_tex_sample.h"
+#include "sp_tex_tile_cache.h"
+#include "sp_tile_cache.h"
+
+
+/** Max number of rasterizer threads, including the context's own thread */
+#define SP_MAX_THREADS 16
+
+
+typedef const float (*cptrf4)[4];
+
+
+/**
+ * A binned point, line or triangle.
+ */
+struct sp_bin_prim {
+   unsigned prim;   /**< PIPE_PRIM_POINTS, _LINES or _TRIANGLES */
+   unsigned v[3];   /**< offsets of the vertices in sp_binner::verts */
+};
+
+
+/**
+ * Per-thread rasterization state.
+ */
+struct sp_bin_thread {
+   struct sp_binner *binner;
+   unsigned index;
+
+   /** Private copy of the scene's state, pointing at the objects below */
+   struct softpipe_context *softpipe;
+
+   struct setup_context *setup;
+   struct tgsi_exec_machine *fs_machine;
+   const struct sp_fragment_shader_variant *fs_variant;
+   struct sp_tgsi_sampler *sampler;
+
+   struct quad_stage *shade;
+   struct quad_stage *depth_test;
+   struct quad_stage *blend;
+   struct quad_stage *pstipple;
+
+   struct softpipe_tile_cache *cbuf_cache[PIPE_MAX_COLOR_BUFS];
+   struct softpipe_tile_cache *zsbuf_cache;
+   struct softpipe_tex_tile_cache *tex_cache[PIPE_MAX_SHADER_SAMPLER_VIEWS];
+
+   struct util_queue_fence fence;
+};
+
+
+struct sp_binner {
+   struct softpipe_context *softpipe;
+
+   /** The state the scene is rendered with */
+   struct softpipe_context state;
+   struct sp_tgsi_sampler sampler;
+   struct pipe_framebuffer_state framebuffer;
+   void *constants[PIPE_MAX_CONSTANT_BUFFERS];
+   unsigned constants_size[PIPE_MAX_CONSTANT_BUFFERS];
+   boolean have_state;
+
+   /** Whether the state allows rendering with the threads */
+   boolean threaded;
+
+   unsigned vertex_size;         /**< in floats */
+   struct util_dynarray verts;   /**< float */
+   struct util_dynarray prims;   /**< struct sp_bin_prim */
+
+   /** One list of indices into prims per tile, in submission order */
+   struct util_dynarray *bins;
+   unsigned num_bins;
+   unsigned tiles_x, tiles_y;
+
+   unsigned num_threads;
+   struct sp_bin_thread thread[SP_MAX_THREADS];
+   struct util_queue queue;
+};
+
+
+static inline cptrf4
+bin_vert(const struct sp_binner *binner, unsigned offset)
+{
+   return (cptrf4) ((const float *) binner->verts.data + offset);
+}
+
+
+/**
+ * Take a copy of the current state for the scene, and decide whether the
+ * scene can be rendered by the threads at all.
+ */
+static void
+bin_set_state(struct sp_binner *binner)
+{
+   struct softpipe_context *softpipe = binner->softpipe;
+   const struct sp_fragment_shader_variant *fs = softpipe->fs_variant;
+   unsigned tiles_x, tiles_y, i;
+
+   binner->have_state = TRUE;
+   binner->threaded = FALSE;
+
+   /* Fragments with side effects must be processed in submission order,
+    * and the statistics would count a primitive once for each tile.
+    */
+   if (!fs ||
+       fs->info.writes_memory ||
+       fs->info.file_count[TGSI_FILE_IMAGE] ||
+       fs->info.file_count[TGSI_FILE_BUFFER] ||
+       softpipe->active_statistics_queries ||
+       softpipe->no_rast)
+      return;
+
+   tiles_x = DIV_ROUND_UP(softpipe->framebuffer.width, TILE_SIZE);
+   tiles_y = DIV_ROUND_UP(softpipe->framebuffer.height, TILE_SIZE);
+   if (tiles_x * tiles_y < 2)
+      return;
+
+   /* texture caches of the threads, for the views the shader may use */
+   for (i = 0; i < binner->num_threads; i++) {
+      struct sp_bin_thread *t = &binner->thread[i];
+      unsigned j;
+
+      for (j = 0; j < softpipe->num_sampler_views[PIPE_SHADER_FRAGMENT]; j++) {
+         if (!t->tex_cache[j]) {
+            t->tex_cache[j] = sp_create_tex_tile_cache(&softpipe->pipe);
+            if (!t->tex_cache[j])
+               return;
+         }
+      }
+   }
+
+   if (tiles_x * tiles_y > binner->num_bins) {
+      struct util_dynarray *bins =
+         CALLOC(tiles_x * tiles_y, sizeof(struct util_dynarray));
+      if (!bins)
+         return;
+
+      for (i = 0; i < binner->num_bins; i++)
+         util_dynarray_fini(&binner->bins[i]);
+      FREE(binner->bins);
+
+      binner->bins = bins;
+      binner->num_bins = tiles_x * tiles_y;
+   }
+   binner->tiles_x = tiles_x;
+   binner->tiles_y = tiles_y;
+
+   memcpy(&binner->state, softpipe, sizeof(*softpipe));
+   memcpy(&binner->sampler, softpipe->tgsi.sampler[PIPE_SHADER_FRAGMENT],
+          sizeof(binner->sampler));
+
+   for (i = 0; i < PIPE_MAX_CONSTANT_BUFFERS; i++) {
+      const void *data = softpipe->mapped_constants[PIPE_SHADER_FRAGMENT][i];
+      const unsigned size = softpipe->const_buffer_size[PIPE_SHADER_FRAGMENT][i];
+
+      if (!data || !size)
+         continue;
+
+      if (size > binner->constants_size[i]) {
+         void *constants = REALLOC(binner->constants[i],
+                                   binner->constants_size[i], size);
+         if (!constants)
+            return;
+         binner->constants[i] = constants;
+         binner->constants_size[i] = size;
+      }
+      memcpy(binner->constants[i], data, size);
+      binner->state.mapped_constants[PIPE_SHADER_FRAGMENT][i] =
+         binner->constants[i];
+   }
+
+   /* keep the surfaces alive until the scene is rendered */
+   util_copy_framebuffer_state(&binner->framebuffer, &softpipe->framebuffer);
+
+   binner->vertex_size = softpipe->vertex_info.size;
+   binner->threaded = TRUE;
+}
+
+
+static unsigned
+bin_vertex(struct sp_binner *binner, cptrf4 v)
+{
+   const unsigned size = binner->vertex_size * sizeof(float);
+   unsigned offset = binner->verts.size / sizeof(float);
+
+   memcpy(util_dynarray_grow(&binner->verts, size), v, size);
+   return offset;
+}
+
+
+/**
+ * Record a primitive and add it to the bins of all the tiles its bounding
+ * box, grown by \p margin pixels, touches.
+ * \return FALSE if the primitive has to be rendered immediately instead
+ */
+static boolean
+bin_prim(struct softpipe_context *softpipe, unsigned prim,
+         const cptrf4 v[3], unsigned nr, float margin)
+{
+   struct sp_binner *binner = softpipe->binner;
+   struct sp_bin_prim *p;
+   float minx, miny, maxx, maxy;
+   unsigned index, tx0, ty0, tx1, ty1, tx, ty, i;
+
+   if (!binner->have_state)
+      bin_set_state(binner);
+   if (!binner->threaded)
+      return FALSE;
+
+   minx = maxx = v[0][0][0];
+   miny = maxy = v[0][0][1];
+   for (i = 1; i < nr; i++) {
+      minx = MIN2(minx, v[i][0][0]);
+      maxx = MAX2(maxx, v[i][0][0]);
+      miny = MIN2(miny, v[i][0][1]);
+      maxy = MAX2(maxy, v[i][0][1]);
+   }
+   minx -= margin;
+   miny -= margin;
+   maxx += margin;
+   maxy += margin;
+
+   /* Entirely outside of the framebuffer; this also rejects NaNs. */
+   if (!(maxx >= 0.0f && maxy >= 0.0f &&
+         minx < (float) binner->state.framebuffer.width &&
+         miny < (float) binner->state.framebuffer.height))
+      return TRUE;
+
+   tx0 = (unsigned) MAX2(minx, 0.0f) >> TILE_SIZE_LOG2;
+   ty0 = (unsigned) MAX2(miny, 0.0f) >> TILE_SIZE_LOG2;
+   tx1 = MIN2((unsigned) MIN2(maxx, (float) MAX_WIDTH) >> TILE_SIZE_LOG2,
+              binner->tiles_x - 1);
+   ty1 = MIN2((unsigned) MIN2(maxy, (float) MAX_HEIGHT) >> TILE_SIZE_LOG2,
+              binner->tiles_y - 1);
+
+   index = binner->prims.size / sizeof(struct sp_bin_prim);
+   p = util_dynarray_grow(&binner->prims, sizeof(struct sp_bin_prim));
+   p->prim = prim;
+   for (i = 0; i < nr; i++)
+      p->v[i] = bin_vertex(binner, v[i]);
+
+   for (ty = ty0; ty <= ty1; ty++) {
+      for (tx = tx0; tx <= tx1; tx++) {
+         util_dynarray_append(&binner->bins[ty * binner->tiles_x + tx],
+                              unsigned, index);
+      }
+   }
+
+   return TRUE;
+}
+
+
+boolean
+sp_bin_point(struct softpipe_context *softpipe,
+             const float (*v0)[4])
+{
+   cptrf4 v[3] = { v0, NULL, NULL };
+   const int size_attr = softpipe->psize_slot;
+   const float size = size_attr > 0 ? v0[size_attr][0]
+                                    : softpipe->rasterizer->point_size;
+
+   return bin_prim(softpipe, PIPE_PRIM_POINTS, v, 1, 0.5f * size + 1.0f);
+}
+
+
+boolean
+sp_bin_line(struct softpipe_context *softpipe,
+            const float (*v0)[4],
+            const float (*v1)[4])
+{
+   cptrf4 v[3] = { v0, v1, NULL };
+
+   return bin_prim(softpipe, PIPE_PRIM_LINES, v, 2,
+                   0.5f * softpipe->rasterizer->line_width + 1.0f);
+}
+
+
+boolean
+sp_bin_tri(struct softpipe_context *softpipe,
+           const float (*v0)[4],
+           const float (*v1)[4],
+           const float (*v2)[4])
+{
+   cptrf4 v[3] = { v0, v1, v2 };
+
+   return bin_prim(softpipe, PIPE_PRIM_TRIANGLES, v, 3, 1.0f);
+}
+
+
+/**
+ * Point the thread's context at the scene's state and at the thread's own
+ * caches and shader machine.  Called from the context's thread, since it
+ * maps surfaces.
+ */
+static void
+bin_thread_prepare(struct sp_bin_thread *t)
+{
+   struct sp_binner *binner = t->binner;
+   const struct softpipe_context *state = &binner->state;
+   const struct sp_fragment_shader_variant *fs = state->fs_variant;
+   struct softpipe_context *softpipe = t->softpipe;
+   unsigned i;
+
+   memcpy(softpipe, state, sizeof(*softpipe));
+   softpipe->binner = NULL;
+   softpipe->binning = FALSE;
+   softpipe->dirty = 0;
+   softpipe->occlusion_count = 0;
+
+   softpipe->quad.shade = t->shade;
+   softpipe->quad.depth_test = t->depth_test;
+   softpipe->quad.blend = t->blend;
+   softpipe->quad.pstipple = t->pstipple;
+
+   for (i = 0; i < PIPE_MAX_COLOR_BUFS; i++) {
+      sp_tile_cache_set_surface(t->cbuf_cache[i],
+                                i < binner->framebuffer.nr_cbufs ?
+                                binner->framebuffer.cbufs[i] : NULL);
+      softpipe->cbuf_cache[i] = t->cbuf_cache[i];
+   }
+   sp_tile_cache_set_surface(t->zsbuf_cache, binner->framebuffer.zsbuf);
+   softpipe->zsbuf_cache = t->zsbuf_cache;
+
+   memcpy(t->sampler->sp_sampler, binner->sampler.sp_sampler,
+          sizeof(t->sampler->sp_sampler));
+   for (i = 0; i < state->num_sampler_views[PIPE_SHADER_FRAGMENT]; i++) {
+      struct pipe_sampler_view *view =
+         state->sampler_views[PIPE_SHADER_FRAGMENT][i];
+      struct softpipe_tex_tile_cache *tc;
+
+      t->sampler->sp_sview[i] = binner->sampler.sp_sview[i];
+      if (!view)
+         continue;
+
+      tc = t->tex_cache[i];
+
+      sp_tex_tile_cache_set_sampler_view(tc, view);
+      if (tc->texture) {
+         struct softpipe_resource *spt = softpipe_resource(tc->texture);
+         if (spt->timestamp != tc->timestamp) {
+            sp_tex_tile_cache_validate_texture(tc);
+            tc->timestamp = spt->timestamp;
+         }
+      }
+      t->sampler->sp_sview[i].cache = tc;
+   }
+   softpipe->tgsi.sampler[PIPE_SHADER_FRAGMENT] = t->sampler;
+
+   softpipe->fs_machine = t->fs_machine;
+   if (t->fs_variant != fs || t->fs_machine->Tokens != fs->tokens) {
+      fs->prepare(fs, t->fs_machine,
+                  (struct tgsi_sampler *) t->sampler,
+                  (struct tgsi_image *) state->tgsi.image[PIPE_SHADER_FRAGMENT],
+                  (struct tgsi_buffer *) state->tgsi.buffer[PIPE_SHADER_FRAGMENT]);
+      t->fs_variant = fs;
+   }
+
+   sp_build_quad_pipeline(softpipe);
+   sp_setup_prepare(t->setup);
+}
+
+
+/**
+ * Rasterize the primitives of the thread's tiles.
+ * Called via util_queue, or directly for the first thread.
+ */
+static void
+bin_thread_rasterize(void *data, int thread_index)
+{
+   struct sp_bin_thread *t = (struct sp_bin_thread *) data;
+   const struct sp_binner *binner = t->binner;
+   struct softpipe_context *softpipe = t->softpipe;
+   const struct sp_bin_prim *prims = binner->prims.data;
+   const unsigned num_tiles = binner->tiles_x * binner->tiles_y;
+   unsigned tile, i;
+
+   for (tile = t->index; tile < num_tiles; tile += binner->num_threads) {
+      const struct util_dynarray *bin = &binner->bins[tile];
+      const unsigned *indices = bin->data;
+      const unsigned num_indices = bin->size / sizeof(unsigned);
+      const unsigned x0 = (tile % binner->tiles_x) * TILE_SIZE;
+      const unsigned y0 = (tile / binner->tiles_x) * TILE_SIZE;
+
+      if (!num_indices)
+         continue;
+
+      for (i = 0; i < PIPE_MAX_VIEWPORTS; i++) {
+         const struct pipe_scissor_state *clip = &binner->state.cliprect[i];
+         struct pipe_scissor_state *tile_clip = &softpipe->cliprect[i];
+
+         tile_clip->minx = MAX2(clip->minx, x0);
+         tile_clip->miny = MAX2(clip->miny, y0);
+         tile_clip->maxx = MAX2(MIN2(clip->maxx, x0 + TILE_SIZE),
+                                tile_clip->minx);
+         tile_clip->maxy = MAX2(MIN2(clip->maxy, y0 + TILE_SIZE),
+                                tile_clip->miny);
+      }
+
+      for (i = 0; i < num_indices; i++) {
+         const struct sp_bin_prim *p = &prims[indices[i]];
+
+         softpipe->reduced_prim = p->prim;
+         switch (p->prim) {
+         case PIPE_PRIM_POINTS:
+            sp_setup_point(t->setup, bin_vert(binner, p->v[0]));
+            break;
+         case PIPE_PRIM_LINES:
+            sp_setup_line(t->setup,
+                          bin_vert(binner, p->v[0]),
+                          bin_vert(binner, p->v[1]));
+            break;
+         default:
+            sp_setup_tri(t->setup,
+                         bin_vert(binner, p->v[0]),
+                         bin_vert(binner, p->v[1]),
+                         bin_vert(binner, p->v[2]));
+            break;
+         }
+      }
+   }
+
+   for (i = 0; i < binner->framebuffer.nr_cbufs; i++)
+      sp_flush_tile_cache(t->cbuf_cache[i]);
+   sp_flush_tile_cache(t->zsbuf_cache);
+}
+
+
+static void
+bin_thread_finish(struct sp_bin_thread *t)
+{
+   unsigned i;
+
+   t->binner->softpipe->occlusion_count += t->softpipe->occlusion_count;
+
+   for (i = 0; i < PIPE_MAX_COLOR_BUFS; i++)
+      sp_tile_cache_set_surface(t->cbuf_cache[i], NULL);
+   sp_tile_cache_set_surface(t->zsbuf_cache, NULL);
+}
+
+
+/**
+ * Render the binned primitives, and forget the scene's state.
+ */
+void
+sp_bin_flush(struct softpipe_context *softpipe)
+{
+   struct sp_binner *binner = softpipe->binner;
+   unsigned i;
+
+   if (!binner)
+      return;
+
+   if (binner->prims.size) {
+      /* The threads read the tiles from the surfaces, so anything drawn or
+       * cleared by this thread has to land there first.
+       */
+      for (i = 0; i < softpipe->framebuffer.nr_cbufs; i++)
+         if (softpipe->cbuf_cache[i])
+            sp_flush_tile_cache(softpipe->cbuf_cache[i]);
+      if (softpipe->zsbuf_cache)
+         sp_flush_tile_cache(softpipe->zsbuf_cache);
+
+      for (i = 0; i < binner->num_threads; i++)
+         bin_thread_prepare(&binner->thread[i]);
+
+      for (i = 1; i < binner->num_threads; i++) {
+         util_queue_add_job(&binner->queue, &binner->thread[i],
+                            &binner->thread[i].fence,
+                            bin_thread_rasterize, NULL);
+      }
+      bin_thread_rasterize(&binner->thread[0], 0);
+
+      for (i = 1; i < binner->num_threads; i++)
+         util_queue_fence_wait(&binner->thread[i].fence);
+
+      for (i = 0; i < binner->num_threads; i++)
+         bin_thread_finish(&binner->thread[i]);
+
+      for (i = 0; i < binner->tiles_x * binner->tiles_y; i++)
+         util_dynarray_clear(&binner->bins[i]);
+      util_dynarray_clear(&binner->prims);
+      util_dynarray_clear(&binner->verts);
+   }
+
+   if (binner->have_state) {
+      util_unreference_framebuffer_state(&binner->framebuffer);
+      binner->have_state = FALSE;
+   }
+}
+
+
+/**
+ * Called at the end of a draw.  The scene is normally kept open for the
+ * next draws, but stream output writes buffers the binned fragment shaders
+ * may read, so those draws are rendered right away.
+ */
+void
+sp_bin_end(struct softpipe_context *softpipe)
+{
+   if (softpipe->num_so_targets)
+      sp_bin_flush(softpipe);
+}
+
+
+/**
+ * How the pending scene uses a resource: its surfaces are written, and the
+ * fragment shader constants and sampler views are read.
+ * \return SP_REFERENCED_FOR_READ and/or SP_REFERENCED_FOR_WRITE, or
+ *         SP_UNREFERENCED
+ */
+unsigned
+sp_bin_is_resource_referenced(struct softpipe_context *softpipe,
+                              const struct pipe_resource *resource)
+{
+   const struct sp_binner *binner = softpipe->binner;
+   const struct pipe_framebuffer_state *fb;
+   const struct softpipe_context *state;
+   unsigned referenced = SP_UNREFERENCED;
+   unsigned i;
+
+   if (!binner || !binner->prims.size)
+      return SP_UNREFERENCED;
+
+   fb = &binner->framebuffer;
+   for (i = 0; i < fb->nr_cbufs; i++) {
+      if (fb->cbufs[i] && fb->cbufs[i]->texture == resource)
+         referenced |= SP_REFERENCED_FOR_WRITE;
+   }
+   if (fb->zsbuf && fb->zsbuf->texture == resource)
+      referenced |= SP_REFERENCED_FOR_WRITE;
+
+   state = &binner->state;
+   for (i = 0; i < PIPE_MAX_CONSTANT_BUFFERS; i++) {
+      if (state->constants[PIPE_SHADER_FRAGMENT][i] == resource)
+         referenced |= SP_REFERENCED_FOR_READ;
+   }
+   for (i = 0; i < state->num_sampler_views[PIPE_SHADER_FRAGMENT]; i++) {
+      const struct pipe_sampler_view *view =
+         state->sampler_views[PIPE_SHADER_FRAGMENT][i];
+
+      if (view && view->texture == resource)
+         referenced |= SP_REFERENCED_FOR_READ;
+   }
+
+   return referenced;
+}
+
+
+static void
+bin_thread_destroy(struct sp_bin_thread *t)
+{
+   unsigned i;
+
+   if (t->shade)
+      t->shade->destroy(t->shade);
+   if (t->depth_test)
+      t->depth_test->destroy(t->depth_test);
+   if (t->blend)
+      t->blend->destroy(t->blend);
+   if (t->pstipple)
+      t->pstipple->destroy(t->pstipple);
+
+   for (i = 0; i < PIPE_MAX_COLOR_BUFS; i++)
+      sp_destroy_tile_cache(t->cbuf_cache[i]);
+   sp_destroy_tile_cache(t->zsbuf_cache);
+
+   for (i = 0; i < PIPE_MAX_SHADER_SAMPLER_VIEWS; i++) {
+      if (t->tex_cache[i]) {
+         sp_tex_tile_cache_set_sampler_view(t->tex_cache[i], NULL);
+         sp_destroy_tex_tile_cache(t->tex_cache[i]);
+      }
+   }
+
+   if (t->fs_machine)
+      tgsi_exec_machine_destroy(t->fs_machine);
+   if (t->setup)
+      sp_setup_destroy_context(t->setup);
+   FREE(t->sampler);
+   FREE(t->softpipe);
+
+   util_queue_fence_destroy(&t->fence);
+}
+
+
+static boolean
+bin_thread_init(struct sp_bin_thread *t, struct softpipe_context *softpipe)
+{
+   unsigned i;
+
+   util_queue_fence_init(&t->fence);
+
+   t->softpipe = CALLOC_STRUCT(softpipe_context);
+   if (!t->softpipe)
+      return FALSE;
+
+   t->setup = sp_setup_create_context(t->softpipe);
+   t->fs_machine = tgsi_exec_machine_create(PIPE_SHADER_FRAGMENT);
+   t->sampler = sp_create_tgsi_sampler();
+
+   t->shade = sp_quad_shade_stage(t->softpipe);
+   t->depth_test = sp_quad_depth_test_stage(t->softpipe);
+   t->blend = sp_quad_blend_stage(t->softpipe);
+   t->pstipple = sp_quad_polygon_stipple_stage(t->softpipe);
+
+   for (i = 0; i < PIPE_MAX_COLOR_BUFS; i++) {
+      t->cbuf_cache[i] = sp_create_tile_cache(&softpipe->pipe);
+      if (!t->cbuf_cache[i])
+         return FALSE;
+   }
+   t->zsbuf_cache = sp_create_tile_cache(&softpipe->pipe);
+
+   return t->setup && t->fs_machine && t->sampler &&
+          t->shade && t->depth_test && t->blend && t->pstipple &&
+          t->zsbuf_cache;
+}
+
+
+/**
+ * Create the binner and the rasterizer threads for a context.
+ * The SOFTPIPE_NUM_THREADS environment variable overrides the number of
+ * threads, which defaults to the number of CPUs.
+ * \return NULL if rasterization is to stay on the context's thread
+ */
+struct sp_binner *
+sp_create_binner(struct softpipe_context *softpipe)
+{
+   struct sp_binner *binner;
+   unsigned num_threads, i;
+
+   util_cpu_detect();
+
+   num_threads = debug_get_num_option("SOFTPIPE_NUM_THREADS",
+                                      util_cpu_caps.nr_cpus);
+   num_threads = MIN2(num_threads, SP_MAX_THREADS);
+   if (num_threads <= 1)
+      return NULL;
+
+   binner = CALLOC_STRUCT(sp_binner);
+   if (!binner)
+      return NULL;
+
+   binner->softpipe = softpipe;
+   util_dynarray_init(&binner->verts, NULL);
+   util_dynarray_init(&binner->prims, NULL);
+
+   for (i = 0; i < num_threads; i++) {
+      binner->thread[i].binner = binner;
+      binner->thread[i].index = i;
+      binner->num_threads = i + 1;
+      if (!bin_thread_init(&binner->thread[i], softpipe))
+         goto fail;
+   }
+
+   /* The context's own thread renders the first thread's tiles. */
+   if (!util_queue_init(&binner->queue, "sprast", num_threads - 1,
+                        num_threads - 1, 0))
+      goto fail;
+
+   return binner;
+
+fail:
+   sp_destroy_binner(binner);
+   return NULL;
+}
+
+
+void
+sp_destroy_binner(struct sp_binner *binner)
+{
+   unsigned i;
+
+   if (!binner)
+      return;
+
+   if (util_queue_is_initialized(&binner->queue))
+      util_queue_destroy(&binner->queue);
+
+   for (i = 0; i < binner->num_threads; i++)
+      bin_thread_destroy(&binner->thread[i]);
+
+   for (i = 0; i < binner->num_bins; i++)
+      util_dynarray_fini(&binner->bins[i]);
+   FREE(binner->bins);
+
+   util_dynarray_fini(&binner->prims);
+   util_dynarray_fini(&binner->verts);
+   util_unreference_framebuffer_state(&binner->framebuffer);
+
+   for (i = 0; i < PIPE_MAX_CONSTANT_BUFFERS; i++)
+      FREE(binner->constants[i]);
+
+   FREE(binner);
+}
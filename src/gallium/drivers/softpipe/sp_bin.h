@@ -0,0 +1,83 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * Tile binning and threaded rasterization.
+ *
+ * The points, lines and triangles which come out of the draw module are
+ * recorded and sorted into bins, one per TILE_SIZE x TILE_SIZE tile of the
+ * framebuffer (the same tiles the sp_tile_cache uses).  When the rendering
+ * state changes, or the results are needed, the bins are handed to a pool
+ * of rasterizer threads.  Each tile belongs
+ * to exactly one thread, which runs the regular setup and quad pipeline
+ * with its own tile caches, so no locking is needed on the color and
+ * depth/stencil tiles.
+ */
+
+#ifndef SP_BIN_H
+#define SP_BIN_H
+
+#include "pipe/p_compiler.h"
+
+
+struct pipe_resource;
+struct softpipe_context;
+struct sp_binner;
+
+
+struct sp_binner *
+sp_create_binner(struct softpipe_context *softpipe);
+
+void
+sp_destroy_binner(struct sp_binner *binner);
+
+void
+sp_bin_end(struct softpipe_context *softpipe);
+
+void
+sp_bin_flush(struct softpipe_context *softpipe);
+
+unsigned
+sp_bin_is_resource_referenced(struct softpipe_context *softpipe,
+                              const struct pipe_resource *resource);
+
+boolean
+sp_bin_point(struct softpipe_context *softpipe,
+             const float (*v0)[4]);
+
+boolean
+sp_bin_line(struct softpipe_context *softpipe,
+            const float (*v0)[4],
+            const float (*v1)[4]);
+
+boolean
+sp_bin_tri(struct softpipe_context *softpipe,
+           const float (*v0)[4],
+           const float (*v1)[4],
+           const float (*v2)[4]);
+
+#endif /* SP_BIN_H */
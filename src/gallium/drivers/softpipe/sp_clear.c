@@ -36,6 +36,7 @@
 #include "util/u_pack_color.h"
 #include "util/u_surface.h"
 #include "sp_clear.h"
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_query.h"
 #include "sp_tile_cache.h"
@@ -62,6 +63,9 @@ softpipe_clear(struct pipe_context *pipe, unsigned buffers,
    if (!softpipe_check_render_cond(softpipe))
       return;
 
+   /* clear after what was drawn before */
+   sp_bin_flush(softpipe);
+
 #if 0
    softpipe_update_derived(softpipe, PIPE_PRIM_TRIANGLES); /* not needed?? */
 #endif
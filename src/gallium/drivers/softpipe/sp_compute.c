@@ -27,6 +27,7 @@
 #include "pipe/p_shader_tokens.h"
 #include "draw/draw_context.h"
 #include "draw/draw_vertex.h"
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_screen.h"
 #include "sp_state.h"
@@ -178,6 +179,9 @@ softpipe_launch_grid(struct pipe_context *context,
    uint32_t grid_size[3] = {0};
    void *local_mem = NULL;
 
+   /* the compute shader may read or write what the binned primitives use */
+   sp_bin_flush(softpipe);
+
    softpipe_update_compute_samplers(softpipe);
    bwidth = cs->info.properties[TGSI_PROPERTY_CS_FIXED_BLOCK_WIDTH];
    bheight = cs->info.properties[TGSI_PROPERTY_CS_FIXED_BLOCK_HEIGHT];
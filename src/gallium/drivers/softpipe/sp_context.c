@@ -38,7 +38,9 @@
 #include "util/u_pstipple.h"
 #include "util/u_inlines.h"
 #include "util/u_upload_mgr.h"
+#include "util/u_threaded_context.h"
 #include "tgsi/tgsi_exec.h"
+#include "sp_bin.h"
 #include "sp_buffer.h"
 #include "sp_clear.h"
 #include "sp_context.h"
@@ -60,6 +62,9 @@ softpipe_destroy( struct pipe_context *pipe )
    struct softpipe_context *softpipe = softpipe_context( pipe );
    uint i, sh;
 
+   /* render what is still binned while its state exists */
+   sp_bin_flush(softpipe);
+
 #if DO_PSTIPPLE_IN_HELPER_MODULE
    if (softpipe->pstipple.sampler)
       pipe->delete_sampler_state(pipe, softpipe->pstipple.sampler);
@@ -75,6 +80,8 @@ softpipe_destroy( struct pipe_context *pipe )
    if (softpipe->draw)
       draw_destroy( softpipe->draw );
 
+   sp_destroy_binner(softpipe->binner);
+
    if (softpipe->quad.shade)
       softpipe->quad.shade->destroy( softpipe->quad.shade );
 
@@ -136,6 +143,9 @@ softpipe_destroy( struct pipe_context *pipe )
  *    return SP_REFERENCED_FOR_READ
  * else
  *    return SP_UNREFERENCED
+ *
+ * Binned primitives use the state of their scene, which may refer to
+ * other surfaces and textures than the ones bound now.
  */
 unsigned int
 softpipe_is_resource_referenced( struct pipe_context *pipe,
@@ -143,10 +153,12 @@ softpipe_is_resource_referenced( struct pipe_context *pipe,
                                  unsigned level, int layer)
 {
    struct softpipe_context *softpipe = softpipe_context( pipe );
+   unsigned referenced = sp_bin_is_resource_referenced(softpipe, texture);
    unsigned i, sh;
 
-   if (texture->target == PIPE_BUFFER)
-      return SP_UNREFERENCED;
+   if (texture->target == PIPE_BUFFER ||
+       (referenced & SP_REFERENCED_FOR_WRITE))
+      return referenced;
 
    /* check if any of the bound drawing surfaces are this texture */
    if (softpipe->dirty_render_cache) {
@@ -171,7 +183,7 @@ softpipe_is_resource_referenced( struct pipe_context *pipe,
       }
    }
 
-   return SP_UNREFERENCED;
+   return referenced;
 }
 
 
@@ -271,6 +283,10 @@ softpipe_create_context(struct pipe_screen *screen,
    softpipe->quad.blend = sp_quad_blend_stage(softpipe);
    softpipe->quad.pstipple = sp_quad_polygon_stipple_stage(softpipe);
 
+   /* rasterizer threads, if there is more than one CPU */
+   softpipe->binner = sp_create_binner(softpipe);
+   softpipe->binning = softpipe->binner != NULL;
+
    softpipe->pipe.stream_uploader = u_upload_create_default(&softpipe->pipe);
    if (!softpipe->pipe.stream_uploader)
       goto fail;
@@ -356,7 +372,13 @@ softpipe_create_context(struct pipe_screen *screen,
    softpipe->pstipple.sampler = util_pstipple_create_sampler(&softpipe->pipe);
 #endif
 
-   return &softpipe->pipe;
+   /* Queue the state changes and draws to a driver thread, unless disabled
+    * with GALLIUM_THREAD=0.
+    */
+   return threaded_context_create(&softpipe->pipe,
+                                  &softpipe_screen(screen)->pool_transfers,
+                                  softpipe_replace_buffer_storage,
+                                  NULL, NULL);
 
  fail:
    softpipe_destroy(&softpipe->pipe);
@@ -48,6 +48,7 @@
 
 
 struct softpipe_vbuf_render;
+struct sp_binner;
 struct draw_context;
 struct draw_stage;
 struct softpipe_tile_cache;
@@ -194,6 +195,11 @@ struct softpipe_context {
    struct softpipe_tile_cache *cbuf_cache[PIPE_MAX_COLOR_BUFS];
    struct softpipe_tile_cache *zsbuf_cache;
 
+   /** Tile binning and rasterizer threads, NULL if single-threaded */
+   struct sp_binner *binner;
+   /** Whether primitives are being binned rather than rasterized */
+   boolean binning;
+
    unsigned tex_timestamp;
 
    /*
@@ -37,6 +37,7 @@
 #include "util/u_draw.h"
 #include "util/u_prim.h"
 
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_query.h"
 #include "sp_state.h"
@@ -165,6 +166,9 @@ softpipe_draw_vbo(struct pipe_context *pipe,
     */
    draw_flush(draw);
 
+   /* the binned primitives are normally rasterized later */
+   sp_bin_end(sp);
+
    /* Note: leave drawing surfaces mapped */
    sp->dirty_render_cache = TRUE;
 }
@@ -33,6 +33,7 @@
 #include "pipe/p_defines.h"
 #include "pipe/p_screen.h"
 #include "draw/draw_context.h"
+#include "sp_bin.h"
 #include "sp_flush.h"
 #include "sp_context.h"
 #include "sp_state.h"
@@ -52,6 +53,7 @@ softpipe_flush( struct pipe_context *pipe,
    uint i;
 
    draw_flush(softpipe->draw);
+   sp_bin_flush(softpipe);
 
    if (flags & SP_FLUSH_TEXTURE_CACHE) {
       unsigned sh;
@@ -174,6 +176,8 @@ void softpipe_texture_barrier(struct pipe_context *pipe, unsigned flags)
    struct softpipe_context *softpipe = softpipe_context(pipe);
    uint i, sh;
 
+   sp_bin_flush(softpipe);
+
    for (sh = 0; sh < ARRAY_SIZE(softpipe->tex_cache); sh++) {
       for (i = 0; i < softpipe->num_sampler_views[sh]; i++) {
          sp_flush_tex_tile_cache(softpipe->tex_cache[sh][i]);
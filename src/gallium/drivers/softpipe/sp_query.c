@@ -33,11 +33,14 @@
 #include "util/os_time.h"
 #include "pipe/p_defines.h"
 #include "util/u_memory.h"
+#include "util/u_threaded_context.h"
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_query.h"
 #include "sp_state.h"
 
 struct softpipe_query {
+   struct threaded_query base;
    unsigned type;
    uint64_t start;
    uint64_t end;
@@ -91,6 +94,9 @@ softpipe_begin_query(struct pipe_context *pipe, struct pipe_query *q)
    struct softpipe_context *softpipe = softpipe_context( pipe );
    struct softpipe_query *sq = softpipe_query(q);
 
+   /* count the binned primitives on the right side of the query */
+   sp_bin_flush(softpipe);
+
    switch (sq->type) {
    case PIPE_QUERY_OCCLUSION_COUNTER:
    case PIPE_QUERY_OCCLUSION_PREDICATE:
@@ -145,6 +151,8 @@ softpipe_end_query(struct pipe_context *pipe, struct pipe_query *q)
    struct softpipe_context *softpipe = softpipe_context( pipe );
    struct softpipe_query *sq = softpipe_query(q);
 
+   sp_bin_flush(softpipe);
+
    softpipe->active_query_count--;
    switch (sq->type) {
    case PIPE_QUERY_OCCLUSION_COUNTER:
@@ -428,12 +428,6 @@ softpipe_is_format_supported( struct pipe_screen *screen,
          return FALSE;
    }
 
-   if (format_desc->layout == UTIL_FORMAT_LAYOUT_BPTC ||
-       format_desc->layout == UTIL_FORMAT_LAYOUT_ASTC) {
-      /* Software decoding is not hooked up. */
-      return FALSE;
-   }
-
    if ((bind & (PIPE_BIND_RENDER_TARGET | PIPE_BIND_SAMPLER_VIEW)) &&
        ((bind & PIPE_BIND_DISPLAY_TARGET) == 0) &&
        target != PIPE_BUFFER) {
@@ -452,10 +446,6 @@ softpipe_is_format_supported( struct pipe_screen *screen,
       }
    }
 
-   if (format_desc->layout == UTIL_FORMAT_LAYOUT_ETC &&
-       format != PIPE_FORMAT_ETC1_RGB8)
-      return FALSE;
-
    /*
     * All other operations (sampling, transfer, etc).
     */
@@ -476,6 +466,8 @@ softpipe_destroy_screen( struct pipe_screen *screen )
    if(winsys->destroy)
       winsys->destroy(winsys);
 
+   slab_destroy_parent(&sp_screen->pool_transfers);
+
    FREE(screen);
 }
 
@@ -589,5 +581,8 @@ softpipe_create_screen(struct sw_winsys *winsys)
    softpipe_init_screen_texture_funcs(&screen->base);
    softpipe_init_screen_fence_funcs(&screen->base);
 
+   slab_create_parent(&screen->pool_transfers,
+                      sizeof(struct softpipe_transfer), 64);
+
    return &screen->base;
 }
@@ -33,6 +33,7 @@
 
 #include "pipe/p_screen.h"
 #include "pipe/p_defines.h"
+#include "util/slab.h"
 
 
 struct sw_winsys;
@@ -47,6 +48,9 @@ struct softpipe_screen {
     */
    unsigned timestamp;
    boolean use_llvm;
+
+   /* Parent pool for the threaded contexts' transfers. */
+   struct slab_parent_pool pool_transfers;
 };
 
 static inline struct softpipe_screen *
@@ -32,6 +32,7 @@
  * \author  Brian Paul
  */
 
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_quad.h"
 #include "sp_quad_pipe.h"
@@ -821,6 +822,11 @@ sp_setup_tri(struct setup_context *setup,
 
    if (setup->softpipe->no_rast || setup->softpipe->rasterizer->rasterizer_discard)
       return;
+
+   /* leave it to the rasterizer threads */
+   if (setup->softpipe->binning &&
+       sp_bin_tri(setup->softpipe, v0, v1, v2))
+      return;
    
    det = calc_det(v0, v1, v2);
    /*
@@ -1110,6 +1116,10 @@ sp_setup_line(struct setup_context *setup,
    if (dx == 0 && dy == 0)
       return;
 
+   if (setup->softpipe->binning &&
+       sp_bin_line(setup->softpipe, v0, v1))
+      return;
+
    if (!setup_line_coefficients(setup, v0, v1))
       return;
 
@@ -1254,6 +1264,10 @@ sp_setup_point(struct setup_context *setup,
    if (setup->softpipe->no_rast || setup->softpipe->rasterizer->rasterizer_discard)
       return;
 
+   if (setup->softpipe->binning &&
+       sp_bin_point(setup->softpipe, v0))
+      return;
+
    assert(setup->softpipe->reduced_prim == PIPE_PRIM_POINTS);
 
    if (setup->softpipe->layer_slot > 0) {
@@ -31,6 +31,7 @@
 #include "util/u_math.h"
 #include "util/u_memory.h"
 #include "draw/draw_context.h"
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_state.h"
 
@@ -61,6 +62,9 @@ static void
 softpipe_delete_blend_state(struct pipe_context *pipe,
                             void *blend)
 {
+   /* the binned primitives may still use it */
+   sp_bin_flush(softpipe_context(pipe));
+
    FREE( blend );
 }
 
@@ -108,6 +112,9 @@ softpipe_bind_depth_stencil_state(struct pipe_context *pipe,
 static void
 softpipe_delete_depth_stencil_state(struct pipe_context *pipe, void *depth)
 {
+   /* the binned primitives may still use it */
+   sp_bin_flush(softpipe_context(pipe));
+
    FREE( depth );
 }
 
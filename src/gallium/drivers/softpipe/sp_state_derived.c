@@ -32,6 +32,7 @@
 #include "pipe/p_shader_tokens.h"
 #include "draw/draw_context.h"
 #include "draw/draw_vertex.h"
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_screen.h"
 #include "sp_state.h"
@@ -442,6 +443,19 @@ softpipe_update_derived(struct softpipe_context *softpipe, unsigned prim)
       softpipe->dirty |= SP_NEW_TEXTURE;
    }
 
+   /* The binned primitives have to be rendered with the old state.  The
+    * vertex, viewport, clip and stream output state is only used by the
+    * draw module, which is done with them, and new fragment shader
+    * constants render them when they are bound.
+    */
+   if (softpipe->dirty & ~(SP_NEW_VIEWPORT |
+                           SP_NEW_CLIP |
+                           SP_NEW_CONSTANTS |
+                           SP_NEW_VERTEX |
+                           SP_NEW_SO |
+                           SP_NEW_SO_BUFFERS))
+      sp_bin_flush(softpipe);
+
 #if DO_PSTIPPLE_IN_HELPER_MODULE
    if (softpipe->dirty & SP_NEW_STIPPLE)
       /* before updating samplers! */
@@ -27,6 +27,7 @@
 
 #include "pipe/p_defines.h"
 #include "util/u_memory.h"
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_state.h"
 #include "draw/draw_context.h"
@@ -63,6 +64,9 @@ static void
 softpipe_delete_rasterizer_state(struct pipe_context *pipe,
                                  void *rasterizer)
 {
+   /* the binned primitives may still use it */
+   sp_bin_flush(softpipe_context(pipe));
+
    FREE( rasterizer );
 }
 
@@ -35,6 +35,7 @@
 
 #include "draw/draw_context.h"
 
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_state.h"
 #include "sp_texture.h"
@@ -90,6 +91,9 @@ static void
 softpipe_sampler_view_destroy(struct pipe_context *pipe,
                               struct pipe_sampler_view *view)
 {
+   /* the binned primitives may still sample from it */
+   sp_bin_flush(softpipe_context(pipe));
+
    pipe_resource_reference(&view->texture, NULL);
    FREE(view);
 }
@@ -158,6 +162,9 @@ static void
 softpipe_delete_sampler_state(struct pipe_context *pipe,
                               void *sampler)
 {
+   /* the binned primitives may still use it */
+   sp_bin_flush(softpipe_context(pipe));
+
    FREE( sampler );
 }
 
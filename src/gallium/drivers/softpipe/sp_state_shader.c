@@ -25,6 +25,7 @@
  * 
  **************************************************************************/
 
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_state.h"
 #include "sp_fs.h"
@@ -179,6 +180,9 @@ softpipe_delete_fs_state(struct pipe_context *pipe, void *fs)
 
    assert(fs != softpipe->fs);
 
+   /* the binned primitives may still use one of the variants */
+   sp_bin_flush(softpipe);
+
    /* delete variants */
    for (var = state->variants; var; var = next_var) {
       next_var = var->next;
@@ -361,6 +365,10 @@ softpipe_set_constant_buffer(struct pipe_context *pipe,
 
    draw_flush(softpipe->draw);
 
+   /* the binned primitives use the old fragment shader constants */
+   if (shader == PIPE_SHADER_FRAGMENT)
+      sp_bin_flush(softpipe);
+
    /* note: reference counting */
    pipe_resource_reference(&softpipe->constants[shader][index], constants);
 
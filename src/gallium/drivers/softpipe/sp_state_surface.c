@@ -28,6 +28,7 @@
 /* Authors:  Keith Whitwell <keithw@vmware.com>
  */
 
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_state.h"
 #include "sp_tile_cache.h"
@@ -52,6 +53,7 @@ softpipe_set_framebuffer_state(struct pipe_context *pipe,
    uint i;
 
    draw_flush(sp->draw);
+   sp_bin_flush(sp);
 
    for (i = 0; i < PIPE_MAX_COLOR_BUFS; i++) {
       struct pipe_surface *cb = i < fb->nr_cbufs ? fb->cbufs[i] : NULL;
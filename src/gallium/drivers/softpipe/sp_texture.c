@@ -39,8 +39,13 @@
 #include "util/u_transfer.h"
 #include "util/u_surface.h"
 
+#include "draw/draw_context.h"
+
+#include "sp_bin.h"
 #include "sp_context.h"
 #include "sp_flush.h"
+#include "sp_state.h"
+#include "sp_tex_tile_cache.h"
 #include "sp_texture.h"
 #include "sp_screen.h"
 
@@ -56,7 +61,7 @@ softpipe_resource_layout(struct pipe_screen *screen,
                          struct softpipe_resource *spr,
                          boolean allocate)
 {
-   struct pipe_resource *pt = &spr->base;
+   struct pipe_resource *pt = &spr->base.b;
    unsigned level;
    unsigned width = pt->width0;
    unsigned height = pt->height0;
@@ -118,7 +123,7 @@ softpipe_can_create_resource(struct pipe_screen *screen,
 {
    struct softpipe_resource spr;
    memset(&spr, 0, sizeof(spr));
-   spr.base = *res;
+   spr.base.b = *res;
    return softpipe_resource_layout(screen, &spr, FALSE);
 }
 
@@ -136,10 +141,10 @@ softpipe_displaytarget_layout(struct pipe_screen *screen,
    /* Round up the surface size to a multiple of the tile size?
     */
    spr->dt = winsys->displaytarget_create(winsys,
-                                          spr->base.bind,
-                                          spr->base.format,
-                                          spr->base.width0, 
-                                          spr->base.height0,
+                                          spr->base.b.bind,
+                                          spr->base.b.format,
+                                          spr->base.b.width0, 
+                                          spr->base.b.height0,
                                           64,
                                           map_front_private,
                                           &spr->stride[0] );
@@ -162,15 +167,15 @@ softpipe_resource_create_front(struct pipe_screen *screen,
 
    assert(templat->format != PIPE_FORMAT_NONE);
 
-   spr->base = *templat;
-   pipe_reference_init(&spr->base.reference, 1);
-   spr->base.screen = screen;
+   spr->base.b = *templat;
+   pipe_reference_init(&spr->base.b.reference, 1);
+   spr->base.b.screen = screen;
 
    spr->pot = (util_is_power_of_two(templat->width0) &&
                util_is_power_of_two(templat->height0) &&
                util_is_power_of_two(templat->depth0));
 
-   if (spr->base.bind & (PIPE_BIND_DISPLAY_TARGET |
+   if (spr->base.b.bind & (PIPE_BIND_DISPLAY_TARGET |
 			 PIPE_BIND_SCANOUT |
 			 PIPE_BIND_SHARED)) {
       if (!softpipe_displaytarget_layout(screen, spr, map_front_private))
@@ -180,8 +185,10 @@ softpipe_resource_create_front(struct pipe_screen *screen,
       if (!softpipe_resource_layout(screen, spr, TRUE))
          goto fail;
    }
-    
-   return &spr->base;
+
+   threaded_resource_init(&spr->base.b);
+
+   return &spr->base.b;
 
  fail:
    FREE(spr);
@@ -212,6 +219,7 @@ softpipe_resource_destroy(struct pipe_screen *pscreen,
       align_free(spr->data);
    }
 
+   threaded_resource_deinit(pt);
    FREE(spr);
 }
 
@@ -227,9 +235,9 @@ softpipe_resource_from_handle(struct pipe_screen *screen,
    if (!spr)
       return NULL;
 
-   spr->base = *templat;
-   pipe_reference_init(&spr->base.reference, 1);
-   spr->base.screen = screen;
+   spr->base.b = *templat;
+   pipe_reference_init(&spr->base.b.reference, 1);
+   spr->base.b.screen = screen;
 
    spr->pot = (util_is_power_of_two(templat->width0) &&
                util_is_power_of_two(templat->height0) &&
@@ -242,7 +250,10 @@ softpipe_resource_from_handle(struct pipe_screen *screen,
    if (!spr->dt)
       goto fail;
 
-   return &spr->base;
+   threaded_resource_init(&spr->base.b);
+   spr->base.is_shared = true;
+
+   return &spr->base.b;
 
  fail:
    FREE(spr);
@@ -415,7 +426,7 @@ softpipe_transfer_map(struct pipe_context *pipe,
    if (!spt)
       return NULL;
 
-   pt = &spt->base;
+   pt = &spt->base.b;
 
    pipe_resource_reference(&pt->resource, resource);
    pt->level = level;
@@ -427,7 +438,7 @@ softpipe_transfer_map(struct pipe_context *pipe,
    spt->offset = softpipe_get_tex_image_offset(spr, level, box->z);
 
    spt->offset +=
-         box->y / util_format_get_blockheight(format) * spt->base.stride +
+         box->y / util_format_get_blockheight(format) * spt->base.b.stride +
          box->x / util_format_get_blockwidth(format) * util_format_get_blocksize(format);
 
    /* resources backed by display target treated specially:
@@ -477,6 +488,70 @@ softpipe_transfer_unmap(struct pipe_context *pipe,
    FREE(transfer);
 }
 
+/**
+ * Threaded context buffer invalidation: move the storage of the freshly
+ * allocated src buffer into dst, and re-point the state which caches
+ * pointers into dst's old storage.
+ */
+void
+softpipe_replace_buffer_storage(struct pipe_context *pipe,
+                                struct pipe_resource *dst,
+                                struct pipe_resource *src)
+{
+   struct softpipe_context *softpipe = softpipe_context(pipe);
+   struct softpipe_resource *sp_dst = softpipe_resource(dst);
+   struct softpipe_resource *sp_src = softpipe_resource(src);
+   const ubyte *old_data = sp_dst->data;
+   unsigned sh, i;
+
+   assert(dst->target == PIPE_BUFFER && src->target == PIPE_BUFFER);
+   assert(!sp_dst->userBuffer && !sp_src->userBuffer);
+
+   /* Only queued vertices and binned primitives may still reference the
+    * old storage.
+    */
+   draw_flush(softpipe->draw);
+   if (sp_bin_is_resource_referenced(softpipe, dst))
+      sp_bin_flush(softpipe);
+
+   for (sh = 0; sh < PIPE_SHADER_TYPES; sh++) {
+      for (i = 0; i < PIPE_MAX_CONSTANT_BUFFERS; i++) {
+         const ubyte *mapped = softpipe->mapped_constants[sh][i];
+
+         if (softpipe->constants[sh][i] != dst)
+            continue;
+
+         mapped = (const ubyte *) sp_src->data + (mapped - old_data);
+         softpipe->mapped_constants[sh][i] = mapped;
+         if (sh == PIPE_SHADER_VERTEX || sh == PIPE_SHADER_GEOMETRY)
+            draw_set_mapped_constant_buffer(softpipe->draw, sh, i, mapped,
+                                            softpipe->const_buffer_size[sh][i]);
+         softpipe->dirty |= SP_NEW_CONSTANTS;
+      }
+
+      /* Texture buffers keep their mapping in the tile cache. */
+      for (i = 0; i < PIPE_MAX_SHADER_SAMPLER_VIEWS; i++) {
+         struct softpipe_tex_tile_cache *tc = softpipe->tex_cache[sh][i];
+
+         if (tc && tc->texture == dst && tc->tex_trans_map) {
+            pipe->transfer_unmap(pipe, tc->tex_trans);
+            tc->tex_trans = NULL;
+            tc->tex_trans_map = NULL;
+         }
+      }
+   }
+
+   align_free(sp_dst->data);
+   sp_dst->data = sp_src->data;
+   /* Expire the tile caches. */
+   sp_dst->timestamp++;
+
+   /* src is about to be destroyed; it no longer owns the storage. */
+   sp_src->data = NULL;
+   sp_src->userBuffer = TRUE;
+}
+
+
 /**
  * Create buffer which wraps user-space data.
  */
@@ -492,20 +567,23 @@ softpipe_user_buffer_create(struct pipe_screen *screen,
    if (!spr)
       return NULL;
 
-   pipe_reference_init(&spr->base.reference, 1);
-   spr->base.screen = screen;
-   spr->base.format = PIPE_FORMAT_R8_UNORM; /* ?? */
-   spr->base.bind = bind_flags;
-   spr->base.usage = PIPE_USAGE_IMMUTABLE;
-   spr->base.flags = 0;
-   spr->base.width0 = bytes;
-   spr->base.height0 = 1;
-   spr->base.depth0 = 1;
-   spr->base.array_size = 1;
+   pipe_reference_init(&spr->base.b.reference, 1);
+   spr->base.b.screen = screen;
+   spr->base.b.format = PIPE_FORMAT_R8_UNORM; /* ?? */
+   spr->base.b.bind = bind_flags;
+   spr->base.b.usage = PIPE_USAGE_IMMUTABLE;
+   spr->base.b.flags = 0;
+   spr->base.b.width0 = bytes;
+   spr->base.b.height0 = 1;
+   spr->base.b.depth0 = 1;
+   spr->base.b.array_size = 1;
    spr->userBuffer = TRUE;
    spr->data = ptr;
 
-   return &spr->base;
+   threaded_resource_init(&spr->base.b);
+   spr->base.is_user_ptr = true;
+
+   return &spr->base.b;
 }
 
 
@@ -49,6 +49,7 @@ struct pipe_debug_callback;
 struct pipe_depth_stencil_alpha_state;
 struct pipe_device_reset_callback;
 struct pipe_draw_info;
+struct pipe_draw_start_count;
 struct pipe_grid_info;
 struct pipe_fence_handle;
 struct pipe_framebuffer_state;
@@ -108,6 +109,21 @@ struct pipe_context {
    /*@{*/
    void (*draw_vbo)( struct pipe_context *pipe,
                      const struct pipe_draw_info *info );
+
+   /**
+    * Draw several ranges that share everything else in \p info.
+    *
+    * Draw i uses the start, count and index_bias of draws[i], and has
+    * drawid info->drawid + i; those fields of \p info are ignored.
+    * info->indirect and info->count_from_stream_output must be NULL, and
+    * for indexed draws, min_index and max_index must cover all the draws.
+    *
+    * Optional: if NULL, callers use one draw_vbo call per draw.
+    */
+   void (*multi_draw)( struct pipe_context *pipe,
+                       const struct pipe_draw_info *info,
+                       const struct pipe_draw_start_count *draws,
+                       unsigned num_draws );
    /*@}*/
 
    /**
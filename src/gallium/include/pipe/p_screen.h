@@ -345,6 +345,17 @@ struct pipe_screen {
                                       enum pipe_shader_ir ir,
                                       enum pipe_shader_type shader);
 
+   /**
+    * Check whether the driver can compile a NIR shader (a 'struct
+    * nir_shader') it would otherwise receive.  If not, the state tracker
+    * passes the program as TGSI instead.  The shader is not modified.
+    *
+    * Optional; NULL means all NIR shaders are supported.
+    */
+   boolean (*is_nir_shader_supported)(struct pipe_screen *screen,
+                                      enum pipe_shader_type shader,
+                                      const void *nir);
+
    /**
     * Returns a pointer to a driver-specific on-disk shader cache. If the
     * driver failed to create the cache or does not support an on-disk shader
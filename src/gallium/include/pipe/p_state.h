@@ -746,6 +746,17 @@ struct pipe_draw_info
 };
 
 
+/**
+ * One draw of a pipe_context::multi_draw call.
+ */
+struct pipe_draw_start_count
+{
+   unsigned start;
+   unsigned count;
+   int index_bias; /**< only used by indexed draws */
+};
+
+
 /**
  * Information to describe a blit call.
  */
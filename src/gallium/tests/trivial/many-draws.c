@@ -0,0 +1,393 @@
+/**************************************************************************
+ *
+ * Copyright © 2018 VMware, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/*
+ * Frame time benchmark for draw-call heavy workloads.
+ *
+ * Every frame clears the render target and issues many small draws, then
+ * flushes.  Like a swapchain, the app only waits for the frame before the
+ * previous one, so drivers which can bin a new frame while the old one is
+ * still being rasterized (llvmpipe with multiple scenes) show lower frame
+ * times than ones which serialize the two.
+ *
+ * The same workload is run once per configuration, each time with a
+ * freshly created screen and context so driver env vars such as
+ * LP_NUM_SCENES or LP_NUM_THREADS are re-read.  By default one and
+ * multiple scenes are compared; with -t the number of rasterizer threads
+ * is scaled from 1 up to the number of CPUs instead.  With -c the driver
+ * context is used directly and then wrapped in a threaded context
+ * (GALLIUM_THREAD), which moves the state and draw call overhead of the
+ * driver to a separate thread.
+ *
+ * usage: many-draws [-t|-c] [frames] [draws per frame] [triangles per draw]
+ */
+
+#define WIDTH 1024
+#define HEIGHT 1024
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pipe/p_state.h"
+#include "pipe/p_context.h"
+#include "pipe/p_screen.h"
+#include "pipe/p_defines.h"
+#include "pipe/p_shader_tokens.h"
+#include "util/u_inlines.h"
+#include "cso_cache/cso_context.h"
+#include "util/u_draw_quad.h"
+#include "util/u_memory.h"
+#include "util/u_simple_shaders.h"
+#include "util/u_string.h"
+#include "util/u_cpu_detect.h"
+#include "util/os_time.h"
+#include "pipe-loader/pipe_loader.h"
+
+#define MAX_CONFIGS 32
+
+struct config
+{
+	char name[64];
+	char env[64];   /* NAME=value pair to put in the environment */
+};
+
+static unsigned scene_configs(struct config *configs)
+{
+	util_snprintf(configs[0].name, sizeof(configs[0].name), "serialized (1 scene)");
+	util_snprintf(configs[0].env, sizeof(configs[0].env), "LP_NUM_SCENES=1");
+	util_snprintf(configs[1].name, sizeof(configs[1].name), "pipelined (4 scenes)");
+	util_snprintf(configs[1].env, sizeof(configs[1].env), "LP_NUM_SCENES=4");
+	return 2;
+}
+
+static unsigned thread_configs(struct config *configs)
+{
+	unsigned n = 0, threads;
+
+	util_cpu_detect();
+
+	for (threads = 1; n < MAX_CONFIGS; threads *= 2) {
+		threads = MIN2(threads, util_cpu_caps.nr_cpus);
+		util_snprintf(configs[n].name, sizeof(configs[n].name),
+			      "%u threads", threads);
+		util_snprintf(configs[n].env, sizeof(configs[n].env),
+			      "LP_NUM_THREADS=%u", threads);
+		n++;
+		if (threads == util_cpu_caps.nr_cpus)
+			break;
+	}
+
+	return n;
+}
+
+static unsigned threaded_context_configs(struct config *configs)
+{
+	util_snprintf(configs[0].name, sizeof(configs[0].name), "direct context");
+	util_snprintf(configs[0].env, sizeof(configs[0].env), "GALLIUM_THREAD=0");
+	util_snprintf(configs[1].name, sizeof(configs[1].name), "threaded context");
+	util_snprintf(configs[1].env, sizeof(configs[1].env), "GALLIUM_THREAD=1");
+	return 2;
+}
+
+struct program
+{
+	struct pipe_loader_device *dev;
+	struct pipe_screen *screen;
+	struct pipe_context *pipe;
+	struct cso_context *cso;
+
+	struct pipe_blend_state blend;
+	struct pipe_depth_stencil_alpha_state depthstencil;
+	struct pipe_rasterizer_state rasterizer;
+	struct pipe_viewport_state viewport;
+	struct pipe_framebuffer_state framebuffer;
+	struct pipe_vertex_element velem[2];
+
+	void *vs;
+	void *fs;
+
+	union pipe_color_union clear_color;
+
+	struct pipe_resource *vbuf;
+	struct pipe_resource *target;
+
+	unsigned num_draws;
+	unsigned tris_per_draw;
+};
+
+static float frand(void)
+{
+	return (float)rand() / (float)RAND_MAX;
+}
+
+static void init_prog(struct program *p)
+{
+	struct pipe_surface surf_tmpl;
+	unsigned num_verts = p->num_draws * p->tris_per_draw * 3;
+	float (*vertices)[2][4];
+	unsigned i;
+	int ret;
+
+	ret = pipe_loader_probe(&p->dev, 1);
+	assert(ret);
+
+	p->screen = pipe_loader_create_screen(p->dev);
+	assert(p->screen);
+
+	p->pipe = p->screen->context_create(p->screen, NULL, 0);
+	p->cso = cso_create_context(p->pipe, 0);
+
+	p->clear_color.f[0] = 0.3;
+	p->clear_color.f[1] = 0.1;
+	p->clear_color.f[2] = 0.3;
+	p->clear_color.f[3] = 1.0;
+
+	/* small random triangles all over the framebuffer */
+	vertices = MALLOC(num_verts * sizeof(*vertices));
+	srand(0);
+	for (i = 0; i < num_verts; i += 3) {
+		float x = frand() * 1.8f - 0.9f;
+		float y = frand() * 1.8f - 0.9f;
+		unsigned j;
+
+		for (j = 0; j < 3; j++) {
+			vertices[i + j][0][0] = x + (frand() - 0.5f) * 0.2f;
+			vertices[i + j][0][1] = y + (frand() - 0.5f) * 0.2f;
+			vertices[i + j][0][2] = 0.0f;
+			vertices[i + j][0][3] = 1.0f;
+			vertices[i + j][1][0] = frand();
+			vertices[i + j][1][1] = frand();
+			vertices[i + j][1][2] = frand();
+			vertices[i + j][1][3] = 1.0f;
+		}
+	}
+
+	p->vbuf = pipe_buffer_create(p->screen, PIPE_BIND_VERTEX_BUFFER,
+				     PIPE_USAGE_DEFAULT,
+				     num_verts * sizeof(*vertices));
+	pipe_buffer_write(p->pipe, p->vbuf, 0, num_verts * sizeof(*vertices),
+			  vertices);
+	FREE(vertices);
+
+	{
+		struct pipe_resource tmplt;
+		memset(&tmplt, 0, sizeof(tmplt));
+		tmplt.target = PIPE_TEXTURE_2D;
+		tmplt.format = PIPE_FORMAT_B8G8R8A8_UNORM;
+		tmplt.width0 = WIDTH;
+		tmplt.height0 = HEIGHT;
+		tmplt.depth0 = 1;
+		tmplt.array_size = 1;
+		tmplt.last_level = 0;
+		tmplt.bind = PIPE_BIND_RENDER_TARGET;
+
+		p->target = p->screen->resource_create(p->screen, &tmplt);
+	}
+
+	memset(&p->blend, 0, sizeof(p->blend));
+	p->blend.rt[0].colormask = PIPE_MASK_RGBA;
+
+	memset(&p->depthstencil, 0, sizeof(p->depthstencil));
+
+	memset(&p->rasterizer, 0, sizeof(p->rasterizer));
+	p->rasterizer.cull_face = PIPE_FACE_NONE;
+	p->rasterizer.half_pixel_center = 1;
+	p->rasterizer.bottom_edge_rule = 1;
+	p->rasterizer.depth_clip = 1;
+
+	surf_tmpl.format = PIPE_FORMAT_B8G8R8A8_UNORM;
+	surf_tmpl.u.tex.level = 0;
+	surf_tmpl.u.tex.first_layer = 0;
+	surf_tmpl.u.tex.last_layer = 0;
+	memset(&p->framebuffer, 0, sizeof(p->framebuffer));
+	p->framebuffer.width = WIDTH;
+	p->framebuffer.height = HEIGHT;
+	p->framebuffer.nr_cbufs = 1;
+	p->framebuffer.cbufs[0] = p->pipe->create_surface(p->pipe, p->target, &surf_tmpl);
+
+	p->viewport.scale[0] = WIDTH / 2.0f;
+	p->viewport.scale[1] = HEIGHT / 2.0f;
+	p->viewport.scale[2] = 1.0f;
+	p->viewport.translate[0] = WIDTH / 2.0f;
+	p->viewport.translate[1] = HEIGHT / 2.0f;
+	p->viewport.translate[2] = 0.0f;
+
+	memset(p->velem, 0, sizeof(p->velem));
+	p->velem[0].src_offset = 0 * 4 * sizeof(float);
+	p->velem[0].vertex_buffer_index = 0;
+	p->velem[0].src_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+
+	p->velem[1].src_offset = 1 * 4 * sizeof(float);
+	p->velem[1].vertex_buffer_index = 0;
+	p->velem[1].src_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+
+	{
+		const uint semantic_names[] = { TGSI_SEMANTIC_POSITION,
+						TGSI_SEMANTIC_COLOR };
+		const uint semantic_indexes[] = { 0, 0 };
+		p->vs = util_make_vertex_passthrough_shader(p->pipe, 2, semantic_names, semantic_indexes, FALSE);
+	}
+
+	p->fs = util_make_fragment_passthrough_shader(p->pipe,
+			TGSI_SEMANTIC_COLOR, TGSI_INTERPOLATE_PERSPECTIVE, TRUE);
+}
+
+static void close_prog(struct program *p)
+{
+	cso_destroy_context(p->cso);
+
+	p->pipe->delete_vs_state(p->pipe, p->vs);
+	p->pipe->delete_fs_state(p->pipe, p->fs);
+
+	pipe_surface_reference(&p->framebuffer.cbufs[0], NULL);
+	pipe_resource_reference(&p->target, NULL);
+	pipe_resource_reference(&p->vbuf, NULL);
+
+	p->pipe->destroy(p->pipe);
+	p->screen->destroy(p->screen);
+	pipe_loader_release(&p->dev, 1);
+}
+
+static void draw_frame(struct program *p)
+{
+	unsigned verts_per_draw = p->tris_per_draw * 3;
+	unsigned i;
+
+	cso_set_framebuffer(p->cso, &p->framebuffer);
+
+	p->pipe->clear(p->pipe, PIPE_CLEAR_COLOR, &p->clear_color, 0, 0);
+
+	cso_set_blend(p->cso, &p->blend);
+	cso_set_depth_stencil_alpha(p->cso, &p->depthstencil);
+	cso_set_rasterizer(p->cso, &p->rasterizer);
+	cso_set_viewport(p->cso, &p->viewport);
+
+	cso_set_fragment_shader_handle(p->cso, p->fs);
+	cso_set_vertex_shader_handle(p->cso, p->vs);
+
+	cso_set_vertex_elements(p->cso, 2, p->velem);
+
+	for (i = 0; i < p->num_draws; i++) {
+		util_draw_vertex_buffer(p->pipe, p->cso,
+					p->vbuf, 0,
+					i * verts_per_draw * 2 * 4 * sizeof(float),
+					PIPE_PRIM_TRIANGLES,
+					verts_per_draw,
+					2); /* attribs/vert */
+	}
+}
+
+static double run(struct program *p, unsigned num_frames)
+{
+	struct pipe_fence_handle *fences[2] = { NULL, NULL };
+	int64_t start, end;
+	unsigned i;
+
+	/* warm up, so shader compilation isn't timed */
+	draw_frame(p);
+	p->pipe->flush(p->pipe, &fences[0], 0);
+	p->screen->fence_finish(p->screen, NULL, fences[0], PIPE_TIMEOUT_INFINITE);
+	p->screen->fence_reference(p->screen, &fences[0], NULL);
+
+	start = os_time_get_nano();
+
+	for (i = 0; i < num_frames; i++) {
+		struct pipe_fence_handle **fence = &fences[i % 2];
+
+		/* wait for the frame before the previous one */
+		if (*fence) {
+			p->screen->fence_finish(p->screen, NULL, *fence,
+						PIPE_TIMEOUT_INFINITE);
+			p->screen->fence_reference(p->screen, fence, NULL);
+		}
+
+		draw_frame(p);
+		p->pipe->flush(p->pipe, fence, 0);
+	}
+
+	for (i = 0; i < 2; i++) {
+		if (fences[i]) {
+			p->screen->fence_finish(p->screen, NULL, fences[i],
+						PIPE_TIMEOUT_INFINITE);
+			p->screen->fence_reference(p->screen, &fences[i], NULL);
+		}
+	}
+
+	end = os_time_get_nano();
+
+	return (end - start) / 1000000.0 / num_frames;
+}
+
+int main(int argc, char** argv)
+{
+	static struct config configs[MAX_CONFIGS];
+	boolean scale_threads = argc > 1 && !strcmp(argv[1], "-t");
+	boolean threaded_context = argc > 1 && !strcmp(argv[1], "-c");
+	unsigned num_frames, num_draws, tris_per_draw, num_configs;
+	double baseline = 0.0;
+	unsigned i;
+
+	if (scale_threads || threaded_context) {
+		argc--;
+		argv++;
+	}
+
+	num_frames = argc > 1 ? atoi(argv[1]) : 100;
+	num_draws = argc > 2 ? atoi(argv[2]) : 2000;
+	tris_per_draw = argc > 3 ? atoi(argv[3]) : 16;
+
+	if (scale_threads)
+		num_configs = thread_configs(configs);
+	else if (threaded_context)
+		num_configs = threaded_context_configs(configs);
+	else
+		num_configs = scene_configs(configs);
+
+	printf("%u frames, %u draws/frame, %u triangles/draw, %ux%u\n",
+	       num_frames, num_draws, tris_per_draw, WIDTH, HEIGHT);
+
+	for (i = 0; i < num_configs; i++) {
+		struct program *p = CALLOC_STRUCT(program);
+		double ms;
+
+		putenv(configs[i].env);
+
+		p->num_draws = num_draws;
+		p->tris_per_draw = tris_per_draw;
+
+		init_prog(p);
+		ms = run(p, num_frames);
+		close_prog(p);
+		FREE(p);
+
+		if (i == 0)
+			baseline = ms;
+
+		printf("%-30s %8.3f ms/frame %8.2f frames/s (%.2fx)\n",
+		       configs[i].name, ms, 1000.0 / ms, baseline / ms);
+	}
+
+	return 0;
+}
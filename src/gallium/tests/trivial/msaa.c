@@ -0,0 +1,369 @@
+/**************************************************************************
+ *
+ * Copyright © 2018 VMware, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/*
+ * Frame time benchmark for multisampling.
+ *
+ * Every frame clears a color and depth buffer, draws overlapping random
+ * triangles with depth testing, and for multisample buffers resolves the
+ * color buffer into a single-sample one with a blit.  The same frames are
+ * rendered single-sampled and with 4x multisampling, so the cost of the
+ * per-sample coverage, depth test, blending and the resolve shows up as
+ * the difference between the two.
+ *
+ * usage: msaa [frames] [triangles per frame]
+ */
+
+#define WIDTH 1024
+#define HEIGHT 1024
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pipe/p_state.h"
+#include "pipe/p_context.h"
+#include "pipe/p_screen.h"
+#include "pipe/p_defines.h"
+#include "pipe/p_shader_tokens.h"
+#include "util/u_box.h"
+#include "util/u_inlines.h"
+#include "cso_cache/cso_context.h"
+#include "util/u_draw_quad.h"
+#include "util/u_memory.h"
+#include "util/u_simple_shaders.h"
+#include "util/os_time.h"
+#include "pipe-loader/pipe_loader.h"
+
+struct program
+{
+	struct pipe_loader_device *dev;
+	struct pipe_screen *screen;
+	struct pipe_context *pipe;
+	struct cso_context *cso;
+
+	struct pipe_blend_state blend;
+	struct pipe_depth_stencil_alpha_state depthstencil;
+	struct pipe_rasterizer_state rasterizer;
+	struct pipe_viewport_state viewport;
+	struct pipe_framebuffer_state framebuffer;
+	struct pipe_vertex_element velem[2];
+
+	void *vs;
+	void *fs;
+
+	union pipe_color_union clear_color;
+
+	struct pipe_resource *vbuf;
+	struct pipe_resource *target;
+	struct pipe_resource *zbuf;
+	struct pipe_resource *resolved;
+
+	unsigned num_samples;
+	unsigned num_tris;
+};
+
+static float frand(void)
+{
+	return (float)rand() / (float)RAND_MAX;
+}
+
+static struct pipe_resource *
+create_target(struct program *p, enum pipe_format format,
+	      unsigned bind, unsigned num_samples)
+{
+	struct pipe_resource tmplt;
+
+	memset(&tmplt, 0, sizeof(tmplt));
+	tmplt.target = PIPE_TEXTURE_2D;
+	tmplt.format = format;
+	tmplt.width0 = WIDTH;
+	tmplt.height0 = HEIGHT;
+	tmplt.depth0 = 1;
+	tmplt.array_size = 1;
+	tmplt.last_level = 0;
+	tmplt.nr_samples = num_samples;
+	tmplt.bind = bind;
+
+	return p->screen->resource_create(p->screen, &tmplt);
+}
+
+static boolean init_prog(struct program *p)
+{
+	struct pipe_surface surf_tmpl;
+	unsigned num_verts = p->num_tris * 3;
+	float (*vertices)[2][4];
+	unsigned i;
+	int ret;
+
+	ret = pipe_loader_probe(&p->dev, 1);
+	assert(ret);
+
+	p->screen = pipe_loader_create_screen(p->dev);
+	assert(p->screen);
+
+	if (p->num_samples > 1 &&
+	    (!p->screen->get_param(p->screen, PIPE_CAP_TEXTURE_MULTISAMPLE) ||
+	     !p->screen->is_format_supported(p->screen,
+					     PIPE_FORMAT_B8G8R8A8_UNORM,
+					     PIPE_TEXTURE_2D, p->num_samples,
+					     PIPE_BIND_RENDER_TARGET) ||
+	     !p->screen->is_format_supported(p->screen,
+					     PIPE_FORMAT_Z24_UNORM_S8_UINT,
+					     PIPE_TEXTURE_2D, p->num_samples,
+					     PIPE_BIND_DEPTH_STENCIL))) {
+		p->screen->destroy(p->screen);
+		pipe_loader_release(&p->dev, 1);
+		return FALSE;
+	}
+
+	p->pipe = p->screen->context_create(p->screen, NULL, 0);
+	p->cso = cso_create_context(p->pipe, 0);
+
+	p->clear_color.f[0] = 0.3;
+	p->clear_color.f[1] = 0.1;
+	p->clear_color.f[2] = 0.3;
+	p->clear_color.f[3] = 1.0;
+
+	/* overlapping random triangles at random depths */
+	vertices = MALLOC(num_verts * sizeof(*vertices));
+	srand(0);
+	for (i = 0; i < num_verts; i += 3) {
+		float x = frand() * 1.6f - 0.8f;
+		float y = frand() * 1.6f - 0.8f;
+		float z = frand();
+		unsigned j;
+
+		for (j = 0; j < 3; j++) {
+			vertices[i + j][0][0] = x + (frand() - 0.5f) * 0.4f;
+			vertices[i + j][0][1] = y + (frand() - 0.5f) * 0.4f;
+			vertices[i + j][0][2] = z;
+			vertices[i + j][0][3] = 1.0f;
+			vertices[i + j][1][0] = frand();
+			vertices[i + j][1][1] = frand();
+			vertices[i + j][1][2] = frand();
+			vertices[i + j][1][3] = 1.0f;
+		}
+	}
+
+	p->vbuf = pipe_buffer_create(p->screen, PIPE_BIND_VERTEX_BUFFER,
+				     PIPE_USAGE_DEFAULT,
+				     num_verts * sizeof(*vertices));
+	pipe_buffer_write(p->pipe, p->vbuf, 0, num_verts * sizeof(*vertices),
+			  vertices);
+	FREE(vertices);
+
+	p->target = create_target(p, PIPE_FORMAT_B8G8R8A8_UNORM,
+				  PIPE_BIND_RENDER_TARGET |
+				  PIPE_BIND_SAMPLER_VIEW, p->num_samples);
+	p->zbuf = create_target(p, PIPE_FORMAT_Z24_UNORM_S8_UINT,
+				PIPE_BIND_DEPTH_STENCIL, p->num_samples);
+	if (p->num_samples > 1)
+		p->resolved = create_target(p, PIPE_FORMAT_B8G8R8A8_UNORM,
+					    PIPE_BIND_RENDER_TARGET |
+					    PIPE_BIND_SAMPLER_VIEW, 0);
+
+	memset(&p->blend, 0, sizeof(p->blend));
+	p->blend.rt[0].colormask = PIPE_MASK_RGBA;
+
+	memset(&p->depthstencil, 0, sizeof(p->depthstencil));
+	p->depthstencil.depth.enabled = 1;
+	p->depthstencil.depth.writemask = 1;
+	p->depthstencil.depth.func = PIPE_FUNC_LESS;
+
+	memset(&p->rasterizer, 0, sizeof(p->rasterizer));
+	p->rasterizer.cull_face = PIPE_FACE_NONE;
+	p->rasterizer.half_pixel_center = 1;
+	p->rasterizer.bottom_edge_rule = 1;
+	p->rasterizer.depth_clip = 1;
+	p->rasterizer.multisample = p->num_samples > 1;
+
+	memset(&surf_tmpl, 0, sizeof(surf_tmpl));
+	surf_tmpl.u.tex.level = 0;
+	surf_tmpl.u.tex.first_layer = 0;
+	surf_tmpl.u.tex.last_layer = 0;
+	memset(&p->framebuffer, 0, sizeof(p->framebuffer));
+	p->framebuffer.width = WIDTH;
+	p->framebuffer.height = HEIGHT;
+	p->framebuffer.nr_cbufs = 1;
+	surf_tmpl.format = PIPE_FORMAT_B8G8R8A8_UNORM;
+	p->framebuffer.cbufs[0] = p->pipe->create_surface(p->pipe, p->target, &surf_tmpl);
+	surf_tmpl.format = PIPE_FORMAT_Z24_UNORM_S8_UINT;
+	p->framebuffer.zsbuf = p->pipe->create_surface(p->pipe, p->zbuf, &surf_tmpl);
+
+	p->viewport.scale[0] = WIDTH / 2.0f;
+	p->viewport.scale[1] = HEIGHT / 2.0f;
+	p->viewport.scale[2] = 1.0f;
+	p->viewport.translate[0] = WIDTH / 2.0f;
+	p->viewport.translate[1] = HEIGHT / 2.0f;
+	p->viewport.translate[2] = 0.0f;
+
+	memset(p->velem, 0, sizeof(p->velem));
+	p->velem[0].src_offset = 0 * 4 * sizeof(float);
+	p->velem[0].vertex_buffer_index = 0;
+	p->velem[0].src_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+
+	p->velem[1].src_offset = 1 * 4 * sizeof(float);
+	p->velem[1].vertex_buffer_index = 0;
+	p->velem[1].src_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+
+	{
+		const uint semantic_names[] = { TGSI_SEMANTIC_POSITION,
+						TGSI_SEMANTIC_COLOR };
+		const uint semantic_indexes[] = { 0, 0 };
+		p->vs = util_make_vertex_passthrough_shader(p->pipe, 2, semantic_names, semantic_indexes, FALSE);
+	}
+
+	p->fs = util_make_fragment_passthrough_shader(p->pipe,
+			TGSI_SEMANTIC_COLOR, TGSI_INTERPOLATE_PERSPECTIVE, TRUE);
+
+	return TRUE;
+}
+
+static void close_prog(struct program *p)
+{
+	cso_destroy_context(p->cso);
+
+	p->pipe->delete_vs_state(p->pipe, p->vs);
+	p->pipe->delete_fs_state(p->pipe, p->fs);
+
+	pipe_surface_reference(&p->framebuffer.cbufs[0], NULL);
+	pipe_surface_reference(&p->framebuffer.zsbuf, NULL);
+	pipe_resource_reference(&p->target, NULL);
+	pipe_resource_reference(&p->zbuf, NULL);
+	pipe_resource_reference(&p->resolved, NULL);
+	pipe_resource_reference(&p->vbuf, NULL);
+
+	p->pipe->destroy(p->pipe);
+	p->screen->destroy(p->screen);
+	pipe_loader_release(&p->dev, 1);
+}
+
+static void draw_frame(struct program *p)
+{
+	cso_set_framebuffer(p->cso, &p->framebuffer);
+
+	p->pipe->clear(p->pipe, PIPE_CLEAR_COLOR | PIPE_CLEAR_DEPTHSTENCIL,
+		       &p->clear_color, 1.0, 0);
+
+	cso_set_blend(p->cso, &p->blend);
+	cso_set_depth_stencil_alpha(p->cso, &p->depthstencil);
+	cso_set_rasterizer(p->cso, &p->rasterizer);
+	cso_set_viewport(p->cso, &p->viewport);
+
+	cso_set_fragment_shader_handle(p->cso, p->fs);
+	cso_set_vertex_shader_handle(p->cso, p->vs);
+
+	cso_set_vertex_elements(p->cso, 2, p->velem);
+
+	util_draw_vertex_buffer(p->pipe, p->cso,
+				p->vbuf, 0, 0,
+				PIPE_PRIM_TRIANGLES,
+				p->num_tris * 3,
+				2); /* attribs/vert */
+
+	if (p->resolved) {
+		struct pipe_blit_info info;
+
+		memset(&info, 0, sizeof(info));
+		info.src.resource = p->target;
+		info.src.format = p->target->format;
+		info.dst.resource = p->resolved;
+		info.dst.format = p->resolved->format;
+		u_box_2d(0, 0, WIDTH, HEIGHT, &info.src.box);
+		info.dst.box = info.src.box;
+		info.mask = PIPE_MASK_RGBA;
+		info.filter = PIPE_TEX_FILTER_NEAREST;
+
+		p->pipe->blit(p->pipe, &info);
+	}
+}
+
+static double run(struct program *p, unsigned num_frames)
+{
+	struct pipe_fence_handle *fence = NULL;
+	int64_t start, end;
+	unsigned i;
+
+	/* warm up, so shader compilation isn't timed */
+	draw_frame(p);
+	p->pipe->flush(p->pipe, &fence, 0);
+	p->screen->fence_finish(p->screen, NULL, fence, PIPE_TIMEOUT_INFINITE);
+	p->screen->fence_reference(p->screen, &fence, NULL);
+
+	start = os_time_get_nano();
+
+	for (i = 0; i < num_frames; i++) {
+		draw_frame(p);
+		p->pipe->flush(p->pipe, &fence, 0);
+		p->screen->fence_finish(p->screen, NULL, fence,
+					PIPE_TIMEOUT_INFINITE);
+		p->screen->fence_reference(p->screen, &fence, NULL);
+	}
+
+	end = os_time_get_nano();
+
+	return (end - start) / 1000000.0 / num_frames;
+}
+
+int main(int argc, char** argv)
+{
+	static const unsigned sample_counts[] = { 0, 4 };
+	unsigned num_frames, num_tris;
+	double baseline = 0.0;
+	unsigned i;
+
+	num_frames = argc > 1 ? atoi(argv[1]) : 50;
+	num_tris = argc > 2 ? atoi(argv[2]) : 20000;
+
+	printf("%u frames, %u triangles/frame, %ux%u\n",
+	       num_frames, num_tris, WIDTH, HEIGHT);
+
+	for (i = 0; i < ARRAY_SIZE(sample_counts); i++) {
+		struct program *p = CALLOC_STRUCT(program);
+		double ms;
+
+		p->num_samples = sample_counts[i];
+		p->num_tris = num_tris;
+
+		if (!init_prog(p)) {
+			printf("%ux MSAA unsupported\n", p->num_samples);
+			FREE(p);
+			continue;
+		}
+		ms = run(p, num_frames);
+		close_prog(p);
+		FREE(p);
+
+		if (i == 0)
+			baseline = ms;
+
+		printf("%ux MSAA %s %8.3f ms/frame %8.2f frames/s (%.2fx)\n",
+		       MAX2(sample_counts[i], 1),
+		       sample_counts[i] > 1 ? "+ resolve" : "         ",
+		       ms, 1000.0 / ms, ms / baseline);
+	}
+
+	return 0;
+}
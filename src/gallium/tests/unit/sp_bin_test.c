@@ -0,0 +1,343 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/*
+ * Check that softpipe renders the binned primitives of a scene before a
+ * texture they sample is changed, even when another texture has been
+ * bound since the draw:
+ *
+ *    draw sampling A, bind B, then write A
+ *
+ * A is written with texture_subdata (glTexSubImage) and with
+ * resource_copy_region.  The draw must still see the old contents of A.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pipe/p_context.h"
+#include "pipe/p_defines.h"
+#include "pipe/p_screen.h"
+#include "pipe/p_shader_tokens.h"
+#include "pipe/p_state.h"
+#include "cso_cache/cso_context.h"
+#include "util/u_box.h"
+#include "util/u_draw_quad.h"
+#include "util/u_inlines.h"
+#include "util/u_memory.h"
+#include "util/u_sampler.h"
+#include "util/u_simple_shaders.h"
+#include "softpipe/sp_public.h"
+#include "sw/null/null_sw_winsys.h"
+
+/* big enough for several tiles, so that the draws are binned */
+#define WIDTH 256
+#define HEIGHT 256
+#define TEX_SIZE 4
+
+#define RED   0xffff0000
+#define GREEN 0xff00ff00
+#define BLUE  0xff0000ff
+
+struct test_context {
+   struct pipe_screen *screen;
+   struct pipe_context *pipe;
+   struct cso_context *cso;
+   struct pipe_resource *target;
+   struct pipe_resource *vbuf;
+   struct pipe_framebuffer_state framebuffer;
+   void *vs;
+   void *fs;
+};
+
+
+static struct pipe_resource *
+create_texture(struct test_context *t, unsigned width, unsigned height,
+               unsigned bind)
+{
+   struct pipe_resource templ;
+
+   memset(&templ, 0, sizeof(templ));
+   templ.target = PIPE_TEXTURE_2D;
+   templ.format = PIPE_FORMAT_B8G8R8A8_UNORM;
+   templ.width0 = width;
+   templ.height0 = height;
+   templ.depth0 = 1;
+   templ.array_size = 1;
+   templ.bind = bind;
+
+   return t->screen->resource_create(t->screen, &templ);
+}
+
+
+static void
+fill_texture(struct test_context *t, struct pipe_resource *tex,
+             uint32_t color)
+{
+   uint32_t texels[TEX_SIZE * TEX_SIZE];
+   struct pipe_box box;
+   unsigned i;
+
+   for (i = 0; i < ARRAY_SIZE(texels); i++)
+      texels[i] = color;
+
+   u_box_2d(0, 0, TEX_SIZE, TEX_SIZE, &box);
+   t->pipe->texture_subdata(t->pipe, tex, 0, PIPE_TRANSFER_WRITE, &box,
+                            texels, TEX_SIZE * 4, 0);
+}
+
+
+static struct pipe_sampler_view *
+create_view(struct test_context *t, struct pipe_resource *tex)
+{
+   struct pipe_sampler_view templ;
+
+   u_sampler_view_default_template(&templ, tex, tex->format);
+   return t->pipe->create_sampler_view(t->pipe, tex, &templ);
+}
+
+
+static boolean
+init_context(struct test_context *t)
+{
+   static const float vertices[4][2][4] = {
+      { { -1.0f, -1.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } },
+      { {  1.0f, -1.0f, 0.0f, 1.0f }, { 1.0f, 0.0f, 0.0f, 1.0f } },
+      { {  1.0f,  1.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 0.0f, 1.0f } },
+      { { -1.0f,  1.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f, 1.0f } },
+   };
+   static const uint semantic_names[] = { TGSI_SEMANTIC_POSITION,
+                                          TGSI_SEMANTIC_GENERIC };
+   static const uint semantic_indexes[] = { 0, 0 };
+   struct pipe_surface surf_templ;
+   struct pipe_blend_state blend;
+   struct pipe_depth_stencil_alpha_state dsa;
+   struct pipe_rasterizer_state rasterizer;
+   struct pipe_sampler_state sampler;
+   const struct pipe_sampler_state *samplers[] = { &sampler };
+   struct pipe_viewport_state viewport;
+   struct pipe_vertex_element velem[2];
+
+   memset(t, 0, sizeof(*t));
+
+   t->screen = softpipe_create_screen(null_sw_create());
+   if (!t->screen)
+      return FALSE;
+   t->pipe = t->screen->context_create(t->screen, NULL, 0);
+   if (!t->pipe)
+      return FALSE;
+   t->cso = cso_create_context(t->pipe, 0);
+
+   t->target = create_texture(t, WIDTH, HEIGHT, PIPE_BIND_RENDER_TARGET);
+   t->vbuf = pipe_buffer_create(t->screen, PIPE_BIND_VERTEX_BUFFER,
+                                PIPE_USAGE_DEFAULT, sizeof(vertices));
+   pipe_buffer_write(t->pipe, t->vbuf, 0, sizeof(vertices), vertices);
+
+   memset(&surf_templ, 0, sizeof(surf_templ));
+   surf_templ.format = t->target->format;
+   t->framebuffer.width = WIDTH;
+   t->framebuffer.height = HEIGHT;
+   t->framebuffer.nr_cbufs = 1;
+   t->framebuffer.cbufs[0] =
+      t->pipe->create_surface(t->pipe, t->target, &surf_templ);
+
+   memset(&blend, 0, sizeof(blend));
+   blend.rt[0].colormask = PIPE_MASK_RGBA;
+   memset(&dsa, 0, sizeof(dsa));
+   memset(&rasterizer, 0, sizeof(rasterizer));
+   rasterizer.cull_face = PIPE_FACE_NONE;
+   rasterizer.half_pixel_center = 1;
+   rasterizer.bottom_edge_rule = 1;
+   rasterizer.depth_clip = 1;
+   memset(&sampler, 0, sizeof(sampler));
+   sampler.wrap_s = PIPE_TEX_WRAP_CLAMP_TO_EDGE;
+   sampler.wrap_t = PIPE_TEX_WRAP_CLAMP_TO_EDGE;
+   sampler.wrap_r = PIPE_TEX_WRAP_CLAMP_TO_EDGE;
+   sampler.min_mip_filter = PIPE_TEX_MIPFILTER_NONE;
+   sampler.min_img_filter = PIPE_TEX_FILTER_NEAREST;
+   sampler.mag_img_filter = PIPE_TEX_FILTER_NEAREST;
+   sampler.normalized_coords = 1;
+
+   viewport.scale[0] = WIDTH / 2.0f;
+   viewport.scale[1] = HEIGHT / 2.0f;
+   viewport.scale[2] = 0.5f;
+   viewport.translate[0] = WIDTH / 2.0f;
+   viewport.translate[1] = HEIGHT / 2.0f;
+   viewport.translate[2] = 0.5f;
+
+   memset(velem, 0, sizeof(velem));
+   velem[0].src_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+   velem[1].src_offset = 4 * sizeof(float);
+   velem[1].src_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+
+   t->vs = util_make_vertex_passthrough_shader(t->pipe, 2, semantic_names,
+                                               semantic_indexes, FALSE);
+   t->fs = util_make_fragment_tex_shader(t->pipe, TGSI_TEXTURE_2D,
+                                         TGSI_INTERPOLATE_LINEAR,
+                                         TGSI_RETURN_TYPE_FLOAT,
+                                         TGSI_RETURN_TYPE_FLOAT, false,
+                                         false);
+
+   cso_set_framebuffer(t->cso, &t->framebuffer);
+   cso_set_blend(t->cso, &blend);
+   cso_set_depth_stencil_alpha(t->cso, &dsa);
+   cso_set_rasterizer(t->cso, &rasterizer);
+   cso_set_viewport(t->cso, &viewport);
+   cso_set_samplers(t->cso, PIPE_SHADER_FRAGMENT, 1, samplers);
+   cso_set_vertex_shader_handle(t->cso, t->vs);
+   cso_set_fragment_shader_handle(t->cso, t->fs);
+   cso_set_vertex_elements(t->cso, 2, velem);
+
+   return TRUE;
+}
+
+
+static void
+destroy_context(struct test_context *t)
+{
+   if (t->cso)
+      cso_destroy_context(t->cso);
+   if (t->pipe) {
+      if (t->vs)
+         t->pipe->delete_vs_state(t->pipe, t->vs);
+      if (t->fs)
+         t->pipe->delete_fs_state(t->pipe, t->fs);
+   }
+   pipe_surface_reference(&t->framebuffer.cbufs[0], NULL);
+   pipe_resource_reference(&t->target, NULL);
+   pipe_resource_reference(&t->vbuf, NULL);
+   if (t->pipe)
+      t->pipe->destroy(t->pipe);
+   if (t->screen)
+      t->screen->destroy(t->screen);
+}
+
+
+static uint32_t
+read_center(struct test_context *t)
+{
+   struct pipe_transfer *transfer;
+   struct pipe_box box;
+   uint32_t color;
+   const uint32_t *map;
+
+   u_box_2d(WIDTH / 2, HEIGHT / 2, 1, 1, &box);
+   map = t->pipe->transfer_map(t->pipe, t->target, 0, PIPE_TRANSFER_READ,
+                               &box, &transfer);
+   color = *map;
+   t->pipe->transfer_unmap(t->pipe, transfer);
+
+   return color;
+}
+
+
+/**
+ * Draw with a texture, bind another one, then overwrite the first one with
+ * blue, either from memory or from another texture.
+ */
+static boolean
+test_write_after_rebind(struct test_context *t, boolean copy)
+{
+   const char *name = copy ? "resource_copy_region" : "texture_subdata";
+   struct pipe_resource *a = create_texture(t, TEX_SIZE, TEX_SIZE,
+                                            PIPE_BIND_SAMPLER_VIEW);
+   struct pipe_resource *b = create_texture(t, TEX_SIZE, TEX_SIZE,
+                                            PIPE_BIND_SAMPLER_VIEW);
+   struct pipe_resource *blue = create_texture(t, TEX_SIZE, TEX_SIZE,
+                                               PIPE_BIND_SAMPLER_VIEW);
+   struct pipe_sampler_view *view_a, *view_b;
+   union pipe_color_union clear_color;
+   uint32_t color;
+
+   fill_texture(t, a, RED);
+   fill_texture(t, b, GREEN);
+   fill_texture(t, blue, BLUE);
+   view_a = create_view(t, a);
+   view_b = create_view(t, b);
+
+   memset(&clear_color, 0, sizeof(clear_color));
+   t->pipe->clear(t->pipe, PIPE_CLEAR_COLOR, &clear_color, 0.0, 0);
+
+   cso_set_sampler_views(t->cso, PIPE_SHADER_FRAGMENT, 1, &view_a);
+   util_draw_vertex_buffer(t->pipe, t->cso, t->vbuf, 0, 0,
+                           PIPE_PRIM_TRIANGLE_FAN, 4, 2);
+
+   cso_set_sampler_views(t->cso, PIPE_SHADER_FRAGMENT, 1, &view_b);
+
+   if (copy) {
+      struct pipe_box box;
+
+      u_box_2d(0, 0, TEX_SIZE, TEX_SIZE, &box);
+      t->pipe->resource_copy_region(t->pipe, a, 0, 0, 0, 0, blue, 0, &box);
+   } else {
+      fill_texture(t, a, BLUE);
+   }
+
+   t->pipe->flush(t->pipe, NULL, 0);
+   color = read_center(t);
+
+   cso_set_sampler_views(t->cso, PIPE_SHADER_FRAGMENT, 0, NULL);
+   pipe_sampler_view_reference(&view_a, NULL);
+   pipe_sampler_view_reference(&view_b, NULL);
+   pipe_resource_reference(&a, NULL);
+   pipe_resource_reference(&b, NULL);
+   pipe_resource_reference(&blue, NULL);
+
+   if (color != RED) {
+      printf("FAIL: draw, rebind, %s: got 0x%08x, expected 0x%08x\n",
+             name, color, RED);
+      return FALSE;
+   }
+
+   printf("PASS: draw, rebind, %s\n", name);
+   return TRUE;
+}
+
+
+int
+main(int argc, char **argv)
+{
+   struct test_context t;
+   boolean success = TRUE;
+
+   /* make sure the context bins, whatever the number of CPUs */
+   setenv("SOFTPIPE_NUM_THREADS", "4", 0);
+
+   if (!init_context(&t)) {
+      printf("FAIL: could not create a softpipe context\n");
+      destroy_context(&t);
+      return 1;
+   }
+
+   success &= test_write_after_rebind(&t, FALSE);
+   success &= test_write_after_rebind(&t, TRUE);
+
+   destroy_context(&t);
+
+   return success ? 0 : 1;
+}
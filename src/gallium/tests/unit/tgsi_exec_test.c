@@ -0,0 +1,327 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/*
+ * Check that the SIMD ALU kernels of the TGSI interpreter give the same
+ * results as the per-channel code, for every write mask.
+ *
+ * "./tgsi_exec_test bench" also times each opcode with every kernel set.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tgsi/tgsi_exec.h"
+#include "tgsi/tgsi_exec_simd.h"
+#include "tgsi/tgsi_text.h"
+#include "util/os_time.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+
+#define MAX_TOKENS 4096
+#define BENCH_INSTRUCTIONS 64
+#define BENCH_RUNS 20000
+
+struct test_op {
+   const char *name;
+   unsigned num_src;
+};
+
+static const struct test_op ops[] = {
+   { "ADD", 2 }, { "MUL", 2 }, { "MIN", 2 }, { "MAX", 2 },
+   { "SLT", 2 }, { "SLE", 2 }, { "SGT", 2 }, { "SGE", 2 },
+   { "SEQ", 2 }, { "SNE", 2 },
+   { "FSLT", 2 }, { "FSGE", 2 }, { "FSEQ", 2 }, { "FSNE", 2 },
+   { "AND", 2 }, { "OR", 2 }, { "XOR", 2 },
+   { "UADD", 2 }, { "UMUL", 2 },
+   { "IMAX", 2 }, { "IMIN", 2 }, { "UMAX", 2 }, { "UMIN", 2 },
+   { "MAD", 3 }, { "LRP", 3 },
+   { "FLR", 1 }, { "CEIL", 1 }, { "FRC", 1 }, { "TRUNC", 1 },
+   { "ROUND", 1 },
+};
+
+static const unsigned channels[] = { 1, 2, 4 };
+
+static const float special[] = {
+   0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f, 1.5f, 2.5f, -2.5f, 3.49f,
+   1e30f, -1e-30f, 1e-40f, 16777217.0f,
+};
+
+
+static uint32_t
+rand_lane(void)
+{
+   union fi v;
+
+   switch (rand() % 4) {
+   case 0:
+      v.f = special[rand() % ARRAY_SIZE(special)];
+      break;
+   case 1:
+      v.ui = 0x7f800000 | (rand() % 3 == 0 ? 0x400000 : 0); /* inf, NaN */
+      v.ui |= (uint32_t) (rand() & 1) << 31;
+      break;
+   case 2:
+      v.f = (float) (rand() % 2000 - 1000) / 7.0f;
+      break;
+   default:
+      v.ui = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+      break;
+   }
+   return v.ui;
+}
+
+
+static struct tgsi_token *
+build_shader(const struct test_op *op, const char *dst, const char *mask,
+             const char *swizzle, unsigned count)
+{
+   static const char *regs[] = { "TEMP[0]", "TEMP[1]", "TEMP[2]", "TEMP[3]" };
+   char text[8192];
+   struct tgsi_token *tokens = MALLOC(MAX_TOKENS * sizeof(*tokens));
+   unsigned i, j;
+   int len;
+
+   len = snprintf(text, sizeof(text),
+                  "VERT\n"
+                  "DCL IN[0..2]\n"
+                  "DCL OUT[0]\n"
+                  "DCL TEMP[0..3]\n"
+                  "MOV TEMP[0], IN[0]\n"
+                  "MOV TEMP[1], IN[1]\n"
+                  "MOV TEMP[2], IN[2]\n"
+                  "MOV TEMP[3], IN[0].yzwx\n");
+
+   if (count == 1) {
+      len += snprintf(text + len, sizeof(text) - len, "%s %s%s",
+                      op->name, dst, mask);
+      for (j = 0; j < op->num_src; j++)
+         len += snprintf(text + len, sizeof(text) - len, ", IN[%u]%s",
+                         j, swizzle);
+      len += snprintf(text + len, sizeof(text) - len, "\n");
+      if (strcmp(dst, "OUT[0]") != 0)
+         len += snprintf(text + len, sizeof(text) - len,
+                         "MOV OUT[0], %s\n", dst);
+   } else {
+      for (i = 0; i < count; i++) {
+         len += snprintf(text + len, sizeof(text) - len, "%s %s%s",
+                         op->name, regs[i % 4], mask);
+         for (j = 0; j < op->num_src; j++)
+            len += snprintf(text + len, sizeof(text) - len, ", %s",
+                            regs[(i + j + 1) % 4]);
+         len += snprintf(text + len, sizeof(text) - len, "\n");
+      }
+      len += snprintf(text + len, sizeof(text) - len, "MOV OUT[0], TEMP[0]\n");
+   }
+   snprintf(text + len, sizeof(text) - len, "END\n");
+
+   if (!tgsi_text_translate(text, tokens, MAX_TOKENS)) {
+      printf("Failed to translate:\n%s", text);
+      FREE(tokens);
+      return NULL;
+   }
+   return tokens;
+}
+
+
+static void
+run(struct tgsi_exec_machine *mach,
+    const struct tgsi_exec_vector inputs[3],
+    struct tgsi_exec_vector *output)
+{
+   memcpy(mach->Inputs, inputs, 3 * sizeof(inputs[0]));
+   memset(mach->Outputs, 0, sizeof(mach->Outputs[0]));
+   mach->NonHelperMask = (1 << TGSI_QUAD_SIZE) - 1;
+   tgsi_exec_machine_run(mach, 0);
+   memcpy(output, mach->Outputs, sizeof(*output));
+}
+
+
+static boolean
+lanes_equal(uint32_t a, uint32_t b)
+{
+   /* NaN payloads aren't worth comparing */
+   return a == b ||
+          ((a & 0x7fffffff) > 0x7f800000 && (b & 0x7fffffff) > 0x7f800000);
+}
+
+
+/*
+ * Run the instruction for every write mask, with the registers read and
+ * written in place by the kernels (temporaries, inputs without swizzles)
+ * and through fetch/store (outputs, swizzled sources).
+ */
+static unsigned
+test_op(struct tgsi_exec_machine *mach, const struct test_op *op,
+        unsigned *total)
+{
+   static const char *chans = "xyzw";
+   unsigned failed = 0;
+   unsigned variant, writemask, w, iter, c, l;
+
+   for (variant = 0; variant < 4 * 15; variant++) {
+      const char *dst = variant & 1 ? "TEMP[0]" : "OUT[0]";
+      const char *swizzle = variant & 2 ? ".wzyx" : "";
+      struct tgsi_token *tokens;
+      char mask[6] = ".";
+
+      writemask = variant / 4 + 1;
+      for (c = 0; c < 4; c++) {
+         if (writemask & (1 << c))
+            strncat(mask, &chans[c], 1);
+      }
+
+      tokens = build_shader(op, dst, mask, swizzle, 1);
+      if (!tokens)
+         return 1;
+      tgsi_exec_machine_bind_shader(mach, tokens, NULL, NULL, NULL);
+
+      for (iter = 0; iter < 32; iter++) {
+         struct tgsi_exec_vector inputs[3], expected, result;
+
+         for (c = 0; c < 4 * TGSI_QUAD_SIZE; c++) {
+            inputs[0].xyzw[c / 4].u[c % 4] = rand_lane();
+            inputs[1].xyzw[c / 4].u[c % 4] = rand_lane();
+            inputs[2].xyzw[c / 4].u[c % 4] = rand_lane();
+         }
+
+         mach->Simd = NULL;
+         run(mach, inputs, &expected);
+
+         for (w = 0; w < ARRAY_SIZE(channels); w++) {
+            mach->Simd = tgsi_exec_get_simd(channels[w]);
+            if (!mach->Simd)
+               continue;
+
+            run(mach, inputs, &result);
+            (*total)++;
+
+            for (c = 0; c < 4; c++) {
+               for (l = 0; l < TGSI_QUAD_SIZE; l++) {
+                  uint32_t e = expected.xyzw[c].u[l];
+                  uint32_t r = result.xyzw[c].u[l];
+
+                  if (!lanes_equal(e, r)) {
+                     printf("%s %s%s%s (%s, %u channels): %c[%u] = %08x, "
+                            "expected %08x\n",
+                            op->name, dst, mask, swizzle,
+                            mach->Simd->name, channels[w],
+                            chans[c], l, r, e);
+                     failed++;
+                     goto next_simd;
+                  }
+               }
+            }
+         next_simd:
+            ;
+         }
+      }
+
+      tgsi_exec_machine_bind_shader(mach, NULL, NULL, NULL, NULL);
+      FREE(tokens);
+   }
+   return failed;
+}
+
+
+static double
+bench_op(struct tgsi_exec_machine *mach, const struct test_op *op,
+         const struct tgsi_exec_simd *simd)
+{
+   struct tgsi_exec_vector inputs[3], output;
+   struct tgsi_token *tokens;
+   int64_t start, end;
+   unsigned i;
+
+   tokens = build_shader(op, NULL, "", "", BENCH_INSTRUCTIONS);
+   if (!tokens)
+      return 0.0;
+   tgsi_exec_machine_bind_shader(mach, tokens, NULL, NULL, NULL);
+   mach->Simd = simd;
+
+   for (i = 0; i < 4 * TGSI_QUAD_SIZE; i++) {
+      inputs[0].xyzw[i / 4].f[i % 4] = 1.0f + i / 16.0f;
+      inputs[1].xyzw[i / 4].f[i % 4] = 0.5f - i / 32.0f;
+      inputs[2].xyzw[i / 4].f[i % 4] = 0.25f * i;
+   }
+
+   start = os_time_get_nano();
+   for (i = 0; i < BENCH_RUNS; i++)
+      run(mach, inputs, &output);
+   end = os_time_get_nano();
+
+   tgsi_exec_machine_bind_shader(mach, NULL, NULL, NULL, NULL);
+   FREE(tokens);
+
+   return (double) (end - start) / (BENCH_RUNS * BENCH_INSTRUCTIONS);
+}
+
+
+int
+main(int argc, char **argv)
+{
+   struct tgsi_exec_machine *mach;
+   unsigned failed = 0, total = 0;
+   unsigned i, w;
+
+   mach = tgsi_exec_machine_create(PIPE_SHADER_VERTEX);
+   if (!mach) {
+      printf("Failed to create the machine\n");
+      return 1;
+   }
+
+   if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+      /* ns per instruction, whole interpreter overhead included */
+      printf("%-6s %8s", "opcode", "scalar");
+      for (w = 0; w < ARRAY_SIZE(channels); w++)
+         printf(" %7uc", channels[w]);
+      printf("\n");
+
+      for (i = 0; i < ARRAY_SIZE(ops); i++) {
+         printf("%-6s %8.2f", ops[i].name, bench_op(mach, &ops[i], NULL));
+         for (w = 0; w < ARRAY_SIZE(channels); w++) {
+            const struct tgsi_exec_simd *simd =
+               tgsi_exec_get_simd(channels[w]);
+
+            if (simd)
+               printf(" %8.2f", bench_op(mach, &ops[i], simd));
+            else
+               printf(" %8s", "-");
+         }
+         printf("\n");
+      }
+   } else {
+      for (i = 0; i < ARRAY_SIZE(ops); i++)
+         failed += test_op(mach, &ops[i], &total);
+
+      printf("%u/%u tests passed\n", total - failed, total);
+   }
+
+   tgsi_exec_machine_destroy(mach);
+   return failed != 0;
+}
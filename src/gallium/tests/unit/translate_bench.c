@@ -0,0 +1,255 @@
+/**************************************************************************
+ *
+ * Copyright 2018 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/*
+ * Compare the translate backends on typical vertex layouts, the way the
+ * draw module's fetch stage uses them: every element converted to
+ * R32G32B32A32_FLOAT.
+ *
+ * Each backend's output is checked against translate_generic first, then
+ * the time per vertex is printed for indexed and linear runs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "translate/translate.h"
+#include "util/os_time.h"
+#include "util/u_cpu_detect.h"
+#include "util/u_format.h"
+#include "util/u_half.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+
+#define NR_VERTICES (64 * 1024)
+#define NR_RUNS 50
+
+struct layout {
+   const char *name;
+   enum pipe_format formats[6];
+};
+
+static const struct layout layouts[] = {
+   { "pos3f norm3f uv2f",
+     { PIPE_FORMAT_R32G32B32_FLOAT, PIPE_FORMAT_R32G32B32_FLOAT,
+       PIPE_FORMAT_R32G32_FLOAT } },
+   { "pos3f norm3f uv2f rgba8",
+     { PIPE_FORMAT_R32G32B32_FLOAT, PIPE_FORMAT_R32G32B32_FLOAT,
+       PIPE_FORMAT_R32G32_FLOAT, PIPE_FORMAT_R8G8B8A8_UNORM } },
+   { "pos4h norm1010102 uv2h",
+     { PIPE_FORMAT_R16G16B16A16_FLOAT, PIPE_FORMAT_R10G10B10A2_SNORM,
+       PIPE_FORMAT_R16G16_FLOAT } },
+   { "pos3f bgra1010102 uv2us",
+     { PIPE_FORMAT_R32G32B32_FLOAT, PIPE_FORMAT_B10G10R10A2_UNORM,
+       PIPE_FORMAT_R16G16_UNORM } },
+   { "pos3s norm4sb uv2s",
+     { PIPE_FORMAT_R16G16B16_SNORM, PIPE_FORMAT_R8G8B8A8_SNORM,
+       PIPE_FORMAT_R16G16_SNORM } },
+   { "skinned",
+     { PIPE_FORMAT_R32G32B32_FLOAT, PIPE_FORMAT_R10G10B10A2_SNORM,
+       PIPE_FORMAT_R16G16_FLOAT, PIPE_FORMAT_R8G8B8A8_UNORM,
+       PIPE_FORMAT_R8G8B8A8_USCALED } },
+};
+
+struct backend {
+   const char *name;
+   struct translate *(*create)(const struct translate_key *key);
+};
+
+static const struct backend backends[] = {
+   { "generic", translate_generic_create },
+   { "sse", translate_sse2_create },
+   { "avx2", translate_avx2_create },
+};
+
+
+static unsigned
+build_key(const struct layout *layout, struct translate_key *key)
+{
+   unsigned offset = 0;
+   unsigned i;
+
+   memset(key, 0, sizeof(*key));
+
+   for (i = 0; i < ARRAY_SIZE(layout->formats) && layout->formats[i]; i++) {
+      struct translate_element *elem = &key->element[i];
+
+      elem->type = TRANSLATE_ELEMENT_NORMAL;
+      elem->input_format = layout->formats[i];
+      elem->output_format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+      elem->input_buffer = 0;
+      elem->input_offset = offset;
+      elem->output_offset = i * 4 * sizeof(float);
+      offset += util_format_get_blocksize(layout->formats[i]);
+   }
+
+   key->nr_elements = i;
+   key->output_stride = i * 4 * sizeof(float);
+   translate_key_sanitize(key);
+
+   /* vertex stride */
+   return offset;
+}
+
+
+static void
+fill_vertices(const struct layout *layout, uint8_t *data, unsigned stride)
+{
+   unsigned v, i, j;
+
+   for (v = 0; v < NR_VERTICES; v++) {
+      uint8_t *vert = data + v * stride;
+
+      for (i = 0; i < ARRAY_SIZE(layout->formats) && layout->formats[i]; i++) {
+         const struct util_format_description *desc =
+            util_format_description(layout->formats[i]);
+         float rgba[4];
+
+         /* keep floats and halves finite */
+         for (j = 0; j < 4; j++)
+            rgba[j] = (float)(rand() % 20000 - 10000) / 1000.0f;
+         if (desc->channel[0].type == UTIL_FORMAT_TYPE_FLOAT) {
+            desc->pack_rgba_float(vert, 0, rgba, 0, 1, 1);
+         } else {
+            for (j = 0; j < desc->block.bits / 8; j++)
+               vert[j] = rand();
+         }
+         vert += desc->block.bits / 8;
+      }
+   }
+}
+
+
+static double
+time_run(struct translate *translate, const unsigned *elts, void *output)
+{
+   int64_t start, end;
+   unsigned i;
+
+   start = os_time_get_nano();
+   for (i = 0; i < NR_RUNS; i++) {
+      if (elts)
+         translate->run_elts(translate, elts, NR_VERTICES, 0, 0, output);
+      else
+         translate->run(translate, 0, NR_VERTICES, 0, 0, output);
+   }
+   end = os_time_get_nano();
+
+   return (double)(end - start) / ((double)NR_RUNS * NR_VERTICES);
+}
+
+
+static boolean
+outputs_equal(const float *a, const float *b, unsigned n)
+{
+   unsigned i;
+
+   for (i = 0; i < n; i++) {
+      if (memcmp(&a[i], &b[i], 4) != 0 &&
+          !(util_is_inf_or_nan(a[i]) && util_is_inf_or_nan(b[i]) &&
+            a[i] != a[i] && b[i] != b[i]))
+         return FALSE;
+   }
+   return TRUE;
+}
+
+
+int
+main(int argc, char **argv)
+{
+   unsigned *elts = MALLOC(NR_VERTICES * sizeof(*elts));
+   float *output = MALLOC(NR_VERTICES * 6 * 4 * sizeof(float));
+   float *expected = MALLOC(NR_VERTICES * 6 * 4 * sizeof(float));
+   unsigned failed = 0;
+   unsigned i, l, b;
+
+   if (!elts || !output || !expected)
+      return 1;
+
+   util_cpu_detect();
+
+   srand(4359025);
+
+   /* post-transform-cache friendly, but not linear */
+   for (i = 0; i < NR_VERTICES; i++)
+      elts[i] = (i & ~63) | ((i * 37) & 63);
+
+   printf("%-26s %-8s %12s %12s\n", "layout", "backend",
+          "elts ns/vtx", "linear ns/vtx");
+
+   for (l = 0; l < ARRAY_SIZE(layouts); l++) {
+      struct translate_key key;
+      unsigned stride = build_key(&layouts[l], &key);
+      unsigned nr_floats = NR_VERTICES * key.output_stride / sizeof(float);
+      uint8_t *data = MALLOC(NR_VERTICES * stride);
+      struct translate *generic;
+
+      if (!data)
+         return 1;
+      fill_vertices(&layouts[l], data, stride);
+
+      generic = translate_generic_create(&key);
+      generic->set_buffer(generic, 0, data, stride, NR_VERTICES - 1);
+      generic->run_elts(generic, elts, NR_VERTICES, 0, 0, expected);
+
+      for (b = 0; b < ARRAY_SIZE(backends); b++) {
+         struct translate *translate = backends[b].create(&key);
+
+         if (!translate) {
+            printf("%-26s %-8s %12s %12s\n", layouts[l].name,
+                   backends[b].name, "-", "-");
+            continue;
+         }
+
+         translate->set_buffer(translate, 0, data, stride, NR_VERTICES - 1);
+
+         memset(output, 0, nr_floats * sizeof(float));
+         translate->run_elts(translate, elts, NR_VERTICES, 0, 0, output);
+         if (!outputs_equal(output, expected, nr_floats)) {
+            printf("%-26s %-8s output differs from translate_generic\n",
+                   layouts[l].name, backends[b].name);
+            failed++;
+         }
+
+         printf("%-26s %-8s %12.2f", layouts[l].name, backends[b].name,
+                time_run(translate, elts, output));
+         printf(" %12.2f\n", time_run(translate, NULL, output));
+
+         translate->release(translate);
+      }
+
+      generic->release(generic);
+      FREE(data);
+   }
+
+   FREE(expected);
+   FREE(output);
+   FREE(elts);
+
+   return failed != 0;
+}
@@ -13,107 +13,198 @@ struct transform {
    unsigned condition_offset;
 };
 
+struct transform_list {
+   const struct transform *xforms;
+   unsigned num_xforms;
+};
+
+/* Automaton transitions for an opcode.  The state of an instruction is
+ * table[f(src0) * n^(k-1) + ... + f(src(k-1))], where f maps the state of a
+ * source through filter and n is num_filtered_states.
+ */
+struct per_op_table {
+   const uint16_t *filter;
+   unsigned num_filtered_states;
+   const uint16_t *table;
+};
+
 #endif
 
    
-static const nir_search_variable search1_0 = {
+static const nir_search_variable search0_0 = {
    { nir_search_value_variable, 0 },
    0, /* x */
    false,
    nir_type_invalid,
    NULL,
 };
-static const nir_search_expression search1 = {
+static const nir_search_expression search0 = {
    { nir_search_value_expression, 0 },
    false,
-   nir_op_fcos,
-   { &search1_0.value },
+   nir_op_fsin,
+   { &search0_0.value },
    NULL,
 };
    
-static const nir_search_variable replace1_0_0 = {
+static const nir_search_variable replace0_0_0 = {
    { nir_search_value_variable, 0 },
    0, /* x */
    false,
    nir_type_invalid,
    NULL,
 };
-static const nir_search_expression replace1_0 = {
+static const nir_search_expression replace0_0 = {
    { nir_search_value_expression, 0 },
    false,
-   nir_op_fcos,
-   { &replace1_0_0.value },
+   nir_op_fsin,
+   { &replace0_0_0.value },
    NULL,
 };
 
-static const nir_search_constant replace1_1 = {
+static const nir_search_constant replace0_1 = {
    { nir_search_value_constant, 0 },
    nir_type_float, { 0x3fefffc115df6556 /* 0.99997 */ },
 };
-static const nir_search_expression replace1 = {
+static const nir_search_expression replace0 = {
    { nir_search_value_expression, 0 },
    false,
    nir_op_fmul,
-   { &replace1_0.value, &replace1_1.value },
+   { &replace0_0.value, &replace0_1.value },
    NULL,
 };
-
-static const struct transform brw_nir_apply_trig_workarounds_fcos_xforms[] = {
-   { &search1, &replace1.value, 0 },
-};
    
-static const nir_search_variable search0_0 = {
+static const nir_search_variable search1_0 = {
    { nir_search_value_variable, 0 },
    0, /* x */
    false,
    nir_type_invalid,
    NULL,
 };
-static const nir_search_expression search0 = {
+static const nir_search_expression search1 = {
    { nir_search_value_expression, 0 },
    false,
-   nir_op_fsin,
-   { &search0_0.value },
+   nir_op_fcos,
+   { &search1_0.value },
    NULL,
 };
    
-static const nir_search_variable replace0_0_0 = {
+static const nir_search_variable replace1_0_0 = {
    { nir_search_value_variable, 0 },
    0, /* x */
    false,
    nir_type_invalid,
    NULL,
 };
-static const nir_search_expression replace0_0 = {
+static const nir_search_expression replace1_0 = {
    { nir_search_value_expression, 0 },
    false,
-   nir_op_fsin,
-   { &replace0_0_0.value },
+   nir_op_fcos,
+   { &replace1_0_0.value },
    NULL,
 };
 
-static const nir_search_constant replace0_1 = {
+static const nir_search_constant replace1_1 = {
    { nir_search_value_constant, 0 },
    nir_type_float, { 0x3fefffc115df6556 /* 0.99997 */ },
 };
-static const nir_search_expression replace0 = {
+static const nir_search_expression replace1 = {
    { nir_search_value_expression, 0 },
    false,
    nir_op_fmul,
-   { &replace0_0.value, &replace0_1.value },
+   { &replace1_0.value, &replace1_1.value },
    NULL,
 };
 
-static const struct transform brw_nir_apply_trig_workarounds_fsin_xforms[] = {
+static const struct transform brw_nir_apply_trig_workarounds_xforms_0[] = {
    { &search0, &replace0.value, 0 },
 };
 
+static const struct transform brw_nir_apply_trig_workarounds_xforms_1[] = {
+   { &search1, &replace1.value, 0 },
+};
+
+/* The transforms to try on an instruction, indexed by its state. */
+static const struct transform_list brw_nir_apply_trig_workarounds_state_xforms[] = {
+   { NULL, 0 },
+   { NULL, 0 },
+   { brw_nir_apply_trig_workarounds_xforms_0, ARRAY_SIZE(brw_nir_apply_trig_workarounds_xforms_0) },
+   { brw_nir_apply_trig_workarounds_xforms_1, ARRAY_SIZE(brw_nir_apply_trig_workarounds_xforms_1) },
+};
+
+static const uint16_t brw_nir_apply_trig_workarounds_filter_0[] = {
+   0, 0, 0, 0,
+};
+
+static const uint16_t brw_nir_apply_trig_workarounds_table_fsin[] = {
+   2,
+};
+
+static const uint16_t brw_nir_apply_trig_workarounds_table_fcos[] = {
+   3,
+};
+
+static const struct per_op_table brw_nir_apply_trig_workarounds_table[nir_num_opcodes] = {
+   [nir_op_fsin] = {
+      .filter = brw_nir_apply_trig_workarounds_filter_0,
+      .num_filtered_states = 1,
+      .table = brw_nir_apply_trig_workarounds_table_fsin,
+   },
+   [nir_op_fcos] = {
+      .filter = brw_nir_apply_trig_workarounds_filter_0,
+      .num_filtered_states = 1,
+      .table = brw_nir_apply_trig_workarounds_table_fcos,
+   },
+};
+
+/* Compute the state of every SSA value defined in the block.  Values which
+ * aren't produced by an ALU instruction are left in state 0, which matches
+ * only variables.
+ */
+static void
+brw_nir_apply_trig_workarounds_pre_block(nir_block *block, uint16_t *states)
+{
+   nir_foreach_instr(instr, block) {
+      switch (instr->type) {
+      case nir_instr_type_alu: {
+         nir_alu_instr *alu = nir_instr_as_alu(instr);
+         const struct per_op_table *tbl = &brw_nir_apply_trig_workarounds_table[alu->op];
+
+         if (!alu->dest.dest.is_ssa || tbl->table == NULL)
+            break;
+
+         unsigned index = 0;
+         for (unsigned i = 0; i < nir_op_infos[alu->op].num_inputs; i++) {
+            unsigned src_state = alu->src[i].src.is_ssa ?
+                                 states[alu->src[i].src.ssa->index] : 0;
+            index = index * tbl->num_filtered_states + tbl->filter[src_state];
+         }
+
+         states[alu->dest.dest.ssa.index] = tbl->table[index];
+         break;
+      }
+
+      case nir_instr_type_load_const: {
+         nir_load_const_instr *load_const = nir_instr_as_load_const(instr);
+         states[load_const->def.index] = 1;
+         break;
+      }
+
+      default:
+         break;
+      }
+   }
+}
+
 static bool
 brw_nir_apply_trig_workarounds_block(nir_block *block, const bool *condition_flags,
-                   void *mem_ctx)
+                   const uint16_t *states, void *mem_ctx)
 {
    bool progress = false;
 
+   /* Instructions inserted by nir_replace_instr() land after the iterator,
+    * so every instruction visited here still has the state computed for it
+    * before any replacement was made.
+    */
    nir_foreach_instr_reverse_safe(instr, block) {
       if (instr->type != nir_instr_type_alu)
          continue;
@@ -122,31 +213,17 @@ brw_nir_apply_trig_workarounds_block(nir_block *block, const bool *condition_fla
       if (!alu->dest.dest.is_ssa)
          continue;
 
-      switch (alu->op) {
-      case nir_op_fcos:
-         for (unsigned i = 0; i < ARRAY_SIZE(brw_nir_apply_trig_workarounds_fcos_xforms); i++) {
-            const struct transform *xform = &brw_nir_apply_trig_workarounds_fcos_xforms[i];
-            if (condition_flags[xform->condition_offset] &&
-                nir_replace_instr(alu, xform->search, xform->replace,
-                                  mem_ctx)) {
-               progress = true;
-               break;
-            }
-         }
-         break;
-      case nir_op_fsin:
-         for (unsigned i = 0; i < ARRAY_SIZE(brw_nir_apply_trig_workarounds_fsin_xforms); i++) {
-            const struct transform *xform = &brw_nir_apply_trig_workarounds_fsin_xforms[i];
-            if (condition_flags[xform->condition_offset] &&
-                nir_replace_instr(alu, xform->search, xform->replace,
-                                  mem_ctx)) {
-               progress = true;
-               break;
-            }
+      const struct transform_list *list =
+         &brw_nir_apply_trig_workarounds_state_xforms[states[alu->dest.dest.ssa.index]];
+
+      for (unsigned i = 0; i < list->num_xforms; i++) {
+         const struct transform *xform = &list->xforms[i];
+         if (condition_flags[xform->condition_offset] &&
+             nir_replace_instr(alu, xform->search, xform->replace,
+                               mem_ctx)) {
+            progress = true;
+            break;
          }
-         break;
-      default:
-         break;
       }
    }
 
@@ -159,10 +236,18 @@ brw_nir_apply_trig_workarounds_impl(nir_function_impl *impl, const bool *conditi
    void *mem_ctx = ralloc_parent(impl);
    bool progress = false;
 
+   uint16_t *states = calloc(impl->ssa_alloc, sizeof(*states));
+
+   nir_foreach_block(block, impl) {
+      brw_nir_apply_trig_workarounds_pre_block(block, states);
+   }
+
    nir_foreach_block_reverse(block, impl) {
-      progress |= brw_nir_apply_trig_workarounds_block(block, condition_flags, mem_ctx);
+      progress |= brw_nir_apply_trig_workarounds_block(block, condition_flags, states, mem_ctx);
    }
 
+   free(states);
+
    if (progress)
       nir_metadata_preserve(impl, nir_metadata_block_index |
                                   nir_metadata_dominance);
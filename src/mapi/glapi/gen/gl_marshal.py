@@ -89,6 +89,10 @@ class PrintCode(gl_XML.gl_print_base):
         out('debug_print_sync_fallback("{0}");'.format(func.name))
         self.print_sync_call(func)
 
+    def print_call_after(self, func):
+        if func.marshal_call_after:
+            out('{0};'.format(func.marshal_call_after))
+
     def print_sync_body(self, func):
         out('/* {0}: marshalled synchronously */'.format(func.name))
         out('static {0} GLAPIENTRY'.format(func.return_type))
@@ -96,9 +100,11 @@ class PrintCode(gl_XML.gl_print_base):
         out('{')
         with indent():
             out('GET_CURRENT_CONTEXT(ctx);')
-            out('_mesa_glthread_finish(ctx);')
+            out('_mesa_glthread_finish_before(ctx, "{0}");'.format(func.name))
             out('debug_print_sync("{0}");'.format(func.name))
             self.print_sync_call(func)
+            if func.return_type == 'void':
+                self.print_call_after(func)
         out('}')
         out('')
         out('')
@@ -132,6 +138,7 @@ class PrintCode(gl_XML.gl_print_base):
 
         if not func.fixed_params and not func.variable_params:
             out('(void) cmd;\n')
+        self.print_call_after(func)
         out('_mesa_post_marshal_hook(ctx);')
 
     def print_async_struct(self, func):
@@ -243,10 +250,18 @@ class PrintCode(gl_XML.gl_print_base):
 
             need_fallback_sync = self.validate_count_or_fallback(func)
 
+            if func.marshal_sync:
+                out('if ({0}) {{'.format(func.marshal_sync))
+                with indent():
+                    out('_mesa_glthread_finish_before(ctx, "{0}");'.format(func.name))
+                    self.print_sync_dispatch(func)
+                    out('return;')
+                out('}')
+
             if func.marshal_fail:
                 out('if ({0}) {{'.format(func.marshal_fail))
                 with indent():
-                    out('_mesa_glthread_finish(ctx);')
+                    out('_mesa_glthread_finish_before(ctx, "{0}");'.format(func.name))
                     out('_mesa_glthread_restore_dispatch(ctx);')
                     self.print_sync_dispatch(func)
                     out('return;')
@@ -262,8 +277,9 @@ class PrintCode(gl_XML.gl_print_base):
         if need_fallback_sync:
             out('fallback_to_sync:')
         with indent():
-            out('_mesa_glthread_finish(ctx);')
+            out('_mesa_glthread_finish_before(ctx, "{0}");'.format(func.name))
             self.print_sync_dispatch(func)
+            self.print_call_after(func)
 
         out('}')
 
@@ -285,7 +301,7 @@ class PrintCode(gl_XML.gl_print_base):
             out('switch (cmd_base->cmd_id) {')
             for func in api.functionIterateAll():
                 flavor = func.marshal_flavor()
-                if flavor in ('skip', 'sync'):
+                if flavor in ('skip', 'sync', 'custom_sync'):
                     continue
                 out('case DISPATCH_CMD_{0}:'.format(func.name))
                 with indent():
@@ -330,7 +346,7 @@ class PrintCode(gl_XML.gl_print_base):
         async_funcs = []
         for func in api.functionIterateAll():
             flavor = func.marshal_flavor()
-            if flavor in ('skip', 'custom'):
+            if flavor in ('skip', 'custom', 'custom_sync'):
                 continue
             elif flavor == 'async':
                 self.print_async_body(func)
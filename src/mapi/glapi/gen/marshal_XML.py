@@ -58,10 +58,18 @@ class marshal_function(gl_XML.gl_function):
         # Store the "marshal" attribute, if present.
         self.marshal = element.get('marshal')
         self.marshal_fail = element.get('marshal_fail')
+        self.marshal_sync = element.get('marshal_sync')
+        self.marshal_call_after = element.get('marshal_call_after')
 
     def marshal_flavor(self):
         """Find out how this function should be marshalled between
-        client and server threads."""
+        client and server threads.
+
+        marshal="custom" functions are hand-written in marshal.c and queue
+        commands like async ones.  marshal="custom_sync" functions are
+        hand-written too, but never queue anything (typically queries which
+        can sometimes be answered by the client thread without
+        synchronizing)."""
         # If a "marshal" attribute was present, that overrides any
         # determination that would otherwise be made by this function.
         if self.marshal not in (None, 'draw'):
@@ -9736,9 +9736,17 @@ KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1068)(GLint location, GLsizei cou
    DISPATCH(Uniform4ui64vARB, (location, count, value), (F, "glUniform4ui64vARB(%d, %d, %p);\n", location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1069)(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1069)(GLuint count);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1069)(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1069)(GLuint count)
+{
+    (void) count;
+   DISPATCH(MaxShaderCompilerThreadsARB, (count), (F, "glMaxShaderCompilerThreadsARB(%d);\n", count));
+}
+
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1070)(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue);
+
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1070)(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue)
 {
     (void) shader; (void) pEntryPoint; (void) numSpecializationConstants; (void) pConstantIndex; (void) pConstantValue;
    DISPATCH(SpecializeShaderARB, (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue), (F, "glSpecializeShaderARB(%d, %p, %d, %p, %p);\n", shader, (const void *) pEntryPoint, numSpecializationConstants, (const void *) pConstantIndex, (const void *) pConstantValue));
@@ -9780,73 +9788,73 @@ KEYWORD1 void KEYWORD2 NAME(InvalidateTexSubImage)(GLuint texture, GLint level,
    DISPATCH(InvalidateTexSubImage, (texture, level, xoffset, yoffset, zoffset, width, height, depth), (F, "glInvalidateTexSubImage(%d, %d, %d, %d, %d, %d, %d, %d);\n", texture, level, xoffset, yoffset, zoffset, width, height, depth));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1076)(GLfloat factor, GLfloat bias);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1077)(GLfloat factor, GLfloat bias);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1076)(GLfloat factor, GLfloat bias)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1077)(GLfloat factor, GLfloat bias)
 {
     (void) factor; (void) bias;
    DISPATCH(PolygonOffsetEXT, (factor, bias), (F, "glPolygonOffsetEXT(%f, %f);\n", factor, bias));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1077)(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1078)(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1077)(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1078)(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)
 {
     (void) x; (void) y; (void) z; (void) width; (void) height;
    DISPATCH(DrawTexfOES, (x, y, z, width, height), (F, "glDrawTexfOES(%f, %f, %f, %f, %f);\n", x, y, z, width, height));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1078)(const GLfloat * coords);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1079)(const GLfloat * coords);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1078)(const GLfloat * coords)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1079)(const GLfloat * coords)
 {
     (void) coords;
    DISPATCH(DrawTexfvOES, (coords), (F, "glDrawTexfvOES(%p);\n", (const void *) coords));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1079)(GLint x, GLint y, GLint z, GLint width, GLint height);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1080)(GLint x, GLint y, GLint z, GLint width, GLint height);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1079)(GLint x, GLint y, GLint z, GLint width, GLint height)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1080)(GLint x, GLint y, GLint z, GLint width, GLint height)
 {
     (void) x; (void) y; (void) z; (void) width; (void) height;
    DISPATCH(DrawTexiOES, (x, y, z, width, height), (F, "glDrawTexiOES(%d, %d, %d, %d, %d);\n", x, y, z, width, height));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1080)(const GLint * coords);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1081)(const GLint * coords);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1080)(const GLint * coords)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1081)(const GLint * coords)
 {
     (void) coords;
    DISPATCH(DrawTexivOES, (coords), (F, "glDrawTexivOES(%p);\n", (const void *) coords));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1081)(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1082)(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1081)(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1082)(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)
 {
     (void) x; (void) y; (void) z; (void) width; (void) height;
    DISPATCH(DrawTexsOES, (x, y, z, width, height), (F, "glDrawTexsOES(%d, %d, %d, %d, %d);\n", x, y, z, width, height));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1082)(const GLshort * coords);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1083)(const GLshort * coords);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1082)(const GLshort * coords)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1083)(const GLshort * coords)
 {
     (void) coords;
    DISPATCH(DrawTexsvOES, (coords), (F, "glDrawTexsvOES(%p);\n", (const void *) coords));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1083)(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1084)(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1083)(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1084)(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)
 {
     (void) x; (void) y; (void) z; (void) width; (void) height;
    DISPATCH(DrawTexxOES, (x, y, z, width, height), (F, "glDrawTexxOES(%d, %d, %d, %d, %d);\n", x, y, z, width, height));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1084)(const GLfixed * coords);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1085)(const GLfixed * coords);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1084)(const GLfixed * coords)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1085)(const GLfixed * coords)
 {
     (void) coords;
    DISPATCH(DrawTexxvOES, (coords), (F, "glDrawTexxvOES(%p);\n", (const void *) coords));
@@ -9858,25 +9866,25 @@ KEYWORD1 void KEYWORD2 NAME(PointSizePointerOES)(GLenum type, GLsizei stride, co
    DISPATCH(PointSizePointerOES, (type, stride, pointer), (F, "glPointSizePointerOES(0x%x, %d, %p);\n", type, stride, (const void *) pointer));
 }
 
-KEYWORD1_ALT GLbitfield KEYWORD2 NAME(_dispatch_stub_1086)(GLfixed * mantissa, GLint * exponent);
+KEYWORD1_ALT GLbitfield KEYWORD2 NAME(_dispatch_stub_1087)(GLfixed * mantissa, GLint * exponent);
 
-KEYWORD1_ALT GLbitfield KEYWORD2 NAME(_dispatch_stub_1086)(GLfixed * mantissa, GLint * exponent)
+KEYWORD1_ALT GLbitfield KEYWORD2 NAME(_dispatch_stub_1087)(GLfixed * mantissa, GLint * exponent)
 {
     (void) mantissa; (void) exponent;
    RETURN_DISPATCH(QueryMatrixxOES, (mantissa, exponent), (F, "glQueryMatrixxOES(%p, %p);\n", (const void *) mantissa, (const void *) exponent));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1087)(GLclampf value, GLboolean invert);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1088)(GLclampf value, GLboolean invert);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1087)(GLclampf value, GLboolean invert)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1088)(GLclampf value, GLboolean invert)
 {
     (void) value; (void) invert;
    DISPATCH(SampleMaskSGIS, (value, invert), (F, "glSampleMaskSGIS(%f, %d);\n", value, invert));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1088)(GLenum pattern);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1089)(GLenum pattern);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1088)(GLenum pattern)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1089)(GLenum pattern)
 {
     (void) pattern;
    DISPATCH(SamplePatternSGIS, (pattern), (F, "glSamplePatternSGIS(0x%x);\n", pattern));
@@ -9918,9 +9926,9 @@ KEYWORD1 void KEYWORD2 NAME(VertexPointerEXT)(GLint size, GLenum type, GLsizei s
    DISPATCH(VertexPointerEXT, (size, type, stride, count, pointer), (F, "glVertexPointerEXT(%d, 0x%x, %d, %d, %p);\n", size, type, stride, count, (const void *) pointer));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1095)(GLenum target, GLsizei numAttachments, const GLenum * attachments);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1096)(GLenum target, GLsizei numAttachments, const GLenum * attachments);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1095)(GLenum target, GLsizei numAttachments, const GLenum * attachments)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1096)(GLenum target, GLsizei numAttachments, const GLenum * attachments)
 {
     (void) target; (void) numAttachments; (void) attachments;
    DISPATCH(DiscardFramebufferEXT, (target, numAttachments, attachments), (F, "glDiscardFramebufferEXT(0x%x, %d, %p);\n", target, numAttachments, (const void *) attachments));
@@ -9932,9 +9940,9 @@ KEYWORD1 void KEYWORD2 NAME(ActiveShaderProgram)(GLuint pipeline, GLuint program
    DISPATCH(ActiveShaderProgram, (pipeline, program), (F, "glActiveShaderProgram(%d, %d);\n", pipeline, program));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1096)(GLuint pipeline, GLuint program);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1097)(GLuint pipeline, GLuint program);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1096)(GLuint pipeline, GLuint program)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1097)(GLuint pipeline, GLuint program)
 {
     (void) pipeline; (void) program;
    DISPATCH(ActiveShaderProgram, (pipeline, program), (F, "glActiveShaderProgramEXT(%d, %d);\n", pipeline, program));
@@ -9946,9 +9954,9 @@ KEYWORD1 void KEYWORD2 NAME(BindProgramPipeline)(GLuint pipeline)
    DISPATCH(BindProgramPipeline, (pipeline), (F, "glBindProgramPipeline(%d);\n", pipeline));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1097)(GLuint pipeline);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1098)(GLuint pipeline);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1097)(GLuint pipeline)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1098)(GLuint pipeline)
 {
     (void) pipeline;
    DISPATCH(BindProgramPipeline, (pipeline), (F, "glBindProgramPipelineEXT(%d);\n", pipeline));
@@ -9960,9 +9968,9 @@ KEYWORD1 GLuint KEYWORD2 NAME(CreateShaderProgramv)(GLenum type, GLsizei count,
    RETURN_DISPATCH(CreateShaderProgramv, (type, count, strings), (F, "glCreateShaderProgramv(0x%x, %d, %p);\n", type, count, (const void *) strings));
 }
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1098)(GLenum type, GLsizei count, const GLchar * const * strings);
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1099)(GLenum type, GLsizei count, const GLchar * const * strings);
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1098)(GLenum type, GLsizei count, const GLchar * const * strings)
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1099)(GLenum type, GLsizei count, const GLchar * const * strings)
 {
     (void) type; (void) count; (void) strings;
    RETURN_DISPATCH(CreateShaderProgramv, (type, count, strings), (F, "glCreateShaderProgramvEXT(0x%x, %d, %p);\n", type, count, (const void *) strings));
@@ -9974,9 +9982,9 @@ KEYWORD1 void KEYWORD2 NAME(DeleteProgramPipelines)(GLsizei n, const GLuint * pi
    DISPATCH(DeleteProgramPipelines, (n, pipelines), (F, "glDeleteProgramPipelines(%d, %p);\n", n, (const void *) pipelines));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1099)(GLsizei n, const GLuint * pipelines);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1100)(GLsizei n, const GLuint * pipelines);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1099)(GLsizei n, const GLuint * pipelines)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1100)(GLsizei n, const GLuint * pipelines)
 {
     (void) n; (void) pipelines;
    DISPATCH(DeleteProgramPipelines, (n, pipelines), (F, "glDeleteProgramPipelinesEXT(%d, %p);\n", n, (const void *) pipelines));
@@ -9988,9 +9996,9 @@ KEYWORD1 void KEYWORD2 NAME(GenProgramPipelines)(GLsizei n, GLuint * pipelines)
    DISPATCH(GenProgramPipelines, (n, pipelines), (F, "glGenProgramPipelines(%d, %p);\n", n, (const void *) pipelines));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1100)(GLsizei n, GLuint * pipelines);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1101)(GLsizei n, GLuint * pipelines);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1100)(GLsizei n, GLuint * pipelines)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1101)(GLsizei n, GLuint * pipelines)
 {
     (void) n; (void) pipelines;
    DISPATCH(GenProgramPipelines, (n, pipelines), (F, "glGenProgramPipelinesEXT(%d, %p);\n", n, (const void *) pipelines));
@@ -10002,9 +10010,9 @@ KEYWORD1 void KEYWORD2 NAME(GetProgramPipelineInfoLog)(GLuint pipeline, GLsizei
    DISPATCH(GetProgramPipelineInfoLog, (pipeline, bufSize, length, infoLog), (F, "glGetProgramPipelineInfoLog(%d, %d, %p, %p);\n", pipeline, bufSize, (const void *) length, (const void *) infoLog));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1101)(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1102)(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1101)(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1102)(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
 {
     (void) pipeline; (void) bufSize; (void) length; (void) infoLog;
    DISPATCH(GetProgramPipelineInfoLog, (pipeline, bufSize, length, infoLog), (F, "glGetProgramPipelineInfoLogEXT(%d, %d, %p, %p);\n", pipeline, bufSize, (const void *) length, (const void *) infoLog));
@@ -10016,9 +10024,9 @@ KEYWORD1 void KEYWORD2 NAME(GetProgramPipelineiv)(GLuint pipeline, GLenum pname,
    DISPATCH(GetProgramPipelineiv, (pipeline, pname, params), (F, "glGetProgramPipelineiv(%d, 0x%x, %p);\n", pipeline, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1102)(GLuint pipeline, GLenum pname, GLint * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1103)(GLuint pipeline, GLenum pname, GLint * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1102)(GLuint pipeline, GLenum pname, GLint * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1103)(GLuint pipeline, GLenum pname, GLint * params)
 {
     (void) pipeline; (void) pname; (void) params;
    DISPATCH(GetProgramPipelineiv, (pipeline, pname, params), (F, "glGetProgramPipelineivEXT(%d, 0x%x, %p);\n", pipeline, pname, (const void *) params));
@@ -10030,9 +10038,9 @@ KEYWORD1 GLboolean KEYWORD2 NAME(IsProgramPipeline)(GLuint pipeline)
    RETURN_DISPATCH(IsProgramPipeline, (pipeline), (F, "glIsProgramPipeline(%d);\n", pipeline));
 }
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1103)(GLuint pipeline);
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1104)(GLuint pipeline);
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1103)(GLuint pipeline)
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1104)(GLuint pipeline)
 {
     (void) pipeline;
    RETURN_DISPATCH(IsProgramPipeline, (pipeline), (F, "glIsProgramPipelineEXT(%d);\n", pipeline));
@@ -10044,17 +10052,17 @@ KEYWORD1 void KEYWORD2 NAME(LockArraysEXT)(GLint first, GLsizei count)
    DISPATCH(LockArraysEXT, (first, count), (F, "glLockArraysEXT(%d, %d);\n", first, count));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1105)(GLuint program, GLint location, GLdouble x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1106)(GLuint program, GLint location, GLdouble x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1105)(GLuint program, GLint location, GLdouble x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1106)(GLuint program, GLint location, GLdouble x)
 {
     (void) program; (void) location; (void) x;
    DISPATCH(ProgramUniform1d, (program, location, x), (F, "glProgramUniform1d(%d, %d, %f);\n", program, location, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1106)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1107)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1106)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1107)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform1dv, (program, location, count, value), (F, "glProgramUniform1dv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10066,9 +10074,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform1f)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform1f, (program, location, x), (F, "glProgramUniform1f(%d, %d, %f);\n", program, location, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1107)(GLuint program, GLint location, GLfloat x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1108)(GLuint program, GLint location, GLfloat x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1107)(GLuint program, GLint location, GLfloat x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1108)(GLuint program, GLint location, GLfloat x)
 {
     (void) program; (void) location; (void) x;
    DISPATCH(ProgramUniform1f, (program, location, x), (F, "glProgramUniform1fEXT(%d, %d, %f);\n", program, location, x));
@@ -10080,9 +10088,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform1fv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform1fv, (program, location, count, value), (F, "glProgramUniform1fv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1108)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1109)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1108)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1109)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform1fv, (program, location, count, value), (F, "glProgramUniform1fvEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10094,9 +10102,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform1i)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform1i, (program, location, x), (F, "glProgramUniform1i(%d, %d, %d);\n", program, location, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1109)(GLuint program, GLint location, GLint x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1110)(GLuint program, GLint location, GLint x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1109)(GLuint program, GLint location, GLint x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1110)(GLuint program, GLint location, GLint x)
 {
     (void) program; (void) location; (void) x;
    DISPATCH(ProgramUniform1i, (program, location, x), (F, "glProgramUniform1iEXT(%d, %d, %d);\n", program, location, x));
@@ -10108,9 +10116,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform1iv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform1iv, (program, location, count, value), (F, "glProgramUniform1iv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1110)(GLuint program, GLint location, GLsizei count, const GLint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1111)(GLuint program, GLint location, GLsizei count, const GLint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1110)(GLuint program, GLint location, GLsizei count, const GLint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1111)(GLuint program, GLint location, GLsizei count, const GLint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform1iv, (program, location, count, value), (F, "glProgramUniform1ivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10122,9 +10130,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform1ui)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform1ui, (program, location, x), (F, "glProgramUniform1ui(%d, %d, %d);\n", program, location, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1111)(GLuint program, GLint location, GLuint x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1112)(GLuint program, GLint location, GLuint x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1111)(GLuint program, GLint location, GLuint x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1112)(GLuint program, GLint location, GLuint x)
 {
     (void) program; (void) location; (void) x;
    DISPATCH(ProgramUniform1ui, (program, location, x), (F, "glProgramUniform1uiEXT(%d, %d, %d);\n", program, location, x));
@@ -10136,25 +10144,25 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform1uiv)(GLuint program, GLint location,
    DISPATCH(ProgramUniform1uiv, (program, location, count, value), (F, "glProgramUniform1uiv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1112)(GLuint program, GLint location, GLsizei count, const GLuint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1113)(GLuint program, GLint location, GLsizei count, const GLuint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1112)(GLuint program, GLint location, GLsizei count, const GLuint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1113)(GLuint program, GLint location, GLsizei count, const GLuint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform1uiv, (program, location, count, value), (F, "glProgramUniform1uivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1113)(GLuint program, GLint location, GLdouble x, GLdouble y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1114)(GLuint program, GLint location, GLdouble x, GLdouble y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1113)(GLuint program, GLint location, GLdouble x, GLdouble y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1114)(GLuint program, GLint location, GLdouble x, GLdouble y)
 {
     (void) program; (void) location; (void) x; (void) y;
    DISPATCH(ProgramUniform2d, (program, location, x, y), (F, "glProgramUniform2d(%d, %d, %f, %f);\n", program, location, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1114)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1115)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1114)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1115)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform2dv, (program, location, count, value), (F, "glProgramUniform2dv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10166,9 +10174,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform2f)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform2f, (program, location, x, y), (F, "glProgramUniform2f(%d, %d, %f, %f);\n", program, location, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1115)(GLuint program, GLint location, GLfloat x, GLfloat y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1116)(GLuint program, GLint location, GLfloat x, GLfloat y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1115)(GLuint program, GLint location, GLfloat x, GLfloat y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1116)(GLuint program, GLint location, GLfloat x, GLfloat y)
 {
     (void) program; (void) location; (void) x; (void) y;
    DISPATCH(ProgramUniform2f, (program, location, x, y), (F, "glProgramUniform2fEXT(%d, %d, %f, %f);\n", program, location, x, y));
@@ -10180,9 +10188,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform2fv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform2fv, (program, location, count, value), (F, "glProgramUniform2fv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1116)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1117)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1116)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1117)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform2fv, (program, location, count, value), (F, "glProgramUniform2fvEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10194,9 +10202,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform2i)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform2i, (program, location, x, y), (F, "glProgramUniform2i(%d, %d, %d, %d);\n", program, location, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1117)(GLuint program, GLint location, GLint x, GLint y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1118)(GLuint program, GLint location, GLint x, GLint y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1117)(GLuint program, GLint location, GLint x, GLint y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1118)(GLuint program, GLint location, GLint x, GLint y)
 {
     (void) program; (void) location; (void) x; (void) y;
    DISPATCH(ProgramUniform2i, (program, location, x, y), (F, "glProgramUniform2iEXT(%d, %d, %d, %d);\n", program, location, x, y));
@@ -10208,9 +10216,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform2iv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform2iv, (program, location, count, value), (F, "glProgramUniform2iv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1118)(GLuint program, GLint location, GLsizei count, const GLint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1119)(GLuint program, GLint location, GLsizei count, const GLint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1118)(GLuint program, GLint location, GLsizei count, const GLint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1119)(GLuint program, GLint location, GLsizei count, const GLint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform2iv, (program, location, count, value), (F, "glProgramUniform2ivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10222,9 +10230,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform2ui)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform2ui, (program, location, x, y), (F, "glProgramUniform2ui(%d, %d, %d, %d);\n", program, location, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1119)(GLuint program, GLint location, GLuint x, GLuint y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1120)(GLuint program, GLint location, GLuint x, GLuint y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1119)(GLuint program, GLint location, GLuint x, GLuint y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1120)(GLuint program, GLint location, GLuint x, GLuint y)
 {
     (void) program; (void) location; (void) x; (void) y;
    DISPATCH(ProgramUniform2ui, (program, location, x, y), (F, "glProgramUniform2uiEXT(%d, %d, %d, %d);\n", program, location, x, y));
@@ -10236,25 +10244,25 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform2uiv)(GLuint program, GLint location,
    DISPATCH(ProgramUniform2uiv, (program, location, count, value), (F, "glProgramUniform2uiv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1120)(GLuint program, GLint location, GLsizei count, const GLuint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1121)(GLuint program, GLint location, GLsizei count, const GLuint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1120)(GLuint program, GLint location, GLsizei count, const GLuint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1121)(GLuint program, GLint location, GLsizei count, const GLuint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform2uiv, (program, location, count, value), (F, "glProgramUniform2uivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1121)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1122)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1121)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1122)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z;
    DISPATCH(ProgramUniform3d, (program, location, x, y, z), (F, "glProgramUniform3d(%d, %d, %f, %f, %f);\n", program, location, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1122)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1123)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1122)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1123)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform3dv, (program, location, count, value), (F, "glProgramUniform3dv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10266,9 +10274,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform3f)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform3f, (program, location, x, y, z), (F, "glProgramUniform3f(%d, %d, %f, %f, %f);\n", program, location, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1123)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1124)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1123)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1124)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z;
    DISPATCH(ProgramUniform3f, (program, location, x, y, z), (F, "glProgramUniform3fEXT(%d, %d, %f, %f, %f);\n", program, location, x, y, z));
@@ -10280,9 +10288,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform3fv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform3fv, (program, location, count, value), (F, "glProgramUniform3fv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1124)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1125)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1124)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1125)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform3fv, (program, location, count, value), (F, "glProgramUniform3fvEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10294,9 +10302,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform3i)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform3i, (program, location, x, y, z), (F, "glProgramUniform3i(%d, %d, %d, %d, %d);\n", program, location, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1125)(GLuint program, GLint location, GLint x, GLint y, GLint z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1126)(GLuint program, GLint location, GLint x, GLint y, GLint z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1125)(GLuint program, GLint location, GLint x, GLint y, GLint z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1126)(GLuint program, GLint location, GLint x, GLint y, GLint z)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z;
    DISPATCH(ProgramUniform3i, (program, location, x, y, z), (F, "glProgramUniform3iEXT(%d, %d, %d, %d, %d);\n", program, location, x, y, z));
@@ -10308,9 +10316,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform3iv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform3iv, (program, location, count, value), (F, "glProgramUniform3iv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1126)(GLuint program, GLint location, GLsizei count, const GLint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1127)(GLuint program, GLint location, GLsizei count, const GLint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1126)(GLuint program, GLint location, GLsizei count, const GLint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1127)(GLuint program, GLint location, GLsizei count, const GLint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform3iv, (program, location, count, value), (F, "glProgramUniform3ivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10322,9 +10330,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform3ui)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform3ui, (program, location, x, y, z), (F, "glProgramUniform3ui(%d, %d, %d, %d, %d);\n", program, location, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1127)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1128)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1127)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1128)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z;
    DISPATCH(ProgramUniform3ui, (program, location, x, y, z), (F, "glProgramUniform3uiEXT(%d, %d, %d, %d, %d);\n", program, location, x, y, z));
@@ -10336,25 +10344,25 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform3uiv)(GLuint program, GLint location,
    DISPATCH(ProgramUniform3uiv, (program, location, count, value), (F, "glProgramUniform3uiv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1128)(GLuint program, GLint location, GLsizei count, const GLuint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1129)(GLuint program, GLint location, GLsizei count, const GLuint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1128)(GLuint program, GLint location, GLsizei count, const GLuint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1129)(GLuint program, GLint location, GLsizei count, const GLuint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform3uiv, (program, location, count, value), (F, "glProgramUniform3uivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1129)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1130)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1129)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1130)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(ProgramUniform4d, (program, location, x, y, z, w), (F, "glProgramUniform4d(%d, %d, %f, %f, %f, %f);\n", program, location, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1130)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1131)(GLuint program, GLint location, GLsizei count, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1130)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1131)(GLuint program, GLint location, GLsizei count, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform4dv, (program, location, count, value), (F, "glProgramUniform4dv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10366,9 +10374,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform4f)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform4f, (program, location, x, y, z, w), (F, "glProgramUniform4f(%d, %d, %f, %f, %f, %f);\n", program, location, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1131)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1132)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1131)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1132)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(ProgramUniform4f, (program, location, x, y, z, w), (F, "glProgramUniform4fEXT(%d, %d, %f, %f, %f, %f);\n", program, location, x, y, z, w));
@@ -10380,9 +10388,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform4fv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform4fv, (program, location, count, value), (F, "glProgramUniform4fv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1132)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1133)(GLuint program, GLint location, GLsizei count, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1132)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1133)(GLuint program, GLint location, GLsizei count, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform4fv, (program, location, count, value), (F, "glProgramUniform4fvEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10394,9 +10402,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform4i)(GLuint program, GLint location, GL
    DISPATCH(ProgramUniform4i, (program, location, x, y, z, w), (F, "glProgramUniform4i(%d, %d, %d, %d, %d, %d);\n", program, location, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1133)(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1134)(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1133)(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1134)(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(ProgramUniform4i, (program, location, x, y, z, w), (F, "glProgramUniform4iEXT(%d, %d, %d, %d, %d, %d);\n", program, location, x, y, z, w));
@@ -10408,9 +10416,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform4iv)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform4iv, (program, location, count, value), (F, "glProgramUniform4iv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1134)(GLuint program, GLint location, GLsizei count, const GLint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1135)(GLuint program, GLint location, GLsizei count, const GLint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1134)(GLuint program, GLint location, GLsizei count, const GLint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1135)(GLuint program, GLint location, GLsizei count, const GLint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform4iv, (program, location, count, value), (F, "glProgramUniform4ivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
@@ -10422,9 +10430,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform4ui)(GLuint program, GLint location, G
    DISPATCH(ProgramUniform4ui, (program, location, x, y, z, w), (F, "glProgramUniform4ui(%d, %d, %d, %d, %d, %d);\n", program, location, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1135)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1136)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1135)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1136)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)
 {
     (void) program; (void) location; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(ProgramUniform4ui, (program, location, x, y, z, w), (F, "glProgramUniform4uiEXT(%d, %d, %d, %d, %d, %d);\n", program, location, x, y, z, w));
@@ -10436,17 +10444,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniform4uiv)(GLuint program, GLint location,
    DISPATCH(ProgramUniform4uiv, (program, location, count, value), (F, "glProgramUniform4uiv(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1136)(GLuint program, GLint location, GLsizei count, const GLuint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1137)(GLuint program, GLint location, GLsizei count, const GLuint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1136)(GLuint program, GLint location, GLsizei count, const GLuint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1137)(GLuint program, GLint location, GLsizei count, const GLuint * value)
 {
     (void) program; (void) location; (void) count; (void) value;
    DISPATCH(ProgramUniform4uiv, (program, location, count, value), (F, "glProgramUniform4uivEXT(%d, %d, %d, %p);\n", program, location, count, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1137)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1138)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1137)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1138)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix2dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10458,17 +10466,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix2fv)(GLuint program, GLint locat
    DISPATCH(ProgramUniformMatrix2fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1138)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1139)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1138)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1139)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix2fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1139)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1140)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1139)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1140)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix2x3dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2x3dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10480,17 +10488,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix2x3fv)(GLuint program, GLint loc
    DISPATCH(ProgramUniformMatrix2x3fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2x3fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1140)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1141)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1140)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1141)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix2x3fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2x3fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1141)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1142)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1141)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1142)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix2x4dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2x4dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10502,17 +10510,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix2x4fv)(GLuint program, GLint loc
    DISPATCH(ProgramUniformMatrix2x4fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2x4fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1142)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1143)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1142)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1143)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix2x4fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix2x4fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1143)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1144)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1143)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1144)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix3dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10524,17 +10532,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix3fv)(GLuint program, GLint locat
    DISPATCH(ProgramUniformMatrix3fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1144)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1145)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1144)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1145)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix3fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1145)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1146)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1145)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1146)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix3x2dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3x2dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10546,17 +10554,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix3x2fv)(GLuint program, GLint loc
    DISPATCH(ProgramUniformMatrix3x2fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3x2fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1146)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1147)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1146)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1147)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix3x2fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3x2fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1147)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1148)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1147)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1148)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix3x4dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3x4dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10568,17 +10576,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix3x4fv)(GLuint program, GLint loc
    DISPATCH(ProgramUniformMatrix3x4fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3x4fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1148)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1149)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1148)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1149)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix3x4fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix3x4fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1149)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1150)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1149)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1150)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix4dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10590,17 +10598,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix4fv)(GLuint program, GLint locat
    DISPATCH(ProgramUniformMatrix4fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1150)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1151)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1150)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1151)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix4fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1151)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1152)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1151)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1152)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix4x2dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4x2dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10612,17 +10620,17 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix4x2fv)(GLuint program, GLint loc
    DISPATCH(ProgramUniformMatrix4x2fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4x2fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1152)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1153)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1152)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1153)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix4x2fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4x2fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1153)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1154)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1153)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1154)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix4x3dv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4x3dv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10634,9 +10642,9 @@ KEYWORD1 void KEYWORD2 NAME(ProgramUniformMatrix4x3fv)(GLuint program, GLint loc
    DISPATCH(ProgramUniformMatrix4x3fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4x3fv(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1154)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1155)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1154)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1155)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
 {
     (void) program; (void) location; (void) count; (void) transpose; (void) value;
    DISPATCH(ProgramUniformMatrix4x3fv, (program, location, count, transpose, value), (F, "glProgramUniformMatrix4x3fvEXT(%d, %d, %d, %d, %p);\n", program, location, count, transpose, (const void *) value));
@@ -10653,9 +10661,9 @@ KEYWORD1 void KEYWORD2 NAME(UseProgramStages)(GLuint pipeline, GLbitfield stages
    DISPATCH(UseProgramStages, (pipeline, stages, program), (F, "glUseProgramStages(%d, %d, %d);\n", pipeline, stages, program));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1156)(GLuint pipeline, GLbitfield stages, GLuint program);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1157)(GLuint pipeline, GLbitfield stages, GLuint program);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1156)(GLuint pipeline, GLbitfield stages, GLuint program)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1157)(GLuint pipeline, GLbitfield stages, GLuint program)
 {
     (void) pipeline; (void) stages; (void) program;
    DISPATCH(UseProgramStages, (pipeline, stages, program), (F, "glUseProgramStagesEXT(%d, %d, %d);\n", pipeline, stages, program));
@@ -10667,9 +10675,9 @@ KEYWORD1 void KEYWORD2 NAME(ValidateProgramPipeline)(GLuint pipeline)
    DISPATCH(ValidateProgramPipeline, (pipeline), (F, "glValidateProgramPipeline(%d);\n", pipeline));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1157)(GLuint pipeline);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1158)(GLuint pipeline);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1157)(GLuint pipeline)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1158)(GLuint pipeline)
 {
     (void) pipeline;
    DISPATCH(ValidateProgramPipeline, (pipeline), (F, "glValidateProgramPipelineEXT(%d);\n", pipeline));
@@ -10687,9 +10695,9 @@ KEYWORD1 void KEYWORD2 NAME(DebugMessageCallback)(GLDEBUGPROC callback, const GL
    DISPATCH(DebugMessageCallback, (callback, userParam), (F, "glDebugMessageCallback(%p, %p);\n", (const void *) callback, (const void *) userParam));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1158)(GLDEBUGPROC callback, const GLvoid * userParam);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1159)(GLDEBUGPROC callback, const GLvoid * userParam);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1158)(GLDEBUGPROC callback, const GLvoid * userParam)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1159)(GLDEBUGPROC callback, const GLvoid * userParam)
 {
     (void) callback; (void) userParam;
    DISPATCH(DebugMessageCallback, (callback, userParam), (F, "glDebugMessageCallbackKHR(%p, %p);\n", (const void *) callback, (const void *) userParam));
@@ -10707,9 +10715,9 @@ KEYWORD1 void KEYWORD2 NAME(DebugMessageControl)(GLenum source, GLenum type, GLe
    DISPATCH(DebugMessageControl, (source, type, severity, count, ids, enabled), (F, "glDebugMessageControl(0x%x, 0x%x, 0x%x, %d, %p, %d);\n", source, type, severity, count, (const void *) ids, enabled));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1159)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1160)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1159)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1160)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
 {
     (void) source; (void) type; (void) severity; (void) count; (void) ids; (void) enabled;
    DISPATCH(DebugMessageControl, (source, type, severity, count, ids, enabled), (F, "glDebugMessageControlKHR(0x%x, 0x%x, 0x%x, %d, %p, %d);\n", source, type, severity, count, (const void *) ids, enabled));
@@ -10727,9 +10735,9 @@ KEYWORD1 void KEYWORD2 NAME(DebugMessageInsert)(GLenum source, GLenum type, GLui
    DISPATCH(DebugMessageInsert, (source, type, id, severity, length, buf), (F, "glDebugMessageInsert(0x%x, 0x%x, %d, 0x%x, %d, %p);\n", source, type, id, severity, length, (const void *) buf));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1160)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1161)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1160)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1161)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
 {
     (void) source; (void) type; (void) id; (void) severity; (void) length; (void) buf;
    DISPATCH(DebugMessageInsert, (source, type, id, severity, length, buf), (F, "glDebugMessageInsertKHR(0x%x, 0x%x, %d, 0x%x, %d, %p);\n", source, type, id, severity, length, (const void *) buf));
@@ -10747,9 +10755,9 @@ KEYWORD1 GLuint KEYWORD2 NAME(GetDebugMessageLog)(GLuint count, GLsizei bufsize,
    RETURN_DISPATCH(GetDebugMessageLog, (count, bufsize, sources, types, ids, severities, lengths, messageLog), (F, "glGetDebugMessageLog(%d, %d, %p, %p, %p, %p, %p, %p);\n", count, bufsize, (const void *) sources, (const void *) types, (const void *) ids, (const void *) severities, (const void *) lengths, (const void *) messageLog));
 }
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1161)(GLuint count, GLsizei bufsize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog);
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1162)(GLuint count, GLsizei bufsize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog);
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1161)(GLuint count, GLsizei bufsize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1162)(GLuint count, GLsizei bufsize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
 {
     (void) count; (void) bufsize; (void) sources; (void) types; (void) ids; (void) severities; (void) lengths; (void) messageLog;
    RETURN_DISPATCH(GetDebugMessageLog, (count, bufsize, sources, types, ids, severities, lengths, messageLog), (F, "glGetDebugMessageLogKHR(%d, %d, %p, %p, %p, %p, %p, %p);\n", count, bufsize, (const void *) sources, (const void *) types, (const void *) ids, (const void *) severities, (const void *) lengths, (const void *) messageLog));
@@ -10761,9 +10769,9 @@ KEYWORD1 void KEYWORD2 NAME(GetObjectLabel)(GLenum identifier, GLuint name, GLsi
    DISPATCH(GetObjectLabel, (identifier, name, bufSize, length, label), (F, "glGetObjectLabel(0x%x, %d, %d, %p, %p);\n", identifier, name, bufSize, (const void *) length, (const void *) label));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1162)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1163)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1162)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1163)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label)
 {
     (void) identifier; (void) name; (void) bufSize; (void) length; (void) label;
    DISPATCH(GetObjectLabel, (identifier, name, bufSize, length, label), (F, "glGetObjectLabelKHR(0x%x, %d, %d, %p, %p);\n", identifier, name, bufSize, (const void *) length, (const void *) label));
@@ -10775,9 +10783,9 @@ KEYWORD1 void KEYWORD2 NAME(GetObjectPtrLabel)(const GLvoid * ptr, GLsizei bufSi
    DISPATCH(GetObjectPtrLabel, (ptr, bufSize, length, label), (F, "glGetObjectPtrLabel(%p, %d, %p, %p);\n", (const void *) ptr, bufSize, (const void *) length, (const void *) label));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1163)(const GLvoid * ptr, GLsizei bufSize, GLsizei * length, GLchar * label);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1164)(const GLvoid * ptr, GLsizei bufSize, GLsizei * length, GLchar * label);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1163)(const GLvoid * ptr, GLsizei bufSize, GLsizei * length, GLchar * label)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1164)(const GLvoid * ptr, GLsizei bufSize, GLsizei * length, GLchar * label)
 {
     (void) ptr; (void) bufSize; (void) length; (void) label;
    DISPATCH(GetObjectPtrLabel, (ptr, bufSize, length, label), (F, "glGetObjectPtrLabelKHR(%p, %d, %p, %p);\n", (const void *) ptr, bufSize, (const void *) length, (const void *) label));
@@ -10789,9 +10797,9 @@ KEYWORD1 void KEYWORD2 NAME(ObjectLabel)(GLenum identifier, GLuint name, GLsizei
    DISPATCH(ObjectLabel, (identifier, name, length, label), (F, "glObjectLabel(0x%x, %d, %d, %p);\n", identifier, name, length, (const void *) label));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1164)(GLenum identifier, GLuint name, GLsizei length, const GLchar * label);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1165)(GLenum identifier, GLuint name, GLsizei length, const GLchar * label);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1164)(GLenum identifier, GLuint name, GLsizei length, const GLchar * label)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1165)(GLenum identifier, GLuint name, GLsizei length, const GLchar * label)
 {
     (void) identifier; (void) name; (void) length; (void) label;
    DISPATCH(ObjectLabel, (identifier, name, length, label), (F, "glObjectLabelKHR(0x%x, %d, %d, %p);\n", identifier, name, length, (const void *) label));
@@ -10803,9 +10811,9 @@ KEYWORD1 void KEYWORD2 NAME(ObjectPtrLabel)(const GLvoid * ptr, GLsizei length,
    DISPATCH(ObjectPtrLabel, (ptr, length, label), (F, "glObjectPtrLabel(%p, %d, %p);\n", (const void *) ptr, length, (const void *) label));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1165)(const GLvoid * ptr, GLsizei length, const GLchar * label);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1166)(const GLvoid * ptr, GLsizei length, const GLchar * label);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1165)(const GLvoid * ptr, GLsizei length, const GLchar * label)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1166)(const GLvoid * ptr, GLsizei length, const GLchar * label)
 {
     (void) ptr; (void) length; (void) label;
    DISPATCH(ObjectPtrLabel, (ptr, length, label), (F, "glObjectPtrLabelKHR(%p, %d, %p);\n", (const void *) ptr, length, (const void *) label));
@@ -10816,9 +10824,9 @@ KEYWORD1 void KEYWORD2 NAME(PopDebugGroup)(void)
    DISPATCH(PopDebugGroup, (), (F, "glPopDebugGroup();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1166)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1167)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1166)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1167)(void)
 {
    DISPATCH(PopDebugGroup, (), (F, "glPopDebugGroupKHR();\n"));
 }
@@ -10829,9 +10837,9 @@ KEYWORD1 void KEYWORD2 NAME(PushDebugGroup)(GLenum source, GLuint id, GLsizei le
    DISPATCH(PushDebugGroup, (source, id, length, message), (F, "glPushDebugGroup(0x%x, %d, %d, %p);\n", source, id, length, (const void *) message));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1167)(GLenum source, GLuint id, GLsizei length, const GLchar * message);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1168)(GLenum source, GLuint id, GLsizei length, const GLchar * message);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1167)(GLenum source, GLuint id, GLsizei length, const GLchar * message)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1168)(GLenum source, GLuint id, GLsizei length, const GLchar * message)
 {
     (void) source; (void) id; (void) length; (void) message;
    DISPATCH(PushDebugGroup, (source, id, length, message), (F, "glPushDebugGroupKHR(0x%x, %d, %d, %p);\n", source, id, length, (const void *) message));
@@ -10897,742 +10905,742 @@ KEYWORD1 void KEYWORD2 NAME(FogCoordfvEXT)(const GLfloat * coord)
    DISPATCH(FogCoordfvEXT, (coord), (F, "glFogCoordfvEXT(%p);\n", (const void *) coord));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1173)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1174)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1173)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1174)(void)
 {
    DISPATCH(ResizeBuffersMESA, (), (F, "glResizeBuffersMESA();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1174)(GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1175)(GLdouble x, GLdouble y, GLdouble z, GLdouble w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1174)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1175)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     (void) x; (void) y; (void) z; (void) w;
    DISPATCH(WindowPos4dMESA, (x, y, z, w), (F, "glWindowPos4dMESA(%f, %f, %f, %f);\n", x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1175)(const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1176)(const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1175)(const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1176)(const GLdouble * v)
 {
     (void) v;
    DISPATCH(WindowPos4dvMESA, (v), (F, "glWindowPos4dvMESA(%p);\n", (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1176)(GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1177)(GLfloat x, GLfloat y, GLfloat z, GLfloat w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1176)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1177)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     (void) x; (void) y; (void) z; (void) w;
    DISPATCH(WindowPos4fMESA, (x, y, z, w), (F, "glWindowPos4fMESA(%f, %f, %f, %f);\n", x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1177)(const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1178)(const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1177)(const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1178)(const GLfloat * v)
 {
     (void) v;
    DISPATCH(WindowPos4fvMESA, (v), (F, "glWindowPos4fvMESA(%p);\n", (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1178)(GLint x, GLint y, GLint z, GLint w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1179)(GLint x, GLint y, GLint z, GLint w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1178)(GLint x, GLint y, GLint z, GLint w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1179)(GLint x, GLint y, GLint z, GLint w)
 {
     (void) x; (void) y; (void) z; (void) w;
    DISPATCH(WindowPos4iMESA, (x, y, z, w), (F, "glWindowPos4iMESA(%d, %d, %d, %d);\n", x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1179)(const GLint * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1180)(const GLint * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1179)(const GLint * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1180)(const GLint * v)
 {
     (void) v;
    DISPATCH(WindowPos4ivMESA, (v), (F, "glWindowPos4ivMESA(%p);\n", (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1180)(GLshort x, GLshort y, GLshort z, GLshort w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1181)(GLshort x, GLshort y, GLshort z, GLshort w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1180)(GLshort x, GLshort y, GLshort z, GLshort w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1181)(GLshort x, GLshort y, GLshort z, GLshort w)
 {
     (void) x; (void) y; (void) z; (void) w;
    DISPATCH(WindowPos4sMESA, (x, y, z, w), (F, "glWindowPos4sMESA(%d, %d, %d, %d);\n", x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1181)(const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1182)(const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1181)(const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1182)(const GLshort * v)
 {
     (void) v;
    DISPATCH(WindowPos4svMESA, (v), (F, "glWindowPos4svMESA(%p);\n", (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1182)(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1183)(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1182)(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1183)(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)
 {
     (void) mode; (void) first; (void) count; (void) primcount; (void) modestride;
    DISPATCH(MultiModeDrawArraysIBM, (mode, first, count, primcount, modestride), (F, "glMultiModeDrawArraysIBM(%p, %p, %p, %d, %d);\n", (const void *) mode, (const void *) first, (const void *) count, primcount, modestride));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1183)(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1184)(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1183)(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1184)(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride)
 {
     (void) mode; (void) count; (void) type; (void) indices; (void) primcount; (void) modestride;
    DISPATCH(MultiModeDrawElementsIBM, (mode, count, type, indices, primcount, modestride), (F, "glMultiModeDrawElementsIBM(%p, %p, 0x%x, %p, %d, %d);\n", (const void *) mode, (const void *) count, type, (const void *) indices, primcount, modestride));
 }
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1184)(GLsizei n, const GLuint * ids, GLboolean * residences);
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1185)(GLsizei n, const GLuint * ids, GLboolean * residences);
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1184)(GLsizei n, const GLuint * ids, GLboolean * residences)
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1185)(GLsizei n, const GLuint * ids, GLboolean * residences)
 {
     (void) n; (void) ids; (void) residences;
    RETURN_DISPATCH(AreProgramsResidentNV, (n, ids, residences), (F, "glAreProgramsResidentNV(%d, %p, %p);\n", n, (const void *) ids, (const void *) residences));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1185)(GLenum target, GLuint id, const GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1186)(GLenum target, GLuint id, const GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1185)(GLenum target, GLuint id, const GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1186)(GLenum target, GLuint id, const GLfloat * params)
 {
     (void) target; (void) id; (void) params;
    DISPATCH(ExecuteProgramNV, (target, id, params), (F, "glExecuteProgramNV(0x%x, %d, %p);\n", target, id, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1186)(GLenum target, GLuint index, GLenum pname, GLdouble * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1187)(GLenum target, GLuint index, GLenum pname, GLdouble * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1186)(GLenum target, GLuint index, GLenum pname, GLdouble * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1187)(GLenum target, GLuint index, GLenum pname, GLdouble * params)
 {
     (void) target; (void) index; (void) pname; (void) params;
    DISPATCH(GetProgramParameterdvNV, (target, index, pname, params), (F, "glGetProgramParameterdvNV(0x%x, %d, 0x%x, %p);\n", target, index, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1187)(GLenum target, GLuint index, GLenum pname, GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1188)(GLenum target, GLuint index, GLenum pname, GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1187)(GLenum target, GLuint index, GLenum pname, GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1188)(GLenum target, GLuint index, GLenum pname, GLfloat * params)
 {
     (void) target; (void) index; (void) pname; (void) params;
    DISPATCH(GetProgramParameterfvNV, (target, index, pname, params), (F, "glGetProgramParameterfvNV(0x%x, %d, 0x%x, %p);\n", target, index, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1188)(GLuint id, GLenum pname, GLubyte * program);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1189)(GLuint id, GLenum pname, GLubyte * program);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1188)(GLuint id, GLenum pname, GLubyte * program)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1189)(GLuint id, GLenum pname, GLubyte * program)
 {
     (void) id; (void) pname; (void) program;
    DISPATCH(GetProgramStringNV, (id, pname, program), (F, "glGetProgramStringNV(%d, 0x%x, %p);\n", id, pname, (const void *) program));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1189)(GLuint id, GLenum pname, GLint * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1190)(GLuint id, GLenum pname, GLint * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1189)(GLuint id, GLenum pname, GLint * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1190)(GLuint id, GLenum pname, GLint * params)
 {
     (void) id; (void) pname; (void) params;
    DISPATCH(GetProgramivNV, (id, pname, params), (F, "glGetProgramivNV(%d, 0x%x, %p);\n", id, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1190)(GLenum target, GLuint address, GLenum pname, GLint * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1191)(GLenum target, GLuint address, GLenum pname, GLint * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1190)(GLenum target, GLuint address, GLenum pname, GLint * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1191)(GLenum target, GLuint address, GLenum pname, GLint * params)
 {
     (void) target; (void) address; (void) pname; (void) params;
    DISPATCH(GetTrackMatrixivNV, (target, address, pname, params), (F, "glGetTrackMatrixivNV(0x%x, %d, 0x%x, %p);\n", target, address, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1191)(GLuint index, GLenum pname, GLdouble * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1192)(GLuint index, GLenum pname, GLdouble * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1191)(GLuint index, GLenum pname, GLdouble * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1192)(GLuint index, GLenum pname, GLdouble * params)
 {
     (void) index; (void) pname; (void) params;
    DISPATCH(GetVertexAttribdvNV, (index, pname, params), (F, "glGetVertexAttribdvNV(%d, 0x%x, %p);\n", index, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1192)(GLuint index, GLenum pname, GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1193)(GLuint index, GLenum pname, GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1192)(GLuint index, GLenum pname, GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1193)(GLuint index, GLenum pname, GLfloat * params)
 {
     (void) index; (void) pname; (void) params;
    DISPATCH(GetVertexAttribfvNV, (index, pname, params), (F, "glGetVertexAttribfvNV(%d, 0x%x, %p);\n", index, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1193)(GLuint index, GLenum pname, GLint * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1194)(GLuint index, GLenum pname, GLint * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1193)(GLuint index, GLenum pname, GLint * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1194)(GLuint index, GLenum pname, GLint * params)
 {
     (void) index; (void) pname; (void) params;
    DISPATCH(GetVertexAttribivNV, (index, pname, params), (F, "glGetVertexAttribivNV(%d, 0x%x, %p);\n", index, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1194)(GLenum target, GLuint id, GLsizei len, const GLubyte * program);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1195)(GLenum target, GLuint id, GLsizei len, const GLubyte * program);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1194)(GLenum target, GLuint id, GLsizei len, const GLubyte * program)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1195)(GLenum target, GLuint id, GLsizei len, const GLubyte * program)
 {
     (void) target; (void) id; (void) len; (void) program;
    DISPATCH(LoadProgramNV, (target, id, len, program), (F, "glLoadProgramNV(0x%x, %d, %d, %p);\n", target, id, len, (const void *) program));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1195)(GLenum target, GLuint index, GLsizei num, const GLdouble * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1196)(GLenum target, GLuint index, GLsizei num, const GLdouble * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1195)(GLenum target, GLuint index, GLsizei num, const GLdouble * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1196)(GLenum target, GLuint index, GLsizei num, const GLdouble * params)
 {
     (void) target; (void) index; (void) num; (void) params;
    DISPATCH(ProgramParameters4dvNV, (target, index, num, params), (F, "glProgramParameters4dvNV(0x%x, %d, %d, %p);\n", target, index, num, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1196)(GLenum target, GLuint index, GLsizei num, const GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1197)(GLenum target, GLuint index, GLsizei num, const GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1196)(GLenum target, GLuint index, GLsizei num, const GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1197)(GLenum target, GLuint index, GLsizei num, const GLfloat * params)
 {
     (void) target; (void) index; (void) num; (void) params;
    DISPATCH(ProgramParameters4fvNV, (target, index, num, params), (F, "glProgramParameters4fvNV(0x%x, %d, %d, %p);\n", target, index, num, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1197)(GLsizei n, const GLuint * ids);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1198)(GLsizei n, const GLuint * ids);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1197)(GLsizei n, const GLuint * ids)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1198)(GLsizei n, const GLuint * ids)
 {
     (void) n; (void) ids;
    DISPATCH(RequestResidentProgramsNV, (n, ids), (F, "glRequestResidentProgramsNV(%d, %p);\n", n, (const void *) ids));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1198)(GLenum target, GLuint address, GLenum matrix, GLenum transform);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1199)(GLenum target, GLuint address, GLenum matrix, GLenum transform);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1198)(GLenum target, GLuint address, GLenum matrix, GLenum transform)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1199)(GLenum target, GLuint address, GLenum matrix, GLenum transform)
 {
     (void) target; (void) address; (void) matrix; (void) transform;
    DISPATCH(TrackMatrixNV, (target, address, matrix, transform), (F, "glTrackMatrixNV(0x%x, %d, 0x%x, 0x%x);\n", target, address, matrix, transform));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1199)(GLuint index, GLdouble x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1200)(GLuint index, GLdouble x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1199)(GLuint index, GLdouble x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1200)(GLuint index, GLdouble x)
 {
     (void) index; (void) x;
    DISPATCH(VertexAttrib1dNV, (index, x), (F, "glVertexAttrib1dNV(%d, %f);\n", index, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1200)(GLuint index, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1201)(GLuint index, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1200)(GLuint index, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1201)(GLuint index, const GLdouble * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib1dvNV, (index, v), (F, "glVertexAttrib1dvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1201)(GLuint index, GLfloat x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1202)(GLuint index, GLfloat x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1201)(GLuint index, GLfloat x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1202)(GLuint index, GLfloat x)
 {
     (void) index; (void) x;
    DISPATCH(VertexAttrib1fNV, (index, x), (F, "glVertexAttrib1fNV(%d, %f);\n", index, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1202)(GLuint index, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1203)(GLuint index, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1202)(GLuint index, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1203)(GLuint index, const GLfloat * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib1fvNV, (index, v), (F, "glVertexAttrib1fvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1203)(GLuint index, GLshort x);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1204)(GLuint index, GLshort x);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1203)(GLuint index, GLshort x)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1204)(GLuint index, GLshort x)
 {
     (void) index; (void) x;
    DISPATCH(VertexAttrib1sNV, (index, x), (F, "glVertexAttrib1sNV(%d, %d);\n", index, x));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1204)(GLuint index, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1205)(GLuint index, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1204)(GLuint index, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1205)(GLuint index, const GLshort * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib1svNV, (index, v), (F, "glVertexAttrib1svNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1205)(GLuint index, GLdouble x, GLdouble y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1206)(GLuint index, GLdouble x, GLdouble y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1205)(GLuint index, GLdouble x, GLdouble y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1206)(GLuint index, GLdouble x, GLdouble y)
 {
     (void) index; (void) x; (void) y;
    DISPATCH(VertexAttrib2dNV, (index, x, y), (F, "glVertexAttrib2dNV(%d, %f, %f);\n", index, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1206)(GLuint index, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1207)(GLuint index, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1206)(GLuint index, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1207)(GLuint index, const GLdouble * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib2dvNV, (index, v), (F, "glVertexAttrib2dvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1207)(GLuint index, GLfloat x, GLfloat y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1208)(GLuint index, GLfloat x, GLfloat y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1207)(GLuint index, GLfloat x, GLfloat y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1208)(GLuint index, GLfloat x, GLfloat y)
 {
     (void) index; (void) x; (void) y;
    DISPATCH(VertexAttrib2fNV, (index, x, y), (F, "glVertexAttrib2fNV(%d, %f, %f);\n", index, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1208)(GLuint index, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1209)(GLuint index, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1208)(GLuint index, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1209)(GLuint index, const GLfloat * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib2fvNV, (index, v), (F, "glVertexAttrib2fvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1209)(GLuint index, GLshort x, GLshort y);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1210)(GLuint index, GLshort x, GLshort y);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1209)(GLuint index, GLshort x, GLshort y)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1210)(GLuint index, GLshort x, GLshort y)
 {
     (void) index; (void) x; (void) y;
    DISPATCH(VertexAttrib2sNV, (index, x, y), (F, "glVertexAttrib2sNV(%d, %d, %d);\n", index, x, y));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1210)(GLuint index, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1211)(GLuint index, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1210)(GLuint index, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1211)(GLuint index, const GLshort * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib2svNV, (index, v), (F, "glVertexAttrib2svNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1211)(GLuint index, GLdouble x, GLdouble y, GLdouble z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1212)(GLuint index, GLdouble x, GLdouble y, GLdouble z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1211)(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1212)(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
     (void) index; (void) x; (void) y; (void) z;
    DISPATCH(VertexAttrib3dNV, (index, x, y, z), (F, "glVertexAttrib3dNV(%d, %f, %f, %f);\n", index, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1212)(GLuint index, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1213)(GLuint index, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1212)(GLuint index, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1213)(GLuint index, const GLdouble * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib3dvNV, (index, v), (F, "glVertexAttrib3dvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1213)(GLuint index, GLfloat x, GLfloat y, GLfloat z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1214)(GLuint index, GLfloat x, GLfloat y, GLfloat z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1213)(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1214)(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
     (void) index; (void) x; (void) y; (void) z;
    DISPATCH(VertexAttrib3fNV, (index, x, y, z), (F, "glVertexAttrib3fNV(%d, %f, %f, %f);\n", index, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1214)(GLuint index, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1215)(GLuint index, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1214)(GLuint index, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1215)(GLuint index, const GLfloat * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib3fvNV, (index, v), (F, "glVertexAttrib3fvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1215)(GLuint index, GLshort x, GLshort y, GLshort z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1216)(GLuint index, GLshort x, GLshort y, GLshort z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1215)(GLuint index, GLshort x, GLshort y, GLshort z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1216)(GLuint index, GLshort x, GLshort y, GLshort z)
 {
     (void) index; (void) x; (void) y; (void) z;
    DISPATCH(VertexAttrib3sNV, (index, x, y, z), (F, "glVertexAttrib3sNV(%d, %d, %d, %d);\n", index, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1216)(GLuint index, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1217)(GLuint index, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1216)(GLuint index, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1217)(GLuint index, const GLshort * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib3svNV, (index, v), (F, "glVertexAttrib3svNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1217)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1218)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1217)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1218)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     (void) index; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(VertexAttrib4dNV, (index, x, y, z, w), (F, "glVertexAttrib4dNV(%d, %f, %f, %f, %f);\n", index, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1218)(GLuint index, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1219)(GLuint index, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1218)(GLuint index, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1219)(GLuint index, const GLdouble * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib4dvNV, (index, v), (F, "glVertexAttrib4dvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1219)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1220)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1219)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1220)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     (void) index; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(VertexAttrib4fNV, (index, x, y, z, w), (F, "glVertexAttrib4fNV(%d, %f, %f, %f, %f);\n", index, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1220)(GLuint index, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1221)(GLuint index, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1220)(GLuint index, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1221)(GLuint index, const GLfloat * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib4fvNV, (index, v), (F, "glVertexAttrib4fvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1221)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1222)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1221)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1222)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
 {
     (void) index; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(VertexAttrib4sNV, (index, x, y, z, w), (F, "glVertexAttrib4sNV(%d, %d, %d, %d, %d);\n", index, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1222)(GLuint index, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1223)(GLuint index, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1222)(GLuint index, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1223)(GLuint index, const GLshort * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib4svNV, (index, v), (F, "glVertexAttrib4svNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1223)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1224)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1223)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1224)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
 {
     (void) index; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(VertexAttrib4ubNV, (index, x, y, z, w), (F, "glVertexAttrib4ubNV(%d, %d, %d, %d, %d);\n", index, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1224)(GLuint index, const GLubyte * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1225)(GLuint index, const GLubyte * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1224)(GLuint index, const GLubyte * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1225)(GLuint index, const GLubyte * v)
 {
     (void) index; (void) v;
    DISPATCH(VertexAttrib4ubvNV, (index, v), (F, "glVertexAttrib4ubvNV(%d, %p);\n", index, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1225)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1226)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1225)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1226)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
 {
     (void) index; (void) size; (void) type; (void) stride; (void) pointer;
    DISPATCH(VertexAttribPointerNV, (index, size, type, stride, pointer), (F, "glVertexAttribPointerNV(%d, %d, 0x%x, %d, %p);\n", index, size, type, stride, (const void *) pointer));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1226)(GLuint index, GLsizei n, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1227)(GLuint index, GLsizei n, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1226)(GLuint index, GLsizei n, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1227)(GLuint index, GLsizei n, const GLdouble * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs1dvNV, (index, n, v), (F, "glVertexAttribs1dvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1227)(GLuint index, GLsizei n, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1228)(GLuint index, GLsizei n, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1227)(GLuint index, GLsizei n, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1228)(GLuint index, GLsizei n, const GLfloat * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs1fvNV, (index, n, v), (F, "glVertexAttribs1fvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1228)(GLuint index, GLsizei n, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1229)(GLuint index, GLsizei n, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1228)(GLuint index, GLsizei n, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1229)(GLuint index, GLsizei n, const GLshort * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs1svNV, (index, n, v), (F, "glVertexAttribs1svNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1229)(GLuint index, GLsizei n, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1230)(GLuint index, GLsizei n, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1229)(GLuint index, GLsizei n, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1230)(GLuint index, GLsizei n, const GLdouble * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs2dvNV, (index, n, v), (F, "glVertexAttribs2dvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1230)(GLuint index, GLsizei n, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1231)(GLuint index, GLsizei n, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1230)(GLuint index, GLsizei n, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1231)(GLuint index, GLsizei n, const GLfloat * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs2fvNV, (index, n, v), (F, "glVertexAttribs2fvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1231)(GLuint index, GLsizei n, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1232)(GLuint index, GLsizei n, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1231)(GLuint index, GLsizei n, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1232)(GLuint index, GLsizei n, const GLshort * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs2svNV, (index, n, v), (F, "glVertexAttribs2svNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1232)(GLuint index, GLsizei n, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1233)(GLuint index, GLsizei n, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1232)(GLuint index, GLsizei n, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1233)(GLuint index, GLsizei n, const GLdouble * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs3dvNV, (index, n, v), (F, "glVertexAttribs3dvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1233)(GLuint index, GLsizei n, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1234)(GLuint index, GLsizei n, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1233)(GLuint index, GLsizei n, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1234)(GLuint index, GLsizei n, const GLfloat * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs3fvNV, (index, n, v), (F, "glVertexAttribs3fvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1234)(GLuint index, GLsizei n, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1235)(GLuint index, GLsizei n, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1234)(GLuint index, GLsizei n, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1235)(GLuint index, GLsizei n, const GLshort * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs3svNV, (index, n, v), (F, "glVertexAttribs3svNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1235)(GLuint index, GLsizei n, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1236)(GLuint index, GLsizei n, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1235)(GLuint index, GLsizei n, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1236)(GLuint index, GLsizei n, const GLdouble * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs4dvNV, (index, n, v), (F, "glVertexAttribs4dvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1236)(GLuint index, GLsizei n, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1237)(GLuint index, GLsizei n, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1236)(GLuint index, GLsizei n, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1237)(GLuint index, GLsizei n, const GLfloat * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs4fvNV, (index, n, v), (F, "glVertexAttribs4fvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1237)(GLuint index, GLsizei n, const GLshort * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1238)(GLuint index, GLsizei n, const GLshort * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1237)(GLuint index, GLsizei n, const GLshort * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1238)(GLuint index, GLsizei n, const GLshort * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs4svNV, (index, n, v), (F, "glVertexAttribs4svNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1238)(GLuint index, GLsizei n, const GLubyte * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1239)(GLuint index, GLsizei n, const GLubyte * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1238)(GLuint index, GLsizei n, const GLubyte * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1239)(GLuint index, GLsizei n, const GLubyte * v)
 {
     (void) index; (void) n; (void) v;
    DISPATCH(VertexAttribs4ubvNV, (index, n, v), (F, "glVertexAttribs4ubvNV(%d, %d, %p);\n", index, n, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1239)(GLenum pname, GLfloat * param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1240)(GLenum pname, GLfloat * param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1239)(GLenum pname, GLfloat * param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1240)(GLenum pname, GLfloat * param)
 {
     (void) pname; (void) param;
    DISPATCH(GetTexBumpParameterfvATI, (pname, param), (F, "glGetTexBumpParameterfvATI(0x%x, %p);\n", pname, (const void *) param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1240)(GLenum pname, GLint * param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1241)(GLenum pname, GLint * param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1240)(GLenum pname, GLint * param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1241)(GLenum pname, GLint * param)
 {
     (void) pname; (void) param;
    DISPATCH(GetTexBumpParameterivATI, (pname, param), (F, "glGetTexBumpParameterivATI(0x%x, %p);\n", pname, (const void *) param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1241)(GLenum pname, const GLfloat * param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1242)(GLenum pname, const GLfloat * param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1241)(GLenum pname, const GLfloat * param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1242)(GLenum pname, const GLfloat * param)
 {
     (void) pname; (void) param;
    DISPATCH(TexBumpParameterfvATI, (pname, param), (F, "glTexBumpParameterfvATI(0x%x, %p);\n", pname, (const void *) param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1242)(GLenum pname, const GLint * param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1243)(GLenum pname, const GLint * param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1242)(GLenum pname, const GLint * param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1243)(GLenum pname, const GLint * param)
 {
     (void) pname; (void) param;
    DISPATCH(TexBumpParameterivATI, (pname, param), (F, "glTexBumpParameterivATI(0x%x, %p);\n", pname, (const void *) param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1243)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1244)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1243)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1244)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
 {
     (void) op; (void) dst; (void) dstMod; (void) arg1; (void) arg1Rep; (void) arg1Mod;
    DISPATCH(AlphaFragmentOp1ATI, (op, dst, dstMod, arg1, arg1Rep, arg1Mod), (F, "glAlphaFragmentOp1ATI(0x%x, %d, %d, %d, %d, %d);\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1244)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1245)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1244)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1245)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
 {
     (void) op; (void) dst; (void) dstMod; (void) arg1; (void) arg1Rep; (void) arg1Mod; (void) arg2; (void) arg2Rep; (void) arg2Mod;
    DISPATCH(AlphaFragmentOp2ATI, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod), (F, "glAlphaFragmentOp2ATI(0x%x, %d, %d, %d, %d, %d, %d, %d, %d);\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1245)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1246)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1245)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1246)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
 {
     (void) op; (void) dst; (void) dstMod; (void) arg1; (void) arg1Rep; (void) arg1Mod; (void) arg2; (void) arg2Rep; (void) arg2Mod; (void) arg3; (void) arg3Rep; (void) arg3Mod;
    DISPATCH(AlphaFragmentOp3ATI, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod), (F, "glAlphaFragmentOp3ATI(0x%x, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d);\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1246)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1247)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1246)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1247)(void)
 {
    DISPATCH(BeginFragmentShaderATI, (), (F, "glBeginFragmentShaderATI();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1247)(GLuint id);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1248)(GLuint id);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1247)(GLuint id)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1248)(GLuint id)
 {
     (void) id;
    DISPATCH(BindFragmentShaderATI, (id), (F, "glBindFragmentShaderATI(%d);\n", id));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1248)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1249)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1248)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1249)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
 {
     (void) op; (void) dst; (void) dstMask; (void) dstMod; (void) arg1; (void) arg1Rep; (void) arg1Mod;
    DISPATCH(ColorFragmentOp1ATI, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod), (F, "glColorFragmentOp1ATI(0x%x, %d, %d, %d, %d, %d, %d);\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1249)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1250)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1249)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1250)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
 {
     (void) op; (void) dst; (void) dstMask; (void) dstMod; (void) arg1; (void) arg1Rep; (void) arg1Mod; (void) arg2; (void) arg2Rep; (void) arg2Mod;
    DISPATCH(ColorFragmentOp2ATI, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod), (F, "glColorFragmentOp2ATI(0x%x, %d, %d, %d, %d, %d, %d, %d, %d, %d);\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1250)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1251)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1250)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1251)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
 {
     (void) op; (void) dst; (void) dstMask; (void) dstMod; (void) arg1; (void) arg1Rep; (void) arg1Mod; (void) arg2; (void) arg2Rep; (void) arg2Mod; (void) arg3; (void) arg3Rep; (void) arg3Mod;
    DISPATCH(ColorFragmentOp3ATI, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod), (F, "glColorFragmentOp3ATI(0x%x, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d);\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1251)(GLuint id);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1252)(GLuint id);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1251)(GLuint id)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1252)(GLuint id)
 {
     (void) id;
    DISPATCH(DeleteFragmentShaderATI, (id), (F, "glDeleteFragmentShaderATI(%d);\n", id));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1252)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1253)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1252)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1253)(void)
 {
    DISPATCH(EndFragmentShaderATI, (), (F, "glEndFragmentShaderATI();\n"));
 }
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1253)(GLuint range);
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1254)(GLuint range);
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1253)(GLuint range)
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1254)(GLuint range)
 {
     (void) range;
    RETURN_DISPATCH(GenFragmentShadersATI, (range), (F, "glGenFragmentShadersATI(%d);\n", range));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1254)(GLuint dst, GLuint coord, GLenum swizzle);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1255)(GLuint dst, GLuint coord, GLenum swizzle);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1254)(GLuint dst, GLuint coord, GLenum swizzle)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1255)(GLuint dst, GLuint coord, GLenum swizzle)
 {
     (void) dst; (void) coord; (void) swizzle;
    DISPATCH(PassTexCoordATI, (dst, coord, swizzle), (F, "glPassTexCoordATI(%d, %d, 0x%x);\n", dst, coord, swizzle));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1255)(GLuint dst, GLuint interp, GLenum swizzle);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1256)(GLuint dst, GLuint interp, GLenum swizzle);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1255)(GLuint dst, GLuint interp, GLenum swizzle)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1256)(GLuint dst, GLuint interp, GLenum swizzle)
 {
     (void) dst; (void) interp; (void) swizzle;
    DISPATCH(SampleMapATI, (dst, interp, swizzle), (F, "glSampleMapATI(%d, %d, 0x%x);\n", dst, interp, swizzle));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1256)(GLuint dst, const GLfloat * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1257)(GLuint dst, const GLfloat * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1256)(GLuint dst, const GLfloat * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1257)(GLuint dst, const GLfloat * value)
 {
     (void) dst; (void) value;
    DISPATCH(SetFragmentShaderConstantATI, (dst, value), (F, "glSetFragmentShaderConstantATI(%d, %p);\n", dst, (const void *) value));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1257)(GLuint first, GLsizei count, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1258)(GLuint first, GLsizei count, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1257)(GLuint first, GLsizei count, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1258)(GLuint first, GLsizei count, const GLfloat * v)
 {
     (void) first; (void) count; (void) v;
    DISPATCH(DepthRangeArrayfvOES, (first, count, v), (F, "glDepthRangeArrayfvOES(%d, %d, %p);\n", first, count, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1258)(GLuint index, GLfloat n, GLfloat f);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1259)(GLuint index, GLfloat n, GLfloat f);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1258)(GLuint index, GLfloat n, GLfloat f)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1259)(GLuint index, GLfloat n, GLfloat f)
 {
     (void) index; (void) n; (void) f;
    DISPATCH(DepthRangeIndexedfOES, (index, n, f), (F, "glDepthRangeIndexedfOES(%d, %f, %f);\n", index, n, f));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1259)(GLenum face);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1260)(GLenum face);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1259)(GLenum face)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1260)(GLenum face)
 {
     (void) face;
    DISPATCH(ActiveStencilFaceEXT, (face), (F, "glActiveStencilFaceEXT(0x%x);\n", face));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1260)(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1261)(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1260)(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1261)(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)
 {
     (void) id; (void) len; (void) name; (void) params;
    DISPATCH(GetProgramNamedParameterdvNV, (id, len, name, params), (F, "glGetProgramNamedParameterdvNV(%d, %d, %p, %p);\n", id, len, (const void *) name, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1261)(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1262)(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1261)(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1262)(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)
 {
     (void) id; (void) len; (void) name; (void) params;
    DISPATCH(GetProgramNamedParameterfvNV, (id, len, name, params), (F, "glGetProgramNamedParameterfvNV(%d, %d, %p, %p);\n", id, len, (const void *) name, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1262)(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1263)(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1262)(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1263)(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
     (void) id; (void) len; (void) name; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(ProgramNamedParameter4dNV, (id, len, name, x, y, z, w), (F, "glProgramNamedParameter4dNV(%d, %d, %p, %f, %f, %f, %f);\n", id, len, (const void *) name, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1263)(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1264)(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1263)(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1264)(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)
 {
     (void) id; (void) len; (void) name; (void) v;
    DISPATCH(ProgramNamedParameter4dvNV, (id, len, name, v), (F, "glProgramNamedParameter4dvNV(%d, %d, %p, %p);\n", id, len, (const void *) name, (const void *) v));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1264)(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1265)(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1264)(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1265)(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     (void) id; (void) len; (void) name; (void) x; (void) y; (void) z; (void) w;
    DISPATCH(ProgramNamedParameter4fNV, (id, len, name, x, y, z, w), (F, "glProgramNamedParameter4fNV(%d, %d, %p, %f, %f, %f, %f);\n", id, len, (const void *) name, x, y, z, w));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1265)(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1266)(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1265)(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1266)(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)
 {
     (void) id; (void) len; (void) name; (void) v;
    DISPATCH(ProgramNamedParameter4fvNV, (id, len, name, v), (F, "glProgramNamedParameter4fvNV(%d, %d, %p, %p);\n", id, len, (const void *) name, (const void *) v));
@@ -11643,33 +11651,33 @@ KEYWORD1 void KEYWORD2 NAME(PrimitiveRestartNV)(void)
    DISPATCH(PrimitiveRestartNV, (), (F, "glPrimitiveRestartNV();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1267)(GLenum coord, GLenum pname, GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1268)(GLenum coord, GLenum pname, GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1267)(GLenum coord, GLenum pname, GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1268)(GLenum coord, GLenum pname, GLfixed * params)
 {
     (void) coord; (void) pname; (void) params;
    DISPATCH(GetTexGenxvOES, (coord, pname, params), (F, "glGetTexGenxvOES(0x%x, 0x%x, %p);\n", coord, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1268)(GLenum coord, GLenum pname, GLint param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1269)(GLenum coord, GLenum pname, GLint param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1268)(GLenum coord, GLenum pname, GLint param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1269)(GLenum coord, GLenum pname, GLint param)
 {
     (void) coord; (void) pname; (void) param;
    DISPATCH(TexGenxOES, (coord, pname, param), (F, "glTexGenxOES(0x%x, 0x%x, %d);\n", coord, pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1269)(GLenum coord, GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1270)(GLenum coord, GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1269)(GLenum coord, GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1270)(GLenum coord, GLenum pname, const GLfixed * params)
 {
     (void) coord; (void) pname; (void) params;
    DISPATCH(TexGenxvOES, (coord, pname, params), (F, "glTexGenxvOES(0x%x, 0x%x, %p);\n", coord, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1270)(GLclampd zmin, GLclampd zmax);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1271)(GLclampd zmin, GLclampd zmax);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1270)(GLclampd zmin, GLclampd zmax)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1271)(GLclampd zmin, GLclampd zmax)
 {
     (void) zmin; (void) zmax;
    DISPATCH(DepthBoundsEXT, (zmin, zmax), (F, "glDepthBoundsEXT(%f, %f);\n", zmin, zmax));
@@ -11687,25 +11695,25 @@ KEYWORD1 void KEYWORD2 NAME(BindRenderbufferEXT)(GLenum target, GLuint renderbuf
    DISPATCH(BindRenderbufferEXT, (target, renderbuffer), (F, "glBindRenderbufferEXT(0x%x, %d);\n", target, renderbuffer));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1273)(GLsizei len, const GLvoid * string);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1274)(GLsizei len, const GLvoid * string);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1273)(GLsizei len, const GLvoid * string)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1274)(GLsizei len, const GLvoid * string)
 {
     (void) len; (void) string;
    DISPATCH(StringMarkerGREMEDY, (len, string), (F, "glStringMarkerGREMEDY(%d, %p);\n", len, (const void *) string));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1274)(GLenum target, GLenum pname, GLint param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1275)(GLenum target, GLenum pname, GLint param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1274)(GLenum target, GLenum pname, GLint param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1275)(GLenum target, GLenum pname, GLint param)
 {
     (void) target; (void) pname; (void) param;
    DISPATCH(BufferParameteriAPPLE, (target, pname, param), (F, "glBufferParameteriAPPLE(0x%x, 0x%x, %d);\n", target, pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1275)(GLenum target, GLintptr offset, GLsizeiptr size);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1276)(GLenum target, GLintptr offset, GLsizeiptr size);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1275)(GLenum target, GLintptr offset, GLsizeiptr size)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1276)(GLenum target, GLintptr offset, GLsizeiptr size)
 {
     (void) target; (void) offset; (void) size;
    DISPATCH(FlushMappedBufferRangeAPPLE, (target, offset, size), (F, "glFlushMappedBufferRangeAPPLE(0x%x, %d, %d);\n", target, offset, size));
@@ -11891,145 +11899,145 @@ KEYWORD1 void KEYWORD2 NAME(ClearColorIuiEXT)(GLuint r, GLuint g, GLuint b, GLui
    DISPATCH(ClearColorIuiEXT, (r, g, b, a), (F, "glClearColorIuiEXT(%d, %d, %d, %d);\n", r, g, b, a));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1292)(GLenum target, GLuint index, GLuint buffer, GLintptr offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1293)(GLenum target, GLuint index, GLuint buffer, GLintptr offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1292)(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1293)(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
 {
     (void) target; (void) index; (void) buffer; (void) offset;
    DISPATCH(BindBufferOffsetEXT, (target, index, buffer, offset), (F, "glBindBufferOffsetEXT(0x%x, %d, %d, %d);\n", target, index, buffer, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1293)(GLuint monitor);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1294)(GLuint monitor);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1293)(GLuint monitor)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1294)(GLuint monitor)
 {
     (void) monitor;
    DISPATCH(BeginPerfMonitorAMD, (monitor), (F, "glBeginPerfMonitorAMD(%d);\n", monitor));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1294)(GLsizei n, GLuint * monitors);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1295)(GLsizei n, GLuint * monitors);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1294)(GLsizei n, GLuint * monitors)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1295)(GLsizei n, GLuint * monitors)
 {
     (void) n; (void) monitors;
    DISPATCH(DeletePerfMonitorsAMD, (n, monitors), (F, "glDeletePerfMonitorsAMD(%d, %p);\n", n, (const void *) monitors));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1295)(GLuint monitor);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1296)(GLuint monitor);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1295)(GLuint monitor)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1296)(GLuint monitor)
 {
     (void) monitor;
    DISPATCH(EndPerfMonitorAMD, (monitor), (F, "glEndPerfMonitorAMD(%d);\n", monitor));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1296)(GLsizei n, GLuint * monitors);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1297)(GLsizei n, GLuint * monitors);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1296)(GLsizei n, GLuint * monitors)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1297)(GLsizei n, GLuint * monitors)
 {
     (void) n; (void) monitors;
    DISPATCH(GenPerfMonitorsAMD, (n, monitors), (F, "glGenPerfMonitorsAMD(%d, %p);\n", n, (const void *) monitors));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1297)(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint * data, GLint * bytesWritten);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1298)(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint * data, GLint * bytesWritten);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1297)(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint * data, GLint * bytesWritten)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1298)(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint * data, GLint * bytesWritten)
 {
     (void) monitor; (void) pname; (void) dataSize; (void) data; (void) bytesWritten;
    DISPATCH(GetPerfMonitorCounterDataAMD, (monitor, pname, dataSize, data, bytesWritten), (F, "glGetPerfMonitorCounterDataAMD(%d, 0x%x, %d, %p, %p);\n", monitor, pname, dataSize, (const void *) data, (const void *) bytesWritten));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1298)(GLuint group, GLuint counter, GLenum pname, GLvoid * data);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1299)(GLuint group, GLuint counter, GLenum pname, GLvoid * data);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1298)(GLuint group, GLuint counter, GLenum pname, GLvoid * data)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1299)(GLuint group, GLuint counter, GLenum pname, GLvoid * data)
 {
     (void) group; (void) counter; (void) pname; (void) data;
    DISPATCH(GetPerfMonitorCounterInfoAMD, (group, counter, pname, data), (F, "glGetPerfMonitorCounterInfoAMD(%d, %d, 0x%x, %p);\n", group, counter, pname, (const void *) data));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1299)(GLuint group, GLuint counter, GLsizei bufSize, GLsizei * length, GLchar * counterString);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1300)(GLuint group, GLuint counter, GLsizei bufSize, GLsizei * length, GLchar * counterString);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1299)(GLuint group, GLuint counter, GLsizei bufSize, GLsizei * length, GLchar * counterString)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1300)(GLuint group, GLuint counter, GLsizei bufSize, GLsizei * length, GLchar * counterString)
 {
     (void) group; (void) counter; (void) bufSize; (void) length; (void) counterString;
    DISPATCH(GetPerfMonitorCounterStringAMD, (group, counter, bufSize, length, counterString), (F, "glGetPerfMonitorCounterStringAMD(%d, %d, %d, %p, %p);\n", group, counter, bufSize, (const void *) length, (const void *) counterString));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1300)(GLuint group, GLint * numCounters, GLint * maxActiveCounters, GLsizei countersSize, GLuint * counters);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1301)(GLuint group, GLint * numCounters, GLint * maxActiveCounters, GLsizei countersSize, GLuint * counters);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1300)(GLuint group, GLint * numCounters, GLint * maxActiveCounters, GLsizei countersSize, GLuint * counters)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1301)(GLuint group, GLint * numCounters, GLint * maxActiveCounters, GLsizei countersSize, GLuint * counters)
 {
     (void) group; (void) numCounters; (void) maxActiveCounters; (void) countersSize; (void) counters;
    DISPATCH(GetPerfMonitorCountersAMD, (group, numCounters, maxActiveCounters, countersSize, counters), (F, "glGetPerfMonitorCountersAMD(%d, %p, %p, %d, %p);\n", group, (const void *) numCounters, (const void *) maxActiveCounters, countersSize, (const void *) counters));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1301)(GLuint group, GLsizei bufSize, GLsizei * length, GLchar * groupString);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1302)(GLuint group, GLsizei bufSize, GLsizei * length, GLchar * groupString);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1301)(GLuint group, GLsizei bufSize, GLsizei * length, GLchar * groupString)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1302)(GLuint group, GLsizei bufSize, GLsizei * length, GLchar * groupString)
 {
     (void) group; (void) bufSize; (void) length; (void) groupString;
    DISPATCH(GetPerfMonitorGroupStringAMD, (group, bufSize, length, groupString), (F, "glGetPerfMonitorGroupStringAMD(%d, %d, %p, %p);\n", group, bufSize, (const void *) length, (const void *) groupString));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1302)(GLint * numGroups, GLsizei groupsSize, GLuint * groups);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1303)(GLint * numGroups, GLsizei groupsSize, GLuint * groups);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1302)(GLint * numGroups, GLsizei groupsSize, GLuint * groups)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1303)(GLint * numGroups, GLsizei groupsSize, GLuint * groups)
 {
     (void) numGroups; (void) groupsSize; (void) groups;
    DISPATCH(GetPerfMonitorGroupsAMD, (numGroups, groupsSize, groups), (F, "glGetPerfMonitorGroupsAMD(%p, %d, %p);\n", (const void *) numGroups, groupsSize, (const void *) groups));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1303)(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint * counterList);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1304)(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint * counterList);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1303)(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint * counterList)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1304)(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint * counterList)
 {
     (void) monitor; (void) enable; (void) group; (void) numCounters; (void) counterList;
    DISPATCH(SelectPerfMonitorCountersAMD, (monitor, enable, group, numCounters, counterList), (F, "glSelectPerfMonitorCountersAMD(%d, %d, %d, %d, %p);\n", monitor, enable, group, numCounters, (const void *) counterList));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1304)(GLenum objectType, GLuint name, GLenum pname, GLint * value);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1305)(GLenum objectType, GLuint name, GLenum pname, GLint * value);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1304)(GLenum objectType, GLuint name, GLenum pname, GLint * value)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1305)(GLenum objectType, GLuint name, GLenum pname, GLint * value)
 {
     (void) objectType; (void) name; (void) pname; (void) value;
    DISPATCH(GetObjectParameterivAPPLE, (objectType, name, pname, value), (F, "glGetObjectParameterivAPPLE(0x%x, %d, 0x%x, %p);\n", objectType, name, pname, (const void *) value));
 }
 
-KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1305)(GLenum objectType, GLuint name, GLenum option);
+KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1306)(GLenum objectType, GLuint name, GLenum option);
 
-KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1305)(GLenum objectType, GLuint name, GLenum option)
+KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1306)(GLenum objectType, GLuint name, GLenum option)
 {
     (void) objectType; (void) name; (void) option;
    RETURN_DISPATCH(ObjectPurgeableAPPLE, (objectType, name, option), (F, "glObjectPurgeableAPPLE(0x%x, %d, 0x%x);\n", objectType, name, option));
 }
 
-KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1306)(GLenum objectType, GLuint name, GLenum option);
+KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1307)(GLenum objectType, GLuint name, GLenum option);
 
-KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1306)(GLenum objectType, GLuint name, GLenum option)
+KEYWORD1_ALT GLenum KEYWORD2 NAME(_dispatch_stub_1307)(GLenum objectType, GLuint name, GLenum option)
 {
     (void) objectType; (void) name; (void) option;
    RETURN_DISPATCH(ObjectUnpurgeableAPPLE, (objectType, name, option), (F, "glObjectUnpurgeableAPPLE(0x%x, %d, 0x%x);\n", objectType, name, option));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1307)(GLuint program);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1308)(GLuint program);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1307)(GLuint program)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1308)(GLuint program)
 {
     (void) program;
    DISPATCH(ActiveProgramEXT, (program), (F, "glActiveProgramEXT(%d);\n", program));
 }
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1308)(GLenum type, const GLchar * string);
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1309)(GLenum type, const GLchar * string);
 
-KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1308)(GLenum type, const GLchar * string)
+KEYWORD1_ALT GLuint KEYWORD2 NAME(_dispatch_stub_1309)(GLenum type, const GLchar * string)
 {
     (void) type; (void) string;
    RETURN_DISPATCH(CreateShaderProgramEXT, (type, string), (F, "glCreateShaderProgramEXT(0x%x, %p);\n", type, (const void *) string));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1309)(GLenum type, GLuint program);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1310)(GLenum type, GLuint program);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1309)(GLenum type, GLuint program)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1310)(GLenum type, GLuint program)
 {
     (void) type; (void) program;
    DISPATCH(UseShaderProgramEXT, (type, program), (F, "glUseShaderProgramEXT(0x%x, %d);\n", type, program));
@@ -12040,447 +12048,447 @@ KEYWORD1 void KEYWORD2 NAME(TextureBarrierNV)(void)
    DISPATCH(TextureBarrierNV, (), (F, "glTextureBarrierNV();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1310)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1311)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1310)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1311)(void)
 {
    DISPATCH(TextureBarrierNV, (), (F, "glTextureBarrier();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1311)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1312)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1311)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1312)(void)
 {
    DISPATCH(VDPAUFiniNV, (), (F, "glVDPAUFiniNV();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1312)(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1313)(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1312)(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1313)(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values)
 {
     (void) surface; (void) pname; (void) bufSize; (void) length; (void) values;
    DISPATCH(VDPAUGetSurfaceivNV, (surface, pname, bufSize, length, values), (F, "glVDPAUGetSurfaceivNV(%d, 0x%x, %d, %p, %p);\n", surface, pname, bufSize, (const void *) length, (const void *) values));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1313)(const GLvoid * vdpDevice, const GLvoid * getProcAddress);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1314)(const GLvoid * vdpDevice, const GLvoid * getProcAddress);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1313)(const GLvoid * vdpDevice, const GLvoid * getProcAddress)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1314)(const GLvoid * vdpDevice, const GLvoid * getProcAddress)
 {
     (void) vdpDevice; (void) getProcAddress;
    DISPATCH(VDPAUInitNV, (vdpDevice, getProcAddress), (F, "glVDPAUInitNV(%p, %p);\n", (const void *) vdpDevice, (const void *) getProcAddress));
 }
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1314)(GLintptr surface);
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1315)(GLintptr surface);
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1314)(GLintptr surface)
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1315)(GLintptr surface)
 {
     (void) surface;
    RETURN_DISPATCH(VDPAUIsSurfaceNV, (surface), (F, "glVDPAUIsSurfaceNV(%d);\n", surface));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1315)(GLsizei numSurfaces, const GLintptr * surfaces);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1316)(GLsizei numSurfaces, const GLintptr * surfaces);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1315)(GLsizei numSurfaces, const GLintptr * surfaces)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1316)(GLsizei numSurfaces, const GLintptr * surfaces)
 {
     (void) numSurfaces; (void) surfaces;
    DISPATCH(VDPAUMapSurfacesNV, (numSurfaces, surfaces), (F, "glVDPAUMapSurfacesNV(%d, %p);\n", numSurfaces, (const void *) surfaces));
 }
 
-KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1316)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames);
+KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1317)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames);
 
-KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1316)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
+KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1317)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
 {
     (void) vdpSurface; (void) target; (void) numTextureNames; (void) textureNames;
    RETURN_DISPATCH(VDPAURegisterOutputSurfaceNV, (vdpSurface, target, numTextureNames, textureNames), (F, "glVDPAURegisterOutputSurfaceNV(%p, 0x%x, %d, %p);\n", (const void *) vdpSurface, target, numTextureNames, (const void *) textureNames));
 }
 
-KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1317)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames);
+KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1318)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames);
 
-KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1317)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
+KEYWORD1_ALT GLintptr KEYWORD2 NAME(_dispatch_stub_1318)(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
 {
     (void) vdpSurface; (void) target; (void) numTextureNames; (void) textureNames;
    RETURN_DISPATCH(VDPAURegisterVideoSurfaceNV, (vdpSurface, target, numTextureNames, textureNames), (F, "glVDPAURegisterVideoSurfaceNV(%p, 0x%x, %d, %p);\n", (const void *) vdpSurface, target, numTextureNames, (const void *) textureNames));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1318)(GLintptr surface, GLenum access);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1319)(GLintptr surface, GLenum access);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1318)(GLintptr surface, GLenum access)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1319)(GLintptr surface, GLenum access)
 {
     (void) surface; (void) access;
    DISPATCH(VDPAUSurfaceAccessNV, (surface, access), (F, "glVDPAUSurfaceAccessNV(%d, 0x%x);\n", surface, access));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1319)(GLsizei numSurfaces, const GLintptr * surfaces);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1320)(GLsizei numSurfaces, const GLintptr * surfaces);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1319)(GLsizei numSurfaces, const GLintptr * surfaces)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1320)(GLsizei numSurfaces, const GLintptr * surfaces)
 {
     (void) numSurfaces; (void) surfaces;
    DISPATCH(VDPAUUnmapSurfacesNV, (numSurfaces, surfaces), (F, "glVDPAUUnmapSurfacesNV(%d, %p);\n", numSurfaces, (const void *) surfaces));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1320)(GLintptr surface);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1321)(GLintptr surface);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1320)(GLintptr surface)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1321)(GLintptr surface)
 {
     (void) surface;
    DISPATCH(VDPAUUnregisterSurfaceNV, (surface), (F, "glVDPAUUnregisterSurfaceNV(%d);\n", surface));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1321)(GLuint queryHandle);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1322)(GLuint queryHandle);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1321)(GLuint queryHandle)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1322)(GLuint queryHandle)
 {
     (void) queryHandle;
    DISPATCH(BeginPerfQueryINTEL, (queryHandle), (F, "glBeginPerfQueryINTEL(%d);\n", queryHandle));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1322)(GLuint queryId, GLuint * queryHandle);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1323)(GLuint queryId, GLuint * queryHandle);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1322)(GLuint queryId, GLuint * queryHandle)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1323)(GLuint queryId, GLuint * queryHandle)
 {
     (void) queryId; (void) queryHandle;
    DISPATCH(CreatePerfQueryINTEL, (queryId, queryHandle), (F, "glCreatePerfQueryINTEL(%d, %p);\n", queryId, (const void *) queryHandle));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1323)(GLuint queryHandle);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1324)(GLuint queryHandle);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1323)(GLuint queryHandle)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1324)(GLuint queryHandle)
 {
     (void) queryHandle;
    DISPATCH(DeletePerfQueryINTEL, (queryHandle), (F, "glDeletePerfQueryINTEL(%d);\n", queryHandle));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1324)(GLuint queryHandle);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1325)(GLuint queryHandle);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1324)(GLuint queryHandle)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1325)(GLuint queryHandle)
 {
     (void) queryHandle;
    DISPATCH(EndPerfQueryINTEL, (queryHandle), (F, "glEndPerfQueryINTEL(%d);\n", queryHandle));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1325)(GLuint * queryId);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1326)(GLuint * queryId);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1325)(GLuint * queryId)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1326)(GLuint * queryId)
 {
     (void) queryId;
    DISPATCH(GetFirstPerfQueryIdINTEL, (queryId), (F, "glGetFirstPerfQueryIdINTEL(%p);\n", (const void *) queryId));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1326)(GLuint queryId, GLuint * nextQueryId);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1327)(GLuint queryId, GLuint * nextQueryId);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1326)(GLuint queryId, GLuint * nextQueryId)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1327)(GLuint queryId, GLuint * nextQueryId)
 {
     (void) queryId; (void) nextQueryId;
    DISPATCH(GetNextPerfQueryIdINTEL, (queryId, nextQueryId), (F, "glGetNextPerfQueryIdINTEL(%d, %p);\n", queryId, (const void *) nextQueryId));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1327)(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar * counterName, GLuint counterDescLength, GLchar * counterDesc, GLuint * counterOffset, GLuint * counterDataSize, GLuint * counterTypeEnum, GLuint * counterDataTypeEnum, GLuint64 * rawCounterMaxValue);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1328)(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar * counterName, GLuint counterDescLength, GLchar * counterDesc, GLuint * counterOffset, GLuint * counterDataSize, GLuint * counterTypeEnum, GLuint * counterDataTypeEnum, GLuint64 * rawCounterMaxValue);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1327)(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar * counterName, GLuint counterDescLength, GLchar * counterDesc, GLuint * counterOffset, GLuint * counterDataSize, GLuint * counterTypeEnum, GLuint * counterDataTypeEnum, GLuint64 * rawCounterMaxValue)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1328)(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar * counterName, GLuint counterDescLength, GLchar * counterDesc, GLuint * counterOffset, GLuint * counterDataSize, GLuint * counterTypeEnum, GLuint * counterDataTypeEnum, GLuint64 * rawCounterMaxValue)
 {
     (void) queryId; (void) counterId; (void) counterNameLength; (void) counterName; (void) counterDescLength; (void) counterDesc; (void) counterOffset; (void) counterDataSize; (void) counterTypeEnum; (void) counterDataTypeEnum; (void) rawCounterMaxValue;
    DISPATCH(GetPerfCounterInfoINTEL, (queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue), (F, "glGetPerfCounterInfoINTEL(%d, %d, %d, %p, %d, %p, %p, %p, %p, %p, %p);\n", queryId, counterId, counterNameLength, (const void *) counterName, counterDescLength, (const void *) counterDesc, (const void *) counterOffset, (const void *) counterDataSize, (const void *) counterTypeEnum, (const void *) counterDataTypeEnum, (const void *) rawCounterMaxValue));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1328)(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid * data, GLuint * bytesWritten);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1329)(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid * data, GLuint * bytesWritten);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1328)(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid * data, GLuint * bytesWritten)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1329)(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid * data, GLuint * bytesWritten)
 {
     (void) queryHandle; (void) flags; (void) dataSize; (void) data; (void) bytesWritten;
    DISPATCH(GetPerfQueryDataINTEL, (queryHandle, flags, dataSize, data, bytesWritten), (F, "glGetPerfQueryDataINTEL(%d, %d, %d, %p, %p);\n", queryHandle, flags, dataSize, (const void *) data, (const void *) bytesWritten));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1329)(GLchar * queryName, GLuint * queryId);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1330)(GLchar * queryName, GLuint * queryId);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1329)(GLchar * queryName, GLuint * queryId)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1330)(GLchar * queryName, GLuint * queryId)
 {
     (void) queryName; (void) queryId;
    DISPATCH(GetPerfQueryIdByNameINTEL, (queryName, queryId), (F, "glGetPerfQueryIdByNameINTEL(%p, %p);\n", (const void *) queryName, (const void *) queryId));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1330)(GLuint queryId, GLuint queryNameLength, GLchar * queryName, GLuint * dataSize, GLuint * noCounters, GLuint * noInstances, GLuint * capsMask);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1331)(GLuint queryId, GLuint queryNameLength, GLchar * queryName, GLuint * dataSize, GLuint * noCounters, GLuint * noInstances, GLuint * capsMask);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1330)(GLuint queryId, GLuint queryNameLength, GLchar * queryName, GLuint * dataSize, GLuint * noCounters, GLuint * noInstances, GLuint * capsMask)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1331)(GLuint queryId, GLuint queryNameLength, GLchar * queryName, GLuint * dataSize, GLuint * noCounters, GLuint * noInstances, GLuint * capsMask)
 {
     (void) queryId; (void) queryNameLength; (void) queryName; (void) dataSize; (void) noCounters; (void) noInstances; (void) capsMask;
    DISPATCH(GetPerfQueryInfoINTEL, (queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask), (F, "glGetPerfQueryInfoINTEL(%d, %d, %p, %p, %p, %p, %p);\n", queryId, queryNameLength, (const void *) queryName, (const void *) dataSize, (const void *) noCounters, (const void *) noInstances, (const void *) capsMask));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1331)(GLfloat factor, GLfloat units, GLfloat clamp);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1332)(GLfloat factor, GLfloat units, GLfloat clamp);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1331)(GLfloat factor, GLfloat units, GLfloat clamp)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1332)(GLfloat factor, GLfloat units, GLfloat clamp)
 {
     (void) factor; (void) units; (void) clamp;
    DISPATCH(PolygonOffsetClampEXT, (factor, units, clamp), (F, "glPolygonOffsetClampEXT(%f, %f, %f);\n", factor, units, clamp));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1332)(GLenum mode, GLsizei count, const GLint * box);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1333)(GLenum mode, GLsizei count, const GLint * box);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1332)(GLenum mode, GLsizei count, const GLint * box)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1333)(GLenum mode, GLsizei count, const GLint * box)
 {
     (void) mode; (void) count; (void) box;
    DISPATCH(WindowRectanglesEXT, (mode, count, box), (F, "glWindowRectanglesEXT(0x%x, %d, %p);\n", mode, count, (const void *) box));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1333)(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1334)(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1333)(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1334)(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)
 {
     (void) target; (void) size; (void) memory; (void) offset;
    DISPATCH(BufferStorageMemEXT, (target, size, memory, offset), (F, "glBufferStorageMemEXT(0x%x, %d, %d, %d);\n", target, size, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1334)(GLsizei n, GLuint * memoryObjects);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1335)(GLsizei n, GLuint * memoryObjects);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1334)(GLsizei n, GLuint * memoryObjects)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1335)(GLsizei n, GLuint * memoryObjects)
 {
     (void) n; (void) memoryObjects;
    DISPATCH(CreateMemoryObjectsEXT, (n, memoryObjects), (F, "glCreateMemoryObjectsEXT(%d, %p);\n", n, (const void *) memoryObjects));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1335)(GLsizei n, const GLuint * memoryObjects);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1336)(GLsizei n, const GLuint * memoryObjects);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1335)(GLsizei n, const GLuint * memoryObjects)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1336)(GLsizei n, const GLuint * memoryObjects)
 {
     (void) n; (void) memoryObjects;
    DISPATCH(DeleteMemoryObjectsEXT, (n, memoryObjects), (F, "glDeleteMemoryObjectsEXT(%d, %p);\n", n, (const void *) memoryObjects));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1336)(GLsizei n, const GLuint * semaphores);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1337)(GLsizei n, const GLuint * semaphores);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1336)(GLsizei n, const GLuint * semaphores)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1337)(GLsizei n, const GLuint * semaphores)
 {
     (void) n; (void) semaphores;
    DISPATCH(DeleteSemaphoresEXT, (n, semaphores), (F, "glDeleteSemaphoresEXT(%d, %p);\n", n, (const void *) semaphores));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1337)(GLsizei n, GLuint * semaphores);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1338)(GLsizei n, GLuint * semaphores);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1337)(GLsizei n, GLuint * semaphores)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1338)(GLsizei n, GLuint * semaphores)
 {
     (void) n; (void) semaphores;
    DISPATCH(GenSemaphoresEXT, (n, semaphores), (F, "glGenSemaphoresEXT(%d, %p);\n", n, (const void *) semaphores));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1338)(GLuint memoryObject, GLenum pname, GLint * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1339)(GLuint memoryObject, GLenum pname, GLint * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1338)(GLuint memoryObject, GLenum pname, GLint * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1339)(GLuint memoryObject, GLenum pname, GLint * params)
 {
     (void) memoryObject; (void) pname; (void) params;
    DISPATCH(GetMemoryObjectParameterivEXT, (memoryObject, pname, params), (F, "glGetMemoryObjectParameterivEXT(%d, 0x%x, %p);\n", memoryObject, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1339)(GLuint semaphore, GLenum pname, GLuint64 * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1340)(GLuint semaphore, GLenum pname, GLuint64 * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1339)(GLuint semaphore, GLenum pname, GLuint64 * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1340)(GLuint semaphore, GLenum pname, GLuint64 * params)
 {
     (void) semaphore; (void) pname; (void) params;
    DISPATCH(GetSemaphoreParameterui64vEXT, (semaphore, pname, params), (F, "glGetSemaphoreParameterui64vEXT(%d, 0x%x, %p);\n", semaphore, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1340)(GLenum target, GLuint index, GLubyte * data);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1341)(GLenum target, GLuint index, GLubyte * data);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1340)(GLenum target, GLuint index, GLubyte * data)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1341)(GLenum target, GLuint index, GLubyte * data)
 {
     (void) target; (void) index; (void) data;
    DISPATCH(GetUnsignedBytei_vEXT, (target, index, data), (F, "glGetUnsignedBytei_vEXT(0x%x, %d, %p);\n", target, index, (const void *) data));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1341)(GLenum pname, GLubyte * data);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1342)(GLenum pname, GLubyte * data);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1341)(GLenum pname, GLubyte * data)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1342)(GLenum pname, GLubyte * data)
 {
     (void) pname; (void) data;
    DISPATCH(GetUnsignedBytevEXT, (pname, data), (F, "glGetUnsignedBytevEXT(0x%x, %p);\n", pname, (const void *) data));
 }
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1342)(GLuint memoryObject);
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1343)(GLuint memoryObject);
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1342)(GLuint memoryObject)
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1343)(GLuint memoryObject)
 {
     (void) memoryObject;
    RETURN_DISPATCH(IsMemoryObjectEXT, (memoryObject), (F, "glIsMemoryObjectEXT(%d);\n", memoryObject));
 }
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1343)(GLuint semaphore);
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1344)(GLuint semaphore);
 
-KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1343)(GLuint semaphore)
+KEYWORD1_ALT GLboolean KEYWORD2 NAME(_dispatch_stub_1344)(GLuint semaphore)
 {
     (void) semaphore;
    RETURN_DISPATCH(IsSemaphoreEXT, (semaphore), (F, "glIsSemaphoreEXT(%d);\n", semaphore));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1344)(GLuint memoryObject, GLenum pname, const GLint * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1345)(GLuint memoryObject, GLenum pname, const GLint * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1344)(GLuint memoryObject, GLenum pname, const GLint * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1345)(GLuint memoryObject, GLenum pname, const GLint * params)
 {
     (void) memoryObject; (void) pname; (void) params;
    DISPATCH(MemoryObjectParameterivEXT, (memoryObject, pname, params), (F, "glMemoryObjectParameterivEXT(%d, 0x%x, %p);\n", memoryObject, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1345)(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1346)(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1345)(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1346)(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)
 {
     (void) buffer; (void) size; (void) memory; (void) offset;
    DISPATCH(NamedBufferStorageMemEXT, (buffer, size, memory, offset), (F, "glNamedBufferStorageMemEXT(%d, %d, %d, %d);\n", buffer, size, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1346)(GLuint semaphore, GLenum pname, const GLuint64 * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1347)(GLuint semaphore, GLenum pname, const GLuint64 * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1346)(GLuint semaphore, GLenum pname, const GLuint64 * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1347)(GLuint semaphore, GLenum pname, const GLuint64 * params)
 {
     (void) semaphore; (void) pname; (void) params;
    DISPATCH(SemaphoreParameterui64vEXT, (semaphore, pname, params), (F, "glSemaphoreParameterui64vEXT(%d, 0x%x, %p);\n", semaphore, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1347)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * dstLayouts);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1348)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * dstLayouts);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1347)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * dstLayouts)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1348)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * dstLayouts)
 {
     (void) semaphore; (void) numBufferBarriers; (void) buffers; (void) numTextureBarriers; (void) textures; (void) dstLayouts;
    DISPATCH(SignalSemaphoreEXT, (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts), (F, "glSignalSemaphoreEXT(%d, %d, %p, %d, %p, %p);\n", semaphore, numBufferBarriers, (const void *) buffers, numTextureBarriers, (const void *) textures, (const void *) dstLayouts));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1348)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1349)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1348)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1349)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
 {
     (void) target; (void) levels; (void) internalFormat; (void) width; (void) memory; (void) offset;
    DISPATCH(TexStorageMem1DEXT, (target, levels, internalFormat, width, memory, offset), (F, "glTexStorageMem1DEXT(0x%x, %d, 0x%x, %d, %d, %d);\n", target, levels, internalFormat, width, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1349)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1350)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1349)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1350)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
 {
     (void) target; (void) levels; (void) internalFormat; (void) width; (void) height; (void) memory; (void) offset;
    DISPATCH(TexStorageMem2DEXT, (target, levels, internalFormat, width, height, memory, offset), (F, "glTexStorageMem2DEXT(0x%x, %d, 0x%x, %d, %d, %d, %d);\n", target, levels, internalFormat, width, height, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1350)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1351)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1350)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1351)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
     (void) target; (void) samples; (void) internalFormat; (void) width; (void) height; (void) fixedSampleLocations; (void) memory; (void) offset;
    DISPATCH(TexStorageMem2DMultisampleEXT, (target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset), (F, "glTexStorageMem2DMultisampleEXT(0x%x, %d, 0x%x, %d, %d, %d, %d, %d);\n", target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1351)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1352)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1351)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1352)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
 {
     (void) target; (void) levels; (void) internalFormat; (void) width; (void) height; (void) depth; (void) memory; (void) offset;
    DISPATCH(TexStorageMem3DEXT, (target, levels, internalFormat, width, height, depth, memory, offset), (F, "glTexStorageMem3DEXT(0x%x, %d, 0x%x, %d, %d, %d, %d, %d);\n", target, levels, internalFormat, width, height, depth, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1352)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1353)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1352)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1353)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
     (void) target; (void) samples; (void) internalFormat; (void) width; (void) height; (void) depth; (void) fixedSampleLocations; (void) memory; (void) offset;
    DISPATCH(TexStorageMem3DMultisampleEXT, (target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset), (F, "glTexStorageMem3DMultisampleEXT(0x%x, %d, 0x%x, %d, %d, %d, %d, %d, %d);\n", target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1353)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1354)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1353)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1354)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
 {
     (void) texture; (void) levels; (void) internalFormat; (void) width; (void) memory; (void) offset;
    DISPATCH(TextureStorageMem1DEXT, (texture, levels, internalFormat, width, memory, offset), (F, "glTextureStorageMem1DEXT(%d, %d, 0x%x, %d, %d, %d);\n", texture, levels, internalFormat, width, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1354)(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1355)(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1354)(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1355)(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
 {
     (void) texture; (void) levels; (void) internalFormat; (void) width; (void) height; (void) memory; (void) offset;
    DISPATCH(TextureStorageMem2DEXT, (texture, levels, internalFormat, width, height, memory, offset), (F, "glTextureStorageMem2DEXT(0x%x, %d, 0x%x, %d, %d, %d, %d);\n", texture, levels, internalFormat, width, height, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1355)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1356)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1355)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1356)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
     (void) texture; (void) samples; (void) internalFormat; (void) width; (void) height; (void) fixedSampleLocations; (void) memory; (void) offset;
    DISPATCH(TextureStorageMem2DMultisampleEXT, (texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset), (F, "glTextureStorageMem2DMultisampleEXT(%d, %d, 0x%x, %d, %d, %d, %d, %d);\n", texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1356)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1357)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1356)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1357)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
 {
     (void) texture; (void) levels; (void) internalFormat; (void) width; (void) height; (void) depth; (void) memory; (void) offset;
    DISPATCH(TextureStorageMem3DEXT, (texture, levels, internalFormat, width, height, depth, memory, offset), (F, "glTextureStorageMem3DEXT(%d, %d, 0x%x, %d, %d, %d, %d, %d);\n", texture, levels, internalFormat, width, height, depth, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1357)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1358)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1357)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1358)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
     (void) texture; (void) samples; (void) internalFormat; (void) width; (void) height; (void) depth; (void) fixedSampleLocations; (void) memory; (void) offset;
    DISPATCH(TextureStorageMem3DMultisampleEXT, (texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset), (F, "glTextureStorageMem3DMultisampleEXT(%d, %d, 0x%x, %d, %d, %d, %d, %d, %d);\n", texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1358)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * srcLayouts);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1359)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * srcLayouts);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1358)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * srcLayouts)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1359)(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * srcLayouts)
 {
     (void) semaphore; (void) numBufferBarriers; (void) buffers; (void) numTextureBarriers; (void) textures; (void) srcLayouts;
    DISPATCH(WaitSemaphoreEXT, (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts), (F, "glWaitSemaphoreEXT(%d, %d, %p, %d, %p, %p);\n", semaphore, numBufferBarriers, (const void *) buffers, numTextureBarriers, (const void *) textures, (const void *) srcLayouts));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1359)(GLuint memory, GLuint64 size, GLenum handleType, GLint fd);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1360)(GLuint memory, GLuint64 size, GLenum handleType, GLint fd);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1359)(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1360)(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)
 {
     (void) memory; (void) size; (void) handleType; (void) fd;
    DISPATCH(ImportMemoryFdEXT, (memory, size, handleType, fd), (F, "glImportMemoryFdEXT(%d, %d, 0x%x, %d);\n", memory, size, handleType, fd));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1360)(GLuint semaphore, GLenum handleType, GLint fd);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1361)(GLuint semaphore, GLenum handleType, GLint fd);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1360)(GLuint semaphore, GLenum handleType, GLint fd)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1361)(GLuint semaphore, GLenum handleType, GLint fd)
 {
     (void) semaphore; (void) handleType; (void) fd;
    DISPATCH(ImportSemaphoreFdEXT, (semaphore, handleType, fd), (F, "glImportSemaphoreFdEXT(%d, 0x%x, %d);\n", semaphore, handleType, fd));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1361)(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1362)(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1361)(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1362)(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
 {
     (void) frontfunc; (void) backfunc; (void) ref; (void) mask;
    DISPATCH(StencilFuncSeparateATI, (frontfunc, backfunc, ref, mask), (F, "glStencilFuncSeparateATI(0x%x, 0x%x, %d, %d);\n", frontfunc, backfunc, ref, mask));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1362)(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1363)(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1362)(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1363)(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
 {
     (void) target; (void) index; (void) count; (void) params;
    DISPATCH(ProgramEnvParameters4fvEXT, (target, index, count, params), (F, "glProgramEnvParameters4fvEXT(0x%x, %d, %d, %p);\n", target, index, count, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1363)(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1364)(GLenum target, GLuint index, GLsizei count, const GLfloat * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1363)(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1364)(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
 {
     (void) target; (void) index; (void) count; (void) params;
    DISPATCH(ProgramLocalParameters4fvEXT, (target, index, count, params), (F, "glProgramLocalParameters4fvEXT(0x%x, %d, %d, %p);\n", target, index, count, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1364)(GLenum target, GLvoid * writeOffset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1365)(GLenum target, GLvoid * writeOffset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1364)(GLenum target, GLvoid * writeOffset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1365)(GLenum target, GLvoid * writeOffset)
 {
     (void) target; (void) writeOffset;
    DISPATCH(EGLImageTargetRenderbufferStorageOES, (target, writeOffset), (F, "glEGLImageTargetRenderbufferStorageOES(0x%x, %p);\n", target, (const void *) writeOffset));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1365)(GLenum target, GLvoid * writeOffset);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1366)(GLenum target, GLvoid * writeOffset);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1365)(GLenum target, GLvoid * writeOffset)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1366)(GLenum target, GLvoid * writeOffset)
 {
     (void) target; (void) writeOffset;
    DISPATCH(EGLImageTargetTexture2DOES, (target, writeOffset), (F, "glEGLImageTargetTexture2DOES(0x%x, %p);\n", target, (const void *) writeOffset));
@@ -12492,9 +12500,9 @@ KEYWORD1 void KEYWORD2 NAME(AlphaFuncx)(GLenum func, GLclampx ref)
    DISPATCH(AlphaFuncx, (func, ref), (F, "glAlphaFuncx(0x%x, %d);\n", func, ref));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1366)(GLenum func, GLclampx ref);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1367)(GLenum func, GLclampx ref);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1366)(GLenum func, GLclampx ref)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1367)(GLenum func, GLclampx ref)
 {
     (void) func; (void) ref;
    DISPATCH(AlphaFuncx, (func, ref), (F, "glAlphaFuncxOES(0x%x, %d);\n", func, ref));
@@ -12506,9 +12514,9 @@ KEYWORD1 void KEYWORD2 NAME(ClearColorx)(GLclampx red, GLclampx green, GLclampx
    DISPATCH(ClearColorx, (red, green, blue, alpha), (F, "glClearColorx(%d, %d, %d, %d);\n", red, green, blue, alpha));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1367)(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1368)(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1367)(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1368)(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)
 {
     (void) red; (void) green; (void) blue; (void) alpha;
    DISPATCH(ClearColorx, (red, green, blue, alpha), (F, "glClearColorxOES(%d, %d, %d, %d);\n", red, green, blue, alpha));
@@ -12520,9 +12528,9 @@ KEYWORD1 void KEYWORD2 NAME(ClearDepthx)(GLclampx depth)
    DISPATCH(ClearDepthx, (depth), (F, "glClearDepthx(%d);\n", depth));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1368)(GLclampx depth);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1369)(GLclampx depth);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1368)(GLclampx depth)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1369)(GLclampx depth)
 {
     (void) depth;
    DISPATCH(ClearDepthx, (depth), (F, "glClearDepthxOES(%d);\n", depth));
@@ -12534,9 +12542,9 @@ KEYWORD1 void KEYWORD2 NAME(Color4x)(GLfixed red, GLfixed green, GLfixed blue, G
    DISPATCH(Color4x, (red, green, blue, alpha), (F, "glColor4x(%d, %d, %d, %d);\n", red, green, blue, alpha));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1369)(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1370)(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1369)(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1370)(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
 {
     (void) red; (void) green; (void) blue; (void) alpha;
    DISPATCH(Color4x, (red, green, blue, alpha), (F, "glColor4xOES(%d, %d, %d, %d);\n", red, green, blue, alpha));
@@ -12548,9 +12556,9 @@ KEYWORD1 void KEYWORD2 NAME(DepthRangex)(GLclampx zNear, GLclampx zFar)
    DISPATCH(DepthRangex, (zNear, zFar), (F, "glDepthRangex(%d, %d);\n", zNear, zFar));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1370)(GLclampx zNear, GLclampx zFar);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1371)(GLclampx zNear, GLclampx zFar);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1370)(GLclampx zNear, GLclampx zFar)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1371)(GLclampx zNear, GLclampx zFar)
 {
     (void) zNear; (void) zFar;
    DISPATCH(DepthRangex, (zNear, zFar), (F, "glDepthRangexOES(%d, %d);\n", zNear, zFar));
@@ -12562,9 +12570,9 @@ KEYWORD1 void KEYWORD2 NAME(Fogx)(GLenum pname, GLfixed param)
    DISPATCH(Fogx, (pname, param), (F, "glFogx(0x%x, %d);\n", pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1371)(GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1372)(GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1371)(GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1372)(GLenum pname, GLfixed param)
 {
     (void) pname; (void) param;
    DISPATCH(Fogx, (pname, param), (F, "glFogxOES(0x%x, %d);\n", pname, param));
@@ -12576,9 +12584,9 @@ KEYWORD1 void KEYWORD2 NAME(Fogxv)(GLenum pname, const GLfixed * params)
    DISPATCH(Fogxv, (pname, params), (F, "glFogxv(0x%x, %p);\n", pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1372)(GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1373)(GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1372)(GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1373)(GLenum pname, const GLfixed * params)
 {
     (void) pname; (void) params;
    DISPATCH(Fogxv, (pname, params), (F, "glFogxvOES(0x%x, %p);\n", pname, (const void *) params));
@@ -12590,9 +12598,9 @@ KEYWORD1 void KEYWORD2 NAME(Frustumf)(GLfloat left, GLfloat right, GLfloat botto
    DISPATCH(Frustumf, (left, right, bottom, top, zNear, zFar), (F, "glFrustumf(%f, %f, %f, %f, %f, %f);\n", left, right, bottom, top, zNear, zFar));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1373)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1374)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1373)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1374)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
 {
     (void) left; (void) right; (void) bottom; (void) top; (void) zNear; (void) zFar;
    DISPATCH(Frustumf, (left, right, bottom, top, zNear, zFar), (F, "glFrustumfOES(%f, %f, %f, %f, %f, %f);\n", left, right, bottom, top, zNear, zFar));
@@ -12604,9 +12612,9 @@ KEYWORD1 void KEYWORD2 NAME(Frustumx)(GLfixed left, GLfixed right, GLfixed botto
    DISPATCH(Frustumx, (left, right, bottom, top, zNear, zFar), (F, "glFrustumx(%d, %d, %d, %d, %d, %d);\n", left, right, bottom, top, zNear, zFar));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1374)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1375)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1374)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1375)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
 {
     (void) left; (void) right; (void) bottom; (void) top; (void) zNear; (void) zFar;
    DISPATCH(Frustumx, (left, right, bottom, top, zNear, zFar), (F, "glFrustumxOES(%d, %d, %d, %d, %d, %d);\n", left, right, bottom, top, zNear, zFar));
@@ -12618,9 +12626,9 @@ KEYWORD1 void KEYWORD2 NAME(LightModelx)(GLenum pname, GLfixed param)
    DISPATCH(LightModelx, (pname, param), (F, "glLightModelx(0x%x, %d);\n", pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1375)(GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1376)(GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1375)(GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1376)(GLenum pname, GLfixed param)
 {
     (void) pname; (void) param;
    DISPATCH(LightModelx, (pname, param), (F, "glLightModelxOES(0x%x, %d);\n", pname, param));
@@ -12632,9 +12640,9 @@ KEYWORD1 void KEYWORD2 NAME(LightModelxv)(GLenum pname, const GLfixed * params)
    DISPATCH(LightModelxv, (pname, params), (F, "glLightModelxv(0x%x, %p);\n", pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1376)(GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1377)(GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1376)(GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1377)(GLenum pname, const GLfixed * params)
 {
     (void) pname; (void) params;
    DISPATCH(LightModelxv, (pname, params), (F, "glLightModelxvOES(0x%x, %p);\n", pname, (const void *) params));
@@ -12646,9 +12654,9 @@ KEYWORD1 void KEYWORD2 NAME(Lightx)(GLenum light, GLenum pname, GLfixed param)
    DISPATCH(Lightx, (light, pname, param), (F, "glLightx(0x%x, 0x%x, %d);\n", light, pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1377)(GLenum light, GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1378)(GLenum light, GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1377)(GLenum light, GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1378)(GLenum light, GLenum pname, GLfixed param)
 {
     (void) light; (void) pname; (void) param;
    DISPATCH(Lightx, (light, pname, param), (F, "glLightxOES(0x%x, 0x%x, %d);\n", light, pname, param));
@@ -12660,9 +12668,9 @@ KEYWORD1 void KEYWORD2 NAME(Lightxv)(GLenum light, GLenum pname, const GLfixed *
    DISPATCH(Lightxv, (light, pname, params), (F, "glLightxv(0x%x, 0x%x, %p);\n", light, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1378)(GLenum light, GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1379)(GLenum light, GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1378)(GLenum light, GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1379)(GLenum light, GLenum pname, const GLfixed * params)
 {
     (void) light; (void) pname; (void) params;
    DISPATCH(Lightxv, (light, pname, params), (F, "glLightxvOES(0x%x, 0x%x, %p);\n", light, pname, (const void *) params));
@@ -12674,9 +12682,9 @@ KEYWORD1 void KEYWORD2 NAME(LineWidthx)(GLfixed width)
    DISPATCH(LineWidthx, (width), (F, "glLineWidthx(%d);\n", width));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1379)(GLfixed width);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1380)(GLfixed width);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1379)(GLfixed width)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1380)(GLfixed width)
 {
     (void) width;
    DISPATCH(LineWidthx, (width), (F, "glLineWidthxOES(%d);\n", width));
@@ -12688,9 +12696,9 @@ KEYWORD1 void KEYWORD2 NAME(LoadMatrixx)(const GLfixed * m)
    DISPATCH(LoadMatrixx, (m), (F, "glLoadMatrixx(%p);\n", (const void *) m));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1380)(const GLfixed * m);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1381)(const GLfixed * m);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1380)(const GLfixed * m)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1381)(const GLfixed * m)
 {
     (void) m;
    DISPATCH(LoadMatrixx, (m), (F, "glLoadMatrixxOES(%p);\n", (const void *) m));
@@ -12702,9 +12710,9 @@ KEYWORD1 void KEYWORD2 NAME(Materialx)(GLenum face, GLenum pname, GLfixed param)
    DISPATCH(Materialx, (face, pname, param), (F, "glMaterialx(0x%x, 0x%x, %d);\n", face, pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1381)(GLenum face, GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1382)(GLenum face, GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1381)(GLenum face, GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1382)(GLenum face, GLenum pname, GLfixed param)
 {
     (void) face; (void) pname; (void) param;
    DISPATCH(Materialx, (face, pname, param), (F, "glMaterialxOES(0x%x, 0x%x, %d);\n", face, pname, param));
@@ -12716,9 +12724,9 @@ KEYWORD1 void KEYWORD2 NAME(Materialxv)(GLenum face, GLenum pname, const GLfixed
    DISPATCH(Materialxv, (face, pname, params), (F, "glMaterialxv(0x%x, 0x%x, %p);\n", face, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1382)(GLenum face, GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1383)(GLenum face, GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1382)(GLenum face, GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1383)(GLenum face, GLenum pname, const GLfixed * params)
 {
     (void) face; (void) pname; (void) params;
    DISPATCH(Materialxv, (face, pname, params), (F, "glMaterialxvOES(0x%x, 0x%x, %p);\n", face, pname, (const void *) params));
@@ -12730,9 +12738,9 @@ KEYWORD1 void KEYWORD2 NAME(MultMatrixx)(const GLfixed * m)
    DISPATCH(MultMatrixx, (m), (F, "glMultMatrixx(%p);\n", (const void *) m));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1383)(const GLfixed * m);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1384)(const GLfixed * m);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1383)(const GLfixed * m)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1384)(const GLfixed * m)
 {
     (void) m;
    DISPATCH(MultMatrixx, (m), (F, "glMultMatrixxOES(%p);\n", (const void *) m));
@@ -12744,9 +12752,9 @@ KEYWORD1 void KEYWORD2 NAME(MultiTexCoord4x)(GLenum target, GLfixed s, GLfixed t
    DISPATCH(MultiTexCoord4x, (target, s, t, r, q), (F, "glMultiTexCoord4x(0x%x, %d, %d, %d, %d);\n", target, s, t, r, q));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1384)(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1385)(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1384)(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1385)(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
 {
     (void) target; (void) s; (void) t; (void) r; (void) q;
    DISPATCH(MultiTexCoord4x, (target, s, t, r, q), (F, "glMultiTexCoord4xOES(0x%x, %d, %d, %d, %d);\n", target, s, t, r, q));
@@ -12758,9 +12766,9 @@ KEYWORD1 void KEYWORD2 NAME(Normal3x)(GLfixed nx, GLfixed ny, GLfixed nz)
    DISPATCH(Normal3x, (nx, ny, nz), (F, "glNormal3x(%d, %d, %d);\n", nx, ny, nz));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1385)(GLfixed nx, GLfixed ny, GLfixed nz);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1386)(GLfixed nx, GLfixed ny, GLfixed nz);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1385)(GLfixed nx, GLfixed ny, GLfixed nz)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1386)(GLfixed nx, GLfixed ny, GLfixed nz)
 {
     (void) nx; (void) ny; (void) nz;
    DISPATCH(Normal3x, (nx, ny, nz), (F, "glNormal3xOES(%d, %d, %d);\n", nx, ny, nz));
@@ -12772,9 +12780,9 @@ KEYWORD1 void KEYWORD2 NAME(Orthof)(GLfloat left, GLfloat right, GLfloat bottom,
    DISPATCH(Orthof, (left, right, bottom, top, zNear, zFar), (F, "glOrthof(%f, %f, %f, %f, %f, %f);\n", left, right, bottom, top, zNear, zFar));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1386)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1387)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1386)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1387)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
 {
     (void) left; (void) right; (void) bottom; (void) top; (void) zNear; (void) zFar;
    DISPATCH(Orthof, (left, right, bottom, top, zNear, zFar), (F, "glOrthofOES(%f, %f, %f, %f, %f, %f);\n", left, right, bottom, top, zNear, zFar));
@@ -12786,9 +12794,9 @@ KEYWORD1 void KEYWORD2 NAME(Orthox)(GLfixed left, GLfixed right, GLfixed bottom,
    DISPATCH(Orthox, (left, right, bottom, top, zNear, zFar), (F, "glOrthox(%d, %d, %d, %d, %d, %d);\n", left, right, bottom, top, zNear, zFar));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1387)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1388)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1387)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1388)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
 {
     (void) left; (void) right; (void) bottom; (void) top; (void) zNear; (void) zFar;
    DISPATCH(Orthox, (left, right, bottom, top, zNear, zFar), (F, "glOrthoxOES(%d, %d, %d, %d, %d, %d);\n", left, right, bottom, top, zNear, zFar));
@@ -12800,9 +12808,9 @@ KEYWORD1 void KEYWORD2 NAME(PointSizex)(GLfixed size)
    DISPATCH(PointSizex, (size), (F, "glPointSizex(%d);\n", size));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1388)(GLfixed size);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1389)(GLfixed size);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1388)(GLfixed size)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1389)(GLfixed size)
 {
     (void) size;
    DISPATCH(PointSizex, (size), (F, "glPointSizexOES(%d);\n", size));
@@ -12814,9 +12822,9 @@ KEYWORD1 void KEYWORD2 NAME(PolygonOffsetx)(GLfixed factor, GLfixed units)
    DISPATCH(PolygonOffsetx, (factor, units), (F, "glPolygonOffsetx(%d, %d);\n", factor, units));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1389)(GLfixed factor, GLfixed units);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1390)(GLfixed factor, GLfixed units);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1389)(GLfixed factor, GLfixed units)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1390)(GLfixed factor, GLfixed units)
 {
     (void) factor; (void) units;
    DISPATCH(PolygonOffsetx, (factor, units), (F, "glPolygonOffsetxOES(%d, %d);\n", factor, units));
@@ -12828,9 +12836,9 @@ KEYWORD1 void KEYWORD2 NAME(Rotatex)(GLfixed angle, GLfixed x, GLfixed y, GLfixe
    DISPATCH(Rotatex, (angle, x, y, z), (F, "glRotatex(%d, %d, %d, %d);\n", angle, x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1390)(GLfixed angle, GLfixed x, GLfixed y, GLfixed z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1391)(GLfixed angle, GLfixed x, GLfixed y, GLfixed z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1390)(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1391)(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
 {
     (void) angle; (void) x; (void) y; (void) z;
    DISPATCH(Rotatex, (angle, x, y, z), (F, "glRotatexOES(%d, %d, %d, %d);\n", angle, x, y, z));
@@ -12842,9 +12850,9 @@ KEYWORD1 void KEYWORD2 NAME(SampleCoveragex)(GLclampx value, GLboolean invert)
    DISPATCH(SampleCoveragex, (value, invert), (F, "glSampleCoveragex(%d, %d);\n", value, invert));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1391)(GLclampx value, GLboolean invert);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1392)(GLclampx value, GLboolean invert);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1391)(GLclampx value, GLboolean invert)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1392)(GLclampx value, GLboolean invert)
 {
     (void) value; (void) invert;
    DISPATCH(SampleCoveragex, (value, invert), (F, "glSampleCoveragexOES(%d, %d);\n", value, invert));
@@ -12856,9 +12864,9 @@ KEYWORD1 void KEYWORD2 NAME(Scalex)(GLfixed x, GLfixed y, GLfixed z)
    DISPATCH(Scalex, (x, y, z), (F, "glScalex(%d, %d, %d);\n", x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1392)(GLfixed x, GLfixed y, GLfixed z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1393)(GLfixed x, GLfixed y, GLfixed z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1392)(GLfixed x, GLfixed y, GLfixed z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1393)(GLfixed x, GLfixed y, GLfixed z)
 {
     (void) x; (void) y; (void) z;
    DISPATCH(Scalex, (x, y, z), (F, "glScalexOES(%d, %d, %d);\n", x, y, z));
@@ -12870,9 +12878,9 @@ KEYWORD1 void KEYWORD2 NAME(TexEnvx)(GLenum target, GLenum pname, GLfixed param)
    DISPATCH(TexEnvx, (target, pname, param), (F, "glTexEnvx(0x%x, 0x%x, %d);\n", target, pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1393)(GLenum target, GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1394)(GLenum target, GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1393)(GLenum target, GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1394)(GLenum target, GLenum pname, GLfixed param)
 {
     (void) target; (void) pname; (void) param;
    DISPATCH(TexEnvx, (target, pname, param), (F, "glTexEnvxOES(0x%x, 0x%x, %d);\n", target, pname, param));
@@ -12884,9 +12892,9 @@ KEYWORD1 void KEYWORD2 NAME(TexEnvxv)(GLenum target, GLenum pname, const GLfixed
    DISPATCH(TexEnvxv, (target, pname, params), (F, "glTexEnvxv(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1394)(GLenum target, GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1395)(GLenum target, GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1394)(GLenum target, GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1395)(GLenum target, GLenum pname, const GLfixed * params)
 {
     (void) target; (void) pname; (void) params;
    DISPATCH(TexEnvxv, (target, pname, params), (F, "glTexEnvxvOES(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
@@ -12898,9 +12906,9 @@ KEYWORD1 void KEYWORD2 NAME(TexParameterx)(GLenum target, GLenum pname, GLfixed
    DISPATCH(TexParameterx, (target, pname, param), (F, "glTexParameterx(0x%x, 0x%x, %d);\n", target, pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1395)(GLenum target, GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1396)(GLenum target, GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1395)(GLenum target, GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1396)(GLenum target, GLenum pname, GLfixed param)
 {
     (void) target; (void) pname; (void) param;
    DISPATCH(TexParameterx, (target, pname, param), (F, "glTexParameterxOES(0x%x, 0x%x, %d);\n", target, pname, param));
@@ -12912,9 +12920,9 @@ KEYWORD1 void KEYWORD2 NAME(Translatex)(GLfixed x, GLfixed y, GLfixed z)
    DISPATCH(Translatex, (x, y, z), (F, "glTranslatex(%d, %d, %d);\n", x, y, z));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1396)(GLfixed x, GLfixed y, GLfixed z);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1397)(GLfixed x, GLfixed y, GLfixed z);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1396)(GLfixed x, GLfixed y, GLfixed z)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1397)(GLfixed x, GLfixed y, GLfixed z)
 {
     (void) x; (void) y; (void) z;
    DISPATCH(Translatex, (x, y, z), (F, "glTranslatexOES(%d, %d, %d);\n", x, y, z));
@@ -12926,9 +12934,9 @@ KEYWORD1 void KEYWORD2 NAME(ClipPlanef)(GLenum plane, const GLfloat * equation)
    DISPATCH(ClipPlanef, (plane, equation), (F, "glClipPlanef(0x%x, %p);\n", plane, (const void *) equation));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1397)(GLenum plane, const GLfloat * equation);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1398)(GLenum plane, const GLfloat * equation);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1397)(GLenum plane, const GLfloat * equation)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1398)(GLenum plane, const GLfloat * equation)
 {
     (void) plane; (void) equation;
    DISPATCH(ClipPlanef, (plane, equation), (F, "glClipPlanefOES(0x%x, %p);\n", plane, (const void *) equation));
@@ -12940,9 +12948,9 @@ KEYWORD1 void KEYWORD2 NAME(ClipPlanex)(GLenum plane, const GLfixed * equation)
    DISPATCH(ClipPlanex, (plane, equation), (F, "glClipPlanex(0x%x, %p);\n", plane, (const void *) equation));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1398)(GLenum plane, const GLfixed * equation);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1399)(GLenum plane, const GLfixed * equation);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1398)(GLenum plane, const GLfixed * equation)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1399)(GLenum plane, const GLfixed * equation)
 {
     (void) plane; (void) equation;
    DISPATCH(ClipPlanex, (plane, equation), (F, "glClipPlanexOES(0x%x, %p);\n", plane, (const void *) equation));
@@ -12954,9 +12962,9 @@ KEYWORD1 void KEYWORD2 NAME(GetClipPlanef)(GLenum plane, GLfloat * equation)
    DISPATCH(GetClipPlanef, (plane, equation), (F, "glGetClipPlanef(0x%x, %p);\n", plane, (const void *) equation));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1399)(GLenum plane, GLfloat * equation);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1400)(GLenum plane, GLfloat * equation);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1399)(GLenum plane, GLfloat * equation)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1400)(GLenum plane, GLfloat * equation)
 {
     (void) plane; (void) equation;
    DISPATCH(GetClipPlanef, (plane, equation), (F, "glGetClipPlanefOES(0x%x, %p);\n", plane, (const void *) equation));
@@ -12968,9 +12976,9 @@ KEYWORD1 void KEYWORD2 NAME(GetClipPlanex)(GLenum plane, GLfixed * equation)
    DISPATCH(GetClipPlanex, (plane, equation), (F, "glGetClipPlanex(0x%x, %p);\n", plane, (const void *) equation));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1400)(GLenum plane, GLfixed * equation);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1401)(GLenum plane, GLfixed * equation);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1400)(GLenum plane, GLfixed * equation)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1401)(GLenum plane, GLfixed * equation)
 {
     (void) plane; (void) equation;
    DISPATCH(GetClipPlanex, (plane, equation), (F, "glGetClipPlanexOES(0x%x, %p);\n", plane, (const void *) equation));
@@ -12982,9 +12990,9 @@ KEYWORD1 void KEYWORD2 NAME(GetFixedv)(GLenum pname, GLfixed * params)
    DISPATCH(GetFixedv, (pname, params), (F, "glGetFixedv(0x%x, %p);\n", pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1401)(GLenum pname, GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1402)(GLenum pname, GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1401)(GLenum pname, GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1402)(GLenum pname, GLfixed * params)
 {
     (void) pname; (void) params;
    DISPATCH(GetFixedv, (pname, params), (F, "glGetFixedvOES(0x%x, %p);\n", pname, (const void *) params));
@@ -12996,9 +13004,9 @@ KEYWORD1 void KEYWORD2 NAME(GetLightxv)(GLenum light, GLenum pname, GLfixed * pa
    DISPATCH(GetLightxv, (light, pname, params), (F, "glGetLightxv(0x%x, 0x%x, %p);\n", light, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1402)(GLenum light, GLenum pname, GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1403)(GLenum light, GLenum pname, GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1402)(GLenum light, GLenum pname, GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1403)(GLenum light, GLenum pname, GLfixed * params)
 {
     (void) light; (void) pname; (void) params;
    DISPATCH(GetLightxv, (light, pname, params), (F, "glGetLightxvOES(0x%x, 0x%x, %p);\n", light, pname, (const void *) params));
@@ -13010,9 +13018,9 @@ KEYWORD1 void KEYWORD2 NAME(GetMaterialxv)(GLenum face, GLenum pname, GLfixed *
    DISPATCH(GetMaterialxv, (face, pname, params), (F, "glGetMaterialxv(0x%x, 0x%x, %p);\n", face, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1403)(GLenum face, GLenum pname, GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1404)(GLenum face, GLenum pname, GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1403)(GLenum face, GLenum pname, GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1404)(GLenum face, GLenum pname, GLfixed * params)
 {
     (void) face; (void) pname; (void) params;
    DISPATCH(GetMaterialxv, (face, pname, params), (F, "glGetMaterialxvOES(0x%x, 0x%x, %p);\n", face, pname, (const void *) params));
@@ -13024,9 +13032,9 @@ KEYWORD1 void KEYWORD2 NAME(GetTexEnvxv)(GLenum target, GLenum pname, GLfixed *
    DISPATCH(GetTexEnvxv, (target, pname, params), (F, "glGetTexEnvxv(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1404)(GLenum target, GLenum pname, GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1405)(GLenum target, GLenum pname, GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1404)(GLenum target, GLenum pname, GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1405)(GLenum target, GLenum pname, GLfixed * params)
 {
     (void) target; (void) pname; (void) params;
    DISPATCH(GetTexEnvxv, (target, pname, params), (F, "glGetTexEnvxvOES(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
@@ -13038,9 +13046,9 @@ KEYWORD1 void KEYWORD2 NAME(GetTexParameterxv)(GLenum target, GLenum pname, GLfi
    DISPATCH(GetTexParameterxv, (target, pname, params), (F, "glGetTexParameterxv(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1405)(GLenum target, GLenum pname, GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1406)(GLenum target, GLenum pname, GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1405)(GLenum target, GLenum pname, GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1406)(GLenum target, GLenum pname, GLfixed * params)
 {
     (void) target; (void) pname; (void) params;
    DISPATCH(GetTexParameterxv, (target, pname, params), (F, "glGetTexParameterxvOES(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
@@ -13052,9 +13060,9 @@ KEYWORD1 void KEYWORD2 NAME(PointParameterx)(GLenum pname, GLfixed param)
    DISPATCH(PointParameterx, (pname, param), (F, "glPointParameterx(0x%x, %d);\n", pname, param));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1406)(GLenum pname, GLfixed param);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1407)(GLenum pname, GLfixed param);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1406)(GLenum pname, GLfixed param)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1407)(GLenum pname, GLfixed param)
 {
     (void) pname; (void) param;
    DISPATCH(PointParameterx, (pname, param), (F, "glPointParameterxOES(0x%x, %d);\n", pname, param));
@@ -13066,9 +13074,9 @@ KEYWORD1 void KEYWORD2 NAME(PointParameterxv)(GLenum pname, const GLfixed * para
    DISPATCH(PointParameterxv, (pname, params), (F, "glPointParameterxv(0x%x, %p);\n", pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1407)(GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1408)(GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1407)(GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1408)(GLenum pname, const GLfixed * params)
 {
     (void) pname; (void) params;
    DISPATCH(PointParameterxv, (pname, params), (F, "glPointParameterxvOES(0x%x, %p);\n", pname, (const void *) params));
@@ -13080,9 +13088,9 @@ KEYWORD1 void KEYWORD2 NAME(TexParameterxv)(GLenum target, GLenum pname, const G
    DISPATCH(TexParameterxv, (target, pname, params), (F, "glTexParameterxv(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1408)(GLenum target, GLenum pname, const GLfixed * params);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1409)(GLenum target, GLenum pname, const GLfixed * params);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1408)(GLenum target, GLenum pname, const GLfixed * params)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1409)(GLenum target, GLenum pname, const GLfixed * params)
 {
     (void) target; (void) pname; (void) params;
    DISPATCH(TexParameterxv, (target, pname, params), (F, "glTexParameterxvOES(0x%x, 0x%x, %p);\n", target, pname, (const void *) params));
@@ -13093,9 +13101,9 @@ KEYWORD1 void KEYWORD2 NAME(BlendBarrier)(void)
    DISPATCH(BlendBarrier, (), (F, "glBlendBarrier();\n"));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1409)(void);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1410)(void);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1409)(void)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1410)(void)
 {
    DISPATCH(BlendBarrier, (), (F, "glBlendBarrierKHR();\n"));
 }
@@ -13106,9 +13114,9 @@ KEYWORD1 void KEYWORD2 NAME(PrimitiveBoundingBox)(GLfloat minX, GLfloat minY, GL
    DISPATCH(PrimitiveBoundingBox, (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW), (F, "glPrimitiveBoundingBox(%f, %f, %f, %f, %f, %f, %f, %f);\n", minX, minY, minZ, minW, maxX, maxY, maxZ, maxW));
 }
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1410)(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW);
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1411)(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW);
 
-KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1410)(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW)
+KEYWORD1_ALT void KEYWORD2 NAME(_dispatch_stub_1411)(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW)
 {
     (void) minX; (void) minY; (void) minZ; (void) minW; (void) maxX; (void) maxY; (void) maxZ; (void) maxW;
    DISPATCH(PrimitiveBoundingBox, (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW), (F, "glPrimitiveBoundingBoxARB(%f, %f, %f, %f, %f, %f, %f, %f);\n", minX, minY, minZ, minW, maxX, maxY, maxZ, maxW));
@@ -14339,13 +14347,13 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1067),
    TABLE_ENTRY(_dispatch_stub_1068),
    TABLE_ENTRY(_dispatch_stub_1069),
+   TABLE_ENTRY(_dispatch_stub_1070),
    TABLE_ENTRY(InvalidateBufferData),
    TABLE_ENTRY(InvalidateBufferSubData),
    TABLE_ENTRY(InvalidateFramebuffer),
    TABLE_ENTRY(InvalidateSubFramebuffer),
    TABLE_ENTRY(InvalidateTexImage),
    TABLE_ENTRY(InvalidateTexSubImage),
-   TABLE_ENTRY(_dispatch_stub_1076),
    TABLE_ENTRY(_dispatch_stub_1077),
    TABLE_ENTRY(_dispatch_stub_1078),
    TABLE_ENTRY(_dispatch_stub_1079),
@@ -14354,17 +14362,18 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1082),
    TABLE_ENTRY(_dispatch_stub_1083),
    TABLE_ENTRY(_dispatch_stub_1084),
+   TABLE_ENTRY(_dispatch_stub_1085),
    TABLE_ENTRY(PointSizePointerOES),
-   TABLE_ENTRY(_dispatch_stub_1086),
    TABLE_ENTRY(_dispatch_stub_1087),
    TABLE_ENTRY(_dispatch_stub_1088),
+   TABLE_ENTRY(_dispatch_stub_1089),
    TABLE_ENTRY(ColorPointerEXT),
    TABLE_ENTRY(EdgeFlagPointerEXT),
    TABLE_ENTRY(IndexPointerEXT),
    TABLE_ENTRY(NormalPointerEXT),
    TABLE_ENTRY(TexCoordPointerEXT),
    TABLE_ENTRY(VertexPointerEXT),
-   TABLE_ENTRY(_dispatch_stub_1095),
+   TABLE_ENTRY(_dispatch_stub_1096),
    TABLE_ENTRY(ActiveShaderProgram),
    TABLE_ENTRY(BindProgramPipeline),
    TABLE_ENTRY(CreateShaderProgramv),
@@ -14374,55 +14383,55 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(GetProgramPipelineiv),
    TABLE_ENTRY(IsProgramPipeline),
    TABLE_ENTRY(LockArraysEXT),
-   TABLE_ENTRY(_dispatch_stub_1105),
    TABLE_ENTRY(_dispatch_stub_1106),
+   TABLE_ENTRY(_dispatch_stub_1107),
    TABLE_ENTRY(ProgramUniform1f),
    TABLE_ENTRY(ProgramUniform1fv),
    TABLE_ENTRY(ProgramUniform1i),
    TABLE_ENTRY(ProgramUniform1iv),
    TABLE_ENTRY(ProgramUniform1ui),
    TABLE_ENTRY(ProgramUniform1uiv),
-   TABLE_ENTRY(_dispatch_stub_1113),
    TABLE_ENTRY(_dispatch_stub_1114),
+   TABLE_ENTRY(_dispatch_stub_1115),
    TABLE_ENTRY(ProgramUniform2f),
    TABLE_ENTRY(ProgramUniform2fv),
    TABLE_ENTRY(ProgramUniform2i),
    TABLE_ENTRY(ProgramUniform2iv),
    TABLE_ENTRY(ProgramUniform2ui),
    TABLE_ENTRY(ProgramUniform2uiv),
-   TABLE_ENTRY(_dispatch_stub_1121),
    TABLE_ENTRY(_dispatch_stub_1122),
+   TABLE_ENTRY(_dispatch_stub_1123),
    TABLE_ENTRY(ProgramUniform3f),
    TABLE_ENTRY(ProgramUniform3fv),
    TABLE_ENTRY(ProgramUniform3i),
    TABLE_ENTRY(ProgramUniform3iv),
    TABLE_ENTRY(ProgramUniform3ui),
    TABLE_ENTRY(ProgramUniform3uiv),
-   TABLE_ENTRY(_dispatch_stub_1129),
    TABLE_ENTRY(_dispatch_stub_1130),
+   TABLE_ENTRY(_dispatch_stub_1131),
    TABLE_ENTRY(ProgramUniform4f),
    TABLE_ENTRY(ProgramUniform4fv),
    TABLE_ENTRY(ProgramUniform4i),
    TABLE_ENTRY(ProgramUniform4iv),
    TABLE_ENTRY(ProgramUniform4ui),
    TABLE_ENTRY(ProgramUniform4uiv),
-   TABLE_ENTRY(_dispatch_stub_1137),
+   TABLE_ENTRY(_dispatch_stub_1138),
    TABLE_ENTRY(ProgramUniformMatrix2fv),
-   TABLE_ENTRY(_dispatch_stub_1139),
+   TABLE_ENTRY(_dispatch_stub_1140),
    TABLE_ENTRY(ProgramUniformMatrix2x3fv),
-   TABLE_ENTRY(_dispatch_stub_1141),
+   TABLE_ENTRY(_dispatch_stub_1142),
    TABLE_ENTRY(ProgramUniformMatrix2x4fv),
-   TABLE_ENTRY(_dispatch_stub_1143),
+   TABLE_ENTRY(_dispatch_stub_1144),
    TABLE_ENTRY(ProgramUniformMatrix3fv),
-   TABLE_ENTRY(_dispatch_stub_1145),
+   TABLE_ENTRY(_dispatch_stub_1146),
    TABLE_ENTRY(ProgramUniformMatrix3x2fv),
-   TABLE_ENTRY(_dispatch_stub_1147),
+   TABLE_ENTRY(_dispatch_stub_1148),
    TABLE_ENTRY(ProgramUniformMatrix3x4fv),
-   TABLE_ENTRY(_dispatch_stub_1149),
+   TABLE_ENTRY(_dispatch_stub_1150),
    TABLE_ENTRY(ProgramUniformMatrix4fv),
-   TABLE_ENTRY(_dispatch_stub_1151),
+   TABLE_ENTRY(_dispatch_stub_1152),
    TABLE_ENTRY(ProgramUniformMatrix4x2fv),
-   TABLE_ENTRY(_dispatch_stub_1153),
+   TABLE_ENTRY(_dispatch_stub_1154),
    TABLE_ENTRY(ProgramUniformMatrix4x3fv),
    TABLE_ENTRY(UnlockArraysEXT),
    TABLE_ENTRY(UseProgramStages),
@@ -14442,7 +14451,6 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(MultiDrawElementsEXT),
    TABLE_ENTRY(FogCoordfEXT),
    TABLE_ENTRY(FogCoordfvEXT),
-   TABLE_ENTRY(_dispatch_stub_1173),
    TABLE_ENTRY(_dispatch_stub_1174),
    TABLE_ENTRY(_dispatch_stub_1175),
    TABLE_ENTRY(_dispatch_stub_1176),
@@ -14535,16 +14543,17 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1263),
    TABLE_ENTRY(_dispatch_stub_1264),
    TABLE_ENTRY(_dispatch_stub_1265),
+   TABLE_ENTRY(_dispatch_stub_1266),
    TABLE_ENTRY(PrimitiveRestartNV),
-   TABLE_ENTRY(_dispatch_stub_1267),
    TABLE_ENTRY(_dispatch_stub_1268),
    TABLE_ENTRY(_dispatch_stub_1269),
    TABLE_ENTRY(_dispatch_stub_1270),
+   TABLE_ENTRY(_dispatch_stub_1271),
    TABLE_ENTRY(BindFramebufferEXT),
    TABLE_ENTRY(BindRenderbufferEXT),
-   TABLE_ENTRY(_dispatch_stub_1273),
    TABLE_ENTRY(_dispatch_stub_1274),
    TABLE_ENTRY(_dispatch_stub_1275),
+   TABLE_ENTRY(_dispatch_stub_1276),
    TABLE_ENTRY(VertexAttribI1iEXT),
    TABLE_ENTRY(VertexAttribI1uiEXT),
    TABLE_ENTRY(VertexAttribI2iEXT),
@@ -14561,7 +14570,6 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(VertexAttribI4uivEXT),
    TABLE_ENTRY(ClearColorIiEXT),
    TABLE_ENTRY(ClearColorIuiEXT),
-   TABLE_ENTRY(_dispatch_stub_1292),
    TABLE_ENTRY(_dispatch_stub_1293),
    TABLE_ENTRY(_dispatch_stub_1294),
    TABLE_ENTRY(_dispatch_stub_1295),
@@ -14579,8 +14587,8 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1307),
    TABLE_ENTRY(_dispatch_stub_1308),
    TABLE_ENTRY(_dispatch_stub_1309),
+   TABLE_ENTRY(_dispatch_stub_1310),
    TABLE_ENTRY(TextureBarrierNV),
-   TABLE_ENTRY(_dispatch_stub_1311),
    TABLE_ENTRY(_dispatch_stub_1312),
    TABLE_ENTRY(_dispatch_stub_1313),
    TABLE_ENTRY(_dispatch_stub_1314),
@@ -14635,6 +14643,7 @@ _glapi_proc DISPATCH_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1363),
    TABLE_ENTRY(_dispatch_stub_1364),
    TABLE_ENTRY(_dispatch_stub_1365),
+   TABLE_ENTRY(_dispatch_stub_1366),
    TABLE_ENTRY(AlphaFuncx),
    TABLE_ENTRY(ClearColorx),
    TABLE_ENTRY(ClearDepthx),
@@ -15217,7 +15226,6 @@ _glapi_proc UNUSED_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_900),
    TABLE_ENTRY(_dispatch_stub_902),
    TABLE_ENTRY(_dispatch_stub_903),
-   TABLE_ENTRY(_dispatch_stub_1096),
    TABLE_ENTRY(_dispatch_stub_1097),
    TABLE_ENTRY(_dispatch_stub_1098),
    TABLE_ENTRY(_dispatch_stub_1099),
@@ -15225,55 +15233,56 @@ _glapi_proc UNUSED_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1101),
    TABLE_ENTRY(_dispatch_stub_1102),
    TABLE_ENTRY(_dispatch_stub_1103),
-   TABLE_ENTRY(_dispatch_stub_1107),
+   TABLE_ENTRY(_dispatch_stub_1104),
    TABLE_ENTRY(_dispatch_stub_1108),
    TABLE_ENTRY(_dispatch_stub_1109),
    TABLE_ENTRY(_dispatch_stub_1110),
    TABLE_ENTRY(_dispatch_stub_1111),
    TABLE_ENTRY(_dispatch_stub_1112),
-   TABLE_ENTRY(_dispatch_stub_1115),
+   TABLE_ENTRY(_dispatch_stub_1113),
    TABLE_ENTRY(_dispatch_stub_1116),
    TABLE_ENTRY(_dispatch_stub_1117),
    TABLE_ENTRY(_dispatch_stub_1118),
    TABLE_ENTRY(_dispatch_stub_1119),
    TABLE_ENTRY(_dispatch_stub_1120),
-   TABLE_ENTRY(_dispatch_stub_1123),
+   TABLE_ENTRY(_dispatch_stub_1121),
    TABLE_ENTRY(_dispatch_stub_1124),
    TABLE_ENTRY(_dispatch_stub_1125),
    TABLE_ENTRY(_dispatch_stub_1126),
    TABLE_ENTRY(_dispatch_stub_1127),
    TABLE_ENTRY(_dispatch_stub_1128),
-   TABLE_ENTRY(_dispatch_stub_1131),
+   TABLE_ENTRY(_dispatch_stub_1129),
    TABLE_ENTRY(_dispatch_stub_1132),
    TABLE_ENTRY(_dispatch_stub_1133),
    TABLE_ENTRY(_dispatch_stub_1134),
    TABLE_ENTRY(_dispatch_stub_1135),
    TABLE_ENTRY(_dispatch_stub_1136),
-   TABLE_ENTRY(_dispatch_stub_1138),
-   TABLE_ENTRY(_dispatch_stub_1140),
-   TABLE_ENTRY(_dispatch_stub_1142),
-   TABLE_ENTRY(_dispatch_stub_1144),
-   TABLE_ENTRY(_dispatch_stub_1146),
-   TABLE_ENTRY(_dispatch_stub_1148),
-   TABLE_ENTRY(_dispatch_stub_1150),
-   TABLE_ENTRY(_dispatch_stub_1152),
-   TABLE_ENTRY(_dispatch_stub_1154),
-   TABLE_ENTRY(_dispatch_stub_1156),
+   TABLE_ENTRY(_dispatch_stub_1137),
+   TABLE_ENTRY(_dispatch_stub_1139),
+   TABLE_ENTRY(_dispatch_stub_1141),
+   TABLE_ENTRY(_dispatch_stub_1143),
+   TABLE_ENTRY(_dispatch_stub_1145),
+   TABLE_ENTRY(_dispatch_stub_1147),
+   TABLE_ENTRY(_dispatch_stub_1149),
+   TABLE_ENTRY(_dispatch_stub_1151),
+   TABLE_ENTRY(_dispatch_stub_1153),
+   TABLE_ENTRY(_dispatch_stub_1155),
    TABLE_ENTRY(_dispatch_stub_1157),
-   TABLE_ENTRY(DebugMessageCallbackARB),
    TABLE_ENTRY(_dispatch_stub_1158),
-   TABLE_ENTRY(DebugMessageControlARB),
+   TABLE_ENTRY(DebugMessageCallbackARB),
    TABLE_ENTRY(_dispatch_stub_1159),
-   TABLE_ENTRY(DebugMessageInsertARB),
+   TABLE_ENTRY(DebugMessageControlARB),
    TABLE_ENTRY(_dispatch_stub_1160),
-   TABLE_ENTRY(GetDebugMessageLogARB),
+   TABLE_ENTRY(DebugMessageInsertARB),
    TABLE_ENTRY(_dispatch_stub_1161),
+   TABLE_ENTRY(GetDebugMessageLogARB),
    TABLE_ENTRY(_dispatch_stub_1162),
    TABLE_ENTRY(_dispatch_stub_1163),
    TABLE_ENTRY(_dispatch_stub_1164),
    TABLE_ENTRY(_dispatch_stub_1165),
    TABLE_ENTRY(_dispatch_stub_1166),
    TABLE_ENTRY(_dispatch_stub_1167),
+   TABLE_ENTRY(_dispatch_stub_1168),
    TABLE_ENTRY(SecondaryColor3f),
    TABLE_ENTRY(SecondaryColor3fv),
    TABLE_ENTRY(MultiDrawElements),
@@ -15293,8 +15302,7 @@ _glapi_proc UNUSED_TABLE_NAME[] = {
    TABLE_ENTRY(VertexAttribI4iv),
    TABLE_ENTRY(VertexAttribI4ui),
    TABLE_ENTRY(VertexAttribI4uiv),
-   TABLE_ENTRY(_dispatch_stub_1310),
-   TABLE_ENTRY(_dispatch_stub_1366),
+   TABLE_ENTRY(_dispatch_stub_1311),
    TABLE_ENTRY(_dispatch_stub_1367),
    TABLE_ENTRY(_dispatch_stub_1368),
    TABLE_ENTRY(_dispatch_stub_1369),
@@ -15339,6 +15347,7 @@ _glapi_proc UNUSED_TABLE_NAME[] = {
    TABLE_ENTRY(_dispatch_stub_1408),
    TABLE_ENTRY(_dispatch_stub_1409),
    TABLE_ENTRY(_dispatch_stub_1410),
+   TABLE_ENTRY(_dispatch_stub_1411),
 #endif /* _GLAPI_SKIP_NORMAL_ENTRY_POINTS */
 #ifndef _GLAPI_SKIP_PROTO_ENTRY_POINTS
    TABLE_ENTRY(AreTexturesResidentEXT),
@@ -1079,353 +1079,354 @@ void APIENTRY shared_dispatch_stub_1065(GLint location, GLint64 x, GLint64 y, GL
 void APIENTRY shared_dispatch_stub_1066(GLint location, GLsizei count, const GLint64 *value);
 void APIENTRY shared_dispatch_stub_1067(GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w);
 void APIENTRY shared_dispatch_stub_1068(GLint location, GLsizei count, const GLuint64 *value);
-void APIENTRY shared_dispatch_stub_1069(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue);
-void APIENTRY shared_dispatch_stub_1070(GLuint buffer);
-void APIENTRY shared_dispatch_stub_1071(GLuint buffer, GLintptr offset, GLsizeiptr length);
-void APIENTRY shared_dispatch_stub_1072(GLenum target, GLsizei numAttachments, const GLenum *attachments);
-void APIENTRY shared_dispatch_stub_1073(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height);
-void APIENTRY shared_dispatch_stub_1074(GLuint texture, GLint level);
-void APIENTRY shared_dispatch_stub_1075(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth);
-void APIENTRY shared_dispatch_stub_1076(GLfloat factor, GLfloat bias);
-void APIENTRY shared_dispatch_stub_1077(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height);
-void APIENTRY shared_dispatch_stub_1078(const GLfloat *coords);
-void APIENTRY shared_dispatch_stub_1079(GLint x, GLint y, GLint z, GLint width, GLint height);
-void APIENTRY shared_dispatch_stub_1080(const GLint *coords);
-void APIENTRY shared_dispatch_stub_1081(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height);
-void APIENTRY shared_dispatch_stub_1082(const GLshort *coords);
-void APIENTRY shared_dispatch_stub_1083(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height);
-void APIENTRY shared_dispatch_stub_1084(const GLfixed *coords);
-void APIENTRY shared_dispatch_stub_1085(GLenum type, GLsizei stride, const GLvoid *pointer);
-GLbitfield APIENTRY shared_dispatch_stub_1086(GLfixed *mantissa, GLint *exponent);
-void APIENTRY shared_dispatch_stub_1087(GLclampf value, GLboolean invert);
-void APIENTRY shared_dispatch_stub_1088(GLenum pattern);
-void APIENTRY shared_dispatch_stub_1089(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
-void APIENTRY shared_dispatch_stub_1090(GLsizei stride, GLsizei count, const GLboolean *pointer);
-void APIENTRY shared_dispatch_stub_1091(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
+void APIENTRY shared_dispatch_stub_1069(GLuint count);
+void APIENTRY shared_dispatch_stub_1070(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue);
+void APIENTRY shared_dispatch_stub_1071(GLuint buffer);
+void APIENTRY shared_dispatch_stub_1072(GLuint buffer, GLintptr offset, GLsizeiptr length);
+void APIENTRY shared_dispatch_stub_1073(GLenum target, GLsizei numAttachments, const GLenum *attachments);
+void APIENTRY shared_dispatch_stub_1074(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height);
+void APIENTRY shared_dispatch_stub_1075(GLuint texture, GLint level);
+void APIENTRY shared_dispatch_stub_1076(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth);
+void APIENTRY shared_dispatch_stub_1077(GLfloat factor, GLfloat bias);
+void APIENTRY shared_dispatch_stub_1078(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height);
+void APIENTRY shared_dispatch_stub_1079(const GLfloat *coords);
+void APIENTRY shared_dispatch_stub_1080(GLint x, GLint y, GLint z, GLint width, GLint height);
+void APIENTRY shared_dispatch_stub_1081(const GLint *coords);
+void APIENTRY shared_dispatch_stub_1082(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height);
+void APIENTRY shared_dispatch_stub_1083(const GLshort *coords);
+void APIENTRY shared_dispatch_stub_1084(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height);
+void APIENTRY shared_dispatch_stub_1085(const GLfixed *coords);
+void APIENTRY shared_dispatch_stub_1086(GLenum type, GLsizei stride, const GLvoid *pointer);
+GLbitfield APIENTRY shared_dispatch_stub_1087(GLfixed *mantissa, GLint *exponent);
+void APIENTRY shared_dispatch_stub_1088(GLclampf value, GLboolean invert);
+void APIENTRY shared_dispatch_stub_1089(GLenum pattern);
+void APIENTRY shared_dispatch_stub_1090(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
+void APIENTRY shared_dispatch_stub_1091(GLsizei stride, GLsizei count, const GLboolean *pointer);
 void APIENTRY shared_dispatch_stub_1092(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
-void APIENTRY shared_dispatch_stub_1093(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
+void APIENTRY shared_dispatch_stub_1093(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
 void APIENTRY shared_dispatch_stub_1094(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
-void APIENTRY shared_dispatch_stub_1095(GLenum target, GLsizei numAttachments, const GLenum *attachments);
-void APIENTRY shared_dispatch_stub_1096(GLuint pipeline, GLuint program);
-void APIENTRY shared_dispatch_stub_1097(GLuint pipeline);
-GLuint APIENTRY shared_dispatch_stub_1098(GLenum type, GLsizei count, const GLchar * const *strings);
-void APIENTRY shared_dispatch_stub_1099(GLsizei n, const GLuint *pipelines);
-void APIENTRY shared_dispatch_stub_1100(GLsizei n, GLuint *pipelines);
-void APIENTRY shared_dispatch_stub_1101(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
-void APIENTRY shared_dispatch_stub_1102(GLuint pipeline, GLenum pname, GLint *params);
-GLboolean APIENTRY shared_dispatch_stub_1103(GLuint pipeline);
-void APIENTRY shared_dispatch_stub_1104(GLint first, GLsizei count);
-void APIENTRY shared_dispatch_stub_1105(GLuint program, GLint location, GLdouble x);
-void APIENTRY shared_dispatch_stub_1106(GLuint program, GLint location, GLsizei count, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1107(GLuint program, GLint location, GLfloat x);
-void APIENTRY shared_dispatch_stub_1108(GLuint program, GLint location, GLsizei count, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1109(GLuint program, GLint location, GLint x);
-void APIENTRY shared_dispatch_stub_1110(GLuint program, GLint location, GLsizei count, const GLint *value);
-void APIENTRY shared_dispatch_stub_1111(GLuint program, GLint location, GLuint x);
-void APIENTRY shared_dispatch_stub_1112(GLuint program, GLint location, GLsizei count, const GLuint *value);
-void APIENTRY shared_dispatch_stub_1113(GLuint program, GLint location, GLdouble x, GLdouble y);
-void APIENTRY shared_dispatch_stub_1114(GLuint program, GLint location, GLsizei count, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1115(GLuint program, GLint location, GLfloat x, GLfloat y);
-void APIENTRY shared_dispatch_stub_1116(GLuint program, GLint location, GLsizei count, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1117(GLuint program, GLint location, GLint x, GLint y);
-void APIENTRY shared_dispatch_stub_1118(GLuint program, GLint location, GLsizei count, const GLint *value);
-void APIENTRY shared_dispatch_stub_1119(GLuint program, GLint location, GLuint x, GLuint y);
-void APIENTRY shared_dispatch_stub_1120(GLuint program, GLint location, GLsizei count, const GLuint *value);
-void APIENTRY shared_dispatch_stub_1121(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z);
-void APIENTRY shared_dispatch_stub_1122(GLuint program, GLint location, GLsizei count, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1123(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z);
-void APIENTRY shared_dispatch_stub_1124(GLuint program, GLint location, GLsizei count, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1125(GLuint program, GLint location, GLint x, GLint y, GLint z);
-void APIENTRY shared_dispatch_stub_1126(GLuint program, GLint location, GLsizei count, const GLint *value);
-void APIENTRY shared_dispatch_stub_1127(GLuint program, GLint location, GLuint x, GLuint y, GLuint z);
-void APIENTRY shared_dispatch_stub_1128(GLuint program, GLint location, GLsizei count, const GLuint *value);
-void APIENTRY shared_dispatch_stub_1129(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
-void APIENTRY shared_dispatch_stub_1130(GLuint program, GLint location, GLsizei count, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1131(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
-void APIENTRY shared_dispatch_stub_1132(GLuint program, GLint location, GLsizei count, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1133(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w);
-void APIENTRY shared_dispatch_stub_1134(GLuint program, GLint location, GLsizei count, const GLint *value);
-void APIENTRY shared_dispatch_stub_1135(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w);
-void APIENTRY shared_dispatch_stub_1136(GLuint program, GLint location, GLsizei count, const GLuint *value);
-void APIENTRY shared_dispatch_stub_1137(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1138(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1139(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1140(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1141(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1142(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1143(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1144(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1145(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1146(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1147(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1148(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1149(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1150(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1151(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1152(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1153(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
-void APIENTRY shared_dispatch_stub_1154(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1155(void);
-void APIENTRY shared_dispatch_stub_1156(GLuint pipeline, GLbitfield stages, GLuint program);
-void APIENTRY shared_dispatch_stub_1157(GLuint pipeline);
-void APIENTRY shared_dispatch_stub_1158(GLDEBUGPROC callback, const GLvoid *userParam);
-void APIENTRY shared_dispatch_stub_1159(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled);
-void APIENTRY shared_dispatch_stub_1160(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf);
-GLuint APIENTRY shared_dispatch_stub_1161(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog);
-void APIENTRY shared_dispatch_stub_1162(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label);
-void APIENTRY shared_dispatch_stub_1163(const GLvoid *ptr, GLsizei bufSize, GLsizei *length, GLchar *label);
-void APIENTRY shared_dispatch_stub_1164(GLenum identifier, GLuint name, GLsizei length, const GLchar *label);
-void APIENTRY shared_dispatch_stub_1165(const GLvoid *ptr, GLsizei length, const GLchar *label);
-void APIENTRY shared_dispatch_stub_1166(void);
-void APIENTRY shared_dispatch_stub_1167(GLenum source, GLuint id, GLsizei length, const GLchar *message);
-void APIENTRY shared_dispatch_stub_1168(GLfloat red, GLfloat green, GLfloat blue);
-void APIENTRY shared_dispatch_stub_1169(const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1170(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount);
-void APIENTRY shared_dispatch_stub_1171(GLfloat coord);
-void APIENTRY shared_dispatch_stub_1172(const GLfloat *coord);
-void APIENTRY shared_dispatch_stub_1173(void);
-void APIENTRY shared_dispatch_stub_1174(GLdouble x, GLdouble y, GLdouble z, GLdouble w);
-void APIENTRY shared_dispatch_stub_1175(const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1176(GLfloat x, GLfloat y, GLfloat z, GLfloat w);
-void APIENTRY shared_dispatch_stub_1177(const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1178(GLint x, GLint y, GLint z, GLint w);
-void APIENTRY shared_dispatch_stub_1179(const GLint *v);
-void APIENTRY shared_dispatch_stub_1180(GLshort x, GLshort y, GLshort z, GLshort w);
-void APIENTRY shared_dispatch_stub_1181(const GLshort *v);
-void APIENTRY shared_dispatch_stub_1182(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride);
-void APIENTRY shared_dispatch_stub_1183(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride);
-GLboolean APIENTRY shared_dispatch_stub_1184(GLsizei n, const GLuint *ids, GLboolean *residences);
-void APIENTRY shared_dispatch_stub_1185(GLenum target, GLuint id, const GLfloat *params);
-void APIENTRY shared_dispatch_stub_1186(GLenum target, GLuint index, GLenum pname, GLdouble *params);
-void APIENTRY shared_dispatch_stub_1187(GLenum target, GLuint index, GLenum pname, GLfloat *params);
-void APIENTRY shared_dispatch_stub_1188(GLuint id, GLenum pname, GLubyte *program);
-void APIENTRY shared_dispatch_stub_1189(GLuint id, GLenum pname, GLint *params);
-void APIENTRY shared_dispatch_stub_1190(GLenum target, GLuint address, GLenum pname, GLint *params);
-void APIENTRY shared_dispatch_stub_1191(GLuint index, GLenum pname, GLdouble *params);
-void APIENTRY shared_dispatch_stub_1192(GLuint index, GLenum pname, GLfloat *params);
-void APIENTRY shared_dispatch_stub_1193(GLuint index, GLenum pname, GLint *params);
-void APIENTRY shared_dispatch_stub_1194(GLenum target, GLuint id, GLsizei len, const GLubyte *program);
-void APIENTRY shared_dispatch_stub_1195(GLenum target, GLuint index, GLsizei num, const GLdouble *params);
-void APIENTRY shared_dispatch_stub_1196(GLenum target, GLuint index, GLsizei num, const GLfloat *params);
-void APIENTRY shared_dispatch_stub_1197(GLsizei n, const GLuint *ids);
-void APIENTRY shared_dispatch_stub_1198(GLenum target, GLuint address, GLenum matrix, GLenum transform);
-void APIENTRY shared_dispatch_stub_1199(GLuint index, GLdouble x);
-void APIENTRY shared_dispatch_stub_1200(GLuint index, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1201(GLuint index, GLfloat x);
-void APIENTRY shared_dispatch_stub_1202(GLuint index, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1203(GLuint index, GLshort x);
-void APIENTRY shared_dispatch_stub_1204(GLuint index, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1205(GLuint index, GLdouble x, GLdouble y);
-void APIENTRY shared_dispatch_stub_1206(GLuint index, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1207(GLuint index, GLfloat x, GLfloat y);
-void APIENTRY shared_dispatch_stub_1208(GLuint index, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1209(GLuint index, GLshort x, GLshort y);
-void APIENTRY shared_dispatch_stub_1210(GLuint index, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1211(GLuint index, GLdouble x, GLdouble y, GLdouble z);
-void APIENTRY shared_dispatch_stub_1212(GLuint index, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1213(GLuint index, GLfloat x, GLfloat y, GLfloat z);
-void APIENTRY shared_dispatch_stub_1214(GLuint index, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1215(GLuint index, GLshort x, GLshort y, GLshort z);
-void APIENTRY shared_dispatch_stub_1216(GLuint index, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1217(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
-void APIENTRY shared_dispatch_stub_1218(GLuint index, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1219(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
-void APIENTRY shared_dispatch_stub_1220(GLuint index, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1221(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
-void APIENTRY shared_dispatch_stub_1222(GLuint index, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1223(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
-void APIENTRY shared_dispatch_stub_1224(GLuint index, const GLubyte *v);
-void APIENTRY shared_dispatch_stub_1225(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
-void APIENTRY shared_dispatch_stub_1226(GLuint index, GLsizei n, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1227(GLuint index, GLsizei n, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1228(GLuint index, GLsizei n, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1229(GLuint index, GLsizei n, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1230(GLuint index, GLsizei n, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1231(GLuint index, GLsizei n, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1232(GLuint index, GLsizei n, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1233(GLuint index, GLsizei n, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1234(GLuint index, GLsizei n, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1235(GLuint index, GLsizei n, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1236(GLuint index, GLsizei n, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1237(GLuint index, GLsizei n, const GLshort *v);
-void APIENTRY shared_dispatch_stub_1238(GLuint index, GLsizei n, const GLubyte *v);
-void APIENTRY shared_dispatch_stub_1239(GLenum pname, GLfloat *param);
-void APIENTRY shared_dispatch_stub_1240(GLenum pname, GLint *param);
-void APIENTRY shared_dispatch_stub_1241(GLenum pname, const GLfloat *param);
-void APIENTRY shared_dispatch_stub_1242(GLenum pname, const GLint *param);
-void APIENTRY shared_dispatch_stub_1243(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
-void APIENTRY shared_dispatch_stub_1244(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
-void APIENTRY shared_dispatch_stub_1245(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
-void APIENTRY shared_dispatch_stub_1246(void);
-void APIENTRY shared_dispatch_stub_1247(GLuint id);
-void APIENTRY shared_dispatch_stub_1248(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
-void APIENTRY shared_dispatch_stub_1249(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
-void APIENTRY shared_dispatch_stub_1250(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
-void APIENTRY shared_dispatch_stub_1251(GLuint id);
-void APIENTRY shared_dispatch_stub_1252(void);
-GLuint APIENTRY shared_dispatch_stub_1253(GLuint range);
-void APIENTRY shared_dispatch_stub_1254(GLuint dst, GLuint coord, GLenum swizzle);
-void APIENTRY shared_dispatch_stub_1255(GLuint dst, GLuint interp, GLenum swizzle);
-void APIENTRY shared_dispatch_stub_1256(GLuint dst, const GLfloat *value);
-void APIENTRY shared_dispatch_stub_1257(GLuint first, GLsizei count, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1258(GLuint index, GLfloat n, GLfloat f);
-void APIENTRY shared_dispatch_stub_1259(GLenum face);
-void APIENTRY shared_dispatch_stub_1260(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params);
-void APIENTRY shared_dispatch_stub_1261(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params);
-void APIENTRY shared_dispatch_stub_1262(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
-void APIENTRY shared_dispatch_stub_1263(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v);
-void APIENTRY shared_dispatch_stub_1264(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
-void APIENTRY shared_dispatch_stub_1265(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v);
-void APIENTRY shared_dispatch_stub_1266(void);
-void APIENTRY shared_dispatch_stub_1267(GLenum coord, GLenum pname, GLfixed *params);
-void APIENTRY shared_dispatch_stub_1268(GLenum coord, GLenum pname, GLint param);
-void APIENTRY shared_dispatch_stub_1269(GLenum coord, GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1270(GLclampd zmin, GLclampd zmax);
-void APIENTRY shared_dispatch_stub_1271(GLenum target, GLuint framebuffer);
-void APIENTRY shared_dispatch_stub_1272(GLenum target, GLuint renderbuffer);
-void APIENTRY shared_dispatch_stub_1273(GLsizei len, const GLvoid *string);
-void APIENTRY shared_dispatch_stub_1274(GLenum target, GLenum pname, GLint param);
-void APIENTRY shared_dispatch_stub_1275(GLenum target, GLintptr offset, GLsizeiptr size);
-void APIENTRY shared_dispatch_stub_1276(GLuint index, GLint x);
-void APIENTRY shared_dispatch_stub_1277(GLuint index, GLuint x);
-void APIENTRY shared_dispatch_stub_1278(GLuint index, GLint x, GLint y);
-void APIENTRY shared_dispatch_stub_1279(GLuint index, const GLint *v);
-void APIENTRY shared_dispatch_stub_1280(GLuint index, GLuint x, GLuint y);
-void APIENTRY shared_dispatch_stub_1281(GLuint index, const GLuint *v);
-void APIENTRY shared_dispatch_stub_1282(GLuint index, GLint x, GLint y, GLint z);
-void APIENTRY shared_dispatch_stub_1283(GLuint index, const GLint *v);
-void APIENTRY shared_dispatch_stub_1284(GLuint index, GLuint x, GLuint y, GLuint z);
-void APIENTRY shared_dispatch_stub_1285(GLuint index, const GLuint *v);
-void APIENTRY shared_dispatch_stub_1286(GLuint index, GLint x, GLint y, GLint z, GLint w);
-void APIENTRY shared_dispatch_stub_1287(GLuint index, const GLint *v);
-void APIENTRY shared_dispatch_stub_1288(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
-void APIENTRY shared_dispatch_stub_1289(GLuint index, const GLuint *v);
-void APIENTRY shared_dispatch_stub_1290(GLint r, GLint g, GLint b, GLint a);
-void APIENTRY shared_dispatch_stub_1291(GLuint r, GLuint g, GLuint b, GLuint a);
-void APIENTRY shared_dispatch_stub_1292(GLenum target, GLuint index, GLuint buffer, GLintptr offset);
-void APIENTRY shared_dispatch_stub_1293(GLuint monitor);
-void APIENTRY shared_dispatch_stub_1294(GLsizei n, GLuint *monitors);
-void APIENTRY shared_dispatch_stub_1295(GLuint monitor);
-void APIENTRY shared_dispatch_stub_1296(GLsizei n, GLuint *monitors);
-void APIENTRY shared_dispatch_stub_1297(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten);
-void APIENTRY shared_dispatch_stub_1298(GLuint group, GLuint counter, GLenum pname, GLvoid *data);
-void APIENTRY shared_dispatch_stub_1299(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString);
-void APIENTRY shared_dispatch_stub_1300(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters);
-void APIENTRY shared_dispatch_stub_1301(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString);
-void APIENTRY shared_dispatch_stub_1302(GLint *numGroups, GLsizei groupsSize, GLuint *groups);
-void APIENTRY shared_dispatch_stub_1303(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList);
-void APIENTRY shared_dispatch_stub_1304(GLenum objectType, GLuint name, GLenum pname, GLint *value);
-GLenum APIENTRY shared_dispatch_stub_1305(GLenum objectType, GLuint name, GLenum option);
+void APIENTRY shared_dispatch_stub_1095(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer);
+void APIENTRY shared_dispatch_stub_1096(GLenum target, GLsizei numAttachments, const GLenum *attachments);
+void APIENTRY shared_dispatch_stub_1097(GLuint pipeline, GLuint program);
+void APIENTRY shared_dispatch_stub_1098(GLuint pipeline);
+GLuint APIENTRY shared_dispatch_stub_1099(GLenum type, GLsizei count, const GLchar * const *strings);
+void APIENTRY shared_dispatch_stub_1100(GLsizei n, const GLuint *pipelines);
+void APIENTRY shared_dispatch_stub_1101(GLsizei n, GLuint *pipelines);
+void APIENTRY shared_dispatch_stub_1102(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void APIENTRY shared_dispatch_stub_1103(GLuint pipeline, GLenum pname, GLint *params);
+GLboolean APIENTRY shared_dispatch_stub_1104(GLuint pipeline);
+void APIENTRY shared_dispatch_stub_1105(GLint first, GLsizei count);
+void APIENTRY shared_dispatch_stub_1106(GLuint program, GLint location, GLdouble x);
+void APIENTRY shared_dispatch_stub_1107(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1108(GLuint program, GLint location, GLfloat x);
+void APIENTRY shared_dispatch_stub_1109(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1110(GLuint program, GLint location, GLint x);
+void APIENTRY shared_dispatch_stub_1111(GLuint program, GLint location, GLsizei count, const GLint *value);
+void APIENTRY shared_dispatch_stub_1112(GLuint program, GLint location, GLuint x);
+void APIENTRY shared_dispatch_stub_1113(GLuint program, GLint location, GLsizei count, const GLuint *value);
+void APIENTRY shared_dispatch_stub_1114(GLuint program, GLint location, GLdouble x, GLdouble y);
+void APIENTRY shared_dispatch_stub_1115(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1116(GLuint program, GLint location, GLfloat x, GLfloat y);
+void APIENTRY shared_dispatch_stub_1117(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1118(GLuint program, GLint location, GLint x, GLint y);
+void APIENTRY shared_dispatch_stub_1119(GLuint program, GLint location, GLsizei count, const GLint *value);
+void APIENTRY shared_dispatch_stub_1120(GLuint program, GLint location, GLuint x, GLuint y);
+void APIENTRY shared_dispatch_stub_1121(GLuint program, GLint location, GLsizei count, const GLuint *value);
+void APIENTRY shared_dispatch_stub_1122(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z);
+void APIENTRY shared_dispatch_stub_1123(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1124(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z);
+void APIENTRY shared_dispatch_stub_1125(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1126(GLuint program, GLint location, GLint x, GLint y, GLint z);
+void APIENTRY shared_dispatch_stub_1127(GLuint program, GLint location, GLsizei count, const GLint *value);
+void APIENTRY shared_dispatch_stub_1128(GLuint program, GLint location, GLuint x, GLuint y, GLuint z);
+void APIENTRY shared_dispatch_stub_1129(GLuint program, GLint location, GLsizei count, const GLuint *value);
+void APIENTRY shared_dispatch_stub_1130(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void APIENTRY shared_dispatch_stub_1131(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1132(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void APIENTRY shared_dispatch_stub_1133(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1134(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w);
+void APIENTRY shared_dispatch_stub_1135(GLuint program, GLint location, GLsizei count, const GLint *value);
+void APIENTRY shared_dispatch_stub_1136(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w);
+void APIENTRY shared_dispatch_stub_1137(GLuint program, GLint location, GLsizei count, const GLuint *value);
+void APIENTRY shared_dispatch_stub_1138(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1139(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1140(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1141(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1142(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1143(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1144(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1145(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1146(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1147(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1148(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1149(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1150(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1151(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1152(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1153(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1154(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+void APIENTRY shared_dispatch_stub_1155(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1156(void);
+void APIENTRY shared_dispatch_stub_1157(GLuint pipeline, GLbitfield stages, GLuint program);
+void APIENTRY shared_dispatch_stub_1158(GLuint pipeline);
+void APIENTRY shared_dispatch_stub_1159(GLDEBUGPROC callback, const GLvoid *userParam);
+void APIENTRY shared_dispatch_stub_1160(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled);
+void APIENTRY shared_dispatch_stub_1161(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf);
+GLuint APIENTRY shared_dispatch_stub_1162(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog);
+void APIENTRY shared_dispatch_stub_1163(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label);
+void APIENTRY shared_dispatch_stub_1164(const GLvoid *ptr, GLsizei bufSize, GLsizei *length, GLchar *label);
+void APIENTRY shared_dispatch_stub_1165(GLenum identifier, GLuint name, GLsizei length, const GLchar *label);
+void APIENTRY shared_dispatch_stub_1166(const GLvoid *ptr, GLsizei length, const GLchar *label);
+void APIENTRY shared_dispatch_stub_1167(void);
+void APIENTRY shared_dispatch_stub_1168(GLenum source, GLuint id, GLsizei length, const GLchar *message);
+void APIENTRY shared_dispatch_stub_1169(GLfloat red, GLfloat green, GLfloat blue);
+void APIENTRY shared_dispatch_stub_1170(const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1171(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount);
+void APIENTRY shared_dispatch_stub_1172(GLfloat coord);
+void APIENTRY shared_dispatch_stub_1173(const GLfloat *coord);
+void APIENTRY shared_dispatch_stub_1174(void);
+void APIENTRY shared_dispatch_stub_1175(GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void APIENTRY shared_dispatch_stub_1176(const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1177(GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void APIENTRY shared_dispatch_stub_1178(const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1179(GLint x, GLint y, GLint z, GLint w);
+void APIENTRY shared_dispatch_stub_1180(const GLint *v);
+void APIENTRY shared_dispatch_stub_1181(GLshort x, GLshort y, GLshort z, GLshort w);
+void APIENTRY shared_dispatch_stub_1182(const GLshort *v);
+void APIENTRY shared_dispatch_stub_1183(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride);
+void APIENTRY shared_dispatch_stub_1184(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride);
+GLboolean APIENTRY shared_dispatch_stub_1185(GLsizei n, const GLuint *ids, GLboolean *residences);
+void APIENTRY shared_dispatch_stub_1186(GLenum target, GLuint id, const GLfloat *params);
+void APIENTRY shared_dispatch_stub_1187(GLenum target, GLuint index, GLenum pname, GLdouble *params);
+void APIENTRY shared_dispatch_stub_1188(GLenum target, GLuint index, GLenum pname, GLfloat *params);
+void APIENTRY shared_dispatch_stub_1189(GLuint id, GLenum pname, GLubyte *program);
+void APIENTRY shared_dispatch_stub_1190(GLuint id, GLenum pname, GLint *params);
+void APIENTRY shared_dispatch_stub_1191(GLenum target, GLuint address, GLenum pname, GLint *params);
+void APIENTRY shared_dispatch_stub_1192(GLuint index, GLenum pname, GLdouble *params);
+void APIENTRY shared_dispatch_stub_1193(GLuint index, GLenum pname, GLfloat *params);
+void APIENTRY shared_dispatch_stub_1194(GLuint index, GLenum pname, GLint *params);
+void APIENTRY shared_dispatch_stub_1195(GLenum target, GLuint id, GLsizei len, const GLubyte *program);
+void APIENTRY shared_dispatch_stub_1196(GLenum target, GLuint index, GLsizei num, const GLdouble *params);
+void APIENTRY shared_dispatch_stub_1197(GLenum target, GLuint index, GLsizei num, const GLfloat *params);
+void APIENTRY shared_dispatch_stub_1198(GLsizei n, const GLuint *ids);
+void APIENTRY shared_dispatch_stub_1199(GLenum target, GLuint address, GLenum matrix, GLenum transform);
+void APIENTRY shared_dispatch_stub_1200(GLuint index, GLdouble x);
+void APIENTRY shared_dispatch_stub_1201(GLuint index, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1202(GLuint index, GLfloat x);
+void APIENTRY shared_dispatch_stub_1203(GLuint index, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1204(GLuint index, GLshort x);
+void APIENTRY shared_dispatch_stub_1205(GLuint index, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1206(GLuint index, GLdouble x, GLdouble y);
+void APIENTRY shared_dispatch_stub_1207(GLuint index, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1208(GLuint index, GLfloat x, GLfloat y);
+void APIENTRY shared_dispatch_stub_1209(GLuint index, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1210(GLuint index, GLshort x, GLshort y);
+void APIENTRY shared_dispatch_stub_1211(GLuint index, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1212(GLuint index, GLdouble x, GLdouble y, GLdouble z);
+void APIENTRY shared_dispatch_stub_1213(GLuint index, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1214(GLuint index, GLfloat x, GLfloat y, GLfloat z);
+void APIENTRY shared_dispatch_stub_1215(GLuint index, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1216(GLuint index, GLshort x, GLshort y, GLshort z);
+void APIENTRY shared_dispatch_stub_1217(GLuint index, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1218(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void APIENTRY shared_dispatch_stub_1219(GLuint index, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1220(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void APIENTRY shared_dispatch_stub_1221(GLuint index, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1222(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
+void APIENTRY shared_dispatch_stub_1223(GLuint index, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1224(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
+void APIENTRY shared_dispatch_stub_1225(GLuint index, const GLubyte *v);
+void APIENTRY shared_dispatch_stub_1226(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer);
+void APIENTRY shared_dispatch_stub_1227(GLuint index, GLsizei n, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1228(GLuint index, GLsizei n, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1229(GLuint index, GLsizei n, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1230(GLuint index, GLsizei n, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1231(GLuint index, GLsizei n, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1232(GLuint index, GLsizei n, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1233(GLuint index, GLsizei n, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1234(GLuint index, GLsizei n, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1235(GLuint index, GLsizei n, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1236(GLuint index, GLsizei n, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1237(GLuint index, GLsizei n, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1238(GLuint index, GLsizei n, const GLshort *v);
+void APIENTRY shared_dispatch_stub_1239(GLuint index, GLsizei n, const GLubyte *v);
+void APIENTRY shared_dispatch_stub_1240(GLenum pname, GLfloat *param);
+void APIENTRY shared_dispatch_stub_1241(GLenum pname, GLint *param);
+void APIENTRY shared_dispatch_stub_1242(GLenum pname, const GLfloat *param);
+void APIENTRY shared_dispatch_stub_1243(GLenum pname, const GLint *param);
+void APIENTRY shared_dispatch_stub_1244(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
+void APIENTRY shared_dispatch_stub_1245(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
+void APIENTRY shared_dispatch_stub_1246(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
+void APIENTRY shared_dispatch_stub_1247(void);
+void APIENTRY shared_dispatch_stub_1248(GLuint id);
+void APIENTRY shared_dispatch_stub_1249(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod);
+void APIENTRY shared_dispatch_stub_1250(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod);
+void APIENTRY shared_dispatch_stub_1251(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod);
+void APIENTRY shared_dispatch_stub_1252(GLuint id);
+void APIENTRY shared_dispatch_stub_1253(void);
+GLuint APIENTRY shared_dispatch_stub_1254(GLuint range);
+void APIENTRY shared_dispatch_stub_1255(GLuint dst, GLuint coord, GLenum swizzle);
+void APIENTRY shared_dispatch_stub_1256(GLuint dst, GLuint interp, GLenum swizzle);
+void APIENTRY shared_dispatch_stub_1257(GLuint dst, const GLfloat *value);
+void APIENTRY shared_dispatch_stub_1258(GLuint first, GLsizei count, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1259(GLuint index, GLfloat n, GLfloat f);
+void APIENTRY shared_dispatch_stub_1260(GLenum face);
+void APIENTRY shared_dispatch_stub_1261(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params);
+void APIENTRY shared_dispatch_stub_1262(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params);
+void APIENTRY shared_dispatch_stub_1263(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void APIENTRY shared_dispatch_stub_1264(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v);
+void APIENTRY shared_dispatch_stub_1265(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void APIENTRY shared_dispatch_stub_1266(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v);
+void APIENTRY shared_dispatch_stub_1267(void);
+void APIENTRY shared_dispatch_stub_1268(GLenum coord, GLenum pname, GLfixed *params);
+void APIENTRY shared_dispatch_stub_1269(GLenum coord, GLenum pname, GLint param);
+void APIENTRY shared_dispatch_stub_1270(GLenum coord, GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1271(GLclampd zmin, GLclampd zmax);
+void APIENTRY shared_dispatch_stub_1272(GLenum target, GLuint framebuffer);
+void APIENTRY shared_dispatch_stub_1273(GLenum target, GLuint renderbuffer);
+void APIENTRY shared_dispatch_stub_1274(GLsizei len, const GLvoid *string);
+void APIENTRY shared_dispatch_stub_1275(GLenum target, GLenum pname, GLint param);
+void APIENTRY shared_dispatch_stub_1276(GLenum target, GLintptr offset, GLsizeiptr size);
+void APIENTRY shared_dispatch_stub_1277(GLuint index, GLint x);
+void APIENTRY shared_dispatch_stub_1278(GLuint index, GLuint x);
+void APIENTRY shared_dispatch_stub_1279(GLuint index, GLint x, GLint y);
+void APIENTRY shared_dispatch_stub_1280(GLuint index, const GLint *v);
+void APIENTRY shared_dispatch_stub_1281(GLuint index, GLuint x, GLuint y);
+void APIENTRY shared_dispatch_stub_1282(GLuint index, const GLuint *v);
+void APIENTRY shared_dispatch_stub_1283(GLuint index, GLint x, GLint y, GLint z);
+void APIENTRY shared_dispatch_stub_1284(GLuint index, const GLint *v);
+void APIENTRY shared_dispatch_stub_1285(GLuint index, GLuint x, GLuint y, GLuint z);
+void APIENTRY shared_dispatch_stub_1286(GLuint index, const GLuint *v);
+void APIENTRY shared_dispatch_stub_1287(GLuint index, GLint x, GLint y, GLint z, GLint w);
+void APIENTRY shared_dispatch_stub_1288(GLuint index, const GLint *v);
+void APIENTRY shared_dispatch_stub_1289(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
+void APIENTRY shared_dispatch_stub_1290(GLuint index, const GLuint *v);
+void APIENTRY shared_dispatch_stub_1291(GLint r, GLint g, GLint b, GLint a);
+void APIENTRY shared_dispatch_stub_1292(GLuint r, GLuint g, GLuint b, GLuint a);
+void APIENTRY shared_dispatch_stub_1293(GLenum target, GLuint index, GLuint buffer, GLintptr offset);
+void APIENTRY shared_dispatch_stub_1294(GLuint monitor);
+void APIENTRY shared_dispatch_stub_1295(GLsizei n, GLuint *monitors);
+void APIENTRY shared_dispatch_stub_1296(GLuint monitor);
+void APIENTRY shared_dispatch_stub_1297(GLsizei n, GLuint *monitors);
+void APIENTRY shared_dispatch_stub_1298(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten);
+void APIENTRY shared_dispatch_stub_1299(GLuint group, GLuint counter, GLenum pname, GLvoid *data);
+void APIENTRY shared_dispatch_stub_1300(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString);
+void APIENTRY shared_dispatch_stub_1301(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters);
+void APIENTRY shared_dispatch_stub_1302(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString);
+void APIENTRY shared_dispatch_stub_1303(GLint *numGroups, GLsizei groupsSize, GLuint *groups);
+void APIENTRY shared_dispatch_stub_1304(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList);
+void APIENTRY shared_dispatch_stub_1305(GLenum objectType, GLuint name, GLenum pname, GLint *value);
 GLenum APIENTRY shared_dispatch_stub_1306(GLenum objectType, GLuint name, GLenum option);
-void APIENTRY shared_dispatch_stub_1307(GLuint program);
-GLuint APIENTRY shared_dispatch_stub_1308(GLenum type, const GLchar *string);
-void APIENTRY shared_dispatch_stub_1309(GLenum type, GLuint program);
-void APIENTRY shared_dispatch_stub_1310(void);
+GLenum APIENTRY shared_dispatch_stub_1307(GLenum objectType, GLuint name, GLenum option);
+void APIENTRY shared_dispatch_stub_1308(GLuint program);
+GLuint APIENTRY shared_dispatch_stub_1309(GLenum type, const GLchar *string);
+void APIENTRY shared_dispatch_stub_1310(GLenum type, GLuint program);
 void APIENTRY shared_dispatch_stub_1311(void);
-void APIENTRY shared_dispatch_stub_1312(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
-void APIENTRY shared_dispatch_stub_1313(const GLvoid *vdpDevice, const GLvoid *getProcAddress);
-GLboolean APIENTRY shared_dispatch_stub_1314(GLintptr surface);
-void APIENTRY shared_dispatch_stub_1315(GLsizei numSurfaces, const GLintptr *surfaces);
-GLintptr APIENTRY shared_dispatch_stub_1316(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames);
+void APIENTRY shared_dispatch_stub_1312(void);
+void APIENTRY shared_dispatch_stub_1313(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
+void APIENTRY shared_dispatch_stub_1314(const GLvoid *vdpDevice, const GLvoid *getProcAddress);
+GLboolean APIENTRY shared_dispatch_stub_1315(GLintptr surface);
+void APIENTRY shared_dispatch_stub_1316(GLsizei numSurfaces, const GLintptr *surfaces);
 GLintptr APIENTRY shared_dispatch_stub_1317(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames);
-void APIENTRY shared_dispatch_stub_1318(GLintptr surface, GLenum access);
-void APIENTRY shared_dispatch_stub_1319(GLsizei numSurfaces, const GLintptr *surfaces);
-void APIENTRY shared_dispatch_stub_1320(GLintptr surface);
-void APIENTRY shared_dispatch_stub_1321(GLuint queryHandle);
-void APIENTRY shared_dispatch_stub_1322(GLuint queryId, GLuint *queryHandle);
-void APIENTRY shared_dispatch_stub_1323(GLuint queryHandle);
+GLintptr APIENTRY shared_dispatch_stub_1318(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames);
+void APIENTRY shared_dispatch_stub_1319(GLintptr surface, GLenum access);
+void APIENTRY shared_dispatch_stub_1320(GLsizei numSurfaces, const GLintptr *surfaces);
+void APIENTRY shared_dispatch_stub_1321(GLintptr surface);
+void APIENTRY shared_dispatch_stub_1322(GLuint queryHandle);
+void APIENTRY shared_dispatch_stub_1323(GLuint queryId, GLuint *queryHandle);
 void APIENTRY shared_dispatch_stub_1324(GLuint queryHandle);
-void APIENTRY shared_dispatch_stub_1325(GLuint *queryId);
-void APIENTRY shared_dispatch_stub_1326(GLuint queryId, GLuint *nextQueryId);
-void APIENTRY shared_dispatch_stub_1327(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue);
-void APIENTRY shared_dispatch_stub_1328(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten);
-void APIENTRY shared_dispatch_stub_1329(GLchar *queryName, GLuint *queryId);
-void APIENTRY shared_dispatch_stub_1330(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask);
-void APIENTRY shared_dispatch_stub_1331(GLfloat factor, GLfloat units, GLfloat clamp);
-void APIENTRY shared_dispatch_stub_1332(GLenum mode, GLsizei count, const GLint *box);
-void APIENTRY shared_dispatch_stub_1333(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1334(GLsizei n, GLuint *memoryObjects);
-void APIENTRY shared_dispatch_stub_1335(GLsizei n, const GLuint *memoryObjects);
-void APIENTRY shared_dispatch_stub_1336(GLsizei n, const GLuint *semaphores);
-void APIENTRY shared_dispatch_stub_1337(GLsizei n, GLuint *semaphores);
-void APIENTRY shared_dispatch_stub_1338(GLuint memoryObject, GLenum pname, GLint *params);
-void APIENTRY shared_dispatch_stub_1339(GLuint semaphore, GLenum pname, GLuint64 *params);
-void APIENTRY shared_dispatch_stub_1340(GLenum target, GLuint index, GLubyte *data);
-void APIENTRY shared_dispatch_stub_1341(GLenum pname, GLubyte *data);
-GLboolean APIENTRY shared_dispatch_stub_1342(GLuint memoryObject);
-GLboolean APIENTRY shared_dispatch_stub_1343(GLuint semaphore);
-void APIENTRY shared_dispatch_stub_1344(GLuint memoryObject, GLenum pname, const GLint *params);
-void APIENTRY shared_dispatch_stub_1345(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1346(GLuint semaphore, GLenum pname, const GLuint64 *params);
-void APIENTRY shared_dispatch_stub_1347(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts);
-void APIENTRY shared_dispatch_stub_1348(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1349(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1350(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1351(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1352(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1353(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1354(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1355(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1356(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1357(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
-void APIENTRY shared_dispatch_stub_1358(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts);
-void APIENTRY shared_dispatch_stub_1359(GLuint memory, GLuint64 size, GLenum handleType, GLint fd);
-void APIENTRY shared_dispatch_stub_1360(GLuint semaphore, GLenum handleType, GLint fd);
-void APIENTRY shared_dispatch_stub_1361(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask);
-void APIENTRY shared_dispatch_stub_1362(GLenum target, GLuint index, GLsizei count, const GLfloat *params);
+void APIENTRY shared_dispatch_stub_1325(GLuint queryHandle);
+void APIENTRY shared_dispatch_stub_1326(GLuint *queryId);
+void APIENTRY shared_dispatch_stub_1327(GLuint queryId, GLuint *nextQueryId);
+void APIENTRY shared_dispatch_stub_1328(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue);
+void APIENTRY shared_dispatch_stub_1329(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten);
+void APIENTRY shared_dispatch_stub_1330(GLchar *queryName, GLuint *queryId);
+void APIENTRY shared_dispatch_stub_1331(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask);
+void APIENTRY shared_dispatch_stub_1332(GLfloat factor, GLfloat units, GLfloat clamp);
+void APIENTRY shared_dispatch_stub_1333(GLenum mode, GLsizei count, const GLint *box);
+void APIENTRY shared_dispatch_stub_1334(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1335(GLsizei n, GLuint *memoryObjects);
+void APIENTRY shared_dispatch_stub_1336(GLsizei n, const GLuint *memoryObjects);
+void APIENTRY shared_dispatch_stub_1337(GLsizei n, const GLuint *semaphores);
+void APIENTRY shared_dispatch_stub_1338(GLsizei n, GLuint *semaphores);
+void APIENTRY shared_dispatch_stub_1339(GLuint memoryObject, GLenum pname, GLint *params);
+void APIENTRY shared_dispatch_stub_1340(GLuint semaphore, GLenum pname, GLuint64 *params);
+void APIENTRY shared_dispatch_stub_1341(GLenum target, GLuint index, GLubyte *data);
+void APIENTRY shared_dispatch_stub_1342(GLenum pname, GLubyte *data);
+GLboolean APIENTRY shared_dispatch_stub_1343(GLuint memoryObject);
+GLboolean APIENTRY shared_dispatch_stub_1344(GLuint semaphore);
+void APIENTRY shared_dispatch_stub_1345(GLuint memoryObject, GLenum pname, const GLint *params);
+void APIENTRY shared_dispatch_stub_1346(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1347(GLuint semaphore, GLenum pname, const GLuint64 *params);
+void APIENTRY shared_dispatch_stub_1348(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts);
+void APIENTRY shared_dispatch_stub_1349(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1350(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1351(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1352(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1353(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1354(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1355(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1356(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1357(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1358(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset);
+void APIENTRY shared_dispatch_stub_1359(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts);
+void APIENTRY shared_dispatch_stub_1360(GLuint memory, GLuint64 size, GLenum handleType, GLint fd);
+void APIENTRY shared_dispatch_stub_1361(GLuint semaphore, GLenum handleType, GLint fd);
+void APIENTRY shared_dispatch_stub_1362(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask);
 void APIENTRY shared_dispatch_stub_1363(GLenum target, GLuint index, GLsizei count, const GLfloat *params);
-void APIENTRY shared_dispatch_stub_1364(GLenum target, GLvoid *writeOffset);
+void APIENTRY shared_dispatch_stub_1364(GLenum target, GLuint index, GLsizei count, const GLfloat *params);
 void APIENTRY shared_dispatch_stub_1365(GLenum target, GLvoid *writeOffset);
-void APIENTRY shared_dispatch_stub_1366(GLenum func, GLclampx ref);
-void APIENTRY shared_dispatch_stub_1367(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha);
-void APIENTRY shared_dispatch_stub_1368(GLclampx depth);
-void APIENTRY shared_dispatch_stub_1369(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha);
-void APIENTRY shared_dispatch_stub_1370(GLclampx zNear, GLclampx zFar);
-void APIENTRY shared_dispatch_stub_1371(GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1372(GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1373(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
-void APIENTRY shared_dispatch_stub_1374(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
-void APIENTRY shared_dispatch_stub_1375(GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1376(GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1377(GLenum light, GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1378(GLenum light, GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1379(GLfixed width);
-void APIENTRY shared_dispatch_stub_1380(const GLfixed *m);
-void APIENTRY shared_dispatch_stub_1381(GLenum face, GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1382(GLenum face, GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1383(const GLfixed *m);
-void APIENTRY shared_dispatch_stub_1384(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q);
-void APIENTRY shared_dispatch_stub_1385(GLfixed nx, GLfixed ny, GLfixed nz);
-void APIENTRY shared_dispatch_stub_1386(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
-void APIENTRY shared_dispatch_stub_1387(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
-void APIENTRY shared_dispatch_stub_1388(GLfixed size);
-void APIENTRY shared_dispatch_stub_1389(GLfixed factor, GLfixed units);
-void APIENTRY shared_dispatch_stub_1390(GLfixed angle, GLfixed x, GLfixed y, GLfixed z);
-void APIENTRY shared_dispatch_stub_1391(GLclampx value, GLboolean invert);
-void APIENTRY shared_dispatch_stub_1392(GLfixed x, GLfixed y, GLfixed z);
-void APIENTRY shared_dispatch_stub_1393(GLenum target, GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1394(GLenum target, GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1395(GLenum target, GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1396(GLfixed x, GLfixed y, GLfixed z);
-void APIENTRY shared_dispatch_stub_1397(GLenum plane, const GLfloat *equation);
-void APIENTRY shared_dispatch_stub_1398(GLenum plane, const GLfixed *equation);
-void APIENTRY shared_dispatch_stub_1399(GLenum plane, GLfloat *equation);
-void APIENTRY shared_dispatch_stub_1400(GLenum plane, GLfixed *equation);
-void APIENTRY shared_dispatch_stub_1401(GLenum pname, GLfixed *params);
-void APIENTRY shared_dispatch_stub_1402(GLenum light, GLenum pname, GLfixed *params);
-void APIENTRY shared_dispatch_stub_1403(GLenum face, GLenum pname, GLfixed *params);
-void APIENTRY shared_dispatch_stub_1404(GLenum target, GLenum pname, GLfixed *params);
+void APIENTRY shared_dispatch_stub_1366(GLenum target, GLvoid *writeOffset);
+void APIENTRY shared_dispatch_stub_1367(GLenum func, GLclampx ref);
+void APIENTRY shared_dispatch_stub_1368(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha);
+void APIENTRY shared_dispatch_stub_1369(GLclampx depth);
+void APIENTRY shared_dispatch_stub_1370(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha);
+void APIENTRY shared_dispatch_stub_1371(GLclampx zNear, GLclampx zFar);
+void APIENTRY shared_dispatch_stub_1372(GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1373(GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1374(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+void APIENTRY shared_dispatch_stub_1375(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+void APIENTRY shared_dispatch_stub_1376(GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1377(GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1378(GLenum light, GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1379(GLenum light, GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1380(GLfixed width);
+void APIENTRY shared_dispatch_stub_1381(const GLfixed *m);
+void APIENTRY shared_dispatch_stub_1382(GLenum face, GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1383(GLenum face, GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1384(const GLfixed *m);
+void APIENTRY shared_dispatch_stub_1385(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q);
+void APIENTRY shared_dispatch_stub_1386(GLfixed nx, GLfixed ny, GLfixed nz);
+void APIENTRY shared_dispatch_stub_1387(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+void APIENTRY shared_dispatch_stub_1388(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+void APIENTRY shared_dispatch_stub_1389(GLfixed size);
+void APIENTRY shared_dispatch_stub_1390(GLfixed factor, GLfixed units);
+void APIENTRY shared_dispatch_stub_1391(GLfixed angle, GLfixed x, GLfixed y, GLfixed z);
+void APIENTRY shared_dispatch_stub_1392(GLclampx value, GLboolean invert);
+void APIENTRY shared_dispatch_stub_1393(GLfixed x, GLfixed y, GLfixed z);
+void APIENTRY shared_dispatch_stub_1394(GLenum target, GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1395(GLenum target, GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1396(GLenum target, GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1397(GLfixed x, GLfixed y, GLfixed z);
+void APIENTRY shared_dispatch_stub_1398(GLenum plane, const GLfloat *equation);
+void APIENTRY shared_dispatch_stub_1399(GLenum plane, const GLfixed *equation);
+void APIENTRY shared_dispatch_stub_1400(GLenum plane, GLfloat *equation);
+void APIENTRY shared_dispatch_stub_1401(GLenum plane, GLfixed *equation);
+void APIENTRY shared_dispatch_stub_1402(GLenum pname, GLfixed *params);
+void APIENTRY shared_dispatch_stub_1403(GLenum light, GLenum pname, GLfixed *params);
+void APIENTRY shared_dispatch_stub_1404(GLenum face, GLenum pname, GLfixed *params);
 void APIENTRY shared_dispatch_stub_1405(GLenum target, GLenum pname, GLfixed *params);
-void APIENTRY shared_dispatch_stub_1406(GLenum pname, GLfixed param);
-void APIENTRY shared_dispatch_stub_1407(GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1408(GLenum target, GLenum pname, const GLfixed *params);
-void APIENTRY shared_dispatch_stub_1409(void);
-void APIENTRY shared_dispatch_stub_1410(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW);
+void APIENTRY shared_dispatch_stub_1406(GLenum target, GLenum pname, GLfixed *params);
+void APIENTRY shared_dispatch_stub_1407(GLenum pname, GLfixed param);
+void APIENTRY shared_dispatch_stub_1408(GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1409(GLenum target, GLenum pname, const GLfixed *params);
+void APIENTRY shared_dispatch_stub_1410(void);
+void APIENTRY shared_dispatch_stub_1411(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW);
 #undef MAPI_TMP_DEFINES
 #endif /* MAPI_TMP_DEFINES */
 
 #ifdef MAPI_TMP_TABLE
-#define MAPI_TABLE_NUM_STATIC 1411
+#define MAPI_TABLE_NUM_STATIC 1412
 #define MAPI_TABLE_NUM_DYNAMIC 256
 #undef MAPI_TMP_TABLE
 #endif /* MAPI_TMP_TABLE */
@@ -7879,6 +7880,12 @@ static void APIENTRY noopUniform4ui64vARB(GLint location, GLsizei count, const G
    noop_warn("glUniform4ui64vARB");
 }
 
+static void APIENTRY noopMaxShaderCompilerThreadsARB(GLuint count)
+{
+   (void) count;
+   noop_warn("glMaxShaderCompilerThreadsARB");
+}
+
 static void APIENTRY noopSpecializeShaderARB(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
 {
    (void) shader; (void) pEntryPoint; (void) numSpecializationConstants; (void) pConstantIndex; (void) pConstantValue;
@@ -11006,6 +11013,7 @@ const mapi_func table_noop_array[] = {
    (mapi_func) noopUniform4i64vARB,
    (mapi_func) noopUniform4ui64ARB,
    (mapi_func) noopUniform4ui64vARB,
+   (mapi_func) noopMaxShaderCompilerThreadsARB,
    (mapi_func) noopSpecializeShaderARB,
    (mapi_func) noopInvalidateBufferData,
    (mapi_func) noopInvalidateBufferSubData,
@@ -13275,6 +13283,7 @@ const mapi_func table_noop_array[] = {
    (mapi_func) noop_generic,
    (mapi_func) noop_generic,
    (mapi_func) noop_generic,
+   (mapi_func) noop_generic,
    (mapi_func) noop_generic
 };
 
@@ -14259,6 +14268,7 @@ static const char public_string_pool[] =
    "Materialxv\0"
    "MaterialxvOES\0"
    "MatrixMode\0"
+   "MaxShaderCompilerThreadsARB\0"
    "MemoryBarrier\0"
    "MemoryBarrierByRegion\0"
    "MemoryObjectParameterivEXT\0"
@@ -15304,19 +15314,19 @@ static const char public_string_pool[] =
 
 static const struct mapi_stub public_stubs[] = {
    { (void *) 0, 213, NULL },
-   { (void *) 6, 1307, NULL },
-   { (void *) 23, 1096, NULL },
-   { (void *) 43, 1096, NULL },
-   { (void *) 66, 1259, NULL },
+   { (void *) 6, 1308, NULL },
+   { (void *) 23, 1097, NULL },
+   { (void *) 43, 1097, NULL },
+   { (void *) 66, 1260, NULL },
    { (void *) 87, 374, NULL },
    { (void *) 101, 374, NULL },
-   { (void *) 118, 1243, NULL },
-   { (void *) 138, 1244, NULL },
-   { (void *) 158, 1245, NULL },
+   { (void *) 118, 1244, NULL },
+   { (void *) 138, 1245, NULL },
+   { (void *) 158, 1246, NULL },
    { (void *) 178, 240, NULL },
-   { (void *) 188, 1366, NULL },
-   { (void *) 199, 1366, NULL },
-   { (void *) 213, 1184, NULL },
+   { (void *) 188, 1367, NULL },
+   { (void *) 199, 1367, NULL },
+   { (void *) 213, 1185, NULL },
    { (void *) 235, 322, NULL },
    { (void *) 255, 322, NULL },
    { (void *) 278, 306, NULL },
@@ -15326,9 +15336,9 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 336, 7, NULL },
    { (void *) 342, 570, NULL },
    { (void *) 365, 570, NULL },
-   { (void *) 390, 1246, NULL },
-   { (void *) 413, 1293, NULL },
-   { (void *) 433, 1321, NULL },
+   { (void *) 390, 1247, NULL },
+   { (void *) 413, 1294, NULL },
+   { (void *) 433, 1322, NULL },
    { (void *) 453, 460, NULL },
    { (void *) 464, 460, NULL },
    { (void *) 478, 460, NULL },
@@ -15341,7 +15351,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 611, 461, NULL },
    { (void *) 625, 572, NULL },
    { (void *) 640, 572, NULL },
-   { (void *) 658, 1292, NULL },
+   { (void *) 658, 1293, NULL },
    { (void *) 678, 573, NULL },
    { (void *) 694, 573, NULL },
    { (void *) 713, 906, NULL },
@@ -15350,18 +15360,18 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 767, 574, NULL },
    { (void *) 791, 715, NULL },
    { (void *) 819, 715, NULL },
-   { (void *) 850, 1247, NULL },
+   { (void *) 850, 1248, NULL },
    { (void *) 872, 661, NULL },
-   { (void *) 888, 1271, NULL },
+   { (void *) 888, 1272, NULL },
    { (void *) 907, 661, NULL },
    { (void *) 926, 868, NULL },
    { (void *) 943, 908, NULL },
    { (void *) 961, 622, NULL },
    { (void *) 976, 622, NULL },
-   { (void *) 990, 1097, NULL },
-   { (void *) 1010, 1097, NULL },
+   { (void *) 990, 1098, NULL },
+   { (void *) 1010, 1098, NULL },
    { (void *) 1033, 662, NULL },
-   { (void *) 1050, 1272, NULL },
+   { (void *) 1050, 1273, NULL },
    { (void *) 1070, 662, NULL },
    { (void *) 1090, 717, NULL },
    { (void *) 1102, 909, NULL },
@@ -15375,8 +15385,8 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 1228, 882, NULL },
    { (void *) 1245, 911, NULL },
    { (void *) 1263, 8, NULL },
-   { (void *) 1270, 1409, NULL },
-   { (void *) 1283, 1409, NULL },
+   { (void *) 1270, 1410, NULL },
+   { (void *) 1283, 1410, NULL },
    { (void *) 1299, 336, NULL },
    { (void *) 1310, 336, NULL },
    { (void *) 1324, 337, NULL },
@@ -15417,10 +15427,10 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 2029, 462, NULL },
    { (void *) 2040, 462, NULL },
    { (void *) 2054, 1031, NULL },
-   { (void *) 2078, 1274, NULL },
+   { (void *) 2078, 1275, NULL },
    { (void *) 2100, 903, NULL },
    { (void *) 2114, 903, NULL },
-   { (void *) 2131, 1333, NULL },
+   { (void *) 2131, 1334, NULL },
    { (void *) 2151, 463, NULL },
    { (void *) 2165, 463, NULL },
    { (void *) 2182, 2, NULL },
@@ -15440,15 +15450,15 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 2409, 578, NULL },
    { (void *) 2423, 579, NULL },
    { (void *) 2438, 206, NULL },
-   { (void *) 2449, 1290, NULL },
-   { (void *) 2465, 1291, NULL },
-   { (void *) 2482, 1367, NULL },
-   { (void *) 2494, 1367, NULL },
+   { (void *) 2449, 1291, NULL },
+   { (void *) 2465, 1292, NULL },
+   { (void *) 2482, 1368, NULL },
+   { (void *) 2494, 1368, NULL },
    { (void *) 2509, 208, NULL },
    { (void *) 2520, 813, NULL },
    { (void *) 2532, 813, NULL },
-   { (void *) 2547, 1368, NULL },
-   { (void *) 2559, 1368, NULL },
+   { (void *) 2547, 1369, NULL },
+   { (void *) 2559, 1369, NULL },
    { (void *) 2574, 205, NULL },
    { (void *) 2585, 935, NULL },
    { (void *) 2606, 936, NULL },
@@ -15464,10 +15474,10 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 2814, 695, NULL },
    { (void *) 2829, 931, NULL },
    { (void *) 2841, 150, NULL },
-   { (void *) 2851, 1397, NULL },
-   { (void *) 2862, 1397, NULL },
-   { (void *) 2876, 1398, NULL },
-   { (void *) 2887, 1398, NULL },
+   { (void *) 2851, 1398, NULL },
+   { (void *) 2862, 1398, NULL },
+   { (void *) 2876, 1399, NULL },
+   { (void *) 2887, 1399, NULL },
    { (void *) 2901, 9, NULL },
    { (void *) 2909, 10, NULL },
    { (void *) 2918, 11, NULL },
@@ -15500,11 +15510,11 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 3156, 38, NULL },
    { (void *) 3166, 39, NULL },
    { (void *) 3175, 40, NULL },
-   { (void *) 3185, 1369, NULL },
-   { (void *) 3193, 1369, NULL },
-   { (void *) 3204, 1248, NULL },
-   { (void *) 3224, 1249, NULL },
-   { (void *) 3244, 1250, NULL },
+   { (void *) 3185, 1370, NULL },
+   { (void *) 3193, 1370, NULL },
+   { (void *) 3204, 1249, NULL },
+   { (void *) 3224, 1250, NULL },
+   { (void *) 3244, 1251, NULL },
    { (void *) 3264, 210, NULL },
    { (void *) 3274, 580, NULL },
    { (void *) 3294, 580, NULL },
@@ -15516,7 +15526,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 3368, 736, NULL },
    { (void *) 3378, 737, NULL },
    { (void *) 3389, 308, NULL },
-   { (void *) 3402, 1089, NULL },
+   { (void *) 3402, 1090, NULL },
    { (void *) 3418, 346, NULL },
    { (void *) 3432, 346, NULL },
    { (void *) 3449, 339, NULL },
@@ -15587,8 +15597,8 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 4845, 947, NULL },
    { (void *) 4867, 948, NULL },
    { (void *) 4881, 949, NULL },
-   { (void *) 4900, 1334, NULL },
-   { (void *) 4923, 1322, NULL },
+   { (void *) 4900, 1335, NULL },
+   { (void *) 4923, 1323, NULL },
    { (void *) 4944, 483, NULL },
    { (void *) 4958, 650, NULL },
    { (void *) 4981, 950, NULL },
@@ -15597,36 +15607,36 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 5038, 953, NULL },
    { (void *) 5053, 484, NULL },
    { (void *) 5066, 651, NULL },
-   { (void *) 5088, 1308, NULL },
-   { (void *) 5111, 1098, NULL },
-   { (void *) 5132, 1098, NULL },
+   { (void *) 5088, 1309, NULL },
+   { (void *) 5111, 1099, NULL },
+   { (void *) 5132, 1099, NULL },
    { (void *) 5156, 954, NULL },
    { (void *) 5171, 955, NULL },
    { (void *) 5196, 956, NULL },
    { (void *) 5215, 152, NULL },
-   { (void *) 5224, 1158, NULL },
-   { (void *) 5245, 1158, NULL },
-   { (void *) 5269, 1158, NULL },
-   { (void *) 5293, 1159, NULL },
-   { (void *) 5313, 1159, NULL },
-   { (void *) 5336, 1159, NULL },
-   { (void *) 5359, 1160, NULL },
-   { (void *) 5378, 1160, NULL },
-   { (void *) 5400, 1160, NULL },
+   { (void *) 5224, 1159, NULL },
+   { (void *) 5245, 1159, NULL },
+   { (void *) 5269, 1159, NULL },
+   { (void *) 5293, 1160, NULL },
+   { (void *) 5313, 1160, NULL },
+   { (void *) 5336, 1160, NULL },
+   { (void *) 5359, 1161, NULL },
+   { (void *) 5378, 1161, NULL },
+   { (void *) 5400, 1161, NULL },
    { (void *) 5422, 464, NULL },
    { (void *) 5436, 464, NULL },
-   { (void *) 5453, 1251, NULL },
+   { (void *) 5453, 1252, NULL },
    { (void *) 5477, 665, NULL },
    { (void *) 5496, 665, NULL },
    { (void *) 5518, 665, NULL },
    { (void *) 5540, 4, NULL },
-   { (void *) 5552, 1335, NULL },
+   { (void *) 5552, 1336, NULL },
    { (void *) 5575, 652, NULL },
-   { (void *) 5591, 1294, NULL },
-   { (void *) 5613, 1323, NULL },
+   { (void *) 5591, 1295, NULL },
+   { (void *) 5613, 1324, NULL },
    { (void *) 5634, 485, NULL },
-   { (void *) 5648, 1099, NULL },
-   { (void *) 5671, 1099, NULL },
+   { (void *) 5648, 1100, NULL },
+   { (void *) 5671, 1100, NULL },
    { (void *) 5697, 623, NULL },
    { (void *) 5715, 623, NULL },
    { (void *) 5732, 465, NULL },
@@ -15636,7 +15646,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 5800, 666, NULL },
    { (void *) 5823, 666, NULL },
    { (void *) 5846, 718, NULL },
-   { (void *) 5861, 1336, NULL },
+   { (void *) 5861, 1337, NULL },
    { (void *) 5881, 486, NULL },
    { (void *) 5894, 696, NULL },
    { (void *) 5905, 327, NULL },
@@ -15644,18 +15654,18 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 5938, 803, NULL },
    { (void *) 5963, 684, NULL },
    { (void *) 5982, 684, NULL },
-   { (void *) 6004, 1270, NULL },
+   { (void *) 6004, 1271, NULL },
    { (void *) 6019, 245, NULL },
    { (void *) 6029, 211, NULL },
    { (void *) 6039, 288, NULL },
-   { (void *) 6050, 1257, NULL },
+   { (void *) 6050, 1258, NULL },
    { (void *) 6071, 831, NULL },
    { (void *) 6088, 832, NULL },
-   { (void *) 6106, 1258, NULL },
+   { (void *) 6106, 1259, NULL },
    { (void *) 6128, 814, NULL },
    { (void *) 6140, 814, NULL },
-   { (void *) 6155, 1370, NULL },
-   { (void *) 6167, 1370, NULL },
+   { (void *) 6155, 1371, NULL },
+   { (void *) 6167, 1371, NULL },
    { (void *) 6182, 653, NULL },
    { (void *) 6198, 487, NULL },
    { (void *) 6211, 214, NULL },
@@ -15667,7 +15677,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 6334, 581, NULL },
    { (void *) 6343, 581, NULL },
    { (void *) 6355, 581, NULL },
-   { (void *) 6367, 1095, NULL },
+   { (void *) 6367, 1096, NULL },
    { (void *) 6389, 878, NULL },
    { (void *) 6405, 928, NULL },
    { (void *) 6433, 879, NULL },
@@ -15706,23 +15716,23 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 7218, 704, NULL },
    { (void *) 7249, 704, NULL },
    { (void *) 7280, 338, NULL },
-   { (void *) 7301, 1077, NULL },
-   { (void *) 7313, 1078, NULL },
-   { (void *) 7326, 1079, NULL },
-   { (void *) 7338, 1080, NULL },
-   { (void *) 7351, 1081, NULL },
-   { (void *) 7363, 1082, NULL },
-   { (void *) 7376, 1083, NULL },
-   { (void *) 7388, 1084, NULL },
+   { (void *) 7301, 1078, NULL },
+   { (void *) 7313, 1079, NULL },
+   { (void *) 7326, 1080, NULL },
+   { (void *) 7338, 1081, NULL },
+   { (void *) 7351, 1082, NULL },
+   { (void *) 7363, 1083, NULL },
+   { (void *) 7376, 1084, NULL },
+   { (void *) 7388, 1085, NULL },
    { (void *) 7401, 804, NULL },
    { (void *) 7423, 864, NULL },
    { (void *) 7454, 810, NULL },
    { (void *) 7482, 865, NULL },
-   { (void *) 7519, 1364, NULL },
-   { (void *) 7556, 1365, NULL },
+   { (void *) 7519, 1365, NULL },
+   { (void *) 7556, 1366, NULL },
    { (void *) 7583, 41, NULL },
    { (void *) 7592, 312, NULL },
-   { (void *) 7608, 1090, NULL },
+   { (void *) 7608, 1091, NULL },
    { (void *) 7627, 42, NULL },
    { (void *) 7637, 215, NULL },
    { (void *) 7644, 313, NULL },
@@ -15736,10 +15746,10 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 7784, 43, NULL },
    { (void *) 7788, 583, NULL },
    { (void *) 7809, 583, NULL },
-   { (void *) 7832, 1252, NULL },
+   { (void *) 7832, 1253, NULL },
    { (void *) 7853, 1, NULL },
-   { (void *) 7861, 1295, NULL },
-   { (void *) 7879, 1324, NULL },
+   { (void *) 7861, 1296, NULL },
+   { (void *) 7879, 1325, NULL },
    { (void *) 7897, 466, NULL },
    { (void *) 7906, 466, NULL },
    { (void *) 7918, 466, NULL },
@@ -15758,13 +15768,13 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 8101, 238, NULL },
    { (void *) 8111, 237, NULL },
    { (void *) 8122, 239, NULL },
-   { (void *) 8133, 1185, NULL },
+   { (void *) 8133, 1186, NULL },
    { (void *) 8150, 194, NULL },
    { (void *) 8165, 697, NULL },
    { (void *) 8175, 216, NULL },
    { (void *) 8182, 217, NULL },
    { (void *) 8188, 681, NULL },
-   { (void *) 8211, 1275, NULL },
+   { (void *) 8211, 1276, NULL },
    { (void *) 8239, 681, NULL },
    { (void *) 8265, 959, NULL },
    { (void *) 8293, 421, NULL },
@@ -15773,18 +15783,18 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 8338, 422, NULL },
    { (void *) 8351, 423, NULL },
    { (void *) 8362, 423, NULL },
-   { (void *) 8376, 1171, NULL },
-   { (void *) 8386, 1171, NULL },
-   { (void *) 8399, 1172, NULL },
-   { (void *) 8410, 1172, NULL },
+   { (void *) 8376, 1172, NULL },
+   { (void *) 8386, 1172, NULL },
+   { (void *) 8399, 1173, NULL },
+   { (void *) 8410, 1173, NULL },
    { (void *) 8424, 153, NULL },
    { (void *) 8429, 154, NULL },
    { (void *) 8435, 155, NULL },
    { (void *) 8440, 156, NULL },
-   { (void *) 8446, 1371, NULL },
-   { (void *) 8451, 1371, NULL },
-   { (void *) 8459, 1372, NULL },
-   { (void *) 8465, 1372, NULL },
+   { (void *) 8446, 1372, NULL },
+   { (void *) 8451, 1372, NULL },
+   { (void *) 8459, 1373, NULL },
+   { (void *) 8465, 1373, NULL },
    { (void *) 8474, 888, NULL },
    { (void *) 8496, 667, NULL },
    { (void *) 8520, 667, NULL },
@@ -15804,20 +15814,20 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 8849, 616, NULL },
    { (void *) 8871, 157, NULL },
    { (void *) 8881, 289, NULL },
-   { (void *) 8889, 1373, NULL },
-   { (void *) 8898, 1373, NULL },
-   { (void *) 8910, 1374, NULL },
-   { (void *) 8919, 1374, NULL },
+   { (void *) 8889, 1374, NULL },
+   { (void *) 8898, 1374, NULL },
+   { (void *) 8910, 1375, NULL },
+   { (void *) 8919, 1375, NULL },
    { (void *) 8931, 467, NULL },
    { (void *) 8942, 467, NULL },
-   { (void *) 8956, 1253, NULL },
+   { (void *) 8956, 1254, NULL },
    { (void *) 8978, 672, NULL },
    { (void *) 8994, 672, NULL },
    { (void *) 9013, 672, NULL },
    { (void *) 9032, 5, NULL },
-   { (void *) 9041, 1296, NULL },
-   { (void *) 9060, 1100, NULL },
-   { (void *) 9080, 1100, NULL },
+   { (void *) 9041, 1297, NULL },
+   { (void *) 9060, 1101, NULL },
+   { (void *) 9080, 1101, NULL },
    { (void *) 9103, 624, NULL },
    { (void *) 9118, 624, NULL },
    { (void *) 9132, 468, NULL },
@@ -15827,7 +15837,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 9188, 673, NULL },
    { (void *) 9208, 673, NULL },
    { (void *) 9228, 719, NULL },
-   { (void *) 9240, 1337, NULL },
+   { (void *) 9240, 1338, NULL },
    { (void *) 9257, 328, NULL },
    { (void *) 9269, 328, NULL },
    { (void *) 9284, 805, NULL },
@@ -15865,10 +15875,10 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 9948, 471, NULL },
    { (void *) 9965, 471, NULL },
    { (void *) 9985, 259, NULL },
-   { (void *) 9998, 1399, NULL },
-   { (void *) 10012, 1399, NULL },
-   { (void *) 10029, 1400, NULL },
-   { (void *) 10043, 1400, NULL },
+   { (void *) 9998, 1400, NULL },
+   { (void *) 10012, 1400, NULL },
+   { (void *) 10029, 1401, NULL },
+   { (void *) 10043, 1401, NULL },
    { (void *) 10060, 343, NULL },
    { (void *) 10074, 343, NULL },
    { (void *) 10091, 344, NULL },
@@ -15888,15 +15898,15 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 10443, 357, NULL },
    { (void *) 10472, 358, NULL },
    { (void *) 10498, 358, NULL },
-   { (void *) 10527, 1161, NULL },
-   { (void *) 10546, 1161, NULL },
-   { (void *) 10568, 1161, NULL },
+   { (void *) 10527, 1162, NULL },
+   { (void *) 10546, 1162, NULL },
+   { (void *) 10568, 1162, NULL },
    { (void *) 10590, 833, NULL },
    { (void *) 10603, 260, NULL },
    { (void *) 10614, 261, NULL },
-   { (void *) 10623, 1325, NULL },
-   { (void *) 10648, 1401, NULL },
-   { (void *) 10658, 1401, NULL },
+   { (void *) 10623, 1326, NULL },
+   { (void *) 10648, 1402, NULL },
+   { (void *) 10658, 1402, NULL },
    { (void *) 10671, 834, NULL },
    { (void *) 10683, 834, NULL },
    { (void *) 10698, 262, NULL },
@@ -15929,16 +15939,16 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 11279, 866, NULL },
    { (void *) 11299, 264, NULL },
    { (void *) 11310, 265, NULL },
-   { (void *) 11321, 1402, NULL },
-   { (void *) 11332, 1402, NULL },
+   { (void *) 11321, 1403, NULL },
+   { (void *) 11332, 1403, NULL },
    { (void *) 11346, 266, NULL },
    { (void *) 11355, 267, NULL },
    { (void *) 11364, 268, NULL },
    { (void *) 11373, 269, NULL },
    { (void *) 11387, 270, NULL },
-   { (void *) 11401, 1403, NULL },
-   { (void *) 11415, 1403, NULL },
-   { (void *) 11432, 1338, NULL },
+   { (void *) 11401, 1404, NULL },
+   { (void *) 11415, 1404, NULL },
+   { (void *) 11432, 1339, NULL },
    { (void *) 11462, 364, NULL },
    { (void *) 11472, 364, NULL },
    { (void *) 11485, 365, NULL },
@@ -15953,24 +15963,24 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 11691, 966, NULL },
    { (void *) 11732, 967, NULL },
    { (void *) 11763, 968, NULL },
-   { (void *) 11795, 1326, NULL },
-   { (void *) 11819, 1162, NULL },
-   { (void *) 11834, 1162, NULL },
+   { (void *) 11795, 1327, NULL },
+   { (void *) 11819, 1163, NULL },
+   { (void *) 11834, 1163, NULL },
    { (void *) 11852, 657, NULL },
-   { (void *) 11876, 1304, NULL },
+   { (void *) 11876, 1305, NULL },
    { (void *) 11902, 658, NULL },
-   { (void *) 11926, 1163, NULL },
-   { (void *) 11944, 1163, NULL },
-   { (void *) 11965, 1327, NULL },
-   { (void *) 11989, 1297, NULL },
-   { (void *) 12018, 1298, NULL },
-   { (void *) 12047, 1299, NULL },
-   { (void *) 12078, 1300, NULL },
-   { (void *) 12104, 1301, NULL },
-   { (void *) 12133, 1302, NULL },
-   { (void *) 12157, 1328, NULL },
-   { (void *) 12179, 1329, NULL },
-   { (void *) 12205, 1330, NULL },
+   { (void *) 11926, 1164, NULL },
+   { (void *) 11944, 1164, NULL },
+   { (void *) 11965, 1328, NULL },
+   { (void *) 11989, 1298, NULL },
+   { (void *) 12018, 1299, NULL },
+   { (void *) 12047, 1300, NULL },
+   { (void *) 12078, 1301, NULL },
+   { (void *) 12104, 1302, NULL },
+   { (void *) 12133, 1303, NULL },
+   { (void *) 12157, 1329, NULL },
+   { (void *) 12179, 1330, NULL },
+   { (void *) 12205, 1331, NULL },
    { (void *) 12227, 271, NULL },
    { (void *) 12241, 272, NULL },
    { (void *) 12256, 273, NULL },
@@ -15986,14 +15996,14 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 12442, 893, NULL },
    { (void *) 12464, 627, NULL },
    { (void *) 12494, 628, NULL },
-   { (void *) 12524, 1260, NULL },
-   { (void *) 12553, 1261, NULL },
-   { (void *) 12582, 1186, NULL },
-   { (void *) 12606, 1187, NULL },
-   { (void *) 12630, 1101, NULL },
-   { (void *) 12656, 1101, NULL },
-   { (void *) 12685, 1102, NULL },
-   { (void *) 12706, 1102, NULL },
+   { (void *) 12524, 1261, NULL },
+   { (void *) 12553, 1262, NULL },
+   { (void *) 12582, 1187, NULL },
+   { (void *) 12606, 1188, NULL },
+   { (void *) 12630, 1102, NULL },
+   { (void *) 12656, 1102, NULL },
+   { (void *) 12685, 1103, NULL },
+   { (void *) 12706, 1103, NULL },
    { (void *) 12730, 894, NULL },
    { (void *) 12754, 895, NULL },
    { (void *) 12781, 896, NULL },
@@ -16002,10 +16012,10 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 12871, 898, NULL },
    { (void *) 12892, 795, NULL },
    { (void *) 12910, 629, NULL },
-   { (void *) 12930, 1188, NULL },
+   { (void *) 12930, 1189, NULL },
    { (void *) 12949, 496, NULL },
    { (void *) 12962, 630, NULL },
-   { (void *) 12978, 1189, NULL },
+   { (void *) 12978, 1190, NULL },
    { (void *) 12993, 969, NULL },
    { (void *) 13018, 970, NULL },
    { (void *) 13041, 971, NULL },
@@ -16035,7 +16045,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 13562, 721, NULL },
    { (void *) 13589, 722, NULL },
    { (void *) 13611, 723, NULL },
-   { (void *) 13633, 1339, NULL },
+   { (void *) 13633, 1340, NULL },
    { (void *) 13663, 359, NULL },
    { (void *) 13682, 359, NULL },
    { (void *) 13704, 497, NULL },
@@ -16048,18 +16058,18 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 13814, 796, NULL },
    { (void *) 13833, 797, NULL },
    { (void *) 13862, 699, NULL },
-   { (void *) 13872, 1239, NULL },
-   { (void *) 13897, 1240, NULL },
+   { (void *) 13872, 1240, NULL },
+   { (void *) 13897, 1241, NULL },
    { (void *) 13922, 276, NULL },
    { (void *) 13934, 277, NULL },
-   { (void *) 13946, 1404, NULL },
-   { (void *) 13958, 1404, NULL },
+   { (void *) 13946, 1405, NULL },
+   { (void *) 13958, 1405, NULL },
    { (void *) 13973, 278, NULL },
    { (void *) 13985, 279, NULL },
    { (void *) 13997, 279, NULL },
    { (void *) 14012, 280, NULL },
    { (void *) 14024, 280, NULL },
-   { (void *) 14039, 1267, NULL },
+   { (void *) 14039, 1268, NULL },
    { (void *) 14054, 281, NULL },
    { (void *) 14066, 284, NULL },
    { (void *) 14089, 285, NULL },
@@ -16071,8 +16081,8 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 14218, 590, NULL },
    { (void *) 14241, 282, NULL },
    { (void *) 14259, 283, NULL },
-   { (void *) 14277, 1405, NULL },
-   { (void *) 14295, 1405, NULL },
+   { (void *) 14277, 1406, NULL },
+   { (void *) 14295, 1406, NULL },
    { (void *) 14316, 913, NULL },
    { (void *) 14336, 973, NULL },
    { (void *) 14352, 974, NULL },
@@ -16083,7 +16093,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 14475, 979, NULL },
    { (void *) 14497, 914, NULL },
    { (void *) 14524, 1030, NULL },
-   { (void *) 14543, 1190, NULL },
+   { (void *) 14543, 1191, NULL },
    { (void *) 14562, 591, NULL },
    { (void *) 14590, 591, NULL },
    { (void *) 14621, 980, NULL },
@@ -16103,8 +16113,8 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 14887, 1034, NULL },
    { (void *) 14906, 592, NULL },
    { (void *) 14920, 592, NULL },
-   { (void *) 14937, 1340, NULL },
-   { (void *) 14959, 1341, NULL },
+   { (void *) 14937, 1341, NULL },
+   { (void *) 14959, 1342, NULL },
    { (void *) 14979, 983, NULL },
    { (void *) 15005, 984, NULL },
    { (void *) 15029, 985, NULL },
@@ -16119,13 +16129,13 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 15225, 503, NULL },
    { (void *) 15251, 504, NULL },
    { (void *) 15269, 504, NULL },
-   { (void *) 15290, 1191, NULL },
+   { (void *) 15290, 1192, NULL },
    { (void *) 15310, 505, NULL },
    { (void *) 15328, 505, NULL },
-   { (void *) 15349, 1192, NULL },
+   { (void *) 15349, 1193, NULL },
    { (void *) 15369, 506, NULL },
    { (void *) 15387, 506, NULL },
-   { (void *) 15408, 1193, NULL },
+   { (void *) 15408, 1194, NULL },
    { (void *) 15428, 842, NULL },
    { (void *) 15446, 843, NULL },
    { (void *) 15472, 844, NULL },
@@ -16155,11 +16165,11 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 15887, 158, NULL },
    { (void *) 15892, 367, NULL },
    { (void *) 15902, 367, NULL },
-   { (void *) 15915, 1359, NULL },
-   { (void *) 15933, 1360, NULL },
+   { (void *) 15915, 1360, NULL },
+   { (void *) 15933, 1361, NULL },
    { (void *) 15954, 212, NULL },
    { (void *) 15964, 314, NULL },
-   { (void *) 15977, 1091, NULL },
+   { (void *) 15977, 1092, NULL },
    { (void *) 15993, 44, NULL },
    { (void *) 16000, 45, NULL },
    { (void *) 16008, 46, NULL },
@@ -16172,14 +16182,14 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 16061, 316, NULL },
    { (void *) 16070, 197, NULL },
    { (void *) 16080, 317, NULL },
-   { (void *) 16098, 1070, NULL },
-   { (void *) 16119, 1071, NULL },
-   { (void *) 16143, 1072, NULL },
+   { (void *) 16098, 1071, NULL },
+   { (void *) 16119, 1072, NULL },
+   { (void *) 16143, 1073, NULL },
    { (void *) 16165, 986, NULL },
    { (void *) 16196, 987, NULL },
-   { (void *) 16230, 1073, NULL },
-   { (void *) 16255, 1074, NULL },
-   { (void *) 16274, 1075, NULL },
+   { (void *) 16230, 1074, NULL },
+   { (void *) 16255, 1075, NULL },
+   { (void *) 16274, 1076, NULL },
    { (void *) 16296, 475, NULL },
    { (void *) 16305, 475, NULL },
    { (void *) 16317, 286, NULL },
@@ -16192,12 +16202,12 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 16417, 677, NULL },
    { (void *) 16434, 916, NULL },
    { (void *) 16459, 287, NULL },
-   { (void *) 16466, 1342, NULL },
+   { (void *) 16466, 1343, NULL },
    { (void *) 16484, 507, NULL },
    { (void *) 16494, 631, NULL },
    { (void *) 16507, 631, NULL },
-   { (void *) 16519, 1103, NULL },
-   { (void *) 16537, 1103, NULL },
+   { (void *) 16519, 1104, NULL },
+   { (void *) 16537, 1104, NULL },
    { (void *) 16558, 476, NULL },
    { (void *) 16566, 476, NULL },
    { (void *) 16577, 476, NULL },
@@ -16205,7 +16215,7 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 16603, 678, NULL },
    { (void *) 16621, 678, NULL },
    { (void *) 16639, 724, NULL },
-   { (void *) 16649, 1343, NULL },
+   { (void *) 16649, 1344, NULL },
    { (void *) 16664, 508, NULL },
    { (void *) 16673, 700, NULL },
    { (void *) 16680, 330, NULL },
@@ -16218,37 +16228,37 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 16793, 164, NULL },
    { (void *) 16806, 165, NULL },
    { (void *) 16818, 166, NULL },
-   { (void *) 16831, 1375, NULL },
-   { (void *) 16843, 1375, NULL },
-   { (void *) 16858, 1376, NULL },
-   { (void *) 16871, 1376, NULL },
+   { (void *) 16831, 1376, NULL },
+   { (void *) 16843, 1376, NULL },
+   { (void *) 16858, 1377, NULL },
+   { (void *) 16871, 1377, NULL },
    { (void *) 16887, 159, NULL },
    { (void *) 16894, 160, NULL },
    { (void *) 16902, 161, NULL },
    { (void *) 16909, 162, NULL },
-   { (void *) 16917, 1377, NULL },
-   { (void *) 16924, 1377, NULL },
-   { (void *) 16934, 1378, NULL },
-   { (void *) 16942, 1378, NULL },
+   { (void *) 16917, 1378, NULL },
+   { (void *) 16924, 1378, NULL },
+   { (void *) 16934, 1379, NULL },
+   { (void *) 16942, 1379, NULL },
    { (void *) 16953, 167, NULL },
    { (void *) 16965, 168, NULL },
-   { (void *) 16975, 1379, NULL },
-   { (void *) 16986, 1379, NULL },
+   { (void *) 16975, 1380, NULL },
+   { (void *) 16986, 1380, NULL },
    { (void *) 17000, 509, NULL },
    { (void *) 17012, 509, NULL },
    { (void *) 17027, 6, NULL },
    { (void *) 17036, 290, NULL },
    { (void *) 17049, 292, NULL },
    { (void *) 17061, 291, NULL },
-   { (void *) 17073, 1380, NULL },
-   { (void *) 17085, 1380, NULL },
+   { (void *) 17073, 1381, NULL },
+   { (void *) 17085, 1381, NULL },
    { (void *) 17100, 198, NULL },
-   { (void *) 17109, 1194, NULL },
+   { (void *) 17109, 1195, NULL },
    { (void *) 17123, 415, NULL },
    { (void *) 17144, 415, NULL },
    { (void *) 17168, 416, NULL },
    { (void *) 17189, 416, NULL },
-   { (void *) 17213, 1104, NULL },
+   { (void *) 17213, 1105, NULL },
    { (void *) 17227, 242, NULL },
    { (void *) 17235, 918, NULL },
    { (void *) 17265, 919, NULL },
@@ -16273,1053 +16283,1054 @@ static const struct mapi_stub public_stubs[] = {
    { (void *) 17531, 170, NULL },
    { (void *) 17542, 171, NULL },
    { (void *) 17552, 172, NULL },
-   { (void *) 17563, 1381, NULL },
-   { (void *) 17573, 1381, NULL },
-   { (void *) 17586, 1382, NULL },
-   { (void *) 17597, 1382, NULL },
+   { (void *) 17563, 1382, NULL },
+   { (void *) 17573, 1382, NULL },
+   { (void *) 17586, 1383, NULL },
+   { (void *) 17597, 1383, NULL },
    { (void *) 17611, 293, NULL },
-   { (void *) 17622, 869, NULL },
-   { (void *) 17636, 621, NULL },
-   { (void *) 17658, 1344, NULL },
-   { (void *) 17685, 620, NULL },
-   { (void *) 17702, 620, NULL },
-   { (void *) 17722, 620, NULL },
-   { (void *) 17742, 368, NULL },
-   { (void *) 17749, 368, NULL },
-   { (void *) 17759, 295, NULL },
-   { (void *) 17771, 294, NULL },
-   { (void *) 17783, 1383, NULL },
-   { (void *) 17795, 1383, NULL },
-   { (void *) 17810, 417, NULL },
-   { (void *) 17831, 417, NULL },
-   { (void *) 17855, 418, NULL },
-   { (void *) 17876, 418, NULL },
-   { (void *) 17900, 424, NULL },
-   { (void *) 17916, 424, NULL },
-   { (void *) 17935, 891, NULL },
-   { (void *) 17959, 929, NULL },
-   { (void *) 17988, 929, NULL },
-   { (void *) 18020, 1170, NULL },
-   { (void *) 18038, 705, NULL },
+   { (void *) 17622, 1069, NULL },
+   { (void *) 17650, 869, NULL },
+   { (void *) 17664, 621, NULL },
+   { (void *) 17686, 1345, NULL },
+   { (void *) 17713, 620, NULL },
+   { (void *) 17730, 620, NULL },
+   { (void *) 17750, 620, NULL },
+   { (void *) 17770, 368, NULL },
+   { (void *) 17777, 368, NULL },
+   { (void *) 17787, 295, NULL },
+   { (void *) 17799, 294, NULL },
+   { (void *) 17811, 1384, NULL },
+   { (void *) 17823, 1384, NULL },
+   { (void *) 17838, 417, NULL },
+   { (void *) 17859, 417, NULL },
+   { (void *) 17883, 418, NULL },
+   { (void *) 17904, 418, NULL },
+   { (void *) 17928, 424, NULL },
+   { (void *) 17944, 424, NULL },
+   { (void *) 17963, 891, NULL },
+   { (void *) 17987, 929, NULL },
+   { (void *) 18016, 929, NULL },
+   { (void *) 18048, 1171, NULL },
    { (void *) 18066, 705, NULL },
-   { (void *) 18097, 1170, NULL },
-   { (void *) 18118, 892, NULL },
-   { (void *) 18144, 930, NULL },
-   { (void *) 18175, 930, NULL },
-   { (void *) 18209, 1182, NULL },
-   { (void *) 18232, 1183, NULL },
-   { (void *) 18257, 376, NULL },
-   { (void *) 18273, 376, NULL },
-   { (void *) 18292, 377, NULL },
-   { (void *) 18309, 377, NULL },
-   { (void *) 18329, 378, NULL },
-   { (void *) 18345, 378, NULL },
-   { (void *) 18364, 379, NULL },
-   { (void *) 18381, 379, NULL },
-   { (void *) 18401, 380, NULL },
-   { (void *) 18417, 380, NULL },
-   { (void *) 18436, 381, NULL },
-   { (void *) 18453, 381, NULL },
-   { (void *) 18473, 382, NULL },
-   { (void *) 18489, 382, NULL },
-   { (void *) 18508, 383, NULL },
-   { (void *) 18525, 383, NULL },
-   { (void *) 18545, 384, NULL },
-   { (void *) 18561, 384, NULL },
-   { (void *) 18580, 385, NULL },
-   { (void *) 18597, 385, NULL },
-   { (void *) 18617, 386, NULL },
-   { (void *) 18633, 386, NULL },
-   { (void *) 18652, 387, NULL },
-   { (void *) 18669, 387, NULL },
-   { (void *) 18689, 388, NULL },
-   { (void *) 18705, 388, NULL },
-   { (void *) 18724, 389, NULL },
-   { (void *) 18741, 389, NULL },
-   { (void *) 18761, 390, NULL },
-   { (void *) 18777, 390, NULL },
-   { (void *) 18796, 391, NULL },
-   { (void *) 18813, 391, NULL },
-   { (void *) 18833, 392, NULL },
-   { (void *) 18849, 392, NULL },
-   { (void *) 18868, 393, NULL },
-   { (void *) 18885, 393, NULL },
-   { (void *) 18905, 394, NULL },
-   { (void *) 18921, 394, NULL },
-   { (void *) 18940, 395, NULL },
-   { (void *) 18957, 395, NULL },
-   { (void *) 18977, 396, NULL },
-   { (void *) 18993, 396, NULL },
-   { (void *) 19012, 397, NULL },
-   { (void *) 19029, 397, NULL },
-   { (void *) 19049, 398, NULL },
-   { (void *) 19065, 398, NULL },
-   { (void *) 19084, 399, NULL },
-   { (void *) 19101, 399, NULL },
-   { (void *) 19121, 400, NULL },
-   { (void *) 19137, 400, NULL },
-   { (void *) 19156, 401, NULL },
-   { (void *) 19173, 401, NULL },
-   { (void *) 19193, 402, NULL },
-   { (void *) 19209, 402, NULL },
-   { (void *) 19228, 403, NULL },
-   { (void *) 19245, 403, NULL },
-   { (void *) 19265, 404, NULL },
-   { (void *) 19281, 404, NULL },
-   { (void *) 19300, 405, NULL },
-   { (void *) 19317, 405, NULL },
-   { (void *) 19337, 406, NULL },
-   { (void *) 19353, 406, NULL },
-   { (void *) 19372, 407, NULL },
-   { (void *) 19389, 407, NULL },
-   { (void *) 19409, 1384, NULL },
-   { (void *) 19425, 1384, NULL },
-   { (void *) 19444, 738, NULL },
-   { (void *) 19462, 739, NULL },
-   { (void *) 19481, 740, NULL },
-   { (void *) 19499, 741, NULL },
-   { (void *) 19518, 742, NULL },
-   { (void *) 19536, 743, NULL },
-   { (void *) 19555, 744, NULL },
-   { (void *) 19573, 745, NULL },
-   { (void *) 19592, 990, NULL },
-   { (void *) 19608, 1032, NULL },
-   { (void *) 19637, 991, NULL },
-   { (void *) 19656, 1345, NULL },
-   { (void *) 19681, 992, NULL },
-   { (void *) 19700, 993, NULL },
-   { (void *) 19727, 994, NULL },
-   { (void *) 19755, 995, NULL },
-   { (void *) 19782, 996, NULL },
-   { (void *) 19809, 997, NULL },
-   { (void *) 19838, 998, NULL },
-   { (void *) 19862, 999, NULL },
-   { (void *) 19891, 1000, NULL },
-   { (void *) 19916, 1001, NULL },
-   { (void *) 19952, 0, NULL },
-   { (void *) 19960, 52, NULL },
-   { (void *) 19969, 53, NULL },
-   { (void *) 19979, 54, NULL },
-   { (void *) 19988, 55, NULL },
-   { (void *) 19998, 56, NULL },
-   { (void *) 20007, 57, NULL },
-   { (void *) 20017, 58, NULL },
-   { (void *) 20026, 59, NULL },
-   { (void *) 20036, 60, NULL },
-   { (void *) 20045, 61, NULL },
-   { (void *) 20055, 1385, NULL },
-   { (void *) 20064, 1385, NULL },
-   { (void *) 20076, 746, NULL },
-   { (void *) 20087, 747, NULL },
-   { (void *) 20099, 318, NULL },
-   { (void *) 20113, 1092, NULL },
-   { (void *) 20130, 1164, NULL },
-   { (void *) 20142, 1164, NULL },
-   { (void *) 20157, 1165, NULL },
-   { (void *) 20172, 1165, NULL },
-   { (void *) 20190, 1305, NULL },
-   { (void *) 20211, 1306, NULL },
-   { (void *) 20234, 296, NULL },
-   { (void *) 20240, 1386, NULL },
-   { (void *) 20247, 1386, NULL },
-   { (void *) 20257, 1387, NULL },
-   { (void *) 20264, 1387, NULL },
-   { (void *) 20274, 1254, NULL },
-   { (void *) 20290, 199, NULL },
-   { (void *) 20302, 800, NULL },
-   { (void *) 20319, 801, NULL },
-   { (void *) 20335, 801, NULL },
-   { (void *) 20354, 801, NULL },
-   { (void *) 20373, 807, NULL },
-   { (void *) 20396, 251, NULL },
-   { (void *) 20407, 252, NULL },
-   { (void *) 20419, 253, NULL },
-   { (void *) 20431, 249, NULL },
-   { (void *) 20443, 250, NULL },
-   { (void *) 20455, 247, NULL },
-   { (void *) 20470, 248, NULL },
-   { (void *) 20485, 246, NULL },
-   { (void *) 20495, 425, NULL },
-   { (void *) 20511, 425, NULL },
-   { (void *) 20530, 425, NULL },
-   { (void *) 20549, 425, NULL },
-   { (void *) 20569, 426, NULL },
-   { (void *) 20586, 426, NULL },
-   { (void *) 20606, 426, NULL },
-   { (void *) 20626, 426, NULL },
-   { (void *) 20647, 427, NULL },
-   { (void *) 20663, 427, NULL },
-   { (void *) 20681, 428, NULL },
-   { (void *) 20698, 428, NULL },
-   { (void *) 20717, 1406, NULL },
-   { (void *) 20733, 1406, NULL },
-   { (void *) 20752, 1407, NULL },
-   { (void *) 20769, 1407, NULL },
-   { (void *) 20789, 173, NULL },
-   { (void *) 20799, 1085, NULL },
-   { (void *) 20819, 1388, NULL },
-   { (void *) 20830, 1388, NULL },
-   { (void *) 20844, 174, NULL },
-   { (void *) 20856, 319, NULL },
-   { (void *) 20870, 1331, NULL },
-   { (void *) 20889, 1331, NULL },
-   { (void *) 20911, 1076, NULL },
-   { (void *) 20928, 1389, NULL },
-   { (void *) 20943, 1389, NULL },
-   { (void *) 20961, 175, NULL },
-   { (void *) 20976, 218, NULL },
-   { (void *) 20986, 334, NULL },
-   { (void *) 21002, 1166, NULL },
-   { (void *) 21016, 1166, NULL },
-   { (void *) 21033, 297, NULL },
-   { (void *) 21043, 200, NULL },
-   { (void *) 21051, 1410, NULL },
-   { (void *) 21072, 1410, NULL },
-   { (void *) 21096, 1410, NULL },
-   { (void *) 21120, 1410, NULL },
-   { (void *) 21144, 614, NULL },
-   { (void *) 21166, 614, NULL },
-   { (void *) 21190, 1266, NULL },
-   { (void *) 21209, 331, NULL },
-   { (void *) 21228, 331, NULL },
-   { (void *) 21250, 819, NULL },
-   { (void *) 21264, 819, NULL },
-   { (void *) 21281, 632, NULL },
-   { (void *) 21306, 633, NULL },
-   { (void *) 21332, 634, NULL },
-   { (void *) 21357, 635, NULL },
-   { (void *) 21383, 1362, NULL },
-   { (void *) 21410, 636, NULL },
-   { (void *) 21437, 637, NULL },
-   { (void *) 21465, 638, NULL },
-   { (void *) 21492, 639, NULL },
-   { (void *) 21520, 1363, NULL },
-   { (void *) 21549, 1262, NULL },
-   { (void *) 21575, 1263, NULL },
-   { (void *) 21602, 1264, NULL },
-   { (void *) 21628, 1265, NULL },
-   { (void *) 21655, 632, NULL },
-   { (void *) 21676, 633, NULL },
-   { (void *) 21698, 634, NULL },
-   { (void *) 21719, 635, NULL },
-   { (void *) 21741, 820, NULL },
-   { (void *) 21759, 820, NULL },
-   { (void *) 21780, 1195, NULL },
-   { (void *) 21803, 1196, NULL },
-   { (void *) 21826, 640, NULL },
-   { (void *) 21843, 1105, NULL },
-   { (void *) 21860, 1106, NULL },
-   { (void *) 21878, 1107, NULL },
-   { (void *) 21895, 1107, NULL },
-   { (void *) 21915, 1108, NULL },
-   { (void *) 21933, 1108, NULL },
-   { (void *) 21954, 1109, NULL },
-   { (void *) 21971, 1037, NULL },
-   { (void *) 21993, 1038, NULL },
-   { (void *) 22016, 1109, NULL },
-   { (void *) 22036, 1110, NULL },
-   { (void *) 22054, 1110, NULL },
-   { (void *) 22075, 1111, NULL },
-   { (void *) 22093, 1039, NULL },
-   { (void *) 22116, 1040, NULL },
-   { (void *) 22140, 1111, NULL },
-   { (void *) 22161, 1112, NULL },
-   { (void *) 22180, 1112, NULL },
-   { (void *) 22202, 1113, NULL },
-   { (void *) 22219, 1114, NULL },
-   { (void *) 22237, 1115, NULL },
-   { (void *) 22254, 1115, NULL },
-   { (void *) 22274, 1116, NULL },
-   { (void *) 22292, 1116, NULL },
-   { (void *) 22313, 1117, NULL },
-   { (void *) 22330, 1041, NULL },
-   { (void *) 22352, 1042, NULL },
-   { (void *) 22375, 1117, NULL },
-   { (void *) 22395, 1118, NULL },
-   { (void *) 22413, 1118, NULL },
-   { (void *) 22434, 1119, NULL },
-   { (void *) 22452, 1043, NULL },
-   { (void *) 22475, 1044, NULL },
-   { (void *) 22499, 1119, NULL },
-   { (void *) 22520, 1120, NULL },
-   { (void *) 22539, 1120, NULL },
-   { (void *) 22561, 1121, NULL },
-   { (void *) 22578, 1122, NULL },
-   { (void *) 22596, 1123, NULL },
-   { (void *) 22613, 1123, NULL },
-   { (void *) 22633, 1124, NULL },
-   { (void *) 22651, 1124, NULL },
-   { (void *) 22672, 1125, NULL },
-   { (void *) 22689, 1045, NULL },
-   { (void *) 22711, 1046, NULL },
-   { (void *) 22734, 1125, NULL },
-   { (void *) 22754, 1126, NULL },
-   { (void *) 22772, 1126, NULL },
-   { (void *) 22793, 1127, NULL },
-   { (void *) 22811, 1047, NULL },
-   { (void *) 22834, 1048, NULL },
-   { (void *) 22858, 1127, NULL },
-   { (void *) 22879, 1128, NULL },
-   { (void *) 22898, 1128, NULL },
-   { (void *) 22920, 1129, NULL },
-   { (void *) 22937, 1130, NULL },
-   { (void *) 22955, 1131, NULL },
-   { (void *) 22972, 1131, NULL },
-   { (void *) 22992, 1132, NULL },
-   { (void *) 23010, 1132, NULL },
-   { (void *) 23031, 1133, NULL },
-   { (void *) 23048, 1049, NULL },
-   { (void *) 23070, 1050, NULL },
-   { (void *) 23093, 1133, NULL },
-   { (void *) 23113, 1134, NULL },
-   { (void *) 23131, 1134, NULL },
-   { (void *) 23152, 1135, NULL },
-   { (void *) 23170, 1051, NULL },
-   { (void *) 23193, 1052, NULL },
-   { (void *) 23217, 1135, NULL },
-   { (void *) 23238, 1136, NULL },
-   { (void *) 23257, 1136, NULL },
-   { (void *) 23279, 922, NULL },
-   { (void *) 23307, 923, NULL },
-   { (void *) 23336, 1137, NULL },
-   { (void *) 23360, 1138, NULL },
-   { (void *) 23384, 1138, NULL },
-   { (void *) 23411, 1139, NULL },
-   { (void *) 23437, 1140, NULL },
-   { (void *) 23463, 1140, NULL },
-   { (void *) 23492, 1141, NULL },
-   { (void *) 23518, 1142, NULL },
-   { (void *) 23544, 1142, NULL },
-   { (void *) 23573, 1143, NULL },
-   { (void *) 23597, 1144, NULL },
-   { (void *) 23621, 1144, NULL },
-   { (void *) 23648, 1145, NULL },
-   { (void *) 23674, 1146, NULL },
-   { (void *) 23700, 1146, NULL },
-   { (void *) 23729, 1147, NULL },
-   { (void *) 23755, 1148, NULL },
-   { (void *) 23781, 1148, NULL },
-   { (void *) 23810, 1149, NULL },
-   { (void *) 23834, 1150, NULL },
-   { (void *) 23858, 1150, NULL },
-   { (void *) 23885, 1151, NULL },
-   { (void *) 23911, 1152, NULL },
-   { (void *) 23937, 1152, NULL },
-   { (void *) 23966, 1153, NULL },
-   { (void *) 23992, 1154, NULL },
-   { (void *) 24018, 1154, NULL },
-   { (void *) 24047, 706, NULL },
-   { (void *) 24063, 706, NULL },
-   { (void *) 24082, 219, NULL },
-   { (void *) 24093, 335, NULL },
-   { (void *) 24110, 1167, NULL },
-   { (void *) 24125, 1167, NULL },
-   { (void *) 24143, 298, NULL },
-   { (void *) 24154, 201, NULL },
-   { (void *) 24163, 733, NULL },
-   { (void *) 24176, 733, NULL },
-   { (void *) 24192, 1086, NULL },
-   { (void *) 24208, 62, NULL },
-   { (void *) 24220, 63, NULL },
-   { (void *) 24233, 64, NULL },
-   { (void *) 24245, 65, NULL },
-   { (void *) 24258, 66, NULL },
-   { (void *) 24270, 67, NULL },
-   { (void *) 24283, 68, NULL },
-   { (void *) 24295, 69, NULL },
-   { (void *) 24308, 70, NULL },
-   { (void *) 24320, 71, NULL },
-   { (void *) 24333, 72, NULL },
-   { (void *) 24345, 73, NULL },
-   { (void *) 24358, 74, NULL },
-   { (void *) 24370, 75, NULL },
-   { (void *) 24383, 76, NULL },
-   { (void *) 24395, 77, NULL },
-   { (void *) 24408, 78, NULL },
-   { (void *) 24420, 79, NULL },
-   { (void *) 24433, 80, NULL },
-   { (void *) 24445, 81, NULL },
-   { (void *) 24458, 82, NULL },
-   { (void *) 24470, 83, NULL },
-   { (void *) 24483, 84, NULL },
-   { (void *) 24495, 85, NULL },
-   { (void *) 24508, 254, NULL },
-   { (void *) 24519, 254, NULL },
-   { (void *) 24532, 256, NULL },
-   { (void *) 24543, 860, NULL },
-   { (void *) 24555, 860, NULL },
-   { (void *) 24570, 860, NULL },
-   { (void *) 24585, 86, NULL },
-   { (void *) 24591, 87, NULL },
-   { (void *) 24598, 88, NULL },
-   { (void *) 24604, 89, NULL },
-   { (void *) 24611, 90, NULL },
-   { (void *) 24617, 91, NULL },
-   { (void *) 24624, 92, NULL },
-   { (void *) 24630, 93, NULL },
-   { (void *) 24637, 816, NULL },
-   { (void *) 24659, 196, NULL },
-   { (void *) 24670, 679, NULL },
-   { (void *) 24690, 679, NULL },
-   { (void *) 24713, 680, NULL },
-   { (void *) 24744, 680, NULL },
-   { (void *) 24778, 679, NULL },
-   { (void *) 24801, 1197, NULL },
-   { (void *) 24827, 369, NULL },
-   { (void *) 24842, 369, NULL },
-   { (void *) 24860, 370, NULL },
-   { (void *) 24872, 370, NULL },
-   { (void *) 24887, 1173, NULL },
-   { (void *) 24905, 808, NULL },
-   { (void *) 24929, 299, NULL },
-   { (void *) 24937, 300, NULL },
-   { (void *) 24945, 1390, NULL },
-   { (void *) 24953, 1390, NULL },
-   { (void *) 24964, 419, NULL },
-   { (void *) 24979, 419, NULL },
-   { (void *) 24997, 1391, NULL },
-   { (void *) 25013, 1391, NULL },
-   { (void *) 25032, 1255, NULL },
-   { (void *) 25045, 1087, NULL },
-   { (void *) 25059, 1087, NULL },
-   { (void *) 25074, 708, NULL },
-   { (void *) 25086, 1088, NULL },
-   { (void *) 25103, 1088, NULL },
-   { (void *) 25121, 725, NULL },
-   { (void *) 25141, 725, NULL },
-   { (void *) 25164, 725, NULL },
-   { (void *) 25187, 726, NULL },
-   { (void *) 25208, 726, NULL },
-   { (void *) 25232, 726, NULL },
-   { (void *) 25256, 727, NULL },
-   { (void *) 25274, 728, NULL },
-   { (void *) 25293, 729, NULL },
-   { (void *) 25311, 730, NULL },
-   { (void *) 25330, 301, NULL },
-   { (void *) 25337, 302, NULL },
-   { (void *) 25344, 1392, NULL },
-   { (void *) 25351, 1392, NULL },
-   { (void *) 25361, 176, NULL },
-   { (void *) 25369, 835, NULL },
-   { (void *) 25383, 835, NULL },
-   { (void *) 25400, 836, NULL },
-   { (void *) 25415, 836, NULL },
-   { (void *) 25433, 837, NULL },
-   { (void *) 25449, 837, NULL },
-   { (void *) 25468, 429, NULL },
-   { (void *) 25485, 429, NULL },
-   { (void *) 25505, 430, NULL },
-   { (void *) 25523, 430, NULL },
-   { (void *) 25544, 431, NULL },
-   { (void *) 25561, 431, NULL },
-   { (void *) 25581, 432, NULL },
-   { (void *) 25599, 432, NULL },
-   { (void *) 25620, 1168, NULL },
-   { (void *) 25637, 1168, NULL },
-   { (void *) 25657, 1169, NULL },
-   { (void *) 25675, 1169, NULL },
-   { (void *) 25696, 433, NULL },
-   { (void *) 25713, 433, NULL },
-   { (void *) 25733, 434, NULL },
-   { (void *) 25751, 434, NULL },
-   { (void *) 25772, 435, NULL },
-   { (void *) 25789, 435, NULL },
-   { (void *) 25809, 436, NULL },
-   { (void *) 25827, 436, NULL },
-   { (void *) 25848, 437, NULL },
-   { (void *) 25866, 437, NULL },
-   { (void *) 25887, 438, NULL },
-   { (void *) 25906, 438, NULL },
-   { (void *) 25928, 439, NULL },
-   { (void *) 25946, 439, NULL },
-   { (void *) 25967, 440, NULL },
-   { (void *) 25986, 440, NULL },
-   { (void *) 26008, 441, NULL },
-   { (void *) 26026, 441, NULL },
-   { (void *) 26047, 442, NULL },
-   { (void *) 26066, 442, NULL },
-   { (void *) 26088, 748, NULL },
-   { (void *) 26107, 749, NULL },
-   { (void *) 26127, 443, NULL },
-   { (void *) 26149, 443, NULL },
-   { (void *) 26174, 195, NULL },
-   { (void *) 26187, 1303, NULL },
-   { (void *) 26216, 1346, NULL },
-   { (void *) 26243, 360, NULL },
-   { (void *) 26261, 360, NULL },
-   { (void *) 26282, 1256, NULL },
-   { (void *) 26311, 177, NULL },
-   { (void *) 26322, 817, NULL },
-   { (void *) 26335, 510, NULL },
-   { (void *) 26348, 510, NULL },
-   { (void *) 26364, 899, NULL },
-   { (void *) 26390, 1347, NULL },
-   { (void *) 26409, 1069, NULL },
-   { (void *) 26426, 1069, NULL },
-   { (void *) 26446, 243, NULL },
-   { (void *) 26458, 511, NULL },
-   { (void *) 26478, 1361, NULL },
-   { (void *) 26501, 209, NULL },
-   { (void *) 26513, 512, NULL },
-   { (void *) 26533, 244, NULL },
-   { (void *) 26543, 513, NULL },
-   { (void *) 26561, 513, NULL },
-   { (void *) 26582, 1273, NULL },
-   { (void *) 26602, 615, NULL },
-   { (void *) 26612, 615, NULL },
-   { (void *) 26625, 615, NULL },
-   { (void *) 26638, 615, NULL },
-   { (void *) 26651, 900, NULL },
-   { (void *) 26666, 900, NULL },
-   { (void *) 26684, 900, NULL },
-   { (void *) 26702, 1241, NULL },
-   { (void *) 26724, 1242, NULL },
-   { (void *) 26746, 94, NULL },
-   { (void *) 26757, 95, NULL },
-   { (void *) 26769, 96, NULL },
-   { (void *) 26780, 97, NULL },
-   { (void *) 26792, 98, NULL },
-   { (void *) 26803, 99, NULL },
-   { (void *) 26815, 100, NULL },
-   { (void *) 26826, 101, NULL },
-   { (void *) 26838, 102, NULL },
-   { (void *) 26849, 103, NULL },
-   { (void *) 26861, 104, NULL },
-   { (void *) 26872, 105, NULL },
-   { (void *) 26884, 106, NULL },
-   { (void *) 26895, 107, NULL },
-   { (void *) 26907, 108, NULL },
-   { (void *) 26918, 109, NULL },
-   { (void *) 26930, 110, NULL },
-   { (void *) 26941, 111, NULL },
-   { (void *) 26953, 112, NULL },
-   { (void *) 26964, 113, NULL },
-   { (void *) 26976, 114, NULL },
-   { (void *) 26987, 115, NULL },
-   { (void *) 26999, 116, NULL },
-   { (void *) 27010, 117, NULL },
-   { (void *) 27022, 118, NULL },
-   { (void *) 27033, 119, NULL },
-   { (void *) 27045, 120, NULL },
-   { (void *) 27056, 121, NULL },
-   { (void *) 27068, 122, NULL },
-   { (void *) 27079, 123, NULL },
-   { (void *) 27091, 124, NULL },
-   { (void *) 27102, 125, NULL },
-   { (void *) 27114, 750, NULL },
-   { (void *) 27127, 751, NULL },
-   { (void *) 27141, 752, NULL },
-   { (void *) 27154, 753, NULL },
-   { (void *) 27168, 754, NULL },
-   { (void *) 27181, 755, NULL },
-   { (void *) 27195, 756, NULL },
-   { (void *) 27208, 757, NULL },
-   { (void *) 27222, 320, NULL },
-   { (void *) 27238, 1093, NULL },
-   { (void *) 27257, 184, NULL },
-   { (void *) 27265, 185, NULL },
-   { (void *) 27274, 186, NULL },
-   { (void *) 27282, 187, NULL },
-   { (void *) 27291, 1393, NULL },
-   { (void *) 27299, 1393, NULL },
-   { (void *) 27310, 1394, NULL },
+   { (void *) 18094, 705, NULL },
+   { (void *) 18125, 1171, NULL },
+   { (void *) 18146, 892, NULL },
+   { (void *) 18172, 930, NULL },
+   { (void *) 18203, 930, NULL },
+   { (void *) 18237, 1183, NULL },
+   { (void *) 18260, 1184, NULL },
+   { (void *) 18285, 376, NULL },
+   { (void *) 18301, 376, NULL },
+   { (void *) 18320, 377, NULL },
+   { (void *) 18337, 377, NULL },
+   { (void *) 18357, 378, NULL },
+   { (void *) 18373, 378, NULL },
+   { (void *) 18392, 379, NULL },
+   { (void *) 18409, 379, NULL },
+   { (void *) 18429, 380, NULL },
+   { (void *) 18445, 380, NULL },
+   { (void *) 18464, 381, NULL },
+   { (void *) 18481, 381, NULL },
+   { (void *) 18501, 382, NULL },
+   { (void *) 18517, 382, NULL },
+   { (void *) 18536, 383, NULL },
+   { (void *) 18553, 383, NULL },
+   { (void *) 18573, 384, NULL },
+   { (void *) 18589, 384, NULL },
+   { (void *) 18608, 385, NULL },
+   { (void *) 18625, 385, NULL },
+   { (void *) 18645, 386, NULL },
+   { (void *) 18661, 386, NULL },
+   { (void *) 18680, 387, NULL },
+   { (void *) 18697, 387, NULL },
+   { (void *) 18717, 388, NULL },
+   { (void *) 18733, 388, NULL },
+   { (void *) 18752, 389, NULL },
+   { (void *) 18769, 389, NULL },
+   { (void *) 18789, 390, NULL },
+   { (void *) 18805, 390, NULL },
+   { (void *) 18824, 391, NULL },
+   { (void *) 18841, 391, NULL },
+   { (void *) 18861, 392, NULL },
+   { (void *) 18877, 392, NULL },
+   { (void *) 18896, 393, NULL },
+   { (void *) 18913, 393, NULL },
+   { (void *) 18933, 394, NULL },
+   { (void *) 18949, 394, NULL },
+   { (void *) 18968, 395, NULL },
+   { (void *) 18985, 395, NULL },
+   { (void *) 19005, 396, NULL },
+   { (void *) 19021, 396, NULL },
+   { (void *) 19040, 397, NULL },
+   { (void *) 19057, 397, NULL },
+   { (void *) 19077, 398, NULL },
+   { (void *) 19093, 398, NULL },
+   { (void *) 19112, 399, NULL },
+   { (void *) 19129, 399, NULL },
+   { (void *) 19149, 400, NULL },
+   { (void *) 19165, 400, NULL },
+   { (void *) 19184, 401, NULL },
+   { (void *) 19201, 401, NULL },
+   { (void *) 19221, 402, NULL },
+   { (void *) 19237, 402, NULL },
+   { (void *) 19256, 403, NULL },
+   { (void *) 19273, 403, NULL },
+   { (void *) 19293, 404, NULL },
+   { (void *) 19309, 404, NULL },
+   { (void *) 19328, 405, NULL },
+   { (void *) 19345, 405, NULL },
+   { (void *) 19365, 406, NULL },
+   { (void *) 19381, 406, NULL },
+   { (void *) 19400, 407, NULL },
+   { (void *) 19417, 407, NULL },
+   { (void *) 19437, 1385, NULL },
+   { (void *) 19453, 1385, NULL },
+   { (void *) 19472, 738, NULL },
+   { (void *) 19490, 739, NULL },
+   { (void *) 19509, 740, NULL },
+   { (void *) 19527, 741, NULL },
+   { (void *) 19546, 742, NULL },
+   { (void *) 19564, 743, NULL },
+   { (void *) 19583, 744, NULL },
+   { (void *) 19601, 745, NULL },
+   { (void *) 19620, 990, NULL },
+   { (void *) 19636, 1032, NULL },
+   { (void *) 19665, 991, NULL },
+   { (void *) 19684, 1346, NULL },
+   { (void *) 19709, 992, NULL },
+   { (void *) 19728, 993, NULL },
+   { (void *) 19755, 994, NULL },
+   { (void *) 19783, 995, NULL },
+   { (void *) 19810, 996, NULL },
+   { (void *) 19837, 997, NULL },
+   { (void *) 19866, 998, NULL },
+   { (void *) 19890, 999, NULL },
+   { (void *) 19919, 1000, NULL },
+   { (void *) 19944, 1001, NULL },
+   { (void *) 19980, 0, NULL },
+   { (void *) 19988, 52, NULL },
+   { (void *) 19997, 53, NULL },
+   { (void *) 20007, 54, NULL },
+   { (void *) 20016, 55, NULL },
+   { (void *) 20026, 56, NULL },
+   { (void *) 20035, 57, NULL },
+   { (void *) 20045, 58, NULL },
+   { (void *) 20054, 59, NULL },
+   { (void *) 20064, 60, NULL },
+   { (void *) 20073, 61, NULL },
+   { (void *) 20083, 1386, NULL },
+   { (void *) 20092, 1386, NULL },
+   { (void *) 20104, 746, NULL },
+   { (void *) 20115, 747, NULL },
+   { (void *) 20127, 318, NULL },
+   { (void *) 20141, 1093, NULL },
+   { (void *) 20158, 1165, NULL },
+   { (void *) 20170, 1165, NULL },
+   { (void *) 20185, 1166, NULL },
+   { (void *) 20200, 1166, NULL },
+   { (void *) 20218, 1306, NULL },
+   { (void *) 20239, 1307, NULL },
+   { (void *) 20262, 296, NULL },
+   { (void *) 20268, 1387, NULL },
+   { (void *) 20275, 1387, NULL },
+   { (void *) 20285, 1388, NULL },
+   { (void *) 20292, 1388, NULL },
+   { (void *) 20302, 1255, NULL },
+   { (void *) 20318, 199, NULL },
+   { (void *) 20330, 800, NULL },
+   { (void *) 20347, 801, NULL },
+   { (void *) 20363, 801, NULL },
+   { (void *) 20382, 801, NULL },
+   { (void *) 20401, 807, NULL },
+   { (void *) 20424, 251, NULL },
+   { (void *) 20435, 252, NULL },
+   { (void *) 20447, 253, NULL },
+   { (void *) 20459, 249, NULL },
+   { (void *) 20471, 250, NULL },
+   { (void *) 20483, 247, NULL },
+   { (void *) 20498, 248, NULL },
+   { (void *) 20513, 246, NULL },
+   { (void *) 20523, 425, NULL },
+   { (void *) 20539, 425, NULL },
+   { (void *) 20558, 425, NULL },
+   { (void *) 20577, 425, NULL },
+   { (void *) 20597, 426, NULL },
+   { (void *) 20614, 426, NULL },
+   { (void *) 20634, 426, NULL },
+   { (void *) 20654, 426, NULL },
+   { (void *) 20675, 427, NULL },
+   { (void *) 20691, 427, NULL },
+   { (void *) 20709, 428, NULL },
+   { (void *) 20726, 428, NULL },
+   { (void *) 20745, 1407, NULL },
+   { (void *) 20761, 1407, NULL },
+   { (void *) 20780, 1408, NULL },
+   { (void *) 20797, 1408, NULL },
+   { (void *) 20817, 173, NULL },
+   { (void *) 20827, 1086, NULL },
+   { (void *) 20847, 1389, NULL },
+   { (void *) 20858, 1389, NULL },
+   { (void *) 20872, 174, NULL },
+   { (void *) 20884, 319, NULL },
+   { (void *) 20898, 1332, NULL },
+   { (void *) 20917, 1332, NULL },
+   { (void *) 20939, 1077, NULL },
+   { (void *) 20956, 1390, NULL },
+   { (void *) 20971, 1390, NULL },
+   { (void *) 20989, 175, NULL },
+   { (void *) 21004, 218, NULL },
+   { (void *) 21014, 334, NULL },
+   { (void *) 21030, 1167, NULL },
+   { (void *) 21044, 1167, NULL },
+   { (void *) 21061, 297, NULL },
+   { (void *) 21071, 200, NULL },
+   { (void *) 21079, 1411, NULL },
+   { (void *) 21100, 1411, NULL },
+   { (void *) 21124, 1411, NULL },
+   { (void *) 21148, 1411, NULL },
+   { (void *) 21172, 614, NULL },
+   { (void *) 21194, 614, NULL },
+   { (void *) 21218, 1267, NULL },
+   { (void *) 21237, 331, NULL },
+   { (void *) 21256, 331, NULL },
+   { (void *) 21278, 819, NULL },
+   { (void *) 21292, 819, NULL },
+   { (void *) 21309, 632, NULL },
+   { (void *) 21334, 633, NULL },
+   { (void *) 21360, 634, NULL },
+   { (void *) 21385, 635, NULL },
+   { (void *) 21411, 1363, NULL },
+   { (void *) 21438, 636, NULL },
+   { (void *) 21465, 637, NULL },
+   { (void *) 21493, 638, NULL },
+   { (void *) 21520, 639, NULL },
+   { (void *) 21548, 1364, NULL },
+   { (void *) 21577, 1263, NULL },
+   { (void *) 21603, 1264, NULL },
+   { (void *) 21630, 1265, NULL },
+   { (void *) 21656, 1266, NULL },
+   { (void *) 21683, 632, NULL },
+   { (void *) 21704, 633, NULL },
+   { (void *) 21726, 634, NULL },
+   { (void *) 21747, 635, NULL },
+   { (void *) 21769, 820, NULL },
+   { (void *) 21787, 820, NULL },
+   { (void *) 21808, 1196, NULL },
+   { (void *) 21831, 1197, NULL },
+   { (void *) 21854, 640, NULL },
+   { (void *) 21871, 1106, NULL },
+   { (void *) 21888, 1107, NULL },
+   { (void *) 21906, 1108, NULL },
+   { (void *) 21923, 1108, NULL },
+   { (void *) 21943, 1109, NULL },
+   { (void *) 21961, 1109, NULL },
+   { (void *) 21982, 1110, NULL },
+   { (void *) 21999, 1037, NULL },
+   { (void *) 22021, 1038, NULL },
+   { (void *) 22044, 1110, NULL },
+   { (void *) 22064, 1111, NULL },
+   { (void *) 22082, 1111, NULL },
+   { (void *) 22103, 1112, NULL },
+   { (void *) 22121, 1039, NULL },
+   { (void *) 22144, 1040, NULL },
+   { (void *) 22168, 1112, NULL },
+   { (void *) 22189, 1113, NULL },
+   { (void *) 22208, 1113, NULL },
+   { (void *) 22230, 1114, NULL },
+   { (void *) 22247, 1115, NULL },
+   { (void *) 22265, 1116, NULL },
+   { (void *) 22282, 1116, NULL },
+   { (void *) 22302, 1117, NULL },
+   { (void *) 22320, 1117, NULL },
+   { (void *) 22341, 1118, NULL },
+   { (void *) 22358, 1041, NULL },
+   { (void *) 22380, 1042, NULL },
+   { (void *) 22403, 1118, NULL },
+   { (void *) 22423, 1119, NULL },
+   { (void *) 22441, 1119, NULL },
+   { (void *) 22462, 1120, NULL },
+   { (void *) 22480, 1043, NULL },
+   { (void *) 22503, 1044, NULL },
+   { (void *) 22527, 1120, NULL },
+   { (void *) 22548, 1121, NULL },
+   { (void *) 22567, 1121, NULL },
+   { (void *) 22589, 1122, NULL },
+   { (void *) 22606, 1123, NULL },
+   { (void *) 22624, 1124, NULL },
+   { (void *) 22641, 1124, NULL },
+   { (void *) 22661, 1125, NULL },
+   { (void *) 22679, 1125, NULL },
+   { (void *) 22700, 1126, NULL },
+   { (void *) 22717, 1045, NULL },
+   { (void *) 22739, 1046, NULL },
+   { (void *) 22762, 1126, NULL },
+   { (void *) 22782, 1127, NULL },
+   { (void *) 22800, 1127, NULL },
+   { (void *) 22821, 1128, NULL },
+   { (void *) 22839, 1047, NULL },
+   { (void *) 22862, 1048, NULL },
+   { (void *) 22886, 1128, NULL },
+   { (void *) 22907, 1129, NULL },
+   { (void *) 22926, 1129, NULL },
+   { (void *) 22948, 1130, NULL },
+   { (void *) 22965, 1131, NULL },
+   { (void *) 22983, 1132, NULL },
+   { (void *) 23000, 1132, NULL },
+   { (void *) 23020, 1133, NULL },
+   { (void *) 23038, 1133, NULL },
+   { (void *) 23059, 1134, NULL },
+   { (void *) 23076, 1049, NULL },
+   { (void *) 23098, 1050, NULL },
+   { (void *) 23121, 1134, NULL },
+   { (void *) 23141, 1135, NULL },
+   { (void *) 23159, 1135, NULL },
+   { (void *) 23180, 1136, NULL },
+   { (void *) 23198, 1051, NULL },
+   { (void *) 23221, 1052, NULL },
+   { (void *) 23245, 1136, NULL },
+   { (void *) 23266, 1137, NULL },
+   { (void *) 23285, 1137, NULL },
+   { (void *) 23307, 922, NULL },
+   { (void *) 23335, 923, NULL },
+   { (void *) 23364, 1138, NULL },
+   { (void *) 23388, 1139, NULL },
+   { (void *) 23412, 1139, NULL },
+   { (void *) 23439, 1140, NULL },
+   { (void *) 23465, 1141, NULL },
+   { (void *) 23491, 1141, NULL },
+   { (void *) 23520, 1142, NULL },
+   { (void *) 23546, 1143, NULL },
+   { (void *) 23572, 1143, NULL },
+   { (void *) 23601, 1144, NULL },
+   { (void *) 23625, 1145, NULL },
+   { (void *) 23649, 1145, NULL },
+   { (void *) 23676, 1146, NULL },
+   { (void *) 23702, 1147, NULL },
+   { (void *) 23728, 1147, NULL },
+   { (void *) 23757, 1148, NULL },
+   { (void *) 23783, 1149, NULL },
+   { (void *) 23809, 1149, NULL },
+   { (void *) 23838, 1150, NULL },
+   { (void *) 23862, 1151, NULL },
+   { (void *) 23886, 1151, NULL },
+   { (void *) 23913, 1152, NULL },
+   { (void *) 23939, 1153, NULL },
+   { (void *) 23965, 1153, NULL },
+   { (void *) 23994, 1154, NULL },
+   { (void *) 24020, 1155, NULL },
+   { (void *) 24046, 1155, NULL },
+   { (void *) 24075, 706, NULL },
+   { (void *) 24091, 706, NULL },
+   { (void *) 24110, 219, NULL },
+   { (void *) 24121, 335, NULL },
+   { (void *) 24138, 1168, NULL },
+   { (void *) 24153, 1168, NULL },
+   { (void *) 24171, 298, NULL },
+   { (void *) 24182, 201, NULL },
+   { (void *) 24191, 733, NULL },
+   { (void *) 24204, 733, NULL },
+   { (void *) 24220, 1087, NULL },
+   { (void *) 24236, 62, NULL },
+   { (void *) 24248, 63, NULL },
+   { (void *) 24261, 64, NULL },
+   { (void *) 24273, 65, NULL },
+   { (void *) 24286, 66, NULL },
+   { (void *) 24298, 67, NULL },
+   { (void *) 24311, 68, NULL },
+   { (void *) 24323, 69, NULL },
+   { (void *) 24336, 70, NULL },
+   { (void *) 24348, 71, NULL },
+   { (void *) 24361, 72, NULL },
+   { (void *) 24373, 73, NULL },
+   { (void *) 24386, 74, NULL },
+   { (void *) 24398, 75, NULL },
+   { (void *) 24411, 76, NULL },
+   { (void *) 24423, 77, NULL },
+   { (void *) 24436, 78, NULL },
+   { (void *) 24448, 79, NULL },
+   { (void *) 24461, 80, NULL },
+   { (void *) 24473, 81, NULL },
+   { (void *) 24486, 82, NULL },
+   { (void *) 24498, 83, NULL },
+   { (void *) 24511, 84, NULL },
+   { (void *) 24523, 85, NULL },
+   { (void *) 24536, 254, NULL },
+   { (void *) 24547, 254, NULL },
+   { (void *) 24560, 256, NULL },
+   { (void *) 24571, 860, NULL },
+   { (void *) 24583, 860, NULL },
+   { (void *) 24598, 860, NULL },
+   { (void *) 24613, 86, NULL },
+   { (void *) 24619, 87, NULL },
+   { (void *) 24626, 88, NULL },
+   { (void *) 24632, 89, NULL },
+   { (void *) 24639, 90, NULL },
+   { (void *) 24645, 91, NULL },
+   { (void *) 24652, 92, NULL },
+   { (void *) 24658, 93, NULL },
+   { (void *) 24665, 816, NULL },
+   { (void *) 24687, 196, NULL },
+   { (void *) 24698, 679, NULL },
+   { (void *) 24718, 679, NULL },
+   { (void *) 24741, 680, NULL },
+   { (void *) 24772, 680, NULL },
+   { (void *) 24806, 679, NULL },
+   { (void *) 24829, 1198, NULL },
+   { (void *) 24855, 369, NULL },
+   { (void *) 24870, 369, NULL },
+   { (void *) 24888, 370, NULL },
+   { (void *) 24900, 370, NULL },
+   { (void *) 24915, 1174, NULL },
+   { (void *) 24933, 808, NULL },
+   { (void *) 24957, 299, NULL },
+   { (void *) 24965, 300, NULL },
+   { (void *) 24973, 1391, NULL },
+   { (void *) 24981, 1391, NULL },
+   { (void *) 24992, 419, NULL },
+   { (void *) 25007, 419, NULL },
+   { (void *) 25025, 1392, NULL },
+   { (void *) 25041, 1392, NULL },
+   { (void *) 25060, 1256, NULL },
+   { (void *) 25073, 1088, NULL },
+   { (void *) 25087, 1088, NULL },
+   { (void *) 25102, 708, NULL },
+   { (void *) 25114, 1089, NULL },
+   { (void *) 25131, 1089, NULL },
+   { (void *) 25149, 725, NULL },
+   { (void *) 25169, 725, NULL },
+   { (void *) 25192, 725, NULL },
+   { (void *) 25215, 726, NULL },
+   { (void *) 25236, 726, NULL },
+   { (void *) 25260, 726, NULL },
+   { (void *) 25284, 727, NULL },
+   { (void *) 25302, 728, NULL },
+   { (void *) 25321, 729, NULL },
+   { (void *) 25339, 730, NULL },
+   { (void *) 25358, 301, NULL },
+   { (void *) 25365, 302, NULL },
+   { (void *) 25372, 1393, NULL },
+   { (void *) 25379, 1393, NULL },
+   { (void *) 25389, 176, NULL },
+   { (void *) 25397, 835, NULL },
+   { (void *) 25411, 835, NULL },
+   { (void *) 25428, 836, NULL },
+   { (void *) 25443, 836, NULL },
+   { (void *) 25461, 837, NULL },
+   { (void *) 25477, 837, NULL },
+   { (void *) 25496, 429, NULL },
+   { (void *) 25513, 429, NULL },
+   { (void *) 25533, 430, NULL },
+   { (void *) 25551, 430, NULL },
+   { (void *) 25572, 431, NULL },
+   { (void *) 25589, 431, NULL },
+   { (void *) 25609, 432, NULL },
+   { (void *) 25627, 432, NULL },
+   { (void *) 25648, 1169, NULL },
+   { (void *) 25665, 1169, NULL },
+   { (void *) 25685, 1170, NULL },
+   { (void *) 25703, 1170, NULL },
+   { (void *) 25724, 433, NULL },
+   { (void *) 25741, 433, NULL },
+   { (void *) 25761, 434, NULL },
+   { (void *) 25779, 434, NULL },
+   { (void *) 25800, 435, NULL },
+   { (void *) 25817, 435, NULL },
+   { (void *) 25837, 436, NULL },
+   { (void *) 25855, 436, NULL },
+   { (void *) 25876, 437, NULL },
+   { (void *) 25894, 437, NULL },
+   { (void *) 25915, 438, NULL },
+   { (void *) 25934, 438, NULL },
+   { (void *) 25956, 439, NULL },
+   { (void *) 25974, 439, NULL },
+   { (void *) 25995, 440, NULL },
+   { (void *) 26014, 440, NULL },
+   { (void *) 26036, 441, NULL },
+   { (void *) 26054, 441, NULL },
+   { (void *) 26075, 442, NULL },
+   { (void *) 26094, 442, NULL },
+   { (void *) 26116, 748, NULL },
+   { (void *) 26135, 749, NULL },
+   { (void *) 26155, 443, NULL },
+   { (void *) 26177, 443, NULL },
+   { (void *) 26202, 195, NULL },
+   { (void *) 26215, 1304, NULL },
+   { (void *) 26244, 1347, NULL },
+   { (void *) 26271, 360, NULL },
+   { (void *) 26289, 360, NULL },
+   { (void *) 26310, 1257, NULL },
+   { (void *) 26339, 177, NULL },
+   { (void *) 26350, 817, NULL },
+   { (void *) 26363, 510, NULL },
+   { (void *) 26376, 510, NULL },
+   { (void *) 26392, 899, NULL },
+   { (void *) 26418, 1348, NULL },
+   { (void *) 26437, 1070, NULL },
+   { (void *) 26454, 1070, NULL },
+   { (void *) 26474, 243, NULL },
+   { (void *) 26486, 511, NULL },
+   { (void *) 26506, 1362, NULL },
+   { (void *) 26529, 209, NULL },
+   { (void *) 26541, 512, NULL },
+   { (void *) 26561, 244, NULL },
+   { (void *) 26571, 513, NULL },
+   { (void *) 26589, 513, NULL },
+   { (void *) 26610, 1274, NULL },
+   { (void *) 26630, 615, NULL },
+   { (void *) 26640, 615, NULL },
+   { (void *) 26653, 615, NULL },
+   { (void *) 26666, 615, NULL },
+   { (void *) 26679, 900, NULL },
+   { (void *) 26694, 900, NULL },
+   { (void *) 26712, 900, NULL },
+   { (void *) 26730, 1242, NULL },
+   { (void *) 26752, 1243, NULL },
+   { (void *) 26774, 94, NULL },
+   { (void *) 26785, 95, NULL },
+   { (void *) 26797, 96, NULL },
+   { (void *) 26808, 97, NULL },
+   { (void *) 26820, 98, NULL },
+   { (void *) 26831, 99, NULL },
+   { (void *) 26843, 100, NULL },
+   { (void *) 26854, 101, NULL },
+   { (void *) 26866, 102, NULL },
+   { (void *) 26877, 103, NULL },
+   { (void *) 26889, 104, NULL },
+   { (void *) 26900, 105, NULL },
+   { (void *) 26912, 106, NULL },
+   { (void *) 26923, 107, NULL },
+   { (void *) 26935, 108, NULL },
+   { (void *) 26946, 109, NULL },
+   { (void *) 26958, 110, NULL },
+   { (void *) 26969, 111, NULL },
+   { (void *) 26981, 112, NULL },
+   { (void *) 26992, 113, NULL },
+   { (void *) 27004, 114, NULL },
+   { (void *) 27015, 115, NULL },
+   { (void *) 27027, 116, NULL },
+   { (void *) 27038, 117, NULL },
+   { (void *) 27050, 118, NULL },
+   { (void *) 27061, 119, NULL },
+   { (void *) 27073, 120, NULL },
+   { (void *) 27084, 121, NULL },
+   { (void *) 27096, 122, NULL },
+   { (void *) 27107, 123, NULL },
+   { (void *) 27119, 124, NULL },
+   { (void *) 27130, 125, NULL },
+   { (void *) 27142, 750, NULL },
+   { (void *) 27155, 751, NULL },
+   { (void *) 27169, 752, NULL },
+   { (void *) 27182, 753, NULL },
+   { (void *) 27196, 754, NULL },
+   { (void *) 27209, 755, NULL },
+   { (void *) 27223, 756, NULL },
+   { (void *) 27236, 757, NULL },
+   { (void *) 27250, 320, NULL },
+   { (void *) 27266, 1094, NULL },
+   { (void *) 27285, 184, NULL },
+   { (void *) 27293, 185, NULL },
+   { (void *) 27302, 186, NULL },
+   { (void *) 27310, 187, NULL },
    { (void *) 27319, 1394, NULL },
-   { (void *) 27331, 188, NULL },
-   { (void *) 27339, 189, NULL },
-   { (void *) 27348, 190, NULL },
-   { (void *) 27356, 190, NULL },
-   { (void *) 27367, 191, NULL },
-   { (void *) 27376, 191, NULL },
-   { (void *) 27388, 192, NULL },
-   { (void *) 27396, 192, NULL },
-   { (void *) 27407, 193, NULL },
-   { (void *) 27416, 193, NULL },
-   { (void *) 27428, 1268, NULL },
-   { (void *) 27439, 1269, NULL },
-   { (void *) 27451, 182, NULL },
-   { (void *) 27462, 183, NULL },
-   { (void *) 27473, 709, NULL },
-   { (void *) 27495, 371, NULL },
-   { (void *) 27506, 371, NULL },
-   { (void *) 27520, 710, NULL },
-   { (void *) 27542, 371, NULL },
-   { (void *) 27556, 596, NULL },
-   { (void *) 27572, 596, NULL },
-   { (void *) 27591, 596, NULL },
-   { (void *) 27610, 597, NULL },
-   { (void *) 27627, 597, NULL },
-   { (void *) 27647, 597, NULL },
-   { (void *) 27667, 178, NULL },
-   { (void *) 27681, 179, NULL },
-   { (void *) 27696, 180, NULL },
-   { (void *) 27710, 181, NULL },
-   { (void *) 27725, 1395, NULL },
-   { (void *) 27739, 1395, NULL },
-   { (void *) 27756, 1408, NULL },
-   { (void *) 27771, 1408, NULL },
-   { (void *) 27789, 870, NULL },
-   { (void *) 27802, 871, NULL },
-   { (void *) 27815, 901, NULL },
-   { (void *) 27839, 872, NULL },
-   { (void *) 27852, 902, NULL },
-   { (void *) 27876, 902, NULL },
-   { (void *) 27903, 1348, NULL },
-   { (void *) 27922, 1349, NULL },
-   { (void *) 27941, 1350, NULL },
-   { (void *) 27971, 1351, NULL },
-   { (void *) 27990, 1352, NULL },
-   { (void *) 28020, 332, NULL },
-   { (void *) 28034, 332, NULL },
-   { (void *) 28051, 333, NULL },
-   { (void *) 28065, 333, NULL },
-   { (void *) 28082, 372, NULL },
-   { (void *) 28096, 372, NULL },
-   { (void *) 28113, 372, NULL },
-   { (void *) 28130, 1310, NULL },
-   { (void *) 28145, 1310, NULL },
-   { (void *) 28162, 1002, NULL },
-   { (void *) 28176, 1003, NULL },
-   { (void *) 28195, 1004, NULL },
-   { (void *) 28215, 1005, NULL },
-   { (void *) 28236, 1006, NULL },
-   { (void *) 28254, 1007, NULL },
-   { (void *) 28273, 1008, NULL },
-   { (void *) 28291, 1009, NULL },
-   { (void *) 28310, 1010, NULL },
-   { (void *) 28327, 873, NULL },
-   { (void *) 28347, 1011, NULL },
-   { (void *) 28364, 874, NULL },
-   { (void *) 28384, 1012, NULL },
-   { (void *) 28412, 1013, NULL },
-   { (void *) 28429, 875, NULL },
-   { (void *) 28449, 1014, NULL },
-   { (void *) 28477, 1353, NULL },
-   { (void *) 28500, 1354, NULL },
-   { (void *) 28523, 1355, NULL },
-   { (void *) 28557, 1356, NULL },
-   { (void *) 28580, 1357, NULL },
-   { (void *) 28614, 1015, NULL },
-   { (void *) 28632, 1016, NULL },
-   { (void *) 28650, 1017, NULL },
-   { (void *) 28668, 881, NULL },
-   { (void *) 28680, 1198, NULL },
-   { (void *) 28694, 1018, NULL },
-   { (void *) 28722, 1019, NULL },
-   { (void *) 28751, 598, NULL },
-   { (void *) 28777, 598, NULL },
-   { (void *) 28806, 303, NULL },
-   { (void *) 28817, 304, NULL },
-   { (void *) 28828, 1396, NULL },
-   { (void *) 28839, 1396, NULL },
-   { (void *) 28853, 775, NULL },
-   { (void *) 28863, 776, NULL },
-   { (void *) 28874, 514, NULL },
-   { (void *) 28884, 514, NULL },
-   { (void *) 28897, 515, NULL },
-   { (void *) 28908, 515, NULL },
-   { (void *) 28922, 516, NULL },
-   { (void *) 28932, 1053, NULL },
-   { (void *) 28947, 1054, NULL },
-   { (void *) 28963, 516, NULL },
-   { (void *) 28976, 517, NULL },
-   { (void *) 28987, 517, NULL },
-   { (void *) 29001, 599, NULL },
-   { (void *) 29012, 1055, NULL },
-   { (void *) 29028, 1056, NULL },
-   { (void *) 29045, 599, NULL },
-   { (void *) 29059, 600, NULL },
-   { (void *) 29071, 600, NULL },
-   { (void *) 29086, 777, NULL },
-   { (void *) 29096, 778, NULL },
-   { (void *) 29107, 518, NULL },
-   { (void *) 29117, 518, NULL },
-   { (void *) 29130, 519, NULL },
-   { (void *) 29141, 519, NULL },
-   { (void *) 29155, 520, NULL },
-   { (void *) 29165, 1057, NULL },
-   { (void *) 29180, 1058, NULL },
-   { (void *) 29196, 520, NULL },
-   { (void *) 29209, 521, NULL },
-   { (void *) 29220, 521, NULL },
-   { (void *) 29234, 601, NULL },
-   { (void *) 29245, 1059, NULL },
-   { (void *) 29261, 1060, NULL },
-   { (void *) 29278, 601, NULL },
-   { (void *) 29292, 602, NULL },
-   { (void *) 29304, 602, NULL },
-   { (void *) 29319, 779, NULL },
-   { (void *) 29329, 780, NULL },
-   { (void *) 29340, 522, NULL },
-   { (void *) 29350, 522, NULL },
-   { (void *) 29363, 523, NULL },
-   { (void *) 29374, 523, NULL },
-   { (void *) 29388, 524, NULL },
-   { (void *) 29398, 1061, NULL },
-   { (void *) 29413, 1062, NULL },
-   { (void *) 29429, 524, NULL },
-   { (void *) 29442, 525, NULL },
-   { (void *) 29453, 525, NULL },
-   { (void *) 29467, 603, NULL },
-   { (void *) 29478, 1063, NULL },
-   { (void *) 29494, 1064, NULL },
-   { (void *) 29511, 603, NULL },
-   { (void *) 29525, 604, NULL },
-   { (void *) 29537, 604, NULL },
-   { (void *) 29552, 781, NULL },
-   { (void *) 29562, 782, NULL },
-   { (void *) 29573, 526, NULL },
-   { (void *) 29583, 526, NULL },
-   { (void *) 29596, 527, NULL },
-   { (void *) 29607, 527, NULL },
-   { (void *) 29621, 528, NULL },
-   { (void *) 29631, 1065, NULL },
-   { (void *) 29646, 1066, NULL },
-   { (void *) 29662, 528, NULL },
-   { (void *) 29675, 529, NULL },
-   { (void *) 29686, 529, NULL },
-   { (void *) 29700, 605, NULL },
-   { (void *) 29711, 1067, NULL },
-   { (void *) 29727, 1068, NULL },
-   { (void *) 29744, 605, NULL },
-   { (void *) 29758, 606, NULL },
-   { (void *) 29770, 606, NULL },
-   { (void *) 29785, 693, NULL },
-   { (void *) 29805, 924, NULL },
-   { (void *) 29826, 925, NULL },
-   { (void *) 29848, 783, NULL },
-   { (void *) 29865, 530, NULL },
-   { (void *) 29882, 530, NULL },
-   { (void *) 29902, 784, NULL },
-   { (void *) 29921, 564, NULL },
-   { (void *) 29940, 785, NULL },
-   { (void *) 29959, 565, NULL },
-   { (void *) 29978, 786, NULL },
-   { (void *) 29995, 531, NULL },
-   { (void *) 30012, 531, NULL },
-   { (void *) 30032, 787, NULL },
-   { (void *) 30051, 566, NULL },
-   { (void *) 30070, 788, NULL },
-   { (void *) 30089, 567, NULL },
-   { (void *) 30108, 789, NULL },
-   { (void *) 30125, 532, NULL },
-   { (void *) 30142, 532, NULL },
-   { (void *) 30162, 790, NULL },
-   { (void *) 30181, 568, NULL },
-   { (void *) 30200, 791, NULL },
-   { (void *) 30219, 569, NULL },
-   { (void *) 30238, 799, NULL },
-   { (void *) 30260, 1155, NULL },
-   { (void *) 30276, 478, NULL },
-   { (void *) 30288, 478, NULL },
-   { (void *) 30303, 478, NULL },
-   { (void *) 30318, 1020, NULL },
-   { (void *) 30335, 533, NULL },
-   { (void *) 30346, 533, NULL },
-   { (void *) 30366, 1156, NULL },
-   { (void *) 30383, 1156, NULL },
-   { (void *) 30403, 1309, NULL },
-   { (void *) 30423, 1311, NULL },
-   { (void *) 30435, 1312, NULL },
-   { (void *) 30455, 1313, NULL },
-   { (void *) 30467, 1314, NULL },
-   { (void *) 30484, 1315, NULL },
-   { (void *) 30503, 1316, NULL },
-   { (void *) 30532, 1317, NULL },
+   { (void *) 27327, 1394, NULL },
+   { (void *) 27338, 1395, NULL },
+   { (void *) 27347, 1395, NULL },
+   { (void *) 27359, 188, NULL },
+   { (void *) 27367, 189, NULL },
+   { (void *) 27376, 190, NULL },
+   { (void *) 27384, 190, NULL },
+   { (void *) 27395, 191, NULL },
+   { (void *) 27404, 191, NULL },
+   { (void *) 27416, 192, NULL },
+   { (void *) 27424, 192, NULL },
+   { (void *) 27435, 193, NULL },
+   { (void *) 27444, 193, NULL },
+   { (void *) 27456, 1269, NULL },
+   { (void *) 27467, 1270, NULL },
+   { (void *) 27479, 182, NULL },
+   { (void *) 27490, 183, NULL },
+   { (void *) 27501, 709, NULL },
+   { (void *) 27523, 371, NULL },
+   { (void *) 27534, 371, NULL },
+   { (void *) 27548, 710, NULL },
+   { (void *) 27570, 371, NULL },
+   { (void *) 27584, 596, NULL },
+   { (void *) 27600, 596, NULL },
+   { (void *) 27619, 596, NULL },
+   { (void *) 27638, 597, NULL },
+   { (void *) 27655, 597, NULL },
+   { (void *) 27675, 597, NULL },
+   { (void *) 27695, 178, NULL },
+   { (void *) 27709, 179, NULL },
+   { (void *) 27724, 180, NULL },
+   { (void *) 27738, 181, NULL },
+   { (void *) 27753, 1396, NULL },
+   { (void *) 27767, 1396, NULL },
+   { (void *) 27784, 1409, NULL },
+   { (void *) 27799, 1409, NULL },
+   { (void *) 27817, 870, NULL },
+   { (void *) 27830, 871, NULL },
+   { (void *) 27843, 901, NULL },
+   { (void *) 27867, 872, NULL },
+   { (void *) 27880, 902, NULL },
+   { (void *) 27904, 902, NULL },
+   { (void *) 27931, 1349, NULL },
+   { (void *) 27950, 1350, NULL },
+   { (void *) 27969, 1351, NULL },
+   { (void *) 27999, 1352, NULL },
+   { (void *) 28018, 1353, NULL },
+   { (void *) 28048, 332, NULL },
+   { (void *) 28062, 332, NULL },
+   { (void *) 28079, 333, NULL },
+   { (void *) 28093, 333, NULL },
+   { (void *) 28110, 372, NULL },
+   { (void *) 28124, 372, NULL },
+   { (void *) 28141, 372, NULL },
+   { (void *) 28158, 1311, NULL },
+   { (void *) 28173, 1311, NULL },
+   { (void *) 28190, 1002, NULL },
+   { (void *) 28204, 1003, NULL },
+   { (void *) 28223, 1004, NULL },
+   { (void *) 28243, 1005, NULL },
+   { (void *) 28264, 1006, NULL },
+   { (void *) 28282, 1007, NULL },
+   { (void *) 28301, 1008, NULL },
+   { (void *) 28319, 1009, NULL },
+   { (void *) 28338, 1010, NULL },
+   { (void *) 28355, 873, NULL },
+   { (void *) 28375, 1011, NULL },
+   { (void *) 28392, 874, NULL },
+   { (void *) 28412, 1012, NULL },
+   { (void *) 28440, 1013, NULL },
+   { (void *) 28457, 875, NULL },
+   { (void *) 28477, 1014, NULL },
+   { (void *) 28505, 1354, NULL },
+   { (void *) 28528, 1355, NULL },
+   { (void *) 28551, 1356, NULL },
+   { (void *) 28585, 1357, NULL },
+   { (void *) 28608, 1358, NULL },
+   { (void *) 28642, 1015, NULL },
+   { (void *) 28660, 1016, NULL },
+   { (void *) 28678, 1017, NULL },
+   { (void *) 28696, 881, NULL },
+   { (void *) 28708, 1199, NULL },
+   { (void *) 28722, 1018, NULL },
+   { (void *) 28750, 1019, NULL },
+   { (void *) 28779, 598, NULL },
+   { (void *) 28805, 598, NULL },
+   { (void *) 28834, 303, NULL },
+   { (void *) 28845, 304, NULL },
+   { (void *) 28856, 1397, NULL },
+   { (void *) 28867, 1397, NULL },
+   { (void *) 28881, 775, NULL },
+   { (void *) 28891, 776, NULL },
+   { (void *) 28902, 514, NULL },
+   { (void *) 28912, 514, NULL },
+   { (void *) 28925, 515, NULL },
+   { (void *) 28936, 515, NULL },
+   { (void *) 28950, 516, NULL },
+   { (void *) 28960, 1053, NULL },
+   { (void *) 28975, 1054, NULL },
+   { (void *) 28991, 516, NULL },
+   { (void *) 29004, 517, NULL },
+   { (void *) 29015, 517, NULL },
+   { (void *) 29029, 599, NULL },
+   { (void *) 29040, 1055, NULL },
+   { (void *) 29056, 1056, NULL },
+   { (void *) 29073, 599, NULL },
+   { (void *) 29087, 600, NULL },
+   { (void *) 29099, 600, NULL },
+   { (void *) 29114, 777, NULL },
+   { (void *) 29124, 778, NULL },
+   { (void *) 29135, 518, NULL },
+   { (void *) 29145, 518, NULL },
+   { (void *) 29158, 519, NULL },
+   { (void *) 29169, 519, NULL },
+   { (void *) 29183, 520, NULL },
+   { (void *) 29193, 1057, NULL },
+   { (void *) 29208, 1058, NULL },
+   { (void *) 29224, 520, NULL },
+   { (void *) 29237, 521, NULL },
+   { (void *) 29248, 521, NULL },
+   { (void *) 29262, 601, NULL },
+   { (void *) 29273, 1059, NULL },
+   { (void *) 29289, 1060, NULL },
+   { (void *) 29306, 601, NULL },
+   { (void *) 29320, 602, NULL },
+   { (void *) 29332, 602, NULL },
+   { (void *) 29347, 779, NULL },
+   { (void *) 29357, 780, NULL },
+   { (void *) 29368, 522, NULL },
+   { (void *) 29378, 522, NULL },
+   { (void *) 29391, 523, NULL },
+   { (void *) 29402, 523, NULL },
+   { (void *) 29416, 524, NULL },
+   { (void *) 29426, 1061, NULL },
+   { (void *) 29441, 1062, NULL },
+   { (void *) 29457, 524, NULL },
+   { (void *) 29470, 525, NULL },
+   { (void *) 29481, 525, NULL },
+   { (void *) 29495, 603, NULL },
+   { (void *) 29506, 1063, NULL },
+   { (void *) 29522, 1064, NULL },
+   { (void *) 29539, 603, NULL },
+   { (void *) 29553, 604, NULL },
+   { (void *) 29565, 604, NULL },
+   { (void *) 29580, 781, NULL },
+   { (void *) 29590, 782, NULL },
+   { (void *) 29601, 526, NULL },
+   { (void *) 29611, 526, NULL },
+   { (void *) 29624, 527, NULL },
+   { (void *) 29635, 527, NULL },
+   { (void *) 29649, 528, NULL },
+   { (void *) 29659, 1065, NULL },
+   { (void *) 29674, 1066, NULL },
+   { (void *) 29690, 528, NULL },
+   { (void *) 29703, 529, NULL },
+   { (void *) 29714, 529, NULL },
+   { (void *) 29728, 605, NULL },
+   { (void *) 29739, 1067, NULL },
+   { (void *) 29755, 1068, NULL },
+   { (void *) 29772, 605, NULL },
+   { (void *) 29786, 606, NULL },
+   { (void *) 29798, 606, NULL },
+   { (void *) 29813, 693, NULL },
+   { (void *) 29833, 924, NULL },
+   { (void *) 29854, 925, NULL },
+   { (void *) 29876, 783, NULL },
+   { (void *) 29893, 530, NULL },
+   { (void *) 29910, 530, NULL },
+   { (void *) 29930, 784, NULL },
+   { (void *) 29949, 564, NULL },
+   { (void *) 29968, 785, NULL },
+   { (void *) 29987, 565, NULL },
+   { (void *) 30006, 786, NULL },
+   { (void *) 30023, 531, NULL },
+   { (void *) 30040, 531, NULL },
+   { (void *) 30060, 787, NULL },
+   { (void *) 30079, 566, NULL },
+   { (void *) 30098, 788, NULL },
+   { (void *) 30117, 567, NULL },
+   { (void *) 30136, 789, NULL },
+   { (void *) 30153, 532, NULL },
+   { (void *) 30170, 532, NULL },
+   { (void *) 30190, 790, NULL },
+   { (void *) 30209, 568, NULL },
+   { (void *) 30228, 791, NULL },
+   { (void *) 30247, 569, NULL },
+   { (void *) 30266, 799, NULL },
+   { (void *) 30288, 1156, NULL },
+   { (void *) 30304, 478, NULL },
+   { (void *) 30316, 478, NULL },
+   { (void *) 30331, 478, NULL },
+   { (void *) 30346, 1020, NULL },
+   { (void *) 30363, 533, NULL },
+   { (void *) 30374, 533, NULL },
+   { (void *) 30394, 1157, NULL },
+   { (void *) 30411, 1157, NULL },
+   { (void *) 30431, 1310, NULL },
+   { (void *) 30451, 1312, NULL },
+   { (void *) 30463, 1313, NULL },
+   { (void *) 30483, 1314, NULL },
+   { (void *) 30495, 1315, NULL },
+   { (void *) 30512, 1316, NULL },
+   { (void *) 30531, 1317, NULL },
    { (void *) 30560, 1318, NULL },
-   { (void *) 30581, 1319, NULL },
-   { (void *) 30602, 1320, NULL },
-   { (void *) 30627, 534, NULL },
-   { (void *) 30643, 534, NULL },
-   { (void *) 30662, 1157, NULL },
-   { (void *) 30686, 1157, NULL },
-   { (void *) 30713, 126, NULL },
-   { (void *) 30722, 127, NULL },
-   { (void *) 30732, 128, NULL },
-   { (void *) 30741, 129, NULL },
-   { (void *) 30751, 130, NULL },
-   { (void *) 30760, 131, NULL },
-   { (void *) 30770, 132, NULL },
-   { (void *) 30779, 133, NULL },
-   { (void *) 30789, 134, NULL },
-   { (void *) 30798, 135, NULL },
-   { (void *) 30808, 136, NULL },
-   { (void *) 30817, 137, NULL },
-   { (void *) 30827, 138, NULL },
-   { (void *) 30836, 139, NULL },
-   { (void *) 30846, 140, NULL },
-   { (void *) 30855, 141, NULL },
-   { (void *) 30865, 142, NULL },
-   { (void *) 30874, 143, NULL },
-   { (void *) 30884, 144, NULL },
-   { (void *) 30893, 145, NULL },
-   { (void *) 30903, 146, NULL },
-   { (void *) 30912, 147, NULL },
-   { (void *) 30922, 148, NULL },
-   { (void *) 30931, 149, NULL },
-   { (void *) 30941, 1021, NULL },
-   { (void *) 30966, 1022, NULL },
-   { (void *) 30990, 1023, NULL },
-   { (void *) 31015, 1024, NULL },
-   { (void *) 31040, 1025, NULL },
-   { (void *) 31066, 1026, NULL },
-   { (void *) 31091, 1027, NULL },
-   { (void *) 31115, 1028, NULL },
-   { (void *) 31140, 535, NULL },
-   { (void *) 31155, 535, NULL },
-   { (void *) 31173, 1199, NULL },
-   { (void *) 31190, 536, NULL },
-   { (void *) 31206, 536, NULL },
-   { (void *) 31225, 1200, NULL },
-   { (void *) 31243, 641, NULL },
-   { (void *) 31258, 641, NULL },
-   { (void *) 31276, 1201, NULL },
-   { (void *) 31293, 642, NULL },
-   { (void *) 31309, 642, NULL },
-   { (void *) 31328, 1202, NULL },
-   { (void *) 31346, 537, NULL },
-   { (void *) 31361, 537, NULL },
-   { (void *) 31379, 1203, NULL },
-   { (void *) 31396, 538, NULL },
-   { (void *) 31412, 538, NULL },
-   { (void *) 31431, 1204, NULL },
-   { (void *) 31449, 539, NULL },
-   { (void *) 31464, 539, NULL },
-   { (void *) 31482, 1205, NULL },
-   { (void *) 31499, 540, NULL },
-   { (void *) 31515, 540, NULL },
-   { (void *) 31534, 1206, NULL },
-   { (void *) 31552, 643, NULL },
-   { (void *) 31567, 643, NULL },
-   { (void *) 31585, 1207, NULL },
-   { (void *) 31602, 644, NULL },
-   { (void *) 31618, 644, NULL },
-   { (void *) 31637, 1208, NULL },
-   { (void *) 31655, 541, NULL },
-   { (void *) 31670, 541, NULL },
-   { (void *) 31688, 1209, NULL },
-   { (void *) 31705, 542, NULL },
-   { (void *) 31721, 542, NULL },
-   { (void *) 31740, 1210, NULL },
-   { (void *) 31758, 543, NULL },
-   { (void *) 31773, 543, NULL },
-   { (void *) 31791, 1211, NULL },
-   { (void *) 31808, 544, NULL },
-   { (void *) 31824, 544, NULL },
-   { (void *) 31843, 1212, NULL },
-   { (void *) 31861, 645, NULL },
-   { (void *) 31876, 645, NULL },
-   { (void *) 31894, 1213, NULL },
-   { (void *) 31911, 646, NULL },
-   { (void *) 31927, 646, NULL },
-   { (void *) 31946, 1214, NULL },
-   { (void *) 31964, 545, NULL },
-   { (void *) 31979, 545, NULL },
-   { (void *) 31997, 1215, NULL },
-   { (void *) 32014, 546, NULL },
-   { (void *) 32030, 546, NULL },
-   { (void *) 32049, 1216, NULL },
-   { (void *) 32067, 547, NULL },
-   { (void *) 32084, 547, NULL },
-   { (void *) 32104, 548, NULL },
-   { (void *) 32121, 548, NULL },
-   { (void *) 32141, 549, NULL },
-   { (void *) 32158, 549, NULL },
-   { (void *) 32178, 550, NULL },
-   { (void *) 32195, 550, NULL },
-   { (void *) 32215, 551, NULL },
-   { (void *) 32233, 551, NULL },
-   { (void *) 32254, 552, NULL },
-   { (void *) 32272, 552, NULL },
-   { (void *) 32293, 553, NULL },
-   { (void *) 32311, 553, NULL },
-   { (void *) 32332, 554, NULL },
-   { (void *) 32348, 554, NULL },
-   { (void *) 32367, 555, NULL },
-   { (void *) 32382, 555, NULL },
-   { (void *) 32400, 1217, NULL },
-   { (void *) 32417, 556, NULL },
-   { (void *) 32433, 556, NULL },
-   { (void *) 32452, 1218, NULL },
-   { (void *) 32470, 647, NULL },
-   { (void *) 32485, 647, NULL },
-   { (void *) 32503, 1219, NULL },
-   { (void *) 32520, 648, NULL },
-   { (void *) 32536, 648, NULL },
-   { (void *) 32555, 1220, NULL },
-   { (void *) 32573, 557, NULL },
-   { (void *) 32589, 557, NULL },
-   { (void *) 32608, 558, NULL },
-   { (void *) 32623, 558, NULL },
-   { (void *) 32641, 1221, NULL },
-   { (void *) 32658, 559, NULL },
-   { (void *) 32674, 559, NULL },
-   { (void *) 32693, 1222, NULL },
-   { (void *) 32711, 1223, NULL },
-   { (void *) 32729, 560, NULL },
-   { (void *) 32746, 560, NULL },
-   { (void *) 32766, 1224, NULL },
-   { (void *) 32785, 561, NULL },
-   { (void *) 32802, 561, NULL },
-   { (void *) 32822, 562, NULL },
-   { (void *) 32839, 562, NULL },
-   { (void *) 32859, 883, NULL },
-   { (void *) 32879, 619, NULL },
-   { (void *) 32899, 619, NULL },
-   { (void *) 32922, 884, NULL },
-   { (void *) 32941, 1276, NULL },
-   { (void *) 32957, 1276, NULL },
-   { (void *) 32976, 607, NULL },
-   { (void *) 32993, 607, NULL },
-   { (void *) 33013, 1277, NULL },
-   { (void *) 33030, 1277, NULL },
-   { (void *) 33050, 608, NULL },
-   { (void *) 33068, 608, NULL },
-   { (void *) 33089, 1278, NULL },
-   { (void *) 33105, 1278, NULL },
-   { (void *) 33124, 1279, NULL },
-   { (void *) 33141, 1279, NULL },
-   { (void *) 33161, 1280, NULL },
-   { (void *) 33178, 1280, NULL },
-   { (void *) 33198, 1281, NULL },
-   { (void *) 33216, 1281, NULL },
-   { (void *) 33237, 1282, NULL },
-   { (void *) 33253, 1282, NULL },
-   { (void *) 33272, 1283, NULL },
-   { (void *) 33289, 1283, NULL },
-   { (void *) 33309, 1284, NULL },
-   { (void *) 33326, 1284, NULL },
-   { (void *) 33346, 1285, NULL },
-   { (void *) 33364, 1285, NULL },
-   { (void *) 33385, 609, NULL },
-   { (void *) 33402, 609, NULL },
-   { (void *) 33422, 1286, NULL },
-   { (void *) 33438, 1286, NULL },
-   { (void *) 33457, 1287, NULL },
-   { (void *) 33474, 1287, NULL },
-   { (void *) 33494, 610, NULL },
-   { (void *) 33511, 610, NULL },
-   { (void *) 33531, 611, NULL },
-   { (void *) 33549, 611, NULL },
-   { (void *) 33570, 1288, NULL },
-   { (void *) 33587, 1288, NULL },
-   { (void *) 33607, 1289, NULL },
-   { (void *) 33625, 1289, NULL },
-   { (void *) 33646, 612, NULL },
-   { (void *) 33664, 612, NULL },
-   { (void *) 33685, 885, NULL },
-   { (void *) 33705, 613, NULL },
-   { (void *) 33726, 613, NULL },
-   { (void *) 33750, 822, NULL },
-   { (void *) 33766, 823, NULL },
-   { (void *) 33783, 926, NULL },
-   { (void *) 33805, 927, NULL },
-   { (void *) 33828, 824, NULL },
-   { (void *) 33844, 825, NULL },
-   { (void *) 33861, 826, NULL },
-   { (void *) 33877, 827, NULL },
-   { (void *) 33894, 828, NULL },
-   { (void *) 33910, 829, NULL },
-   { (void *) 33927, 886, NULL },
-   { (void *) 33947, 830, NULL },
-   { (void *) 33968, 758, NULL },
-   { (void *) 33985, 759, NULL },
-   { (void *) 34003, 760, NULL },
-   { (void *) 34020, 761, NULL },
-   { (void *) 34038, 762, NULL },
-   { (void *) 34055, 763, NULL },
-   { (void *) 34073, 764, NULL },
-   { (void *) 34090, 765, NULL },
-   { (void *) 34108, 563, NULL },
-   { (void *) 34128, 563, NULL },
-   { (void *) 34151, 1225, NULL },
-   { (void *) 34173, 1226, NULL },
-   { (void *) 34192, 1227, NULL },
-   { (void *) 34211, 1228, NULL },
-   { (void *) 34230, 1229, NULL },
-   { (void *) 34249, 1230, NULL },
-   { (void *) 34268, 1231, NULL },
-   { (void *) 34287, 1232, NULL },
-   { (void *) 34306, 1233, NULL },
-   { (void *) 34325, 1234, NULL },
-   { (void *) 34344, 1235, NULL },
-   { (void *) 34363, 1236, NULL },
-   { (void *) 34382, 1237, NULL },
-   { (void *) 34401, 1238, NULL },
-   { (void *) 34421, 887, NULL },
-   { (void *) 34442, 766, NULL },
-   { (void *) 34453, 767, NULL },
-   { (void *) 34465, 768, NULL },
-   { (void *) 34476, 769, NULL },
-   { (void *) 34488, 770, NULL },
-   { (void *) 34499, 771, NULL },
-   { (void *) 34511, 321, NULL },
-   { (void *) 34525, 1094, NULL },
-   { (void *) 34542, 305, NULL },
-   { (void *) 34551, 838, NULL },
-   { (void *) 34566, 838, NULL },
-   { (void *) 34584, 839, NULL },
-   { (void *) 34601, 839, NULL },
-   { (void *) 34621, 840, NULL },
-   { (void *) 34639, 840, NULL },
-   { (void *) 34660, 1358, NULL },
-   { (void *) 34677, 701, NULL },
-   { (void *) 34686, 444, NULL },
-   { (void *) 34698, 444, NULL },
-   { (void *) 34713, 444, NULL },
-   { (void *) 34729, 445, NULL },
-   { (void *) 34742, 445, NULL },
-   { (void *) 34758, 445, NULL },
-   { (void *) 34775, 446, NULL },
-   { (void *) 34787, 446, NULL },
-   { (void *) 34802, 446, NULL },
-   { (void *) 34818, 447, NULL },
-   { (void *) 34831, 447, NULL },
-   { (void *) 34847, 447, NULL },
-   { (void *) 34864, 448, NULL },
-   { (void *) 34876, 448, NULL },
-   { (void *) 34891, 448, NULL },
-   { (void *) 34907, 449, NULL },
-   { (void *) 34920, 449, NULL },
-   { (void *) 34936, 449, NULL },
-   { (void *) 34953, 450, NULL },
-   { (void *) 34965, 450, NULL },
-   { (void *) 34980, 450, NULL },
-   { (void *) 34996, 451, NULL },
-   { (void *) 35009, 451, NULL },
-   { (void *) 35025, 451, NULL },
-   { (void *) 35042, 452, NULL },
-   { (void *) 35054, 452, NULL },
-   { (void *) 35069, 452, NULL },
-   { (void *) 35085, 453, NULL },
-   { (void *) 35098, 453, NULL },
-   { (void *) 35114, 453, NULL },
-   { (void *) 35131, 454, NULL },
-   { (void *) 35143, 454, NULL },
-   { (void *) 35158, 454, NULL },
-   { (void *) 35174, 455, NULL },
-   { (void *) 35187, 455, NULL },
-   { (void *) 35203, 455, NULL },
-   { (void *) 35220, 456, NULL },
-   { (void *) 35232, 456, NULL },
-   { (void *) 35247, 456, NULL },
-   { (void *) 35263, 457, NULL },
-   { (void *) 35276, 457, NULL },
-   { (void *) 35292, 457, NULL },
-   { (void *) 35309, 458, NULL },
-   { (void *) 35321, 458, NULL },
-   { (void *) 35336, 458, NULL },
-   { (void *) 35352, 459, NULL },
-   { (void *) 35365, 459, NULL },
-   { (void *) 35381, 459, NULL },
-   { (void *) 35398, 1174, NULL },
-   { (void *) 35414, 1175, NULL },
-   { (void *) 35431, 1176, NULL },
-   { (void *) 35447, 1177, NULL },
-   { (void *) 35464, 1178, NULL },
-   { (void *) 35480, 1179, NULL },
-   { (void *) 35497, 1180, NULL },
-   { (void *) 35513, 1181, NULL },
-   { (void *) 35530, 1332, NULL }
+   { (void *) 30588, 1319, NULL },
+   { (void *) 30609, 1320, NULL },
+   { (void *) 30630, 1321, NULL },
+   { (void *) 30655, 534, NULL },
+   { (void *) 30671, 534, NULL },
+   { (void *) 30690, 1158, NULL },
+   { (void *) 30714, 1158, NULL },
+   { (void *) 30741, 126, NULL },
+   { (void *) 30750, 127, NULL },
+   { (void *) 30760, 128, NULL },
+   { (void *) 30769, 129, NULL },
+   { (void *) 30779, 130, NULL },
+   { (void *) 30788, 131, NULL },
+   { (void *) 30798, 132, NULL },
+   { (void *) 30807, 133, NULL },
+   { (void *) 30817, 134, NULL },
+   { (void *) 30826, 135, NULL },
+   { (void *) 30836, 136, NULL },
+   { (void *) 30845, 137, NULL },
+   { (void *) 30855, 138, NULL },
+   { (void *) 30864, 139, NULL },
+   { (void *) 30874, 140, NULL },
+   { (void *) 30883, 141, NULL },
+   { (void *) 30893, 142, NULL },
+   { (void *) 30902, 143, NULL },
+   { (void *) 30912, 144, NULL },
+   { (void *) 30921, 145, NULL },
+   { (void *) 30931, 146, NULL },
+   { (void *) 30940, 147, NULL },
+   { (void *) 30950, 148, NULL },
+   { (void *) 30959, 149, NULL },
+   { (void *) 30969, 1021, NULL },
+   { (void *) 30994, 1022, NULL },
+   { (void *) 31018, 1023, NULL },
+   { (void *) 31043, 1024, NULL },
+   { (void *) 31068, 1025, NULL },
+   { (void *) 31094, 1026, NULL },
+   { (void *) 31119, 1027, NULL },
+   { (void *) 31143, 1028, NULL },
+   { (void *) 31168, 535, NULL },
+   { (void *) 31183, 535, NULL },
+   { (void *) 31201, 1200, NULL },
+   { (void *) 31218, 536, NULL },
+   { (void *) 31234, 536, NULL },
+   { (void *) 31253, 1201, NULL },
+   { (void *) 31271, 641, NULL },
+   { (void *) 31286, 641, NULL },
+   { (void *) 31304, 1202, NULL },
+   { (void *) 31321, 642, NULL },
+   { (void *) 31337, 642, NULL },
+   { (void *) 31356, 1203, NULL },
+   { (void *) 31374, 537, NULL },
+   { (void *) 31389, 537, NULL },
+   { (void *) 31407, 1204, NULL },
+   { (void *) 31424, 538, NULL },
+   { (void *) 31440, 538, NULL },
+   { (void *) 31459, 1205, NULL },
+   { (void *) 31477, 539, NULL },
+   { (void *) 31492, 539, NULL },
+   { (void *) 31510, 1206, NULL },
+   { (void *) 31527, 540, NULL },
+   { (void *) 31543, 540, NULL },
+   { (void *) 31562, 1207, NULL },
+   { (void *) 31580, 643, NULL },
+   { (void *) 31595, 643, NULL },
+   { (void *) 31613, 1208, NULL },
+   { (void *) 31630, 644, NULL },
+   { (void *) 31646, 644, NULL },
+   { (void *) 31665, 1209, NULL },
+   { (void *) 31683, 541, NULL },
+   { (void *) 31698, 541, NULL },
+   { (void *) 31716, 1210, NULL },
+   { (void *) 31733, 542, NULL },
+   { (void *) 31749, 542, NULL },
+   { (void *) 31768, 1211, NULL },
+   { (void *) 31786, 543, NULL },
+   { (void *) 31801, 543, NULL },
+   { (void *) 31819, 1212, NULL },
+   { (void *) 31836, 544, NULL },
+   { (void *) 31852, 544, NULL },
+   { (void *) 31871, 1213, NULL },
+   { (void *) 31889, 645, NULL },
+   { (void *) 31904, 645, NULL },
+   { (void *) 31922, 1214, NULL },
+   { (void *) 31939, 646, NULL },
+   { (void *) 31955, 646, NULL },
+   { (void *) 31974, 1215, NULL },
+   { (void *) 31992, 545, NULL },
+   { (void *) 32007, 545, NULL },
+   { (void *) 32025, 1216, NULL },
+   { (void *) 32042, 546, NULL },
+   { (void *) 32058, 546, NULL },
+   { (void *) 32077, 1217, NULL },
+   { (void *) 32095, 547, NULL },
+   { (void *) 32112, 547, NULL },
+   { (void *) 32132, 548, NULL },
+   { (void *) 32149, 548, NULL },
+   { (void *) 32169, 549, NULL },
+   { (void *) 32186, 549, NULL },
+   { (void *) 32206, 550, NULL },
+   { (void *) 32223, 550, NULL },
+   { (void *) 32243, 551, NULL },
+   { (void *) 32261, 551, NULL },
+   { (void *) 32282, 552, NULL },
+   { (void *) 32300, 552, NULL },
+   { (void *) 32321, 553, NULL },
+   { (void *) 32339, 553, NULL },
+   { (void *) 32360, 554, NULL },
+   { (void *) 32376, 554, NULL },
+   { (void *) 32395, 555, NULL },
+   { (void *) 32410, 555, NULL },
+   { (void *) 32428, 1218, NULL },
+   { (void *) 32445, 556, NULL },
+   { (void *) 32461, 556, NULL },
+   { (void *) 32480, 1219, NULL },
+   { (void *) 32498, 647, NULL },
+   { (void *) 32513, 647, NULL },
+   { (void *) 32531, 1220, NULL },
+   { (void *) 32548, 648, NULL },
+   { (void *) 32564, 648, NULL },
+   { (void *) 32583, 1221, NULL },
+   { (void *) 32601, 557, NULL },
+   { (void *) 32617, 557, NULL },
+   { (void *) 32636, 558, NULL },
+   { (void *) 32651, 558, NULL },
+   { (void *) 32669, 1222, NULL },
+   { (void *) 32686, 559, NULL },
+   { (void *) 32702, 559, NULL },
+   { (void *) 32721, 1223, NULL },
+   { (void *) 32739, 1224, NULL },
+   { (void *) 32757, 560, NULL },
+   { (void *) 32774, 560, NULL },
+   { (void *) 32794, 1225, NULL },
+   { (void *) 32813, 561, NULL },
+   { (void *) 32830, 561, NULL },
+   { (void *) 32850, 562, NULL },
+   { (void *) 32867, 562, NULL },
+   { (void *) 32887, 883, NULL },
+   { (void *) 32907, 619, NULL },
+   { (void *) 32927, 619, NULL },
+   { (void *) 32950, 884, NULL },
+   { (void *) 32969, 1277, NULL },
+   { (void *) 32985, 1277, NULL },
+   { (void *) 33004, 607, NULL },
+   { (void *) 33021, 607, NULL },
+   { (void *) 33041, 1278, NULL },
+   { (void *) 33058, 1278, NULL },
+   { (void *) 33078, 608, NULL },
+   { (void *) 33096, 608, NULL },
+   { (void *) 33117, 1279, NULL },
+   { (void *) 33133, 1279, NULL },
+   { (void *) 33152, 1280, NULL },
+   { (void *) 33169, 1280, NULL },
+   { (void *) 33189, 1281, NULL },
+   { (void *) 33206, 1281, NULL },
+   { (void *) 33226, 1282, NULL },
+   { (void *) 33244, 1282, NULL },
+   { (void *) 33265, 1283, NULL },
+   { (void *) 33281, 1283, NULL },
+   { (void *) 33300, 1284, NULL },
+   { (void *) 33317, 1284, NULL },
+   { (void *) 33337, 1285, NULL },
+   { (void *) 33354, 1285, NULL },
+   { (void *) 33374, 1286, NULL },
+   { (void *) 33392, 1286, NULL },
+   { (void *) 33413, 609, NULL },
+   { (void *) 33430, 609, NULL },
+   { (void *) 33450, 1287, NULL },
+   { (void *) 33466, 1287, NULL },
+   { (void *) 33485, 1288, NULL },
+   { (void *) 33502, 1288, NULL },
+   { (void *) 33522, 610, NULL },
+   { (void *) 33539, 610, NULL },
+   { (void *) 33559, 611, NULL },
+   { (void *) 33577, 611, NULL },
+   { (void *) 33598, 1289, NULL },
+   { (void *) 33615, 1289, NULL },
+   { (void *) 33635, 1290, NULL },
+   { (void *) 33653, 1290, NULL },
+   { (void *) 33674, 612, NULL },
+   { (void *) 33692, 612, NULL },
+   { (void *) 33713, 885, NULL },
+   { (void *) 33733, 613, NULL },
+   { (void *) 33754, 613, NULL },
+   { (void *) 33778, 822, NULL },
+   { (void *) 33794, 823, NULL },
+   { (void *) 33811, 926, NULL },
+   { (void *) 33833, 927, NULL },
+   { (void *) 33856, 824, NULL },
+   { (void *) 33872, 825, NULL },
+   { (void *) 33889, 826, NULL },
+   { (void *) 33905, 827, NULL },
+   { (void *) 33922, 828, NULL },
+   { (void *) 33938, 829, NULL },
+   { (void *) 33955, 886, NULL },
+   { (void *) 33975, 830, NULL },
+   { (void *) 33996, 758, NULL },
+   { (void *) 34013, 759, NULL },
+   { (void *) 34031, 760, NULL },
+   { (void *) 34048, 761, NULL },
+   { (void *) 34066, 762, NULL },
+   { (void *) 34083, 763, NULL },
+   { (void *) 34101, 764, NULL },
+   { (void *) 34118, 765, NULL },
+   { (void *) 34136, 563, NULL },
+   { (void *) 34156, 563, NULL },
+   { (void *) 34179, 1226, NULL },
+   { (void *) 34201, 1227, NULL },
+   { (void *) 34220, 1228, NULL },
+   { (void *) 34239, 1229, NULL },
+   { (void *) 34258, 1230, NULL },
+   { (void *) 34277, 1231, NULL },
+   { (void *) 34296, 1232, NULL },
+   { (void *) 34315, 1233, NULL },
+   { (void *) 34334, 1234, NULL },
+   { (void *) 34353, 1235, NULL },
+   { (void *) 34372, 1236, NULL },
+   { (void *) 34391, 1237, NULL },
+   { (void *) 34410, 1238, NULL },
+   { (void *) 34429, 1239, NULL },
+   { (void *) 34449, 887, NULL },
+   { (void *) 34470, 766, NULL },
+   { (void *) 34481, 767, NULL },
+   { (void *) 34493, 768, NULL },
+   { (void *) 34504, 769, NULL },
+   { (void *) 34516, 770, NULL },
+   { (void *) 34527, 771, NULL },
+   { (void *) 34539, 321, NULL },
+   { (void *) 34553, 1095, NULL },
+   { (void *) 34570, 305, NULL },
+   { (void *) 34579, 838, NULL },
+   { (void *) 34594, 838, NULL },
+   { (void *) 34612, 839, NULL },
+   { (void *) 34629, 839, NULL },
+   { (void *) 34649, 840, NULL },
+   { (void *) 34667, 840, NULL },
+   { (void *) 34688, 1359, NULL },
+   { (void *) 34705, 701, NULL },
+   { (void *) 34714, 444, NULL },
+   { (void *) 34726, 444, NULL },
+   { (void *) 34741, 444, NULL },
+   { (void *) 34757, 445, NULL },
+   { (void *) 34770, 445, NULL },
+   { (void *) 34786, 445, NULL },
+   { (void *) 34803, 446, NULL },
+   { (void *) 34815, 446, NULL },
+   { (void *) 34830, 446, NULL },
+   { (void *) 34846, 447, NULL },
+   { (void *) 34859, 447, NULL },
+   { (void *) 34875, 447, NULL },
+   { (void *) 34892, 448, NULL },
+   { (void *) 34904, 448, NULL },
+   { (void *) 34919, 448, NULL },
+   { (void *) 34935, 449, NULL },
+   { (void *) 34948, 449, NULL },
+   { (void *) 34964, 449, NULL },
+   { (void *) 34981, 450, NULL },
+   { (void *) 34993, 450, NULL },
+   { (void *) 35008, 450, NULL },
+   { (void *) 35024, 451, NULL },
+   { (void *) 35037, 451, NULL },
+   { (void *) 35053, 451, NULL },
+   { (void *) 35070, 452, NULL },
+   { (void *) 35082, 452, NULL },
+   { (void *) 35097, 452, NULL },
+   { (void *) 35113, 453, NULL },
+   { (void *) 35126, 453, NULL },
+   { (void *) 35142, 453, NULL },
+   { (void *) 35159, 454, NULL },
+   { (void *) 35171, 454, NULL },
+   { (void *) 35186, 454, NULL },
+   { (void *) 35202, 455, NULL },
+   { (void *) 35215, 455, NULL },
+   { (void *) 35231, 455, NULL },
+   { (void *) 35248, 456, NULL },
+   { (void *) 35260, 456, NULL },
+   { (void *) 35275, 456, NULL },
+   { (void *) 35291, 457, NULL },
+   { (void *) 35304, 457, NULL },
+   { (void *) 35320, 457, NULL },
+   { (void *) 35337, 458, NULL },
+   { (void *) 35349, 458, NULL },
+   { (void *) 35364, 458, NULL },
+   { (void *) 35380, 459, NULL },
+   { (void *) 35393, 459, NULL },
+   { (void *) 35409, 459, NULL },
+   { (void *) 35426, 1175, NULL },
+   { (void *) 35442, 1176, NULL },
+   { (void *) 35459, 1177, NULL },
+   { (void *) 35475, 1178, NULL },
+   { (void *) 35492, 1179, NULL },
+   { (void *) 35508, 1180, NULL },
+   { (void *) 35525, 1181, NULL },
+   { (void *) 35541, 1182, NULL },
+   { (void *) 35558, 1333, NULL }
 };
 #undef MAPI_TMP_PUBLIC_STUBS
 #endif /* MAPI_TMP_PUBLIC_STUBS */
@@ -24808,165 +24819,165 @@ void APIENTRY shared_dispatch_stub_1068(GLint location, GLsizei count, const GLu
    ((void (APIENTRY *)(GLint location, GLsizei count, const GLuint64 *value)) _func)(location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1069(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
+void APIENTRY shared_dispatch_stub_1069(GLuint count)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1069];
-   ((void (APIENTRY *)(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)) _func)(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+   ((void (APIENTRY *)(GLuint count)) _func)(count);
 }
 
-void APIENTRY shared_dispatch_stub_1070(GLuint buffer)
+void APIENTRY shared_dispatch_stub_1070(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1070];
-   ((void (APIENTRY *)(GLuint buffer)) _func)(buffer);
+   ((void (APIENTRY *)(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue)) _func)(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
 }
 
-void APIENTRY shared_dispatch_stub_1071(GLuint buffer, GLintptr offset, GLsizeiptr length)
+void APIENTRY shared_dispatch_stub_1071(GLuint buffer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1071];
-   ((void (APIENTRY *)(GLuint buffer, GLintptr offset, GLsizeiptr length)) _func)(buffer, offset, length);
+   ((void (APIENTRY *)(GLuint buffer)) _func)(buffer);
 }
 
-void APIENTRY shared_dispatch_stub_1072(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+void APIENTRY shared_dispatch_stub_1072(GLuint buffer, GLintptr offset, GLsizeiptr length)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1072];
-   ((void (APIENTRY *)(GLenum target, GLsizei numAttachments, const GLenum *attachments)) _func)(target, numAttachments, attachments);
+   ((void (APIENTRY *)(GLuint buffer, GLintptr offset, GLsizeiptr length)) _func)(buffer, offset, length);
 }
 
-void APIENTRY shared_dispatch_stub_1073(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+void APIENTRY shared_dispatch_stub_1073(GLenum target, GLsizei numAttachments, const GLenum *attachments)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1073];
-   ((void (APIENTRY *)(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)) _func)(target, numAttachments, attachments, x, y, width, height);
+   ((void (APIENTRY *)(GLenum target, GLsizei numAttachments, const GLenum *attachments)) _func)(target, numAttachments, attachments);
 }
 
-void APIENTRY shared_dispatch_stub_1074(GLuint texture, GLint level)
+void APIENTRY shared_dispatch_stub_1074(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1074];
-   ((void (APIENTRY *)(GLuint texture, GLint level)) _func)(texture, level);
+   ((void (APIENTRY *)(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)) _func)(target, numAttachments, attachments, x, y, width, height);
 }
 
-void APIENTRY shared_dispatch_stub_1075(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+void APIENTRY shared_dispatch_stub_1075(GLuint texture, GLint level)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1075];
-   ((void (APIENTRY *)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)) _func)(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+   ((void (APIENTRY *)(GLuint texture, GLint level)) _func)(texture, level);
 }
 
-void APIENTRY shared_dispatch_stub_1076(GLfloat factor, GLfloat bias)
+void APIENTRY shared_dispatch_stub_1076(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1076];
-   ((void (APIENTRY *)(GLfloat factor, GLfloat bias)) _func)(factor, bias);
+   ((void (APIENTRY *)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)) _func)(texture, level, xoffset, yoffset, zoffset, width, height, depth);
 }
 
-void APIENTRY shared_dispatch_stub_1077(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)
+void APIENTRY shared_dispatch_stub_1077(GLfloat factor, GLfloat bias)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1077];
-   ((void (APIENTRY *)(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)) _func)(x, y, z, width, height);
+   ((void (APIENTRY *)(GLfloat factor, GLfloat bias)) _func)(factor, bias);
 }
 
-void APIENTRY shared_dispatch_stub_1078(const GLfloat *coords)
+void APIENTRY shared_dispatch_stub_1078(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1078];
-   ((void (APIENTRY *)(const GLfloat *coords)) _func)(coords);
+   ((void (APIENTRY *)(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)) _func)(x, y, z, width, height);
 }
 
-void APIENTRY shared_dispatch_stub_1079(GLint x, GLint y, GLint z, GLint width, GLint height)
+void APIENTRY shared_dispatch_stub_1079(const GLfloat *coords)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1079];
-   ((void (APIENTRY *)(GLint x, GLint y, GLint z, GLint width, GLint height)) _func)(x, y, z, width, height);
+   ((void (APIENTRY *)(const GLfloat *coords)) _func)(coords);
 }
 
-void APIENTRY shared_dispatch_stub_1080(const GLint *coords)
+void APIENTRY shared_dispatch_stub_1080(GLint x, GLint y, GLint z, GLint width, GLint height)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1080];
-   ((void (APIENTRY *)(const GLint *coords)) _func)(coords);
+   ((void (APIENTRY *)(GLint x, GLint y, GLint z, GLint width, GLint height)) _func)(x, y, z, width, height);
 }
 
-void APIENTRY shared_dispatch_stub_1081(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)
+void APIENTRY shared_dispatch_stub_1081(const GLint *coords)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1081];
-   ((void (APIENTRY *)(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)) _func)(x, y, z, width, height);
+   ((void (APIENTRY *)(const GLint *coords)) _func)(coords);
 }
 
-void APIENTRY shared_dispatch_stub_1082(const GLshort *coords)
+void APIENTRY shared_dispatch_stub_1082(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1082];
-   ((void (APIENTRY *)(const GLshort *coords)) _func)(coords);
+   ((void (APIENTRY *)(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)) _func)(x, y, z, width, height);
 }
 
-void APIENTRY shared_dispatch_stub_1083(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)
+void APIENTRY shared_dispatch_stub_1083(const GLshort *coords)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1083];
-   ((void (APIENTRY *)(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)) _func)(x, y, z, width, height);
+   ((void (APIENTRY *)(const GLshort *coords)) _func)(coords);
 }
 
-void APIENTRY shared_dispatch_stub_1084(const GLfixed *coords)
+void APIENTRY shared_dispatch_stub_1084(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1084];
-   ((void (APIENTRY *)(const GLfixed *coords)) _func)(coords);
+   ((void (APIENTRY *)(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)) _func)(x, y, z, width, height);
 }
 
-void APIENTRY shared_dispatch_stub_1085(GLenum type, GLsizei stride, const GLvoid *pointer)
+void APIENTRY shared_dispatch_stub_1085(const GLfixed *coords)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1085];
-   ((void (APIENTRY *)(GLenum type, GLsizei stride, const GLvoid *pointer)) _func)(type, stride, pointer);
+   ((void (APIENTRY *)(const GLfixed *coords)) _func)(coords);
 }
 
-GLbitfield APIENTRY shared_dispatch_stub_1086(GLfixed *mantissa, GLint *exponent)
+void APIENTRY shared_dispatch_stub_1086(GLenum type, GLsizei stride, const GLvoid *pointer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1086];
-   return ((GLbitfield (APIENTRY *)(GLfixed *mantissa, GLint *exponent)) _func)(mantissa, exponent);
+   ((void (APIENTRY *)(GLenum type, GLsizei stride, const GLvoid *pointer)) _func)(type, stride, pointer);
 }
 
-void APIENTRY shared_dispatch_stub_1087(GLclampf value, GLboolean invert)
+GLbitfield APIENTRY shared_dispatch_stub_1087(GLfixed *mantissa, GLint *exponent)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1087];
-   ((void (APIENTRY *)(GLclampf value, GLboolean invert)) _func)(value, invert);
+   return ((GLbitfield (APIENTRY *)(GLfixed *mantissa, GLint *exponent)) _func)(mantissa, exponent);
 }
 
-void APIENTRY shared_dispatch_stub_1088(GLenum pattern)
+void APIENTRY shared_dispatch_stub_1088(GLclampf value, GLboolean invert)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1088];
-   ((void (APIENTRY *)(GLenum pattern)) _func)(pattern);
+   ((void (APIENTRY *)(GLclampf value, GLboolean invert)) _func)(value, invert);
 }
 
-void APIENTRY shared_dispatch_stub_1089(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+void APIENTRY shared_dispatch_stub_1089(GLenum pattern)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1089];
-   ((void (APIENTRY *)(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(size, type, stride, count, pointer);
+   ((void (APIENTRY *)(GLenum pattern)) _func)(pattern);
 }
 
-void APIENTRY shared_dispatch_stub_1090(GLsizei stride, GLsizei count, const GLboolean *pointer)
+void APIENTRY shared_dispatch_stub_1090(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1090];
-   ((void (APIENTRY *)(GLsizei stride, GLsizei count, const GLboolean *pointer)) _func)(stride, count, pointer);
+   ((void (APIENTRY *)(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(size, type, stride, count, pointer);
 }
 
-void APIENTRY shared_dispatch_stub_1091(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+void APIENTRY shared_dispatch_stub_1091(GLsizei stride, GLsizei count, const GLboolean *pointer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1091];
-   ((void (APIENTRY *)(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(type, stride, count, pointer);
+   ((void (APIENTRY *)(GLsizei stride, GLsizei count, const GLboolean *pointer)) _func)(stride, count, pointer);
 }
 
 void APIENTRY shared_dispatch_stub_1092(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
@@ -24976,11 +24987,11 @@ void APIENTRY shared_dispatch_stub_1092(GLenum type, GLsizei stride, GLsizei cou
    ((void (APIENTRY *)(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(type, stride, count, pointer);
 }
 
-void APIENTRY shared_dispatch_stub_1093(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+void APIENTRY shared_dispatch_stub_1093(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1093];
-   ((void (APIENTRY *)(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(size, type, stride, count, pointer);
+   ((void (APIENTRY *)(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(type, stride, count, pointer);
 }
 
 void APIENTRY shared_dispatch_stub_1094(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
@@ -24990,1481 +25001,1481 @@ void APIENTRY shared_dispatch_stub_1094(GLint size, GLenum type, GLsizei stride,
    ((void (APIENTRY *)(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(size, type, stride, count, pointer);
 }
 
-void APIENTRY shared_dispatch_stub_1095(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+void APIENTRY shared_dispatch_stub_1095(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1095];
-   ((void (APIENTRY *)(GLenum target, GLsizei numAttachments, const GLenum *attachments)) _func)(target, numAttachments, attachments);
+   ((void (APIENTRY *)(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)) _func)(size, type, stride, count, pointer);
 }
 
-void APIENTRY shared_dispatch_stub_1096(GLuint pipeline, GLuint program)
+void APIENTRY shared_dispatch_stub_1096(GLenum target, GLsizei numAttachments, const GLenum *attachments)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1096];
-   ((void (APIENTRY *)(GLuint pipeline, GLuint program)) _func)(pipeline, program);
+   ((void (APIENTRY *)(GLenum target, GLsizei numAttachments, const GLenum *attachments)) _func)(target, numAttachments, attachments);
 }
 
-void APIENTRY shared_dispatch_stub_1097(GLuint pipeline)
+void APIENTRY shared_dispatch_stub_1097(GLuint pipeline, GLuint program)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1097];
-   ((void (APIENTRY *)(GLuint pipeline)) _func)(pipeline);
+   ((void (APIENTRY *)(GLuint pipeline, GLuint program)) _func)(pipeline, program);
 }
 
-GLuint APIENTRY shared_dispatch_stub_1098(GLenum type, GLsizei count, const GLchar * const *strings)
+void APIENTRY shared_dispatch_stub_1098(GLuint pipeline)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1098];
-   return ((GLuint (APIENTRY *)(GLenum type, GLsizei count, const GLchar * const *strings)) _func)(type, count, strings);
+   ((void (APIENTRY *)(GLuint pipeline)) _func)(pipeline);
 }
 
-void APIENTRY shared_dispatch_stub_1099(GLsizei n, const GLuint *pipelines)
+GLuint APIENTRY shared_dispatch_stub_1099(GLenum type, GLsizei count, const GLchar * const *strings)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1099];
-   ((void (APIENTRY *)(GLsizei n, const GLuint *pipelines)) _func)(n, pipelines);
+   return ((GLuint (APIENTRY *)(GLenum type, GLsizei count, const GLchar * const *strings)) _func)(type, count, strings);
 }
 
-void APIENTRY shared_dispatch_stub_1100(GLsizei n, GLuint *pipelines)
+void APIENTRY shared_dispatch_stub_1100(GLsizei n, const GLuint *pipelines)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1100];
-   ((void (APIENTRY *)(GLsizei n, GLuint *pipelines)) _func)(n, pipelines);
+   ((void (APIENTRY *)(GLsizei n, const GLuint *pipelines)) _func)(n, pipelines);
 }
 
-void APIENTRY shared_dispatch_stub_1101(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+void APIENTRY shared_dispatch_stub_1101(GLsizei n, GLuint *pipelines)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1101];
-   ((void (APIENTRY *)(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)) _func)(pipeline, bufSize, length, infoLog);
+   ((void (APIENTRY *)(GLsizei n, GLuint *pipelines)) _func)(n, pipelines);
 }
 
-void APIENTRY shared_dispatch_stub_1102(GLuint pipeline, GLenum pname, GLint *params)
+void APIENTRY shared_dispatch_stub_1102(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1102];
-   ((void (APIENTRY *)(GLuint pipeline, GLenum pname, GLint *params)) _func)(pipeline, pname, params);
+   ((void (APIENTRY *)(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)) _func)(pipeline, bufSize, length, infoLog);
 }
 
-GLboolean APIENTRY shared_dispatch_stub_1103(GLuint pipeline)
+void APIENTRY shared_dispatch_stub_1103(GLuint pipeline, GLenum pname, GLint *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1103];
-   return ((GLboolean (APIENTRY *)(GLuint pipeline)) _func)(pipeline);
+   ((void (APIENTRY *)(GLuint pipeline, GLenum pname, GLint *params)) _func)(pipeline, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1104(GLint first, GLsizei count)
+GLboolean APIENTRY shared_dispatch_stub_1104(GLuint pipeline)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1104];
-   ((void (APIENTRY *)(GLint first, GLsizei count)) _func)(first, count);
+   return ((GLboolean (APIENTRY *)(GLuint pipeline)) _func)(pipeline);
 }
 
-void APIENTRY shared_dispatch_stub_1105(GLuint program, GLint location, GLdouble x)
+void APIENTRY shared_dispatch_stub_1105(GLint first, GLsizei count)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1105];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x)) _func)(program, location, x);
+   ((void (APIENTRY *)(GLint first, GLsizei count)) _func)(first, count);
 }
 
-void APIENTRY shared_dispatch_stub_1106(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1106(GLuint program, GLint location, GLdouble x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1106];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x)) _func)(program, location, x);
 }
 
-void APIENTRY shared_dispatch_stub_1107(GLuint program, GLint location, GLfloat x)
+void APIENTRY shared_dispatch_stub_1107(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1107];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x)) _func)(program, location, x);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1108(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1108(GLuint program, GLint location, GLfloat x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1108];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x)) _func)(program, location, x);
 }
 
-void APIENTRY shared_dispatch_stub_1109(GLuint program, GLint location, GLint x)
+void APIENTRY shared_dispatch_stub_1109(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1109];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLint x)) _func)(program, location, x);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1110(GLuint program, GLint location, GLsizei count, const GLint *value)
+void APIENTRY shared_dispatch_stub_1110(GLuint program, GLint location, GLint x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1110];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLint x)) _func)(program, location, x);
 }
 
-void APIENTRY shared_dispatch_stub_1111(GLuint program, GLint location, GLuint x)
+void APIENTRY shared_dispatch_stub_1111(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1111];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x)) _func)(program, location, x);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1112(GLuint program, GLint location, GLsizei count, const GLuint *value)
+void APIENTRY shared_dispatch_stub_1112(GLuint program, GLint location, GLuint x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1112];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x)) _func)(program, location, x);
 }
 
-void APIENTRY shared_dispatch_stub_1113(GLuint program, GLint location, GLdouble x, GLdouble y)
+void APIENTRY shared_dispatch_stub_1113(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1113];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x, GLdouble y)) _func)(program, location, x, y);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1114(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1114(GLuint program, GLint location, GLdouble x, GLdouble y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1114];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x, GLdouble y)) _func)(program, location, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1115(GLuint program, GLint location, GLfloat x, GLfloat y)
+void APIENTRY shared_dispatch_stub_1115(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1115];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x, GLfloat y)) _func)(program, location, x, y);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1116(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1116(GLuint program, GLint location, GLfloat x, GLfloat y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1116];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x, GLfloat y)) _func)(program, location, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1117(GLuint program, GLint location, GLint x, GLint y)
+void APIENTRY shared_dispatch_stub_1117(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1117];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLint x, GLint y)) _func)(program, location, x, y);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1118(GLuint program, GLint location, GLsizei count, const GLint *value)
+void APIENTRY shared_dispatch_stub_1118(GLuint program, GLint location, GLint x, GLint y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1118];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLint x, GLint y)) _func)(program, location, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1119(GLuint program, GLint location, GLuint x, GLuint y)
+void APIENTRY shared_dispatch_stub_1119(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1119];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x, GLuint y)) _func)(program, location, x, y);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1120(GLuint program, GLint location, GLsizei count, const GLuint *value)
+void APIENTRY shared_dispatch_stub_1120(GLuint program, GLint location, GLuint x, GLuint y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1120];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x, GLuint y)) _func)(program, location, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1121(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
+void APIENTRY shared_dispatch_stub_1121(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1121];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)) _func)(program, location, x, y, z);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1122(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1122(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1122];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)) _func)(program, location, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1123(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)
+void APIENTRY shared_dispatch_stub_1123(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1123];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)) _func)(program, location, x, y, z);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1124(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1124(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1124];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)) _func)(program, location, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1125(GLuint program, GLint location, GLint x, GLint y, GLint z)
+void APIENTRY shared_dispatch_stub_1125(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1125];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLint x, GLint y, GLint z)) _func)(program, location, x, y, z);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1126(GLuint program, GLint location, GLsizei count, const GLint *value)
+void APIENTRY shared_dispatch_stub_1126(GLuint program, GLint location, GLint x, GLint y, GLint z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1126];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLint x, GLint y, GLint z)) _func)(program, location, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1127(GLuint program, GLint location, GLuint x, GLuint y, GLuint z)
+void APIENTRY shared_dispatch_stub_1127(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1127];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z)) _func)(program, location, x, y, z);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1128(GLuint program, GLint location, GLsizei count, const GLuint *value)
+void APIENTRY shared_dispatch_stub_1128(GLuint program, GLint location, GLuint x, GLuint y, GLuint z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1128];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z)) _func)(program, location, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1129(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+void APIENTRY shared_dispatch_stub_1129(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1129];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(program, location, x, y, z, w);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1130(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1130(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1130];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(program, location, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1131(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+void APIENTRY shared_dispatch_stub_1131(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1131];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(program, location, x, y, z, w);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLdouble *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1132(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1132(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1132];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(program, location, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1133(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)
+void APIENTRY shared_dispatch_stub_1133(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1133];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)) _func)(program, location, x, y, z, w);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLfloat *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1134(GLuint program, GLint location, GLsizei count, const GLint *value)
+void APIENTRY shared_dispatch_stub_1134(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1134];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)) _func)(program, location, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1135(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)
+void APIENTRY shared_dispatch_stub_1135(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1135];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)) _func)(program, location, x, y, z, w);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1136(GLuint program, GLint location, GLsizei count, const GLuint *value)
+void APIENTRY shared_dispatch_stub_1136(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1136];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)) _func)(program, location, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1137(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1137(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1137];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, const GLuint *value)) _func)(program, location, count, value);
 }
 
-void APIENTRY shared_dispatch_stub_1138(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1138(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1138];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1139(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1139(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1139];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1140(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1140(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1140];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1141(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1141(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1141];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1142(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1142(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1142];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1143(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1143(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1143];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1144(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1144(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1144];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1145(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1145(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1145];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1146(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1146(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1146];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1147(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1147(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1147];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1148(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1148(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1148];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1149(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1149(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1149];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1150(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1150(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1150];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1151(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1151(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1151];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1152(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1152(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1152];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1153(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+void APIENTRY shared_dispatch_stub_1153(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1153];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1154(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1154(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1154];
-   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1155(void)
+void APIENTRY shared_dispatch_stub_1155(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1155];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)) _func)(program, location, count, transpose, value);
 }
 
-void APIENTRY shared_dispatch_stub_1156(GLuint pipeline, GLbitfield stages, GLuint program)
+void APIENTRY shared_dispatch_stub_1156(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1156];
-   ((void (APIENTRY *)(GLuint pipeline, GLbitfield stages, GLuint program)) _func)(pipeline, stages, program);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1157(GLuint pipeline)
+void APIENTRY shared_dispatch_stub_1157(GLuint pipeline, GLbitfield stages, GLuint program)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1157];
-   ((void (APIENTRY *)(GLuint pipeline)) _func)(pipeline);
+   ((void (APIENTRY *)(GLuint pipeline, GLbitfield stages, GLuint program)) _func)(pipeline, stages, program);
 }
 
-void APIENTRY shared_dispatch_stub_1158(GLDEBUGPROC callback, const GLvoid *userParam)
+void APIENTRY shared_dispatch_stub_1158(GLuint pipeline)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1158];
-   ((void (APIENTRY *)(GLDEBUGPROC callback, const GLvoid *userParam)) _func)(callback, userParam);
+   ((void (APIENTRY *)(GLuint pipeline)) _func)(pipeline);
 }
 
-void APIENTRY shared_dispatch_stub_1159(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+void APIENTRY shared_dispatch_stub_1159(GLDEBUGPROC callback, const GLvoid *userParam)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1159];
-   ((void (APIENTRY *)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)) _func)(source, type, severity, count, ids, enabled);
+   ((void (APIENTRY *)(GLDEBUGPROC callback, const GLvoid *userParam)) _func)(callback, userParam);
 }
 
-void APIENTRY shared_dispatch_stub_1160(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+void APIENTRY shared_dispatch_stub_1160(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1160];
-   ((void (APIENTRY *)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)) _func)(source, type, id, severity, length, buf);
+   ((void (APIENTRY *)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)) _func)(source, type, severity, count, ids, enabled);
 }
 
-GLuint APIENTRY shared_dispatch_stub_1161(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+void APIENTRY shared_dispatch_stub_1161(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1161];
-   return ((GLuint (APIENTRY *)(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)) _func)(count, bufsize, sources, types, ids, severities, lengths, messageLog);
+   ((void (APIENTRY *)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)) _func)(source, type, id, severity, length, buf);
 }
 
-void APIENTRY shared_dispatch_stub_1162(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+GLuint APIENTRY shared_dispatch_stub_1162(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1162];
-   ((void (APIENTRY *)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)) _func)(identifier, name, bufSize, length, label);
+   return ((GLuint (APIENTRY *)(GLuint count, GLsizei bufsize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)) _func)(count, bufsize, sources, types, ids, severities, lengths, messageLog);
 }
 
-void APIENTRY shared_dispatch_stub_1163(const GLvoid *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+void APIENTRY shared_dispatch_stub_1163(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1163];
-   ((void (APIENTRY *)(const GLvoid *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)) _func)(ptr, bufSize, length, label);
+   ((void (APIENTRY *)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)) _func)(identifier, name, bufSize, length, label);
 }
 
-void APIENTRY shared_dispatch_stub_1164(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+void APIENTRY shared_dispatch_stub_1164(const GLvoid *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1164];
-   ((void (APIENTRY *)(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)) _func)(identifier, name, length, label);
+   ((void (APIENTRY *)(const GLvoid *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)) _func)(ptr, bufSize, length, label);
 }
 
-void APIENTRY shared_dispatch_stub_1165(const GLvoid *ptr, GLsizei length, const GLchar *label)
+void APIENTRY shared_dispatch_stub_1165(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1165];
-   ((void (APIENTRY *)(const GLvoid *ptr, GLsizei length, const GLchar *label)) _func)(ptr, length, label);
+   ((void (APIENTRY *)(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)) _func)(identifier, name, length, label);
 }
 
-void APIENTRY shared_dispatch_stub_1166(void)
+void APIENTRY shared_dispatch_stub_1166(const GLvoid *ptr, GLsizei length, const GLchar *label)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1166];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(const GLvoid *ptr, GLsizei length, const GLchar *label)) _func)(ptr, length, label);
 }
 
-void APIENTRY shared_dispatch_stub_1167(GLenum source, GLuint id, GLsizei length, const GLchar *message)
+void APIENTRY shared_dispatch_stub_1167(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1167];
-   ((void (APIENTRY *)(GLenum source, GLuint id, GLsizei length, const GLchar *message)) _func)(source, id, length, message);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1168(GLfloat red, GLfloat green, GLfloat blue)
+void APIENTRY shared_dispatch_stub_1168(GLenum source, GLuint id, GLsizei length, const GLchar *message)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1168];
-   ((void (APIENTRY *)(GLfloat red, GLfloat green, GLfloat blue)) _func)(red, green, blue);
+   ((void (APIENTRY *)(GLenum source, GLuint id, GLsizei length, const GLchar *message)) _func)(source, id, length, message);
 }
 
-void APIENTRY shared_dispatch_stub_1169(const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1169(GLfloat red, GLfloat green, GLfloat blue)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1169];
-   ((void (APIENTRY *)(const GLfloat *v)) _func)(v);
+   ((void (APIENTRY *)(GLfloat red, GLfloat green, GLfloat blue)) _func)(red, green, blue);
 }
 
-void APIENTRY shared_dispatch_stub_1170(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount)
+void APIENTRY shared_dispatch_stub_1170(const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1170];
-   ((void (APIENTRY *)(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount)) _func)(mode, count, type, indices, primcount);
+   ((void (APIENTRY *)(const GLfloat *v)) _func)(v);
 }
 
-void APIENTRY shared_dispatch_stub_1171(GLfloat coord)
+void APIENTRY shared_dispatch_stub_1171(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1171];
-   ((void (APIENTRY *)(GLfloat coord)) _func)(coord);
+   ((void (APIENTRY *)(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount)) _func)(mode, count, type, indices, primcount);
 }
 
-void APIENTRY shared_dispatch_stub_1172(const GLfloat *coord)
+void APIENTRY shared_dispatch_stub_1172(GLfloat coord)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1172];
-   ((void (APIENTRY *)(const GLfloat *coord)) _func)(coord);
+   ((void (APIENTRY *)(GLfloat coord)) _func)(coord);
 }
 
-void APIENTRY shared_dispatch_stub_1173(void)
+void APIENTRY shared_dispatch_stub_1173(const GLfloat *coord)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1173];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(const GLfloat *coord)) _func)(coord);
 }
 
-void APIENTRY shared_dispatch_stub_1174(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+void APIENTRY shared_dispatch_stub_1174(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1174];
-   ((void (APIENTRY *)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(x, y, z, w);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1175(const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1175(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1175];
-   ((void (APIENTRY *)(const GLdouble *v)) _func)(v);
+   ((void (APIENTRY *)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1176(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+void APIENTRY shared_dispatch_stub_1176(const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1176];
-   ((void (APIENTRY *)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(x, y, z, w);
+   ((void (APIENTRY *)(const GLdouble *v)) _func)(v);
 }
 
-void APIENTRY shared_dispatch_stub_1177(const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1177(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1177];
-   ((void (APIENTRY *)(const GLfloat *v)) _func)(v);
+   ((void (APIENTRY *)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1178(GLint x, GLint y, GLint z, GLint w)
+void APIENTRY shared_dispatch_stub_1178(const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1178];
-   ((void (APIENTRY *)(GLint x, GLint y, GLint z, GLint w)) _func)(x, y, z, w);
+   ((void (APIENTRY *)(const GLfloat *v)) _func)(v);
 }
 
-void APIENTRY shared_dispatch_stub_1179(const GLint *v)
+void APIENTRY shared_dispatch_stub_1179(GLint x, GLint y, GLint z, GLint w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1179];
-   ((void (APIENTRY *)(const GLint *v)) _func)(v);
+   ((void (APIENTRY *)(GLint x, GLint y, GLint z, GLint w)) _func)(x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1180(GLshort x, GLshort y, GLshort z, GLshort w)
+void APIENTRY shared_dispatch_stub_1180(const GLint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1180];
-   ((void (APIENTRY *)(GLshort x, GLshort y, GLshort z, GLshort w)) _func)(x, y, z, w);
+   ((void (APIENTRY *)(const GLint *v)) _func)(v);
 }
 
-void APIENTRY shared_dispatch_stub_1181(const GLshort *v)
+void APIENTRY shared_dispatch_stub_1181(GLshort x, GLshort y, GLshort z, GLshort w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1181];
-   ((void (APIENTRY *)(const GLshort *v)) _func)(v);
+   ((void (APIENTRY *)(GLshort x, GLshort y, GLshort z, GLshort w)) _func)(x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1182(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride)
+void APIENTRY shared_dispatch_stub_1182(const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1182];
-   ((void (APIENTRY *)(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride)) _func)(mode, first, count, primcount, modestride);
+   ((void (APIENTRY *)(const GLshort *v)) _func)(v);
 }
 
-void APIENTRY shared_dispatch_stub_1183(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride)
+void APIENTRY shared_dispatch_stub_1183(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1183];
-   ((void (APIENTRY *)(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride)) _func)(mode, count, type, indices, primcount, modestride);
+   ((void (APIENTRY *)(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride)) _func)(mode, first, count, primcount, modestride);
 }
 
-GLboolean APIENTRY shared_dispatch_stub_1184(GLsizei n, const GLuint *ids, GLboolean *residences)
+void APIENTRY shared_dispatch_stub_1184(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1184];
-   return ((GLboolean (APIENTRY *)(GLsizei n, const GLuint *ids, GLboolean *residences)) _func)(n, ids, residences);
+   ((void (APIENTRY *)(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride)) _func)(mode, count, type, indices, primcount, modestride);
 }
 
-void APIENTRY shared_dispatch_stub_1185(GLenum target, GLuint id, const GLfloat *params)
+GLboolean APIENTRY shared_dispatch_stub_1185(GLsizei n, const GLuint *ids, GLboolean *residences)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1185];
-   ((void (APIENTRY *)(GLenum target, GLuint id, const GLfloat *params)) _func)(target, id, params);
+   return ((GLboolean (APIENTRY *)(GLsizei n, const GLuint *ids, GLboolean *residences)) _func)(n, ids, residences);
 }
 
-void APIENTRY shared_dispatch_stub_1186(GLenum target, GLuint index, GLenum pname, GLdouble *params)
+void APIENTRY shared_dispatch_stub_1186(GLenum target, GLuint id, const GLfloat *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1186];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLenum pname, GLdouble *params)) _func)(target, index, pname, params);
+   ((void (APIENTRY *)(GLenum target, GLuint id, const GLfloat *params)) _func)(target, id, params);
 }
 
-void APIENTRY shared_dispatch_stub_1187(GLenum target, GLuint index, GLenum pname, GLfloat *params)
+void APIENTRY shared_dispatch_stub_1187(GLenum target, GLuint index, GLenum pname, GLdouble *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1187];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLenum pname, GLfloat *params)) _func)(target, index, pname, params);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLenum pname, GLdouble *params)) _func)(target, index, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1188(GLuint id, GLenum pname, GLubyte *program)
+void APIENTRY shared_dispatch_stub_1188(GLenum target, GLuint index, GLenum pname, GLfloat *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1188];
-   ((void (APIENTRY *)(GLuint id, GLenum pname, GLubyte *program)) _func)(id, pname, program);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLenum pname, GLfloat *params)) _func)(target, index, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1189(GLuint id, GLenum pname, GLint *params)
+void APIENTRY shared_dispatch_stub_1189(GLuint id, GLenum pname, GLubyte *program)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1189];
-   ((void (APIENTRY *)(GLuint id, GLenum pname, GLint *params)) _func)(id, pname, params);
+   ((void (APIENTRY *)(GLuint id, GLenum pname, GLubyte *program)) _func)(id, pname, program);
 }
 
-void APIENTRY shared_dispatch_stub_1190(GLenum target, GLuint address, GLenum pname, GLint *params)
+void APIENTRY shared_dispatch_stub_1190(GLuint id, GLenum pname, GLint *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1190];
-   ((void (APIENTRY *)(GLenum target, GLuint address, GLenum pname, GLint *params)) _func)(target, address, pname, params);
+   ((void (APIENTRY *)(GLuint id, GLenum pname, GLint *params)) _func)(id, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1191(GLuint index, GLenum pname, GLdouble *params)
+void APIENTRY shared_dispatch_stub_1191(GLenum target, GLuint address, GLenum pname, GLint *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1191];
-   ((void (APIENTRY *)(GLuint index, GLenum pname, GLdouble *params)) _func)(index, pname, params);
+   ((void (APIENTRY *)(GLenum target, GLuint address, GLenum pname, GLint *params)) _func)(target, address, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1192(GLuint index, GLenum pname, GLfloat *params)
+void APIENTRY shared_dispatch_stub_1192(GLuint index, GLenum pname, GLdouble *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1192];
-   ((void (APIENTRY *)(GLuint index, GLenum pname, GLfloat *params)) _func)(index, pname, params);
+   ((void (APIENTRY *)(GLuint index, GLenum pname, GLdouble *params)) _func)(index, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1193(GLuint index, GLenum pname, GLint *params)
+void APIENTRY shared_dispatch_stub_1193(GLuint index, GLenum pname, GLfloat *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1193];
-   ((void (APIENTRY *)(GLuint index, GLenum pname, GLint *params)) _func)(index, pname, params);
+   ((void (APIENTRY *)(GLuint index, GLenum pname, GLfloat *params)) _func)(index, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1194(GLenum target, GLuint id, GLsizei len, const GLubyte *program)
+void APIENTRY shared_dispatch_stub_1194(GLuint index, GLenum pname, GLint *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1194];
-   ((void (APIENTRY *)(GLenum target, GLuint id, GLsizei len, const GLubyte *program)) _func)(target, id, len, program);
+   ((void (APIENTRY *)(GLuint index, GLenum pname, GLint *params)) _func)(index, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1195(GLenum target, GLuint index, GLsizei num, const GLdouble *params)
+void APIENTRY shared_dispatch_stub_1195(GLenum target, GLuint id, GLsizei len, const GLubyte *program)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1195];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei num, const GLdouble *params)) _func)(target, index, num, params);
+   ((void (APIENTRY *)(GLenum target, GLuint id, GLsizei len, const GLubyte *program)) _func)(target, id, len, program);
 }
 
-void APIENTRY shared_dispatch_stub_1196(GLenum target, GLuint index, GLsizei num, const GLfloat *params)
+void APIENTRY shared_dispatch_stub_1196(GLenum target, GLuint index, GLsizei num, const GLdouble *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1196];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei num, const GLfloat *params)) _func)(target, index, num, params);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei num, const GLdouble *params)) _func)(target, index, num, params);
 }
 
-void APIENTRY shared_dispatch_stub_1197(GLsizei n, const GLuint *ids)
+void APIENTRY shared_dispatch_stub_1197(GLenum target, GLuint index, GLsizei num, const GLfloat *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1197];
-   ((void (APIENTRY *)(GLsizei n, const GLuint *ids)) _func)(n, ids);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei num, const GLfloat *params)) _func)(target, index, num, params);
 }
 
-void APIENTRY shared_dispatch_stub_1198(GLenum target, GLuint address, GLenum matrix, GLenum transform)
+void APIENTRY shared_dispatch_stub_1198(GLsizei n, const GLuint *ids)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1198];
-   ((void (APIENTRY *)(GLenum target, GLuint address, GLenum matrix, GLenum transform)) _func)(target, address, matrix, transform);
+   ((void (APIENTRY *)(GLsizei n, const GLuint *ids)) _func)(n, ids);
 }
 
-void APIENTRY shared_dispatch_stub_1199(GLuint index, GLdouble x)
+void APIENTRY shared_dispatch_stub_1199(GLenum target, GLuint address, GLenum matrix, GLenum transform)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1199];
-   ((void (APIENTRY *)(GLuint index, GLdouble x)) _func)(index, x);
+   ((void (APIENTRY *)(GLenum target, GLuint address, GLenum matrix, GLenum transform)) _func)(target, address, matrix, transform);
 }
 
-void APIENTRY shared_dispatch_stub_1200(GLuint index, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1200(GLuint index, GLdouble x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1200];
-   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLdouble x)) _func)(index, x);
 }
 
-void APIENTRY shared_dispatch_stub_1201(GLuint index, GLfloat x)
+void APIENTRY shared_dispatch_stub_1201(GLuint index, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1201];
-   ((void (APIENTRY *)(GLuint index, GLfloat x)) _func)(index, x);
+   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1202(GLuint index, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1202(GLuint index, GLfloat x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1202];
-   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLfloat x)) _func)(index, x);
 }
 
-void APIENTRY shared_dispatch_stub_1203(GLuint index, GLshort x)
+void APIENTRY shared_dispatch_stub_1203(GLuint index, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1203];
-   ((void (APIENTRY *)(GLuint index, GLshort x)) _func)(index, x);
+   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1204(GLuint index, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1204(GLuint index, GLshort x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1204];
-   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLshort x)) _func)(index, x);
 }
 
-void APIENTRY shared_dispatch_stub_1205(GLuint index, GLdouble x, GLdouble y)
+void APIENTRY shared_dispatch_stub_1205(GLuint index, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1205];
-   ((void (APIENTRY *)(GLuint index, GLdouble x, GLdouble y)) _func)(index, x, y);
+   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1206(GLuint index, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1206(GLuint index, GLdouble x, GLdouble y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1206];
-   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLdouble x, GLdouble y)) _func)(index, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1207(GLuint index, GLfloat x, GLfloat y)
+void APIENTRY shared_dispatch_stub_1207(GLuint index, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1207];
-   ((void (APIENTRY *)(GLuint index, GLfloat x, GLfloat y)) _func)(index, x, y);
+   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1208(GLuint index, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1208(GLuint index, GLfloat x, GLfloat y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1208];
-   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLfloat x, GLfloat y)) _func)(index, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1209(GLuint index, GLshort x, GLshort y)
+void APIENTRY shared_dispatch_stub_1209(GLuint index, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1209];
-   ((void (APIENTRY *)(GLuint index, GLshort x, GLshort y)) _func)(index, x, y);
+   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1210(GLuint index, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1210(GLuint index, GLshort x, GLshort y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1210];
-   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLshort x, GLshort y)) _func)(index, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1211(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+void APIENTRY shared_dispatch_stub_1211(GLuint index, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1211];
-   ((void (APIENTRY *)(GLuint index, GLdouble x, GLdouble y, GLdouble z)) _func)(index, x, y, z);
+   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1212(GLuint index, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1212(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1212];
-   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLdouble x, GLdouble y, GLdouble z)) _func)(index, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1213(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+void APIENTRY shared_dispatch_stub_1213(GLuint index, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1213];
-   ((void (APIENTRY *)(GLuint index, GLfloat x, GLfloat y, GLfloat z)) _func)(index, x, y, z);
+   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1214(GLuint index, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1214(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1214];
-   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLfloat x, GLfloat y, GLfloat z)) _func)(index, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1215(GLuint index, GLshort x, GLshort y, GLshort z)
+void APIENTRY shared_dispatch_stub_1215(GLuint index, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1215];
-   ((void (APIENTRY *)(GLuint index, GLshort x, GLshort y, GLshort z)) _func)(index, x, y, z);
+   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1216(GLuint index, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1216(GLuint index, GLshort x, GLshort y, GLshort z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1216];
-   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLshort x, GLshort y, GLshort z)) _func)(index, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1217(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+void APIENTRY shared_dispatch_stub_1217(GLuint index, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1217];
-   ((void (APIENTRY *)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(index, x, y, z, w);
+   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1218(GLuint index, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1218(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1218];
-   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(index, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1219(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+void APIENTRY shared_dispatch_stub_1219(GLuint index, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1219];
-   ((void (APIENTRY *)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(index, x, y, z, w);
+   ((void (APIENTRY *)(GLuint index, const GLdouble *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1220(GLuint index, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1220(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1220];
-   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(index, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1221(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+void APIENTRY shared_dispatch_stub_1221(GLuint index, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1221];
-   ((void (APIENTRY *)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)) _func)(index, x, y, z, w);
+   ((void (APIENTRY *)(GLuint index, const GLfloat *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1222(GLuint index, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1222(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1222];
-   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)) _func)(index, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1223(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+void APIENTRY shared_dispatch_stub_1223(GLuint index, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1223];
-   ((void (APIENTRY *)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)) _func)(index, x, y, z, w);
+   ((void (APIENTRY *)(GLuint index, const GLshort *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1224(GLuint index, const GLubyte *v)
+void APIENTRY shared_dispatch_stub_1224(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1224];
-   ((void (APIENTRY *)(GLuint index, const GLubyte *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)) _func)(index, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1225(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+void APIENTRY shared_dispatch_stub_1225(GLuint index, const GLubyte *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1225];
-   ((void (APIENTRY *)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)) _func)(index, size, type, stride, pointer);
+   ((void (APIENTRY *)(GLuint index, const GLubyte *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1226(GLuint index, GLsizei n, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1226(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1226];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)) _func)(index, size, type, stride, pointer);
 }
 
-void APIENTRY shared_dispatch_stub_1227(GLuint index, GLsizei n, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1227(GLuint index, GLsizei n, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1227];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1228(GLuint index, GLsizei n, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1228(GLuint index, GLsizei n, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1228];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1229(GLuint index, GLsizei n, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1229(GLuint index, GLsizei n, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1229];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1230(GLuint index, GLsizei n, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1230(GLuint index, GLsizei n, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1230];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1231(GLuint index, GLsizei n, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1231(GLuint index, GLsizei n, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1231];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1232(GLuint index, GLsizei n, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1232(GLuint index, GLsizei n, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1232];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1233(GLuint index, GLsizei n, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1233(GLuint index, GLsizei n, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1233];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1234(GLuint index, GLsizei n, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1234(GLuint index, GLsizei n, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1234];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1235(GLuint index, GLsizei n, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1235(GLuint index, GLsizei n, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1235];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1236(GLuint index, GLsizei n, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1236(GLuint index, GLsizei n, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1236];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLdouble *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1237(GLuint index, GLsizei n, const GLshort *v)
+void APIENTRY shared_dispatch_stub_1237(GLuint index, GLsizei n, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1237];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLfloat *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1238(GLuint index, GLsizei n, const GLubyte *v)
+void APIENTRY shared_dispatch_stub_1238(GLuint index, GLsizei n, const GLshort *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1238];
-   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLubyte *v)) _func)(index, n, v);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLshort *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1239(GLenum pname, GLfloat *param)
+void APIENTRY shared_dispatch_stub_1239(GLuint index, GLsizei n, const GLubyte *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1239];
-   ((void (APIENTRY *)(GLenum pname, GLfloat *param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLuint index, GLsizei n, const GLubyte *v)) _func)(index, n, v);
 }
 
-void APIENTRY shared_dispatch_stub_1240(GLenum pname, GLint *param)
+void APIENTRY shared_dispatch_stub_1240(GLenum pname, GLfloat *param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1240];
-   ((void (APIENTRY *)(GLenum pname, GLint *param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLenum pname, GLfloat *param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1241(GLenum pname, const GLfloat *param)
+void APIENTRY shared_dispatch_stub_1241(GLenum pname, GLint *param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1241];
-   ((void (APIENTRY *)(GLenum pname, const GLfloat *param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLenum pname, GLint *param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1242(GLenum pname, const GLint *param)
+void APIENTRY shared_dispatch_stub_1242(GLenum pname, const GLfloat *param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1242];
-   ((void (APIENTRY *)(GLenum pname, const GLint *param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLenum pname, const GLfloat *param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1243(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+void APIENTRY shared_dispatch_stub_1243(GLenum pname, const GLint *param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1243];
-   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)) _func)(op, dst, dstMod, arg1, arg1Rep, arg1Mod);
+   ((void (APIENTRY *)(GLenum pname, const GLint *param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1244(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+void APIENTRY shared_dispatch_stub_1244(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1244];
-   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)) _func)(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)) _func)(op, dst, dstMod, arg1, arg1Rep, arg1Mod);
 }
 
-void APIENTRY shared_dispatch_stub_1245(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+void APIENTRY shared_dispatch_stub_1245(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1245];
-   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)) _func)(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)) _func)(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
 }
 
-void APIENTRY shared_dispatch_stub_1246(void)
+void APIENTRY shared_dispatch_stub_1246(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1246];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)) _func)(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
 }
 
-void APIENTRY shared_dispatch_stub_1247(GLuint id)
+void APIENTRY shared_dispatch_stub_1247(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1247];
-   ((void (APIENTRY *)(GLuint id)) _func)(id);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1248(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+void APIENTRY shared_dispatch_stub_1248(GLuint id)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1248];
-   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)) _func)(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);
+   ((void (APIENTRY *)(GLuint id)) _func)(id);
 }
 
-void APIENTRY shared_dispatch_stub_1249(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+void APIENTRY shared_dispatch_stub_1249(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1249];
-   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)) _func)(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)) _func)(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);
 }
 
-void APIENTRY shared_dispatch_stub_1250(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+void APIENTRY shared_dispatch_stub_1250(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1250];
-   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)) _func)(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)) _func)(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
 }
 
-void APIENTRY shared_dispatch_stub_1251(GLuint id)
+void APIENTRY shared_dispatch_stub_1251(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1251];
-   ((void (APIENTRY *)(GLuint id)) _func)(id);
+   ((void (APIENTRY *)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)) _func)(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
 }
 
-void APIENTRY shared_dispatch_stub_1252(void)
+void APIENTRY shared_dispatch_stub_1252(GLuint id)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1252];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(GLuint id)) _func)(id);
 }
 
-GLuint APIENTRY shared_dispatch_stub_1253(GLuint range)
+void APIENTRY shared_dispatch_stub_1253(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1253];
-   return ((GLuint (APIENTRY *)(GLuint range)) _func)(range);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1254(GLuint dst, GLuint coord, GLenum swizzle)
+GLuint APIENTRY shared_dispatch_stub_1254(GLuint range)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1254];
-   ((void (APIENTRY *)(GLuint dst, GLuint coord, GLenum swizzle)) _func)(dst, coord, swizzle);
+   return ((GLuint (APIENTRY *)(GLuint range)) _func)(range);
 }
 
-void APIENTRY shared_dispatch_stub_1255(GLuint dst, GLuint interp, GLenum swizzle)
+void APIENTRY shared_dispatch_stub_1255(GLuint dst, GLuint coord, GLenum swizzle)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1255];
-   ((void (APIENTRY *)(GLuint dst, GLuint interp, GLenum swizzle)) _func)(dst, interp, swizzle);
+   ((void (APIENTRY *)(GLuint dst, GLuint coord, GLenum swizzle)) _func)(dst, coord, swizzle);
 }
 
-void APIENTRY shared_dispatch_stub_1256(GLuint dst, const GLfloat *value)
+void APIENTRY shared_dispatch_stub_1256(GLuint dst, GLuint interp, GLenum swizzle)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1256];
-   ((void (APIENTRY *)(GLuint dst, const GLfloat *value)) _func)(dst, value);
+   ((void (APIENTRY *)(GLuint dst, GLuint interp, GLenum swizzle)) _func)(dst, interp, swizzle);
 }
 
-void APIENTRY shared_dispatch_stub_1257(GLuint first, GLsizei count, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1257(GLuint dst, const GLfloat *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1257];
-   ((void (APIENTRY *)(GLuint first, GLsizei count, const GLfloat *v)) _func)(first, count, v);
+   ((void (APIENTRY *)(GLuint dst, const GLfloat *value)) _func)(dst, value);
 }
 
-void APIENTRY shared_dispatch_stub_1258(GLuint index, GLfloat n, GLfloat f)
+void APIENTRY shared_dispatch_stub_1258(GLuint first, GLsizei count, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1258];
-   ((void (APIENTRY *)(GLuint index, GLfloat n, GLfloat f)) _func)(index, n, f);
+   ((void (APIENTRY *)(GLuint first, GLsizei count, const GLfloat *v)) _func)(first, count, v);
 }
 
-void APIENTRY shared_dispatch_stub_1259(GLenum face)
+void APIENTRY shared_dispatch_stub_1259(GLuint index, GLfloat n, GLfloat f)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1259];
-   ((void (APIENTRY *)(GLenum face)) _func)(face);
+   ((void (APIENTRY *)(GLuint index, GLfloat n, GLfloat f)) _func)(index, n, f);
 }
 
-void APIENTRY shared_dispatch_stub_1260(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params)
+void APIENTRY shared_dispatch_stub_1260(GLenum face)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1260];
-   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params)) _func)(id, len, name, params);
+   ((void (APIENTRY *)(GLenum face)) _func)(face);
 }
 
-void APIENTRY shared_dispatch_stub_1261(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params)
+void APIENTRY shared_dispatch_stub_1261(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1261];
-   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params)) _func)(id, len, name, params);
+   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params)) _func)(id, len, name, params);
 }
 
-void APIENTRY shared_dispatch_stub_1262(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+void APIENTRY shared_dispatch_stub_1262(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1262];
-   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(id, len, name, x, y, z, w);
+   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params)) _func)(id, len, name, params);
 }
 
-void APIENTRY shared_dispatch_stub_1263(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v)
+void APIENTRY shared_dispatch_stub_1263(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1263];
-   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v)) _func)(id, len, name, v);
+   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) _func)(id, len, name, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1264(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+void APIENTRY shared_dispatch_stub_1264(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1264];
-   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(id, len, name, x, y, z, w);
+   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v)) _func)(id, len, name, v);
 }
 
-void APIENTRY shared_dispatch_stub_1265(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v)
+void APIENTRY shared_dispatch_stub_1265(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1265];
-   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v)) _func)(id, len, name, v);
+   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) _func)(id, len, name, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1266(void)
+void APIENTRY shared_dispatch_stub_1266(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1266];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v)) _func)(id, len, name, v);
 }
 
-void APIENTRY shared_dispatch_stub_1267(GLenum coord, GLenum pname, GLfixed *params)
+void APIENTRY shared_dispatch_stub_1267(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1267];
-   ((void (APIENTRY *)(GLenum coord, GLenum pname, GLfixed *params)) _func)(coord, pname, params);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1268(GLenum coord, GLenum pname, GLint param)
+void APIENTRY shared_dispatch_stub_1268(GLenum coord, GLenum pname, GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1268];
-   ((void (APIENTRY *)(GLenum coord, GLenum pname, GLint param)) _func)(coord, pname, param);
+   ((void (APIENTRY *)(GLenum coord, GLenum pname, GLfixed *params)) _func)(coord, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1269(GLenum coord, GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1269(GLenum coord, GLenum pname, GLint param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1269];
-   ((void (APIENTRY *)(GLenum coord, GLenum pname, const GLfixed *params)) _func)(coord, pname, params);
+   ((void (APIENTRY *)(GLenum coord, GLenum pname, GLint param)) _func)(coord, pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1270(GLclampd zmin, GLclampd zmax)
+void APIENTRY shared_dispatch_stub_1270(GLenum coord, GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1270];
-   ((void (APIENTRY *)(GLclampd zmin, GLclampd zmax)) _func)(zmin, zmax);
+   ((void (APIENTRY *)(GLenum coord, GLenum pname, const GLfixed *params)) _func)(coord, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1271(GLenum target, GLuint framebuffer)
+void APIENTRY shared_dispatch_stub_1271(GLclampd zmin, GLclampd zmax)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1271];
-   ((void (APIENTRY *)(GLenum target, GLuint framebuffer)) _func)(target, framebuffer);
+   ((void (APIENTRY *)(GLclampd zmin, GLclampd zmax)) _func)(zmin, zmax);
 }
 
-void APIENTRY shared_dispatch_stub_1272(GLenum target, GLuint renderbuffer)
+void APIENTRY shared_dispatch_stub_1272(GLenum target, GLuint framebuffer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1272];
-   ((void (APIENTRY *)(GLenum target, GLuint renderbuffer)) _func)(target, renderbuffer);
+   ((void (APIENTRY *)(GLenum target, GLuint framebuffer)) _func)(target, framebuffer);
 }
 
-void APIENTRY shared_dispatch_stub_1273(GLsizei len, const GLvoid *string)
+void APIENTRY shared_dispatch_stub_1273(GLenum target, GLuint renderbuffer)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1273];
-   ((void (APIENTRY *)(GLsizei len, const GLvoid *string)) _func)(len, string);
+   ((void (APIENTRY *)(GLenum target, GLuint renderbuffer)) _func)(target, renderbuffer);
 }
 
-void APIENTRY shared_dispatch_stub_1274(GLenum target, GLenum pname, GLint param)
+void APIENTRY shared_dispatch_stub_1274(GLsizei len, const GLvoid *string)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1274];
-   ((void (APIENTRY *)(GLenum target, GLenum pname, GLint param)) _func)(target, pname, param);
+   ((void (APIENTRY *)(GLsizei len, const GLvoid *string)) _func)(len, string);
 }
 
-void APIENTRY shared_dispatch_stub_1275(GLenum target, GLintptr offset, GLsizeiptr size)
+void APIENTRY shared_dispatch_stub_1275(GLenum target, GLenum pname, GLint param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1275];
-   ((void (APIENTRY *)(GLenum target, GLintptr offset, GLsizeiptr size)) _func)(target, offset, size);
+   ((void (APIENTRY *)(GLenum target, GLenum pname, GLint param)) _func)(target, pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1276(GLuint index, GLint x)
+void APIENTRY shared_dispatch_stub_1276(GLenum target, GLintptr offset, GLsizeiptr size)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1276];
-   ((void (APIENTRY *)(GLuint index, GLint x)) _func)(index, x);
+   ((void (APIENTRY *)(GLenum target, GLintptr offset, GLsizeiptr size)) _func)(target, offset, size);
 }
 
-void APIENTRY shared_dispatch_stub_1277(GLuint index, GLuint x)
+void APIENTRY shared_dispatch_stub_1277(GLuint index, GLint x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1277];
-   ((void (APIENTRY *)(GLuint index, GLuint x)) _func)(index, x);
+   ((void (APIENTRY *)(GLuint index, GLint x)) _func)(index, x);
 }
 
-void APIENTRY shared_dispatch_stub_1278(GLuint index, GLint x, GLint y)
+void APIENTRY shared_dispatch_stub_1278(GLuint index, GLuint x)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1278];
-   ((void (APIENTRY *)(GLuint index, GLint x, GLint y)) _func)(index, x, y);
+   ((void (APIENTRY *)(GLuint index, GLuint x)) _func)(index, x);
 }
 
-void APIENTRY shared_dispatch_stub_1279(GLuint index, const GLint *v)
+void APIENTRY shared_dispatch_stub_1279(GLuint index, GLint x, GLint y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1279];
-   ((void (APIENTRY *)(GLuint index, const GLint *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLint x, GLint y)) _func)(index, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1280(GLuint index, GLuint x, GLuint y)
+void APIENTRY shared_dispatch_stub_1280(GLuint index, const GLint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1280];
-   ((void (APIENTRY *)(GLuint index, GLuint x, GLuint y)) _func)(index, x, y);
+   ((void (APIENTRY *)(GLuint index, const GLint *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1281(GLuint index, const GLuint *v)
+void APIENTRY shared_dispatch_stub_1281(GLuint index, GLuint x, GLuint y)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1281];
-   ((void (APIENTRY *)(GLuint index, const GLuint *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLuint x, GLuint y)) _func)(index, x, y);
 }
 
-void APIENTRY shared_dispatch_stub_1282(GLuint index, GLint x, GLint y, GLint z)
+void APIENTRY shared_dispatch_stub_1282(GLuint index, const GLuint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1282];
-   ((void (APIENTRY *)(GLuint index, GLint x, GLint y, GLint z)) _func)(index, x, y, z);
+   ((void (APIENTRY *)(GLuint index, const GLuint *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1283(GLuint index, const GLint *v)
+void APIENTRY shared_dispatch_stub_1283(GLuint index, GLint x, GLint y, GLint z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1283];
-   ((void (APIENTRY *)(GLuint index, const GLint *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLint x, GLint y, GLint z)) _func)(index, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1284(GLuint index, GLuint x, GLuint y, GLuint z)
+void APIENTRY shared_dispatch_stub_1284(GLuint index, const GLint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1284];
-   ((void (APIENTRY *)(GLuint index, GLuint x, GLuint y, GLuint z)) _func)(index, x, y, z);
+   ((void (APIENTRY *)(GLuint index, const GLint *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1285(GLuint index, const GLuint *v)
+void APIENTRY shared_dispatch_stub_1285(GLuint index, GLuint x, GLuint y, GLuint z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1285];
-   ((void (APIENTRY *)(GLuint index, const GLuint *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLuint x, GLuint y, GLuint z)) _func)(index, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1286(GLuint index, GLint x, GLint y, GLint z, GLint w)
+void APIENTRY shared_dispatch_stub_1286(GLuint index, const GLuint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1286];
-   ((void (APIENTRY *)(GLuint index, GLint x, GLint y, GLint z, GLint w)) _func)(index, x, y, z, w);
+   ((void (APIENTRY *)(GLuint index, const GLuint *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1287(GLuint index, const GLint *v)
+void APIENTRY shared_dispatch_stub_1287(GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1287];
-   ((void (APIENTRY *)(GLuint index, const GLint *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLint x, GLint y, GLint z, GLint w)) _func)(index, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1288(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+void APIENTRY shared_dispatch_stub_1288(GLuint index, const GLint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1288];
-   ((void (APIENTRY *)(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)) _func)(index, x, y, z, w);
+   ((void (APIENTRY *)(GLuint index, const GLint *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1289(GLuint index, const GLuint *v)
+void APIENTRY shared_dispatch_stub_1289(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1289];
-   ((void (APIENTRY *)(GLuint index, const GLuint *v)) _func)(index, v);
+   ((void (APIENTRY *)(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)) _func)(index, x, y, z, w);
 }
 
-void APIENTRY shared_dispatch_stub_1290(GLint r, GLint g, GLint b, GLint a)
+void APIENTRY shared_dispatch_stub_1290(GLuint index, const GLuint *v)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1290];
-   ((void (APIENTRY *)(GLint r, GLint g, GLint b, GLint a)) _func)(r, g, b, a);
+   ((void (APIENTRY *)(GLuint index, const GLuint *v)) _func)(index, v);
 }
 
-void APIENTRY shared_dispatch_stub_1291(GLuint r, GLuint g, GLuint b, GLuint a)
+void APIENTRY shared_dispatch_stub_1291(GLint r, GLint g, GLint b, GLint a)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1291];
-   ((void (APIENTRY *)(GLuint r, GLuint g, GLuint b, GLuint a)) _func)(r, g, b, a);
+   ((void (APIENTRY *)(GLint r, GLint g, GLint b, GLint a)) _func)(r, g, b, a);
 }
 
-void APIENTRY shared_dispatch_stub_1292(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+void APIENTRY shared_dispatch_stub_1292(GLuint r, GLuint g, GLuint b, GLuint a)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1292];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLuint buffer, GLintptr offset)) _func)(target, index, buffer, offset);
+   ((void (APIENTRY *)(GLuint r, GLuint g, GLuint b, GLuint a)) _func)(r, g, b, a);
 }
 
-void APIENTRY shared_dispatch_stub_1293(GLuint monitor)
+void APIENTRY shared_dispatch_stub_1293(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1293];
-   ((void (APIENTRY *)(GLuint monitor)) _func)(monitor);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLuint buffer, GLintptr offset)) _func)(target, index, buffer, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1294(GLsizei n, GLuint *monitors)
+void APIENTRY shared_dispatch_stub_1294(GLuint monitor)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1294];
-   ((void (APIENTRY *)(GLsizei n, GLuint *monitors)) _func)(n, monitors);
+   ((void (APIENTRY *)(GLuint monitor)) _func)(monitor);
 }
 
-void APIENTRY shared_dispatch_stub_1295(GLuint monitor)
+void APIENTRY shared_dispatch_stub_1295(GLsizei n, GLuint *monitors)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1295];
-   ((void (APIENTRY *)(GLuint monitor)) _func)(monitor);
+   ((void (APIENTRY *)(GLsizei n, GLuint *monitors)) _func)(n, monitors);
 }
 
-void APIENTRY shared_dispatch_stub_1296(GLsizei n, GLuint *monitors)
+void APIENTRY shared_dispatch_stub_1296(GLuint monitor)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1296];
-   ((void (APIENTRY *)(GLsizei n, GLuint *monitors)) _func)(n, monitors);
+   ((void (APIENTRY *)(GLuint monitor)) _func)(monitor);
 }
 
-void APIENTRY shared_dispatch_stub_1297(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten)
+void APIENTRY shared_dispatch_stub_1297(GLsizei n, GLuint *monitors)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1297];
-   ((void (APIENTRY *)(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten)) _func)(monitor, pname, dataSize, data, bytesWritten);
+   ((void (APIENTRY *)(GLsizei n, GLuint *monitors)) _func)(n, monitors);
 }
 
-void APIENTRY shared_dispatch_stub_1298(GLuint group, GLuint counter, GLenum pname, GLvoid *data)
+void APIENTRY shared_dispatch_stub_1298(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1298];
-   ((void (APIENTRY *)(GLuint group, GLuint counter, GLenum pname, GLvoid *data)) _func)(group, counter, pname, data);
+   ((void (APIENTRY *)(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten)) _func)(monitor, pname, dataSize, data, bytesWritten);
 }
 
-void APIENTRY shared_dispatch_stub_1299(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString)
+void APIENTRY shared_dispatch_stub_1299(GLuint group, GLuint counter, GLenum pname, GLvoid *data)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1299];
-   ((void (APIENTRY *)(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString)) _func)(group, counter, bufSize, length, counterString);
+   ((void (APIENTRY *)(GLuint group, GLuint counter, GLenum pname, GLvoid *data)) _func)(group, counter, pname, data);
 }
 
-void APIENTRY shared_dispatch_stub_1300(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters)
+void APIENTRY shared_dispatch_stub_1300(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1300];
-   ((void (APIENTRY *)(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters)) _func)(group, numCounters, maxActiveCounters, countersSize, counters);
+   ((void (APIENTRY *)(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString)) _func)(group, counter, bufSize, length, counterString);
 }
 
-void APIENTRY shared_dispatch_stub_1301(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString)
+void APIENTRY shared_dispatch_stub_1301(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1301];
-   ((void (APIENTRY *)(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString)) _func)(group, bufSize, length, groupString);
+   ((void (APIENTRY *)(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters)) _func)(group, numCounters, maxActiveCounters, countersSize, counters);
 }
 
-void APIENTRY shared_dispatch_stub_1302(GLint *numGroups, GLsizei groupsSize, GLuint *groups)
+void APIENTRY shared_dispatch_stub_1302(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1302];
-   ((void (APIENTRY *)(GLint *numGroups, GLsizei groupsSize, GLuint *groups)) _func)(numGroups, groupsSize, groups);
+   ((void (APIENTRY *)(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString)) _func)(group, bufSize, length, groupString);
 }
 
-void APIENTRY shared_dispatch_stub_1303(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList)
+void APIENTRY shared_dispatch_stub_1303(GLint *numGroups, GLsizei groupsSize, GLuint *groups)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1303];
-   ((void (APIENTRY *)(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList)) _func)(monitor, enable, group, numCounters, counterList);
+   ((void (APIENTRY *)(GLint *numGroups, GLsizei groupsSize, GLuint *groups)) _func)(numGroups, groupsSize, groups);
 }
 
-void APIENTRY shared_dispatch_stub_1304(GLenum objectType, GLuint name, GLenum pname, GLint *value)
+void APIENTRY shared_dispatch_stub_1304(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1304];
-   ((void (APIENTRY *)(GLenum objectType, GLuint name, GLenum pname, GLint *value)) _func)(objectType, name, pname, value);
+   ((void (APIENTRY *)(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList)) _func)(monitor, enable, group, numCounters, counterList);
 }
 
-GLenum APIENTRY shared_dispatch_stub_1305(GLenum objectType, GLuint name, GLenum option)
+void APIENTRY shared_dispatch_stub_1305(GLenum objectType, GLuint name, GLenum pname, GLint *value)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1305];
-   return ((GLenum (APIENTRY *)(GLenum objectType, GLuint name, GLenum option)) _func)(objectType, name, option);
+   ((void (APIENTRY *)(GLenum objectType, GLuint name, GLenum pname, GLint *value)) _func)(objectType, name, pname, value);
 }
 
 GLenum APIENTRY shared_dispatch_stub_1306(GLenum objectType, GLuint name, GLenum option)
@@ -26474,32 +26485,32 @@ GLenum APIENTRY shared_dispatch_stub_1306(GLenum objectType, GLuint name, GLenum
    return ((GLenum (APIENTRY *)(GLenum objectType, GLuint name, GLenum option)) _func)(objectType, name, option);
 }
 
-void APIENTRY shared_dispatch_stub_1307(GLuint program)
+GLenum APIENTRY shared_dispatch_stub_1307(GLenum objectType, GLuint name, GLenum option)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1307];
-   ((void (APIENTRY *)(GLuint program)) _func)(program);
+   return ((GLenum (APIENTRY *)(GLenum objectType, GLuint name, GLenum option)) _func)(objectType, name, option);
 }
 
-GLuint APIENTRY shared_dispatch_stub_1308(GLenum type, const GLchar *string)
+void APIENTRY shared_dispatch_stub_1308(GLuint program)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1308];
-   return ((GLuint (APIENTRY *)(GLenum type, const GLchar *string)) _func)(type, string);
+   ((void (APIENTRY *)(GLuint program)) _func)(program);
 }
 
-void APIENTRY shared_dispatch_stub_1309(GLenum type, GLuint program)
+GLuint APIENTRY shared_dispatch_stub_1309(GLenum type, const GLchar *string)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1309];
-   ((void (APIENTRY *)(GLenum type, GLuint program)) _func)(type, program);
+   return ((GLuint (APIENTRY *)(GLenum type, const GLchar *string)) _func)(type, string);
 }
 
-void APIENTRY shared_dispatch_stub_1310(void)
+void APIENTRY shared_dispatch_stub_1310(GLenum type, GLuint program)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1310];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(GLenum type, GLuint program)) _func)(type, program);
 }
 
 void APIENTRY shared_dispatch_stub_1311(void)
@@ -26509,39 +26520,39 @@ void APIENTRY shared_dispatch_stub_1311(void)
    ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1312(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+void APIENTRY shared_dispatch_stub_1312(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1312];
-   ((void (APIENTRY *)(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)) _func)(surface, pname, bufSize, length, values);
+   ((void (APIENTRY *)(void)) _func)();
 }
 
-void APIENTRY shared_dispatch_stub_1313(const GLvoid *vdpDevice, const GLvoid *getProcAddress)
+void APIENTRY shared_dispatch_stub_1313(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1313];
-   ((void (APIENTRY *)(const GLvoid *vdpDevice, const GLvoid *getProcAddress)) _func)(vdpDevice, getProcAddress);
+   ((void (APIENTRY *)(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)) _func)(surface, pname, bufSize, length, values);
 }
 
-GLboolean APIENTRY shared_dispatch_stub_1314(GLintptr surface)
+void APIENTRY shared_dispatch_stub_1314(const GLvoid *vdpDevice, const GLvoid *getProcAddress)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1314];
-   return ((GLboolean (APIENTRY *)(GLintptr surface)) _func)(surface);
+   ((void (APIENTRY *)(const GLvoid *vdpDevice, const GLvoid *getProcAddress)) _func)(vdpDevice, getProcAddress);
 }
 
-void APIENTRY shared_dispatch_stub_1315(GLsizei numSurfaces, const GLintptr *surfaces)
+GLboolean APIENTRY shared_dispatch_stub_1315(GLintptr surface)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1315];
-   ((void (APIENTRY *)(GLsizei numSurfaces, const GLintptr *surfaces)) _func)(numSurfaces, surfaces);
+   return ((GLboolean (APIENTRY *)(GLintptr surface)) _func)(surface);
 }
 
-GLintptr APIENTRY shared_dispatch_stub_1316(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)
+void APIENTRY shared_dispatch_stub_1316(GLsizei numSurfaces, const GLintptr *surfaces)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1316];
-   return ((GLintptr (APIENTRY *)(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)) _func)(vdpSurface, target, numTextureNames, textureNames);
+   ((void (APIENTRY *)(GLsizei numSurfaces, const GLintptr *surfaces)) _func)(numSurfaces, surfaces);
 }
 
 GLintptr APIENTRY shared_dispatch_stub_1317(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)
@@ -26551,46 +26562,46 @@ GLintptr APIENTRY shared_dispatch_stub_1317(const GLvoid *vdpSurface, GLenum tar
    return ((GLintptr (APIENTRY *)(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)) _func)(vdpSurface, target, numTextureNames, textureNames);
 }
 
-void APIENTRY shared_dispatch_stub_1318(GLintptr surface, GLenum access)
+GLintptr APIENTRY shared_dispatch_stub_1318(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1318];
-   ((void (APIENTRY *)(GLintptr surface, GLenum access)) _func)(surface, access);
+   return ((GLintptr (APIENTRY *)(const GLvoid *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)) _func)(vdpSurface, target, numTextureNames, textureNames);
 }
 
-void APIENTRY shared_dispatch_stub_1319(GLsizei numSurfaces, const GLintptr *surfaces)
+void APIENTRY shared_dispatch_stub_1319(GLintptr surface, GLenum access)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1319];
-   ((void (APIENTRY *)(GLsizei numSurfaces, const GLintptr *surfaces)) _func)(numSurfaces, surfaces);
+   ((void (APIENTRY *)(GLintptr surface, GLenum access)) _func)(surface, access);
 }
 
-void APIENTRY shared_dispatch_stub_1320(GLintptr surface)
+void APIENTRY shared_dispatch_stub_1320(GLsizei numSurfaces, const GLintptr *surfaces)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1320];
-   ((void (APIENTRY *)(GLintptr surface)) _func)(surface);
+   ((void (APIENTRY *)(GLsizei numSurfaces, const GLintptr *surfaces)) _func)(numSurfaces, surfaces);
 }
 
-void APIENTRY shared_dispatch_stub_1321(GLuint queryHandle)
+void APIENTRY shared_dispatch_stub_1321(GLintptr surface)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1321];
-   ((void (APIENTRY *)(GLuint queryHandle)) _func)(queryHandle);
+   ((void (APIENTRY *)(GLintptr surface)) _func)(surface);
 }
 
-void APIENTRY shared_dispatch_stub_1322(GLuint queryId, GLuint *queryHandle)
+void APIENTRY shared_dispatch_stub_1322(GLuint queryHandle)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1322];
-   ((void (APIENTRY *)(GLuint queryId, GLuint *queryHandle)) _func)(queryId, queryHandle);
+   ((void (APIENTRY *)(GLuint queryHandle)) _func)(queryHandle);
 }
 
-void APIENTRY shared_dispatch_stub_1323(GLuint queryHandle)
+void APIENTRY shared_dispatch_stub_1323(GLuint queryId, GLuint *queryHandle)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1323];
-   ((void (APIENTRY *)(GLuint queryHandle)) _func)(queryHandle);
+   ((void (APIENTRY *)(GLuint queryId, GLuint *queryHandle)) _func)(queryId, queryHandle);
 }
 
 void APIENTRY shared_dispatch_stub_1324(GLuint queryHandle)
@@ -26600,270 +26611,270 @@ void APIENTRY shared_dispatch_stub_1324(GLuint queryHandle)
    ((void (APIENTRY *)(GLuint queryHandle)) _func)(queryHandle);
 }
 
-void APIENTRY shared_dispatch_stub_1325(GLuint *queryId)
+void APIENTRY shared_dispatch_stub_1325(GLuint queryHandle)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1325];
-   ((void (APIENTRY *)(GLuint *queryId)) _func)(queryId);
+   ((void (APIENTRY *)(GLuint queryHandle)) _func)(queryHandle);
 }
 
-void APIENTRY shared_dispatch_stub_1326(GLuint queryId, GLuint *nextQueryId)
+void APIENTRY shared_dispatch_stub_1326(GLuint *queryId)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1326];
-   ((void (APIENTRY *)(GLuint queryId, GLuint *nextQueryId)) _func)(queryId, nextQueryId);
+   ((void (APIENTRY *)(GLuint *queryId)) _func)(queryId);
 }
 
-void APIENTRY shared_dispatch_stub_1327(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue)
+void APIENTRY shared_dispatch_stub_1327(GLuint queryId, GLuint *nextQueryId)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1327];
-   ((void (APIENTRY *)(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue)) _func)(queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue);
+   ((void (APIENTRY *)(GLuint queryId, GLuint *nextQueryId)) _func)(queryId, nextQueryId);
 }
 
-void APIENTRY shared_dispatch_stub_1328(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten)
+void APIENTRY shared_dispatch_stub_1328(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1328];
-   ((void (APIENTRY *)(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten)) _func)(queryHandle, flags, dataSize, data, bytesWritten);
+   ((void (APIENTRY *)(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue)) _func)(queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue);
 }
 
-void APIENTRY shared_dispatch_stub_1329(GLchar *queryName, GLuint *queryId)
+void APIENTRY shared_dispatch_stub_1329(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1329];
-   ((void (APIENTRY *)(GLchar *queryName, GLuint *queryId)) _func)(queryName, queryId);
+   ((void (APIENTRY *)(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten)) _func)(queryHandle, flags, dataSize, data, bytesWritten);
 }
 
-void APIENTRY shared_dispatch_stub_1330(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask)
+void APIENTRY shared_dispatch_stub_1330(GLchar *queryName, GLuint *queryId)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1330];
-   ((void (APIENTRY *)(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask)) _func)(queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask);
+   ((void (APIENTRY *)(GLchar *queryName, GLuint *queryId)) _func)(queryName, queryId);
 }
 
-void APIENTRY shared_dispatch_stub_1331(GLfloat factor, GLfloat units, GLfloat clamp)
+void APIENTRY shared_dispatch_stub_1331(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1331];
-   ((void (APIENTRY *)(GLfloat factor, GLfloat units, GLfloat clamp)) _func)(factor, units, clamp);
+   ((void (APIENTRY *)(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask)) _func)(queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask);
 }
 
-void APIENTRY shared_dispatch_stub_1332(GLenum mode, GLsizei count, const GLint *box)
+void APIENTRY shared_dispatch_stub_1332(GLfloat factor, GLfloat units, GLfloat clamp)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1332];
-   ((void (APIENTRY *)(GLenum mode, GLsizei count, const GLint *box)) _func)(mode, count, box);
+   ((void (APIENTRY *)(GLfloat factor, GLfloat units, GLfloat clamp)) _func)(factor, units, clamp);
 }
 
-void APIENTRY shared_dispatch_stub_1333(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1333(GLenum mode, GLsizei count, const GLint *box)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1333];
-   ((void (APIENTRY *)(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)) _func)(target, size, memory, offset);
+   ((void (APIENTRY *)(GLenum mode, GLsizei count, const GLint *box)) _func)(mode, count, box);
 }
 
-void APIENTRY shared_dispatch_stub_1334(GLsizei n, GLuint *memoryObjects)
+void APIENTRY shared_dispatch_stub_1334(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1334];
-   ((void (APIENTRY *)(GLsizei n, GLuint *memoryObjects)) _func)(n, memoryObjects);
+   ((void (APIENTRY *)(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset)) _func)(target, size, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1335(GLsizei n, const GLuint *memoryObjects)
+void APIENTRY shared_dispatch_stub_1335(GLsizei n, GLuint *memoryObjects)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1335];
-   ((void (APIENTRY *)(GLsizei n, const GLuint *memoryObjects)) _func)(n, memoryObjects);
+   ((void (APIENTRY *)(GLsizei n, GLuint *memoryObjects)) _func)(n, memoryObjects);
 }
 
-void APIENTRY shared_dispatch_stub_1336(GLsizei n, const GLuint *semaphores)
+void APIENTRY shared_dispatch_stub_1336(GLsizei n, const GLuint *memoryObjects)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1336];
-   ((void (APIENTRY *)(GLsizei n, const GLuint *semaphores)) _func)(n, semaphores);
+   ((void (APIENTRY *)(GLsizei n, const GLuint *memoryObjects)) _func)(n, memoryObjects);
 }
 
-void APIENTRY shared_dispatch_stub_1337(GLsizei n, GLuint *semaphores)
+void APIENTRY shared_dispatch_stub_1337(GLsizei n, const GLuint *semaphores)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1337];
-   ((void (APIENTRY *)(GLsizei n, GLuint *semaphores)) _func)(n, semaphores);
+   ((void (APIENTRY *)(GLsizei n, const GLuint *semaphores)) _func)(n, semaphores);
 }
 
-void APIENTRY shared_dispatch_stub_1338(GLuint memoryObject, GLenum pname, GLint *params)
+void APIENTRY shared_dispatch_stub_1338(GLsizei n, GLuint *semaphores)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1338];
-   ((void (APIENTRY *)(GLuint memoryObject, GLenum pname, GLint *params)) _func)(memoryObject, pname, params);
+   ((void (APIENTRY *)(GLsizei n, GLuint *semaphores)) _func)(n, semaphores);
 }
 
-void APIENTRY shared_dispatch_stub_1339(GLuint semaphore, GLenum pname, GLuint64 *params)
+void APIENTRY shared_dispatch_stub_1339(GLuint memoryObject, GLenum pname, GLint *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1339];
-   ((void (APIENTRY *)(GLuint semaphore, GLenum pname, GLuint64 *params)) _func)(semaphore, pname, params);
+   ((void (APIENTRY *)(GLuint memoryObject, GLenum pname, GLint *params)) _func)(memoryObject, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1340(GLenum target, GLuint index, GLubyte *data)
+void APIENTRY shared_dispatch_stub_1340(GLuint semaphore, GLenum pname, GLuint64 *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1340];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLubyte *data)) _func)(target, index, data);
+   ((void (APIENTRY *)(GLuint semaphore, GLenum pname, GLuint64 *params)) _func)(semaphore, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1341(GLenum pname, GLubyte *data)
+void APIENTRY shared_dispatch_stub_1341(GLenum target, GLuint index, GLubyte *data)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1341];
-   ((void (APIENTRY *)(GLenum pname, GLubyte *data)) _func)(pname, data);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLubyte *data)) _func)(target, index, data);
 }
 
-GLboolean APIENTRY shared_dispatch_stub_1342(GLuint memoryObject)
+void APIENTRY shared_dispatch_stub_1342(GLenum pname, GLubyte *data)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1342];
-   return ((GLboolean (APIENTRY *)(GLuint memoryObject)) _func)(memoryObject);
+   ((void (APIENTRY *)(GLenum pname, GLubyte *data)) _func)(pname, data);
 }
 
-GLboolean APIENTRY shared_dispatch_stub_1343(GLuint semaphore)
+GLboolean APIENTRY shared_dispatch_stub_1343(GLuint memoryObject)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1343];
-   return ((GLboolean (APIENTRY *)(GLuint semaphore)) _func)(semaphore);
+   return ((GLboolean (APIENTRY *)(GLuint memoryObject)) _func)(memoryObject);
 }
 
-void APIENTRY shared_dispatch_stub_1344(GLuint memoryObject, GLenum pname, const GLint *params)
+GLboolean APIENTRY shared_dispatch_stub_1344(GLuint semaphore)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1344];
-   ((void (APIENTRY *)(GLuint memoryObject, GLenum pname, const GLint *params)) _func)(memoryObject, pname, params);
+   return ((GLboolean (APIENTRY *)(GLuint semaphore)) _func)(semaphore);
 }
 
-void APIENTRY shared_dispatch_stub_1345(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1345(GLuint memoryObject, GLenum pname, const GLint *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1345];
-   ((void (APIENTRY *)(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)) _func)(buffer, size, memory, offset);
+   ((void (APIENTRY *)(GLuint memoryObject, GLenum pname, const GLint *params)) _func)(memoryObject, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1346(GLuint semaphore, GLenum pname, const GLuint64 *params)
+void APIENTRY shared_dispatch_stub_1346(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1346];
-   ((void (APIENTRY *)(GLuint semaphore, GLenum pname, const GLuint64 *params)) _func)(semaphore, pname, params);
+   ((void (APIENTRY *)(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset)) _func)(buffer, size, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1347(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts)
+void APIENTRY shared_dispatch_stub_1347(GLuint semaphore, GLenum pname, const GLuint64 *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1347];
-   ((void (APIENTRY *)(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts)) _func)(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts);
+   ((void (APIENTRY *)(GLuint semaphore, GLenum pname, const GLuint64 *params)) _func)(semaphore, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1348(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1348(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1348];
-   ((void (APIENTRY *)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)) _func)(target, levels, internalFormat, width, memory, offset);
+   ((void (APIENTRY *)(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts)) _func)(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts);
 }
 
-void APIENTRY shared_dispatch_stub_1349(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1349(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1349];
-   ((void (APIENTRY *)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)) _func)(target, levels, internalFormat, width, height, memory, offset);
+   ((void (APIENTRY *)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)) _func)(target, levels, internalFormat, width, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1350(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1350(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1350];
-   ((void (APIENTRY *)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
+   ((void (APIENTRY *)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)) _func)(target, levels, internalFormat, width, height, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1351(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1351(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1351];
-   ((void (APIENTRY *)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)) _func)(target, levels, internalFormat, width, height, depth, memory, offset);
+   ((void (APIENTRY *)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1352(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1352(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1352];
-   ((void (APIENTRY *)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
+   ((void (APIENTRY *)(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)) _func)(target, levels, internalFormat, width, height, depth, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1353(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1353(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1353];
-   ((void (APIENTRY *)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)) _func)(texture, levels, internalFormat, width, memory, offset);
+   ((void (APIENTRY *)(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1354(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1354(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1354];
-   ((void (APIENTRY *)(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)) _func)(texture, levels, internalFormat, width, height, memory, offset);
+   ((void (APIENTRY *)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset)) _func)(texture, levels, internalFormat, width, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1355(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1355(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1355];
-   ((void (APIENTRY *)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
+   ((void (APIENTRY *)(GLenum texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset)) _func)(texture, levels, internalFormat, width, height, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1356(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1356(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1356];
-   ((void (APIENTRY *)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)) _func)(texture, levels, internalFormat, width, height, depth, memory, offset);
+   ((void (APIENTRY *)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1357(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
+void APIENTRY shared_dispatch_stub_1357(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1357];
-   ((void (APIENTRY *)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
+   ((void (APIENTRY *)(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset)) _func)(texture, levels, internalFormat, width, height, depth, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1358(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts)
+void APIENTRY shared_dispatch_stub_1358(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1358];
-   ((void (APIENTRY *)(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts)) _func)(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts);
+   ((void (APIENTRY *)(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset)) _func)(texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
 }
 
-void APIENTRY shared_dispatch_stub_1359(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)
+void APIENTRY shared_dispatch_stub_1359(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1359];
-   ((void (APIENTRY *)(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)) _func)(memory, size, handleType, fd);
+   ((void (APIENTRY *)(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts)) _func)(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts);
 }
 
-void APIENTRY shared_dispatch_stub_1360(GLuint semaphore, GLenum handleType, GLint fd)
+void APIENTRY shared_dispatch_stub_1360(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1360];
-   ((void (APIENTRY *)(GLuint semaphore, GLenum handleType, GLint fd)) _func)(semaphore, handleType, fd);
+   ((void (APIENTRY *)(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)) _func)(memory, size, handleType, fd);
 }
 
-void APIENTRY shared_dispatch_stub_1361(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
+void APIENTRY shared_dispatch_stub_1361(GLuint semaphore, GLenum handleType, GLint fd)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1361];
-   ((void (APIENTRY *)(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)) _func)(frontfunc, backfunc, ref, mask);
+   ((void (APIENTRY *)(GLuint semaphore, GLenum handleType, GLint fd)) _func)(semaphore, handleType, fd);
 }
 
-void APIENTRY shared_dispatch_stub_1362(GLenum target, GLuint index, GLsizei count, const GLfloat *params)
+void APIENTRY shared_dispatch_stub_1362(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1362];
-   ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei count, const GLfloat *params)) _func)(target, index, count, params);
+   ((void (APIENTRY *)(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)) _func)(frontfunc, backfunc, ref, mask);
 }
 
 void APIENTRY shared_dispatch_stub_1363(GLenum target, GLuint index, GLsizei count, const GLfloat *params)
@@ -26873,11 +26884,11 @@ void APIENTRY shared_dispatch_stub_1363(GLenum target, GLuint index, GLsizei cou
    ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei count, const GLfloat *params)) _func)(target, index, count, params);
 }
 
-void APIENTRY shared_dispatch_stub_1364(GLenum target, GLvoid *writeOffset)
+void APIENTRY shared_dispatch_stub_1364(GLenum target, GLuint index, GLsizei count, const GLfloat *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1364];
-   ((void (APIENTRY *)(GLenum target, GLvoid *writeOffset)) _func)(target, writeOffset);
+   ((void (APIENTRY *)(GLenum target, GLuint index, GLsizei count, const GLfloat *params)) _func)(target, index, count, params);
 }
 
 void APIENTRY shared_dispatch_stub_1365(GLenum target, GLvoid *writeOffset)
@@ -26887,277 +26898,277 @@ void APIENTRY shared_dispatch_stub_1365(GLenum target, GLvoid *writeOffset)
    ((void (APIENTRY *)(GLenum target, GLvoid *writeOffset)) _func)(target, writeOffset);
 }
 
-void APIENTRY shared_dispatch_stub_1366(GLenum func, GLclampx ref)
+void APIENTRY shared_dispatch_stub_1366(GLenum target, GLvoid *writeOffset)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1366];
-   ((void (APIENTRY *)(GLenum func, GLclampx ref)) _func)(func, ref);
+   ((void (APIENTRY *)(GLenum target, GLvoid *writeOffset)) _func)(target, writeOffset);
 }
 
-void APIENTRY shared_dispatch_stub_1367(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)
+void APIENTRY shared_dispatch_stub_1367(GLenum func, GLclampx ref)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1367];
-   ((void (APIENTRY *)(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)) _func)(red, green, blue, alpha);
+   ((void (APIENTRY *)(GLenum func, GLclampx ref)) _func)(func, ref);
 }
 
-void APIENTRY shared_dispatch_stub_1368(GLclampx depth)
+void APIENTRY shared_dispatch_stub_1368(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1368];
-   ((void (APIENTRY *)(GLclampx depth)) _func)(depth);
+   ((void (APIENTRY *)(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)) _func)(red, green, blue, alpha);
 }
 
-void APIENTRY shared_dispatch_stub_1369(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+void APIENTRY shared_dispatch_stub_1369(GLclampx depth)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1369];
-   ((void (APIENTRY *)(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)) _func)(red, green, blue, alpha);
+   ((void (APIENTRY *)(GLclampx depth)) _func)(depth);
 }
 
-void APIENTRY shared_dispatch_stub_1370(GLclampx zNear, GLclampx zFar)
+void APIENTRY shared_dispatch_stub_1370(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1370];
-   ((void (APIENTRY *)(GLclampx zNear, GLclampx zFar)) _func)(zNear, zFar);
+   ((void (APIENTRY *)(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)) _func)(red, green, blue, alpha);
 }
 
-void APIENTRY shared_dispatch_stub_1371(GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1371(GLclampx zNear, GLclampx zFar)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1371];
-   ((void (APIENTRY *)(GLenum pname, GLfixed param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLclampx zNear, GLclampx zFar)) _func)(zNear, zFar);
 }
 
-void APIENTRY shared_dispatch_stub_1372(GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1372(GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1372];
-   ((void (APIENTRY *)(GLenum pname, const GLfixed *params)) _func)(pname, params);
+   ((void (APIENTRY *)(GLenum pname, GLfixed param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1373(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+void APIENTRY shared_dispatch_stub_1373(GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1373];
-   ((void (APIENTRY *)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)) _func)(left, right, bottom, top, zNear, zFar);
+   ((void (APIENTRY *)(GLenum pname, const GLfixed *params)) _func)(pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1374(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+void APIENTRY shared_dispatch_stub_1374(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1374];
-   ((void (APIENTRY *)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)) _func)(left, right, bottom, top, zNear, zFar);
+   ((void (APIENTRY *)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)) _func)(left, right, bottom, top, zNear, zFar);
 }
 
-void APIENTRY shared_dispatch_stub_1375(GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1375(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1375];
-   ((void (APIENTRY *)(GLenum pname, GLfixed param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)) _func)(left, right, bottom, top, zNear, zFar);
 }
 
-void APIENTRY shared_dispatch_stub_1376(GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1376(GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1376];
-   ((void (APIENTRY *)(GLenum pname, const GLfixed *params)) _func)(pname, params);
+   ((void (APIENTRY *)(GLenum pname, GLfixed param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1377(GLenum light, GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1377(GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1377];
-   ((void (APIENTRY *)(GLenum light, GLenum pname, GLfixed param)) _func)(light, pname, param);
+   ((void (APIENTRY *)(GLenum pname, const GLfixed *params)) _func)(pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1378(GLenum light, GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1378(GLenum light, GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1378];
-   ((void (APIENTRY *)(GLenum light, GLenum pname, const GLfixed *params)) _func)(light, pname, params);
+   ((void (APIENTRY *)(GLenum light, GLenum pname, GLfixed param)) _func)(light, pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1379(GLfixed width)
+void APIENTRY shared_dispatch_stub_1379(GLenum light, GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1379];
-   ((void (APIENTRY *)(GLfixed width)) _func)(width);
+   ((void (APIENTRY *)(GLenum light, GLenum pname, const GLfixed *params)) _func)(light, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1380(const GLfixed *m)
+void APIENTRY shared_dispatch_stub_1380(GLfixed width)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1380];
-   ((void (APIENTRY *)(const GLfixed *m)) _func)(m);
+   ((void (APIENTRY *)(GLfixed width)) _func)(width);
 }
 
-void APIENTRY shared_dispatch_stub_1381(GLenum face, GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1381(const GLfixed *m)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1381];
-   ((void (APIENTRY *)(GLenum face, GLenum pname, GLfixed param)) _func)(face, pname, param);
+   ((void (APIENTRY *)(const GLfixed *m)) _func)(m);
 }
 
-void APIENTRY shared_dispatch_stub_1382(GLenum face, GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1382(GLenum face, GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1382];
-   ((void (APIENTRY *)(GLenum face, GLenum pname, const GLfixed *params)) _func)(face, pname, params);
+   ((void (APIENTRY *)(GLenum face, GLenum pname, GLfixed param)) _func)(face, pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1383(const GLfixed *m)
+void APIENTRY shared_dispatch_stub_1383(GLenum face, GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1383];
-   ((void (APIENTRY *)(const GLfixed *m)) _func)(m);
+   ((void (APIENTRY *)(GLenum face, GLenum pname, const GLfixed *params)) _func)(face, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1384(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+void APIENTRY shared_dispatch_stub_1384(const GLfixed *m)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1384];
-   ((void (APIENTRY *)(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)) _func)(target, s, t, r, q);
+   ((void (APIENTRY *)(const GLfixed *m)) _func)(m);
 }
 
-void APIENTRY shared_dispatch_stub_1385(GLfixed nx, GLfixed ny, GLfixed nz)
+void APIENTRY shared_dispatch_stub_1385(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1385];
-   ((void (APIENTRY *)(GLfixed nx, GLfixed ny, GLfixed nz)) _func)(nx, ny, nz);
+   ((void (APIENTRY *)(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)) _func)(target, s, t, r, q);
 }
 
-void APIENTRY shared_dispatch_stub_1386(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+void APIENTRY shared_dispatch_stub_1386(GLfixed nx, GLfixed ny, GLfixed nz)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1386];
-   ((void (APIENTRY *)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)) _func)(left, right, bottom, top, zNear, zFar);
+   ((void (APIENTRY *)(GLfixed nx, GLfixed ny, GLfixed nz)) _func)(nx, ny, nz);
 }
 
-void APIENTRY shared_dispatch_stub_1387(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+void APIENTRY shared_dispatch_stub_1387(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1387];
-   ((void (APIENTRY *)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)) _func)(left, right, bottom, top, zNear, zFar);
+   ((void (APIENTRY *)(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)) _func)(left, right, bottom, top, zNear, zFar);
 }
 
-void APIENTRY shared_dispatch_stub_1388(GLfixed size)
+void APIENTRY shared_dispatch_stub_1388(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1388];
-   ((void (APIENTRY *)(GLfixed size)) _func)(size);
+   ((void (APIENTRY *)(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)) _func)(left, right, bottom, top, zNear, zFar);
 }
 
-void APIENTRY shared_dispatch_stub_1389(GLfixed factor, GLfixed units)
+void APIENTRY shared_dispatch_stub_1389(GLfixed size)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1389];
-   ((void (APIENTRY *)(GLfixed factor, GLfixed units)) _func)(factor, units);
+   ((void (APIENTRY *)(GLfixed size)) _func)(size);
 }
 
-void APIENTRY shared_dispatch_stub_1390(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+void APIENTRY shared_dispatch_stub_1390(GLfixed factor, GLfixed units)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1390];
-   ((void (APIENTRY *)(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)) _func)(angle, x, y, z);
+   ((void (APIENTRY *)(GLfixed factor, GLfixed units)) _func)(factor, units);
 }
 
-void APIENTRY shared_dispatch_stub_1391(GLclampx value, GLboolean invert)
+void APIENTRY shared_dispatch_stub_1391(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1391];
-   ((void (APIENTRY *)(GLclampx value, GLboolean invert)) _func)(value, invert);
+   ((void (APIENTRY *)(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)) _func)(angle, x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1392(GLfixed x, GLfixed y, GLfixed z)
+void APIENTRY shared_dispatch_stub_1392(GLclampx value, GLboolean invert)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1392];
-   ((void (APIENTRY *)(GLfixed x, GLfixed y, GLfixed z)) _func)(x, y, z);
+   ((void (APIENTRY *)(GLclampx value, GLboolean invert)) _func)(value, invert);
 }
 
-void APIENTRY shared_dispatch_stub_1393(GLenum target, GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1393(GLfixed x, GLfixed y, GLfixed z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1393];
-   ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed param)) _func)(target, pname, param);
+   ((void (APIENTRY *)(GLfixed x, GLfixed y, GLfixed z)) _func)(x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1394(GLenum target, GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1394(GLenum target, GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1394];
-   ((void (APIENTRY *)(GLenum target, GLenum pname, const GLfixed *params)) _func)(target, pname, params);
+   ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed param)) _func)(target, pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1395(GLenum target, GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1395(GLenum target, GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1395];
-   ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed param)) _func)(target, pname, param);
+   ((void (APIENTRY *)(GLenum target, GLenum pname, const GLfixed *params)) _func)(target, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1396(GLfixed x, GLfixed y, GLfixed z)
+void APIENTRY shared_dispatch_stub_1396(GLenum target, GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1396];
-   ((void (APIENTRY *)(GLfixed x, GLfixed y, GLfixed z)) _func)(x, y, z);
+   ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed param)) _func)(target, pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1397(GLenum plane, const GLfloat *equation)
+void APIENTRY shared_dispatch_stub_1397(GLfixed x, GLfixed y, GLfixed z)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1397];
-   ((void (APIENTRY *)(GLenum plane, const GLfloat *equation)) _func)(plane, equation);
+   ((void (APIENTRY *)(GLfixed x, GLfixed y, GLfixed z)) _func)(x, y, z);
 }
 
-void APIENTRY shared_dispatch_stub_1398(GLenum plane, const GLfixed *equation)
+void APIENTRY shared_dispatch_stub_1398(GLenum plane, const GLfloat *equation)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1398];
-   ((void (APIENTRY *)(GLenum plane, const GLfixed *equation)) _func)(plane, equation);
+   ((void (APIENTRY *)(GLenum plane, const GLfloat *equation)) _func)(plane, equation);
 }
 
-void APIENTRY shared_dispatch_stub_1399(GLenum plane, GLfloat *equation)
+void APIENTRY shared_dispatch_stub_1399(GLenum plane, const GLfixed *equation)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1399];
-   ((void (APIENTRY *)(GLenum plane, GLfloat *equation)) _func)(plane, equation);
+   ((void (APIENTRY *)(GLenum plane, const GLfixed *equation)) _func)(plane, equation);
 }
 
-void APIENTRY shared_dispatch_stub_1400(GLenum plane, GLfixed *equation)
+void APIENTRY shared_dispatch_stub_1400(GLenum plane, GLfloat *equation)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1400];
-   ((void (APIENTRY *)(GLenum plane, GLfixed *equation)) _func)(plane, equation);
+   ((void (APIENTRY *)(GLenum plane, GLfloat *equation)) _func)(plane, equation);
 }
 
-void APIENTRY shared_dispatch_stub_1401(GLenum pname, GLfixed *params)
+void APIENTRY shared_dispatch_stub_1401(GLenum plane, GLfixed *equation)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1401];
-   ((void (APIENTRY *)(GLenum pname, GLfixed *params)) _func)(pname, params);
+   ((void (APIENTRY *)(GLenum plane, GLfixed *equation)) _func)(plane, equation);
 }
 
-void APIENTRY shared_dispatch_stub_1402(GLenum light, GLenum pname, GLfixed *params)
+void APIENTRY shared_dispatch_stub_1402(GLenum pname, GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1402];
-   ((void (APIENTRY *)(GLenum light, GLenum pname, GLfixed *params)) _func)(light, pname, params);
+   ((void (APIENTRY *)(GLenum pname, GLfixed *params)) _func)(pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1403(GLenum face, GLenum pname, GLfixed *params)
+void APIENTRY shared_dispatch_stub_1403(GLenum light, GLenum pname, GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1403];
-   ((void (APIENTRY *)(GLenum face, GLenum pname, GLfixed *params)) _func)(face, pname, params);
+   ((void (APIENTRY *)(GLenum light, GLenum pname, GLfixed *params)) _func)(light, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1404(GLenum target, GLenum pname, GLfixed *params)
+void APIENTRY shared_dispatch_stub_1404(GLenum face, GLenum pname, GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1404];
-   ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed *params)) _func)(target, pname, params);
+   ((void (APIENTRY *)(GLenum face, GLenum pname, GLfixed *params)) _func)(face, pname, params);
 }
 
 void APIENTRY shared_dispatch_stub_1405(GLenum target, GLenum pname, GLfixed *params)
@@ -27167,38 +27178,45 @@ void APIENTRY shared_dispatch_stub_1405(GLenum target, GLenum pname, GLfixed *pa
    ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed *params)) _func)(target, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1406(GLenum pname, GLfixed param)
+void APIENTRY shared_dispatch_stub_1406(GLenum target, GLenum pname, GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1406];
-   ((void (APIENTRY *)(GLenum pname, GLfixed param)) _func)(pname, param);
+   ((void (APIENTRY *)(GLenum target, GLenum pname, GLfixed *params)) _func)(target, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1407(GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1407(GLenum pname, GLfixed param)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1407];
-   ((void (APIENTRY *)(GLenum pname, const GLfixed *params)) _func)(pname, params);
+   ((void (APIENTRY *)(GLenum pname, GLfixed param)) _func)(pname, param);
 }
 
-void APIENTRY shared_dispatch_stub_1408(GLenum target, GLenum pname, const GLfixed *params)
+void APIENTRY shared_dispatch_stub_1408(GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1408];
-   ((void (APIENTRY *)(GLenum target, GLenum pname, const GLfixed *params)) _func)(target, pname, params);
+   ((void (APIENTRY *)(GLenum pname, const GLfixed *params)) _func)(pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1409(void)
+void APIENTRY shared_dispatch_stub_1409(GLenum target, GLenum pname, const GLfixed *params)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1409];
-   ((void (APIENTRY *)(void)) _func)();
+   ((void (APIENTRY *)(GLenum target, GLenum pname, const GLfixed *params)) _func)(target, pname, params);
 }
 
-void APIENTRY shared_dispatch_stub_1410(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW)
+void APIENTRY shared_dispatch_stub_1410(void)
 {
    const struct _glapi_table *_tbl = entry_current_get();
    mapi_func _func = ((const mapi_func *) _tbl)[1410];
+   ((void (APIENTRY *)(void)) _func)();
+}
+
+void APIENTRY shared_dispatch_stub_1411(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW)
+{
+   const struct _glapi_table *_tbl = entry_current_get();
+   mapi_func _func = ((const mapi_func *) _tbl)[1411];
    ((void (APIENTRY *)(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW)) _func)(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
 }
 
@@ -28613,7 +28631,8 @@ static const mapi_func public_entries[] = {
    (mapi_func) shared_dispatch_stub_1407,
    (mapi_func) shared_dispatch_stub_1408,
    (mapi_func) shared_dispatch_stub_1409,
-   (mapi_func) shared_dispatch_stub_1410
+   (mapi_func) shared_dispatch_stub_1410,
+   (mapi_func) shared_dispatch_stub_1411
 };
 #undef MAPI_TMP_PUBLIC_ENTRIES
 #endif /* MAPI_TMP_PUBLIC_ENTRIES */
@@ -34264,6 +34283,10 @@ STUB_ASM_ENTRY("shared_dispatch_stub_1409")"\n"
 STUB_ASM_ENTRY("shared_dispatch_stub_1410")"\n"
 "\t"STUB_ASM_CODE("1410")"\n"
 
+".hidden ""shared_dispatch_stub_1411""\n"
+STUB_ASM_ENTRY("shared_dispatch_stub_1411")"\n"
+"\t"STUB_ASM_CODE("1411")"\n"
+
 );
 #undef MAPI_TMP_STUB_ASM_GCC
 #endif /* MAPI_TMP_STUB_ASM_GCC */
@@ -436,6 +436,7 @@ _mesa_initialize_exec_table(struct gl_context *ctx)
       SET_GetnPolygonStippleARB(exec, _mesa_GetnPolygonStippleARB);
       SET_GetnTexImageARB(exec, _mesa_GetnTexImageARB);
       SET_GetnUniformdvARB(exec, _mesa_GetnUniformdvARB);
+      SET_MaxShaderCompilerThreadsARB(exec, _mesa_MaxShaderCompilerThreadsARB);
       SET_MultiModeDrawArraysIBM(exec, _mesa_MultiModeDrawArraysIBM);
       SET_MultiModeDrawElementsIBM(exec, _mesa_MultiModeDrawElementsIBM);
       SET_NamedBufferPageCommitmentARB(exec, _mesa_NamedBufferPageCommitmentARB);
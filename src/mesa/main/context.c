@@ -1310,6 +1310,11 @@ _mesa_free_context_data( struct gl_context *ctx )
       _mesa_make_current(ctx, NULL, NULL);
    }
 
+   /* Compile and link jobs queued from this context still point at it. */
+   if (ctx->Shared &&
+       util_queue_is_initialized(&ctx->Shared->ShaderCompilerQueue))
+      util_queue_finish(&ctx->Shared->ShaderCompilerQueue);
+
    /* unreference WinSysDraw/Read buffers */
    _mesa_reference_framebuffer(&ctx->WinSysDrawBuffer, NULL);
    _mesa_reference_framebuffer(&ctx->WinSysReadBuffer, NULL);
@@ -1746,6 +1751,11 @@ _mesa_make_current( struct gl_context *newCtx,
          newCtx->NewState |= _NEW_BUFFERS;
 
          check_init_viewport(newCtx, drawBuffer->Width, drawBuffer->Height);
+
+         /* The window system framebuffers and the initial viewport may have
+          * changed behind glthread's back.
+          */
+         _mesa_glthread_invalidate_state(newCtx);
       }
 
       if (newCtx->FirstTimeCurrent) {
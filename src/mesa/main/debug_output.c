@@ -738,7 +738,15 @@ _mesa_unlock_debug_state(struct gl_context *ctx)
 bool
 _mesa_set_debug_state_int(struct gl_context *ctx, GLenum pname, GLint val)
 {
-   struct gl_debug_state *debug = _mesa_lock_debug_state(ctx);
+   struct gl_debug_state *debug;
+
+   /* Compiles and links queued while the output was off or asynchronous may
+    * still log messages from a compiler thread.  Let them finish first.
+    */
+   if (val && util_queue_is_initialized(&ctx->Shared->ShaderCompilerQueue))
+      util_queue_finish(&ctx->Shared->ShaderCompilerQueue);
+
+   debug = _mesa_lock_debug_state(ctx);
 
    if (!debug)
       return false;
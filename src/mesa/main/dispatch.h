@@ -57,7 +57,7 @@
     } while(0)
 
 /* total number of offsets below */
-#define _gloffset_COUNT 1411
+#define _gloffset_COUNT 1412
 
 #define _gloffset_NewList 0
 #define _gloffset_EndList 1
@@ -467,7 +467,7 @@
 #define _gloffset_MultiTexCoord4iv 405
 #define _gloffset_MultiTexCoord4s 406
 #define _gloffset_MultiTexCoord4sv 407
-#define driDispatchRemapTable_size 1003
+#define driDispatchRemapTable_size 1004
 extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 
 #define CompressedTexImage1D_remap_index 0
@@ -1131,348 +1131,349 @@ extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 #define Uniform4i64vARB_remap_index 658
 #define Uniform4ui64ARB_remap_index 659
 #define Uniform4ui64vARB_remap_index 660
-#define SpecializeShaderARB_remap_index 661
-#define InvalidateBufferData_remap_index 662
-#define InvalidateBufferSubData_remap_index 663
-#define InvalidateFramebuffer_remap_index 664
-#define InvalidateSubFramebuffer_remap_index 665
-#define InvalidateTexImage_remap_index 666
-#define InvalidateTexSubImage_remap_index 667
-#define PolygonOffsetEXT_remap_index 668
-#define DrawTexfOES_remap_index 669
-#define DrawTexfvOES_remap_index 670
-#define DrawTexiOES_remap_index 671
-#define DrawTexivOES_remap_index 672
-#define DrawTexsOES_remap_index 673
-#define DrawTexsvOES_remap_index 674
-#define DrawTexxOES_remap_index 675
-#define DrawTexxvOES_remap_index 676
-#define PointSizePointerOES_remap_index 677
-#define QueryMatrixxOES_remap_index 678
-#define SampleMaskSGIS_remap_index 679
-#define SamplePatternSGIS_remap_index 680
-#define ColorPointerEXT_remap_index 681
-#define EdgeFlagPointerEXT_remap_index 682
-#define IndexPointerEXT_remap_index 683
-#define NormalPointerEXT_remap_index 684
-#define TexCoordPointerEXT_remap_index 685
-#define VertexPointerEXT_remap_index 686
-#define DiscardFramebufferEXT_remap_index 687
-#define ActiveShaderProgram_remap_index 688
-#define BindProgramPipeline_remap_index 689
-#define CreateShaderProgramv_remap_index 690
-#define DeleteProgramPipelines_remap_index 691
-#define GenProgramPipelines_remap_index 692
-#define GetProgramPipelineInfoLog_remap_index 693
-#define GetProgramPipelineiv_remap_index 694
-#define IsProgramPipeline_remap_index 695
-#define LockArraysEXT_remap_index 696
-#define ProgramUniform1d_remap_index 697
-#define ProgramUniform1dv_remap_index 698
-#define ProgramUniform1f_remap_index 699
-#define ProgramUniform1fv_remap_index 700
-#define ProgramUniform1i_remap_index 701
-#define ProgramUniform1iv_remap_index 702
-#define ProgramUniform1ui_remap_index 703
-#define ProgramUniform1uiv_remap_index 704
-#define ProgramUniform2d_remap_index 705
-#define ProgramUniform2dv_remap_index 706
-#define ProgramUniform2f_remap_index 707
-#define ProgramUniform2fv_remap_index 708
-#define ProgramUniform2i_remap_index 709
-#define ProgramUniform2iv_remap_index 710
-#define ProgramUniform2ui_remap_index 711
-#define ProgramUniform2uiv_remap_index 712
-#define ProgramUniform3d_remap_index 713
-#define ProgramUniform3dv_remap_index 714
-#define ProgramUniform3f_remap_index 715
-#define ProgramUniform3fv_remap_index 716
-#define ProgramUniform3i_remap_index 717
-#define ProgramUniform3iv_remap_index 718
-#define ProgramUniform3ui_remap_index 719
-#define ProgramUniform3uiv_remap_index 720
-#define ProgramUniform4d_remap_index 721
-#define ProgramUniform4dv_remap_index 722
-#define ProgramUniform4f_remap_index 723
-#define ProgramUniform4fv_remap_index 724
-#define ProgramUniform4i_remap_index 725
-#define ProgramUniform4iv_remap_index 726
-#define ProgramUniform4ui_remap_index 727
-#define ProgramUniform4uiv_remap_index 728
-#define ProgramUniformMatrix2dv_remap_index 729
-#define ProgramUniformMatrix2fv_remap_index 730
-#define ProgramUniformMatrix2x3dv_remap_index 731
-#define ProgramUniformMatrix2x3fv_remap_index 732
-#define ProgramUniformMatrix2x4dv_remap_index 733
-#define ProgramUniformMatrix2x4fv_remap_index 734
-#define ProgramUniformMatrix3dv_remap_index 735
-#define ProgramUniformMatrix3fv_remap_index 736
-#define ProgramUniformMatrix3x2dv_remap_index 737
-#define ProgramUniformMatrix3x2fv_remap_index 738
-#define ProgramUniformMatrix3x4dv_remap_index 739
-#define ProgramUniformMatrix3x4fv_remap_index 740
-#define ProgramUniformMatrix4dv_remap_index 741
-#define ProgramUniformMatrix4fv_remap_index 742
-#define ProgramUniformMatrix4x2dv_remap_index 743
-#define ProgramUniformMatrix4x2fv_remap_index 744
-#define ProgramUniformMatrix4x3dv_remap_index 745
-#define ProgramUniformMatrix4x3fv_remap_index 746
-#define UnlockArraysEXT_remap_index 747
-#define UseProgramStages_remap_index 748
-#define ValidateProgramPipeline_remap_index 749
-#define DebugMessageCallback_remap_index 750
-#define DebugMessageControl_remap_index 751
-#define DebugMessageInsert_remap_index 752
-#define GetDebugMessageLog_remap_index 753
-#define GetObjectLabel_remap_index 754
-#define GetObjectPtrLabel_remap_index 755
-#define ObjectLabel_remap_index 756
-#define ObjectPtrLabel_remap_index 757
-#define PopDebugGroup_remap_index 758
-#define PushDebugGroup_remap_index 759
-#define SecondaryColor3fEXT_remap_index 760
-#define SecondaryColor3fvEXT_remap_index 761
-#define MultiDrawElementsEXT_remap_index 762
-#define FogCoordfEXT_remap_index 763
-#define FogCoordfvEXT_remap_index 764
-#define ResizeBuffersMESA_remap_index 765
-#define WindowPos4dMESA_remap_index 766
-#define WindowPos4dvMESA_remap_index 767
-#define WindowPos4fMESA_remap_index 768
-#define WindowPos4fvMESA_remap_index 769
-#define WindowPos4iMESA_remap_index 770
-#define WindowPos4ivMESA_remap_index 771
-#define WindowPos4sMESA_remap_index 772
-#define WindowPos4svMESA_remap_index 773
-#define MultiModeDrawArraysIBM_remap_index 774
-#define MultiModeDrawElementsIBM_remap_index 775
-#define AreProgramsResidentNV_remap_index 776
-#define ExecuteProgramNV_remap_index 777
-#define GetProgramParameterdvNV_remap_index 778
-#define GetProgramParameterfvNV_remap_index 779
-#define GetProgramStringNV_remap_index 780
-#define GetProgramivNV_remap_index 781
-#define GetTrackMatrixivNV_remap_index 782
-#define GetVertexAttribdvNV_remap_index 783
-#define GetVertexAttribfvNV_remap_index 784
-#define GetVertexAttribivNV_remap_index 785
-#define LoadProgramNV_remap_index 786
-#define ProgramParameters4dvNV_remap_index 787
-#define ProgramParameters4fvNV_remap_index 788
-#define RequestResidentProgramsNV_remap_index 789
-#define TrackMatrixNV_remap_index 790
-#define VertexAttrib1dNV_remap_index 791
-#define VertexAttrib1dvNV_remap_index 792
-#define VertexAttrib1fNV_remap_index 793
-#define VertexAttrib1fvNV_remap_index 794
-#define VertexAttrib1sNV_remap_index 795
-#define VertexAttrib1svNV_remap_index 796
-#define VertexAttrib2dNV_remap_index 797
-#define VertexAttrib2dvNV_remap_index 798
-#define VertexAttrib2fNV_remap_index 799
-#define VertexAttrib2fvNV_remap_index 800
-#define VertexAttrib2sNV_remap_index 801
-#define VertexAttrib2svNV_remap_index 802
-#define VertexAttrib3dNV_remap_index 803
-#define VertexAttrib3dvNV_remap_index 804
-#define VertexAttrib3fNV_remap_index 805
-#define VertexAttrib3fvNV_remap_index 806
-#define VertexAttrib3sNV_remap_index 807
-#define VertexAttrib3svNV_remap_index 808
-#define VertexAttrib4dNV_remap_index 809
-#define VertexAttrib4dvNV_remap_index 810
-#define VertexAttrib4fNV_remap_index 811
-#define VertexAttrib4fvNV_remap_index 812
-#define VertexAttrib4sNV_remap_index 813
-#define VertexAttrib4svNV_remap_index 814
-#define VertexAttrib4ubNV_remap_index 815
-#define VertexAttrib4ubvNV_remap_index 816
-#define VertexAttribPointerNV_remap_index 817
-#define VertexAttribs1dvNV_remap_index 818
-#define VertexAttribs1fvNV_remap_index 819
-#define VertexAttribs1svNV_remap_index 820
-#define VertexAttribs2dvNV_remap_index 821
-#define VertexAttribs2fvNV_remap_index 822
-#define VertexAttribs2svNV_remap_index 823
-#define VertexAttribs3dvNV_remap_index 824
-#define VertexAttribs3fvNV_remap_index 825
-#define VertexAttribs3svNV_remap_index 826
-#define VertexAttribs4dvNV_remap_index 827
-#define VertexAttribs4fvNV_remap_index 828
-#define VertexAttribs4svNV_remap_index 829
-#define VertexAttribs4ubvNV_remap_index 830
-#define GetTexBumpParameterfvATI_remap_index 831
-#define GetTexBumpParameterivATI_remap_index 832
-#define TexBumpParameterfvATI_remap_index 833
-#define TexBumpParameterivATI_remap_index 834
-#define AlphaFragmentOp1ATI_remap_index 835
-#define AlphaFragmentOp2ATI_remap_index 836
-#define AlphaFragmentOp3ATI_remap_index 837
-#define BeginFragmentShaderATI_remap_index 838
-#define BindFragmentShaderATI_remap_index 839
-#define ColorFragmentOp1ATI_remap_index 840
-#define ColorFragmentOp2ATI_remap_index 841
-#define ColorFragmentOp3ATI_remap_index 842
-#define DeleteFragmentShaderATI_remap_index 843
-#define EndFragmentShaderATI_remap_index 844
-#define GenFragmentShadersATI_remap_index 845
-#define PassTexCoordATI_remap_index 846
-#define SampleMapATI_remap_index 847
-#define SetFragmentShaderConstantATI_remap_index 848
-#define DepthRangeArrayfvOES_remap_index 849
-#define DepthRangeIndexedfOES_remap_index 850
-#define ActiveStencilFaceEXT_remap_index 851
-#define GetProgramNamedParameterdvNV_remap_index 852
-#define GetProgramNamedParameterfvNV_remap_index 853
-#define ProgramNamedParameter4dNV_remap_index 854
-#define ProgramNamedParameter4dvNV_remap_index 855
-#define ProgramNamedParameter4fNV_remap_index 856
-#define ProgramNamedParameter4fvNV_remap_index 857
-#define PrimitiveRestartNV_remap_index 858
-#define GetTexGenxvOES_remap_index 859
-#define TexGenxOES_remap_index 860
-#define TexGenxvOES_remap_index 861
-#define DepthBoundsEXT_remap_index 862
-#define BindFramebufferEXT_remap_index 863
-#define BindRenderbufferEXT_remap_index 864
-#define StringMarkerGREMEDY_remap_index 865
-#define BufferParameteriAPPLE_remap_index 866
-#define FlushMappedBufferRangeAPPLE_remap_index 867
-#define VertexAttribI1iEXT_remap_index 868
-#define VertexAttribI1uiEXT_remap_index 869
-#define VertexAttribI2iEXT_remap_index 870
-#define VertexAttribI2ivEXT_remap_index 871
-#define VertexAttribI2uiEXT_remap_index 872
-#define VertexAttribI2uivEXT_remap_index 873
-#define VertexAttribI3iEXT_remap_index 874
-#define VertexAttribI3ivEXT_remap_index 875
-#define VertexAttribI3uiEXT_remap_index 876
-#define VertexAttribI3uivEXT_remap_index 877
-#define VertexAttribI4iEXT_remap_index 878
-#define VertexAttribI4ivEXT_remap_index 879
-#define VertexAttribI4uiEXT_remap_index 880
-#define VertexAttribI4uivEXT_remap_index 881
-#define ClearColorIiEXT_remap_index 882
-#define ClearColorIuiEXT_remap_index 883
-#define BindBufferOffsetEXT_remap_index 884
-#define BeginPerfMonitorAMD_remap_index 885
-#define DeletePerfMonitorsAMD_remap_index 886
-#define EndPerfMonitorAMD_remap_index 887
-#define GenPerfMonitorsAMD_remap_index 888
-#define GetPerfMonitorCounterDataAMD_remap_index 889
-#define GetPerfMonitorCounterInfoAMD_remap_index 890
-#define GetPerfMonitorCounterStringAMD_remap_index 891
-#define GetPerfMonitorCountersAMD_remap_index 892
-#define GetPerfMonitorGroupStringAMD_remap_index 893
-#define GetPerfMonitorGroupsAMD_remap_index 894
-#define SelectPerfMonitorCountersAMD_remap_index 895
-#define GetObjectParameterivAPPLE_remap_index 896
-#define ObjectPurgeableAPPLE_remap_index 897
-#define ObjectUnpurgeableAPPLE_remap_index 898
-#define ActiveProgramEXT_remap_index 899
-#define CreateShaderProgramEXT_remap_index 900
-#define UseShaderProgramEXT_remap_index 901
-#define TextureBarrierNV_remap_index 902
-#define VDPAUFiniNV_remap_index 903
-#define VDPAUGetSurfaceivNV_remap_index 904
-#define VDPAUInitNV_remap_index 905
-#define VDPAUIsSurfaceNV_remap_index 906
-#define VDPAUMapSurfacesNV_remap_index 907
-#define VDPAURegisterOutputSurfaceNV_remap_index 908
-#define VDPAURegisterVideoSurfaceNV_remap_index 909
-#define VDPAUSurfaceAccessNV_remap_index 910
-#define VDPAUUnmapSurfacesNV_remap_index 911
-#define VDPAUUnregisterSurfaceNV_remap_index 912
-#define BeginPerfQueryINTEL_remap_index 913
-#define CreatePerfQueryINTEL_remap_index 914
-#define DeletePerfQueryINTEL_remap_index 915
-#define EndPerfQueryINTEL_remap_index 916
-#define GetFirstPerfQueryIdINTEL_remap_index 917
-#define GetNextPerfQueryIdINTEL_remap_index 918
-#define GetPerfCounterInfoINTEL_remap_index 919
-#define GetPerfQueryDataINTEL_remap_index 920
-#define GetPerfQueryIdByNameINTEL_remap_index 921
-#define GetPerfQueryInfoINTEL_remap_index 922
-#define PolygonOffsetClampEXT_remap_index 923
-#define WindowRectanglesEXT_remap_index 924
-#define BufferStorageMemEXT_remap_index 925
-#define CreateMemoryObjectsEXT_remap_index 926
-#define DeleteMemoryObjectsEXT_remap_index 927
-#define DeleteSemaphoresEXT_remap_index 928
-#define GenSemaphoresEXT_remap_index 929
-#define GetMemoryObjectParameterivEXT_remap_index 930
-#define GetSemaphoreParameterui64vEXT_remap_index 931
-#define GetUnsignedBytei_vEXT_remap_index 932
-#define GetUnsignedBytevEXT_remap_index 933
-#define IsMemoryObjectEXT_remap_index 934
-#define IsSemaphoreEXT_remap_index 935
-#define MemoryObjectParameterivEXT_remap_index 936
-#define NamedBufferStorageMemEXT_remap_index 937
-#define SemaphoreParameterui64vEXT_remap_index 938
-#define SignalSemaphoreEXT_remap_index 939
-#define TexStorageMem1DEXT_remap_index 940
-#define TexStorageMem2DEXT_remap_index 941
-#define TexStorageMem2DMultisampleEXT_remap_index 942
-#define TexStorageMem3DEXT_remap_index 943
-#define TexStorageMem3DMultisampleEXT_remap_index 944
-#define TextureStorageMem1DEXT_remap_index 945
-#define TextureStorageMem2DEXT_remap_index 946
-#define TextureStorageMem2DMultisampleEXT_remap_index 947
-#define TextureStorageMem3DEXT_remap_index 948
-#define TextureStorageMem3DMultisampleEXT_remap_index 949
-#define WaitSemaphoreEXT_remap_index 950
-#define ImportMemoryFdEXT_remap_index 951
-#define ImportSemaphoreFdEXT_remap_index 952
-#define StencilFuncSeparateATI_remap_index 953
-#define ProgramEnvParameters4fvEXT_remap_index 954
-#define ProgramLocalParameters4fvEXT_remap_index 955
-#define EGLImageTargetRenderbufferStorageOES_remap_index 956
-#define EGLImageTargetTexture2DOES_remap_index 957
-#define AlphaFuncx_remap_index 958
-#define ClearColorx_remap_index 959
-#define ClearDepthx_remap_index 960
-#define Color4x_remap_index 961
-#define DepthRangex_remap_index 962
-#define Fogx_remap_index 963
-#define Fogxv_remap_index 964
-#define Frustumf_remap_index 965
-#define Frustumx_remap_index 966
-#define LightModelx_remap_index 967
-#define LightModelxv_remap_index 968
-#define Lightx_remap_index 969
-#define Lightxv_remap_index 970
-#define LineWidthx_remap_index 971
-#define LoadMatrixx_remap_index 972
-#define Materialx_remap_index 973
-#define Materialxv_remap_index 974
-#define MultMatrixx_remap_index 975
-#define MultiTexCoord4x_remap_index 976
-#define Normal3x_remap_index 977
-#define Orthof_remap_index 978
-#define Orthox_remap_index 979
-#define PointSizex_remap_index 980
-#define PolygonOffsetx_remap_index 981
-#define Rotatex_remap_index 982
-#define SampleCoveragex_remap_index 983
-#define Scalex_remap_index 984
-#define TexEnvx_remap_index 985
-#define TexEnvxv_remap_index 986
-#define TexParameterx_remap_index 987
-#define Translatex_remap_index 988
-#define ClipPlanef_remap_index 989
-#define ClipPlanex_remap_index 990
-#define GetClipPlanef_remap_index 991
-#define GetClipPlanex_remap_index 992
-#define GetFixedv_remap_index 993
-#define GetLightxv_remap_index 994
-#define GetMaterialxv_remap_index 995
-#define GetTexEnvxv_remap_index 996
-#define GetTexParameterxv_remap_index 997
-#define PointParameterx_remap_index 998
-#define PointParameterxv_remap_index 999
-#define TexParameterxv_remap_index 1000
-#define BlendBarrier_remap_index 1001
-#define PrimitiveBoundingBox_remap_index 1002
+#define MaxShaderCompilerThreadsARB_remap_index 661
+#define SpecializeShaderARB_remap_index 662
+#define InvalidateBufferData_remap_index 663
+#define InvalidateBufferSubData_remap_index 664
+#define InvalidateFramebuffer_remap_index 665
+#define InvalidateSubFramebuffer_remap_index 666
+#define InvalidateTexImage_remap_index 667
+#define InvalidateTexSubImage_remap_index 668
+#define PolygonOffsetEXT_remap_index 669
+#define DrawTexfOES_remap_index 670
+#define DrawTexfvOES_remap_index 671
+#define DrawTexiOES_remap_index 672
+#define DrawTexivOES_remap_index 673
+#define DrawTexsOES_remap_index 674
+#define DrawTexsvOES_remap_index 675
+#define DrawTexxOES_remap_index 676
+#define DrawTexxvOES_remap_index 677
+#define PointSizePointerOES_remap_index 678
+#define QueryMatrixxOES_remap_index 679
+#define SampleMaskSGIS_remap_index 680
+#define SamplePatternSGIS_remap_index 681
+#define ColorPointerEXT_remap_index 682
+#define EdgeFlagPointerEXT_remap_index 683
+#define IndexPointerEXT_remap_index 684
+#define NormalPointerEXT_remap_index 685
+#define TexCoordPointerEXT_remap_index 686
+#define VertexPointerEXT_remap_index 687
+#define DiscardFramebufferEXT_remap_index 688
+#define ActiveShaderProgram_remap_index 689
+#define BindProgramPipeline_remap_index 690
+#define CreateShaderProgramv_remap_index 691
+#define DeleteProgramPipelines_remap_index 692
+#define GenProgramPipelines_remap_index 693
+#define GetProgramPipelineInfoLog_remap_index 694
+#define GetProgramPipelineiv_remap_index 695
+#define IsProgramPipeline_remap_index 696
+#define LockArraysEXT_remap_index 697
+#define ProgramUniform1d_remap_index 698
+#define ProgramUniform1dv_remap_index 699
+#define ProgramUniform1f_remap_index 700
+#define ProgramUniform1fv_remap_index 701
+#define ProgramUniform1i_remap_index 702
+#define ProgramUniform1iv_remap_index 703
+#define ProgramUniform1ui_remap_index 704
+#define ProgramUniform1uiv_remap_index 705
+#define ProgramUniform2d_remap_index 706
+#define ProgramUniform2dv_remap_index 707
+#define ProgramUniform2f_remap_index 708
+#define ProgramUniform2fv_remap_index 709
+#define ProgramUniform2i_remap_index 710
+#define ProgramUniform2iv_remap_index 711
+#define ProgramUniform2ui_remap_index 712
+#define ProgramUniform2uiv_remap_index 713
+#define ProgramUniform3d_remap_index 714
+#define ProgramUniform3dv_remap_index 715
+#define ProgramUniform3f_remap_index 716
+#define ProgramUniform3fv_remap_index 717
+#define ProgramUniform3i_remap_index 718
+#define ProgramUniform3iv_remap_index 719
+#define ProgramUniform3ui_remap_index 720
+#define ProgramUniform3uiv_remap_index 721
+#define ProgramUniform4d_remap_index 722
+#define ProgramUniform4dv_remap_index 723
+#define ProgramUniform4f_remap_index 724
+#define ProgramUniform4fv_remap_index 725
+#define ProgramUniform4i_remap_index 726
+#define ProgramUniform4iv_remap_index 727
+#define ProgramUniform4ui_remap_index 728
+#define ProgramUniform4uiv_remap_index 729
+#define ProgramUniformMatrix2dv_remap_index 730
+#define ProgramUniformMatrix2fv_remap_index 731
+#define ProgramUniformMatrix2x3dv_remap_index 732
+#define ProgramUniformMatrix2x3fv_remap_index 733
+#define ProgramUniformMatrix2x4dv_remap_index 734
+#define ProgramUniformMatrix2x4fv_remap_index 735
+#define ProgramUniformMatrix3dv_remap_index 736
+#define ProgramUniformMatrix3fv_remap_index 737
+#define ProgramUniformMatrix3x2dv_remap_index 738
+#define ProgramUniformMatrix3x2fv_remap_index 739
+#define ProgramUniformMatrix3x4dv_remap_index 740
+#define ProgramUniformMatrix3x4fv_remap_index 741
+#define ProgramUniformMatrix4dv_remap_index 742
+#define ProgramUniformMatrix4fv_remap_index 743
+#define ProgramUniformMatrix4x2dv_remap_index 744
+#define ProgramUniformMatrix4x2fv_remap_index 745
+#define ProgramUniformMatrix4x3dv_remap_index 746
+#define ProgramUniformMatrix4x3fv_remap_index 747
+#define UnlockArraysEXT_remap_index 748
+#define UseProgramStages_remap_index 749
+#define ValidateProgramPipeline_remap_index 750
+#define DebugMessageCallback_remap_index 751
+#define DebugMessageControl_remap_index 752
+#define DebugMessageInsert_remap_index 753
+#define GetDebugMessageLog_remap_index 754
+#define GetObjectLabel_remap_index 755
+#define GetObjectPtrLabel_remap_index 756
+#define ObjectLabel_remap_index 757
+#define ObjectPtrLabel_remap_index 758
+#define PopDebugGroup_remap_index 759
+#define PushDebugGroup_remap_index 760
+#define SecondaryColor3fEXT_remap_index 761
+#define SecondaryColor3fvEXT_remap_index 762
+#define MultiDrawElementsEXT_remap_index 763
+#define FogCoordfEXT_remap_index 764
+#define FogCoordfvEXT_remap_index 765
+#define ResizeBuffersMESA_remap_index 766
+#define WindowPos4dMESA_remap_index 767
+#define WindowPos4dvMESA_remap_index 768
+#define WindowPos4fMESA_remap_index 769
+#define WindowPos4fvMESA_remap_index 770
+#define WindowPos4iMESA_remap_index 771
+#define WindowPos4ivMESA_remap_index 772
+#define WindowPos4sMESA_remap_index 773
+#define WindowPos4svMESA_remap_index 774
+#define MultiModeDrawArraysIBM_remap_index 775
+#define MultiModeDrawElementsIBM_remap_index 776
+#define AreProgramsResidentNV_remap_index 777
+#define ExecuteProgramNV_remap_index 778
+#define GetProgramParameterdvNV_remap_index 779
+#define GetProgramParameterfvNV_remap_index 780
+#define GetProgramStringNV_remap_index 781
+#define GetProgramivNV_remap_index 782
+#define GetTrackMatrixivNV_remap_index 783
+#define GetVertexAttribdvNV_remap_index 784
+#define GetVertexAttribfvNV_remap_index 785
+#define GetVertexAttribivNV_remap_index 786
+#define LoadProgramNV_remap_index 787
+#define ProgramParameters4dvNV_remap_index 788
+#define ProgramParameters4fvNV_remap_index 789
+#define RequestResidentProgramsNV_remap_index 790
+#define TrackMatrixNV_remap_index 791
+#define VertexAttrib1dNV_remap_index 792
+#define VertexAttrib1dvNV_remap_index 793
+#define VertexAttrib1fNV_remap_index 794
+#define VertexAttrib1fvNV_remap_index 795
+#define VertexAttrib1sNV_remap_index 796
+#define VertexAttrib1svNV_remap_index 797
+#define VertexAttrib2dNV_remap_index 798
+#define VertexAttrib2dvNV_remap_index 799
+#define VertexAttrib2fNV_remap_index 800
+#define VertexAttrib2fvNV_remap_index 801
+#define VertexAttrib2sNV_remap_index 802
+#define VertexAttrib2svNV_remap_index 803
+#define VertexAttrib3dNV_remap_index 804
+#define VertexAttrib3dvNV_remap_index 805
+#define VertexAttrib3fNV_remap_index 806
+#define VertexAttrib3fvNV_remap_index 807
+#define VertexAttrib3sNV_remap_index 808
+#define VertexAttrib3svNV_remap_index 809
+#define VertexAttrib4dNV_remap_index 810
+#define VertexAttrib4dvNV_remap_index 811
+#define VertexAttrib4fNV_remap_index 812
+#define VertexAttrib4fvNV_remap_index 813
+#define VertexAttrib4sNV_remap_index 814
+#define VertexAttrib4svNV_remap_index 815
+#define VertexAttrib4ubNV_remap_index 816
+#define VertexAttrib4ubvNV_remap_index 817
+#define VertexAttribPointerNV_remap_index 818
+#define VertexAttribs1dvNV_remap_index 819
+#define VertexAttribs1fvNV_remap_index 820
+#define VertexAttribs1svNV_remap_index 821
+#define VertexAttribs2dvNV_remap_index 822
+#define VertexAttribs2fvNV_remap_index 823
+#define VertexAttribs2svNV_remap_index 824
+#define VertexAttribs3dvNV_remap_index 825
+#define VertexAttribs3fvNV_remap_index 826
+#define VertexAttribs3svNV_remap_index 827
+#define VertexAttribs4dvNV_remap_index 828
+#define VertexAttribs4fvNV_remap_index 829
+#define VertexAttribs4svNV_remap_index 830
+#define VertexAttribs4ubvNV_remap_index 831
+#define GetTexBumpParameterfvATI_remap_index 832
+#define GetTexBumpParameterivATI_remap_index 833
+#define TexBumpParameterfvATI_remap_index 834
+#define TexBumpParameterivATI_remap_index 835
+#define AlphaFragmentOp1ATI_remap_index 836
+#define AlphaFragmentOp2ATI_remap_index 837
+#define AlphaFragmentOp3ATI_remap_index 838
+#define BeginFragmentShaderATI_remap_index 839
+#define BindFragmentShaderATI_remap_index 840
+#define ColorFragmentOp1ATI_remap_index 841
+#define ColorFragmentOp2ATI_remap_index 842
+#define ColorFragmentOp3ATI_remap_index 843
+#define DeleteFragmentShaderATI_remap_index 844
+#define EndFragmentShaderATI_remap_index 845
+#define GenFragmentShadersATI_remap_index 846
+#define PassTexCoordATI_remap_index 847
+#define SampleMapATI_remap_index 848
+#define SetFragmentShaderConstantATI_remap_index 849
+#define DepthRangeArrayfvOES_remap_index 850
+#define DepthRangeIndexedfOES_remap_index 851
+#define ActiveStencilFaceEXT_remap_index 852
+#define GetProgramNamedParameterdvNV_remap_index 853
+#define GetProgramNamedParameterfvNV_remap_index 854
+#define ProgramNamedParameter4dNV_remap_index 855
+#define ProgramNamedParameter4dvNV_remap_index 856
+#define ProgramNamedParameter4fNV_remap_index 857
+#define ProgramNamedParameter4fvNV_remap_index 858
+#define PrimitiveRestartNV_remap_index 859
+#define GetTexGenxvOES_remap_index 860
+#define TexGenxOES_remap_index 861
+#define TexGenxvOES_remap_index 862
+#define DepthBoundsEXT_remap_index 863
+#define BindFramebufferEXT_remap_index 864
+#define BindRenderbufferEXT_remap_index 865
+#define StringMarkerGREMEDY_remap_index 866
+#define BufferParameteriAPPLE_remap_index 867
+#define FlushMappedBufferRangeAPPLE_remap_index 868
+#define VertexAttribI1iEXT_remap_index 869
+#define VertexAttribI1uiEXT_remap_index 870
+#define VertexAttribI2iEXT_remap_index 871
+#define VertexAttribI2ivEXT_remap_index 872
+#define VertexAttribI2uiEXT_remap_index 873
+#define VertexAttribI2uivEXT_remap_index 874
+#define VertexAttribI3iEXT_remap_index 875
+#define VertexAttribI3ivEXT_remap_index 876
+#define VertexAttribI3uiEXT_remap_index 877
+#define VertexAttribI3uivEXT_remap_index 878
+#define VertexAttribI4iEXT_remap_index 879
+#define VertexAttribI4ivEXT_remap_index 880
+#define VertexAttribI4uiEXT_remap_index 881
+#define VertexAttribI4uivEXT_remap_index 882
+#define ClearColorIiEXT_remap_index 883
+#define ClearColorIuiEXT_remap_index 884
+#define BindBufferOffsetEXT_remap_index 885
+#define BeginPerfMonitorAMD_remap_index 886
+#define DeletePerfMonitorsAMD_remap_index 887
+#define EndPerfMonitorAMD_remap_index 888
+#define GenPerfMonitorsAMD_remap_index 889
+#define GetPerfMonitorCounterDataAMD_remap_index 890
+#define GetPerfMonitorCounterInfoAMD_remap_index 891
+#define GetPerfMonitorCounterStringAMD_remap_index 892
+#define GetPerfMonitorCountersAMD_remap_index 893
+#define GetPerfMonitorGroupStringAMD_remap_index 894
+#define GetPerfMonitorGroupsAMD_remap_index 895
+#define SelectPerfMonitorCountersAMD_remap_index 896
+#define GetObjectParameterivAPPLE_remap_index 897
+#define ObjectPurgeableAPPLE_remap_index 898
+#define ObjectUnpurgeableAPPLE_remap_index 899
+#define ActiveProgramEXT_remap_index 900
+#define CreateShaderProgramEXT_remap_index 901
+#define UseShaderProgramEXT_remap_index 902
+#define TextureBarrierNV_remap_index 903
+#define VDPAUFiniNV_remap_index 904
+#define VDPAUGetSurfaceivNV_remap_index 905
+#define VDPAUInitNV_remap_index 906
+#define VDPAUIsSurfaceNV_remap_index 907
+#define VDPAUMapSurfacesNV_remap_index 908
+#define VDPAURegisterOutputSurfaceNV_remap_index 909
+#define VDPAURegisterVideoSurfaceNV_remap_index 910
+#define VDPAUSurfaceAccessNV_remap_index 911
+#define VDPAUUnmapSurfacesNV_remap_index 912
+#define VDPAUUnregisterSurfaceNV_remap_index 913
+#define BeginPerfQueryINTEL_remap_index 914
+#define CreatePerfQueryINTEL_remap_index 915
+#define DeletePerfQueryINTEL_remap_index 916
+#define EndPerfQueryINTEL_remap_index 917
+#define GetFirstPerfQueryIdINTEL_remap_index 918
+#define GetNextPerfQueryIdINTEL_remap_index 919
+#define GetPerfCounterInfoINTEL_remap_index 920
+#define GetPerfQueryDataINTEL_remap_index 921
+#define GetPerfQueryIdByNameINTEL_remap_index 922
+#define GetPerfQueryInfoINTEL_remap_index 923
+#define PolygonOffsetClampEXT_remap_index 924
+#define WindowRectanglesEXT_remap_index 925
+#define BufferStorageMemEXT_remap_index 926
+#define CreateMemoryObjectsEXT_remap_index 927
+#define DeleteMemoryObjectsEXT_remap_index 928
+#define DeleteSemaphoresEXT_remap_index 929
+#define GenSemaphoresEXT_remap_index 930
+#define GetMemoryObjectParameterivEXT_remap_index 931
+#define GetSemaphoreParameterui64vEXT_remap_index 932
+#define GetUnsignedBytei_vEXT_remap_index 933
+#define GetUnsignedBytevEXT_remap_index 934
+#define IsMemoryObjectEXT_remap_index 935
+#define IsSemaphoreEXT_remap_index 936
+#define MemoryObjectParameterivEXT_remap_index 937
+#define NamedBufferStorageMemEXT_remap_index 938
+#define SemaphoreParameterui64vEXT_remap_index 939
+#define SignalSemaphoreEXT_remap_index 940
+#define TexStorageMem1DEXT_remap_index 941
+#define TexStorageMem2DEXT_remap_index 942
+#define TexStorageMem2DMultisampleEXT_remap_index 943
+#define TexStorageMem3DEXT_remap_index 944
+#define TexStorageMem3DMultisampleEXT_remap_index 945
+#define TextureStorageMem1DEXT_remap_index 946
+#define TextureStorageMem2DEXT_remap_index 947
+#define TextureStorageMem2DMultisampleEXT_remap_index 948
+#define TextureStorageMem3DEXT_remap_index 949
+#define TextureStorageMem3DMultisampleEXT_remap_index 950
+#define WaitSemaphoreEXT_remap_index 951
+#define ImportMemoryFdEXT_remap_index 952
+#define ImportSemaphoreFdEXT_remap_index 953
+#define StencilFuncSeparateATI_remap_index 954
+#define ProgramEnvParameters4fvEXT_remap_index 955
+#define ProgramLocalParameters4fvEXT_remap_index 956
+#define EGLImageTargetRenderbufferStorageOES_remap_index 957
+#define EGLImageTargetTexture2DOES_remap_index 958
+#define AlphaFuncx_remap_index 959
+#define ClearColorx_remap_index 960
+#define ClearDepthx_remap_index 961
+#define Color4x_remap_index 962
+#define DepthRangex_remap_index 963
+#define Fogx_remap_index 964
+#define Fogxv_remap_index 965
+#define Frustumf_remap_index 966
+#define Frustumx_remap_index 967
+#define LightModelx_remap_index 968
+#define LightModelxv_remap_index 969
+#define Lightx_remap_index 970
+#define Lightxv_remap_index 971
+#define LineWidthx_remap_index 972
+#define LoadMatrixx_remap_index 973
+#define Materialx_remap_index 974
+#define Materialxv_remap_index 975
+#define MultMatrixx_remap_index 976
+#define MultiTexCoord4x_remap_index 977
+#define Normal3x_remap_index 978
+#define Orthof_remap_index 979
+#define Orthox_remap_index 980
+#define PointSizex_remap_index 981
+#define PolygonOffsetx_remap_index 982
+#define Rotatex_remap_index 983
+#define SampleCoveragex_remap_index 984
+#define Scalex_remap_index 985
+#define TexEnvx_remap_index 986
+#define TexEnvxv_remap_index 987
+#define TexParameterx_remap_index 988
+#define Translatex_remap_index 989
+#define ClipPlanef_remap_index 990
+#define ClipPlanex_remap_index 991
+#define GetClipPlanef_remap_index 992
+#define GetClipPlanex_remap_index 993
+#define GetFixedv_remap_index 994
+#define GetLightxv_remap_index 995
+#define GetMaterialxv_remap_index 996
+#define GetTexEnvxv_remap_index 997
+#define GetTexParameterxv_remap_index 998
+#define PointParameterx_remap_index 999
+#define PointParameterxv_remap_index 1000
+#define TexParameterxv_remap_index 1001
+#define BlendBarrier_remap_index 1002
+#define PrimitiveBoundingBox_remap_index 1003
 
 #define _gloffset_CompressedTexImage1D driDispatchRemapTable[CompressedTexImage1D_remap_index]
 #define _gloffset_CompressedTexImage2D driDispatchRemapTable[CompressedTexImage2D_remap_index]
@@ -2135,6 +2136,7 @@ extern int driDispatchRemapTable[ driDispatchRemapTable_size ];
 #define _gloffset_Uniform4i64vARB driDispatchRemapTable[Uniform4i64vARB_remap_index]
 #define _gloffset_Uniform4ui64ARB driDispatchRemapTable[Uniform4ui64ARB_remap_index]
 #define _gloffset_Uniform4ui64vARB driDispatchRemapTable[Uniform4ui64vARB_remap_index]
+#define _gloffset_MaxShaderCompilerThreadsARB driDispatchRemapTable[MaxShaderCompilerThreadsARB_remap_index]
 #define _gloffset_SpecializeShaderARB driDispatchRemapTable[SpecializeShaderARB_remap_index]
 #define _gloffset_InvalidateBufferData driDispatchRemapTable[InvalidateBufferData_remap_index]
 #define _gloffset_InvalidateBufferSubData driDispatchRemapTable[InvalidateBufferSubData_remap_index]
@@ -14237,6 +14239,17 @@ static inline void SET_Uniform4ui64vARB(struct _glapi_table *disp, void (GLAPIEN
    SET_by_offset(disp, _gloffset_Uniform4ui64vARB, fn);
 }
 
+typedef void (GLAPIENTRYP _glptr_MaxShaderCompilerThreadsARB)(GLuint);
+#define CALL_MaxShaderCompilerThreadsARB(disp, parameters) \
+    (* GET_MaxShaderCompilerThreadsARB(disp)) parameters
+static inline _glptr_MaxShaderCompilerThreadsARB GET_MaxShaderCompilerThreadsARB(struct _glapi_table *disp) {
+   return (_glptr_MaxShaderCompilerThreadsARB) (GET_by_offset(disp, _gloffset_MaxShaderCompilerThreadsARB));
+}
+
+static inline void SET_MaxShaderCompilerThreadsARB(struct _glapi_table *disp, void (GLAPIENTRYP fn)(GLuint)) {
+   SET_by_offset(disp, _gloffset_MaxShaderCompilerThreadsARB, fn);
+}
+
 typedef void (GLAPIENTRYP _glptr_SpecializeShaderARB)(GLuint, const GLchar *, GLuint, const GLuint *, const GLuint *);
 #define CALL_SpecializeShaderARB(disp, parameters) \
     (* GET_SpecializeShaderARB(disp)) parameters
@@ -34,6 +34,10 @@
 
 #include "glheader.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 struct gl_context;
 
 
@@ -73,6 +77,8 @@ _mesa_set_multisample(struct gl_context *ctx, GLboolean state);
 extern void
 _mesa_set_framebuffer_srgb(struct gl_context *ctx, GLboolean state);
 
-
+#ifdef __cplusplus
+}
+#endif
 
 #endif
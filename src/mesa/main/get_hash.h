@@ -626,6 +626,7 @@ static const struct value_desc values[] = {
     { GL_MAX_COMBINED_CLIP_AND_CULL_DISTANCES, CONTEXT_INT(Const.MaxClipPlanes), extra_ARB_cull_distance },
     { GL_MAX_COMPUTE_VARIABLE_GROUP_INVOCATIONS_ARB, CONTEXT_INT(Const.MaxComputeVariableGroupInvocations), extra_ARB_compute_variable_group_size },
     { GL_SPARSE_BUFFER_PAGE_SIZE_ARB, CONTEXT_INT(Const.SparseBufferPageSize), extra_ARB_sparse_buffer },
+    { GL_MAX_SHADER_COMPILER_THREADS_ARB, CONTEXT_INT(Hint.MaxShaderCompilerThreads), NO_EXTRA },
     { GL_MAX_SUBROUTINES, CONST(MAX_SUBROUTINES), NO_EXTRA },
     { GL_MAX_SUBROUTINE_UNIFORM_LOCATIONS, CONST(MAX_SUBROUTINE_UNIFORM_LOCATIONS), NO_EXTRA },
     { GL_PARAMETER_BUFFER_BINDING_ARB, LOC_CUSTOM, TYPE_INT, 0, extra_ARB_indirect_parameters },
@@ -726,7 +727,7 @@ static table_t table_API_OPENGL = {
      208,    0,    0,  418,
        0,  328,  108,    0,
        0,    0,  321,  584,
-       0,    0,    0,    0,
+       0,    0,    0,  623,
        0,  415,    0,  457,
      405,  247,   29,  473,
        0,  595,  559,  197,
@@ -2269,7 +2270,7 @@ static table_t table_API_OPENGL_CORE = {
      493,    0,  142,  235,
        0,  377,    0,  610,
        0,  404,  327,   84,
-     384,    0,    0,  623,
+     384,    0,    0,  624,
      449,  601,    0,    0,
      592,    0,  363,    0,
      431,  479,    0,  338,
@@ -2280,7 +2281,7 @@ static table_t table_API_OPENGL_CORE = {
      208,    0,    0,  418,
        0,  328,  108,    0,
        0,  356,  321,  584,
-       0,  371,    0,    0,
+       0,  371,    0,  623,
        0,  415,    0,  457,
      405,  247,   29,  473,
      347,  595,  559,  197,
@@ -2292,7 +2293,7 @@ static table_t table_API_OPENGL_CORE = {
        0,  330,  379,    0,
        0,  367,  352,  342,
        0,  256,    0,    0,
-     624,  450,  602,    0,
+     625,  450,  602,    0,
        0,  591,    0,  364,
      474,  250,  188,  312,
        0,    0,   75,  273,
@@ -2388,7 +2389,7 @@ static table_t table_API_OPENGL_CORE = {
      158,    0,    0,   28,
      433,   53,  130,  408,
      572,    0,   37,    0,
-       0,  439,  625,  443,
+       0,  439,  626,  443,
        0,    0,    0,  113,
        0,    0,  360,    0,
        0,    0,    0,    0,
@@ -36,6 +36,11 @@
 #include "main/glthread.h"
 #include "main/marshal.h"
 #include "main/marshal_generated.h"
+#include "main/extensions.h"
+#include "main/shaderobj.h"
+#include "util/debug.h"
+#include "util/hash_table.h"
+#include "util/set.h"
 #include "util/u_atomic.h"
 #include "util/u_thread.h"
 
@@ -91,6 +96,22 @@ _mesa_glthread_init(struct gl_context *ctx)
       util_queue_fence_init(&glthread->batches[i].fence);
    }
 
+   if (env_var_as_boolean("MESA_GLTHREAD_SYNC_STATS", false)) {
+      glthread->sync_stats = _mesa_hash_table_create(NULL, _mesa_hash_string,
+                                                     _mesa_key_string_equal);
+   }
+   glthread->known_textures = _mesa_hash_table_create(NULL, _mesa_hash_pointer,
+                                                      _mesa_key_pointer_equal);
+   glthread->known_vertex_arrays = _mesa_set_create(NULL, _mesa_hash_pointer,
+                                                    _mesa_key_pointer_equal);
+   glthread->known_buffers = _mesa_set_create(NULL, _mesa_hash_pointer,
+                                              _mesa_key_pointer_equal);
+   glthread->known_framebuffers = _mesa_set_create(NULL, _mesa_hash_pointer,
+                                                   _mesa_key_pointer_equal);
+   glthread->known_renderbuffers = _mesa_set_create(NULL, _mesa_hash_pointer,
+                                                    _mesa_key_pointer_equal);
+   glthread->linked_programs = _mesa_set_create(NULL, _mesa_hash_pointer,
+                                                _mesa_key_pointer_equal);
    glthread->stats.queue = &glthread->queue;
    ctx->CurrentClientDispatch = ctx->MarshalExec;
    ctx->GLThread = glthread;
@@ -104,6 +125,46 @@ _mesa_glthread_init(struct gl_context *ctx)
    util_queue_fence_destroy(&fence);
 }
 
+static int
+compare_sync_stats(const void *a, const void *b)
+{
+   const struct hash_entry *ea = *(const struct hash_entry **)a;
+   const struct hash_entry *eb = *(const struct hash_entry **)b;
+   uintptr_t ca = (uintptr_t)ea->data, cb = (uintptr_t)eb->data;
+
+   if (ca != cb)
+      return ca < cb ? 1 : -1;
+   return strcmp(ea->key, eb->key);
+}
+
+static void
+print_sync_stats(struct glthread_state *glthread)
+{
+   struct hash_table *ht = glthread->sync_stats;
+   struct hash_entry **entries, *entry;
+   unsigned num = 0;
+
+   fprintf(stderr, "glthread: %u syncs\n", glthread->stats.num_syncs);
+   if (!ht->entries)
+      return;
+
+   entries = malloc(ht->entries * sizeof(*entries));
+   if (!entries)
+      return;
+
+   hash_table_foreach(ht, entry)
+      entries[num++] = entry;
+
+   qsort(entries, num, sizeof(*entries), compare_sync_stats);
+
+   for (unsigned i = 0; i < num; i++) {
+      fprintf(stderr, "glthread: %10u %s\n",
+              (unsigned)(uintptr_t)entries[i]->data,
+              (const char *)entries[i]->key);
+   }
+   free(entries);
+}
+
 void
 _mesa_glthread_destroy(struct gl_context *ctx)
 {
@@ -118,6 +179,17 @@ _mesa_glthread_destroy(struct gl_context *ctx)
    for (unsigned i = 0; i < MARSHAL_MAX_BATCHES; i++)
       util_queue_fence_destroy(&glthread->batches[i].fence);
 
+   if (glthread->sync_stats) {
+      print_sync_stats(glthread);
+      _mesa_hash_table_destroy(glthread->sync_stats, NULL);
+   }
+   _mesa_hash_table_destroy(glthread->known_textures, NULL);
+   _mesa_set_destroy(glthread->known_vertex_arrays, NULL);
+   _mesa_set_destroy(glthread->known_buffers, NULL);
+   _mesa_set_destroy(glthread->known_framebuffers, NULL);
+   _mesa_set_destroy(glthread->known_renderbuffers, NULL);
+   _mesa_set_destroy(glthread->linked_programs, NULL);
+
    free(glthread);
    ctx->GLThread = NULL;
 
@@ -172,15 +244,15 @@ _mesa_glthread_flush_batch(struct gl_context *ctx)
 /**
  * Waits for all pending batches have been unmarshaled.
  *
- * This can be used by the main thread to synchronize access to the context,
- * since the worker thread will be idle after this.
+ * Returns whether the caller actually had to wait for (or execute) any
+ * commands.
  */
-void
-_mesa_glthread_finish(struct gl_context *ctx)
+static bool
+glthread_finish(struct gl_context *ctx)
 {
    struct glthread_state *glthread = ctx->GLThread;
    if (!glthread)
-      return;
+      return false;
 
    /* If this is called from the worker thread, then we've hit a path that
     * might be called from either the main thread or the worker (such as some
@@ -188,7 +260,7 @@ _mesa_glthread_finish(struct gl_context *ctx)
     * synchronize against ourself.
     */
    if (u_thread_is_self(glthread->queue.threads[0]))
-      return;
+      return false;
 
    struct glthread_batch *last = &glthread->batches[glthread->last];
    struct glthread_batch *next = &glthread->batches[glthread->next];
@@ -217,4 +289,656 @@ _mesa_glthread_finish(struct gl_context *ctx)
 
    if (synced)
       p_atomic_inc(&glthread->stats.num_syncs);
+
+   glthread->idle = true;
+   return synced;
+}
+
+/**
+ * Waits for all pending batches have been unmarshaled.
+ *
+ * This can be used by the main thread to synchronize access to the context,
+ * since the worker thread will be idle after this.
+ */
+void
+_mesa_glthread_finish(struct gl_context *ctx)
+{
+   glthread_finish(ctx);
+}
+
+/**
+ * Like _mesa_glthread_finish(), but records the synchronization against the
+ * GL entry point \p func if one was needed.  All the synchronous marshalling
+ * paths go through this, so that MESA_GLTHREAD_SYNC_STATS can point at the
+ * calls that are still stalling the application thread.
+ */
+void
+_mesa_glthread_finish_before(struct gl_context *ctx, const char *func)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (!glthread_finish(ctx) || !glthread->sync_stats)
+      return;
+
+   uint32_t hash = _mesa_hash_string(func);
+   struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(glthread->sync_stats, hash, func);
+
+   if (entry)
+      entry->data = (void *)((uintptr_t)entry->data + 1);
+   else
+      _mesa_hash_table_insert_pre_hashed(glthread->sync_stats, hash, func,
+                                         (void *)(uintptr_t)1);
+}
+
+
+/**
+ * Allocate \p size bytes of staging memory for a command that doesn't fit in
+ * a batch.  The command owns the memory and the worker thread releases it
+ * with _mesa_glthread_staging_free() once it has been executed.
+ *
+ * If too much staging memory is in flight already, this waits for the
+ * worker thread (recorded as a sync of \p func) first.  Returns NULL if the
+ * allocation fails, in which case the caller should execute the command
+ * synchronously.
+ */
+void *
+_mesa_glthread_staging_alloc(struct gl_context *ctx, size_t size,
+                             const char *func)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (p_atomic_read(&glthread->staging_bytes) + (int64_t)size >
+       MARSHAL_MAX_STAGING_SIZE)
+      _mesa_glthread_finish_before(ctx, func);
+
+   void *ptr = malloc(size);
+   if (ptr)
+      p_atomic_add(&glthread->staging_bytes, (int64_t)size);
+   return ptr;
+}
+
+void
+_mesa_glthread_staging_free(struct gl_context *ctx, void *ptr, size_t size)
+{
+   free(ptr);
+   p_atomic_add(&ctx->GLThread->staging_bytes, -(int64_t)size);
+}
+
+
+static inline void *
+name_key(GLuint name)
+{
+   return (void *)(uintptr_t)name;
+}
+
+/**
+ * Whether another context can delete or recreate objects behind our back,
+ * in which case nothing is known about texture and program names.
+ */
+static bool
+objects_are_shared(struct gl_context *ctx)
+{
+   return p_atomic_read(&ctx->Shared->RefCount) > 1;
+}
+
+static void
+remember_names(struct set *set, GLsizei n, const GLuint *names)
+{
+   if (n < 0 || !set || !names)
+      return;
+
+   for (GLsizei i = 0; i < n; i++)
+      _mesa_set_add(set, name_key(names[i]));
+}
+
+/**
+ * Whether a bind of a nonzero name from one of the known_* sets is known
+ * to succeed.  Names of shared objects are only trusted while nothing else
+ * can delete them.
+ */
+static bool
+is_known_name(struct gl_context *ctx, struct set *set, GLuint name,
+              bool shared)
+{
+   if (!set || (shared && objects_are_shared(ctx)))
+      return false;
+
+   return _mesa_set_search(set, name_key(name)) != NULL;
+}
+
+/** Mark the name of the object bound in the context as known. */
+static void
+remember_bound(struct set *set, GLuint name)
+{
+   if (set && name)
+      _mesa_set_add(set, name_key(name));
+}
+
+static void
+forget_names(struct set *set, GLsizei n, const GLuint *names)
+{
+   if (!set || !names)
+      return;
+
+   for (GLsizei i = 0; i < n; i++) {
+      if (names[i])
+         _mesa_set_remove(set, _mesa_set_search(set, name_key(names[i])));
+   }
+}
+
+/**
+ * Mark the shadowed state as unknown.  The next query of a shadowed value
+ * will synchronize and reload everything from the context.
+ */
+void
+_mesa_glthread_invalidate_state(struct gl_context *ctx)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (glthread)
+      glthread->shadow.valid = false;
+}
+
+/**
+ * Reload the shadowed state from the context.  The worker thread must be
+ * idle, i.e. _mesa_glthread_finish() must have been called just before.
+ */
+void
+_mesa_glthread_validate_state(struct gl_context *ctx)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   unsigned enables = 0;
+
+   if (ctx->Color.BlendEnabled & 1)
+      enables |= GLTHREAD_CAP_BLEND;
+   if (ctx->Polygon.CullFlag)
+      enables |= GLTHREAD_CAP_CULL_FACE;
+   if (ctx->Depth.Test)
+      enables |= GLTHREAD_CAP_DEPTH_TEST;
+   if (ctx->Stencil.Enabled)
+      enables |= GLTHREAD_CAP_STENCIL_TEST;
+   if (ctx->Scissor.EnableFlags & 1)
+      enables |= GLTHREAD_CAP_SCISSOR_TEST;
+   if (ctx->Polygon.OffsetFill)
+      enables |= GLTHREAD_CAP_POLYGON_OFFSET_FILL;
+   if (ctx->Color.DitherFlag)
+      enables |= GLTHREAD_CAP_DITHER;
+   if (ctx->Multisample.SampleAlphaToCoverage)
+      enables |= GLTHREAD_CAP_SAMPLE_ALPHA_TO_COVERAGE;
+   if (ctx->Multisample.SampleCoverage)
+      enables |= GLTHREAD_CAP_SAMPLE_COVERAGE;
+   glthread->shadow.enables = enables;
+
+   glthread->shadow.array_buffer = ctx->Array.ArrayBufferObj->Name;
+   glthread->shadow.vertex_array = ctx->Array.VAO->Name;
+   glthread->shadow.current_program =
+      ctx->Shader.ActiveProgram ? ctx->Shader.ActiveProgram->Name : 0;
+   glthread->shadow.draw_framebuffer = ctx->DrawBuffer->Name;
+   glthread->shadow.read_framebuffer = ctx->ReadBuffer->Name;
+   glthread->shadow.renderbuffer =
+      ctx->CurrentRenderbuffer ? ctx->CurrentRenderbuffer->Name : 0;
+
+   glthread->shadow.active_texture = ctx->Texture.CurrentUnit;
+   for (unsigned i = 0; i < ARRAY_SIZE(glthread->shadow.texture_2d); i++) {
+      struct gl_texture_object *tex =
+         ctx->Texture.Unit[i].CurrentTex[TEXTURE_2D_INDEX];
+      glthread->shadow.texture_2d[i] = tex ? tex->Name : 0;
+      if (tex && tex->Name && glthread->known_textures) {
+         _mesa_hash_table_insert(glthread->known_textures,
+                                 name_key(tex->Name),
+                                 (void *)(uintptr_t)GL_TEXTURE_2D);
+      }
+   }
+
+   /* Whatever is bound now exists, so binding it again can't fail. */
+   remember_bound(glthread->known_vertex_arrays, ctx->Array.VAO->Name);
+   remember_bound(glthread->known_buffers, ctx->Array.ArrayBufferObj->Name);
+   remember_bound(glthread->known_framebuffers, ctx->DrawBuffer->Name);
+   remember_bound(glthread->known_framebuffers, ctx->ReadBuffer->Name);
+   remember_bound(glthread->known_renderbuffers,
+                  glthread->shadow.renderbuffer);
+   if (ctx->Shader.ActiveProgram &&
+       ctx->Shader.ActiveProgram->data->LinkStatus == linking_success &&
+       glthread->linked_programs) {
+      _mesa_set_add(glthread->linked_programs,
+                    name_key(ctx->Shader.ActiveProgram->Name));
+   }
+   glthread->xfb_active = ctx->TransformFeedback.CurrentObject->Active &&
+                          !ctx->TransformFeedback.CurrentObject->Paused;
+
+   glthread->shadow.viewport[0] = IROUND(ctx->ViewportArray[0].X);
+   glthread->shadow.viewport[1] = IROUND(ctx->ViewportArray[0].Y);
+   glthread->shadow.viewport[2] = IROUND(ctx->ViewportArray[0].Width);
+   glthread->shadow.viewport[3] = IROUND(ctx->ViewportArray[0].Height);
+
+   glthread->shadow.primitive_restart = ctx->Array.PrimitiveRestart;
+   glthread->shadow.primitive_restart_fixed_index =
+      ctx->Array.PrimitiveRestartFixedIndex;
+   glthread->shadow.restart_index = ctx->Array.RestartIndex;
+
+   glthread->shadow.valid = true;
+}
+
+/**
+ * Return the GLTHREAD_CAP_* bit for a glEnable() cap, or 0 if it isn't
+ * shadowed.
+ */
+unsigned
+_mesa_glthread_cap_bit(GLenum cap)
+{
+   switch (cap) {
+   case GL_BLEND:
+      return GLTHREAD_CAP_BLEND;
+   case GL_CULL_FACE:
+      return GLTHREAD_CAP_CULL_FACE;
+   case GL_DEPTH_TEST:
+      return GLTHREAD_CAP_DEPTH_TEST;
+   case GL_STENCIL_TEST:
+      return GLTHREAD_CAP_STENCIL_TEST;
+   case GL_SCISSOR_TEST:
+      return GLTHREAD_CAP_SCISSOR_TEST;
+   case GL_POLYGON_OFFSET_FILL:
+      return GLTHREAD_CAP_POLYGON_OFFSET_FILL;
+   case GL_DITHER:
+      return GLTHREAD_CAP_DITHER;
+   case GL_SAMPLE_ALPHA_TO_COVERAGE:
+      return GLTHREAD_CAP_SAMPLE_ALPHA_TO_COVERAGE;
+   case GL_SAMPLE_COVERAGE:
+      return GLTHREAD_CAP_SAMPLE_COVERAGE;
+   default:
+      return 0;
+   }
+}
+
+/* The functions below are called on the main thread right after the
+ * corresponding command has been queued (or executed synchronously), and
+ * mirror its effect on the shadowed state.  They only replicate the error
+ * checks that don't need any object lookups.
+ */
+
+static void
+set_enable(struct gl_context *ctx, GLenum cap, bool state)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   unsigned bit = _mesa_glthread_cap_bit(cap);
+
+   if (bit) {
+      if (state)
+         glthread->shadow.enables |= bit;
+      else
+         glthread->shadow.enables &= ~bit;
+      return;
+   }
+
+   switch (cap) {
+   case GL_PRIMITIVE_RESTART:
+      if (_mesa_is_desktop_gl(ctx) && ctx->Version >= 31)
+         glthread->shadow.primitive_restart = state;
+      break;
+   case GL_PRIMITIVE_RESTART_FIXED_INDEX:
+      if (_mesa_is_gles3(ctx) || ctx->Extensions.ARB_ES3_compatibility)
+         glthread->shadow.primitive_restart_fixed_index = state;
+      break;
+   case GL_VERTEX_ARRAY:
+   case GL_NORMAL_ARRAY:
+   case GL_COLOR_ARRAY:
+   case GL_TEXTURE_COORD_ARRAY:
+   case GL_INDEX_ARRAY:
+   case GL_EDGE_FLAG_ARRAY:
+   case GL_FOG_COORDINATE_ARRAY:
+   case GL_SECONDARY_COLOR_ARRAY:
+   case GL_POINT_SIZE_ARRAY_OES:
+      /* glEnable() accepts the client state caps too. */
+      _mesa_glthread_ClientState(ctx, cap, state);
+      break;
+   }
+}
+
+void
+_mesa_glthread_Enable(struct gl_context *ctx, GLenum cap)
+{
+   set_enable(ctx, cap, true);
+}
+
+void
+_mesa_glthread_Disable(struct gl_context *ctx, GLenum cap)
+{
+   set_enable(ctx, cap, false);
+}
+
+void
+_mesa_glthread_Viewport(struct gl_context *ctx, GLint x, GLint y,
+                        GLsizei width, GLsizei height)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   GLfloat fx = x, fy = y, fw = width, fh = height;
+
+   if (width < 0 || height < 0)
+      return;
+
+   /* Same as clamp_viewport() in viewport.c. */
+   fw = MIN2(fw, (GLfloat) ctx->Const.MaxViewportWidth);
+   fh = MIN2(fh, (GLfloat) ctx->Const.MaxViewportHeight);
+   if (_mesa_has_ARB_viewport_array(ctx) ||
+       _mesa_has_OES_viewport_array(ctx)) {
+      fx = CLAMP(fx, ctx->Const.ViewportBounds.Min,
+                 ctx->Const.ViewportBounds.Max);
+      fy = CLAMP(fy, ctx->Const.ViewportBounds.Min,
+                 ctx->Const.ViewportBounds.Max);
+   }
+
+   glthread->shadow.viewport[0] = IROUND(fx);
+   glthread->shadow.viewport[1] = IROUND(fy);
+   glthread->shadow.viewport[2] = IROUND(fw);
+   glthread->shadow.viewport[3] = IROUND(fh);
+}
+
+void
+_mesa_glthread_ActiveTexture(struct gl_context *ctx, GLenum texture)
+{
+   const GLuint unit = texture - GL_TEXTURE0;
+   const GLuint k = MAX2(ctx->Const.MaxCombinedTextureImageUnits,
+                         ctx->Const.MaxTextureCoordUnits);
+
+   if (unit < k)
+      ctx->GLThread->shadow.active_texture = unit;
+}
+
+void
+_mesa_glthread_BindTexture(struct gl_context *ctx, GLenum target,
+                           GLuint texture)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   struct hash_entry *entry = NULL;
+
+   if (texture) {
+      if (glthread->known_textures && !objects_are_shared(ctx)) {
+         entry = _mesa_hash_table_search(glthread->known_textures,
+                                         name_key(texture));
+      }
+
+      /* Binding a name that wasn't generated (in core profiles) or a
+       * texture that was first bound to another target fails.
+       */
+      if (!entry ||
+          (entry->data && (GLenum)(uintptr_t)entry->data != target)) {
+         if (target == GL_TEXTURE_2D)
+            _mesa_glthread_invalidate_state(ctx);
+         return;
+      }
+
+      entry->data = (void *)(uintptr_t)target;
+   }
+
+   if (target == GL_TEXTURE_2D)
+      glthread->shadow.texture_2d[glthread->shadow.active_texture] = texture;
+}
+
+void
+_mesa_glthread_GenTextures(struct gl_context *ctx, GLsizei n,
+                           const GLuint *textures)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (n < 0 || !textures || !glthread->known_textures)
+      return;
+
+   for (GLsizei i = 0; i < n; i++)
+      _mesa_hash_table_insert(glthread->known_textures,
+                              name_key(textures[i]), NULL);
+}
+
+void
+_mesa_glthread_PrimitiveRestartIndex(struct gl_context *ctx, GLuint index)
+{
+   if (ctx->Extensions.NV_primitive_restart || ctx->Version >= 31)
+      ctx->GLThread->shadow.restart_index = index;
+}
+
+void
+_mesa_glthread_UseProgram(struct gl_context *ctx, GLuint program)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   /* glUseProgram fails during transform feedback and for programs that
+    * don't exist or aren't linked successfully.
+    */
+   if (glthread->xfb_active ||
+       (program && (!glthread->linked_programs || objects_are_shared(ctx) ||
+                    !_mesa_set_search(glthread->linked_programs,
+                                      name_key(program))))) {
+      _mesa_glthread_invalidate_state(ctx);
+      return;
+   }
+
+   glthread->shadow.current_program = program;
+}
+
+void
+_mesa_glthread_LinkProgram(struct gl_context *ctx, GLuint program)
+{
+   forget_names(ctx->GLThread->linked_programs, 1, &program);
+}
+
+void
+_mesa_glthread_DeleteProgram(struct gl_context *ctx, GLuint program)
+{
+   forget_names(ctx->GLThread->linked_programs, 1, &program);
+}
+
+/**
+ * Called after glGetProgramiv, which waited for the worker thread, so the
+ * link status can be read from the context directly.
+ */
+void
+_mesa_glthread_GetProgramiv(struct gl_context *ctx, GLuint program,
+                            GLenum pname)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   struct gl_shader_program *shProg;
+
+   if (pname != GL_LINK_STATUS || !program || !glthread->linked_programs)
+      return;
+
+   shProg = _mesa_lookup_shader_program(ctx, program);
+   if (shProg && shProg->data->LinkStatus == linking_success)
+      _mesa_set_add(glthread->linked_programs, name_key(program));
+   else
+      forget_names(glthread->linked_programs, 1, &program);
+}
+
+void
+_mesa_glthread_BeginTransformFeedback(struct gl_context *ctx)
+{
+   ctx->GLThread->xfb_active = true;
+}
+
+void
+_mesa_glthread_EndTransformFeedback(struct gl_context *ctx)
+{
+   ctx->GLThread->xfb_active = false;
+}
+
+/**
+ * glBindFramebuffer in desktop GL only accepts names returned by
+ * glGenFramebuffers or glCreateFramebuffers, while GLES and
+ * glBindFramebufferEXT create the object for any name.
+ */
+void
+_mesa_glthread_BindFramebuffer(struct gl_context *ctx, GLenum target,
+                               GLuint framebuffer, bool allow_user_names)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   const bool have_fb_blit = _mesa_is_gles3(ctx) || _mesa_is_desktop_gl(ctx);
+
+   if (target != GL_FRAMEBUFFER &&
+       (!have_fb_blit || (target != GL_DRAW_FRAMEBUFFER &&
+                          target != GL_READ_FRAMEBUFFER)))
+      return;
+
+   /* Framebuffer objects aren't shared. */
+   if (framebuffer && !allow_user_names &&
+       !is_known_name(ctx, glthread->known_framebuffers, framebuffer,
+                      false)) {
+      _mesa_glthread_invalidate_state(ctx);
+      return;
+   }
+
+   if (target != GL_READ_FRAMEBUFFER)
+      glthread->shadow.draw_framebuffer = framebuffer;
+   if (target != GL_DRAW_FRAMEBUFFER)
+      glthread->shadow.read_framebuffer = framebuffer;
+}
+
+void
+_mesa_glthread_GenFramebuffers(struct gl_context *ctx, GLsizei n,
+                               const GLuint *framebuffers)
+{
+   remember_names(ctx->GLThread->known_framebuffers, n, framebuffers);
+}
+
+/** Same as _mesa_glthread_BindFramebuffer(), for renderbuffers. */
+void
+_mesa_glthread_BindRenderbuffer(struct gl_context *ctx, GLenum target,
+                                GLuint renderbuffer, bool allow_user_names)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (target != GL_RENDERBUFFER)
+      return;
+
+   if (renderbuffer && !allow_user_names &&
+       !is_known_name(ctx, glthread->known_renderbuffers, renderbuffer,
+                      true)) {
+      _mesa_glthread_invalidate_state(ctx);
+      return;
+   }
+
+   glthread->shadow.renderbuffer = renderbuffer;
+}
+
+void
+_mesa_glthread_GenRenderbuffers(struct gl_context *ctx, GLsizei n,
+                                const GLuint *renderbuffers)
+{
+   remember_names(ctx->GLThread->known_renderbuffers, n, renderbuffers);
+}
+
+/**
+ * Whether glBindBuffer(buffer) is known to succeed.  Only core profiles
+ * reject names that weren't generated; the others create the buffer.
+ */
+bool
+_mesa_glthread_can_bind_buffer(struct gl_context *ctx, GLuint buffer)
+{
+   return !buffer || ctx->API != API_OPENGL_CORE ||
+          is_known_name(ctx, ctx->GLThread->known_buffers, buffer, true);
+}
+
+void
+_mesa_glthread_GenBuffers(struct gl_context *ctx, GLsizei n,
+                          const GLuint *buffers)
+{
+   remember_names(ctx->GLThread->known_buffers, n, buffers);
+}
+
+void
+_mesa_glthread_BindVertexArray(struct gl_context *ctx, GLuint array)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   /* Vertex array objects aren't shared, but binding a name that wasn't
+    * returned by glGenVertexArrays or glCreateVertexArrays fails.
+    */
+   if (array && (!glthread->known_vertex_arrays ||
+                 !_mesa_set_search(glthread->known_vertex_arrays,
+                                   name_key(array)))) {
+      _mesa_glthread_invalidate_state(ctx);
+      return;
+   }
+
+   glthread->shadow.vertex_array = array;
+}
+
+void
+_mesa_glthread_GenVertexArrays(struct gl_context *ctx, GLsizei n,
+                               const GLuint *arrays)
+{
+   remember_names(ctx->GLThread->known_vertex_arrays, n, arrays);
+}
+
+static void
+unbind_deleted(GLuint *binding, GLsizei n, const GLuint *names)
+{
+   for (GLsizei i = 0; i < n; i++) {
+      if (names[i] && names[i] == *binding) {
+         *binding = 0;
+         return;
+      }
+   }
+}
+
+void
+_mesa_glthread_DeleteBuffers(struct gl_context *ctx, GLsizei n,
+                             const GLuint *buffers)
+{
+   if (buffers)
+      unbind_deleted(&ctx->GLThread->shadow.array_buffer, n, buffers);
+   forget_names(ctx->GLThread->known_buffers, n, buffers);
+}
+
+void
+_mesa_glthread_DeleteTextures(struct gl_context *ctx, GLsizei n,
+                              const GLuint *textures)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (!textures)
+      return;
+
+   for (unsigned i = 0; i < ARRAY_SIZE(glthread->shadow.texture_2d); i++)
+      unbind_deleted(&glthread->shadow.texture_2d[i], n, textures);
+
+   for (GLsizei i = 0; glthread->known_textures && i < n; i++) {
+      struct hash_table *ht = glthread->known_textures;
+      struct hash_entry *entry;
+
+      if (!textures[i])
+         continue;
+      entry = _mesa_hash_table_search(ht, name_key(textures[i]));
+      _mesa_hash_table_remove(ht, entry);
+   }
+}
+
+void
+_mesa_glthread_DeleteFramebuffers(struct gl_context *ctx, GLsizei n,
+                                  const GLuint *framebuffers)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (!framebuffers)
+      return;
+
+   unbind_deleted(&glthread->shadow.draw_framebuffer, n, framebuffers);
+   unbind_deleted(&glthread->shadow.read_framebuffer, n, framebuffers);
+   forget_names(glthread->known_framebuffers, n, framebuffers);
+}
+
+void
+_mesa_glthread_DeleteRenderbuffers(struct gl_context *ctx, GLsizei n,
+                                   const GLuint *renderbuffers)
+{
+   if (renderbuffers)
+      unbind_deleted(&ctx->GLThread->shadow.renderbuffer, n, renderbuffers);
+   forget_names(ctx->GLThread->known_renderbuffers, n, renderbuffers);
+}
+
+void
+_mesa_glthread_DeleteVertexArrays(struct gl_context *ctx, GLsizei n,
+                                  const GLuint *arrays)
+{
+   if (arrays)
+      unbind_deleted(&ctx->GLThread->shadow.vertex_array, n, arrays);
+   forget_names(ctx->GLThread->known_vertex_arrays, n, arrays);
 }
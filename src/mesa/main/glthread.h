@@ -45,12 +45,39 @@
  */
 #define MARSHAL_MAX_BATCHES 8
 
+/* The maximum amount of staging memory holding copies of large uploads and
+ * user vertex arrays for commands that haven't been executed yet.  When it is
+ * exceeded, the application thread waits for the worker thread to catch up.
+ */
+#define MARSHAL_MAX_STAGING_SIZE (64 * 1024 * 1024)
+
 #include <inttypes.h>
 #include <stdbool.h>
 #include "util/u_queue.h"
 
+struct hash_table;
+struct set;
+
 enum marshal_dispatch_cmd_id;
 
+/**
+ * A vertex array in user memory, as specified by the application.  Only
+ * what's needed to compute the range of memory a draw call reads is kept.
+ */
+struct glthread_attrib
+{
+   const GLubyte *pointer;
+
+   /** Distance between elements in bytes, never 0. */
+   GLsizei stride;
+
+   /** Size of one element in bytes. */
+   unsigned element_size;
+
+   /** Instance divisor, or 0 for per-vertex arrays. */
+   unsigned divisor;
+};
+
 /** A single batch of commands queued up for execution. */
 struct glthread_batch
 {
@@ -95,6 +122,114 @@ struct glthread_state
     * buffer) binding is in a VBO.
     */
    bool element_array_is_vbo;
+
+   /**
+    * True if the worker thread has executed everything queued so far and
+    * nothing has been queued since.  Set by _mesa_glthread_finish() and
+    * cleared by _mesa_glthread_allocate_command().
+    */
+   bool idle;
+
+   /**
+    * Shadow copy of frequently queried state, owned by the main thread.
+    *
+    * It is updated from the marshalling functions as the commands are
+    * queued, so that glGet*() and glIsEnabled() for these values can be
+    * answered without waiting for the worker thread.  Commands that affect
+    * the state in ways that aren't tracked here (glPopAttrib, display lists,
+    * indexed and multi-bind variants) invalidate the whole shadow, and it is
+    * reloaded from the context at the next query that needs it.
+    *
+    * A call only updates the shadow when it is known to succeed.  Calls
+    * that may generate a GL error, such as binding an object the main
+    * thread hasn't seen being created, invalidate the shadow instead.
+    */
+   struct {
+      bool valid;
+
+      /** Bitmask of GLTHREAD_CAP_* for the tracked glEnable() caps. */
+      unsigned enables;
+
+      GLuint array_buffer;
+      GLuint vertex_array;
+      GLuint current_program;
+      GLuint draw_framebuffer;
+      GLuint read_framebuffer;
+      GLuint renderbuffer;
+
+      /** Index of the active texture unit (not the GL_TEXTUREi enum). */
+      unsigned active_texture;
+      GLuint texture_2d[MAX_COMBINED_TEXTURE_IMAGE_UNITS];
+
+      GLint viewport[4];
+
+      bool primitive_restart;
+      bool primitive_restart_fixed_index;
+      GLuint restart_index;
+   } shadow;
+
+   /**
+    * Vertex arrays of the current vertex array object, tracked by the main
+    * thread to upload user-pointer arrays when a draw call is queued.
+    *
+    * This is only used outside of core contexts, where binding a vertex
+    * array object turns glthread off, so the current one is always the
+    * default one.  When the arrays are changed in ways we don't follow
+    * (InterleavedArrays, ARB_vertex_attrib_binding, PopClientAttrib),
+    * arrays_valid is cleared and the next draw call that needs them
+    * synchronizes and reloads them from the context.
+    */
+   bool arrays_valid;
+   unsigned client_active_texture;
+   GLbitfield enabled_arrays;   /**< VERT_BIT_* */
+   GLbitfield user_arrays;      /**< VERT_BIT_* of arrays not in a VBO */
+   struct glthread_attrib attribs[VERT_ATTRIB_MAX];
+
+   /**
+    * Objects the main thread has seen being created, used to tell whether
+    * glBindTexture, glBindVertexArray, glUseProgram and the buffer,
+    * framebuffer and renderbuffer binds will succeed.
+    *
+    * known_textures maps texture names to the target they were first bound
+    * to, or to 0 if they haven't been bound yet.  linked_programs contains
+    * the programs whose last link is known to have succeeded.  Names that
+    * aren't found here are treated as possibly invalid.  Any of these may be
+    * NULL if allocation failed, in which case no name is known.
+    */
+   struct hash_table *known_textures;
+   struct set *known_vertex_arrays;
+   struct set *known_buffers;
+   struct set *known_framebuffers;
+   struct set *known_renderbuffers;
+   struct set *linked_programs;
+
+   /**
+    * Whether transform feedback may be active and not paused, during which
+    * glUseProgram fails.
+    */
+   bool xfb_active;
+
+   /** Staging memory allocated by the main thread and not freed yet. */
+   int64_t staging_bytes;
+
+   /**
+    * Number of synchronizations per GL entry point, keyed by function name.
+    * Only allocated when MESA_GLTHREAD_SYNC_STATS is set.
+    */
+   struct hash_table *sync_stats;
+};
+
+/** Bits of glthread_state::shadow.enables */
+enum {
+   GLTHREAD_CAP_BLEND                    = 1 << 0,
+   GLTHREAD_CAP_CULL_FACE                = 1 << 1,
+   GLTHREAD_CAP_DEPTH_TEST               = 1 << 2,
+   GLTHREAD_CAP_STENCIL_TEST             = 1 << 3,
+   GLTHREAD_CAP_SCISSOR_TEST             = 1 << 4,
+   GLTHREAD_CAP_POLYGON_OFFSET_FILL      = 1 << 5,
+   GLTHREAD_CAP_DITHER                   = 1 << 6,
+   GLTHREAD_CAP_SAMPLE_ALPHA_TO_COVERAGE = 1 << 7,
+   GLTHREAD_CAP_SAMPLE_COVERAGE          = 1 << 8,
 };
 
 void _mesa_glthread_init(struct gl_context *ctx);
@@ -103,5 +238,88 @@ void _mesa_glthread_destroy(struct gl_context *ctx);
 void _mesa_glthread_restore_dispatch(struct gl_context *ctx);
 void _mesa_glthread_flush_batch(struct gl_context *ctx);
 void _mesa_glthread_finish(struct gl_context *ctx);
+void _mesa_glthread_finish_before(struct gl_context *ctx, const char *func);
+
+void *_mesa_glthread_staging_alloc(struct gl_context *ctx, size_t size,
+                                   const char *func);
+void _mesa_glthread_staging_free(struct gl_context *ctx, void *ptr,
+                                 size_t size);
+
+void _mesa_glthread_invalidate_state(struct gl_context *ctx);
+void _mesa_glthread_validate_state(struct gl_context *ctx);
+unsigned _mesa_glthread_cap_bit(GLenum cap);
+
+void _mesa_glthread_Enable(struct gl_context *ctx, GLenum cap);
+void _mesa_glthread_Disable(struct gl_context *ctx, GLenum cap);
+void _mesa_glthread_Viewport(struct gl_context *ctx, GLint x, GLint y,
+                             GLsizei width, GLsizei height);
+void _mesa_glthread_ActiveTexture(struct gl_context *ctx, GLenum texture);
+void _mesa_glthread_BindTexture(struct gl_context *ctx, GLenum target,
+                                GLuint texture);
+void _mesa_glthread_GenTextures(struct gl_context *ctx, GLsizei n,
+                                const GLuint *textures);
+void _mesa_glthread_UseProgram(struct gl_context *ctx, GLuint program);
+void _mesa_glthread_LinkProgram(struct gl_context *ctx, GLuint program);
+void _mesa_glthread_DeleteProgram(struct gl_context *ctx, GLuint program);
+void _mesa_glthread_GetProgramiv(struct gl_context *ctx, GLuint program,
+                                 GLenum pname);
+void _mesa_glthread_BeginTransformFeedback(struct gl_context *ctx);
+void _mesa_glthread_EndTransformFeedback(struct gl_context *ctx);
+void _mesa_glthread_BindFramebuffer(struct gl_context *ctx, GLenum target,
+                                    GLuint framebuffer,
+                                    bool allow_user_names);
+void _mesa_glthread_GenFramebuffers(struct gl_context *ctx, GLsizei n,
+                                    const GLuint *framebuffers);
+void _mesa_glthread_BindRenderbuffer(struct gl_context *ctx, GLenum target,
+                                     GLuint renderbuffer,
+                                     bool allow_user_names);
+void _mesa_glthread_GenRenderbuffers(struct gl_context *ctx, GLsizei n,
+                                     const GLuint *renderbuffers);
+bool _mesa_glthread_can_bind_buffer(struct gl_context *ctx, GLuint buffer);
+void _mesa_glthread_GenBuffers(struct gl_context *ctx, GLsizei n,
+                               const GLuint *buffers);
+void _mesa_glthread_BindVertexArray(struct gl_context *ctx, GLuint array);
+void _mesa_glthread_GenVertexArrays(struct gl_context *ctx, GLsizei n,
+                                    const GLuint *arrays);
+void _mesa_glthread_DeleteBuffers(struct gl_context *ctx, GLsizei n,
+                                  const GLuint *buffers);
+void _mesa_glthread_DeleteTextures(struct gl_context *ctx, GLsizei n,
+                                   const GLuint *textures);
+void _mesa_glthread_DeleteFramebuffers(struct gl_context *ctx, GLsizei n,
+                                       const GLuint *framebuffers);
+void _mesa_glthread_DeleteRenderbuffers(struct gl_context *ctx, GLsizei n,
+                                        const GLuint *renderbuffers);
+void _mesa_glthread_DeleteVertexArrays(struct gl_context *ctx, GLsizei n,
+                                       const GLuint *arrays);
+void _mesa_glthread_PrimitiveRestartIndex(struct gl_context *ctx,
+                                          GLuint index);
+
+void _mesa_glthread_invalidate_arrays(struct gl_context *ctx);
+void _mesa_glthread_validate_arrays(struct gl_context *ctx);
+void _mesa_glthread_ClientState(struct gl_context *ctx, GLenum array,
+                                bool enable);
+void _mesa_glthread_VertexAttribArray(struct gl_context *ctx, GLuint index,
+                                      bool enable);
+void _mesa_glthread_ClientActiveTexture(struct gl_context *ctx,
+                                        GLenum texture);
+void _mesa_glthread_AttribPointer(struct gl_context *ctx,
+                                  gl_vert_attrib attrib, GLint size,
+                                  GLenum type, GLsizei stride,
+                                  const void *pointer);
+void _mesa_glthread_TexCoordPointer(struct gl_context *ctx, GLint size,
+                                    GLenum type, GLsizei stride,
+                                    const void *pointer);
+void _mesa_glthread_VertexAttribPointer(struct gl_context *ctx, GLuint index,
+                                        GLint size, GLenum type,
+                                        GLsizei stride, const void *pointer);
+void _mesa_glthread_VertexAttribIPointer(struct gl_context *ctx, GLuint index,
+                                         GLint size, GLenum type,
+                                         GLsizei stride, const void *pointer);
+void _mesa_glthread_VertexAttribLPointer(struct gl_context *ctx, GLuint index,
+                                         GLint size, GLenum type,
+                                         GLsizei stride, const void *pointer);
+void _mesa_glthread_VertexAttribDivisor(struct gl_context *ctx, GLuint index,
+                                        GLuint divisor);
+void _mesa_glthread_PopClientAttrib(struct gl_context *ctx);
 
 #endif /* _GLTHREAD_H*/
@@ -0,0 +1,401 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/** @file glthread_varray.c
+ *
+ * Main thread tracking of the vertex arrays in user memory.
+ *
+ * Draw calls that read user arrays can't be queued as-is, because the
+ * application may change or free the memory as soon as the call returns.
+ * The functions here mirror the gl*Pointer() and array enable calls on the
+ * main thread, so that the draw marshalling code knows which arrays it has
+ * to copy and where they are.
+ */
+
+#include "main/mtypes.h"
+#include "main/bufferobj.h"
+#include "main/context.h"
+#include "main/glformats.h"
+#include "main/glthread.h"
+#include "main/marshal.h"
+
+
+/**
+ * Forget the tracked arrays.  The next draw call using user arrays will
+ * synchronize and reload them from the context.
+ */
+void
+_mesa_glthread_invalidate_arrays(struct gl_context *ctx)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (glthread)
+      glthread->arrays_valid = false;
+}
+
+void
+_mesa_glthread_PopClientAttrib(struct gl_context *ctx)
+{
+   _mesa_glthread_invalidate_state(ctx);
+   _mesa_glthread_invalidate_arrays(ctx);
+}
+
+/**
+ * Reload the tracked arrays from the context.  The worker thread must be
+ * idle.
+ */
+void
+_mesa_glthread_validate_arrays(struct gl_context *ctx)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   struct gl_vertex_array_object *vao = ctx->Array.VAO;
+
+   glthread->enabled_arrays = 0;
+   glthread->user_arrays = 0;
+   glthread->client_active_texture = ctx->Array.ActiveTexture;
+   glthread->vertex_array_is_vbo =
+      _mesa_is_bufferobj(ctx->Array.ArrayBufferObj);
+   glthread->element_array_is_vbo = _mesa_is_bufferobj(vao->IndexBufferObj);
+
+   for (unsigned i = 0; i < VERT_ATTRIB_MAX; i++) {
+      const struct gl_array_attributes *array = &vao->VertexAttrib[i];
+      const struct gl_vertex_buffer_binding *binding =
+         &vao->BufferBinding[array->BufferBindingIndex];
+      struct glthread_attrib *attrib = &glthread->attribs[i];
+
+      if (array->Enabled)
+         glthread->enabled_arrays |= VERT_BIT(i);
+
+      if (_mesa_is_bufferobj(binding->BufferObj))
+         continue;
+
+      /* The draw code only knows how to redirect arrays set up by the
+       * gl*Pointer() functions.  Anything else has to be synchronous, which
+       * we get by leaving arrays_valid unset.
+       */
+      if (array->BufferBindingIndex != i || array->RelativeOffset != 0)
+         return;
+
+      glthread->user_arrays |= VERT_BIT(i);
+      attrib->pointer = array->Ptr;
+      attrib->stride = binding->Stride;
+      attrib->element_size = array->_ElementSize;
+      attrib->divisor = binding->InstanceDivisor;
+   }
+
+   glthread->arrays_valid = true;
+}
+
+static gl_vert_attrib
+client_state_attrib(struct gl_context *ctx, GLenum array)
+{
+   const bool compat = ctx->API == API_OPENGL_COMPAT;
+   const bool gles1 = ctx->API == API_OPENGLES;
+
+   switch (array) {
+   case GL_VERTEX_ARRAY:
+      return compat || gles1 ? VERT_ATTRIB_POS : VERT_ATTRIB_MAX;
+   case GL_NORMAL_ARRAY:
+      return compat || gles1 ? VERT_ATTRIB_NORMAL : VERT_ATTRIB_MAX;
+   case GL_COLOR_ARRAY:
+      return compat || gles1 ? VERT_ATTRIB_COLOR0 : VERT_ATTRIB_MAX;
+   case GL_TEXTURE_COORD_ARRAY:
+      return compat || gles1 ?
+         VERT_ATTRIB_TEX(ctx->GLThread->client_active_texture) :
+         VERT_ATTRIB_MAX;
+   case GL_INDEX_ARRAY:
+      return compat ? VERT_ATTRIB_COLOR_INDEX : VERT_ATTRIB_MAX;
+   case GL_EDGE_FLAG_ARRAY:
+      return compat ? VERT_ATTRIB_EDGEFLAG : VERT_ATTRIB_MAX;
+   case GL_FOG_COORDINATE_ARRAY:
+      return compat ? VERT_ATTRIB_FOG : VERT_ATTRIB_MAX;
+   case GL_SECONDARY_COLOR_ARRAY:
+      return compat ? VERT_ATTRIB_COLOR1 : VERT_ATTRIB_MAX;
+   case GL_POINT_SIZE_ARRAY_OES:
+      return gles1 ? VERT_ATTRIB_POINT_SIZE : VERT_ATTRIB_MAX;
+   default:
+      return VERT_ATTRIB_MAX;
+   }
+}
+
+static void
+set_array_enabled(struct glthread_state *glthread, gl_vert_attrib attrib,
+                  bool enable)
+{
+   if (enable)
+      glthread->enabled_arrays |= VERT_BIT(attrib);
+   else
+      glthread->enabled_arrays &= ~VERT_BIT(attrib);
+}
+
+void
+_mesa_glthread_ClientState(struct gl_context *ctx, GLenum array, bool enable)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (array == GL_PRIMITIVE_RESTART_NV) {
+      if (ctx->Extensions.NV_primitive_restart)
+         glthread->shadow.primitive_restart = enable;
+      return;
+   }
+
+   gl_vert_attrib attrib = client_state_attrib(ctx, array);
+   if (attrib < VERT_ATTRIB_MAX)
+      set_array_enabled(glthread, attrib, enable);
+}
+
+void
+_mesa_glthread_VertexAttribArray(struct gl_context *ctx, GLuint index,
+                                 bool enable)
+{
+   if (index < ctx->Const.Program[MESA_SHADER_VERTEX].MaxAttribs)
+      set_array_enabled(ctx->GLThread, VERT_ATTRIB_GENERIC(index), enable);
+}
+
+void
+_mesa_glthread_ClientActiveTexture(struct gl_context *ctx, GLenum texture)
+{
+   const GLuint unit = texture - GL_TEXTURE0;
+
+   if (unit < ctx->Const.MaxTextureCoordUnits)
+      ctx->GLThread->client_active_texture = unit;
+}
+
+/* The array types glthread accepts without knowing the enabled extensions,
+ * as bits of (type - GL_BYTE).  HALF_FLOAT, FIXED on desktop GL and the
+ * packed types depend on extensions and aren't included.
+ */
+#define TYPE_BIT(type)   (1u << ((type) - GL_BYTE))
+#define INTEGER_TYPES    (TYPE_BIT(GL_BYTE) | TYPE_BIT(GL_UNSIGNED_BYTE) | \
+                          TYPE_BIT(GL_SHORT) | TYPE_BIT(GL_UNSIGNED_SHORT) | \
+                          TYPE_BIT(GL_INT) | TYPE_BIT(GL_UNSIGNED_INT))
+#define GLES1_TYPES      (TYPE_BIT(GL_BYTE) | TYPE_BIT(GL_SHORT) | \
+                          TYPE_BIT(GL_FLOAT) | TYPE_BIT(GL_FIXED))
+
+/**
+ * Whether a gl*Pointer() call passes the size, type and stride checks of
+ * the same entry point in varray.c.  \p types is a mask of TYPE_BIT() and
+ * may be a subset of what varray.c accepts, in which case some valid calls
+ * are reported as failing.
+ */
+static bool
+is_valid_pointer(const struct gl_context *ctx, GLbitfield types,
+                 GLint min_size, GLint max_size, bool allow_bgra,
+                 GLint size, GLenum type, GLsizei stride)
+{
+   if (type < GL_BYTE || type > GL_FIXED || !(types & TYPE_BIT(type)))
+      return false;
+
+   if (size == GL_BGRA) {
+      if (!allow_bgra || _mesa_is_gles(ctx) || type != GL_UNSIGNED_BYTE)
+         return false;
+   } else if (size < min_size || size > max_size) {
+      return false;
+   }
+
+   if (stride < 0)
+      return false;
+
+   if (ctx->API == API_OPENGL_CORE && ctx->Version >= 44 &&
+       stride > ctx->Const.MaxVertexAttribStride)
+      return false;
+
+   return true;
+}
+
+/**
+ * Record a gl*Pointer() call.  If it may have failed, the tracked arrays
+ * are invalidated instead: a call that fails some checks in varray.c still
+ * changes the array, so leaving it untouched isn't right either.
+ */
+static void
+attrib_pointer(struct gl_context *ctx, gl_vert_attrib attrib, bool valid,
+               GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   struct glthread_attrib *array = &glthread->attribs[attrib];
+
+   if (!valid) {
+      _mesa_glthread_invalidate_arrays(ctx);
+      return;
+   }
+
+   if (size == GL_BGRA)
+      size = 4;
+
+   GLint element_size = _mesa_bytes_per_vertex_attrib(size, type);
+   assert(element_size > 0);
+
+   array->pointer = pointer;
+   array->element_size = element_size;
+   array->stride = stride ? stride : element_size;
+
+   if (glthread->vertex_array_is_vbo)
+      glthread->user_arrays &= ~VERT_BIT(attrib);
+   else
+      glthread->user_arrays |= VERT_BIT(attrib);
+}
+
+/**
+ * Record a fixed-function gl*Pointer() call, other than glTexCoordPointer.
+ */
+void
+_mesa_glthread_AttribPointer(struct gl_context *ctx, gl_vert_attrib attrib,
+                             GLint size, GLenum type, GLsizei stride,
+                             const void *pointer)
+{
+   const bool gles1 = ctx->API == API_OPENGLES;
+   const GLbitfield float_types = TYPE_BIT(GL_FLOAT) | TYPE_BIT(GL_DOUBLE);
+   bool valid;
+
+   switch (attrib) {
+   case VERT_ATTRIB_POS:
+      valid = is_valid_pointer(ctx, gles1 ? GLES1_TYPES :
+                               TYPE_BIT(GL_SHORT) | TYPE_BIT(GL_INT) |
+                               float_types,
+                               2, 4, false, size, type, stride);
+      break;
+   case VERT_ATTRIB_NORMAL:
+      valid = is_valid_pointer(ctx, gles1 ? GLES1_TYPES :
+                               TYPE_BIT(GL_BYTE) | TYPE_BIT(GL_SHORT) |
+                               TYPE_BIT(GL_INT) | float_types,
+                               3, 3, false, size, type, stride);
+      break;
+   case VERT_ATTRIB_COLOR0:
+      valid = is_valid_pointer(ctx, gles1 ?
+                               TYPE_BIT(GL_UNSIGNED_BYTE) |
+                               TYPE_BIT(GL_FLOAT) | TYPE_BIT(GL_FIXED) :
+                               INTEGER_TYPES | float_types,
+                               gles1 ? 4 : 3, 4, true, size, type, stride);
+      break;
+   case VERT_ATTRIB_COLOR1:
+      valid = is_valid_pointer(ctx, INTEGER_TYPES | float_types,
+                               3, 4, true, size, type, stride);
+      break;
+   case VERT_ATTRIB_FOG:
+      valid = is_valid_pointer(ctx, float_types,
+                               1, 1, false, size, type, stride);
+      break;
+   case VERT_ATTRIB_COLOR_INDEX:
+      valid = is_valid_pointer(ctx, TYPE_BIT(GL_UNSIGNED_BYTE) |
+                               TYPE_BIT(GL_SHORT) | TYPE_BIT(GL_INT) |
+                               float_types,
+                               1, 1, false, size, type, stride);
+      break;
+   case VERT_ATTRIB_EDGEFLAG:
+      valid = is_valid_pointer(ctx, TYPE_BIT(GL_UNSIGNED_BYTE),
+                               1, 1, false, size, type, stride);
+      break;
+   case VERT_ATTRIB_POINT_SIZE:
+      valid = is_valid_pointer(ctx, TYPE_BIT(GL_FLOAT) | TYPE_BIT(GL_FIXED),
+                               1, 1, false, size, type, stride);
+      break;
+   default:
+      unreachable("not a fixed-function array");
+   }
+
+   attrib_pointer(ctx, attrib, valid, size, type, stride, pointer);
+}
+
+void
+_mesa_glthread_TexCoordPointer(struct gl_context *ctx, GLint size,
+                               GLenum type, GLsizei stride,
+                               const void *pointer)
+{
+   const bool gles1 = ctx->API == API_OPENGLES;
+   unsigned unit = ctx->GLThread->client_active_texture;
+   bool valid =
+      is_valid_pointer(ctx, gles1 ? GLES1_TYPES :
+                       TYPE_BIT(GL_SHORT) | TYPE_BIT(GL_INT) |
+                       TYPE_BIT(GL_FLOAT) | TYPE_BIT(GL_DOUBLE),
+                       gles1 ? 2 : 1, 4, false, size, type, stride);
+
+   attrib_pointer(ctx, VERT_ATTRIB_TEX(unit), valid, size, type, stride,
+                  pointer);
+}
+
+/**
+ * glVertexAttribPointer.  GL_BGRA also requires normalized to be true,
+ * which isn't passed here, so it is treated as possibly invalid.
+ */
+void
+_mesa_glthread_VertexAttribPointer(struct gl_context *ctx, GLuint index,
+                                   GLint size, GLenum type, GLsizei stride,
+                                   const void *pointer)
+{
+   GLbitfield types = INTEGER_TYPES | TYPE_BIT(GL_FLOAT);
+
+   if (index >= ctx->Const.Program[MESA_SHADER_VERTEX].MaxAttribs)
+      return;
+
+   if (_mesa_is_gles(ctx)) {
+      types |= TYPE_BIT(GL_FIXED);
+      if (ctx->Version < 30)
+         types &= ~(TYPE_BIT(GL_INT) | TYPE_BIT(GL_UNSIGNED_INT));
+   } else {
+      types |= TYPE_BIT(GL_DOUBLE);
+   }
+
+   attrib_pointer(ctx, VERT_ATTRIB_GENERIC(index),
+                  is_valid_pointer(ctx, types, 1, 4, false,
+                                   size, type, stride),
+                  size, type, stride, pointer);
+}
+
+void
+_mesa_glthread_VertexAttribIPointer(struct gl_context *ctx, GLuint index,
+                                    GLint size, GLenum type, GLsizei stride,
+                                    const void *pointer)
+{
+   if (index >= ctx->Const.Program[MESA_SHADER_VERTEX].MaxAttribs)
+      return;
+
+   attrib_pointer(ctx, VERT_ATTRIB_GENERIC(index),
+                  is_valid_pointer(ctx, INTEGER_TYPES, 1, 4, false,
+                                   size, type, stride),
+                  size, type, stride, pointer);
+}
+
+void
+_mesa_glthread_VertexAttribLPointer(struct gl_context *ctx, GLuint index,
+                                    GLint size, GLenum type, GLsizei stride,
+                                    const void *pointer)
+{
+   if (index >= ctx->Const.Program[MESA_SHADER_VERTEX].MaxAttribs)
+      return;
+
+   attrib_pointer(ctx, VERT_ATTRIB_GENERIC(index),
+                  is_valid_pointer(ctx, TYPE_BIT(GL_DOUBLE), 1, 4, false,
+                                   size, type, stride),
+                  size, type, stride, pointer);
+}
+
+void
+_mesa_glthread_VertexAttribDivisor(struct gl_context *ctx, GLuint index,
+                                   GLuint divisor)
+{
+   if (index >= ctx->Const.Program[MESA_SHADER_VERTEX].MaxAttribs)
+      return;
+
+   ctx->GLThread->attribs[VERT_ATTRIB_GENERIC(index)].divisor = divisor;
+}
@@ -37,6 +37,7 @@
 #include "glheader.h"
 #include "hash.h"
 #include "util/hash_table.h"
+#include "util/u_atomic.h"
 
 
 /**
@@ -87,18 +88,71 @@ _mesa_DeleteHashTable(struct _mesa_HashTable *table)
 {
    assert(table);
 
-   if (_mesa_hash_table_next_entry(table->ht, NULL) != NULL) {
+   if (table->NumDirect ||
+       _mesa_hash_table_next_entry(table->ht, NULL) != NULL) {
       _mesa_problem(NULL, "In _mesa_DeleteHashTable, found non-freed data");
    }
 
    _mesa_hash_table_destroy(table->ht, NULL);
 
+   for (unsigned i = 0; i < HASH_DIRECT_PAGES; i++)
+      free(table->direct[i]);
+
    mtx_destroy(&table->Mutex);
    free(table);
 }
 
 
 
+/**
+ * Lookup a key below HASH_DIRECT_MAX_KEY.  This is safe without the mutex.
+ */
+static inline void *
+direct_lookup(const struct _mesa_HashTable *table, GLuint key)
+{
+   void **page = p_atomic_read(&table->direct[key >> HASH_DIRECT_PAGE_SHIFT]);
+
+   if (!page)
+      return NULL;
+
+   return p_atomic_read(&page[key & (HASH_DIRECT_PAGE_SIZE - 1)]);
+}
+
+
+/**
+ * Set the entry for a key below HASH_DIRECT_MAX_KEY.  The mutex must be
+ * held.
+ *
+ * \return false if the page couldn't be allocated
+ */
+static bool
+direct_set(struct _mesa_HashTable *table, GLuint key, void *data)
+{
+   void ***pagep = &table->direct[key >> HASH_DIRECT_PAGE_SHIFT];
+   void **page = *pagep;
+
+   if (!page) {
+      if (!data)
+         return true;
+
+      page = calloc(HASH_DIRECT_PAGE_SIZE, sizeof(void *));
+      if (!page)
+         return false;
+      p_atomic_set(pagep, page);
+   }
+
+   void **slot = &page[key & (HASH_DIRECT_PAGE_SIZE - 1)];
+
+   if (!*slot && data)
+      table->NumDirect++;
+   else if (*slot && !data)
+      table->NumDirect--;
+
+   p_atomic_set(slot, data);
+   return true;
+}
+
+
 /**
  * Lookup an entry in the hash table, without locking.
  * \sa _mesa_HashLookup
@@ -111,8 +165,8 @@ _mesa_HashLookup_unlocked(struct _mesa_HashTable *table, GLuint key)
    assert(table);
    assert(key);
 
-   if (key == DELETED_KEY_VALUE)
-      return table->deleted_key_data;
+   if (key < HASH_DIRECT_MAX_KEY)
+      return direct_lookup(table, key);
 
    entry = _mesa_hash_table_search_pre_hashed(table->ht,
                                               uint_hash(key),
@@ -136,6 +190,14 @@ void *
 _mesa_HashLookup(struct _mesa_HashTable *table, GLuint key)
 {
    void *res;
+
+   assert(table);
+   assert(key);
+
+   /* The common case doesn't need the lock. */
+   if (key < HASH_DIRECT_MAX_KEY)
+      return direct_lookup(table, key);
+
    _mesa_HashLockMutex(table);
    res = _mesa_HashLookup_unlocked(table, key);
    _mesa_HashUnlockMutex(table);
@@ -173,8 +235,9 @@ _mesa_HashInsert_unlocked(struct _mesa_HashTable *table, GLuint key, void *data)
    if (key > table->MaxKey)
       table->MaxKey = key;
 
-   if (key == DELETED_KEY_VALUE) {
-      table->deleted_key_data = data;
+   if (key < HASH_DIRECT_MAX_KEY) {
+      if (!direct_set(table, key, data))
+         _mesa_error_no_memory(__func__);
    } else {
       entry = _mesa_hash_table_search_pre_hashed(table->ht, hash, uint_key(key));
       if (entry) {
@@ -243,8 +306,8 @@ _mesa_HashRemove_unlocked(struct _mesa_HashTable *table, GLuint key)
     */
    assert(!table->InDeleteAll);
 
-   if (key == DELETED_KEY_VALUE) {
-      table->deleted_key_data = NULL;
+   if (key < HASH_DIRECT_MAX_KEY) {
+      direct_set(table, key, NULL);
    } else {
       entry = _mesa_hash_table_search_pre_hashed(table->ht,
                                                  uint_hash(key),
@@ -287,14 +350,24 @@ _mesa_HashDeleteAll(struct _mesa_HashTable *table,
    assert(callback);
    _mesa_HashLockMutex(table);
    table->InDeleteAll = GL_TRUE;
+   for (unsigned i = 0; i < HASH_DIRECT_PAGES && table->NumDirect; i++) {
+      void **page = table->direct[i];
+
+      if (!page)
+         continue;
+
+      for (unsigned j = 0; j < HASH_DIRECT_PAGE_SIZE; j++) {
+         if (page[j]) {
+            callback((i << HASH_DIRECT_PAGE_SHIFT) + j, page[j], userData);
+            p_atomic_set(&page[j], NULL);
+            table->NumDirect--;
+         }
+      }
+   }
    hash_table_foreach(table->ht, entry) {
       callback((uintptr_t)entry->key, entry->data, userData);
       _mesa_hash_table_remove(table->ht, entry);
    }
-   if (table->deleted_key_data) {
-      callback(DELETED_KEY_VALUE, table->deleted_key_data, userData);
-      table->deleted_key_data = NULL;
-   }
    table->InDeleteAll = GL_FALSE;
    _mesa_HashUnlockMutex(table);
 }
@@ -315,12 +388,23 @@ hash_walk_unlocked(const struct _mesa_HashTable *table,
    assert(table);
    assert(callback);
 
+   /* The callback may remove entries, so re-read the pages as we go. */
+   for (unsigned i = 0; i < HASH_DIRECT_PAGES; i++) {
+      void **page = table->direct[i];
+
+      if (!page)
+         continue;
+
+      for (unsigned j = 0; j < HASH_DIRECT_PAGE_SIZE; j++) {
+         if (page[j])
+            callback((i << HASH_DIRECT_PAGE_SHIFT) + j, page[j], userData);
+      }
+   }
+
    struct hash_entry *entry;
    hash_table_foreach(table->ht, entry) {
       callback((uintptr_t)entry->key, entry->data, userData);
    }
-   if (table->deleted_key_data)
-      callback(DELETED_KEY_VALUE, table->deleted_key_data, userData);
 }
 
 
@@ -359,8 +443,6 @@ debug_print_entry(GLuint key, void *data, void *userData)
 void
 _mesa_HashPrint(const struct _mesa_HashTable *table)
 {
-   if (table->deleted_key_data)
-      debug_print_entry(DELETED_KEY_VALUE, table->deleted_key_data, NULL);
    _mesa_HashWalk(table, debug_print_entry, NULL);
 }
 
@@ -417,12 +499,5 @@ _mesa_HashFindFreeKeyBlock(struct _mesa_HashTable *table, GLuint numKeys)
 GLuint
 _mesa_HashNumEntries(const struct _mesa_HashTable *table)
 {
-   GLuint count = 0;
-
-   if (table->deleted_key_data)
-      count++;
-
-   count += _mesa_hash_table_num_entries(table->ht);
-
-   return count;
+   return table->NumDirect + _mesa_hash_table_num_entries(table->ht);
 }
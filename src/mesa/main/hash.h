@@ -35,6 +35,10 @@
 #include "glheader.h"
 #include "imports.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * Magic GLuint object name that gets stored outside of the struct hash_table.
  *
@@ -44,7 +48,7 @@
  * and we use a 1:1 mapping from GLuints to key pointers, so we need to be
  * able to track a GLuint that happens to match the deleted key outside of
  * struct hash_table.  We tell the hash table to use "1" as the deleted key
- * value, so that we test the deleted-key-in-the-table path as best we can.
+ * value, which always lives in the direct array (see HASH_DIRECT_MAX_KEY).
  */
 #define DELETED_KEY_VALUE 1
 
@@ -92,16 +96,31 @@ uint_key(GLuint id)
 }
 /** @} */
 
+/** @{
+ * Keys below HASH_DIRECT_MAX_KEY, which covers everything glGen*() hands out
+ * in practice, are stored in a two-level array indexed by the key instead of
+ * in the hash table.  The pages are allocated on first use and only freed
+ * with the table, so lookups in the array don't need the mutex: a reader
+ * racing with an insertion or removal sees either the old or the new value.
+ * Larger names, which only come from applications choosing their own, go to
+ * the hash table.
+ */
+#define HASH_DIRECT_PAGE_SHIFT 10
+#define HASH_DIRECT_PAGE_SIZE  (1 << HASH_DIRECT_PAGE_SHIFT)
+#define HASH_DIRECT_PAGES      1024
+#define HASH_DIRECT_MAX_KEY    (HASH_DIRECT_PAGES * HASH_DIRECT_PAGE_SIZE)
+/** @} */
+
 /**
  * The hash table data structure.
  */
 struct _mesa_HashTable {
-   struct hash_table *ht;
+   void **direct[HASH_DIRECT_PAGES];     /**< pages of the direct array */
+   GLuint NumDirect;                     /**< entries in the direct array */
+   struct hash_table *ht;                /**< keys >= HASH_DIRECT_MAX_KEY */
    GLuint MaxKey;                        /**< highest key inserted so far */
    mtx_t Mutex;                          /**< mutual exclusion lock */
    GLboolean InDeleteAll;                /**< Debug check */
-   /** Value that would be in the table for DELETED_KEY_VALUE. */
-   void *deleted_key_data;
 };
 
 extern struct _mesa_HashTable *_mesa_NewHashTable(void);
@@ -174,5 +193,8 @@ _mesa_HashNumEntries(const struct _mesa_HashTable *table);
 
 extern void _mesa_test_hash_functions(void);
 
+#ifdef __cplusplus
+}
+#endif
 
 #endif
@@ -131,6 +131,20 @@ invalid_target:
 }
 
 
+/* GL_ARB_parallel_shader_compile */
+void GLAPIENTRY
+_mesa_MaxShaderCompilerThreadsARB(GLuint count)
+{
+   GET_CURRENT_CONTEXT(ctx);
+
+   /* Zero makes glCompileShader and glLinkProgram synchronous again. Any
+    * other count only enables the share group's compiler threads, whose
+    * number is fixed when they are started.
+    */
+   ctx->Hint.MaxShaderCompilerThreads = count;
+}
+
+
 /**********************************************************************/
 /*****                      Initialization                        *****/
 /**********************************************************************/
@@ -146,4 +160,5 @@ void _mesa_init_hint( struct gl_context * ctx )
    ctx->Hint.TextureCompression = GL_DONT_CARE;
    ctx->Hint.GenerateMipmap = GL_DONT_CARE;
    ctx->Hint.FragmentShaderDerivative = GL_DONT_CARE;
+   ctx->Hint.MaxShaderCompilerThreads = 0xffffffff;
 }
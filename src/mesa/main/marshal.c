@@ -27,8 +27,14 @@
  * thread when automatic code generation isn't appropriate.
  */
 
+#include <limits.h>
+#include "main/bufferobj.h"
 #include "main/enums.h"
+#include "main/extensions.h"
+#include "main/glformats.h"
 #include "main/macros.h"
+#include "main/varray.h"
+#include "util/u_math.h"
 #include "marshal.h"
 #include "dispatch.h"
 #include "marshal_generated.h"
@@ -88,17 +94,18 @@ _mesa_marshal_Enable(GLenum cap)
    debug_print_marshal("Enable");
 
    if (cap == GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "Enable");
       _mesa_glthread_restore_dispatch(ctx);
    } else {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_Enable,
                                             sizeof(*cmd));
       cmd->cap = cap;
+      _mesa_glthread_Enable(ctx, cap);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Enable");
    debug_print_sync_fallback("Enable");
    CALL_Enable(ctx->CurrentServerDispatch, (cap));
 }
@@ -187,7 +194,7 @@ _mesa_marshal_ShaderSource(GLuint shader, GLsizei count,
       }
       _mesa_post_marshal_hook(ctx);
    } else {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ShaderSource");
       CALL_ShaderSource(ctx->CurrentServerDispatch,
                         (shader, count, string, length_tmp));
    }
@@ -211,14 +218,6 @@ struct marshal_cmd_BindBufferBase
  * user vertex array bindings per attribute on each vertex array for
  * determining what to upload at draw call time.
  *
- * Note that GL core makes it so that a buffer binding with an invalid handle
- * in the "buffer" parameter will throw an error, and then a
- * glVertexAttribPointer() that followsmight not end up pointing at a VBO.
- * However, in GL core the draw call would throw an error as well, so we don't
- * really care if our tracking is wrong for this case -- we never need to
- * marshal user data for draw calls, and the unmarshal will just generate an
- * error or not as appropriate.
- *
  * For compatibility GL, we do need to accurately know whether the draw call
  * on the unmarshal side will dereference a user pointer or load data from a
  * VBO per vertex.  That would make it seem like we need to track whether a
@@ -226,15 +225,28 @@ struct marshal_cmd_BindBufferBase
  * instead of updating the binding.  However, compat GL has the ridiculous
  * feature that if you pass a bad name, it just gens a buffer object for you,
  * so we escape without having to know if things are valid or not.
+ *
+ * GL core makes it so that a buffer binding with an invalid handle in the
+ * "buffer" parameter will throw an error and leave the old binding in place.
+ * Draw calls never need the user array tracking there, but the shadowed
+ * GL_ARRAY_BUFFER_BINDING does, so binding a name that glthread hasn't seen
+ * being generated invalidates the shadow.
  */
 static void
 track_vbo_binding(struct gl_context *ctx, GLenum target, GLuint buffer)
 {
    struct glthread_state *glthread = ctx->GLThread;
 
+   if (target == GL_ARRAY_BUFFER &&
+       !_mesa_glthread_can_bind_buffer(ctx, buffer)) {
+      _mesa_glthread_invalidate_state(ctx);
+      return;
+   }
+
    switch (target) {
    case GL_ARRAY_BUFFER:
       glthread->vertex_array_is_vbo = (buffer != 0);
+      glthread->shadow.array_buffer = buffer;
       break;
    case GL_ELEMENT_ARRAY_BUFFER:
       /* The current element array buffer binding is actually tracked in the
@@ -283,7 +295,7 @@ _mesa_marshal_BindBuffer(GLenum target, GLuint buffer)
       cmd->buffer = buffer;
       _mesa_post_marshal_hook(ctx);
    } else {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "BindBuffer");
       CALL_BindBuffer(ctx->CurrentServerDispatch, (target, buffer));
    }
 }
@@ -296,6 +308,7 @@ struct marshal_cmd_BufferData
    GLsizeiptr size;
    GLenum usage;
    bool data_null; /* If set, no data follows for "data" */
+   void *staging;  /* If set, "data" is in this staging memory */
    /* Next size bytes are GLubyte data[size] */
 };
 
@@ -310,10 +323,15 @@ _mesa_unmarshal_BufferData(struct gl_context *ctx,
 
    if (cmd->data_null)
       data = NULL;
+   else if (cmd->staging)
+      data = cmd->staging;
    else
       data = (const void *) (cmd + 1);
 
    CALL_BufferData(ctx->CurrentServerDispatch, (target, size, data, usage));
+
+   if (cmd->staging)
+      _mesa_glthread_staging_free(ctx, cmd->staging, size);
 }
 
 void GLAPIENTRY
@@ -326,11 +344,22 @@ _mesa_marshal_BufferData(GLenum target, GLsizeiptr size, const GLvoid * data,
    debug_print_marshal("BufferData");
 
    if (unlikely(size < 0)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "BufferData");
       _mesa_error(ctx, GL_INVALID_VALUE, "BufferData(size < 0)");
       return;
    }
 
+   /* Data that doesn't fit in a batch is copied to staging memory. */
+   void *staging = NULL;
+   if (target != GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD &&
+       cmd_size > MARSHAL_MAX_CMD_SIZE) {
+      staging = _mesa_glthread_staging_alloc(ctx, size, "BufferData");
+      if (staging) {
+         memcpy(staging, data, size);
+         cmd_size = sizeof(struct marshal_cmd_BufferData);
+      }
+   }
+
    if (target != GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD &&
        cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       struct marshal_cmd_BufferData *cmd =
@@ -341,13 +370,14 @@ _mesa_marshal_BufferData(GLenum target, GLsizeiptr size, const GLvoid * data,
       cmd->size = size;
       cmd->usage = usage;
       cmd->data_null = !data;
-      if (data) {
+      cmd->staging = staging;
+      if (data && !staging) {
          char *variable_data = (char *) (cmd + 1);
          memcpy(variable_data, data, size);
       }
       _mesa_post_marshal_hook(ctx);
    } else {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "BufferData");
       CALL_BufferData(ctx->CurrentServerDispatch,
                       (target, size, data, usage));
    }
@@ -360,6 +390,7 @@ struct marshal_cmd_BufferSubData
    GLenum target;
    GLintptr offset;
    GLsizeiptr size;
+   void *staging;  /* If set, "data" is in this staging memory */
    /* Next size bytes are GLubyte data[size] */
 };
 
@@ -370,10 +401,13 @@ _mesa_unmarshal_BufferSubData(struct gl_context *ctx,
    const GLenum target = cmd->target;
    const GLintptr offset = cmd->offset;
    const GLsizeiptr size = cmd->size;
-   const void *data = (const void *) (cmd + 1);
+   const void *data = cmd->staging ? cmd->staging : (const void *) (cmd + 1);
 
    CALL_BufferSubData(ctx->CurrentServerDispatch,
                       (target, offset, size, data));
+
+   if (cmd->staging)
+      _mesa_glthread_staging_free(ctx, cmd->staging, size);
 }
 
 void GLAPIENTRY
@@ -385,11 +419,21 @@ _mesa_marshal_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
 
    debug_print_marshal("BufferSubData");
    if (unlikely(size < 0)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "BufferSubData");
       _mesa_error(ctx, GL_INVALID_VALUE, "BufferSubData(size < 0)");
       return;
    }
 
+   void *staging = NULL;
+   if (target != GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD &&
+       cmd_size > MARSHAL_MAX_CMD_SIZE) {
+      staging = _mesa_glthread_staging_alloc(ctx, size, "BufferSubData");
+      if (staging) {
+         memcpy(staging, data, size);
+         cmd_size = sizeof(struct marshal_cmd_BufferSubData);
+      }
+   }
+
    if (target != GL_EXTERNAL_VIRTUAL_MEMORY_BUFFER_AMD &&
        cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       struct marshal_cmd_BufferSubData *cmd =
@@ -398,11 +442,14 @@ _mesa_marshal_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
       cmd->target = target;
       cmd->offset = offset;
       cmd->size = size;
-      char *variable_data = (char *) (cmd + 1);
-      memcpy(variable_data, data, size);
+      cmd->staging = staging;
+      if (!staging) {
+         char *variable_data = (char *) (cmd + 1);
+         memcpy(variable_data, data, size);
+      }
       _mesa_post_marshal_hook(ctx);
    } else {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "BufferSubData");
       CALL_BufferSubData(ctx->CurrentServerDispatch,
                          (target, offset, size, data));
    }
@@ -416,6 +463,7 @@ struct marshal_cmd_NamedBufferData
    GLsizei size;
    GLenum usage;
    bool data_null; /* If set, no data follows for "data" */
+   void *staging;  /* If set, "data" is in this staging memory */
    /* Next size bytes are GLubyte data[size] */
 };
 
@@ -430,11 +478,16 @@ _mesa_unmarshal_NamedBufferData(struct gl_context *ctx,
 
    if (cmd->data_null)
       data = NULL;
+   else if (cmd->staging)
+      data = cmd->staging;
    else
       data = (const void *) (cmd + 1);
 
    CALL_NamedBufferData(ctx->CurrentServerDispatch,
                         (name, size, data, usage));
+
+   if (cmd->staging)
+      _mesa_glthread_staging_free(ctx, cmd->staging, size);
 }
 
 void GLAPIENTRY
@@ -446,11 +499,20 @@ _mesa_marshal_NamedBufferData(GLuint buffer, GLsizeiptr size,
 
    debug_print_marshal("NamedBufferData");
    if (unlikely(size < 0)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "NamedBufferData");
       _mesa_error(ctx, GL_INVALID_VALUE, "NamedBufferData(size < 0)");
       return;
    }
 
+   void *staging = NULL;
+   if (buffer > 0 && size <= INT_MAX && cmd_size > MARSHAL_MAX_CMD_SIZE) {
+      staging = _mesa_glthread_staging_alloc(ctx, size, "NamedBufferData");
+      if (staging) {
+         memcpy(staging, data, size);
+         cmd_size = sizeof(struct marshal_cmd_NamedBufferData);
+      }
+   }
+
    if (buffer > 0 && cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       struct marshal_cmd_NamedBufferData *cmd =
          _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_NamedBufferData,
@@ -459,13 +521,14 @@ _mesa_marshal_NamedBufferData(GLuint buffer, GLsizeiptr size,
       cmd->size = size;
       cmd->usage = usage;
       cmd->data_null = !data;
-      if (data) {
+      cmd->staging = staging;
+      if (data && !staging) {
          char *variable_data = (char *) (cmd + 1);
          memcpy(variable_data, data, size);
       }
       _mesa_post_marshal_hook(ctx);
    } else {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "NamedBufferData");
       CALL_NamedBufferData(ctx->CurrentServerDispatch,
                            (buffer, size, data, usage));
    }
@@ -478,6 +541,7 @@ struct marshal_cmd_NamedBufferSubData
    GLuint name;
    GLintptr offset;
    GLsizei size;
+   void *staging;  /* If set, "data" is in this staging memory */
    /* Next size bytes are GLubyte data[size] */
 };
 
@@ -488,10 +552,13 @@ _mesa_unmarshal_NamedBufferSubData(struct gl_context *ctx,
    const GLuint name = cmd->name;
    const GLintptr offset = cmd->offset;
    const GLsizei size = cmd->size;
-   const void *data = (const void *) (cmd + 1);
+   const void *data = cmd->staging ? cmd->staging : (const void *) (cmd + 1);
 
    CALL_NamedBufferSubData(ctx->CurrentServerDispatch,
                            (name, offset, size, data));
+
+   if (cmd->staging)
+      _mesa_glthread_staging_free(ctx, cmd->staging, size);
 }
 
 void GLAPIENTRY
@@ -503,11 +570,20 @@ _mesa_marshal_NamedBufferSubData(GLuint buffer, GLintptr offset,
 
    debug_print_marshal("NamedBufferSubData");
    if (unlikely(size < 0)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "NamedBufferSubData");
       _mesa_error(ctx, GL_INVALID_VALUE, "NamedBufferSubData(size < 0)");
       return;
    }
 
+   void *staging = NULL;
+   if (buffer > 0 && size <= INT_MAX && cmd_size > MARSHAL_MAX_CMD_SIZE) {
+      staging = _mesa_glthread_staging_alloc(ctx, size, "NamedBufferSubData");
+      if (staging) {
+         memcpy(staging, data, size);
+         cmd_size = sizeof(struct marshal_cmd_NamedBufferSubData);
+      }
+   }
+
    if (buffer > 0 && cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       struct marshal_cmd_NamedBufferSubData *cmd =
          _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_NamedBufferSubData,
@@ -515,11 +591,14 @@ _mesa_marshal_NamedBufferSubData(GLuint buffer, GLintptr offset,
       cmd->name = buffer;
       cmd->offset = offset;
       cmd->size = size;
-      char *variable_data = (char *) (cmd + 1);
-      memcpy(variable_data, data, size);
+      cmd->staging = staging;
+      if (!staging) {
+         char *variable_data = (char *) (cmd + 1);
+         memcpy(variable_data, data, size);
+      }
       _mesa_post_marshal_hook(ctx);
    } else {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "NamedBufferSubData");
       CALL_NamedBufferSubData(ctx->CurrentServerDispatch,
                               (buffer, offset, size, data));
    }
@@ -635,7 +714,7 @@ _mesa_marshal_ClearBufferfv(GLenum buffer, GLint drawbuffer,
    debug_print_marshal("ClearBufferfv");
 
    if (!(buffer == GL_DEPTH || buffer == GL_COLOR)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferfv");
 
       /* Page 498 of the PDF, section '17.4.3.1 Clearing Individual Buffers'
        * of the OpenGL 4.5 spec states:
@@ -651,7 +730,7 @@ _mesa_marshal_ClearBufferfv(GLenum buffer, GLint drawbuffer,
    if (!clear_buffer_add_command(ctx, DISPATCH_CMD_ClearBufferfv, buffer,
                                  drawbuffer, (GLuint *)value, size)) {
       debug_print_sync("ClearBufferfv");
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferfv");
       CALL_ClearBufferfv(ctx->CurrentServerDispatch,
                          (buffer, drawbuffer, value));
    }
@@ -665,7 +744,7 @@ _mesa_marshal_ClearBufferiv(GLenum buffer, GLint drawbuffer,
    debug_print_marshal("ClearBufferiv");
 
    if (!(buffer == GL_STENCIL || buffer == GL_COLOR)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferiv");
 
       /* Page 498 of the PDF, section '17.4.3.1 Clearing Individual Buffers'
        * of the OpenGL 4.5 spec states:
@@ -681,7 +760,7 @@ _mesa_marshal_ClearBufferiv(GLenum buffer, GLint drawbuffer,
    if (!clear_buffer_add_command(ctx, DISPATCH_CMD_ClearBufferiv, buffer,
                                  drawbuffer, (GLuint *)value, size)) {
       debug_print_sync("ClearBufferiv");
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferiv");
       CALL_ClearBufferiv(ctx->CurrentServerDispatch,
                          (buffer, drawbuffer, value));
    }
@@ -695,7 +774,7 @@ _mesa_marshal_ClearBufferuiv(GLenum buffer, GLint drawbuffer,
    debug_print_marshal("ClearBufferuiv");
 
    if (buffer != GL_COLOR) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferuiv");
 
       /* Page 498 of the PDF, section '17.4.3.1 Clearing Individual Buffers'
        * of the OpenGL 4.5 spec states:
@@ -710,7 +789,7 @@ _mesa_marshal_ClearBufferuiv(GLenum buffer, GLint drawbuffer,
    if (!clear_buffer_add_command(ctx, DISPATCH_CMD_ClearBufferuiv, buffer,
                                  drawbuffer, (GLuint *)value, 4)) {
       debug_print_sync("ClearBufferuiv");
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferuiv");
       CALL_ClearBufferuiv(ctx->CurrentServerDispatch,
                          (buffer, drawbuffer, value));
    }
@@ -724,7 +803,7 @@ _mesa_marshal_ClearBufferfi(GLenum buffer, GLint drawbuffer,
    debug_print_marshal("ClearBufferfi");
 
    if (buffer != GL_DEPTH_STENCIL) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferfi");
 
       /* Page 498 of the PDF, section '17.4.3.1 Clearing Individual Buffers'
        * of the OpenGL 4.5 spec states:
@@ -742,8 +821,696 @@ _mesa_marshal_ClearBufferfi(GLenum buffer, GLint drawbuffer,
    if (!clear_buffer_add_command(ctx, DISPATCH_CMD_ClearBufferfi, buffer,
                                  drawbuffer, (GLuint *)value, 2)) {
       debug_print_sync("ClearBufferfi");
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "ClearBufferfi");
       CALL_ClearBufferfi(ctx->CurrentServerDispatch,
                          (buffer, drawbuffer, depth, stencil));
    }
 }
+
+
+/* GetIntegerv: answered from the shadowed state when possible, otherwise
+ * marshalled synchronously.
+ */
+static bool
+get_shadowed_integerv(struct gl_context *ctx, GLenum pname, GLint *params)
+{
+   const struct glthread_state *glthread = ctx->GLThread;
+
+   switch (pname) {
+   case GL_ARRAY_BUFFER_BINDING:
+      params[0] = glthread->shadow.array_buffer;
+      return true;
+   case GL_VERTEX_ARRAY_BINDING:
+      if (!_mesa_has_ARB_vertex_array_object(ctx) &&
+          !_mesa_has_OES_vertex_array_object(ctx))
+         return false;
+      params[0] = glthread->shadow.vertex_array;
+      return true;
+   case GL_CURRENT_PROGRAM:
+      if (ctx->API == API_OPENGLES)
+         return false;
+      params[0] = glthread->shadow.current_program;
+      return true;
+   case GL_DRAW_FRAMEBUFFER_BINDING:
+      params[0] = glthread->shadow.draw_framebuffer;
+      return true;
+   case GL_READ_FRAMEBUFFER_BINDING:
+      if (!_mesa_is_desktop_gl(ctx) && !_mesa_is_gles3(ctx))
+         return false;
+      params[0] = glthread->shadow.read_framebuffer;
+      return true;
+   case GL_RENDERBUFFER_BINDING:
+      params[0] = glthread->shadow.renderbuffer;
+      return true;
+   case GL_ACTIVE_TEXTURE:
+      params[0] = GL_TEXTURE0 + glthread->shadow.active_texture;
+      return true;
+   case GL_TEXTURE_BINDING_2D:
+      params[0] =
+         glthread->shadow.texture_2d[glthread->shadow.active_texture];
+      return true;
+   case GL_VIEWPORT:
+      memcpy(params, glthread->shadow.viewport,
+             sizeof(glthread->shadow.viewport));
+      return true;
+   default:
+      return false;
+   }
+}
+
+void GLAPIENTRY
+_mesa_marshal_GetIntegerv(GLenum pname, GLint *params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct glthread_state *glthread = ctx->GLThread;
+
+   if (glthread->shadow.valid && get_shadowed_integerv(ctx, pname, params))
+      return;
+
+   _mesa_glthread_finish_before(ctx, "GetIntegerv");
+   debug_print_sync("GetIntegerv");
+   CALL_GetIntegerv(ctx->CurrentServerDispatch, (pname, params));
+
+   /* The worker thread is idle now, so refresh the shadow for the next
+    * query.
+    */
+   if (!glthread->shadow.valid)
+      _mesa_glthread_validate_state(ctx);
+}
+
+
+/* IsEnabled: same as GetIntegerv. */
+GLboolean GLAPIENTRY
+_mesa_marshal_IsEnabled(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct glthread_state *glthread = ctx->GLThread;
+   unsigned bit = _mesa_glthread_cap_bit(cap);
+
+   if (glthread->shadow.valid && bit)
+      return (glthread->shadow.enables & bit) != 0;
+
+   _mesa_glthread_finish_before(ctx, "IsEnabled");
+   debug_print_sync("IsEnabled");
+   GLboolean enabled = CALL_IsEnabled(ctx->CurrentServerDispatch, (cap));
+
+   if (!glthread->shadow.valid)
+      _mesa_glthread_validate_state(ctx);
+   return enabled;
+}
+
+
+/* GetError: errors are raised on the worker thread, so this has to wait for
+ * everything queued so far.  The common case of an application checking
+ * for errors right after another synchronous call (or twice in a row) finds
+ * the worker idle and skips the fence entirely.
+ */
+GLenum GLAPIENTRY
+_mesa_marshal_GetError(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+
+   if (!ctx->GLThread->idle)
+      _mesa_glthread_finish_before(ctx, "GetError");
+   debug_print_sync("GetError");
+   return CALL_GetError(ctx->CurrentServerDispatch, ());
+}
+
+
+/* Draw*: marshalled asynchronously.
+ *
+ * All the non-indirect, non-multi draw calls share one command layout.  If
+ * the draw call reads vertex arrays or indices in user memory, the range it
+ * reads is copied on the application thread, either after the command
+ * record or to staging memory if it doesn't fit in a batch, and the worker
+ * thread points the arrays at the copy for the duration of the call.
+ */
+struct marshal_draw_array
+{
+   GLuint attrib;
+   /* Where the array pointer goes, relative to the uploaded data.  It can be
+    * negative, because only the range of elements used is copied.
+    */
+   ptrdiff_t offset;
+};
+
+struct marshal_cmd_Draw
+{
+   struct marshal_cmd_base cmd_base;
+   GLenum mode;
+   GLenum type;
+   GLint first;
+   GLuint start;
+   GLuint end;
+   GLsizei count;
+   GLsizei primcount;
+   GLint basevertex;
+   GLuint baseinstance;
+   /* If user_indices is set, this is the offset of the indices in the
+    * uploaded data.
+    */
+   const GLvoid *indices;
+   bool user_indices;
+   GLuint num_arrays;
+   /* Uploaded data that didn't fit in the batch, owned by the command. */
+   void *staging;
+   size_t staging_size;
+   /* Next num_arrays struct marshal_draw_array, then the uploaded data
+    * unless staging is set.
+    */
+};
+
+static void
+dispatch_draw(struct gl_context *ctx, uint16_t cmd_id,
+              const struct marshal_cmd_Draw *d, const GLvoid *indices)
+{
+   struct _glapi_table *disp = ctx->CurrentServerDispatch;
+
+   switch (cmd_id) {
+   case DISPATCH_CMD_DrawArrays:
+      CALL_DrawArrays(disp, (d->mode, d->first, d->count));
+      break;
+   case DISPATCH_CMD_DrawArraysInstancedARB:
+      CALL_DrawArraysInstancedARB(disp, (d->mode, d->first, d->count,
+                                         d->primcount));
+      break;
+   case DISPATCH_CMD_DrawArraysInstancedBaseInstance:
+      CALL_DrawArraysInstancedBaseInstance(disp, (d->mode, d->first,
+                                                  d->count, d->primcount,
+                                                  d->baseinstance));
+      break;
+   case DISPATCH_CMD_DrawElements:
+      CALL_DrawElements(disp, (d->mode, d->count, d->type, indices));
+      break;
+   case DISPATCH_CMD_DrawRangeElements:
+      CALL_DrawRangeElements(disp, (d->mode, d->start, d->end, d->count,
+                                    d->type, indices));
+      break;
+   case DISPATCH_CMD_DrawElementsInstancedARB:
+      CALL_DrawElementsInstancedARB(disp, (d->mode, d->count, d->type,
+                                           indices, d->primcount));
+      break;
+   case DISPATCH_CMD_DrawElementsBaseVertex:
+      CALL_DrawElementsBaseVertex(disp, (d->mode, d->count, d->type,
+                                         indices, d->basevertex));
+      break;
+   case DISPATCH_CMD_DrawRangeElementsBaseVertex:
+      CALL_DrawRangeElementsBaseVertex(disp, (d->mode, d->start, d->end,
+                                              d->count, d->type, indices,
+                                              d->basevertex));
+      break;
+   case DISPATCH_CMD_DrawElementsInstancedBaseVertex:
+      CALL_DrawElementsInstancedBaseVertex(disp, (d->mode, d->count,
+                                                  d->type, indices,
+                                                  d->primcount,
+                                                  d->basevertex));
+      break;
+   case DISPATCH_CMD_DrawElementsInstancedBaseInstance:
+      CALL_DrawElementsInstancedBaseInstance(disp, (d->mode, d->count,
+                                                    d->type, indices,
+                                                    d->primcount,
+                                                    d->baseinstance));
+      break;
+   case DISPATCH_CMD_DrawElementsInstancedBaseVertexBaseInstance:
+      CALL_DrawElementsInstancedBaseVertexBaseInstance(disp,
+                                                       (d->mode, d->count,
+                                                        d->type, indices,
+                                                        d->primcount,
+                                                        d->basevertex,
+                                                        d->baseinstance));
+      break;
+   default:
+      unreachable("not a draw command");
+   }
+}
+
+/**
+ * Point a user array at \p ptr, in the same way gl*Pointer() does, and
+ * return the previous pointer.
+ */
+static const GLubyte *
+set_user_array_pointer(struct gl_context *ctx, gl_vert_attrib attrib,
+                       const GLubyte *ptr)
+{
+   struct gl_vertex_array_object *vao = ctx->Array.VAO;
+   struct gl_array_attributes *array = &vao->VertexAttrib[attrib];
+   struct gl_vertex_buffer_binding *binding = &vao->BufferBinding[attrib];
+   const GLubyte *old = array->Ptr;
+
+   array->Ptr = ptr;
+   _mesa_bind_vertex_buffer(ctx, vao, attrib, ctx->Shared->NullBufferObj,
+                            (GLintptr) ptr, binding->Stride);
+   return old;
+}
+
+static void
+unmarshal_draw(struct gl_context *ctx, const struct marshal_cmd_Draw *cmd)
+{
+   const struct marshal_draw_array *arrays =
+      (const struct marshal_draw_array *) (cmd + 1);
+   const GLubyte *data = cmd->staging ? cmd->staging :
+      (const GLubyte *) (arrays + cmd->num_arrays);
+   struct gl_vertex_array_object *vao = ctx->Array.VAO;
+   const GLubyte *saved[VERT_ATTRIB_MAX];
+   GLbitfield redirected = 0;
+
+   for (unsigned i = 0; i < cmd->num_arrays; i++) {
+      gl_vert_attrib attrib = arrays[i].attrib;
+      const struct gl_array_attributes *array = &vao->VertexAttrib[attrib];
+
+      /* The main thread may have tracked a gl*Pointer() call that failed
+       * here; leave such arrays alone.
+       */
+      if (array->BufferBindingIndex != attrib ||
+          _mesa_is_bufferobj(vao->BufferBinding[attrib].BufferObj))
+         continue;
+
+      saved[attrib] = set_user_array_pointer(ctx, attrib,
+                                             data + arrays[i].offset);
+      redirected |= VERT_BIT(attrib);
+   }
+
+   const GLvoid *indices = cmd->user_indices ?
+      data + (uintptr_t) cmd->indices : cmd->indices;
+
+   dispatch_draw(ctx, cmd->cmd_base.cmd_id, cmd, indices);
+
+   while (redirected) {
+      gl_vert_attrib attrib = u_bit_scan(&redirected);
+      set_user_array_pointer(ctx, attrib, saved[attrib]);
+   }
+
+   if (cmd->staging)
+      _mesa_glthread_staging_free(ctx, cmd->staging, cmd->staging_size);
+}
+
+/**
+ * Compute the range of indices used by a draw call, ignoring the primitive
+ * restart index.  Returns false if no index is used.
+ */
+static bool
+get_index_range(struct gl_context *ctx, const char *func, GLenum type,
+                const GLvoid *indices, GLsizei count,
+                GLuint *min_index, GLuint *max_index)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   GLuint min = ~0u, max = 0;
+
+   if (!glthread->shadow.valid) {
+      _mesa_glthread_finish_before(ctx, func);
+      _mesa_glthread_validate_state(ctx);
+   }
+
+   const bool restart = glthread->shadow.primitive_restart ||
+                        glthread->shadow.primitive_restart_fixed_index;
+   GLuint restart_index = glthread->shadow.restart_index;
+
+#define SCAN_INDICES(T, FIXED_RESTART)                                 \
+   do {                                                                 \
+      const T *ind = (const T *) indices;                               \
+      if (glthread->shadow.primitive_restart_fixed_index)              \
+         restart_index = FIXED_RESTART;                                 \
+      for (GLsizei i = 0; i < count; i++) {                             \
+         GLuint v = ind[i];                                             \
+         if (restart && v == restart_index)                             \
+            continue;                                                   \
+         min = MIN2(min, v);                                            \
+         max = MAX2(max, v);                                            \
+      }                                                                 \
+   } while (0)
+
+   switch (type) {
+   case GL_UNSIGNED_BYTE:
+      SCAN_INDICES(GLubyte, 0xff);
+      break;
+   case GL_UNSIGNED_SHORT:
+      SCAN_INDICES(GLushort, 0xffff);
+      break;
+   default:
+      SCAN_INDICES(GLuint, 0xffffffff);
+      break;
+   }
+#undef SCAN_INDICES
+
+   *min_index = min;
+   *max_index = max;
+   return min <= max;
+}
+
+struct upload_region
+{
+   const GLubyte *start;
+   const GLubyte *end;
+   GLsizei stride;
+   unsigned divisor;
+   size_t offset;
+};
+
+static void
+draw_sync(struct gl_context *ctx, uint16_t cmd_id, const char *func,
+          const struct marshal_cmd_Draw *d, const GLvoid *indices)
+{
+   _mesa_glthread_finish_before(ctx, func);
+   debug_print_sync_fallback(func);
+   dispatch_draw(ctx, cmd_id, d, indices);
+}
+
+/**
+ * Queue a draw call, uploading the user arrays and indices it reads.
+ *
+ * \param d  the draw parameters, in the layout of the command
+ * \param indexed  whether this is a glDrawElements() variant
+ * \param has_range  whether d->start and d->end are the index range
+ */
+static void
+marshal_draw(struct gl_context *ctx, uint16_t cmd_id, const char *func,
+             const struct marshal_cmd_Draw *d, bool indexed, bool has_range)
+{
+   struct glthread_state *glthread = ctx->GLThread;
+   struct marshal_draw_array arrays[VERT_ATTRIB_MAX];
+   struct upload_region regions[VERT_ATTRIB_MAX];
+   unsigned num_arrays = 0, num_regions = 0;
+   GLbitfield user_arrays = 0;
+   bool user_indices = false;
+   size_t index_size = 0, upload_size = 0;
+   struct marshal_cmd_Draw *cmd;
+
+   debug_print_marshal(func);
+
+   if (ctx->API != API_OPENGL_CORE) {
+      if (_mesa_glthread_has_user_arrays(ctx, func))
+         user_arrays = glthread->enabled_arrays & glthread->user_arrays;
+      if (indexed)
+         user_indices = _mesa_glthread_is_non_vbo_draw_elements(ctx);
+   }
+
+   /* Invalid calls don't read anything, so just queue them and let the
+    * worker thread generate the error.
+    */
+   if (d->count <= 0 || d->primcount <= 0 || (!indexed && d->first < 0) ||
+       (indexed && d->type != GL_UNSIGNED_BYTE &&
+        d->type != GL_UNSIGNED_SHORT && d->type != GL_UNSIGNED_INT) ||
+       (has_range && d->end < d->start)) {
+      user_arrays = 0;
+      user_indices = false;
+   }
+
+   if (user_indices) {
+      index_size = d->count * _mesa_sizeof_type(d->type);
+      upload_size = index_size;
+   }
+
+   if (user_arrays) {
+      int64_t min_vertex, max_vertex;
+
+      if (!indexed) {
+         min_vertex = d->first;
+         max_vertex = (int64_t) d->first + d->count - 1;
+      } else if (has_range || user_indices) {
+         GLuint min_index = d->start, max_index = d->end;
+
+         if (!has_range &&
+             !get_index_range(ctx, func, d->type, d->indices, d->count,
+                              &min_index, &max_index)) {
+            /* Only restart indices: no vertex is read. */
+            min_index = 1;
+            max_index = 0;
+         }
+         min_vertex = (int64_t) min_index + d->basevertex;
+         max_vertex = (int64_t) max_index + d->basevertex;
+      } else {
+         /* The index range is in a buffer object, which only the worker
+          * thread may look at.
+          */
+         draw_sync(ctx, cmd_id, func, d, d->indices);
+         return;
+      }
+
+      while (user_arrays) {
+         gl_vert_attrib attrib = u_bit_scan(&user_arrays);
+         const struct glthread_attrib *a = &glthread->attribs[attrib];
+         int64_t first, last;
+
+         if (a->divisor) {
+            first = d->baseinstance;
+            last = first + (d->primcount - 1) / a->divisor;
+         } else {
+            first = min_vertex;
+            last = max_vertex;
+         }
+
+         if (!a->pointer || first > last)
+            continue;
+         if (first < 0) {
+            draw_sync(ctx, cmd_id, func, d, d->indices);
+            return;
+         }
+
+         const GLubyte *start = a->pointer + first * a->stride;
+         const GLubyte *end = a->pointer + last * a->stride + a->element_size;
+         unsigned r;
+
+         /* Interleaved arrays are copied as one region, which also keeps
+          * them interleaved for the driver.
+          */
+         for (r = 0; r < num_regions; r++) {
+            if (regions[r].stride == a->stride &&
+                regions[r].divisor == a->divisor &&
+                start < regions[r].start + a->stride &&
+                regions[r].start < start + a->stride)
+               break;
+         }
+         if (r == num_regions) {
+            regions[r].start = start;
+            regions[r].end = end;
+            regions[r].stride = a->stride;
+            regions[r].divisor = a->divisor;
+            num_regions++;
+         } else {
+            regions[r].start = MIN2(regions[r].start, start);
+            regions[r].end = MAX2(regions[r].end, end);
+         }
+
+         arrays[num_arrays].attrib = attrib;
+         /* Temporarily the region index; turned into an offset below. */
+         arrays[num_arrays].offset = r;
+         num_arrays++;
+      }
+
+      /* Lay out the regions after the indices, keeping the alignment of the
+       * original pointers.
+       */
+      for (unsigned r = 0; r < num_regions; r++) {
+         upload_size = ALIGN(upload_size, 8) +
+                       ((uintptr_t) regions[r].start & 7);
+         regions[r].offset = upload_size;
+         upload_size += regions[r].end - regions[r].start;
+      }
+      for (unsigned i = 0; i < num_arrays; i++) {
+         const struct upload_region *region = &regions[arrays[i].offset];
+         const struct glthread_attrib *a =
+            &glthread->attribs[arrays[i].attrib];
+
+         arrays[i].offset = (ptrdiff_t) region->offset +
+                            (a->pointer - region->start);
+      }
+   }
+
+   size_t cmd_size = sizeof(*cmd) + num_arrays * sizeof(arrays[0]);
+   void *staging = NULL;
+   GLubyte *upload;
+
+   if (upload_size && cmd_size + upload_size > MARSHAL_MAX_CMD_SIZE) {
+      staging = _mesa_glthread_staging_alloc(ctx, upload_size, func);
+      if (!staging) {
+         draw_sync(ctx, cmd_id, func, d, d->indices);
+         return;
+      }
+   } else {
+      cmd_size += upload_size;
+   }
+
+   cmd = _mesa_glthread_allocate_command(ctx, cmd_id, cmd_size);
+   *cmd = *d;
+   cmd->cmd_base.cmd_id = cmd_id;
+   cmd->cmd_base.cmd_size = ALIGN(cmd_size, 8);
+   cmd->user_indices = user_indices;
+   cmd->num_arrays = num_arrays;
+   cmd->staging = staging;
+   cmd->staging_size = upload_size;
+   memcpy(cmd + 1, arrays, num_arrays * sizeof(arrays[0]));
+
+   upload = staging ? staging :
+      (GLubyte *) ((struct marshal_draw_array *) (cmd + 1) + num_arrays);
+
+   if (user_indices) {
+      memcpy(upload, d->indices, index_size);
+      cmd->indices = NULL;
+   }
+   for (unsigned r = 0; r < num_regions; r++) {
+      memcpy(upload + regions[r].offset, regions[r].start,
+             regions[r].end - regions[r].start);
+   }
+
+   _mesa_post_marshal_hook(ctx);
+}
+
+#define DRAW_ARRAYS(cmd_id, func, ...)                          \
+   do {                                                         \
+      GET_CURRENT_CONTEXT(ctx);                                 \
+      const struct marshal_cmd_Draw d = { .primcount = 1,       \
+                                          __VA_ARGS__ };        \
+      marshal_draw(ctx, cmd_id, func, &d, false, false);        \
+   } while (0)
+
+#define DRAW_ELEMENTS(cmd_id, func, has_range, ...)             \
+   do {                                                         \
+      GET_CURRENT_CONTEXT(ctx);                                 \
+      const struct marshal_cmd_Draw d = { .primcount = 1,       \
+                                          __VA_ARGS__ };        \
+      marshal_draw(ctx, cmd_id, func, &d, true, has_range);     \
+   } while (0)
+
+void GLAPIENTRY
+_mesa_marshal_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+   DRAW_ARRAYS(DISPATCH_CMD_DrawArrays, "DrawArrays",
+               .mode = mode, .first = first, .count = count);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count,
+                                     GLsizei primcount)
+{
+   DRAW_ARRAYS(DISPATCH_CMD_DrawArraysInstancedARB, "DrawArraysInstancedARB",
+               .mode = mode, .first = first, .count = count,
+               .primcount = primcount);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawArraysInstancedBaseInstance(GLenum mode, GLint first,
+                                              GLsizei count,
+                                              GLsizei primcount,
+                                              GLuint baseinstance)
+{
+   DRAW_ARRAYS(DISPATCH_CMD_DrawArraysInstancedBaseInstance,
+               "DrawArraysInstancedBaseInstance",
+               .mode = mode, .first = first, .count = count,
+               .primcount = primcount, .baseinstance = baseinstance);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawElements(GLenum mode, GLsizei count, GLenum type,
+                           const GLvoid *indices)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawElements, "DrawElements", false,
+                 .mode = mode, .count = count, .type = type,
+                 .indices = indices);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawRangeElements(GLenum mode, GLuint start, GLuint end,
+                                GLsizei count, GLenum type,
+                                const GLvoid *indices)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawRangeElements, "DrawRangeElements", true,
+                 .mode = mode, .start = start, .end = end, .count = count,
+                 .type = type, .indices = indices);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedARB(GLenum mode, GLsizei count,
+                                       GLenum type, const GLvoid *indices,
+                                       GLsizei primcount)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawElementsInstancedARB,
+                 "DrawElementsInstancedARB", false,
+                 .mode = mode, .count = count, .type = type,
+                 .indices = indices, .primcount = primcount);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type,
+                                     const GLvoid *indices, GLint basevertex)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawElementsBaseVertex,
+                 "DrawElementsBaseVertex", false,
+                 .mode = mode, .count = count, .type = type,
+                 .indices = indices, .basevertex = basevertex);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawRangeElementsBaseVertex(GLenum mode, GLuint start,
+                                          GLuint end, GLsizei count,
+                                          GLenum type, const GLvoid *indices,
+                                          GLint basevertex)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawRangeElementsBaseVertex,
+                 "DrawRangeElementsBaseVertex", true,
+                 .mode = mode, .start = start, .end = end, .count = count,
+                 .type = type, .indices = indices, .basevertex = basevertex);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count,
+                                              GLenum type,
+                                              const GLvoid *indices,
+                                              GLsizei primcount,
+                                              GLint basevertex)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawElementsInstancedBaseVertex,
+                 "DrawElementsInstancedBaseVertex", false,
+                 .mode = mode, .count = count, .type = type,
+                 .indices = indices, .primcount = primcount,
+                 .basevertex = basevertex);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count,
+                                                GLenum type,
+                                                const GLvoid *indices,
+                                                GLsizei primcount,
+                                                GLuint baseinstance)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawElementsInstancedBaseInstance,
+                 "DrawElementsInstancedBaseInstance", false,
+                 .mode = mode, .count = count, .type = type,
+                 .indices = indices, .primcount = primcount,
+                 .baseinstance = baseinstance);
+}
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode,
+                                                          GLsizei count,
+                                                          GLenum type,
+                                                          const GLvoid *indices,
+                                                          GLsizei primcount,
+                                                          GLint basevertex,
+                                                          GLuint baseinstance)
+{
+   DRAW_ELEMENTS(DISPATCH_CMD_DrawElementsInstancedBaseVertexBaseInstance,
+                 "DrawElementsInstancedBaseVertexBaseInstance", false,
+                 .mode = mode, .count = count, .type = type,
+                 .indices = indices, .primcount = primcount,
+                 .basevertex = basevertex, .baseinstance = baseinstance);
+}
+
+#define UNMARSHAL_DRAW(name)                                            \
+   void                                                                 \
+   _mesa_unmarshal_##name(struct gl_context *ctx,                       \
+                          const struct marshal_cmd_##name *cmd)         \
+   {                                                                    \
+      unmarshal_draw(ctx, cmd);                                         \
+   }
+
+UNMARSHAL_DRAW(DrawArrays)
+UNMARSHAL_DRAW(DrawArraysInstancedARB)
+UNMARSHAL_DRAW(DrawArraysInstancedBaseInstance)
+UNMARSHAL_DRAW(DrawElements)
+UNMARSHAL_DRAW(DrawRangeElements)
+UNMARSHAL_DRAW(DrawElementsInstancedARB)
+UNMARSHAL_DRAW(DrawElementsBaseVertex)
+UNMARSHAL_DRAW(DrawRangeElementsBaseVertex)
+UNMARSHAL_DRAW(DrawElementsInstancedBaseVertex)
+UNMARSHAL_DRAW(DrawElementsInstancedBaseInstance)
+UNMARSHAL_DRAW(DrawElementsInstancedBaseVertexBaseInstance)
@@ -57,6 +57,8 @@ _mesa_glthread_allocate_command(struct gl_context *ctx,
    struct marshal_cmd_base *cmd_base;
    const size_t aligned_size = ALIGN(size, 8);
 
+   glthread->idle = false;
+
    if (unlikely(next->used + size > MARSHAL_MAX_CMD_SIZE)) {
       _mesa_glthread_flush_batch(ctx);
       next = &glthread->batches[glthread->next];
@@ -70,21 +72,30 @@ _mesa_glthread_allocate_command(struct gl_context *ctx,
 }
 
 /**
- * Instead of conditionally handling marshaling previously-bound user vertex
- * array data in draw calls (deprecated and removed in GL core), we just
- * disable threading at the point where the user sets a user vertex array.
+ * Whether a draw call would read vertex arrays in user memory.
+ *
+ * Draw calls that can upload those arrays (see marshal.c) do it, the others
+ * are executed synchronously when this returns true.  If the tracked arrays
+ * are unknown, this synchronizes once to reload them.
  */
 static inline bool
-_mesa_glthread_is_non_vbo_vertex_attrib_pointer(const struct gl_context *ctx)
+_mesa_glthread_has_user_arrays(struct gl_context *ctx, const char *func)
 {
    struct glthread_state *glthread = ctx->GLThread;
 
-   return ctx->API != API_OPENGL_CORE && !glthread->vertex_array_is_vbo;
+   if (ctx->API == API_OPENGL_CORE)
+      return false;
+
+   if (unlikely(!glthread->arrays_valid)) {
+      _mesa_glthread_finish_before(ctx, func);
+      _mesa_glthread_validate_arrays(ctx);
+   }
+
+   return (glthread->enabled_arrays & glthread->user_arrays) != 0;
 }
 
 /**
- * Instead of conditionally handling marshaling immediate index data in draw
- * calls (deprecated and removed in GL core), we just disable threading.
+ * Whether the index buffer of an indexed draw call is in user memory.
  */
 static inline bool
 _mesa_glthread_is_non_vbo_draw_elements(const struct gl_context *ctx)
@@ -187,6 +198,18 @@ struct marshal_cmd_ClearBuffer;
 #define marshal_cmd_ClearBufferiv   marshal_cmd_ClearBuffer
 #define marshal_cmd_ClearBufferuiv  marshal_cmd_ClearBuffer
 #define marshal_cmd_ClearBufferfi   marshal_cmd_ClearBuffer
+struct marshal_cmd_Draw;
+#define marshal_cmd_DrawArrays                                   marshal_cmd_Draw
+#define marshal_cmd_DrawArraysInstancedARB                       marshal_cmd_Draw
+#define marshal_cmd_DrawArraysInstancedBaseInstance              marshal_cmd_Draw
+#define marshal_cmd_DrawElements                                 marshal_cmd_Draw
+#define marshal_cmd_DrawRangeElements                            marshal_cmd_Draw
+#define marshal_cmd_DrawElementsInstancedARB                     marshal_cmd_Draw
+#define marshal_cmd_DrawElementsBaseVertex                       marshal_cmd_Draw
+#define marshal_cmd_DrawRangeElementsBaseVertex                  marshal_cmd_Draw
+#define marshal_cmd_DrawElementsInstancedBaseVertex              marshal_cmd_Draw
+#define marshal_cmd_DrawElementsInstancedBaseInstance            marshal_cmd_Draw
+#define marshal_cmd_DrawElementsInstancedBaseVertexBaseInstance  marshal_cmd_Draw
 
 void
 _mesa_unmarshal_Enable(struct gl_context *ctx,
@@ -195,6 +218,15 @@ _mesa_unmarshal_Enable(struct gl_context *ctx,
 void GLAPIENTRY
 _mesa_marshal_Enable(GLenum cap);
 
+void GLAPIENTRY
+_mesa_marshal_GetIntegerv(GLenum pname, GLint *params);
+
+GLboolean GLAPIENTRY
+_mesa_marshal_IsEnabled(GLenum cap);
+
+GLenum GLAPIENTRY
+_mesa_marshal_GetError(void);
+
 void GLAPIENTRY
 _mesa_marshal_ShaderSource(GLuint shader, GLsizei count,
                            const GLchar * const *string, const GLint *length);
@@ -281,4 +313,108 @@ void GLAPIENTRY
 _mesa_marshal_ClearBufferfi(GLenum buffer, GLint drawbuffer,
                             const GLfloat depth, const GLint stencil);
 
+void
+_mesa_unmarshal_DrawArrays(struct gl_context *ctx,
+                           const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawArrays(GLenum mode, GLint first, GLsizei count);
+
+void
+_mesa_unmarshal_DrawArraysInstancedARB(struct gl_context *ctx,
+                                       const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count,
+                                     GLsizei primcount);
+
+void
+_mesa_unmarshal_DrawArraysInstancedBaseInstance(struct gl_context *ctx,
+                                                const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawArraysInstancedBaseInstance(GLenum mode, GLint first,
+                                              GLsizei count,
+                                              GLsizei primcount,
+                                              GLuint baseinstance);
+
+void
+_mesa_unmarshal_DrawElements(struct gl_context *ctx,
+                             const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawElements(GLenum mode, GLsizei count, GLenum type,
+                           const GLvoid *indices);
+
+void
+_mesa_unmarshal_DrawRangeElements(struct gl_context *ctx,
+                                  const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawRangeElements(GLenum mode, GLuint start, GLuint end,
+                                GLsizei count, GLenum type,
+                                const GLvoid *indices);
+
+void
+_mesa_unmarshal_DrawElementsInstancedARB(struct gl_context *ctx,
+                                         const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedARB(GLenum mode, GLsizei count,
+                                       GLenum type, const GLvoid *indices,
+                                       GLsizei primcount);
+
+void
+_mesa_unmarshal_DrawElementsBaseVertex(struct gl_context *ctx,
+                                       const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type,
+                                     const GLvoid *indices, GLint basevertex);
+
+void
+_mesa_unmarshal_DrawRangeElementsBaseVertex(struct gl_context *ctx,
+                                            const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawRangeElementsBaseVertex(GLenum mode, GLuint start,
+                                          GLuint end, GLsizei count,
+                                          GLenum type, const GLvoid *indices,
+                                          GLint basevertex);
+
+void
+_mesa_unmarshal_DrawElementsInstancedBaseVertex(struct gl_context *ctx,
+                                                const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count,
+                                              GLenum type,
+                                              const GLvoid *indices,
+                                              GLsizei primcount,
+                                              GLint basevertex);
+
+void
+_mesa_unmarshal_DrawElementsInstancedBaseInstance(struct gl_context *ctx,
+                                                  const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count,
+                                                GLenum type,
+                                                const GLvoid *indices,
+                                                GLsizei primcount,
+                                                GLuint baseinstance);
+
+void
+_mesa_unmarshal_DrawElementsInstancedBaseVertexBaseInstance(struct gl_context *ctx,
+                                                            const struct marshal_cmd_Draw *cmd);
+
+void GLAPIENTRY
+_mesa_marshal_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode,
+                                                          GLsizei count,
+                                                          GLenum type,
+                                                          const GLvoid *indices,
+                                                          GLsizei primcount,
+                                                          GLint basevertex,
+                                                          GLuint baseinstance);
+
 #endif /* MARSHAL_H */
@@ -73,7 +73,7 @@ _mesa_marshal_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapGrid1d");
    debug_print_sync_fallback("MapGrid1d");
    CALL_MapGrid1d(ctx->CurrentServerDispatch, (un, u1, u2));
 }
@@ -111,7 +111,7 @@ _mesa_marshal_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapGrid1f");
    debug_print_sync_fallback("MapGrid1f");
    CALL_MapGrid1f(ctx->CurrentServerDispatch, (un, u1, u2));
 }
@@ -161,7 +161,7 @@ _mesa_marshal_ProgramUniform3i64vARB(GLuint program, GLint location, GLsizei cou
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3i64vARB");
    debug_print_sync_fallback("ProgramUniform3i64vARB");
    CALL_ProgramUniform3i64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -172,7 +172,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramResourceLocationIndex");
    debug_print_sync("GetProgramResourceLocationIndex");
    return CALL_GetProgramResourceLocationIndex(ctx->CurrentServerDispatch, (program, programInterface, name));
 }
@@ -207,7 +207,7 @@ _mesa_marshal_TexCoordP1ui(GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP1ui");
    debug_print_sync_fallback("TexCoordP1ui");
    CALL_TexCoordP1ui(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -218,7 +218,7 @@ static void GLAPIENTRY
 _mesa_marshal_PolygonStipple(const GLubyte * mask)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PolygonStipple");
    debug_print_sync("PolygonStipple");
    CALL_PolygonStipple(ctx->CurrentServerDispatch, (mask));
 }
@@ -253,23 +253,12 @@ _mesa_marshal_MultiTexCoord1dv(GLenum target, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1dv");
    debug_print_sync_fallback("MultiTexCoord1dv");
    CALL_MultiTexCoord1dv(ctx->CurrentServerDispatch, (target, v));
 }
 
 
-/* IsEnabled: marshalled synchronously */
-static GLboolean GLAPIENTRY
-_mesa_marshal_IsEnabled(GLenum cap)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
-   debug_print_sync("IsEnabled");
-   return CALL_IsEnabled(ctx->CurrentServerDispatch, (cap));
-}
-
-
 /* AttachShader: marshalled asynchronously */
 struct marshal_cmd_AttachShader
 {
@@ -299,7 +288,7 @@ _mesa_marshal_AttachShader(GLuint program, GLuint shader)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AttachShader");
    debug_print_sync_fallback("AttachShader");
    CALL_AttachShader(ctx->CurrentServerDispatch, (program, shader));
 }
@@ -340,7 +329,7 @@ _mesa_marshal_VertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3fARB");
    debug_print_sync_fallback("VertexAttrib3fARB");
    CALL_VertexAttrib3fARB(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -372,7 +361,7 @@ _mesa_marshal_Indexubv(const GLubyte * c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexubv");
    debug_print_sync_fallback("Indexubv");
    CALL_Indexubv(ctx->CurrentServerDispatch, (c));
 }
@@ -383,7 +372,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetCompressedTextureImage");
    debug_print_sync("GetCompressedTextureImage");
    CALL_GetCompressedTextureImage(ctx->CurrentServerDispatch, (texture, level, bufSize, pixels));
 }
@@ -394,7 +383,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP3uiv");
    debug_print_sync("MultiTexCoordP3uiv");
    CALL_MultiTexCoordP3uiv(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -405,7 +394,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI4usv(GLuint index, const GLushort * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4usv");
    debug_print_sync("VertexAttribI4usv");
    CALL_VertexAttribI4usv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -437,7 +426,7 @@ _mesa_marshal_Color3ubv(const GLubyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3ubv");
    debug_print_sync_fallback("Color3ubv");
    CALL_Color3ubv(ctx->CurrentServerDispatch, (v));
 }
@@ -448,7 +437,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetClipPlanex(GLenum plane, GLfixed * equation)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetClipPlanex");
    debug_print_sync("GetClipPlanex");
    CALL_GetClipPlanex(ctx->CurrentServerDispatch, (plane, equation));
 }
@@ -489,7 +478,7 @@ _mesa_marshal_ProgramUniform2ui(GLuint program, GLint location, GLuint x, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2ui");
    debug_print_sync_fallback("ProgramUniform2ui");
    CALL_ProgramUniform2ui(ctx->CurrentServerDispatch, (program, location, x, y));
 }
@@ -500,7 +489,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexCoordP1uiv(GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP1uiv");
    debug_print_sync("TexCoordP1uiv");
    CALL_TexCoordP1uiv(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -541,7 +530,7 @@ _mesa_marshal_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RenderbufferStorage");
    debug_print_sync_fallback("RenderbufferStorage");
    CALL_RenderbufferStorage(ctx->CurrentServerDispatch, (target, internalformat, width, height));
 }
@@ -552,7 +541,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetClipPlanef(GLenum plane, GLfloat * equation)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetClipPlanef");
    debug_print_sync("GetClipPlanef");
    CALL_GetClipPlanef(ctx->CurrentServerDispatch, (plane, equation));
 }
@@ -563,7 +552,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfQueryDataINTEL(GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid * data, GLuint * bytesWritten)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfQueryDataINTEL");
    debug_print_sync("GetPerfQueryDataINTEL");
    CALL_GetPerfQueryDataINTEL(ctx->CurrentServerDispatch, (queryHandle, flags, dataSize, data, bytesWritten));
 }
@@ -574,7 +563,7 @@ static void GLAPIENTRY
 _mesa_marshal_DrawArraysIndirect(GLenum mode, const GLvoid * indirect)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawArraysIndirect");
    debug_print_sync("DrawArraysIndirect");
    CALL_DrawArraysIndirect(ctx->CurrentServerDispatch, (mode, indirect));
 }
@@ -615,7 +604,7 @@ _mesa_marshal_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3i");
    debug_print_sync_fallback("Uniform3i");
    CALL_Uniform3i(ctx->CurrentServerDispatch, (location, v0, v1, v2));
 }
@@ -626,7 +615,7 @@ static void GLAPIENTRY
 _mesa_marshal_VDPAUGetSurfaceivNV(GLintptr surface, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUGetSurfaceivNV");
    debug_print_sync("VDPAUGetSurfaceivNV");
    CALL_VDPAUGetSurfaceivNV(ctx->CurrentServerDispatch, (surface, pname, bufSize, length, values));
 }
@@ -667,7 +656,7 @@ _mesa_marshal_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3d");
    debug_print_sync_fallback("Uniform3d");
    CALL_Uniform3d(ctx->CurrentServerDispatch, (location, x, y, z));
 }
@@ -708,7 +697,7 @@ _mesa_marshal_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3f");
    debug_print_sync_fallback("Uniform3f");
    CALL_Uniform3f(ctx->CurrentServerDispatch, (location, v0, v1, v2));
 }
@@ -758,7 +747,7 @@ _mesa_marshal_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix2x4fv");
    debug_print_sync_fallback("UniformMatrix2x4fv");
    CALL_UniformMatrix2x4fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -769,7 +758,7 @@ static GLbitfield GLAPIENTRY
 _mesa_marshal_QueryMatrixxOES(GLfixed * mantissa, GLint * exponent)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "QueryMatrixxOES");
    debug_print_sync("QueryMatrixxOES");
    return CALL_QueryMatrixxOES(ctx->CurrentServerDispatch, (mantissa, exponent));
 }
@@ -801,7 +790,7 @@ _mesa_marshal_Normal3iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3iv");
    debug_print_sync_fallback("Normal3iv");
    CALL_Normal3iv(ctx->CurrentServerDispatch, (v));
 }
@@ -845,7 +834,7 @@ _mesa_marshal_DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint height)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexiOES");
    debug_print_sync_fallback("DrawTexiOES");
    CALL_DrawTexiOES(ctx->CurrentServerDispatch, (x, y, z, width, height));
 }
@@ -882,13 +871,15 @@ _mesa_marshal_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
       cmd->y = y;
       cmd->width = width;
       cmd->height = height;
+      _mesa_glthread_Viewport(ctx, x, y, width, height);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Viewport");
    debug_print_sync_fallback("Viewport");
    CALL_Viewport(ctx->CurrentServerDispatch, (x, y, width, height));
+   _mesa_glthread_Viewport(ctx, x, y, width, height);
 }
 
 
@@ -897,7 +888,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreateProgramPipelines(GLsizei n, GLuint * pipelines)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateProgramPipelines");
    debug_print_sync("CreateProgramPipelines");
    CALL_CreateProgramPipelines(ctx->CurrentServerDispatch, (n, pipelines));
 }
@@ -936,14 +927,16 @@ _mesa_marshal_DeleteVertexArrays(GLsizei n, const GLuint * arrays)
       char *variable_data = (char *) (cmd + 1);
       memcpy(variable_data, arrays, n * 4);
       variable_data += n * 4;
+      _mesa_glthread_DeleteVertexArrays(ctx, n, arrays);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteVertexArrays");
    debug_print_sync_fallback("DeleteVertexArrays");
    CALL_DeleteVertexArrays(ctx->CurrentServerDispatch, (n, arrays));
+   _mesa_glthread_DeleteVertexArrays(ctx, n, arrays);
 }
 
 
@@ -982,7 +975,7 @@ _mesa_marshal_ClearColorIuiEXT(GLuint r, GLuint g, GLuint b, GLuint a)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearColorIuiEXT");
    debug_print_sync_fallback("ClearColorIuiEXT");
    CALL_ClearColorIuiEXT(ctx->CurrentServerDispatch, (r, g, b, a));
 }
@@ -993,7 +986,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnConvolutionFilterARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, GLvoid * image)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnConvolutionFilterARB");
    debug_print_sync("GetnConvolutionFilterARB");
    CALL_GetnConvolutionFilterARB(ctx->CurrentServerDispatch, (target, format, type, bufSize, image));
 }
@@ -1028,7 +1021,7 @@ _mesa_marshal_PolygonOffsetx(GLfixed factor, GLfixed units)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PolygonOffsetx");
    debug_print_sync_fallback("PolygonOffsetx");
    CALL_PolygonOffsetx(ctx->CurrentServerDispatch, (factor, units));
 }
@@ -1039,7 +1032,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetLightxv(GLenum light, GLenum pname, GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetLightxv");
    debug_print_sync("GetLightxv");
    CALL_GetLightxv(ctx->CurrentServerDispatch, (light, pname, params));
 }
@@ -1050,7 +1043,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetConvolutionParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetConvolutionParameteriv");
    debug_print_sync("GetConvolutionParameteriv");
    CALL_GetConvolutionParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -1088,7 +1081,7 @@ _mesa_marshal_DepthRangeIndexedfOES(GLuint index, GLfloat n, GLfloat f)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRangeIndexedfOES");
    debug_print_sync_fallback("DepthRangeIndexedfOES");
    CALL_DepthRangeIndexedfOES(ctx->CurrentServerDispatch, (index, n, f));
 }
@@ -1099,7 +1092,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramResourceLocation");
    debug_print_sync("GetProgramResourceLocation");
    return CALL_GetProgramResourceLocation(ctx->CurrentServerDispatch, (program, programInterface, name));
 }
@@ -1110,7 +1103,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSubroutineUniformLocation");
    debug_print_sync("GetSubroutineUniformLocation");
    return CALL_GetSubroutineUniformLocation(ctx->CurrentServerDispatch, (program, shadertype, name));
 }
@@ -1145,7 +1138,7 @@ _mesa_marshal_VertexAttrib4usv(GLuint index, const GLushort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4usv");
    debug_print_sync_fallback("VertexAttrib4usv");
    CALL_VertexAttrib4usv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -1189,7 +1182,7 @@ _mesa_marshal_TextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage1DEXT");
    debug_print_sync_fallback("TextureStorage1DEXT");
    CALL_TextureStorage1DEXT(ctx->CurrentServerDispatch, (texture, target, levels, internalFormat, width));
 }
@@ -1233,7 +1226,7 @@ _mesa_marshal_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Nub");
    debug_print_sync_fallback("VertexAttrib4Nub");
    CALL_VertexAttrib4Nub(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -1274,7 +1267,7 @@ _mesa_marshal_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP3ui");
    debug_print_sync_fallback("VertexAttribP3ui");
    CALL_VertexAttribP3ui(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -1306,7 +1299,7 @@ _mesa_marshal_PointSize(GLfloat size)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointSize");
    debug_print_sync_fallback("PointSize");
    CALL_PointSize(ctx->CurrentServerDispatch, (size));
 }
@@ -1337,7 +1330,7 @@ _mesa_marshal_PopName(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PopName");
    debug_print_sync_fallback("PopName");
    CALL_PopName(ctx->CurrentServerDispatch, ());
 }
@@ -1378,7 +1371,7 @@ _mesa_marshal_FramebufferTexture(GLenum target, GLenum attachment, GLuint textur
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferTexture");
    debug_print_sync_fallback("FramebufferTexture");
    CALL_FramebufferTexture(ctx->CurrentServerDispatch, (target, attachment, texture, level));
 }
@@ -1389,7 +1382,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreateTransformFeedbacks(GLsizei n, GLuint * ids)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateTransformFeedbacks");
    debug_print_sync("CreateTransformFeedbacks");
    CALL_CreateTransformFeedbacks(ctx->CurrentServerDispatch, (n, ids));
 }
@@ -1433,7 +1426,7 @@ _mesa_marshal_VertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4ubNV");
    debug_print_sync_fallback("VertexAttrib4ubNV");
    CALL_VertexAttrib4ubNV(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -1465,7 +1458,7 @@ _mesa_marshal_ValidateProgramPipeline(GLuint pipeline)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ValidateProgramPipeline");
    debug_print_sync_fallback("ValidateProgramPipeline");
    CALL_ValidateProgramPipeline(ctx->CurrentServerDispatch, (pipeline));
 }
@@ -1476,7 +1469,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindFragDataLocationIndexed");
    debug_print_sync("BindFragDataLocationIndexed");
    CALL_BindFragDataLocationIndexed(ctx->CurrentServerDispatch, (program, colorNumber, index, name));
 }
@@ -1487,7 +1480,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetClipPlane(GLenum plane, GLdouble * equation)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetClipPlane");
    debug_print_sync("GetClipPlane");
    CALL_GetClipPlane(ctx->CurrentServerDispatch, (plane, equation));
 }
@@ -1498,7 +1491,7 @@ static void GLAPIENTRY
 _mesa_marshal_DeleteSemaphoresEXT(GLsizei n, const GLuint * semaphores)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteSemaphoresEXT");
    debug_print_sync("DeleteSemaphoresEXT");
    CALL_DeleteSemaphoresEXT(ctx->CurrentServerDispatch, (n, semaphores));
 }
@@ -1509,7 +1502,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexCoordP4uiv(GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP4uiv");
    debug_print_sync("TexCoordP4uiv");
    CALL_TexCoordP4uiv(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -1556,7 +1549,7 @@ _mesa_marshal_VertexAttribs3dvNV(GLuint index, GLsizei n, const GLdouble * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs3dvNV");
    debug_print_sync_fallback("VertexAttribs3dvNV");
    CALL_VertexAttribs3dvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -1609,7 +1602,7 @@ _mesa_marshal_ProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix2x4dv");
    debug_print_sync_fallback("ProgramUniformMatrix2x4dv");
    CALL_ProgramUniformMatrix2x4dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -1620,7 +1613,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenQueries(GLsizei n, GLuint * ids)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenQueries");
    debug_print_sync("GenQueries");
    CALL_GenQueries(ctx->CurrentServerDispatch, (n, ids));
 }
@@ -1670,7 +1663,7 @@ _mesa_marshal_ProgramUniform4iv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4iv");
    debug_print_sync_fallback("ProgramUniform4iv");
    CALL_ProgramUniform4iv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -1681,7 +1674,7 @@ static GLenum GLAPIENTRY
 _mesa_marshal_ObjectUnpurgeableAPPLE(GLenum objectType, GLuint name, GLenum option)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ObjectUnpurgeableAPPLE");
    debug_print_sync("ObjectUnpurgeableAPPLE");
    return CALL_ObjectUnpurgeableAPPLE(ctx->CurrentServerDispatch, (objectType, name, option));
 }
@@ -1692,7 +1685,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetCompressedTextureSubImage");
    debug_print_sync("GetCompressedTextureSubImage");
    CALL_GetCompressedTextureSubImage(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels));
 }
@@ -1724,7 +1717,7 @@ _mesa_marshal_TexCoord2iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2iv");
    debug_print_sync_fallback("TexCoord2iv");
    CALL_TexCoord2iv(ctx->CurrentServerDispatch, (v));
 }
@@ -1771,7 +1764,7 @@ _mesa_marshal_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum inter
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexImage2DMultisample");
    debug_print_sync_fallback("TexImage2DMultisample");
    CALL_TexImage2DMultisample(ctx->CurrentServerDispatch, (target, samples, internalformat, width, height, fixedsamplelocations));
 }
@@ -1809,7 +1802,7 @@ _mesa_marshal_TexParameterx(GLenum target, GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameterx");
    debug_print_sync_fallback("TexParameterx");
    CALL_TexParameterx(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -1850,7 +1843,7 @@ _mesa_marshal_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rotatef");
    debug_print_sync_fallback("Rotatef");
    CALL_Rotatef(ctx->CurrentServerDispatch, (angle, x, y, z));
 }
@@ -1888,7 +1881,7 @@ _mesa_marshal_TexParameterf(GLenum target, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameterf");
    debug_print_sync_fallback("TexParameterf");
    CALL_TexParameterf(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -1926,7 +1919,7 @@ _mesa_marshal_TexParameteri(GLenum target, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameteri");
    debug_print_sync_fallback("TexParameteri");
    CALL_TexParameteri(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -1937,7 +1930,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformiv(GLuint program, GLint location, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformiv");
    debug_print_sync("GetUniformiv");
    CALL_GetUniformiv(ctx->CurrentServerDispatch, (program, location, params));
 }
@@ -1948,7 +1941,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearBufferSubData");
    debug_print_sync("ClearBufferSubData");
    CALL_ClearBufferSubData(ctx->CurrentServerDispatch, (target, internalformat, offset, size, format, type, data));
 }
@@ -1959,7 +1952,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureParameterfv(GLuint texture, GLenum pname, const GLfloat * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureParameterfv");
    debug_print_sync("TextureParameterfv");
    CALL_TextureParameterfv(ctx->CurrentServerDispatch, (texture, pname, param));
 }
@@ -1990,7 +1983,7 @@ _mesa_marshal_VDPAUFiniNV(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUFiniNV");
    debug_print_sync_fallback("VDPAUFiniNV");
    CALL_VDPAUFiniNV(ctx->CurrentServerDispatch, ());
 }
@@ -2043,7 +2036,7 @@ _mesa_marshal_ProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix4x2fv");
    debug_print_sync_fallback("ProgramUniformMatrix4x2fv");
    CALL_ProgramUniformMatrix4x2fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -2084,7 +2077,7 @@ _mesa_marshal_ProgramUniform2f(GLuint program, GLint location, GLfloat x, GLfloa
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2f");
    debug_print_sync_fallback("ProgramUniform2f");
    CALL_ProgramUniform2f(ctx->CurrentServerDispatch, (program, location, x, y));
 }
@@ -2125,7 +2118,7 @@ _mesa_marshal_ProgramUniform2d(GLuint program, GLint location, GLdouble x, GLdou
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2d");
    debug_print_sync_fallback("ProgramUniform2d");
    CALL_ProgramUniform2d(ctx->CurrentServerDispatch, (program, location, x, y));
 }
@@ -2166,7 +2159,7 @@ _mesa_marshal_ProgramUniform2i(GLuint program, GLint location, GLint x, GLint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2i");
    debug_print_sync_fallback("ProgramUniform2i");
    CALL_ProgramUniform2i(ctx->CurrentServerDispatch, (program, location, x, y));
 }
@@ -2201,7 +2194,7 @@ _mesa_marshal_Fogx(GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Fogx");
    debug_print_sync_fallback("Fogx");
    CALL_Fogx(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -2242,7 +2235,7 @@ _mesa_marshal_Uniform3ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3ui64ARB");
    debug_print_sync_fallback("Uniform3ui64ARB");
    CALL_Uniform3ui64ARB(ctx->CurrentServerDispatch, (location, x, y, z));
 }
@@ -2277,7 +2270,7 @@ _mesa_marshal_Fogf(GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Fogf");
    debug_print_sync_fallback("Fogf");
    CALL_Fogf(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -2288,7 +2281,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexSubImage1D");
    debug_print_sync("TexSubImage1D");
    CALL_TexSubImage1D(ctx->CurrentServerDispatch, (target, level, xoffset, width, format, type, pixels));
 }
@@ -2338,7 +2331,7 @@ _mesa_marshal_ProgramUniform3ui64vARB(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3ui64vARB");
    debug_print_sync_fallback("ProgramUniform3ui64vARB");
    CALL_ProgramUniform3ui64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -2370,7 +2363,7 @@ _mesa_marshal_Color4usv(const GLushort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4usv");
    debug_print_sync_fallback("Color4usv");
    CALL_Color4usv(ctx->CurrentServerDispatch, (v));
 }
@@ -2405,7 +2398,7 @@ _mesa_marshal_Fogi(GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Fogi");
    debug_print_sync_fallback("Fogi");
    CALL_Fogi(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -2437,7 +2430,7 @@ _mesa_marshal_DepthFunc(GLenum func)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthFunc");
    debug_print_sync_fallback("DepthFunc");
    CALL_DepthFunc(ctx->CurrentServerDispatch, (func));
 }
@@ -2448,7 +2441,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSamplerParameterIiv");
    debug_print_sync("GetSamplerParameterIiv");
    CALL_GetSamplerParameterIiv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -2492,7 +2485,7 @@ _mesa_marshal_VertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint s
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayAttribLFormat");
    debug_print_sync_fallback("VertexArrayAttribLFormat");
    CALL_VertexArrayAttribLFormat(ctx->CurrentServerDispatch, (vaobj, attribindex, size, type, relativeoffset));
 }
@@ -2536,69 +2529,12 @@ _mesa_marshal_VertexAttribI4uiEXT(GLuint index, GLuint x, GLuint y, GLuint z, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4uiEXT");
    debug_print_sync_fallback("VertexAttribI4uiEXT");
    CALL_VertexAttribI4uiEXT(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
 
 
-/* DrawElementsInstancedBaseVertexBaseInstance: marshalled asynchronously */
-struct marshal_cmd_DrawElementsInstancedBaseVertexBaseInstance
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-   GLsizei primcount;
-   GLint basevertex;
-   GLuint baseinstance;
-};
-static inline void
-_mesa_unmarshal_DrawElementsInstancedBaseVertexBaseInstance(struct gl_context *ctx, const struct marshal_cmd_DrawElementsInstancedBaseVertexBaseInstance *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   const GLsizei primcount = cmd->primcount;
-   const GLint basevertex = cmd->basevertex;
-   const GLuint baseinstance = cmd->baseinstance;
-   CALL_DrawElementsInstancedBaseVertexBaseInstance(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex, baseinstance));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices, GLsizei primcount, GLint basevertex, GLuint baseinstance)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawElementsInstancedBaseVertexBaseInstance);
-   struct marshal_cmd_DrawElementsInstancedBaseVertexBaseInstance *cmd;
-   debug_print_marshal("DrawElementsInstancedBaseVertexBaseInstance");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawElementsInstancedBaseVertexBaseInstance");
-      CALL_DrawElementsInstancedBaseVertexBaseInstance(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex, baseinstance));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawElementsInstancedBaseVertexBaseInstance, cmd_size);
-      cmd->mode = mode;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      cmd->primcount = primcount;
-      cmd->basevertex = basevertex;
-      cmd->baseinstance = baseinstance;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawElementsInstancedBaseVertexBaseInstance");
-   CALL_DrawElementsInstancedBaseVertexBaseInstance(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex, baseinstance));
-}
-
-
 /* ProgramEnvParameter4dvARB: marshalled asynchronously */
 struct marshal_cmd_ProgramEnvParameter4dvARB
 {
@@ -2631,7 +2567,7 @@ _mesa_marshal_ProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdou
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramEnvParameter4dvARB");
    debug_print_sync_fallback("ProgramEnvParameter4dvARB");
    CALL_ProgramEnvParameter4dvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -2642,7 +2578,7 @@ static void GLAPIENTRY
 _mesa_marshal_ColorTableParameteriv(GLenum target, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorTableParameteriv");
    debug_print_sync("ColorTableParameteriv");
    CALL_ColorTableParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -2653,7 +2589,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindSamplers(GLuint first, GLsizei count, const GLuint * samplers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindSamplers");
    debug_print_sync("BindSamplers");
    CALL_BindSamplers(ctx->CurrentServerDispatch, (first, count, samplers));
 }
@@ -2664,7 +2600,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, GLvoid * img)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnCompressedTexImageARB");
    debug_print_sync("GetnCompressedTexImageARB");
    CALL_GetnCompressedTexImageARB(ctx->CurrentServerDispatch, (target, lod, bufSize, img));
 }
@@ -2708,7 +2644,7 @@ _mesa_marshal_CopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLin
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyNamedBufferSubData");
    debug_print_sync_fallback("CopyNamedBufferSubData");
    CALL_CopyNamedBufferSubData(ctx->CurrentServerDispatch, (readBuffer, writeBuffer, readOffset, writeOffset, size));
 }
@@ -2743,7 +2679,7 @@ _mesa_marshal_BindSampler(GLuint unit, GLuint sampler)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindSampler");
    debug_print_sync_fallback("BindSampler");
    CALL_BindSampler(ctx->CurrentServerDispatch, (unit, sampler));
 }
@@ -2754,7 +2690,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformuiv(GLuint program, GLint location, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformuiv");
    debug_print_sync("GetUniformuiv");
    CALL_GetUniformuiv(ctx->CurrentServerDispatch, (program, location, params));
 }
@@ -2795,7 +2731,7 @@ _mesa_marshal_GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryBufferObjectuiv");
    debug_print_sync_fallback("GetQueryBufferObjectuiv");
    CALL_GetQueryBufferObjectuiv(ctx->CurrentServerDispatch, (id, buffer, pname, offset));
 }
@@ -2833,7 +2769,7 @@ _mesa_marshal_MultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2fARB");
    debug_print_sync_fallback("MultiTexCoord2fARB");
    CALL_MultiTexCoord2fARB(ctx->CurrentServerDispatch, (target, s, t));
 }
@@ -2868,7 +2804,7 @@ _mesa_marshal_Uniform1ui64ARB(GLint location, GLuint64 x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1ui64ARB");
    debug_print_sync_fallback("Uniform1ui64ARB");
    CALL_Uniform1ui64ARB(ctx->CurrentServerDispatch, (location, x));
 }
@@ -2879,7 +2815,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureImage");
    debug_print_sync("GetTextureImage");
    CALL_GetTextureImage(ctx->CurrentServerDispatch, (texture, level, format, type, bufSize, pixels));
 }
@@ -2914,7 +2850,7 @@ _mesa_marshal_MultiTexCoord3iv(GLenum target, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3iv");
    debug_print_sync_fallback("MultiTexCoord3iv");
    CALL_MultiTexCoord3iv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -2925,7 +2861,7 @@ static void GLAPIENTRY
 _mesa_marshal_Finish(void)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Finish");
    debug_print_sync("Finish");
    CALL_Finish(ctx->CurrentServerDispatch, ());
 }
@@ -2957,7 +2893,7 @@ _mesa_marshal_ClearStencil(GLint s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearStencil");
    debug_print_sync_fallback("ClearStencil");
    CALL_ClearStencil(ctx->CurrentServerDispatch, (s));
 }
@@ -2998,7 +2934,7 @@ _mesa_marshal_ClearColorIiEXT(GLint r, GLint g, GLint b, GLint a)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearColorIiEXT");
    debug_print_sync_fallback("ClearColorIiEXT");
    CALL_ClearColorIiEXT(ctx->CurrentServerDispatch, (r, g, b, a));
 }
@@ -3030,7 +2966,7 @@ _mesa_marshal_LoadMatrixd(const GLdouble * m)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadMatrixd");
    debug_print_sync_fallback("LoadMatrixd");
    CALL_LoadMatrixd(ctx->CurrentServerDispatch, (m));
 }
@@ -3041,7 +2977,7 @@ static GLintptr GLAPIENTRY
 _mesa_marshal_VDPAURegisterOutputSurfaceNV(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAURegisterOutputSurfaceNV");
    debug_print_sync("VDPAURegisterOutputSurfaceNV");
    return CALL_VDPAURegisterOutputSurfaceNV(ctx->CurrentServerDispatch, (vdpSurface, target, numTextureNames, textureNames));
 }
@@ -3076,7 +3012,7 @@ _mesa_marshal_VertexP4ui(GLenum type, GLuint value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexP4ui");
    debug_print_sync_fallback("VertexP4ui");
    CALL_VertexP4ui(ctx->CurrentServerDispatch, (type, value));
 }
@@ -3087,7 +3023,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_GetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramResourceIndex");
    debug_print_sync("GetProgramResourceIndex");
    return CALL_GetProgramResourceIndex(ctx->CurrentServerDispatch, (program, programInterface, name));
 }
@@ -3137,7 +3073,7 @@ _mesa_marshal_TextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenu
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage3DMultisample");
    debug_print_sync_fallback("TextureStorage3DMultisample");
    CALL_TextureStorage3DMultisample(ctx->CurrentServerDispatch, (texture, samples, internalformat, width, height, depth, fixedsamplelocations));
 }
@@ -3148,7 +3084,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnUniformivARB(GLuint program, GLint location, GLsizei bufSize, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnUniformivARB");
    debug_print_sync("GetnUniformivARB");
    CALL_GetnUniformivARB(ctx->CurrentServerDispatch, (program, location, bufSize, params));
 }
@@ -3179,7 +3115,7 @@ _mesa_marshal_ReleaseShaderCompiler(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ReleaseShaderCompiler");
    debug_print_sync_fallback("ReleaseShaderCompiler");
    CALL_ReleaseShaderCompiler(ctx->CurrentServerDispatch, ());
 }
@@ -3220,12 +3156,44 @@ _mesa_marshal_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfa
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendFuncSeparate");
    debug_print_sync_fallback("BlendFuncSeparate");
    CALL_BlendFuncSeparate(ctx->CurrentServerDispatch, (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha));
 }
 
 
+/* MaxShaderCompilerThreadsARB: marshalled asynchronously */
+struct marshal_cmd_MaxShaderCompilerThreadsARB
+{
+   struct marshal_cmd_base cmd_base;
+   GLuint count;
+};
+static inline void
+_mesa_unmarshal_MaxShaderCompilerThreadsARB(struct gl_context *ctx, const struct marshal_cmd_MaxShaderCompilerThreadsARB *cmd)
+{
+   const GLuint count = cmd->count;
+   CALL_MaxShaderCompilerThreadsARB(ctx->CurrentServerDispatch, (count));
+}
+static void GLAPIENTRY
+_mesa_marshal_MaxShaderCompilerThreadsARB(GLuint count)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   size_t cmd_size = sizeof(struct marshal_cmd_MaxShaderCompilerThreadsARB);
+   struct marshal_cmd_MaxShaderCompilerThreadsARB *cmd;
+   debug_print_marshal("MaxShaderCompilerThreadsARB");
+   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
+      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_MaxShaderCompilerThreadsARB, cmd_size);
+      cmd->count = count;
+      _mesa_post_marshal_hook(ctx);
+      return;
+   }
+
+   _mesa_glthread_finish_before(ctx, "MaxShaderCompilerThreadsARB");
+   debug_print_sync_fallback("MaxShaderCompilerThreadsARB");
+   CALL_MaxShaderCompilerThreadsARB(ctx->CurrentServerDispatch, (count));
+}
+
+
 /* Color3us: marshalled asynchronously */
 struct marshal_cmd_Color3us
 {
@@ -3258,7 +3226,7 @@ _mesa_marshal_Color3us(GLushort red, GLushort green, GLushort blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3us");
    debug_print_sync_fallback("Color3us");
    CALL_Color3us(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -3290,7 +3258,7 @@ _mesa_marshal_LoadMatrixx(const GLfixed * m)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadMatrixx");
    debug_print_sync_fallback("LoadMatrixx");
    CALL_LoadMatrixx(ctx->CurrentServerDispatch, (m));
 }
@@ -3301,7 +3269,7 @@ static void GLAPIENTRY
 _mesa_marshal_BufferStorage(GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BufferStorage");
    debug_print_sync("BufferStorage");
    CALL_BufferStorage(ctx->CurrentServerDispatch, (target, size, data, flags));
 }
@@ -3339,7 +3307,7 @@ _mesa_marshal_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3ub");
    debug_print_sync_fallback("Color3ub");
    CALL_Color3ub(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -3377,7 +3345,7 @@ _mesa_marshal_Color3ui(GLuint red, GLuint green, GLuint blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3ui");
    debug_print_sync_fallback("Color3ui");
    CALL_Color3ui(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -3412,7 +3380,7 @@ _mesa_marshal_VertexAttrib4dvNV(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4dvNV");
    debug_print_sync_fallback("VertexAttrib4dvNV");
    CALL_VertexAttrib4dvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -3468,7 +3436,7 @@ _mesa_marshal_AlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint a
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AlphaFragmentOp2ATI");
    debug_print_sync_fallback("AlphaFragmentOp2ATI");
    CALL_AlphaFragmentOp2ATI(ctx->CurrentServerDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
 }
@@ -3500,7 +3468,7 @@ _mesa_marshal_RasterPos4dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4dv");
    debug_print_sync_fallback("RasterPos4dv");
    CALL_RasterPos4dv(ctx->CurrentServerDispatch, (v));
 }
@@ -3511,7 +3479,7 @@ static void GLAPIENTRY
 _mesa_marshal_DeleteProgramPipelines(GLsizei n, const GLuint * pipelines)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteProgramPipelines");
    debug_print_sync("DeleteProgramPipelines");
    CALL_DeleteProgramPipelines(ctx->CurrentServerDispatch, (n, pipelines));
 }
@@ -3543,7 +3511,7 @@ _mesa_marshal_LineWidthx(GLfixed width)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LineWidthx");
    debug_print_sync_fallback("LineWidthx");
    CALL_LineWidthx(ctx->CurrentServerDispatch, (width));
 }
@@ -3554,7 +3522,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTransformFeedbacki_v");
    debug_print_sync("GetTransformFeedbacki_v");
    CALL_GetTransformFeedbacki_v(ctx->CurrentServerDispatch, (xfb, pname, index, param));
 }
@@ -3586,7 +3554,7 @@ _mesa_marshal_Indexdv(const GLdouble * c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexdv");
    debug_print_sync_fallback("Indexdv");
    CALL_Indexdv(ctx->CurrentServerDispatch, (c));
 }
@@ -3597,7 +3565,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnPixelMapfvARB(GLenum map, GLsizei bufSize, GLfloat * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnPixelMapfvARB");
    debug_print_sync("GetnPixelMapfvARB");
    CALL_GetnPixelMapfvARB(ctx->CurrentServerDispatch, (map, bufSize, values));
 }
@@ -3608,7 +3576,7 @@ static void GLAPIENTRY
 _mesa_marshal_EGLImageTargetTexture2DOES(GLenum target, GLvoid * writeOffset)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EGLImageTargetTexture2DOES");
    debug_print_sync("EGLImageTargetTexture2DOES");
    CALL_EGLImageTargetTexture2DOES(ctx->CurrentServerDispatch, (target, writeOffset));
 }
@@ -3640,7 +3608,7 @@ _mesa_marshal_DepthMask(GLboolean flag)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthMask");
    debug_print_sync_fallback("DepthMask");
    CALL_DepthMask(ctx->CurrentServerDispatch, (flag));
 }
@@ -3651,7 +3619,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos4ivMESA(const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4ivMESA");
    debug_print_sync("WindowPos4ivMESA");
    CALL_WindowPos4ivMESA(ctx->CurrentServerDispatch, (v));
 }
@@ -3662,7 +3630,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetShaderInfoLog");
    debug_print_sync("GetShaderInfoLog");
    CALL_GetShaderInfoLog(ctx->CurrentServerDispatch, (shader, bufSize, length, infoLog));
 }
@@ -3694,7 +3662,7 @@ _mesa_marshal_BindFragmentShaderATI(GLuint id)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindFragmentShaderATI");
    debug_print_sync_fallback("BindFragmentShaderATI");
    CALL_BindFragmentShaderATI(ctx->CurrentServerDispatch, (id));
 }
@@ -3738,7 +3706,7 @@ _mesa_marshal_BlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendFuncSeparateiARB");
    debug_print_sync_fallback("BlendFuncSeparateiARB");
    CALL_BlendFuncSeparateiARB(ctx->CurrentServerDispatch, (buf, srcRGB, dstRGB, srcA, dstA));
 }
@@ -3749,7 +3717,7 @@ static void GLAPIENTRY
 _mesa_marshal_EGLImageTargetRenderbufferStorageOES(GLenum target, GLvoid * writeOffset)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EGLImageTargetRenderbufferStorageOES");
    debug_print_sync("EGLImageTargetRenderbufferStorageOES");
    CALL_EGLImageTargetRenderbufferStorageOES(ctx->CurrentServerDispatch, (target, writeOffset));
 }
@@ -3760,7 +3728,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenTransformFeedbacks(GLsizei n, GLuint * ids)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenTransformFeedbacks");
    debug_print_sync("GenTransformFeedbacks");
    CALL_GenTransformFeedbacks(ctx->CurrentServerDispatch, (n, ids));
 }
@@ -3791,26 +3759,21 @@ _mesa_marshal_VertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoi
    size_t cmd_size = sizeof(struct marshal_cmd_VertexPointer);
    struct marshal_cmd_VertexPointer *cmd;
    debug_print_marshal("VertexPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("VertexPointer");
-      CALL_VertexPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexPointer, cmd_size);
       cmd->size = size;
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_POS, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexPointer");
    debug_print_sync_fallback("VertexPointer");
    CALL_VertexPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_POS, size, type, stride, pointer);
 }
 
 
@@ -3819,7 +3782,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetCompressedTexImage(GLenum target, GLint level, GLvoid * img)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetCompressedTexImage");
    debug_print_sync("GetCompressedTexImage");
    CALL_GetCompressedTexImage(ctx->CurrentServerDispatch, (target, level, img));
 }
@@ -3857,7 +3820,7 @@ _mesa_marshal_ProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLd
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramLocalParameter4dvARB");
    debug_print_sync_fallback("ProgramLocalParameter4dvARB");
    CALL_ProgramLocalParameter4dvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -3907,7 +3870,7 @@ _mesa_marshal_UniformMatrix2dv(GLint location, GLsizei count, GLboolean transpos
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix2dv");
    debug_print_sync_fallback("UniformMatrix2dv");
    CALL_UniformMatrix2dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -3918,7 +3881,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryObjectui64v");
    debug_print_sync("GetQueryObjectui64v");
    CALL_GetQueryObjectui64v(ctx->CurrentServerDispatch, (id, pname, params));
 }
@@ -3929,7 +3892,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP1uiv");
    debug_print_sync("VertexAttribP1uiv");
    CALL_VertexAttribP1uiv(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -3940,7 +3903,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsProgram(GLuint program)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsProgram");
    debug_print_sync("IsProgram");
    return CALL_IsProgram(ctx->CurrentServerDispatch, (program));
 }
@@ -3951,7 +3914,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint * buffers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindBuffersBase");
    debug_print_sync("BindBuffersBase");
    CALL_BindBuffersBase(ctx->CurrentServerDispatch, (target, first, count, buffers));
 }
@@ -3962,9 +3925,10 @@ static void GLAPIENTRY
 _mesa_marshal_GenTextures(GLsizei n, GLuint * textures)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenTextures");
    debug_print_sync("GenTextures");
    CALL_GenTextures(ctx->CurrentServerDispatch, (n, textures));
+   _mesa_glthread_GenTextures(ctx, n, textures);
 }
 
 
@@ -3973,7 +3937,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_UnmapNamedBuffer(GLuint buffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UnmapNamedBuffer");
    debug_print_sync("UnmapNamedBuffer");
    return CALL_UnmapNamedBuffer(ctx->CurrentServerDispatch, (buffer));
 }
@@ -4023,7 +3987,7 @@ _mesa_marshal_UniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix3x2dv");
    debug_print_sync_fallback("UniformMatrix3x2dv");
    CALL_UniformMatrix3x2dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -4064,7 +4028,7 @@ _mesa_marshal_WindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4fMESA");
    debug_print_sync_fallback("WindowPos4fMESA");
    CALL_WindowPos4fMESA(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -4111,7 +4075,7 @@ _mesa_marshal_VertexAttribs2fvNV(GLuint index, GLsizei n, const GLfloat * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs2fvNV");
    debug_print_sync_fallback("VertexAttribs2fvNV");
    CALL_VertexAttribs2fvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -4152,7 +4116,7 @@ _mesa_marshal_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP4ui");
    debug_print_sync_fallback("VertexAttribP4ui");
    CALL_VertexAttribP4ui(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -4163,7 +4127,7 @@ static void GLAPIENTRY
 _mesa_marshal_StringMarkerGREMEDY(GLsizei len, const GLvoid * string)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StringMarkerGREMEDY");
    debug_print_sync("StringMarkerGREMEDY");
    CALL_StringMarkerGREMEDY(ctx->CurrentServerDispatch, (len, string));
 }
@@ -4207,7 +4171,7 @@ _mesa_marshal_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4i");
    debug_print_sync_fallback("Uniform4i");
    CALL_Uniform4i(ctx->CurrentServerDispatch, (location, v0, v1, v2, v3));
 }
@@ -4251,7 +4215,7 @@ _mesa_marshal_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdo
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4d");
    debug_print_sync_fallback("Uniform4d");
    CALL_Uniform4d(ctx->CurrentServerDispatch, (location, x, y, z, w));
 }
@@ -4295,7 +4259,7 @@ _mesa_marshal_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfl
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4f");
    debug_print_sync_fallback("Uniform4f");
    CALL_Uniform4f(ctx->CurrentServerDispatch, (location, v0, v1, v2, v3));
 }
@@ -4345,7 +4309,7 @@ _mesa_marshal_ProgramUniform3dv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3dv");
    debug_print_sync_fallback("ProgramUniform3dv");
    CALL_ProgramUniform3dv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -4356,7 +4320,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedBufferParameteri64v");
    debug_print_sync("GetNamedBufferParameteri64v");
    CALL_GetNamedBufferParameteri64v(ctx->CurrentServerDispatch, (buffer, pname, params));
 }
@@ -4397,7 +4361,7 @@ _mesa_marshal_NamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLu
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferTexture");
    debug_print_sync_fallback("NamedFramebufferTexture");
    CALL_NamedFramebufferTexture(ctx->CurrentServerDispatch, (framebuffer, attachment, texture, level));
 }
@@ -4441,7 +4405,7 @@ _mesa_marshal_ProgramUniform3d(GLuint program, GLint location, GLdouble x, GLdou
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3d");
    debug_print_sync_fallback("ProgramUniform3d");
    CALL_ProgramUniform3d(ctx->CurrentServerDispatch, (program, location, x, y, z));
 }
@@ -4485,7 +4449,7 @@ _mesa_marshal_ProgramUniform3f(GLuint program, GLint location, GLfloat x, GLfloa
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3f");
    debug_print_sync_fallback("ProgramUniform3f");
    CALL_ProgramUniform3f(ctx->CurrentServerDispatch, (program, location, x, y, z));
 }
@@ -4529,7 +4493,7 @@ _mesa_marshal_ProgramUniform3i(GLuint program, GLint location, GLint x, GLint y,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3i");
    debug_print_sync_fallback("ProgramUniform3i");
    CALL_ProgramUniform3i(ctx->CurrentServerDispatch, (program, location, x, y, z));
 }
@@ -4540,7 +4504,7 @@ static void GLAPIENTRY
 _mesa_marshal_PointParameterfv(GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointParameterfv");
    debug_print_sync("PointParameterfv");
    CALL_PointParameterfv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -4551,7 +4515,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetHistogramParameterfv(GLenum target, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetHistogramParameterfv");
    debug_print_sync("GetHistogramParameterfv");
    CALL_GetHistogramParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -4562,7 +4526,7 @@ static const GLubyte * GLAPIENTRY
 _mesa_marshal_GetString(GLenum name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetString");
    debug_print_sync("GetString");
    return CALL_GetString(ctx->CurrentServerDispatch, (name));
 }
@@ -4573,7 +4537,7 @@ static void GLAPIENTRY
 _mesa_marshal_VDPAUUnmapSurfacesNV(GLsizei numSurfaces, const GLintptr * surfaces)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUUnmapSurfacesNV");
    debug_print_sync("VDPAUUnmapSurfacesNV");
    CALL_VDPAUUnmapSurfacesNV(ctx->CurrentServerDispatch, (numSurfaces, surfaces));
 }
@@ -4584,7 +4548,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnHistogramARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, GLvoid * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnHistogramARB");
    debug_print_sync("GetnHistogramARB");
    CALL_GetnHistogramARB(ctx->CurrentServerDispatch, (target, reset, format, type, bufSize, values));
 }
@@ -4622,7 +4586,7 @@ _mesa_marshal_SecondaryColor3s(GLshort red, GLshort green, GLshort blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3s");
    debug_print_sync_fallback("SecondaryColor3s");
    CALL_SecondaryColor3s(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -4672,7 +4636,7 @@ _mesa_marshal_TexStorageMem2DEXT(GLenum target, GLsizei levels, GLenum internalF
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorageMem2DEXT");
    debug_print_sync_fallback("TexStorageMem2DEXT");
    CALL_TexStorageMem2DEXT(ctx->CurrentServerDispatch, (target, levels, internalFormat, width, height, memory, offset));
 }
@@ -4683,7 +4647,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP2uiv");
    debug_print_sync("VertexAttribP2uiv");
    CALL_VertexAttribP2uiv(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -4733,7 +4697,7 @@ _mesa_marshal_UniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix3x4dv");
    debug_print_sync_fallback("UniformMatrix3x4dv");
    CALL_UniformMatrix3x4dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -4774,7 +4738,7 @@ _mesa_marshal_VertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3fNV");
    debug_print_sync_fallback("VertexAttrib3fNV");
    CALL_VertexAttrib3fNV(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -4812,7 +4776,7 @@ _mesa_marshal_SecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3b");
    debug_print_sync_fallback("SecondaryColor3b");
    CALL_SecondaryColor3b(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -4840,13 +4804,15 @@ _mesa_marshal_EnableClientState(GLenum array)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_EnableClientState, cmd_size);
       cmd->array = array;
+      _mesa_glthread_ClientState(ctx, array, true);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EnableClientState");
    debug_print_sync_fallback("EnableClientState");
    CALL_EnableClientState(ctx->CurrentServerDispatch, (array));
+   _mesa_glthread_ClientState(ctx, array, true);
 }
 
 
@@ -4855,7 +4821,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei * length, GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveSubroutineName");
    debug_print_sync("GetActiveSubroutineName");
    CALL_GetActiveSubroutineName(ctx->CurrentServerDispatch, (program, shadertype, index, bufsize, length, name));
 }
@@ -4893,7 +4859,7 @@ _mesa_marshal_SecondaryColor3i(GLint red, GLint green, GLint blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3i");
    debug_print_sync_fallback("SecondaryColor3i");
    CALL_SecondaryColor3i(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -4931,7 +4897,7 @@ _mesa_marshal_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FlushMappedBufferRange");
    debug_print_sync_fallback("FlushMappedBufferRange");
    CALL_FlushMappedBufferRange(ctx->CurrentServerDispatch, (target, offset, length));
 }
@@ -4984,7 +4950,7 @@ _mesa_marshal_TexStorageMem3DEXT(GLenum target, GLsizei levels, GLenum internalF
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorageMem3DEXT");
    debug_print_sync_fallback("TexStorageMem3DEXT");
    CALL_TexStorageMem3DEXT(ctx->CurrentServerDispatch, (target, levels, internalFormat, width, height, depth, memory, offset));
 }
@@ -4995,7 +4961,7 @@ static void GLAPIENTRY
 _mesa_marshal_Lightfv(GLenum light, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Lightfv");
    debug_print_sync("Lightfv");
    CALL_Lightfv(ctx->CurrentServerDispatch, (light, pname, params));
 }
@@ -5006,7 +4972,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFramebufferAttachmentParameteriv");
    debug_print_sync("GetFramebufferAttachmentParameteriv");
    CALL_GetFramebufferAttachmentParameteriv(ctx->CurrentServerDispatch, (target, attachment, pname, params));
 }
@@ -5017,7 +4983,7 @@ static void GLAPIENTRY
 _mesa_marshal_ColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorSubTable");
    debug_print_sync("ColorSubTable");
    CALL_ColorSubTable(ctx->CurrentServerDispatch, (target, start, count, format, type, data));
 }
@@ -5028,7 +4994,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexArrayIndexed64iv");
    debug_print_sync("GetVertexArrayIndexed64iv");
    CALL_GetVertexArrayIndexed64iv(ctx->CurrentServerDispatch, (vaobj, index, pname, param));
 }
@@ -5060,7 +5026,7 @@ _mesa_marshal_EndPerfMonitorAMD(GLuint monitor)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndPerfMonitorAMD");
    debug_print_sync_fallback("EndPerfMonitorAMD");
    CALL_EndPerfMonitorAMD(ctx->CurrentServerDispatch, (monitor));
 }
@@ -5071,9 +5037,10 @@ static void GLAPIENTRY
 _mesa_marshal_CreateBuffers(GLsizei n, GLuint * buffers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateBuffers");
    debug_print_sync("CreateBuffers");
    CALL_CreateBuffers(ctx->CurrentServerDispatch, (n, buffers));
+   _mesa_glthread_GenBuffers(ctx, n, buffers);
 }
 
 
@@ -5118,7 +5085,7 @@ _mesa_marshal_VertexAttribs4dvNV(GLuint index, GLsizei n, const GLdouble * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs4dvNV");
    debug_print_sync_fallback("VertexAttribs4dvNV");
    CALL_VertexAttribs4dvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -5165,7 +5132,7 @@ _mesa_marshal_Uniform2i64vARB(GLint location, GLsizei count, const GLint64 * val
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2i64vARB");
    debug_print_sync_fallback("Uniform2i64vARB");
    CALL_Uniform2i64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -5176,7 +5143,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMultisamplefv(GLenum pname, GLuint index, GLfloat * val)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMultisamplefv");
    debug_print_sync("GetMultisamplefv");
    CALL_GetMultisamplefv(ctx->CurrentServerDispatch, (pname, index, val));
 }
@@ -5187,7 +5154,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei * length, GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveSubroutineUniformName");
    debug_print_sync("GetActiveSubroutineUniformName");
    CALL_GetActiveSubroutineUniformName(ctx->CurrentServerDispatch, (program, shadertype, index, bufsize, length, name));
 }
@@ -5222,53 +5189,12 @@ _mesa_marshal_Rectdv(const GLdouble * v1, const GLdouble * v2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rectdv");
    debug_print_sync_fallback("Rectdv");
    CALL_Rectdv(ctx->CurrentServerDispatch, (v1, v2));
 }
 
 
-/* DrawArraysInstancedARB: marshalled asynchronously */
-struct marshal_cmd_DrawArraysInstancedARB
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLint first;
-   GLsizei count;
-   GLsizei primcount;
-};
-static inline void
-_mesa_unmarshal_DrawArraysInstancedARB(struct gl_context *ctx, const struct marshal_cmd_DrawArraysInstancedARB *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLint first = cmd->first;
-   const GLsizei count = cmd->count;
-   const GLsizei primcount = cmd->primcount;
-   CALL_DrawArraysInstancedARB(ctx->CurrentServerDispatch, (mode, first, count, primcount));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawArraysInstancedARB);
-   struct marshal_cmd_DrawArraysInstancedARB *cmd;
-   debug_print_marshal("DrawArraysInstancedARB");
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawArraysInstancedARB, cmd_size);
-      cmd->mode = mode;
-      cmd->first = first;
-      cmd->count = count;
-      cmd->primcount = primcount;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawArraysInstancedARB");
-   CALL_DrawArraysInstancedARB(ctx->CurrentServerDispatch, (mode, first, count, primcount));
-}
-
-
 /* MakeImageHandleNonResidentARB: marshalled asynchronously */
 struct marshal_cmd_MakeImageHandleNonResidentARB
 {
@@ -5295,7 +5221,7 @@ _mesa_marshal_MakeImageHandleNonResidentARB(GLuint64 handle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MakeImageHandleNonResidentARB");
    debug_print_sync_fallback("MakeImageHandleNonResidentARB");
    CALL_MakeImageHandleNonResidentARB(ctx->CurrentServerDispatch, (handle));
 }
@@ -5336,7 +5262,7 @@ _mesa_marshal_ImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ImportMemoryFdEXT");
    debug_print_sync_fallback("ImportMemoryFdEXT");
    CALL_ImportMemoryFdEXT(ctx->CurrentServerDispatch, (memory, size, handleType, fd));
 }
@@ -5347,7 +5273,7 @@ static void GLAPIENTRY
 _mesa_marshal_ProgramEnvParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramEnvParameters4fvEXT");
    debug_print_sync("ProgramEnvParameters4fvEXT");
    CALL_ProgramEnvParameters4fvEXT(ctx->CurrentServerDispatch, (target, index, count, params));
 }
@@ -5394,7 +5320,7 @@ _mesa_marshal_TexStorageMem1DEXT(GLenum target, GLsizei levels, GLenum internalF
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorageMem1DEXT");
    debug_print_sync_fallback("TexStorageMem1DEXT");
    CALL_TexStorageMem1DEXT(ctx->CurrentServerDispatch, (target, levels, internalFormat, width, memory, offset));
 }
@@ -5425,7 +5351,7 @@ _mesa_marshal_BlendBarrier(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendBarrier");
    debug_print_sync_fallback("BlendBarrier");
    CALL_BlendBarrier(ctx->CurrentServerDispatch, ());
 }
@@ -5460,7 +5386,7 @@ _mesa_marshal_VertexAttrib2svNV(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2svNV");
    debug_print_sync_fallback("VertexAttrib2svNV");
    CALL_VertexAttrib2svNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -5471,7 +5397,7 @@ static void GLAPIENTRY
 _mesa_marshal_SecondaryColorP3uiv(GLenum type, const GLuint * color)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColorP3uiv");
    debug_print_sync("SecondaryColorP3uiv");
    CALL_SecondaryColorP3uiv(ctx->CurrentServerDispatch, (type, color));
 }
@@ -5482,7 +5408,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnPixelMapuivARB(GLenum map, GLsizei bufSize, GLuint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnPixelMapuivARB");
    debug_print_sync("GetnPixelMapuivARB");
    CALL_GetnPixelMapuivARB(ctx->CurrentServerDispatch, (map, bufSize, values));
 }
@@ -5493,7 +5419,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSamplerParameterIuiv");
    debug_print_sync("GetSamplerParameterIuiv");
    CALL_GetSamplerParameterIuiv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -5524,13 +5450,15 @@ _mesa_marshal_Disablei(GLenum target, GLuint index)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_Disablei, cmd_size);
       cmd->target = target;
       cmd->index = index;
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Disablei");
    debug_print_sync_fallback("Disablei");
    CALL_Disablei(ctx->CurrentServerDispatch, (target, index));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -5539,7 +5467,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTexSubImage3D");
    debug_print_sync("CompressedTexSubImage3D");
    CALL_CompressedTexSubImage3D(ctx->CurrentServerDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data));
 }
@@ -5550,7 +5478,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos4svMESA(const GLshort * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4svMESA");
    debug_print_sync("WindowPos4svMESA");
    CALL_WindowPos4svMESA(ctx->CurrentServerDispatch, (v));
 }
@@ -5561,7 +5489,7 @@ static void GLAPIENTRY
 _mesa_marshal_ObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ObjectLabel");
    debug_print_sync("ObjectLabel");
    CALL_ObjectLabel(ctx->CurrentServerDispatch, (identifier, name, length, label));
 }
@@ -5593,7 +5521,7 @@ _mesa_marshal_Color3dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3dv");
    debug_print_sync_fallback("Color3dv");
    CALL_Color3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -5631,7 +5559,7 @@ _mesa_marshal_ProgramUniform1ui64ARB(GLuint program, GLint location, GLuint64 x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1ui64ARB");
    debug_print_sync_fallback("ProgramUniform1ui64ARB");
    CALL_ProgramUniform1ui64ARB(ctx->CurrentServerDispatch, (program, location, x));
 }
@@ -5666,7 +5594,7 @@ _mesa_marshal_BeginQuery(GLenum target, GLuint id)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginQuery");
    debug_print_sync_fallback("BeginQuery");
    CALL_BeginQuery(ctx->CurrentServerDispatch, (target, id));
 }
@@ -5677,7 +5605,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexP3uiv(GLenum type, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexP3uiv");
    debug_print_sync("VertexP3uiv");
    CALL_VertexP3uiv(ctx->CurrentServerDispatch, (type, value));
 }
@@ -5688,7 +5616,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetUniformLocation(GLuint program, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformLocation");
    debug_print_sync("GetUniformLocation");
    return CALL_GetUniformLocation(ctx->CurrentServerDispatch, (program, name));
 }
@@ -5723,7 +5651,7 @@ _mesa_marshal_PixelStoref(GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelStoref");
    debug_print_sync_fallback("PixelStoref");
    CALL_PixelStoref(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -5734,7 +5662,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos2iv(const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2iv");
    debug_print_sync("WindowPos2iv");
    CALL_WindowPos2iv(ctx->CurrentServerDispatch, (v));
 }
@@ -5769,7 +5697,7 @@ _mesa_marshal_PixelStorei(GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelStorei");
    debug_print_sync_fallback("PixelStorei");
    CALL_PixelStorei(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -5816,7 +5744,7 @@ _mesa_marshal_VertexAttribs1svNV(GLuint index, GLsizei n, const GLshort * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs1svNV");
    debug_print_sync_fallback("VertexAttribs1svNV");
    CALL_VertexAttribs1svNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -5827,7 +5755,7 @@ static GLenum GLAPIENTRY
 _mesa_marshal_CheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CheckNamedFramebufferStatus");
    debug_print_sync("CheckNamedFramebufferStatus");
    return CALL_CheckNamedFramebufferStatus(ctx->CurrentServerDispatch, (framebuffer, target));
 }
@@ -5838,7 +5766,7 @@ static void GLAPIENTRY
 _mesa_marshal_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformSubroutinesuiv");
    debug_print_sync("UniformSubroutinesuiv");
    CALL_UniformSubroutinesuiv(ctx->CurrentServerDispatch, (shadertype, count, indices));
 }
@@ -5849,7 +5777,7 @@ static GLenum GLAPIENTRY
 _mesa_marshal_CheckFramebufferStatus(GLenum target)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CheckFramebufferStatus");
    debug_print_sync("CheckFramebufferStatus");
    return CALL_CheckFramebufferStatus(ctx->CurrentServerDispatch, (target));
 }
@@ -5881,7 +5809,7 @@ _mesa_marshal_DispatchComputeIndirect(GLintptr indirect)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DispatchComputeIndirect");
    debug_print_sync_fallback("DispatchComputeIndirect");
    CALL_DispatchComputeIndirect(ctx->CurrentServerDispatch, (indirect));
 }
@@ -5913,7 +5841,7 @@ _mesa_marshal_InvalidateBufferData(GLuint buffer)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateBufferData");
    debug_print_sync_fallback("InvalidateBufferData");
    CALL_InvalidateBufferData(ctx->CurrentServerDispatch, (buffer));
 }
@@ -5924,7 +5852,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformdv(GLuint program, GLint location, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformdv");
    debug_print_sync("GetUniformdv");
    CALL_GetUniformdv(ctx->CurrentServerDispatch, (program, location, params));
 }
@@ -5935,7 +5863,7 @@ static void GLAPIENTRY
 _mesa_marshal_ProgramLocalParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramLocalParameters4fvEXT");
    debug_print_sync("ProgramLocalParameters4fvEXT");
    CALL_ProgramLocalParameters4fvEXT(ctx->CurrentServerDispatch, (target, index, count, params));
 }
@@ -5946,7 +5874,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribL1dv(GLuint index, const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL1dv");
    debug_print_sync("VertexAttribL1dv");
    CALL_VertexAttribL1dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -5993,7 +5921,7 @@ _mesa_marshal_Uniform1ui64vARB(GLint location, GLsizei count, const GLuint64 * v
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1ui64vARB");
    debug_print_sync_fallback("Uniform1ui64vARB");
    CALL_Uniform1ui64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -6004,7 +5932,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsFramebuffer(GLuint framebuffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsFramebuffer");
    debug_print_sync("IsFramebuffer");
    return CALL_IsFramebuffer(ctx->CurrentServerDispatch, (framebuffer));
 }
@@ -6015,7 +5943,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetDoublev(GLenum pname, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetDoublev");
    debug_print_sync("GetDoublev");
    CALL_GetDoublev(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -6026,7 +5954,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetObjectLabel");
    debug_print_sync("GetObjectLabel");
    CALL_GetObjectLabel(ctx->CurrentServerDispatch, (identifier, name, bufSize, length, label));
 }
@@ -6037,7 +5965,7 @@ static void GLAPIENTRY
 _mesa_marshal_ColorP3uiv(GLenum type, const GLuint * color)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorP3uiv");
    debug_print_sync("ColorP3uiv");
    CALL_ColorP3uiv(ctx->CurrentServerDispatch, (type, color));
 }
@@ -6048,7 +5976,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureSubImage");
    debug_print_sync("GetTextureSubImage");
    CALL_GetTextureSubImage(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels));
 }
@@ -6059,7 +5987,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI4ivEXT(GLuint index, const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4ivEXT");
    debug_print_sync("VertexAttribI4ivEXT");
    CALL_VertexAttribI4ivEXT(ctx->CurrentServerDispatch, (index, v));
 }
@@ -6094,7 +6022,7 @@ _mesa_marshal_VertexAttrib1svNV(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1svNV");
    debug_print_sync_fallback("VertexAttrib1svNV");
    CALL_VertexAttrib1svNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -6126,7 +6054,7 @@ _mesa_marshal_SecondaryColor3ubv(const GLubyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3ubv");
    debug_print_sync_fallback("SecondaryColor3ubv");
    CALL_SecondaryColor3ubv(ctx->CurrentServerDispatch, (v));
 }
@@ -6137,7 +6065,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_GetDebugMessageLog(GLuint count, GLsizei bufsize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetDebugMessageLog");
    debug_print_sync("GetDebugMessageLog");
    return CALL_GetDebugMessageLog(ctx->CurrentServerDispatch, (count, bufsize, sources, types, ids, severities, lengths, messageLog));
 }
@@ -6181,7 +6109,7 @@ _mesa_marshal_Uniform4ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4ui64ARB");
    debug_print_sync_fallback("Uniform4ui64ARB");
    CALL_Uniform4ui64ARB(ctx->CurrentServerDispatch, (location, x, y, z, w));
 }
@@ -6213,7 +6141,7 @@ _mesa_marshal_RasterPos3fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3fv");
    debug_print_sync_fallback("RasterPos3fv");
    CALL_RasterPos3fv(ctx->CurrentServerDispatch, (v));
 }
@@ -6224,7 +6152,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetShaderSource");
    debug_print_sync("GetShaderSource");
    CALL_GetShaderSource(ctx->CurrentServerDispatch, (shader, bufSize, length, source));
 }
@@ -6259,7 +6187,7 @@ _mesa_marshal_BindProgramARB(GLenum target, GLuint program)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindProgramARB");
    debug_print_sync_fallback("BindProgramARB");
    CALL_BindProgramARB(ctx->CurrentServerDispatch, (target, program));
 }
@@ -6300,7 +6228,7 @@ _mesa_marshal_VertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3sNV");
    debug_print_sync_fallback("VertexAttrib3sNV");
    CALL_VertexAttrib3sNV(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -6350,7 +6278,7 @@ _mesa_marshal_ColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorFragmentOp1ATI");
    debug_print_sync_fallback("ColorFragmentOp1ATI");
    CALL_ColorFragmentOp1ATI(ctx->CurrentServerDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod));
 }
@@ -6403,7 +6331,7 @@ _mesa_marshal_ProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix4x3fv");
    debug_print_sync_fallback("ProgramUniformMatrix4x3fv");
    CALL_ProgramUniformMatrix4x3fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -6430,64 +6358,15 @@ _mesa_marshal_PopClientAttrib(void)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_PopClientAttrib, cmd_size);
       (void) cmd;
 
+      _mesa_glthread_PopClientAttrib(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PopClientAttrib");
    debug_print_sync_fallback("PopClientAttrib");
    CALL_PopClientAttrib(ctx->CurrentServerDispatch, ());
-}
-
-
-/* DrawElementsInstancedARB: marshalled asynchronously */
-struct marshal_cmd_DrawElementsInstancedARB
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-   GLsizei primcount;
-};
-static inline void
-_mesa_unmarshal_DrawElementsInstancedARB(struct gl_context *ctx, const struct marshal_cmd_DrawElementsInstancedARB *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   const GLsizei primcount = cmd->primcount;
-   CALL_DrawElementsInstancedARB(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices, GLsizei primcount)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawElementsInstancedARB);
-   struct marshal_cmd_DrawElementsInstancedARB *cmd;
-   debug_print_marshal("DrawElementsInstancedARB");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawElementsInstancedARB");
-      CALL_DrawElementsInstancedARB(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawElementsInstancedARB, cmd_size);
-      cmd->mode = mode;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      cmd->primcount = primcount;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawElementsInstancedARB");
-   CALL_DrawElementsInstancedARB(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount));
+   _mesa_glthread_PopClientAttrib(ctx);
 }
 
 
@@ -6496,7 +6375,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryObjectuiv");
    debug_print_sync("GetQueryObjectuiv");
    CALL_GetQueryObjectuiv(ctx->CurrentServerDispatch, (id, pname, params));
 }
@@ -6507,7 +6386,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI4bv(GLuint index, const GLbyte * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4bv");
    debug_print_sync("VertexAttribI4bv");
    CALL_VertexAttribI4bv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -6542,7 +6421,7 @@ _mesa_marshal_DisableVertexArrayAttrib(GLuint vaobj, GLuint index)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DisableVertexArrayAttrib");
    debug_print_sync_fallback("DisableVertexArrayAttrib");
    CALL_DisableVertexArrayAttrib(ctx->CurrentServerDispatch, (vaobj, index));
 }
@@ -6586,7 +6465,7 @@ _mesa_marshal_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL4d");
    debug_print_sync_fallback("VertexAttribL4d");
    CALL_VertexAttribL4d(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -6618,7 +6497,7 @@ _mesa_marshal_ListBase(GLuint base)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ListBase");
    debug_print_sync_fallback("ListBase");
    CALL_ListBase(ctx->CurrentServerDispatch, (base));
 }
@@ -6650,7 +6529,7 @@ _mesa_marshal_GenerateMipmap(GLenum target)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenerateMipmap");
    debug_print_sync_fallback("GenerateMipmap");
    CALL_GenerateMipmap(ctx->CurrentServerDispatch, (target));
 }
@@ -6694,7 +6573,7 @@ _mesa_marshal_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintp
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindBufferRange");
    debug_print_sync_fallback("BindBufferRange");
    CALL_BindBufferRange(ctx->CurrentServerDispatch, (target, index, buffer, offset, size));
 }
@@ -6747,7 +6626,7 @@ _mesa_marshal_ProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix2x4fv");
    debug_print_sync_fallback("ProgramUniformMatrix2x4fv");
    CALL_ProgramUniformMatrix2x4fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -6785,7 +6664,7 @@ _mesa_marshal_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindBufferBase");
    debug_print_sync_fallback("BindBufferBase");
    CALL_BindBufferBase(ctx->CurrentServerDispatch, (target, index, buffer));
 }
@@ -6796,7 +6675,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetQueryObjectiv(GLuint id, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryObjectiv");
    debug_print_sync("GetQueryObjectiv");
    CALL_GetQueryObjectiv(ctx->CurrentServerDispatch, (id, pname, params));
 }
@@ -6834,7 +6713,7 @@ _mesa_marshal_VertexAttrib2s(GLuint index, GLshort x, GLshort y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2s");
    debug_print_sync_fallback("VertexAttrib2s");
    CALL_VertexAttrib2s(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -6866,7 +6745,7 @@ _mesa_marshal_SecondaryColor3fvEXT(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3fvEXT");
    debug_print_sync_fallback("SecondaryColor3fvEXT");
    CALL_SecondaryColor3fvEXT(ctx->CurrentServerDispatch, (v));
 }
@@ -6904,7 +6783,7 @@ _mesa_marshal_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2d");
    debug_print_sync_fallback("VertexAttrib2d");
    CALL_VertexAttrib2d(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -6915,7 +6794,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearNamedFramebufferiv");
    debug_print_sync("ClearNamedFramebufferiv");
    CALL_ClearNamedFramebufferiv(ctx->CurrentServerDispatch, (framebuffer, buffer, drawbuffer, value));
 }
@@ -6962,7 +6841,7 @@ _mesa_marshal_Uniform1fv(GLint location, GLsizei count, const GLfloat * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1fv");
    debug_print_sync_fallback("Uniform1fv");
    CALL_Uniform1fv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -6973,7 +6852,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramPipelineInfoLog");
    debug_print_sync("GetProgramPipelineInfoLog");
    CALL_GetProgramPipelineInfoLog(ctx->CurrentServerDispatch, (pipeline, bufSize, length, infoLog));
 }
@@ -7008,7 +6887,7 @@ _mesa_marshal_DepthBoundsEXT(GLclampd zmin, GLclampd zmax)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthBoundsEXT");
    debug_print_sync_fallback("DepthBoundsEXT");
    CALL_DepthBoundsEXT(ctx->CurrentServerDispatch, (zmin, zmax));
 }
@@ -7049,7 +6928,7 @@ _mesa_marshal_BufferStorageMemEXT(GLenum target, GLsizeiptr size, GLuint memory,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BufferStorageMemEXT");
    debug_print_sync_fallback("BufferStorageMemEXT");
    CALL_BufferStorageMemEXT(ctx->CurrentServerDispatch, (target, size, memory, offset));
 }
@@ -7081,7 +6960,7 @@ _mesa_marshal_WindowPos3fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3fv");
    debug_print_sync_fallback("WindowPos3fv");
    CALL_WindowPos3fv(ctx->CurrentServerDispatch, (v));
 }
@@ -7092,7 +6971,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetHistogramParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetHistogramParameteriv");
    debug_print_sync("GetHistogramParameteriv");
    CALL_GetHistogramParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -7103,7 +6982,7 @@ static void GLAPIENTRY
 _mesa_marshal_PointParameteriv(GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointParameteriv");
    debug_print_sync("PointParameteriv");
    CALL_PointParameteriv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -7144,7 +7023,7 @@ _mesa_marshal_NamedRenderbufferStorage(GLuint renderbuffer, GLenum internalforma
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedRenderbufferStorage");
    debug_print_sync_fallback("NamedRenderbufferStorage");
    CALL_NamedRenderbufferStorage(ctx->CurrentServerDispatch, (renderbuffer, internalformat, width, height));
 }
@@ -7155,7 +7034,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramivARB(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramivARB");
    debug_print_sync("GetProgramivARB");
    CALL_GetProgramivARB(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -7186,13 +7065,15 @@ _mesa_marshal_BindRenderbuffer(GLenum target, GLuint renderbuffer)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindRenderbuffer, cmd_size);
       cmd->target = target;
       cmd->renderbuffer = renderbuffer;
+      _mesa_glthread_BindRenderbuffer(ctx, target, renderbuffer, _mesa_is_gles(ctx));
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindRenderbuffer");
    debug_print_sync_fallback("BindRenderbuffer");
    CALL_BindRenderbuffer(ctx->CurrentServerDispatch, (target, renderbuffer));
+   _mesa_glthread_BindRenderbuffer(ctx, target, renderbuffer, _mesa_is_gles(ctx));
 }
 
 
@@ -7228,7 +7109,7 @@ _mesa_marshal_SecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3fEXT");
    debug_print_sync_fallback("SecondaryColor3fEXT");
    CALL_SecondaryColor3fEXT(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -7256,13 +7137,15 @@ _mesa_marshal_PrimitiveRestartIndex(GLuint index)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_PrimitiveRestartIndex, cmd_size);
       cmd->index = index;
+      _mesa_glthread_PrimitiveRestartIndex(ctx, index);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PrimitiveRestartIndex");
    debug_print_sync_fallback("PrimitiveRestartIndex");
    CALL_PrimitiveRestartIndex(ctx->CurrentServerDispatch, (index));
+   _mesa_glthread_PrimitiveRestartIndex(ctx, index);
 }
 
 
@@ -7313,7 +7196,7 @@ _mesa_marshal_TextureStorageMem3DEXT(GLuint texture, GLsizei levels, GLenum inte
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorageMem3DEXT");
    debug_print_sync_fallback("TextureStorageMem3DEXT");
    CALL_TextureStorageMem3DEXT(ctx->CurrentServerDispatch, (texture, levels, internalFormat, width, height, depth, memory, offset));
 }
@@ -7324,7 +7207,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI4ubv(GLuint index, const GLubyte * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4ubv");
    debug_print_sync("VertexAttribI4ubv");
    CALL_VertexAttribI4ubv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -7335,7 +7218,7 @@ static GLenum GLAPIENTRY
 _mesa_marshal_GetGraphicsResetStatusARB(void)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetGraphicsResetStatusARB");
    debug_print_sync("GetGraphicsResetStatusARB");
    return CALL_GetGraphicsResetStatusARB(ctx->CurrentServerDispatch, ());
 }
@@ -7346,9 +7229,10 @@ static void GLAPIENTRY
 _mesa_marshal_CreateRenderbuffers(GLsizei n, GLuint * renderbuffers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateRenderbuffers");
    debug_print_sync("CreateRenderbuffers");
    CALL_CreateRenderbuffers(ctx->CurrentServerDispatch, (n, renderbuffers));
+   _mesa_glthread_GenRenderbuffers(ctx, n, renderbuffers);
 }
 
 
@@ -7378,7 +7262,7 @@ _mesa_marshal_ActiveStencilFaceEXT(GLenum face)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ActiveStencilFaceEXT");
    debug_print_sync_fallback("ActiveStencilFaceEXT");
    CALL_ActiveStencilFaceEXT(ctx->CurrentServerDispatch, (face));
 }
@@ -7422,7 +7306,7 @@ _mesa_marshal_VertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4dNV");
    debug_print_sync_fallback("VertexAttrib4dNV");
    CALL_VertexAttrib4dNV(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -7457,7 +7341,7 @@ _mesa_marshal_DepthRange(GLclampd zNear, GLclampd zFar)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRange");
    debug_print_sync_fallback("DepthRange");
    CALL_DepthRange(ctx->CurrentServerDispatch, (zNear, zFar));
 }
@@ -7501,7 +7385,7 @@ _mesa_marshal_VertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4fNV");
    debug_print_sync_fallback("VertexAttrib4fNV");
    CALL_VertexAttrib4fNV(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -7548,7 +7432,7 @@ _mesa_marshal_Uniform4fv(GLint location, GLsizei count, const GLfloat * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4fv");
    debug_print_sync_fallback("Uniform4fv");
    CALL_Uniform4fv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -7559,7 +7443,7 @@ static void GLAPIENTRY
 _mesa_marshal_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SamplerParameterIiv");
    debug_print_sync("SamplerParameterIiv");
    CALL_SamplerParameterIiv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -7606,7 +7490,7 @@ _mesa_marshal_Frustumf(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Frustumf");
    debug_print_sync_fallback("Frustumf");
    CALL_Frustumf(ctx->CurrentServerDispatch, (left, right, bottom, top, zNear, zFar));
 }
@@ -7647,7 +7531,7 @@ _mesa_marshal_GetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryBufferObjectui64v");
    debug_print_sync_fallback("GetQueryBufferObjectui64v");
    CALL_GetQueryBufferObjectui64v(ctx->CurrentServerDispatch, (id, buffer, pname, offset));
 }
@@ -7697,7 +7581,7 @@ _mesa_marshal_ProgramUniform2uiv(GLuint program, GLint location, GLsizei count,
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2uiv");
    debug_print_sync_fallback("ProgramUniform2uiv");
    CALL_ProgramUniform2uiv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -7732,7 +7616,7 @@ _mesa_marshal_Rectsv(const GLshort * v1, const GLshort * v2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rectsv");
    debug_print_sync_fallback("Rectsv");
    CALL_Rectsv(ctx->CurrentServerDispatch, (v1, v2));
 }
@@ -7779,7 +7663,7 @@ _mesa_marshal_Frustumx(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Frustumx");
    debug_print_sync_fallback("Frustumx");
    CALL_Frustumx(ctx->CurrentServerDispatch, (left, right, bottom, top, zNear, zFar));
 }
@@ -7811,7 +7695,7 @@ _mesa_marshal_CullFace(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CullFace");
    debug_print_sync_fallback("CullFace");
    CALL_CullFace(ctx->CurrentServerDispatch, (mode));
 }
@@ -7842,13 +7726,15 @@ _mesa_marshal_BindTexture(GLenum target, GLuint texture)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindTexture, cmd_size);
       cmd->target = target;
       cmd->texture = texture;
+      _mesa_glthread_BindTexture(ctx, target, texture);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindTexture");
    debug_print_sync_fallback("BindTexture");
    CALL_BindTexture(ctx->CurrentServerDispatch, (target, texture));
+   _mesa_glthread_BindTexture(ctx, target, texture);
 }
 
 
@@ -7890,7 +7776,7 @@ _mesa_marshal_MultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4fARB");
    debug_print_sync_fallback("MultiTexCoord4fARB");
    CALL_MultiTexCoord4fARB(ctx->CurrentServerDispatch, (target, s, t, r, q));
 }
@@ -7928,7 +7814,7 @@ _mesa_marshal_Uniform2ui64ARB(GLint location, GLuint64 x, GLuint64 y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2ui64ARB");
    debug_print_sync_fallback("Uniform2ui64ARB");
    CALL_Uniform2ui64ARB(ctx->CurrentServerDispatch, (location, x, y));
 }
@@ -7939,7 +7825,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP2uiv");
    debug_print_sync("MultiTexCoordP2uiv");
    CALL_MultiTexCoordP2uiv(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -7971,7 +7857,7 @@ _mesa_marshal_BeginPerfQueryINTEL(GLuint queryHandle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginPerfQueryINTEL");
    debug_print_sync_fallback("BeginPerfQueryINTEL");
    CALL_BeginPerfQueryINTEL(ctx->CurrentServerDispatch, (queryHandle));
 }
@@ -8000,25 +7886,20 @@ _mesa_marshal_NormalPointer(GLenum type, GLsizei stride, const GLvoid * pointer)
    size_t cmd_size = sizeof(struct marshal_cmd_NormalPointer);
    struct marshal_cmd_NormalPointer *cmd;
    debug_print_marshal("NormalPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("NormalPointer");
-      CALL_NormalPointer(ctx->CurrentServerDispatch, (type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_NormalPointer, cmd_size);
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_NORMAL, 3, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NormalPointer");
    debug_print_sync_fallback("NormalPointer");
    CALL_NormalPointer(ctx->CurrentServerDispatch, (type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_NORMAL, 3, type, stride, pointer);
 }
 
 
@@ -8057,7 +7938,7 @@ _mesa_marshal_WindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4iMESA");
    debug_print_sync_fallback("WindowPos4iMESA");
    CALL_WindowPos4iMESA(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -8092,7 +7973,7 @@ _mesa_marshal_VertexAttrib4bv(GLuint index, const GLbyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4bv");
    debug_print_sync_fallback("VertexAttrib4bv");
    CALL_VertexAttrib4bv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -8124,7 +8005,7 @@ _mesa_marshal_SecondaryColor3usv(const GLushort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3usv");
    debug_print_sync_fallback("SecondaryColor3usv");
    CALL_SecondaryColor3usv(ctx->CurrentServerDispatch, (v));
 }
@@ -8135,7 +8016,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPixelMapuiv(GLenum map, GLuint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPixelMapuiv");
    debug_print_sync("GetPixelMapuiv");
    CALL_GetPixelMapuiv(ctx->CurrentServerDispatch, (map, values));
 }
@@ -8146,7 +8027,7 @@ static GLvoid * GLAPIENTRY
 _mesa_marshal_MapNamedBuffer(GLuint buffer, GLenum access)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapNamedBuffer");
    debug_print_sync("MapNamedBuffer");
    return CALL_MapNamedBuffer(ctx->CurrentServerDispatch, (buffer, access));
 }
@@ -8178,7 +8059,7 @@ _mesa_marshal_Indexfv(const GLfloat * c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexfv");
    debug_print_sync_fallback("Indexfv");
    CALL_Indexfv(ctx->CurrentServerDispatch, (c));
 }
@@ -8225,7 +8106,7 @@ _mesa_marshal_AlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint a
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AlphaFragmentOp1ATI");
    debug_print_sync_fallback("AlphaFragmentOp1ATI");
    CALL_AlphaFragmentOp1ATI(ctx->CurrentServerDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod));
 }
@@ -8236,7 +8117,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetFloatv(GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFloatv");
    debug_print_sync("GetFloatv");
    CALL_GetFloatv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -8286,7 +8167,7 @@ _mesa_marshal_ProgramUniform2dv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2dv");
    debug_print_sync_fallback("ProgramUniform2dv");
    CALL_ProgramUniform2dv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -8327,7 +8208,7 @@ _mesa_marshal_MultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3i");
    debug_print_sync_fallback("MultiTexCoord3i");
    CALL_MultiTexCoord3i(ctx->CurrentServerDispatch, (target, s, t, r));
 }
@@ -8377,7 +8258,7 @@ _mesa_marshal_ProgramUniform1fv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1fv");
    debug_print_sync_fallback("ProgramUniform1fv");
    CALL_ProgramUniform1fv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -8418,7 +8299,7 @@ _mesa_marshal_MultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3d");
    debug_print_sync_fallback("MultiTexCoord3d");
    CALL_MultiTexCoord3d(ctx->CurrentServerDispatch, (target, s, t, r));
 }
@@ -8450,7 +8331,7 @@ _mesa_marshal_TexCoord3sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3sv");
    debug_print_sync_fallback("TexCoord3sv");
    CALL_TexCoord3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -8461,7 +8342,7 @@ static void GLAPIENTRY
 _mesa_marshal_Fogfv(GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Fogfv");
    debug_print_sync("Fogfv");
    CALL_Fogfv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -8499,7 +8380,7 @@ _mesa_marshal_Minmax(GLenum target, GLenum internalformat, GLboolean sink)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Minmax");
    debug_print_sync_fallback("Minmax");
    CALL_Minmax(ctx->CurrentServerDispatch, (target, internalformat, sink));
 }
@@ -8540,7 +8421,7 @@ _mesa_marshal_MultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3s");
    debug_print_sync_fallback("MultiTexCoord3s");
    CALL_MultiTexCoord3s(ctx->CurrentServerDispatch, (target, s, t, r));
 }
@@ -8572,7 +8453,7 @@ _mesa_marshal_Vertex4iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4iv");
    debug_print_sync_fallback("Vertex4iv");
    CALL_Vertex4iv(ctx->CurrentServerDispatch, (v));
 }
@@ -8604,7 +8485,7 @@ _mesa_marshal_TexCoord4dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4dv");
    debug_print_sync_fallback("TexCoord4dv");
    CALL_TexCoord4dv(ctx->CurrentServerDispatch, (v));
 }
@@ -8630,7 +8511,7 @@ _mesa_marshal_Begin(GLenum mode)
    struct marshal_cmd_Begin *cmd;
    debug_print_marshal("Begin");
    if (true) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "Begin");
       _mesa_glthread_restore_dispatch(ctx);
       debug_print_sync_fallback("Begin");
       CALL_Begin(ctx->CurrentServerDispatch, (mode));
@@ -8643,7 +8524,7 @@ _mesa_marshal_Begin(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Begin");
    debug_print_sync_fallback("Begin");
    CALL_Begin(ctx->CurrentServerDispatch, (mode));
 }
@@ -8678,7 +8559,7 @@ _mesa_marshal_LightModeli(GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LightModeli");
    debug_print_sync_fallback("LightModeli");
    CALL_LightModeli(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -8728,7 +8609,7 @@ _mesa_marshal_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpos
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix2fv");
    debug_print_sync_fallback("UniformMatrix2fv");
    CALL_UniformMatrix2fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -8763,7 +8644,7 @@ _mesa_marshal_LightModelf(GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LightModelf");
    debug_print_sync_fallback("LightModelf");
    CALL_LightModelf(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -8774,7 +8655,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexParameterfv(GLenum target, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexParameterfv");
    debug_print_sync("GetTexParameterfv");
    CALL_GetTexParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -8815,7 +8696,7 @@ _mesa_marshal_TextureStorage1D(GLuint texture, GLsizei levels, GLenum internalfo
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage1D");
    debug_print_sync_fallback("TextureStorage1D");
    CALL_TextureStorage1D(ctx->CurrentServerDispatch, (texture, levels, internalformat, width));
 }
@@ -8850,7 +8731,7 @@ _mesa_marshal_MultiTexCoord2fvARB(GLenum target, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2fvARB");
    debug_print_sync_fallback("MultiTexCoord2fvARB");
    CALL_MultiTexCoord2fvARB(ctx->CurrentServerDispatch, (target, v));
 }
@@ -8885,7 +8766,7 @@ _mesa_marshal_VertexAttrib4ubv(GLuint index, const GLubyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4ubv");
    debug_print_sync_fallback("VertexAttrib4ubv");
    CALL_VertexAttrib4ubv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -8896,7 +8777,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, GLvoid * img)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnTexImageARB");
    debug_print_sync("GetnTexImageARB");
    CALL_GetnTexImageARB(ctx->CurrentServerDispatch, (target, level, format, type, bufSize, img));
 }
@@ -8937,7 +8818,7 @@ _mesa_marshal_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolea
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorMask");
    debug_print_sync_fallback("ColorMask");
    CALL_ColorMask(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -8981,7 +8862,7 @@ _mesa_marshal_MultiTexCoord4x(GLenum target, GLfixed s, GLfixed t, GLfixed r, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4x");
    debug_print_sync_fallback("MultiTexCoord4x");
    CALL_MultiTexCoord4x(ctx->CurrentServerDispatch, (target, s, t, r, q));
 }
@@ -9016,7 +8897,7 @@ _mesa_marshal_UniformHandleui64ARB(GLint location, GLuint64 value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformHandleui64ARB");
    debug_print_sync_fallback("UniformHandleui64ARB");
    CALL_UniformHandleui64ARB(ctx->CurrentServerDispatch, (location, value));
 }
@@ -9063,66 +8944,12 @@ _mesa_marshal_VertexAttribs4svNV(GLuint index, GLsizei n, const GLshort * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs4svNV");
    debug_print_sync_fallback("VertexAttribs4svNV");
    CALL_VertexAttribs4svNV(ctx->CurrentServerDispatch, (index, n, v));
 }
 
 
-/* DrawElementsInstancedBaseInstance: marshalled asynchronously */
-struct marshal_cmd_DrawElementsInstancedBaseInstance
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-   GLsizei primcount;
-   GLuint baseinstance;
-};
-static inline void
-_mesa_unmarshal_DrawElementsInstancedBaseInstance(struct gl_context *ctx, const struct marshal_cmd_DrawElementsInstancedBaseInstance *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   const GLsizei primcount = cmd->primcount;
-   const GLuint baseinstance = cmd->baseinstance;
-   CALL_DrawElementsInstancedBaseInstance(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, baseinstance));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices, GLsizei primcount, GLuint baseinstance)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawElementsInstancedBaseInstance);
-   struct marshal_cmd_DrawElementsInstancedBaseInstance *cmd;
-   debug_print_marshal("DrawElementsInstancedBaseInstance");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawElementsInstancedBaseInstance");
-      CALL_DrawElementsInstancedBaseInstance(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, baseinstance));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawElementsInstancedBaseInstance, cmd_size);
-      cmd->mode = mode;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      cmd->primcount = primcount;
-      cmd->baseinstance = baseinstance;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawElementsInstancedBaseInstance");
-   CALL_DrawElementsInstancedBaseInstance(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, baseinstance));
-}
-
-
 /* UniformMatrix4fv: marshalled asynchronously */
 struct marshal_cmd_UniformMatrix4fv
 {
@@ -9167,7 +8994,7 @@ _mesa_marshal_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpos
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix4fv");
    debug_print_sync_fallback("UniformMatrix4fv");
    CALL_UniformMatrix4fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -9217,7 +9044,7 @@ _mesa_marshal_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix3x2fv");
    debug_print_sync_fallback("UniformMatrix3x2fv");
    CALL_UniformMatrix3x2fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -9252,7 +9079,7 @@ _mesa_marshal_VertexAttrib4Nuiv(GLuint index, const GLuint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Nuiv");
    debug_print_sync_fallback("VertexAttrib4Nuiv");
    CALL_VertexAttrib4Nuiv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -9280,13 +9107,15 @@ _mesa_marshal_ClientActiveTexture(GLenum texture)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ClientActiveTexture, cmd_size);
       cmd->texture = texture;
+      _mesa_glthread_ClientActiveTexture(ctx, texture);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClientActiveTexture");
    debug_print_sync_fallback("ClientActiveTexture");
    CALL_ClientActiveTexture(ctx->CurrentServerDispatch, (texture));
+   _mesa_glthread_ClientActiveTexture(ctx, texture);
 }
 
 
@@ -9295,7 +9124,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar * const * uniformNames, GLuint * uniformIndices)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformIndices");
    debug_print_sync("GetUniformIndices");
    CALL_GetUniformIndices(ctx->CurrentServerDispatch, (program, uniformCount, uniformNames, uniformIndices));
 }
@@ -9330,7 +9159,7 @@ _mesa_marshal_MultiTexCoord2sv(GLenum target, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2sv");
    debug_print_sync_fallback("MultiTexCoord2sv");
    CALL_MultiTexCoord2sv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -9341,7 +9170,7 @@ static void GLAPIENTRY
 _mesa_marshal_NamedBufferStorage(GLuint buffer, GLsizeiptr size, const GLvoid * data, GLbitfield flags)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedBufferStorage");
    debug_print_sync("NamedBufferStorage");
    CALL_NamedBufferStorage(ctx->CurrentServerDispatch, (buffer, size, data, flags));
 }
@@ -9376,7 +9205,7 @@ _mesa_marshal_NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferDrawBuffer");
    debug_print_sync_fallback("NamedFramebufferDrawBuffer");
    CALL_NamedFramebufferDrawBuffer(ctx->CurrentServerDispatch, (framebuffer, buf));
 }
@@ -9420,7 +9249,7 @@ _mesa_marshal_NamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferTextureLayer");
    debug_print_sync_fallback("NamedFramebufferTextureLayer");
    CALL_NamedFramebufferTextureLayer(ctx->CurrentServerDispatch, (framebuffer, attachment, texture, level, layer));
 }
@@ -9451,7 +9280,7 @@ _mesa_marshal_LoadIdentity(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadIdentity");
    debug_print_sync_fallback("LoadIdentity");
    CALL_LoadIdentity(ctx->CurrentServerDispatch, ());
 }
@@ -9486,7 +9315,7 @@ _mesa_marshal_ActiveShaderProgram(GLuint pipeline, GLuint program)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ActiveShaderProgram");
    debug_print_sync_fallback("ActiveShaderProgram");
    CALL_ActiveShaderProgram(ctx->CurrentServerDispatch, (pipeline, program));
 }
@@ -9497,7 +9326,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindImageTextures(GLuint first, GLsizei count, const GLuint * textures)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindImageTextures");
    debug_print_sync("BindImageTextures");
    CALL_BindImageTextures(ctx->CurrentServerDispatch, (first, count, textures));
 }
@@ -9508,7 +9337,7 @@ static void GLAPIENTRY
 _mesa_marshal_DeleteTransformFeedbacks(GLsizei n, const GLuint * ids)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteTransformFeedbacks");
    debug_print_sync("DeleteTransformFeedbacks");
    CALL_DeleteTransformFeedbacks(ctx->CurrentServerDispatch, (n, ids));
 }
@@ -9543,7 +9372,7 @@ _mesa_marshal_VertexAttrib4ubvNV(GLuint index, const GLubyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4ubvNV");
    debug_print_sync_fallback("VertexAttrib4ubvNV");
    CALL_VertexAttrib4ubvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -9575,7 +9404,7 @@ _mesa_marshal_FogCoordfEXT(GLfloat coord)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FogCoordfEXT");
    debug_print_sync_fallback("FogCoordfEXT");
    CALL_FogCoordfEXT(ctx->CurrentServerDispatch, (coord));
 }
@@ -9586,7 +9415,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMapfv(GLenum target, GLenum query, GLfloat * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMapfv");
    debug_print_sync("GetMapfv");
    CALL_GetMapfv(ctx->CurrentServerDispatch, (target, query, v));
 }
@@ -9597,7 +9426,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramInfoLog");
    debug_print_sync("GetProgramInfoLog");
    CALL_GetProgramInfoLog(ctx->CurrentServerDispatch, (program, bufSize, length, infoLog));
 }
@@ -9632,7 +9461,7 @@ _mesa_marshal_BindTransformFeedback(GLenum target, GLuint id)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindTransformFeedback");
    debug_print_sync_fallback("BindTransformFeedback");
    CALL_BindTransformFeedback(ctx->CurrentServerDispatch, (target, id));
 }
@@ -9643,7 +9472,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPixelMapfv(GLenum map, GLfloat * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPixelMapfv");
    debug_print_sync("GetPixelMapfv");
    CALL_GetPixelMapfv(ctx->CurrentServerDispatch, (map, values));
 }
@@ -9687,7 +9516,7 @@ _mesa_marshal_TextureBufferRange(GLuint texture, GLenum internalformat, GLuint b
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureBufferRange");
    debug_print_sync_fallback("TextureBufferRange");
    CALL_TextureBufferRange(ctx->CurrentServerDispatch, (texture, internalformat, buffer, offset, size));
 }
@@ -9722,7 +9551,7 @@ _mesa_marshal_VertexAttrib4svNV(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4svNV");
    debug_print_sync_fallback("VertexAttrib4svNV");
    CALL_VertexAttrib4svNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -9757,7 +9586,7 @@ _mesa_marshal_PatchParameteri(GLenum pname, GLint value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PatchParameteri");
    debug_print_sync_fallback("PatchParameteri");
    CALL_PatchParameteri(ctx->CurrentServerDispatch, (pname, value));
 }
@@ -9768,7 +9597,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedBufferSubData");
    debug_print_sync("GetNamedBufferSubData");
    CALL_GetNamedBufferSubData(ctx->CurrentServerDispatch, (buffer, offset, size, data));
 }
@@ -9803,7 +9632,7 @@ _mesa_marshal_VDPAUSurfaceAccessNV(GLintptr surface, GLenum access)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUSurfaceAccessNV");
    debug_print_sync_fallback("VDPAUSurfaceAccessNV");
    CALL_VDPAUSurfaceAccessNV(ctx->CurrentServerDispatch, (surface, access));
 }
@@ -9830,24 +9659,19 @@ _mesa_marshal_EdgeFlagPointer(GLsizei stride, const GLvoid * pointer)
    size_t cmd_size = sizeof(struct marshal_cmd_EdgeFlagPointer);
    struct marshal_cmd_EdgeFlagPointer *cmd;
    debug_print_marshal("EdgeFlagPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("EdgeFlagPointer");
-      CALL_EdgeFlagPointer(ctx->CurrentServerDispatch, (stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_EdgeFlagPointer, cmd_size);
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_EDGEFLAG, 1, GL_UNSIGNED_BYTE, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EdgeFlagPointer");
    debug_print_sync_fallback("EdgeFlagPointer");
    CALL_EdgeFlagPointer(ctx->CurrentServerDispatch, (stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_EDGEFLAG, 1, GL_UNSIGNED_BYTE, stride, pointer);
 }
 
 
@@ -9880,7 +9704,7 @@ _mesa_marshal_WindowPos2f(GLfloat x, GLfloat y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2f");
    debug_print_sync_fallback("WindowPos2f");
    CALL_WindowPos2f(ctx->CurrentServerDispatch, (x, y));
 }
@@ -9915,7 +9739,7 @@ _mesa_marshal_WindowPos2d(GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2d");
    debug_print_sync_fallback("WindowPos2d");
    CALL_WindowPos2d(ctx->CurrentServerDispatch, (x, y));
 }
@@ -9926,7 +9750,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribLdv");
    debug_print_sync("GetVertexAttribLdv");
    CALL_GetVertexAttribLdv(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -9961,7 +9785,7 @@ _mesa_marshal_WindowPos2i(GLint x, GLint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2i");
    debug_print_sync_fallback("WindowPos2i");
    CALL_WindowPos2i(ctx->CurrentServerDispatch, (x, y));
 }
@@ -9996,7 +9820,7 @@ _mesa_marshal_WindowPos2s(GLshort x, GLshort y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2s");
    debug_print_sync_fallback("WindowPos2s");
    CALL_WindowPos2s(ctx->CurrentServerDispatch, (x, y));
 }
@@ -10031,7 +9855,7 @@ _mesa_marshal_VertexAttribI1uiEXT(GLuint index, GLuint x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI1uiEXT");
    debug_print_sync_fallback("VertexAttribI1uiEXT");
    CALL_VertexAttribI1uiEXT(ctx->CurrentServerDispatch, (index, x));
 }
@@ -10063,7 +9887,7 @@ _mesa_marshal_DeleteSync(GLsync sync)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteSync");
    debug_print_sync_fallback("DeleteSync");
    CALL_DeleteSync(ctx->CurrentServerDispatch, (sync));
 }
@@ -10074,7 +9898,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos4fvMESA(const GLfloat * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4fvMESA");
    debug_print_sync("WindowPos4fvMESA");
    CALL_WindowPos4fvMESA(ctx->CurrentServerDispatch, (v));
 }
@@ -10085,7 +9909,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTexImage3D");
    debug_print_sync("CompressedTexImage3D");
    CALL_CompressedTexImage3D(ctx->CurrentServerDispatch, (target, level, internalformat, width, height, depth, border, imageSize, data));
 }
@@ -10096,7 +9920,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenSemaphoresEXT(GLsizei n, GLuint * semaphores)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenSemaphoresEXT");
    debug_print_sync("GenSemaphoresEXT");
    CALL_GenSemaphoresEXT(ctx->CurrentServerDispatch, (n, semaphores));
 }
@@ -10107,7 +9931,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI1uiv(GLuint index, const GLuint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI1uiv");
    debug_print_sync("VertexAttribI1uiv");
    CALL_VertexAttribI1uiv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -10139,7 +9963,7 @@ _mesa_marshal_SecondaryColor3dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3dv");
    debug_print_sync_fallback("SecondaryColor3dv");
    CALL_SecondaryColor3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -10150,7 +9974,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnPixelMapusvARB(GLenum map, GLsizei bufSize, GLushort * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnPixelMapusvARB");
    debug_print_sync("GetnPixelMapusvARB");
    CALL_GetnPixelMapusvARB(ctx->CurrentServerDispatch, (map, bufSize, values));
 }
@@ -10191,7 +10015,7 @@ _mesa_marshal_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3s");
    debug_print_sync_fallback("VertexAttrib3s");
    CALL_VertexAttrib3s(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -10241,7 +10065,7 @@ _mesa_marshal_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix4x3fv");
    debug_print_sync_fallback("UniformMatrix4x3fv");
    CALL_UniformMatrix4x3fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -10252,7 +10076,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetQueryiv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryiv");
    debug_print_sync("GetQueryiv");
    CALL_GetQueryiv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -10293,7 +10117,7 @@ _mesa_marshal_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3d");
    debug_print_sync_fallback("VertexAttrib3d");
    CALL_VertexAttrib3d(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -10304,7 +10128,7 @@ static GLvoid * GLAPIENTRY
 _mesa_marshal_MapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapNamedBufferRange");
    debug_print_sync("MapNamedBufferRange");
    return CALL_MapNamedBufferRange(ctx->CurrentServerDispatch, (buffer, offset, length, access));
 }
@@ -10315,7 +10139,7 @@ static GLvoid * GLAPIENTRY
 _mesa_marshal_MapBuffer(GLenum target, GLenum access)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapBuffer");
    debug_print_sync("MapBuffer");
    return CALL_MapBuffer(ctx->CurrentServerDispatch, (target, access));
 }
@@ -10326,7 +10150,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramStageiv");
    debug_print_sync("GetProgramStageiv");
    CALL_GetProgramStageiv(ctx->CurrentServerDispatch, (program, shadertype, pname, values));
 }
@@ -10361,7 +10185,7 @@ _mesa_marshal_VertexAttrib4Nbv(GLuint index, const GLbyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Nbv");
    debug_print_sync_fallback("VertexAttrib4Nbv");
    CALL_VertexAttrib4Nbv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -10372,9 +10196,10 @@ static void GLAPIENTRY
 _mesa_marshal_ProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid * binary, GLsizei length)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramBinary");
    debug_print_sync("ProgramBinary");
    CALL_ProgramBinary(ctx->CurrentServerDispatch, (program, binaryFormat, binary, length));
+   _mesa_glthread_LinkProgram(ctx, program);
 }
 
 
@@ -10407,7 +10232,7 @@ _mesa_marshal_InvalidateTexImage(GLuint texture, GLint level)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateTexImage");
    debug_print_sync_fallback("InvalidateTexImage");
    CALL_InvalidateTexImage(ctx->CurrentServerDispatch, (texture, level));
 }
@@ -10451,7 +10276,7 @@ _mesa_marshal_Uniform4ui(GLint location, GLuint x, GLuint y, GLuint z, GLuint w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4ui");
    debug_print_sync_fallback("Uniform4ui");
    CALL_Uniform4ui(ctx->CurrentServerDispatch, (location, x, y, z, w));
 }
@@ -10498,7 +10323,7 @@ _mesa_marshal_VertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint si
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayAttribFormat");
    debug_print_sync_fallback("VertexArrayAttribFormat");
    CALL_VertexArrayAttribFormat(ctx->CurrentServerDispatch, (vaobj, attribindex, size, type, normalized, relativeoffset));
 }
@@ -10533,7 +10358,7 @@ _mesa_marshal_VertexAttrib1fARB(GLuint index, GLfloat x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1fARB");
    debug_print_sync_fallback("VertexAttrib1fARB");
    CALL_VertexAttrib1fARB(ctx->CurrentServerDispatch, (index, x));
 }
@@ -10544,7 +10369,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetBooleani_v(GLenum value, GLuint index, GLboolean * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetBooleani_v");
    debug_print_sync("GetBooleani_v");
    CALL_GetBooleani_v(ctx->CurrentServerDispatch, (value, index, data));
 }
@@ -10588,7 +10413,7 @@ _mesa_marshal_DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width, GLshor
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexsOES");
    debug_print_sync_fallback("DrawTexsOES");
    CALL_DrawTexsOES(ctx->CurrentServerDispatch, (x, y, z, width, height));
 }
@@ -10599,7 +10424,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetObjectPtrLabel(const GLvoid * ptr, GLsizei bufSize, GLsizei * length, GLchar * label)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetObjectPtrLabel");
    debug_print_sync("GetObjectPtrLabel");
    CALL_GetObjectPtrLabel(ctx->CurrentServerDispatch, (ptr, bufSize, length, label));
 }
@@ -10637,7 +10462,7 @@ _mesa_marshal_ProgramParameteri(GLuint program, GLenum pname, GLint value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramParameteri");
    debug_print_sync_fallback("ProgramParameteri");
    CALL_ProgramParameteri(ctx->CurrentServerDispatch, (program, pname, value));
 }
@@ -10669,7 +10494,7 @@ _mesa_marshal_Color3fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3fv");
    debug_print_sync_fallback("Color3fv");
    CALL_Color3fv(ctx->CurrentServerDispatch, (v));
 }
@@ -10680,7 +10505,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnMapfvARB(GLenum target, GLenum query, GLsizei bufSize, GLfloat * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnMapfvARB");
    debug_print_sync("GetnMapfvARB");
    CALL_GetnMapfvARB(ctx->CurrentServerDispatch, (target, query, bufSize, v));
 }
@@ -10718,7 +10543,7 @@ _mesa_marshal_MultiTexCoord2i(GLenum target, GLint s, GLint t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2i");
    debug_print_sync_fallback("MultiTexCoord2i");
    CALL_MultiTexCoord2i(ctx->CurrentServerDispatch, (target, s, t));
 }
@@ -10756,7 +10581,7 @@ _mesa_marshal_MultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2d");
    debug_print_sync_fallback("MultiTexCoord2d");
    CALL_MultiTexCoord2d(ctx->CurrentServerDispatch, (target, s, t));
 }
@@ -10767,7 +10592,7 @@ static void GLAPIENTRY
 _mesa_marshal_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SamplerParameterIuiv");
    debug_print_sync("SamplerParameterIuiv");
    CALL_SamplerParameterIuiv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -10805,7 +10630,7 @@ _mesa_marshal_MultiTexCoord2s(GLenum target, GLshort s, GLshort t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2s");
    debug_print_sync_fallback("MultiTexCoord2s");
    CALL_MultiTexCoord2s(ctx->CurrentServerDispatch, (target, s, t));
 }
@@ -10816,7 +10641,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetInternalformati64v");
    debug_print_sync("GetInternalformati64v");
    CALL_GetInternalformati64v(ctx->CurrentServerDispatch, (target, internalformat, pname, bufSize, params));
 }
@@ -10827,7 +10652,7 @@ static GLintptr GLAPIENTRY
 _mesa_marshal_VDPAURegisterVideoSurfaceNV(const GLvoid * vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint * textureNames)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAURegisterVideoSurfaceNV");
    debug_print_sync("VDPAURegisterVideoSurfaceNV");
    return CALL_VDPAURegisterVideoSurfaceNV(ctx->CurrentServerDispatch, (vdpSurface, target, numTextureNames, textureNames));
 }
@@ -10859,7 +10684,7 @@ _mesa_marshal_Indexub(GLubyte c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexub");
    debug_print_sync_fallback("Indexub");
    CALL_Indexub(ctx->CurrentServerDispatch, (c));
 }
@@ -10870,7 +10695,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfMonitorCounterDataAMD(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint * data, GLint * bytesWritten)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfMonitorCounterDataAMD");
    debug_print_sync("GetPerfMonitorCounterDataAMD");
    CALL_GetPerfMonitorCounterDataAMD(ctx->CurrentServerDispatch, (monitor, pname, dataSize, data, bytesWritten));
 }
@@ -10881,7 +10706,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultTransposeMatrixf(const GLfloat * m)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultTransposeMatrixf");
    debug_print_sync("MultTransposeMatrixf");
    CALL_MultTransposeMatrixf(ctx->CurrentServerDispatch, (m));
 }
@@ -10916,7 +10741,7 @@ _mesa_marshal_PolygonOffsetEXT(GLfloat factor, GLfloat bias)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PolygonOffsetEXT");
    debug_print_sync_fallback("PolygonOffsetEXT");
    CALL_PolygonOffsetEXT(ctx->CurrentServerDispatch, (factor, bias));
 }
@@ -10954,7 +10779,7 @@ _mesa_marshal_Scalex(GLfixed x, GLfixed y, GLfixed z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Scalex");
    debug_print_sync_fallback("Scalex");
    CALL_Scalex(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -10992,7 +10817,7 @@ _mesa_marshal_Scaled(GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Scaled");
    debug_print_sync_fallback("Scaled");
    CALL_Scaled(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -11030,7 +10855,7 @@ _mesa_marshal_Scalef(GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Scalef");
    debug_print_sync_fallback("Scalef");
    CALL_Scalef(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -11061,26 +10886,21 @@ _mesa_marshal_IndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const
    size_t cmd_size = sizeof(struct marshal_cmd_IndexPointerEXT);
    struct marshal_cmd_IndexPointerEXT *cmd;
    debug_print_marshal("IndexPointerEXT");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("IndexPointerEXT");
-      CALL_IndexPointerEXT(ctx->CurrentServerDispatch, (type, stride, count, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_IndexPointerEXT, cmd_size);
       cmd->type = type;
       cmd->stride = stride;
       cmd->count = count;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR_INDEX, 1, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IndexPointerEXT");
    debug_print_sync_fallback("IndexPointerEXT");
    CALL_IndexPointerEXT(ctx->CurrentServerDispatch, (type, stride, count, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR_INDEX, 1, type, stride, pointer);
 }
 
 
@@ -11089,7 +10909,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformfv(GLuint program, GLint location, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformfv");
    debug_print_sync("GetUniformfv");
    CALL_GetUniformfv(ctx->CurrentServerDispatch, (program, location, params));
 }
@@ -11148,7 +10968,7 @@ _mesa_marshal_ColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorFragmentOp2ATI");
    debug_print_sync_fallback("ColorFragmentOp2ATI");
    CALL_ColorFragmentOp2ATI(ctx->CurrentServerDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
 }
@@ -11186,7 +11006,7 @@ _mesa_marshal_VertexAttrib2sNV(GLuint index, GLshort x, GLshort y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2sNV");
    debug_print_sync_fallback("VertexAttrib2sNV");
    CALL_VertexAttrib2sNV(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -11197,7 +11017,7 @@ static void GLAPIENTRY
 _mesa_marshal_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ReadPixels");
    debug_print_sync("ReadPixels");
    CALL_ReadPixels(ctx->CurrentServerDispatch, (x, y, width, height, format, type, pixels));
 }
@@ -11232,7 +11052,7 @@ _mesa_marshal_QueryCounter(GLuint id, GLenum target)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "QueryCounter");
    debug_print_sync_fallback("QueryCounter");
    CALL_QueryCounter(ctx->CurrentServerDispatch, (id, target));
 }
@@ -11263,26 +11083,21 @@ _mesa_marshal_NormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const
    size_t cmd_size = sizeof(struct marshal_cmd_NormalPointerEXT);
    struct marshal_cmd_NormalPointerEXT *cmd;
    debug_print_marshal("NormalPointerEXT");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("NormalPointerEXT");
-      CALL_NormalPointerEXT(ctx->CurrentServerDispatch, (type, stride, count, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_NormalPointerEXT, cmd_size);
       cmd->type = type;
       cmd->stride = stride;
       cmd->count = count;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_NORMAL, 3, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NormalPointerEXT");
    debug_print_sync_fallback("NormalPointerEXT");
    CALL_NormalPointerEXT(ctx->CurrentServerDispatch, (type, stride, count, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_NORMAL, 3, type, stride, pointer);
 }
 
 
@@ -11291,7 +11106,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_GetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSubroutineIndex");
    debug_print_sync("GetSubroutineIndex");
    return CALL_GetSubroutineIndex(ctx->CurrentServerDispatch, (program, shadertype, name));
 }
@@ -11341,7 +11156,7 @@ _mesa_marshal_ProgramUniform3iv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3iv");
    debug_print_sync_fallback("ProgramUniform3iv");
    CALL_ProgramUniform3iv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -11394,7 +11209,7 @@ _mesa_marshal_ProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix2dv");
    debug_print_sync_fallback("ProgramUniformMatrix2dv");
    CALL_ProgramUniformMatrix2dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -11405,7 +11220,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearTexSubImage");
    debug_print_sync("ClearTexSubImage");
    CALL_ClearTexSubImage(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data));
 }
@@ -11416,63 +11231,12 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveUniformBlockName");
    debug_print_sync("GetActiveUniformBlockName");
    CALL_GetActiveUniformBlockName(ctx->CurrentServerDispatch, (program, uniformBlockIndex, bufSize, length, uniformBlockName));
 }
 
 
-/* DrawElementsBaseVertex: marshalled asynchronously */
-struct marshal_cmd_DrawElementsBaseVertex
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-   GLint basevertex;
-};
-static inline void
-_mesa_unmarshal_DrawElementsBaseVertex(struct gl_context *ctx, const struct marshal_cmd_DrawElementsBaseVertex *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   const GLint basevertex = cmd->basevertex;
-   CALL_DrawElementsBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, basevertex));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices, GLint basevertex)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawElementsBaseVertex);
-   struct marshal_cmd_DrawElementsBaseVertex *cmd;
-   debug_print_marshal("DrawElementsBaseVertex");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawElementsBaseVertex");
-      CALL_DrawElementsBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, basevertex));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawElementsBaseVertex, cmd_size);
-      cmd->mode = mode;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      cmd->basevertex = basevertex;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawElementsBaseVertex");
-   CALL_DrawElementsBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, basevertex));
-}
-
-
 /* RasterPos3iv: marshalled asynchronously */
 struct marshal_cmd_RasterPos3iv
 {
@@ -11499,7 +11263,7 @@ _mesa_marshal_RasterPos3iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3iv");
    debug_print_sync_fallback("RasterPos3iv");
    CALL_RasterPos3iv(ctx->CurrentServerDispatch, (v));
 }
@@ -11543,7 +11307,7 @@ _mesa_marshal_ColorMaski(GLuint buf, GLboolean r, GLboolean g, GLboolean b, GLbo
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorMaski");
    debug_print_sync_fallback("ColorMaski");
    CALL_ColorMaski(ctx->CurrentServerDispatch, (buf, r, g, b, a));
 }
@@ -11590,7 +11354,7 @@ _mesa_marshal_Uniform2uiv(GLint location, GLsizei count, const GLuint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2uiv");
    debug_print_sync_fallback("Uniform2uiv");
    CALL_Uniform2uiv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -11628,7 +11392,7 @@ _mesa_marshal_RasterPos3s(GLshort x, GLshort y, GLshort z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3s");
    debug_print_sync_fallback("RasterPos3s");
    CALL_RasterPos3s(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -11666,7 +11430,7 @@ _mesa_marshal_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3d");
    debug_print_sync_fallback("RasterPos3d");
    CALL_RasterPos3d(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -11704,7 +11468,7 @@ _mesa_marshal_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3f");
    debug_print_sync_fallback("RasterPos3f");
    CALL_RasterPos3f(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -11730,7 +11494,7 @@ _mesa_marshal_BindVertexArray(GLuint array)
    struct marshal_cmd_BindVertexArray *cmd;
    debug_print_marshal("BindVertexArray");
    if (_mesa_glthread_is_compat_bind_vertex_array(ctx)) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "BindVertexArray");
       _mesa_glthread_restore_dispatch(ctx);
       debug_print_sync_fallback("BindVertexArray");
       CALL_BindVertexArray(ctx->CurrentServerDispatch, (array));
@@ -11739,13 +11503,15 @@ _mesa_marshal_BindVertexArray(GLuint array)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindVertexArray, cmd_size);
       cmd->array = array;
+      _mesa_glthread_BindVertexArray(ctx, array);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindVertexArray");
    debug_print_sync_fallback("BindVertexArray");
    CALL_BindVertexArray(ctx->CurrentServerDispatch, (array));
+   _mesa_glthread_BindVertexArray(ctx, array);
 }
 
 
@@ -11781,7 +11547,7 @@ _mesa_marshal_RasterPos3i(GLint x, GLint y, GLint z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3i");
    debug_print_sync_fallback("RasterPos3i");
    CALL_RasterPos3i(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -11792,7 +11558,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribL3dv(GLuint index, const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL3dv");
    debug_print_sync("VertexAttribL3dv");
    CALL_VertexAttribL3dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -11803,7 +11569,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexParameteriv");
    debug_print_sync("GetTexParameteriv");
    CALL_GetTexParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -11834,6 +11600,12 @@ _mesa_marshal_DrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuin
    size_t cmd_size = sizeof(struct marshal_cmd_DrawTransformFeedbackStreamInstanced);
    struct marshal_cmd_DrawTransformFeedbackStreamInstanced *cmd;
    debug_print_marshal("DrawTransformFeedbackStreamInstanced");
+   if (_mesa_glthread_has_user_arrays(ctx, "DrawTransformFeedbackStreamInstanced")) {
+      _mesa_glthread_finish_before(ctx, "DrawTransformFeedbackStreamInstanced");
+      debug_print_sync_fallback("DrawTransformFeedbackStreamInstanced");
+      CALL_DrawTransformFeedbackStreamInstanced(ctx->CurrentServerDispatch, (mode, id, stream, primcount));
+      return;
+   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawTransformFeedbackStreamInstanced, cmd_size);
       cmd->mode = mode;
@@ -11844,7 +11616,7 @@ _mesa_marshal_DrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuin
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTransformFeedbackStreamInstanced");
    debug_print_sync_fallback("DrawTransformFeedbackStreamInstanced");
    CALL_DrawTransformFeedbackStreamInstanced(ctx->CurrentServerDispatch, (mode, id, stream, primcount));
 }
@@ -11879,7 +11651,7 @@ _mesa_marshal_VertexAttrib2fvARB(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2fvARB");
    debug_print_sync_fallback("VertexAttrib2fvARB");
    CALL_VertexAttrib2fvARB(ctx->CurrentServerDispatch, (index, v));
 }
@@ -11890,7 +11662,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei  bufSize, GLsizei * length, GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramResourceName");
    debug_print_sync("GetProgramResourceName");
    CALL_GetProgramResourceName(ctx->CurrentServerDispatch, (program, programInterface, index, bufSize, length, name));
 }
@@ -11943,7 +11715,7 @@ _mesa_marshal_ProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix4x3dv");
    debug_print_sync_fallback("ProgramUniformMatrix4x3dv");
    CALL_ProgramUniformMatrix4x3dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -11954,7 +11726,7 @@ static void GLAPIENTRY
 _mesa_marshal_ColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorTable");
    debug_print_sync("ColorTable");
    CALL_ColorTable(ctx->CurrentServerDispatch, (target, internalformat, width, format, type, table));
 }
@@ -11986,7 +11758,7 @@ _mesa_marshal_LoadName(GLuint name)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadName");
    debug_print_sync_fallback("LoadName");
    CALL_LoadName(ctx->CurrentServerDispatch, (name));
 }
@@ -11997,7 +11769,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnUniformuivARB(GLuint program, GLint location, GLsizei bufSize, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnUniformuivARB");
    debug_print_sync("GetnUniformuivARB");
    CALL_GetnUniformuivARB(ctx->CurrentServerDispatch, (program, location, bufSize, params));
 }
@@ -12029,7 +11801,7 @@ _mesa_marshal_ClearIndex(GLfloat c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearIndex");
    debug_print_sync_fallback("ClearIndex");
    CALL_ClearIndex(ctx->CurrentServerDispatch, (c));
 }
@@ -12040,7 +11812,7 @@ static void GLAPIENTRY
 _mesa_marshal_ConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ConvolutionParameterfv");
    debug_print_sync("ConvolutionParameterfv");
    CALL_ConvolutionParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -12051,7 +11823,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexGendv(GLenum coord, GLenum pname, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexGendv");
    debug_print_sync("GetTexGendv");
    CALL_GetTexGendv(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -12089,7 +11861,7 @@ _mesa_marshal_FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsize
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FlushMappedNamedBufferRange");
    debug_print_sync_fallback("FlushMappedNamedBufferRange");
    CALL_FlushMappedNamedBufferRange(ctx->CurrentServerDispatch, (buffer, offset, length));
 }
@@ -12127,7 +11899,7 @@ _mesa_marshal_MultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP1ui");
    debug_print_sync_fallback("MultiTexCoordP1ui");
    CALL_MultiTexCoordP1ui(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -12171,7 +11943,7 @@ _mesa_marshal_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalMesh2");
    debug_print_sync_fallback("EvalMesh2");
    CALL_EvalMesh2(ctx->CurrentServerDispatch, (mode, i1, i2, j1, j2));
 }
@@ -12203,7 +11975,7 @@ _mesa_marshal_Vertex4fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4fv");
    debug_print_sync_fallback("Vertex4fv");
    CALL_Vertex4fv(ctx->CurrentServerDispatch, (v));
 }
@@ -12250,7 +12022,7 @@ _mesa_marshal_ProgramUniform4i64ARB(GLuint program, GLint location, GLint64 x, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4i64ARB");
    debug_print_sync_fallback("ProgramUniform4i64ARB");
    CALL_ProgramUniform4i64ARB(ctx->CurrentServerDispatch, (program, location, x, y, z, w));
 }
@@ -12261,7 +12033,7 @@ static void GLAPIENTRY
 _mesa_marshal_SelectPerfMonitorCountersAMD(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint * counterList)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SelectPerfMonitorCountersAMD");
    debug_print_sync("SelectPerfMonitorCountersAMD");
    CALL_SelectPerfMonitorCountersAMD(ctx->CurrentServerDispatch, (monitor, enable, group, numCounters, counterList));
 }
@@ -12305,7 +12077,7 @@ _mesa_marshal_TextureStorage2D(GLuint texture, GLsizei levels, GLenum internalfo
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage2D");
    debug_print_sync_fallback("TextureStorage2D");
    CALL_TextureStorage2D(ctx->CurrentServerDispatch, (texture, levels, internalformat, width, height));
 }
@@ -12316,7 +12088,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureParameterIiv(GLuint texture, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureParameterIiv");
    debug_print_sync("GetTextureParameterIiv");
    CALL_GetTextureParameterIiv(ctx->CurrentServerDispatch, (texture, pname, params));
 }
@@ -12347,13 +12119,15 @@ _mesa_marshal_BindFramebuffer(GLenum target, GLuint framebuffer)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindFramebuffer, cmd_size);
       cmd->target = target;
       cmd->framebuffer = framebuffer;
+      _mesa_glthread_BindFramebuffer(ctx, target, framebuffer, _mesa_is_gles(ctx));
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindFramebuffer");
    debug_print_sync_fallback("BindFramebuffer");
    CALL_BindFramebuffer(ctx->CurrentServerDispatch, (target, framebuffer));
+   _mesa_glthread_BindFramebuffer(ctx, target, framebuffer, _mesa_is_gles(ctx));
 }
 
 
@@ -12362,7 +12136,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMinmax");
    debug_print_sync("GetMinmax");
    CALL_GetMinmax(ctx->CurrentServerDispatch, (target, reset, format, type, values));
 }
@@ -12409,7 +12183,7 @@ _mesa_marshal_VertexAttribs3svNV(GLuint index, GLsizei n, const GLshort * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs3svNV");
    debug_print_sync_fallback("VertexAttribs3svNV");
    CALL_VertexAttribs3svNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -12420,7 +12194,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveUniformsiv");
    debug_print_sync("GetActiveUniformsiv");
    CALL_GetActiveUniformsiv(ctx->CurrentServerDispatch, (program, uniformCount, uniformIndices, pname, params));
 }
@@ -12455,7 +12229,7 @@ _mesa_marshal_VertexAttrib2sv(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2sv");
    debug_print_sync_fallback("VertexAttrib2sv");
    CALL_VertexAttrib2sv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -12466,7 +12240,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramEnvParameterdvARB");
    debug_print_sync("GetProgramEnvParameterdvARB");
    CALL_GetProgramEnvParameterdvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -12513,7 +12287,7 @@ _mesa_marshal_Uniform1dv(GLint location, GLsizei count, const GLdouble * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1dv");
    debug_print_sync_fallback("Uniform1dv");
    CALL_Uniform1dv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -12557,7 +12331,7 @@ _mesa_marshal_TransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buff
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TransformFeedbackBufferRange");
    debug_print_sync_fallback("TransformFeedbackBufferRange");
    CALL_TransformFeedbackBufferRange(ctx->CurrentServerDispatch, (xfb, index, buffer, offset, size));
 }
@@ -12568,7 +12342,7 @@ static void GLAPIENTRY
 _mesa_marshal_PushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PushDebugGroup");
    debug_print_sync("PushDebugGroup");
    CALL_PushDebugGroup(ctx->CurrentServerDispatch, (source, id, length, message));
 }
@@ -12579,23 +12353,12 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfMonitorGroupStringAMD(GLuint group, GLsizei bufSize, GLsizei * length, GLchar * groupString)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfMonitorGroupStringAMD");
    debug_print_sync("GetPerfMonitorGroupStringAMD");
    CALL_GetPerfMonitorGroupStringAMD(ctx->CurrentServerDispatch, (group, bufSize, length, groupString));
 }
 
 
-/* GetError: marshalled synchronously */
-static GLenum GLAPIENTRY
-_mesa_marshal_GetError(void)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
-   debug_print_sync("GetError");
-   return CALL_GetError(ctx->CurrentServerDispatch, ());
-}
-
-
 /* PassThrough: marshalled asynchronously */
 struct marshal_cmd_PassThrough
 {
@@ -12622,7 +12385,7 @@ _mesa_marshal_PassThrough(GLfloat token)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PassThrough");
    debug_print_sync_fallback("PassThrough");
    CALL_PassThrough(ctx->CurrentServerDispatch, (token));
 }
@@ -12633,7 +12396,7 @@ static void GLAPIENTRY
 _mesa_marshal_PatchParameterfv(GLenum pname, const GLfloat * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PatchParameterfv");
    debug_print_sync("PatchParameterfv");
    CALL_PatchParameterfv(ctx->CurrentServerDispatch, (pname, values));
 }
@@ -12644,7 +12407,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetObjectParameterivAPPLE(GLenum objectType, GLuint name, GLenum pname, GLint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetObjectParameterivAPPLE");
    debug_print_sync("GetObjectParameterivAPPLE");
    CALL_GetObjectParameterivAPPLE(ctx->CurrentServerDispatch, (objectType, name, pname, value));
 }
@@ -12655,7 +12418,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindBuffersRange");
    debug_print_sync("BindBuffersRange");
    CALL_BindBuffersRange(ctx->CurrentServerDispatch, (target, first, count, buffers, offsets, sizes));
 }
@@ -12690,7 +12453,7 @@ _mesa_marshal_VertexAttrib4fvARB(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4fvARB");
    debug_print_sync_fallback("VertexAttrib4fvARB");
    CALL_VertexAttrib4fvARB(ctx->CurrentServerDispatch, (index, v));
 }
@@ -12737,7 +12500,7 @@ _mesa_marshal_Uniform3i64vARB(GLint location, GLsizei count, const GLint64 * val
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3i64vARB");
    debug_print_sync_fallback("Uniform3i64vARB");
    CALL_Uniform3i64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -12748,7 +12511,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos3dv(const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3dv");
    debug_print_sync("WindowPos3dv");
    CALL_WindowPos3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -12786,7 +12549,7 @@ _mesa_marshal_TexGenxOES(GLenum coord, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGenxOES");
    debug_print_sync_fallback("TexGenxOES");
    CALL_TexGenxOES(ctx->CurrentServerDispatch, (coord, pname, param));
 }
@@ -12830,7 +12593,7 @@ _mesa_marshal_VertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint s
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayAttribIFormat");
    debug_print_sync_fallback("VertexArrayAttribIFormat");
    CALL_VertexArrayAttribIFormat(ctx->CurrentServerDispatch, (vaobj, attribindex, size, type, relativeoffset));
 }
@@ -12868,7 +12631,7 @@ _mesa_marshal_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilOp");
    debug_print_sync_fallback("StencilOp");
    CALL_StencilOp(ctx->CurrentServerDispatch, (fail, zfail, zpass));
 }
@@ -12918,7 +12681,7 @@ _mesa_marshal_ProgramUniform1iv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1iv");
    debug_print_sync_fallback("ProgramUniform1iv");
    CALL_ProgramUniform1iv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -12962,7 +12725,7 @@ _mesa_marshal_ProgramUniform3ui(GLuint program, GLint location, GLuint x, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3ui");
    debug_print_sync_fallback("ProgramUniform3ui");
    CALL_ProgramUniform3ui(ctx->CurrentServerDispatch, (program, location, x, y, z));
 }
@@ -12994,7 +12757,7 @@ _mesa_marshal_SecondaryColor3sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3sv");
    debug_print_sync_fallback("SecondaryColor3sv");
    CALL_SecondaryColor3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -13029,7 +12792,7 @@ _mesa_marshal_TexCoordP3ui(GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP3ui");
    debug_print_sync_fallback("TexCoordP3ui");
    CALL_TexCoordP3ui(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -13064,7 +12827,7 @@ _mesa_marshal_VertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayElementBuffer");
    debug_print_sync_fallback("VertexArrayElementBuffer");
    CALL_VertexArrayElementBuffer(ctx->CurrentServerDispatch, (vaobj, buffer));
 }
@@ -13075,7 +12838,7 @@ static void GLAPIENTRY
 _mesa_marshal_Fogxv(GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Fogxv");
    debug_print_sync("Fogxv");
    CALL_Fogxv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -13116,7 +12879,7 @@ _mesa_marshal_Uniform3i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3i64ARB");
    debug_print_sync_fallback("Uniform3i64ARB");
    CALL_Uniform3i64ARB(ctx->CurrentServerDispatch, (location, x, y, z));
 }
@@ -13157,7 +12920,7 @@ _mesa_marshal_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP1ui");
    debug_print_sync_fallback("VertexAttribP1ui");
    CALL_VertexAttribP1ui(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -13168,7 +12931,7 @@ static GLuint64 GLAPIENTRY
 _mesa_marshal_GetImageHandleARB(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetImageHandleARB");
    debug_print_sync("GetImageHandleARB");
    return CALL_GetImageHandleARB(ctx->CurrentServerDispatch, (texture, level, layered, layer, format));
 }
@@ -13203,7 +12966,7 @@ _mesa_marshal_DeleteLists(GLuint list, GLsizei range)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteLists");
    debug_print_sync_fallback("DeleteLists");
    CALL_DeleteLists(ctx->CurrentServerDispatch, (list, range));
 }
@@ -13235,7 +12998,7 @@ _mesa_marshal_LogicOp(GLenum opcode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LogicOp");
    debug_print_sync_fallback("LogicOp");
    CALL_LogicOp(ctx->CurrentServerDispatch, (opcode));
 }
@@ -13279,7 +13042,7 @@ _mesa_marshal_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLe
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RenderbufferStorageMultisample");
    debug_print_sync_fallback("RenderbufferStorageMultisample");
    CALL_RenderbufferStorageMultisample(ctx->CurrentServerDispatch, (target, samples, internalformat, width, height));
 }
@@ -13290,7 +13053,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTransformFeedbacki64_v");
    debug_print_sync("GetTransformFeedbacki64_v");
    CALL_GetTransformFeedbacki64_v(ctx->CurrentServerDispatch, (xfb, pname, index, param));
 }
@@ -13328,7 +13091,7 @@ _mesa_marshal_WindowPos3d(GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3d");
    debug_print_sync_fallback("WindowPos3d");
    CALL_WindowPos3d(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -13359,13 +13122,15 @@ _mesa_marshal_Enablei(GLenum target, GLuint index)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_Enablei, cmd_size);
       cmd->target = target;
       cmd->index = index;
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Enablei");
    debug_print_sync_fallback("Enablei");
    CALL_Enablei(ctx->CurrentServerDispatch, (target, index));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -13401,7 +13166,7 @@ _mesa_marshal_WindowPos3f(GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3f");
    debug_print_sync_fallback("WindowPos3f");
    CALL_WindowPos3f(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -13412,7 +13177,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenProgramsARB(GLsizei n, GLuint * programs)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenProgramsARB");
    debug_print_sync("GenProgramsARB");
    CALL_GenProgramsARB(ctx->CurrentServerDispatch, (n, programs));
 }
@@ -13444,7 +13209,7 @@ _mesa_marshal_RasterPos2sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2sv");
    debug_print_sync_fallback("RasterPos2sv");
    CALL_RasterPos2sv(ctx->CurrentServerDispatch, (v));
 }
@@ -13482,7 +13247,7 @@ _mesa_marshal_WindowPos3i(GLint x, GLint y, GLint z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3i");
    debug_print_sync_fallback("WindowPos3i");
    CALL_WindowPos3i(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -13517,7 +13282,7 @@ _mesa_marshal_MultiTexCoord4iv(GLenum target, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4iv");
    debug_print_sync_fallback("MultiTexCoord4iv");
    CALL_MultiTexCoord4iv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -13549,7 +13314,7 @@ _mesa_marshal_TexCoord1sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1sv");
    debug_print_sync_fallback("TexCoord1sv");
    CALL_TexCoord1sv(ctx->CurrentServerDispatch, (v));
 }
@@ -13587,7 +13352,7 @@ _mesa_marshal_WindowPos3s(GLshort x, GLshort y, GLshort z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3s");
    debug_print_sync_fallback("WindowPos3s");
    CALL_WindowPos3s(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -13598,7 +13363,7 @@ static void GLAPIENTRY
 _mesa_marshal_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelMapusv");
    debug_print_sync("PixelMapusv");
    CALL_PixelMapusv(ctx->CurrentServerDispatch, (map, mapsize, values));
 }
@@ -13609,7 +13374,7 @@ static void GLAPIENTRY
 _mesa_marshal_DebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DebugMessageInsert");
    debug_print_sync("DebugMessageInsert");
    CALL_DebugMessageInsert(ctx->CurrentServerDispatch, (source, type, id, severity, length, buf));
 }
@@ -13656,7 +13421,7 @@ _mesa_marshal_Orthof(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Orthof");
    debug_print_sync_fallback("Orthof");
    CALL_Orthof(ctx->CurrentServerDispatch, (left, right, bottom, top, zNear, zFar));
 }
@@ -13667,7 +13432,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTexImage2D");
    debug_print_sync("CompressedTexImage2D");
    CALL_CompressedTexImage2D(ctx->CurrentServerDispatch, (target, level, internalformat, width, height, border, imageSize, data));
 }
@@ -13695,13 +13460,15 @@ _mesa_marshal_DeleteObjectARB(GLhandleARB obj)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DeleteObjectARB, cmd_size);
       cmd->obj = obj;
+      _mesa_glthread_DeleteProgram(ctx, obj);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteObjectARB");
    debug_print_sync_fallback("DeleteObjectARB");
    CALL_DeleteObjectARB(ctx->CurrentServerDispatch, (obj));
+   _mesa_glthread_DeleteProgram(ctx, obj);
 }
 
 
@@ -13752,7 +13519,7 @@ _mesa_marshal_ProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix2x3dv");
    debug_print_sync_fallback("ProgramUniformMatrix2x3dv");
    CALL_ProgramUniformMatrix2x3dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -13763,7 +13530,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexArrayiv(GLuint vaobj, GLenum pname, GLint * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexArrayiv");
    debug_print_sync("GetVertexArrayiv");
    CALL_GetVertexArrayiv(ctx->CurrentServerDispatch, (vaobj, pname, param));
 }
@@ -13774,7 +13541,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsSync(GLsync sync)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsSync");
    debug_print_sync("IsSync");
    return CALL_IsSync(ctx->CurrentServerDispatch, (sync));
 }
@@ -13806,7 +13573,7 @@ _mesa_marshal_Color4uiv(const GLuint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4uiv");
    debug_print_sync_fallback("Color4uiv");
    CALL_Color4uiv(ctx->CurrentServerDispatch, (v));
 }
@@ -13841,7 +13608,7 @@ _mesa_marshal_MultiTexCoord1sv(GLenum target, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1sv");
    debug_print_sync_fallback("MultiTexCoord1sv");
    CALL_MultiTexCoord1sv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -13888,7 +13655,7 @@ _mesa_marshal_Orthox(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Orthox");
    debug_print_sync_fallback("Orthox");
    CALL_Orthox(ctx->CurrentServerDispatch, (left, right, bottom, top, zNear, zFar));
 }
@@ -13920,7 +13687,7 @@ _mesa_marshal_PushAttrib(GLbitfield mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PushAttrib");
    debug_print_sync_fallback("PushAttrib");
    CALL_PushAttrib(ctx->CurrentServerDispatch, (mask));
 }
@@ -13955,7 +13722,7 @@ _mesa_marshal_RasterPos2i(GLint x, GLint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2i");
    debug_print_sync_fallback("RasterPos2i");
    CALL_RasterPos2i(ctx->CurrentServerDispatch, (x, y));
 }
@@ -13990,7 +13757,7 @@ _mesa_marshal_ClipPlane(GLenum plane, const GLdouble * equation)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClipPlane");
    debug_print_sync_fallback("ClipPlane");
    CALL_ClipPlane(ctx->CurrentServerDispatch, (plane, equation));
 }
@@ -14025,7 +13792,7 @@ _mesa_marshal_RasterPos2f(GLfloat x, GLfloat y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2f");
    debug_print_sync_fallback("RasterPos2f");
    CALL_RasterPos2f(ctx->CurrentServerDispatch, (x, y));
 }
@@ -14036,7 +13803,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveSubroutineUniformiv");
    debug_print_sync("GetActiveSubroutineUniformiv");
    CALL_GetActiveSubroutineUniformiv(ctx->CurrentServerDispatch, (program, shadertype, index, pname, values));
 }
@@ -14071,7 +13838,7 @@ _mesa_marshal_RasterPos2d(GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2d");
    debug_print_sync_fallback("RasterPos2d");
    CALL_RasterPos2d(ctx->CurrentServerDispatch, (x, y));
 }
@@ -14106,7 +13873,7 @@ _mesa_marshal_MakeImageHandleResidentARB(GLuint64 handle, GLenum access)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MakeImageHandleResidentARB");
    debug_print_sync_fallback("MakeImageHandleResidentARB");
    CALL_MakeImageHandleResidentARB(ctx->CurrentServerDispatch, (handle, access));
 }
@@ -14165,7 +13932,7 @@ _mesa_marshal_InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateSubFramebuffer");
    debug_print_sync_fallback("InvalidateSubFramebuffer");
    CALL_InvalidateSubFramebuffer(ctx->CurrentServerDispatch, (target, numAttachments, attachments, x, y, width, height));
 }
@@ -14206,7 +13973,7 @@ _mesa_marshal_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4ub");
    debug_print_sync_fallback("Color4ub");
    CALL_Color4ub(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -14256,7 +14023,7 @@ _mesa_marshal_UniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix2x4dv");
    debug_print_sync_fallback("UniformMatrix2x4dv");
    CALL_UniformMatrix2x4dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -14291,7 +14058,7 @@ _mesa_marshal_RasterPos2s(GLshort x, GLshort y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2s");
    debug_print_sync_fallback("RasterPos2s");
    CALL_RasterPos2s(ctx->CurrentServerDispatch, (x, y));
 }
@@ -14338,7 +14105,7 @@ _mesa_marshal_DispatchComputeGroupSizeARB(GLuint num_groups_x, GLuint num_groups
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DispatchComputeGroupSizeARB");
    debug_print_sync_fallback("DispatchComputeGroupSizeARB");
    CALL_DispatchComputeGroupSizeARB(ctx->CurrentServerDispatch, (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z));
 }
@@ -14349,7 +14116,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexP2uiv(GLenum type, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexP2uiv");
    debug_print_sync("VertexP2uiv");
    CALL_VertexP2uiv(ctx->CurrentServerDispatch, (type, value));
 }
@@ -14387,7 +14154,7 @@ _mesa_marshal_VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuin
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayBindingDivisor");
    debug_print_sync_fallback("VertexArrayBindingDivisor");
    CALL_VertexArrayBindingDivisor(ctx->CurrentServerDispatch, (vaobj, bindingindex, divisor));
 }
@@ -14422,7 +14189,7 @@ _mesa_marshal_MultiTexCoord3dv(GLenum target, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3dv");
    debug_print_sync_fallback("MultiTexCoord3dv");
    CALL_MultiTexCoord3dv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -14454,7 +14221,7 @@ _mesa_marshal_BindProgramPipeline(GLuint pipeline)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindProgramPipeline");
    debug_print_sync_fallback("BindProgramPipeline");
    CALL_BindProgramPipeline(ctx->CurrentServerDispatch, (pipeline));
 }
@@ -14465,7 +14232,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP4uiv");
    debug_print_sync("VertexAttribP4uiv");
    CALL_VertexAttribP4uiv(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -14476,7 +14243,7 @@ static void GLAPIENTRY
 _mesa_marshal_DebugMessageCallback(GLDEBUGPROC callback, const GLvoid * userParam)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DebugMessageCallback");
    debug_print_sync("DebugMessageCallback");
    CALL_DebugMessageCallback(ctx->CurrentServerDispatch, (callback, userParam));
 }
@@ -14511,7 +14278,7 @@ _mesa_marshal_MultiTexCoord1i(GLenum target, GLint s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1i");
    debug_print_sync_fallback("MultiTexCoord1i");
    CALL_MultiTexCoord1i(ctx->CurrentServerDispatch, (target, s));
 }
@@ -14522,7 +14289,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos2dv(const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2dv");
    debug_print_sync("WindowPos2dv");
    CALL_WindowPos2dv(ctx->CurrentServerDispatch, (v));
 }
@@ -14533,7 +14300,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexParameterIuiv(GLenum target, GLenum pname, const GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameterIuiv");
    debug_print_sync("TexParameterIuiv");
    CALL_TexParameterIuiv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -14565,7 +14332,7 @@ _mesa_marshal_DeletePerfQueryINTEL(GLuint queryHandle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeletePerfQueryINTEL");
    debug_print_sync_fallback("DeletePerfQueryINTEL");
    CALL_DeletePerfQueryINTEL(ctx->CurrentServerDispatch, (queryHandle));
 }
@@ -14600,7 +14367,7 @@ _mesa_marshal_MultiTexCoord1d(GLenum target, GLdouble s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1d");
    debug_print_sync_fallback("MultiTexCoord1d");
    CALL_MultiTexCoord1d(ctx->CurrentServerDispatch, (target, s));
 }
@@ -14635,7 +14402,7 @@ _mesa_marshal_MultiTexCoord1s(GLenum target, GLshort s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1s");
    debug_print_sync_fallback("MultiTexCoord1s");
    CALL_MultiTexCoord1s(ctx->CurrentServerDispatch, (target, s));
 }
@@ -14670,7 +14437,7 @@ _mesa_marshal_BeginConditionalRender(GLuint query, GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginConditionalRender");
    debug_print_sync_fallback("BeginConditionalRender");
    CALL_BeginConditionalRender(ctx->CurrentServerDispatch, (query, mode));
 }
@@ -14681,7 +14448,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetShaderiv(GLuint shader, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetShaderiv");
    debug_print_sync("GetShaderiv");
    CALL_GetShaderiv(ctx->CurrentServerDispatch, (shader, pname, params));
 }
@@ -14725,7 +14492,7 @@ _mesa_marshal_CopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLin
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyConvolutionFilter1D");
    debug_print_sync_fallback("CopyConvolutionFilter1D");
    CALL_CopyConvolutionFilter1D(ctx->CurrentServerDispatch, (target, internalformat, x, y, width));
 }
@@ -14775,7 +14542,7 @@ _mesa_marshal_UniformMatrix4dv(GLint location, GLsizei count, GLboolean transpos
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix4dv");
    debug_print_sync_fallback("UniformMatrix4dv");
    CALL_UniformMatrix4dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -14786,7 +14553,7 @@ static GLhandleARB GLAPIENTRY
 _mesa_marshal_CreateShaderObjectARB(GLenum shaderType)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateShaderObjectARB");
    debug_print_sync("CreateShaderObjectARB");
    return CALL_CreateShaderObjectARB(ctx->CurrentServerDispatch, (shaderType));
 }
@@ -14797,7 +14564,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexParameterxv(GLenum target, GLenum pname, GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexParameterxv");
    debug_print_sync("GetTexParameterxv");
    CALL_GetTexParameterxv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -14808,7 +14575,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * obj)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetAttachedShaders");
    debug_print_sync("GetAttachedShaders");
    CALL_GetAttachedShaders(ctx->CurrentServerDispatch, (program, maxCount, count, obj));
 }
@@ -14819,7 +14586,7 @@ static void GLAPIENTRY
 _mesa_marshal_Materialiv(GLenum face, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Materialiv");
    debug_print_sync("Materialiv");
    CALL_Materialiv(ctx->CurrentServerDispatch, (face, pname, params));
 }
@@ -14851,7 +14618,7 @@ _mesa_marshal_DeleteFragmentShaderATI(GLuint id)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteFragmentShaderATI");
    debug_print_sync_fallback("DeleteFragmentShaderATI");
    CALL_DeleteFragmentShaderATI(ctx->CurrentServerDispatch, (id));
 }
@@ -14862,66 +14629,12 @@ static void GLAPIENTRY
 _mesa_marshal_VertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayVertexBuffers");
    debug_print_sync("VertexArrayVertexBuffers");
    CALL_VertexArrayVertexBuffers(ctx->CurrentServerDispatch, (vaobj, first, count, buffers, offsets, strides));
 }
 
 
-/* DrawElementsInstancedBaseVertex: marshalled asynchronously */
-struct marshal_cmd_DrawElementsInstancedBaseVertex
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-   GLsizei primcount;
-   GLint basevertex;
-};
-static inline void
-_mesa_unmarshal_DrawElementsInstancedBaseVertex(struct gl_context *ctx, const struct marshal_cmd_DrawElementsInstancedBaseVertex *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   const GLsizei primcount = cmd->primcount;
-   const GLint basevertex = cmd->basevertex;
-   CALL_DrawElementsInstancedBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices, GLsizei primcount, GLint basevertex)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawElementsInstancedBaseVertex);
-   struct marshal_cmd_DrawElementsInstancedBaseVertex *cmd;
-   debug_print_marshal("DrawElementsInstancedBaseVertex");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawElementsInstancedBaseVertex");
-      CALL_DrawElementsInstancedBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawElementsInstancedBaseVertex, cmd_size);
-      cmd->mode = mode;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      cmd->primcount = primcount;
-      cmd->basevertex = basevertex;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawElementsInstancedBaseVertex");
-   CALL_DrawElementsInstancedBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex));
-}
-
-
 /* DisableClientState: marshalled asynchronously */
 struct marshal_cmd_DisableClientState
 {
@@ -14944,13 +14657,15 @@ _mesa_marshal_DisableClientState(GLenum array)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DisableClientState, cmd_size);
       cmd->array = array;
+      _mesa_glthread_ClientState(ctx, array, false);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DisableClientState");
    debug_print_sync_fallback("DisableClientState");
    CALL_DisableClientState(ctx->CurrentServerDispatch, (array));
+   _mesa_glthread_ClientState(ctx, array, false);
 }
 
 
@@ -14986,7 +14701,7 @@ _mesa_marshal_TexGeni(GLenum coord, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGeni");
    debug_print_sync_fallback("TexGeni");
    CALL_TexGeni(ctx->CurrentServerDispatch, (coord, pname, param));
 }
@@ -15024,7 +14739,7 @@ _mesa_marshal_TexGenf(GLenum coord, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGenf");
    debug_print_sync_fallback("TexGenf");
    CALL_TexGenf(ctx->CurrentServerDispatch, (coord, pname, param));
 }
@@ -15062,7 +14777,7 @@ _mesa_marshal_TexGend(GLenum coord, GLenum pname, GLdouble param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGend");
    debug_print_sync_fallback("TexGend");
    CALL_TexGend(ctx->CurrentServerDispatch, (coord, pname, param));
 }
@@ -15112,7 +14827,7 @@ _mesa_marshal_ProgramUniform4i64vARB(GLuint program, GLint location, GLsizei cou
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4i64vARB");
    debug_print_sync_fallback("ProgramUniform4i64vARB");
    CALL_ProgramUniform4i64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -15144,7 +14859,7 @@ _mesa_marshal_Color4sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4sv");
    debug_print_sync_fallback("Color4sv");
    CALL_Color4sv(ctx->CurrentServerDispatch, (v));
 }
@@ -15155,7 +14870,7 @@ static void GLAPIENTRY
 _mesa_marshal_LoadTransposeMatrixf(const GLfloat * m)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadTransposeMatrixf");
    debug_print_sync("LoadTransposeMatrixf");
    CALL_LoadTransposeMatrixf(ctx->CurrentServerDispatch, (m));
 }
@@ -15166,7 +14881,7 @@ static void GLAPIENTRY
 _mesa_marshal_LoadTransposeMatrixd(const GLdouble * m)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadTransposeMatrixd");
    debug_print_sync("LoadTransposeMatrixd");
    CALL_LoadTransposeMatrixd(ctx->CurrentServerDispatch, (m));
 }
@@ -15201,7 +14916,7 @@ _mesa_marshal_PixelZoom(GLfloat xfactor, GLfloat yfactor)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelZoom");
    debug_print_sync_fallback("PixelZoom");
    CALL_PixelZoom(ctx->CurrentServerDispatch, (xfactor, yfactor));
 }
@@ -15248,7 +14963,7 @@ _mesa_marshal_ProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramEnvParameter4dARB");
    debug_print_sync_fallback("ProgramEnvParameter4dARB");
    CALL_ProgramEnvParameter4dARB(ctx->CurrentServerDispatch, (target, index, x, y, z, w));
 }
@@ -15259,7 +14974,7 @@ static void GLAPIENTRY
 _mesa_marshal_ColorTableParameterfv(GLenum target, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorTableParameterfv");
    debug_print_sync("ColorTableParameterfv");
    CALL_ColorTableParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -15270,7 +14985,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsSemaphoreEXT(GLuint semaphore)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsSemaphoreEXT");
    debug_print_sync("IsSemaphoreEXT");
    return CALL_IsSemaphoreEXT(ctx->CurrentServerDispatch, (semaphore));
 }
@@ -15281,7 +14996,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsTexture(GLuint texture)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsTexture");
    debug_print_sync("IsTexture");
    return CALL_IsTexture(ctx->CurrentServerDispatch, (texture));
 }
@@ -15331,7 +15046,7 @@ _mesa_marshal_ProgramUniform3uiv(GLuint program, GLint location, GLsizei count,
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3uiv");
    debug_print_sync_fallback("ProgramUniform3uiv");
    CALL_ProgramUniform3uiv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -15360,25 +15075,20 @@ _mesa_marshal_IndexPointer(GLenum type, GLsizei stride, const GLvoid * pointer)
    size_t cmd_size = sizeof(struct marshal_cmd_IndexPointer);
    struct marshal_cmd_IndexPointer *cmd;
    debug_print_marshal("IndexPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("IndexPointer");
-      CALL_IndexPointer(ctx->CurrentServerDispatch, (type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_IndexPointer, cmd_size);
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR_INDEX, 1, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IndexPointer");
    debug_print_sync_fallback("IndexPointer");
    CALL_IndexPointer(ctx->CurrentServerDispatch, (type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR_INDEX, 1, type, stride, pointer);
 }
 
 
@@ -15420,7 +15130,7 @@ _mesa_marshal_VertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4sNV");
    debug_print_sync_fallback("VertexAttrib4sNV");
    CALL_VertexAttrib4sNV(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -15431,7 +15141,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMapdv(GLenum target, GLenum query, GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMapdv");
    debug_print_sync("GetMapdv");
    CALL_GetMapdv(ctx->CurrentServerDispatch, (target, query, v));
 }
@@ -15478,7 +15188,7 @@ _mesa_marshal_Uniform3ui64vARB(GLint location, GLsizei count, const GLuint64 * v
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3ui64vARB");
    debug_print_sync_fallback("Uniform3ui64vARB");
    CALL_Uniform3ui64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -15489,7 +15199,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetInteger64i_v(GLenum cap, GLuint index, GLint64 * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetInteger64i_v");
    debug_print_sync("GetInteger64i_v");
    CALL_GetInteger64i_v(ctx->CurrentServerDispatch, (cap, index, data));
 }
@@ -15530,7 +15240,7 @@ _mesa_marshal_BufferPageCommitmentARB(GLenum target, GLintptr offset, GLsizeiptr
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BufferPageCommitmentARB");
    debug_print_sync_fallback("BufferPageCommitmentARB");
    CALL_BufferPageCommitmentARB(ctx->CurrentServerDispatch, (target, offset, size, commit));
 }
@@ -15541,7 +15251,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsBuffer(GLuint buffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsBuffer");
    debug_print_sync("IsBuffer");
    return CALL_IsBuffer(ctx->CurrentServerDispatch, (buffer));
 }
@@ -15576,7 +15286,7 @@ _mesa_marshal_ColorP4ui(GLenum type, GLuint color)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorP4ui");
    debug_print_sync_fallback("ColorP4ui");
    CALL_ColorP4ui(ctx->CurrentServerDispatch, (type, color));
 }
@@ -15623,7 +15333,7 @@ _mesa_marshal_TextureStorage3D(GLuint texture, GLsizei levels, GLenum internalfo
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage3D");
    debug_print_sync_fallback("TextureStorage3D");
    CALL_TextureStorage3D(ctx->CurrentServerDispatch, (texture, levels, internalformat, width, height, depth));
 }
@@ -15634,7 +15344,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexCoordP3uiv(GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP3uiv");
    debug_print_sync("TexCoordP3uiv");
    CALL_TexCoordP3uiv(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -15645,7 +15355,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnUniformui64vARB(GLuint program, GLint location, GLsizei bufSize, GLuint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnUniformui64vARB");
    debug_print_sync("GetnUniformui64vARB");
    CALL_GetnUniformui64vARB(ctx->CurrentServerDispatch, (program, location, bufSize, params));
 }
@@ -15698,7 +15408,7 @@ _mesa_marshal_TextureStorageMem2DMultisampleEXT(GLuint texture, GLsizei samples,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorageMem2DMultisampleEXT");
    debug_print_sync_fallback("TextureStorageMem2DMultisampleEXT");
    CALL_TextureStorageMem2DMultisampleEXT(ctx->CurrentServerDispatch, (texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset));
 }
@@ -15745,7 +15455,7 @@ _mesa_marshal_Uniform1iv(GLint location, GLsizei count, const GLint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1iv");
    debug_print_sync_fallback("Uniform1iv");
    CALL_Uniform1iv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -15792,7 +15502,7 @@ _mesa_marshal_Uniform4uiv(GLint location, GLsizei count, const GLuint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4uiv");
    debug_print_sync_fallback("Uniform4uiv");
    CALL_Uniform4uiv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -15823,7 +15533,7 @@ _mesa_marshal_PopDebugGroup(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PopDebugGroup");
    debug_print_sync_fallback("PopDebugGroup");
    CALL_PopDebugGroup(ctx->CurrentServerDispatch, ());
 }
@@ -15858,7 +15568,7 @@ _mesa_marshal_VertexAttrib1d(GLuint index, GLdouble x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1d");
    debug_print_sync_fallback("VertexAttrib1d");
    CALL_VertexAttrib1d(ctx->CurrentServerDispatch, (index, x));
 }
@@ -15869,7 +15579,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTexImage1D");
    debug_print_sync("CompressedTexImage1D");
    CALL_CompressedTexImage1D(ctx->CurrentServerDispatch, (target, level, internalformat, width, border, imageSize, data));
 }
@@ -15913,7 +15623,7 @@ _mesa_marshal_TexBufferRange(GLenum target, GLenum internalformat, GLuint buffer
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexBufferRange");
    debug_print_sync_fallback("TexBufferRange");
    CALL_TexBufferRange(ctx->CurrentServerDispatch, (target, internalformat, buffer, offset, size));
 }
@@ -15948,7 +15658,7 @@ _mesa_marshal_VertexAttrib1s(GLuint index, GLshort x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1s");
    debug_print_sync_fallback("VertexAttrib1s");
    CALL_VertexAttrib1s(ctx->CurrentServerDispatch, (index, x));
 }
@@ -15959,7 +15669,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid * indirect, GLsizei primcount, GLsizei stride)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawElementsIndirect");
    debug_print_sync("MultiDrawElementsIndirect");
    CALL_MultiDrawElementsIndirect(ctx->CurrentServerDispatch, (mode, type, indirect, primcount, stride));
 }
@@ -16009,7 +15719,7 @@ _mesa_marshal_UniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix4x3dv");
    debug_print_sync_fallback("UniformMatrix4x3dv");
    CALL_UniformMatrix4x3dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -16047,7 +15757,7 @@ _mesa_marshal_TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffe
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TransformFeedbackBufferBase");
    debug_print_sync_fallback("TransformFeedbackBufferBase");
    CALL_TransformFeedbackBufferBase(ctx->CurrentServerDispatch, (xfb, index, buffer));
 }
@@ -16079,7 +15789,7 @@ _mesa_marshal_FogCoordfvEXT(const GLfloat * coord)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FogCoordfvEXT");
    debug_print_sync_fallback("FogCoordfvEXT");
    CALL_FogCoordfvEXT(ctx->CurrentServerDispatch, (coord));
 }
@@ -16126,7 +15836,7 @@ _mesa_marshal_Uniform2ui64vARB(GLint location, GLsizei count, const GLuint64 * v
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2ui64vARB");
    debug_print_sync_fallback("Uniform2ui64vARB");
    CALL_Uniform2ui64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -16137,7 +15847,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetColorTableParameterfv(GLenum target, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetColorTableParameterfv");
    debug_print_sync("GetColorTableParameterfv");
    CALL_GetColorTableParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -16178,7 +15888,7 @@ _mesa_marshal_MultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3fARB");
    debug_print_sync_fallback("MultiTexCoord3fARB");
    CALL_MultiTexCoord3fARB(ctx->CurrentServerDispatch, (target, s, t, r));
 }
@@ -16189,7 +15899,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexLevelParameterfv");
    debug_print_sync("GetTexLevelParameterfv");
    CALL_GetTexLevelParameterfv(ctx->CurrentServerDispatch, (target, level, pname, params));
 }
@@ -16221,7 +15931,7 @@ _mesa_marshal_Vertex2sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2sv");
    debug_print_sync_fallback("Vertex2sv");
    CALL_Vertex2sv(ctx->CurrentServerDispatch, (v));
 }
@@ -16232,7 +15942,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnMapdvARB(GLenum target, GLenum query, GLsizei bufSize, GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnMapdvARB");
    debug_print_sync("GetnMapdvARB");
    CALL_GetnMapdvARB(ctx->CurrentServerDispatch, (target, query, bufSize, v));
 }
@@ -16270,7 +15980,7 @@ _mesa_marshal_VertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2dNV");
    debug_print_sync_fallback("VertexAttrib2dNV");
    CALL_VertexAttrib2dNV(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -16305,7 +16015,7 @@ _mesa_marshal_VertexAttrib3svNV(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3svNV");
    debug_print_sync_fallback("VertexAttrib3svNV");
    CALL_VertexAttrib3svNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -16316,7 +16026,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexEnviv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexEnviv");
    debug_print_sync("GetTexEnviv");
    CALL_GetTexEnviv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -16358,14 +16068,16 @@ _mesa_marshal_ViewportArrayv(GLuint first, GLsizei count, const GLfloat * v)
       char *variable_data = (char *) (cmd + 1);
       memcpy(variable_data, v, count * 16);
       variable_data += count * 16;
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ViewportArrayv");
    debug_print_sync_fallback("ViewportArrayv");
    CALL_ViewportArrayv(ctx->CurrentServerDispatch, (first, count, v));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -16374,7 +16086,7 @@ static void GLAPIENTRY
 _mesa_marshal_SeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SeparableFilter2D");
    debug_print_sync("SeparableFilter2D");
    CALL_SeparableFilter2D(ctx->CurrentServerDispatch, (target, internalformat, width, height, format, type, row, column));
 }
@@ -16399,6 +16111,12 @@ _mesa_marshal_ArrayElement(GLint i)
    size_t cmd_size = sizeof(struct marshal_cmd_ArrayElement);
    struct marshal_cmd_ArrayElement *cmd;
    debug_print_marshal("ArrayElement");
+   if (_mesa_glthread_has_user_arrays(ctx, "ArrayElement")) {
+      _mesa_glthread_finish_before(ctx, "ArrayElement");
+      debug_print_sync_fallback("ArrayElement");
+      CALL_ArrayElement(ctx->CurrentServerDispatch, (i));
+      return;
+   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ArrayElement, cmd_size);
       cmd->i = i;
@@ -16406,7 +16124,7 @@ _mesa_marshal_ArrayElement(GLint i)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ArrayElement");
    debug_print_sync_fallback("ArrayElement");
    CALL_ArrayElement(ctx->CurrentServerDispatch, (i));
 }
@@ -16417,7 +16135,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexImage2D");
    debug_print_sync("TexImage2D");
    CALL_TexImage2D(ctx->CurrentServerDispatch, (target, level, internalformat, width, height, border, format, type, pixels));
 }
@@ -16449,7 +16167,7 @@ _mesa_marshal_RasterPos2dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2dv");
    debug_print_sync_fallback("RasterPos2dv");
    CALL_RasterPos2dv(ctx->CurrentServerDispatch, (v));
 }
@@ -16460,7 +16178,7 @@ static void GLAPIENTRY
 _mesa_marshal_Fogiv(GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Fogiv");
    debug_print_sync("Fogiv");
    CALL_Fogiv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -16492,7 +16210,7 @@ _mesa_marshal_EndQuery(GLenum target)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndQuery");
    debug_print_sync_fallback("EndQuery");
    CALL_EndQuery(ctx->CurrentServerDispatch, (target));
 }
@@ -16524,7 +16242,7 @@ _mesa_marshal_TexCoord1dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1dv");
    debug_print_sync_fallback("TexCoord1dv");
    CALL_TexCoord1dv(ctx->CurrentServerDispatch, (v));
 }
@@ -16589,7 +16307,7 @@ _mesa_marshal_AlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint a
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AlphaFragmentOp3ATI");
    debug_print_sync_fallback("AlphaFragmentOp3ATI");
    CALL_AlphaFragmentOp3ATI(ctx->CurrentServerDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
 }
@@ -16621,7 +16339,7 @@ _mesa_marshal_Clear(GLbitfield mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Clear");
    debug_print_sync_fallback("Clear");
    CALL_Clear(ctx->CurrentServerDispatch, (mask));
 }
@@ -16656,7 +16374,7 @@ _mesa_marshal_VertexAttrib4sv(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4sv");
    debug_print_sync_fallback("VertexAttrib4sv");
    CALL_VertexAttrib4sv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -16703,7 +16421,7 @@ _mesa_marshal_Ortho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Ortho");
    debug_print_sync_fallback("Ortho");
    CALL_Ortho(ctx->CurrentServerDispatch, (left, right, bottom, top, zNear, zFar));
 }
@@ -16750,7 +16468,7 @@ _mesa_marshal_Uniform3uiv(GLint location, GLsizei count, const GLuint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3uiv");
    debug_print_sync_fallback("Uniform3uiv");
    CALL_Uniform3uiv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -16761,7 +16479,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformi64vARB(GLuint program, GLint location, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformi64vARB");
    debug_print_sync("GetUniformi64vARB");
    CALL_GetUniformi64vARB(ctx->CurrentServerDispatch, (program, location, params));
 }
@@ -16796,7 +16514,7 @@ _mesa_marshal_EndQueryIndexed(GLenum target, GLuint index)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndQueryIndexed");
    debug_print_sync_fallback("EndQueryIndexed");
    CALL_EndQueryIndexed(ctx->CurrentServerDispatch, (target, index));
 }
@@ -16807,7 +16525,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexParameterxv(GLenum target, GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameterxv");
    debug_print_sync("TexParameterxv");
    CALL_TexParameterxv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -16851,7 +16569,7 @@ _mesa_marshal_MultiDrawArraysIndirectCountARB(GLenum mode, GLintptr indirect, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawArraysIndirectCountARB");
    debug_print_sync_fallback("MultiDrawArraysIndirectCountARB");
    CALL_MultiDrawArraysIndirectCountARB(ctx->CurrentServerDispatch, (mode, indirect, drawcount, maxdrawcount, stride));
 }
@@ -16904,7 +16622,7 @@ _mesa_marshal_ProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix2fv");
    debug_print_sync_fallback("ProgramUniformMatrix2fv");
    CALL_ProgramUniformMatrix2fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -16942,7 +16660,7 @@ _mesa_marshal_ProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLf
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramLocalParameter4fvARB");
    debug_print_sync_fallback("ProgramLocalParameter4fvARB");
    CALL_ProgramLocalParameter4fvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -16989,7 +16707,7 @@ _mesa_marshal_Uniform4dv(GLint location, GLsizei count, const GLdouble * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4dv");
    debug_print_sync_fallback("Uniform4dv");
    CALL_Uniform4dv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -17000,7 +16718,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUnsignedBytevEXT(GLenum pname, GLubyte * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUnsignedBytevEXT");
    debug_print_sync("GetUnsignedBytevEXT");
    CALL_GetUnsignedBytevEXT(ctx->CurrentServerDispatch, (pname, data));
 }
@@ -17035,7 +16753,7 @@ _mesa_marshal_LightModelx(GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LightModelx");
    debug_print_sync_fallback("LightModelx");
    CALL_LightModelx(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -17076,7 +16794,7 @@ _mesa_marshal_VertexAttribI3iEXT(GLuint index, GLint x, GLint y, GLint z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI3iEXT");
    debug_print_sync_fallback("VertexAttribI3iEXT");
    CALL_VertexAttribI3iEXT(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -17117,7 +16835,7 @@ _mesa_marshal_ClearColorx(GLclampx red, GLclampx green, GLclampx blue, GLclampx
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearColorx");
    debug_print_sync_fallback("ClearColorx");
    CALL_ClearColorx(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -17144,13 +16862,15 @@ _mesa_marshal_EndTransformFeedback(void)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_EndTransformFeedback, cmd_size);
       (void) cmd;
 
+      _mesa_glthread_EndTransformFeedback(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndTransformFeedback");
    debug_print_sync_fallback("EndTransformFeedback");
    CALL_EndTransformFeedback(ctx->CurrentServerDispatch, ());
+   _mesa_glthread_EndTransformFeedback(ctx);
 }
 
 
@@ -17159,7 +16879,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribL2dv(GLuint index, const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL2dv");
    debug_print_sync("VertexAttribL2dv");
    CALL_VertexAttribL2dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -17170,7 +16890,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveUniformName");
    debug_print_sync("GetActiveUniformName");
    CALL_GetActiveUniformName(ctx->CurrentServerDispatch, (program, uniformIndex, bufSize, length, uniformName));
 }
@@ -17181,7 +16901,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, GLvoid * binary)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramBinary");
    debug_print_sync("GetProgramBinary");
    CALL_GetProgramBinary(ctx->CurrentServerDispatch, (program, bufSize, length, binaryFormat, binary));
 }
@@ -17212,13 +16932,15 @@ _mesa_marshal_ViewportIndexedfv(GLuint index, const GLfloat * v)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ViewportIndexedfv, cmd_size);
       cmd->index = index;
       memcpy(cmd->v, v, 16);
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ViewportIndexedfv");
    debug_print_sync_fallback("ViewportIndexedfv");
    CALL_ViewportIndexedfv(ctx->CurrentServerDispatch, (index, v));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -17247,13 +16969,15 @@ _mesa_marshal_BindTextureUnit(GLuint unit, GLuint texture)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindTextureUnit, cmd_size);
       cmd->unit = unit;
       cmd->texture = texture;
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindTextureUnit");
    debug_print_sync_fallback("BindTextureUnit");
    CALL_BindTextureUnit(ctx->CurrentServerDispatch, (unit, texture));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -17279,13 +17003,15 @@ _mesa_marshal_CallList(GLuint list)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_CallList, cmd_size);
       cmd->list = list;
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CallList");
    debug_print_sync_fallback("CallList");
    CALL_CallList(ctx->CurrentServerDispatch, (list));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -17294,7 +17020,7 @@ static void GLAPIENTRY
 _mesa_marshal_Materialfv(GLenum face, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Materialfv");
    debug_print_sync("Materialfv");
    CALL_Materialfv(ctx->CurrentServerDispatch, (face, pname, params));
 }
@@ -17322,13 +17048,15 @@ _mesa_marshal_DeleteProgram(GLuint program)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DeleteProgram, cmd_size);
       cmd->program = program;
+      _mesa_glthread_DeleteProgram(ctx, program);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteProgram");
    debug_print_sync_fallback("DeleteProgram");
    CALL_DeleteProgram(ctx->CurrentServerDispatch, (program));
+   _mesa_glthread_DeleteProgram(ctx, program);
 }
 
 
@@ -17337,7 +17065,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveAtomicCounterBufferiv");
    debug_print_sync("GetActiveAtomicCounterBufferiv");
    CALL_GetActiveAtomicCounterBufferiv(ctx->CurrentServerDispatch, (program, bufferIndex, pname, params));
 }
@@ -17369,7 +17097,7 @@ _mesa_marshal_ClearDepthf(GLclampf depth)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearDepthf");
    debug_print_sync_fallback("ClearDepthf");
    CALL_ClearDepthf(ctx->CurrentServerDispatch, (depth));
 }
@@ -17380,7 +17108,7 @@ static GLuint64 GLAPIENTRY
 _mesa_marshal_GetTextureHandleARB(GLuint texture)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureHandleARB");
    debug_print_sync("GetTextureHandleARB");
    return CALL_GetTextureHandleARB(ctx->CurrentServerDispatch, (texture));
 }
@@ -17391,7 +17119,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid * image)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetConvolutionFilter");
    debug_print_sync("GetConvolutionFilter");
    CALL_GetConvolutionFilter(ctx->CurrentServerDispatch, (target, format, type, image));
 }
@@ -17402,7 +17130,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiModeDrawElementsIBM(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiModeDrawElementsIBM");
    debug_print_sync("MultiModeDrawElementsIBM");
    CALL_MultiModeDrawElementsIBM(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, modestride));
 }
@@ -17449,7 +17177,7 @@ _mesa_marshal_Uniform2iv(GLint location, GLsizei count, const GLint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2iv");
    debug_print_sync_fallback("Uniform2iv");
    CALL_Uniform2iv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -17460,7 +17188,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetFixedv(GLenum pname, GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFixedv");
    debug_print_sync("GetFixedv");
    CALL_GetFixedv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -17495,7 +17223,7 @@ _mesa_marshal_SampleCoveragex(GLclampx value, GLboolean invert)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SampleCoveragex");
    debug_print_sync_fallback("SampleCoveragex");
    CALL_SampleCoveragex(ctx->CurrentServerDispatch, (value, invert));
 }
@@ -17506,7 +17234,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfQueryInfoINTEL(GLuint queryId, GLuint queryNameLength, GLchar * queryName, GLuint * dataSize, GLuint * noCounters, GLuint * noInstances, GLuint * capsMask)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfQueryInfoINTEL");
    debug_print_sync("GetPerfQueryInfoINTEL");
    CALL_GetPerfQueryInfoINTEL(ctx->CurrentServerDispatch, (queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask));
 }
@@ -17545,14 +17273,16 @@ _mesa_marshal_DeleteFramebuffers(GLsizei n, const GLuint * framebuffers)
       char *variable_data = (char *) (cmd + 1);
       memcpy(variable_data, framebuffers, n * 4);
       variable_data += n * 4;
+      _mesa_glthread_DeleteFramebuffers(ctx, n, framebuffers);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteFramebuffers");
    debug_print_sync_fallback("DeleteFramebuffers");
    CALL_DeleteFramebuffers(ctx->CurrentServerDispatch, (n, framebuffers));
+   _mesa_glthread_DeleteFramebuffers(ctx, n, framebuffers);
 }
 
 
@@ -17585,7 +17315,7 @@ _mesa_marshal_VertexAttrib4uiv(GLuint index, const GLuint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4uiv");
    debug_print_sync_fallback("VertexAttrib4uiv");
    CALL_VertexAttrib4uiv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -17620,7 +17350,7 @@ _mesa_marshal_VertexAttrib4Nsv(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Nsv");
    debug_print_sync_fallback("VertexAttrib4Nsv");
    CALL_VertexAttrib4Nsv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -17661,7 +17391,7 @@ _mesa_marshal_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4s");
    debug_print_sync_fallback("Vertex4s");
    CALL_Vertex4s(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -17699,7 +17429,7 @@ _mesa_marshal_VertexAttribI2iEXT(GLuint index, GLint x, GLint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI2iEXT");
    debug_print_sync_fallback("VertexAttribI2iEXT");
    CALL_VertexAttribI2iEXT(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -17740,7 +17470,7 @@ _mesa_marshal_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4f");
    debug_print_sync_fallback("Vertex4f");
    CALL_Vertex4f(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -17781,7 +17511,7 @@ _mesa_marshal_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4d");
    debug_print_sync_fallback("Vertex4d");
    CALL_Vertex4d(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -17792,7 +17522,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribL4dv(GLuint index, const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL4dv");
    debug_print_sync("VertexAttribL4dv");
    CALL_VertexAttribL4dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -17803,7 +17533,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnUniformi64vARB(GLuint program, GLint location, GLsizei bufSize, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnUniformi64vARB");
    debug_print_sync("GetnUniformi64vARB");
    CALL_GetnUniformi64vARB(ctx->CurrentServerDispatch, (program, location, bufSize, params));
 }
@@ -17814,7 +17544,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexGenfv(GLenum coord, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexGenfv");
    debug_print_sync("GetTexGenfv");
    CALL_GetTexGenfv(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -17855,7 +17585,7 @@ _mesa_marshal_Vertex4i(GLint x, GLint y, GLint z, GLint w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4i");
    debug_print_sync_fallback("Vertex4i");
    CALL_Vertex4i(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -17887,7 +17617,7 @@ _mesa_marshal_MemoryBarrierByRegion(GLbitfield barriers)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MemoryBarrierByRegion");
    debug_print_sync_fallback("MemoryBarrierByRegion");
    CALL_MemoryBarrierByRegion(ctx->CurrentServerDispatch, (barriers));
 }
@@ -17928,7 +17658,7 @@ _mesa_marshal_StencilFuncSeparateATI(GLenum frontfunc, GLenum backfunc, GLint re
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilFuncSeparateATI");
    debug_print_sync_fallback("StencilFuncSeparateATI");
    CALL_StencilFuncSeparateATI(ctx->CurrentServerDispatch, (frontfunc, backfunc, ref, mask));
 }
@@ -17939,7 +17669,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribIuiv");
    debug_print_sync("GetVertexAttribIuiv");
    CALL_GetVertexAttribIuiv(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -17950,7 +17680,7 @@ static void GLAPIENTRY
 _mesa_marshal_LightModelfv(GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LightModelfv");
    debug_print_sync("LightModelfv");
    CALL_LightModelfv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -17982,7 +17712,7 @@ _mesa_marshal_Vertex4dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4dv");
    debug_print_sync_fallback("Vertex4dv");
    CALL_Vertex4dv(ctx->CurrentServerDispatch, (v));
 }
@@ -17993,7 +17723,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * infoLog)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetInfoLogARB");
    debug_print_sync("GetInfoLogARB");
    CALL_GetInfoLogARB(ctx->CurrentServerDispatch, (obj, maxLength, length, infoLog));
 }
@@ -18025,7 +17755,7 @@ _mesa_marshal_StencilMask(GLuint mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilMask");
    debug_print_sync_fallback("StencilMask");
    CALL_StencilMask(ctx->CurrentServerDispatch, (mask));
 }
@@ -18060,7 +17790,7 @@ _mesa_marshal_NamedFramebufferReadBuffer(GLuint framebuffer, GLenum buf)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferReadBuffer");
    debug_print_sync_fallback("NamedFramebufferReadBuffer");
    CALL_NamedFramebufferReadBuffer(ctx->CurrentServerDispatch, (framebuffer, buf));
 }
@@ -18098,7 +17828,7 @@ _mesa_marshal_ProgramUniformHandleui64ARB(GLuint program, GLint location, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformHandleui64ARB");
    debug_print_sync_fallback("ProgramUniformHandleui64ARB");
    CALL_ProgramUniformHandleui64ARB(ctx->CurrentServerDispatch, (program, location, value));
 }
@@ -18139,7 +17869,7 @@ _mesa_marshal_ProgramUniform2i64ARB(GLuint program, GLint location, GLint64 x, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2i64ARB");
    debug_print_sync_fallback("ProgramUniform2i64ARB");
    CALL_ProgramUniform2i64ARB(ctx->CurrentServerDispatch, (program, location, x, y));
 }
@@ -18150,7 +17880,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsList(GLuint list)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsList");
    debug_print_sync("IsList");
    return CALL_IsList(ctx->CurrentServerDispatch, (list));
 }
@@ -18161,7 +17891,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetIntegeri_v(GLenum value, GLuint index, GLint * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetIntegeri_v");
    debug_print_sync("GetIntegeri_v");
    CALL_GetIntegeri_v(ctx->CurrentServerDispatch, (value, index, data));
 }
@@ -18211,7 +17941,7 @@ _mesa_marshal_ProgramUniform2iv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2iv");
    debug_print_sync_fallback("ProgramUniform2iv");
    CALL_ProgramUniform2iv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -18222,9 +17952,10 @@ static void GLAPIENTRY
 _mesa_marshal_CreateVertexArrays(GLsizei n, GLuint * arrays)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateVertexArrays");
    debug_print_sync("CreateVertexArrays");
    CALL_CreateVertexArrays(ctx->CurrentServerDispatch, (n, arrays));
+   _mesa_glthread_GenVertexArrays(ctx, n, arrays);
 }
 
 
@@ -18251,25 +17982,20 @@ _mesa_marshal_FogCoordPointer(GLenum type, GLsizei stride, const GLvoid * pointe
    size_t cmd_size = sizeof(struct marshal_cmd_FogCoordPointer);
    struct marshal_cmd_FogCoordPointer *cmd;
    debug_print_marshal("FogCoordPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("FogCoordPointer");
-      CALL_FogCoordPointer(ctx->CurrentServerDispatch, (type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_FogCoordPointer, cmd_size);
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_FOG, 1, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FogCoordPointer");
    debug_print_sync_fallback("FogCoordPointer");
    CALL_FogCoordPointer(ctx->CurrentServerDispatch, (type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_FOG, 1, type, stride, pointer);
 }
 
 
@@ -18305,7 +18031,7 @@ _mesa_marshal_SecondaryColor3us(GLushort red, GLushort green, GLushort blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3us");
    debug_print_sync_fallback("SecondaryColor3us");
    CALL_SecondaryColor3us(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -18352,7 +18078,7 @@ _mesa_marshal_TextureStorageMem1DEXT(GLuint texture, GLsizei levels, GLenum inte
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorageMem1DEXT");
    debug_print_sync_fallback("TextureStorageMem1DEXT");
    CALL_TextureStorageMem1DEXT(ctx->CurrentServerDispatch, (texture, levels, internalFormat, width, memory, offset));
 }
@@ -18390,7 +18116,7 @@ _mesa_marshal_SecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3ub");
    debug_print_sync_fallback("SecondaryColor3ub");
    CALL_SecondaryColor3ub(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -18431,7 +18157,7 @@ _mesa_marshal_NamedBufferStorageMemEXT(GLuint buffer, GLsizeiptr size, GLuint me
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedBufferStorageMemEXT");
    debug_print_sync_fallback("NamedBufferStorageMemEXT");
    CALL_NamedBufferStorageMemEXT(ctx->CurrentServerDispatch, (buffer, size, memory, offset));
 }
@@ -18469,7 +18195,7 @@ _mesa_marshal_SecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3ui");
    debug_print_sync_fallback("SecondaryColor3ui");
    CALL_SecondaryColor3ui(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -18516,7 +18242,7 @@ _mesa_marshal_ProgramUniform4ui64ARB(GLuint program, GLint location, GLuint64 x,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4ui64ARB");
    debug_print_sync_fallback("ProgramUniform4ui64ARB");
    CALL_ProgramUniform4ui64ARB(ctx->CurrentServerDispatch, (program, location, x, y, z, w));
 }
@@ -18551,7 +18277,7 @@ _mesa_marshal_VertexAttrib1sNV(GLuint index, GLshort x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1sNV");
    debug_print_sync_fallback("VertexAttrib1sNV");
    CALL_VertexAttrib1sNV(ctx->CurrentServerDispatch, (index, x));
 }
@@ -18562,7 +18288,7 @@ static void GLAPIENTRY
 _mesa_marshal_SignalSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * dstLayouts)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SignalSemaphoreEXT");
    debug_print_sync("SignalSemaphoreEXT");
    CALL_SignalSemaphoreEXT(ctx->CurrentServerDispatch, (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts));
 }
@@ -18600,7 +18326,7 @@ _mesa_marshal_TextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureBuffer");
    debug_print_sync_fallback("TextureBuffer");
    CALL_TextureBuffer(ctx->CurrentServerDispatch, (texture, internalformat, buffer));
 }
@@ -18631,7 +18357,7 @@ _mesa_marshal_InitNames(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InitNames");
    debug_print_sync_fallback("InitNames");
    CALL_InitNames(ctx->CurrentServerDispatch, ());
 }
@@ -18663,7 +18389,7 @@ _mesa_marshal_Normal3sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3sv");
    debug_print_sync_fallback("Normal3sv");
    CALL_Normal3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -18707,7 +18433,7 @@ _mesa_marshal_DeleteQueries(GLsizei n, const GLuint * ids)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteQueries");
    debug_print_sync_fallback("DeleteQueries");
    CALL_DeleteQueries(ctx->CurrentServerDispatch, (n, ids));
 }
@@ -18754,7 +18480,7 @@ _mesa_marshal_InvalidateFramebuffer(GLenum target, GLsizei numAttachments, const
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateFramebuffer");
    debug_print_sync_fallback("InvalidateFramebuffer");
    CALL_InvalidateFramebuffer(ctx->CurrentServerDispatch, (target, numAttachments, attachments));
 }
@@ -18789,7 +18515,7 @@ _mesa_marshal_Hint(GLenum target, GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Hint");
    debug_print_sync_fallback("Hint");
    CALL_Hint(ctx->CurrentServerDispatch, (target, mode));
 }
@@ -18821,7 +18547,7 @@ _mesa_marshal_MemoryBarrier(GLbitfield barriers)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MemoryBarrier");
    debug_print_sync_fallback("MemoryBarrier");
    CALL_MemoryBarrier(ctx->CurrentServerDispatch, (barriers));
 }
@@ -18865,7 +18591,7 @@ _mesa_marshal_CopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyColorSubTable");
    debug_print_sync_fallback("CopyColorSubTable");
    CALL_CopyColorSubTable(ctx->CurrentServerDispatch, (target, start, x, y, width));
 }
@@ -18876,7 +18602,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetObjectParameterfvARB");
    debug_print_sync("GetObjectParameterfvARB");
    CALL_GetObjectParameterfvARB(ctx->CurrentServerDispatch, (obj, pname, params));
 }
@@ -18887,7 +18613,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexEnvxv(GLenum target, GLenum pname, GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexEnvxv");
    debug_print_sync("GetTexEnvxv");
    CALL_GetTexEnvxv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -18919,7 +18645,7 @@ _mesa_marshal_DrawTexsvOES(const GLshort * coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexsvOES");
    debug_print_sync_fallback("DrawTexsvOES");
    CALL_DrawTexsvOES(ctx->CurrentServerDispatch, (coords));
 }
@@ -18947,13 +18673,15 @@ _mesa_marshal_Disable(GLenum cap)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_Disable, cmd_size);
       cmd->cap = cap;
+      _mesa_glthread_Disable(ctx, cap);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Disable");
    debug_print_sync_fallback("Disable");
    CALL_Disable(ctx->CurrentServerDispatch, (cap));
+   _mesa_glthread_Disable(ctx, cap);
 }
 
 
@@ -18992,7 +18720,7 @@ _mesa_marshal_ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf a
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearColor");
    debug_print_sync_fallback("ClearColor");
    CALL_ClearColor(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -19003,7 +18731,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureParameterIuiv");
    debug_print_sync("GetTextureParameterIuiv");
    CALL_GetTextureParameterIuiv(ctx->CurrentServerDispatch, (texture, pname, params));
 }
@@ -19035,7 +18763,7 @@ _mesa_marshal_RasterPos4iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4iv");
    debug_print_sync_fallback("RasterPos4iv");
    CALL_RasterPos4iv(ctx->CurrentServerDispatch, (v));
 }
@@ -19046,7 +18774,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_VDPAUIsSurfaceNV(GLintptr surface)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUIsSurfaceNV");
    debug_print_sync("VDPAUIsSurfaceNV");
    return CALL_VDPAUIsSurfaceNV(ctx->CurrentServerDispatch, (surface));
 }
@@ -19099,7 +18827,7 @@ _mesa_marshal_ProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix2x3fv");
    debug_print_sync_fallback("ProgramUniformMatrix2x3fv");
    CALL_ProgramUniformMatrix2x3fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -19136,13 +18864,15 @@ _mesa_marshal_BindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offs
       cmd->buffer = buffer;
       cmd->offset = offset;
       cmd->stride = stride;
+      _mesa_glthread_invalidate_arrays(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindVertexBuffer");
    debug_print_sync_fallback("BindVertexBuffer");
    CALL_BindVertexBuffer(ctx->CurrentServerDispatch, (bindingindex, buffer, offset, stride));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -19181,7 +18911,7 @@ _mesa_marshal_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4i");
    debug_print_sync_fallback("RasterPos4i");
    CALL_RasterPos4i(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -19222,7 +18952,7 @@ _mesa_marshal_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4d");
    debug_print_sync_fallback("RasterPos4d");
    CALL_RasterPos4d(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -19263,7 +18993,7 @@ _mesa_marshal_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4f");
    debug_print_sync_fallback("RasterPos4f");
    CALL_RasterPos4f(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -19274,7 +19004,7 @@ static void GLAPIENTRY
 _mesa_marshal_VDPAUMapSurfacesNV(GLsizei numSurfaces, const GLintptr * surfaces)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUMapSurfacesNV");
    debug_print_sync("VDPAUMapSurfacesNV");
    CALL_VDPAUMapSurfacesNV(ctx->CurrentServerDispatch, (numSurfaces, surfaces));
 }
@@ -19285,7 +19015,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryIndexediv");
    debug_print_sync("GetQueryIndexediv");
    CALL_GetQueryIndexediv(ctx->CurrentServerDispatch, (target, index, pname, params));
 }
@@ -19317,7 +19047,7 @@ _mesa_marshal_RasterPos3dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3dv");
    debug_print_sync_fallback("RasterPos3dv");
    CALL_RasterPos3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -19328,9 +19058,10 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramiv(GLuint program, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramiv");
    debug_print_sync("GetProgramiv");
    CALL_GetProgramiv(ctx->CurrentServerDispatch, (program, pname, params));
+   _mesa_glthread_GetProgramiv(ctx, program, pname);
 }
 
 
@@ -19360,7 +19091,7 @@ _mesa_marshal_TexCoord1iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1iv");
    debug_print_sync_fallback("TexCoord1iv");
    CALL_TexCoord1iv(ctx->CurrentServerDispatch, (v));
 }
@@ -19401,7 +19132,7 @@ _mesa_marshal_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4s");
    debug_print_sync_fallback("RasterPos4s");
    CALL_RasterPos4s(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -19436,7 +19167,7 @@ _mesa_marshal_VertexAttrib3dv(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3dv");
    debug_print_sync_fallback("VertexAttrib3dv");
    CALL_VertexAttrib3dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -19477,7 +19208,7 @@ _mesa_marshal_Histogram(GLenum target, GLsizei width, GLenum internalformat, GLb
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Histogram");
    debug_print_sync_fallback("Histogram");
    CALL_Histogram(ctx->CurrentServerDispatch, (target, width, internalformat, sink));
 }
@@ -19524,7 +19255,7 @@ _mesa_marshal_Uniform2fv(GLint location, GLsizei count, const GLfloat * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2fv");
    debug_print_sync_fallback("Uniform2fv");
    CALL_Uniform2fv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -19577,7 +19308,7 @@ _mesa_marshal_ProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix3x4dv");
    debug_print_sync_fallback("ProgramUniformMatrix3x4dv");
    CALL_ProgramUniformMatrix3x4dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -19621,7 +19352,7 @@ _mesa_marshal_DrawBuffers(GLsizei n, const GLenum * bufs)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawBuffers");
    debug_print_sync_fallback("DrawBuffers");
    CALL_DrawBuffers(ctx->CurrentServerDispatch, (n, bufs));
 }
@@ -19656,7 +19387,7 @@ _mesa_marshal_VertexAttribL1ui64ARB(GLuint index, GLuint64EXT x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL1ui64ARB");
    debug_print_sync_fallback("VertexAttribL1ui64ARB");
    CALL_VertexAttribL1ui64ARB(ctx->CurrentServerDispatch, (index, x));
 }
@@ -19667,7 +19398,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnPolygonStippleARB(GLsizei bufSize, GLubyte * pattern)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnPolygonStippleARB");
    debug_print_sync("GetnPolygonStippleARB");
    CALL_GetnPolygonStippleARB(ctx->CurrentServerDispatch, (bufSize, pattern));
 }
@@ -19699,7 +19430,7 @@ _mesa_marshal_Color3uiv(const GLuint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3uiv");
    debug_print_sync_fallback("Color3uiv");
    CALL_Color3uiv(ctx->CurrentServerDispatch, (v));
 }
@@ -19731,7 +19462,7 @@ _mesa_marshal_EvalCoord2fv(const GLfloat * u)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord2fv");
    debug_print_sync_fallback("EvalCoord2fv");
    CALL_EvalCoord2fv(ctx->CurrentServerDispatch, (u));
 }
@@ -19781,7 +19512,7 @@ _mesa_marshal_TextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage3DEXT");
    debug_print_sync_fallback("TextureStorage3DEXT");
    CALL_TextureStorage3DEXT(ctx->CurrentServerDispatch, (texture, target, levels, internalFormat, width, height, depth));
 }
@@ -19819,7 +19550,7 @@ _mesa_marshal_VertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2fARB");
    debug_print_sync_fallback("VertexAttrib2fARB");
    CALL_VertexAttrib2fARB(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -19830,7 +19561,7 @@ static void GLAPIENTRY
 _mesa_marshal_SpecializeShaderARB(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SpecializeShaderARB");
    debug_print_sync("SpecializeShaderARB");
    CALL_SpecializeShaderARB(ctx->CurrentServerDispatch, (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue));
 }
@@ -19862,7 +19593,7 @@ _mesa_marshal_BeginPerfMonitorAMD(GLuint monitor)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginPerfMonitorAMD");
    debug_print_sync_fallback("BeginPerfMonitorAMD");
    CALL_BeginPerfMonitorAMD(ctx->CurrentServerDispatch, (monitor));
 }
@@ -19873,7 +19604,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos2fv(const GLfloat * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2fv");
    debug_print_sync("WindowPos2fv");
    CALL_WindowPos2fv(ctx->CurrentServerDispatch, (v));
 }
@@ -19884,7 +19615,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexImage3D");
    debug_print_sync("TexImage3D");
    CALL_TexImage3D(ctx->CurrentServerDispatch, (target, level, internalformat, width, height, depth, border, format, type, pixels));
 }
@@ -19895,7 +19626,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfQueryIdByNameINTEL(GLchar * queryName, GLuint * queryId)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfQueryIdByNameINTEL");
    debug_print_sync("GetPerfQueryIdByNameINTEL");
    CALL_GetPerfQueryIdByNameINTEL(ctx->CurrentServerDispatch, (queryName, queryId));
 }
@@ -19906,7 +19637,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindFragDataLocation(GLuint program, GLuint colorNumber, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindFragDataLocation");
    debug_print_sync("BindFragDataLocation");
    CALL_BindFragDataLocation(ctx->CurrentServerDispatch, (program, colorNumber, name));
 }
@@ -19917,7 +19648,7 @@ static void GLAPIENTRY
 _mesa_marshal_LightModeliv(GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LightModeliv");
    debug_print_sync("LightModeliv");
    CALL_LightModeliv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -19949,7 +19680,7 @@ _mesa_marshal_Normal3bv(const GLbyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3bv");
    debug_print_sync_fallback("Normal3bv");
    CALL_Normal3bv(ctx->CurrentServerDispatch, (v));
 }
@@ -19987,7 +19718,7 @@ _mesa_marshal_BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginQueryIndexed");
    debug_print_sync_fallback("BeginQueryIndexed");
    CALL_BeginQueryIndexed(ctx->CurrentServerDispatch, (target, index, id));
 }
@@ -19998,7 +19729,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearNamedBufferData");
    debug_print_sync("ClearNamedBufferData");
    CALL_ClearNamedBufferData(ctx->CurrentServerDispatch, (buffer, internalformat, format, type, data));
 }
@@ -20030,7 +19761,7 @@ _mesa_marshal_Vertex3iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3iv");
    debug_print_sync_fallback("Vertex3iv");
    CALL_Vertex3iv(ctx->CurrentServerDispatch, (v));
 }
@@ -20080,7 +19811,7 @@ _mesa_marshal_UniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix2x3dv");
    debug_print_sync_fallback("UniformMatrix2x3dv");
    CALL_UniformMatrix2x3dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -20091,7 +19822,7 @@ static void GLAPIENTRY
 _mesa_marshal_UniformHandleui64vARB(GLint location, GLsizei count, const GLuint64 * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformHandleui64vARB");
    debug_print_sync("UniformHandleui64vARB");
    CALL_UniformHandleui64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -20123,7 +19854,7 @@ _mesa_marshal_TexCoord3dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3dv");
    debug_print_sync_fallback("TexCoord3dv");
    CALL_TexCoord3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -20134,7 +19865,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramStringARB(GLenum target, GLenum pname, GLvoid * string)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramStringARB");
    debug_print_sync("GetProgramStringARB");
    CALL_GetProgramStringARB(ctx->CurrentServerDispatch, (target, pname, string));
 }
@@ -20169,7 +19900,7 @@ _mesa_marshal_VertexP3ui(GLenum type, GLuint value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexP3ui");
    debug_print_sync_fallback("VertexP3ui");
    CALL_VertexP3ui(ctx->CurrentServerDispatch, (type, value));
 }
@@ -20180,7 +19911,7 @@ static GLhandleARB GLAPIENTRY
 _mesa_marshal_CreateProgramObjectARB(void)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateProgramObjectARB");
    debug_print_sync("CreateProgramObjectARB");
    return CALL_CreateProgramObjectARB(ctx->CurrentServerDispatch, ());
 }
@@ -20230,7 +19961,7 @@ _mesa_marshal_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpos
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix3fv");
    debug_print_sync_fallback("UniformMatrix3fv");
    CALL_UniformMatrix3fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -20280,7 +20011,7 @@ _mesa_marshal_PrioritizeTextures(GLsizei n, const GLuint * textures, const GLcla
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PrioritizeTextures");
    debug_print_sync_fallback("PrioritizeTextures");
    CALL_PrioritizeTextures(ctx->CurrentServerDispatch, (n, textures, priorities));
 }
@@ -20321,7 +20052,7 @@ _mesa_marshal_VertexAttribI3uiEXT(GLuint index, GLuint x, GLuint y, GLuint z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI3uiEXT");
    debug_print_sync_fallback("VertexAttribI3uiEXT");
    CALL_VertexAttribI3uiEXT(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -20359,7 +20090,7 @@ _mesa_marshal_ProgramUniform1i64ARB(GLuint program, GLint location, GLint64 x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1i64ARB");
    debug_print_sync_fallback("ProgramUniform1i64ARB");
    CALL_ProgramUniform1i64ARB(ctx->CurrentServerDispatch, (program, location, x));
 }
@@ -20370,7 +20101,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMaterialxv(GLenum face, GLenum pname, GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMaterialxv");
    debug_print_sync("GetMaterialxv");
    CALL_GetMaterialxv(ctx->CurrentServerDispatch, (face, pname, params));
 }
@@ -20402,7 +20133,7 @@ _mesa_marshal_SecondaryColor3uiv(const GLuint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3uiv");
    debug_print_sync_fallback("SecondaryColor3uiv");
    CALL_SecondaryColor3uiv(ctx->CurrentServerDispatch, (v));
 }
@@ -20433,7 +20164,7 @@ _mesa_marshal_EndConditionalRender(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndConditionalRender");
    debug_print_sync_fallback("EndConditionalRender");
    CALL_EndConditionalRender(ctx->CurrentServerDispatch, ());
 }
@@ -20480,7 +20211,7 @@ _mesa_marshal_ProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramLocalParameter4dARB");
    debug_print_sync_fallback("ProgramLocalParameter4dARB");
    CALL_ProgramLocalParameter4dARB(ctx->CurrentServerDispatch, (target, index, x, y, z, w));
 }
@@ -20512,7 +20243,7 @@ _mesa_marshal_Color3sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3sv");
    debug_print_sync_fallback("Color3sv");
    CALL_Color3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -20523,7 +20254,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_GenFragmentShadersATI(GLuint range)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenFragmentShadersATI");
    debug_print_sync("GenFragmentShadersATI");
    return CALL_GenFragmentShadersATI(ctx->CurrentServerDispatch, (range));
 }
@@ -20534,7 +20265,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedBufferParameteriv");
    debug_print_sync("GetNamedBufferParameteriv");
    CALL_GetNamedBufferParameteriv(ctx->CurrentServerDispatch, (buffer, pname, params));
 }
@@ -20572,7 +20303,7 @@ _mesa_marshal_BlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeA
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendEquationSeparateiARB");
    debug_print_sync_fallback("BlendEquationSeparateiARB");
    CALL_BlendEquationSeparateiARB(ctx->CurrentServerDispatch, (buf, modeRGB, modeA));
 }
@@ -20607,7 +20338,7 @@ _mesa_marshal_MultiTexCoord1fvARB(GLenum target, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1fvARB");
    debug_print_sync_fallback("MultiTexCoord1fvARB");
    CALL_MultiTexCoord1fvARB(ctx->CurrentServerDispatch, (target, v));
 }
@@ -20651,7 +20382,7 @@ _mesa_marshal_TexStorage2D(GLenum target, GLsizei levels, GLenum internalFormat,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorage2D");
    debug_print_sync_fallback("TexStorage2D");
    CALL_TexStorage2D(ctx->CurrentServerDispatch, (target, levels, internalFormat, width, height));
 }
@@ -20695,7 +20426,7 @@ _mesa_marshal_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum text
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferTexture2D");
    debug_print_sync_fallback("FramebufferTexture2D");
    CALL_FramebufferTexture2D(ctx->CurrentServerDispatch, (target, attachment, textarget, texture, level));
 }
@@ -20706,7 +20437,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSamplerParameterfv");
    debug_print_sync("GetSamplerParameterfv");
    CALL_GetSamplerParameterfv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -20741,7 +20472,7 @@ _mesa_marshal_VertexAttrib2dv(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2dv");
    debug_print_sync_fallback("VertexAttrib2dv");
    CALL_VertexAttrib2dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -20773,7 +20504,7 @@ _mesa_marshal_Vertex4sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex4sv");
    debug_print_sync_fallback("Vertex4sv");
    CALL_Vertex4sv(ctx->CurrentServerDispatch, (v));
 }
@@ -20784,7 +20515,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryObjecti64v");
    debug_print_sync("GetQueryObjecti64v");
    CALL_GetQueryObjecti64v(ctx->CurrentServerDispatch, (id, pname, params));
 }
@@ -20819,7 +20550,7 @@ _mesa_marshal_ClampColor(GLenum target, GLenum clamp)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClampColor");
    debug_print_sync_fallback("ClampColor");
    CALL_ClampColor(ctx->CurrentServerDispatch, (target, clamp));
 }
@@ -20854,7 +20585,7 @@ _mesa_marshal_Uniform1i64ARB(GLint location, GLint64 x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1i64ARB");
    debug_print_sync_fallback("Uniform1i64ARB");
    CALL_Uniform1i64ARB(ctx->CurrentServerDispatch, (location, x));
 }
@@ -20865,7 +20596,7 @@ static void GLAPIENTRY
 _mesa_marshal_DepthRangeArrayfvOES(GLuint first, GLsizei count, const GLfloat * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRangeArrayfvOES");
    debug_print_sync("DepthRangeArrayfvOES");
    CALL_DepthRangeArrayfvOES(ctx->CurrentServerDispatch, (first, count, v));
 }
@@ -20876,7 +20607,7 @@ static void GLAPIENTRY
 _mesa_marshal_ConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ConvolutionFilter1D");
    debug_print_sync("ConvolutionFilter1D");
    CALL_ConvolutionFilter1D(ctx->CurrentServerDispatch, (target, internalformat, width, format, type, image));
 }
@@ -20887,7 +20618,7 @@ static void GLAPIENTRY
 _mesa_marshal_DrawElementsIndirect(GLenum mode, GLenum type, const GLvoid * indirect)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawElementsIndirect");
    debug_print_sync("DrawElementsIndirect");
    CALL_DrawElementsIndirect(ctx->CurrentServerDispatch, (mode, type, indirect));
 }
@@ -20898,7 +20629,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos3sv(const GLshort * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3sv");
    debug_print_sync("WindowPos3sv");
    CALL_WindowPos3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -20909,9 +20640,10 @@ static void GLAPIENTRY
 _mesa_marshal_CallLists(GLsizei n, GLenum type, const GLvoid * lists)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CallLists");
    debug_print_sync("CallLists");
    CALL_CallLists(ctx->CurrentServerDispatch, (n, type, lists));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -20944,7 +20676,7 @@ _mesa_marshal_AlphaFunc(GLenum func, GLclampf ref)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AlphaFunc");
    debug_print_sync_fallback("AlphaFunc");
    CALL_AlphaFunc(ctx->CurrentServerDispatch, (func, ref));
 }
@@ -20955,7 +20687,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureParameterfv(GLuint texture, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureParameterfv");
    debug_print_sync("GetTextureParameterfv");
    CALL_GetTextureParameterfv(ctx->CurrentServerDispatch, (texture, pname, params));
 }
@@ -20987,7 +20719,7 @@ _mesa_marshal_EdgeFlag(GLboolean flag)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EdgeFlag");
    debug_print_sync_fallback("EdgeFlag");
    CALL_EdgeFlag(ctx->CurrentServerDispatch, (flag));
 }
@@ -21019,7 +20751,7 @@ _mesa_marshal_EdgeFlagv(const GLboolean * flag)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EdgeFlagv");
    debug_print_sync_fallback("EdgeFlagv");
    CALL_EdgeFlagv(ctx->CurrentServerDispatch, (flag));
 }
@@ -21054,7 +20786,7 @@ _mesa_marshal_DepthRangex(GLclampx zNear, GLclampx zFar)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRangex");
    debug_print_sync_fallback("DepthRangex");
    CALL_DepthRangex(ctx->CurrentServerDispatch, (zNear, zFar));
 }
@@ -21065,7 +20797,7 @@ static void GLAPIENTRY
 _mesa_marshal_ProgramUniformHandleui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformHandleui64vARB");
    debug_print_sync("ProgramUniformHandleui64vARB");
    CALL_ProgramUniformHandleui64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -21076,7 +20808,7 @@ static void GLAPIENTRY
 _mesa_marshal_VDPAUInitNV(const GLvoid * vdpDevice, const GLvoid * getProcAddress)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUInitNV");
    debug_print_sync("VDPAUInitNV");
    CALL_VDPAUInitNV(ctx->CurrentServerDispatch, (vdpDevice, getProcAddress));
 }
@@ -21087,7 +20819,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetBufferParameteri64v");
    debug_print_sync("GetBufferParameteri64v");
    CALL_GetBufferParameteri64v(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -21098,7 +20830,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_CreateProgram(void)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateProgram");
    debug_print_sync("CreateProgram");
    return CALL_CreateProgram(ctx->CurrentServerDispatch, ());
 }
@@ -21133,7 +20865,7 @@ _mesa_marshal_DepthRangef(GLclampf zNear, GLclampf zFar)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRangef");
    debug_print_sync_fallback("DepthRangef");
    CALL_DepthRangef(ctx->CurrentServerDispatch, (zNear, zFar));
 }
@@ -21144,7 +20876,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureParameteriv(GLuint texture, GLenum pname, const GLint * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureParameteriv");
    debug_print_sync("TextureParameteriv");
    CALL_TextureParameteriv(ctx->CurrentServerDispatch, (texture, pname, param));
 }
@@ -21212,7 +20944,7 @@ _mesa_marshal_ColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorFragmentOp3ATI");
    debug_print_sync_fallback("ColorFragmentOp3ATI");
    CALL_ColorFragmentOp3ATI(ctx->CurrentServerDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
 }
@@ -21244,7 +20976,7 @@ _mesa_marshal_ValidateProgram(GLuint program)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ValidateProgram");
    debug_print_sync_fallback("ValidateProgram");
    CALL_ValidateProgram(ctx->CurrentServerDispatch, (program));
 }
@@ -21277,13 +21009,6 @@ _mesa_marshal_VertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei
    size_t cmd_size = sizeof(struct marshal_cmd_VertexPointerEXT);
    struct marshal_cmd_VertexPointerEXT *cmd;
    debug_print_marshal("VertexPointerEXT");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("VertexPointerEXT");
-      CALL_VertexPointerEXT(ctx->CurrentServerDispatch, (size, type, stride, count, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexPointerEXT, cmd_size);
       cmd->size = size;
@@ -21291,13 +21016,15 @@ _mesa_marshal_VertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei
       cmd->stride = stride;
       cmd->count = count;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_POS, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexPointerEXT");
    debug_print_sync_fallback("VertexPointerEXT");
    CALL_VertexPointerEXT(ctx->CurrentServerDispatch, (size, type, stride, count, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_POS, size, type, stride, pointer);
 }
 
 
@@ -21306,7 +21033,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI4sv(GLuint index, const GLshort * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4sv");
    debug_print_sync("VertexAttribI4sv");
    CALL_VertexAttribI4sv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -21347,7 +21074,7 @@ _mesa_marshal_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Scissor");
    debug_print_sync_fallback("Scissor");
    CALL_Scissor(ctx->CurrentServerDispatch, (x, y, width, height));
 }
@@ -21375,13 +21102,15 @@ _mesa_marshal_BeginTransformFeedback(GLenum mode)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BeginTransformFeedback, cmd_size);
       cmd->mode = mode;
+      _mesa_glthread_BeginTransformFeedback(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginTransformFeedback");
    debug_print_sync_fallback("BeginTransformFeedback");
    CALL_BeginTransformFeedback(ctx->CurrentServerDispatch, (mode));
+   _mesa_glthread_BeginTransformFeedback(ctx);
 }
 
 
@@ -21414,7 +21143,7 @@ _mesa_marshal_TexCoord2i(GLint s, GLint t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2i");
    debug_print_sync_fallback("TexCoord2i");
    CALL_TexCoord2i(ctx->CurrentServerDispatch, (s, t));
 }
@@ -21452,7 +21181,7 @@ _mesa_marshal_VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayAttribBinding");
    debug_print_sync_fallback("VertexArrayAttribBinding");
    CALL_VertexArrayAttribBinding(ctx->CurrentServerDispatch, (vaobj, attribindex, bindingindex));
 }
@@ -21493,7 +21222,7 @@ _mesa_marshal_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4ui");
    debug_print_sync_fallback("Color4ui");
    CALL_Color4ui(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -21528,7 +21257,7 @@ _mesa_marshal_TexCoord2f(GLfloat s, GLfloat t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2f");
    debug_print_sync_fallback("TexCoord2f");
    CALL_TexCoord2f(ctx->CurrentServerDispatch, (s, t));
 }
@@ -21563,7 +21292,7 @@ _mesa_marshal_TexCoord2d(GLdouble s, GLdouble t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2d");
    debug_print_sync_fallback("TexCoord2d");
    CALL_TexCoord2d(ctx->CurrentServerDispatch, (s, t));
 }
@@ -21574,7 +21303,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTransformFeedbackiv");
    debug_print_sync("GetTransformFeedbackiv");
    CALL_GetTransformFeedbackiv(ctx->CurrentServerDispatch, (xfb, pname, param));
 }
@@ -21609,7 +21338,7 @@ _mesa_marshal_TexCoord2s(GLshort s, GLshort t)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2s");
    debug_print_sync_fallback("TexCoord2s");
    CALL_TexCoord2s(ctx->CurrentServerDispatch, (s, t));
 }
@@ -21620,9 +21349,10 @@ static void GLAPIENTRY
 _mesa_marshal_PointSizePointerOES(GLenum type, GLsizei stride, const GLvoid * pointer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointSizePointerOES");
    debug_print_sync("PointSizePointerOES");
    CALL_PointSizePointerOES(ctx->CurrentServerDispatch, (type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_POINT_SIZE, 1, type, stride, pointer);
 }
 
 
@@ -21661,7 +21391,7 @@ _mesa_marshal_Color4us(GLushort red, GLushort green, GLushort blue, GLushort alp
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4us");
    debug_print_sync_fallback("Color4us");
    CALL_Color4us(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -21693,7 +21423,7 @@ _mesa_marshal_Color3bv(const GLbyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3bv");
    debug_print_sync_fallback("Color3bv");
    CALL_Color3bv(ctx->CurrentServerDispatch, (v));
 }
@@ -21724,7 +21454,7 @@ _mesa_marshal_PrimitiveRestartNV(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PrimitiveRestartNV");
    debug_print_sync_fallback("PrimitiveRestartNV");
    CALL_PrimitiveRestartNV(ctx->CurrentServerDispatch, ());
 }
@@ -21765,7 +21495,7 @@ _mesa_marshal_BindBufferOffsetEXT(GLenum target, GLuint index, GLuint buffer, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindBufferOffsetEXT");
    debug_print_sync_fallback("BindBufferOffsetEXT");
    CALL_BindBufferOffsetEXT(ctx->CurrentServerDispatch, (target, index, buffer, offset));
 }
@@ -21797,7 +21527,7 @@ _mesa_marshal_ProvokingVertex(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProvokingVertex");
    debug_print_sync_fallback("ProvokingVertex");
    CALL_ProvokingVertex(ctx->CurrentServerDispatch, (mode));
 }
@@ -21844,7 +21574,7 @@ _mesa_marshal_VertexAttribs4fvNV(GLuint index, GLsizei n, const GLfloat * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs4fvNV");
    debug_print_sync_fallback("VertexAttribs4fvNV");
    CALL_VertexAttribs4fvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -21879,7 +21609,7 @@ _mesa_marshal_Vertex2i(GLint x, GLint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2i");
    debug_print_sync_fallback("Vertex2i");
    CALL_Vertex2i(ctx->CurrentServerDispatch, (x, y));
 }
@@ -21920,7 +21650,7 @@ _mesa_marshal_GetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryBufferObjecti64v");
    debug_print_sync_fallback("GetQueryBufferObjecti64v");
    CALL_GetQueryBufferObjecti64v(ctx->CurrentServerDispatch, (id, buffer, pname, offset));
 }
@@ -21931,9 +21661,10 @@ static void GLAPIENTRY
 _mesa_marshal_InterleavedArrays(GLenum format, GLsizei stride, const GLvoid * pointer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InterleavedArrays");
    debug_print_sync("InterleavedArrays");
    CALL_InterleavedArrays(ctx->CurrentServerDispatch, (format, stride, pointer));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -21963,7 +21694,7 @@ _mesa_marshal_RasterPos2fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2fv");
    debug_print_sync_fallback("RasterPos2fv");
    CALL_RasterPos2fv(ctx->CurrentServerDispatch, (v));
 }
@@ -21995,7 +21726,7 @@ _mesa_marshal_TexCoord1fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1fv");
    debug_print_sync_fallback("TexCoord1fv");
    CALL_TexCoord1fv(ctx->CurrentServerDispatch, (v));
 }
@@ -22030,7 +21761,7 @@ _mesa_marshal_MultiTexCoord4dv(GLenum target, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4dv");
    debug_print_sync_fallback("MultiTexCoord4dv");
    CALL_MultiTexCoord4dv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -22068,7 +21799,7 @@ _mesa_marshal_ProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLflo
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramEnvParameter4fvARB");
    debug_print_sync_fallback("ProgramEnvParameter4fvARB");
    CALL_ProgramEnvParameter4fvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -22100,7 +21831,7 @@ _mesa_marshal_RasterPos4fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4fv");
    debug_print_sync_fallback("RasterPos4fv");
    CALL_RasterPos4fv(ctx->CurrentServerDispatch, (v));
 }
@@ -22131,7 +21862,7 @@ _mesa_marshal_PushMatrix(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PushMatrix");
    debug_print_sync_fallback("PushMatrix");
    CALL_PushMatrix(ctx->CurrentServerDispatch, ());
 }
@@ -22162,72 +21893,18 @@ _mesa_marshal_EndList(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndList");
    debug_print_sync_fallback("EndList");
    CALL_EndList(ctx->CurrentServerDispatch, ());
 }
 
 
-/* DrawRangeElements: marshalled asynchronously */
-struct marshal_cmd_DrawRangeElements
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLuint start;
-   GLuint end;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-};
-static inline void
-_mesa_unmarshal_DrawRangeElements(struct gl_context *ctx, const struct marshal_cmd_DrawRangeElements *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLuint start = cmd->start;
-   const GLuint end = cmd->end;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   CALL_DrawRangeElements(ctx->CurrentServerDispatch, (mode, start, end, count, type, indices));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawRangeElements);
-   struct marshal_cmd_DrawRangeElements *cmd;
-   debug_print_marshal("DrawRangeElements");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawRangeElements");
-      CALL_DrawRangeElements(ctx->CurrentServerDispatch, (mode, start, end, count, type, indices));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawRangeElements, cmd_size);
-      cmd->mode = mode;
-      cmd->start = start;
-      cmd->end = end;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawRangeElements");
-   CALL_DrawRangeElements(ctx->CurrentServerDispatch, (mode, start, end, count, type, indices));
-}
-
-
 /* GetTexGenxvOES: marshalled synchronously */
 static void GLAPIENTRY
 _mesa_marshal_GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexGenxvOES");
    debug_print_sync("GetTexGenxvOES");
    CALL_GetTexGenxvOES(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -22238,7 +21915,7 @@ static GLhandleARB GLAPIENTRY
 _mesa_marshal_GetHandleARB(GLenum pname)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetHandleARB");
    debug_print_sync("GetHandleARB");
    return CALL_GetHandleARB(ctx->CurrentServerDispatch, (pname));
 }
@@ -22270,7 +21947,7 @@ _mesa_marshal_DrawTexfvOES(const GLfloat * coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexfvOES");
    debug_print_sync_fallback("DrawTexfvOES");
    CALL_DrawTexfvOES(ctx->CurrentServerDispatch, (coords));
 }
@@ -22308,7 +21985,7 @@ _mesa_marshal_BlendFunciARB(GLuint buf, GLenum src, GLenum dst)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendFunciARB");
    debug_print_sync_fallback("BlendFunciARB");
    CALL_BlendFunciARB(ctx->CurrentServerDispatch, (buf, src, dst));
 }
@@ -22352,7 +22029,7 @@ _mesa_marshal_ClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint d
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearNamedFramebufferfi");
    debug_print_sync_fallback("ClearNamedFramebufferfi");
    CALL_ClearNamedFramebufferfi(ctx->CurrentServerDispatch, (framebuffer, buffer, drawbuffer, depth, stencil));
 }
@@ -22363,7 +22040,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearNamedFramebufferfv");
    debug_print_sync("ClearNamedFramebufferfv");
    CALL_ClearNamedFramebufferfv(ctx->CurrentServerDispatch, (framebuffer, buffer, drawbuffer, value));
 }
@@ -22401,7 +22078,7 @@ _mesa_marshal_Uniform2ui(GLint location, GLuint x, GLuint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2ui");
    debug_print_sync_fallback("Uniform2ui");
    CALL_Uniform2ui(ctx->CurrentServerDispatch, (location, x, y));
 }
@@ -22445,7 +22122,7 @@ _mesa_marshal_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei wid
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ScissorIndexed");
    debug_print_sync_fallback("ScissorIndexed");
    CALL_ScissorIndexed(ctx->CurrentServerDispatch, (index, left, bottom, width, height));
 }
@@ -22476,7 +22153,7 @@ _mesa_marshal_End(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "End");
    debug_print_sync_fallback("End");
    CALL_End(ctx->CurrentServerDispatch, ());
 }
@@ -22514,7 +22191,7 @@ _mesa_marshal_NamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferParameteri");
    debug_print_sync_fallback("NamedFramebufferParameteri");
    CALL_NamedFramebufferParameteri(ctx->CurrentServerDispatch, (framebuffer, pname, param));
 }
@@ -22525,9 +22202,10 @@ static void GLAPIENTRY
 _mesa_marshal_BindVertexBuffers(GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindVertexBuffers");
    debug_print_sync("BindVertexBuffers");
    CALL_BindVertexBuffers(ctx->CurrentServerDispatch, (first, count, buffers, offsets, strides));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -22536,7 +22214,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSamplerParameteriv");
    debug_print_sync("GetSamplerParameteriv");
    CALL_GetSamplerParameteriv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -22547,7 +22225,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenProgramPipelines(GLsizei n, GLuint * pipelines)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenProgramPipelines");
    debug_print_sync("GenProgramPipelines");
    CALL_GenProgramPipelines(ctx->CurrentServerDispatch, (n, pipelines));
 }
@@ -22558,7 +22236,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsProgramPipeline(GLuint pipeline)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsProgramPipeline");
    debug_print_sync("IsProgramPipeline");
    return CALL_IsProgramPipeline(ctx->CurrentServerDispatch, (pipeline));
 }
@@ -22569,7 +22247,7 @@ static void GLAPIENTRY
 _mesa_marshal_ShaderBinary(GLsizei n, const GLuint * shaders, GLenum binaryformat, const GLvoid * binary, GLsizei length)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ShaderBinary");
    debug_print_sync("ShaderBinary");
    CALL_ShaderBinary(ctx->CurrentServerDispatch, (n, shaders, binaryformat, binary, length));
 }
@@ -22580,7 +22258,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureSubImage1D");
    debug_print_sync("TextureSubImage1D");
    CALL_TextureSubImage1D(ctx->CurrentServerDispatch, (texture, level, xoffset, width, format, type, pixels));
 }
@@ -22618,7 +22296,7 @@ _mesa_marshal_Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3x");
    debug_print_sync_fallback("Normal3x");
    CALL_Normal3x(ctx->CurrentServerDispatch, (nx, ny, nz));
 }
@@ -22662,7 +22340,7 @@ _mesa_marshal_VertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4fARB");
    debug_print_sync_fallback("VertexAttrib4fARB");
    CALL_VertexAttrib4fARB(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -22694,7 +22372,7 @@ _mesa_marshal_TexCoord4fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4fv");
    debug_print_sync_fallback("TexCoord4fv");
    CALL_TexCoord4fv(ctx->CurrentServerDispatch, (v));
 }
@@ -22705,7 +22383,7 @@ static void GLAPIENTRY
 _mesa_marshal_ReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ReadnPixelsARB");
    debug_print_sync("ReadnPixelsARB");
    CALL_ReadnPixelsARB(ctx->CurrentServerDispatch, (x, y, width, height, format, type, bufSize, data));
 }
@@ -22758,7 +22436,7 @@ _mesa_marshal_InvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateTexSubImage");
    debug_print_sync_fallback("InvalidateTexSubImage");
    CALL_InvalidateTexSubImage(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, width, height, depth));
 }
@@ -22796,7 +22474,7 @@ _mesa_marshal_Normal3s(GLshort nx, GLshort ny, GLshort nz)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3s");
    debug_print_sync_fallback("Normal3s");
    CALL_Normal3s(ctx->CurrentServerDispatch, (nx, ny, nz));
 }
@@ -22807,7 +22485,7 @@ static void GLAPIENTRY
 _mesa_marshal_Materialxv(GLenum face, GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Materialxv");
    debug_print_sync("Materialxv");
    CALL_Materialxv(ctx->CurrentServerDispatch, (face, pname, params));
 }
@@ -22845,7 +22523,7 @@ _mesa_marshal_Normal3i(GLint nx, GLint ny, GLint nz)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3i");
    debug_print_sync_fallback("Normal3i");
    CALL_Normal3i(ctx->CurrentServerDispatch, (nx, ny, nz));
 }
@@ -22883,7 +22561,7 @@ _mesa_marshal_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3b");
    debug_print_sync_fallback("Normal3b");
    CALL_Normal3b(ctx->CurrentServerDispatch, (nx, ny, nz));
 }
@@ -22921,7 +22599,7 @@ _mesa_marshal_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3d");
    debug_print_sync_fallback("Normal3d");
    CALL_Normal3d(ctx->CurrentServerDispatch, (nx, ny, nz));
 }
@@ -22959,7 +22637,7 @@ _mesa_marshal_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3f");
    debug_print_sync_fallback("Normal3f");
    CALL_Normal3f(ctx->CurrentServerDispatch, (nx, ny, nz));
 }
@@ -22991,7 +22669,7 @@ _mesa_marshal_Indexi(GLint c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexi");
    debug_print_sync_fallback("Indexi");
    CALL_Indexi(ctx->CurrentServerDispatch, (c));
 }
@@ -23038,7 +22716,7 @@ _mesa_marshal_Uniform1uiv(GLint location, GLsizei count, const GLuint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1uiv");
    debug_print_sync_fallback("Uniform1uiv");
    CALL_Uniform1uiv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -23076,7 +22754,7 @@ _mesa_marshal_VertexAttribI2uiEXT(GLuint index, GLuint x, GLuint y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI2uiEXT");
    debug_print_sync_fallback("VertexAttribI2uiEXT");
    CALL_VertexAttribI2uiEXT(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -23087,7 +22765,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsRenderbuffer(GLuint renderbuffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsRenderbuffer");
    debug_print_sync("IsRenderbuffer");
    return CALL_IsRenderbuffer(ctx->CurrentServerDispatch, (renderbuffer));
 }
@@ -23098,7 +22776,7 @@ static void GLAPIENTRY
 _mesa_marshal_NormalP3uiv(GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NormalP3uiv");
    debug_print_sync("NormalP3uiv");
    CALL_NormalP3uiv(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -23130,7 +22808,7 @@ _mesa_marshal_Indexf(GLfloat c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexf");
    debug_print_sync_fallback("Indexf");
    CALL_Indexf(ctx->CurrentServerDispatch, (c));
 }
@@ -23162,7 +22840,7 @@ _mesa_marshal_Indexd(GLdouble c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexd");
    debug_print_sync_fallback("Indexd");
    CALL_Indexd(ctx->CurrentServerDispatch, (c));
 }
@@ -23173,7 +22851,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMaterialiv(GLenum face, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMaterialiv");
    debug_print_sync("GetMaterialiv");
    CALL_GetMaterialiv(ctx->CurrentServerDispatch, (face, pname, params));
 }
@@ -23205,7 +22883,7 @@ _mesa_marshal_Indexs(GLshort c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexs");
    debug_print_sync_fallback("Indexs");
    CALL_Indexs(ctx->CurrentServerDispatch, (c));
 }
@@ -23216,7 +22894,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP1uiv");
    debug_print_sync("MultiTexCoordP1uiv");
    CALL_MultiTexCoordP1uiv(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -23227,7 +22905,7 @@ static void GLAPIENTRY
 _mesa_marshal_ConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ConvolutionFilter2D");
    debug_print_sync("ConvolutionFilter2D");
    CALL_ConvolutionFilter2D(ctx->CurrentServerDispatch, (target, internalformat, width, height, format, type, image));
 }
@@ -23262,7 +22940,7 @@ _mesa_marshal_Vertex2d(GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2d");
    debug_print_sync_fallback("Vertex2d");
    CALL_Vertex2d(ctx->CurrentServerDispatch, (x, y));
 }
@@ -23297,7 +22975,7 @@ _mesa_marshal_Vertex2f(GLfloat x, GLfloat y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2f");
    debug_print_sync_fallback("Vertex2f");
    CALL_Vertex2f(ctx->CurrentServerDispatch, (x, y));
 }
@@ -23329,7 +23007,7 @@ _mesa_marshal_Color4bv(const GLbyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4bv");
    debug_print_sync_fallback("Color4bv");
    CALL_Color4bv(ctx->CurrentServerDispatch, (v));
 }
@@ -23382,7 +23060,7 @@ _mesa_marshal_ProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix3x2dv");
    debug_print_sync_fallback("ProgramUniformMatrix3x2dv");
    CALL_ProgramUniformMatrix3x2dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -23417,7 +23095,7 @@ _mesa_marshal_VertexAttrib2fvNV(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2fvNV");
    debug_print_sync_fallback("VertexAttrib2fvNV");
    CALL_VertexAttrib2fvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -23452,7 +23130,7 @@ _mesa_marshal_Vertex2s(GLshort x, GLshort y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2s");
    debug_print_sync_fallback("Vertex2s");
    CALL_Vertex2s(ctx->CurrentServerDispatch, (x, y));
 }
@@ -23480,13 +23158,15 @@ _mesa_marshal_ActiveTexture(GLenum texture)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ActiveTexture, cmd_size);
       cmd->texture = texture;
+      _mesa_glthread_ActiveTexture(ctx, texture);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ActiveTexture");
    debug_print_sync_fallback("ActiveTexture");
    CALL_ActiveTexture(ctx->CurrentServerDispatch, (texture));
+   _mesa_glthread_ActiveTexture(ctx, texture);
 }
 
 
@@ -23495,7 +23175,7 @@ static void GLAPIENTRY
 _mesa_marshal_InvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateNamedFramebufferSubData");
    debug_print_sync("InvalidateNamedFramebufferSubData");
    CALL_InvalidateNamedFramebufferSubData(ctx->CurrentServerDispatch, (framebuffer, numAttachments, attachments, x, y, width, height));
 }
@@ -23506,7 +23186,7 @@ static void GLAPIENTRY
 _mesa_marshal_ColorP4uiv(GLenum type, const GLuint * color)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorP4uiv");
    debug_print_sync("ColorP4uiv");
    CALL_ColorP4uiv(ctx->CurrentServerDispatch, (type, color));
 }
@@ -23550,7 +23230,7 @@ _mesa_marshal_DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixe
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexxOES");
    debug_print_sync_fallback("DrawTexxOES");
    CALL_DrawTexxOES(ctx->CurrentServerDispatch, (x, y, z, width, height));
 }
@@ -23588,7 +23268,7 @@ _mesa_marshal_MultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP3ui");
    debug_print_sync_fallback("MultiTexCoordP3ui");
    CALL_MultiTexCoordP3ui(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -23599,7 +23279,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetAttribLocation(GLuint program, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetAttribLocation");
    debug_print_sync("GetAttribLocation");
    return CALL_GetAttribLocation(ctx->CurrentServerDispatch, (program, name));
 }
@@ -23631,7 +23311,7 @@ _mesa_marshal_DrawBuffer(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawBuffer");
    debug_print_sync_fallback("DrawBuffer");
    CALL_DrawBuffer(ctx->CurrentServerDispatch, (mode));
 }
@@ -23642,7 +23322,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPointerv(GLenum pname, GLvoid ** params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPointerv");
    debug_print_sync("GetPointerv");
    CALL_GetPointerv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -23677,7 +23357,7 @@ _mesa_marshal_MultiTexCoord2dv(GLenum target, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2dv");
    debug_print_sync_fallback("MultiTexCoord2dv");
    CALL_MultiTexCoord2dv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -23688,7 +23368,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsSampler(GLuint sampler)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsSampler");
    debug_print_sync("IsSampler");
    return CALL_IsSampler(ctx->CurrentServerDispatch, (sampler));
 }
@@ -23723,7 +23403,7 @@ _mesa_marshal_BlendFunc(GLenum sfactor, GLenum dfactor)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendFunc");
    debug_print_sync_fallback("BlendFunc");
    CALL_BlendFunc(ctx->CurrentServerDispatch, (sfactor, dfactor));
 }
@@ -23767,7 +23447,7 @@ _mesa_marshal_NamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei s
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedRenderbufferStorageMultisample");
    debug_print_sync_fallback("NamedRenderbufferStorageMultisample");
    CALL_NamedRenderbufferStorageMultisample(ctx->CurrentServerDispatch, (renderbuffer, samples, internalformat, width, height));
 }
@@ -23802,7 +23482,7 @@ _mesa_marshal_ColorMaterial(GLenum face, GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorMaterial");
    debug_print_sync_fallback("ColorMaterial");
    CALL_ColorMaterial(ctx->CurrentServerDispatch, (face, mode));
 }
@@ -23834,7 +23514,7 @@ _mesa_marshal_RasterPos3sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos3sv");
    debug_print_sync_fallback("RasterPos3sv");
    CALL_RasterPos3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -23869,7 +23549,7 @@ _mesa_marshal_TexCoordP2ui(GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP2ui");
    debug_print_sync_fallback("TexCoordP2ui");
    CALL_TexCoordP2ui(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -23880,7 +23560,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexParameteriv(GLenum target, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameteriv");
    debug_print_sync("TexParameteriv");
    CALL_TexParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -23891,7 +23571,7 @@ static void GLAPIENTRY
 _mesa_marshal_WaitSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint * buffers, GLuint numTextureBarriers, const GLuint * textures, const GLenum * srcLayouts)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WaitSemaphoreEXT");
    debug_print_sync("WaitSemaphoreEXT");
    CALL_WaitSemaphoreEXT(ctx->CurrentServerDispatch, (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts));
 }
@@ -23926,7 +23606,7 @@ _mesa_marshal_VertexAttrib3fvARB(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3fvARB");
    debug_print_sync_fallback("VertexAttrib3fvARB");
    CALL_VertexAttrib3fvARB(ctx->CurrentServerDispatch, (index, v));
 }
@@ -23979,7 +23659,7 @@ _mesa_marshal_ProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix3x4fv");
    debug_print_sync_fallback("ProgramUniformMatrix3x4fv");
    CALL_ProgramUniformMatrix3x4fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -23990,7 +23670,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetColorTable(GLenum target, GLenum format, GLenum type, GLvoid * table)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetColorTable");
    debug_print_sync("GetColorTable");
    CALL_GetColorTable(ctx->CurrentServerDispatch, (target, format, type, table));
 }
@@ -24028,7 +23708,7 @@ _mesa_marshal_TexCoord3i(GLint s, GLint t, GLint r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3i");
    debug_print_sync_fallback("TexCoord3i");
    CALL_TexCoord3i(ctx->CurrentServerDispatch, (s, t, r));
 }
@@ -24072,7 +23752,7 @@ _mesa_marshal_CopyColorTable(GLenum target, GLenum internalformat, GLint x, GLin
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyColorTable");
    debug_print_sync_fallback("CopyColorTable");
    CALL_CopyColorTable(ctx->CurrentServerDispatch, (target, internalformat, x, y, width));
 }
@@ -24119,7 +23799,7 @@ _mesa_marshal_Frustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble t
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Frustum");
    debug_print_sync_fallback("Frustum");
    CALL_Frustum(ctx->CurrentServerDispatch, (left, right, bottom, top, zNear, zFar));
 }
@@ -24157,7 +23837,7 @@ _mesa_marshal_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3d");
    debug_print_sync_fallback("TexCoord3d");
    CALL_TexCoord3d(ctx->CurrentServerDispatch, (s, t, r));
 }
@@ -24168,7 +23848,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureParameteriv(GLuint texture, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureParameteriv");
    debug_print_sync("GetTextureParameteriv");
    CALL_GetTextureParameteriv(ctx->CurrentServerDispatch, (texture, pname, params));
 }
@@ -24206,7 +23886,7 @@ _mesa_marshal_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3f");
    debug_print_sync_fallback("TexCoord3f");
    CALL_TexCoord3f(ctx->CurrentServerDispatch, (s, t, r));
 }
@@ -24253,7 +23933,7 @@ _mesa_marshal_DepthRangeArrayv(GLuint first, GLsizei count, const GLclampd * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRangeArrayv");
    debug_print_sync_fallback("DepthRangeArrayv");
    CALL_DepthRangeArrayv(ctx->CurrentServerDispatch, (first, count, v));
 }
@@ -24292,14 +23972,16 @@ _mesa_marshal_DeleteTextures(GLsizei n, const GLuint * textures)
       char *variable_data = (char *) (cmd + 1);
       memcpy(variable_data, textures, n * 4);
       variable_data += n * 4;
+      _mesa_glthread_DeleteTextures(ctx, n, textures);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteTextures");
    debug_print_sync_fallback("DeleteTextures");
    CALL_DeleteTextures(ctx->CurrentServerDispatch, (n, textures));
+   _mesa_glthread_DeleteTextures(ctx, n, textures);
 }
 
 
@@ -24330,13 +24012,6 @@ _mesa_marshal_TexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsize
    size_t cmd_size = sizeof(struct marshal_cmd_TexCoordPointerEXT);
    struct marshal_cmd_TexCoordPointerEXT *cmd;
    debug_print_marshal("TexCoordPointerEXT");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("TexCoordPointerEXT");
-      CALL_TexCoordPointerEXT(ctx->CurrentServerDispatch, (size, type, stride, count, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_TexCoordPointerEXT, cmd_size);
       cmd->size = size;
@@ -24344,13 +24019,15 @@ _mesa_marshal_TexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsize
       cmd->stride = stride;
       cmd->count = count;
       cmd->pointer = pointer;
+      _mesa_glthread_TexCoordPointer(ctx, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordPointerEXT");
    debug_print_sync_fallback("TexCoordPointerEXT");
    CALL_TexCoordPointerEXT(ctx->CurrentServerDispatch, (size, type, stride, count, pointer));
+   _mesa_glthread_TexCoordPointer(ctx, size, type, stride, pointer);
 }
 
 
@@ -24386,7 +24063,7 @@ _mesa_marshal_TexCoord3s(GLshort s, GLshort t, GLshort r)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3s");
    debug_print_sync_fallback("TexCoord3s");
    CALL_TexCoord3s(ctx->CurrentServerDispatch, (s, t, r));
 }
@@ -24397,7 +24074,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexLevelParameteriv");
    debug_print_sync("GetTexLevelParameteriv");
    CALL_GetTexLevelParameteriv(ctx->CurrentServerDispatch, (target, level, pname, params));
 }
@@ -24408,7 +24085,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureParameterIuiv(GLuint texture, GLenum pname, const GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureParameterIuiv");
    debug_print_sync("TextureParameterIuiv");
    CALL_TextureParameterIuiv(ctx->CurrentServerDispatch, (texture, pname, params));
 }
@@ -24419,7 +24096,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenPerfMonitorsAMD(GLsizei n, GLuint * monitors)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenPerfMonitorsAMD");
    debug_print_sync("GenPerfMonitorsAMD");
    CALL_GenPerfMonitorsAMD(ctx->CurrentServerDispatch, (n, monitors));
 }
@@ -24460,7 +24137,7 @@ _mesa_marshal_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearAccum");
    debug_print_sync_fallback("ClearAccum");
    CALL_ClearAccum(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -24492,7 +24169,7 @@ _mesa_marshal_TexCoord4iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4iv");
    debug_print_sync_fallback("TexCoord4iv");
    CALL_TexCoord4iv(ctx->CurrentServerDispatch, (v));
 }
@@ -24539,7 +24216,7 @@ _mesa_marshal_TexStorage3D(GLenum target, GLsizei levels, GLenum internalFormat,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorage3D");
    debug_print_sync_fallback("TexStorage3D");
    CALL_TexStorage3D(ctx->CurrentServerDispatch, (target, levels, internalFormat, width, height, depth));
 }
@@ -24577,7 +24254,7 @@ _mesa_marshal_Uniform2i64ARB(GLint location, GLint64 x, GLint64 y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2i64ARB");
    debug_print_sync_fallback("Uniform2i64ARB");
    CALL_Uniform2i64ARB(ctx->CurrentServerDispatch, (location, x, y));
 }
@@ -24624,7 +24301,7 @@ _mesa_marshal_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum text
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferTexture3D");
    debug_print_sync_fallback("FramebufferTexture3D");
    CALL_FramebufferTexture3D(ctx->CurrentServerDispatch, (target, attachment, textarget, texture, level, layer));
 }
@@ -24635,7 +24312,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetBufferParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetBufferParameteriv");
    debug_print_sync("GetBufferParameteriv");
    CALL_GetBufferParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -24673,7 +24350,7 @@ _mesa_marshal_VertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2fNV");
    debug_print_sync_fallback("VertexAttrib2fNV");
    CALL_VertexAttrib2fNV(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -24726,7 +24403,7 @@ _mesa_marshal_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTexImage2D");
    debug_print_sync_fallback("CopyTexImage2D");
    CALL_CopyTexImage2D(ctx->CurrentServerDispatch, (target, level, internalformat, x, y, width, height, border));
 }
@@ -24758,7 +24435,7 @@ _mesa_marshal_Vertex3fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3fv");
    debug_print_sync_fallback("Vertex3fv");
    CALL_Vertex3fv(ctx->CurrentServerDispatch, (v));
 }
@@ -24769,7 +24446,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos4dvMESA(const GLdouble * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4dvMESA");
    debug_print_sync("WindowPos4dvMESA");
    CALL_WindowPos4dvMESA(ctx->CurrentServerDispatch, (v));
 }
@@ -24819,7 +24496,7 @@ _mesa_marshal_ProgramUniform2i64vARB(GLuint program, GLint location, GLsizei cou
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2i64vARB");
    debug_print_sync_fallback("ProgramUniform2i64vARB");
    CALL_ProgramUniform2i64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -24857,7 +24534,7 @@ _mesa_marshal_MultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP2ui");
    debug_print_sync_fallback("MultiTexCoordP2ui");
    CALL_MultiTexCoordP2ui(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -24904,7 +24581,7 @@ _mesa_marshal_VertexAttribs1dvNV(GLuint index, GLsizei n, const GLdouble * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs1dvNV");
    debug_print_sync_fallback("VertexAttribs1dvNV");
    CALL_VertexAttribs1dvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -24942,7 +24619,7 @@ _mesa_marshal_ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GLint fd
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ImportSemaphoreFdEXT");
    debug_print_sync_fallback("ImportSemaphoreFdEXT");
    CALL_ImportSemaphoreFdEXT(ctx->CurrentServerDispatch, (semaphore, handleType, fd));
 }
@@ -24953,7 +24630,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsQuery(GLuint id)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsQuery");
    debug_print_sync("IsQuery");
    return CALL_IsQuery(ctx->CurrentServerDispatch, (id));
 }
@@ -24982,25 +24659,20 @@ _mesa_marshal_EdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean
    size_t cmd_size = sizeof(struct marshal_cmd_EdgeFlagPointerEXT);
    struct marshal_cmd_EdgeFlagPointerEXT *cmd;
    debug_print_marshal("EdgeFlagPointerEXT");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("EdgeFlagPointerEXT");
-      CALL_EdgeFlagPointerEXT(ctx->CurrentServerDispatch, (stride, count, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_EdgeFlagPointerEXT, cmd_size);
       cmd->stride = stride;
       cmd->count = count;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_EDGEFLAG, 1, GL_UNSIGNED_BYTE, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EdgeFlagPointerEXT");
    debug_print_sync_fallback("EdgeFlagPointerEXT");
    CALL_EdgeFlagPointerEXT(ctx->CurrentServerDispatch, (stride, count, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_EDGEFLAG, 1, GL_UNSIGNED_BYTE, stride, pointer);
 }
 
 
@@ -25045,7 +24717,7 @@ _mesa_marshal_VertexAttribs2svNV(GLuint index, GLsizei n, const GLshort * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs2svNV");
    debug_print_sync_fallback("VertexAttribs2svNV");
    CALL_VertexAttribs2svNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -25056,7 +24728,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_CreateShaderProgramv(GLenum type, GLsizei count, const GLchar * const * strings)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateShaderProgramv");
    debug_print_sync("CreateShaderProgramv");
    return CALL_CreateShaderProgramv(ctx->CurrentServerDispatch, (type, count, strings));
 }
@@ -25091,7 +24763,7 @@ _mesa_marshal_BlendEquationiARB(GLuint buf, GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendEquationiARB");
    debug_print_sync_fallback("BlendEquationiARB");
    CALL_BlendEquationiARB(ctx->CurrentServerDispatch, (buf, mode));
 }
@@ -25102,7 +24774,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI4uivEXT(GLuint index, const GLuint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4uivEXT");
    debug_print_sync("VertexAttribI4uivEXT");
    CALL_VertexAttribI4uivEXT(ctx->CurrentServerDispatch, (index, v));
 }
@@ -25134,7 +24806,7 @@ _mesa_marshal_PointSizex(GLfixed size)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointSizex");
    debug_print_sync_fallback("PointSizex");
    CALL_PointSizex(ctx->CurrentServerDispatch, (size));
 }
@@ -25169,7 +24841,7 @@ _mesa_marshal_PolygonMode(GLenum face, GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PolygonMode");
    debug_print_sync_fallback("PolygonMode");
    CALL_PolygonMode(ctx->CurrentServerDispatch, (face, mode));
 }
@@ -25201,7 +24873,7 @@ _mesa_marshal_SecondaryColor3iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3iv");
    debug_print_sync_fallback("SecondaryColor3iv");
    CALL_SecondaryColor3iv(ctx->CurrentServerDispatch, (v));
 }
@@ -25236,7 +24908,7 @@ _mesa_marshal_VertexAttribI1iEXT(GLuint index, GLint x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI1iEXT");
    debug_print_sync_fallback("VertexAttribI1iEXT");
    CALL_VertexAttribI1iEXT(ctx->CurrentServerDispatch, (index, x));
 }
@@ -25271,7 +24943,7 @@ _mesa_marshal_VertexAttrib4Niv(GLuint index, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Niv");
    debug_print_sync_fallback("VertexAttrib4Niv");
    CALL_VertexAttrib4Niv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -25282,7 +24954,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnUniformdvARB(GLuint program, GLint location, GLsizei bufSize, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnUniformdvARB");
    debug_print_sync("GetnUniformdvARB");
    CALL_GetnUniformdvARB(ctx->CurrentServerDispatch, (program, location, bufSize, params));
 }
@@ -25310,13 +24982,15 @@ _mesa_marshal_LinkProgram(GLuint program)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_LinkProgram, cmd_size);
       cmd->program = program;
+      _mesa_glthread_LinkProgram(ctx, program);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LinkProgram");
    debug_print_sync_fallback("LinkProgram");
    CALL_LinkProgram(ctx->CurrentServerDispatch, (program));
+   _mesa_glthread_LinkProgram(ctx, program);
 }
 
 
@@ -25361,7 +25035,7 @@ _mesa_marshal_ProgramUniform4d(GLuint program, GLint location, GLdouble x, GLdou
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4d");
    debug_print_sync_fallback("ProgramUniform4d");
    CALL_ProgramUniform4d(ctx->CurrentServerDispatch, (program, location, x, y, z, w));
 }
@@ -25408,7 +25082,7 @@ _mesa_marshal_ProgramUniform4f(GLuint program, GLint location, GLfloat x, GLfloa
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4f");
    debug_print_sync_fallback("ProgramUniform4f");
    CALL_ProgramUniform4f(ctx->CurrentServerDispatch, (program, location, x, y, z, w));
 }
@@ -25455,7 +25129,7 @@ _mesa_marshal_ProgramUniform4i(GLuint program, GLint location, GLint x, GLint y,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4i");
    debug_print_sync_fallback("ProgramUniform4i");
    CALL_ProgramUniform4i(ctx->CurrentServerDispatch, (program, location, x, y, z, w));
 }
@@ -25466,7 +25140,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFramebufferParameteriv");
    debug_print_sync("GetFramebufferParameteriv");
    CALL_GetFramebufferParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -25477,7 +25151,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedBufferPointerv(GLuint buffer, GLenum pname, GLvoid ** params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedBufferPointerv");
    debug_print_sync("GetNamedBufferPointerv");
    CALL_GetNamedBufferPointerv(ctx->CurrentServerDispatch, (buffer, pname, params));
 }
@@ -25521,7 +25195,7 @@ _mesa_marshal_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4d");
    debug_print_sync_fallback("VertexAttrib4d");
    CALL_VertexAttrib4d(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -25571,7 +25245,7 @@ _mesa_marshal_ProgramUniform4ui64vARB(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4ui64vARB");
    debug_print_sync_fallback("ProgramUniform4ui64vARB");
    CALL_ProgramUniform4ui64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -25612,7 +25286,7 @@ _mesa_marshal_WindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4sMESA");
    debug_print_sync_fallback("WindowPos4sMESA");
    CALL_WindowPos4sMESA(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -25656,7 +25330,7 @@ _mesa_marshal_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLsh
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4s");
    debug_print_sync_fallback("VertexAttrib4s");
    CALL_VertexAttrib4s(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -25706,7 +25380,7 @@ _mesa_marshal_ProgramUniform1i64vARB(GLuint program, GLint location, GLsizei cou
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1i64vARB");
    debug_print_sync_fallback("ProgramUniform1i64vARB");
    CALL_ProgramUniform1i64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -25741,7 +25415,7 @@ _mesa_marshal_VertexAttrib1dvNV(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1dvNV");
    debug_print_sync_fallback("VertexAttrib1dvNV");
    CALL_VertexAttrib1dvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -25752,7 +25426,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, GLuint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSemaphoreParameterui64vEXT");
    debug_print_sync("GetSemaphoreParameterui64vEXT");
    CALL_GetSemaphoreParameterui64vEXT(ctx->CurrentServerDispatch, (semaphore, pname, params));
 }
@@ -25802,7 +25476,7 @@ _mesa_marshal_TexStorage3DMultisample(GLenum target, GLsizei samples, GLenum int
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorage3DMultisample");
    debug_print_sync_fallback("TexStorage3DMultisample");
    CALL_TexStorage3DMultisample(ctx->CurrentServerDispatch, (target, samples, internalformat, width, height, depth, fixedsamplelocations));
 }
@@ -25813,7 +25487,7 @@ static void GLAPIENTRY
 _mesa_marshal_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SamplerParameteriv");
    debug_print_sync("SamplerParameteriv");
    CALL_SamplerParameteriv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -25824,7 +25498,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP3uiv");
    debug_print_sync("VertexAttribP3uiv");
    CALL_VertexAttribP3uiv(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -25859,7 +25533,7 @@ _mesa_marshal_ScissorIndexedv(GLuint index, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ScissorIndexedv");
    debug_print_sync_fallback("ScissorIndexedv");
    CALL_ScissorIndexedv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -25870,7 +25544,7 @@ static const GLubyte * GLAPIENTRY
 _mesa_marshal_GetStringi(GLenum name, GLuint index)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetStringi");
    debug_print_sync("GetStringi");
    return CALL_GetStringi(ctx->CurrentServerDispatch, (name, index));
 }
@@ -25917,7 +25591,7 @@ _mesa_marshal_Uniform2dv(GLint location, GLsizei count, const GLdouble * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2dv");
    debug_print_sync_fallback("Uniform2dv");
    CALL_Uniform2dv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -25952,7 +25626,7 @@ _mesa_marshal_VertexAttrib4dv(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4dv");
    debug_print_sync_fallback("VertexAttrib4dv");
    CALL_VertexAttrib4dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -25963,7 +25637,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreateTextures(GLenum target, GLsizei n, GLuint * textures)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateTextures");
    debug_print_sync("CreateTextures");
    CALL_CreateTextures(ctx->CurrentServerDispatch, (target, n, textures));
 }
@@ -25995,7 +25669,7 @@ _mesa_marshal_EvalCoord2dv(const GLdouble * u)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord2dv");
    debug_print_sync_fallback("EvalCoord2dv");
    CALL_EvalCoord2dv(ctx->CurrentServerDispatch, (u));
 }
@@ -26030,7 +25704,7 @@ _mesa_marshal_VertexAttrib1fNV(GLuint index, GLfloat x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1fNV");
    debug_print_sync_fallback("VertexAttrib1fNV");
    CALL_VertexAttrib1fNV(ctx->CurrentServerDispatch, (index, x));
 }
@@ -26041,7 +25715,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTexSubImage1D");
    debug_print_sync("CompressedTexSubImage1D");
    CALL_CompressedTexSubImage1D(ctx->CurrentServerDispatch, (target, level, xoffset, width, format, imageSize, data));
 }
@@ -26052,7 +25726,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSeparableFilter");
    debug_print_sync("GetSeparableFilter");
    CALL_GetSeparableFilter(ctx->CurrentServerDispatch, (target, format, type, row, column, span));
 }
@@ -26063,7 +25737,7 @@ static void GLAPIENTRY
 _mesa_marshal_FeedbackBuffer(GLsizei size, GLenum type, GLfloat * buffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FeedbackBuffer");
    debug_print_sync("FeedbackBuffer");
    CALL_FeedbackBuffer(ctx->CurrentServerDispatch, (size, type, buffer));
 }
@@ -26095,7 +25769,7 @@ _mesa_marshal_RasterPos2iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos2iv");
    debug_print_sync_fallback("RasterPos2iv");
    CALL_RasterPos2iv(ctx->CurrentServerDispatch, (v));
 }
@@ -26106,7 +25780,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexImage1D");
    debug_print_sync("TexImage1D");
    CALL_TexImage1D(ctx->CurrentServerDispatch, (target, level, internalformat, width, border, format, type, pixels));
 }
@@ -26117,7 +25791,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiDrawElementsEXT(GLenum mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawElementsEXT");
    debug_print_sync("MultiDrawElementsEXT");
    CALL_MultiDrawElementsEXT(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount));
 }
@@ -26128,7 +25802,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnSeparableFilterARB(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, GLvoid * row, GLsizei columnBufSize, GLvoid * column, GLvoid * span)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnSeparableFilterARB");
    debug_print_sync("GetnSeparableFilterARB");
    CALL_GetnSeparableFilterARB(ctx->CurrentServerDispatch, (target, format, type, rowBufSize, row, columnBufSize, column, span));
 }
@@ -26160,7 +25834,7 @@ _mesa_marshal_FrontFace(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FrontFace");
    debug_print_sync_fallback("FrontFace");
    CALL_FrontFace(ctx->CurrentServerDispatch, (mode));
 }
@@ -26171,7 +25845,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiModeDrawArraysIBM(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiModeDrawArraysIBM");
    debug_print_sync("MultiModeDrawArraysIBM");
    CALL_MultiModeDrawArraysIBM(ctx->CurrentServerDispatch, (mode, first, count, primcount, modestride));
 }
@@ -26203,7 +25877,7 @@ _mesa_marshal_Normal3dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3dv");
    debug_print_sync_fallback("Normal3dv");
    CALL_Normal3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -26241,7 +25915,7 @@ _mesa_marshal_Lightf(GLenum light, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Lightf");
    debug_print_sync_fallback("Lightf");
    CALL_Lightf(ctx->CurrentServerDispatch, (light, pname, param));
 }
@@ -26273,7 +25947,7 @@ _mesa_marshal_MatrixMode(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MatrixMode");
    debug_print_sync_fallback("MatrixMode");
    CALL_MatrixMode(ctx->CurrentServerDispatch, (mode));
 }
@@ -26284,7 +25958,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPixelMapusv(GLenum map, GLushort * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPixelMapusv");
    debug_print_sync("GetPixelMapusv");
    CALL_GetPixelMapusv(ctx->CurrentServerDispatch, (map, values));
 }
@@ -26322,7 +25996,7 @@ _mesa_marshal_Lighti(GLenum light, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Lighti");
    debug_print_sync_fallback("Lighti");
    CALL_Lighti(ctx->CurrentServerDispatch, (light, pname, param));
 }
@@ -26333,7 +26007,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetFragDataIndex(GLuint program, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFragDataIndex");
    debug_print_sync("GetFragDataIndex");
    return CALL_GetFragDataIndex(ctx->CurrentServerDispatch, (program, name));
 }
@@ -26371,7 +26045,7 @@ _mesa_marshal_Lightx(GLenum light, GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Lightx");
    debug_print_sync_fallback("Lightx");
    CALL_Lightx(ctx->CurrentServerDispatch, (light, pname, param));
 }
@@ -26421,7 +26095,7 @@ _mesa_marshal_ProgramUniform3fv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3fv");
    debug_print_sync_fallback("ProgramUniform3fv");
    CALL_ProgramUniform3fv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -26453,7 +26127,7 @@ _mesa_marshal_MultMatrixd(const GLdouble * m)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultMatrixd");
    debug_print_sync_fallback("MultMatrixd");
    CALL_MultMatrixd(ctx->CurrentServerDispatch, (m));
 }
@@ -26485,7 +26159,7 @@ _mesa_marshal_MultMatrixf(const GLfloat * m)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultMatrixf");
    debug_print_sync_fallback("MultMatrixf");
    CALL_MultMatrixf(ctx->CurrentServerDispatch, (m));
 }
@@ -26532,7 +26206,7 @@ _mesa_marshal_Uniform4ui64vARB(GLint location, GLsizei count, const GLuint64 * v
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4ui64vARB");
    debug_print_sync_fallback("Uniform4ui64vARB");
    CALL_Uniform4ui64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -26567,7 +26241,7 @@ _mesa_marshal_MultiTexCoord4fvARB(GLenum target, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4fvARB");
    debug_print_sync_fallback("MultiTexCoord4fvARB");
    CALL_MultiTexCoord4fvARB(ctx->CurrentServerDispatch, (target, v));
 }
@@ -26617,7 +26291,7 @@ _mesa_marshal_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix2x3fv");
    debug_print_sync_fallback("UniformMatrix2x3fv");
    CALL_UniformMatrix2x3fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -26655,7 +26329,7 @@ _mesa_marshal_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SamplerParameterf");
    debug_print_sync_fallback("SamplerParameterf");
    CALL_SamplerParameterf(ctx->CurrentServerDispatch, (sampler, pname, param));
 }
@@ -26705,7 +26379,7 @@ _mesa_marshal_UniformMatrix3dv(GLint location, GLsizei count, GLboolean transpos
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix3dv");
    debug_print_sync_fallback("UniformMatrix3dv");
    CALL_UniformMatrix3dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -26740,50 +26414,12 @@ _mesa_marshal_PointParameterx(GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointParameterx");
    debug_print_sync_fallback("PointParameterx");
    CALL_PointParameterx(ctx->CurrentServerDispatch, (pname, param));
 }
 
 
-/* DrawArrays: marshalled asynchronously */
-struct marshal_cmd_DrawArrays
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLint first;
-   GLsizei count;
-};
-static inline void
-_mesa_unmarshal_DrawArrays(struct gl_context *ctx, const struct marshal_cmd_DrawArrays *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLint first = cmd->first;
-   const GLsizei count = cmd->count;
-   CALL_DrawArrays(ctx->CurrentServerDispatch, (mode, first, count));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawArrays(GLenum mode, GLint first, GLsizei count)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawArrays);
-   struct marshal_cmd_DrawArrays *cmd;
-   debug_print_marshal("DrawArrays");
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawArrays, cmd_size);
-      cmd->mode = mode;
-      cmd->first = first;
-      cmd->count = count;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawArrays");
-   CALL_DrawArrays(ctx->CurrentServerDispatch, (mode, first, count));
-}
-
-
 /* Uniform3dv: marshalled asynchronously */
 struct marshal_cmd_Uniform3dv
 {
@@ -26825,7 +26461,7 @@ _mesa_marshal_Uniform3dv(GLint location, GLsizei count, const GLdouble * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3dv");
    debug_print_sync_fallback("Uniform3dv");
    CALL_Uniform3dv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -26860,7 +26496,7 @@ _mesa_marshal_PointParameteri(GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointParameteri");
    debug_print_sync_fallback("PointParameteri");
    CALL_PointParameteri(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -26895,7 +26531,7 @@ _mesa_marshal_PointParameterf(GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointParameterf");
    debug_print_sync_fallback("PointParameterf");
    CALL_PointParameterf(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -26926,13 +26562,15 @@ _mesa_marshal_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexAttribBinding, cmd_size);
       cmd->attribindex = attribindex;
       cmd->bindingindex = bindingindex;
+      _mesa_glthread_invalidate_arrays(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribBinding");
    debug_print_sync_fallback("VertexAttribBinding");
    CALL_VertexAttribBinding(ctx->CurrentServerDispatch, (attribindex, bindingindex));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -26941,7 +26579,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureSubImage2D");
    debug_print_sync("TextureSubImage2D");
    CALL_TextureSubImage2D(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, width, height, format, type, pixels));
 }
@@ -26952,7 +26590,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_CreateShader(GLenum type)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateShader");
    debug_print_sync("CreateShader");
    return CALL_CreateShader(ctx->CurrentServerDispatch, (type));
 }
@@ -27002,7 +26640,7 @@ _mesa_marshal_ProgramUniform1dv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1dv");
    debug_print_sync_fallback("ProgramUniform1dv");
    CALL_ProgramUniform1dv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -27013,7 +26651,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramEnvParameterfvARB");
    debug_print_sync("GetProgramEnvParameterfvARB");
    CALL_GetProgramEnvParameterfvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -27052,14 +26690,16 @@ _mesa_marshal_DeleteBuffers(GLsizei n, const GLuint * buffer)
       char *variable_data = (char *) (cmd + 1);
       memcpy(variable_data, buffer, n * 4);
       variable_data += n * 4;
+      _mesa_glthread_DeleteBuffers(ctx, n, buffer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteBuffers");
    debug_print_sync_fallback("DeleteBuffers");
    CALL_DeleteBuffers(ctx->CurrentServerDispatch, (n, buffer));
+   _mesa_glthread_DeleteBuffers(ctx, n, buffer);
 }
 
 
@@ -27068,7 +26708,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetBufferSubData");
    debug_print_sync("GetBufferSubData");
    CALL_GetBufferSubData(ctx->CurrentServerDispatch, (target, offset, size, data));
 }
@@ -27079,7 +26719,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedRenderbufferParameteriv");
    debug_print_sync("GetNamedRenderbufferParameteriv");
    CALL_GetNamedRenderbufferParameteriv(ctx->CurrentServerDispatch, (renderbuffer, pname, params));
 }
@@ -27090,7 +26730,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfMonitorGroupsAMD(GLint * numGroups, GLsizei groupsSize, GLuint * groups)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfMonitorGroupsAMD");
    debug_print_sync("GetPerfMonitorGroupsAMD");
    CALL_GetPerfMonitorGroupsAMD(ctx->CurrentServerDispatch, (numGroups, groupsSize, groups));
 }
@@ -27131,7 +26771,7 @@ _mesa_marshal_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribP2ui");
    debug_print_sync_fallback("VertexAttribP2ui");
    CALL_VertexAttribP2ui(ctx->CurrentServerDispatch, (index, type, normalized, value));
 }
@@ -27181,7 +26821,7 @@ _mesa_marshal_ProgramUniform4dv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4dv");
    debug_print_sync_fallback("ProgramUniform4dv");
    CALL_ProgramUniform4dv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -27192,7 +26832,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMinmaxParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMinmaxParameteriv");
    debug_print_sync("GetMinmaxParameteriv");
    CALL_GetMinmaxParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -27224,7 +26864,7 @@ _mesa_marshal_DrawTexivOES(const GLint * coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexivOES");
    debug_print_sync_fallback("DrawTexivOES");
    CALL_DrawTexivOES(ctx->CurrentServerDispatch, (coords));
 }
@@ -27274,7 +26914,7 @@ _mesa_marshal_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTexImage1D");
    debug_print_sync_fallback("CopyTexImage1D");
    CALL_CopyTexImage1D(ctx->CurrentServerDispatch, (target, level, internalformat, x, y, width, border));
 }
@@ -27285,7 +26925,7 @@ static void GLAPIENTRY
 _mesa_marshal_InvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateNamedFramebufferData");
    debug_print_sync("InvalidateNamedFramebufferData");
    CALL_InvalidateNamedFramebufferData(ctx->CurrentServerDispatch, (framebuffer, numAttachments, attachments));
 }
@@ -27296,7 +26936,7 @@ static void GLAPIENTRY
 _mesa_marshal_SemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, const GLuint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SemaphoreParameterui64vEXT");
    debug_print_sync("SemaphoreParameterui64vEXT");
    CALL_SemaphoreParameterui64vEXT(ctx->CurrentServerDispatch, (semaphore, pname, params));
 }
@@ -27307,7 +26947,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnColorTableARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, GLvoid * table)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnColorTableARB");
    debug_print_sync("GetnColorTableARB");
    CALL_GetnColorTableARB(ctx->CurrentServerDispatch, (target, format, type, bufSize, table));
 }
@@ -27347,13 +26987,15 @@ _mesa_marshal_VertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GL
       cmd->type = type;
       cmd->normalized = normalized;
       cmd->relativeoffset = relativeoffset;
+      _mesa_glthread_invalidate_arrays(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribFormat");
    debug_print_sync_fallback("VertexAttribFormat");
    CALL_VertexAttribFormat(ctx->CurrentServerDispatch, (attribindex, size, type, normalized, relativeoffset));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -27389,7 +27031,7 @@ _mesa_marshal_Vertex3i(GLint x, GLint y, GLint z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3i");
    debug_print_sync_fallback("Vertex3i");
    CALL_Vertex3i(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -27427,7 +27069,7 @@ _mesa_marshal_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3f");
    debug_print_sync_fallback("Vertex3f");
    CALL_Vertex3f(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -27465,7 +27107,7 @@ _mesa_marshal_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3d");
    debug_print_sync_fallback("Vertex3d");
    CALL_Vertex3d(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -27476,7 +27118,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramPipelineiv");
    debug_print_sync("GetProgramPipelineiv");
    CALL_GetProgramPipelineiv(ctx->CurrentServerDispatch, (pipeline, pname, params));
 }
@@ -27508,7 +27150,7 @@ _mesa_marshal_ReadBuffer(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ReadBuffer");
    debug_print_sync_fallback("ReadBuffer");
    CALL_ReadBuffer(ctx->CurrentServerDispatch, (mode));
 }
@@ -27546,7 +27188,7 @@ _mesa_marshal_ConvolutionParameteri(GLenum target, GLenum pname, GLint params)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ConvolutionParameteri");
    debug_print_sync_fallback("ConvolutionParameteri");
    CALL_ConvolutionParameteri(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -27557,7 +27199,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexParameterIiv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexParameterIiv");
    debug_print_sync("GetTexParameterIiv");
    CALL_GetTexParameterIiv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -27595,7 +27237,7 @@ _mesa_marshal_Vertex3s(GLshort x, GLshort y, GLshort z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3s");
    debug_print_sync_fallback("Vertex3s");
    CALL_Vertex3s(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -27633,7 +27275,7 @@ _mesa_marshal_ConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ConvolutionParameterf");
    debug_print_sync_fallback("ConvolutionParameterf");
    CALL_ConvolutionParameterf(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -27644,7 +27286,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetColorTableParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetColorTableParameteriv");
    debug_print_sync("GetColorTableParameteriv");
    CALL_GetColorTableParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -27655,7 +27297,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTransformFeedbackVarying");
    debug_print_sync("GetTransformFeedbackVarying");
    CALL_GetTransformFeedbackVarying(ctx->CurrentServerDispatch, (program, index, bufSize, length, size, type, name));
 }
@@ -27666,7 +27308,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNextPerfQueryIdINTEL(GLuint queryId, GLuint * nextQueryId)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNextPerfQueryIdINTEL");
    debug_print_sync("GetNextPerfQueryIdINTEL");
    CALL_GetNextPerfQueryIdINTEL(ctx->CurrentServerDispatch, (queryId, nextQueryId));
 }
@@ -27698,7 +27340,7 @@ _mesa_marshal_TexCoord3fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3fv");
    debug_print_sync_fallback("TexCoord3fv");
    CALL_TexCoord3fv(ctx->CurrentServerDispatch, (v));
 }
@@ -27729,7 +27371,7 @@ _mesa_marshal_TextureBarrierNV(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureBarrierNV");
    debug_print_sync_fallback("TextureBarrierNV");
    CALL_TextureBarrierNV(ctx->CurrentServerDispatch, ());
 }
@@ -27740,7 +27382,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramInterfaceiv");
    debug_print_sync("GetProgramInterfaceiv");
    CALL_GetProgramInterfaceiv(ctx->CurrentServerDispatch, (program, programInterface, pname, params));
 }
@@ -27751,7 +27393,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribL1ui64vARB(GLuint index, const GLuint64EXT * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL1ui64vARB");
    debug_print_sync("VertexAttribL1ui64vARB");
    CALL_VertexAttribL1ui64vARB(ctx->CurrentServerDispatch, (index, v));
 }
@@ -27798,7 +27440,7 @@ _mesa_marshal_ProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramLocalParameter4fARB");
    debug_print_sync_fallback("ProgramLocalParameter4fARB");
    CALL_ProgramLocalParameter4fARB(ctx->CurrentServerDispatch, (target, index, x, y, z, w));
 }
@@ -27829,7 +27471,7 @@ _mesa_marshal_PauseTransformFeedback(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PauseTransformFeedback");
    debug_print_sync_fallback("PauseTransformFeedback");
    CALL_PauseTransformFeedback(ctx->CurrentServerDispatch, ());
 }
@@ -27861,7 +27503,7 @@ _mesa_marshal_DeleteShader(GLuint program)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteShader");
    debug_print_sync_fallback("DeleteShader");
    CALL_DeleteShader(ctx->CurrentServerDispatch, (program));
 }
@@ -27902,7 +27544,7 @@ _mesa_marshal_NamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferRenderbuffer");
    debug_print_sync_fallback("NamedFramebufferRenderbuffer");
    CALL_NamedFramebufferRenderbuffer(ctx->CurrentServerDispatch, (framebuffer, attachment, renderbuffertarget, renderbuffer));
 }
@@ -27934,7 +27576,7 @@ _mesa_marshal_CompileShader(GLuint shader)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompileShader");
    debug_print_sync_fallback("CompileShader");
    CALL_CompileShader(ctx->CurrentServerDispatch, (shader));
 }
@@ -27966,7 +27608,7 @@ _mesa_marshal_Vertex2iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2iv");
    debug_print_sync_fallback("Vertex2iv");
    CALL_Vertex2iv(ctx->CurrentServerDispatch, (v));
 }
@@ -27977,7 +27619,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexArrayIndexediv");
    debug_print_sync("GetVertexArrayIndexediv");
    CALL_GetVertexArrayIndexediv(ctx->CurrentServerDispatch, (vaobj, index, pname, param));
 }
@@ -27988,7 +27630,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexParameterIiv(GLenum target, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameterIiv");
    debug_print_sync("TexParameterIiv");
    CALL_TexParameterIiv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -27999,7 +27641,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexGendv(GLenum coord, GLenum pname, const GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGendv");
    debug_print_sync("TexGendv");
    CALL_TexGendv(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -28031,7 +27673,7 @@ _mesa_marshal_ResetMinmax(GLenum target)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ResetMinmax");
    debug_print_sync_fallback("ResetMinmax");
    CALL_ResetMinmax(ctx->CurrentServerDispatch, (target));
 }
@@ -28066,7 +27708,7 @@ _mesa_marshal_SampleCoverage(GLclampf value, GLboolean invert)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SampleCoverage");
    debug_print_sync_fallback("SampleCoverage");
    CALL_SampleCoverage(ctx->CurrentServerDispatch, (value, invert));
 }
@@ -28098,7 +27740,7 @@ _mesa_marshal_GenerateTextureMipmap(GLuint texture)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenerateTextureMipmap");
    debug_print_sync_fallback("GenerateTextureMipmap");
    CALL_GenerateTextureMipmap(ctx->CurrentServerDispatch, (texture));
 }
@@ -28142,7 +27784,7 @@ _mesa_marshal_DeleteProgramsARB(GLsizei n, const GLuint * programs)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteProgramsARB");
    debug_print_sync_fallback("DeleteProgramsARB");
    CALL_DeleteProgramsARB(ctx->CurrentServerDispatch, (n, programs));
 }
@@ -28174,7 +27816,7 @@ _mesa_marshal_ShadeModel(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ShadeModel");
    debug_print_sync_fallback("ShadeModel");
    CALL_ShadeModel(ctx->CurrentServerDispatch, (mode));
 }
@@ -28185,7 +27827,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreateQueries(GLenum target, GLsizei n, GLuint * ids)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateQueries");
    debug_print_sync("CreateQueries");
    CALL_CreateQueries(ctx->CurrentServerDispatch, (target, n, ids));
 }
@@ -28196,7 +27838,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawArrays");
    debug_print_sync("MultiDrawArrays");
    CALL_MultiDrawArrays(ctx->CurrentServerDispatch, (mode, first, count, primcount));
 }
@@ -28207,7 +27849,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramLocalParameterdvARB");
    debug_print_sync("GetProgramLocalParameterdvARB");
    CALL_GetProgramLocalParameterdvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -28218,7 +27860,7 @@ static GLvoid * GLAPIENTRY
 _mesa_marshal_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapBufferRange");
    debug_print_sync("MapBufferRange");
    return CALL_MapBufferRange(ctx->CurrentServerDispatch, (target, offset, length, access));
 }
@@ -28256,7 +27898,7 @@ _mesa_marshal_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint n
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DispatchCompute");
    debug_print_sync_fallback("DispatchCompute");
    CALL_DispatchCompute(ctx->CurrentServerDispatch, (num_groups_x, num_groups_y, num_groups_z));
 }
@@ -28294,7 +27936,7 @@ _mesa_marshal_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint progra
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UseProgramStages");
    debug_print_sync_fallback("UseProgramStages");
    CALL_UseProgramStages(ctx->CurrentServerDispatch, (pipeline, stages, program));
 }
@@ -28347,7 +27989,7 @@ _mesa_marshal_ProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix4fv");
    debug_print_sync_fallback("ProgramUniformMatrix4fv");
    CALL_ProgramUniformMatrix4fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -28388,7 +28030,7 @@ _mesa_marshal_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum r
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferRenderbuffer");
    debug_print_sync_fallback("FramebufferRenderbuffer");
    CALL_FramebufferRenderbuffer(ctx->CurrentServerDispatch, (target, attachment, renderbuffertarget, renderbuffer));
 }
@@ -28399,7 +28041,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsProgramARB(GLuint program)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsProgramARB");
    debug_print_sync("IsProgramARB");
    return CALL_IsProgramARB(ctx->CurrentServerDispatch, (program));
 }
@@ -28410,7 +28052,7 @@ static void GLAPIENTRY
 _mesa_marshal_Map2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Map2d");
    debug_print_sync("Map2d");
    CALL_Map2d(ctx->CurrentServerDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
 }
@@ -28421,7 +28063,7 @@ static void GLAPIENTRY
 _mesa_marshal_Map2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Map2f");
    debug_print_sync("Map2f");
    CALL_Map2f(ctx->CurrentServerDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
 }
@@ -28471,7 +28113,7 @@ _mesa_marshal_ProgramStringARB(GLenum target, GLenum format, GLsizei len, const
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramStringARB");
    debug_print_sync_fallback("ProgramStringARB");
    CALL_ProgramStringARB(ctx->CurrentServerDispatch, (target, format, len, string));
 }
@@ -28524,7 +28166,7 @@ _mesa_marshal_CopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTextureSubImage2D");
    debug_print_sync_fallback("CopyTextureSubImage2D");
    CALL_CopyTextureSubImage2D(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, x, y, width, height));
 }
@@ -28568,7 +28210,7 @@ _mesa_marshal_MultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4s");
    debug_print_sync_fallback("MultiTexCoord4s");
    CALL_MultiTexCoord4s(ctx->CurrentServerDispatch, (target, s, t, r, q));
 }
@@ -28608,13 +28250,15 @@ _mesa_marshal_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GL
       cmd->y = y;
       cmd->w = w;
       cmd->h = h;
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ViewportIndexedf");
    debug_print_sync_fallback("ViewportIndexedf");
    CALL_ViewportIndexedf(ctx->CurrentServerDispatch, (index, x, y, w, h));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -28656,7 +28300,7 @@ _mesa_marshal_MultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4i");
    debug_print_sync_fallback("MultiTexCoord4i");
    CALL_MultiTexCoord4i(ctx->CurrentServerDispatch, (target, s, t, r, q));
 }
@@ -28712,7 +28356,7 @@ _mesa_marshal_DebugMessageControl(GLenum source, GLenum type, GLenum severity, G
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DebugMessageControl");
    debug_print_sync_fallback("DebugMessageControl");
    CALL_DebugMessageControl(ctx->CurrentServerDispatch, (source, type, severity, count, ids, enabled));
 }
@@ -28756,7 +28400,7 @@ _mesa_marshal_MultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4d");
    debug_print_sync_fallback("MultiTexCoord4d");
    CALL_MultiTexCoord4d(ctx->CurrentServerDispatch, (target, s, t, r, q));
 }
@@ -28767,7 +28411,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetHistogram");
    debug_print_sync("GetHistogram");
    CALL_GetHistogram(ctx->CurrentServerDispatch, (target, reset, format, type, values));
 }
@@ -28805,7 +28449,7 @@ _mesa_marshal_Translatex(GLfixed x, GLfixed y, GLfixed z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Translatex");
    debug_print_sync_fallback("Translatex");
    CALL_Translatex(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -28852,7 +28496,7 @@ _mesa_marshal_MultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, GLintp
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawElementsIndirectCountARB");
    debug_print_sync_fallback("MultiDrawElementsIndirectCountARB");
    CALL_MultiDrawElementsIndirectCountARB(ctx->CurrentServerDispatch, (mode, type, indirect, drawcount, maxdrawcount, stride));
 }
@@ -28884,7 +28528,7 @@ _mesa_marshal_Indexsv(const GLshort * c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexsv");
    debug_print_sync_fallback("Indexsv");
    CALL_Indexsv(ctx->CurrentServerDispatch, (c));
 }
@@ -28919,7 +28563,7 @@ _mesa_marshal_VertexAttrib1fvARB(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1fvARB");
    debug_print_sync_fallback("VertexAttrib1fvARB");
    CALL_VertexAttrib1fvARB(ctx->CurrentServerDispatch, (index, v));
 }
@@ -28951,7 +28595,7 @@ _mesa_marshal_TexCoord2dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2dv");
    debug_print_sync_fallback("TexCoord2dv");
    CALL_TexCoord2dv(ctx->CurrentServerDispatch, (v));
 }
@@ -28989,7 +28633,7 @@ _mesa_marshal_Translated(GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Translated");
    debug_print_sync_fallback("Translated");
    CALL_Translated(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -29027,7 +28671,7 @@ _mesa_marshal_Translatef(GLfloat x, GLfloat y, GLfloat z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Translatef");
    debug_print_sync_fallback("Translatef");
    CALL_Translatef(ctx->CurrentServerDispatch, (x, y, z));
 }
@@ -29038,7 +28682,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultTransposeMatrixd(const GLdouble * m)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultTransposeMatrixd");
    debug_print_sync("MultTransposeMatrixd");
    CALL_MultTransposeMatrixd(ctx->CurrentServerDispatch, (m));
 }
@@ -29088,7 +28732,7 @@ _mesa_marshal_ProgramUniform4uiv(GLuint program, GLint location, GLsizei count,
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4uiv");
    debug_print_sync_fallback("ProgramUniform4uiv");
    CALL_ProgramUniform4uiv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -29099,7 +28743,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfCounterInfoINTEL(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar * counterName, GLuint counterDescLength, GLchar * counterDesc, GLuint * counterOffset, GLuint * counterDataSize, GLuint * counterTypeEnum, GLuint * counterDataTypeEnum, GLuint64 * rawCounterMaxValue)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfCounterInfoINTEL");
    debug_print_sync("GetPerfCounterInfoINTEL");
    CALL_GetPerfCounterInfoINTEL(ctx->CurrentServerDispatch, (queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue));
 }
@@ -29110,7 +28754,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_RenderMode(GLenum mode)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RenderMode");
    debug_print_sync("RenderMode");
    return CALL_RenderMode(ctx->CurrentServerDispatch, (mode));
 }
@@ -29145,7 +28789,7 @@ _mesa_marshal_MultiTexCoord1fARB(GLenum target, GLfloat s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1fARB");
    debug_print_sync_fallback("MultiTexCoord1fARB");
    CALL_MultiTexCoord1fARB(ctx->CurrentServerDispatch, (target, s));
 }
@@ -29183,7 +28827,7 @@ _mesa_marshal_SecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3d");
    debug_print_sync_fallback("SecondaryColor3d");
    CALL_SecondaryColor3d(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -29221,7 +28865,7 @@ _mesa_marshal_FramebufferParameteri(GLenum target, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferParameteri");
    debug_print_sync_fallback("FramebufferParameteri");
    CALL_FramebufferParameteri(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -29268,7 +28912,7 @@ _mesa_marshal_VertexAttribs4ubvNV(GLuint index, GLsizei n, const GLubyte * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs4ubvNV");
    debug_print_sync_fallback("VertexAttribs4ubvNV");
    CALL_VertexAttribs4ubvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -29279,7 +28923,7 @@ static void GLAPIENTRY
 _mesa_marshal_LightModelxv(GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LightModelxv");
    debug_print_sync("LightModelxv");
    CALL_LightModelxv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -29326,7 +28970,7 @@ _mesa_marshal_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTexSubImage1D");
    debug_print_sync_fallback("CopyTexSubImage1D");
    CALL_CopyTexSubImage1D(ctx->CurrentServerDispatch, (target, level, xoffset, x, y, width));
 }
@@ -29337,7 +28981,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureSubImage3D");
    debug_print_sync("TextureSubImage3D");
    CALL_TextureSubImage3D(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels));
 }
@@ -29375,7 +29019,7 @@ _mesa_marshal_StencilFunc(GLenum func, GLint ref, GLuint mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilFunc");
    debug_print_sync_fallback("StencilFunc");
    CALL_StencilFunc(ctx->CurrentServerDispatch, (func, ref, mask));
 }
@@ -29419,7 +29063,7 @@ _mesa_marshal_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyPixels");
    debug_print_sync_fallback("CopyPixels");
    CALL_CopyPixels(ctx->CurrentServerDispatch, (x, y, width, height, type));
 }
@@ -29430,7 +29074,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexGenxvOES(GLenum coord, GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGenxvOES");
    debug_print_sync("TexGenxvOES");
    CALL_TexGenxvOES(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -29441,7 +29085,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureLevelParameterfv");
    debug_print_sync("GetTextureLevelParameterfv");
    CALL_GetTextureLevelParameterfv(ctx->CurrentServerDispatch, (texture, level, pname, params));
 }
@@ -29476,7 +29120,7 @@ _mesa_marshal_VertexAttrib4Nubv(GLuint index, const GLubyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Nubv");
    debug_print_sync_fallback("VertexAttrib4Nubv");
    CALL_VertexAttrib4Nubv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -29526,7 +29170,7 @@ _mesa_marshal_UniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix4x2dv");
    debug_print_sync_fallback("UniformMatrix4x2dv");
    CALL_UniformMatrix4x2dv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -29561,13 +29205,6 @@ _mesa_marshal_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboole
    size_t cmd_size = sizeof(struct marshal_cmd_VertexAttribPointer);
    struct marshal_cmd_VertexAttribPointer *cmd;
    debug_print_marshal("VertexAttribPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("VertexAttribPointer");
-      CALL_VertexAttribPointer(ctx->CurrentServerDispatch, (index, size, type, normalized, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexAttribPointer, cmd_size);
       cmd->index = index;
@@ -29576,13 +29213,15 @@ _mesa_marshal_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboole
       cmd->normalized = normalized;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_VertexAttribPointer(ctx, index, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribPointer");
    debug_print_sync_fallback("VertexAttribPointer");
    CALL_VertexAttribPointer(ctx->CurrentServerDispatch, (index, size, type, normalized, stride, pointer));
+   _mesa_glthread_VertexAttribPointer(ctx, index, size, type, stride, pointer);
 }
 
 
@@ -29612,7 +29251,7 @@ _mesa_marshal_IndexMask(GLuint mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IndexMask");
    debug_print_sync_fallback("IndexMask");
    CALL_IndexMask(ctx->CurrentServerDispatch, (mask));
 }
@@ -29649,64 +29288,15 @@ _mesa_marshal_VertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, G
       cmd->size = size;
       cmd->type = type;
       cmd->relativeoffset = relativeoffset;
+      _mesa_glthread_invalidate_arrays(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribIFormat");
    debug_print_sync_fallback("VertexAttribIFormat");
    CALL_VertexAttribIFormat(ctx->CurrentServerDispatch, (attribindex, size, type, relativeoffset));
-}
-
-
-/* DrawArraysInstancedBaseInstance: marshalled asynchronously */
-struct marshal_cmd_DrawArraysInstancedBaseInstance
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLint first;
-   GLsizei count;
-   GLsizei primcount;
-   GLuint baseinstance;
-};
-static inline void
-_mesa_unmarshal_DrawArraysInstancedBaseInstance(struct gl_context *ctx, const struct marshal_cmd_DrawArraysInstancedBaseInstance *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLint first = cmd->first;
-   const GLsizei count = cmd->count;
-   const GLsizei primcount = cmd->primcount;
-   const GLuint baseinstance = cmd->baseinstance;
-   CALL_DrawArraysInstancedBaseInstance(ctx->CurrentServerDispatch, (mode, first, count, primcount, baseinstance));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei primcount, GLuint baseinstance)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawArraysInstancedBaseInstance);
-   struct marshal_cmd_DrawArraysInstancedBaseInstance *cmd;
-   debug_print_marshal("DrawArraysInstancedBaseInstance");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawArraysInstancedBaseInstance");
-      CALL_DrawArraysInstancedBaseInstance(ctx->CurrentServerDispatch, (mode, first, count, primcount, baseinstance));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawArraysInstancedBaseInstance, cmd_size);
-      cmd->mode = mode;
-      cmd->first = first;
-      cmd->count = count;
-      cmd->primcount = primcount;
-      cmd->baseinstance = baseinstance;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawArraysInstancedBaseInstance");
-   CALL_DrawArraysInstancedBaseInstance(ctx->CurrentServerDispatch, (mode, first, count, primcount, baseinstance));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -29760,7 +29350,7 @@ _mesa_marshal_TextureStorageMem3DMultisampleEXT(GLuint texture, GLsizei samples,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorageMem3DMultisampleEXT");
    debug_print_sync_fallback("TextureStorageMem3DMultisampleEXT");
    CALL_TextureStorageMem3DMultisampleEXT(ctx->CurrentServerDispatch, (texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset));
 }
@@ -29771,7 +29361,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTextureSubImage3D");
    debug_print_sync("CompressedTextureSubImage3D");
    CALL_CompressedTextureSubImage3D(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data));
 }
@@ -29798,13 +29388,15 @@ _mesa_marshal_PopAttrib(void)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_PopAttrib, cmd_size);
       (void) cmd;
 
+      _mesa_glthread_invalidate_state(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PopAttrib");
    debug_print_sync_fallback("PopAttrib");
    CALL_PopAttrib(ctx->CurrentServerDispatch, ());
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -29843,7 +29435,7 @@ _mesa_marshal_Uniform3ui(GLint location, GLuint x, GLuint y, GLuint z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3ui");
    debug_print_sync_fallback("Uniform3ui");
    CALL_Uniform3ui(ctx->CurrentServerDispatch, (location, x, y, z));
 }
@@ -29854,7 +29446,7 @@ static void GLAPIENTRY
 _mesa_marshal_DeletePerfMonitorsAMD(GLsizei n, GLuint * monitors)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeletePerfMonitorsAMD");
    debug_print_sync("DeletePerfMonitorsAMD");
    CALL_DeletePerfMonitorsAMD(ctx->CurrentServerDispatch, (n, monitors));
 }
@@ -29886,7 +29478,7 @@ _mesa_marshal_Color4dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4dv");
    debug_print_sync_fallback("Color4dv");
    CALL_Color4dv(ctx->CurrentServerDispatch, (v));
 }
@@ -29914,13 +29506,15 @@ _mesa_marshal_DisableVertexAttribArray(GLuint index)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DisableVertexAttribArray, cmd_size);
       cmd->index = index;
+      _mesa_glthread_VertexAttribArray(ctx, index, false);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DisableVertexAttribArray");
    debug_print_sync_fallback("DisableVertexAttribArray");
    CALL_DisableVertexAttribArray(ctx->CurrentServerDispatch, (index));
+   _mesa_glthread_VertexAttribArray(ctx, index, false);
 }
 
 
@@ -29971,7 +29565,7 @@ _mesa_marshal_ProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix3x2fv");
    debug_print_sync_fallback("ProgramUniformMatrix3x2fv");
    CALL_ProgramUniformMatrix3x2fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -29982,7 +29576,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetDoublei_v(GLenum target, GLuint index, GLdouble * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetDoublei_v");
    debug_print_sync("GetDoublei_v");
    CALL_GetDoublei_v(ctx->CurrentServerDispatch, (target, index, data));
 }
@@ -29993,7 +29587,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsTransformFeedback(GLuint id)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsTransformFeedback");
    debug_print_sync("IsTransformFeedback");
    return CALL_IsTransformFeedback(ctx->CurrentServerDispatch, (id));
 }
@@ -30004,7 +29598,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMemoryObjectParameterivEXT");
    debug_print_sync("GetMemoryObjectParameterivEXT");
    CALL_GetMemoryObjectParameterivEXT(ctx->CurrentServerDispatch, (memoryObject, pname, params));
 }
@@ -30039,7 +29633,7 @@ _mesa_marshal_ClipPlanex(GLenum plane, const GLfixed * equation)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClipPlanex");
    debug_print_sync_fallback("ClipPlanex");
    CALL_ClipPlanex(ctx->CurrentServerDispatch, (plane, equation));
 }
@@ -30050,7 +29644,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetLightfv(GLenum light, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetLightfv");
    debug_print_sync("GetLightfv");
    CALL_GetLightfv(ctx->CurrentServerDispatch, (light, pname, params));
 }
@@ -30085,7 +29679,7 @@ _mesa_marshal_ClipPlanef(GLenum plane, const GLfloat * equation)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClipPlanef");
    debug_print_sync_fallback("ClipPlanef");
    CALL_ClipPlanef(ctx->CurrentServerDispatch, (plane, equation));
 }
@@ -30123,7 +29717,7 @@ _mesa_marshal_ProgramUniform1ui(GLuint program, GLint location, GLuint x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1ui");
    debug_print_sync_fallback("ProgramUniform1ui");
    CALL_ProgramUniform1ui(ctx->CurrentServerDispatch, (program, location, x));
 }
@@ -30154,26 +29748,21 @@ _mesa_marshal_SecondaryColorPointer(GLint size, GLenum type, GLsizei stride, con
    size_t cmd_size = sizeof(struct marshal_cmd_SecondaryColorPointer);
    struct marshal_cmd_SecondaryColorPointer *cmd;
    debug_print_marshal("SecondaryColorPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("SecondaryColorPointer");
-      CALL_SecondaryColorPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_SecondaryColorPointer, cmd_size);
       cmd->size = size;
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR1, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColorPointer");
    debug_print_sync_fallback("SecondaryColorPointer");
    CALL_SecondaryColorPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR1, size, type, stride, pointer);
 }
 
 
@@ -30206,7 +29795,7 @@ _mesa_marshal_LineStipple(GLint factor, GLushort pattern)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LineStipple");
    debug_print_sync_fallback("LineStipple");
    CALL_LineStipple(ctx->CurrentServerDispatch, (factor, pattern));
 }
@@ -30237,7 +29826,7 @@ _mesa_marshal_BeginFragmentShaderATI(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BeginFragmentShaderATI");
    debug_print_sync_fallback("BeginFragmentShaderATI");
    CALL_BeginFragmentShaderATI(ctx->CurrentServerDispatch, ());
 }
@@ -30248,9 +29837,10 @@ static void GLAPIENTRY
 _mesa_marshal_GenRenderbuffers(GLsizei n, GLuint * renderbuffers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenRenderbuffers");
    debug_print_sync("GenRenderbuffers");
    CALL_GenRenderbuffers(ctx->CurrentServerDispatch, (n, renderbuffers));
+   _mesa_glthread_GenRenderbuffers(ctx, n, renderbuffers);
 }
 
 
@@ -30259,7 +29849,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMinmaxParameterfv");
    debug_print_sync("GetMinmaxParameterfv");
    CALL_GetMinmaxParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -30309,7 +29899,7 @@ _mesa_marshal_TextureStorageMem2DEXT(GLenum texture, GLsizei levels, GLenum inte
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorageMem2DEXT");
    debug_print_sync_fallback("TextureStorageMem2DEXT");
    CALL_TextureStorageMem2DEXT(ctx->CurrentServerDispatch, (texture, levels, internalFormat, width, height, memory, offset));
 }
@@ -30320,7 +29910,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsEnabledi(GLenum target, GLuint index)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsEnabledi");
    debug_print_sync("IsEnabledi");
    return CALL_IsEnabledi(ctx->CurrentServerDispatch, (target, index));
 }
@@ -30358,7 +29948,7 @@ _mesa_marshal_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WaitSync");
    debug_print_sync_fallback("WaitSync");
    CALL_WaitSync(ctx->CurrentServerDispatch, (sync, flags, timeout));
 }
@@ -30369,7 +29959,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribPointerv(GLuint index, GLenum pname, GLvoid ** pointer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribPointerv");
    debug_print_sync("GetVertexAttribPointerv");
    CALL_GetVertexAttribPointerv(ctx->CurrentServerDispatch, (index, pname, pointer));
 }
@@ -30416,7 +30006,7 @@ _mesa_marshal_Uniform1i64vARB(GLint location, GLsizei count, const GLint64 * val
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1i64vARB");
    debug_print_sync_fallback("Uniform1i64vARB");
    CALL_Uniform1i64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -30427,7 +30017,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreatePerfQueryINTEL(GLuint queryId, GLuint * queryHandle)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreatePerfQueryINTEL");
    debug_print_sync("CreatePerfQueryINTEL");
    CALL_CreatePerfQueryINTEL(ctx->CurrentServerDispatch, (queryId, queryHandle));
 }
@@ -30455,7 +30045,7 @@ _mesa_marshal_NewList(GLuint list, GLenum mode)
    struct marshal_cmd_NewList *cmd;
    debug_print_marshal("NewList");
    if (true) {
-      _mesa_glthread_finish(ctx);
+      _mesa_glthread_finish_before(ctx, "NewList");
       _mesa_glthread_restore_dispatch(ctx);
       debug_print_sync_fallback("NewList");
       CALL_NewList(ctx->CurrentServerDispatch, (list, mode));
@@ -30469,7 +30059,7 @@ _mesa_marshal_NewList(GLuint list, GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NewList");
    debug_print_sync_fallback("NewList");
    CALL_NewList(ctx->CurrentServerDispatch, (list, mode));
 }
@@ -30507,7 +30097,7 @@ _mesa_marshal_TexBuffer(GLenum target, GLenum internalFormat, GLuint buffer)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexBuffer");
    debug_print_sync_fallback("TexBuffer");
    CALL_TexBuffer(ctx->CurrentServerDispatch, (target, internalFormat, buffer));
 }
@@ -30539,7 +30129,7 @@ _mesa_marshal_TexCoord4sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4sv");
    debug_print_sync_fallback("TexCoord4sv");
    CALL_TexCoord4sv(ctx->CurrentServerDispatch, (v));
 }
@@ -30571,7 +30161,7 @@ _mesa_marshal_TexCoord1f(GLfloat s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1f");
    debug_print_sync_fallback("TexCoord1f");
    CALL_TexCoord1f(ctx->CurrentServerDispatch, (s));
 }
@@ -30603,7 +30193,7 @@ _mesa_marshal_TexCoord1d(GLdouble s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1d");
    debug_print_sync_fallback("TexCoord1d");
    CALL_TexCoord1d(ctx->CurrentServerDispatch, (s));
 }
@@ -30635,7 +30225,7 @@ _mesa_marshal_TexCoord1i(GLint s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1i");
    debug_print_sync_fallback("TexCoord1i");
    CALL_TexCoord1i(ctx->CurrentServerDispatch, (s));
 }
@@ -30646,7 +30236,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnUniformfvARB(GLuint program, GLint location, GLsizei bufSize, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnUniformfvARB");
    debug_print_sync("GetnUniformfvARB");
    CALL_GetnUniformfvARB(ctx->CurrentServerDispatch, (program, location, bufSize, params));
 }
@@ -30678,7 +30268,7 @@ _mesa_marshal_TexCoord1s(GLshort s)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord1s");
    debug_print_sync_fallback("TexCoord1s");
    CALL_TexCoord1s(ctx->CurrentServerDispatch, (s));
 }
@@ -30713,7 +30303,7 @@ _mesa_marshal_Uniform1ui(GLint location, GLuint x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1ui");
    debug_print_sync_fallback("Uniform1ui");
    CALL_Uniform1ui(ctx->CurrentServerDispatch, (location, x));
 }
@@ -30754,7 +30344,7 @@ _mesa_marshal_TexStorage1D(GLenum target, GLsizei levels, GLenum internalFormat,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorage1D");
    debug_print_sync_fallback("TexStorage1D");
    CALL_TexStorage1D(ctx->CurrentServerDispatch, (target, levels, internalFormat, width));
 }
@@ -30813,7 +30403,7 @@ _mesa_marshal_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlitFramebuffer");
    debug_print_sync_fallback("BlitFramebuffer");
    CALL_BlitFramebuffer(ctx->CurrentServerDispatch, (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter));
 }
@@ -30851,7 +30441,7 @@ _mesa_marshal_TextureParameterf(GLuint texture, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureParameterf");
    debug_print_sync_fallback("TextureParameterf");
    CALL_TextureParameterf(ctx->CurrentServerDispatch, (texture, pname, param));
 }
@@ -30895,7 +30485,7 @@ _mesa_marshal_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum text
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferTexture1D");
    debug_print_sync_fallback("FramebufferTexture1D");
    CALL_FramebufferTexture1D(ctx->CurrentServerDispatch, (target, attachment, textarget, texture, level));
 }
@@ -30933,7 +30523,7 @@ _mesa_marshal_TextureParameteri(GLuint texture, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureParameteri");
    debug_print_sync_fallback("TextureParameteri");
    CALL_TextureParameteri(ctx->CurrentServerDispatch, (texture, pname, param));
 }
@@ -30944,7 +30534,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMapiv(GLenum target, GLenum query, GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMapiv");
    debug_print_sync("GetMapiv");
    CALL_GetMapiv(ctx->CurrentServerDispatch, (target, query, v));
 }
@@ -30955,7 +30545,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformui64vARB(GLuint program, GLint location, GLuint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformui64vARB");
    debug_print_sync("GetUniformui64vARB");
    CALL_GetUniformui64vARB(ctx->CurrentServerDispatch, (program, location, params));
 }
@@ -30990,7 +30580,7 @@ _mesa_marshal_TexCoordP4ui(GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP4ui");
    debug_print_sync_fallback("TexCoordP4ui");
    CALL_TexCoordP4ui(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -31025,7 +30615,7 @@ _mesa_marshal_VertexAttrib1sv(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1sv");
    debug_print_sync_fallback("VertexAttrib1sv");
    CALL_VertexAttrib1sv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -31066,7 +30656,7 @@ _mesa_marshal_WindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos4dMESA");
    debug_print_sync_fallback("WindowPos4dMESA");
    CALL_WindowPos4dMESA(ctx->CurrentServerDispatch, (x, y, z, w));
 }
@@ -31098,7 +30688,7 @@ _mesa_marshal_Vertex3dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3dv");
    debug_print_sync_fallback("Vertex3dv");
    CALL_Vertex3dv(ctx->CurrentServerDispatch, (v));
 }
@@ -31136,7 +30726,7 @@ _mesa_marshal_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL2d");
    debug_print_sync_fallback("VertexAttribL2d");
    CALL_VertexAttribL2d(ctx->CurrentServerDispatch, (index, x, y));
 }
@@ -31147,7 +30737,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnMapivARB(GLenum target, GLenum query, GLsizei bufSize, GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnMapivARB");
    debug_print_sync("GetnMapivARB");
    CALL_GetnMapivARB(ctx->CurrentServerDispatch, (target, query, bufSize, v));
 }
@@ -31158,7 +30748,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribfv");
    debug_print_sync("GetVertexAttribfv");
    CALL_GetVertexAttribfv(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -31169,7 +30759,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP4uiv");
    debug_print_sync("MultiTexCoordP4uiv");
    CALL_MultiTexCoordP4uiv(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -31180,7 +30770,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexGeniv(GLenum coord, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGeniv");
    debug_print_sync("TexGeniv");
    CALL_TexGeniv(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -31191,7 +30781,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsMemoryObjectEXT(GLuint memoryObject)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsMemoryObjectEXT");
    debug_print_sync("IsMemoryObjectEXT");
    return CALL_IsMemoryObjectEXT(ctx->CurrentServerDispatch, (memoryObject));
 }
@@ -31232,7 +30822,7 @@ _mesa_marshal_BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf a
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendColor");
    debug_print_sync_fallback("BlendColor");
    CALL_BlendColor(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -31279,7 +30869,7 @@ _mesa_marshal_VertexAttribs2dvNV(GLuint index, GLsizei n, const GLdouble * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs2dvNV");
    debug_print_sync_fallback("VertexAttribs2dvNV");
    CALL_VertexAttribs2dvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -31314,7 +30904,7 @@ _mesa_marshal_VertexAttrib2dvNV(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib2dvNV");
    debug_print_sync_fallback("VertexAttrib2dvNV");
    CALL_VertexAttrib2dvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -31325,7 +30915,7 @@ static void GLAPIENTRY
 _mesa_marshal_NamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum * bufs)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedFramebufferDrawBuffers");
    debug_print_sync("NamedFramebufferDrawBuffers");
    CALL_NamedFramebufferDrawBuffers(ctx->CurrentServerDispatch, (framebuffer, n, bufs));
 }
@@ -31357,7 +30947,7 @@ _mesa_marshal_ResetHistogram(GLenum target)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ResetHistogram");
    debug_print_sync_fallback("ResetHistogram");
    CALL_ResetHistogram(ctx->CurrentServerDispatch, (target));
 }
@@ -31368,7 +30958,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTexSubImage2D");
    debug_print_sync("CompressedTexSubImage2D");
    CALL_CompressedTexSubImage2D(ctx->CurrentServerDispatch, (target, level, xoffset, yoffset, width, height, format, imageSize, data));
 }
@@ -31400,7 +30990,7 @@ _mesa_marshal_TexCoord2sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2sv");
    debug_print_sync_fallback("TexCoord2sv");
    CALL_TexCoord2sv(ctx->CurrentServerDispatch, (v));
 }
@@ -31435,7 +31025,7 @@ _mesa_marshal_StencilMaskSeparate(GLenum face, GLuint mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilMaskSeparate");
    debug_print_sync_fallback("StencilMaskSeparate");
    CALL_StencilMaskSeparate(ctx->CurrentServerDispatch, (face, mask));
 }
@@ -31470,7 +31060,7 @@ _mesa_marshal_MultiTexCoord3sv(GLenum target, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3sv");
    debug_print_sync_fallback("MultiTexCoord3sv");
    CALL_MultiTexCoord3sv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -31502,7 +31092,7 @@ _mesa_marshal_TexCoord3iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord3iv");
    debug_print_sync_fallback("TexCoord3iv");
    CALL_TexCoord3iv(ctx->CurrentServerDispatch, (v));
 }
@@ -31537,7 +31127,7 @@ _mesa_marshal_MultiTexCoord4sv(GLenum target, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord4sv");
    debug_print_sync_fallback("MultiTexCoord4sv");
    CALL_MultiTexCoord4sv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -31568,13 +31158,15 @@ _mesa_marshal_VertexBindingDivisor(GLuint attribindex, GLuint divisor)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexBindingDivisor, cmd_size);
       cmd->attribindex = attribindex;
       cmd->divisor = divisor;
+      _mesa_glthread_invalidate_arrays(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexBindingDivisor");
    debug_print_sync_fallback("VertexBindingDivisor");
    CALL_VertexBindingDivisor(ctx->CurrentServerDispatch, (attribindex, divisor));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -31625,7 +31217,7 @@ _mesa_marshal_PrimitiveBoundingBox(GLfloat minX, GLfloat minY, GLfloat minZ, GLf
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PrimitiveBoundingBox");
    debug_print_sync_fallback("PrimitiveBoundingBox");
    CALL_PrimitiveBoundingBox(ctx->CurrentServerDispatch, (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW));
 }
@@ -31636,7 +31228,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfMonitorCounterInfoAMD(GLuint group, GLuint counter, GLenum pname, GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfMonitorCounterInfoAMD");
    debug_print_sync("GetPerfMonitorCounterInfoAMD");
    CALL_GetPerfMonitorCounterInfoAMD(ctx->CurrentServerDispatch, (group, counter, pname, data));
 }
@@ -31674,7 +31266,7 @@ _mesa_marshal_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLui
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformBlockBinding");
    debug_print_sync_fallback("UniformBlockBinding");
    CALL_UniformBlockBinding(ctx->CurrentServerDispatch, (program, uniformBlockIndex, uniformBlockBinding));
 }
@@ -31685,7 +31277,7 @@ static GLsync GLAPIENTRY
 _mesa_marshal_FenceSync(GLenum condition, GLbitfield flags)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FenceSync");
    debug_print_sync("FenceSync");
    return CALL_FenceSync(ctx->CurrentServerDispatch, (condition, flags));
 }
@@ -31696,7 +31288,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTextureSubImage2D");
    debug_print_sync("CompressedTextureSubImage2D");
    CALL_CompressedTextureSubImage2D(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, width, height, format, imageSize, data));
 }
@@ -31731,7 +31323,7 @@ _mesa_marshal_VertexAttrib4Nusv(GLuint index, const GLushort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4Nusv");
    debug_print_sync_fallback("VertexAttrib4Nusv");
    CALL_VertexAttrib4Nusv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -31742,7 +31334,7 @@ static void GLAPIENTRY
 _mesa_marshal_SetFragmentShaderConstantATI(GLuint dst, const GLfloat * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SetFragmentShaderConstantATI");
    debug_print_sync("SetFragmentShaderConstantATI");
    CALL_SetFragmentShaderConstantATI(ctx->CurrentServerDispatch, (dst, value));
 }
@@ -31777,7 +31369,7 @@ _mesa_marshal_VertexP2ui(GLenum type, GLuint value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexP2ui");
    debug_print_sync_fallback("VertexP2ui");
    CALL_VertexP2ui(ctx->CurrentServerDispatch, (type, value));
 }
@@ -31827,7 +31419,7 @@ _mesa_marshal_ProgramUniform2fv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2fv");
    debug_print_sync_fallback("ProgramUniform2fv");
    CALL_ProgramUniform2fv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -31838,7 +31430,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureLevelParameteriv");
    debug_print_sync("GetTextureLevelParameteriv");
    CALL_GetTextureLevelParameteriv(ctx->CurrentServerDispatch, (texture, level, pname, params));
 }
@@ -31849,7 +31441,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexEnvfv(GLenum target, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexEnvfv");
    debug_print_sync("GetTexEnvfv");
    CALL_GetTexEnvfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -31860,7 +31452,7 @@ static void GLAPIENTRY
 _mesa_marshal_BindAttribLocation(GLuint program, GLuint index, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindAttribLocation");
    debug_print_sync("BindAttribLocation");
    CALL_BindAttribLocation(ctx->CurrentServerDispatch, (program, index, name));
 }
@@ -31907,7 +31499,7 @@ _mesa_marshal_TextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage2DEXT");
    debug_print_sync_fallback("TextureStorage2DEXT");
    CALL_TextureStorage2DEXT(ctx->CurrentServerDispatch, (texture, target, levels, internalFormat, width, height));
 }
@@ -31918,7 +31510,7 @@ static void GLAPIENTRY
 _mesa_marshal_TextureParameterIiv(GLuint texture, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureParameterIiv");
    debug_print_sync("TextureParameterIiv");
    CALL_TextureParameterIiv(ctx->CurrentServerDispatch, (texture, pname, params));
 }
@@ -31947,6 +31539,12 @@ _mesa_marshal_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei pri
    size_t cmd_size = sizeof(struct marshal_cmd_DrawTransformFeedbackInstanced);
    struct marshal_cmd_DrawTransformFeedbackInstanced *cmd;
    debug_print_marshal("DrawTransformFeedbackInstanced");
+   if (_mesa_glthread_has_user_arrays(ctx, "DrawTransformFeedbackInstanced")) {
+      _mesa_glthread_finish_before(ctx, "DrawTransformFeedbackInstanced");
+      debug_print_sync_fallback("DrawTransformFeedbackInstanced");
+      CALL_DrawTransformFeedbackInstanced(ctx->CurrentServerDispatch, (mode, id, primcount));
+      return;
+   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawTransformFeedbackInstanced, cmd_size);
       cmd->mode = mode;
@@ -31956,7 +31554,7 @@ _mesa_marshal_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei pri
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTransformFeedbackInstanced");
    debug_print_sync_fallback("DrawTransformFeedbackInstanced");
    CALL_DrawTransformFeedbackInstanced(ctx->CurrentServerDispatch, (mode, id, primcount));
 }
@@ -32003,7 +31601,7 @@ _mesa_marshal_CopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTextureSubImage1D");
    debug_print_sync_fallback("CopyTextureSubImage1D");
    CALL_CopyTextureSubImage1D(ctx->CurrentServerDispatch, (texture, level, xoffset, x, y, width));
 }
@@ -32030,13 +31628,15 @@ _mesa_marshal_ResumeTransformFeedback(void)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ResumeTransformFeedback, cmd_size);
       (void) cmd;
 
+      _mesa_glthread_BeginTransformFeedback(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ResumeTransformFeedback");
    debug_print_sync_fallback("ResumeTransformFeedback");
    CALL_ResumeTransformFeedback(ctx->CurrentServerDispatch, ());
+   _mesa_glthread_BeginTransformFeedback(ctx);
 }
 
 
@@ -32045,7 +31645,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI1iv(GLuint index, const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI1iv");
    debug_print_sync("VertexAttribI1iv");
    CALL_VertexAttribI1iv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -32077,7 +31677,7 @@ _mesa_marshal_Vertex2dv(const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2dv");
    debug_print_sync_fallback("Vertex2dv");
    CALL_Vertex2dv(ctx->CurrentServerDispatch, (v));
 }
@@ -32088,7 +31688,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI2uivEXT(GLuint index, const GLuint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI2uivEXT");
    debug_print_sync("VertexAttribI2uivEXT");
    CALL_VertexAttribI2uivEXT(ctx->CurrentServerDispatch, (index, v));
 }
@@ -32123,7 +31723,7 @@ _mesa_marshal_SampleMaski(GLuint index, GLbitfield mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SampleMaski");
    debug_print_sync_fallback("SampleMaski");
    CALL_SampleMaski(ctx->CurrentServerDispatch, (index, mask));
 }
@@ -32134,7 +31734,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetFloati_v(GLenum target, GLuint index, GLfloat * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFloati_v");
    debug_print_sync("GetFloati_v");
    CALL_GetFloati_v(ctx->CurrentServerDispatch, (target, index, data));
 }
@@ -32169,7 +31769,7 @@ _mesa_marshal_MultiTexCoord2iv(GLenum target, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord2iv");
    debug_print_sync_fallback("MultiTexCoord2iv");
    CALL_MultiTexCoord2iv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -32180,7 +31780,7 @@ static void GLAPIENTRY
 _mesa_marshal_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawPixels");
    debug_print_sync("DrawPixels");
    CALL_DrawPixels(ctx->CurrentServerDispatch, (width, height, format, type, pixels));
 }
@@ -32191,9 +31791,10 @@ static void GLAPIENTRY
 _mesa_marshal_CreateFramebuffers(GLsizei n, GLuint * framebuffers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateFramebuffers");
    debug_print_sync("CreateFramebuffers");
    CALL_CreateFramebuffers(ctx->CurrentServerDispatch, (n, framebuffers));
+   _mesa_glthread_GenFramebuffers(ctx, n, framebuffers);
 }
 
 
@@ -32218,6 +31819,12 @@ _mesa_marshal_DrawTransformFeedback(GLenum mode, GLuint id)
    size_t cmd_size = sizeof(struct marshal_cmd_DrawTransformFeedback);
    struct marshal_cmd_DrawTransformFeedback *cmd;
    debug_print_marshal("DrawTransformFeedback");
+   if (_mesa_glthread_has_user_arrays(ctx, "DrawTransformFeedback")) {
+      _mesa_glthread_finish_before(ctx, "DrawTransformFeedback");
+      debug_print_sync_fallback("DrawTransformFeedback");
+      CALL_DrawTransformFeedback(ctx->CurrentServerDispatch, (mode, id));
+      return;
+   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawTransformFeedback, cmd_size);
       cmd->mode = mode;
@@ -32226,7 +31833,7 @@ _mesa_marshal_DrawTransformFeedback(GLenum mode, GLuint id)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTransformFeedback");
    debug_print_sync_fallback("DrawTransformFeedback");
    CALL_DrawTransformFeedback(ctx->CurrentServerDispatch, (mode, id));
 }
@@ -32273,7 +31880,7 @@ _mesa_marshal_VertexAttribs3fvNV(GLuint index, GLsizei n, const GLfloat * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs3fvNV");
    debug_print_sync_fallback("VertexAttribs3fvNV");
    CALL_VertexAttribs3fvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -32284,7 +31891,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_GenLists(GLsizei range)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenLists");
    debug_print_sync("GenLists");
    return CALL_GenLists(ctx->CurrentServerDispatch, (range));
 }
@@ -32334,7 +31941,7 @@ _mesa_marshal_ProgramUniform2ui64vARB(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2ui64vARB");
    debug_print_sync_fallback("ProgramUniform2ui64vARB");
    CALL_ProgramUniform2ui64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -32381,7 +31988,7 @@ _mesa_marshal_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapGrid2d");
    debug_print_sync_fallback("MapGrid2d");
    CALL_MapGrid2d(ctx->CurrentServerDispatch, (un, u1, u2, vn, v1, v2));
 }
@@ -32428,7 +32035,7 @@ _mesa_marshal_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MapGrid2f");
    debug_print_sync_fallback("MapGrid2f");
    CALL_MapGrid2f(ctx->CurrentServerDispatch, (un, u1, u2, vn, v1, v2));
 }
@@ -32466,7 +32073,7 @@ _mesa_marshal_SampleMapATI(GLuint dst, GLuint interp, GLenum swizzle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SampleMapATI");
    debug_print_sync_fallback("SampleMapATI");
    CALL_SampleMapATI(ctx->CurrentServerDispatch, (dst, interp, swizzle));
 }
@@ -32477,7 +32084,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveAttrib(GLuint program, GLuint index, GLsizei  bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveAttrib");
    debug_print_sync("GetActiveAttrib");
    CALL_GetActiveAttrib(ctx->CurrentServerDispatch, (program, index, bufSize, length, size, type, name));
 }
@@ -32488,7 +32095,7 @@ static void GLAPIENTRY
 _mesa_marshal_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelMapfv");
    debug_print_sync("PixelMapfv");
    CALL_PixelMapfv(ctx->CurrentServerDispatch, (map, mapsize, values));
 }
@@ -32499,7 +32106,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearBufferData");
    debug_print_sync("ClearBufferData");
    CALL_ClearBufferData(ctx->CurrentServerDispatch, (target, internalformat, format, type, data));
 }
@@ -32531,7 +32138,7 @@ _mesa_marshal_Color3usv(const GLushort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3usv");
    debug_print_sync_fallback("Color3usv");
    CALL_Color3usv(ctx->CurrentServerDispatch, (v));
 }
@@ -32605,7 +32212,7 @@ _mesa_marshal_CopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyImageSubData");
    debug_print_sync_fallback("CopyImageSubData");
    CALL_CopyImageSubData(ctx->CurrentServerDispatch, (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth));
 }
@@ -32646,7 +32253,7 @@ _mesa_marshal_StencilOpSeparate(GLenum face, GLenum sfail, GLenum zfail, GLenum
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilOpSeparate");
    debug_print_sync_fallback("StencilOpSeparate");
    CALL_StencilOpSeparate(ctx->CurrentServerDispatch, (face, sfail, zfail, zpass));
 }
@@ -32657,7 +32264,7 @@ static void GLAPIENTRY
 _mesa_marshal_GenSamplers(GLsizei count, GLuint * samplers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenSamplers");
    debug_print_sync("GenSamplers");
    CALL_GenSamplers(ctx->CurrentServerDispatch, (count, samplers));
 }
@@ -32692,7 +32299,7 @@ _mesa_marshal_ClipControl(GLenum origin, GLenum depth)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClipControl");
    debug_print_sync_fallback("ClipControl");
    CALL_ClipControl(ctx->CurrentServerDispatch, (origin, depth));
 }
@@ -32736,7 +32343,7 @@ _mesa_marshal_DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloa
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexfOES");
    debug_print_sync_fallback("DrawTexfOES");
    CALL_DrawTexfOES(ctx->CurrentServerDispatch, (x, y, z, width, height));
 }
@@ -32783,7 +32390,7 @@ _mesa_marshal_Uniform4i64vARB(GLint location, GLsizei count, const GLint64 * val
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4i64vARB");
    debug_print_sync_fallback("Uniform4i64vARB");
    CALL_Uniform4i64vARB(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -32818,7 +32425,7 @@ _mesa_marshal_AttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AttachObjectARB");
    debug_print_sync_fallback("AttachObjectARB");
    CALL_AttachObjectARB(ctx->CurrentServerDispatch, (containerObj, obj));
 }
@@ -32853,7 +32460,7 @@ _mesa_marshal_Accum(GLenum op, GLfloat value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Accum");
    debug_print_sync_fallback("Accum");
    CALL_Accum(ctx->CurrentServerDispatch, (op, value));
 }
@@ -32864,7 +32471,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexImage");
    debug_print_sync("GetTexImage");
    CALL_GetTexImage(ctx->CurrentServerDispatch, (target, level, format, type, pixels));
 }
@@ -32905,7 +32512,7 @@ _mesa_marshal_Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4x");
    debug_print_sync_fallback("Color4x");
    CALL_Color4x(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -32916,7 +32523,7 @@ static void GLAPIENTRY
 _mesa_marshal_ConvolutionParameteriv(GLenum target, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ConvolutionParameteriv");
    debug_print_sync("ConvolutionParameteriv");
    CALL_ConvolutionParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -32957,7 +32564,7 @@ _mesa_marshal_Color4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4s");
    debug_print_sync_fallback("Color4s");
    CALL_Color4s(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -32985,13 +32592,15 @@ _mesa_marshal_EnableVertexAttribArray(GLuint index)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_EnableVertexAttribArray, cmd_size);
       cmd->index = index;
+      _mesa_glthread_VertexAttribArray(ctx, index, true);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EnableVertexAttribArray");
    debug_print_sync_fallback("EnableVertexAttribArray");
    CALL_EnableVertexAttribArray(ctx->CurrentServerDispatch, (index));
+   _mesa_glthread_VertexAttribArray(ctx, index, true);
 }
 
 
@@ -33030,7 +32639,7 @@ _mesa_marshal_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4i");
    debug_print_sync_fallback("Color4i");
    CALL_Color4i(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -33071,7 +32680,7 @@ _mesa_marshal_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4f");
    debug_print_sync_fallback("Color4f");
    CALL_Color4f(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -33109,7 +32718,7 @@ _mesa_marshal_ShaderStorageBlockBinding(GLuint program, GLuint shaderStorageBloc
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ShaderStorageBlockBinding");
    debug_print_sync_fallback("ShaderStorageBlockBinding");
    CALL_ShaderStorageBlockBinding(ctx->CurrentServerDispatch, (program, shaderStorageBlockIndex, shaderStorageBlockBinding));
 }
@@ -33150,7 +32759,7 @@ _mesa_marshal_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alph
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4d");
    debug_print_sync_fallback("Color4d");
    CALL_Color4d(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -33191,7 +32800,7 @@ _mesa_marshal_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4b");
    debug_print_sync_fallback("Color4b");
    CALL_Color4b(ctx->CurrentServerDispatch, (red, green, blue, alpha));
 }
@@ -33202,7 +32811,7 @@ static void GLAPIENTRY
 _mesa_marshal_MemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MemoryObjectParameterivEXT");
    debug_print_sync("MemoryObjectParameterivEXT");
    CALL_MemoryObjectParameterivEXT(ctx->CurrentServerDispatch, (memoryObject, pname, params));
 }
@@ -33213,7 +32822,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxLength, GLsizei * length, GLhandleARB * infoLog)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetAttachedObjectsARB");
    debug_print_sync("GetAttachedObjectsARB");
    CALL_GetAttachedObjectsARB(ctx->CurrentServerDispatch, (containerObj, maxLength, length, infoLog));
 }
@@ -33245,7 +32854,7 @@ _mesa_marshal_EvalCoord1fv(const GLfloat * u)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord1fv");
    debug_print_sync_fallback("EvalCoord1fv");
    CALL_EvalCoord1fv(ctx->CurrentServerDispatch, (u));
 }
@@ -33282,13 +32891,15 @@ _mesa_marshal_VertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, G
       cmd->size = size;
       cmd->type = type;
       cmd->relativeoffset = relativeoffset;
+      _mesa_glthread_invalidate_arrays(ctx);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribLFormat");
    debug_print_sync_fallback("VertexAttribLFormat");
    CALL_VertexAttribLFormat(ctx->CurrentServerDispatch, (attribindex, size, type, relativeoffset));
+   _mesa_glthread_invalidate_arrays(ctx);
 }
 
 
@@ -33327,7 +32938,7 @@ _mesa_marshal_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL3d");
    debug_print_sync_fallback("VertexAttribL3d");
    CALL_VertexAttribL3d(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -33338,7 +32949,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearNamedFramebufferuiv");
    debug_print_sync("ClearNamedFramebufferuiv");
    CALL_ClearNamedFramebufferuiv(ctx->CurrentServerDispatch, (framebuffer, buffer, drawbuffer, value));
 }
@@ -33379,7 +32990,7 @@ _mesa_marshal_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint ma
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "StencilFuncSeparate");
    debug_print_sync_fallback("StencilFuncSeparate");
    CALL_StencilFuncSeparate(ctx->CurrentServerDispatch, (face, func, ref, mask));
 }
@@ -33411,7 +33022,7 @@ _mesa_marshal_Normal3fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Normal3fv");
    debug_print_sync_fallback("Normal3fv");
    CALL_Normal3fv(ctx->CurrentServerDispatch, (v));
 }
@@ -33446,7 +33057,7 @@ _mesa_marshal_NormalP3ui(GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NormalP3ui");
    debug_print_sync_fallback("NormalP3ui");
    CALL_NormalP3ui(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -33457,7 +33068,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreateSamplers(GLsizei n, GLuint * samplers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateSamplers");
    debug_print_sync("CreateSamplers");
    CALL_CreateSamplers(ctx->CurrentServerDispatch, (n, samplers));
 }
@@ -33492,7 +33103,7 @@ _mesa_marshal_MultiTexCoord3fvARB(GLenum target, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord3fvARB");
    debug_print_sync_fallback("MultiTexCoord3fvARB");
    CALL_MultiTexCoord3fvARB(ctx->CurrentServerDispatch, (target, v));
 }
@@ -33503,7 +33114,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexSubImage2D");
    debug_print_sync("TexSubImage2D");
    CALL_TexSubImage2D(ctx->CurrentServerDispatch, (target, level, xoffset, yoffset, width, height, format, type, pixels));
 }
@@ -33514,7 +33125,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexGenfv(GLenum coord, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexGenfv");
    debug_print_sync("TexGenfv");
    CALL_TexGenfv(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -33525,7 +33136,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribiv(GLuint index, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribiv");
    debug_print_sync("GetVertexAttribiv");
    CALL_GetVertexAttribiv(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -33536,7 +33147,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexCoordP2uiv(GLenum type, const GLuint * coords)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordP2uiv");
    debug_print_sync("TexCoordP2uiv");
    CALL_TexCoordP2uiv(ctx->CurrentServerDispatch, (type, coords));
 }
@@ -33583,7 +33194,7 @@ _mesa_marshal_Uniform3fv(GLint location, GLsizei count, const GLfloat * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3fv");
    debug_print_sync_fallback("Uniform3fv");
    CALL_Uniform3fv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -33615,7 +33226,7 @@ _mesa_marshal_BlendEquation(GLenum mode)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendEquation");
    debug_print_sync_fallback("BlendEquation");
    CALL_BlendEquation(ctx->CurrentServerDispatch, (mode));
 }
@@ -33656,7 +33267,7 @@ _mesa_marshal_VertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3dNV");
    debug_print_sync_fallback("VertexAttrib3dNV");
    CALL_VertexAttrib3dNV(ctx->CurrentServerDispatch, (index, x, y, z));
 }
@@ -33688,7 +33299,7 @@ _mesa_marshal_PushName(GLuint name)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PushName");
    debug_print_sync_fallback("PushName");
    CALL_PushName(ctx->CurrentServerDispatch, (name));
 }
@@ -33727,14 +33338,16 @@ _mesa_marshal_DeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers)
       char *variable_data = (char *) (cmd + 1);
       memcpy(variable_data, renderbuffers, n * 4);
       variable_data += n * 4;
+      _mesa_glthread_DeleteRenderbuffers(ctx, n, renderbuffers);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteRenderbuffers");
    debug_print_sync_fallback("DeleteRenderbuffers");
    CALL_DeleteRenderbuffers(ctx->CurrentServerDispatch, (n, renderbuffers));
+   _mesa_glthread_DeleteRenderbuffers(ctx, n, renderbuffers);
 }
 
 
@@ -33767,7 +33380,7 @@ _mesa_marshal_VertexAttrib1dv(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1dv");
    debug_print_sync_fallback("VertexAttrib1dv");
    CALL_VertexAttrib1dv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -33778,7 +33391,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsShader(GLuint shader)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsShader");
    debug_print_sync("IsShader");
    return CALL_IsShader(ctx->CurrentServerDispatch, (shader));
 }
@@ -33819,7 +33432,7 @@ _mesa_marshal_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rotated");
    debug_print_sync_fallback("Rotated");
    CALL_Rotated(ctx->CurrentServerDispatch, (angle, x, y, z));
 }
@@ -33851,7 +33464,7 @@ _mesa_marshal_Color4iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4iv");
    debug_print_sync_fallback("Color4iv");
    CALL_Color4iv(ctx->CurrentServerDispatch, (v));
 }
@@ -33862,7 +33475,7 @@ static void GLAPIENTRY
 _mesa_marshal_PointParameterxv(GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PointParameterxv");
    debug_print_sync("PointParameterxv");
    CALL_PointParameterxv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -33903,7 +33516,7 @@ _mesa_marshal_Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rotatex");
    debug_print_sync_fallback("Rotatex");
    CALL_Rotatex(ctx->CurrentServerDispatch, (angle, x, y, z));
 }
@@ -33947,7 +33560,7 @@ _mesa_marshal_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint t
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FramebufferTextureLayer");
    debug_print_sync_fallback("FramebufferTextureLayer");
    CALL_FramebufferTextureLayer(ctx->CurrentServerDispatch, (target, attachment, texture, level, layer));
 }
@@ -33958,7 +33571,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexEnvfv(GLenum target, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexEnvfv");
    debug_print_sync("TexEnvfv");
    CALL_TexEnvfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -34011,7 +33624,7 @@ _mesa_marshal_ProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix3fv");
    debug_print_sync_fallback("ProgramUniformMatrix3fv");
    CALL_ProgramUniformMatrix3fv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -34022,7 +33635,7 @@ static void GLAPIENTRY
 _mesa_marshal_DeleteMemoryObjectsEXT(GLsizei n, const GLuint * memoryObjects)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteMemoryObjectsEXT");
    debug_print_sync("DeleteMemoryObjectsEXT");
    CALL_DeleteMemoryObjectsEXT(ctx->CurrentServerDispatch, (n, memoryObjects));
 }
@@ -34054,7 +33667,7 @@ _mesa_marshal_LoadMatrixf(const GLfloat * m)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LoadMatrixf");
    debug_print_sync_fallback("LoadMatrixf");
    CALL_LoadMatrixf(ctx->CurrentServerDispatch, (m));
 }
@@ -34065,7 +33678,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramLocalParameterfvARB");
    debug_print_sync("GetProgramLocalParameterfvARB");
    CALL_GetProgramLocalParameterfvARB(ctx->CurrentServerDispatch, (target, index, params));
 }
@@ -34097,7 +33710,7 @@ _mesa_marshal_MakeTextureHandleResidentARB(GLuint64 handle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MakeTextureHandleResidentARB");
    debug_print_sync_fallback("MakeTextureHandleResidentARB");
    CALL_MakeTextureHandleResidentARB(ctx->CurrentServerDispatch, (handle));
 }
@@ -34108,69 +33721,12 @@ static void GLAPIENTRY
 _mesa_marshal_MultiDrawArraysIndirect(GLenum mode, const GLvoid * indirect, GLsizei primcount, GLsizei stride)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawArraysIndirect");
    debug_print_sync("MultiDrawArraysIndirect");
    CALL_MultiDrawArraysIndirect(ctx->CurrentServerDispatch, (mode, indirect, primcount, stride));
 }
 
 
-/* DrawRangeElementsBaseVertex: marshalled asynchronously */
-struct marshal_cmd_DrawRangeElementsBaseVertex
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLuint start;
-   GLuint end;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-   GLint basevertex;
-};
-static inline void
-_mesa_unmarshal_DrawRangeElementsBaseVertex(struct gl_context *ctx, const struct marshal_cmd_DrawRangeElementsBaseVertex *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLuint start = cmd->start;
-   const GLuint end = cmd->end;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   const GLint basevertex = cmd->basevertex;
-   CALL_DrawRangeElementsBaseVertex(ctx->CurrentServerDispatch, (mode, start, end, count, type, indices, basevertex));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices, GLint basevertex)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawRangeElementsBaseVertex);
-   struct marshal_cmd_DrawRangeElementsBaseVertex *cmd;
-   debug_print_marshal("DrawRangeElementsBaseVertex");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawRangeElementsBaseVertex");
-      CALL_DrawRangeElementsBaseVertex(ctx->CurrentServerDispatch, (mode, start, end, count, type, indices, basevertex));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawRangeElementsBaseVertex, cmd_size);
-      cmd->mode = mode;
-      cmd->start = start;
-      cmd->end = end;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      cmd->basevertex = basevertex;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawRangeElementsBaseVertex");
-   CALL_DrawRangeElementsBaseVertex(ctx->CurrentServerDispatch, (mode, start, end, count, type, indices, basevertex));
-}
-
-
 /* ProgramUniformMatrix4dv: marshalled asynchronously */
 struct marshal_cmd_ProgramUniformMatrix4dv
 {
@@ -34218,7 +33774,7 @@ _mesa_marshal_ProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix4dv");
    debug_print_sync_fallback("ProgramUniformMatrix4dv");
    CALL_ProgramUniformMatrix4dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -34250,7 +33806,7 @@ _mesa_marshal_SecondaryColor3bv(const GLbyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColor3bv");
    debug_print_sync_fallback("SecondaryColor3bv");
    CALL_SecondaryColor3bv(ctx->CurrentServerDispatch, (v));
 }
@@ -34282,7 +33838,7 @@ _mesa_marshal_DrawTexxvOES(const GLfixed * coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTexxvOES");
    debug_print_sync_fallback("DrawTexxvOES");
    CALL_DrawTexxvOES(ctx->CurrentServerDispatch, (coords));
 }
@@ -34293,7 +33849,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexParameterfv(GLenum target, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexParameterfv");
    debug_print_sync("TexParameterfv");
    CALL_TexParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -34325,7 +33881,7 @@ _mesa_marshal_Color4ubv(const GLubyte * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4ubv");
    debug_print_sync_fallback("Color4ubv");
    CALL_Color4ubv(ctx->CurrentServerDispatch, (v));
 }
@@ -34357,7 +33913,7 @@ _mesa_marshal_TexCoord2fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord2fv");
    debug_print_sync_fallback("TexCoord2fv");
    CALL_TexCoord2fv(ctx->CurrentServerDispatch, (v));
 }
@@ -34389,7 +33945,7 @@ _mesa_marshal_FogCoorddv(const GLdouble * coord)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FogCoorddv");
    debug_print_sync_fallback("FogCoorddv");
    CALL_FogCoorddv(ctx->CurrentServerDispatch, (coord));
 }
@@ -34421,7 +33977,7 @@ _mesa_marshal_VDPAUUnregisterSurfaceNV(GLintptr surface)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VDPAUUnregisterSurfaceNV");
    debug_print_sync_fallback("VDPAUUnregisterSurfaceNV");
    CALL_VDPAUUnregisterSurfaceNV(ctx->CurrentServerDispatch, (surface));
 }
@@ -34456,7 +34012,7 @@ _mesa_marshal_ColorP3ui(GLenum type, GLuint color)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorP3ui");
    debug_print_sync_fallback("ColorP3ui");
    CALL_ColorP3ui(ctx->CurrentServerDispatch, (type, color));
 }
@@ -34467,7 +34023,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUnsignedBytei_vEXT");
    debug_print_sync("GetUnsignedBytei_vEXT");
    CALL_GetUnsignedBytei_vEXT(ctx->CurrentServerDispatch, (target, index, data));
 }
@@ -34478,7 +34034,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetShaderPrecisionFormat");
    debug_print_sync("GetShaderPrecisionFormat");
    CALL_GetShaderPrecisionFormat(ctx->CurrentServerDispatch, (shadertype, precisiontype, range, precision));
 }
@@ -34510,7 +34066,7 @@ _mesa_marshal_MakeTextureHandleNonResidentARB(GLuint64 handle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MakeTextureHandleNonResidentARB");
    debug_print_sync_fallback("MakeTextureHandleNonResidentARB");
    CALL_MakeTextureHandleNonResidentARB(ctx->CurrentServerDispatch, (handle));
 }
@@ -34554,7 +34110,7 @@ _mesa_marshal_VertexAttribI4iEXT(GLuint index, GLint x, GLint y, GLint z, GLint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI4iEXT");
    debug_print_sync_fallback("VertexAttribI4iEXT");
    CALL_VertexAttribI4iEXT(ctx->CurrentServerDispatch, (index, x, y, z, w));
 }
@@ -34565,7 +34121,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI3uivEXT(GLuint index, const GLuint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI3uivEXT");
    debug_print_sync("VertexAttribI3uivEXT");
    CALL_VertexAttribI3uivEXT(ctx->CurrentServerDispatch, (index, v));
 }
@@ -34597,7 +34153,7 @@ _mesa_marshal_FogCoordd(GLdouble coord)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "FogCoordd");
    debug_print_sync_fallback("FogCoordd");
    CALL_FogCoordd(ctx->CurrentServerDispatch, (coord));
 }
@@ -34628,13 +34184,15 @@ _mesa_marshal_BindFramebufferEXT(GLenum target, GLuint framebuffer)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindFramebufferEXT, cmd_size);
       cmd->target = target;
       cmd->framebuffer = framebuffer;
+      _mesa_glthread_BindFramebuffer(ctx, target, framebuffer, true);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindFramebufferEXT");
    debug_print_sync_fallback("BindFramebufferEXT");
    CALL_BindFramebufferEXT(ctx->CurrentServerDispatch, (target, framebuffer));
+   _mesa_glthread_BindFramebuffer(ctx, target, framebuffer, true);
 }
 
 
@@ -34679,7 +34237,7 @@ _mesa_marshal_Uniform3iv(GLint location, GLsizei count, const GLint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform3iv");
    debug_print_sync_fallback("Uniform3iv");
    CALL_Uniform3iv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -34726,7 +34284,7 @@ _mesa_marshal_TexStorage2DMultisample(GLenum target, GLsizei samples, GLenum int
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorage2DMultisample");
    debug_print_sync_fallback("TexStorage2DMultisample");
    CALL_TexStorage2DMultisample(ctx->CurrentServerDispatch, (target, samples, internalformat, width, height, fixedsamplelocations));
 }
@@ -34757,7 +34315,7 @@ _mesa_marshal_UnlockArraysEXT(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UnlockArraysEXT");
    debug_print_sync_fallback("UnlockArraysEXT");
    CALL_UnlockArraysEXT(ctx->CurrentServerDispatch, ());
 }
@@ -34768,7 +34326,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribLui64vARB(GLuint index, GLenum pname, GLuint64EXT * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribLui64vARB");
    debug_print_sync("GetVertexAttribLui64vARB");
    CALL_GetVertexAttribLui64vARB(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -34803,7 +34361,7 @@ _mesa_marshal_VertexAttrib4iv(GLuint index, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4iv");
    debug_print_sync_fallback("VertexAttrib4iv");
    CALL_VertexAttrib4iv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -34859,7 +34417,7 @@ _mesa_marshal_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTexSubImage3D");
    debug_print_sync_fallback("CopyTexSubImage3D");
    CALL_CopyTexSubImage3D(ctx->CurrentServerDispatch, (target, level, xoffset, yoffset, zoffset, x, y, width, height));
 }
@@ -34897,7 +34455,7 @@ _mesa_marshal_PolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat clamp
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PolygonOffsetClampEXT");
    debug_print_sync_fallback("PolygonOffsetClampEXT");
    CALL_PolygonOffsetClampEXT(ctx->CurrentServerDispatch, (factor, units, clamp));
 }
@@ -34908,7 +34466,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetInteger64v(GLenum pname, GLint64 * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetInteger64v");
    debug_print_sync("GetInteger64v");
    CALL_GetInteger64v(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -34943,7 +34501,7 @@ _mesa_marshal_DetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DetachObjectARB");
    debug_print_sync_fallback("DetachObjectARB");
    CALL_DetachObjectARB(ctx->CurrentServerDispatch, (containerObj, attachedObj));
 }
@@ -34975,7 +34533,7 @@ _mesa_marshal_Indexiv(const GLint * c)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Indexiv");
    debug_print_sync_fallback("Indexiv");
    CALL_Indexiv(ctx->CurrentServerDispatch, (c));
 }
@@ -35013,7 +34571,7 @@ _mesa_marshal_TexEnvi(GLenum target, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexEnvi");
    debug_print_sync_fallback("TexEnvi");
    CALL_TexEnvi(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -35051,7 +34609,7 @@ _mesa_marshal_TexEnvf(GLenum target, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexEnvf");
    debug_print_sync_fallback("TexEnvf");
    CALL_TexEnvf(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -35089,7 +34647,7 @@ _mesa_marshal_TexEnvx(GLenum target, GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexEnvx");
    debug_print_sync_fallback("TexEnvx");
    CALL_TexEnvx(ctx->CurrentServerDispatch, (target, pname, param));
 }
@@ -35127,7 +34685,7 @@ _mesa_marshal_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "InvalidateBufferSubData");
    debug_print_sync_fallback("InvalidateBufferSubData");
    CALL_InvalidateBufferSubData(ctx->CurrentServerDispatch, (buffer, offset, length));
 }
@@ -35177,7 +34735,7 @@ _mesa_marshal_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix4x2fv");
    debug_print_sync_fallback("UniformMatrix4x2fv");
    CALL_UniformMatrix4x2fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -35188,7 +34746,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearTexImage");
    debug_print_sync("ClearTexImage");
    CALL_ClearTexImage(ctx->CurrentServerDispatch, (texture, level, format, type, data));
 }
@@ -35223,7 +34781,7 @@ _mesa_marshal_PolygonOffset(GLfloat factor, GLfloat units)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PolygonOffset");
    debug_print_sync_fallback("PolygonOffset");
    CALL_PolygonOffset(ctx->CurrentServerDispatch, (factor, units));
 }
@@ -35234,7 +34792,7 @@ static void GLAPIENTRY
 _mesa_marshal_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SamplerParameterfv");
    debug_print_sync("SamplerParameterfv");
    CALL_SamplerParameterfv(ctx->CurrentServerDispatch, (sampler, pname, params));
 }
@@ -35245,7 +34803,7 @@ static void GLAPIENTRY
 _mesa_marshal_CompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CompressedTextureSubImage1D");
    debug_print_sync("CompressedTextureSubImage1D");
    CALL_CompressedTextureSubImage1D(ctx->CurrentServerDispatch, (texture, level, xoffset, width, format, imageSize, data));
 }
@@ -35298,7 +34856,7 @@ _mesa_marshal_ProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix4x2dv");
    debug_print_sync_fallback("ProgramUniformMatrix4x2dv");
    CALL_ProgramUniformMatrix4x2dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -35345,7 +34903,7 @@ _mesa_marshal_ProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramEnvParameter4fARB");
    debug_print_sync_fallback("ProgramEnvParameter4fARB");
    CALL_ProgramEnvParameter4fARB(ctx->CurrentServerDispatch, (target, index, x, y, z, w));
 }
@@ -35377,7 +34935,7 @@ _mesa_marshal_ClearDepth(GLclampd depth)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearDepth");
    debug_print_sync_fallback("ClearDepth");
    CALL_ClearDepth(ctx->CurrentServerDispatch, (depth));
 }
@@ -35412,7 +34970,7 @@ _mesa_marshal_VertexAttrib3dvNV(GLuint index, const GLdouble * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3dvNV");
    debug_print_sync_fallback("VertexAttrib3dvNV");
    CALL_VertexAttrib3dvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -35444,7 +35002,7 @@ _mesa_marshal_Color4fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color4fv");
    debug_print_sync_fallback("Color4fv");
    CALL_Color4fv(ctx->CurrentServerDispatch, (v));
 }
@@ -35455,7 +35013,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetnMinmaxARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, GLvoid * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetnMinmaxARB");
    debug_print_sync("GetnMinmaxARB");
    CALL_GetnMinmaxARB(ctx->CurrentServerDispatch, (target, reset, format, type, bufSize, values));
 }
@@ -35466,7 +35024,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsImageHandleResidentARB(GLuint64 handle)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsImageHandleResidentARB");
    debug_print_sync("IsImageHandleResidentARB");
    return CALL_IsImageHandleResidentARB(ctx->CurrentServerDispatch, (handle));
 }
@@ -35497,26 +35055,21 @@ _mesa_marshal_ColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid
    size_t cmd_size = sizeof(struct marshal_cmd_ColorPointer);
    struct marshal_cmd_ColorPointer *cmd;
    debug_print_marshal("ColorPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("ColorPointer");
-      CALL_ColorPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ColorPointer, cmd_size);
       cmd->size = size;
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR0, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorPointer");
    debug_print_sync_fallback("ColorPointer");
    CALL_ColorPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR0, size, type, stride, pointer);
 }
 
 
@@ -35555,7 +35108,7 @@ _mesa_marshal_ProgramUniform2ui64ARB(GLuint program, GLint location, GLuint64 x,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform2ui64ARB");
    debug_print_sync_fallback("ProgramUniform2ui64ARB");
    CALL_ProgramUniform2ui64ARB(ctx->CurrentServerDispatch, (program, location, x, y));
 }
@@ -35566,7 +35119,7 @@ static void GLAPIENTRY
 _mesa_marshal_Lightiv(GLenum light, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Lightiv");
    debug_print_sync("Lightiv");
    CALL_Lightiv(ctx->CurrentServerDispatch, (light, pname, params));
 }
@@ -35577,7 +35130,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexParameterIuiv");
    debug_print_sync("GetTexParameterIuiv");
    CALL_GetTexParameterIuiv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -35588,7 +35141,7 @@ static void GLAPIENTRY
 _mesa_marshal_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar * const * varyings, GLenum bufferMode)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TransformFeedbackVaryings");
    debug_print_sync("TransformFeedbackVaryings");
    CALL_TransformFeedbackVaryings(ctx->CurrentServerDispatch, (program, count, varyings, bufferMode));
 }
@@ -35623,7 +35176,7 @@ _mesa_marshal_VertexAttrib3sv(GLuint index, const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3sv");
    debug_print_sync_fallback("VertexAttrib3sv");
    CALL_VertexAttrib3sv(ctx->CurrentServerDispatch, (index, v));
 }
@@ -35667,7 +35220,7 @@ _mesa_marshal_Uniform4i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z, GL
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4i64ARB");
    debug_print_sync_fallback("Uniform4i64ARB");
    CALL_Uniform4i64ARB(ctx->CurrentServerDispatch, (location, x, y, z, w));
 }
@@ -35678,7 +35231,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsVertexArray(GLuint array)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsVertexArray");
    debug_print_sync("IsVertexArray");
    return CALL_IsVertexArray(ctx->CurrentServerDispatch, (array));
 }
@@ -35722,7 +35275,7 @@ _mesa_marshal_ProgramUniform3ui64ARB(GLuint program, GLint location, GLuint64 x,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3ui64ARB");
    debug_print_sync_fallback("ProgramUniform3ui64ARB");
    CALL_ProgramUniform3ui64ARB(ctx->CurrentServerDispatch, (program, location, x, y, z));
 }
@@ -35754,7 +35307,7 @@ _mesa_marshal_PushClientAttrib(GLbitfield mask)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PushClientAttrib");
    debug_print_sync_fallback("PushClientAttrib");
    CALL_PushClientAttrib(ctx->CurrentServerDispatch, (mask));
 }
@@ -35801,7 +35354,7 @@ _mesa_marshal_ProgramUniform4ui(GLuint program, GLint location, GLuint x, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4ui");
    debug_print_sync_fallback("ProgramUniform4ui");
    CALL_ProgramUniform4ui(ctx->CurrentServerDispatch, (program, location, x, y, z, w));
 }
@@ -35836,7 +35389,7 @@ _mesa_marshal_Uniform1f(GLint location, GLfloat v0)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1f");
    debug_print_sync_fallback("Uniform1f");
    CALL_Uniform1f(ctx->CurrentServerDispatch, (location, v0));
 }
@@ -35871,7 +35424,7 @@ _mesa_marshal_Uniform1d(GLint location, GLdouble x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1d");
    debug_print_sync_fallback("Uniform1d");
    CALL_Uniform1d(ctx->CurrentServerDispatch, (location, x));
 }
@@ -35906,7 +35459,7 @@ _mesa_marshal_Uniform1i(GLint location, GLint v0)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform1i");
    debug_print_sync_fallback("Uniform1i");
    CALL_Uniform1i(ctx->CurrentServerDispatch, (location, v0));
 }
@@ -35917,7 +35470,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPolygonStipple(GLubyte * mask)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPolygonStipple");
    debug_print_sync("GetPolygonStipple");
    CALL_GetPolygonStipple(ctx->CurrentServerDispatch, (mask));
 }
@@ -35982,7 +35535,7 @@ _mesa_marshal_BlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffe
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlitNamedFramebuffer");
    debug_print_sync_fallback("BlitNamedFramebuffer");
    CALL_BlitNamedFramebuffer(ctx->CurrentServerDispatch, (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter));
 }
@@ -36010,13 +35563,15 @@ _mesa_marshal_UseProgram(GLuint program)
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_UseProgram, cmd_size);
       cmd->program = program;
+      _mesa_glthread_UseProgram(ctx, program);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UseProgram");
    debug_print_sync_fallback("UseProgram");
    CALL_UseProgram(ctx->CurrentServerDispatch, (program));
+   _mesa_glthread_UseProgram(ctx, program);
 }
 
 
@@ -36025,7 +35580,7 @@ static GLint GLAPIENTRY
 _mesa_marshal_GetFragDataLocation(GLuint program, const GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFragDataLocation");
    debug_print_sync("GetFragDataLocation");
    return CALL_GetFragDataLocation(ctx->CurrentServerDispatch, (program, name));
 }
@@ -36036,7 +35591,7 @@ static void GLAPIENTRY
 _mesa_marshal_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelMapuiv");
    debug_print_sync("PixelMapuiv");
    CALL_PixelMapuiv(ctx->CurrentServerDispatch, (map, mapsize, values));
 }
@@ -36047,7 +35602,7 @@ static void GLAPIENTRY
 _mesa_marshal_ClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const GLvoid * data)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearNamedBufferSubData");
    debug_print_sync("ClearNamedBufferSubData");
    CALL_ClearNamedBufferSubData(ctx->CurrentServerDispatch, (buffer, internalformat, offset, size, format, type, data));
 }
@@ -36058,7 +35613,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedFramebufferAttachmentParameteriv");
    debug_print_sync("GetNamedFramebufferAttachmentParameteriv");
    CALL_GetNamedFramebufferAttachmentParameteriv(ctx->CurrentServerDispatch, (framebuffer, attachment, pname, params));
 }
@@ -36069,9 +35624,10 @@ static void GLAPIENTRY
 _mesa_marshal_GenVertexArrays(GLsizei n, GLuint * arrays)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenVertexArrays");
    debug_print_sync("GenVertexArrays");
    CALL_GenVertexArrays(ctx->CurrentServerDispatch, (n, arrays));
+   _mesa_glthread_GenVertexArrays(ctx, n, arrays);
 }
 
 
@@ -36122,7 +35678,7 @@ _mesa_marshal_TexStorageMem2DMultisampleEXT(GLenum target, GLsizei samples, GLen
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorageMem2DMultisampleEXT");
    debug_print_sync_fallback("TexStorageMem2DMultisampleEXT");
    CALL_TexStorageMem2DMultisampleEXT(ctx->CurrentServerDispatch, (target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset));
 }
@@ -36160,7 +35716,7 @@ _mesa_marshal_Color3s(GLshort red, GLshort green, GLshort blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3s");
    debug_print_sync_fallback("Color3s");
    CALL_Color3s(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -36207,7 +35763,7 @@ _mesa_marshal_TextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenu
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureStorage2DMultisample");
    debug_print_sync_fallback("TextureStorage2DMultisample");
    CALL_TextureStorage2DMultisample(ctx->CurrentServerDispatch, (texture, samples, internalformat, width, height, fixedsamplelocations));
 }
@@ -36238,26 +35794,21 @@ _mesa_marshal_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLv
    size_t cmd_size = sizeof(struct marshal_cmd_TexCoordPointer);
    struct marshal_cmd_TexCoordPointer *cmd;
    debug_print_marshal("TexCoordPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("TexCoordPointer");
-      CALL_TexCoordPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_TexCoordPointer, cmd_size);
       cmd->size = size;
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_TexCoordPointer(ctx, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoordPointer");
    debug_print_sync_fallback("TexCoordPointer");
    CALL_TexCoordPointer(ctx->CurrentServerDispatch, (size, type, stride, pointer));
+   _mesa_glthread_TexCoordPointer(ctx, size, type, stride, pointer);
 }
 
 
@@ -36293,7 +35844,7 @@ _mesa_marshal_Color3i(GLint red, GLint green, GLint blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3i");
    debug_print_sync_fallback("Color3i");
    CALL_Color3i(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -36328,7 +35879,7 @@ _mesa_marshal_EvalCoord2d(GLdouble u, GLdouble v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord2d");
    debug_print_sync_fallback("EvalCoord2d");
    CALL_EvalCoord2d(ctx->CurrentServerDispatch, (u, v));
 }
@@ -36363,7 +35914,7 @@ _mesa_marshal_EvalCoord2f(GLfloat u, GLfloat v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord2f");
    debug_print_sync_fallback("EvalCoord2f");
    CALL_EvalCoord2f(ctx->CurrentServerDispatch, (u, v));
 }
@@ -36401,7 +35952,7 @@ _mesa_marshal_Color3b(GLbyte red, GLbyte green, GLbyte blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3b");
    debug_print_sync_fallback("Color3b");
    CALL_Color3b(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -36439,7 +35990,7 @@ _mesa_marshal_Color3f(GLfloat red, GLfloat green, GLfloat blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3f");
    debug_print_sync_fallback("Color3f");
    CALL_Color3f(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -36477,7 +36028,7 @@ _mesa_marshal_Color3d(GLdouble red, GLdouble green, GLdouble blue)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3d");
    debug_print_sync_fallback("Color3d");
    CALL_Color3d(ctx->CurrentServerDispatch, (red, green, blue));
 }
@@ -36488,7 +36039,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribdv");
    debug_print_sync("GetVertexAttribdv");
    CALL_GetVertexAttribdv(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -36499,7 +36050,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetBufferPointerv(GLenum target, GLenum pname, GLvoid ** params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetBufferPointerv");
    debug_print_sync("GetBufferPointerv");
    CALL_GetBufferPointerv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -36510,9 +36061,10 @@ static void GLAPIENTRY
 _mesa_marshal_GenFramebuffers(GLsizei n, GLuint * framebuffers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenFramebuffers");
    debug_print_sync("GenFramebuffers");
    CALL_GenFramebuffers(ctx->CurrentServerDispatch, (n, framebuffers));
+   _mesa_glthread_GenFramebuffers(ctx, n, framebuffers);
 }
 
 
@@ -36521,7 +36073,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_IsTextureHandleResidentARB(GLuint64 handle)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "IsTextureHandleResidentARB");
    debug_print_sync("IsTextureHandleResidentARB");
    return CALL_IsTextureHandleResidentARB(ctx->CurrentServerDispatch, (handle));
 }
@@ -36532,9 +36084,10 @@ static void GLAPIENTRY
 _mesa_marshal_GenBuffers(GLsizei n, GLuint * buffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GenBuffers");
    debug_print_sync("GenBuffers");
    CALL_GenBuffers(ctx->CurrentServerDispatch, (n, buffer));
+   _mesa_glthread_GenBuffers(ctx, n, buffer);
 }
 
 
@@ -36564,7 +36117,7 @@ _mesa_marshal_ClearDepthx(GLclampx depth)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClearDepthx");
    debug_print_sync_fallback("ClearDepthx");
    CALL_ClearDepthx(ctx->CurrentServerDispatch, (depth));
 }
@@ -36599,7 +36152,7 @@ _mesa_marshal_EnableVertexArrayAttrib(GLuint vaobj, GLuint index)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EnableVertexArrayAttrib");
    debug_print_sync_fallback("EnableVertexArrayAttrib");
    CALL_EnableVertexArrayAttrib(ctx->CurrentServerDispatch, (vaobj, index));
 }
@@ -36634,7 +36187,7 @@ _mesa_marshal_BlendEquationSeparate(GLenum modeRGB, GLenum modeA)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BlendEquationSeparate");
    debug_print_sync_fallback("BlendEquationSeparate");
    CALL_BlendEquationSeparate(ctx->CurrentServerDispatch, (modeRGB, modeA));
 }
@@ -36672,7 +36225,7 @@ _mesa_marshal_MultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoordP4ui");
    debug_print_sync_fallback("MultiTexCoordP4ui");
    CALL_MultiTexCoordP4ui(ctx->CurrentServerDispatch, (texture, type, coords));
 }
@@ -36719,7 +36272,7 @@ _mesa_marshal_VertexAttribs1fvNV(GLuint index, GLsizei n, const GLfloat * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribs1fvNV");
    debug_print_sync_fallback("VertexAttribs1fvNV");
    CALL_VertexAttribs1fvNV(ctx->CurrentServerDispatch, (index, n, v));
 }
@@ -36752,13 +36305,6 @@ _mesa_marshal_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsize
    size_t cmd_size = sizeof(struct marshal_cmd_VertexAttribIPointer);
    struct marshal_cmd_VertexAttribIPointer *cmd;
    debug_print_marshal("VertexAttribIPointer");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("VertexAttribIPointer");
-      CALL_VertexAttribIPointer(ctx->CurrentServerDispatch, (index, size, type, stride, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexAttribIPointer, cmd_size);
       cmd->index = index;
@@ -36766,13 +36312,15 @@ _mesa_marshal_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsize
       cmd->type = type;
       cmd->stride = stride;
       cmd->pointer = pointer;
+      _mesa_glthread_VertexAttribIPointer(ctx, index, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribIPointer");
    debug_print_sync_fallback("VertexAttribIPointer");
    CALL_VertexAttribIPointer(ctx->CurrentServerDispatch, (index, size, type, stride, pointer));
+   _mesa_glthread_VertexAttribIPointer(ctx, index, size, type, stride, pointer);
 }
 
 
@@ -36820,7 +36368,7 @@ _mesa_marshal_ProgramUniform4fv(GLuint program, GLint location, GLsizei count, c
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform4fv");
    debug_print_sync_fallback("ProgramUniform4fv");
    CALL_ProgramUniform4fv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -36852,7 +36400,7 @@ _mesa_marshal_RasterPos4sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "RasterPos4sv");
    debug_print_sync_fallback("RasterPos4sv");
    CALL_RasterPos4sv(ctx->CurrentServerDispatch, (v));
 }
@@ -36908,7 +36456,7 @@ _mesa_marshal_CopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset,
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTextureSubImage3D");
    debug_print_sync_fallback("CopyTextureSubImage3D");
    CALL_CopyTextureSubImage3D(ctx->CurrentServerDispatch, (texture, level, xoffset, yoffset, zoffset, x, y, width, height));
 }
@@ -36919,7 +36467,7 @@ static void GLAPIENTRY
 _mesa_marshal_SelectBuffer(GLsizei size, GLuint * buffer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SelectBuffer");
    debug_print_sync("SelectBuffer");
    CALL_SelectBuffer(ctx->CurrentServerDispatch, (size, buffer));
 }
@@ -36930,7 +36478,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetSynciv");
    debug_print_sync("GetSynciv");
    CALL_GetSynciv(ctx->CurrentServerDispatch, (sync, pname, bufSize, length, values));
 }
@@ -36983,7 +36531,7 @@ _mesa_marshal_TextureView(GLuint texture, GLenum target, GLuint origtexture, GLe
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TextureView");
    debug_print_sync_fallback("TextureView");
    CALL_TextureView(ctx->CurrentServerDispatch, (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers));
 }
@@ -36994,7 +36542,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexEnviv(GLenum target, GLenum pname, const GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexEnviv");
    debug_print_sync("TexEnviv");
    CALL_TexEnviv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -37005,7 +36553,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexSubImage3D");
    debug_print_sync("TexSubImage3D");
    CALL_TexSubImage3D(ctx->CurrentServerDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels));
 }
@@ -37016,7 +36564,7 @@ static void GLAPIENTRY
 _mesa_marshal_Bitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte * bitmap)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Bitmap");
    debug_print_sync("Bitmap");
    CALL_Bitmap(ctx->CurrentServerDispatch, (width, height, xorig, yorig, xmove, ymove, bitmap));
 }
@@ -37047,13 +36595,15 @@ _mesa_marshal_VertexAttribDivisor(GLuint index, GLuint divisor)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_VertexAttribDivisor, cmd_size);
       cmd->index = index;
       cmd->divisor = divisor;
+      _mesa_glthread_VertexAttribDivisor(ctx, index, divisor);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribDivisor");
    debug_print_sync_fallback("VertexAttribDivisor");
    CALL_VertexAttribDivisor(ctx->CurrentServerDispatch, (index, divisor));
+   _mesa_glthread_VertexAttribDivisor(ctx, index, divisor);
 }
 
 
@@ -37080,6 +36630,12 @@ _mesa_marshal_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
    size_t cmd_size = sizeof(struct marshal_cmd_DrawTransformFeedbackStream);
    struct marshal_cmd_DrawTransformFeedbackStream *cmd;
    debug_print_marshal("DrawTransformFeedbackStream");
+   if (_mesa_glthread_has_user_arrays(ctx, "DrawTransformFeedbackStream")) {
+      _mesa_glthread_finish_before(ctx, "DrawTransformFeedbackStream");
+      debug_print_sync_fallback("DrawTransformFeedbackStream");
+      CALL_DrawTransformFeedbackStream(ctx->CurrentServerDispatch, (mode, id, stream));
+      return;
+   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawTransformFeedbackStream, cmd_size);
       cmd->mode = mode;
@@ -37089,23 +36645,12 @@ _mesa_marshal_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DrawTransformFeedbackStream");
    debug_print_sync_fallback("DrawTransformFeedbackStream");
    CALL_DrawTransformFeedbackStream(ctx->CurrentServerDispatch, (mode, id, stream));
 }
 
 
-/* GetIntegerv: marshalled synchronously */
-static void GLAPIENTRY
-_mesa_marshal_GetIntegerv(GLenum pname, GLint * params)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
-   debug_print_sync("GetIntegerv");
-   CALL_GetIntegerv(ctx->CurrentServerDispatch, (pname, params));
-}
-
-
 /* EndPerfQueryINTEL: marshalled asynchronously */
 struct marshal_cmd_EndPerfQueryINTEL
 {
@@ -37132,7 +36677,7 @@ _mesa_marshal_EndPerfQueryINTEL(GLuint queryHandle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndPerfQueryINTEL");
    debug_print_sync_fallback("EndPerfQueryINTEL");
    CALL_EndPerfQueryINTEL(ctx->CurrentServerDispatch, (queryHandle));
 }
@@ -37173,7 +36718,7 @@ _mesa_marshal_NamedBufferPageCommitmentARB(GLuint buffer, GLintptr offset, GLsiz
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "NamedBufferPageCommitmentARB");
    debug_print_sync_fallback("NamedBufferPageCommitmentARB");
    CALL_NamedBufferPageCommitmentARB(ctx->CurrentServerDispatch, (buffer, offset, size, commit));
 }
@@ -37184,7 +36729,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveUniform");
    debug_print_sync("GetActiveUniform");
    CALL_GetActiveUniform(ctx->CurrentServerDispatch, (program, index, bufSize, length, size, type, name));
 }
@@ -37219,7 +36764,7 @@ _mesa_marshal_AlphaFuncx(GLenum func, GLclampx ref)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AlphaFuncx");
    debug_print_sync_fallback("AlphaFuncx");
    CALL_AlphaFuncx(ctx->CurrentServerDispatch, (func, ref));
 }
@@ -37230,7 +36775,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI2ivEXT(GLuint index, const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI2ivEXT");
    debug_print_sync("VertexAttribI2ivEXT");
    CALL_VertexAttribI2ivEXT(ctx->CurrentServerDispatch, (index, v));
 }
@@ -37241,7 +36786,7 @@ static void GLAPIENTRY
 _mesa_marshal_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Map1d");
    debug_print_sync("Map1d");
    CALL_Map1d(ctx->CurrentServerDispatch, (target, u1, u2, stride, order, points));
 }
@@ -37252,7 +36797,7 @@ static void GLAPIENTRY
 _mesa_marshal_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Map1f");
    debug_print_sync("Map1f");
    CALL_Map1f(ctx->CurrentServerDispatch, (target, u1, u2, stride, order, points));
 }
@@ -37263,7 +36808,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_AreTexturesResident(GLsizei n, const GLuint * textures, GLboolean * residences)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "AreTexturesResident");
    debug_print_sync("AreTexturesResident");
    return CALL_AreTexturesResident(ctx->CurrentServerDispatch, (n, textures, residences));
 }
@@ -37307,7 +36852,7 @@ _mesa_marshal_VertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexArrayVertexBuffer");
    debug_print_sync_fallback("VertexArrayVertexBuffer");
    CALL_VertexArrayVertexBuffer(ctx->CurrentServerDispatch, (vaobj, bindingindex, buffer, offset, stride));
 }
@@ -37342,7 +36887,7 @@ _mesa_marshal_PixelTransferf(GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelTransferf");
    debug_print_sync_fallback("PixelTransferf");
    CALL_PixelTransferf(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -37377,7 +36922,7 @@ _mesa_marshal_PixelTransferi(GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PixelTransferi");
    debug_print_sync_fallback("PixelTransferi");
    CALL_PixelTransferi(ctx->CurrentServerDispatch, (pname, param));
 }
@@ -37388,7 +36933,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei  propCount, const GLenum * props, GLsizei  bufSize, GLsizei * length, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetProgramResourceiv");
    debug_print_sync("GetProgramResourceiv");
    CALL_GetProgramResourceiv(ctx->CurrentServerDispatch, (program, programInterface, index, propCount, props, bufSize, length, params));
 }
@@ -37423,7 +36968,7 @@ _mesa_marshal_VertexAttrib3fvNV(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib3fvNV");
    debug_print_sync_fallback("VertexAttrib3fvNV");
    CALL_VertexAttrib3fvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -37458,7 +37003,7 @@ _mesa_marshal_SecondaryColorP3ui(GLenum type, GLuint color)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SecondaryColorP3ui");
    debug_print_sync_fallback("SecondaryColorP3ui");
    CALL_SecondaryColorP3ui(ctx->CurrentServerDispatch, (type, color));
 }
@@ -37469,9 +37014,10 @@ static void GLAPIENTRY
 _mesa_marshal_BindTextures(GLuint first, GLsizei count, const GLuint * textures)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindTextures");
    debug_print_sync("BindTextures");
    CALL_BindTextures(ctx->CurrentServerDispatch, (first, count, textures));
+   _mesa_glthread_invalidate_state(ctx);
 }
 
 
@@ -37504,7 +37050,7 @@ _mesa_marshal_VertexAttrib4fvNV(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib4fvNV");
    debug_print_sync_fallback("VertexAttrib4fvNV");
    CALL_VertexAttrib4fvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -37539,7 +37085,7 @@ _mesa_marshal_Rectiv(const GLint * v1, const GLint * v2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rectiv");
    debug_print_sync_fallback("Rectiv");
    CALL_Rectiv(ctx->CurrentServerDispatch, (v1, v2));
 }
@@ -37574,7 +37120,7 @@ _mesa_marshal_MultiTexCoord1iv(GLenum target, const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiTexCoord1iv");
    debug_print_sync_fallback("MultiTexCoord1iv");
    CALL_MultiTexCoord1iv(ctx->CurrentServerDispatch, (target, v));
 }
@@ -37612,7 +37158,7 @@ _mesa_marshal_PassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PassTexCoordATI");
    debug_print_sync_fallback("PassTexCoordATI");
    CALL_PassTexCoordATI(ctx->CurrentServerDispatch, (dst, coord, swizzle));
 }
@@ -37644,7 +37190,7 @@ _mesa_marshal_Vertex2fv(const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex2fv");
    debug_print_sync_fallback("Vertex2fv");
    CALL_Vertex2fv(ctx->CurrentServerDispatch, (v));
 }
@@ -37675,13 +37221,15 @@ _mesa_marshal_BindRenderbufferEXT(GLenum target, GLuint renderbuffer)
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_BindRenderbufferEXT, cmd_size);
       cmd->target = target;
       cmd->renderbuffer = renderbuffer;
+      _mesa_glthread_BindRenderbuffer(ctx, target, renderbuffer, true);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindRenderbufferEXT");
    debug_print_sync_fallback("BindRenderbufferEXT");
    CALL_BindRenderbufferEXT(ctx->CurrentServerDispatch, (target, renderbuffer));
+   _mesa_glthread_BindRenderbuffer(ctx, target, renderbuffer, true);
 }
 
 
@@ -37711,7 +37259,7 @@ _mesa_marshal_Vertex3sv(const GLshort * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Vertex3sv");
    debug_print_sync_fallback("Vertex3sv");
    CALL_Vertex3sv(ctx->CurrentServerDispatch, (v));
 }
@@ -37749,7 +37297,7 @@ _mesa_marshal_EvalMesh1(GLenum mode, GLint i1, GLint i2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalMesh1");
    debug_print_sync_fallback("EvalMesh1");
    CALL_EvalMesh1(ctx->CurrentServerDispatch, (mode, i1, i2));
 }
@@ -37796,7 +37344,7 @@ _mesa_marshal_DiscardFramebufferEXT(GLenum target, GLsizei numAttachments, const
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DiscardFramebufferEXT");
    debug_print_sync_fallback("DiscardFramebufferEXT");
    CALL_DiscardFramebufferEXT(ctx->CurrentServerDispatch, (target, numAttachments, attachments));
 }
@@ -37834,7 +37382,7 @@ _mesa_marshal_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2f");
    debug_print_sync_fallback("Uniform2f");
    CALL_Uniform2f(ctx->CurrentServerDispatch, (location, v0, v1));
 }
@@ -37872,7 +37420,7 @@ _mesa_marshal_Uniform2d(GLint location, GLdouble x, GLdouble y)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2d");
    debug_print_sync_fallback("Uniform2d");
    CALL_Uniform2d(ctx->CurrentServerDispatch, (location, x, y));
 }
@@ -37905,13 +37453,6 @@ _mesa_marshal_ColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei c
    size_t cmd_size = sizeof(struct marshal_cmd_ColorPointerEXT);
    struct marshal_cmd_ColorPointerEXT *cmd;
    debug_print_marshal("ColorPointerEXT");
-   if (_mesa_glthread_is_non_vbo_vertex_attrib_pointer(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("ColorPointerEXT");
-      CALL_ColorPointerEXT(ctx->CurrentServerDispatch, (size, type, stride, count, pointer));
-      return;
-   }
    if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
       cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_ColorPointerEXT, cmd_size);
       cmd->size = size;
@@ -37919,13 +37460,15 @@ _mesa_marshal_ColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei c
       cmd->stride = stride;
       cmd->count = count;
       cmd->pointer = pointer;
+      _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR0, size, type, stride, pointer);
       _mesa_post_marshal_hook(ctx);
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ColorPointerEXT");
    debug_print_sync_fallback("ColorPointerEXT");
    CALL_ColorPointerEXT(ctx->CurrentServerDispatch, (size, type, stride, count, pointer));
+   _mesa_glthread_AttribPointer(ctx, VERT_ATTRIB_COLOR0, size, type, stride, pointer);
 }
 
 
@@ -37955,7 +37498,7 @@ _mesa_marshal_LineWidth(GLfloat width)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LineWidth");
    debug_print_sync_fallback("LineWidth");
    CALL_LineWidth(ctx->CurrentServerDispatch, (width));
 }
@@ -37993,7 +37536,7 @@ _mesa_marshal_Uniform2i(GLint location, GLint v0, GLint v1)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform2i");
    debug_print_sync_fallback("Uniform2i");
    CALL_Uniform2i(ctx->CurrentServerDispatch, (location, v0, v1));
 }
@@ -38004,7 +37547,7 @@ static void GLAPIENTRY
 _mesa_marshal_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, const GLint * basevertex)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultiDrawElementsBaseVertex");
    debug_print_sync("MultiDrawElementsBaseVertex");
    CALL_MultiDrawElementsBaseVertex(ctx->CurrentServerDispatch, (mode, count, type, indices, primcount, basevertex));
 }
@@ -38015,7 +37558,7 @@ static void GLAPIENTRY
 _mesa_marshal_Lightxv(GLenum light, GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Lightxv");
    debug_print_sync("Lightxv");
    CALL_Lightxv(ctx->CurrentServerDispatch, (light, pname, params));
 }
@@ -38053,7 +37596,7 @@ _mesa_marshal_DepthRangeIndexed(GLuint index, GLclampd n, GLclampd f)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DepthRangeIndexed");
    debug_print_sync_fallback("DepthRangeIndexed");
    CALL_DepthRangeIndexed(ctx->CurrentServerDispatch, (index, n, f));
 }
@@ -38064,7 +37607,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetConvolutionParameterfv");
    debug_print_sync("GetConvolutionParameterfv");
    CALL_GetConvolutionParameterfv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -38075,7 +37618,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetMaterialfv(GLenum face, GLenum pname, GLfloat * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetMaterialfv");
    debug_print_sync("GetMaterialfv");
    CALL_GetMaterialfv(ctx->CurrentServerDispatch, (face, pname, params));
 }
@@ -38125,7 +37668,7 @@ _mesa_marshal_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum inter
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexImage3DMultisample");
    debug_print_sync_fallback("TexImage3DMultisample");
    CALL_TexImage3DMultisample(ctx->CurrentServerDispatch, (target, samples, internalformat, width, height, depth, fixedsamplelocations));
 }
@@ -38160,7 +37703,7 @@ _mesa_marshal_VertexAttrib1fvNV(GLuint index, const GLfloat * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1fvNV");
    debug_print_sync_fallback("VertexAttrib1fvNV");
    CALL_VertexAttrib1fvNV(ctx->CurrentServerDispatch, (index, v));
 }
@@ -38171,7 +37714,7 @@ static GLuint GLAPIENTRY
 _mesa_marshal_GetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformBlockIndex");
    debug_print_sync("GetUniformBlockIndex");
    return CALL_GetUniformBlockIndex(ctx->CurrentServerDispatch, (program, uniformBlockName));
 }
@@ -38206,7 +37749,7 @@ _mesa_marshal_DetachShader(GLuint program, GLuint shader)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DetachShader");
    debug_print_sync_fallback("DetachShader");
    CALL_DetachShader(ctx->CurrentServerDispatch, (program, shader));
 }
@@ -38259,7 +37802,7 @@ _mesa_marshal_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyTexSubImage2D");
    debug_print_sync_fallback("CopyTexSubImage2D");
    CALL_CopyTexSubImage2D(ctx->CurrentServerDispatch, (target, level, xoffset, yoffset, x, y, width, height));
 }
@@ -38270,7 +37813,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint * param)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetNamedFramebufferParameteriv");
    debug_print_sync("GetNamedFramebufferParameteriv");
    CALL_GetNamedFramebufferParameteriv(ctx->CurrentServerDispatch, (framebuffer, pname, param));
 }
@@ -38281,7 +37824,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetObjectParameterivARB");
    debug_print_sync("GetObjectParameterivARB");
    CALL_GetObjectParameterivARB(ctx->CurrentServerDispatch, (obj, pname, params));
 }
@@ -38313,60 +37856,12 @@ _mesa_marshal_Color3iv(const GLint * v)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Color3iv");
    debug_print_sync_fallback("Color3iv");
    CALL_Color3iv(ctx->CurrentServerDispatch, (v));
 }
 
 
-/* DrawElements: marshalled asynchronously */
-struct marshal_cmd_DrawElements
-{
-   struct marshal_cmd_base cmd_base;
-   GLenum mode;
-   GLsizei count;
-   GLenum type;
-   const GLvoid * indices;
-};
-static inline void
-_mesa_unmarshal_DrawElements(struct gl_context *ctx, const struct marshal_cmd_DrawElements *cmd)
-{
-   const GLenum mode = cmd->mode;
-   const GLsizei count = cmd->count;
-   const GLenum type = cmd->type;
-   const GLvoid * indices = cmd->indices;
-   CALL_DrawElements(ctx->CurrentServerDispatch, (mode, count, type, indices));
-}
-static void GLAPIENTRY
-_mesa_marshal_DrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices)
-{
-   GET_CURRENT_CONTEXT(ctx);
-   size_t cmd_size = sizeof(struct marshal_cmd_DrawElements);
-   struct marshal_cmd_DrawElements *cmd;
-   debug_print_marshal("DrawElements");
-   if (_mesa_glthread_is_non_vbo_draw_elements(ctx)) {
-      _mesa_glthread_finish(ctx);
-      _mesa_glthread_restore_dispatch(ctx);
-      debug_print_sync_fallback("DrawElements");
-      CALL_DrawElements(ctx->CurrentServerDispatch, (mode, count, type, indices));
-      return;
-   }
-   if (cmd_size <= MARSHAL_MAX_CMD_SIZE) {
-      cmd = _mesa_glthread_allocate_command(ctx, DISPATCH_CMD_DrawElements, cmd_size);
-      cmd->mode = mode;
-      cmd->count = count;
-      cmd->type = type;
-      cmd->indices = indices;
-      _mesa_post_marshal_hook(ctx);
-      return;
-   }
-
-   _mesa_glthread_finish(ctx);
-   debug_print_sync_fallback("DrawElements");
-   CALL_DrawElements(ctx->CurrentServerDispatch, (mode, count, type, indices));
-}
-
-
 /* ScissorArrayv: marshalled asynchronously */
 struct marshal_cmd_ScissorArrayv
 {
@@ -38408,7 +37903,7 @@ _mesa_marshal_ScissorArrayv(GLuint first, GLsizei count, const int * v)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ScissorArrayv");
    debug_print_sync_fallback("ScissorArrayv");
    CALL_ScissorArrayv(ctx->CurrentServerDispatch, (first, count, v));
 }
@@ -38419,7 +37914,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetInternalformativ");
    debug_print_sync("GetInternalformativ");
    CALL_GetInternalformativ(ctx->CurrentServerDispatch, (target, internalformat, pname, bufSize, params));
 }
@@ -38454,7 +37949,7 @@ _mesa_marshal_EvalPoint2(GLint i, GLint j)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalPoint2");
    debug_print_sync_fallback("EvalPoint2");
    CALL_EvalPoint2(ctx->CurrentServerDispatch, (i, j));
 }
@@ -38486,7 +37981,7 @@ _mesa_marshal_EvalPoint1(GLint i)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalPoint1");
    debug_print_sync_fallback("EvalPoint1");
    CALL_EvalPoint1(ctx->CurrentServerDispatch, (i));
 }
@@ -38497,9 +37992,10 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribLPointer");
    debug_print_sync("VertexAttribLPointer");
    CALL_VertexAttribLPointer(ctx->CurrentServerDispatch, (index, size, type, stride, pointer));
+   _mesa_glthread_VertexAttribLPointer(ctx, index, size, type, stride, pointer);
 }
 
 
@@ -38528,7 +38024,7 @@ _mesa_marshal_PopMatrix(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "PopMatrix");
    debug_print_sync_fallback("PopMatrix");
    CALL_PopMatrix(ctx->CurrentServerDispatch, ());
 }
@@ -38539,7 +38035,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetTexGeniv(GLenum coord, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTexGeniv");
    debug_print_sync("GetTexGeniv");
    CALL_GetTexGeniv(ctx->CurrentServerDispatch, (coord, pname, params));
 }
@@ -38550,7 +38046,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetFirstPerfQueryIdINTEL(GLuint * queryId)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetFirstPerfQueryIdINTEL");
    debug_print_sync("GetFirstPerfQueryIdINTEL");
    CALL_GetFirstPerfQueryIdINTEL(ctx->CurrentServerDispatch, (queryId));
 }
@@ -38561,7 +38057,7 @@ static GLboolean GLAPIENTRY
 _mesa_marshal_UnmapBuffer(GLenum target)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UnmapBuffer");
    debug_print_sync("UnmapBuffer");
    return CALL_UnmapBuffer(ctx->CurrentServerDispatch, (target));
 }
@@ -38593,7 +38089,7 @@ _mesa_marshal_EvalCoord1d(GLdouble u)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord1d");
    debug_print_sync_fallback("EvalCoord1d");
    CALL_EvalCoord1d(ctx->CurrentServerDispatch, (u));
 }
@@ -38628,7 +38124,7 @@ _mesa_marshal_VertexAttribL1d(GLuint index, GLdouble x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribL1d");
    debug_print_sync_fallback("VertexAttribL1d");
    CALL_VertexAttribL1d(ctx->CurrentServerDispatch, (index, x));
 }
@@ -38660,7 +38156,7 @@ _mesa_marshal_EvalCoord1f(GLfloat u)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord1f");
    debug_print_sync_fallback("EvalCoord1f");
    CALL_EvalCoord1f(ctx->CurrentServerDispatch, (u));
 }
@@ -38698,7 +38194,7 @@ _mesa_marshal_Materialf(GLenum face, GLenum pname, GLfloat param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Materialf");
    debug_print_sync_fallback("Materialf");
    CALL_Materialf(ctx->CurrentServerDispatch, (face, pname, param));
 }
@@ -38736,7 +38232,7 @@ _mesa_marshal_Materiali(GLenum face, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Materiali");
    debug_print_sync_fallback("Materiali");
    CALL_Materiali(ctx->CurrentServerDispatch, (face, pname, param));
 }
@@ -38786,7 +38282,7 @@ _mesa_marshal_ProgramUniform1uiv(GLuint program, GLint location, GLsizei count,
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1uiv");
    debug_print_sync_fallback("ProgramUniform1uiv");
    CALL_ProgramUniform1uiv(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -38818,7 +38314,7 @@ _mesa_marshal_EvalCoord1dv(const GLdouble * u)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EvalCoord1dv");
    debug_print_sync_fallback("EvalCoord1dv");
    CALL_EvalCoord1dv(ctx->CurrentServerDispatch, (u));
 }
@@ -38856,7 +38352,7 @@ _mesa_marshal_Materialx(GLenum face, GLenum pname, GLfixed param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Materialx");
    debug_print_sync_fallback("Materialx");
    CALL_Materialx(ctx->CurrentServerDispatch, (face, pname, param));
 }
@@ -38897,7 +38393,7 @@ _mesa_marshal_GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLi
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetQueryBufferObjectiv");
    debug_print_sync_fallback("GetQueryBufferObjectiv");
    CALL_GetQueryBufferObjectiv(ctx->CurrentServerDispatch, (id, buffer, pname, offset));
 }
@@ -38908,7 +38404,7 @@ static GLuint64 GLAPIENTRY
 _mesa_marshal_GetTextureSamplerHandleARB(GLuint texture, GLuint sampler)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetTextureSamplerHandleARB");
    debug_print_sync("GetTextureSamplerHandleARB");
    return CALL_GetTextureSamplerHandleARB(ctx->CurrentServerDispatch, (texture, sampler));
 }
@@ -38919,7 +38415,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetLightiv(GLenum light, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetLightiv");
    debug_print_sync("GetLightiv");
    CALL_GetLightiv(ctx->CurrentServerDispatch, (light, pname, params));
 }
@@ -38963,7 +38459,7 @@ _mesa_marshal_ProgramUniform3i64ARB(GLuint program, GLint location, GLint64 x, G
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform3i64ARB");
    debug_print_sync_fallback("ProgramUniform3i64ARB");
    CALL_ProgramUniform3i64ARB(ctx->CurrentServerDispatch, (program, location, x, y, z));
 }
@@ -39001,7 +38497,7 @@ _mesa_marshal_ProgramUniform1i(GLuint program, GLint location, GLint x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1i");
    debug_print_sync_fallback("ProgramUniform1i");
    CALL_ProgramUniform1i(ctx->CurrentServerDispatch, (program, location, x));
 }
@@ -39039,7 +38535,7 @@ _mesa_marshal_ProgramUniform1f(GLuint program, GLint location, GLfloat x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1f");
    debug_print_sync_fallback("ProgramUniform1f");
    CALL_ProgramUniform1f(ctx->CurrentServerDispatch, (program, location, x));
 }
@@ -39077,7 +38573,7 @@ _mesa_marshal_ProgramUniform1d(GLuint program, GLint location, GLdouble x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1d");
    debug_print_sync_fallback("ProgramUniform1d");
    CALL_ProgramUniform1d(ctx->CurrentServerDispatch, (program, location, x));
 }
@@ -39088,7 +38584,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos3iv(const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos3iv");
    debug_print_sync("WindowPos3iv");
    CALL_WindowPos3iv(ctx->CurrentServerDispatch, (v));
 }
@@ -39135,7 +38631,7 @@ _mesa_marshal_CopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLin
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyConvolutionFilter2D");
    debug_print_sync_fallback("CopyConvolutionFilter2D");
    CALL_CopyConvolutionFilter2D(ctx->CurrentServerDispatch, (target, internalformat, x, y, width, height));
 }
@@ -39179,7 +38675,7 @@ _mesa_marshal_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CopyBufferSubData");
    debug_print_sync_fallback("CopyBufferSubData");
    CALL_CopyBufferSubData(ctx->CurrentServerDispatch, (readTarget, writeTarget, readOffset, writeOffset, size));
 }
@@ -39229,7 +38725,7 @@ _mesa_marshal_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transp
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "UniformMatrix3x4fv");
    debug_print_sync_fallback("UniformMatrix3x4fv");
    CALL_UniformMatrix3x4fv(ctx->CurrentServerDispatch, (location, count, transpose, value));
 }
@@ -39270,7 +38766,7 @@ _mesa_marshal_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Recti");
    debug_print_sync_fallback("Recti");
    CALL_Recti(ctx->CurrentServerDispatch, (x1, y1, x2, y2));
 }
@@ -39281,7 +38777,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexAttribI3ivEXT(GLuint index, const GLint * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttribI3ivEXT");
    debug_print_sync("VertexAttribI3ivEXT");
    CALL_VertexAttribI3ivEXT(ctx->CurrentServerDispatch, (index, v));
 }
@@ -39292,7 +38788,7 @@ static void GLAPIENTRY
 _mesa_marshal_DeleteSamplers(GLsizei count, const GLuint * samplers)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "DeleteSamplers");
    debug_print_sync("DeleteSamplers");
    CALL_DeleteSamplers(ctx->CurrentServerDispatch, (count, samplers));
 }
@@ -39330,7 +38826,7 @@ _mesa_marshal_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "SamplerParameteri");
    debug_print_sync_fallback("SamplerParameteri");
    CALL_SamplerParameteri(ctx->CurrentServerDispatch, (sampler, pname, param));
 }
@@ -39341,7 +38837,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowRectanglesEXT(GLenum mode, GLsizei count, const GLint * box)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowRectanglesEXT");
    debug_print_sync("WindowRectanglesEXT");
    CALL_WindowRectanglesEXT(ctx->CurrentServerDispatch, (mode, count, box));
 }
@@ -39382,7 +38878,7 @@ _mesa_marshal_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rectf");
    debug_print_sync_fallback("Rectf");
    CALL_Rectf(ctx->CurrentServerDispatch, (x1, y1, x2, y2));
 }
@@ -39423,7 +38919,7 @@ _mesa_marshal_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rectd");
    debug_print_sync_fallback("Rectd");
    CALL_Rectd(ctx->CurrentServerDispatch, (x1, y1, x2, y2));
 }
@@ -39455,7 +38951,7 @@ _mesa_marshal_MultMatrixx(const GLfixed * m)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MultMatrixx");
    debug_print_sync_fallback("MultMatrixx");
    CALL_MultMatrixx(ctx->CurrentServerDispatch, (m));
 }
@@ -39511,7 +39007,7 @@ _mesa_marshal_TexStorageMem3DMultisampleEXT(GLenum target, GLsizei samples, GLen
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexStorageMem3DMultisampleEXT");
    debug_print_sync_fallback("TexStorageMem3DMultisampleEXT");
    CALL_TexStorageMem3DMultisampleEXT(ctx->CurrentServerDispatch, (target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset));
 }
@@ -39552,7 +39048,7 @@ _mesa_marshal_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rects");
    debug_print_sync_fallback("Rects");
    CALL_Rects(ctx->CurrentServerDispatch, (x1, y1, x2, y2));
 }
@@ -39563,7 +39059,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetVertexAttribIiv(GLuint index, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetVertexAttribIiv");
    debug_print_sync("GetVertexAttribIiv");
    CALL_GetVertexAttribIiv(ctx->CurrentServerDispatch, (index, pname, params));
 }
@@ -39574,7 +39070,7 @@ static GLenum GLAPIENTRY
 _mesa_marshal_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ClientWaitSync");
    debug_print_sync("ClientWaitSync");
    return CALL_ClientWaitSync(ctx->CurrentServerDispatch, (sync, flags, timeout));
 }
@@ -39615,7 +39111,7 @@ _mesa_marshal_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4s");
    debug_print_sync_fallback("TexCoord4s");
    CALL_TexCoord4s(ctx->CurrentServerDispatch, (s, t, r, q));
 }
@@ -39626,7 +39122,7 @@ static void GLAPIENTRY
 _mesa_marshal_TexEnvxv(GLenum target, GLenum pname, const GLfixed * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexEnvxv");
    debug_print_sync("TexEnvxv");
    CALL_TexEnvxv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -39667,7 +39163,7 @@ _mesa_marshal_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4i");
    debug_print_sync_fallback("TexCoord4i");
    CALL_TexCoord4i(ctx->CurrentServerDispatch, (s, t, r, q));
 }
@@ -39678,7 +39174,7 @@ static GLenum GLAPIENTRY
 _mesa_marshal_ObjectPurgeableAPPLE(GLenum objectType, GLuint name, GLenum option)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ObjectPurgeableAPPLE");
    debug_print_sync("ObjectPurgeableAPPLE");
    return CALL_ObjectPurgeableAPPLE(ctx->CurrentServerDispatch, (objectType, name, option));
 }
@@ -39728,7 +39224,7 @@ _mesa_marshal_ProgramUniform1ui64vARB(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniform1ui64vARB");
    debug_print_sync_fallback("ProgramUniform1ui64vARB");
    CALL_ProgramUniform1ui64vARB(ctx->CurrentServerDispatch, (program, location, count, value));
 }
@@ -39769,7 +39265,7 @@ _mesa_marshal_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4d");
    debug_print_sync_fallback("TexCoord4d");
    CALL_TexCoord4d(ctx->CurrentServerDispatch, (s, t, r, q));
 }
@@ -39810,7 +39306,7 @@ _mesa_marshal_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "TexCoord4f");
    debug_print_sync_fallback("TexCoord4f");
    CALL_TexCoord4f(ctx->CurrentServerDispatch, (s, t, r, q));
 }
@@ -39821,7 +39317,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetBooleanv(GLenum pname, GLboolean * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetBooleanv");
    debug_print_sync("GetBooleanv");
    CALL_GetBooleanv(ctx->CurrentServerDispatch, (pname, params));
 }
@@ -39874,7 +39370,7 @@ _mesa_marshal_ProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei co
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ProgramUniformMatrix3dv");
    debug_print_sync_fallback("ProgramUniformMatrix3dv");
    CALL_ProgramUniformMatrix3dv(ctx->CurrentServerDispatch, (program, location, count, transpose, value));
 }
@@ -39909,7 +39405,7 @@ _mesa_marshal_LockArraysEXT(GLint first, GLsizei count)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "LockArraysEXT");
    debug_print_sync_fallback("LockArraysEXT");
    CALL_LockArraysEXT(ctx->CurrentServerDispatch, (first, count));
 }
@@ -39920,7 +39416,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetActiveUniformBlockiv");
    debug_print_sync("GetActiveUniformBlockiv");
    CALL_GetActiveUniformBlockiv(ctx->CurrentServerDispatch, (program, uniformBlockIndex, pname, params));
 }
@@ -39931,7 +39427,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfMonitorCountersAMD(GLuint group, GLint * numCounters, GLint * maxActiveCounters, GLsizei countersSize, GLuint * counters)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfMonitorCountersAMD");
    debug_print_sync("GetPerfMonitorCountersAMD");
    CALL_GetPerfMonitorCountersAMD(ctx->CurrentServerDispatch, (group, numCounters, maxActiveCounters, countersSize, counters));
 }
@@ -39942,7 +39438,7 @@ static void GLAPIENTRY
 _mesa_marshal_ObjectPtrLabel(const GLvoid * ptr, GLsizei length, const GLchar * label)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "ObjectPtrLabel");
    debug_print_sync("ObjectPtrLabel");
    CALL_ObjectPtrLabel(ctx->CurrentServerDispatch, (ptr, length, label));
 }
@@ -39977,7 +39473,7 @@ _mesa_marshal_Rectfv(const GLfloat * v1, const GLfloat * v2)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Rectfv");
    debug_print_sync_fallback("Rectfv");
    CALL_Rectfv(ctx->CurrentServerDispatch, (v1, v2));
 }
@@ -40027,7 +39523,7 @@ _mesa_marshal_BindImageTexture(GLuint unit, GLuint texture, GLint level, GLboole
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "BindImageTexture");
    debug_print_sync_fallback("BindImageTexture");
    CALL_BindImageTexture(ctx->CurrentServerDispatch, (unit, texture, level, layered, layer, access, format));
 }
@@ -40038,7 +39534,7 @@ static void GLAPIENTRY
 _mesa_marshal_VertexP4uiv(GLenum type, const GLuint * value)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexP4uiv");
    debug_print_sync("VertexP4uiv");
    CALL_VertexP4uiv(ctx->CurrentServerDispatch, (type, value));
 }
@@ -40049,7 +39545,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetUniformSubroutineuiv");
    debug_print_sync("GetUniformSubroutineuiv");
    CALL_GetUniformSubroutineuiv(ctx->CurrentServerDispatch, (shadertype, location, params));
 }
@@ -40081,7 +39577,7 @@ _mesa_marshal_MinSampleShading(GLfloat value)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "MinSampleShading");
    debug_print_sync_fallback("MinSampleShading");
    CALL_MinSampleShading(ctx->CurrentServerDispatch, (value));
 }
@@ -40092,7 +39588,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetRenderbufferParameteriv");
    debug_print_sync("GetRenderbufferParameteriv");
    CALL_GetRenderbufferParameteriv(ctx->CurrentServerDispatch, (target, pname, params));
 }
@@ -40127,7 +39623,7 @@ _mesa_marshal_VertexAttrib1dNV(GLuint index, GLdouble x)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "VertexAttrib1dNV");
    debug_print_sync_fallback("VertexAttrib1dNV");
    CALL_VertexAttrib1dNV(ctx->CurrentServerDispatch, (index, x));
 }
@@ -40138,7 +39634,7 @@ static void GLAPIENTRY
 _mesa_marshal_WindowPos2sv(const GLshort * v)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "WindowPos2sv");
    debug_print_sync("WindowPos2sv");
    CALL_WindowPos2sv(ctx->CurrentServerDispatch, (v));
 }
@@ -40149,7 +39645,7 @@ static void GLAPIENTRY
 _mesa_marshal_GetPerfMonitorCounterStringAMD(GLuint group, GLuint counter, GLsizei bufSize, GLsizei * length, GLchar * counterString)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "GetPerfMonitorCounterStringAMD");
    debug_print_sync("GetPerfMonitorCounterStringAMD");
    CALL_GetPerfMonitorCounterStringAMD(ctx->CurrentServerDispatch, (group, counter, bufSize, length, counterString));
 }
@@ -40180,7 +39676,7 @@ _mesa_marshal_EndFragmentShaderATI(void)
       return;
    }
 
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "EndFragmentShaderATI");
    debug_print_sync_fallback("EndFragmentShaderATI");
    CALL_EndFragmentShaderATI(ctx->CurrentServerDispatch, ());
 }
@@ -40227,7 +39723,7 @@ _mesa_marshal_Uniform4iv(GLint location, GLsizei count, const GLint * value)
    }
 
 fallback_to_sync:
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "Uniform4iv");
    debug_print_sync_fallback("Uniform4iv");
    CALL_Uniform4iv(ctx->CurrentServerDispatch, (location, count, value));
 }
@@ -40238,7 +39734,7 @@ static void GLAPIENTRY
 _mesa_marshal_CreateMemoryObjectsEXT(GLsizei n, GLuint * memoryObjects)
 {
    GET_CURRENT_CONTEXT(ctx);
-   _mesa_glthread_finish(ctx);
+   _mesa_glthread_finish_before(ctx, "CreateMemoryObjectsEXT");
    debug_print_sync("CreateMemoryObjectsEXT");
    CALL_CreateMemoryObjectsEXT(ctx->CurrentServerDispatch, (n, memoryObjects));
 }
@@ -40525,6 +40021,10 @@ _mesa_unmarshal_dispatch_cmd(struct gl_context *ctx, const void *cmd)
       debug_print_unmarshal("BlendFuncSeparate");
       _mesa_unmarshal_BlendFuncSeparate(ctx, (const struct marshal_cmd_BlendFuncSeparate *) cmd);
       break;
+   case DISPATCH_CMD_MaxShaderCompilerThreadsARB:
+      debug_print_unmarshal("MaxShaderCompilerThreadsARB");
+      _mesa_unmarshal_MaxShaderCompilerThreadsARB(ctx, (const struct marshal_cmd_MaxShaderCompilerThreadsARB *) cmd);
+      break;
    case DISPATCH_CMD_Color3us:
       debug_print_unmarshal("Color3us");
       _mesa_unmarshal_Color3us(ctx, (const struct marshal_cmd_Color3us *) cmd);
@@ -43969,6 +43469,7 @@ _mesa_create_marshal_table(const struct gl_context *ctx)
    SET_GetnUniformivARB(table, _mesa_marshal_GetnUniformivARB);
    SET_ReleaseShaderCompiler(table, _mesa_marshal_ReleaseShaderCompiler);
    SET_BlendFuncSeparate(table, _mesa_marshal_BlendFuncSeparate);
+   SET_MaxShaderCompilerThreadsARB(table, _mesa_marshal_MaxShaderCompilerThreadsARB);
    SET_Color3us(table, _mesa_marshal_Color3us);
    SET_LoadMatrixx(table, _mesa_marshal_LoadMatrixx);
    SET_BufferStorage(table, _mesa_marshal_BufferStorage);
@@ -100,6 +100,7 @@ enum marshal_dispatch_cmd_id
    DISPATCH_CMD_TextureStorage3DMultisample,
    DISPATCH_CMD_ReleaseShaderCompiler,
    DISPATCH_CMD_BlendFuncSeparate,
+   DISPATCH_CMD_MaxShaderCompilerThreadsARB,
    DISPATCH_CMD_Color3us,
    DISPATCH_CMD_LoadMatrixx,
    DISPATCH_CMD_Color3ub,
@@ -48,6 +48,7 @@
 #include "compiler/glsl/list.h"
 #include "util/simple_mtx.h"
 #include "util/u_dynarray.h"
+#include "util/u_queue.h"
 
 
 #ifdef __cplusplus
@@ -638,6 +639,7 @@ struct gl_hint_attrib
    GLenum TextureCompression;   /**< GL_ARB_texture_compression */
    GLenum GenerateMipmap;       /**< GL_SGIS_generate_mipmap */
    GLenum FragmentShaderDerivative; /**< GL_ARB_fragment_shader */
+   GLuint MaxShaderCompilerThreads; /**< GL_ARB_parallel_shader_compile */
 };
 
 
@@ -2580,6 +2582,13 @@ struct gl_shader
 
    enum gl_compile_status CompileStatus;
 
+   /**
+    * GL_ARB_parallel_shader_compile: signalled when the compiler queue is
+    * done compiling the shader, and the number of queued links reading it.
+    */
+   struct util_queue_fence CompileFence;
+   unsigned PendingLinks;
+
 #ifdef DEBUG
    unsigned SourceChecksum;       /**< for debug/logging purposes */
 #endif
@@ -2929,6 +2938,12 @@ struct gl_shader_program
    GLuint NumShaders;          /**< number of attached shaders */
    struct gl_shader **Shaders; /**< List of attached the shaders */
 
+   /**
+    * GL_ARB_parallel_shader_compile: signalled when the compiler queue is
+    * done linking the program.
+    */
+   struct util_queue_fence LinkFence;
+
    /**
     * User-defined attribute bindings
     *
@@ -3086,7 +3101,12 @@ struct gl_pipeline_object
     */
    struct gl_shader_program *ActiveProgram;
 
-   GLbitfield Flags;                    /**< Mask of GLSL_x flags */
+   /**
+    * Mask of GLSL_x flags.  Every pipeline object of a context has the same
+    * flags, so compiles and links read them from ctx->Shader: they may run
+    * on a compiler thread while ctx->_Shader is rebound.
+    */
+   GLbitfield Flags;
 
    GLboolean EverBound;                 /**< Has the pipeline object been created */
 
@@ -3268,6 +3288,12 @@ struct gl_shared_state
    /** Table of both gl_shader and gl_shader_program objects */
    struct _mesa_HashTable *ShaderObjects;
 
+   /**
+    * GL_ARB_parallel_shader_compile: threads compiling shaders and linking
+    * programs for all contexts of the share group, started on first use.
+    */
+   struct util_queue ShaderCompilerQueue;
+
    /* GL_EXT_framebuffer_object */
    struct _mesa_HashTable *RenderBuffers;
    struct _mesa_HashTable *FrameBuffers;
@@ -4022,6 +4048,13 @@ struct gl_constants
 
    /** GL_ARB_get_program_binary */
    GLuint NumProgramBinaryFormats;
+
+   /**
+    * GL_ARB_parallel_shader_compile: how many threads may compile shaders
+    * and link programs for a share group, or 0 if the driver's LinkShader
+    * hook must run on the application thread.
+    */
+   GLuint MaxShaderCompilerThreads;
 };
 
 
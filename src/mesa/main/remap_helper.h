@@ -580,87 +580,91 @@ static const char _mesa_function_pool[] =
    "glBlendFuncSeparateINGR\0"
    "glBlendFuncSeparateOES\0"
    "\0"
-   /* _mesa_function_pool[4207]: Color3us (offset 23) */
+   /* _mesa_function_pool[4207]: MaxShaderCompilerThreadsARB (will be remapped) */
+   "i\0"
+   "glMaxShaderCompilerThreadsARB\0"
+   "\0"
+   /* _mesa_function_pool[4240]: Color3us (offset 23) */
    "iii\0"
    "glColor3us\0"
    "\0"
-   /* _mesa_function_pool[4223]: LoadMatrixx (will be remapped) */
+   /* _mesa_function_pool[4256]: LoadMatrixx (will be remapped) */
    "p\0"
    "glLoadMatrixxOES\0"
    "glLoadMatrixx\0"
    "\0"
-   /* _mesa_function_pool[4257]: BufferStorage (will be remapped) */
+   /* _mesa_function_pool[4290]: BufferStorage (will be remapped) */
    "iipi\0"
    "glBufferStorage\0"
    "glBufferStorageEXT\0"
    "\0"
-   /* _mesa_function_pool[4298]: Color3ub (offset 19) */
+   /* _mesa_function_pool[4331]: Color3ub (offset 19) */
    "iii\0"
    "glColor3ub\0"
    "\0"
-   /* _mesa_function_pool[4314]: GetInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[4347]: GetInstrumentsSGIX (dynamic) */
    "\0"
    "glGetInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[4337]: Color3ui (offset 21) */
+   /* _mesa_function_pool[4370]: Color3ui (offset 21) */
    "iii\0"
    "glColor3ui\0"
    "\0"
-   /* _mesa_function_pool[4353]: VertexAttrib4dvNV (will be remapped) */
+   /* _mesa_function_pool[4386]: VertexAttrib4dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib4dvNV\0"
    "\0"
-   /* _mesa_function_pool[4377]: AlphaFragmentOp2ATI (will be remapped) */
+   /* _mesa_function_pool[4410]: AlphaFragmentOp2ATI (will be remapped) */
    "iiiiiiiii\0"
    "glAlphaFragmentOp2ATI\0"
    "\0"
-   /* _mesa_function_pool[4410]: RasterPos4dv (offset 79) */
+   /* _mesa_function_pool[4443]: RasterPos4dv (offset 79) */
    "p\0"
    "glRasterPos4dv\0"
    "\0"
-   /* _mesa_function_pool[4428]: DeleteProgramPipelines (will be remapped) */
+   /* _mesa_function_pool[4461]: DeleteProgramPipelines (will be remapped) */
    "ip\0"
    "glDeleteProgramPipelines\0"
    "glDeleteProgramPipelinesEXT\0"
    "\0"
-   /* _mesa_function_pool[4485]: LineWidthx (will be remapped) */
+   /* _mesa_function_pool[4518]: LineWidthx (will be remapped) */
    "i\0"
    "glLineWidthxOES\0"
    "glLineWidthx\0"
    "\0"
-   /* _mesa_function_pool[4517]: GetTransformFeedbacki_v (will be remapped) */
+   /* _mesa_function_pool[4550]: GetTransformFeedbacki_v (will be remapped) */
    "iiip\0"
    "glGetTransformFeedbacki_v\0"
    "\0"
-   /* _mesa_function_pool[4549]: Indexdv (offset 45) */
+   /* _mesa_function_pool[4582]: Indexdv (offset 45) */
    "p\0"
    "glIndexdv\0"
    "\0"
-   /* _mesa_function_pool[4562]: GetnPixelMapfvARB (will be remapped) */
+   /* _mesa_function_pool[4595]: GetnPixelMapfvARB (will be remapped) */
    "iip\0"
    "glGetnPixelMapfvARB\0"
    "\0"
-   /* _mesa_function_pool[4587]: EGLImageTargetTexture2DOES (will be remapped) */
+   /* _mesa_function_pool[4620]: EGLImageTargetTexture2DOES (will be remapped) */
    "ip\0"
    "glEGLImageTargetTexture2DOES\0"
    "\0"
-   /* _mesa_function_pool[4620]: DepthMask (offset 211) */
+   /* _mesa_function_pool[4653]: DepthMask (offset 211) */
    "i\0"
    "glDepthMask\0"
    "\0"
-   /* _mesa_function_pool[4635]: WindowPos4ivMESA (will be remapped) */
+   /* _mesa_function_pool[4668]: WindowPos4ivMESA (will be remapped) */
    "p\0"
    "glWindowPos4ivMESA\0"
    "\0"
-   /* _mesa_function_pool[4657]: GetShaderInfoLog (will be remapped) */
+   /* _mesa_function_pool[4690]: GetShaderInfoLog (will be remapped) */
    "iipp\0"
    "glGetShaderInfoLog\0"
    "\0"
-   /* _mesa_function_pool[4682]: BindFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[4715]: BindFragmentShaderATI (will be remapped) */
    "i\0"
    "glBindFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[4709]: BlendFuncSeparateiARB (will be remapped) */
+   /* _mesa_function_pool[4742]: BlendFuncSeparateiARB (will be remapped) */
    "iiiii\0"
    "glBlendFuncSeparateiARB\0"
    "glBlendFuncSeparateIndexedAMD\0"
@@ -668,2922 +672,2922 @@ static const char _mesa_function_pool[] =
    "glBlendFuncSeparateiEXT\0"
    "glBlendFuncSeparateiOES\0"
    "\0"
-   /* _mesa_function_pool[4839]: PixelTexGenParameteriSGIS (dynamic) */
+   /* _mesa_function_pool[4872]: PixelTexGenParameteriSGIS (dynamic) */
    "ii\0"
    "glPixelTexGenParameteriSGIS\0"
    "\0"
-   /* _mesa_function_pool[4871]: EGLImageTargetRenderbufferStorageOES (will be remapped) */
+   /* _mesa_function_pool[4904]: EGLImageTargetRenderbufferStorageOES (will be remapped) */
    "ip\0"
    "glEGLImageTargetRenderbufferStorageOES\0"
    "\0"
-   /* _mesa_function_pool[4914]: GenTransformFeedbacks (will be remapped) */
+   /* _mesa_function_pool[4947]: GenTransformFeedbacks (will be remapped) */
    "ip\0"
    "glGenTransformFeedbacks\0"
    "\0"
-   /* _mesa_function_pool[4942]: VertexPointer (offset 321) */
+   /* _mesa_function_pool[4975]: VertexPointer (offset 321) */
    "iiip\0"
    "glVertexPointer\0"
    "\0"
-   /* _mesa_function_pool[4964]: GetCompressedTexImage (will be remapped) */
+   /* _mesa_function_pool[4997]: GetCompressedTexImage (will be remapped) */
    "iip\0"
    "glGetCompressedTexImage\0"
    "glGetCompressedTexImageARB\0"
    "\0"
-   /* _mesa_function_pool[5020]: ProgramLocalParameter4dvARB (will be remapped) */
+   /* _mesa_function_pool[5053]: ProgramLocalParameter4dvARB (will be remapped) */
    "iip\0"
    "glProgramLocalParameter4dvARB\0"
    "\0"
-   /* _mesa_function_pool[5055]: UniformMatrix2dv (will be remapped) */
+   /* _mesa_function_pool[5088]: UniformMatrix2dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix2dv\0"
    "\0"
-   /* _mesa_function_pool[5080]: GetQueryObjectui64v (will be remapped) */
+   /* _mesa_function_pool[5113]: GetQueryObjectui64v (will be remapped) */
    "iip\0"
    "glGetQueryObjectui64v\0"
    "glGetQueryObjectui64vEXT\0"
    "\0"
-   /* _mesa_function_pool[5132]: VertexAttribP1uiv (will be remapped) */
+   /* _mesa_function_pool[5165]: VertexAttribP1uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP1uiv\0"
    "\0"
-   /* _mesa_function_pool[5158]: IsProgram (will be remapped) */
+   /* _mesa_function_pool[5191]: IsProgram (will be remapped) */
    "i\0"
    "glIsProgram\0"
    "\0"
-   /* _mesa_function_pool[5173]: TexCoordPointerListIBM (dynamic) */
+   /* _mesa_function_pool[5206]: TexCoordPointerListIBM (dynamic) */
    "iiipi\0"
    "glTexCoordPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[5205]: ResizeBuffersMESA (will be remapped) */
+   /* _mesa_function_pool[5238]: ResizeBuffersMESA (will be remapped) */
    "\0"
    "glResizeBuffersMESA\0"
    "\0"
-   /* _mesa_function_pool[5227]: BindBuffersBase (will be remapped) */
+   /* _mesa_function_pool[5260]: BindBuffersBase (will be remapped) */
    "iiip\0"
    "glBindBuffersBase\0"
    "\0"
-   /* _mesa_function_pool[5251]: GenTextures (offset 328) */
+   /* _mesa_function_pool[5284]: GenTextures (offset 328) */
    "ip\0"
    "glGenTextures\0"
    "glGenTexturesEXT\0"
    "\0"
-   /* _mesa_function_pool[5286]: IndexPointerListIBM (dynamic) */
+   /* _mesa_function_pool[5319]: IndexPointerListIBM (dynamic) */
    "iipi\0"
    "glIndexPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[5314]: UnmapNamedBuffer (will be remapped) */
+   /* _mesa_function_pool[5347]: UnmapNamedBuffer (will be remapped) */
    "i\0"
    "glUnmapNamedBuffer\0"
    "\0"
-   /* _mesa_function_pool[5336]: UniformMatrix3x2dv (will be remapped) */
+   /* _mesa_function_pool[5369]: UniformMatrix3x2dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3x2dv\0"
    "\0"
-   /* _mesa_function_pool[5363]: WindowPos4fMESA (will be remapped) */
+   /* _mesa_function_pool[5396]: WindowPos4fMESA (will be remapped) */
    "ffff\0"
    "glWindowPos4fMESA\0"
    "\0"
-   /* _mesa_function_pool[5387]: VertexAttribs2fvNV (will be remapped) */
+   /* _mesa_function_pool[5420]: VertexAttribs2fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs2fvNV\0"
    "\0"
-   /* _mesa_function_pool[5413]: VertexAttribP4ui (will be remapped) */
+   /* _mesa_function_pool[5446]: VertexAttribP4ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP4ui\0"
    "\0"
-   /* _mesa_function_pool[5438]: StringMarkerGREMEDY (will be remapped) */
+   /* _mesa_function_pool[5471]: StringMarkerGREMEDY (will be remapped) */
    "ip\0"
    "glStringMarkerGREMEDY\0"
    "\0"
-   /* _mesa_function_pool[5464]: Uniform4i (will be remapped) */
+   /* _mesa_function_pool[5497]: Uniform4i (will be remapped) */
    "iiiii\0"
    "glUniform4i\0"
    "glUniform4iARB\0"
    "\0"
-   /* _mesa_function_pool[5498]: Uniform4d (will be remapped) */
+   /* _mesa_function_pool[5531]: Uniform4d (will be remapped) */
    "idddd\0"
    "glUniform4d\0"
    "\0"
-   /* _mesa_function_pool[5517]: Uniform4f (will be remapped) */
+   /* _mesa_function_pool[5550]: Uniform4f (will be remapped) */
    "iffff\0"
    "glUniform4f\0"
    "glUniform4fARB\0"
    "\0"
-   /* _mesa_function_pool[5551]: ProgramUniform3dv (will be remapped) */
+   /* _mesa_function_pool[5584]: ProgramUniform3dv (will be remapped) */
    "iiip\0"
    "glProgramUniform3dv\0"
    "\0"
-   /* _mesa_function_pool[5577]: GetNamedBufferParameteri64v (will be remapped) */
+   /* _mesa_function_pool[5610]: GetNamedBufferParameteri64v (will be remapped) */
    "iip\0"
    "glGetNamedBufferParameteri64v\0"
    "\0"
-   /* _mesa_function_pool[5612]: NamedFramebufferTexture (will be remapped) */
+   /* _mesa_function_pool[5645]: NamedFramebufferTexture (will be remapped) */
    "iiii\0"
    "glNamedFramebufferTexture\0"
    "\0"
-   /* _mesa_function_pool[5644]: ProgramUniform3d (will be remapped) */
+   /* _mesa_function_pool[5677]: ProgramUniform3d (will be remapped) */
    "iiddd\0"
    "glProgramUniform3d\0"
    "\0"
-   /* _mesa_function_pool[5670]: ProgramUniform3f (will be remapped) */
+   /* _mesa_function_pool[5703]: ProgramUniform3f (will be remapped) */
    "iifff\0"
    "glProgramUniform3f\0"
    "glProgramUniform3fEXT\0"
    "\0"
-   /* _mesa_function_pool[5718]: ProgramUniform3i (will be remapped) */
+   /* _mesa_function_pool[5751]: ProgramUniform3i (will be remapped) */
    "iiiii\0"
    "glProgramUniform3i\0"
    "glProgramUniform3iEXT\0"
    "\0"
-   /* _mesa_function_pool[5766]: PointParameterfv (will be remapped) */
+   /* _mesa_function_pool[5799]: PointParameterfv (will be remapped) */
    "ip\0"
    "glPointParameterfv\0"
    "glPointParameterfvARB\0"
    "glPointParameterfvEXT\0"
    "glPointParameterfvSGIS\0"
    "\0"
-   /* _mesa_function_pool[5856]: GetHistogramParameterfv (offset 362) */
+   /* _mesa_function_pool[5889]: GetHistogramParameterfv (offset 362) */
    "iip\0"
    "glGetHistogramParameterfv\0"
    "glGetHistogramParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[5916]: GetString (offset 275) */
+   /* _mesa_function_pool[5949]: GetString (offset 275) */
    "i\0"
    "glGetString\0"
    "\0"
-   /* _mesa_function_pool[5931]: ColorPointervINTEL (dynamic) */
+   /* _mesa_function_pool[5964]: ColorPointervINTEL (dynamic) */
    "iip\0"
    "glColorPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[5957]: VDPAUUnmapSurfacesNV (will be remapped) */
+   /* _mesa_function_pool[5990]: VDPAUUnmapSurfacesNV (will be remapped) */
    "ip\0"
    "glVDPAUUnmapSurfacesNV\0"
    "\0"
-   /* _mesa_function_pool[5984]: GetnHistogramARB (will be remapped) */
+   /* _mesa_function_pool[6017]: GetnHistogramARB (will be remapped) */
    "iiiiip\0"
    "glGetnHistogramARB\0"
    "\0"
-   /* _mesa_function_pool[6011]: ReplacementCodeuiColor4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[6044]: ReplacementCodeuiColor4fNormal3fVertex3fvSUN (dynamic) */
    "pppp\0"
    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[6064]: SecondaryColor3s (will be remapped) */
+   /* _mesa_function_pool[6097]: SecondaryColor3s (will be remapped) */
    "iii\0"
    "glSecondaryColor3s\0"
    "glSecondaryColor3sEXT\0"
    "\0"
-   /* _mesa_function_pool[6110]: TexStorageMem2DEXT (will be remapped) */
+   /* _mesa_function_pool[6143]: TexStorageMem2DEXT (will be remapped) */
    "iiiiiii\0"
    "glTexStorageMem2DEXT\0"
    "\0"
-   /* _mesa_function_pool[6140]: VertexAttribP2uiv (will be remapped) */
+   /* _mesa_function_pool[6173]: VertexAttribP2uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP2uiv\0"
    "\0"
-   /* _mesa_function_pool[6166]: UniformMatrix3x4dv (will be remapped) */
+   /* _mesa_function_pool[6199]: UniformMatrix3x4dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3x4dv\0"
    "\0"
-   /* _mesa_function_pool[6193]: VertexAttrib3fNV (will be remapped) */
+   /* _mesa_function_pool[6226]: VertexAttrib3fNV (will be remapped) */
    "ifff\0"
    "glVertexAttrib3fNV\0"
    "\0"
-   /* _mesa_function_pool[6218]: SecondaryColor3b (will be remapped) */
+   /* _mesa_function_pool[6251]: SecondaryColor3b (will be remapped) */
    "iii\0"
    "glSecondaryColor3b\0"
    "glSecondaryColor3bEXT\0"
    "\0"
-   /* _mesa_function_pool[6264]: EnableClientState (offset 313) */
+   /* _mesa_function_pool[6297]: EnableClientState (offset 313) */
    "i\0"
    "glEnableClientState\0"
    "\0"
-   /* _mesa_function_pool[6287]: Color4ubVertex2fvSUN (dynamic) */
+   /* _mesa_function_pool[6320]: Color4ubVertex2fvSUN (dynamic) */
    "pp\0"
    "glColor4ubVertex2fvSUN\0"
    "\0"
-   /* _mesa_function_pool[6314]: GetActiveSubroutineName (will be remapped) */
+   /* _mesa_function_pool[6347]: GetActiveSubroutineName (will be remapped) */
    "iiiipp\0"
    "glGetActiveSubroutineName\0"
    "\0"
-   /* _mesa_function_pool[6348]: SecondaryColor3i (will be remapped) */
+   /* _mesa_function_pool[6381]: SecondaryColor3i (will be remapped) */
    "iii\0"
    "glSecondaryColor3i\0"
    "glSecondaryColor3iEXT\0"
    "\0"
-   /* _mesa_function_pool[6394]: TexFilterFuncSGIS (dynamic) */
+   /* _mesa_function_pool[6427]: TexFilterFuncSGIS (dynamic) */
    "iiip\0"
    "glTexFilterFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[6420]: GetFragmentMaterialfvSGIX (dynamic) */
+   /* _mesa_function_pool[6453]: GetFragmentMaterialfvSGIX (dynamic) */
    "iip\0"
    "glGetFragmentMaterialfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[6453]: DetailTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[6486]: DetailTexFuncSGIS (dynamic) */
    "iip\0"
    "glDetailTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[6478]: FlushMappedBufferRange (will be remapped) */
+   /* _mesa_function_pool[6511]: FlushMappedBufferRange (will be remapped) */
    "iii\0"
    "glFlushMappedBufferRange\0"
    "glFlushMappedBufferRangeEXT\0"
    "\0"
-   /* _mesa_function_pool[6536]: TexStorageMem3DEXT (will be remapped) */
+   /* _mesa_function_pool[6569]: TexStorageMem3DEXT (will be remapped) */
    "iiiiiiii\0"
    "glTexStorageMem3DEXT\0"
    "\0"
-   /* _mesa_function_pool[6567]: Lightfv (offset 160) */
+   /* _mesa_function_pool[6600]: Lightfv (offset 160) */
    "iip\0"
    "glLightfv\0"
    "\0"
-   /* _mesa_function_pool[6582]: GetFramebufferAttachmentParameteriv (will be remapped) */
+   /* _mesa_function_pool[6615]: GetFramebufferAttachmentParameteriv (will be remapped) */
    "iiip\0"
    "glGetFramebufferAttachmentParameteriv\0"
    "glGetFramebufferAttachmentParameterivEXT\0"
    "glGetFramebufferAttachmentParameterivOES\0"
    "\0"
-   /* _mesa_function_pool[6708]: ColorSubTable (offset 346) */
+   /* _mesa_function_pool[6741]: ColorSubTable (offset 346) */
    "iiiiip\0"
    "glColorSubTable\0"
    "glColorSubTableEXT\0"
    "\0"
-   /* _mesa_function_pool[6751]: GetVertexArrayIndexed64iv (will be remapped) */
+   /* _mesa_function_pool[6784]: GetVertexArrayIndexed64iv (will be remapped) */
    "iiip\0"
    "glGetVertexArrayIndexed64iv\0"
    "\0"
-   /* _mesa_function_pool[6785]: EndPerfMonitorAMD (will be remapped) */
+   /* _mesa_function_pool[6818]: EndPerfMonitorAMD (will be remapped) */
    "i\0"
    "glEndPerfMonitorAMD\0"
    "\0"
-   /* _mesa_function_pool[6808]: ReadInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[6841]: ReadInstrumentsSGIX (dynamic) */
    "i\0"
    "glReadInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[6833]: CreateBuffers (will be remapped) */
+   /* _mesa_function_pool[6866]: CreateBuffers (will be remapped) */
    "ip\0"
    "glCreateBuffers\0"
    "\0"
-   /* _mesa_function_pool[6853]: MapParameterivNV (dynamic) */
+   /* _mesa_function_pool[6886]: MapParameterivNV (dynamic) */
    "iip\0"
    "glMapParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[6877]: VertexAttribs4dvNV (will be remapped) */
+   /* _mesa_function_pool[6910]: VertexAttribs4dvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4dvNV\0"
    "\0"
-   /* _mesa_function_pool[6903]: Uniform2i64vARB (will be remapped) */
+   /* _mesa_function_pool[6936]: Uniform2i64vARB (will be remapped) */
    "iip\0"
    "glUniform2i64vARB\0"
    "\0"
-   /* _mesa_function_pool[6926]: GetMultisamplefv (will be remapped) */
+   /* _mesa_function_pool[6959]: GetMultisamplefv (will be remapped) */
    "iip\0"
    "glGetMultisamplefv\0"
    "\0"
-   /* _mesa_function_pool[6950]: WeightbvARB (dynamic) */
+   /* _mesa_function_pool[6983]: WeightbvARB (dynamic) */
    "ip\0"
    "glWeightbvARB\0"
    "\0"
-   /* _mesa_function_pool[6968]: GetActiveSubroutineUniformName (will be remapped) */
+   /* _mesa_function_pool[7001]: GetActiveSubroutineUniformName (will be remapped) */
    "iiiipp\0"
    "glGetActiveSubroutineUniformName\0"
    "\0"
-   /* _mesa_function_pool[7009]: Rectdv (offset 87) */
+   /* _mesa_function_pool[7042]: Rectdv (offset 87) */
    "pp\0"
    "glRectdv\0"
    "\0"
-   /* _mesa_function_pool[7022]: DrawArraysInstancedARB (will be remapped) */
+   /* _mesa_function_pool[7055]: DrawArraysInstancedARB (will be remapped) */
    "iiii\0"
    "glDrawArraysInstancedARB\0"
    "glDrawArraysInstancedEXT\0"
    "glDrawArraysInstanced\0"
    "\0"
-   /* _mesa_function_pool[7100]: MakeImageHandleNonResidentARB (will be remapped) */
+   /* _mesa_function_pool[7133]: MakeImageHandleNonResidentARB (will be remapped) */
    "i\0"
    "glMakeImageHandleNonResidentARB\0"
    "\0"
-   /* _mesa_function_pool[7135]: ImportMemoryFdEXT (will be remapped) */
+   /* _mesa_function_pool[7168]: ImportMemoryFdEXT (will be remapped) */
    "iiii\0"
    "glImportMemoryFdEXT\0"
    "\0"
-   /* _mesa_function_pool[7161]: ProgramEnvParameters4fvEXT (will be remapped) */
+   /* _mesa_function_pool[7194]: ProgramEnvParameters4fvEXT (will be remapped) */
    "iiip\0"
    "glProgramEnvParameters4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[7196]: TexStorageMem1DEXT (will be remapped) */
+   /* _mesa_function_pool[7229]: TexStorageMem1DEXT (will be remapped) */
    "iiiiii\0"
    "glTexStorageMem1DEXT\0"
    "\0"
-   /* _mesa_function_pool[7225]: BlendBarrier (will be remapped) */
+   /* _mesa_function_pool[7258]: BlendBarrier (will be remapped) */
    "\0"
    "glBlendBarrier\0"
    "glBlendBarrierKHR\0"
    "\0"
-   /* _mesa_function_pool[7260]: VertexAttrib2svNV (will be remapped) */
+   /* _mesa_function_pool[7293]: VertexAttrib2svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib2svNV\0"
    "\0"
-   /* _mesa_function_pool[7284]: SecondaryColorP3uiv (will be remapped) */
+   /* _mesa_function_pool[7317]: SecondaryColorP3uiv (will be remapped) */
    "ip\0"
    "glSecondaryColorP3uiv\0"
    "\0"
-   /* _mesa_function_pool[7310]: GetnPixelMapuivARB (will be remapped) */
+   /* _mesa_function_pool[7343]: GetnPixelMapuivARB (will be remapped) */
    "iip\0"
    "glGetnPixelMapuivARB\0"
    "\0"
-   /* _mesa_function_pool[7336]: GetSamplerParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[7369]: GetSamplerParameterIuiv (will be remapped) */
    "iip\0"
    "glGetSamplerParameterIuiv\0"
    "glGetSamplerParameterIuivEXT\0"
    "glGetSamplerParameterIuivOES\0"
    "\0"
-   /* _mesa_function_pool[7425]: Disablei (will be remapped) */
+   /* _mesa_function_pool[7458]: Disablei (will be remapped) */
    "ii\0"
    "glDisableIndexedEXT\0"
    "glDisablei\0"
    "glDisableiEXT\0"
    "glDisableiOES\0"
    "\0"
-   /* _mesa_function_pool[7488]: CompressedTexSubImage3D (will be remapped) */
+   /* _mesa_function_pool[7521]: CompressedTexSubImage3D (will be remapped) */
    "iiiiiiiiiip\0"
    "glCompressedTexSubImage3D\0"
    "glCompressedTexSubImage3DARB\0"
    "glCompressedTexSubImage3DOES\0"
    "\0"
-   /* _mesa_function_pool[7585]: WindowPos4svMESA (will be remapped) */
+   /* _mesa_function_pool[7618]: WindowPos4svMESA (will be remapped) */
    "p\0"
    "glWindowPos4svMESA\0"
    "\0"
-   /* _mesa_function_pool[7607]: ObjectLabel (will be remapped) */
+   /* _mesa_function_pool[7640]: ObjectLabel (will be remapped) */
    "iiip\0"
    "glObjectLabel\0"
    "glObjectLabelKHR\0"
    "\0"
-   /* _mesa_function_pool[7644]: Color3dv (offset 12) */
+   /* _mesa_function_pool[7677]: Color3dv (offset 12) */
    "p\0"
    "glColor3dv\0"
    "\0"
-   /* _mesa_function_pool[7658]: ProgramUniform1ui64ARB (will be remapped) */
+   /* _mesa_function_pool[7691]: ProgramUniform1ui64ARB (will be remapped) */
    "iii\0"
    "glProgramUniform1ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[7688]: BeginQuery (will be remapped) */
+   /* _mesa_function_pool[7721]: BeginQuery (will be remapped) */
    "ii\0"
    "glBeginQuery\0"
    "glBeginQueryARB\0"
    "glBeginQueryEXT\0"
    "\0"
-   /* _mesa_function_pool[7737]: VertexP3uiv (will be remapped) */
+   /* _mesa_function_pool[7770]: VertexP3uiv (will be remapped) */
    "ip\0"
    "glVertexP3uiv\0"
    "\0"
-   /* _mesa_function_pool[7755]: GetUniformLocation (will be remapped) */
+   /* _mesa_function_pool[7788]: GetUniformLocation (will be remapped) */
    "ip\0"
    "glGetUniformLocation\0"
    "glGetUniformLocationARB\0"
    "\0"
-   /* _mesa_function_pool[7804]: PixelStoref (offset 249) */
+   /* _mesa_function_pool[7837]: PixelStoref (offset 249) */
    "if\0"
    "glPixelStoref\0"
    "\0"
-   /* _mesa_function_pool[7822]: WindowPos2iv (will be remapped) */
+   /* _mesa_function_pool[7855]: WindowPos2iv (will be remapped) */
    "p\0"
    "glWindowPos2iv\0"
    "glWindowPos2ivARB\0"
    "glWindowPos2ivMESA\0"
    "\0"
-   /* _mesa_function_pool[7877]: PixelStorei (offset 250) */
+   /* _mesa_function_pool[7910]: PixelStorei (offset 250) */
    "ii\0"
    "glPixelStorei\0"
    "\0"
-   /* _mesa_function_pool[7895]: AsyncMarkerSGIX (dynamic) */
+   /* _mesa_function_pool[7928]: AsyncMarkerSGIX (dynamic) */
    "i\0"
    "glAsyncMarkerSGIX\0"
    "\0"
-   /* _mesa_function_pool[7916]: VertexAttribs1svNV (will be remapped) */
+   /* _mesa_function_pool[7949]: VertexAttribs1svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs1svNV\0"
    "\0"
-   /* _mesa_function_pool[7942]: CheckNamedFramebufferStatus (will be remapped) */
+   /* _mesa_function_pool[7975]: CheckNamedFramebufferStatus (will be remapped) */
    "ii\0"
    "glCheckNamedFramebufferStatus\0"
    "\0"
-   /* _mesa_function_pool[7976]: RequestResidentProgramsNV (will be remapped) */
+   /* _mesa_function_pool[8009]: RequestResidentProgramsNV (will be remapped) */
    "ip\0"
    "glRequestResidentProgramsNV\0"
    "\0"
-   /* _mesa_function_pool[8008]: UniformSubroutinesuiv (will be remapped) */
+   /* _mesa_function_pool[8041]: UniformSubroutinesuiv (will be remapped) */
    "iip\0"
    "glUniformSubroutinesuiv\0"
    "\0"
-   /* _mesa_function_pool[8037]: ListParameterivSGIX (dynamic) */
+   /* _mesa_function_pool[8070]: ListParameterivSGIX (dynamic) */
    "iip\0"
    "glListParameterivSGIX\0"
    "\0"
-   /* _mesa_function_pool[8064]: TexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[8097]: TexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
    "pppp\0"
    "glTexCoord2fColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[8110]: CheckFramebufferStatus (will be remapped) */
+   /* _mesa_function_pool[8143]: CheckFramebufferStatus (will be remapped) */
    "i\0"
    "glCheckFramebufferStatus\0"
    "glCheckFramebufferStatusEXT\0"
    "glCheckFramebufferStatusOES\0"
    "\0"
-   /* _mesa_function_pool[8194]: DispatchComputeIndirect (will be remapped) */
+   /* _mesa_function_pool[8227]: DispatchComputeIndirect (will be remapped) */
    "i\0"
    "glDispatchComputeIndirect\0"
    "\0"
-   /* _mesa_function_pool[8223]: InvalidateBufferData (will be remapped) */
+   /* _mesa_function_pool[8256]: InvalidateBufferData (will be remapped) */
    "i\0"
    "glInvalidateBufferData\0"
    "\0"
-   /* _mesa_function_pool[8249]: GetUniformdv (will be remapped) */
+   /* _mesa_function_pool[8282]: GetUniformdv (will be remapped) */
    "iip\0"
    "glGetUniformdv\0"
    "\0"
-   /* _mesa_function_pool[8269]: ProgramLocalParameters4fvEXT (will be remapped) */
+   /* _mesa_function_pool[8302]: ProgramLocalParameters4fvEXT (will be remapped) */
    "iiip\0"
    "glProgramLocalParameters4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[8306]: VertexAttribL1dv (will be remapped) */
+   /* _mesa_function_pool[8339]: VertexAttribL1dv (will be remapped) */
    "ip\0"
    "glVertexAttribL1dv\0"
    "\0"
-   /* _mesa_function_pool[8329]: Uniform1ui64vARB (will be remapped) */
+   /* _mesa_function_pool[8362]: Uniform1ui64vARB (will be remapped) */
    "iip\0"
    "glUniform1ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[8353]: IsFramebuffer (will be remapped) */
+   /* _mesa_function_pool[8386]: IsFramebuffer (will be remapped) */
    "i\0"
    "glIsFramebuffer\0"
    "glIsFramebufferEXT\0"
    "glIsFramebufferOES\0"
    "\0"
-   /* _mesa_function_pool[8410]: GetPixelTexGenParameterfvSGIS (dynamic) */
+   /* _mesa_function_pool[8443]: GetPixelTexGenParameterfvSGIS (dynamic) */
    "ip\0"
    "glGetPixelTexGenParameterfvSGIS\0"
    "\0"
-   /* _mesa_function_pool[8446]: GetDoublev (offset 260) */
+   /* _mesa_function_pool[8479]: GetDoublev (offset 260) */
    "ip\0"
    "glGetDoublev\0"
    "\0"
-   /* _mesa_function_pool[8463]: GetObjectLabel (will be remapped) */
+   /* _mesa_function_pool[8496]: GetObjectLabel (will be remapped) */
    "iiipp\0"
    "glGetObjectLabel\0"
    "glGetObjectLabelKHR\0"
    "\0"
-   /* _mesa_function_pool[8507]: ColorP3uiv (will be remapped) */
+   /* _mesa_function_pool[8540]: ColorP3uiv (will be remapped) */
    "ip\0"
    "glColorP3uiv\0"
    "\0"
-   /* _mesa_function_pool[8524]: CombinerParameteriNV (dynamic) */
+   /* _mesa_function_pool[8557]: CombinerParameteriNV (dynamic) */
    "ii\0"
    "glCombinerParameteriNV\0"
    "\0"
-   /* _mesa_function_pool[8551]: GetTextureSubImage (will be remapped) */
+   /* _mesa_function_pool[8584]: GetTextureSubImage (will be remapped) */
    "iiiiiiiiiiip\0"
    "glGetTextureSubImage\0"
    "\0"
-   /* _mesa_function_pool[8586]: Normal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[8619]: Normal3fVertex3fvSUN (dynamic) */
    "pp\0"
    "glNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[8613]: VertexAttribI4ivEXT (will be remapped) */
+   /* _mesa_function_pool[8646]: VertexAttribI4ivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4ivEXT\0"
    "glVertexAttribI4iv\0"
    "\0"
-   /* _mesa_function_pool[8658]: VertexAttrib1svNV (will be remapped) */
+   /* _mesa_function_pool[8691]: VertexAttrib1svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib1svNV\0"
    "\0"
-   /* _mesa_function_pool[8682]: SecondaryColor3ubv (will be remapped) */
+   /* _mesa_function_pool[8715]: SecondaryColor3ubv (will be remapped) */
    "p\0"
    "glSecondaryColor3ubv\0"
    "glSecondaryColor3ubvEXT\0"
    "\0"
-   /* _mesa_function_pool[8730]: GetDebugMessageLog (will be remapped) */
+   /* _mesa_function_pool[8763]: GetDebugMessageLog (will be remapped) */
    "iipppppp\0"
    "glGetDebugMessageLogARB\0"
    "glGetDebugMessageLog\0"
    "glGetDebugMessageLogKHR\0"
    "\0"
-   /* _mesa_function_pool[8809]: DeformationMap3fSGIX (dynamic) */
+   /* _mesa_function_pool[8842]: DeformationMap3fSGIX (dynamic) */
    "iffiiffiiffiip\0"
    "glDeformationMap3fSGIX\0"
    "\0"
-   /* _mesa_function_pool[8848]: MatrixIndexubvARB (dynamic) */
+   /* _mesa_function_pool[8881]: MatrixIndexubvARB (dynamic) */
    "ip\0"
    "glMatrixIndexubvARB\0"
    "\0"
-   /* _mesa_function_pool[8872]: Color4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[8905]: Color4fNormal3fVertex3fSUN (dynamic) */
    "ffffffffff\0"
    "glColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[8913]: PixelTexGenParameterfSGIS (dynamic) */
+   /* _mesa_function_pool[8946]: PixelTexGenParameterfSGIS (dynamic) */
    "if\0"
    "glPixelTexGenParameterfSGIS\0"
    "\0"
-   /* _mesa_function_pool[8945]: Uniform4ui64ARB (will be remapped) */
+   /* _mesa_function_pool[8978]: Uniform4ui64ARB (will be remapped) */
    "iiiii\0"
    "glUniform4ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[8970]: RasterPos3fv (offset 73) */
+   /* _mesa_function_pool[9003]: RasterPos3fv (offset 73) */
    "p\0"
    "glRasterPos3fv\0"
    "\0"
-   /* _mesa_function_pool[8988]: TexCoord2fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[9021]: TexCoord2fVertex3fvSUN (dynamic) */
    "pp\0"
    "glTexCoord2fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[9017]: Color4ubVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[9050]: Color4ubVertex3fvSUN (dynamic) */
    "pp\0"
    "glColor4ubVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[9044]: GetShaderSource (will be remapped) */
+   /* _mesa_function_pool[9077]: GetShaderSource (will be remapped) */
    "iipp\0"
    "glGetShaderSource\0"
    "glGetShaderSourceARB\0"
    "\0"
-   /* _mesa_function_pool[9089]: BindProgramARB (will be remapped) */
+   /* _mesa_function_pool[9122]: BindProgramARB (will be remapped) */
    "ii\0"
    "glBindProgramARB\0"
    "glBindProgramNV\0"
    "\0"
-   /* _mesa_function_pool[9126]: VertexAttrib3sNV (will be remapped) */
+   /* _mesa_function_pool[9159]: VertexAttrib3sNV (will be remapped) */
    "iiii\0"
    "glVertexAttrib3sNV\0"
    "\0"
-   /* _mesa_function_pool[9151]: ColorFragmentOp1ATI (will be remapped) */
+   /* _mesa_function_pool[9184]: ColorFragmentOp1ATI (will be remapped) */
    "iiiiiii\0"
    "glColorFragmentOp1ATI\0"
    "\0"
-   /* _mesa_function_pool[9182]: ProgramUniformMatrix4x3fv (will be remapped) */
+   /* _mesa_function_pool[9215]: ProgramUniformMatrix4x3fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix4x3fv\0"
    "glProgramUniformMatrix4x3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[9248]: PopClientAttrib (offset 334) */
+   /* _mesa_function_pool[9281]: PopClientAttrib (offset 334) */
    "\0"
    "glPopClientAttrib\0"
    "\0"
-   /* _mesa_function_pool[9268]: DrawElementsInstancedARB (will be remapped) */
+   /* _mesa_function_pool[9301]: DrawElementsInstancedARB (will be remapped) */
    "iiipi\0"
    "glDrawElementsInstancedARB\0"
    "glDrawElementsInstancedEXT\0"
    "glDrawElementsInstanced\0"
    "\0"
-   /* _mesa_function_pool[9353]: GetQueryObjectuiv (will be remapped) */
+   /* _mesa_function_pool[9386]: GetQueryObjectuiv (will be remapped) */
    "iip\0"
    "glGetQueryObjectuiv\0"
    "glGetQueryObjectuivARB\0"
    "glGetQueryObjectuivEXT\0"
    "\0"
-   /* _mesa_function_pool[9424]: VertexAttribI4bv (will be remapped) */
+   /* _mesa_function_pool[9457]: VertexAttribI4bv (will be remapped) */
    "ip\0"
    "glVertexAttribI4bvEXT\0"
    "glVertexAttribI4bv\0"
    "\0"
-   /* _mesa_function_pool[9469]: FogCoordPointerListIBM (dynamic) */
+   /* _mesa_function_pool[9502]: FogCoordPointerListIBM (dynamic) */
    "iipi\0"
    "glFogCoordPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[9500]: DisableVertexArrayAttrib (will be remapped) */
+   /* _mesa_function_pool[9533]: DisableVertexArrayAttrib (will be remapped) */
    "ii\0"
    "glDisableVertexArrayAttrib\0"
    "\0"
-   /* _mesa_function_pool[9531]: VertexAttribL4d (will be remapped) */
+   /* _mesa_function_pool[9564]: VertexAttribL4d (will be remapped) */
    "idddd\0"
    "glVertexAttribL4d\0"
    "\0"
-   /* _mesa_function_pool[9556]: Binormal3sEXT (dynamic) */
+   /* _mesa_function_pool[9589]: Binormal3sEXT (dynamic) */
    "iii\0"
    "glBinormal3sEXT\0"
    "\0"
-   /* _mesa_function_pool[9577]: ListBase (offset 6) */
+   /* _mesa_function_pool[9610]: ListBase (offset 6) */
    "i\0"
    "glListBase\0"
    "\0"
-   /* _mesa_function_pool[9591]: GenerateMipmap (will be remapped) */
+   /* _mesa_function_pool[9624]: GenerateMipmap (will be remapped) */
    "i\0"
    "glGenerateMipmap\0"
    "glGenerateMipmapEXT\0"
    "glGenerateMipmapOES\0"
    "\0"
-   /* _mesa_function_pool[9651]: BindBufferRange (will be remapped) */
+   /* _mesa_function_pool[9684]: BindBufferRange (will be remapped) */
    "iiiii\0"
    "glBindBufferRange\0"
    "glBindBufferRangeEXT\0"
    "\0"
-   /* _mesa_function_pool[9697]: ProgramUniformMatrix2x4fv (will be remapped) */
+   /* _mesa_function_pool[9730]: ProgramUniformMatrix2x4fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix2x4fv\0"
    "glProgramUniformMatrix2x4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[9763]: BindBufferBase (will be remapped) */
+   /* _mesa_function_pool[9796]: BindBufferBase (will be remapped) */
    "iii\0"
    "glBindBufferBase\0"
    "glBindBufferBaseEXT\0"
    "\0"
-   /* _mesa_function_pool[9805]: GetQueryObjectiv (will be remapped) */
+   /* _mesa_function_pool[9838]: GetQueryObjectiv (will be remapped) */
    "iip\0"
    "glGetQueryObjectiv\0"
    "glGetQueryObjectivARB\0"
    "glGetQueryObjectivEXT\0"
    "\0"
-   /* _mesa_function_pool[9873]: VertexAttrib2s (will be remapped) */
+   /* _mesa_function_pool[9906]: VertexAttrib2s (will be remapped) */
    "iii\0"
    "glVertexAttrib2s\0"
    "glVertexAttrib2sARB\0"
    "\0"
-   /* _mesa_function_pool[9915]: SecondaryColor3fvEXT (will be remapped) */
+   /* _mesa_function_pool[9948]: SecondaryColor3fvEXT (will be remapped) */
    "p\0"
    "glSecondaryColor3fv\0"
    "glSecondaryColor3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[9961]: VertexAttrib2d (will be remapped) */
+   /* _mesa_function_pool[9994]: VertexAttrib2d (will be remapped) */
    "idd\0"
    "glVertexAttrib2d\0"
    "glVertexAttrib2dARB\0"
    "\0"
-   /* _mesa_function_pool[10003]: ClearNamedFramebufferiv (will be remapped) */
+   /* _mesa_function_pool[10036]: ClearNamedFramebufferiv (will be remapped) */
    "iiip\0"
    "glClearNamedFramebufferiv\0"
    "\0"
-   /* _mesa_function_pool[10035]: Uniform1fv (will be remapped) */
+   /* _mesa_function_pool[10068]: Uniform1fv (will be remapped) */
    "iip\0"
    "glUniform1fv\0"
    "glUniform1fvARB\0"
    "\0"
-   /* _mesa_function_pool[10069]: GetProgramPipelineInfoLog (will be remapped) */
+   /* _mesa_function_pool[10102]: GetProgramPipelineInfoLog (will be remapped) */
    "iipp\0"
    "glGetProgramPipelineInfoLog\0"
    "glGetProgramPipelineInfoLogEXT\0"
    "\0"
-   /* _mesa_function_pool[10134]: TextureMaterialEXT (dynamic) */
+   /* _mesa_function_pool[10167]: TextureMaterialEXT (dynamic) */
    "ii\0"
    "glTextureMaterialEXT\0"
    "\0"
-   /* _mesa_function_pool[10159]: DepthBoundsEXT (will be remapped) */
+   /* _mesa_function_pool[10192]: DepthBoundsEXT (will be remapped) */
    "dd\0"
    "glDepthBoundsEXT\0"
    "\0"
-   /* _mesa_function_pool[10180]: BufferStorageMemEXT (will be remapped) */
+   /* _mesa_function_pool[10213]: BufferStorageMemEXT (will be remapped) */
    "iiii\0"
    "glBufferStorageMemEXT\0"
    "\0"
-   /* _mesa_function_pool[10208]: WindowPos3fv (will be remapped) */
+   /* _mesa_function_pool[10241]: WindowPos3fv (will be remapped) */
    "p\0"
    "glWindowPos3fv\0"
    "glWindowPos3fvARB\0"
    "glWindowPos3fvMESA\0"
    "\0"
-   /* _mesa_function_pool[10263]: BindVertexArrayAPPLE (dynamic) */
+   /* _mesa_function_pool[10296]: BindVertexArrayAPPLE (dynamic) */
    "i\0"
    "glBindVertexArrayAPPLE\0"
    "\0"
-   /* _mesa_function_pool[10289]: GetHistogramParameteriv (offset 363) */
+   /* _mesa_function_pool[10322]: GetHistogramParameteriv (offset 363) */
    "iip\0"
    "glGetHistogramParameteriv\0"
    "glGetHistogramParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[10349]: PointParameteriv (will be remapped) */
+   /* _mesa_function_pool[10382]: PointParameteriv (will be remapped) */
    "ip\0"
    "glPointParameteriv\0"
    "glPointParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[10393]: NamedRenderbufferStorage (will be remapped) */
+   /* _mesa_function_pool[10426]: NamedRenderbufferStorage (will be remapped) */
    "iiii\0"
    "glNamedRenderbufferStorage\0"
    "\0"
-   /* _mesa_function_pool[10426]: GetProgramivARB (will be remapped) */
+   /* _mesa_function_pool[10459]: GetProgramivARB (will be remapped) */
    "iip\0"
    "glGetProgramivARB\0"
    "\0"
-   /* _mesa_function_pool[10449]: BindRenderbuffer (will be remapped) */
+   /* _mesa_function_pool[10482]: BindRenderbuffer (will be remapped) */
    "ii\0"
    "glBindRenderbuffer\0"
    "glBindRenderbufferOES\0"
    "\0"
-   /* _mesa_function_pool[10494]: SecondaryColor3fEXT (will be remapped) */
+   /* _mesa_function_pool[10527]: SecondaryColor3fEXT (will be remapped) */
    "fff\0"
    "glSecondaryColor3f\0"
    "glSecondaryColor3fEXT\0"
    "\0"
-   /* _mesa_function_pool[10540]: PrimitiveRestartIndex (will be remapped) */
+   /* _mesa_function_pool[10573]: PrimitiveRestartIndex (will be remapped) */
    "i\0"
    "glPrimitiveRestartIndex\0"
    "glPrimitiveRestartIndexNV\0"
    "\0"
-   /* _mesa_function_pool[10593]: TextureStorageMem3DEXT (will be remapped) */
+   /* _mesa_function_pool[10626]: TextureStorageMem3DEXT (will be remapped) */
    "iiiiiiii\0"
    "glTextureStorageMem3DEXT\0"
    "\0"
-   /* _mesa_function_pool[10628]: VertexAttribI4ubv (will be remapped) */
+   /* _mesa_function_pool[10661]: VertexAttribI4ubv (will be remapped) */
    "ip\0"
    "glVertexAttribI4ubvEXT\0"
    "glVertexAttribI4ubv\0"
    "\0"
-   /* _mesa_function_pool[10675]: GetGraphicsResetStatusARB (will be remapped) */
+   /* _mesa_function_pool[10708]: GetGraphicsResetStatusARB (will be remapped) */
    "\0"
    "glGetGraphicsResetStatusARB\0"
    "glGetGraphicsResetStatus\0"
    "glGetGraphicsResetStatusKHR\0"
    "\0"
-   /* _mesa_function_pool[10758]: CreateRenderbuffers (will be remapped) */
+   /* _mesa_function_pool[10791]: CreateRenderbuffers (will be remapped) */
    "ip\0"
    "glCreateRenderbuffers\0"
    "\0"
-   /* _mesa_function_pool[10784]: ActiveStencilFaceEXT (will be remapped) */
+   /* _mesa_function_pool[10817]: ActiveStencilFaceEXT (will be remapped) */
    "i\0"
    "glActiveStencilFaceEXT\0"
    "\0"
-   /* _mesa_function_pool[10810]: VertexAttrib4dNV (will be remapped) */
+   /* _mesa_function_pool[10843]: VertexAttrib4dNV (will be remapped) */
    "idddd\0"
    "glVertexAttrib4dNV\0"
    "\0"
-   /* _mesa_function_pool[10836]: DepthRange (offset 288) */
+   /* _mesa_function_pool[10869]: DepthRange (offset 288) */
    "dd\0"
    "glDepthRange\0"
    "\0"
-   /* _mesa_function_pool[10853]: TexBumpParameterivATI (will be remapped) */
+   /* _mesa_function_pool[10886]: TexBumpParameterivATI (will be remapped) */
    "ip\0"
    "glTexBumpParameterivATI\0"
    "\0"
-   /* _mesa_function_pool[10881]: VertexAttrib4fNV (will be remapped) */
+   /* _mesa_function_pool[10914]: VertexAttrib4fNV (will be remapped) */
    "iffff\0"
    "glVertexAttrib4fNV\0"
    "\0"
-   /* _mesa_function_pool[10907]: Uniform4fv (will be remapped) */
+   /* _mesa_function_pool[10940]: Uniform4fv (will be remapped) */
    "iip\0"
    "glUniform4fv\0"
    "glUniform4fvARB\0"
    "\0"
-   /* _mesa_function_pool[10941]: DrawMeshArraysSUN (dynamic) */
+   /* _mesa_function_pool[10974]: DrawMeshArraysSUN (dynamic) */
    "iiii\0"
    "glDrawMeshArraysSUN\0"
    "\0"
-   /* _mesa_function_pool[10967]: SamplerParameterIiv (will be remapped) */
+   /* _mesa_function_pool[11000]: SamplerParameterIiv (will be remapped) */
    "iip\0"
    "glSamplerParameterIiv\0"
    "glSamplerParameterIivEXT\0"
    "glSamplerParameterIivOES\0"
    "\0"
-   /* _mesa_function_pool[11044]: GetMapControlPointsNV (dynamic) */
+   /* _mesa_function_pool[11077]: GetMapControlPointsNV (dynamic) */
    "iiiiiip\0"
    "glGetMapControlPointsNV\0"
    "\0"
-   /* _mesa_function_pool[11077]: SpriteParameterivSGIX (dynamic) */
+   /* _mesa_function_pool[11110]: SpriteParameterivSGIX (dynamic) */
    "ip\0"
    "glSpriteParameterivSGIX\0"
    "\0"
-   /* _mesa_function_pool[11105]: Frustumf (will be remapped) */
+   /* _mesa_function_pool[11138]: Frustumf (will be remapped) */
    "ffffff\0"
    "glFrustumfOES\0"
    "glFrustumf\0"
    "\0"
-   /* _mesa_function_pool[11138]: GetQueryBufferObjectui64v (will be remapped) */
+   /* _mesa_function_pool[11171]: GetQueryBufferObjectui64v (will be remapped) */
    "iiii\0"
    "glGetQueryBufferObjectui64v\0"
    "\0"
-   /* _mesa_function_pool[11172]: ProgramUniform2uiv (will be remapped) */
+   /* _mesa_function_pool[11205]: ProgramUniform2uiv (will be remapped) */
    "iiip\0"
    "glProgramUniform2uiv\0"
    "glProgramUniform2uivEXT\0"
    "\0"
-   /* _mesa_function_pool[11223]: Rectsv (offset 93) */
+   /* _mesa_function_pool[11256]: Rectsv (offset 93) */
    "pp\0"
    "glRectsv\0"
    "\0"
-   /* _mesa_function_pool[11236]: Frustumx (will be remapped) */
+   /* _mesa_function_pool[11269]: Frustumx (will be remapped) */
    "iiiiii\0"
    "glFrustumxOES\0"
    "glFrustumx\0"
    "\0"
-   /* _mesa_function_pool[11269]: CullFace (offset 152) */
+   /* _mesa_function_pool[11302]: CullFace (offset 152) */
    "i\0"
    "glCullFace\0"
    "\0"
-   /* _mesa_function_pool[11283]: BindTexture (offset 307) */
+   /* _mesa_function_pool[11316]: BindTexture (offset 307) */
    "ii\0"
    "glBindTexture\0"
    "glBindTextureEXT\0"
    "\0"
-   /* _mesa_function_pool[11318]: MultiTexCoord4fARB (offset 402) */
+   /* _mesa_function_pool[11351]: MultiTexCoord4fARB (offset 402) */
    "iffff\0"
    "glMultiTexCoord4f\0"
    "glMultiTexCoord4fARB\0"
    "\0"
-   /* _mesa_function_pool[11364]: Uniform2ui64ARB (will be remapped) */
+   /* _mesa_function_pool[11397]: Uniform2ui64ARB (will be remapped) */
    "iii\0"
    "glUniform2ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[11387]: MultiTexCoordP2uiv (will be remapped) */
+   /* _mesa_function_pool[11420]: MultiTexCoordP2uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP2uiv\0"
    "\0"
-   /* _mesa_function_pool[11413]: BeginPerfQueryINTEL (will be remapped) */
+   /* _mesa_function_pool[11446]: BeginPerfQueryINTEL (will be remapped) */
    "i\0"
    "glBeginPerfQueryINTEL\0"
    "\0"
-   /* _mesa_function_pool[11438]: NormalPointer (offset 318) */
+   /* _mesa_function_pool[11471]: NormalPointer (offset 318) */
    "iip\0"
    "glNormalPointer\0"
    "\0"
-   /* _mesa_function_pool[11459]: TangentPointerEXT (dynamic) */
+   /* _mesa_function_pool[11492]: TangentPointerEXT (dynamic) */
    "iip\0"
    "glTangentPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[11484]: WindowPos4iMESA (will be remapped) */
+   /* _mesa_function_pool[11517]: WindowPos4iMESA (will be remapped) */
    "iiii\0"
    "glWindowPos4iMESA\0"
    "\0"
-   /* _mesa_function_pool[11508]: ReferencePlaneSGIX (dynamic) */
+   /* _mesa_function_pool[11541]: ReferencePlaneSGIX (dynamic) */
    "p\0"
    "glReferencePlaneSGIX\0"
    "\0"
-   /* _mesa_function_pool[11532]: VertexAttrib4bv (will be remapped) */
+   /* _mesa_function_pool[11565]: VertexAttrib4bv (will be remapped) */
    "ip\0"
    "glVertexAttrib4bv\0"
    "glVertexAttrib4bvARB\0"
    "\0"
-   /* _mesa_function_pool[11575]: ReplacementCodeuivSUN (dynamic) */
+   /* _mesa_function_pool[11608]: ReplacementCodeuivSUN (dynamic) */
    "p\0"
    "glReplacementCodeuivSUN\0"
    "\0"
-   /* _mesa_function_pool[11602]: SecondaryColor3usv (will be remapped) */
+   /* _mesa_function_pool[11635]: SecondaryColor3usv (will be remapped) */
    "p\0"
    "glSecondaryColor3usv\0"
    "glSecondaryColor3usvEXT\0"
    "\0"
-   /* _mesa_function_pool[11650]: GetPixelMapuiv (offset 272) */
+   /* _mesa_function_pool[11683]: GetPixelMapuiv (offset 272) */
    "ip\0"
    "glGetPixelMapuiv\0"
    "\0"
-   /* _mesa_function_pool[11671]: MapNamedBuffer (will be remapped) */
+   /* _mesa_function_pool[11704]: MapNamedBuffer (will be remapped) */
    "ii\0"
    "glMapNamedBuffer\0"
    "\0"
-   /* _mesa_function_pool[11692]: Indexfv (offset 47) */
+   /* _mesa_function_pool[11725]: Indexfv (offset 47) */
    "p\0"
    "glIndexfv\0"
    "\0"
-   /* _mesa_function_pool[11705]: AlphaFragmentOp1ATI (will be remapped) */
+   /* _mesa_function_pool[11738]: AlphaFragmentOp1ATI (will be remapped) */
    "iiiiii\0"
    "glAlphaFragmentOp1ATI\0"
    "\0"
-   /* _mesa_function_pool[11735]: ListParameteriSGIX (dynamic) */
+   /* _mesa_function_pool[11768]: ListParameteriSGIX (dynamic) */
    "iii\0"
    "glListParameteriSGIX\0"
    "\0"
-   /* _mesa_function_pool[11761]: GetFloatv (offset 262) */
+   /* _mesa_function_pool[11794]: GetFloatv (offset 262) */
    "ip\0"
    "glGetFloatv\0"
    "\0"
-   /* _mesa_function_pool[11777]: ProgramUniform2dv (will be remapped) */
+   /* _mesa_function_pool[11810]: ProgramUniform2dv (will be remapped) */
    "iiip\0"
    "glProgramUniform2dv\0"
    "\0"
-   /* _mesa_function_pool[11803]: MultiTexCoord3i (offset 396) */
+   /* _mesa_function_pool[11836]: MultiTexCoord3i (offset 396) */
    "iiii\0"
    "glMultiTexCoord3i\0"
    "glMultiTexCoord3iARB\0"
    "\0"
-   /* _mesa_function_pool[11848]: ProgramUniform1fv (will be remapped) */
+   /* _mesa_function_pool[11881]: ProgramUniform1fv (will be remapped) */
    "iiip\0"
    "glProgramUniform1fv\0"
    "glProgramUniform1fvEXT\0"
    "\0"
-   /* _mesa_function_pool[11897]: MultiTexCoord3d (offset 392) */
+   /* _mesa_function_pool[11930]: MultiTexCoord3d (offset 392) */
    "iddd\0"
    "glMultiTexCoord3d\0"
    "glMultiTexCoord3dARB\0"
    "\0"
-   /* _mesa_function_pool[11942]: TexCoord3sv (offset 117) */
+   /* _mesa_function_pool[11975]: TexCoord3sv (offset 117) */
    "p\0"
    "glTexCoord3sv\0"
    "\0"
-   /* _mesa_function_pool[11959]: Fogfv (offset 154) */
+   /* _mesa_function_pool[11992]: Fogfv (offset 154) */
    "ip\0"
    "glFogfv\0"
    "\0"
-   /* _mesa_function_pool[11971]: Minmax (offset 368) */
+   /* _mesa_function_pool[12004]: Minmax (offset 368) */
    "iii\0"
    "glMinmax\0"
    "glMinmaxEXT\0"
    "\0"
-   /* _mesa_function_pool[11997]: MultiTexCoord3s (offset 398) */
+   /* _mesa_function_pool[12030]: MultiTexCoord3s (offset 398) */
    "iiii\0"
    "glMultiTexCoord3s\0"
    "glMultiTexCoord3sARB\0"
    "\0"
-   /* _mesa_function_pool[12042]: FinishTextureSUNX (dynamic) */
+   /* _mesa_function_pool[12075]: FinishTextureSUNX (dynamic) */
    "\0"
    "glFinishTextureSUNX\0"
    "\0"
-   /* _mesa_function_pool[12064]: GetFinalCombinerInputParameterfvNV (dynamic) */
+   /* _mesa_function_pool[12097]: GetFinalCombinerInputParameterfvNV (dynamic) */
    "iip\0"
    "glGetFinalCombinerInputParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[12106]: PollInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[12139]: PollInstrumentsSGIX (dynamic) */
    "p\0"
    "glPollInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[12131]: Vertex4iv (offset 147) */
+   /* _mesa_function_pool[12164]: Vertex4iv (offset 147) */
    "p\0"
    "glVertex4iv\0"
    "\0"
-   /* _mesa_function_pool[12146]: BufferSubData (will be remapped) */
+   /* _mesa_function_pool[12179]: BufferSubData (will be remapped) */
    "iiip\0"
    "glBufferSubData\0"
    "glBufferSubDataARB\0"
    "\0"
-   /* _mesa_function_pool[12187]: TexCoord4dv (offset 119) */
+   /* _mesa_function_pool[12220]: TexCoord4dv (offset 119) */
    "p\0"
    "glTexCoord4dv\0"
    "\0"
-   /* _mesa_function_pool[12204]: Normal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[12237]: Normal3fVertex3fSUN (dynamic) */
    "ffffff\0"
    "glNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[12234]: Begin (offset 7) */
+   /* _mesa_function_pool[12267]: Begin (offset 7) */
    "i\0"
    "glBegin\0"
    "\0"
-   /* _mesa_function_pool[12245]: LightModeli (offset 165) */
+   /* _mesa_function_pool[12278]: LightModeli (offset 165) */
    "ii\0"
    "glLightModeli\0"
    "\0"
-   /* _mesa_function_pool[12263]: UniformMatrix2fv (will be remapped) */
+   /* _mesa_function_pool[12296]: UniformMatrix2fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix2fv\0"
    "glUniformMatrix2fvARB\0"
    "\0"
-   /* _mesa_function_pool[12310]: LightModelf (offset 163) */
+   /* _mesa_function_pool[12343]: LightModelf (offset 163) */
    "if\0"
    "glLightModelf\0"
    "\0"
-   /* _mesa_function_pool[12328]: GetTexParameterfv (offset 282) */
+   /* _mesa_function_pool[12361]: GetTexParameterfv (offset 282) */
    "iip\0"
    "glGetTexParameterfv\0"
    "\0"
-   /* _mesa_function_pool[12353]: TextureStorage1D (will be remapped) */
+   /* _mesa_function_pool[12386]: TextureStorage1D (will be remapped) */
    "iiii\0"
    "glTextureStorage1D\0"
    "\0"
-   /* _mesa_function_pool[12378]: BinormalPointerEXT (dynamic) */
+   /* _mesa_function_pool[12411]: BinormalPointerEXT (dynamic) */
    "iip\0"
    "glBinormalPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[12404]: GetCombinerInputParameterivNV (dynamic) */
+   /* _mesa_function_pool[12437]: GetCombinerInputParameterivNV (dynamic) */
    "iiiip\0"
    "glGetCombinerInputParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[12443]: DeleteAsyncMarkersSGIX (dynamic) */
+   /* _mesa_function_pool[12476]: DeleteAsyncMarkersSGIX (dynamic) */
    "ii\0"
    "glDeleteAsyncMarkersSGIX\0"
    "\0"
-   /* _mesa_function_pool[12472]: MultiTexCoord2fvARB (offset 387) */
+   /* _mesa_function_pool[12505]: MultiTexCoord2fvARB (offset 387) */
    "ip\0"
    "glMultiTexCoord2fv\0"
    "glMultiTexCoord2fvARB\0"
    "\0"
-   /* _mesa_function_pool[12517]: VertexAttrib4ubv (will be remapped) */
+   /* _mesa_function_pool[12550]: VertexAttrib4ubv (will be remapped) */
    "ip\0"
    "glVertexAttrib4ubv\0"
    "glVertexAttrib4ubvARB\0"
    "\0"
-   /* _mesa_function_pool[12562]: GetnTexImageARB (will be remapped) */
+   /* _mesa_function_pool[12595]: GetnTexImageARB (will be remapped) */
    "iiiiip\0"
    "glGetnTexImageARB\0"
    "\0"
-   /* _mesa_function_pool[12588]: ColorMask (offset 210) */
+   /* _mesa_function_pool[12621]: ColorMask (offset 210) */
    "iiii\0"
    "glColorMask\0"
    "\0"
-   /* _mesa_function_pool[12606]: GenAsyncMarkersSGIX (dynamic) */
+   /* _mesa_function_pool[12639]: GenAsyncMarkersSGIX (dynamic) */
    "i\0"
    "glGenAsyncMarkersSGIX\0"
    "\0"
-   /* _mesa_function_pool[12631]: MultiTexCoord4x (will be remapped) */
+   /* _mesa_function_pool[12664]: MultiTexCoord4x (will be remapped) */
    "iiiii\0"
    "glMultiTexCoord4xOES\0"
    "glMultiTexCoord4x\0"
    "\0"
-   /* _mesa_function_pool[12677]: ReplacementCodeuiVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[12710]: ReplacementCodeuiVertex3fSUN (dynamic) */
    "ifff\0"
    "glReplacementCodeuiVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[12714]: UniformHandleui64ARB (will be remapped) */
+   /* _mesa_function_pool[12747]: UniformHandleui64ARB (will be remapped) */
    "ii\0"
    "glUniformHandleui64ARB\0"
    "\0"
-   /* _mesa_function_pool[12741]: VertexAttribs4svNV (will be remapped) */
+   /* _mesa_function_pool[12774]: VertexAttribs4svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4svNV\0"
    "\0"
-   /* _mesa_function_pool[12767]: DrawElementsInstancedBaseInstance (will be remapped) */
+   /* _mesa_function_pool[12800]: DrawElementsInstancedBaseInstance (will be remapped) */
    "iiipii\0"
    "glDrawElementsInstancedBaseInstance\0"
    "glDrawElementsInstancedBaseInstanceEXT\0"
    "\0"
-   /* _mesa_function_pool[12850]: UniformMatrix4fv (will be remapped) */
+   /* _mesa_function_pool[12883]: UniformMatrix4fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4fv\0"
    "glUniformMatrix4fvARB\0"
    "\0"
-   /* _mesa_function_pool[12897]: UniformMatrix3x2fv (will be remapped) */
+   /* _mesa_function_pool[12930]: UniformMatrix3x2fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3x2fv\0"
    "\0"
-   /* _mesa_function_pool[12924]: VertexAttrib4Nuiv (will be remapped) */
+   /* _mesa_function_pool[12957]: VertexAttrib4Nuiv (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nuiv\0"
    "glVertexAttrib4NuivARB\0"
    "\0"
-   /* _mesa_function_pool[12971]: ClientActiveTexture (offset 375) */
+   /* _mesa_function_pool[13004]: ClientActiveTexture (offset 375) */
    "i\0"
    "glClientActiveTexture\0"
    "glClientActiveTextureARB\0"
    "\0"
-   /* _mesa_function_pool[13021]: GetUniformIndices (will be remapped) */
+   /* _mesa_function_pool[13054]: GetUniformIndices (will be remapped) */
    "iipp\0"
    "glGetUniformIndices\0"
    "\0"
-   /* _mesa_function_pool[13047]: GetTexBumpParameterivATI (will be remapped) */
+   /* _mesa_function_pool[13080]: GetTexBumpParameterivATI (will be remapped) */
    "ip\0"
    "glGetTexBumpParameterivATI\0"
    "\0"
-   /* _mesa_function_pool[13078]: Binormal3bEXT (dynamic) */
+   /* _mesa_function_pool[13111]: Binormal3bEXT (dynamic) */
    "iii\0"
    "glBinormal3bEXT\0"
    "\0"
-   /* _mesa_function_pool[13099]: CombinerParameterivNV (dynamic) */
+   /* _mesa_function_pool[13132]: CombinerParameterivNV (dynamic) */
    "ip\0"
    "glCombinerParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[13127]: MultiTexCoord2sv (offset 391) */
+   /* _mesa_function_pool[13160]: MultiTexCoord2sv (offset 391) */
    "ip\0"
    "glMultiTexCoord2sv\0"
    "glMultiTexCoord2svARB\0"
    "\0"
-   /* _mesa_function_pool[13172]: NamedBufferStorage (will be remapped) */
+   /* _mesa_function_pool[13205]: NamedBufferStorage (will be remapped) */
    "iipi\0"
    "glNamedBufferStorage\0"
    "\0"
-   /* _mesa_function_pool[13199]: NamedFramebufferDrawBuffer (will be remapped) */
+   /* _mesa_function_pool[13232]: NamedFramebufferDrawBuffer (will be remapped) */
    "ii\0"
    "glNamedFramebufferDrawBuffer\0"
    "\0"
-   /* _mesa_function_pool[13232]: NamedFramebufferTextureLayer (will be remapped) */
+   /* _mesa_function_pool[13265]: NamedFramebufferTextureLayer (will be remapped) */
    "iiiii\0"
    "glNamedFramebufferTextureLayer\0"
    "\0"
-   /* _mesa_function_pool[13270]: LoadIdentity (offset 290) */
+   /* _mesa_function_pool[13303]: LoadIdentity (offset 290) */
    "\0"
    "glLoadIdentity\0"
    "\0"
-   /* _mesa_function_pool[13287]: ActiveShaderProgram (will be remapped) */
+   /* _mesa_function_pool[13320]: ActiveShaderProgram (will be remapped) */
    "ii\0"
    "glActiveShaderProgram\0"
    "glActiveShaderProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[13338]: BindImageTextures (will be remapped) */
+   /* _mesa_function_pool[13371]: BindImageTextures (will be remapped) */
    "iip\0"
    "glBindImageTextures\0"
    "\0"
-   /* _mesa_function_pool[13363]: DeleteTransformFeedbacks (will be remapped) */
+   /* _mesa_function_pool[13396]: DeleteTransformFeedbacks (will be remapped) */
    "ip\0"
    "glDeleteTransformFeedbacks\0"
    "\0"
-   /* _mesa_function_pool[13394]: VertexAttrib4ubvNV (will be remapped) */
+   /* _mesa_function_pool[13427]: VertexAttrib4ubvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib4ubvNV\0"
    "\0"
-   /* _mesa_function_pool[13419]: FogCoordfEXT (will be remapped) */
+   /* _mesa_function_pool[13452]: FogCoordfEXT (will be remapped) */
    "f\0"
    "glFogCoordf\0"
    "glFogCoordfEXT\0"
    "\0"
-   /* _mesa_function_pool[13449]: GetMapfv (offset 267) */
+   /* _mesa_function_pool[13482]: GetMapfv (offset 267) */
    "iip\0"
    "glGetMapfv\0"
    "\0"
-   /* _mesa_function_pool[13465]: GetProgramInfoLog (will be remapped) */
+   /* _mesa_function_pool[13498]: GetProgramInfoLog (will be remapped) */
    "iipp\0"
    "glGetProgramInfoLog\0"
    "\0"
-   /* _mesa_function_pool[13491]: BindTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[13524]: BindTransformFeedback (will be remapped) */
    "ii\0"
    "glBindTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[13519]: TexCoord4fColor4fNormal3fVertex4fvSUN (dynamic) */
+   /* _mesa_function_pool[13552]: TexCoord4fColor4fNormal3fVertex4fvSUN (dynamic) */
    "pppp\0"
    "glTexCoord4fColor4fNormal3fVertex4fvSUN\0"
    "\0"
-   /* _mesa_function_pool[13565]: GetPixelMapfv (offset 271) */
+   /* _mesa_function_pool[13598]: GetPixelMapfv (offset 271) */
    "ip\0"
    "glGetPixelMapfv\0"
    "\0"
-   /* _mesa_function_pool[13585]: TextureBufferRange (will be remapped) */
+   /* _mesa_function_pool[13618]: TextureBufferRange (will be remapped) */
    "iiiii\0"
    "glTextureBufferRange\0"
    "\0"
-   /* _mesa_function_pool[13613]: WeightivARB (dynamic) */
+   /* _mesa_function_pool[13646]: WeightivARB (dynamic) */
    "ip\0"
    "glWeightivARB\0"
    "\0"
-   /* _mesa_function_pool[13631]: VertexAttrib4svNV (will be remapped) */
+   /* _mesa_function_pool[13664]: VertexAttrib4svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib4svNV\0"
    "\0"
-   /* _mesa_function_pool[13655]: PatchParameteri (will be remapped) */
+   /* _mesa_function_pool[13688]: PatchParameteri (will be remapped) */
    "ii\0"
    "glPatchParameteri\0"
    "glPatchParameteriEXT\0"
    "glPatchParameteriOES\0"
    "\0"
-   /* _mesa_function_pool[13719]: ReplacementCodeuiTexCoord2fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[13752]: ReplacementCodeuiTexCoord2fVertex3fSUN (dynamic) */
    "ifffff\0"
    "glReplacementCodeuiTexCoord2fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[13768]: GetNamedBufferSubData (will be remapped) */
+   /* _mesa_function_pool[13801]: GetNamedBufferSubData (will be remapped) */
    "iiip\0"
    "glGetNamedBufferSubData\0"
    "\0"
-   /* _mesa_function_pool[13798]: VDPAUSurfaceAccessNV (will be remapped) */
+   /* _mesa_function_pool[13831]: VDPAUSurfaceAccessNV (will be remapped) */
    "ii\0"
    "glVDPAUSurfaceAccessNV\0"
    "\0"
-   /* _mesa_function_pool[13825]: EdgeFlagPointer (offset 312) */
+   /* _mesa_function_pool[13858]: EdgeFlagPointer (offset 312) */
    "ip\0"
    "glEdgeFlagPointer\0"
    "\0"
-   /* _mesa_function_pool[13847]: WindowPos2f (will be remapped) */
+   /* _mesa_function_pool[13880]: WindowPos2f (will be remapped) */
    "ff\0"
    "glWindowPos2f\0"
    "glWindowPos2fARB\0"
    "glWindowPos2fMESA\0"
    "\0"
-   /* _mesa_function_pool[13900]: WindowPos2d (will be remapped) */
+   /* _mesa_function_pool[13933]: WindowPos2d (will be remapped) */
    "dd\0"
    "glWindowPos2d\0"
    "glWindowPos2dARB\0"
    "glWindowPos2dMESA\0"
    "\0"
-   /* _mesa_function_pool[13953]: GetVertexAttribLdv (will be remapped) */
+   /* _mesa_function_pool[13986]: GetVertexAttribLdv (will be remapped) */
    "iip\0"
    "glGetVertexAttribLdv\0"
    "\0"
-   /* _mesa_function_pool[13979]: WindowPos2i (will be remapped) */
+   /* _mesa_function_pool[14012]: WindowPos2i (will be remapped) */
    "ii\0"
    "glWindowPos2i\0"
    "glWindowPos2iARB\0"
    "glWindowPos2iMESA\0"
    "\0"
-   /* _mesa_function_pool[14032]: WindowPos2s (will be remapped) */
+   /* _mesa_function_pool[14065]: WindowPos2s (will be remapped) */
    "ii\0"
    "glWindowPos2s\0"
    "glWindowPos2sARB\0"
    "glWindowPos2sMESA\0"
    "\0"
-   /* _mesa_function_pool[14085]: VertexAttribI1uiEXT (will be remapped) */
+   /* _mesa_function_pool[14118]: VertexAttribI1uiEXT (will be remapped) */
    "ii\0"
    "glVertexAttribI1uiEXT\0"
    "glVertexAttribI1ui\0"
    "\0"
-   /* _mesa_function_pool[14130]: DeleteSync (will be remapped) */
+   /* _mesa_function_pool[14163]: DeleteSync (will be remapped) */
    "i\0"
    "glDeleteSync\0"
    "\0"
-   /* _mesa_function_pool[14146]: WindowPos4fvMESA (will be remapped) */
+   /* _mesa_function_pool[14179]: WindowPos4fvMESA (will be remapped) */
    "p\0"
    "glWindowPos4fvMESA\0"
    "\0"
-   /* _mesa_function_pool[14168]: CompressedTexImage3D (will be remapped) */
+   /* _mesa_function_pool[14201]: CompressedTexImage3D (will be remapped) */
    "iiiiiiiip\0"
    "glCompressedTexImage3D\0"
    "glCompressedTexImage3DARB\0"
    "glCompressedTexImage3DOES\0"
    "\0"
-   /* _mesa_function_pool[14254]: GenSemaphoresEXT (will be remapped) */
+   /* _mesa_function_pool[14287]: GenSemaphoresEXT (will be remapped) */
    "ip\0"
    "glGenSemaphoresEXT\0"
    "\0"
-   /* _mesa_function_pool[14277]: VertexAttribI1uiv (will be remapped) */
+   /* _mesa_function_pool[14310]: VertexAttribI1uiv (will be remapped) */
    "ip\0"
    "glVertexAttribI1uivEXT\0"
    "glVertexAttribI1uiv\0"
    "\0"
-   /* _mesa_function_pool[14324]: SecondaryColor3dv (will be remapped) */
+   /* _mesa_function_pool[14357]: SecondaryColor3dv (will be remapped) */
    "p\0"
    "glSecondaryColor3dv\0"
    "glSecondaryColor3dvEXT\0"
    "\0"
-   /* _mesa_function_pool[14370]: GetListParameterivSGIX (dynamic) */
+   /* _mesa_function_pool[14403]: GetListParameterivSGIX (dynamic) */
    "iip\0"
    "glGetListParameterivSGIX\0"
    "\0"
-   /* _mesa_function_pool[14400]: GetnPixelMapusvARB (will be remapped) */
+   /* _mesa_function_pool[14433]: GetnPixelMapusvARB (will be remapped) */
    "iip\0"
    "glGetnPixelMapusvARB\0"
    "\0"
-   /* _mesa_function_pool[14426]: VertexAttrib3s (will be remapped) */
+   /* _mesa_function_pool[14459]: VertexAttrib3s (will be remapped) */
    "iiii\0"
    "glVertexAttrib3s\0"
    "glVertexAttrib3sARB\0"
    "\0"
-   /* _mesa_function_pool[14469]: UniformMatrix4x3fv (will be remapped) */
+   /* _mesa_function_pool[14502]: UniformMatrix4x3fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4x3fv\0"
    "\0"
-   /* _mesa_function_pool[14496]: Binormal3dEXT (dynamic) */
+   /* _mesa_function_pool[14529]: Binormal3dEXT (dynamic) */
    "ddd\0"
    "glBinormal3dEXT\0"
    "\0"
-   /* _mesa_function_pool[14517]: GetQueryiv (will be remapped) */
+   /* _mesa_function_pool[14550]: GetQueryiv (will be remapped) */
    "iip\0"
    "glGetQueryiv\0"
    "glGetQueryivARB\0"
    "glGetQueryivEXT\0"
    "\0"
-   /* _mesa_function_pool[14567]: VertexAttrib3d (will be remapped) */
+   /* _mesa_function_pool[14600]: VertexAttrib3d (will be remapped) */
    "iddd\0"
    "glVertexAttrib3d\0"
    "glVertexAttrib3dARB\0"
    "\0"
-   /* _mesa_function_pool[14610]: ImageTransformParameterfHP (dynamic) */
+   /* _mesa_function_pool[14643]: ImageTransformParameterfHP (dynamic) */
    "iif\0"
    "glImageTransformParameterfHP\0"
    "\0"
-   /* _mesa_function_pool[14644]: MapNamedBufferRange (will be remapped) */
+   /* _mesa_function_pool[14677]: MapNamedBufferRange (will be remapped) */
    "iiii\0"
    "glMapNamedBufferRange\0"
    "\0"
-   /* _mesa_function_pool[14672]: MapBuffer (will be remapped) */
+   /* _mesa_function_pool[14705]: MapBuffer (will be remapped) */
    "ii\0"
    "glMapBuffer\0"
    "glMapBufferARB\0"
    "glMapBufferOES\0"
    "\0"
-   /* _mesa_function_pool[14718]: GetProgramStageiv (will be remapped) */
+   /* _mesa_function_pool[14751]: GetProgramStageiv (will be remapped) */
    "iiip\0"
    "glGetProgramStageiv\0"
    "\0"
-   /* _mesa_function_pool[14744]: VertexAttrib4Nbv (will be remapped) */
+   /* _mesa_function_pool[14777]: VertexAttrib4Nbv (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nbv\0"
    "glVertexAttrib4NbvARB\0"
    "\0"
-   /* _mesa_function_pool[14789]: ProgramBinary (will be remapped) */
+   /* _mesa_function_pool[14822]: ProgramBinary (will be remapped) */
    "iipi\0"
    "glProgramBinary\0"
    "glProgramBinaryOES\0"
    "\0"
-   /* _mesa_function_pool[14830]: InvalidateTexImage (will be remapped) */
+   /* _mesa_function_pool[14863]: InvalidateTexImage (will be remapped) */
    "ii\0"
    "glInvalidateTexImage\0"
    "\0"
-   /* _mesa_function_pool[14855]: Uniform4ui (will be remapped) */
+   /* _mesa_function_pool[14888]: Uniform4ui (will be remapped) */
    "iiiii\0"
    "glUniform4uiEXT\0"
    "glUniform4ui\0"
    "\0"
-   /* _mesa_function_pool[14891]: VertexArrayAttribFormat (will be remapped) */
+   /* _mesa_function_pool[14924]: VertexArrayAttribFormat (will be remapped) */
    "iiiiii\0"
    "glVertexArrayAttribFormat\0"
    "\0"
-   /* _mesa_function_pool[14925]: VertexAttrib1fARB (will be remapped) */
+   /* _mesa_function_pool[14958]: VertexAttrib1fARB (will be remapped) */
    "if\0"
    "glVertexAttrib1f\0"
    "glVertexAttrib1fARB\0"
    "\0"
-   /* _mesa_function_pool[14966]: GetBooleani_v (will be remapped) */
+   /* _mesa_function_pool[14999]: GetBooleani_v (will be remapped) */
    "iip\0"
    "glGetBooleanIndexedvEXT\0"
    "glGetBooleani_v\0"
    "\0"
-   /* _mesa_function_pool[15011]: DrawTexsOES (will be remapped) */
+   /* _mesa_function_pool[15044]: DrawTexsOES (will be remapped) */
    "iiiii\0"
    "glDrawTexsOES\0"
    "\0"
-   /* _mesa_function_pool[15032]: GetObjectPtrLabel (will be remapped) */
+   /* _mesa_function_pool[15065]: GetObjectPtrLabel (will be remapped) */
    "pipp\0"
    "glGetObjectPtrLabel\0"
    "glGetObjectPtrLabelKHR\0"
    "\0"
-   /* _mesa_function_pool[15081]: ProgramParameteri (will be remapped) */
+   /* _mesa_function_pool[15114]: ProgramParameteri (will be remapped) */
    "iii\0"
    "glProgramParameteri\0"
    "glProgramParameteriEXT\0"
    "\0"
-   /* _mesa_function_pool[15129]: SecondaryColorPointerListIBM (dynamic) */
+   /* _mesa_function_pool[15162]: SecondaryColorPointerListIBM (dynamic) */
    "iiipi\0"
    "glSecondaryColorPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[15167]: Color3fv (offset 14) */
+   /* _mesa_function_pool[15200]: Color3fv (offset 14) */
    "p\0"
    "glColor3fv\0"
    "\0"
-   /* _mesa_function_pool[15181]: ReplacementCodeubSUN (dynamic) */
+   /* _mesa_function_pool[15214]: ReplacementCodeubSUN (dynamic) */
    "i\0"
    "glReplacementCodeubSUN\0"
    "\0"
-   /* _mesa_function_pool[15207]: GetnMapfvARB (will be remapped) */
+   /* _mesa_function_pool[15240]: GetnMapfvARB (will be remapped) */
    "iiip\0"
    "glGetnMapfvARB\0"
    "\0"
-   /* _mesa_function_pool[15228]: MultiTexCoord2i (offset 388) */
+   /* _mesa_function_pool[15261]: MultiTexCoord2i (offset 388) */
    "iii\0"
    "glMultiTexCoord2i\0"
    "glMultiTexCoord2iARB\0"
    "\0"
-   /* _mesa_function_pool[15272]: MultiTexCoord2d (offset 384) */
+   /* _mesa_function_pool[15305]: MultiTexCoord2d (offset 384) */
    "idd\0"
    "glMultiTexCoord2d\0"
    "glMultiTexCoord2dARB\0"
    "\0"
-   /* _mesa_function_pool[15316]: SamplerParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[15349]: SamplerParameterIuiv (will be remapped) */
    "iip\0"
    "glSamplerParameterIuiv\0"
    "glSamplerParameterIuivEXT\0"
    "glSamplerParameterIuivOES\0"
    "\0"
-   /* _mesa_function_pool[15396]: MultiTexCoord2s (offset 390) */
+   /* _mesa_function_pool[15429]: MultiTexCoord2s (offset 390) */
    "iii\0"
    "glMultiTexCoord2s\0"
    "glMultiTexCoord2sARB\0"
    "\0"
-   /* _mesa_function_pool[15440]: GetInternalformati64v (will be remapped) */
+   /* _mesa_function_pool[15473]: GetInternalformati64v (will be remapped) */
    "iiiip\0"
    "glGetInternalformati64v\0"
    "\0"
-   /* _mesa_function_pool[15471]: VDPAURegisterVideoSurfaceNV (will be remapped) */
+   /* _mesa_function_pool[15504]: VDPAURegisterVideoSurfaceNV (will be remapped) */
    "piip\0"
    "glVDPAURegisterVideoSurfaceNV\0"
    "\0"
-   /* _mesa_function_pool[15507]: TexCoord2fColor4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[15540]: TexCoord2fColor4fNormal3fVertex3fSUN (dynamic) */
    "ffffffffffff\0"
    "glTexCoord2fColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[15560]: Indexub (offset 315) */
+   /* _mesa_function_pool[15593]: Indexub (offset 315) */
    "i\0"
    "glIndexub\0"
    "\0"
-   /* _mesa_function_pool[15573]: GetPerfMonitorCounterDataAMD (will be remapped) */
+   /* _mesa_function_pool[15606]: GetPerfMonitorCounterDataAMD (will be remapped) */
    "iiipp\0"
    "glGetPerfMonitorCounterDataAMD\0"
    "\0"
-   /* _mesa_function_pool[15611]: MultTransposeMatrixf (will be remapped) */
+   /* _mesa_function_pool[15644]: MultTransposeMatrixf (will be remapped) */
    "p\0"
    "glMultTransposeMatrixf\0"
    "glMultTransposeMatrixfARB\0"
    "\0"
-   /* _mesa_function_pool[15663]: PolygonOffsetEXT (will be remapped) */
+   /* _mesa_function_pool[15696]: PolygonOffsetEXT (will be remapped) */
    "ff\0"
    "glPolygonOffsetEXT\0"
    "\0"
-   /* _mesa_function_pool[15686]: Scalex (will be remapped) */
+   /* _mesa_function_pool[15719]: Scalex (will be remapped) */
    "iii\0"
    "glScalexOES\0"
    "glScalex\0"
    "\0"
-   /* _mesa_function_pool[15712]: Scaled (offset 301) */
+   /* _mesa_function_pool[15745]: Scaled (offset 301) */
    "ddd\0"
    "glScaled\0"
    "\0"
-   /* _mesa_function_pool[15726]: Scalef (offset 302) */
+   /* _mesa_function_pool[15759]: Scalef (offset 302) */
    "fff\0"
    "glScalef\0"
    "\0"
-   /* _mesa_function_pool[15740]: IndexPointerEXT (will be remapped) */
+   /* _mesa_function_pool[15773]: IndexPointerEXT (will be remapped) */
    "iiip\0"
    "glIndexPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[15764]: GetUniformfv (will be remapped) */
+   /* _mesa_function_pool[15797]: GetUniformfv (will be remapped) */
    "iip\0"
    "glGetUniformfv\0"
    "glGetUniformfvARB\0"
    "\0"
-   /* _mesa_function_pool[15802]: ColorFragmentOp2ATI (will be remapped) */
+   /* _mesa_function_pool[15835]: ColorFragmentOp2ATI (will be remapped) */
    "iiiiiiiiii\0"
    "glColorFragmentOp2ATI\0"
    "\0"
-   /* _mesa_function_pool[15836]: VertexAttrib2sNV (will be remapped) */
+   /* _mesa_function_pool[15869]: VertexAttrib2sNV (will be remapped) */
    "iii\0"
    "glVertexAttrib2sNV\0"
    "\0"
-   /* _mesa_function_pool[15860]: ReadPixels (offset 256) */
+   /* _mesa_function_pool[15893]: ReadPixels (offset 256) */
    "iiiiiip\0"
    "glReadPixels\0"
    "\0"
-   /* _mesa_function_pool[15882]: NormalPointerListIBM (dynamic) */
+   /* _mesa_function_pool[15915]: NormalPointerListIBM (dynamic) */
    "iipi\0"
    "glNormalPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[15911]: QueryCounter (will be remapped) */
+   /* _mesa_function_pool[15944]: QueryCounter (will be remapped) */
    "ii\0"
    "glQueryCounter\0"
    "glQueryCounterEXT\0"
    "\0"
-   /* _mesa_function_pool[15948]: NormalPointerEXT (will be remapped) */
+   /* _mesa_function_pool[15981]: NormalPointerEXT (will be remapped) */
    "iiip\0"
    "glNormalPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[15973]: GetSubroutineIndex (will be remapped) */
+   /* _mesa_function_pool[16006]: GetSubroutineIndex (will be remapped) */
    "iip\0"
    "glGetSubroutineIndex\0"
    "\0"
-   /* _mesa_function_pool[15999]: ProgramUniform3iv (will be remapped) */
+   /* _mesa_function_pool[16032]: ProgramUniform3iv (will be remapped) */
    "iiip\0"
    "glProgramUniform3iv\0"
    "glProgramUniform3ivEXT\0"
    "\0"
-   /* _mesa_function_pool[16048]: ProgramUniformMatrix2dv (will be remapped) */
+   /* _mesa_function_pool[16081]: ProgramUniformMatrix2dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix2dv\0"
    "\0"
-   /* _mesa_function_pool[16081]: ClearTexSubImage (will be remapped) */
+   /* _mesa_function_pool[16114]: ClearTexSubImage (will be remapped) */
    "iiiiiiiiiip\0"
    "glClearTexSubImage\0"
    "\0"
-   /* _mesa_function_pool[16113]: GetActiveUniformBlockName (will be remapped) */
+   /* _mesa_function_pool[16146]: GetActiveUniformBlockName (will be remapped) */
    "iiipp\0"
    "glGetActiveUniformBlockName\0"
    "\0"
-   /* _mesa_function_pool[16148]: DrawElementsBaseVertex (will be remapped) */
+   /* _mesa_function_pool[16181]: DrawElementsBaseVertex (will be remapped) */
    "iiipi\0"
    "glDrawElementsBaseVertex\0"
    "glDrawElementsBaseVertexEXT\0"
    "glDrawElementsBaseVertexOES\0"
    "\0"
-   /* _mesa_function_pool[16236]: RasterPos3iv (offset 75) */
+   /* _mesa_function_pool[16269]: RasterPos3iv (offset 75) */
    "p\0"
    "glRasterPos3iv\0"
    "\0"
-   /* _mesa_function_pool[16254]: ColorMaski (will be remapped) */
+   /* _mesa_function_pool[16287]: ColorMaski (will be remapped) */
    "iiiii\0"
    "glColorMaskIndexedEXT\0"
    "glColorMaski\0"
    "glColorMaskiEXT\0"
    "glColorMaskiOES\0"
    "\0"
-   /* _mesa_function_pool[16328]: Uniform2uiv (will be remapped) */
+   /* _mesa_function_pool[16361]: Uniform2uiv (will be remapped) */
    "iip\0"
    "glUniform2uivEXT\0"
    "glUniform2uiv\0"
    "\0"
-   /* _mesa_function_pool[16364]: RasterPos3s (offset 76) */
+   /* _mesa_function_pool[16397]: RasterPos3s (offset 76) */
    "iii\0"
    "glRasterPos3s\0"
    "\0"
-   /* _mesa_function_pool[16383]: RasterPos3d (offset 70) */
+   /* _mesa_function_pool[16416]: RasterPos3d (offset 70) */
    "ddd\0"
    "glRasterPos3d\0"
    "\0"
-   /* _mesa_function_pool[16402]: RasterPos3f (offset 72) */
+   /* _mesa_function_pool[16435]: RasterPos3f (offset 72) */
    "fff\0"
    "glRasterPos3f\0"
    "\0"
-   /* _mesa_function_pool[16421]: BindVertexArray (will be remapped) */
+   /* _mesa_function_pool[16454]: BindVertexArray (will be remapped) */
    "i\0"
    "glBindVertexArray\0"
    "glBindVertexArrayOES\0"
    "\0"
-   /* _mesa_function_pool[16463]: RasterPos3i (offset 74) */
+   /* _mesa_function_pool[16496]: RasterPos3i (offset 74) */
    "iii\0"
    "glRasterPos3i\0"
    "\0"
-   /* _mesa_function_pool[16482]: VertexAttribL3dv (will be remapped) */
+   /* _mesa_function_pool[16515]: VertexAttribL3dv (will be remapped) */
    "ip\0"
    "glVertexAttribL3dv\0"
    "\0"
-   /* _mesa_function_pool[16505]: GetTexParameteriv (offset 283) */
+   /* _mesa_function_pool[16538]: GetTexParameteriv (offset 283) */
    "iip\0"
    "glGetTexParameteriv\0"
    "\0"
-   /* _mesa_function_pool[16530]: DrawTransformFeedbackStreamInstanced (will be remapped) */
+   /* _mesa_function_pool[16563]: DrawTransformFeedbackStreamInstanced (will be remapped) */
    "iiii\0"
    "glDrawTransformFeedbackStreamInstanced\0"
    "\0"
-   /* _mesa_function_pool[16575]: VertexAttrib2fvARB (will be remapped) */
+   /* _mesa_function_pool[16608]: VertexAttrib2fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib2fv\0"
    "glVertexAttrib2fvARB\0"
    "\0"
-   /* _mesa_function_pool[16618]: VertexPointerListIBM (dynamic) */
+   /* _mesa_function_pool[16651]: VertexPointerListIBM (dynamic) */
    "iiipi\0"
    "glVertexPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[16648]: GetProgramResourceName (will be remapped) */
+   /* _mesa_function_pool[16681]: GetProgramResourceName (will be remapped) */
    "iiiipp\0"
    "glGetProgramResourceName\0"
    "\0"
-   /* _mesa_function_pool[16681]: TexCoord2fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[16714]: TexCoord2fNormal3fVertex3fSUN (dynamic) */
    "ffffffff\0"
    "glTexCoord2fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[16723]: ProgramUniformMatrix4x3dv (will be remapped) */
+   /* _mesa_function_pool[16756]: ProgramUniformMatrix4x3dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix4x3dv\0"
    "\0"
-   /* _mesa_function_pool[16758]: IsFenceNV (dynamic) */
+   /* _mesa_function_pool[16791]: IsFenceNV (dynamic) */
    "i\0"
    "glIsFenceNV\0"
    "\0"
-   /* _mesa_function_pool[16773]: ColorTable (offset 339) */
+   /* _mesa_function_pool[16806]: ColorTable (offset 339) */
    "iiiiip\0"
    "glColorTable\0"
    "glColorTableSGI\0"
    "glColorTableEXT\0"
    "\0"
-   /* _mesa_function_pool[16826]: LoadName (offset 198) */
+   /* _mesa_function_pool[16859]: LoadName (offset 198) */
    "i\0"
    "glLoadName\0"
    "\0"
-   /* _mesa_function_pool[16840]: Color3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[16873]: Color3fVertex3fSUN (dynamic) */
    "ffffff\0"
    "glColor3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[16869]: GetnUniformuivARB (will be remapped) */
+   /* _mesa_function_pool[16902]: GetnUniformuivARB (will be remapped) */
    "iiip\0"
    "glGetnUniformuivARB\0"
    "glGetnUniformuiv\0"
    "glGetnUniformuivKHR\0"
    "\0"
-   /* _mesa_function_pool[16932]: ClearIndex (offset 205) */
+   /* _mesa_function_pool[16965]: ClearIndex (offset 205) */
    "f\0"
    "glClearIndex\0"
    "\0"
-   /* _mesa_function_pool[16948]: ConvolutionParameterfv (offset 351) */
+   /* _mesa_function_pool[16981]: ConvolutionParameterfv (offset 351) */
    "iip\0"
    "glConvolutionParameterfv\0"
    "glConvolutionParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[17006]: TbufferMask3DFX (dynamic) */
+   /* _mesa_function_pool[17039]: TbufferMask3DFX (dynamic) */
    "i\0"
    "glTbufferMask3DFX\0"
    "\0"
-   /* _mesa_function_pool[17027]: GetTexGendv (offset 278) */
+   /* _mesa_function_pool[17060]: GetTexGendv (offset 278) */
    "iip\0"
    "glGetTexGendv\0"
    "\0"
-   /* _mesa_function_pool[17046]: FlushMappedNamedBufferRange (will be remapped) */
+   /* _mesa_function_pool[17079]: FlushMappedNamedBufferRange (will be remapped) */
    "iii\0"
    "glFlushMappedNamedBufferRange\0"
    "\0"
-   /* _mesa_function_pool[17081]: MultiTexCoordP1ui (will be remapped) */
+   /* _mesa_function_pool[17114]: MultiTexCoordP1ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP1ui\0"
    "\0"
-   /* _mesa_function_pool[17106]: EvalMesh2 (offset 238) */
+   /* _mesa_function_pool[17139]: EvalMesh2 (offset 238) */
    "iiiii\0"
    "glEvalMesh2\0"
    "\0"
-   /* _mesa_function_pool[17125]: Vertex4fv (offset 145) */
+   /* _mesa_function_pool[17158]: Vertex4fv (offset 145) */
    "p\0"
    "glVertex4fv\0"
    "\0"
-   /* _mesa_function_pool[17140]: ProgramUniform4i64ARB (will be remapped) */
+   /* _mesa_function_pool[17173]: ProgramUniform4i64ARB (will be remapped) */
    "iiiiii\0"
    "glProgramUniform4i64ARB\0"
    "\0"
-   /* _mesa_function_pool[17172]: SelectPerfMonitorCountersAMD (will be remapped) */
+   /* _mesa_function_pool[17205]: SelectPerfMonitorCountersAMD (will be remapped) */
    "iiiip\0"
    "glSelectPerfMonitorCountersAMD\0"
    "\0"
-   /* _mesa_function_pool[17210]: TextureStorage2D (will be remapped) */
+   /* _mesa_function_pool[17243]: TextureStorage2D (will be remapped) */
    "iiiii\0"
    "glTextureStorage2D\0"
    "\0"
-   /* _mesa_function_pool[17236]: GetTextureParameterIiv (will be remapped) */
+   /* _mesa_function_pool[17269]: GetTextureParameterIiv (will be remapped) */
    "iip\0"
    "glGetTextureParameterIiv\0"
    "\0"
-   /* _mesa_function_pool[17266]: BindFramebuffer (will be remapped) */
+   /* _mesa_function_pool[17299]: BindFramebuffer (will be remapped) */
    "ii\0"
    "glBindFramebuffer\0"
    "glBindFramebufferOES\0"
    "\0"
-   /* _mesa_function_pool[17309]: ReplacementCodeuiNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[17342]: ReplacementCodeuiNormal3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glReplacementCodeuiNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[17354]: GetMinmax (offset 364) */
+   /* _mesa_function_pool[17387]: GetMinmax (offset 364) */
    "iiiip\0"
    "glGetMinmax\0"
    "glGetMinmaxEXT\0"
    "\0"
-   /* _mesa_function_pool[17388]: Color3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[17421]: Color3fVertex3fvSUN (dynamic) */
    "pp\0"
    "glColor3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[17414]: VertexAttribs3svNV (will be remapped) */
+   /* _mesa_function_pool[17447]: VertexAttribs3svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs3svNV\0"
    "\0"
-   /* _mesa_function_pool[17440]: GetActiveUniformsiv (will be remapped) */
+   /* _mesa_function_pool[17473]: GetActiveUniformsiv (will be remapped) */
    "iipip\0"
    "glGetActiveUniformsiv\0"
    "\0"
-   /* _mesa_function_pool[17469]: VertexAttrib2sv (will be remapped) */
+   /* _mesa_function_pool[17502]: VertexAttrib2sv (will be remapped) */
    "ip\0"
    "glVertexAttrib2sv\0"
    "glVertexAttrib2svARB\0"
    "\0"
-   /* _mesa_function_pool[17512]: GetProgramEnvParameterdvARB (will be remapped) */
+   /* _mesa_function_pool[17545]: GetProgramEnvParameterdvARB (will be remapped) */
    "iip\0"
    "glGetProgramEnvParameterdvARB\0"
    "\0"
-   /* _mesa_function_pool[17547]: GetSharpenTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[17580]: GetSharpenTexFuncSGIS (dynamic) */
    "ip\0"
    "glGetSharpenTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[17575]: Uniform1dv (will be remapped) */
+   /* _mesa_function_pool[17608]: Uniform1dv (will be remapped) */
    "iip\0"
    "glUniform1dv\0"
    "\0"
-   /* _mesa_function_pool[17593]: PixelTransformParameterfvEXT (dynamic) */
+   /* _mesa_function_pool[17626]: PixelTransformParameterfvEXT (dynamic) */
    "iip\0"
    "glPixelTransformParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[17629]: TransformFeedbackBufferRange (will be remapped) */
+   /* _mesa_function_pool[17662]: TransformFeedbackBufferRange (will be remapped) */
    "iiiii\0"
    "glTransformFeedbackBufferRange\0"
    "\0"
-   /* _mesa_function_pool[17667]: PushDebugGroup (will be remapped) */
+   /* _mesa_function_pool[17700]: PushDebugGroup (will be remapped) */
    "iiip\0"
    "glPushDebugGroup\0"
    "glPushDebugGroupKHR\0"
    "\0"
-   /* _mesa_function_pool[17710]: ReplacementCodeuiNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[17743]: ReplacementCodeuiNormal3fVertex3fSUN (dynamic) */
    "iffffff\0"
    "glReplacementCodeuiNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[17758]: GetPerfMonitorGroupStringAMD (will be remapped) */
+   /* _mesa_function_pool[17791]: GetPerfMonitorGroupStringAMD (will be remapped) */
    "iipp\0"
    "glGetPerfMonitorGroupStringAMD\0"
    "\0"
-   /* _mesa_function_pool[17795]: GetError (offset 261) */
+   /* _mesa_function_pool[17828]: GetError (offset 261) */
    "\0"
    "glGetError\0"
    "\0"
-   /* _mesa_function_pool[17808]: PassThrough (offset 199) */
+   /* _mesa_function_pool[17841]: PassThrough (offset 199) */
    "f\0"
    "glPassThrough\0"
    "\0"
-   /* _mesa_function_pool[17825]: GetListParameterfvSGIX (dynamic) */
+   /* _mesa_function_pool[17858]: GetListParameterfvSGIX (dynamic) */
    "iip\0"
    "glGetListParameterfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[17855]: PatchParameterfv (will be remapped) */
+   /* _mesa_function_pool[17888]: PatchParameterfv (will be remapped) */
    "ip\0"
    "glPatchParameterfv\0"
    "\0"
-   /* _mesa_function_pool[17878]: GetObjectParameterivAPPLE (will be remapped) */
+   /* _mesa_function_pool[17911]: GetObjectParameterivAPPLE (will be remapped) */
    "iiip\0"
    "glGetObjectParameterivAPPLE\0"
    "\0"
-   /* _mesa_function_pool[17912]: GlobalAlphaFactorubSUN (dynamic) */
+   /* _mesa_function_pool[17945]: GlobalAlphaFactorubSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorubSUN\0"
    "\0"
-   /* _mesa_function_pool[17940]: BindBuffersRange (will be remapped) */
+   /* _mesa_function_pool[17973]: BindBuffersRange (will be remapped) */
    "iiippp\0"
    "glBindBuffersRange\0"
    "\0"
-   /* _mesa_function_pool[17967]: VertexAttrib4fvARB (will be remapped) */
+   /* _mesa_function_pool[18000]: VertexAttrib4fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib4fv\0"
    "glVertexAttrib4fvARB\0"
    "\0"
-   /* _mesa_function_pool[18010]: Uniform3i64vARB (will be remapped) */
+   /* _mesa_function_pool[18043]: Uniform3i64vARB (will be remapped) */
    "iip\0"
    "glUniform3i64vARB\0"
    "\0"
-   /* _mesa_function_pool[18033]: WindowPos3dv (will be remapped) */
+   /* _mesa_function_pool[18066]: WindowPos3dv (will be remapped) */
    "p\0"
    "glWindowPos3dv\0"
    "glWindowPos3dvARB\0"
    "glWindowPos3dvMESA\0"
    "\0"
-   /* _mesa_function_pool[18088]: TexGenxOES (will be remapped) */
+   /* _mesa_function_pool[18121]: TexGenxOES (will be remapped) */
    "iii\0"
    "glTexGenxOES\0"
    "\0"
-   /* _mesa_function_pool[18106]: VertexArrayAttribIFormat (will be remapped) */
+   /* _mesa_function_pool[18139]: VertexArrayAttribIFormat (will be remapped) */
    "iiiii\0"
    "glVertexArrayAttribIFormat\0"
    "\0"
-   /* _mesa_function_pool[18140]: DeleteFencesNV (dynamic) */
+   /* _mesa_function_pool[18173]: DeleteFencesNV (dynamic) */
    "ip\0"
    "glDeleteFencesNV\0"
    "\0"
-   /* _mesa_function_pool[18161]: GetImageTransformParameterivHP (dynamic) */
+   /* _mesa_function_pool[18194]: GetImageTransformParameterivHP (dynamic) */
    "iip\0"
    "glGetImageTransformParameterivHP\0"
    "\0"
-   /* _mesa_function_pool[18199]: StencilOp (offset 244) */
+   /* _mesa_function_pool[18232]: StencilOp (offset 244) */
    "iii\0"
    "glStencilOp\0"
    "\0"
-   /* _mesa_function_pool[18216]: Binormal3fEXT (dynamic) */
+   /* _mesa_function_pool[18249]: Binormal3fEXT (dynamic) */
    "fff\0"
    "glBinormal3fEXT\0"
    "\0"
-   /* _mesa_function_pool[18237]: ProgramUniform1iv (will be remapped) */
+   /* _mesa_function_pool[18270]: ProgramUniform1iv (will be remapped) */
    "iiip\0"
    "glProgramUniform1iv\0"
    "glProgramUniform1ivEXT\0"
    "\0"
-   /* _mesa_function_pool[18286]: ProgramUniform3ui (will be remapped) */
+   /* _mesa_function_pool[18319]: ProgramUniform3ui (will be remapped) */
    "iiiii\0"
    "glProgramUniform3ui\0"
    "glProgramUniform3uiEXT\0"
    "\0"
-   /* _mesa_function_pool[18336]: SecondaryColor3sv (will be remapped) */
+   /* _mesa_function_pool[18369]: SecondaryColor3sv (will be remapped) */
    "p\0"
    "glSecondaryColor3sv\0"
    "glSecondaryColor3svEXT\0"
    "\0"
-   /* _mesa_function_pool[18382]: TexCoordP3ui (will be remapped) */
+   /* _mesa_function_pool[18415]: TexCoordP3ui (will be remapped) */
    "ii\0"
    "glTexCoordP3ui\0"
    "\0"
-   /* _mesa_function_pool[18401]: VertexArrayElementBuffer (will be remapped) */
+   /* _mesa_function_pool[18434]: VertexArrayElementBuffer (will be remapped) */
    "ii\0"
    "glVertexArrayElementBuffer\0"
    "\0"
-   /* _mesa_function_pool[18432]: Fogxv (will be remapped) */
+   /* _mesa_function_pool[18465]: Fogxv (will be remapped) */
    "ip\0"
    "glFogxvOES\0"
    "glFogxv\0"
    "\0"
-   /* _mesa_function_pool[18455]: VertexPointervINTEL (dynamic) */
+   /* _mesa_function_pool[18488]: VertexPointervINTEL (dynamic) */
    "iip\0"
    "glVertexPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[18482]: Uniform3i64ARB (will be remapped) */
+   /* _mesa_function_pool[18515]: Uniform3i64ARB (will be remapped) */
    "iiii\0"
    "glUniform3i64ARB\0"
    "\0"
-   /* _mesa_function_pool[18505]: VertexAttribP1ui (will be remapped) */
+   /* _mesa_function_pool[18538]: VertexAttribP1ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP1ui\0"
    "\0"
-   /* _mesa_function_pool[18530]: GetImageHandleARB (will be remapped) */
+   /* _mesa_function_pool[18563]: GetImageHandleARB (will be remapped) */
    "iiiii\0"
    "glGetImageHandleARB\0"
    "\0"
-   /* _mesa_function_pool[18557]: DeleteLists (offset 4) */
+   /* _mesa_function_pool[18590]: DeleteLists (offset 4) */
    "ii\0"
    "glDeleteLists\0"
    "\0"
-   /* _mesa_function_pool[18575]: LogicOp (offset 242) */
+   /* _mesa_function_pool[18608]: LogicOp (offset 242) */
    "i\0"
    "glLogicOp\0"
    "\0"
-   /* _mesa_function_pool[18588]: RenderbufferStorageMultisample (will be remapped) */
+   /* _mesa_function_pool[18621]: RenderbufferStorageMultisample (will be remapped) */
    "iiiii\0"
    "glRenderbufferStorageMultisample\0"
    "glRenderbufferStorageMultisampleEXT\0"
    "\0"
-   /* _mesa_function_pool[18664]: GetTransformFeedbacki64_v (will be remapped) */
+   /* _mesa_function_pool[18697]: GetTransformFeedbacki64_v (will be remapped) */
    "iiip\0"
    "glGetTransformFeedbacki64_v\0"
    "\0"
-   /* _mesa_function_pool[18698]: WindowPos3d (will be remapped) */
+   /* _mesa_function_pool[18731]: WindowPos3d (will be remapped) */
    "ddd\0"
    "glWindowPos3d\0"
    "glWindowPos3dARB\0"
    "glWindowPos3dMESA\0"
    "\0"
-   /* _mesa_function_pool[18752]: Enablei (will be remapped) */
+   /* _mesa_function_pool[18785]: Enablei (will be remapped) */
    "ii\0"
    "glEnableIndexedEXT\0"
    "glEnablei\0"
    "glEnableiEXT\0"
    "glEnableiOES\0"
    "\0"
-   /* _mesa_function_pool[18811]: WindowPos3f (will be remapped) */
+   /* _mesa_function_pool[18844]: WindowPos3f (will be remapped) */
    "fff\0"
    "glWindowPos3f\0"
    "glWindowPos3fARB\0"
    "glWindowPos3fMESA\0"
    "\0"
-   /* _mesa_function_pool[18865]: GenProgramsARB (will be remapped) */
+   /* _mesa_function_pool[18898]: GenProgramsARB (will be remapped) */
    "ip\0"
    "glGenProgramsARB\0"
    "glGenProgramsNV\0"
    "\0"
-   /* _mesa_function_pool[18902]: RasterPos2sv (offset 69) */
+   /* _mesa_function_pool[18935]: RasterPos2sv (offset 69) */
    "p\0"
    "glRasterPos2sv\0"
    "\0"
-   /* _mesa_function_pool[18920]: WindowPos3i (will be remapped) */
+   /* _mesa_function_pool[18953]: WindowPos3i (will be remapped) */
    "iii\0"
    "glWindowPos3i\0"
    "glWindowPos3iARB\0"
    "glWindowPos3iMESA\0"
    "\0"
-   /* _mesa_function_pool[18974]: MultiTexCoord4iv (offset 405) */
+   /* _mesa_function_pool[19007]: MultiTexCoord4iv (offset 405) */
    "ip\0"
    "glMultiTexCoord4iv\0"
    "glMultiTexCoord4ivARB\0"
    "\0"
-   /* _mesa_function_pool[19019]: TexCoord1sv (offset 101) */
+   /* _mesa_function_pool[19052]: TexCoord1sv (offset 101) */
    "p\0"
    "glTexCoord1sv\0"
    "\0"
-   /* _mesa_function_pool[19036]: WindowPos3s (will be remapped) */
+   /* _mesa_function_pool[19069]: WindowPos3s (will be remapped) */
    "iii\0"
    "glWindowPos3s\0"
    "glWindowPos3sARB\0"
    "glWindowPos3sMESA\0"
    "\0"
-   /* _mesa_function_pool[19090]: PixelMapusv (offset 253) */
+   /* _mesa_function_pool[19123]: PixelMapusv (offset 253) */
    "iip\0"
    "glPixelMapusv\0"
    "\0"
-   /* _mesa_function_pool[19109]: DebugMessageInsert (will be remapped) */
+   /* _mesa_function_pool[19142]: DebugMessageInsert (will be remapped) */
    "iiiiip\0"
    "glDebugMessageInsertARB\0"
    "glDebugMessageInsert\0"
    "glDebugMessageInsertKHR\0"
    "\0"
-   /* _mesa_function_pool[19186]: Orthof (will be remapped) */
+   /* _mesa_function_pool[19219]: Orthof (will be remapped) */
    "ffffff\0"
    "glOrthofOES\0"
    "glOrthof\0"
    "\0"
-   /* _mesa_function_pool[19215]: CompressedTexImage2D (will be remapped) */
+   /* _mesa_function_pool[19248]: CompressedTexImage2D (will be remapped) */
    "iiiiiiip\0"
    "glCompressedTexImage2D\0"
    "glCompressedTexImage2DARB\0"
    "\0"
-   /* _mesa_function_pool[19274]: DeleteObjectARB (will be remapped) */
+   /* _mesa_function_pool[19307]: DeleteObjectARB (will be remapped) */
    "i\0"
    "glDeleteObjectARB\0"
    "\0"
-   /* _mesa_function_pool[19295]: ProgramUniformMatrix2x3dv (will be remapped) */
+   /* _mesa_function_pool[19328]: ProgramUniformMatrix2x3dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix2x3dv\0"
    "\0"
-   /* _mesa_function_pool[19330]: GetVertexArrayiv (will be remapped) */
+   /* _mesa_function_pool[19363]: GetVertexArrayiv (will be remapped) */
    "iip\0"
    "glGetVertexArrayiv\0"
    "\0"
-   /* _mesa_function_pool[19354]: IsSync (will be remapped) */
+   /* _mesa_function_pool[19387]: IsSync (will be remapped) */
    "i\0"
    "glIsSync\0"
    "\0"
-   /* _mesa_function_pool[19366]: Color4uiv (offset 38) */
+   /* _mesa_function_pool[19399]: Color4uiv (offset 38) */
    "p\0"
    "glColor4uiv\0"
    "\0"
-   /* _mesa_function_pool[19381]: MultiTexCoord1sv (offset 383) */
+   /* _mesa_function_pool[19414]: MultiTexCoord1sv (offset 383) */
    "ip\0"
    "glMultiTexCoord1sv\0"
    "glMultiTexCoord1svARB\0"
    "\0"
-   /* _mesa_function_pool[19426]: Orthox (will be remapped) */
+   /* _mesa_function_pool[19459]: Orthox (will be remapped) */
    "iiiiii\0"
    "glOrthoxOES\0"
    "glOrthox\0"
    "\0"
-   /* _mesa_function_pool[19455]: PushAttrib (offset 219) */
+   /* _mesa_function_pool[19488]: PushAttrib (offset 219) */
    "i\0"
    "glPushAttrib\0"
    "\0"
-   /* _mesa_function_pool[19471]: RasterPos2i (offset 66) */
+   /* _mesa_function_pool[19504]: RasterPos2i (offset 66) */
    "ii\0"
    "glRasterPos2i\0"
    "\0"
-   /* _mesa_function_pool[19489]: ClipPlane (offset 150) */
+   /* _mesa_function_pool[19522]: ClipPlane (offset 150) */
    "ip\0"
    "glClipPlane\0"
    "\0"
-   /* _mesa_function_pool[19505]: TexCoord2fColor3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[19538]: TexCoord2fColor3fVertex3fSUN (dynamic) */
    "ffffffff\0"
    "glTexCoord2fColor3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[19546]: GetProgramivNV (will be remapped) */
+   /* _mesa_function_pool[19579]: GetProgramivNV (will be remapped) */
    "iip\0"
    "glGetProgramivNV\0"
    "\0"
-   /* _mesa_function_pool[19568]: RasterPos2f (offset 64) */
+   /* _mesa_function_pool[19601]: RasterPos2f (offset 64) */
    "ff\0"
    "glRasterPos2f\0"
    "\0"
-   /* _mesa_function_pool[19586]: GetActiveSubroutineUniformiv (will be remapped) */
+   /* _mesa_function_pool[19619]: GetActiveSubroutineUniformiv (will be remapped) */
    "iiiip\0"
    "glGetActiveSubroutineUniformiv\0"
    "\0"
-   /* _mesa_function_pool[19624]: RasterPos2d (offset 62) */
+   /* _mesa_function_pool[19657]: RasterPos2d (offset 62) */
    "dd\0"
    "glRasterPos2d\0"
    "\0"
-   /* _mesa_function_pool[19642]: MakeImageHandleResidentARB (will be remapped) */
+   /* _mesa_function_pool[19675]: MakeImageHandleResidentARB (will be remapped) */
    "ii\0"
    "glMakeImageHandleResidentARB\0"
    "\0"
-   /* _mesa_function_pool[19675]: InvalidateSubFramebuffer (will be remapped) */
+   /* _mesa_function_pool[19708]: InvalidateSubFramebuffer (will be remapped) */
    "iipiiii\0"
    "glInvalidateSubFramebuffer\0"
    "\0"
-   /* _mesa_function_pool[19711]: Color4ub (offset 35) */
+   /* _mesa_function_pool[19744]: Color4ub (offset 35) */
    "iiii\0"
    "glColor4ub\0"
    "\0"
-   /* _mesa_function_pool[19728]: UniformMatrix2x4dv (will be remapped) */
+   /* _mesa_function_pool[19761]: UniformMatrix2x4dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix2x4dv\0"
    "\0"
-   /* _mesa_function_pool[19755]: RasterPos2s (offset 68) */
+   /* _mesa_function_pool[19788]: RasterPos2s (offset 68) */
    "ii\0"
    "glRasterPos2s\0"
    "\0"
-   /* _mesa_function_pool[19773]: DispatchComputeGroupSizeARB (will be remapped) */
+   /* _mesa_function_pool[19806]: DispatchComputeGroupSizeARB (will be remapped) */
    "iiiiii\0"
    "glDispatchComputeGroupSizeARB\0"
    "\0"
-   /* _mesa_function_pool[19811]: VertexP2uiv (will be remapped) */
+   /* _mesa_function_pool[19844]: VertexP2uiv (will be remapped) */
    "ip\0"
    "glVertexP2uiv\0"
    "\0"
-   /* _mesa_function_pool[19829]: Color4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[19862]: Color4fNormal3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[19864]: VertexArrayBindingDivisor (will be remapped) */
+   /* _mesa_function_pool[19897]: VertexArrayBindingDivisor (will be remapped) */
    "iii\0"
    "glVertexArrayBindingDivisor\0"
    "\0"
-   /* _mesa_function_pool[19897]: GetVertexAttribivNV (will be remapped) */
+   /* _mesa_function_pool[19930]: GetVertexAttribivNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribivNV\0"
    "\0"
-   /* _mesa_function_pool[19924]: TexSubImage4DSGIS (dynamic) */
+   /* _mesa_function_pool[19957]: TexSubImage4DSGIS (dynamic) */
    "iiiiiiiiiiiip\0"
    "glTexSubImage4DSGIS\0"
    "\0"
-   /* _mesa_function_pool[19959]: MultiTexCoord3dv (offset 393) */
+   /* _mesa_function_pool[19992]: MultiTexCoord3dv (offset 393) */
    "ip\0"
    "glMultiTexCoord3dv\0"
    "glMultiTexCoord3dvARB\0"
    "\0"
-   /* _mesa_function_pool[20004]: BindProgramPipeline (will be remapped) */
+   /* _mesa_function_pool[20037]: BindProgramPipeline (will be remapped) */
    "i\0"
    "glBindProgramPipeline\0"
    "glBindProgramPipelineEXT\0"
    "\0"
-   /* _mesa_function_pool[20054]: VertexAttribP4uiv (will be remapped) */
+   /* _mesa_function_pool[20087]: VertexAttribP4uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP4uiv\0"
    "\0"
-   /* _mesa_function_pool[20080]: DebugMessageCallback (will be remapped) */
+   /* _mesa_function_pool[20113]: DebugMessageCallback (will be remapped) */
    "pp\0"
    "glDebugMessageCallbackARB\0"
    "glDebugMessageCallback\0"
    "glDebugMessageCallbackKHR\0"
    "\0"
-   /* _mesa_function_pool[20159]: MultiTexCoord1i (offset 380) */
+   /* _mesa_function_pool[20192]: MultiTexCoord1i (offset 380) */
    "ii\0"
    "glMultiTexCoord1i\0"
    "glMultiTexCoord1iARB\0"
    "\0"
-   /* _mesa_function_pool[20202]: WindowPos2dv (will be remapped) */
+   /* _mesa_function_pool[20235]: WindowPos2dv (will be remapped) */
    "p\0"
    "glWindowPos2dv\0"
    "glWindowPos2dvARB\0"
    "glWindowPos2dvMESA\0"
    "\0"
-   /* _mesa_function_pool[20257]: TexParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[20290]: TexParameterIuiv (will be remapped) */
    "iip\0"
    "glTexParameterIuivEXT\0"
    "glTexParameterIuiv\0"
    "glTexParameterIuivOES\0"
    "\0"
-   /* _mesa_function_pool[20325]: DeletePerfQueryINTEL (will be remapped) */
+   /* _mesa_function_pool[20358]: DeletePerfQueryINTEL (will be remapped) */
    "i\0"
    "glDeletePerfQueryINTEL\0"
    "\0"
-   /* _mesa_function_pool[20351]: MultiTexCoord1d (offset 376) */
+   /* _mesa_function_pool[20384]: MultiTexCoord1d (offset 376) */
    "id\0"
    "glMultiTexCoord1d\0"
    "glMultiTexCoord1dARB\0"
    "\0"
-   /* _mesa_function_pool[20394]: GenVertexArraysAPPLE (dynamic) */
+   /* _mesa_function_pool[20427]: GenVertexArraysAPPLE (dynamic) */
    "ip\0"
    "glGenVertexArraysAPPLE\0"
    "\0"
-   /* _mesa_function_pool[20421]: MultiTexCoord1s (offset 382) */
+   /* _mesa_function_pool[20454]: MultiTexCoord1s (offset 382) */
    "ii\0"
    "glMultiTexCoord1s\0"
    "glMultiTexCoord1sARB\0"
    "\0"
-   /* _mesa_function_pool[20464]: BeginConditionalRender (will be remapped) */
+   /* _mesa_function_pool[20497]: BeginConditionalRender (will be remapped) */
    "ii\0"
    "glBeginConditionalRender\0"
    "glBeginConditionalRenderNV\0"
    "\0"
-   /* _mesa_function_pool[20520]: LoadPaletteFromModelViewMatrixOES (dynamic) */
+   /* _mesa_function_pool[20553]: LoadPaletteFromModelViewMatrixOES (dynamic) */
    "\0"
    "glLoadPaletteFromModelViewMatrixOES\0"
    "\0"
-   /* _mesa_function_pool[20558]: GetShaderiv (will be remapped) */
+   /* _mesa_function_pool[20591]: GetShaderiv (will be remapped) */
    "iip\0"
    "glGetShaderiv\0"
    "\0"
-   /* _mesa_function_pool[20577]: GetMapAttribParameterfvNV (dynamic) */
+   /* _mesa_function_pool[20610]: GetMapAttribParameterfvNV (dynamic) */
    "iiip\0"
    "glGetMapAttribParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[20611]: CopyConvolutionFilter1D (offset 354) */
+   /* _mesa_function_pool[20644]: CopyConvolutionFilter1D (offset 354) */
    "iiiii\0"
    "glCopyConvolutionFilter1D\0"
    "glCopyConvolutionFilter1DEXT\0"
    "\0"
-   /* _mesa_function_pool[20673]: ClearBufferfv (will be remapped) */
+   /* _mesa_function_pool[20706]: ClearBufferfv (will be remapped) */
    "iip\0"
    "glClearBufferfv\0"
    "\0"
-   /* _mesa_function_pool[20694]: UniformMatrix4dv (will be remapped) */
+   /* _mesa_function_pool[20727]: UniformMatrix4dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4dv\0"
    "\0"
-   /* _mesa_function_pool[20719]: InstrumentsBufferSGIX (dynamic) */
+   /* _mesa_function_pool[20752]: InstrumentsBufferSGIX (dynamic) */
    "ip\0"
    "glInstrumentsBufferSGIX\0"
    "\0"
-   /* _mesa_function_pool[20747]: CreateShaderObjectARB (will be remapped) */
+   /* _mesa_function_pool[20780]: CreateShaderObjectARB (will be remapped) */
    "i\0"
    "glCreateShaderObjectARB\0"
    "\0"
-   /* _mesa_function_pool[20774]: GetTexParameterxv (will be remapped) */
+   /* _mesa_function_pool[20807]: GetTexParameterxv (will be remapped) */
    "iip\0"
    "glGetTexParameterxvOES\0"
    "glGetTexParameterxv\0"
    "\0"
-   /* _mesa_function_pool[20822]: GetAttachedShaders (will be remapped) */
+   /* _mesa_function_pool[20855]: GetAttachedShaders (will be remapped) */
    "iipp\0"
    "glGetAttachedShaders\0"
    "\0"
-   /* _mesa_function_pool[20849]: ClearBufferfi (will be remapped) */
+   /* _mesa_function_pool[20882]: ClearBufferfi (will be remapped) */
    "iifi\0"
    "glClearBufferfi\0"
    "\0"
-   /* _mesa_function_pool[20871]: Materialiv (offset 172) */
+   /* _mesa_function_pool[20904]: Materialiv (offset 172) */
    "iip\0"
    "glMaterialiv\0"
    "\0"
-   /* _mesa_function_pool[20889]: DeleteFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[20922]: DeleteFragmentShaderATI (will be remapped) */
    "i\0"
    "glDeleteFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[20918]: VertexArrayVertexBuffers (will be remapped) */
+   /* _mesa_function_pool[20951]: VertexArrayVertexBuffers (will be remapped) */
    "iiippp\0"
    "glVertexArrayVertexBuffers\0"
    "\0"
-   /* _mesa_function_pool[20953]: DrawElementsInstancedBaseVertex (will be remapped) */
+   /* _mesa_function_pool[20986]: DrawElementsInstancedBaseVertex (will be remapped) */
    "iiipii\0"
    "glDrawElementsInstancedBaseVertex\0"
    "glDrawElementsInstancedBaseVertexEXT\0"
    "glDrawElementsInstancedBaseVertexOES\0"
    "\0"
-   /* _mesa_function_pool[21069]: DisableClientState (offset 309) */
+   /* _mesa_function_pool[21102]: DisableClientState (offset 309) */
    "i\0"
    "glDisableClientState\0"
    "\0"
-   /* _mesa_function_pool[21093]: TexGeni (offset 192) */
+   /* _mesa_function_pool[21126]: TexGeni (offset 192) */
    "iii\0"
    "glTexGeni\0"
    "glTexGeniOES\0"
    "\0"
-   /* _mesa_function_pool[21121]: TexGenf (offset 190) */
+   /* _mesa_function_pool[21154]: TexGenf (offset 190) */
    "iif\0"
    "glTexGenf\0"
    "glTexGenfOES\0"
    "\0"
-   /* _mesa_function_pool[21149]: TexGend (offset 188) */
+   /* _mesa_function_pool[21182]: TexGend (offset 188) */
    "iid\0"
    "glTexGend\0"
    "\0"
-   /* _mesa_function_pool[21164]: GetVertexAttribfvNV (will be remapped) */
+   /* _mesa_function_pool[21197]: GetVertexAttribfvNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribfvNV\0"
    "\0"
-   /* _mesa_function_pool[21191]: ProgramUniform4i64vARB (will be remapped) */
+   /* _mesa_function_pool[21224]: ProgramUniform4i64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniform4i64vARB\0"
    "\0"
-   /* _mesa_function_pool[21222]: ColorPointerListIBM (dynamic) */
+   /* _mesa_function_pool[21255]: ColorPointerListIBM (dynamic) */
    "iiipi\0"
    "glColorPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[21251]: Color4sv (offset 34) */
+   /* _mesa_function_pool[21284]: Color4sv (offset 34) */
    "p\0"
    "glColor4sv\0"
    "\0"
-   /* _mesa_function_pool[21265]: GetCombinerInputParameterfvNV (dynamic) */
+   /* _mesa_function_pool[21298]: GetCombinerInputParameterfvNV (dynamic) */
    "iiiip\0"
    "glGetCombinerInputParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[21304]: LoadTransposeMatrixf (will be remapped) */
+   /* _mesa_function_pool[21337]: LoadTransposeMatrixf (will be remapped) */
    "p\0"
    "glLoadTransposeMatrixf\0"
    "glLoadTransposeMatrixfARB\0"
    "\0"
-   /* _mesa_function_pool[21356]: LoadTransposeMatrixd (will be remapped) */
+   /* _mesa_function_pool[21389]: LoadTransposeMatrixd (will be remapped) */
    "p\0"
    "glLoadTransposeMatrixd\0"
    "glLoadTransposeMatrixdARB\0"
    "\0"
-   /* _mesa_function_pool[21408]: PixelZoom (offset 246) */
+   /* _mesa_function_pool[21441]: PixelZoom (offset 246) */
    "ff\0"
    "glPixelZoom\0"
    "\0"
-   /* _mesa_function_pool[21424]: ProgramEnvParameter4dARB (will be remapped) */
+   /* _mesa_function_pool[21457]: ProgramEnvParameter4dARB (will be remapped) */
    "iidddd\0"
    "glProgramEnvParameter4dARB\0"
    "glProgramParameter4dNV\0"
    "\0"
-   /* _mesa_function_pool[21482]: ColorTableParameterfv (offset 340) */
+   /* _mesa_function_pool[21515]: ColorTableParameterfv (offset 340) */
    "iip\0"
    "glColorTableParameterfv\0"
    "glColorTableParameterfvSGI\0"
    "\0"
-   /* _mesa_function_pool[21538]: IsSemaphoreEXT (will be remapped) */
+   /* _mesa_function_pool[21571]: IsSemaphoreEXT (will be remapped) */
    "i\0"
    "glIsSemaphoreEXT\0"
    "\0"
-   /* _mesa_function_pool[21558]: IsTexture (offset 330) */
+   /* _mesa_function_pool[21591]: IsTexture (offset 330) */
    "i\0"
    "glIsTexture\0"
    "glIsTextureEXT\0"
    "\0"
-   /* _mesa_function_pool[21588]: ProgramUniform3uiv (will be remapped) */
+   /* _mesa_function_pool[21621]: ProgramUniform3uiv (will be remapped) */
    "iiip\0"
    "glProgramUniform3uiv\0"
    "glProgramUniform3uivEXT\0"
    "\0"
-   /* _mesa_function_pool[21639]: IndexPointer (offset 314) */
+   /* _mesa_function_pool[21672]: IndexPointer (offset 314) */
    "iip\0"
    "glIndexPointer\0"
    "\0"
-   /* _mesa_function_pool[21659]: ImageTransformParameterivHP (dynamic) */
+   /* _mesa_function_pool[21692]: ImageTransformParameterivHP (dynamic) */
    "iip\0"
    "glImageTransformParameterivHP\0"
    "\0"
-   /* _mesa_function_pool[21694]: VertexAttrib4sNV (will be remapped) */
+   /* _mesa_function_pool[21727]: VertexAttrib4sNV (will be remapped) */
    "iiiii\0"
    "glVertexAttrib4sNV\0"
    "\0"
-   /* _mesa_function_pool[21720]: GetMapdv (offset 266) */
+   /* _mesa_function_pool[21753]: GetMapdv (offset 266) */
    "iip\0"
    "glGetMapdv\0"
    "\0"
-   /* _mesa_function_pool[21736]: Uniform3ui64vARB (will be remapped) */
+   /* _mesa_function_pool[21769]: Uniform3ui64vARB (will be remapped) */
    "iip\0"
    "glUniform3ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[21760]: GetInteger64i_v (will be remapped) */
+   /* _mesa_function_pool[21793]: GetInteger64i_v (will be remapped) */
    "iip\0"
    "glGetInteger64i_v\0"
    "\0"
-   /* _mesa_function_pool[21783]: ReplacementCodeuiColor4ubVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[21816]: ReplacementCodeuiColor4ubVertex3fSUN (dynamic) */
    "iiiiifff\0"
    "glReplacementCodeuiColor4ubVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[21832]: BufferPageCommitmentARB (will be remapped) */
+   /* _mesa_function_pool[21865]: BufferPageCommitmentARB (will be remapped) */
    "iiii\0"
    "glBufferPageCommitmentARB\0"
    "\0"
-   /* _mesa_function_pool[21864]: IsBuffer (will be remapped) */
+   /* _mesa_function_pool[21897]: IsBuffer (will be remapped) */
    "i\0"
    "glIsBuffer\0"
    "glIsBufferARB\0"
    "\0"
-   /* _mesa_function_pool[21892]: ColorP4ui (will be remapped) */
+   /* _mesa_function_pool[21925]: ColorP4ui (will be remapped) */
    "ii\0"
    "glColorP4ui\0"
    "\0"
-   /* _mesa_function_pool[21908]: TextureStorage3D (will be remapped) */
+   /* _mesa_function_pool[21941]: TextureStorage3D (will be remapped) */
    "iiiiii\0"
    "glTextureStorage3D\0"
    "\0"
-   /* _mesa_function_pool[21935]: SpriteParameteriSGIX (dynamic) */
+   /* _mesa_function_pool[21968]: SpriteParameteriSGIX (dynamic) */
    "ii\0"
    "glSpriteParameteriSGIX\0"
    "\0"
-   /* _mesa_function_pool[21962]: TexCoordP3uiv (will be remapped) */
+   /* _mesa_function_pool[21995]: TexCoordP3uiv (will be remapped) */
    "ip\0"
    "glTexCoordP3uiv\0"
    "\0"
-   /* _mesa_function_pool[21982]: WeightusvARB (dynamic) */
+   /* _mesa_function_pool[22015]: WeightusvARB (dynamic) */
    "ip\0"
    "glWeightusvARB\0"
    "\0"
-   /* _mesa_function_pool[22001]: GetnUniformui64vARB (will be remapped) */
+   /* _mesa_function_pool[22034]: GetnUniformui64vARB (will be remapped) */
    "iiip\0"
    "glGetnUniformui64vARB\0"
    "\0"
-   /* _mesa_function_pool[22029]: EvalMapsNV (dynamic) */
+   /* _mesa_function_pool[22062]: EvalMapsNV (dynamic) */
    "ii\0"
    "glEvalMapsNV\0"
    "\0"
-   /* _mesa_function_pool[22046]: TextureStorageMem2DMultisampleEXT (will be remapped) */
+   /* _mesa_function_pool[22079]: TextureStorageMem2DMultisampleEXT (will be remapped) */
    "iiiiiiii\0"
    "glTextureStorageMem2DMultisampleEXT\0"
    "\0"
-   /* _mesa_function_pool[22092]: ReplacementCodeuiSUN (dynamic) */
+   /* _mesa_function_pool[22125]: ReplacementCodeuiSUN (dynamic) */
    "i\0"
    "glReplacementCodeuiSUN\0"
    "\0"
-   /* _mesa_function_pool[22118]: GlobalAlphaFactoruiSUN (dynamic) */
+   /* _mesa_function_pool[22151]: GlobalAlphaFactoruiSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactoruiSUN\0"
    "\0"
-   /* _mesa_function_pool[22146]: Uniform1iv (will be remapped) */
+   /* _mesa_function_pool[22179]: Uniform1iv (will be remapped) */
    "iip\0"
    "glUniform1iv\0"
    "glUniform1ivARB\0"
    "\0"
-   /* _mesa_function_pool[22180]: Uniform4uiv (will be remapped) */
+   /* _mesa_function_pool[22213]: Uniform4uiv (will be remapped) */
    "iip\0"
    "glUniform4uivEXT\0"
    "glUniform4uiv\0"
    "\0"
-   /* _mesa_function_pool[22216]: PopDebugGroup (will be remapped) */
+   /* _mesa_function_pool[22249]: PopDebugGroup (will be remapped) */
    "\0"
    "glPopDebugGroup\0"
    "glPopDebugGroupKHR\0"
    "\0"
-   /* _mesa_function_pool[22253]: VertexAttrib1d (will be remapped) */
+   /* _mesa_function_pool[22286]: VertexAttrib1d (will be remapped) */
    "id\0"
    "glVertexAttrib1d\0"
    "glVertexAttrib1dARB\0"
    "\0"
-   /* _mesa_function_pool[22294]: CompressedTexImage1D (will be remapped) */
+   /* _mesa_function_pool[22327]: CompressedTexImage1D (will be remapped) */
    "iiiiiip\0"
    "glCompressedTexImage1D\0"
    "glCompressedTexImage1DARB\0"
    "\0"
-   /* _mesa_function_pool[22352]: NamedBufferSubData (will be remapped) */
+   /* _mesa_function_pool[22385]: NamedBufferSubData (will be remapped) */
    "iiip\0"
    "glNamedBufferSubData\0"
    "\0"
-   /* _mesa_function_pool[22379]: TexBufferRange (will be remapped) */
+   /* _mesa_function_pool[22412]: TexBufferRange (will be remapped) */
    "iiiii\0"
    "glTexBufferRange\0"
    "glTexBufferRangeEXT\0"
    "glTexBufferRangeOES\0"
    "\0"
-   /* _mesa_function_pool[22443]: VertexAttrib1s (will be remapped) */
+   /* _mesa_function_pool[22476]: VertexAttrib1s (will be remapped) */
    "ii\0"
    "glVertexAttrib1s\0"
    "glVertexAttrib1sARB\0"
    "\0"
-   /* _mesa_function_pool[22484]: MultiDrawElementsIndirect (will be remapped) */
+   /* _mesa_function_pool[22517]: MultiDrawElementsIndirect (will be remapped) */
    "iipii\0"
    "glMultiDrawElementsIndirect\0"
    "\0"
-   /* _mesa_function_pool[22519]: UniformMatrix4x3dv (will be remapped) */
+   /* _mesa_function_pool[22552]: UniformMatrix4x3dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4x3dv\0"
    "\0"
-   /* _mesa_function_pool[22546]: TransformFeedbackBufferBase (will be remapped) */
+   /* _mesa_function_pool[22579]: TransformFeedbackBufferBase (will be remapped) */
    "iii\0"
    "glTransformFeedbackBufferBase\0"
    "\0"
-   /* _mesa_function_pool[22581]: FogCoordfvEXT (will be remapped) */
+   /* _mesa_function_pool[22614]: FogCoordfvEXT (will be remapped) */
    "p\0"
    "glFogCoordfv\0"
    "glFogCoordfvEXT\0"
    "\0"
-   /* _mesa_function_pool[22613]: Uniform2ui64vARB (will be remapped) */
+   /* _mesa_function_pool[22646]: Uniform2ui64vARB (will be remapped) */
    "iip\0"
    "glUniform2ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[22637]: GetColorTableParameterfv (offset 344) */
+   /* _mesa_function_pool[22670]: GetColorTableParameterfv (offset 344) */
    "iip\0"
    "glGetColorTableParameterfv\0"
    "glGetColorTableParameterfvSGI\0"
    "glGetColorTableParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[22729]: MultiTexCoord3fARB (offset 394) */
+   /* _mesa_function_pool[22762]: MultiTexCoord3fARB (offset 394) */
    "ifff\0"
    "glMultiTexCoord3f\0"
    "glMultiTexCoord3fARB\0"
    "\0"
-   /* _mesa_function_pool[22774]: GetTexLevelParameterfv (offset 284) */
+   /* _mesa_function_pool[22807]: GetTexLevelParameterfv (offset 284) */
    "iiip\0"
    "glGetTexLevelParameterfv\0"
    "\0"
-   /* _mesa_function_pool[22805]: Vertex2sv (offset 133) */
+   /* _mesa_function_pool[22838]: Vertex2sv (offset 133) */
    "p\0"
    "glVertex2sv\0"
    "\0"
-   /* _mesa_function_pool[22820]: GetnMapdvARB (will be remapped) */
+   /* _mesa_function_pool[22853]: GetnMapdvARB (will be remapped) */
    "iiip\0"
    "glGetnMapdvARB\0"
    "\0"
-   /* _mesa_function_pool[22841]: VertexAttrib2dNV (will be remapped) */
+   /* _mesa_function_pool[22874]: VertexAttrib2dNV (will be remapped) */
    "idd\0"
    "glVertexAttrib2dNV\0"
    "\0"
-   /* _mesa_function_pool[22865]: GetTrackMatrixivNV (will be remapped) */
+   /* _mesa_function_pool[22898]: GetTrackMatrixivNV (will be remapped) */
    "iiip\0"
    "glGetTrackMatrixivNV\0"
    "\0"
-   /* _mesa_function_pool[22892]: VertexAttrib3svNV (will be remapped) */
+   /* _mesa_function_pool[22925]: VertexAttrib3svNV (will be remapped) */
    "ip\0"
    "glVertexAttrib3svNV\0"
    "\0"
-   /* _mesa_function_pool[22916]: GetTexEnviv (offset 277) */
+   /* _mesa_function_pool[22949]: GetTexEnviv (offset 277) */
    "iip\0"
    "glGetTexEnviv\0"
    "\0"
-   /* _mesa_function_pool[22935]: ViewportArrayv (will be remapped) */
+   /* _mesa_function_pool[22968]: ViewportArrayv (will be remapped) */
    "iip\0"
    "glViewportArrayv\0"
    "glViewportArrayvOES\0"
    "\0"
-   /* _mesa_function_pool[22977]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[23010]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (dynamic) */
    "iffffffffffff\0"
    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[23048]: SeparableFilter2D (offset 360) */
+   /* _mesa_function_pool[23081]: SeparableFilter2D (offset 360) */
    "iiiiiipp\0"
    "glSeparableFilter2D\0"
    "glSeparableFilter2DEXT\0"
    "\0"
-   /* _mesa_function_pool[23101]: ReplacementCodeuiColor4ubVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[23134]: ReplacementCodeuiColor4ubVertex3fvSUN (dynamic) */
    "ppp\0"
    "glReplacementCodeuiColor4ubVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[23146]: ArrayElement (offset 306) */
+   /* _mesa_function_pool[23179]: ArrayElement (offset 306) */
    "i\0"
    "glArrayElement\0"
    "glArrayElementEXT\0"
    "\0"
-   /* _mesa_function_pool[23182]: TexImage2D (offset 183) */
+   /* _mesa_function_pool[23215]: TexImage2D (offset 183) */
    "iiiiiiiip\0"
    "glTexImage2D\0"
    "\0"
-   /* _mesa_function_pool[23206]: FragmentMaterialiSGIX (dynamic) */
+   /* _mesa_function_pool[23239]: FragmentMaterialiSGIX (dynamic) */
    "iii\0"
    "glFragmentMaterialiSGIX\0"
    "\0"
-   /* _mesa_function_pool[23235]: RasterPos2dv (offset 63) */
+   /* _mesa_function_pool[23268]: RasterPos2dv (offset 63) */
    "p\0"
    "glRasterPos2dv\0"
    "\0"
-   /* _mesa_function_pool[23253]: Fogiv (offset 156) */
+   /* _mesa_function_pool[23286]: Fogiv (offset 156) */
    "ip\0"
    "glFogiv\0"
    "\0"
-   /* _mesa_function_pool[23265]: EndQuery (will be remapped) */
+   /* _mesa_function_pool[23298]: EndQuery (will be remapped) */
    "i\0"
    "glEndQuery\0"
    "glEndQueryARB\0"
    "glEndQueryEXT\0"
    "\0"
-   /* _mesa_function_pool[23307]: TexCoord1dv (offset 95) */
+   /* _mesa_function_pool[23340]: TexCoord1dv (offset 95) */
    "p\0"
    "glTexCoord1dv\0"
    "\0"
-   /* _mesa_function_pool[23324]: AlphaFragmentOp3ATI (will be remapped) */
+   /* _mesa_function_pool[23357]: AlphaFragmentOp3ATI (will be remapped) */
    "iiiiiiiiiiii\0"
    "glAlphaFragmentOp3ATI\0"
    "\0"
-   /* _mesa_function_pool[23360]: GetVertexAttribdvNV (will be remapped) */
+   /* _mesa_function_pool[23393]: GetVertexAttribdvNV (will be remapped) */
    "iip\0"
    "glGetVertexAttribdvNV\0"
    "\0"
-   /* _mesa_function_pool[23387]: Clear (offset 203) */
+   /* _mesa_function_pool[23420]: Clear (offset 203) */
    "i\0"
    "glClear\0"
    "\0"
-   /* _mesa_function_pool[23398]: VertexAttrib4sv (will be remapped) */
+   /* _mesa_function_pool[23431]: VertexAttrib4sv (will be remapped) */
    "ip\0"
    "glVertexAttrib4sv\0"
    "glVertexAttrib4svARB\0"
    "\0"
-   /* _mesa_function_pool[23441]: Ortho (offset 296) */
+   /* _mesa_function_pool[23474]: Ortho (offset 296) */
    "dddddd\0"
    "glOrtho\0"
    "\0"
-   /* _mesa_function_pool[23457]: Uniform3uiv (will be remapped) */
+   /* _mesa_function_pool[23490]: Uniform3uiv (will be remapped) */
    "iip\0"
    "glUniform3uivEXT\0"
    "glUniform3uiv\0"
    "\0"
-   /* _mesa_function_pool[23493]: MatrixIndexPointerARB (dynamic) */
+   /* _mesa_function_pool[23526]: MatrixIndexPointerARB (dynamic) */
    "iiip\0"
    "glMatrixIndexPointerARB\0"
    "glMatrixIndexPointerOES\0"
    "\0"
-   /* _mesa_function_pool[23547]: GetUniformi64vARB (will be remapped) */
+   /* _mesa_function_pool[23580]: GetUniformi64vARB (will be remapped) */
    "iip\0"
    "glGetUniformi64vARB\0"
    "\0"
-   /* _mesa_function_pool[23572]: EndQueryIndexed (will be remapped) */
+   /* _mesa_function_pool[23605]: EndQueryIndexed (will be remapped) */
    "ii\0"
    "glEndQueryIndexed\0"
    "\0"
-   /* _mesa_function_pool[23594]: TexParameterxv (will be remapped) */
+   /* _mesa_function_pool[23627]: TexParameterxv (will be remapped) */
    "iip\0"
    "glTexParameterxvOES\0"
    "glTexParameterxv\0"
    "\0"
-   /* _mesa_function_pool[23636]: SampleMaskSGIS (will be remapped) */
+   /* _mesa_function_pool[23669]: SampleMaskSGIS (will be remapped) */
    "fi\0"
    "glSampleMaskSGIS\0"
    "glSampleMaskEXT\0"
    "\0"
-   /* _mesa_function_pool[23673]: MultiDrawArraysIndirectCountARB (will be remapped) */
+   /* _mesa_function_pool[23706]: MultiDrawArraysIndirectCountARB (will be remapped) */
    "iiiii\0"
    "glMultiDrawArraysIndirectCountARB\0"
    "glMultiDrawArraysIndirectCount\0"
    "\0"
-   /* _mesa_function_pool[23745]: ProgramUniformMatrix2fv (will be remapped) */
+   /* _mesa_function_pool[23778]: ProgramUniformMatrix2fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix2fv\0"
    "glProgramUniformMatrix2fvEXT\0"
    "\0"
-   /* _mesa_function_pool[23807]: ProgramLocalParameter4fvARB (will be remapped) */
+   /* _mesa_function_pool[23840]: ProgramLocalParameter4fvARB (will be remapped) */
    "iip\0"
    "glProgramLocalParameter4fvARB\0"
    "\0"
-   /* _mesa_function_pool[23842]: GetProgramStringNV (will be remapped) */
+   /* _mesa_function_pool[23875]: GetProgramStringNV (will be remapped) */
    "iip\0"
    "glGetProgramStringNV\0"
    "\0"
-   /* _mesa_function_pool[23868]: Binormal3svEXT (dynamic) */
+   /* _mesa_function_pool[23901]: Binormal3svEXT (dynamic) */
    "p\0"
    "glBinormal3svEXT\0"
    "\0"
-   /* _mesa_function_pool[23888]: Uniform4dv (will be remapped) */
+   /* _mesa_function_pool[23921]: Uniform4dv (will be remapped) */
    "iip\0"
    "glUniform4dv\0"
    "\0"
-   /* _mesa_function_pool[23906]: GetUnsignedBytevEXT (will be remapped) */
+   /* _mesa_function_pool[23939]: GetUnsignedBytevEXT (will be remapped) */
    "ip\0"
    "glGetUnsignedBytevEXT\0"
    "\0"
-   /* _mesa_function_pool[23932]: LightModelx (will be remapped) */
+   /* _mesa_function_pool[23965]: LightModelx (will be remapped) */
    "ii\0"
    "glLightModelxOES\0"
    "glLightModelx\0"
    "\0"
-   /* _mesa_function_pool[23967]: VertexAttribI3iEXT (will be remapped) */
+   /* _mesa_function_pool[24000]: VertexAttribI3iEXT (will be remapped) */
    "iiii\0"
    "glVertexAttribI3iEXT\0"
    "glVertexAttribI3i\0"
    "\0"
-   /* _mesa_function_pool[24012]: ClearColorx (will be remapped) */
+   /* _mesa_function_pool[24045]: ClearColorx (will be remapped) */
    "iiii\0"
    "glClearColorxOES\0"
    "glClearColorx\0"
    "\0"
-   /* _mesa_function_pool[24049]: EndTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[24082]: EndTransformFeedback (will be remapped) */
    "\0"
    "glEndTransformFeedback\0"
    "glEndTransformFeedbackEXT\0"
    "\0"
-   /* _mesa_function_pool[24100]: VertexAttribL2dv (will be remapped) */
+   /* _mesa_function_pool[24133]: VertexAttribL2dv (will be remapped) */
    "ip\0"
    "glVertexAttribL2dv\0"
    "\0"
-   /* _mesa_function_pool[24123]: GetActiveUniformName (will be remapped) */
+   /* _mesa_function_pool[24156]: GetActiveUniformName (will be remapped) */
    "iiipp\0"
    "glGetActiveUniformName\0"
    "\0"
-   /* _mesa_function_pool[24153]: GetProgramBinary (will be remapped) */
+   /* _mesa_function_pool[24186]: GetProgramBinary (will be remapped) */
    "iippp\0"
    "glGetProgramBinary\0"
    "glGetProgramBinaryOES\0"
    "\0"
-   /* _mesa_function_pool[24201]: ViewportIndexedfv (will be remapped) */
+   /* _mesa_function_pool[24234]: ViewportIndexedfv (will be remapped) */
    "ip\0"
    "glViewportIndexedfv\0"
    "glViewportIndexedfvOES\0"
    "\0"
-   /* _mesa_function_pool[24248]: BindTextureUnit (will be remapped) */
+   /* _mesa_function_pool[24281]: BindTextureUnit (will be remapped) */
    "ii\0"
    "glBindTextureUnit\0"
    "\0"
-   /* _mesa_function_pool[24270]: CallList (offset 2) */
+   /* _mesa_function_pool[24303]: CallList (offset 2) */
    "i\0"
    "glCallList\0"
    "\0"
-   /* _mesa_function_pool[24284]: Materialfv (offset 170) */
+   /* _mesa_function_pool[24317]: Materialfv (offset 170) */
    "iip\0"
    "glMaterialfv\0"
    "\0"
-   /* _mesa_function_pool[24302]: DeleteProgram (will be remapped) */
+   /* _mesa_function_pool[24335]: DeleteProgram (will be remapped) */
    "i\0"
    "glDeleteProgram\0"
    "\0"
-   /* _mesa_function_pool[24321]: GetActiveAtomicCounterBufferiv (will be remapped) */
+   /* _mesa_function_pool[24354]: GetActiveAtomicCounterBufferiv (will be remapped) */
    "iiip\0"
    "glGetActiveAtomicCounterBufferiv\0"
    "\0"
-   /* _mesa_function_pool[24360]: ClearDepthf (will be remapped) */
+   /* _mesa_function_pool[24393]: ClearDepthf (will be remapped) */
    "f\0"
    "glClearDepthf\0"
    "glClearDepthfOES\0"
    "\0"
-   /* _mesa_function_pool[24394]: VertexWeightfEXT (dynamic) */
+   /* _mesa_function_pool[24427]: VertexWeightfEXT (dynamic) */
    "f\0"
    "glVertexWeightfEXT\0"
    "\0"
-   /* _mesa_function_pool[24416]: FlushVertexArrayRangeNV (dynamic) */
+   /* _mesa_function_pool[24449]: FlushVertexArrayRangeNV (dynamic) */
    "\0"
    "glFlushVertexArrayRangeNV\0"
    "\0"
-   /* _mesa_function_pool[24444]: GetTextureHandleARB (will be remapped) */
+   /* _mesa_function_pool[24477]: GetTextureHandleARB (will be remapped) */
    "i\0"
    "glGetTextureHandleARB\0"
    "\0"
-   /* _mesa_function_pool[24469]: GetConvolutionFilter (offset 356) */
+   /* _mesa_function_pool[24502]: GetConvolutionFilter (offset 356) */
    "iiip\0"
    "glGetConvolutionFilter\0"
    "glGetConvolutionFilterEXT\0"
    "\0"
-   /* _mesa_function_pool[24524]: MultiModeDrawElementsIBM (will be remapped) */
+   /* _mesa_function_pool[24557]: MultiModeDrawElementsIBM (will be remapped) */
    "ppipii\0"
    "glMultiModeDrawElementsIBM\0"
    "\0"
-   /* _mesa_function_pool[24559]: Uniform2iv (will be remapped) */
+   /* _mesa_function_pool[24592]: Uniform2iv (will be remapped) */
    "iip\0"
    "glUniform2iv\0"
    "glUniform2ivARB\0"
    "\0"
-   /* _mesa_function_pool[24593]: GetFixedv (will be remapped) */
+   /* _mesa_function_pool[24626]: GetFixedv (will be remapped) */
    "ip\0"
    "glGetFixedvOES\0"
    "glGetFixedv\0"
    "\0"
-   /* _mesa_function_pool[24624]: ProgramParameters4dvNV (will be remapped) */
+   /* _mesa_function_pool[24657]: ProgramParameters4dvNV (will be remapped) */
    "iiip\0"
    "glProgramParameters4dvNV\0"
    "\0"
-   /* _mesa_function_pool[24655]: Binormal3dvEXT (dynamic) */
+   /* _mesa_function_pool[24688]: Binormal3dvEXT (dynamic) */
    "p\0"
    "glBinormal3dvEXT\0"
    "\0"
-   /* _mesa_function_pool[24675]: SampleCoveragex (will be remapped) */
+   /* _mesa_function_pool[24708]: SampleCoveragex (will be remapped) */
    "ii\0"
    "glSampleCoveragexOES\0"
    "glSampleCoveragex\0"
    "\0"
-   /* _mesa_function_pool[24718]: GetPerfQueryInfoINTEL (will be remapped) */
+   /* _mesa_function_pool[24751]: GetPerfQueryInfoINTEL (will be remapped) */
    "iippppp\0"
    "glGetPerfQueryInfoINTEL\0"
    "\0"
-   /* _mesa_function_pool[24751]: DeleteFramebuffers (will be remapped) */
+   /* _mesa_function_pool[24784]: DeleteFramebuffers (will be remapped) */
    "ip\0"
    "glDeleteFramebuffers\0"
    "glDeleteFramebuffersEXT\0"
    "glDeleteFramebuffersOES\0"
    "\0"
-   /* _mesa_function_pool[24824]: CombinerInputNV (dynamic) */
+   /* _mesa_function_pool[24857]: CombinerInputNV (dynamic) */
    "iiiiii\0"
    "glCombinerInputNV\0"
    "\0"
-   /* _mesa_function_pool[24850]: VertexAttrib4uiv (will be remapped) */
+   /* _mesa_function_pool[24883]: VertexAttrib4uiv (will be remapped) */
    "ip\0"
    "glVertexAttrib4uiv\0"
    "glVertexAttrib4uivARB\0"
    "\0"
-   /* _mesa_function_pool[24895]: VertexAttrib4Nsv (will be remapped) */
+   /* _mesa_function_pool[24928]: VertexAttrib4Nsv (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nsv\0"
    "glVertexAttrib4NsvARB\0"
    "\0"
-   /* _mesa_function_pool[24940]: Vertex4s (offset 148) */
+   /* _mesa_function_pool[24973]: Vertex4s (offset 148) */
    "iiii\0"
    "glVertex4s\0"
    "\0"
-   /* _mesa_function_pool[24957]: VertexAttribI2iEXT (will be remapped) */
+   /* _mesa_function_pool[24990]: VertexAttribI2iEXT (will be remapped) */
    "iii\0"
    "glVertexAttribI2iEXT\0"
    "glVertexAttribI2i\0"
    "\0"
-   /* _mesa_function_pool[25001]: Vertex4f (offset 144) */
+   /* _mesa_function_pool[25034]: Vertex4f (offset 144) */
    "ffff\0"
    "glVertex4f\0"
    "\0"
-   /* _mesa_function_pool[25018]: Vertex4d (offset 142) */
+   /* _mesa_function_pool[25051]: Vertex4d (offset 142) */
    "dddd\0"
    "glVertex4d\0"
    "\0"
-   /* _mesa_function_pool[25035]: VertexAttribL4dv (will be remapped) */
+   /* _mesa_function_pool[25068]: VertexAttribL4dv (will be remapped) */
    "ip\0"
    "glVertexAttribL4dv\0"
    "\0"
-   /* _mesa_function_pool[25058]: GetnUniformi64vARB (will be remapped) */
+   /* _mesa_function_pool[25091]: GetnUniformi64vARB (will be remapped) */
    "iiip\0"
    "glGetnUniformi64vARB\0"
    "\0"
-   /* _mesa_function_pool[25085]: GetTexGenfv (offset 279) */
+   /* _mesa_function_pool[25118]: GetTexGenfv (offset 279) */
    "iip\0"
    "glGetTexGenfv\0"
    "glGetTexGenfvOES\0"
    "\0"
-   /* _mesa_function_pool[25121]: Vertex4i (offset 146) */
+   /* _mesa_function_pool[25154]: Vertex4i (offset 146) */
    "iiii\0"
    "glVertex4i\0"
    "\0"
-   /* _mesa_function_pool[25138]: VertexWeightPointerEXT (dynamic) */
+   /* _mesa_function_pool[25171]: VertexWeightPointerEXT (dynamic) */
    "iiip\0"
    "glVertexWeightPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[25169]: MemoryBarrierByRegion (will be remapped) */
+   /* _mesa_function_pool[25202]: MemoryBarrierByRegion (will be remapped) */
    "i\0"
    "glMemoryBarrierByRegion\0"
    "\0"
-   /* _mesa_function_pool[25196]: StencilFuncSeparateATI (will be remapped) */
+   /* _mesa_function_pool[25229]: StencilFuncSeparateATI (will be remapped) */
    "iiii\0"
    "glStencilFuncSeparateATI\0"
    "\0"
-   /* _mesa_function_pool[25227]: GetVertexAttribIuiv (will be remapped) */
+   /* _mesa_function_pool[25260]: GetVertexAttribIuiv (will be remapped) */
    "iip\0"
    "glGetVertexAttribIuivEXT\0"
    "glGetVertexAttribIuiv\0"
    "\0"
-   /* _mesa_function_pool[25279]: LightModelfv (offset 164) */
+   /* _mesa_function_pool[25312]: LightModelfv (offset 164) */
    "ip\0"
    "glLightModelfv\0"
    "\0"
-   /* _mesa_function_pool[25298]: Vertex4dv (offset 143) */
+   /* _mesa_function_pool[25331]: Vertex4dv (offset 143) */
    "p\0"
    "glVertex4dv\0"
    "\0"
-   /* _mesa_function_pool[25313]: ProgramParameters4fvNV (will be remapped) */
+   /* _mesa_function_pool[25346]: ProgramParameters4fvNV (will be remapped) */
    "iiip\0"
    "glProgramParameters4fvNV\0"
    "\0"
-   /* _mesa_function_pool[25344]: GetInfoLogARB (will be remapped) */
+   /* _mesa_function_pool[25377]: GetInfoLogARB (will be remapped) */
    "iipp\0"
    "glGetInfoLogARB\0"
    "\0"
-   /* _mesa_function_pool[25366]: StencilMask (offset 209) */
+   /* _mesa_function_pool[25399]: StencilMask (offset 209) */
    "i\0"
    "glStencilMask\0"
    "\0"
-   /* _mesa_function_pool[25383]: NamedFramebufferReadBuffer (will be remapped) */
+   /* _mesa_function_pool[25416]: NamedFramebufferReadBuffer (will be remapped) */
    "ii\0"
    "glNamedFramebufferReadBuffer\0"
    "\0"
-   /* _mesa_function_pool[25416]: ProgramUniformHandleui64ARB (will be remapped) */
+   /* _mesa_function_pool[25449]: ProgramUniformHandleui64ARB (will be remapped) */
    "iii\0"
    "glProgramUniformHandleui64ARB\0"
    "\0"
-   /* _mesa_function_pool[25451]: ProgramUniform2i64ARB (will be remapped) */
+   /* _mesa_function_pool[25484]: ProgramUniform2i64ARB (will be remapped) */
    "iiii\0"
    "glProgramUniform2i64ARB\0"
    "\0"
-   /* _mesa_function_pool[25481]: IsList (offset 287) */
+   /* _mesa_function_pool[25514]: IsList (offset 287) */
    "i\0"
    "glIsList\0"
    "\0"
-   /* _mesa_function_pool[25493]: ClearBufferiv (will be remapped) */
+   /* _mesa_function_pool[25526]: ClearBufferiv (will be remapped) */
    "iip\0"
    "glClearBufferiv\0"
    "\0"
-   /* _mesa_function_pool[25514]: GetIntegeri_v (will be remapped) */
+   /* _mesa_function_pool[25547]: GetIntegeri_v (will be remapped) */
    "iip\0"
    "glGetIntegerIndexedvEXT\0"
    "glGetIntegeri_v\0"
    "\0"
-   /* _mesa_function_pool[25559]: ProgramUniform2iv (will be remapped) */
+   /* _mesa_function_pool[25592]: ProgramUniform2iv (will be remapped) */
    "iiip\0"
    "glProgramUniform2iv\0"
    "glProgramUniform2ivEXT\0"
    "\0"
-   /* _mesa_function_pool[25608]: CreateVertexArrays (will be remapped) */
+   /* _mesa_function_pool[25641]: CreateVertexArrays (will be remapped) */
    "ip\0"
    "glCreateVertexArrays\0"
    "\0"
-   /* _mesa_function_pool[25633]: FogCoordPointer (will be remapped) */
+   /* _mesa_function_pool[25666]: FogCoordPointer (will be remapped) */
    "iip\0"
    "glFogCoordPointer\0"
    "glFogCoordPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[25677]: SecondaryColor3us (will be remapped) */
+   /* _mesa_function_pool[25710]: SecondaryColor3us (will be remapped) */
    "iii\0"
    "glSecondaryColor3us\0"
    "glSecondaryColor3usEXT\0"
    "\0"
-   /* _mesa_function_pool[25725]: DeformationMap3dSGIX (dynamic) */
+   /* _mesa_function_pool[25758]: DeformationMap3dSGIX (dynamic) */
    "iddiiddiiddiip\0"
    "glDeformationMap3dSGIX\0"
    "\0"
-   /* _mesa_function_pool[25764]: TextureStorageMem1DEXT (will be remapped) */
+   /* _mesa_function_pool[25797]: TextureStorageMem1DEXT (will be remapped) */
    "iiiiii\0"
    "glTextureStorageMem1DEXT\0"
    "\0"
-   /* _mesa_function_pool[25797]: TextureNormalEXT (dynamic) */
+   /* _mesa_function_pool[25830]: TextureNormalEXT (dynamic) */
    "i\0"
    "glTextureNormalEXT\0"
    "\0"
-   /* _mesa_function_pool[25819]: SecondaryColor3ub (will be remapped) */
+   /* _mesa_function_pool[25852]: SecondaryColor3ub (will be remapped) */
    "iii\0"
    "glSecondaryColor3ub\0"
    "glSecondaryColor3ubEXT\0"
    "\0"
-   /* _mesa_function_pool[25867]: NamedBufferStorageMemEXT (will be remapped) */
+   /* _mesa_function_pool[25900]: NamedBufferStorageMemEXT (will be remapped) */
    "iiii\0"
    "glNamedBufferStorageMemEXT\0"
    "\0"
-   /* _mesa_function_pool[25900]: SecondaryColor3ui (will be remapped) */
+   /* _mesa_function_pool[25933]: SecondaryColor3ui (will be remapped) */
    "iii\0"
    "glSecondaryColor3ui\0"
    "glSecondaryColor3uiEXT\0"
    "\0"
-   /* _mesa_function_pool[25948]: ProgramUniform4ui64ARB (will be remapped) */
+   /* _mesa_function_pool[25981]: ProgramUniform4ui64ARB (will be remapped) */
    "iiiiii\0"
    "glProgramUniform4ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[25981]: Binormal3fvEXT (dynamic) */
+   /* _mesa_function_pool[26014]: Binormal3fvEXT (dynamic) */
    "p\0"
    "glBinormal3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[26001]: TexCoordPointervINTEL (dynamic) */
+   /* _mesa_function_pool[26034]: TexCoordPointervINTEL (dynamic) */
    "iip\0"
    "glTexCoordPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[26030]: VertexAttrib1sNV (will be remapped) */
+   /* _mesa_function_pool[26063]: VertexAttrib1sNV (will be remapped) */
    "ii\0"
    "glVertexAttrib1sNV\0"
    "\0"
-   /* _mesa_function_pool[26053]: Tangent3bEXT (dynamic) */
+   /* _mesa_function_pool[26086]: Tangent3bEXT (dynamic) */
    "iii\0"
    "glTangent3bEXT\0"
    "\0"
-   /* _mesa_function_pool[26073]: SignalSemaphoreEXT (will be remapped) */
+   /* _mesa_function_pool[26106]: SignalSemaphoreEXT (will be remapped) */
    "iipipp\0"
    "glSignalSemaphoreEXT\0"
    "\0"
-   /* _mesa_function_pool[26102]: TextureBuffer (will be remapped) */
+   /* _mesa_function_pool[26135]: TextureBuffer (will be remapped) */
    "iii\0"
    "glTextureBuffer\0"
    "\0"
-   /* _mesa_function_pool[26123]: FragmentLightModelfSGIX (dynamic) */
+   /* _mesa_function_pool[26156]: FragmentLightModelfSGIX (dynamic) */
    "if\0"
    "glFragmentLightModelfSGIX\0"
    "\0"
-   /* _mesa_function_pool[26153]: InitNames (offset 197) */
+   /* _mesa_function_pool[26186]: InitNames (offset 197) */
    "\0"
    "glInitNames\0"
    "\0"
-   /* _mesa_function_pool[26167]: Normal3sv (offset 61) */
+   /* _mesa_function_pool[26200]: Normal3sv (offset 61) */
    "p\0"
    "glNormal3sv\0"
    "\0"
-   /* _mesa_function_pool[26182]: DeleteQueries (will be remapped) */
+   /* _mesa_function_pool[26215]: DeleteQueries (will be remapped) */
    "ip\0"
    "glDeleteQueries\0"
    "glDeleteQueriesARB\0"
    "glDeleteQueriesEXT\0"
    "\0"
-   /* _mesa_function_pool[26240]: InvalidateFramebuffer (will be remapped) */
+   /* _mesa_function_pool[26273]: InvalidateFramebuffer (will be remapped) */
    "iip\0"
    "glInvalidateFramebuffer\0"
    "\0"
-   /* _mesa_function_pool[26269]: Hint (offset 158) */
+   /* _mesa_function_pool[26302]: Hint (offset 158) */
    "ii\0"
    "glHint\0"
    "\0"
-   /* _mesa_function_pool[26280]: MemoryBarrier (will be remapped) */
+   /* _mesa_function_pool[26313]: MemoryBarrier (will be remapped) */
    "i\0"
    "glMemoryBarrier\0"
    "\0"
-   /* _mesa_function_pool[26299]: CopyColorSubTable (offset 347) */
+   /* _mesa_function_pool[26332]: CopyColorSubTable (offset 347) */
    "iiiii\0"
    "glCopyColorSubTable\0"
    "glCopyColorSubTableEXT\0"
    "\0"
-   /* _mesa_function_pool[26349]: WeightdvARB (dynamic) */
+   /* _mesa_function_pool[26382]: WeightdvARB (dynamic) */
    "ip\0"
    "glWeightdvARB\0"
    "\0"
-   /* _mesa_function_pool[26367]: GetObjectParameterfvARB (will be remapped) */
+   /* _mesa_function_pool[26400]: GetObjectParameterfvARB (will be remapped) */
    "iip\0"
    "glGetObjectParameterfvARB\0"
    "\0"
-   /* _mesa_function_pool[26398]: GetTexEnvxv (will be remapped) */
+   /* _mesa_function_pool[26431]: GetTexEnvxv (will be remapped) */
    "iip\0"
    "glGetTexEnvxvOES\0"
    "glGetTexEnvxv\0"
    "\0"
-   /* _mesa_function_pool[26434]: DrawTexsvOES (will be remapped) */
+   /* _mesa_function_pool[26467]: DrawTexsvOES (will be remapped) */
    "p\0"
    "glDrawTexsvOES\0"
    "\0"
-   /* _mesa_function_pool[26452]: Disable (offset 214) */
+   /* _mesa_function_pool[26485]: Disable (offset 214) */
    "i\0"
    "glDisable\0"
    "\0"
-   /* _mesa_function_pool[26465]: ClearColor (offset 206) */
+   /* _mesa_function_pool[26498]: ClearColor (offset 206) */
    "ffff\0"
    "glClearColor\0"
    "\0"
-   /* _mesa_function_pool[26484]: WeightuivARB (dynamic) */
+   /* _mesa_function_pool[26517]: WeightuivARB (dynamic) */
    "ip\0"
    "glWeightuivARB\0"
    "\0"
-   /* _mesa_function_pool[26503]: GetTextureParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[26536]: GetTextureParameterIuiv (will be remapped) */
    "iip\0"
    "glGetTextureParameterIuiv\0"
    "\0"
-   /* _mesa_function_pool[26534]: RasterPos4iv (offset 83) */
+   /* _mesa_function_pool[26567]: RasterPos4iv (offset 83) */
    "p\0"
    "glRasterPos4iv\0"
    "\0"
-   /* _mesa_function_pool[26552]: VDPAUIsSurfaceNV (will be remapped) */
+   /* _mesa_function_pool[26585]: VDPAUIsSurfaceNV (will be remapped) */
    "i\0"
    "glVDPAUIsSurfaceNV\0"
    "\0"
-   /* _mesa_function_pool[26574]: ProgramUniformMatrix2x3fv (will be remapped) */
+   /* _mesa_function_pool[26607]: ProgramUniformMatrix2x3fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix2x3fv\0"
    "glProgramUniformMatrix2x3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[26640]: BindVertexBuffer (will be remapped) */
+   /* _mesa_function_pool[26673]: BindVertexBuffer (will be remapped) */
    "iiii\0"
    "glBindVertexBuffer\0"
    "\0"
-   /* _mesa_function_pool[26665]: Binormal3iEXT (dynamic) */
+   /* _mesa_function_pool[26698]: Binormal3iEXT (dynamic) */
    "iii\0"
    "glBinormal3iEXT\0"
    "\0"
-   /* _mesa_function_pool[26686]: RasterPos4i (offset 82) */
+   /* _mesa_function_pool[26719]: RasterPos4i (offset 82) */
    "iiii\0"
    "glRasterPos4i\0"
    "\0"
-   /* _mesa_function_pool[26706]: RasterPos4d (offset 78) */
+   /* _mesa_function_pool[26739]: RasterPos4d (offset 78) */
    "dddd\0"
    "glRasterPos4d\0"
    "\0"
-   /* _mesa_function_pool[26726]: RasterPos4f (offset 80) */
+   /* _mesa_function_pool[26759]: RasterPos4f (offset 80) */
    "ffff\0"
    "glRasterPos4f\0"
    "\0"
-   /* _mesa_function_pool[26746]: VDPAUMapSurfacesNV (will be remapped) */
+   /* _mesa_function_pool[26779]: VDPAUMapSurfacesNV (will be remapped) */
    "ip\0"
    "glVDPAUMapSurfacesNV\0"
    "\0"
-   /* _mesa_function_pool[26771]: GetQueryIndexediv (will be remapped) */
+   /* _mesa_function_pool[26804]: GetQueryIndexediv (will be remapped) */
    "iiip\0"
    "glGetQueryIndexediv\0"
    "\0"
-   /* _mesa_function_pool[26797]: RasterPos3dv (offset 71) */
+   /* _mesa_function_pool[26830]: RasterPos3dv (offset 71) */
    "p\0"
    "glRasterPos3dv\0"
    "\0"
-   /* _mesa_function_pool[26815]: GetProgramiv (will be remapped) */
+   /* _mesa_function_pool[26848]: GetProgramiv (will be remapped) */
    "iip\0"
    "glGetProgramiv\0"
    "\0"
-   /* _mesa_function_pool[26835]: TexCoord1iv (offset 99) */
+   /* _mesa_function_pool[26868]: TexCoord1iv (offset 99) */
    "p\0"
    "glTexCoord1iv\0"
    "\0"
-   /* _mesa_function_pool[26852]: RasterPos4s (offset 84) */
+   /* _mesa_function_pool[26885]: RasterPos4s (offset 84) */
    "iiii\0"
    "glRasterPos4s\0"
    "\0"
-   /* _mesa_function_pool[26872]: PixelTexGenParameterfvSGIS (dynamic) */
+   /* _mesa_function_pool[26905]: PixelTexGenParameterfvSGIS (dynamic) */
    "ip\0"
    "glPixelTexGenParameterfvSGIS\0"
    "\0"
-   /* _mesa_function_pool[26905]: VertexAttrib3dv (will be remapped) */
+   /* _mesa_function_pool[26938]: VertexAttrib3dv (will be remapped) */
    "ip\0"
    "glVertexAttrib3dv\0"
    "glVertexAttrib3dvARB\0"
    "\0"
-   /* _mesa_function_pool[26948]: Histogram (offset 367) */
+   /* _mesa_function_pool[26981]: Histogram (offset 367) */
    "iiii\0"
    "glHistogram\0"
    "glHistogramEXT\0"
    "\0"
-   /* _mesa_function_pool[26981]: Uniform2fv (will be remapped) */
+   /* _mesa_function_pool[27014]: Uniform2fv (will be remapped) */
    "iip\0"
    "glUniform2fv\0"
    "glUniform2fvARB\0"
    "\0"
-   /* _mesa_function_pool[27015]: TexImage4DSGIS (dynamic) */
+   /* _mesa_function_pool[27048]: TexImage4DSGIS (dynamic) */
    "iiiiiiiiiip\0"
    "glTexImage4DSGIS\0"
    "\0"
-   /* _mesa_function_pool[27045]: ProgramUniformMatrix3x4dv (will be remapped) */
+   /* _mesa_function_pool[27078]: ProgramUniformMatrix3x4dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix3x4dv\0"
    "\0"
-   /* _mesa_function_pool[27080]: DrawBuffers (will be remapped) */
+   /* _mesa_function_pool[27113]: DrawBuffers (will be remapped) */
    "ip\0"
    "glDrawBuffers\0"
    "glDrawBuffersARB\0"
@@ -3591,168 +3595,168 @@ static const char _mesa_function_pool[] =
    "glDrawBuffersNV\0"
    "glDrawBuffersEXT\0"
    "\0"
-   /* _mesa_function_pool[27165]: VertexAttribL1ui64ARB (will be remapped) */
+   /* _mesa_function_pool[27198]: VertexAttribL1ui64ARB (will be remapped) */
    "ii\0"
    "glVertexAttribL1ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[27193]: GetnPolygonStippleARB (will be remapped) */
+   /* _mesa_function_pool[27226]: GetnPolygonStippleARB (will be remapped) */
    "ip\0"
    "glGetnPolygonStippleARB\0"
    "\0"
-   /* _mesa_function_pool[27221]: Color3uiv (offset 22) */
+   /* _mesa_function_pool[27254]: Color3uiv (offset 22) */
    "p\0"
    "glColor3uiv\0"
    "\0"
-   /* _mesa_function_pool[27236]: EvalCoord2fv (offset 235) */
+   /* _mesa_function_pool[27269]: EvalCoord2fv (offset 235) */
    "p\0"
    "glEvalCoord2fv\0"
    "\0"
-   /* _mesa_function_pool[27254]: TextureStorage3DEXT (will be remapped) */
+   /* _mesa_function_pool[27287]: TextureStorage3DEXT (will be remapped) */
    "iiiiiii\0"
    "glTextureStorage3DEXT\0"
    "\0"
-   /* _mesa_function_pool[27285]: VertexAttrib2fARB (will be remapped) */
+   /* _mesa_function_pool[27318]: VertexAttrib2fARB (will be remapped) */
    "iff\0"
    "glVertexAttrib2f\0"
    "glVertexAttrib2fARB\0"
    "\0"
-   /* _mesa_function_pool[27327]: SpecializeShaderARB (will be remapped) */
+   /* _mesa_function_pool[27360]: SpecializeShaderARB (will be remapped) */
    "ipipp\0"
    "glSpecializeShaderARB\0"
    "glSpecializeShader\0"
    "\0"
-   /* _mesa_function_pool[27375]: BeginPerfMonitorAMD (will be remapped) */
+   /* _mesa_function_pool[27408]: BeginPerfMonitorAMD (will be remapped) */
    "i\0"
    "glBeginPerfMonitorAMD\0"
    "\0"
-   /* _mesa_function_pool[27400]: WindowPos2fv (will be remapped) */
+   /* _mesa_function_pool[27433]: WindowPos2fv (will be remapped) */
    "p\0"
    "glWindowPos2fv\0"
    "glWindowPos2fvARB\0"
    "glWindowPos2fvMESA\0"
    "\0"
-   /* _mesa_function_pool[27455]: Tangent3fEXT (dynamic) */
+   /* _mesa_function_pool[27488]: Tangent3fEXT (dynamic) */
    "fff\0"
    "glTangent3fEXT\0"
    "\0"
-   /* _mesa_function_pool[27475]: TexImage3D (offset 371) */
+   /* _mesa_function_pool[27508]: TexImage3D (offset 371) */
    "iiiiiiiiip\0"
    "glTexImage3D\0"
    "glTexImage3DEXT\0"
    "glTexImage3DOES\0"
    "\0"
-   /* _mesa_function_pool[27532]: GetPerfQueryIdByNameINTEL (will be remapped) */
+   /* _mesa_function_pool[27565]: GetPerfQueryIdByNameINTEL (will be remapped) */
    "pp\0"
    "glGetPerfQueryIdByNameINTEL\0"
    "\0"
-   /* _mesa_function_pool[27564]: BindFragDataLocation (will be remapped) */
+   /* _mesa_function_pool[27597]: BindFragDataLocation (will be remapped) */
    "iip\0"
    "glBindFragDataLocationEXT\0"
    "glBindFragDataLocation\0"
    "\0"
-   /* _mesa_function_pool[27618]: LightModeliv (offset 166) */
+   /* _mesa_function_pool[27651]: LightModeliv (offset 166) */
    "ip\0"
    "glLightModeliv\0"
    "\0"
-   /* _mesa_function_pool[27637]: Normal3bv (offset 53) */
+   /* _mesa_function_pool[27670]: Normal3bv (offset 53) */
    "p\0"
    "glNormal3bv\0"
    "\0"
-   /* _mesa_function_pool[27652]: BeginQueryIndexed (will be remapped) */
+   /* _mesa_function_pool[27685]: BeginQueryIndexed (will be remapped) */
    "iii\0"
    "glBeginQueryIndexed\0"
    "\0"
-   /* _mesa_function_pool[27677]: ClearNamedBufferData (will be remapped) */
+   /* _mesa_function_pool[27710]: ClearNamedBufferData (will be remapped) */
    "iiiip\0"
    "glClearNamedBufferData\0"
    "\0"
-   /* _mesa_function_pool[27707]: Vertex3iv (offset 139) */
+   /* _mesa_function_pool[27740]: Vertex3iv (offset 139) */
    "p\0"
    "glVertex3iv\0"
    "\0"
-   /* _mesa_function_pool[27722]: UniformMatrix2x3dv (will be remapped) */
+   /* _mesa_function_pool[27755]: UniformMatrix2x3dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix2x3dv\0"
    "\0"
-   /* _mesa_function_pool[27749]: UniformHandleui64vARB (will be remapped) */
+   /* _mesa_function_pool[27782]: UniformHandleui64vARB (will be remapped) */
    "iip\0"
    "glUniformHandleui64vARB\0"
    "\0"
-   /* _mesa_function_pool[27778]: TexCoord3dv (offset 111) */
+   /* _mesa_function_pool[27811]: TexCoord3dv (offset 111) */
    "p\0"
    "glTexCoord3dv\0"
    "\0"
-   /* _mesa_function_pool[27795]: GetProgramStringARB (will be remapped) */
+   /* _mesa_function_pool[27828]: GetProgramStringARB (will be remapped) */
    "iip\0"
    "glGetProgramStringARB\0"
    "\0"
-   /* _mesa_function_pool[27822]: VertexP3ui (will be remapped) */
+   /* _mesa_function_pool[27855]: VertexP3ui (will be remapped) */
    "ii\0"
    "glVertexP3ui\0"
    "\0"
-   /* _mesa_function_pool[27839]: CreateProgramObjectARB (will be remapped) */
+   /* _mesa_function_pool[27872]: CreateProgramObjectARB (will be remapped) */
    "\0"
    "glCreateProgramObjectARB\0"
    "\0"
-   /* _mesa_function_pool[27866]: UniformMatrix3fv (will be remapped) */
+   /* _mesa_function_pool[27899]: UniformMatrix3fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3fv\0"
    "glUniformMatrix3fvARB\0"
    "\0"
-   /* _mesa_function_pool[27913]: PrioritizeTextures (offset 331) */
+   /* _mesa_function_pool[27946]: PrioritizeTextures (offset 331) */
    "ipp\0"
    "glPrioritizeTextures\0"
    "glPrioritizeTexturesEXT\0"
    "\0"
-   /* _mesa_function_pool[27963]: VertexAttribI3uiEXT (will be remapped) */
+   /* _mesa_function_pool[27996]: VertexAttribI3uiEXT (will be remapped) */
    "iiii\0"
    "glVertexAttribI3uiEXT\0"
    "glVertexAttribI3ui\0"
    "\0"
-   /* _mesa_function_pool[28010]: ProgramUniform1i64ARB (will be remapped) */
+   /* _mesa_function_pool[28043]: ProgramUniform1i64ARB (will be remapped) */
    "iii\0"
    "glProgramUniform1i64ARB\0"
    "\0"
-   /* _mesa_function_pool[28039]: GetProgramNamedParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[28072]: GetProgramNamedParameterfvNV (will be remapped) */
    "iipp\0"
    "glGetProgramNamedParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[28076]: GetMaterialxv (will be remapped) */
+   /* _mesa_function_pool[28109]: GetMaterialxv (will be remapped) */
    "iip\0"
    "glGetMaterialxvOES\0"
    "glGetMaterialxv\0"
    "\0"
-   /* _mesa_function_pool[28116]: MatrixIndexusvARB (dynamic) */
+   /* _mesa_function_pool[28149]: MatrixIndexusvARB (dynamic) */
    "ip\0"
    "glMatrixIndexusvARB\0"
    "\0"
-   /* _mesa_function_pool[28140]: SecondaryColor3uiv (will be remapped) */
+   /* _mesa_function_pool[28173]: SecondaryColor3uiv (will be remapped) */
    "p\0"
    "glSecondaryColor3uiv\0"
    "glSecondaryColor3uivEXT\0"
    "\0"
-   /* _mesa_function_pool[28188]: EndConditionalRender (will be remapped) */
+   /* _mesa_function_pool[28221]: EndConditionalRender (will be remapped) */
    "\0"
    "glEndConditionalRender\0"
    "glEndConditionalRenderNV\0"
    "\0"
-   /* _mesa_function_pool[28238]: ProgramLocalParameter4dARB (will be remapped) */
+   /* _mesa_function_pool[28271]: ProgramLocalParameter4dARB (will be remapped) */
    "iidddd\0"
    "glProgramLocalParameter4dARB\0"
    "\0"
-   /* _mesa_function_pool[28275]: Color3sv (offset 18) */
+   /* _mesa_function_pool[28308]: Color3sv (offset 18) */
    "p\0"
    "glColor3sv\0"
    "\0"
-   /* _mesa_function_pool[28289]: GenFragmentShadersATI (will be remapped) */
+   /* _mesa_function_pool[28322]: GenFragmentShadersATI (will be remapped) */
    "i\0"
    "glGenFragmentShadersATI\0"
    "\0"
-   /* _mesa_function_pool[28316]: GetNamedBufferParameteriv (will be remapped) */
+   /* _mesa_function_pool[28349]: GetNamedBufferParameteriv (will be remapped) */
    "iip\0"
    "glGetNamedBufferParameteriv\0"
    "\0"
-   /* _mesa_function_pool[28349]: BlendEquationSeparateiARB (will be remapped) */
+   /* _mesa_function_pool[28382]: BlendEquationSeparateiARB (will be remapped) */
    "iii\0"
    "glBlendEquationSeparateiARB\0"
    "glBlendEquationSeparateIndexedAMD\0"
@@ -3760,301 +3764,301 @@ static const char _mesa_function_pool[] =
    "glBlendEquationSeparateiEXT\0"
    "glBlendEquationSeparateiOES\0"
    "\0"
-   /* _mesa_function_pool[28497]: TestFenceNV (dynamic) */
+   /* _mesa_function_pool[28530]: TestFenceNV (dynamic) */
    "i\0"
    "glTestFenceNV\0"
    "\0"
-   /* _mesa_function_pool[28514]: MultiTexCoord1fvARB (offset 379) */
+   /* _mesa_function_pool[28547]: MultiTexCoord1fvARB (offset 379) */
    "ip\0"
    "glMultiTexCoord1fv\0"
    "glMultiTexCoord1fvARB\0"
    "\0"
-   /* _mesa_function_pool[28559]: TexStorage2D (will be remapped) */
+   /* _mesa_function_pool[28592]: TexStorage2D (will be remapped) */
    "iiiii\0"
    "glTexStorage2D\0"
    "\0"
-   /* _mesa_function_pool[28581]: GetPixelTexGenParameterivSGIS (dynamic) */
+   /* _mesa_function_pool[28614]: GetPixelTexGenParameterivSGIS (dynamic) */
    "ip\0"
    "glGetPixelTexGenParameterivSGIS\0"
    "\0"
-   /* _mesa_function_pool[28617]: FramebufferTexture2D (will be remapped) */
+   /* _mesa_function_pool[28650]: FramebufferTexture2D (will be remapped) */
    "iiiii\0"
    "glFramebufferTexture2D\0"
    "glFramebufferTexture2DEXT\0"
    "glFramebufferTexture2DOES\0"
    "\0"
-   /* _mesa_function_pool[28699]: GetSamplerParameterfv (will be remapped) */
+   /* _mesa_function_pool[28732]: GetSamplerParameterfv (will be remapped) */
    "iip\0"
    "glGetSamplerParameterfv\0"
    "\0"
-   /* _mesa_function_pool[28728]: VertexAttrib2dv (will be remapped) */
+   /* _mesa_function_pool[28761]: VertexAttrib2dv (will be remapped) */
    "ip\0"
    "glVertexAttrib2dv\0"
    "glVertexAttrib2dvARB\0"
    "\0"
-   /* _mesa_function_pool[28771]: Vertex4sv (offset 149) */
+   /* _mesa_function_pool[28804]: Vertex4sv (offset 149) */
    "p\0"
    "glVertex4sv\0"
    "\0"
-   /* _mesa_function_pool[28786]: GetQueryObjecti64v (will be remapped) */
+   /* _mesa_function_pool[28819]: GetQueryObjecti64v (will be remapped) */
    "iip\0"
    "glGetQueryObjecti64v\0"
    "glGetQueryObjecti64vEXT\0"
    "\0"
-   /* _mesa_function_pool[28836]: ClampColor (will be remapped) */
+   /* _mesa_function_pool[28869]: ClampColor (will be remapped) */
    "ii\0"
    "glClampColorARB\0"
    "glClampColor\0"
    "\0"
-   /* _mesa_function_pool[28869]: TextureRangeAPPLE (dynamic) */
+   /* _mesa_function_pool[28902]: TextureRangeAPPLE (dynamic) */
    "iip\0"
    "glTextureRangeAPPLE\0"
    "\0"
-   /* _mesa_function_pool[28894]: Uniform1i64ARB (will be remapped) */
+   /* _mesa_function_pool[28927]: Uniform1i64ARB (will be remapped) */
    "ii\0"
    "glUniform1i64ARB\0"
    "\0"
-   /* _mesa_function_pool[28915]: DepthRangeArrayfvOES (will be remapped) */
+   /* _mesa_function_pool[28948]: DepthRangeArrayfvOES (will be remapped) */
    "iip\0"
    "glDepthRangeArrayfvOES\0"
    "\0"
-   /* _mesa_function_pool[28943]: ConvolutionFilter1D (offset 348) */
+   /* _mesa_function_pool[28976]: ConvolutionFilter1D (offset 348) */
    "iiiiip\0"
    "glConvolutionFilter1D\0"
    "glConvolutionFilter1DEXT\0"
    "\0"
-   /* _mesa_function_pool[28998]: DrawElementsIndirect (will be remapped) */
+   /* _mesa_function_pool[29031]: DrawElementsIndirect (will be remapped) */
    "iip\0"
    "glDrawElementsIndirect\0"
    "\0"
-   /* _mesa_function_pool[29026]: WindowPos3sv (will be remapped) */
+   /* _mesa_function_pool[29059]: WindowPos3sv (will be remapped) */
    "p\0"
    "glWindowPos3sv\0"
    "glWindowPos3svARB\0"
    "glWindowPos3svMESA\0"
    "\0"
-   /* _mesa_function_pool[29081]: FragmentMaterialfvSGIX (dynamic) */
+   /* _mesa_function_pool[29114]: FragmentMaterialfvSGIX (dynamic) */
    "iip\0"
    "glFragmentMaterialfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[29111]: CallLists (offset 3) */
+   /* _mesa_function_pool[29144]: CallLists (offset 3) */
    "iip\0"
    "glCallLists\0"
    "\0"
-   /* _mesa_function_pool[29128]: AlphaFunc (offset 240) */
+   /* _mesa_function_pool[29161]: AlphaFunc (offset 240) */
    "if\0"
    "glAlphaFunc\0"
    "\0"
-   /* _mesa_function_pool[29144]: GetTextureParameterfv (will be remapped) */
+   /* _mesa_function_pool[29177]: GetTextureParameterfv (will be remapped) */
    "iip\0"
    "glGetTextureParameterfv\0"
    "\0"
-   /* _mesa_function_pool[29173]: EdgeFlag (offset 41) */
+   /* _mesa_function_pool[29206]: EdgeFlag (offset 41) */
    "i\0"
    "glEdgeFlag\0"
    "\0"
-   /* _mesa_function_pool[29187]: TexCoord2fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[29220]: TexCoord2fNormal3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glTexCoord2fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[29225]: EdgeFlagv (offset 42) */
+   /* _mesa_function_pool[29258]: EdgeFlagv (offset 42) */
    "p\0"
    "glEdgeFlagv\0"
    "\0"
-   /* _mesa_function_pool[29240]: DepthRangex (will be remapped) */
+   /* _mesa_function_pool[29273]: DepthRangex (will be remapped) */
    "ii\0"
    "glDepthRangexOES\0"
    "glDepthRangex\0"
    "\0"
-   /* _mesa_function_pool[29275]: ReplacementCodeubvSUN (dynamic) */
+   /* _mesa_function_pool[29308]: ReplacementCodeubvSUN (dynamic) */
    "p\0"
    "glReplacementCodeubvSUN\0"
    "\0"
-   /* _mesa_function_pool[29302]: ProgramUniformHandleui64vARB (will be remapped) */
+   /* _mesa_function_pool[29335]: ProgramUniformHandleui64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniformHandleui64vARB\0"
    "\0"
-   /* _mesa_function_pool[29339]: VDPAUInitNV (will be remapped) */
+   /* _mesa_function_pool[29372]: VDPAUInitNV (will be remapped) */
    "pp\0"
    "glVDPAUInitNV\0"
    "\0"
-   /* _mesa_function_pool[29357]: GetBufferParameteri64v (will be remapped) */
+   /* _mesa_function_pool[29390]: GetBufferParameteri64v (will be remapped) */
    "iip\0"
    "glGetBufferParameteri64v\0"
    "\0"
-   /* _mesa_function_pool[29387]: CreateProgram (will be remapped) */
+   /* _mesa_function_pool[29420]: CreateProgram (will be remapped) */
    "\0"
    "glCreateProgram\0"
    "\0"
-   /* _mesa_function_pool[29405]: DepthRangef (will be remapped) */
+   /* _mesa_function_pool[29438]: DepthRangef (will be remapped) */
    "ff\0"
    "glDepthRangef\0"
    "glDepthRangefOES\0"
    "\0"
-   /* _mesa_function_pool[29440]: TextureParameteriv (will be remapped) */
+   /* _mesa_function_pool[29473]: TextureParameteriv (will be remapped) */
    "iip\0"
    "glTextureParameteriv\0"
    "\0"
-   /* _mesa_function_pool[29466]: ColorFragmentOp3ATI (will be remapped) */
+   /* _mesa_function_pool[29499]: ColorFragmentOp3ATI (will be remapped) */
    "iiiiiiiiiiiii\0"
    "glColorFragmentOp3ATI\0"
    "\0"
-   /* _mesa_function_pool[29503]: ValidateProgram (will be remapped) */
+   /* _mesa_function_pool[29536]: ValidateProgram (will be remapped) */
    "i\0"
    "glValidateProgram\0"
    "glValidateProgramARB\0"
    "\0"
-   /* _mesa_function_pool[29545]: VertexPointerEXT (will be remapped) */
+   /* _mesa_function_pool[29578]: VertexPointerEXT (will be remapped) */
    "iiiip\0"
    "glVertexPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[29571]: VertexAttribI4sv (will be remapped) */
+   /* _mesa_function_pool[29604]: VertexAttribI4sv (will be remapped) */
    "ip\0"
    "glVertexAttribI4svEXT\0"
    "glVertexAttribI4sv\0"
    "\0"
-   /* _mesa_function_pool[29616]: Scissor (offset 176) */
+   /* _mesa_function_pool[29649]: Scissor (offset 176) */
    "iiii\0"
    "glScissor\0"
    "\0"
-   /* _mesa_function_pool[29632]: BeginTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[29665]: BeginTransformFeedback (will be remapped) */
    "i\0"
    "glBeginTransformFeedback\0"
    "glBeginTransformFeedbackEXT\0"
    "\0"
-   /* _mesa_function_pool[29688]: TexCoord2i (offset 106) */
+   /* _mesa_function_pool[29721]: TexCoord2i (offset 106) */
    "ii\0"
    "glTexCoord2i\0"
    "\0"
-   /* _mesa_function_pool[29705]: VertexArrayAttribBinding (will be remapped) */
+   /* _mesa_function_pool[29738]: VertexArrayAttribBinding (will be remapped) */
    "iii\0"
    "glVertexArrayAttribBinding\0"
    "\0"
-   /* _mesa_function_pool[29737]: Color4ui (offset 37) */
+   /* _mesa_function_pool[29770]: Color4ui (offset 37) */
    "iiii\0"
    "glColor4ui\0"
    "\0"
-   /* _mesa_function_pool[29754]: TexCoord2f (offset 104) */
+   /* _mesa_function_pool[29787]: TexCoord2f (offset 104) */
    "ff\0"
    "glTexCoord2f\0"
    "\0"
-   /* _mesa_function_pool[29771]: TexCoord2d (offset 102) */
+   /* _mesa_function_pool[29804]: TexCoord2d (offset 102) */
    "dd\0"
    "glTexCoord2d\0"
    "\0"
-   /* _mesa_function_pool[29788]: GetTransformFeedbackiv (will be remapped) */
+   /* _mesa_function_pool[29821]: GetTransformFeedbackiv (will be remapped) */
    "iip\0"
    "glGetTransformFeedbackiv\0"
    "\0"
-   /* _mesa_function_pool[29818]: TexCoord2s (offset 108) */
+   /* _mesa_function_pool[29851]: TexCoord2s (offset 108) */
    "ii\0"
    "glTexCoord2s\0"
    "\0"
-   /* _mesa_function_pool[29835]: PointSizePointerOES (will be remapped) */
+   /* _mesa_function_pool[29868]: PointSizePointerOES (will be remapped) */
    "iip\0"
    "glPointSizePointerOES\0"
    "\0"
-   /* _mesa_function_pool[29862]: Color4us (offset 39) */
+   /* _mesa_function_pool[29895]: Color4us (offset 39) */
    "iiii\0"
    "glColor4us\0"
    "\0"
-   /* _mesa_function_pool[29879]: Color3bv (offset 10) */
+   /* _mesa_function_pool[29912]: Color3bv (offset 10) */
    "p\0"
    "glColor3bv\0"
    "\0"
-   /* _mesa_function_pool[29893]: PrimitiveRestartNV (will be remapped) */
+   /* _mesa_function_pool[29926]: PrimitiveRestartNV (will be remapped) */
    "\0"
    "glPrimitiveRestartNV\0"
    "\0"
-   /* _mesa_function_pool[29916]: BindBufferOffsetEXT (will be remapped) */
+   /* _mesa_function_pool[29949]: BindBufferOffsetEXT (will be remapped) */
    "iiii\0"
    "glBindBufferOffsetEXT\0"
    "\0"
-   /* _mesa_function_pool[29944]: ProvokingVertex (will be remapped) */
+   /* _mesa_function_pool[29977]: ProvokingVertex (will be remapped) */
    "i\0"
    "glProvokingVertexEXT\0"
    "glProvokingVertex\0"
    "\0"
-   /* _mesa_function_pool[29986]: VertexAttribs4fvNV (will be remapped) */
+   /* _mesa_function_pool[30019]: VertexAttribs4fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4fvNV\0"
    "\0"
-   /* _mesa_function_pool[30012]: MapControlPointsNV (dynamic) */
+   /* _mesa_function_pool[30045]: MapControlPointsNV (dynamic) */
    "iiiiiiiip\0"
    "glMapControlPointsNV\0"
    "\0"
-   /* _mesa_function_pool[30044]: Vertex2i (offset 130) */
+   /* _mesa_function_pool[30077]: Vertex2i (offset 130) */
    "ii\0"
    "glVertex2i\0"
    "\0"
-   /* _mesa_function_pool[30059]: HintPGI (dynamic) */
+   /* _mesa_function_pool[30092]: HintPGI (dynamic) */
    "ii\0"
    "glHintPGI\0"
    "\0"
-   /* _mesa_function_pool[30073]: GetQueryBufferObjecti64v (will be remapped) */
+   /* _mesa_function_pool[30106]: GetQueryBufferObjecti64v (will be remapped) */
    "iiii\0"
    "glGetQueryBufferObjecti64v\0"
    "\0"
-   /* _mesa_function_pool[30106]: InterleavedArrays (offset 317) */
+   /* _mesa_function_pool[30139]: InterleavedArrays (offset 317) */
    "iip\0"
    "glInterleavedArrays\0"
    "\0"
-   /* _mesa_function_pool[30131]: RasterPos2fv (offset 65) */
+   /* _mesa_function_pool[30164]: RasterPos2fv (offset 65) */
    "p\0"
    "glRasterPos2fv\0"
    "\0"
-   /* _mesa_function_pool[30149]: TexCoord1fv (offset 97) */
+   /* _mesa_function_pool[30182]: TexCoord1fv (offset 97) */
    "p\0"
    "glTexCoord1fv\0"
    "\0"
-   /* _mesa_function_pool[30166]: ProgramNamedParameter4fNV (will be remapped) */
+   /* _mesa_function_pool[30199]: ProgramNamedParameter4fNV (will be remapped) */
    "iipffff\0"
    "glProgramNamedParameter4fNV\0"
    "\0"
-   /* _mesa_function_pool[30203]: MultiTexCoord4dv (offset 401) */
+   /* _mesa_function_pool[30236]: MultiTexCoord4dv (offset 401) */
    "ip\0"
    "glMultiTexCoord4dv\0"
    "glMultiTexCoord4dvARB\0"
    "\0"
-   /* _mesa_function_pool[30248]: ProgramEnvParameter4fvARB (will be remapped) */
+   /* _mesa_function_pool[30281]: ProgramEnvParameter4fvARB (will be remapped) */
    "iip\0"
    "glProgramEnvParameter4fvARB\0"
    "glProgramParameter4fvNV\0"
    "\0"
-   /* _mesa_function_pool[30305]: RasterPos4fv (offset 81) */
+   /* _mesa_function_pool[30338]: RasterPos4fv (offset 81) */
    "p\0"
    "glRasterPos4fv\0"
    "\0"
-   /* _mesa_function_pool[30323]: FragmentLightModeliSGIX (dynamic) */
+   /* _mesa_function_pool[30356]: FragmentLightModeliSGIX (dynamic) */
    "ii\0"
    "glFragmentLightModeliSGIX\0"
    "\0"
-   /* _mesa_function_pool[30353]: PushMatrix (offset 298) */
+   /* _mesa_function_pool[30386]: PushMatrix (offset 298) */
    "\0"
    "glPushMatrix\0"
    "\0"
-   /* _mesa_function_pool[30368]: EndList (offset 1) */
+   /* _mesa_function_pool[30401]: EndList (offset 1) */
    "\0"
    "glEndList\0"
    "\0"
-   /* _mesa_function_pool[30380]: DrawRangeElements (offset 338) */
+   /* _mesa_function_pool[30413]: DrawRangeElements (offset 338) */
    "iiiiip\0"
    "glDrawRangeElements\0"
    "glDrawRangeElementsEXT\0"
    "\0"
-   /* _mesa_function_pool[30431]: GetTexGenxvOES (will be remapped) */
+   /* _mesa_function_pool[30464]: GetTexGenxvOES (will be remapped) */
    "iip\0"
    "glGetTexGenxvOES\0"
    "\0"
-   /* _mesa_function_pool[30453]: GetHandleARB (will be remapped) */
+   /* _mesa_function_pool[30486]: GetHandleARB (will be remapped) */
    "i\0"
    "glGetHandleARB\0"
    "\0"
-   /* _mesa_function_pool[30471]: DrawTexfvOES (will be remapped) */
+   /* _mesa_function_pool[30504]: DrawTexfvOES (will be remapped) */
    "p\0"
    "glDrawTexfvOES\0"
    "\0"
-   /* _mesa_function_pool[30489]: BlendFunciARB (will be remapped) */
+   /* _mesa_function_pool[30522]: BlendFunciARB (will be remapped) */
    "iii\0"
    "glBlendFunciARB\0"
    "glBlendFuncIndexedAMD\0"
@@ -4062,468 +4066,468 @@ static const char _mesa_function_pool[] =
    "glBlendFunciEXT\0"
    "glBlendFunciOES\0"
    "\0"
-   /* _mesa_function_pool[30577]: ClearNamedFramebufferfi (will be remapped) */
+   /* _mesa_function_pool[30610]: ClearNamedFramebufferfi (will be remapped) */
    "iiifi\0"
    "glClearNamedFramebufferfi\0"
    "\0"
-   /* _mesa_function_pool[30610]: ClearNamedFramebufferfv (will be remapped) */
+   /* _mesa_function_pool[30643]: ClearNamedFramebufferfv (will be remapped) */
    "iiip\0"
    "glClearNamedFramebufferfv\0"
    "\0"
-   /* _mesa_function_pool[30642]: GlobalAlphaFactorbSUN (dynamic) */
+   /* _mesa_function_pool[30675]: GlobalAlphaFactorbSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorbSUN\0"
    "\0"
-   /* _mesa_function_pool[30669]: Uniform2ui (will be remapped) */
+   /* _mesa_function_pool[30702]: Uniform2ui (will be remapped) */
    "iii\0"
    "glUniform2uiEXT\0"
    "glUniform2ui\0"
    "\0"
-   /* _mesa_function_pool[30703]: ScissorIndexed (will be remapped) */
+   /* _mesa_function_pool[30736]: ScissorIndexed (will be remapped) */
    "iiiii\0"
    "glScissorIndexed\0"
    "glScissorIndexedOES\0"
    "\0"
-   /* _mesa_function_pool[30747]: End (offset 43) */
+   /* _mesa_function_pool[30780]: End (offset 43) */
    "\0"
    "glEnd\0"
    "\0"
-   /* _mesa_function_pool[30755]: NamedFramebufferParameteri (will be remapped) */
+   /* _mesa_function_pool[30788]: NamedFramebufferParameteri (will be remapped) */
    "iii\0"
    "glNamedFramebufferParameteri\0"
    "\0"
-   /* _mesa_function_pool[30789]: BindVertexBuffers (will be remapped) */
+   /* _mesa_function_pool[30822]: BindVertexBuffers (will be remapped) */
    "iippp\0"
    "glBindVertexBuffers\0"
    "\0"
-   /* _mesa_function_pool[30816]: GetSamplerParameteriv (will be remapped) */
+   /* _mesa_function_pool[30849]: GetSamplerParameteriv (will be remapped) */
    "iip\0"
    "glGetSamplerParameteriv\0"
    "\0"
-   /* _mesa_function_pool[30845]: GenProgramPipelines (will be remapped) */
+   /* _mesa_function_pool[30878]: GenProgramPipelines (will be remapped) */
    "ip\0"
    "glGenProgramPipelines\0"
    "glGenProgramPipelinesEXT\0"
    "\0"
-   /* _mesa_function_pool[30896]: Enable (offset 215) */
+   /* _mesa_function_pool[30929]: Enable (offset 215) */
    "i\0"
    "glEnable\0"
    "\0"
-   /* _mesa_function_pool[30908]: IsProgramPipeline (will be remapped) */
+   /* _mesa_function_pool[30941]: IsProgramPipeline (will be remapped) */
    "i\0"
    "glIsProgramPipeline\0"
    "glIsProgramPipelineEXT\0"
    "\0"
-   /* _mesa_function_pool[30954]: ShaderBinary (will be remapped) */
+   /* _mesa_function_pool[30987]: ShaderBinary (will be remapped) */
    "ipipi\0"
    "glShaderBinary\0"
    "\0"
-   /* _mesa_function_pool[30976]: GetFragmentMaterialivSGIX (dynamic) */
+   /* _mesa_function_pool[31009]: GetFragmentMaterialivSGIX (dynamic) */
    "iip\0"
    "glGetFragmentMaterialivSGIX\0"
    "\0"
-   /* _mesa_function_pool[31009]: WeightPointerARB (dynamic) */
+   /* _mesa_function_pool[31042]: WeightPointerARB (dynamic) */
    "iiip\0"
    "glWeightPointerARB\0"
    "glWeightPointerOES\0"
    "\0"
-   /* _mesa_function_pool[31053]: TextureSubImage1D (will be remapped) */
+   /* _mesa_function_pool[31086]: TextureSubImage1D (will be remapped) */
    "iiiiiip\0"
    "glTextureSubImage1D\0"
    "\0"
-   /* _mesa_function_pool[31082]: Normal3x (will be remapped) */
+   /* _mesa_function_pool[31115]: Normal3x (will be remapped) */
    "iii\0"
    "glNormal3xOES\0"
    "glNormal3x\0"
    "\0"
-   /* _mesa_function_pool[31112]: VertexAttrib4fARB (will be remapped) */
+   /* _mesa_function_pool[31145]: VertexAttrib4fARB (will be remapped) */
    "iffff\0"
    "glVertexAttrib4f\0"
    "glVertexAttrib4fARB\0"
    "\0"
-   /* _mesa_function_pool[31156]: TexCoord4fv (offset 121) */
+   /* _mesa_function_pool[31189]: TexCoord4fv (offset 121) */
    "p\0"
    "glTexCoord4fv\0"
    "\0"
-   /* _mesa_function_pool[31173]: ReadnPixelsARB (will be remapped) */
+   /* _mesa_function_pool[31206]: ReadnPixelsARB (will be remapped) */
    "iiiiiiip\0"
    "glReadnPixelsARB\0"
    "glReadnPixels\0"
    "glReadnPixelsKHR\0"
    "\0"
-   /* _mesa_function_pool[31231]: InvalidateTexSubImage (will be remapped) */
+   /* _mesa_function_pool[31264]: InvalidateTexSubImage (will be remapped) */
    "iiiiiiii\0"
    "glInvalidateTexSubImage\0"
    "\0"
-   /* _mesa_function_pool[31265]: Normal3s (offset 60) */
+   /* _mesa_function_pool[31298]: Normal3s (offset 60) */
    "iii\0"
    "glNormal3s\0"
    "\0"
-   /* _mesa_function_pool[31281]: Materialxv (will be remapped) */
+   /* _mesa_function_pool[31314]: Materialxv (will be remapped) */
    "iip\0"
    "glMaterialxvOES\0"
    "glMaterialxv\0"
    "\0"
-   /* _mesa_function_pool[31315]: Normal3i (offset 58) */
+   /* _mesa_function_pool[31348]: Normal3i (offset 58) */
    "iii\0"
    "glNormal3i\0"
    "\0"
-   /* _mesa_function_pool[31331]: ProgramNamedParameter4fvNV (will be remapped) */
+   /* _mesa_function_pool[31364]: ProgramNamedParameter4fvNV (will be remapped) */
    "iipp\0"
    "glProgramNamedParameter4fvNV\0"
    "\0"
-   /* _mesa_function_pool[31366]: Normal3b (offset 52) */
+   /* _mesa_function_pool[31399]: Normal3b (offset 52) */
    "iii\0"
    "glNormal3b\0"
    "\0"
-   /* _mesa_function_pool[31382]: Normal3d (offset 54) */
+   /* _mesa_function_pool[31415]: Normal3d (offset 54) */
    "ddd\0"
    "glNormal3d\0"
    "\0"
-   /* _mesa_function_pool[31398]: Normal3f (offset 56) */
+   /* _mesa_function_pool[31431]: Normal3f (offset 56) */
    "fff\0"
    "glNormal3f\0"
    "\0"
-   /* _mesa_function_pool[31414]: Indexi (offset 48) */
+   /* _mesa_function_pool[31447]: Indexi (offset 48) */
    "i\0"
    "glIndexi\0"
    "\0"
-   /* _mesa_function_pool[31426]: Uniform1uiv (will be remapped) */
+   /* _mesa_function_pool[31459]: Uniform1uiv (will be remapped) */
    "iip\0"
    "glUniform1uivEXT\0"
    "glUniform1uiv\0"
    "\0"
-   /* _mesa_function_pool[31462]: VertexAttribI2uiEXT (will be remapped) */
+   /* _mesa_function_pool[31495]: VertexAttribI2uiEXT (will be remapped) */
    "iii\0"
    "glVertexAttribI2uiEXT\0"
    "glVertexAttribI2ui\0"
    "\0"
-   /* _mesa_function_pool[31508]: IsRenderbuffer (will be remapped) */
+   /* _mesa_function_pool[31541]: IsRenderbuffer (will be remapped) */
    "i\0"
    "glIsRenderbuffer\0"
    "glIsRenderbufferEXT\0"
    "glIsRenderbufferOES\0"
    "\0"
-   /* _mesa_function_pool[31568]: NormalP3uiv (will be remapped) */
+   /* _mesa_function_pool[31601]: NormalP3uiv (will be remapped) */
    "ip\0"
    "glNormalP3uiv\0"
    "\0"
-   /* _mesa_function_pool[31586]: Indexf (offset 46) */
+   /* _mesa_function_pool[31619]: Indexf (offset 46) */
    "f\0"
    "glIndexf\0"
    "\0"
-   /* _mesa_function_pool[31598]: Indexd (offset 44) */
+   /* _mesa_function_pool[31631]: Indexd (offset 44) */
    "d\0"
    "glIndexd\0"
    "\0"
-   /* _mesa_function_pool[31610]: GetMaterialiv (offset 270) */
+   /* _mesa_function_pool[31643]: GetMaterialiv (offset 270) */
    "iip\0"
    "glGetMaterialiv\0"
    "\0"
-   /* _mesa_function_pool[31631]: Indexs (offset 50) */
+   /* _mesa_function_pool[31664]: Indexs (offset 50) */
    "i\0"
    "glIndexs\0"
    "\0"
-   /* _mesa_function_pool[31643]: MultiTexCoordP1uiv (will be remapped) */
+   /* _mesa_function_pool[31676]: MultiTexCoordP1uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP1uiv\0"
    "\0"
-   /* _mesa_function_pool[31669]: ConvolutionFilter2D (offset 349) */
+   /* _mesa_function_pool[31702]: ConvolutionFilter2D (offset 349) */
    "iiiiiip\0"
    "glConvolutionFilter2D\0"
    "glConvolutionFilter2DEXT\0"
    "\0"
-   /* _mesa_function_pool[31725]: Vertex2d (offset 126) */
+   /* _mesa_function_pool[31758]: Vertex2d (offset 126) */
    "dd\0"
    "glVertex2d\0"
    "\0"
-   /* _mesa_function_pool[31740]: Vertex2f (offset 128) */
+   /* _mesa_function_pool[31773]: Vertex2f (offset 128) */
    "ff\0"
    "glVertex2f\0"
    "\0"
-   /* _mesa_function_pool[31755]: Color4bv (offset 26) */
+   /* _mesa_function_pool[31788]: Color4bv (offset 26) */
    "p\0"
    "glColor4bv\0"
    "\0"
-   /* _mesa_function_pool[31769]: ProgramUniformMatrix3x2dv (will be remapped) */
+   /* _mesa_function_pool[31802]: ProgramUniformMatrix3x2dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix3x2dv\0"
    "\0"
-   /* _mesa_function_pool[31804]: VertexAttrib2fvNV (will be remapped) */
+   /* _mesa_function_pool[31837]: VertexAttrib2fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib2fvNV\0"
    "\0"
-   /* _mesa_function_pool[31828]: Vertex2s (offset 132) */
+   /* _mesa_function_pool[31861]: Vertex2s (offset 132) */
    "ii\0"
    "glVertex2s\0"
    "\0"
-   /* _mesa_function_pool[31843]: ActiveTexture (offset 374) */
+   /* _mesa_function_pool[31876]: ActiveTexture (offset 374) */
    "i\0"
    "glActiveTexture\0"
    "glActiveTextureARB\0"
    "\0"
-   /* _mesa_function_pool[31881]: GlobalAlphaFactorfSUN (dynamic) */
+   /* _mesa_function_pool[31914]: GlobalAlphaFactorfSUN (dynamic) */
    "f\0"
    "glGlobalAlphaFactorfSUN\0"
    "\0"
-   /* _mesa_function_pool[31908]: InvalidateNamedFramebufferSubData (will be remapped) */
+   /* _mesa_function_pool[31941]: InvalidateNamedFramebufferSubData (will be remapped) */
    "iipiiii\0"
    "glInvalidateNamedFramebufferSubData\0"
    "\0"
-   /* _mesa_function_pool[31953]: ColorP4uiv (will be remapped) */
+   /* _mesa_function_pool[31986]: ColorP4uiv (will be remapped) */
    "ip\0"
    "glColorP4uiv\0"
    "\0"
-   /* _mesa_function_pool[31970]: DrawTexxOES (will be remapped) */
+   /* _mesa_function_pool[32003]: DrawTexxOES (will be remapped) */
    "iiiii\0"
    "glDrawTexxOES\0"
    "\0"
-   /* _mesa_function_pool[31991]: SetFenceNV (dynamic) */
+   /* _mesa_function_pool[32024]: SetFenceNV (dynamic) */
    "ii\0"
    "glSetFenceNV\0"
    "\0"
-   /* _mesa_function_pool[32008]: PixelTexGenParameterivSGIS (dynamic) */
+   /* _mesa_function_pool[32041]: PixelTexGenParameterivSGIS (dynamic) */
    "ip\0"
    "glPixelTexGenParameterivSGIS\0"
    "\0"
-   /* _mesa_function_pool[32041]: MultiTexCoordP3ui (will be remapped) */
+   /* _mesa_function_pool[32074]: MultiTexCoordP3ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP3ui\0"
    "\0"
-   /* _mesa_function_pool[32066]: GetAttribLocation (will be remapped) */
+   /* _mesa_function_pool[32099]: GetAttribLocation (will be remapped) */
    "ip\0"
    "glGetAttribLocation\0"
    "glGetAttribLocationARB\0"
    "\0"
-   /* _mesa_function_pool[32113]: GetCombinerStageParameterfvNV (dynamic) */
+   /* _mesa_function_pool[32146]: GetCombinerStageParameterfvNV (dynamic) */
    "iip\0"
    "glGetCombinerStageParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[32150]: DrawBuffer (offset 202) */
+   /* _mesa_function_pool[32183]: DrawBuffer (offset 202) */
    "i\0"
    "glDrawBuffer\0"
    "\0"
-   /* _mesa_function_pool[32166]: GetPointerv (offset 329) */
+   /* _mesa_function_pool[32199]: GetPointerv (offset 329) */
    "ip\0"
    "glGetPointerv\0"
    "glGetPointervKHR\0"
    "glGetPointervEXT\0"
    "\0"
-   /* _mesa_function_pool[32218]: MultiTexCoord2dv (offset 385) */
+   /* _mesa_function_pool[32251]: MultiTexCoord2dv (offset 385) */
    "ip\0"
    "glMultiTexCoord2dv\0"
    "glMultiTexCoord2dvARB\0"
    "\0"
-   /* _mesa_function_pool[32263]: IsSampler (will be remapped) */
+   /* _mesa_function_pool[32296]: IsSampler (will be remapped) */
    "i\0"
    "glIsSampler\0"
    "\0"
-   /* _mesa_function_pool[32278]: BlendFunc (offset 241) */
+   /* _mesa_function_pool[32311]: BlendFunc (offset 241) */
    "ii\0"
    "glBlendFunc\0"
    "\0"
-   /* _mesa_function_pool[32294]: NamedRenderbufferStorageMultisample (will be remapped) */
+   /* _mesa_function_pool[32327]: NamedRenderbufferStorageMultisample (will be remapped) */
    "iiiii\0"
    "glNamedRenderbufferStorageMultisample\0"
    "\0"
-   /* _mesa_function_pool[32339]: Tangent3fvEXT (dynamic) */
+   /* _mesa_function_pool[32372]: Tangent3fvEXT (dynamic) */
    "p\0"
    "glTangent3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[32358]: ColorMaterial (offset 151) */
+   /* _mesa_function_pool[32391]: ColorMaterial (offset 151) */
    "ii\0"
    "glColorMaterial\0"
    "\0"
-   /* _mesa_function_pool[32378]: RasterPos3sv (offset 77) */
+   /* _mesa_function_pool[32411]: RasterPos3sv (offset 77) */
    "p\0"
    "glRasterPos3sv\0"
    "\0"
-   /* _mesa_function_pool[32396]: TexCoordP2ui (will be remapped) */
+   /* _mesa_function_pool[32429]: TexCoordP2ui (will be remapped) */
    "ii\0"
    "glTexCoordP2ui\0"
    "\0"
-   /* _mesa_function_pool[32415]: TexParameteriv (offset 181) */
+   /* _mesa_function_pool[32448]: TexParameteriv (offset 181) */
    "iip\0"
    "glTexParameteriv\0"
    "\0"
-   /* _mesa_function_pool[32437]: WaitSemaphoreEXT (will be remapped) */
+   /* _mesa_function_pool[32470]: WaitSemaphoreEXT (will be remapped) */
    "iipipp\0"
    "glWaitSemaphoreEXT\0"
    "\0"
-   /* _mesa_function_pool[32464]: VertexAttrib3fvARB (will be remapped) */
+   /* _mesa_function_pool[32497]: VertexAttrib3fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib3fv\0"
    "glVertexAttrib3fvARB\0"
    "\0"
-   /* _mesa_function_pool[32507]: ProgramUniformMatrix3x4fv (will be remapped) */
+   /* _mesa_function_pool[32540]: ProgramUniformMatrix3x4fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix3x4fv\0"
    "glProgramUniformMatrix3x4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[32573]: PixelTransformParameterfEXT (dynamic) */
+   /* _mesa_function_pool[32606]: PixelTransformParameterfEXT (dynamic) */
    "iif\0"
    "glPixelTransformParameterfEXT\0"
    "\0"
-   /* _mesa_function_pool[32608]: TextureColorMaskSGIS (dynamic) */
+   /* _mesa_function_pool[32641]: TextureColorMaskSGIS (dynamic) */
    "iiii\0"
    "glTextureColorMaskSGIS\0"
    "\0"
-   /* _mesa_function_pool[32637]: GetColorTable (offset 343) */
+   /* _mesa_function_pool[32670]: GetColorTable (offset 343) */
    "iiip\0"
    "glGetColorTable\0"
    "glGetColorTableSGI\0"
    "glGetColorTableEXT\0"
    "\0"
-   /* _mesa_function_pool[32697]: TexCoord3i (offset 114) */
+   /* _mesa_function_pool[32730]: TexCoord3i (offset 114) */
    "iii\0"
    "glTexCoord3i\0"
    "\0"
-   /* _mesa_function_pool[32715]: CopyColorTable (offset 342) */
+   /* _mesa_function_pool[32748]: CopyColorTable (offset 342) */
    "iiiii\0"
    "glCopyColorTable\0"
    "glCopyColorTableSGI\0"
    "\0"
-   /* _mesa_function_pool[32759]: Frustum (offset 289) */
+   /* _mesa_function_pool[32792]: Frustum (offset 289) */
    "dddddd\0"
    "glFrustum\0"
    "\0"
-   /* _mesa_function_pool[32777]: TexCoord3d (offset 110) */
+   /* _mesa_function_pool[32810]: TexCoord3d (offset 110) */
    "ddd\0"
    "glTexCoord3d\0"
    "\0"
-   /* _mesa_function_pool[32795]: GetTextureParameteriv (will be remapped) */
+   /* _mesa_function_pool[32828]: GetTextureParameteriv (will be remapped) */
    "iip\0"
    "glGetTextureParameteriv\0"
    "\0"
-   /* _mesa_function_pool[32824]: TexCoord3f (offset 112) */
+   /* _mesa_function_pool[32857]: TexCoord3f (offset 112) */
    "fff\0"
    "glTexCoord3f\0"
    "\0"
-   /* _mesa_function_pool[32842]: DepthRangeArrayv (will be remapped) */
+   /* _mesa_function_pool[32875]: DepthRangeArrayv (will be remapped) */
    "iip\0"
    "glDepthRangeArrayv\0"
    "\0"
-   /* _mesa_function_pool[32866]: DeleteTextures (offset 327) */
+   /* _mesa_function_pool[32899]: DeleteTextures (offset 327) */
    "ip\0"
    "glDeleteTextures\0"
    "glDeleteTexturesEXT\0"
    "\0"
-   /* _mesa_function_pool[32907]: TexCoordPointerEXT (will be remapped) */
+   /* _mesa_function_pool[32940]: TexCoordPointerEXT (will be remapped) */
    "iiiip\0"
    "glTexCoordPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[32935]: TexCoord3s (offset 116) */
+   /* _mesa_function_pool[32968]: TexCoord3s (offset 116) */
    "iii\0"
    "glTexCoord3s\0"
    "\0"
-   /* _mesa_function_pool[32953]: GetTexLevelParameteriv (offset 285) */
+   /* _mesa_function_pool[32986]: GetTexLevelParameteriv (offset 285) */
    "iiip\0"
    "glGetTexLevelParameteriv\0"
    "\0"
-   /* _mesa_function_pool[32984]: TextureParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[33017]: TextureParameterIuiv (will be remapped) */
    "iip\0"
    "glTextureParameterIuiv\0"
    "\0"
-   /* _mesa_function_pool[33012]: CombinerStageParameterfvNV (dynamic) */
+   /* _mesa_function_pool[33045]: CombinerStageParameterfvNV (dynamic) */
    "iip\0"
    "glCombinerStageParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[33046]: GenPerfMonitorsAMD (will be remapped) */
+   /* _mesa_function_pool[33079]: GenPerfMonitorsAMD (will be remapped) */
    "ip\0"
    "glGenPerfMonitorsAMD\0"
    "\0"
-   /* _mesa_function_pool[33071]: ClearAccum (offset 204) */
+   /* _mesa_function_pool[33104]: ClearAccum (offset 204) */
    "ffff\0"
    "glClearAccum\0"
    "\0"
-   /* _mesa_function_pool[33090]: DeformSGIX (dynamic) */
+   /* _mesa_function_pool[33123]: DeformSGIX (dynamic) */
    "i\0"
    "glDeformSGIX\0"
    "\0"
-   /* _mesa_function_pool[33106]: TexCoord4iv (offset 123) */
+   /* _mesa_function_pool[33139]: TexCoord4iv (offset 123) */
    "p\0"
    "glTexCoord4iv\0"
    "\0"
-   /* _mesa_function_pool[33123]: TexStorage3D (will be remapped) */
+   /* _mesa_function_pool[33156]: TexStorage3D (will be remapped) */
    "iiiiii\0"
    "glTexStorage3D\0"
    "\0"
-   /* _mesa_function_pool[33146]: Uniform2i64ARB (will be remapped) */
+   /* _mesa_function_pool[33179]: Uniform2i64ARB (will be remapped) */
    "iii\0"
    "glUniform2i64ARB\0"
    "\0"
-   /* _mesa_function_pool[33168]: FramebufferTexture3D (will be remapped) */
+   /* _mesa_function_pool[33201]: FramebufferTexture3D (will be remapped) */
    "iiiiii\0"
    "glFramebufferTexture3D\0"
    "glFramebufferTexture3DEXT\0"
    "glFramebufferTexture3DOES\0"
    "\0"
-   /* _mesa_function_pool[33251]: FragmentLightModelfvSGIX (dynamic) */
+   /* _mesa_function_pool[33284]: FragmentLightModelfvSGIX (dynamic) */
    "ip\0"
    "glFragmentLightModelfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[33282]: GetBufferParameteriv (will be remapped) */
+   /* _mesa_function_pool[33315]: GetBufferParameteriv (will be remapped) */
    "iip\0"
    "glGetBufferParameteriv\0"
    "glGetBufferParameterivARB\0"
    "\0"
-   /* _mesa_function_pool[33336]: VertexAttrib2fNV (will be remapped) */
+   /* _mesa_function_pool[33369]: VertexAttrib2fNV (will be remapped) */
    "iff\0"
    "glVertexAttrib2fNV\0"
    "\0"
-   /* _mesa_function_pool[33360]: GetFragmentLightfvSGIX (dynamic) */
+   /* _mesa_function_pool[33393]: GetFragmentLightfvSGIX (dynamic) */
    "iip\0"
    "glGetFragmentLightfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[33390]: CopyTexImage2D (offset 324) */
+   /* _mesa_function_pool[33423]: CopyTexImage2D (offset 324) */
    "iiiiiiii\0"
    "glCopyTexImage2D\0"
    "glCopyTexImage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[33437]: Vertex3fv (offset 137) */
+   /* _mesa_function_pool[33470]: Vertex3fv (offset 137) */
    "p\0"
    "glVertex3fv\0"
    "\0"
-   /* _mesa_function_pool[33452]: WindowPos4dvMESA (will be remapped) */
+   /* _mesa_function_pool[33485]: WindowPos4dvMESA (will be remapped) */
    "p\0"
    "glWindowPos4dvMESA\0"
    "\0"
-   /* _mesa_function_pool[33474]: ProgramUniform2i64vARB (will be remapped) */
+   /* _mesa_function_pool[33507]: ProgramUniform2i64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniform2i64vARB\0"
    "\0"
-   /* _mesa_function_pool[33505]: MultiTexCoordP2ui (will be remapped) */
+   /* _mesa_function_pool[33538]: MultiTexCoordP2ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP2ui\0"
    "\0"
-   /* _mesa_function_pool[33530]: VertexAttribs1dvNV (will be remapped) */
+   /* _mesa_function_pool[33563]: VertexAttribs1dvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs1dvNV\0"
    "\0"
-   /* _mesa_function_pool[33556]: ImportSemaphoreFdEXT (will be remapped) */
+   /* _mesa_function_pool[33589]: ImportSemaphoreFdEXT (will be remapped) */
    "iii\0"
    "glImportSemaphoreFdEXT\0"
    "\0"
-   /* _mesa_function_pool[33584]: IsQuery (will be remapped) */
+   /* _mesa_function_pool[33617]: IsQuery (will be remapped) */
    "i\0"
    "glIsQuery\0"
    "glIsQueryARB\0"
    "glIsQueryEXT\0"
    "\0"
-   /* _mesa_function_pool[33623]: EdgeFlagPointerEXT (will be remapped) */
+   /* _mesa_function_pool[33656]: EdgeFlagPointerEXT (will be remapped) */
    "iip\0"
    "glEdgeFlagPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[33649]: VertexAttribs2svNV (will be remapped) */
+   /* _mesa_function_pool[33682]: VertexAttribs2svNV (will be remapped) */
    "iip\0"
    "glVertexAttribs2svNV\0"
    "\0"
-   /* _mesa_function_pool[33675]: CreateShaderProgramv (will be remapped) */
+   /* _mesa_function_pool[33708]: CreateShaderProgramv (will be remapped) */
    "iip\0"
    "glCreateShaderProgramv\0"
    "glCreateShaderProgramvEXT\0"
    "\0"
-   /* _mesa_function_pool[33729]: BlendEquationiARB (will be remapped) */
+   /* _mesa_function_pool[33762]: BlendEquationiARB (will be remapped) */
    "ii\0"
    "glBlendEquationiARB\0"
    "glBlendEquationIndexedAMD\0"
@@ -4531,2704 +4535,2704 @@ static const char _mesa_function_pool[] =
    "glBlendEquationiEXT\0"
    "glBlendEquationiOES\0"
    "\0"
-   /* _mesa_function_pool[33836]: VertexAttribI4uivEXT (will be remapped) */
+   /* _mesa_function_pool[33869]: VertexAttribI4uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI4uivEXT\0"
    "glVertexAttribI4uiv\0"
    "\0"
-   /* _mesa_function_pool[33883]: PointSizex (will be remapped) */
+   /* _mesa_function_pool[33916]: PointSizex (will be remapped) */
    "i\0"
    "glPointSizexOES\0"
    "glPointSizex\0"
    "\0"
-   /* _mesa_function_pool[33915]: PolygonMode (offset 174) */
+   /* _mesa_function_pool[33948]: PolygonMode (offset 174) */
    "ii\0"
    "glPolygonMode\0"
    "\0"
-   /* _mesa_function_pool[33933]: SecondaryColor3iv (will be remapped) */
+   /* _mesa_function_pool[33966]: SecondaryColor3iv (will be remapped) */
    "p\0"
    "glSecondaryColor3iv\0"
    "glSecondaryColor3ivEXT\0"
    "\0"
-   /* _mesa_function_pool[33979]: VertexAttribI1iEXT (will be remapped) */
+   /* _mesa_function_pool[34012]: VertexAttribI1iEXT (will be remapped) */
    "ii\0"
    "glVertexAttribI1iEXT\0"
    "glVertexAttribI1i\0"
    "\0"
-   /* _mesa_function_pool[34022]: VertexAttrib4Niv (will be remapped) */
+   /* _mesa_function_pool[34055]: VertexAttrib4Niv (will be remapped) */
    "ip\0"
    "glVertexAttrib4Niv\0"
    "glVertexAttrib4NivARB\0"
    "\0"
-   /* _mesa_function_pool[34067]: GetMapAttribParameterivNV (dynamic) */
+   /* _mesa_function_pool[34100]: GetMapAttribParameterivNV (dynamic) */
    "iiip\0"
    "glGetMapAttribParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[34101]: GetnUniformdvARB (will be remapped) */
+   /* _mesa_function_pool[34134]: GetnUniformdvARB (will be remapped) */
    "iiip\0"
    "glGetnUniformdvARB\0"
    "\0"
-   /* _mesa_function_pool[34126]: LinkProgram (will be remapped) */
+   /* _mesa_function_pool[34159]: LinkProgram (will be remapped) */
    "i\0"
    "glLinkProgram\0"
    "glLinkProgramARB\0"
    "\0"
-   /* _mesa_function_pool[34160]: ProgramUniform4d (will be remapped) */
+   /* _mesa_function_pool[34193]: ProgramUniform4d (will be remapped) */
    "iidddd\0"
    "glProgramUniform4d\0"
    "\0"
-   /* _mesa_function_pool[34187]: ProgramUniform4f (will be remapped) */
+   /* _mesa_function_pool[34220]: ProgramUniform4f (will be remapped) */
    "iiffff\0"
    "glProgramUniform4f\0"
    "glProgramUniform4fEXT\0"
    "\0"
-   /* _mesa_function_pool[34236]: ProgramUniform4i (will be remapped) */
+   /* _mesa_function_pool[34269]: ProgramUniform4i (will be remapped) */
    "iiiiii\0"
    "glProgramUniform4i\0"
    "glProgramUniform4iEXT\0"
    "\0"
-   /* _mesa_function_pool[34285]: GetFramebufferParameteriv (will be remapped) */
+   /* _mesa_function_pool[34318]: GetFramebufferParameteriv (will be remapped) */
    "iip\0"
    "glGetFramebufferParameteriv\0"
    "\0"
-   /* _mesa_function_pool[34318]: ListParameterfvSGIX (dynamic) */
+   /* _mesa_function_pool[34351]: ListParameterfvSGIX (dynamic) */
    "iip\0"
    "glListParameterfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[34345]: GetNamedBufferPointerv (will be remapped) */
+   /* _mesa_function_pool[34378]: GetNamedBufferPointerv (will be remapped) */
    "iip\0"
    "glGetNamedBufferPointerv\0"
    "\0"
-   /* _mesa_function_pool[34375]: VertexAttrib4d (will be remapped) */
+   /* _mesa_function_pool[34408]: VertexAttrib4d (will be remapped) */
    "idddd\0"
    "glVertexAttrib4d\0"
    "glVertexAttrib4dARB\0"
    "\0"
-   /* _mesa_function_pool[34419]: ProgramUniform4ui64vARB (will be remapped) */
+   /* _mesa_function_pool[34452]: ProgramUniform4ui64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniform4ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[34451]: WindowPos4sMESA (will be remapped) */
+   /* _mesa_function_pool[34484]: WindowPos4sMESA (will be remapped) */
    "iiii\0"
    "glWindowPos4sMESA\0"
    "\0"
-   /* _mesa_function_pool[34475]: VertexAttrib4s (will be remapped) */
+   /* _mesa_function_pool[34508]: VertexAttrib4s (will be remapped) */
    "iiiii\0"
    "glVertexAttrib4s\0"
    "glVertexAttrib4sARB\0"
    "\0"
-   /* _mesa_function_pool[34519]: ProgramUniform1i64vARB (will be remapped) */
+   /* _mesa_function_pool[34552]: ProgramUniform1i64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniform1i64vARB\0"
    "\0"
-   /* _mesa_function_pool[34550]: VertexAttrib1dvNV (will be remapped) */
+   /* _mesa_function_pool[34583]: VertexAttrib1dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib1dvNV\0"
    "\0"
-   /* _mesa_function_pool[34574]: ReplacementCodePointerSUN (dynamic) */
+   /* _mesa_function_pool[34607]: ReplacementCodePointerSUN (dynamic) */
    "iip\0"
    "glReplacementCodePointerSUN\0"
    "\0"
-   /* _mesa_function_pool[34607]: GetSemaphoreParameterui64vEXT (will be remapped) */
+   /* _mesa_function_pool[34640]: GetSemaphoreParameterui64vEXT (will be remapped) */
    "iip\0"
    "glGetSemaphoreParameterui64vEXT\0"
    "\0"
-   /* _mesa_function_pool[34644]: TexStorage3DMultisample (will be remapped) */
+   /* _mesa_function_pool[34677]: TexStorage3DMultisample (will be remapped) */
    "iiiiiii\0"
    "glTexStorage3DMultisample\0"
    "glTexStorage3DMultisampleOES\0"
    "\0"
-   /* _mesa_function_pool[34708]: Binormal3bvEXT (dynamic) */
+   /* _mesa_function_pool[34741]: Binormal3bvEXT (dynamic) */
    "p\0"
    "glBinormal3bvEXT\0"
    "\0"
-   /* _mesa_function_pool[34728]: SamplerParameteriv (will be remapped) */
+   /* _mesa_function_pool[34761]: SamplerParameteriv (will be remapped) */
    "iip\0"
    "glSamplerParameteriv\0"
    "\0"
-   /* _mesa_function_pool[34754]: VertexAttribP3uiv (will be remapped) */
+   /* _mesa_function_pool[34787]: VertexAttribP3uiv (will be remapped) */
    "iiip\0"
    "glVertexAttribP3uiv\0"
    "\0"
-   /* _mesa_function_pool[34780]: ScissorIndexedv (will be remapped) */
+   /* _mesa_function_pool[34813]: ScissorIndexedv (will be remapped) */
    "ip\0"
    "glScissorIndexedv\0"
    "glScissorIndexedvOES\0"
    "\0"
-   /* _mesa_function_pool[34823]: Color4ubVertex2fSUN (dynamic) */
+   /* _mesa_function_pool[34856]: Color4ubVertex2fSUN (dynamic) */
    "iiiiff\0"
    "glColor4ubVertex2fSUN\0"
    "\0"
-   /* _mesa_function_pool[34853]: FragmentColorMaterialSGIX (dynamic) */
+   /* _mesa_function_pool[34886]: FragmentColorMaterialSGIX (dynamic) */
    "ii\0"
    "glFragmentColorMaterialSGIX\0"
    "\0"
-   /* _mesa_function_pool[34885]: GetStringi (will be remapped) */
+   /* _mesa_function_pool[34918]: GetStringi (will be remapped) */
    "ii\0"
    "glGetStringi\0"
    "\0"
-   /* _mesa_function_pool[34902]: Uniform2dv (will be remapped) */
+   /* _mesa_function_pool[34935]: Uniform2dv (will be remapped) */
    "iip\0"
    "glUniform2dv\0"
    "\0"
-   /* _mesa_function_pool[34920]: VertexAttrib4dv (will be remapped) */
+   /* _mesa_function_pool[34953]: VertexAttrib4dv (will be remapped) */
    "ip\0"
    "glVertexAttrib4dv\0"
    "glVertexAttrib4dvARB\0"
    "\0"
-   /* _mesa_function_pool[34963]: CreateTextures (will be remapped) */
+   /* _mesa_function_pool[34996]: CreateTextures (will be remapped) */
    "iip\0"
    "glCreateTextures\0"
    "\0"
-   /* _mesa_function_pool[34985]: EvalCoord2dv (offset 233) */
+   /* _mesa_function_pool[35018]: EvalCoord2dv (offset 233) */
    "p\0"
    "glEvalCoord2dv\0"
    "\0"
-   /* _mesa_function_pool[35003]: VertexAttrib1fNV (will be remapped) */
+   /* _mesa_function_pool[35036]: VertexAttrib1fNV (will be remapped) */
    "if\0"
    "glVertexAttrib1fNV\0"
    "\0"
-   /* _mesa_function_pool[35026]: CompressedTexSubImage1D (will be remapped) */
+   /* _mesa_function_pool[35059]: CompressedTexSubImage1D (will be remapped) */
    "iiiiiip\0"
    "glCompressedTexSubImage1D\0"
    "glCompressedTexSubImage1DARB\0"
    "\0"
-   /* _mesa_function_pool[35090]: GetSeparableFilter (offset 359) */
+   /* _mesa_function_pool[35123]: GetSeparableFilter (offset 359) */
    "iiippp\0"
    "glGetSeparableFilter\0"
    "glGetSeparableFilterEXT\0"
    "\0"
-   /* _mesa_function_pool[35143]: ReplacementCodeusSUN (dynamic) */
+   /* _mesa_function_pool[35176]: ReplacementCodeusSUN (dynamic) */
    "i\0"
    "glReplacementCodeusSUN\0"
    "\0"
-   /* _mesa_function_pool[35169]: FeedbackBuffer (offset 194) */
+   /* _mesa_function_pool[35202]: FeedbackBuffer (offset 194) */
    "iip\0"
    "glFeedbackBuffer\0"
    "\0"
-   /* _mesa_function_pool[35191]: RasterPos2iv (offset 67) */
+   /* _mesa_function_pool[35224]: RasterPos2iv (offset 67) */
    "p\0"
    "glRasterPos2iv\0"
    "\0"
-   /* _mesa_function_pool[35209]: TexImage1D (offset 182) */
+   /* _mesa_function_pool[35242]: TexImage1D (offset 182) */
    "iiiiiiip\0"
    "glTexImage1D\0"
    "\0"
-   /* _mesa_function_pool[35232]: MultiDrawElementsEXT (will be remapped) */
+   /* _mesa_function_pool[35265]: MultiDrawElementsEXT (will be remapped) */
    "ipipi\0"
    "glMultiDrawElements\0"
    "glMultiDrawElementsEXT\0"
    "\0"
-   /* _mesa_function_pool[35282]: GetnSeparableFilterARB (will be remapped) */
+   /* _mesa_function_pool[35315]: GetnSeparableFilterARB (will be remapped) */
    "iiiipipp\0"
    "glGetnSeparableFilterARB\0"
    "\0"
-   /* _mesa_function_pool[35317]: FrontFace (offset 157) */
+   /* _mesa_function_pool[35350]: FrontFace (offset 157) */
    "i\0"
    "glFrontFace\0"
    "\0"
-   /* _mesa_function_pool[35332]: MultiModeDrawArraysIBM (will be remapped) */
+   /* _mesa_function_pool[35365]: MultiModeDrawArraysIBM (will be remapped) */
    "pppii\0"
    "glMultiModeDrawArraysIBM\0"
    "\0"
-   /* _mesa_function_pool[35364]: Tangent3ivEXT (dynamic) */
+   /* _mesa_function_pool[35397]: Tangent3ivEXT (dynamic) */
    "p\0"
    "glTangent3ivEXT\0"
    "\0"
-   /* _mesa_function_pool[35383]: LightEnviSGIX (dynamic) */
+   /* _mesa_function_pool[35416]: LightEnviSGIX (dynamic) */
    "ii\0"
    "glLightEnviSGIX\0"
    "\0"
-   /* _mesa_function_pool[35403]: Normal3dv (offset 55) */
+   /* _mesa_function_pool[35436]: Normal3dv (offset 55) */
    "p\0"
    "glNormal3dv\0"
    "\0"
-   /* _mesa_function_pool[35418]: Lightf (offset 159) */
+   /* _mesa_function_pool[35451]: Lightf (offset 159) */
    "iif\0"
    "glLightf\0"
    "\0"
-   /* _mesa_function_pool[35432]: MatrixMode (offset 293) */
+   /* _mesa_function_pool[35465]: MatrixMode (offset 293) */
    "i\0"
    "glMatrixMode\0"
    "\0"
-   /* _mesa_function_pool[35448]: GetPixelMapusv (offset 273) */
+   /* _mesa_function_pool[35481]: GetPixelMapusv (offset 273) */
    "ip\0"
    "glGetPixelMapusv\0"
    "\0"
-   /* _mesa_function_pool[35469]: Lighti (offset 161) */
+   /* _mesa_function_pool[35502]: Lighti (offset 161) */
    "iii\0"
    "glLighti\0"
    "\0"
-   /* _mesa_function_pool[35483]: VertexAttribPointerNV (will be remapped) */
+   /* _mesa_function_pool[35516]: VertexAttribPointerNV (will be remapped) */
    "iiiip\0"
    "glVertexAttribPointerNV\0"
    "\0"
-   /* _mesa_function_pool[35514]: GetFragDataIndex (will be remapped) */
+   /* _mesa_function_pool[35547]: GetFragDataIndex (will be remapped) */
    "ip\0"
    "glGetFragDataIndex\0"
    "glGetFragDataIndexEXT\0"
    "\0"
-   /* _mesa_function_pool[35559]: Lightx (will be remapped) */
+   /* _mesa_function_pool[35592]: Lightx (will be remapped) */
    "iii\0"
    "glLightxOES\0"
    "glLightx\0"
    "\0"
-   /* _mesa_function_pool[35585]: ProgramUniform3fv (will be remapped) */
+   /* _mesa_function_pool[35618]: ProgramUniform3fv (will be remapped) */
    "iiip\0"
    "glProgramUniform3fv\0"
    "glProgramUniform3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[35634]: MultMatrixd (offset 295) */
+   /* _mesa_function_pool[35667]: MultMatrixd (offset 295) */
    "p\0"
    "glMultMatrixd\0"
    "\0"
-   /* _mesa_function_pool[35651]: MultMatrixf (offset 294) */
+   /* _mesa_function_pool[35684]: MultMatrixf (offset 294) */
    "p\0"
    "glMultMatrixf\0"
    "\0"
-   /* _mesa_function_pool[35668]: Uniform4ui64vARB (will be remapped) */
+   /* _mesa_function_pool[35701]: Uniform4ui64vARB (will be remapped) */
    "iip\0"
    "glUniform4ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[35692]: MultiTexCoord4fvARB (offset 403) */
+   /* _mesa_function_pool[35725]: MultiTexCoord4fvARB (offset 403) */
    "ip\0"
    "glMultiTexCoord4fv\0"
    "glMultiTexCoord4fvARB\0"
    "\0"
-   /* _mesa_function_pool[35737]: UniformMatrix2x3fv (will be remapped) */
+   /* _mesa_function_pool[35770]: UniformMatrix2x3fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix2x3fv\0"
    "\0"
-   /* _mesa_function_pool[35764]: TrackMatrixNV (will be remapped) */
+   /* _mesa_function_pool[35797]: TrackMatrixNV (will be remapped) */
    "iiii\0"
    "glTrackMatrixNV\0"
    "\0"
-   /* _mesa_function_pool[35786]: SamplerParameterf (will be remapped) */
+   /* _mesa_function_pool[35819]: SamplerParameterf (will be remapped) */
    "iif\0"
    "glSamplerParameterf\0"
    "\0"
-   /* _mesa_function_pool[35811]: UniformMatrix3dv (will be remapped) */
+   /* _mesa_function_pool[35844]: UniformMatrix3dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3dv\0"
    "\0"
-   /* _mesa_function_pool[35836]: PointParameterx (will be remapped) */
+   /* _mesa_function_pool[35869]: PointParameterx (will be remapped) */
    "ii\0"
    "glPointParameterxOES\0"
    "glPointParameterx\0"
    "\0"
-   /* _mesa_function_pool[35879]: DrawArrays (offset 310) */
+   /* _mesa_function_pool[35912]: DrawArrays (offset 310) */
    "iii\0"
    "glDrawArrays\0"
    "glDrawArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[35913]: Uniform3dv (will be remapped) */
+   /* _mesa_function_pool[35946]: Uniform3dv (will be remapped) */
    "iip\0"
    "glUniform3dv\0"
    "\0"
-   /* _mesa_function_pool[35931]: PointParameteri (will be remapped) */
+   /* _mesa_function_pool[35964]: PointParameteri (will be remapped) */
    "ii\0"
    "glPointParameteri\0"
    "glPointParameteriNV\0"
    "\0"
-   /* _mesa_function_pool[35973]: PointParameterf (will be remapped) */
+   /* _mesa_function_pool[36006]: PointParameterf (will be remapped) */
    "if\0"
    "glPointParameterf\0"
    "glPointParameterfARB\0"
    "glPointParameterfEXT\0"
    "glPointParameterfSGIS\0"
    "\0"
-   /* _mesa_function_pool[36059]: GlobalAlphaFactorsSUN (dynamic) */
+   /* _mesa_function_pool[36092]: GlobalAlphaFactorsSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorsSUN\0"
    "\0"
-   /* _mesa_function_pool[36086]: VertexAttribBinding (will be remapped) */
+   /* _mesa_function_pool[36119]: VertexAttribBinding (will be remapped) */
    "ii\0"
    "glVertexAttribBinding\0"
    "\0"
-   /* _mesa_function_pool[36112]: TextureSubImage2D (will be remapped) */
+   /* _mesa_function_pool[36145]: TextureSubImage2D (will be remapped) */
    "iiiiiiiip\0"
    "glTextureSubImage2D\0"
    "\0"
-   /* _mesa_function_pool[36143]: ReplacementCodeuiTexCoord2fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[36176]: ReplacementCodeuiTexCoord2fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glReplacementCodeuiTexCoord2fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[36190]: CreateShader (will be remapped) */
+   /* _mesa_function_pool[36223]: CreateShader (will be remapped) */
    "i\0"
    "glCreateShader\0"
    "\0"
-   /* _mesa_function_pool[36208]: GetProgramParameterdvNV (will be remapped) */
+   /* _mesa_function_pool[36241]: GetProgramParameterdvNV (will be remapped) */
    "iiip\0"
    "glGetProgramParameterdvNV\0"
    "\0"
-   /* _mesa_function_pool[36240]: ProgramUniform1dv (will be remapped) */
+   /* _mesa_function_pool[36273]: ProgramUniform1dv (will be remapped) */
    "iiip\0"
    "glProgramUniform1dv\0"
    "\0"
-   /* _mesa_function_pool[36266]: GetProgramEnvParameterfvARB (will be remapped) */
+   /* _mesa_function_pool[36299]: GetProgramEnvParameterfvARB (will be remapped) */
    "iip\0"
    "glGetProgramEnvParameterfvARB\0"
    "\0"
-   /* _mesa_function_pool[36301]: DeleteBuffers (will be remapped) */
+   /* _mesa_function_pool[36334]: DeleteBuffers (will be remapped) */
    "ip\0"
    "glDeleteBuffers\0"
    "glDeleteBuffersARB\0"
    "\0"
-   /* _mesa_function_pool[36340]: GetBufferSubData (will be remapped) */
+   /* _mesa_function_pool[36373]: GetBufferSubData (will be remapped) */
    "iiip\0"
    "glGetBufferSubData\0"
    "glGetBufferSubDataARB\0"
    "\0"
-   /* _mesa_function_pool[36387]: GetNamedRenderbufferParameteriv (will be remapped) */
+   /* _mesa_function_pool[36420]: GetNamedRenderbufferParameteriv (will be remapped) */
    "iip\0"
    "glGetNamedRenderbufferParameteriv\0"
    "\0"
-   /* _mesa_function_pool[36426]: GetPerfMonitorGroupsAMD (will be remapped) */
+   /* _mesa_function_pool[36459]: GetPerfMonitorGroupsAMD (will be remapped) */
    "pip\0"
    "glGetPerfMonitorGroupsAMD\0"
    "\0"
-   /* _mesa_function_pool[36457]: FlushRasterSGIX (dynamic) */
+   /* _mesa_function_pool[36490]: FlushRasterSGIX (dynamic) */
    "\0"
    "glFlushRasterSGIX\0"
    "\0"
-   /* _mesa_function_pool[36477]: VertexAttribP2ui (will be remapped) */
+   /* _mesa_function_pool[36510]: VertexAttribP2ui (will be remapped) */
    "iiii\0"
    "glVertexAttribP2ui\0"
    "\0"
-   /* _mesa_function_pool[36502]: ProgramUniform4dv (will be remapped) */
+   /* _mesa_function_pool[36535]: ProgramUniform4dv (will be remapped) */
    "iiip\0"
    "glProgramUniform4dv\0"
    "\0"
-   /* _mesa_function_pool[36528]: GetMinmaxParameteriv (offset 366) */
+   /* _mesa_function_pool[36561]: GetMinmaxParameteriv (offset 366) */
    "iip\0"
    "glGetMinmaxParameteriv\0"
    "glGetMinmaxParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[36582]: DrawTexivOES (will be remapped) */
+   /* _mesa_function_pool[36615]: DrawTexivOES (will be remapped) */
    "p\0"
    "glDrawTexivOES\0"
    "\0"
-   /* _mesa_function_pool[36600]: CopyTexImage1D (offset 323) */
+   /* _mesa_function_pool[36633]: CopyTexImage1D (offset 323) */
    "iiiiiii\0"
    "glCopyTexImage1D\0"
    "glCopyTexImage1DEXT\0"
    "\0"
-   /* _mesa_function_pool[36646]: InvalidateNamedFramebufferData (will be remapped) */
+   /* _mesa_function_pool[36679]: InvalidateNamedFramebufferData (will be remapped) */
    "iip\0"
    "glInvalidateNamedFramebufferData\0"
    "\0"
-   /* _mesa_function_pool[36684]: SemaphoreParameterui64vEXT (will be remapped) */
+   /* _mesa_function_pool[36717]: SemaphoreParameterui64vEXT (will be remapped) */
    "iip\0"
    "glSemaphoreParameterui64vEXT\0"
    "\0"
-   /* _mesa_function_pool[36718]: GetnColorTableARB (will be remapped) */
+   /* _mesa_function_pool[36751]: GetnColorTableARB (will be remapped) */
    "iiiip\0"
    "glGetnColorTableARB\0"
    "\0"
-   /* _mesa_function_pool[36745]: VertexAttribFormat (will be remapped) */
+   /* _mesa_function_pool[36778]: VertexAttribFormat (will be remapped) */
    "iiiii\0"
    "glVertexAttribFormat\0"
    "\0"
-   /* _mesa_function_pool[36773]: Vertex3i (offset 138) */
+   /* _mesa_function_pool[36806]: Vertex3i (offset 138) */
    "iii\0"
    "glVertex3i\0"
    "\0"
-   /* _mesa_function_pool[36789]: Vertex3f (offset 136) */
+   /* _mesa_function_pool[36822]: Vertex3f (offset 136) */
    "fff\0"
    "glVertex3f\0"
    "\0"
-   /* _mesa_function_pool[36805]: Vertex3d (offset 134) */
+   /* _mesa_function_pool[36838]: Vertex3d (offset 134) */
    "ddd\0"
    "glVertex3d\0"
    "\0"
-   /* _mesa_function_pool[36821]: GetProgramPipelineiv (will be remapped) */
+   /* _mesa_function_pool[36854]: GetProgramPipelineiv (will be remapped) */
    "iip\0"
    "glGetProgramPipelineiv\0"
    "glGetProgramPipelineivEXT\0"
    "\0"
-   /* _mesa_function_pool[36875]: ReadBuffer (offset 254) */
+   /* _mesa_function_pool[36908]: ReadBuffer (offset 254) */
    "i\0"
    "glReadBuffer\0"
    "glReadBufferNV\0"
    "\0"
-   /* _mesa_function_pool[36906]: ConvolutionParameteri (offset 352) */
+   /* _mesa_function_pool[36939]: ConvolutionParameteri (offset 352) */
    "iii\0"
    "glConvolutionParameteri\0"
    "glConvolutionParameteriEXT\0"
    "\0"
-   /* _mesa_function_pool[36962]: GetTexParameterIiv (will be remapped) */
+   /* _mesa_function_pool[36995]: GetTexParameterIiv (will be remapped) */
    "iip\0"
    "glGetTexParameterIivEXT\0"
    "glGetTexParameterIiv\0"
    "glGetTexParameterIivOES\0"
    "\0"
-   /* _mesa_function_pool[37036]: Vertex3s (offset 140) */
+   /* _mesa_function_pool[37069]: Vertex3s (offset 140) */
    "iii\0"
    "glVertex3s\0"
    "\0"
-   /* _mesa_function_pool[37052]: ConvolutionParameterf (offset 350) */
+   /* _mesa_function_pool[37085]: ConvolutionParameterf (offset 350) */
    "iif\0"
    "glConvolutionParameterf\0"
    "glConvolutionParameterfEXT\0"
    "\0"
-   /* _mesa_function_pool[37108]: GetColorTableParameteriv (offset 345) */
+   /* _mesa_function_pool[37141]: GetColorTableParameteriv (offset 345) */
    "iip\0"
    "glGetColorTableParameteriv\0"
    "glGetColorTableParameterivSGI\0"
    "glGetColorTableParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[37200]: GetTransformFeedbackVarying (will be remapped) */
+   /* _mesa_function_pool[37233]: GetTransformFeedbackVarying (will be remapped) */
    "iiipppp\0"
    "glGetTransformFeedbackVarying\0"
    "glGetTransformFeedbackVaryingEXT\0"
    "\0"
-   /* _mesa_function_pool[37272]: GetNextPerfQueryIdINTEL (will be remapped) */
+   /* _mesa_function_pool[37305]: GetNextPerfQueryIdINTEL (will be remapped) */
    "ip\0"
    "glGetNextPerfQueryIdINTEL\0"
    "\0"
-   /* _mesa_function_pool[37302]: TexCoord3fv (offset 113) */
+   /* _mesa_function_pool[37335]: TexCoord3fv (offset 113) */
    "p\0"
    "glTexCoord3fv\0"
    "\0"
-   /* _mesa_function_pool[37319]: TextureBarrierNV (will be remapped) */
+   /* _mesa_function_pool[37352]: TextureBarrierNV (will be remapped) */
    "\0"
    "glTextureBarrier\0"
    "glTextureBarrierNV\0"
    "\0"
-   /* _mesa_function_pool[37357]: GetProgramInterfaceiv (will be remapped) */
+   /* _mesa_function_pool[37390]: GetProgramInterfaceiv (will be remapped) */
    "iiip\0"
    "glGetProgramInterfaceiv\0"
    "\0"
-   /* _mesa_function_pool[37387]: ReplacementCodeuiColor4fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[37420]: ReplacementCodeuiColor4fNormal3fVertex3fSUN (dynamic) */
    "iffffffffff\0"
    "glReplacementCodeuiColor4fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[37446]: VertexAttribL1ui64vARB (will be remapped) */
+   /* _mesa_function_pool[37479]: VertexAttribL1ui64vARB (will be remapped) */
    "ip\0"
    "glVertexAttribL1ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[37475]: ProgramLocalParameter4fARB (will be remapped) */
+   /* _mesa_function_pool[37508]: ProgramLocalParameter4fARB (will be remapped) */
    "iiffff\0"
    "glProgramLocalParameter4fARB\0"
    "\0"
-   /* _mesa_function_pool[37512]: PauseTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[37545]: PauseTransformFeedback (will be remapped) */
    "\0"
    "glPauseTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[37539]: DeleteShader (will be remapped) */
+   /* _mesa_function_pool[37572]: DeleteShader (will be remapped) */
    "i\0"
    "glDeleteShader\0"
    "\0"
-   /* _mesa_function_pool[37557]: NamedFramebufferRenderbuffer (will be remapped) */
+   /* _mesa_function_pool[37590]: NamedFramebufferRenderbuffer (will be remapped) */
    "iiii\0"
    "glNamedFramebufferRenderbuffer\0"
    "\0"
-   /* _mesa_function_pool[37594]: CompileShader (will be remapped) */
+   /* _mesa_function_pool[37627]: CompileShader (will be remapped) */
    "i\0"
    "glCompileShader\0"
    "glCompileShaderARB\0"
    "\0"
-   /* _mesa_function_pool[37632]: Vertex2iv (offset 131) */
+   /* _mesa_function_pool[37665]: Vertex2iv (offset 131) */
    "p\0"
    "glVertex2iv\0"
    "\0"
-   /* _mesa_function_pool[37647]: GetVertexArrayIndexediv (will be remapped) */
+   /* _mesa_function_pool[37680]: GetVertexArrayIndexediv (will be remapped) */
    "iiip\0"
    "glGetVertexArrayIndexediv\0"
    "\0"
-   /* _mesa_function_pool[37679]: TexParameterIiv (will be remapped) */
+   /* _mesa_function_pool[37712]: TexParameterIiv (will be remapped) */
    "iip\0"
    "glTexParameterIivEXT\0"
    "glTexParameterIiv\0"
    "glTexParameterIivOES\0"
    "\0"
-   /* _mesa_function_pool[37744]: TexGendv (offset 189) */
+   /* _mesa_function_pool[37777]: TexGendv (offset 189) */
    "iip\0"
    "glTexGendv\0"
    "\0"
-   /* _mesa_function_pool[37760]: TextureLightEXT (dynamic) */
+   /* _mesa_function_pool[37793]: TextureLightEXT (dynamic) */
    "i\0"
    "glTextureLightEXT\0"
    "\0"
-   /* _mesa_function_pool[37781]: ResetMinmax (offset 370) */
+   /* _mesa_function_pool[37814]: ResetMinmax (offset 370) */
    "i\0"
    "glResetMinmax\0"
    "glResetMinmaxEXT\0"
    "\0"
-   /* _mesa_function_pool[37815]: SampleCoverage (will be remapped) */
+   /* _mesa_function_pool[37848]: SampleCoverage (will be remapped) */
    "fi\0"
    "glSampleCoverage\0"
    "glSampleCoverageARB\0"
    "\0"
-   /* _mesa_function_pool[37856]: SpriteParameterfSGIX (dynamic) */
+   /* _mesa_function_pool[37889]: SpriteParameterfSGIX (dynamic) */
    "if\0"
    "glSpriteParameterfSGIX\0"
    "\0"
-   /* _mesa_function_pool[37883]: GenerateTextureMipmap (will be remapped) */
+   /* _mesa_function_pool[37916]: GenerateTextureMipmap (will be remapped) */
    "i\0"
    "glGenerateTextureMipmap\0"
    "\0"
-   /* _mesa_function_pool[37910]: DeleteProgramsARB (will be remapped) */
+   /* _mesa_function_pool[37943]: DeleteProgramsARB (will be remapped) */
    "ip\0"
    "glDeleteProgramsARB\0"
    "glDeleteProgramsNV\0"
    "\0"
-   /* _mesa_function_pool[37953]: ShadeModel (offset 177) */
+   /* _mesa_function_pool[37986]: ShadeModel (offset 177) */
    "i\0"
    "glShadeModel\0"
    "\0"
-   /* _mesa_function_pool[37969]: CreateQueries (will be remapped) */
+   /* _mesa_function_pool[38002]: CreateQueries (will be remapped) */
    "iip\0"
    "glCreateQueries\0"
    "\0"
-   /* _mesa_function_pool[37990]: FogFuncSGIS (dynamic) */
+   /* _mesa_function_pool[38023]: FogFuncSGIS (dynamic) */
    "ip\0"
    "glFogFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[38008]: TexCoord4fVertex4fSUN (dynamic) */
+   /* _mesa_function_pool[38041]: TexCoord4fVertex4fSUN (dynamic) */
    "ffffffff\0"
    "glTexCoord4fVertex4fSUN\0"
    "\0"
-   /* _mesa_function_pool[38042]: MultiDrawArrays (will be remapped) */
+   /* _mesa_function_pool[38075]: MultiDrawArrays (will be remapped) */
    "ippi\0"
    "glMultiDrawArrays\0"
    "glMultiDrawArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[38087]: GetProgramLocalParameterdvARB (will be remapped) */
+   /* _mesa_function_pool[38120]: GetProgramLocalParameterdvARB (will be remapped) */
    "iip\0"
    "glGetProgramLocalParameterdvARB\0"
    "\0"
-   /* _mesa_function_pool[38124]: BufferParameteriAPPLE (will be remapped) */
+   /* _mesa_function_pool[38157]: BufferParameteriAPPLE (will be remapped) */
    "iii\0"
    "glBufferParameteriAPPLE\0"
    "\0"
-   /* _mesa_function_pool[38153]: MapBufferRange (will be remapped) */
+   /* _mesa_function_pool[38186]: MapBufferRange (will be remapped) */
    "iiii\0"
    "glMapBufferRange\0"
    "glMapBufferRangeEXT\0"
    "\0"
-   /* _mesa_function_pool[38196]: DispatchCompute (will be remapped) */
+   /* _mesa_function_pool[38229]: DispatchCompute (will be remapped) */
    "iii\0"
    "glDispatchCompute\0"
    "\0"
-   /* _mesa_function_pool[38219]: UseProgramStages (will be remapped) */
+   /* _mesa_function_pool[38252]: UseProgramStages (will be remapped) */
    "iii\0"
    "glUseProgramStages\0"
    "glUseProgramStagesEXT\0"
    "\0"
-   /* _mesa_function_pool[38265]: ProgramUniformMatrix4fv (will be remapped) */
+   /* _mesa_function_pool[38298]: ProgramUniformMatrix4fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix4fv\0"
    "glProgramUniformMatrix4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[38327]: FinishAsyncSGIX (dynamic) */
+   /* _mesa_function_pool[38360]: FinishAsyncSGIX (dynamic) */
    "p\0"
    "glFinishAsyncSGIX\0"
    "\0"
-   /* _mesa_function_pool[38348]: FramebufferRenderbuffer (will be remapped) */
+   /* _mesa_function_pool[38381]: FramebufferRenderbuffer (will be remapped) */
    "iiii\0"
    "glFramebufferRenderbuffer\0"
    "glFramebufferRenderbufferEXT\0"
    "glFramebufferRenderbufferOES\0"
    "\0"
-   /* _mesa_function_pool[38438]: IsProgramARB (will be remapped) */
+   /* _mesa_function_pool[38471]: IsProgramARB (will be remapped) */
    "i\0"
    "glIsProgramARB\0"
    "glIsProgramNV\0"
    "\0"
-   /* _mesa_function_pool[38470]: Map2d (offset 222) */
+   /* _mesa_function_pool[38503]: Map2d (offset 222) */
    "iddiiddiip\0"
    "glMap2d\0"
    "\0"
-   /* _mesa_function_pool[38490]: Map2f (offset 223) */
+   /* _mesa_function_pool[38523]: Map2f (offset 223) */
    "iffiiffiip\0"
    "glMap2f\0"
    "\0"
-   /* _mesa_function_pool[38510]: ProgramStringARB (will be remapped) */
+   /* _mesa_function_pool[38543]: ProgramStringARB (will be remapped) */
    "iiip\0"
    "glProgramStringARB\0"
    "\0"
-   /* _mesa_function_pool[38535]: CopyTextureSubImage2D (will be remapped) */
+   /* _mesa_function_pool[38568]: CopyTextureSubImage2D (will be remapped) */
    "iiiiiiii\0"
    "glCopyTextureSubImage2D\0"
    "\0"
-   /* _mesa_function_pool[38569]: MultiTexCoord4s (offset 406) */
+   /* _mesa_function_pool[38602]: MultiTexCoord4s (offset 406) */
    "iiiii\0"
    "glMultiTexCoord4s\0"
    "glMultiTexCoord4sARB\0"
    "\0"
-   /* _mesa_function_pool[38615]: ViewportIndexedf (will be remapped) */
+   /* _mesa_function_pool[38648]: ViewportIndexedf (will be remapped) */
    "iffff\0"
    "glViewportIndexedf\0"
    "glViewportIndexedfOES\0"
    "\0"
-   /* _mesa_function_pool[38663]: MultiTexCoord4i (offset 404) */
+   /* _mesa_function_pool[38696]: MultiTexCoord4i (offset 404) */
    "iiiii\0"
    "glMultiTexCoord4i\0"
    "glMultiTexCoord4iARB\0"
    "\0"
-   /* _mesa_function_pool[38709]: ApplyTextureEXT (dynamic) */
+   /* _mesa_function_pool[38742]: ApplyTextureEXT (dynamic) */
    "i\0"
    "glApplyTextureEXT\0"
    "\0"
-   /* _mesa_function_pool[38730]: DebugMessageControl (will be remapped) */
+   /* _mesa_function_pool[38763]: DebugMessageControl (will be remapped) */
    "iiiipi\0"
    "glDebugMessageControlARB\0"
    "glDebugMessageControl\0"
    "glDebugMessageControlKHR\0"
    "\0"
-   /* _mesa_function_pool[38810]: MultiTexCoord4d (offset 400) */
+   /* _mesa_function_pool[38843]: MultiTexCoord4d (offset 400) */
    "idddd\0"
    "glMultiTexCoord4d\0"
    "glMultiTexCoord4dARB\0"
    "\0"
-   /* _mesa_function_pool[38856]: GetHistogram (offset 361) */
+   /* _mesa_function_pool[38889]: GetHistogram (offset 361) */
    "iiiip\0"
    "glGetHistogram\0"
    "glGetHistogramEXT\0"
    "\0"
-   /* _mesa_function_pool[38896]: Translatex (will be remapped) */
+   /* _mesa_function_pool[38929]: Translatex (will be remapped) */
    "iii\0"
    "glTranslatexOES\0"
    "glTranslatex\0"
    "\0"
-   /* _mesa_function_pool[38930]: MultiDrawElementsIndirectCountARB (will be remapped) */
+   /* _mesa_function_pool[38963]: MultiDrawElementsIndirectCountARB (will be remapped) */
    "iiiiii\0"
    "glMultiDrawElementsIndirectCountARB\0"
    "glMultiDrawElementsIndirectCount\0"
    "\0"
-   /* _mesa_function_pool[39007]: IglooInterfaceSGIX (dynamic) */
+   /* _mesa_function_pool[39040]: IglooInterfaceSGIX (dynamic) */
    "ip\0"
    "glIglooInterfaceSGIX\0"
    "\0"
-   /* _mesa_function_pool[39032]: Indexsv (offset 51) */
+   /* _mesa_function_pool[39065]: Indexsv (offset 51) */
    "p\0"
    "glIndexsv\0"
    "\0"
-   /* _mesa_function_pool[39045]: VertexAttrib1fvARB (will be remapped) */
+   /* _mesa_function_pool[39078]: VertexAttrib1fvARB (will be remapped) */
    "ip\0"
    "glVertexAttrib1fv\0"
    "glVertexAttrib1fvARB\0"
    "\0"
-   /* _mesa_function_pool[39088]: TexCoord2dv (offset 103) */
+   /* _mesa_function_pool[39121]: TexCoord2dv (offset 103) */
    "p\0"
    "glTexCoord2dv\0"
    "\0"
-   /* _mesa_function_pool[39105]: GetDetailTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[39138]: GetDetailTexFuncSGIS (dynamic) */
    "ip\0"
    "glGetDetailTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[39132]: Translated (offset 303) */
+   /* _mesa_function_pool[39165]: Translated (offset 303) */
    "ddd\0"
    "glTranslated\0"
    "\0"
-   /* _mesa_function_pool[39150]: Translatef (offset 304) */
+   /* _mesa_function_pool[39183]: Translatef (offset 304) */
    "fff\0"
    "glTranslatef\0"
    "\0"
-   /* _mesa_function_pool[39168]: MultTransposeMatrixd (will be remapped) */
+   /* _mesa_function_pool[39201]: MultTransposeMatrixd (will be remapped) */
    "p\0"
    "glMultTransposeMatrixd\0"
    "glMultTransposeMatrixdARB\0"
    "\0"
-   /* _mesa_function_pool[39220]: ProgramUniform4uiv (will be remapped) */
+   /* _mesa_function_pool[39253]: ProgramUniform4uiv (will be remapped) */
    "iiip\0"
    "glProgramUniform4uiv\0"
    "glProgramUniform4uivEXT\0"
    "\0"
-   /* _mesa_function_pool[39271]: GetPerfCounterInfoINTEL (will be remapped) */
+   /* _mesa_function_pool[39304]: GetPerfCounterInfoINTEL (will be remapped) */
    "iiipipppppp\0"
    "glGetPerfCounterInfoINTEL\0"
    "\0"
-   /* _mesa_function_pool[39310]: RenderMode (offset 196) */
+   /* _mesa_function_pool[39343]: RenderMode (offset 196) */
    "i\0"
    "glRenderMode\0"
    "\0"
-   /* _mesa_function_pool[39326]: MultiTexCoord1fARB (offset 378) */
+   /* _mesa_function_pool[39359]: MultiTexCoord1fARB (offset 378) */
    "if\0"
    "glMultiTexCoord1f\0"
    "glMultiTexCoord1fARB\0"
    "\0"
-   /* _mesa_function_pool[39369]: SecondaryColor3d (will be remapped) */
+   /* _mesa_function_pool[39402]: SecondaryColor3d (will be remapped) */
    "ddd\0"
    "glSecondaryColor3d\0"
    "glSecondaryColor3dEXT\0"
    "\0"
-   /* _mesa_function_pool[39415]: FramebufferParameteri (will be remapped) */
+   /* _mesa_function_pool[39448]: FramebufferParameteri (will be remapped) */
    "iii\0"
    "glFramebufferParameteri\0"
    "\0"
-   /* _mesa_function_pool[39444]: VertexAttribs4ubvNV (will be remapped) */
+   /* _mesa_function_pool[39477]: VertexAttribs4ubvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs4ubvNV\0"
    "\0"
-   /* _mesa_function_pool[39471]: WeightsvARB (dynamic) */
+   /* _mesa_function_pool[39504]: WeightsvARB (dynamic) */
    "ip\0"
    "glWeightsvARB\0"
    "\0"
-   /* _mesa_function_pool[39489]: LightModelxv (will be remapped) */
+   /* _mesa_function_pool[39522]: LightModelxv (will be remapped) */
    "ip\0"
    "glLightModelxvOES\0"
    "glLightModelxv\0"
    "\0"
-   /* _mesa_function_pool[39526]: CopyTexSubImage1D (offset 325) */
+   /* _mesa_function_pool[39559]: CopyTexSubImage1D (offset 325) */
    "iiiiii\0"
    "glCopyTexSubImage1D\0"
    "glCopyTexSubImage1DEXT\0"
    "\0"
-   /* _mesa_function_pool[39577]: TextureSubImage3D (will be remapped) */
+   /* _mesa_function_pool[39610]: TextureSubImage3D (will be remapped) */
    "iiiiiiiiiip\0"
    "glTextureSubImage3D\0"
    "\0"
-   /* _mesa_function_pool[39610]: StencilFunc (offset 243) */
+   /* _mesa_function_pool[39643]: StencilFunc (offset 243) */
    "iii\0"
    "glStencilFunc\0"
    "\0"
-   /* _mesa_function_pool[39629]: CopyPixels (offset 255) */
+   /* _mesa_function_pool[39662]: CopyPixels (offset 255) */
    "iiiii\0"
    "glCopyPixels\0"
    "\0"
-   /* _mesa_function_pool[39649]: TexGenxvOES (will be remapped) */
+   /* _mesa_function_pool[39682]: TexGenxvOES (will be remapped) */
    "iip\0"
    "glTexGenxvOES\0"
    "\0"
-   /* _mesa_function_pool[39668]: GetTextureLevelParameterfv (will be remapped) */
+   /* _mesa_function_pool[39701]: GetTextureLevelParameterfv (will be remapped) */
    "iiip\0"
    "glGetTextureLevelParameterfv\0"
    "\0"
-   /* _mesa_function_pool[39703]: VertexAttrib4Nubv (will be remapped) */
+   /* _mesa_function_pool[39736]: VertexAttrib4Nubv (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nubv\0"
    "glVertexAttrib4NubvARB\0"
    "\0"
-   /* _mesa_function_pool[39750]: GetFogFuncSGIS (dynamic) */
+   /* _mesa_function_pool[39783]: GetFogFuncSGIS (dynamic) */
    "p\0"
    "glGetFogFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[39770]: UniformMatrix4x2dv (will be remapped) */
+   /* _mesa_function_pool[39803]: UniformMatrix4x2dv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4x2dv\0"
    "\0"
-   /* _mesa_function_pool[39797]: VertexAttribPointer (will be remapped) */
+   /* _mesa_function_pool[39830]: VertexAttribPointer (will be remapped) */
    "iiiiip\0"
    "glVertexAttribPointer\0"
    "glVertexAttribPointerARB\0"
    "\0"
-   /* _mesa_function_pool[39852]: IndexMask (offset 212) */
+   /* _mesa_function_pool[39885]: IndexMask (offset 212) */
    "i\0"
    "glIndexMask\0"
    "\0"
-   /* _mesa_function_pool[39867]: SharpenTexFuncSGIS (dynamic) */
+   /* _mesa_function_pool[39900]: SharpenTexFuncSGIS (dynamic) */
    "iip\0"
    "glSharpenTexFuncSGIS\0"
    "\0"
-   /* _mesa_function_pool[39893]: VertexAttribIFormat (will be remapped) */
+   /* _mesa_function_pool[39926]: VertexAttribIFormat (will be remapped) */
    "iiii\0"
    "glVertexAttribIFormat\0"
    "\0"
-   /* _mesa_function_pool[39921]: CombinerOutputNV (dynamic) */
+   /* _mesa_function_pool[39954]: CombinerOutputNV (dynamic) */
    "iiiiiiiiii\0"
    "glCombinerOutputNV\0"
    "\0"
-   /* _mesa_function_pool[39952]: DrawArraysInstancedBaseInstance (will be remapped) */
+   /* _mesa_function_pool[39985]: DrawArraysInstancedBaseInstance (will be remapped) */
    "iiiii\0"
    "glDrawArraysInstancedBaseInstance\0"
    "glDrawArraysInstancedBaseInstanceEXT\0"
    "\0"
-   /* _mesa_function_pool[40030]: TextureStorageMem3DMultisampleEXT (will be remapped) */
+   /* _mesa_function_pool[40063]: TextureStorageMem3DMultisampleEXT (will be remapped) */
    "iiiiiiiii\0"
    "glTextureStorageMem3DMultisampleEXT\0"
    "\0"
-   /* _mesa_function_pool[40077]: CompressedTextureSubImage3D (will be remapped) */
+   /* _mesa_function_pool[40110]: CompressedTextureSubImage3D (will be remapped) */
    "iiiiiiiiiip\0"
    "glCompressedTextureSubImage3D\0"
    "\0"
-   /* _mesa_function_pool[40120]: PopAttrib (offset 218) */
+   /* _mesa_function_pool[40153]: PopAttrib (offset 218) */
    "\0"
    "glPopAttrib\0"
    "\0"
-   /* _mesa_function_pool[40134]: SamplePatternSGIS (will be remapped) */
+   /* _mesa_function_pool[40167]: SamplePatternSGIS (will be remapped) */
    "i\0"
    "glSamplePatternSGIS\0"
    "glSamplePatternEXT\0"
    "\0"
-   /* _mesa_function_pool[40176]: Uniform3ui (will be remapped) */
+   /* _mesa_function_pool[40209]: Uniform3ui (will be remapped) */
    "iiii\0"
    "glUniform3uiEXT\0"
    "glUniform3ui\0"
    "\0"
-   /* _mesa_function_pool[40211]: DeletePerfMonitorsAMD (will be remapped) */
+   /* _mesa_function_pool[40244]: DeletePerfMonitorsAMD (will be remapped) */
    "ip\0"
    "glDeletePerfMonitorsAMD\0"
    "\0"
-   /* _mesa_function_pool[40239]: Color4dv (offset 28) */
+   /* _mesa_function_pool[40272]: Color4dv (offset 28) */
    "p\0"
    "glColor4dv\0"
    "\0"
-   /* _mesa_function_pool[40253]: AreProgramsResidentNV (will be remapped) */
+   /* _mesa_function_pool[40286]: AreProgramsResidentNV (will be remapped) */
    "ipp\0"
    "glAreProgramsResidentNV\0"
    "\0"
-   /* _mesa_function_pool[40282]: DisableVertexAttribArray (will be remapped) */
+   /* _mesa_function_pool[40315]: DisableVertexAttribArray (will be remapped) */
    "i\0"
    "glDisableVertexAttribArray\0"
    "glDisableVertexAttribArrayARB\0"
    "\0"
-   /* _mesa_function_pool[40342]: ProgramUniformMatrix3x2fv (will be remapped) */
+   /* _mesa_function_pool[40375]: ProgramUniformMatrix3x2fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix3x2fv\0"
    "glProgramUniformMatrix3x2fvEXT\0"
    "\0"
-   /* _mesa_function_pool[40408]: GetDoublei_v (will be remapped) */
+   /* _mesa_function_pool[40441]: GetDoublei_v (will be remapped) */
    "iip\0"
    "glGetDoublei_v\0"
    "\0"
-   /* _mesa_function_pool[40428]: IsTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[40461]: IsTransformFeedback (will be remapped) */
    "i\0"
    "glIsTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[40453]: GetMemoryObjectParameterivEXT (will be remapped) */
+   /* _mesa_function_pool[40486]: GetMemoryObjectParameterivEXT (will be remapped) */
    "iip\0"
    "glGetMemoryObjectParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[40490]: ClipPlanex (will be remapped) */
+   /* _mesa_function_pool[40523]: ClipPlanex (will be remapped) */
    "ip\0"
    "glClipPlanexOES\0"
    "glClipPlanex\0"
    "\0"
-   /* _mesa_function_pool[40523]: ReplacementCodeuiColor3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[40556]: ReplacementCodeuiColor3fVertex3fSUN (dynamic) */
    "iffffff\0"
    "glReplacementCodeuiColor3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[40570]: GetLightfv (offset 264) */
+   /* _mesa_function_pool[40603]: GetLightfv (offset 264) */
    "iip\0"
    "glGetLightfv\0"
    "\0"
-   /* _mesa_function_pool[40588]: ClipPlanef (will be remapped) */
+   /* _mesa_function_pool[40621]: ClipPlanef (will be remapped) */
    "ip\0"
    "glClipPlanefOES\0"
    "glClipPlanef\0"
    "\0"
-   /* _mesa_function_pool[40621]: ProgramUniform1ui (will be remapped) */
+   /* _mesa_function_pool[40654]: ProgramUniform1ui (will be remapped) */
    "iii\0"
    "glProgramUniform1ui\0"
    "glProgramUniform1uiEXT\0"
    "\0"
-   /* _mesa_function_pool[40669]: SecondaryColorPointer (will be remapped) */
+   /* _mesa_function_pool[40702]: SecondaryColorPointer (will be remapped) */
    "iiip\0"
    "glSecondaryColorPointer\0"
    "glSecondaryColorPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[40726]: Tangent3svEXT (dynamic) */
+   /* _mesa_function_pool[40759]: Tangent3svEXT (dynamic) */
    "p\0"
    "glTangent3svEXT\0"
    "\0"
-   /* _mesa_function_pool[40745]: Tangent3iEXT (dynamic) */
+   /* _mesa_function_pool[40778]: Tangent3iEXT (dynamic) */
    "iii\0"
    "glTangent3iEXT\0"
    "\0"
-   /* _mesa_function_pool[40765]: LineStipple (offset 167) */
+   /* _mesa_function_pool[40798]: LineStipple (offset 167) */
    "ii\0"
    "glLineStipple\0"
    "\0"
-   /* _mesa_function_pool[40783]: FragmentLightfSGIX (dynamic) */
+   /* _mesa_function_pool[40816]: FragmentLightfSGIX (dynamic) */
    "iif\0"
    "glFragmentLightfSGIX\0"
    "\0"
-   /* _mesa_function_pool[40809]: BeginFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[40842]: BeginFragmentShaderATI (will be remapped) */
    "\0"
    "glBeginFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[40836]: GenRenderbuffers (will be remapped) */
+   /* _mesa_function_pool[40869]: GenRenderbuffers (will be remapped) */
    "ip\0"
    "glGenRenderbuffers\0"
    "glGenRenderbuffersEXT\0"
    "glGenRenderbuffersOES\0"
    "\0"
-   /* _mesa_function_pool[40903]: GetMinmaxParameterfv (offset 365) */
+   /* _mesa_function_pool[40936]: GetMinmaxParameterfv (offset 365) */
    "iip\0"
    "glGetMinmaxParameterfv\0"
    "glGetMinmaxParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[40957]: TextureStorageMem2DEXT (will be remapped) */
+   /* _mesa_function_pool[40990]: TextureStorageMem2DEXT (will be remapped) */
    "iiiiiii\0"
    "glTextureStorageMem2DEXT\0"
    "\0"
-   /* _mesa_function_pool[40991]: IsEnabledi (will be remapped) */
+   /* _mesa_function_pool[41024]: IsEnabledi (will be remapped) */
    "ii\0"
    "glIsEnabledIndexedEXT\0"
    "glIsEnabledi\0"
    "glIsEnablediEXT\0"
    "glIsEnablediOES\0"
    "\0"
-   /* _mesa_function_pool[41062]: FragmentMaterialivSGIX (dynamic) */
+   /* _mesa_function_pool[41095]: FragmentMaterialivSGIX (dynamic) */
    "iip\0"
    "glFragmentMaterialivSGIX\0"
    "\0"
-   /* _mesa_function_pool[41092]: WaitSync (will be remapped) */
+   /* _mesa_function_pool[41125]: WaitSync (will be remapped) */
    "iii\0"
    "glWaitSync\0"
    "\0"
-   /* _mesa_function_pool[41108]: GetVertexAttribPointerv (will be remapped) */
+   /* _mesa_function_pool[41141]: GetVertexAttribPointerv (will be remapped) */
    "iip\0"
    "glGetVertexAttribPointerv\0"
    "glGetVertexAttribPointervARB\0"
    "glGetVertexAttribPointervNV\0"
    "\0"
-   /* _mesa_function_pool[41196]: Uniform1i64vARB (will be remapped) */
+   /* _mesa_function_pool[41229]: Uniform1i64vARB (will be remapped) */
    "iip\0"
    "glUniform1i64vARB\0"
    "\0"
-   /* _mesa_function_pool[41219]: CreatePerfQueryINTEL (will be remapped) */
+   /* _mesa_function_pool[41252]: CreatePerfQueryINTEL (will be remapped) */
    "ip\0"
    "glCreatePerfQueryINTEL\0"
    "\0"
-   /* _mesa_function_pool[41246]: NewList (dynamic) */
+   /* _mesa_function_pool[41279]: NewList (dynamic) */
    "ii\0"
    "glNewList\0"
    "\0"
-   /* _mesa_function_pool[41260]: TexBuffer (will be remapped) */
+   /* _mesa_function_pool[41293]: TexBuffer (will be remapped) */
    "iii\0"
    "glTexBufferARB\0"
    "glTexBuffer\0"
    "glTexBufferEXT\0"
    "glTexBufferOES\0"
    "\0"
-   /* _mesa_function_pool[41322]: TexCoord4sv (offset 125) */
+   /* _mesa_function_pool[41355]: TexCoord4sv (offset 125) */
    "p\0"
    "glTexCoord4sv\0"
    "\0"
-   /* _mesa_function_pool[41339]: TexCoord1f (offset 96) */
+   /* _mesa_function_pool[41372]: TexCoord1f (offset 96) */
    "f\0"
    "glTexCoord1f\0"
    "\0"
-   /* _mesa_function_pool[41355]: TexCoord1d (offset 94) */
+   /* _mesa_function_pool[41388]: TexCoord1d (offset 94) */
    "d\0"
    "glTexCoord1d\0"
    "\0"
-   /* _mesa_function_pool[41371]: TexCoord1i (offset 98) */
+   /* _mesa_function_pool[41404]: TexCoord1i (offset 98) */
    "i\0"
    "glTexCoord1i\0"
    "\0"
-   /* _mesa_function_pool[41387]: GetnUniformfvARB (will be remapped) */
+   /* _mesa_function_pool[41420]: GetnUniformfvARB (will be remapped) */
    "iiip\0"
    "glGetnUniformfvARB\0"
    "glGetnUniformfv\0"
    "glGetnUniformfvKHR\0"
    "\0"
-   /* _mesa_function_pool[41447]: TexCoord1s (offset 100) */
+   /* _mesa_function_pool[41480]: TexCoord1s (offset 100) */
    "i\0"
    "glTexCoord1s\0"
    "\0"
-   /* _mesa_function_pool[41463]: GlobalAlphaFactoriSUN (dynamic) */
+   /* _mesa_function_pool[41496]: GlobalAlphaFactoriSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactoriSUN\0"
    "\0"
-   /* _mesa_function_pool[41490]: Uniform1ui (will be remapped) */
+   /* _mesa_function_pool[41523]: Uniform1ui (will be remapped) */
    "ii\0"
    "glUniform1uiEXT\0"
    "glUniform1ui\0"
    "\0"
-   /* _mesa_function_pool[41523]: TexStorage1D (will be remapped) */
+   /* _mesa_function_pool[41556]: TexStorage1D (will be remapped) */
    "iiii\0"
    "glTexStorage1D\0"
    "\0"
-   /* _mesa_function_pool[41544]: BlitFramebuffer (will be remapped) */
+   /* _mesa_function_pool[41577]: BlitFramebuffer (will be remapped) */
    "iiiiiiiiii\0"
    "glBlitFramebuffer\0"
    "glBlitFramebufferEXT\0"
    "\0"
-   /* _mesa_function_pool[41595]: TextureParameterf (will be remapped) */
+   /* _mesa_function_pool[41628]: TextureParameterf (will be remapped) */
    "iif\0"
    "glTextureParameterf\0"
    "\0"
-   /* _mesa_function_pool[41620]: FramebufferTexture1D (will be remapped) */
+   /* _mesa_function_pool[41653]: FramebufferTexture1D (will be remapped) */
    "iiiii\0"
    "glFramebufferTexture1D\0"
    "glFramebufferTexture1DEXT\0"
    "\0"
-   /* _mesa_function_pool[41676]: TextureParameteri (will be remapped) */
+   /* _mesa_function_pool[41709]: TextureParameteri (will be remapped) */
    "iii\0"
    "glTextureParameteri\0"
    "\0"
-   /* _mesa_function_pool[41701]: GetMapiv (offset 268) */
+   /* _mesa_function_pool[41734]: GetMapiv (offset 268) */
    "iip\0"
    "glGetMapiv\0"
    "\0"
-   /* _mesa_function_pool[41717]: GetUniformui64vARB (will be remapped) */
+   /* _mesa_function_pool[41750]: GetUniformui64vARB (will be remapped) */
    "iip\0"
    "glGetUniformui64vARB\0"
    "\0"
-   /* _mesa_function_pool[41743]: TexCoordP4ui (will be remapped) */
+   /* _mesa_function_pool[41776]: TexCoordP4ui (will be remapped) */
    "ii\0"
    "glTexCoordP4ui\0"
    "\0"
-   /* _mesa_function_pool[41762]: VertexAttrib1sv (will be remapped) */
+   /* _mesa_function_pool[41795]: VertexAttrib1sv (will be remapped) */
    "ip\0"
    "glVertexAttrib1sv\0"
    "glVertexAttrib1svARB\0"
    "\0"
-   /* _mesa_function_pool[41805]: WindowPos4dMESA (will be remapped) */
+   /* _mesa_function_pool[41838]: WindowPos4dMESA (will be remapped) */
    "dddd\0"
    "glWindowPos4dMESA\0"
    "\0"
-   /* _mesa_function_pool[41829]: Vertex3dv (offset 135) */
+   /* _mesa_function_pool[41862]: Vertex3dv (offset 135) */
    "p\0"
    "glVertex3dv\0"
    "\0"
-   /* _mesa_function_pool[41844]: CreateShaderProgramEXT (will be remapped) */
+   /* _mesa_function_pool[41877]: CreateShaderProgramEXT (will be remapped) */
    "ip\0"
    "glCreateShaderProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[41873]: VertexAttribL2d (will be remapped) */
+   /* _mesa_function_pool[41906]: VertexAttribL2d (will be remapped) */
    "idd\0"
    "glVertexAttribL2d\0"
    "\0"
-   /* _mesa_function_pool[41896]: GetnMapivARB (will be remapped) */
+   /* _mesa_function_pool[41929]: GetnMapivARB (will be remapped) */
    "iiip\0"
    "glGetnMapivARB\0"
    "\0"
-   /* _mesa_function_pool[41917]: MapParameterfvNV (dynamic) */
+   /* _mesa_function_pool[41950]: MapParameterfvNV (dynamic) */
    "iip\0"
    "glMapParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[41941]: GetVertexAttribfv (will be remapped) */
+   /* _mesa_function_pool[41974]: GetVertexAttribfv (will be remapped) */
    "iip\0"
    "glGetVertexAttribfv\0"
    "glGetVertexAttribfvARB\0"
    "\0"
-   /* _mesa_function_pool[41989]: MultiTexCoordP4uiv (will be remapped) */
+   /* _mesa_function_pool[42022]: MultiTexCoordP4uiv (will be remapped) */
    "iip\0"
    "glMultiTexCoordP4uiv\0"
    "\0"
-   /* _mesa_function_pool[42015]: TexGeniv (offset 193) */
+   /* _mesa_function_pool[42048]: TexGeniv (offset 193) */
    "iip\0"
    "glTexGeniv\0"
    "glTexGenivOES\0"
    "\0"
-   /* _mesa_function_pool[42045]: IsMemoryObjectEXT (will be remapped) */
+   /* _mesa_function_pool[42078]: IsMemoryObjectEXT (will be remapped) */
    "i\0"
    "glIsMemoryObjectEXT\0"
    "\0"
-   /* _mesa_function_pool[42068]: WeightubvARB (dynamic) */
+   /* _mesa_function_pool[42101]: WeightubvARB (dynamic) */
    "ip\0"
    "glWeightubvARB\0"
    "\0"
-   /* _mesa_function_pool[42087]: BlendColor (offset 336) */
+   /* _mesa_function_pool[42120]: BlendColor (offset 336) */
    "ffff\0"
    "glBlendColor\0"
    "glBlendColorEXT\0"
    "\0"
-   /* _mesa_function_pool[42122]: VertexAttribs2dvNV (will be remapped) */
+   /* _mesa_function_pool[42155]: VertexAttribs2dvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs2dvNV\0"
    "\0"
-   /* _mesa_function_pool[42148]: VertexAttrib2dvNV (will be remapped) */
+   /* _mesa_function_pool[42181]: VertexAttrib2dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib2dvNV\0"
    "\0"
-   /* _mesa_function_pool[42172]: NamedFramebufferDrawBuffers (will be remapped) */
+   /* _mesa_function_pool[42205]: NamedFramebufferDrawBuffers (will be remapped) */
    "iip\0"
    "glNamedFramebufferDrawBuffers\0"
    "\0"
-   /* _mesa_function_pool[42207]: ResetHistogram (offset 369) */
+   /* _mesa_function_pool[42240]: ResetHistogram (offset 369) */
    "i\0"
    "glResetHistogram\0"
    "glResetHistogramEXT\0"
    "\0"
-   /* _mesa_function_pool[42247]: CompressedTexSubImage2D (will be remapped) */
+   /* _mesa_function_pool[42280]: CompressedTexSubImage2D (will be remapped) */
    "iiiiiiiip\0"
    "glCompressedTexSubImage2D\0"
    "glCompressedTexSubImage2DARB\0"
    "\0"
-   /* _mesa_function_pool[42313]: TexCoord2sv (offset 109) */
+   /* _mesa_function_pool[42346]: TexCoord2sv (offset 109) */
    "p\0"
    "glTexCoord2sv\0"
    "\0"
-   /* _mesa_function_pool[42330]: StencilMaskSeparate (will be remapped) */
+   /* _mesa_function_pool[42363]: StencilMaskSeparate (will be remapped) */
    "ii\0"
    "glStencilMaskSeparate\0"
    "\0"
-   /* _mesa_function_pool[42356]: MultiTexCoord3sv (offset 399) */
+   /* _mesa_function_pool[42389]: MultiTexCoord3sv (offset 399) */
    "ip\0"
    "glMultiTexCoord3sv\0"
    "glMultiTexCoord3svARB\0"
    "\0"
-   /* _mesa_function_pool[42401]: GetMapParameterfvNV (dynamic) */
+   /* _mesa_function_pool[42434]: GetMapParameterfvNV (dynamic) */
    "iip\0"
    "glGetMapParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[42428]: TexCoord3iv (offset 115) */
+   /* _mesa_function_pool[42461]: TexCoord3iv (offset 115) */
    "p\0"
    "glTexCoord3iv\0"
    "\0"
-   /* _mesa_function_pool[42445]: MultiTexCoord4sv (offset 407) */
+   /* _mesa_function_pool[42478]: MultiTexCoord4sv (offset 407) */
    "ip\0"
    "glMultiTexCoord4sv\0"
    "glMultiTexCoord4svARB\0"
    "\0"
-   /* _mesa_function_pool[42490]: VertexBindingDivisor (will be remapped) */
+   /* _mesa_function_pool[42523]: VertexBindingDivisor (will be remapped) */
    "ii\0"
    "glVertexBindingDivisor\0"
    "\0"
-   /* _mesa_function_pool[42517]: PrimitiveBoundingBox (will be remapped) */
+   /* _mesa_function_pool[42550]: PrimitiveBoundingBox (will be remapped) */
    "ffffffff\0"
    "glPrimitiveBoundingBox\0"
    "glPrimitiveBoundingBoxARB\0"
    "glPrimitiveBoundingBoxEXT\0"
    "glPrimitiveBoundingBoxOES\0"
    "\0"
-   /* _mesa_function_pool[42628]: GetPerfMonitorCounterInfoAMD (will be remapped) */
+   /* _mesa_function_pool[42661]: GetPerfMonitorCounterInfoAMD (will be remapped) */
    "iiip\0"
    "glGetPerfMonitorCounterInfoAMD\0"
    "\0"
-   /* _mesa_function_pool[42665]: UniformBlockBinding (will be remapped) */
+   /* _mesa_function_pool[42698]: UniformBlockBinding (will be remapped) */
    "iii\0"
    "glUniformBlockBinding\0"
    "\0"
-   /* _mesa_function_pool[42692]: FenceSync (will be remapped) */
+   /* _mesa_function_pool[42725]: FenceSync (will be remapped) */
    "ii\0"
    "glFenceSync\0"
    "\0"
-   /* _mesa_function_pool[42708]: CompressedTextureSubImage2D (will be remapped) */
+   /* _mesa_function_pool[42741]: CompressedTextureSubImage2D (will be remapped) */
    "iiiiiiiip\0"
    "glCompressedTextureSubImage2D\0"
    "\0"
-   /* _mesa_function_pool[42749]: VertexAttrib4Nusv (will be remapped) */
+   /* _mesa_function_pool[42782]: VertexAttrib4Nusv (will be remapped) */
    "ip\0"
    "glVertexAttrib4Nusv\0"
    "glVertexAttrib4NusvARB\0"
    "\0"
-   /* _mesa_function_pool[42796]: SetFragmentShaderConstantATI (will be remapped) */
+   /* _mesa_function_pool[42829]: SetFragmentShaderConstantATI (will be remapped) */
    "ip\0"
    "glSetFragmentShaderConstantATI\0"
    "\0"
-   /* _mesa_function_pool[42831]: VertexP2ui (will be remapped) */
+   /* _mesa_function_pool[42864]: VertexP2ui (will be remapped) */
    "ii\0"
    "glVertexP2ui\0"
    "\0"
-   /* _mesa_function_pool[42848]: ProgramUniform2fv (will be remapped) */
+   /* _mesa_function_pool[42881]: ProgramUniform2fv (will be remapped) */
    "iiip\0"
    "glProgramUniform2fv\0"
    "glProgramUniform2fvEXT\0"
    "\0"
-   /* _mesa_function_pool[42897]: GetTextureLevelParameteriv (will be remapped) */
+   /* _mesa_function_pool[42930]: GetTextureLevelParameteriv (will be remapped) */
    "iiip\0"
    "glGetTextureLevelParameteriv\0"
    "\0"
-   /* _mesa_function_pool[42932]: GetTexEnvfv (offset 276) */
+   /* _mesa_function_pool[42965]: GetTexEnvfv (offset 276) */
    "iip\0"
    "glGetTexEnvfv\0"
    "\0"
-   /* _mesa_function_pool[42951]: BindAttribLocation (will be remapped) */
+   /* _mesa_function_pool[42984]: BindAttribLocation (will be remapped) */
    "iip\0"
    "glBindAttribLocation\0"
    "glBindAttribLocationARB\0"
    "\0"
-   /* _mesa_function_pool[43001]: TextureStorage2DEXT (will be remapped) */
+   /* _mesa_function_pool[43034]: TextureStorage2DEXT (will be remapped) */
    "iiiiii\0"
    "glTextureStorage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[43031]: TextureParameterIiv (will be remapped) */
+   /* _mesa_function_pool[43064]: TextureParameterIiv (will be remapped) */
    "iip\0"
    "glTextureParameterIiv\0"
    "\0"
-   /* _mesa_function_pool[43058]: FragmentLightiSGIX (dynamic) */
+   /* _mesa_function_pool[43091]: FragmentLightiSGIX (dynamic) */
    "iii\0"
    "glFragmentLightiSGIX\0"
    "\0"
-   /* _mesa_function_pool[43084]: DrawTransformFeedbackInstanced (will be remapped) */
+   /* _mesa_function_pool[43117]: DrawTransformFeedbackInstanced (will be remapped) */
    "iii\0"
    "glDrawTransformFeedbackInstanced\0"
    "\0"
-   /* _mesa_function_pool[43122]: CopyTextureSubImage1D (will be remapped) */
+   /* _mesa_function_pool[43155]: CopyTextureSubImage1D (will be remapped) */
    "iiiiii\0"
    "glCopyTextureSubImage1D\0"
    "\0"
-   /* _mesa_function_pool[43154]: PollAsyncSGIX (dynamic) */
+   /* _mesa_function_pool[43187]: PollAsyncSGIX (dynamic) */
    "p\0"
    "glPollAsyncSGIX\0"
    "\0"
-   /* _mesa_function_pool[43173]: ResumeTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[43206]: ResumeTransformFeedback (will be remapped) */
    "\0"
    "glResumeTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[43201]: GetProgramNamedParameterdvNV (will be remapped) */
+   /* _mesa_function_pool[43234]: GetProgramNamedParameterdvNV (will be remapped) */
    "iipp\0"
    "glGetProgramNamedParameterdvNV\0"
    "\0"
-   /* _mesa_function_pool[43238]: VertexAttribI1iv (will be remapped) */
+   /* _mesa_function_pool[43271]: VertexAttribI1iv (will be remapped) */
    "ip\0"
    "glVertexAttribI1ivEXT\0"
    "glVertexAttribI1iv\0"
    "\0"
-   /* _mesa_function_pool[43283]: Vertex2dv (offset 127) */
+   /* _mesa_function_pool[43316]: Vertex2dv (offset 127) */
    "p\0"
    "glVertex2dv\0"
    "\0"
-   /* _mesa_function_pool[43298]: VertexAttribI2uivEXT (will be remapped) */
+   /* _mesa_function_pool[43331]: VertexAttribI2uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI2uivEXT\0"
    "glVertexAttribI2uiv\0"
    "\0"
-   /* _mesa_function_pool[43345]: SampleMaski (will be remapped) */
+   /* _mesa_function_pool[43378]: SampleMaski (will be remapped) */
    "ii\0"
    "glSampleMaski\0"
    "\0"
-   /* _mesa_function_pool[43363]: GetFloati_v (will be remapped) */
+   /* _mesa_function_pool[43396]: GetFloati_v (will be remapped) */
    "iip\0"
    "glGetFloati_v\0"
    "glGetFloati_vOES\0"
    "\0"
-   /* _mesa_function_pool[43399]: MultiTexCoord2iv (offset 389) */
+   /* _mesa_function_pool[43432]: MultiTexCoord2iv (offset 389) */
    "ip\0"
    "glMultiTexCoord2iv\0"
    "glMultiTexCoord2ivARB\0"
    "\0"
-   /* _mesa_function_pool[43444]: DrawPixels (offset 257) */
+   /* _mesa_function_pool[43477]: DrawPixels (offset 257) */
    "iiiip\0"
    "glDrawPixels\0"
    "\0"
-   /* _mesa_function_pool[43464]: ReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[43497]: ReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (dynamic) */
    "iffffffff\0"
    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[43524]: CreateFramebuffers (will be remapped) */
+   /* _mesa_function_pool[43557]: CreateFramebuffers (will be remapped) */
    "ip\0"
    "glCreateFramebuffers\0"
    "\0"
-   /* _mesa_function_pool[43549]: DrawTransformFeedback (will be remapped) */
+   /* _mesa_function_pool[43582]: DrawTransformFeedback (will be remapped) */
    "ii\0"
    "glDrawTransformFeedback\0"
    "\0"
-   /* _mesa_function_pool[43577]: VertexAttribs3fvNV (will be remapped) */
+   /* _mesa_function_pool[43610]: VertexAttribs3fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs3fvNV\0"
    "\0"
-   /* _mesa_function_pool[43603]: GenLists (offset 5) */
+   /* _mesa_function_pool[43636]: GenLists (offset 5) */
    "i\0"
    "glGenLists\0"
    "\0"
-   /* _mesa_function_pool[43617]: ProgramUniform2ui64vARB (will be remapped) */
+   /* _mesa_function_pool[43650]: ProgramUniform2ui64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniform2ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[43649]: MapGrid2d (offset 226) */
+   /* _mesa_function_pool[43682]: MapGrid2d (offset 226) */
    "iddidd\0"
    "glMapGrid2d\0"
    "\0"
-   /* _mesa_function_pool[43669]: MapGrid2f (offset 227) */
+   /* _mesa_function_pool[43702]: MapGrid2f (offset 227) */
    "iffiff\0"
    "glMapGrid2f\0"
    "\0"
-   /* _mesa_function_pool[43689]: SampleMapATI (will be remapped) */
+   /* _mesa_function_pool[43722]: SampleMapATI (will be remapped) */
    "iii\0"
    "glSampleMapATI\0"
    "\0"
-   /* _mesa_function_pool[43709]: TexBumpParameterfvATI (will be remapped) */
+   /* _mesa_function_pool[43742]: TexBumpParameterfvATI (will be remapped) */
    "ip\0"
    "glTexBumpParameterfvATI\0"
    "\0"
-   /* _mesa_function_pool[43737]: GetActiveAttrib (will be remapped) */
+   /* _mesa_function_pool[43770]: GetActiveAttrib (will be remapped) */
    "iiipppp\0"
    "glGetActiveAttrib\0"
    "glGetActiveAttribARB\0"
    "\0"
-   /* _mesa_function_pool[43785]: TexCoord2fColor4ubVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[43818]: TexCoord2fColor4ubVertex3fvSUN (dynamic) */
    "ppp\0"
    "glTexCoord2fColor4ubVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[43823]: PixelMapfv (offset 251) */
+   /* _mesa_function_pool[43856]: PixelMapfv (offset 251) */
    "iip\0"
    "glPixelMapfv\0"
    "\0"
-   /* _mesa_function_pool[43841]: ClearBufferData (will be remapped) */
+   /* _mesa_function_pool[43874]: ClearBufferData (will be remapped) */
    "iiiip\0"
    "glClearBufferData\0"
    "\0"
-   /* _mesa_function_pool[43866]: Color3usv (offset 24) */
+   /* _mesa_function_pool[43899]: Color3usv (offset 24) */
    "p\0"
    "glColor3usv\0"
    "\0"
-   /* _mesa_function_pool[43881]: CopyImageSubData (will be remapped) */
+   /* _mesa_function_pool[43914]: CopyImageSubData (will be remapped) */
    "iiiiiiiiiiiiiii\0"
    "glCopyImageSubData\0"
    "glCopyImageSubDataEXT\0"
    "glCopyImageSubDataOES\0"
    "\0"
-   /* _mesa_function_pool[43961]: StencilOpSeparate (will be remapped) */
+   /* _mesa_function_pool[43994]: StencilOpSeparate (will be remapped) */
    "iiii\0"
    "glStencilOpSeparate\0"
    "glStencilOpSeparateATI\0"
    "\0"
-   /* _mesa_function_pool[44010]: GenSamplers (will be remapped) */
+   /* _mesa_function_pool[44043]: GenSamplers (will be remapped) */
    "ip\0"
    "glGenSamplers\0"
    "\0"
-   /* _mesa_function_pool[44028]: ClipControl (will be remapped) */
+   /* _mesa_function_pool[44061]: ClipControl (will be remapped) */
    "ii\0"
    "glClipControl\0"
    "\0"
-   /* _mesa_function_pool[44046]: DrawTexfOES (will be remapped) */
+   /* _mesa_function_pool[44079]: DrawTexfOES (will be remapped) */
    "fffff\0"
    "glDrawTexfOES\0"
    "\0"
-   /* _mesa_function_pool[44067]: Uniform4i64vARB (will be remapped) */
+   /* _mesa_function_pool[44100]: Uniform4i64vARB (will be remapped) */
    "iip\0"
    "glUniform4i64vARB\0"
    "\0"
-   /* _mesa_function_pool[44090]: AttachObjectARB (will be remapped) */
+   /* _mesa_function_pool[44123]: AttachObjectARB (will be remapped) */
    "ii\0"
    "glAttachObjectARB\0"
    "\0"
-   /* _mesa_function_pool[44112]: GetFragmentLightivSGIX (dynamic) */
+   /* _mesa_function_pool[44145]: GetFragmentLightivSGIX (dynamic) */
    "iip\0"
    "glGetFragmentLightivSGIX\0"
    "\0"
-   /* _mesa_function_pool[44142]: Accum (offset 213) */
+   /* _mesa_function_pool[44175]: Accum (offset 213) */
    "if\0"
    "glAccum\0"
    "\0"
-   /* _mesa_function_pool[44154]: GetTexImage (offset 281) */
+   /* _mesa_function_pool[44187]: GetTexImage (offset 281) */
    "iiiip\0"
    "glGetTexImage\0"
    "\0"
-   /* _mesa_function_pool[44175]: Color4x (will be remapped) */
+   /* _mesa_function_pool[44208]: Color4x (will be remapped) */
    "iiii\0"
    "glColor4xOES\0"
    "glColor4x\0"
    "\0"
-   /* _mesa_function_pool[44204]: ConvolutionParameteriv (offset 353) */
+   /* _mesa_function_pool[44237]: ConvolutionParameteriv (offset 353) */
    "iip\0"
    "glConvolutionParameteriv\0"
    "glConvolutionParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[44262]: Color4s (offset 33) */
+   /* _mesa_function_pool[44295]: Color4s (offset 33) */
    "iiii\0"
    "glColor4s\0"
    "\0"
-   /* _mesa_function_pool[44278]: CullParameterdvEXT (dynamic) */
+   /* _mesa_function_pool[44311]: CullParameterdvEXT (dynamic) */
    "ip\0"
    "glCullParameterdvEXT\0"
    "\0"
-   /* _mesa_function_pool[44303]: EnableVertexAttribArray (will be remapped) */
+   /* _mesa_function_pool[44336]: EnableVertexAttribArray (will be remapped) */
    "i\0"
    "glEnableVertexAttribArray\0"
    "glEnableVertexAttribArrayARB\0"
    "\0"
-   /* _mesa_function_pool[44361]: Color4i (offset 31) */
+   /* _mesa_function_pool[44394]: Color4i (offset 31) */
    "iiii\0"
    "glColor4i\0"
    "\0"
-   /* _mesa_function_pool[44377]: Color4f (offset 29) */
+   /* _mesa_function_pool[44410]: Color4f (offset 29) */
    "ffff\0"
    "glColor4f\0"
    "\0"
-   /* _mesa_function_pool[44393]: ShaderStorageBlockBinding (will be remapped) */
+   /* _mesa_function_pool[44426]: ShaderStorageBlockBinding (will be remapped) */
    "iii\0"
    "glShaderStorageBlockBinding\0"
    "\0"
-   /* _mesa_function_pool[44426]: Color4d (offset 27) */
+   /* _mesa_function_pool[44459]: Color4d (offset 27) */
    "dddd\0"
    "glColor4d\0"
    "\0"
-   /* _mesa_function_pool[44442]: Color4b (offset 25) */
+   /* _mesa_function_pool[44475]: Color4b (offset 25) */
    "iiii\0"
    "glColor4b\0"
    "\0"
-   /* _mesa_function_pool[44458]: MemoryObjectParameterivEXT (will be remapped) */
+   /* _mesa_function_pool[44491]: MemoryObjectParameterivEXT (will be remapped) */
    "iip\0"
    "glMemoryObjectParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[44492]: LoadProgramNV (will be remapped) */
+   /* _mesa_function_pool[44525]: LoadProgramNV (will be remapped) */
    "iiip\0"
    "glLoadProgramNV\0"
    "\0"
-   /* _mesa_function_pool[44514]: GetAttachedObjectsARB (will be remapped) */
+   /* _mesa_function_pool[44547]: GetAttachedObjectsARB (will be remapped) */
    "iipp\0"
    "glGetAttachedObjectsARB\0"
    "\0"
-   /* _mesa_function_pool[44544]: EvalCoord1fv (offset 231) */
+   /* _mesa_function_pool[44577]: EvalCoord1fv (offset 231) */
    "p\0"
    "glEvalCoord1fv\0"
    "\0"
-   /* _mesa_function_pool[44562]: VertexAttribLFormat (will be remapped) */
+   /* _mesa_function_pool[44595]: VertexAttribLFormat (will be remapped) */
    "iiii\0"
    "glVertexAttribLFormat\0"
    "\0"
-   /* _mesa_function_pool[44590]: VertexAttribL3d (will be remapped) */
+   /* _mesa_function_pool[44623]: VertexAttribL3d (will be remapped) */
    "iddd\0"
    "glVertexAttribL3d\0"
    "\0"
-   /* _mesa_function_pool[44614]: ClearNamedFramebufferuiv (will be remapped) */
+   /* _mesa_function_pool[44647]: ClearNamedFramebufferuiv (will be remapped) */
    "iiip\0"
    "glClearNamedFramebufferuiv\0"
    "\0"
-   /* _mesa_function_pool[44647]: StencilFuncSeparate (will be remapped) */
+   /* _mesa_function_pool[44680]: StencilFuncSeparate (will be remapped) */
    "iiii\0"
    "glStencilFuncSeparate\0"
    "\0"
-   /* _mesa_function_pool[44675]: ShaderSource (will be remapped) */
+   /* _mesa_function_pool[44708]: ShaderSource (will be remapped) */
    "iipp\0"
    "glShaderSource\0"
    "glShaderSourceARB\0"
    "\0"
-   /* _mesa_function_pool[44714]: Normal3fv (offset 57) */
+   /* _mesa_function_pool[44747]: Normal3fv (offset 57) */
    "p\0"
    "glNormal3fv\0"
    "\0"
-   /* _mesa_function_pool[44729]: ImageTransformParameterfvHP (dynamic) */
+   /* _mesa_function_pool[44762]: ImageTransformParameterfvHP (dynamic) */
    "iip\0"
    "glImageTransformParameterfvHP\0"
    "\0"
-   /* _mesa_function_pool[44764]: NormalP3ui (will be remapped) */
+   /* _mesa_function_pool[44797]: NormalP3ui (will be remapped) */
    "ii\0"
    "glNormalP3ui\0"
    "\0"
-   /* _mesa_function_pool[44781]: CreateSamplers (will be remapped) */
+   /* _mesa_function_pool[44814]: CreateSamplers (will be remapped) */
    "ip\0"
    "glCreateSamplers\0"
    "\0"
-   /* _mesa_function_pool[44802]: MultiTexCoord3fvARB (offset 395) */
+   /* _mesa_function_pool[44835]: MultiTexCoord3fvARB (offset 395) */
    "ip\0"
    "glMultiTexCoord3fv\0"
    "glMultiTexCoord3fvARB\0"
    "\0"
-   /* _mesa_function_pool[44847]: GetProgramParameterfvNV (will be remapped) */
+   /* _mesa_function_pool[44880]: GetProgramParameterfvNV (will be remapped) */
    "iiip\0"
    "glGetProgramParameterfvNV\0"
    "\0"
-   /* _mesa_function_pool[44879]: BufferData (will be remapped) */
+   /* _mesa_function_pool[44912]: BufferData (will be remapped) */
    "iipi\0"
    "glBufferData\0"
    "glBufferDataARB\0"
    "\0"
-   /* _mesa_function_pool[44914]: TexSubImage2D (offset 333) */
+   /* _mesa_function_pool[44947]: TexSubImage2D (offset 333) */
    "iiiiiiiip\0"
    "glTexSubImage2D\0"
    "glTexSubImage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[44960]: FragmentLightivSGIX (dynamic) */
+   /* _mesa_function_pool[44993]: FragmentLightivSGIX (dynamic) */
    "iip\0"
    "glFragmentLightivSGIX\0"
    "\0"
-   /* _mesa_function_pool[44987]: GetTexParameterPointervAPPLE (dynamic) */
+   /* _mesa_function_pool[45020]: GetTexParameterPointervAPPLE (dynamic) */
    "iip\0"
    "glGetTexParameterPointervAPPLE\0"
    "\0"
-   /* _mesa_function_pool[45023]: TexGenfv (offset 191) */
+   /* _mesa_function_pool[45056]: TexGenfv (offset 191) */
    "iip\0"
    "glTexGenfv\0"
    "glTexGenfvOES\0"
    "\0"
-   /* _mesa_function_pool[45053]: GetVertexAttribiv (will be remapped) */
+   /* _mesa_function_pool[45086]: GetVertexAttribiv (will be remapped) */
    "iip\0"
    "glGetVertexAttribiv\0"
    "glGetVertexAttribivARB\0"
    "\0"
-   /* _mesa_function_pool[45101]: TexCoordP2uiv (will be remapped) */
+   /* _mesa_function_pool[45134]: TexCoordP2uiv (will be remapped) */
    "ip\0"
    "glTexCoordP2uiv\0"
    "\0"
-   /* _mesa_function_pool[45121]: ReplacementCodeuiColor3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[45154]: ReplacementCodeuiColor3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glReplacementCodeuiColor3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[45165]: Uniform3fv (will be remapped) */
+   /* _mesa_function_pool[45198]: Uniform3fv (will be remapped) */
    "iip\0"
    "glUniform3fv\0"
    "glUniform3fvARB\0"
    "\0"
-   /* _mesa_function_pool[45199]: BlendEquation (offset 337) */
+   /* _mesa_function_pool[45232]: BlendEquation (offset 337) */
    "i\0"
    "glBlendEquation\0"
    "glBlendEquationEXT\0"
    "glBlendEquationOES\0"
    "\0"
-   /* _mesa_function_pool[45256]: VertexAttrib3dNV (will be remapped) */
+   /* _mesa_function_pool[45289]: VertexAttrib3dNV (will be remapped) */
    "iddd\0"
    "glVertexAttrib3dNV\0"
    "\0"
-   /* _mesa_function_pool[45281]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[45314]: ReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (dynamic) */
    "ppppp\0"
    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[45345]: IndexFuncEXT (dynamic) */
+   /* _mesa_function_pool[45378]: IndexFuncEXT (dynamic) */
    "if\0"
    "glIndexFuncEXT\0"
    "\0"
-   /* _mesa_function_pool[45364]: UseShaderProgramEXT (will be remapped) */
+   /* _mesa_function_pool[45397]: UseShaderProgramEXT (will be remapped) */
    "ii\0"
    "glUseShaderProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[45390]: PushName (offset 201) */
+   /* _mesa_function_pool[45423]: PushName (offset 201) */
    "i\0"
    "glPushName\0"
    "\0"
-   /* _mesa_function_pool[45404]: GenFencesNV (dynamic) */
+   /* _mesa_function_pool[45437]: GenFencesNV (dynamic) */
    "ip\0"
    "glGenFencesNV\0"
    "\0"
-   /* _mesa_function_pool[45422]: CullParameterfvEXT (dynamic) */
+   /* _mesa_function_pool[45455]: CullParameterfvEXT (dynamic) */
    "ip\0"
    "glCullParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[45447]: DeleteRenderbuffers (will be remapped) */
+   /* _mesa_function_pool[45480]: DeleteRenderbuffers (will be remapped) */
    "ip\0"
    "glDeleteRenderbuffers\0"
    "glDeleteRenderbuffersEXT\0"
    "glDeleteRenderbuffersOES\0"
    "\0"
-   /* _mesa_function_pool[45523]: VertexAttrib1dv (will be remapped) */
+   /* _mesa_function_pool[45556]: VertexAttrib1dv (will be remapped) */
    "ip\0"
    "glVertexAttrib1dv\0"
    "glVertexAttrib1dvARB\0"
    "\0"
-   /* _mesa_function_pool[45566]: ImageTransformParameteriHP (dynamic) */
+   /* _mesa_function_pool[45599]: ImageTransformParameteriHP (dynamic) */
    "iii\0"
    "glImageTransformParameteriHP\0"
    "\0"
-   /* _mesa_function_pool[45600]: IsShader (will be remapped) */
+   /* _mesa_function_pool[45633]: IsShader (will be remapped) */
    "i\0"
    "glIsShader\0"
    "\0"
-   /* _mesa_function_pool[45614]: Rotated (offset 299) */
+   /* _mesa_function_pool[45647]: Rotated (offset 299) */
    "dddd\0"
    "glRotated\0"
    "\0"
-   /* _mesa_function_pool[45630]: Color4iv (offset 32) */
+   /* _mesa_function_pool[45663]: Color4iv (offset 32) */
    "p\0"
    "glColor4iv\0"
    "\0"
-   /* _mesa_function_pool[45644]: PointParameterxv (will be remapped) */
+   /* _mesa_function_pool[45677]: PointParameterxv (will be remapped) */
    "ip\0"
    "glPointParameterxvOES\0"
    "glPointParameterxv\0"
    "\0"
-   /* _mesa_function_pool[45689]: Rotatex (will be remapped) */
+   /* _mesa_function_pool[45722]: Rotatex (will be remapped) */
    "iiii\0"
    "glRotatexOES\0"
    "glRotatex\0"
    "\0"
-   /* _mesa_function_pool[45718]: FramebufferTextureLayer (will be remapped) */
+   /* _mesa_function_pool[45751]: FramebufferTextureLayer (will be remapped) */
    "iiiii\0"
    "glFramebufferTextureLayer\0"
    "glFramebufferTextureLayerEXT\0"
    "\0"
-   /* _mesa_function_pool[45780]: TexEnvfv (offset 185) */
+   /* _mesa_function_pool[45813]: TexEnvfv (offset 185) */
    "iip\0"
    "glTexEnvfv\0"
    "\0"
-   /* _mesa_function_pool[45796]: ProgramUniformMatrix3fv (will be remapped) */
+   /* _mesa_function_pool[45829]: ProgramUniformMatrix3fv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix3fv\0"
    "glProgramUniformMatrix3fvEXT\0"
    "\0"
-   /* _mesa_function_pool[45858]: DeleteMemoryObjectsEXT (will be remapped) */
+   /* _mesa_function_pool[45891]: DeleteMemoryObjectsEXT (will be remapped) */
    "ip\0"
    "glDeleteMemoryObjectsEXT\0"
    "\0"
-   /* _mesa_function_pool[45887]: LoadMatrixf (offset 291) */
+   /* _mesa_function_pool[45920]: LoadMatrixf (offset 291) */
    "p\0"
    "glLoadMatrixf\0"
    "\0"
-   /* _mesa_function_pool[45904]: GetProgramLocalParameterfvARB (will be remapped) */
+   /* _mesa_function_pool[45937]: GetProgramLocalParameterfvARB (will be remapped) */
    "iip\0"
    "glGetProgramLocalParameterfvARB\0"
    "\0"
-   /* _mesa_function_pool[45941]: MakeTextureHandleResidentARB (will be remapped) */
+   /* _mesa_function_pool[45974]: MakeTextureHandleResidentARB (will be remapped) */
    "i\0"
    "glMakeTextureHandleResidentARB\0"
    "\0"
-   /* _mesa_function_pool[45975]: MultiDrawArraysIndirect (will be remapped) */
+   /* _mesa_function_pool[46008]: MultiDrawArraysIndirect (will be remapped) */
    "ipii\0"
    "glMultiDrawArraysIndirect\0"
    "\0"
-   /* _mesa_function_pool[46007]: DrawRangeElementsBaseVertex (will be remapped) */
+   /* _mesa_function_pool[46040]: DrawRangeElementsBaseVertex (will be remapped) */
    "iiiiipi\0"
    "glDrawRangeElementsBaseVertex\0"
    "glDrawRangeElementsBaseVertexEXT\0"
    "glDrawRangeElementsBaseVertexOES\0"
    "\0"
-   /* _mesa_function_pool[46112]: ProgramUniformMatrix4dv (will be remapped) */
+   /* _mesa_function_pool[46145]: ProgramUniformMatrix4dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix4dv\0"
    "\0"
-   /* _mesa_function_pool[46145]: MatrixIndexuivARB (dynamic) */
+   /* _mesa_function_pool[46178]: MatrixIndexuivARB (dynamic) */
    "ip\0"
    "glMatrixIndexuivARB\0"
    "\0"
-   /* _mesa_function_pool[46169]: Tangent3sEXT (dynamic) */
+   /* _mesa_function_pool[46202]: Tangent3sEXT (dynamic) */
    "iii\0"
    "glTangent3sEXT\0"
    "\0"
-   /* _mesa_function_pool[46189]: SecondaryColor3bv (will be remapped) */
+   /* _mesa_function_pool[46222]: SecondaryColor3bv (will be remapped) */
    "p\0"
    "glSecondaryColor3bv\0"
    "glSecondaryColor3bvEXT\0"
    "\0"
-   /* _mesa_function_pool[46235]: GlobalAlphaFactorusSUN (dynamic) */
+   /* _mesa_function_pool[46268]: GlobalAlphaFactorusSUN (dynamic) */
    "i\0"
    "glGlobalAlphaFactorusSUN\0"
    "\0"
-   /* _mesa_function_pool[46263]: GetCombinerOutputParameterivNV (dynamic) */
+   /* _mesa_function_pool[46296]: GetCombinerOutputParameterivNV (dynamic) */
    "iiip\0"
    "glGetCombinerOutputParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[46302]: DrawTexxvOES (will be remapped) */
+   /* _mesa_function_pool[46335]: DrawTexxvOES (will be remapped) */
    "p\0"
    "glDrawTexxvOES\0"
    "\0"
-   /* _mesa_function_pool[46320]: TexParameterfv (offset 179) */
+   /* _mesa_function_pool[46353]: TexParameterfv (offset 179) */
    "iip\0"
    "glTexParameterfv\0"
    "\0"
-   /* _mesa_function_pool[46342]: Color4ubv (offset 36) */
+   /* _mesa_function_pool[46375]: Color4ubv (offset 36) */
    "p\0"
    "glColor4ubv\0"
    "\0"
-   /* _mesa_function_pool[46357]: TexCoord2fv (offset 105) */
+   /* _mesa_function_pool[46390]: TexCoord2fv (offset 105) */
    "p\0"
    "glTexCoord2fv\0"
    "\0"
-   /* _mesa_function_pool[46374]: FogCoorddv (will be remapped) */
+   /* _mesa_function_pool[46407]: FogCoorddv (will be remapped) */
    "p\0"
    "glFogCoorddv\0"
    "glFogCoorddvEXT\0"
    "\0"
-   /* _mesa_function_pool[46406]: VDPAUUnregisterSurfaceNV (will be remapped) */
+   /* _mesa_function_pool[46439]: VDPAUUnregisterSurfaceNV (will be remapped) */
    "i\0"
    "glVDPAUUnregisterSurfaceNV\0"
    "\0"
-   /* _mesa_function_pool[46436]: ColorP3ui (will be remapped) */
+   /* _mesa_function_pool[46469]: ColorP3ui (will be remapped) */
    "ii\0"
    "glColorP3ui\0"
    "\0"
-   /* _mesa_function_pool[46452]: ClearBufferuiv (will be remapped) */
+   /* _mesa_function_pool[46485]: ClearBufferuiv (will be remapped) */
    "iip\0"
    "glClearBufferuiv\0"
    "\0"
-   /* _mesa_function_pool[46474]: GetUnsignedBytei_vEXT (will be remapped) */
+   /* _mesa_function_pool[46507]: GetUnsignedBytei_vEXT (will be remapped) */
    "iip\0"
    "glGetUnsignedBytei_vEXT\0"
    "\0"
-   /* _mesa_function_pool[46503]: GetShaderPrecisionFormat (will be remapped) */
+   /* _mesa_function_pool[46536]: GetShaderPrecisionFormat (will be remapped) */
    "iipp\0"
    "glGetShaderPrecisionFormat\0"
    "\0"
-   /* _mesa_function_pool[46536]: ProgramNamedParameter4dvNV (will be remapped) */
+   /* _mesa_function_pool[46569]: ProgramNamedParameter4dvNV (will be remapped) */
    "iipp\0"
    "glProgramNamedParameter4dvNV\0"
    "\0"
-   /* _mesa_function_pool[46571]: Flush (offset 217) */
+   /* _mesa_function_pool[46604]: Flush (offset 217) */
    "\0"
    "glFlush\0"
    "\0"
-   /* _mesa_function_pool[46581]: MakeTextureHandleNonResidentARB (will be remapped) */
+   /* _mesa_function_pool[46614]: MakeTextureHandleNonResidentARB (will be remapped) */
    "i\0"
    "glMakeTextureHandleNonResidentARB\0"
    "\0"
-   /* _mesa_function_pool[46618]: VertexAttribI4iEXT (will be remapped) */
+   /* _mesa_function_pool[46651]: VertexAttribI4iEXT (will be remapped) */
    "iiiii\0"
    "glVertexAttribI4iEXT\0"
    "glVertexAttribI4i\0"
    "\0"
-   /* _mesa_function_pool[46664]: VertexAttribI3uivEXT (will be remapped) */
+   /* _mesa_function_pool[46697]: VertexAttribI3uivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI3uivEXT\0"
    "glVertexAttribI3uiv\0"
    "\0"
-   /* _mesa_function_pool[46711]: FogCoordd (will be remapped) */
+   /* _mesa_function_pool[46744]: FogCoordd (will be remapped) */
    "d\0"
    "glFogCoordd\0"
    "glFogCoorddEXT\0"
    "\0"
-   /* _mesa_function_pool[46741]: BindFramebufferEXT (will be remapped) */
+   /* _mesa_function_pool[46774]: BindFramebufferEXT (will be remapped) */
    "ii\0"
    "glBindFramebufferEXT\0"
    "\0"
-   /* _mesa_function_pool[46766]: Uniform3iv (will be remapped) */
+   /* _mesa_function_pool[46799]: Uniform3iv (will be remapped) */
    "iip\0"
    "glUniform3iv\0"
    "glUniform3ivARB\0"
    "\0"
-   /* _mesa_function_pool[46800]: TexStorage2DMultisample (will be remapped) */
+   /* _mesa_function_pool[46833]: TexStorage2DMultisample (will be remapped) */
    "iiiiii\0"
    "glTexStorage2DMultisample\0"
    "\0"
-   /* _mesa_function_pool[46834]: UnlockArraysEXT (will be remapped) */
+   /* _mesa_function_pool[46867]: UnlockArraysEXT (will be remapped) */
    "\0"
    "glUnlockArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[46854]: GetVertexAttribLui64vARB (will be remapped) */
+   /* _mesa_function_pool[46887]: GetVertexAttribLui64vARB (will be remapped) */
    "iip\0"
    "glGetVertexAttribLui64vARB\0"
    "\0"
-   /* _mesa_function_pool[46886]: VertexAttrib4iv (will be remapped) */
+   /* _mesa_function_pool[46919]: VertexAttrib4iv (will be remapped) */
    "ip\0"
    "glVertexAttrib4iv\0"
    "glVertexAttrib4ivARB\0"
    "\0"
-   /* _mesa_function_pool[46929]: CopyTexSubImage3D (offset 373) */
+   /* _mesa_function_pool[46962]: CopyTexSubImage3D (offset 373) */
    "iiiiiiiii\0"
    "glCopyTexSubImage3D\0"
    "glCopyTexSubImage3DEXT\0"
    "glCopyTexSubImage3DOES\0"
    "\0"
-   /* _mesa_function_pool[47006]: PolygonOffsetClampEXT (will be remapped) */
+   /* _mesa_function_pool[47039]: PolygonOffsetClampEXT (will be remapped) */
    "fff\0"
    "glPolygonOffsetClampEXT\0"
    "glPolygonOffsetClamp\0"
    "\0"
-   /* _mesa_function_pool[47056]: GetInteger64v (will be remapped) */
+   /* _mesa_function_pool[47089]: GetInteger64v (will be remapped) */
    "ip\0"
    "glGetInteger64v\0"
    "\0"
-   /* _mesa_function_pool[47076]: DetachObjectARB (will be remapped) */
+   /* _mesa_function_pool[47109]: DetachObjectARB (will be remapped) */
    "ii\0"
    "glDetachObjectARB\0"
    "\0"
-   /* _mesa_function_pool[47098]: Indexiv (offset 49) */
+   /* _mesa_function_pool[47131]: Indexiv (offset 49) */
    "p\0"
    "glIndexiv\0"
    "\0"
-   /* _mesa_function_pool[47111]: TexEnvi (offset 186) */
+   /* _mesa_function_pool[47144]: TexEnvi (offset 186) */
    "iii\0"
    "glTexEnvi\0"
    "\0"
-   /* _mesa_function_pool[47126]: TexEnvf (offset 184) */
+   /* _mesa_function_pool[47159]: TexEnvf (offset 184) */
    "iif\0"
    "glTexEnvf\0"
    "\0"
-   /* _mesa_function_pool[47141]: TexEnvx (will be remapped) */
+   /* _mesa_function_pool[47174]: TexEnvx (will be remapped) */
    "iii\0"
    "glTexEnvxOES\0"
    "glTexEnvx\0"
    "\0"
-   /* _mesa_function_pool[47169]: LoadIdentityDeformationMapSGIX (dynamic) */
+   /* _mesa_function_pool[47202]: LoadIdentityDeformationMapSGIX (dynamic) */
    "i\0"
    "glLoadIdentityDeformationMapSGIX\0"
    "\0"
-   /* _mesa_function_pool[47205]: StopInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[47238]: StopInstrumentsSGIX (dynamic) */
    "i\0"
    "glStopInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[47230]: TexCoord4fColor4fNormal3fVertex4fSUN (dynamic) */
+   /* _mesa_function_pool[47263]: TexCoord4fColor4fNormal3fVertex4fSUN (dynamic) */
    "fffffffffffffff\0"
    "glTexCoord4fColor4fNormal3fVertex4fSUN\0"
    "\0"
-   /* _mesa_function_pool[47286]: InvalidateBufferSubData (will be remapped) */
+   /* _mesa_function_pool[47319]: InvalidateBufferSubData (will be remapped) */
    "iii\0"
    "glInvalidateBufferSubData\0"
    "\0"
-   /* _mesa_function_pool[47317]: UniformMatrix4x2fv (will be remapped) */
+   /* _mesa_function_pool[47350]: UniformMatrix4x2fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix4x2fv\0"
    "\0"
-   /* _mesa_function_pool[47344]: ClearTexImage (will be remapped) */
+   /* _mesa_function_pool[47377]: ClearTexImage (will be remapped) */
    "iiiip\0"
    "glClearTexImage\0"
    "\0"
-   /* _mesa_function_pool[47367]: PolygonOffset (offset 319) */
+   /* _mesa_function_pool[47400]: PolygonOffset (offset 319) */
    "ff\0"
    "glPolygonOffset\0"
    "\0"
-   /* _mesa_function_pool[47387]: NormalPointervINTEL (dynamic) */
+   /* _mesa_function_pool[47420]: NormalPointervINTEL (dynamic) */
    "ip\0"
    "glNormalPointervINTEL\0"
    "\0"
-   /* _mesa_function_pool[47413]: SamplerParameterfv (will be remapped) */
+   /* _mesa_function_pool[47446]: SamplerParameterfv (will be remapped) */
    "iip\0"
    "glSamplerParameterfv\0"
    "\0"
-   /* _mesa_function_pool[47439]: CompressedTextureSubImage1D (will be remapped) */
+   /* _mesa_function_pool[47472]: CompressedTextureSubImage1D (will be remapped) */
    "iiiiiip\0"
    "glCompressedTextureSubImage1D\0"
    "\0"
-   /* _mesa_function_pool[47478]: ProgramUniformMatrix4x2dv (will be remapped) */
+   /* _mesa_function_pool[47511]: ProgramUniformMatrix4x2dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix4x2dv\0"
    "\0"
-   /* _mesa_function_pool[47513]: ProgramEnvParameter4fARB (will be remapped) */
+   /* _mesa_function_pool[47546]: ProgramEnvParameter4fARB (will be remapped) */
    "iiffff\0"
    "glProgramEnvParameter4fARB\0"
    "glProgramParameter4fNV\0"
    "\0"
-   /* _mesa_function_pool[47571]: ClearDepth (offset 208) */
+   /* _mesa_function_pool[47604]: ClearDepth (offset 208) */
    "d\0"
    "glClearDepth\0"
    "\0"
-   /* _mesa_function_pool[47587]: VertexAttrib3dvNV (will be remapped) */
+   /* _mesa_function_pool[47620]: VertexAttrib3dvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib3dvNV\0"
    "\0"
-   /* _mesa_function_pool[47611]: Color4fv (offset 30) */
+   /* _mesa_function_pool[47644]: Color4fv (offset 30) */
    "p\0"
    "glColor4fv\0"
    "\0"
-   /* _mesa_function_pool[47625]: GetnMinmaxARB (will be remapped) */
+   /* _mesa_function_pool[47658]: GetnMinmaxARB (will be remapped) */
    "iiiiip\0"
    "glGetnMinmaxARB\0"
    "\0"
-   /* _mesa_function_pool[47649]: IsImageHandleResidentARB (will be remapped) */
+   /* _mesa_function_pool[47682]: IsImageHandleResidentARB (will be remapped) */
    "i\0"
    "glIsImageHandleResidentARB\0"
    "\0"
-   /* _mesa_function_pool[47679]: ColorPointer (offset 308) */
+   /* _mesa_function_pool[47712]: ColorPointer (offset 308) */
    "iiip\0"
    "glColorPointer\0"
    "\0"
-   /* _mesa_function_pool[47700]: ProgramUniform2ui64ARB (will be remapped) */
+   /* _mesa_function_pool[47733]: ProgramUniform2ui64ARB (will be remapped) */
    "iiii\0"
    "glProgramUniform2ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[47731]: Lightiv (offset 162) */
+   /* _mesa_function_pool[47764]: Lightiv (offset 162) */
    "iip\0"
    "glLightiv\0"
    "\0"
-   /* _mesa_function_pool[47746]: GetTexParameterIuiv (will be remapped) */
+   /* _mesa_function_pool[47779]: GetTexParameterIuiv (will be remapped) */
    "iip\0"
    "glGetTexParameterIuivEXT\0"
    "glGetTexParameterIuiv\0"
    "glGetTexParameterIuivOES\0"
    "\0"
-   /* _mesa_function_pool[47823]: TransformFeedbackVaryings (will be remapped) */
+   /* _mesa_function_pool[47856]: TransformFeedbackVaryings (will be remapped) */
    "iipi\0"
    "glTransformFeedbackVaryings\0"
    "glTransformFeedbackVaryingsEXT\0"
    "\0"
-   /* _mesa_function_pool[47888]: VertexAttrib3sv (will be remapped) */
+   /* _mesa_function_pool[47921]: VertexAttrib3sv (will be remapped) */
    "ip\0"
    "glVertexAttrib3sv\0"
    "glVertexAttrib3svARB\0"
    "\0"
-   /* _mesa_function_pool[47931]: Uniform4i64ARB (will be remapped) */
+   /* _mesa_function_pool[47964]: Uniform4i64ARB (will be remapped) */
    "iiiii\0"
    "glUniform4i64ARB\0"
    "\0"
-   /* _mesa_function_pool[47955]: IsVertexArray (will be remapped) */
+   /* _mesa_function_pool[47988]: IsVertexArray (will be remapped) */
    "i\0"
    "glIsVertexArray\0"
    "glIsVertexArrayOES\0"
    "\0"
-   /* _mesa_function_pool[47993]: ProgramUniform3ui64ARB (will be remapped) */
+   /* _mesa_function_pool[48026]: ProgramUniform3ui64ARB (will be remapped) */
    "iiiii\0"
    "glProgramUniform3ui64ARB\0"
    "\0"
-   /* _mesa_function_pool[48025]: PushClientAttrib (offset 335) */
+   /* _mesa_function_pool[48058]: PushClientAttrib (offset 335) */
    "i\0"
    "glPushClientAttrib\0"
    "\0"
-   /* _mesa_function_pool[48047]: ProgramUniform4ui (will be remapped) */
+   /* _mesa_function_pool[48080]: ProgramUniform4ui (will be remapped) */
    "iiiiii\0"
    "glProgramUniform4ui\0"
    "glProgramUniform4uiEXT\0"
    "\0"
-   /* _mesa_function_pool[48098]: Uniform1f (will be remapped) */
+   /* _mesa_function_pool[48131]: Uniform1f (will be remapped) */
    "if\0"
    "glUniform1f\0"
    "glUniform1fARB\0"
    "\0"
-   /* _mesa_function_pool[48129]: Uniform1d (will be remapped) */
+   /* _mesa_function_pool[48162]: Uniform1d (will be remapped) */
    "id\0"
    "glUniform1d\0"
    "\0"
-   /* _mesa_function_pool[48145]: FragmentMaterialfSGIX (dynamic) */
+   /* _mesa_function_pool[48178]: FragmentMaterialfSGIX (dynamic) */
    "iif\0"
    "glFragmentMaterialfSGIX\0"
    "\0"
-   /* _mesa_function_pool[48174]: Uniform1i (will be remapped) */
+   /* _mesa_function_pool[48207]: Uniform1i (will be remapped) */
    "ii\0"
    "glUniform1i\0"
    "glUniform1iARB\0"
    "\0"
-   /* _mesa_function_pool[48205]: GetPolygonStipple (offset 274) */
+   /* _mesa_function_pool[48238]: GetPolygonStipple (offset 274) */
    "p\0"
    "glGetPolygonStipple\0"
    "\0"
-   /* _mesa_function_pool[48228]: Tangent3dvEXT (dynamic) */
+   /* _mesa_function_pool[48261]: Tangent3dvEXT (dynamic) */
    "p\0"
    "glTangent3dvEXT\0"
    "\0"
-   /* _mesa_function_pool[48247]: BlitNamedFramebuffer (will be remapped) */
+   /* _mesa_function_pool[48280]: BlitNamedFramebuffer (will be remapped) */
    "iiiiiiiiiiii\0"
    "glBlitNamedFramebuffer\0"
    "\0"
-   /* _mesa_function_pool[48284]: PixelTexGenSGIX (dynamic) */
+   /* _mesa_function_pool[48317]: PixelTexGenSGIX (dynamic) */
    "i\0"
    "glPixelTexGenSGIX\0"
    "\0"
-   /* _mesa_function_pool[48305]: ReplacementCodeusvSUN (dynamic) */
+   /* _mesa_function_pool[48338]: ReplacementCodeusvSUN (dynamic) */
    "p\0"
    "glReplacementCodeusvSUN\0"
    "\0"
-   /* _mesa_function_pool[48332]: UseProgram (will be remapped) */
+   /* _mesa_function_pool[48365]: UseProgram (will be remapped) */
    "i\0"
    "glUseProgram\0"
    "glUseProgramObjectARB\0"
    "\0"
-   /* _mesa_function_pool[48370]: StartInstrumentsSGIX (dynamic) */
+   /* _mesa_function_pool[48403]: StartInstrumentsSGIX (dynamic) */
    "\0"
    "glStartInstrumentsSGIX\0"
    "\0"
-   /* _mesa_function_pool[48395]: FlushMappedBufferRangeAPPLE (will be remapped) */
+   /* _mesa_function_pool[48428]: FlushMappedBufferRangeAPPLE (will be remapped) */
    "iii\0"
    "glFlushMappedBufferRangeAPPLE\0"
    "\0"
-   /* _mesa_function_pool[48430]: GetFragDataLocation (will be remapped) */
+   /* _mesa_function_pool[48463]: GetFragDataLocation (will be remapped) */
    "ip\0"
    "glGetFragDataLocationEXT\0"
    "glGetFragDataLocation\0"
    "\0"
-   /* _mesa_function_pool[48481]: PixelMapuiv (offset 252) */
+   /* _mesa_function_pool[48514]: PixelMapuiv (offset 252) */
    "iip\0"
    "glPixelMapuiv\0"
    "\0"
-   /* _mesa_function_pool[48500]: ClearNamedBufferSubData (will be remapped) */
+   /* _mesa_function_pool[48533]: ClearNamedBufferSubData (will be remapped) */
    "iiiiiip\0"
    "glClearNamedBufferSubData\0"
    "\0"
-   /* _mesa_function_pool[48535]: VertexWeightfvEXT (dynamic) */
+   /* _mesa_function_pool[48568]: VertexWeightfvEXT (dynamic) */
    "p\0"
    "glVertexWeightfvEXT\0"
    "\0"
-   /* _mesa_function_pool[48558]: GetFenceivNV (dynamic) */
+   /* _mesa_function_pool[48591]: GetFenceivNV (dynamic) */
    "iip\0"
    "glGetFenceivNV\0"
    "\0"
-   /* _mesa_function_pool[48578]: CurrentPaletteMatrixARB (dynamic) */
+   /* _mesa_function_pool[48611]: CurrentPaletteMatrixARB (dynamic) */
    "i\0"
    "glCurrentPaletteMatrixARB\0"
    "glCurrentPaletteMatrixOES\0"
    "\0"
-   /* _mesa_function_pool[48633]: GetNamedFramebufferAttachmentParameteriv (will be remapped) */
+   /* _mesa_function_pool[48666]: GetNamedFramebufferAttachmentParameteriv (will be remapped) */
    "iiip\0"
    "glGetNamedFramebufferAttachmentParameteriv\0"
    "\0"
-   /* _mesa_function_pool[48682]: GenVertexArrays (will be remapped) */
+   /* _mesa_function_pool[48715]: GenVertexArrays (will be remapped) */
    "ip\0"
    "glGenVertexArrays\0"
    "glGenVertexArraysOES\0"
    "\0"
-   /* _mesa_function_pool[48725]: TexStorageMem2DMultisampleEXT (will be remapped) */
+   /* _mesa_function_pool[48758]: TexStorageMem2DMultisampleEXT (will be remapped) */
    "iiiiiiii\0"
    "glTexStorageMem2DMultisampleEXT\0"
    "\0"
-   /* _mesa_function_pool[48767]: TexCoord2fColor4ubVertex3fSUN (dynamic) */
+   /* _mesa_function_pool[48800]: TexCoord2fColor4ubVertex3fSUN (dynamic) */
    "ffiiiifff\0"
    "glTexCoord2fColor4ubVertex3fSUN\0"
    "\0"
-   /* _mesa_function_pool[48810]: TagSampleBufferSGIX (dynamic) */
+   /* _mesa_function_pool[48843]: TagSampleBufferSGIX (dynamic) */
    "\0"
    "glTagSampleBufferSGIX\0"
    "\0"
-   /* _mesa_function_pool[48834]: Color3s (offset 17) */
+   /* _mesa_function_pool[48867]: Color3s (offset 17) */
    "iii\0"
    "glColor3s\0"
    "\0"
-   /* _mesa_function_pool[48849]: TextureStorage2DMultisample (will be remapped) */
+   /* _mesa_function_pool[48882]: TextureStorage2DMultisample (will be remapped) */
    "iiiiii\0"
    "glTextureStorage2DMultisample\0"
    "\0"
-   /* _mesa_function_pool[48887]: TexCoordPointer (offset 320) */
+   /* _mesa_function_pool[48920]: TexCoordPointer (offset 320) */
    "iiip\0"
    "glTexCoordPointer\0"
    "\0"
-   /* _mesa_function_pool[48911]: Color3i (offset 15) */
+   /* _mesa_function_pool[48944]: Color3i (offset 15) */
    "iii\0"
    "glColor3i\0"
    "\0"
-   /* _mesa_function_pool[48926]: EvalCoord2d (offset 232) */
+   /* _mesa_function_pool[48959]: EvalCoord2d (offset 232) */
    "dd\0"
    "glEvalCoord2d\0"
    "\0"
-   /* _mesa_function_pool[48944]: EvalCoord2f (offset 234) */
+   /* _mesa_function_pool[48977]: EvalCoord2f (offset 234) */
    "ff\0"
    "glEvalCoord2f\0"
    "\0"
-   /* _mesa_function_pool[48962]: Color3b (offset 9) */
+   /* _mesa_function_pool[48995]: Color3b (offset 9) */
    "iii\0"
    "glColor3b\0"
    "\0"
-   /* _mesa_function_pool[48977]: ExecuteProgramNV (will be remapped) */
+   /* _mesa_function_pool[49010]: ExecuteProgramNV (will be remapped) */
    "iip\0"
    "glExecuteProgramNV\0"
    "\0"
-   /* _mesa_function_pool[49001]: Color3f (offset 13) */
+   /* _mesa_function_pool[49034]: Color3f (offset 13) */
    "fff\0"
    "glColor3f\0"
    "\0"
-   /* _mesa_function_pool[49016]: Color3d (offset 11) */
+   /* _mesa_function_pool[49049]: Color3d (offset 11) */
    "ddd\0"
    "glColor3d\0"
    "\0"
-   /* _mesa_function_pool[49031]: GetVertexAttribdv (will be remapped) */
+   /* _mesa_function_pool[49064]: GetVertexAttribdv (will be remapped) */
    "iip\0"
    "glGetVertexAttribdv\0"
    "glGetVertexAttribdvARB\0"
    "\0"
-   /* _mesa_function_pool[49079]: GetBufferPointerv (will be remapped) */
+   /* _mesa_function_pool[49112]: GetBufferPointerv (will be remapped) */
    "iip\0"
    "glGetBufferPointerv\0"
    "glGetBufferPointervARB\0"
    "glGetBufferPointervOES\0"
    "\0"
-   /* _mesa_function_pool[49150]: GenFramebuffers (will be remapped) */
+   /* _mesa_function_pool[49183]: GenFramebuffers (will be remapped) */
    "ip\0"
    "glGenFramebuffers\0"
    "glGenFramebuffersEXT\0"
    "glGenFramebuffersOES\0"
    "\0"
-   /* _mesa_function_pool[49214]: IsTextureHandleResidentARB (will be remapped) */
+   /* _mesa_function_pool[49247]: IsTextureHandleResidentARB (will be remapped) */
    "i\0"
    "glIsTextureHandleResidentARB\0"
    "\0"
-   /* _mesa_function_pool[49246]: GenBuffers (will be remapped) */
+   /* _mesa_function_pool[49279]: GenBuffers (will be remapped) */
    "ip\0"
    "glGenBuffers\0"
    "glGenBuffersARB\0"
    "\0"
-   /* _mesa_function_pool[49279]: ClearDepthx (will be remapped) */
+   /* _mesa_function_pool[49312]: ClearDepthx (will be remapped) */
    "i\0"
    "glClearDepthxOES\0"
    "glClearDepthx\0"
    "\0"
-   /* _mesa_function_pool[49313]: EnableVertexArrayAttrib (will be remapped) */
+   /* _mesa_function_pool[49346]: EnableVertexArrayAttrib (will be remapped) */
    "ii\0"
    "glEnableVertexArrayAttrib\0"
    "\0"
-   /* _mesa_function_pool[49343]: BlendEquationSeparate (will be remapped) */
+   /* _mesa_function_pool[49376]: BlendEquationSeparate (will be remapped) */
    "ii\0"
    "glBlendEquationSeparate\0"
    "glBlendEquationSeparateEXT\0"
    "glBlendEquationSeparateATI\0"
    "glBlendEquationSeparateOES\0"
    "\0"
-   /* _mesa_function_pool[49452]: PixelTransformParameteriEXT (dynamic) */
+   /* _mesa_function_pool[49485]: PixelTransformParameteriEXT (dynamic) */
    "iii\0"
    "glPixelTransformParameteriEXT\0"
    "\0"
-   /* _mesa_function_pool[49487]: MultiTexCoordP4ui (will be remapped) */
+   /* _mesa_function_pool[49520]: MultiTexCoordP4ui (will be remapped) */
    "iii\0"
    "glMultiTexCoordP4ui\0"
    "\0"
-   /* _mesa_function_pool[49512]: VertexAttribs1fvNV (will be remapped) */
+   /* _mesa_function_pool[49545]: VertexAttribs1fvNV (will be remapped) */
    "iip\0"
    "glVertexAttribs1fvNV\0"
    "\0"
-   /* _mesa_function_pool[49538]: VertexAttribIPointer (will be remapped) */
+   /* _mesa_function_pool[49571]: VertexAttribIPointer (will be remapped) */
    "iiiip\0"
    "glVertexAttribIPointerEXT\0"
    "glVertexAttribIPointer\0"
    "\0"
-   /* _mesa_function_pool[49594]: ProgramUniform4fv (will be remapped) */
+   /* _mesa_function_pool[49627]: ProgramUniform4fv (will be remapped) */
    "iiip\0"
    "glProgramUniform4fv\0"
    "glProgramUniform4fvEXT\0"
    "\0"
-   /* _mesa_function_pool[49643]: FrameZoomSGIX (dynamic) */
+   /* _mesa_function_pool[49676]: FrameZoomSGIX (dynamic) */
    "i\0"
    "glFrameZoomSGIX\0"
    "\0"
-   /* _mesa_function_pool[49662]: RasterPos4sv (offset 85) */
+   /* _mesa_function_pool[49695]: RasterPos4sv (offset 85) */
    "p\0"
    "glRasterPos4sv\0"
    "\0"
-   /* _mesa_function_pool[49680]: CopyTextureSubImage3D (will be remapped) */
+   /* _mesa_function_pool[49713]: CopyTextureSubImage3D (will be remapped) */
    "iiiiiiiii\0"
    "glCopyTextureSubImage3D\0"
    "\0"
-   /* _mesa_function_pool[49715]: SelectBuffer (offset 195) */
+   /* _mesa_function_pool[49748]: SelectBuffer (offset 195) */
    "ip\0"
    "glSelectBuffer\0"
    "\0"
-   /* _mesa_function_pool[49734]: GetSynciv (will be remapped) */
+   /* _mesa_function_pool[49767]: GetSynciv (will be remapped) */
    "iiipp\0"
    "glGetSynciv\0"
    "\0"
-   /* _mesa_function_pool[49753]: TextureView (will be remapped) */
+   /* _mesa_function_pool[49786]: TextureView (will be remapped) */
    "iiiiiiii\0"
    "glTextureView\0"
    "\0"
-   /* _mesa_function_pool[49777]: TexEnviv (offset 187) */
+   /* _mesa_function_pool[49810]: TexEnviv (offset 187) */
    "iip\0"
    "glTexEnviv\0"
    "\0"
-   /* _mesa_function_pool[49793]: TexSubImage3D (offset 372) */
+   /* _mesa_function_pool[49826]: TexSubImage3D (offset 372) */
    "iiiiiiiiiip\0"
    "glTexSubImage3D\0"
    "glTexSubImage3DEXT\0"
    "glTexSubImage3DOES\0"
    "\0"
-   /* _mesa_function_pool[49860]: Bitmap (offset 8) */
+   /* _mesa_function_pool[49893]: Bitmap (offset 8) */
    "iiffffp\0"
    "glBitmap\0"
    "\0"
-   /* _mesa_function_pool[49878]: VertexAttribDivisor (will be remapped) */
+   /* _mesa_function_pool[49911]: VertexAttribDivisor (will be remapped) */
    "ii\0"
    "glVertexAttribDivisorARB\0"
    "glVertexAttribDivisor\0"
    "\0"
-   /* _mesa_function_pool[49929]: DrawTransformFeedbackStream (will be remapped) */
+   /* _mesa_function_pool[49962]: DrawTransformFeedbackStream (will be remapped) */
    "iii\0"
    "glDrawTransformFeedbackStream\0"
    "\0"
-   /* _mesa_function_pool[49964]: GetIntegerv (offset 263) */
+   /* _mesa_function_pool[49997]: GetIntegerv (offset 263) */
    "ip\0"
    "glGetIntegerv\0"
    "\0"
-   /* _mesa_function_pool[49982]: EndPerfQueryINTEL (will be remapped) */
+   /* _mesa_function_pool[50015]: EndPerfQueryINTEL (will be remapped) */
    "i\0"
    "glEndPerfQueryINTEL\0"
    "\0"
-   /* _mesa_function_pool[50005]: FragmentLightfvSGIX (dynamic) */
+   /* _mesa_function_pool[50038]: FragmentLightfvSGIX (dynamic) */
    "iip\0"
    "glFragmentLightfvSGIX\0"
    "\0"
-   /* _mesa_function_pool[50032]: NamedBufferPageCommitmentARB (will be remapped) */
+   /* _mesa_function_pool[50065]: NamedBufferPageCommitmentARB (will be remapped) */
    "iiii\0"
    "glNamedBufferPageCommitmentARB\0"
    "\0"
-   /* _mesa_function_pool[50069]: TexCoord2fColor3fVertex3fvSUN (dynamic) */
+   /* _mesa_function_pool[50102]: TexCoord2fColor3fVertex3fvSUN (dynamic) */
    "ppp\0"
    "glTexCoord2fColor3fVertex3fvSUN\0"
    "\0"
-   /* _mesa_function_pool[50106]: GetActiveUniform (will be remapped) */
+   /* _mesa_function_pool[50139]: GetActiveUniform (will be remapped) */
    "iiipppp\0"
    "glGetActiveUniform\0"
    "glGetActiveUniformARB\0"
    "\0"
-   /* _mesa_function_pool[50156]: AlphaFuncx (will be remapped) */
+   /* _mesa_function_pool[50189]: AlphaFuncx (will be remapped) */
    "ii\0"
    "glAlphaFuncxOES\0"
    "glAlphaFuncx\0"
    "\0"
-   /* _mesa_function_pool[50189]: VertexAttribI2ivEXT (will be remapped) */
+   /* _mesa_function_pool[50222]: VertexAttribI2ivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI2ivEXT\0"
    "glVertexAttribI2iv\0"
    "\0"
-   /* _mesa_function_pool[50234]: VertexBlendARB (dynamic) */
+   /* _mesa_function_pool[50267]: VertexBlendARB (dynamic) */
    "i\0"
    "glVertexBlendARB\0"
    "\0"
-   /* _mesa_function_pool[50254]: Map1d (offset 220) */
+   /* _mesa_function_pool[50287]: Map1d (offset 220) */
    "iddiip\0"
    "glMap1d\0"
    "\0"
-   /* _mesa_function_pool[50270]: Map1f (offset 221) */
+   /* _mesa_function_pool[50303]: Map1f (offset 221) */
    "iffiip\0"
    "glMap1f\0"
    "\0"
-   /* _mesa_function_pool[50286]: AreTexturesResident (offset 322) */
+   /* _mesa_function_pool[50319]: AreTexturesResident (offset 322) */
    "ipp\0"
    "glAreTexturesResident\0"
    "glAreTexturesResidentEXT\0"
    "\0"
-   /* _mesa_function_pool[50338]: VertexArrayVertexBuffer (will be remapped) */
+   /* _mesa_function_pool[50371]: VertexArrayVertexBuffer (will be remapped) */
    "iiiii\0"
    "glVertexArrayVertexBuffer\0"
    "\0"
-   /* _mesa_function_pool[50371]: PixelTransferf (offset 247) */
+   /* _mesa_function_pool[50404]: PixelTransferf (offset 247) */
    "if\0"
    "glPixelTransferf\0"
    "\0"
-   /* _mesa_function_pool[50392]: PixelTransferi (offset 248) */
+   /* _mesa_function_pool[50425]: PixelTransferi (offset 248) */
    "ii\0"
    "glPixelTransferi\0"
    "\0"
-   /* _mesa_function_pool[50413]: GetProgramResourceiv (will be remapped) */
+   /* _mesa_function_pool[50446]: GetProgramResourceiv (will be remapped) */
    "iiiipipp\0"
    "glGetProgramResourceiv\0"
    "\0"
-   /* _mesa_function_pool[50446]: VertexAttrib3fvNV (will be remapped) */
+   /* _mesa_function_pool[50479]: VertexAttrib3fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib3fvNV\0"
    "\0"
-   /* _mesa_function_pool[50470]: GetFinalCombinerInputParameterivNV (dynamic) */
+   /* _mesa_function_pool[50503]: GetFinalCombinerInputParameterivNV (dynamic) */
    "iip\0"
    "glGetFinalCombinerInputParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[50512]: SecondaryColorP3ui (will be remapped) */
+   /* _mesa_function_pool[50545]: SecondaryColorP3ui (will be remapped) */
    "ii\0"
    "glSecondaryColorP3ui\0"
    "\0"
-   /* _mesa_function_pool[50537]: BindTextures (will be remapped) */
+   /* _mesa_function_pool[50570]: BindTextures (will be remapped) */
    "iip\0"
    "glBindTextures\0"
    "\0"
-   /* _mesa_function_pool[50557]: GetMapParameterivNV (dynamic) */
+   /* _mesa_function_pool[50590]: GetMapParameterivNV (dynamic) */
    "iip\0"
    "glGetMapParameterivNV\0"
    "\0"
-   /* _mesa_function_pool[50584]: VertexAttrib4fvNV (will be remapped) */
+   /* _mesa_function_pool[50617]: VertexAttrib4fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib4fvNV\0"
    "\0"
-   /* _mesa_function_pool[50608]: Rectiv (offset 91) */
+   /* _mesa_function_pool[50641]: Rectiv (offset 91) */
    "pp\0"
    "glRectiv\0"
    "\0"
-   /* _mesa_function_pool[50621]: MultiTexCoord1iv (offset 381) */
+   /* _mesa_function_pool[50654]: MultiTexCoord1iv (offset 381) */
    "ip\0"
    "glMultiTexCoord1iv\0"
    "glMultiTexCoord1ivARB\0"
    "\0"
-   /* _mesa_function_pool[50666]: PassTexCoordATI (will be remapped) */
+   /* _mesa_function_pool[50699]: PassTexCoordATI (will be remapped) */
    "iii\0"
    "glPassTexCoordATI\0"
    "\0"
-   /* _mesa_function_pool[50689]: Tangent3dEXT (dynamic) */
+   /* _mesa_function_pool[50722]: Tangent3dEXT (dynamic) */
    "ddd\0"
    "glTangent3dEXT\0"
    "\0"
-   /* _mesa_function_pool[50709]: Vertex2fv (offset 129) */
+   /* _mesa_function_pool[50742]: Vertex2fv (offset 129) */
    "p\0"
    "glVertex2fv\0"
    "\0"
-   /* _mesa_function_pool[50724]: BindRenderbufferEXT (will be remapped) */
+   /* _mesa_function_pool[50757]: BindRenderbufferEXT (will be remapped) */
    "ii\0"
    "glBindRenderbufferEXT\0"
    "\0"
-   /* _mesa_function_pool[50750]: Vertex3sv (offset 141) */
+   /* _mesa_function_pool[50783]: Vertex3sv (offset 141) */
    "p\0"
    "glVertex3sv\0"
    "\0"
-   /* _mesa_function_pool[50765]: EvalMesh1 (offset 236) */
+   /* _mesa_function_pool[50798]: EvalMesh1 (offset 236) */
    "iii\0"
    "glEvalMesh1\0"
    "\0"
-   /* _mesa_function_pool[50782]: DiscardFramebufferEXT (will be remapped) */
+   /* _mesa_function_pool[50815]: DiscardFramebufferEXT (will be remapped) */
    "iip\0"
    "glDiscardFramebufferEXT\0"
    "\0"
-   /* _mesa_function_pool[50811]: Uniform2f (will be remapped) */
+   /* _mesa_function_pool[50844]: Uniform2f (will be remapped) */
    "iff\0"
    "glUniform2f\0"
    "glUniform2fARB\0"
    "\0"
-   /* _mesa_function_pool[50843]: Uniform2d (will be remapped) */
+   /* _mesa_function_pool[50876]: Uniform2d (will be remapped) */
    "idd\0"
    "glUniform2d\0"
    "\0"
-   /* _mesa_function_pool[50860]: ColorPointerEXT (will be remapped) */
+   /* _mesa_function_pool[50893]: ColorPointerEXT (will be remapped) */
    "iiiip\0"
    "glColorPointerEXT\0"
    "\0"
-   /* _mesa_function_pool[50885]: LineWidth (offset 168) */
+   /* _mesa_function_pool[50918]: LineWidth (offset 168) */
    "f\0"
    "glLineWidth\0"
    "\0"
-   /* _mesa_function_pool[50900]: Uniform2i (will be remapped) */
+   /* _mesa_function_pool[50933]: Uniform2i (will be remapped) */
    "iii\0"
    "glUniform2i\0"
    "glUniform2iARB\0"
    "\0"
-   /* _mesa_function_pool[50932]: MultiDrawElementsBaseVertex (will be remapped) */
+   /* _mesa_function_pool[50965]: MultiDrawElementsBaseVertex (will be remapped) */
    "ipipip\0"
    "glMultiDrawElementsBaseVertex\0"
    "glMultiDrawElementsBaseVertexEXT\0"
    "\0"
-   /* _mesa_function_pool[51003]: Lightxv (will be remapped) */
+   /* _mesa_function_pool[51036]: Lightxv (will be remapped) */
    "iip\0"
    "glLightxvOES\0"
    "glLightxv\0"
    "\0"
-   /* _mesa_function_pool[51031]: DepthRangeIndexed (will be remapped) */
+   /* _mesa_function_pool[51064]: DepthRangeIndexed (will be remapped) */
    "idd\0"
    "glDepthRangeIndexed\0"
    "\0"
-   /* _mesa_function_pool[51056]: GetConvolutionParameterfv (offset 357) */
+   /* _mesa_function_pool[51089]: GetConvolutionParameterfv (offset 357) */
    "iip\0"
    "glGetConvolutionParameterfv\0"
    "glGetConvolutionParameterfvEXT\0"
    "\0"
-   /* _mesa_function_pool[51120]: GetTexBumpParameterfvATI (will be remapped) */
+   /* _mesa_function_pool[51153]: GetTexBumpParameterfvATI (will be remapped) */
    "ip\0"
    "glGetTexBumpParameterfvATI\0"
    "\0"
-   /* _mesa_function_pool[51151]: ProgramNamedParameter4dNV (will be remapped) */
+   /* _mesa_function_pool[51184]: ProgramNamedParameter4dNV (will be remapped) */
    "iipdddd\0"
    "glProgramNamedParameter4dNV\0"
    "\0"
-   /* _mesa_function_pool[51188]: GetMaterialfv (offset 269) */
+   /* _mesa_function_pool[51221]: GetMaterialfv (offset 269) */
    "iip\0"
    "glGetMaterialfv\0"
    "\0"
-   /* _mesa_function_pool[51209]: TexImage3DMultisample (will be remapped) */
+   /* _mesa_function_pool[51242]: TexImage3DMultisample (will be remapped) */
    "iiiiiii\0"
    "glTexImage3DMultisample\0"
    "\0"
-   /* _mesa_function_pool[51242]: VertexAttrib1fvNV (will be remapped) */
+   /* _mesa_function_pool[51275]: VertexAttrib1fvNV (will be remapped) */
    "ip\0"
    "glVertexAttrib1fvNV\0"
    "\0"
-   /* _mesa_function_pool[51266]: GetUniformBlockIndex (will be remapped) */
+   /* _mesa_function_pool[51299]: GetUniformBlockIndex (will be remapped) */
    "ip\0"
    "glGetUniformBlockIndex\0"
    "\0"
-   /* _mesa_function_pool[51293]: DetachShader (will be remapped) */
+   /* _mesa_function_pool[51326]: DetachShader (will be remapped) */
    "ii\0"
    "glDetachShader\0"
    "\0"
-   /* _mesa_function_pool[51312]: CopyTexSubImage2D (offset 326) */
+   /* _mesa_function_pool[51345]: CopyTexSubImage2D (offset 326) */
    "iiiiiiii\0"
    "glCopyTexSubImage2D\0"
    "glCopyTexSubImage2DEXT\0"
    "\0"
-   /* _mesa_function_pool[51365]: GetNamedFramebufferParameteriv (will be remapped) */
+   /* _mesa_function_pool[51398]: GetNamedFramebufferParameteriv (will be remapped) */
    "iip\0"
    "glGetNamedFramebufferParameteriv\0"
    "\0"
-   /* _mesa_function_pool[51403]: GetObjectParameterivARB (will be remapped) */
+   /* _mesa_function_pool[51436]: GetObjectParameterivARB (will be remapped) */
    "iip\0"
    "glGetObjectParameterivARB\0"
    "\0"
-   /* _mesa_function_pool[51434]: Color3iv (offset 16) */
+   /* _mesa_function_pool[51467]: Color3iv (offset 16) */
    "p\0"
    "glColor3iv\0"
    "\0"
-   /* _mesa_function_pool[51448]: DrawElements (offset 311) */
+   /* _mesa_function_pool[51481]: DrawElements (offset 311) */
    "iiip\0"
    "glDrawElements\0"
    "\0"
-   /* _mesa_function_pool[51469]: ScissorArrayv (will be remapped) */
+   /* _mesa_function_pool[51502]: ScissorArrayv (will be remapped) */
    "iip\0"
    "glScissorArrayv\0"
    "glScissorArrayvOES\0"
    "\0"
-   /* _mesa_function_pool[51509]: GetInternalformativ (will be remapped) */
+   /* _mesa_function_pool[51542]: GetInternalformativ (will be remapped) */
    "iiiip\0"
    "glGetInternalformativ\0"
    "\0"
-   /* _mesa_function_pool[51538]: EvalPoint2 (offset 239) */
+   /* _mesa_function_pool[51571]: EvalPoint2 (offset 239) */
    "ii\0"
    "glEvalPoint2\0"
    "\0"
-   /* _mesa_function_pool[51555]: EvalPoint1 (offset 237) */
+   /* _mesa_function_pool[51588]: EvalPoint1 (offset 237) */
    "i\0"
    "glEvalPoint1\0"
    "\0"
-   /* _mesa_function_pool[51571]: VertexAttribLPointer (will be remapped) */
+   /* _mesa_function_pool[51604]: VertexAttribLPointer (will be remapped) */
    "iiiip\0"
    "glVertexAttribLPointer\0"
    "\0"
-   /* _mesa_function_pool[51601]: PopMatrix (offset 297) */
+   /* _mesa_function_pool[51634]: PopMatrix (offset 297) */
    "\0"
    "glPopMatrix\0"
    "\0"
-   /* _mesa_function_pool[51615]: FinishFenceNV (dynamic) */
+   /* _mesa_function_pool[51648]: FinishFenceNV (dynamic) */
    "i\0"
    "glFinishFenceNV\0"
    "\0"
-   /* _mesa_function_pool[51634]: Tangent3bvEXT (dynamic) */
+   /* _mesa_function_pool[51667]: Tangent3bvEXT (dynamic) */
    "p\0"
    "glTangent3bvEXT\0"
    "\0"
-   /* _mesa_function_pool[51653]: NamedBufferData (will be remapped) */
+   /* _mesa_function_pool[51686]: NamedBufferData (will be remapped) */
    "iipi\0"
    "glNamedBufferData\0"
    "\0"
-   /* _mesa_function_pool[51677]: GetTexGeniv (offset 280) */
+   /* _mesa_function_pool[51710]: GetTexGeniv (offset 280) */
    "iip\0"
    "glGetTexGeniv\0"
    "glGetTexGenivOES\0"
    "\0"
-   /* _mesa_function_pool[51713]: GetFirstPerfQueryIdINTEL (will be remapped) */
+   /* _mesa_function_pool[51746]: GetFirstPerfQueryIdINTEL (will be remapped) */
    "p\0"
    "glGetFirstPerfQueryIdINTEL\0"
    "\0"
-   /* _mesa_function_pool[51743]: ActiveProgramEXT (will be remapped) */
+   /* _mesa_function_pool[51776]: ActiveProgramEXT (will be remapped) */
    "i\0"
    "glActiveProgramEXT\0"
    "\0"
-   /* _mesa_function_pool[51765]: PixelTransformParameterivEXT (dynamic) */
+   /* _mesa_function_pool[51798]: PixelTransformParameterivEXT (dynamic) */
    "iip\0"
    "glPixelTransformParameterivEXT\0"
    "\0"
-   /* _mesa_function_pool[51801]: TexCoord4fVertex4fvSUN (dynamic) */
+   /* _mesa_function_pool[51834]: TexCoord4fVertex4fvSUN (dynamic) */
    "pp\0"
    "glTexCoord4fVertex4fvSUN\0"
    "\0"
-   /* _mesa_function_pool[51830]: UnmapBuffer (will be remapped) */
+   /* _mesa_function_pool[51863]: UnmapBuffer (will be remapped) */
    "i\0"
    "glUnmapBuffer\0"
    "glUnmapBufferARB\0"
    "glUnmapBufferOES\0"
    "\0"
-   /* _mesa_function_pool[51881]: EvalCoord1d (offset 228) */
+   /* _mesa_function_pool[51914]: EvalCoord1d (offset 228) */
    "d\0"
    "glEvalCoord1d\0"
    "\0"
-   /* _mesa_function_pool[51898]: VertexAttribL1d (will be remapped) */
+   /* _mesa_function_pool[51931]: VertexAttribL1d (will be remapped) */
    "id\0"
    "glVertexAttribL1d\0"
    "\0"
-   /* _mesa_function_pool[51920]: EvalCoord1f (offset 230) */
+   /* _mesa_function_pool[51953]: EvalCoord1f (offset 230) */
    "f\0"
    "glEvalCoord1f\0"
    "\0"
-   /* _mesa_function_pool[51937]: IndexMaterialEXT (dynamic) */
+   /* _mesa_function_pool[51970]: IndexMaterialEXT (dynamic) */
    "ii\0"
    "glIndexMaterialEXT\0"
    "\0"
-   /* _mesa_function_pool[51960]: Materialf (offset 169) */
+   /* _mesa_function_pool[51993]: Materialf (offset 169) */
    "iif\0"
    "glMaterialf\0"
    "\0"
-   /* _mesa_function_pool[51977]: Materiali (offset 171) */
+   /* _mesa_function_pool[52010]: Materiali (offset 171) */
    "iii\0"
    "glMateriali\0"
    "\0"
-   /* _mesa_function_pool[51994]: ProgramUniform1uiv (will be remapped) */
+   /* _mesa_function_pool[52027]: ProgramUniform1uiv (will be remapped) */
    "iiip\0"
    "glProgramUniform1uiv\0"
    "glProgramUniform1uivEXT\0"
    "\0"
-   /* _mesa_function_pool[52045]: EvalCoord1dv (offset 229) */
+   /* _mesa_function_pool[52078]: EvalCoord1dv (offset 229) */
    "p\0"
    "glEvalCoord1dv\0"
    "\0"
-   /* _mesa_function_pool[52063]: Materialx (will be remapped) */
+   /* _mesa_function_pool[52096]: Materialx (will be remapped) */
    "iii\0"
    "glMaterialxOES\0"
    "glMaterialx\0"
    "\0"
-   /* _mesa_function_pool[52095]: GetQueryBufferObjectiv (will be remapped) */
+   /* _mesa_function_pool[52128]: GetQueryBufferObjectiv (will be remapped) */
    "iiii\0"
    "glGetQueryBufferObjectiv\0"
    "\0"
-   /* _mesa_function_pool[52126]: GetTextureSamplerHandleARB (will be remapped) */
+   /* _mesa_function_pool[52159]: GetTextureSamplerHandleARB (will be remapped) */
    "ii\0"
    "glGetTextureSamplerHandleARB\0"
    "\0"
-   /* _mesa_function_pool[52159]: GetLightiv (offset 265) */
+   /* _mesa_function_pool[52192]: GetLightiv (offset 265) */
    "iip\0"
    "glGetLightiv\0"
    "\0"
-   /* _mesa_function_pool[52177]: ProgramUniform3i64ARB (will be remapped) */
+   /* _mesa_function_pool[52210]: ProgramUniform3i64ARB (will be remapped) */
    "iiiii\0"
    "glProgramUniform3i64ARB\0"
    "\0"
-   /* _mesa_function_pool[52208]: BindBuffer (will be remapped) */
+   /* _mesa_function_pool[52241]: BindBuffer (will be remapped) */
    "ii\0"
    "glBindBuffer\0"
    "glBindBufferARB\0"
    "\0"
-   /* _mesa_function_pool[52241]: ProgramUniform1i (will be remapped) */
+   /* _mesa_function_pool[52274]: ProgramUniform1i (will be remapped) */
    "iii\0"
    "glProgramUniform1i\0"
    "glProgramUniform1iEXT\0"
    "\0"
-   /* _mesa_function_pool[52287]: ProgramUniform1f (will be remapped) */
+   /* _mesa_function_pool[52320]: ProgramUniform1f (will be remapped) */
    "iif\0"
    "glProgramUniform1f\0"
    "glProgramUniform1fEXT\0"
    "\0"
-   /* _mesa_function_pool[52333]: ProgramUniform1d (will be remapped) */
+   /* _mesa_function_pool[52366]: ProgramUniform1d (will be remapped) */
    "iid\0"
    "glProgramUniform1d\0"
    "\0"
-   /* _mesa_function_pool[52357]: WindowPos3iv (will be remapped) */
+   /* _mesa_function_pool[52390]: WindowPos3iv (will be remapped) */
    "p\0"
    "glWindowPos3iv\0"
    "glWindowPos3ivARB\0"
    "glWindowPos3ivMESA\0"
    "\0"
-   /* _mesa_function_pool[52412]: CopyConvolutionFilter2D (offset 355) */
+   /* _mesa_function_pool[52445]: CopyConvolutionFilter2D (offset 355) */
    "iiiiii\0"
    "glCopyConvolutionFilter2D\0"
    "glCopyConvolutionFilter2DEXT\0"
    "\0"
-   /* _mesa_function_pool[52475]: CopyBufferSubData (will be remapped) */
+   /* _mesa_function_pool[52508]: CopyBufferSubData (will be remapped) */
    "iiiii\0"
    "glCopyBufferSubData\0"
    "\0"
-   /* _mesa_function_pool[52502]: WeightfvARB (dynamic) */
+   /* _mesa_function_pool[52535]: WeightfvARB (dynamic) */
    "ip\0"
    "glWeightfvARB\0"
    "\0"
-   /* _mesa_function_pool[52520]: UniformMatrix3x4fv (will be remapped) */
+   /* _mesa_function_pool[52553]: UniformMatrix3x4fv (will be remapped) */
    "iiip\0"
    "glUniformMatrix3x4fv\0"
    "\0"
-   /* _mesa_function_pool[52547]: Recti (offset 90) */
+   /* _mesa_function_pool[52580]: Recti (offset 90) */
    "iiii\0"
    "glRecti\0"
    "\0"
-   /* _mesa_function_pool[52561]: VertexAttribI3ivEXT (will be remapped) */
+   /* _mesa_function_pool[52594]: VertexAttribI3ivEXT (will be remapped) */
    "ip\0"
    "glVertexAttribI3ivEXT\0"
    "glVertexAttribI3iv\0"
    "\0"
-   /* _mesa_function_pool[52606]: DeleteSamplers (will be remapped) */
+   /* _mesa_function_pool[52639]: DeleteSamplers (will be remapped) */
    "ip\0"
    "glDeleteSamplers\0"
    "\0"
-   /* _mesa_function_pool[52627]: SamplerParameteri (will be remapped) */
+   /* _mesa_function_pool[52660]: SamplerParameteri (will be remapped) */
    "iii\0"
    "glSamplerParameteri\0"
    "\0"
-   /* _mesa_function_pool[52652]: WindowRectanglesEXT (will be remapped) */
+   /* _mesa_function_pool[52685]: WindowRectanglesEXT (will be remapped) */
    "iip\0"
    "glWindowRectanglesEXT\0"
    "\0"
-   /* _mesa_function_pool[52679]: Rectf (offset 88) */
+   /* _mesa_function_pool[52712]: Rectf (offset 88) */
    "ffff\0"
    "glRectf\0"
    "\0"
-   /* _mesa_function_pool[52693]: Rectd (offset 86) */
+   /* _mesa_function_pool[52726]: Rectd (offset 86) */
    "dddd\0"
    "glRectd\0"
    "\0"
-   /* _mesa_function_pool[52707]: MultMatrixx (will be remapped) */
+   /* _mesa_function_pool[52740]: MultMatrixx (will be remapped) */
    "p\0"
    "glMultMatrixxOES\0"
    "glMultMatrixx\0"
    "\0"
-   /* _mesa_function_pool[52741]: TexStorageMem3DMultisampleEXT (will be remapped) */
+   /* _mesa_function_pool[52774]: TexStorageMem3DMultisampleEXT (will be remapped) */
    "iiiiiiiii\0"
    "glTexStorageMem3DMultisampleEXT\0"
    "\0"
-   /* _mesa_function_pool[52784]: Rects (offset 92) */
+   /* _mesa_function_pool[52817]: Rects (offset 92) */
    "iiii\0"
    "glRects\0"
    "\0"
-   /* _mesa_function_pool[52798]: CombinerParameterfNV (dynamic) */
+   /* _mesa_function_pool[52831]: CombinerParameterfNV (dynamic) */
    "if\0"
    "glCombinerParameterfNV\0"
    "\0"
-   /* _mesa_function_pool[52825]: GetVertexAttribIiv (will be remapped) */
+   /* _mesa_function_pool[52858]: GetVertexAttribIiv (will be remapped) */
    "iip\0"
    "glGetVertexAttribIivEXT\0"
    "glGetVertexAttribIiv\0"
    "\0"
-   /* _mesa_function_pool[52875]: ClientWaitSync (will be remapped) */
+   /* _mesa_function_pool[52908]: ClientWaitSync (will be remapped) */
    "iii\0"
    "glClientWaitSync\0"
    "\0"
-   /* _mesa_function_pool[52897]: TexCoord4s (offset 124) */
+   /* _mesa_function_pool[52930]: TexCoord4s (offset 124) */
    "iiii\0"
    "glTexCoord4s\0"
    "\0"
-   /* _mesa_function_pool[52916]: TexEnvxv (will be remapped) */
+   /* _mesa_function_pool[52949]: TexEnvxv (will be remapped) */
    "iip\0"
    "glTexEnvxvOES\0"
    "glTexEnvxv\0"
    "\0"
-   /* _mesa_function_pool[52946]: TexCoord4i (offset 122) */
+   /* _mesa_function_pool[52979]: TexCoord4i (offset 122) */
    "iiii\0"
    "glTexCoord4i\0"
    "\0"
-   /* _mesa_function_pool[52965]: ObjectPurgeableAPPLE (will be remapped) */
+   /* _mesa_function_pool[52998]: ObjectPurgeableAPPLE (will be remapped) */
    "iii\0"
    "glObjectPurgeableAPPLE\0"
    "\0"
-   /* _mesa_function_pool[52993]: ProgramUniform1ui64vARB (will be remapped) */
+   /* _mesa_function_pool[53026]: ProgramUniform1ui64vARB (will be remapped) */
    "iiip\0"
    "glProgramUniform1ui64vARB\0"
    "\0"
-   /* _mesa_function_pool[53025]: TexCoord4d (offset 118) */
+   /* _mesa_function_pool[53058]: TexCoord4d (offset 118) */
    "dddd\0"
    "glTexCoord4d\0"
    "\0"
-   /* _mesa_function_pool[53044]: TexCoord4f (offset 120) */
+   /* _mesa_function_pool[53077]: TexCoord4f (offset 120) */
    "ffff\0"
    "glTexCoord4f\0"
    "\0"
-   /* _mesa_function_pool[53063]: GetBooleanv (offset 258) */
+   /* _mesa_function_pool[53096]: GetBooleanv (offset 258) */
    "ip\0"
    "glGetBooleanv\0"
    "\0"
-   /* _mesa_function_pool[53081]: IsAsyncMarkerSGIX (dynamic) */
+   /* _mesa_function_pool[53114]: IsAsyncMarkerSGIX (dynamic) */
    "i\0"
    "glIsAsyncMarkerSGIX\0"
    "\0"
-   /* _mesa_function_pool[53104]: ProgramUniformMatrix3dv (will be remapped) */
+   /* _mesa_function_pool[53137]: ProgramUniformMatrix3dv (will be remapped) */
    "iiiip\0"
    "glProgramUniformMatrix3dv\0"
    "\0"
-   /* _mesa_function_pool[53137]: IsVertexArrayAPPLE (dynamic) */
+   /* _mesa_function_pool[53170]: IsVertexArrayAPPLE (dynamic) */
    "i\0"
    "glIsVertexArrayAPPLE\0"
    "\0"
-   /* _mesa_function_pool[53161]: LockArraysEXT (will be remapped) */
+   /* _mesa_function_pool[53194]: LockArraysEXT (will be remapped) */
    "ii\0"
    "glLockArraysEXT\0"
    "\0"
-   /* _mesa_function_pool[53181]: GetActiveUniformBlockiv (will be remapped) */
+   /* _mesa_function_pool[53214]: GetActiveUniformBlockiv (will be remapped) */
    "iiip\0"
    "glGetActiveUniformBlockiv\0"
    "\0"
-   /* _mesa_function_pool[53213]: GetPerfMonitorCountersAMD (will be remapped) */
+   /* _mesa_function_pool[53246]: GetPerfMonitorCountersAMD (will be remapped) */
    "ippip\0"
    "glGetPerfMonitorCountersAMD\0"
    "\0"
-   /* _mesa_function_pool[53248]: ObjectPtrLabel (will be remapped) */
+   /* _mesa_function_pool[53281]: ObjectPtrLabel (will be remapped) */
    "pip\0"
    "glObjectPtrLabel\0"
    "glObjectPtrLabelKHR\0"
    "\0"
-   /* _mesa_function_pool[53290]: Rectfv (offset 89) */
+   /* _mesa_function_pool[53323]: Rectfv (offset 89) */
    "pp\0"
    "glRectfv\0"
    "\0"
-   /* _mesa_function_pool[53303]: BindImageTexture (will be remapped) */
+   /* _mesa_function_pool[53336]: BindImageTexture (will be remapped) */
    "iiiiiii\0"
    "glBindImageTexture\0"
    "\0"
-   /* _mesa_function_pool[53331]: VertexP4uiv (will be remapped) */
+   /* _mesa_function_pool[53364]: VertexP4uiv (will be remapped) */
    "ip\0"
    "glVertexP4uiv\0"
    "\0"
-   /* _mesa_function_pool[53349]: GetUniformSubroutineuiv (will be remapped) */
+   /* _mesa_function_pool[53382]: GetUniformSubroutineuiv (will be remapped) */
    "iip\0"
    "glGetUniformSubroutineuiv\0"
    "\0"
-   /* _mesa_function_pool[53380]: MinSampleShading (will be remapped) */
+   /* _mesa_function_pool[53413]: MinSampleShading (will be remapped) */
    "f\0"
    "glMinSampleShadingARB\0"
    "glMinSampleShading\0"
    "glMinSampleShadingOES\0"
    "\0"
-   /* _mesa_function_pool[53446]: GetRenderbufferParameteriv (will be remapped) */
+   /* _mesa_function_pool[53479]: GetRenderbufferParameteriv (will be remapped) */
    "iip\0"
    "glGetRenderbufferParameteriv\0"
    "glGetRenderbufferParameterivEXT\0"
    "glGetRenderbufferParameterivOES\0"
    "\0"
-   /* _mesa_function_pool[53544]: EdgeFlagPointerListIBM (dynamic) */
+   /* _mesa_function_pool[53577]: EdgeFlagPointerListIBM (dynamic) */
    "ipi\0"
    "glEdgeFlagPointerListIBM\0"
    "\0"
-   /* _mesa_function_pool[53574]: VertexAttrib1dNV (will be remapped) */
+   /* _mesa_function_pool[53607]: VertexAttrib1dNV (will be remapped) */
    "id\0"
    "glVertexAttrib1dNV\0"
    "\0"
-   /* _mesa_function_pool[53597]: WindowPos2sv (will be remapped) */
+   /* _mesa_function_pool[53630]: WindowPos2sv (will be remapped) */
    "p\0"
    "glWindowPos2sv\0"
    "glWindowPos2svARB\0"
    "glWindowPos2svMESA\0"
    "\0"
-   /* _mesa_function_pool[53652]: VertexArrayRangeNV (dynamic) */
+   /* _mesa_function_pool[53685]: VertexArrayRangeNV (dynamic) */
    "ip\0"
    "glVertexArrayRangeNV\0"
    "\0"
-   /* _mesa_function_pool[53677]: GetPerfMonitorCounterStringAMD (will be remapped) */
+   /* _mesa_function_pool[53710]: GetPerfMonitorCounterStringAMD (will be remapped) */
    "iiipp\0"
    "glGetPerfMonitorCounterStringAMD\0"
    "\0"
-   /* _mesa_function_pool[53717]: EndFragmentShaderATI (will be remapped) */
+   /* _mesa_function_pool[53750]: EndFragmentShaderATI (will be remapped) */
    "\0"
    "glEndFragmentShaderATI\0"
    "\0"
-   /* _mesa_function_pool[53742]: Uniform4iv (will be remapped) */
+   /* _mesa_function_pool[53775]: Uniform4iv (will be remapped) */
    "iip\0"
    "glUniform4iv\0"
    "glUniform4ivARB\0"
    "\0"
-   /* _mesa_function_pool[53776]: CreateMemoryObjectsEXT (will be remapped) */
+   /* _mesa_function_pool[53809]: CreateMemoryObjectsEXT (will be remapped) */
    "ip\0"
    "glCreateMemoryObjectsEXT\0"
    "\0"
@@ -7236,1009 +7240,1010 @@ static const char _mesa_function_pool[] =
 
 /* these functions need to be remapped */
 static const struct gl_function_pool_remap MESA_remap_table_functions[] = {
-   { 22294, CompressedTexImage1D_remap_index },
-   { 19215, CompressedTexImage2D_remap_index },
-   { 14168, CompressedTexImage3D_remap_index },
-   { 35026, CompressedTexSubImage1D_remap_index },
-   { 42247, CompressedTexSubImage2D_remap_index },
-   {  7488, CompressedTexSubImage3D_remap_index },
-   {  4964, GetCompressedTexImage_remap_index },
-   { 21356, LoadTransposeMatrixd_remap_index },
-   { 21304, LoadTransposeMatrixf_remap_index },
-   { 39168, MultTransposeMatrixd_remap_index },
-   { 15611, MultTransposeMatrixf_remap_index },
-   { 37815, SampleCoverage_remap_index },
+   { 22327, CompressedTexImage1D_remap_index },
+   { 19248, CompressedTexImage2D_remap_index },
+   { 14201, CompressedTexImage3D_remap_index },
+   { 35059, CompressedTexSubImage1D_remap_index },
+   { 42280, CompressedTexSubImage2D_remap_index },
+   {  7521, CompressedTexSubImage3D_remap_index },
+   {  4997, GetCompressedTexImage_remap_index },
+   { 21389, LoadTransposeMatrixd_remap_index },
+   { 21337, LoadTransposeMatrixf_remap_index },
+   { 39201, MultTransposeMatrixd_remap_index },
+   { 15644, MultTransposeMatrixf_remap_index },
+   { 37848, SampleCoverage_remap_index },
    {  4111, BlendFuncSeparate_remap_index },
-   { 25633, FogCoordPointer_remap_index },
-   { 46711, FogCoordd_remap_index },
-   { 46374, FogCoorddv_remap_index },
-   { 38042, MultiDrawArrays_remap_index },
-   { 35973, PointParameterf_remap_index },
-   {  5766, PointParameterfv_remap_index },
-   { 35931, PointParameteri_remap_index },
-   { 10349, PointParameteriv_remap_index },
-   {  6218, SecondaryColor3b_remap_index },
-   { 46189, SecondaryColor3bv_remap_index },
-   { 39369, SecondaryColor3d_remap_index },
-   { 14324, SecondaryColor3dv_remap_index },
-   {  6348, SecondaryColor3i_remap_index },
-   { 33933, SecondaryColor3iv_remap_index },
-   {  6064, SecondaryColor3s_remap_index },
-   { 18336, SecondaryColor3sv_remap_index },
-   { 25819, SecondaryColor3ub_remap_index },
-   {  8682, SecondaryColor3ubv_remap_index },
-   { 25900, SecondaryColor3ui_remap_index },
-   { 28140, SecondaryColor3uiv_remap_index },
-   { 25677, SecondaryColor3us_remap_index },
-   { 11602, SecondaryColor3usv_remap_index },
-   { 40669, SecondaryColorPointer_remap_index },
-   { 13900, WindowPos2d_remap_index },
-   { 20202, WindowPos2dv_remap_index },
-   { 13847, WindowPos2f_remap_index },
-   { 27400, WindowPos2fv_remap_index },
-   { 13979, WindowPos2i_remap_index },
-   {  7822, WindowPos2iv_remap_index },
-   { 14032, WindowPos2s_remap_index },
-   { 53597, WindowPos2sv_remap_index },
-   { 18698, WindowPos3d_remap_index },
-   { 18033, WindowPos3dv_remap_index },
-   { 18811, WindowPos3f_remap_index },
-   { 10208, WindowPos3fv_remap_index },
-   { 18920, WindowPos3i_remap_index },
-   { 52357, WindowPos3iv_remap_index },
-   { 19036, WindowPos3s_remap_index },
-   { 29026, WindowPos3sv_remap_index },
-   {  7688, BeginQuery_remap_index },
-   { 52208, BindBuffer_remap_index },
-   { 44879, BufferData_remap_index },
-   { 12146, BufferSubData_remap_index },
-   { 36301, DeleteBuffers_remap_index },
-   { 26182, DeleteQueries_remap_index },
-   { 23265, EndQuery_remap_index },
-   { 49246, GenBuffers_remap_index },
+   { 25666, FogCoordPointer_remap_index },
+   { 46744, FogCoordd_remap_index },
+   { 46407, FogCoorddv_remap_index },
+   { 38075, MultiDrawArrays_remap_index },
+   { 36006, PointParameterf_remap_index },
+   {  5799, PointParameterfv_remap_index },
+   { 35964, PointParameteri_remap_index },
+   { 10382, PointParameteriv_remap_index },
+   {  6251, SecondaryColor3b_remap_index },
+   { 46222, SecondaryColor3bv_remap_index },
+   { 39402, SecondaryColor3d_remap_index },
+   { 14357, SecondaryColor3dv_remap_index },
+   {  6381, SecondaryColor3i_remap_index },
+   { 33966, SecondaryColor3iv_remap_index },
+   {  6097, SecondaryColor3s_remap_index },
+   { 18369, SecondaryColor3sv_remap_index },
+   { 25852, SecondaryColor3ub_remap_index },
+   {  8715, SecondaryColor3ubv_remap_index },
+   { 25933, SecondaryColor3ui_remap_index },
+   { 28173, SecondaryColor3uiv_remap_index },
+   { 25710, SecondaryColor3us_remap_index },
+   { 11635, SecondaryColor3usv_remap_index },
+   { 40702, SecondaryColorPointer_remap_index },
+   { 13933, WindowPos2d_remap_index },
+   { 20235, WindowPos2dv_remap_index },
+   { 13880, WindowPos2f_remap_index },
+   { 27433, WindowPos2fv_remap_index },
+   { 14012, WindowPos2i_remap_index },
+   {  7855, WindowPos2iv_remap_index },
+   { 14065, WindowPos2s_remap_index },
+   { 53630, WindowPos2sv_remap_index },
+   { 18731, WindowPos3d_remap_index },
+   { 18066, WindowPos3dv_remap_index },
+   { 18844, WindowPos3f_remap_index },
+   { 10241, WindowPos3fv_remap_index },
+   { 18953, WindowPos3i_remap_index },
+   { 52390, WindowPos3iv_remap_index },
+   { 19069, WindowPos3s_remap_index },
+   { 29059, WindowPos3sv_remap_index },
+   {  7721, BeginQuery_remap_index },
+   { 52241, BindBuffer_remap_index },
+   { 44912, BufferData_remap_index },
+   { 12179, BufferSubData_remap_index },
+   { 36334, DeleteBuffers_remap_index },
+   { 26215, DeleteQueries_remap_index },
+   { 23298, EndQuery_remap_index },
+   { 49279, GenBuffers_remap_index },
    {  2263, GenQueries_remap_index },
-   { 33282, GetBufferParameteriv_remap_index },
-   { 49079, GetBufferPointerv_remap_index },
-   { 36340, GetBufferSubData_remap_index },
-   {  9805, GetQueryObjectiv_remap_index },
-   {  9353, GetQueryObjectuiv_remap_index },
-   { 14517, GetQueryiv_remap_index },
-   { 21864, IsBuffer_remap_index },
-   { 33584, IsQuery_remap_index },
-   { 14672, MapBuffer_remap_index },
-   { 51830, UnmapBuffer_remap_index },
+   { 33315, GetBufferParameteriv_remap_index },
+   { 49112, GetBufferPointerv_remap_index },
+   { 36373, GetBufferSubData_remap_index },
+   {  9838, GetQueryObjectiv_remap_index },
+   {  9386, GetQueryObjectuiv_remap_index },
+   { 14550, GetQueryiv_remap_index },
+   { 21897, IsBuffer_remap_index },
+   { 33617, IsQuery_remap_index },
+   { 14705, MapBuffer_remap_index },
+   { 51863, UnmapBuffer_remap_index },
    {   330, AttachShader_remap_index },
-   { 42951, BindAttribLocation_remap_index },
-   { 49343, BlendEquationSeparate_remap_index },
-   { 37594, CompileShader_remap_index },
-   { 29387, CreateProgram_remap_index },
-   { 36190, CreateShader_remap_index },
-   { 24302, DeleteProgram_remap_index },
-   { 37539, DeleteShader_remap_index },
-   { 51293, DetachShader_remap_index },
-   { 40282, DisableVertexAttribArray_remap_index },
-   { 27080, DrawBuffers_remap_index },
-   { 44303, EnableVertexAttribArray_remap_index },
-   { 43737, GetActiveAttrib_remap_index },
-   { 50106, GetActiveUniform_remap_index },
-   { 20822, GetAttachedShaders_remap_index },
-   { 32066, GetAttribLocation_remap_index },
-   { 13465, GetProgramInfoLog_remap_index },
-   { 26815, GetProgramiv_remap_index },
-   {  4657, GetShaderInfoLog_remap_index },
-   {  9044, GetShaderSource_remap_index },
-   { 20558, GetShaderiv_remap_index },
-   {  7755, GetUniformLocation_remap_index },
-   { 15764, GetUniformfv_remap_index },
+   { 42984, BindAttribLocation_remap_index },
+   { 49376, BlendEquationSeparate_remap_index },
+   { 37627, CompileShader_remap_index },
+   { 29420, CreateProgram_remap_index },
+   { 36223, CreateShader_remap_index },
+   { 24335, DeleteProgram_remap_index },
+   { 37572, DeleteShader_remap_index },
+   { 51326, DetachShader_remap_index },
+   { 40315, DisableVertexAttribArray_remap_index },
+   { 27113, DrawBuffers_remap_index },
+   { 44336, EnableVertexAttribArray_remap_index },
+   { 43770, GetActiveAttrib_remap_index },
+   { 50139, GetActiveUniform_remap_index },
+   { 20855, GetAttachedShaders_remap_index },
+   { 32099, GetAttribLocation_remap_index },
+   { 13498, GetProgramInfoLog_remap_index },
+   { 26848, GetProgramiv_remap_index },
+   {  4690, GetShaderInfoLog_remap_index },
+   {  9077, GetShaderSource_remap_index },
+   { 20591, GetShaderiv_remap_index },
+   {  7788, GetUniformLocation_remap_index },
+   { 15797, GetUniformfv_remap_index },
    {  2581, GetUniformiv_remap_index },
-   { 41108, GetVertexAttribPointerv_remap_index },
-   { 49031, GetVertexAttribdv_remap_index },
-   { 41941, GetVertexAttribfv_remap_index },
-   { 45053, GetVertexAttribiv_remap_index },
-   {  5158, IsProgram_remap_index },
-   { 45600, IsShader_remap_index },
-   { 34126, LinkProgram_remap_index },
-   { 44675, ShaderSource_remap_index },
-   { 44647, StencilFuncSeparate_remap_index },
-   { 42330, StencilMaskSeparate_remap_index },
-   { 43961, StencilOpSeparate_remap_index },
-   { 48098, Uniform1f_remap_index },
-   { 10035, Uniform1fv_remap_index },
-   { 48174, Uniform1i_remap_index },
-   { 22146, Uniform1iv_remap_index },
-   { 50811, Uniform2f_remap_index },
-   { 26981, Uniform2fv_remap_index },
-   { 50900, Uniform2i_remap_index },
-   { 24559, Uniform2iv_remap_index },
+   { 41141, GetVertexAttribPointerv_remap_index },
+   { 49064, GetVertexAttribdv_remap_index },
+   { 41974, GetVertexAttribfv_remap_index },
+   { 45086, GetVertexAttribiv_remap_index },
+   {  5191, IsProgram_remap_index },
+   { 45633, IsShader_remap_index },
+   { 34159, LinkProgram_remap_index },
+   { 44708, ShaderSource_remap_index },
+   { 44680, StencilFuncSeparate_remap_index },
+   { 42363, StencilMaskSeparate_remap_index },
+   { 43994, StencilOpSeparate_remap_index },
+   { 48131, Uniform1f_remap_index },
+   { 10068, Uniform1fv_remap_index },
+   { 48207, Uniform1i_remap_index },
+   { 22179, Uniform1iv_remap_index },
+   { 50844, Uniform2f_remap_index },
+   { 27014, Uniform2fv_remap_index },
+   { 50933, Uniform2i_remap_index },
+   { 24592, Uniform2iv_remap_index },
    {  1016, Uniform3f_remap_index },
-   { 45165, Uniform3fv_remap_index },
+   { 45198, Uniform3fv_remap_index },
    {   906, Uniform3i_remap_index },
-   { 46766, Uniform3iv_remap_index },
-   {  5517, Uniform4f_remap_index },
-   { 10907, Uniform4fv_remap_index },
-   {  5464, Uniform4i_remap_index },
-   { 53742, Uniform4iv_remap_index },
-   { 12263, UniformMatrix2fv_remap_index },
-   { 27866, UniformMatrix3fv_remap_index },
-   { 12850, UniformMatrix4fv_remap_index },
-   { 48332, UseProgram_remap_index },
-   { 29503, ValidateProgram_remap_index },
-   { 22253, VertexAttrib1d_remap_index },
-   { 45523, VertexAttrib1dv_remap_index },
-   { 22443, VertexAttrib1s_remap_index },
-   { 41762, VertexAttrib1sv_remap_index },
-   {  9961, VertexAttrib2d_remap_index },
-   { 28728, VertexAttrib2dv_remap_index },
-   {  9873, VertexAttrib2s_remap_index },
-   { 17469, VertexAttrib2sv_remap_index },
-   { 14567, VertexAttrib3d_remap_index },
-   { 26905, VertexAttrib3dv_remap_index },
-   { 14426, VertexAttrib3s_remap_index },
-   { 47888, VertexAttrib3sv_remap_index },
-   { 14744, VertexAttrib4Nbv_remap_index },
-   { 34022, VertexAttrib4Niv_remap_index },
-   { 24895, VertexAttrib4Nsv_remap_index },
+   { 46799, Uniform3iv_remap_index },
+   {  5550, Uniform4f_remap_index },
+   { 10940, Uniform4fv_remap_index },
+   {  5497, Uniform4i_remap_index },
+   { 53775, Uniform4iv_remap_index },
+   { 12296, UniformMatrix2fv_remap_index },
+   { 27899, UniformMatrix3fv_remap_index },
+   { 12883, UniformMatrix4fv_remap_index },
+   { 48365, UseProgram_remap_index },
+   { 29536, ValidateProgram_remap_index },
+   { 22286, VertexAttrib1d_remap_index },
+   { 45556, VertexAttrib1dv_remap_index },
+   { 22476, VertexAttrib1s_remap_index },
+   { 41795, VertexAttrib1sv_remap_index },
+   {  9994, VertexAttrib2d_remap_index },
+   { 28761, VertexAttrib2dv_remap_index },
+   {  9906, VertexAttrib2s_remap_index },
+   { 17502, VertexAttrib2sv_remap_index },
+   { 14600, VertexAttrib3d_remap_index },
+   { 26938, VertexAttrib3dv_remap_index },
+   { 14459, VertexAttrib3s_remap_index },
+   { 47921, VertexAttrib3sv_remap_index },
+   { 14777, VertexAttrib4Nbv_remap_index },
+   { 34055, VertexAttrib4Niv_remap_index },
+   { 24928, VertexAttrib4Nsv_remap_index },
    {  1687, VertexAttrib4Nub_remap_index },
-   { 39703, VertexAttrib4Nubv_remap_index },
-   { 12924, VertexAttrib4Nuiv_remap_index },
-   { 42749, VertexAttrib4Nusv_remap_index },
-   { 11532, VertexAttrib4bv_remap_index },
-   { 34375, VertexAttrib4d_remap_index },
-   { 34920, VertexAttrib4dv_remap_index },
-   { 46886, VertexAttrib4iv_remap_index },
-   { 34475, VertexAttrib4s_remap_index },
-   { 23398, VertexAttrib4sv_remap_index },
-   { 12517, VertexAttrib4ubv_remap_index },
-   { 24850, VertexAttrib4uiv_remap_index },
+   { 39736, VertexAttrib4Nubv_remap_index },
+   { 12957, VertexAttrib4Nuiv_remap_index },
+   { 42782, VertexAttrib4Nusv_remap_index },
+   { 11565, VertexAttrib4bv_remap_index },
+   { 34408, VertexAttrib4d_remap_index },
+   { 34953, VertexAttrib4dv_remap_index },
+   { 46919, VertexAttrib4iv_remap_index },
+   { 34508, VertexAttrib4s_remap_index },
+   { 23431, VertexAttrib4sv_remap_index },
+   { 12550, VertexAttrib4ubv_remap_index },
+   { 24883, VertexAttrib4uiv_remap_index },
    {  1613, VertexAttrib4usv_remap_index },
-   { 39797, VertexAttribPointer_remap_index },
-   { 35737, UniformMatrix2x3fv_remap_index },
+   { 39830, VertexAttribPointer_remap_index },
+   { 35770, UniformMatrix2x3fv_remap_index },
    {  1049, UniformMatrix2x4fv_remap_index },
-   { 12897, UniformMatrix3x2fv_remap_index },
-   { 52520, UniformMatrix3x4fv_remap_index },
-   { 47317, UniformMatrix4x2fv_remap_index },
-   { 14469, UniformMatrix4x3fv_remap_index },
-   { 20464, BeginConditionalRender_remap_index },
-   { 29632, BeginTransformFeedback_remap_index },
-   {  9763, BindBufferBase_remap_index },
-   {  9651, BindBufferRange_remap_index },
-   { 27564, BindFragDataLocation_remap_index },
-   { 28836, ClampColor_remap_index },
-   { 20849, ClearBufferfi_remap_index },
-   { 20673, ClearBufferfv_remap_index },
-   { 25493, ClearBufferiv_remap_index },
-   { 46452, ClearBufferuiv_remap_index },
-   { 16254, ColorMaski_remap_index },
-   {  7425, Disablei_remap_index },
-   { 18752, Enablei_remap_index },
-   { 28188, EndConditionalRender_remap_index },
-   { 24049, EndTransformFeedback_remap_index },
-   { 14966, GetBooleani_v_remap_index },
-   { 48430, GetFragDataLocation_remap_index },
-   { 25514, GetIntegeri_v_remap_index },
-   { 34885, GetStringi_remap_index },
-   { 36962, GetTexParameterIiv_remap_index },
-   { 47746, GetTexParameterIuiv_remap_index },
-   { 37200, GetTransformFeedbackVarying_remap_index },
+   { 12930, UniformMatrix3x2fv_remap_index },
+   { 52553, UniformMatrix3x4fv_remap_index },
+   { 47350, UniformMatrix4x2fv_remap_index },
+   { 14502, UniformMatrix4x3fv_remap_index },
+   { 20497, BeginConditionalRender_remap_index },
+   { 29665, BeginTransformFeedback_remap_index },
+   {  9796, BindBufferBase_remap_index },
+   {  9684, BindBufferRange_remap_index },
+   { 27597, BindFragDataLocation_remap_index },
+   { 28869, ClampColor_remap_index },
+   { 20882, ClearBufferfi_remap_index },
+   { 20706, ClearBufferfv_remap_index },
+   { 25526, ClearBufferiv_remap_index },
+   { 46485, ClearBufferuiv_remap_index },
+   { 16287, ColorMaski_remap_index },
+   {  7458, Disablei_remap_index },
+   { 18785, Enablei_remap_index },
+   { 28221, EndConditionalRender_remap_index },
+   { 24082, EndTransformFeedback_remap_index },
+   { 14999, GetBooleani_v_remap_index },
+   { 48463, GetFragDataLocation_remap_index },
+   { 25547, GetIntegeri_v_remap_index },
+   { 34918, GetStringi_remap_index },
+   { 36995, GetTexParameterIiv_remap_index },
+   { 47779, GetTexParameterIuiv_remap_index },
+   { 37233, GetTransformFeedbackVarying_remap_index },
    {  3594, GetUniformuiv_remap_index },
-   { 52825, GetVertexAttribIiv_remap_index },
-   { 25227, GetVertexAttribIuiv_remap_index },
-   { 40991, IsEnabledi_remap_index },
-   { 37679, TexParameterIiv_remap_index },
-   { 20257, TexParameterIuiv_remap_index },
-   { 47823, TransformFeedbackVaryings_remap_index },
-   { 41490, Uniform1ui_remap_index },
-   { 31426, Uniform1uiv_remap_index },
-   { 30669, Uniform2ui_remap_index },
-   { 16328, Uniform2uiv_remap_index },
-   { 40176, Uniform3ui_remap_index },
-   { 23457, Uniform3uiv_remap_index },
-   { 14855, Uniform4ui_remap_index },
-   { 22180, Uniform4uiv_remap_index },
-   { 43238, VertexAttribI1iv_remap_index },
-   { 14277, VertexAttribI1uiv_remap_index },
-   {  9424, VertexAttribI4bv_remap_index },
-   { 29571, VertexAttribI4sv_remap_index },
-   { 10628, VertexAttribI4ubv_remap_index },
+   { 52858, GetVertexAttribIiv_remap_index },
+   { 25260, GetVertexAttribIuiv_remap_index },
+   { 41024, IsEnabledi_remap_index },
+   { 37712, TexParameterIiv_remap_index },
+   { 20290, TexParameterIuiv_remap_index },
+   { 47856, TransformFeedbackVaryings_remap_index },
+   { 41523, Uniform1ui_remap_index },
+   { 31459, Uniform1uiv_remap_index },
+   { 30702, Uniform2ui_remap_index },
+   { 16361, Uniform2uiv_remap_index },
+   { 40209, Uniform3ui_remap_index },
+   { 23490, Uniform3uiv_remap_index },
+   { 14888, Uniform4ui_remap_index },
+   { 22213, Uniform4uiv_remap_index },
+   { 43271, VertexAttribI1iv_remap_index },
+   { 14310, VertexAttribI1uiv_remap_index },
+   {  9457, VertexAttribI4bv_remap_index },
+   { 29604, VertexAttribI4sv_remap_index },
+   { 10661, VertexAttribI4ubv_remap_index },
    {   466, VertexAttribI4usv_remap_index },
-   { 49538, VertexAttribIPointer_remap_index },
-   { 10540, PrimitiveRestartIndex_remap_index },
-   { 41260, TexBuffer_remap_index },
+   { 49571, VertexAttribIPointer_remap_index },
+   { 10573, PrimitiveRestartIndex_remap_index },
+   { 41293, TexBuffer_remap_index },
    {  1849, FramebufferTexture_remap_index },
-   { 29357, GetBufferParameteri64v_remap_index },
-   { 21760, GetInteger64i_v_remap_index },
-   { 49878, VertexAttribDivisor_remap_index },
-   { 53380, MinSampleShading_remap_index },
-   { 25169, MemoryBarrierByRegion_remap_index },
-   {  9089, BindProgramARB_remap_index },
-   { 37910, DeleteProgramsARB_remap_index },
-   { 18865, GenProgramsARB_remap_index },
-   { 17512, GetProgramEnvParameterdvARB_remap_index },
-   { 36266, GetProgramEnvParameterfvARB_remap_index },
-   { 38087, GetProgramLocalParameterdvARB_remap_index },
-   { 45904, GetProgramLocalParameterfvARB_remap_index },
-   { 27795, GetProgramStringARB_remap_index },
-   { 10426, GetProgramivARB_remap_index },
-   { 38438, IsProgramARB_remap_index },
-   { 21424, ProgramEnvParameter4dARB_remap_index },
+   { 29390, GetBufferParameteri64v_remap_index },
+   { 21793, GetInteger64i_v_remap_index },
+   { 49911, VertexAttribDivisor_remap_index },
+   { 53413, MinSampleShading_remap_index },
+   { 25202, MemoryBarrierByRegion_remap_index },
+   {  9122, BindProgramARB_remap_index },
+   { 37943, DeleteProgramsARB_remap_index },
+   { 18898, GenProgramsARB_remap_index },
+   { 17545, GetProgramEnvParameterdvARB_remap_index },
+   { 36299, GetProgramEnvParameterfvARB_remap_index },
+   { 38120, GetProgramLocalParameterdvARB_remap_index },
+   { 45937, GetProgramLocalParameterfvARB_remap_index },
+   { 27828, GetProgramStringARB_remap_index },
+   { 10459, GetProgramivARB_remap_index },
+   { 38471, IsProgramARB_remap_index },
+   { 21457, ProgramEnvParameter4dARB_remap_index },
    {  3377, ProgramEnvParameter4dvARB_remap_index },
-   { 47513, ProgramEnvParameter4fARB_remap_index },
-   { 30248, ProgramEnvParameter4fvARB_remap_index },
-   { 28238, ProgramLocalParameter4dARB_remap_index },
-   {  5020, ProgramLocalParameter4dvARB_remap_index },
-   { 37475, ProgramLocalParameter4fARB_remap_index },
-   { 23807, ProgramLocalParameter4fvARB_remap_index },
-   { 38510, ProgramStringARB_remap_index },
-   { 14925, VertexAttrib1fARB_remap_index },
-   { 39045, VertexAttrib1fvARB_remap_index },
-   { 27285, VertexAttrib2fARB_remap_index },
-   { 16575, VertexAttrib2fvARB_remap_index },
+   { 47546, ProgramEnvParameter4fARB_remap_index },
+   { 30281, ProgramEnvParameter4fvARB_remap_index },
+   { 28271, ProgramLocalParameter4dARB_remap_index },
+   {  5053, ProgramLocalParameter4dvARB_remap_index },
+   { 37508, ProgramLocalParameter4fARB_remap_index },
+   { 23840, ProgramLocalParameter4fvARB_remap_index },
+   { 38543, ProgramStringARB_remap_index },
+   { 14958, VertexAttrib1fARB_remap_index },
+   { 39078, VertexAttrib1fvARB_remap_index },
+   { 27318, VertexAttrib2fARB_remap_index },
+   { 16608, VertexAttrib2fvARB_remap_index },
    {   349, VertexAttrib3fARB_remap_index },
-   { 32464, VertexAttrib3fvARB_remap_index },
-   { 31112, VertexAttrib4fARB_remap_index },
-   { 17967, VertexAttrib4fvARB_remap_index },
-   { 44090, AttachObjectARB_remap_index },
-   { 27839, CreateProgramObjectARB_remap_index },
-   { 20747, CreateShaderObjectARB_remap_index },
-   { 19274, DeleteObjectARB_remap_index },
-   { 47076, DetachObjectARB_remap_index },
-   { 44514, GetAttachedObjectsARB_remap_index },
-   { 30453, GetHandleARB_remap_index },
-   { 25344, GetInfoLogARB_remap_index },
-   { 26367, GetObjectParameterfvARB_remap_index },
-   { 51403, GetObjectParameterivARB_remap_index },
-   {  7022, DrawArraysInstancedARB_remap_index },
-   {  9268, DrawElementsInstancedARB_remap_index },
-   { 17266, BindFramebuffer_remap_index },
-   { 10449, BindRenderbuffer_remap_index },
-   { 41544, BlitFramebuffer_remap_index },
-   {  8110, CheckFramebufferStatus_remap_index },
-   { 24751, DeleteFramebuffers_remap_index },
-   { 45447, DeleteRenderbuffers_remap_index },
-   { 38348, FramebufferRenderbuffer_remap_index },
-   { 41620, FramebufferTexture1D_remap_index },
-   { 28617, FramebufferTexture2D_remap_index },
-   { 33168, FramebufferTexture3D_remap_index },
-   { 45718, FramebufferTextureLayer_remap_index },
-   { 49150, GenFramebuffers_remap_index },
-   { 40836, GenRenderbuffers_remap_index },
-   {  9591, GenerateMipmap_remap_index },
-   {  6582, GetFramebufferAttachmentParameteriv_remap_index },
-   { 53446, GetRenderbufferParameteriv_remap_index },
-   {  8353, IsFramebuffer_remap_index },
-   { 31508, IsRenderbuffer_remap_index },
+   { 32497, VertexAttrib3fvARB_remap_index },
+   { 31145, VertexAttrib4fARB_remap_index },
+   { 18000, VertexAttrib4fvARB_remap_index },
+   { 44123, AttachObjectARB_remap_index },
+   { 27872, CreateProgramObjectARB_remap_index },
+   { 20780, CreateShaderObjectARB_remap_index },
+   { 19307, DeleteObjectARB_remap_index },
+   { 47109, DetachObjectARB_remap_index },
+   { 44547, GetAttachedObjectsARB_remap_index },
+   { 30486, GetHandleARB_remap_index },
+   { 25377, GetInfoLogARB_remap_index },
+   { 26400, GetObjectParameterfvARB_remap_index },
+   { 51436, GetObjectParameterivARB_remap_index },
+   {  7055, DrawArraysInstancedARB_remap_index },
+   {  9301, DrawElementsInstancedARB_remap_index },
+   { 17299, BindFramebuffer_remap_index },
+   { 10482, BindRenderbuffer_remap_index },
+   { 41577, BlitFramebuffer_remap_index },
+   {  8143, CheckFramebufferStatus_remap_index },
+   { 24784, DeleteFramebuffers_remap_index },
+   { 45480, DeleteRenderbuffers_remap_index },
+   { 38381, FramebufferRenderbuffer_remap_index },
+   { 41653, FramebufferTexture1D_remap_index },
+   { 28650, FramebufferTexture2D_remap_index },
+   { 33201, FramebufferTexture3D_remap_index },
+   { 45751, FramebufferTextureLayer_remap_index },
+   { 49183, GenFramebuffers_remap_index },
+   { 40869, GenRenderbuffers_remap_index },
+   {  9624, GenerateMipmap_remap_index },
+   {  6615, GetFramebufferAttachmentParameteriv_remap_index },
+   { 53479, GetRenderbufferParameteriv_remap_index },
+   {  8386, IsFramebuffer_remap_index },
+   { 31541, IsRenderbuffer_remap_index },
    {   733, RenderbufferStorage_remap_index },
-   { 18588, RenderbufferStorageMultisample_remap_index },
-   {  6478, FlushMappedBufferRange_remap_index },
-   { 38153, MapBufferRange_remap_index },
-   { 16421, BindVertexArray_remap_index },
+   { 18621, RenderbufferStorageMultisample_remap_index },
+   {  6511, FlushMappedBufferRange_remap_index },
+   { 38186, MapBufferRange_remap_index },
+   { 16454, BindVertexArray_remap_index },
    {  1267, DeleteVertexArrays_remap_index },
-   { 48682, GenVertexArrays_remap_index },
-   { 47955, IsVertexArray_remap_index },
-   { 16113, GetActiveUniformBlockName_remap_index },
-   { 53181, GetActiveUniformBlockiv_remap_index },
-   { 24123, GetActiveUniformName_remap_index },
-   { 17440, GetActiveUniformsiv_remap_index },
-   { 51266, GetUniformBlockIndex_remap_index },
-   { 13021, GetUniformIndices_remap_index },
-   { 42665, UniformBlockBinding_remap_index },
-   { 52475, CopyBufferSubData_remap_index },
-   { 52875, ClientWaitSync_remap_index },
-   { 14130, DeleteSync_remap_index },
-   { 42692, FenceSync_remap_index },
-   { 47056, GetInteger64v_remap_index },
-   { 49734, GetSynciv_remap_index },
-   { 19354, IsSync_remap_index },
-   { 41092, WaitSync_remap_index },
-   { 16148, DrawElementsBaseVertex_remap_index },
-   { 20953, DrawElementsInstancedBaseVertex_remap_index },
-   { 46007, DrawRangeElementsBaseVertex_remap_index },
-   { 50932, MultiDrawElementsBaseVertex_remap_index },
-   { 29944, ProvokingVertex_remap_index },
-   {  6926, GetMultisamplefv_remap_index },
-   { 43345, SampleMaski_remap_index },
+   { 48715, GenVertexArrays_remap_index },
+   { 47988, IsVertexArray_remap_index },
+   { 16146, GetActiveUniformBlockName_remap_index },
+   { 53214, GetActiveUniformBlockiv_remap_index },
+   { 24156, GetActiveUniformName_remap_index },
+   { 17473, GetActiveUniformsiv_remap_index },
+   { 51299, GetUniformBlockIndex_remap_index },
+   { 13054, GetUniformIndices_remap_index },
+   { 42698, UniformBlockBinding_remap_index },
+   { 52508, CopyBufferSubData_remap_index },
+   { 52908, ClientWaitSync_remap_index },
+   { 14163, DeleteSync_remap_index },
+   { 42725, FenceSync_remap_index },
+   { 47089, GetInteger64v_remap_index },
+   { 49767, GetSynciv_remap_index },
+   { 19387, IsSync_remap_index },
+   { 41125, WaitSync_remap_index },
+   { 16181, DrawElementsBaseVertex_remap_index },
+   { 20986, DrawElementsInstancedBaseVertex_remap_index },
+   { 46040, DrawRangeElementsBaseVertex_remap_index },
+   { 50965, MultiDrawElementsBaseVertex_remap_index },
+   { 29977, ProvokingVertex_remap_index },
+   {  6959, GetMultisamplefv_remap_index },
+   { 43378, SampleMaski_remap_index },
    {  2451, TexImage2DMultisample_remap_index },
-   { 51209, TexImage3DMultisample_remap_index },
-   { 28349, BlendEquationSeparateiARB_remap_index },
-   { 33729, BlendEquationiARB_remap_index },
-   {  4709, BlendFuncSeparateiARB_remap_index },
-   { 30489, BlendFunciARB_remap_index },
+   { 51242, TexImage3DMultisample_remap_index },
+   { 28382, BlendEquationSeparateiARB_remap_index },
+   { 33762, BlendEquationiARB_remap_index },
+   {  4742, BlendFuncSeparateiARB_remap_index },
+   { 30522, BlendFunciARB_remap_index },
    {  2040, BindFragDataLocationIndexed_remap_index },
-   { 35514, GetFragDataIndex_remap_index },
+   { 35547, GetFragDataIndex_remap_index },
    {  3576, BindSampler_remap_index },
-   { 52606, DeleteSamplers_remap_index },
-   { 44010, GenSamplers_remap_index },
+   { 52639, DeleteSamplers_remap_index },
+   { 44043, GenSamplers_remap_index },
    {  3105, GetSamplerParameterIiv_remap_index },
-   {  7336, GetSamplerParameterIuiv_remap_index },
-   { 28699, GetSamplerParameterfv_remap_index },
-   { 30816, GetSamplerParameteriv_remap_index },
-   { 32263, IsSampler_remap_index },
-   { 10967, SamplerParameterIiv_remap_index },
-   { 15316, SamplerParameterIuiv_remap_index },
-   { 35786, SamplerParameterf_remap_index },
-   { 47413, SamplerParameterfv_remap_index },
-   { 52627, SamplerParameteri_remap_index },
-   { 34728, SamplerParameteriv_remap_index },
-   { 28786, GetQueryObjecti64v_remap_index },
-   {  5080, GetQueryObjectui64v_remap_index },
-   { 15911, QueryCounter_remap_index },
-   { 46436, ColorP3ui_remap_index },
-   {  8507, ColorP3uiv_remap_index },
-   { 21892, ColorP4ui_remap_index },
-   { 31953, ColorP4uiv_remap_index },
-   { 17081, MultiTexCoordP1ui_remap_index },
-   { 31643, MultiTexCoordP1uiv_remap_index },
-   { 33505, MultiTexCoordP2ui_remap_index },
-   { 11387, MultiTexCoordP2uiv_remap_index },
-   { 32041, MultiTexCoordP3ui_remap_index },
+   {  7369, GetSamplerParameterIuiv_remap_index },
+   { 28732, GetSamplerParameterfv_remap_index },
+   { 30849, GetSamplerParameteriv_remap_index },
+   { 32296, IsSampler_remap_index },
+   { 11000, SamplerParameterIiv_remap_index },
+   { 15349, SamplerParameterIuiv_remap_index },
+   { 35819, SamplerParameterf_remap_index },
+   { 47446, SamplerParameterfv_remap_index },
+   { 52660, SamplerParameteri_remap_index },
+   { 34761, SamplerParameteriv_remap_index },
+   { 28819, GetQueryObjecti64v_remap_index },
+   {  5113, GetQueryObjectui64v_remap_index },
+   { 15944, QueryCounter_remap_index },
+   { 46469, ColorP3ui_remap_index },
+   {  8540, ColorP3uiv_remap_index },
+   { 21925, ColorP4ui_remap_index },
+   { 31986, ColorP4uiv_remap_index },
+   { 17114, MultiTexCoordP1ui_remap_index },
+   { 31676, MultiTexCoordP1uiv_remap_index },
+   { 33538, MultiTexCoordP2ui_remap_index },
+   { 11420, MultiTexCoordP2uiv_remap_index },
+   { 32074, MultiTexCoordP3ui_remap_index },
    {   440, MultiTexCoordP3uiv_remap_index },
-   { 49487, MultiTexCoordP4ui_remap_index },
-   { 41989, MultiTexCoordP4uiv_remap_index },
-   { 44764, NormalP3ui_remap_index },
-   { 31568, NormalP3uiv_remap_index },
-   { 50512, SecondaryColorP3ui_remap_index },
-   {  7284, SecondaryColorP3uiv_remap_index },
+   { 49520, MultiTexCoordP4ui_remap_index },
+   { 42022, MultiTexCoordP4uiv_remap_index },
+   { 44797, NormalP3ui_remap_index },
+   { 31601, NormalP3uiv_remap_index },
+   { 50545, SecondaryColorP3ui_remap_index },
+   {  7317, SecondaryColorP3uiv_remap_index },
    {   177, TexCoordP1ui_remap_index },
    {   713, TexCoordP1uiv_remap_index },
-   { 32396, TexCoordP2ui_remap_index },
-   { 45101, TexCoordP2uiv_remap_index },
-   { 18382, TexCoordP3ui_remap_index },
-   { 21962, TexCoordP3uiv_remap_index },
-   { 41743, TexCoordP4ui_remap_index },
+   { 32429, TexCoordP2ui_remap_index },
+   { 45134, TexCoordP2uiv_remap_index },
+   { 18415, TexCoordP3ui_remap_index },
+   { 21995, TexCoordP3uiv_remap_index },
+   { 41776, TexCoordP4ui_remap_index },
    {  2182, TexCoordP4uiv_remap_index },
-   { 18505, VertexAttribP1ui_remap_index },
-   {  5132, VertexAttribP1uiv_remap_index },
-   { 36477, VertexAttribP2ui_remap_index },
-   {  6140, VertexAttribP2uiv_remap_index },
+   { 18538, VertexAttribP1ui_remap_index },
+   {  5165, VertexAttribP1uiv_remap_index },
+   { 36510, VertexAttribP2ui_remap_index },
+   {  6173, VertexAttribP2uiv_remap_index },
    {  1735, VertexAttribP3ui_remap_index },
-   { 34754, VertexAttribP3uiv_remap_index },
-   {  5413, VertexAttribP4ui_remap_index },
-   { 20054, VertexAttribP4uiv_remap_index },
-   { 42831, VertexP2ui_remap_index },
-   { 19811, VertexP2uiv_remap_index },
-   { 27822, VertexP3ui_remap_index },
-   {  7737, VertexP3uiv_remap_index },
+   { 34787, VertexAttribP3uiv_remap_index },
+   {  5446, VertexAttribP4ui_remap_index },
+   { 20087, VertexAttribP4uiv_remap_index },
+   { 42864, VertexP2ui_remap_index },
+   { 19844, VertexP2uiv_remap_index },
+   { 27855, VertexP3ui_remap_index },
+   {  7770, VertexP3uiv_remap_index },
    {  3910, VertexP4ui_remap_index },
-   { 53331, VertexP4uiv_remap_index },
+   { 53364, VertexP4uiv_remap_index },
    {   881, DrawArraysIndirect_remap_index },
-   { 28998, DrawElementsIndirect_remap_index },
-   {  8249, GetUniformdv_remap_index },
-   { 48129, Uniform1d_remap_index },
-   { 17575, Uniform1dv_remap_index },
-   { 50843, Uniform2d_remap_index },
-   { 34902, Uniform2dv_remap_index },
+   { 29031, DrawElementsIndirect_remap_index },
+   {  8282, GetUniformdv_remap_index },
+   { 48162, Uniform1d_remap_index },
+   { 17608, Uniform1dv_remap_index },
+   { 50876, Uniform2d_remap_index },
+   { 34935, Uniform2dv_remap_index },
    {   998, Uniform3d_remap_index },
-   { 35913, Uniform3dv_remap_index },
-   {  5498, Uniform4d_remap_index },
-   { 23888, Uniform4dv_remap_index },
-   {  5055, UniformMatrix2dv_remap_index },
-   { 27722, UniformMatrix2x3dv_remap_index },
-   { 19728, UniformMatrix2x4dv_remap_index },
-   { 35811, UniformMatrix3dv_remap_index },
-   {  5336, UniformMatrix3x2dv_remap_index },
-   {  6166, UniformMatrix3x4dv_remap_index },
-   { 20694, UniformMatrix4dv_remap_index },
-   { 39770, UniformMatrix4x2dv_remap_index },
-   { 22519, UniformMatrix4x3dv_remap_index },
-   {  6314, GetActiveSubroutineName_remap_index },
-   {  6968, GetActiveSubroutineUniformName_remap_index },
-   { 19586, GetActiveSubroutineUniformiv_remap_index },
-   { 14718, GetProgramStageiv_remap_index },
-   { 15973, GetSubroutineIndex_remap_index },
+   { 35946, Uniform3dv_remap_index },
+   {  5531, Uniform4d_remap_index },
+   { 23921, Uniform4dv_remap_index },
+   {  5088, UniformMatrix2dv_remap_index },
+   { 27755, UniformMatrix2x3dv_remap_index },
+   { 19761, UniformMatrix2x4dv_remap_index },
+   { 35844, UniformMatrix3dv_remap_index },
+   {  5369, UniformMatrix3x2dv_remap_index },
+   {  6199, UniformMatrix3x4dv_remap_index },
+   { 20727, UniformMatrix4dv_remap_index },
+   { 39803, UniformMatrix4x2dv_remap_index },
+   { 22552, UniformMatrix4x3dv_remap_index },
+   {  6347, GetActiveSubroutineName_remap_index },
+   {  7001, GetActiveSubroutineUniformName_remap_index },
+   { 19619, GetActiveSubroutineUniformiv_remap_index },
+   { 14751, GetProgramStageiv_remap_index },
+   { 16006, GetSubroutineIndex_remap_index },
    {  1577, GetSubroutineUniformLocation_remap_index },
-   { 53349, GetUniformSubroutineuiv_remap_index },
-   {  8008, UniformSubroutinesuiv_remap_index },
-   { 17855, PatchParameterfv_remap_index },
-   { 13655, PatchParameteri_remap_index },
-   { 13491, BindTransformFeedback_remap_index },
-   { 13363, DeleteTransformFeedbacks_remap_index },
-   { 43549, DrawTransformFeedback_remap_index },
-   {  4914, GenTransformFeedbacks_remap_index },
-   { 40428, IsTransformFeedback_remap_index },
-   { 37512, PauseTransformFeedback_remap_index },
-   { 43173, ResumeTransformFeedback_remap_index },
-   { 27652, BeginQueryIndexed_remap_index },
-   { 49929, DrawTransformFeedbackStream_remap_index },
-   { 23572, EndQueryIndexed_remap_index },
-   { 26771, GetQueryIndexediv_remap_index },
-   { 24360, ClearDepthf_remap_index },
-   { 29405, DepthRangef_remap_index },
-   { 46503, GetShaderPrecisionFormat_remap_index },
+   { 53382, GetUniformSubroutineuiv_remap_index },
+   {  8041, UniformSubroutinesuiv_remap_index },
+   { 17888, PatchParameterfv_remap_index },
+   { 13688, PatchParameteri_remap_index },
+   { 13524, BindTransformFeedback_remap_index },
+   { 13396, DeleteTransformFeedbacks_remap_index },
+   { 43582, DrawTransformFeedback_remap_index },
+   {  4947, GenTransformFeedbacks_remap_index },
+   { 40461, IsTransformFeedback_remap_index },
+   { 37545, PauseTransformFeedback_remap_index },
+   { 43206, ResumeTransformFeedback_remap_index },
+   { 27685, BeginQueryIndexed_remap_index },
+   { 49962, DrawTransformFeedbackStream_remap_index },
+   { 23605, EndQueryIndexed_remap_index },
+   { 26804, GetQueryIndexediv_remap_index },
+   { 24393, ClearDepthf_remap_index },
+   { 29438, DepthRangef_remap_index },
+   { 46536, GetShaderPrecisionFormat_remap_index },
    {  4085, ReleaseShaderCompiler_remap_index },
-   { 30954, ShaderBinary_remap_index },
-   { 24153, GetProgramBinary_remap_index },
-   { 14789, ProgramBinary_remap_index },
-   { 15081, ProgramParameteri_remap_index },
-   { 13953, GetVertexAttribLdv_remap_index },
-   { 51898, VertexAttribL1d_remap_index },
-   {  8306, VertexAttribL1dv_remap_index },
-   { 41873, VertexAttribL2d_remap_index },
-   { 24100, VertexAttribL2dv_remap_index },
-   { 44590, VertexAttribL3d_remap_index },
-   { 16482, VertexAttribL3dv_remap_index },
-   {  9531, VertexAttribL4d_remap_index },
-   { 25035, VertexAttribL4dv_remap_index },
-   { 51571, VertexAttribLPointer_remap_index },
-   { 32842, DepthRangeArrayv_remap_index },
-   { 51031, DepthRangeIndexed_remap_index },
-   { 40408, GetDoublei_v_remap_index },
-   { 43363, GetFloati_v_remap_index },
-   { 51469, ScissorArrayv_remap_index },
-   { 30703, ScissorIndexed_remap_index },
-   { 34780, ScissorIndexedv_remap_index },
-   { 22935, ViewportArrayv_remap_index },
-   { 38615, ViewportIndexedf_remap_index },
-   { 24201, ViewportIndexedfv_remap_index },
-   { 10675, GetGraphicsResetStatusARB_remap_index },
-   { 36718, GetnColorTableARB_remap_index },
+   { 30987, ShaderBinary_remap_index },
+   { 24186, GetProgramBinary_remap_index },
+   { 14822, ProgramBinary_remap_index },
+   { 15114, ProgramParameteri_remap_index },
+   { 13986, GetVertexAttribLdv_remap_index },
+   { 51931, VertexAttribL1d_remap_index },
+   {  8339, VertexAttribL1dv_remap_index },
+   { 41906, VertexAttribL2d_remap_index },
+   { 24133, VertexAttribL2dv_remap_index },
+   { 44623, VertexAttribL3d_remap_index },
+   { 16515, VertexAttribL3dv_remap_index },
+   {  9564, VertexAttribL4d_remap_index },
+   { 25068, VertexAttribL4dv_remap_index },
+   { 51604, VertexAttribLPointer_remap_index },
+   { 32875, DepthRangeArrayv_remap_index },
+   { 51064, DepthRangeIndexed_remap_index },
+   { 40441, GetDoublei_v_remap_index },
+   { 43396, GetFloati_v_remap_index },
+   { 51502, ScissorArrayv_remap_index },
+   { 30736, ScissorIndexed_remap_index },
+   { 34813, ScissorIndexedv_remap_index },
+   { 22968, ViewportArrayv_remap_index },
+   { 38648, ViewportIndexedf_remap_index },
+   { 24234, ViewportIndexedfv_remap_index },
+   { 10708, GetGraphicsResetStatusARB_remap_index },
+   { 36751, GetnColorTableARB_remap_index },
    {  3510, GetnCompressedTexImageARB_remap_index },
    {  1341, GetnConvolutionFilterARB_remap_index },
-   {  5984, GetnHistogramARB_remap_index },
-   { 22820, GetnMapdvARB_remap_index },
-   { 15207, GetnMapfvARB_remap_index },
-   { 41896, GetnMapivARB_remap_index },
-   { 47625, GetnMinmaxARB_remap_index },
-   {  4562, GetnPixelMapfvARB_remap_index },
-   {  7310, GetnPixelMapuivARB_remap_index },
-   { 14400, GetnPixelMapusvARB_remap_index },
-   { 27193, GetnPolygonStippleARB_remap_index },
-   { 35282, GetnSeparableFilterARB_remap_index },
-   { 12562, GetnTexImageARB_remap_index },
-   { 34101, GetnUniformdvARB_remap_index },
-   { 41387, GetnUniformfvARB_remap_index },
+   {  6017, GetnHistogramARB_remap_index },
+   { 22853, GetnMapdvARB_remap_index },
+   { 15240, GetnMapfvARB_remap_index },
+   { 41929, GetnMapivARB_remap_index },
+   { 47658, GetnMinmaxARB_remap_index },
+   {  4595, GetnPixelMapfvARB_remap_index },
+   {  7343, GetnPixelMapuivARB_remap_index },
+   { 14433, GetnPixelMapusvARB_remap_index },
+   { 27226, GetnPolygonStippleARB_remap_index },
+   { 35315, GetnSeparableFilterARB_remap_index },
+   { 12595, GetnTexImageARB_remap_index },
+   { 34134, GetnUniformdvARB_remap_index },
+   { 41420, GetnUniformfvARB_remap_index },
    {  4025, GetnUniformivARB_remap_index },
-   { 16869, GetnUniformuivARB_remap_index },
-   { 31173, ReadnPixelsARB_remap_index },
-   { 39952, DrawArraysInstancedBaseInstance_remap_index },
-   { 12767, DrawElementsInstancedBaseInstance_remap_index },
+   { 16902, GetnUniformuivARB_remap_index },
+   { 31206, ReadnPixelsARB_remap_index },
+   { 39985, DrawArraysInstancedBaseInstance_remap_index },
+   { 12800, DrawElementsInstancedBaseInstance_remap_index },
    {  3273, DrawElementsInstancedBaseVertexBaseInstance_remap_index },
-   { 43084, DrawTransformFeedbackInstanced_remap_index },
-   { 16530, DrawTransformFeedbackStreamInstanced_remap_index },
-   { 51509, GetInternalformativ_remap_index },
-   { 24321, GetActiveAtomicCounterBufferiv_remap_index },
-   { 53303, BindImageTexture_remap_index },
-   { 26280, MemoryBarrier_remap_index },
-   { 41523, TexStorage1D_remap_index },
-   { 28559, TexStorage2D_remap_index },
-   { 33123, TexStorage3D_remap_index },
+   { 43117, DrawTransformFeedbackInstanced_remap_index },
+   { 16563, DrawTransformFeedbackStreamInstanced_remap_index },
+   { 51542, GetInternalformativ_remap_index },
+   { 24354, GetActiveAtomicCounterBufferiv_remap_index },
+   { 53336, BindImageTexture_remap_index },
+   { 26313, MemoryBarrier_remap_index },
+   { 41556, TexStorage1D_remap_index },
+   { 28592, TexStorage2D_remap_index },
+   { 33156, TexStorage3D_remap_index },
    {  1658, TextureStorage1DEXT_remap_index },
-   { 43001, TextureStorage2DEXT_remap_index },
-   { 27254, TextureStorage3DEXT_remap_index },
-   { 43841, ClearBufferData_remap_index },
+   { 43034, TextureStorage2DEXT_remap_index },
+   { 27287, TextureStorage3DEXT_remap_index },
+   { 43874, ClearBufferData_remap_index },
    {  2619, ClearBufferSubData_remap_index },
-   { 38196, DispatchCompute_remap_index },
-   {  8194, DispatchComputeIndirect_remap_index },
-   { 43881, CopyImageSubData_remap_index },
-   { 49753, TextureView_remap_index },
-   { 26640, BindVertexBuffer_remap_index },
-   { 36086, VertexAttribBinding_remap_index },
-   { 36745, VertexAttribFormat_remap_index },
-   { 39893, VertexAttribIFormat_remap_index },
-   { 44562, VertexAttribLFormat_remap_index },
-   { 42490, VertexBindingDivisor_remap_index },
-   { 39415, FramebufferParameteri_remap_index },
-   { 34285, GetFramebufferParameteriv_remap_index },
-   { 15440, GetInternalformati64v_remap_index },
-   { 45975, MultiDrawArraysIndirect_remap_index },
-   { 22484, MultiDrawElementsIndirect_remap_index },
-   { 37357, GetProgramInterfaceiv_remap_index },
+   { 38229, DispatchCompute_remap_index },
+   {  8227, DispatchComputeIndirect_remap_index },
+   { 43914, CopyImageSubData_remap_index },
+   { 49786, TextureView_remap_index },
+   { 26673, BindVertexBuffer_remap_index },
+   { 36119, VertexAttribBinding_remap_index },
+   { 36778, VertexAttribFormat_remap_index },
+   { 39926, VertexAttribIFormat_remap_index },
+   { 44595, VertexAttribLFormat_remap_index },
+   { 42523, VertexBindingDivisor_remap_index },
+   { 39448, FramebufferParameteri_remap_index },
+   { 34318, GetFramebufferParameteriv_remap_index },
+   { 15473, GetInternalformati64v_remap_index },
+   { 46008, MultiDrawArraysIndirect_remap_index },
+   { 22517, MultiDrawElementsIndirect_remap_index },
+   { 37390, GetProgramInterfaceiv_remap_index },
    {  3927, GetProgramResourceIndex_remap_index },
    {  1543, GetProgramResourceLocation_remap_index },
    {   101, GetProgramResourceLocationIndex_remap_index },
-   { 16648, GetProgramResourceName_remap_index },
-   { 50413, GetProgramResourceiv_remap_index },
-   { 44393, ShaderStorageBlockBinding_remap_index },
-   { 22379, TexBufferRange_remap_index },
-   { 46800, TexStorage2DMultisample_remap_index },
-   { 34644, TexStorage3DMultisample_remap_index },
-   {  4257, BufferStorage_remap_index },
-   { 47344, ClearTexImage_remap_index },
-   { 16081, ClearTexSubImage_remap_index },
-   {  5227, BindBuffersBase_remap_index },
-   { 17940, BindBuffersRange_remap_index },
-   { 13338, BindImageTextures_remap_index },
+   { 16681, GetProgramResourceName_remap_index },
+   { 50446, GetProgramResourceiv_remap_index },
+   { 44426, ShaderStorageBlockBinding_remap_index },
+   { 22412, TexBufferRange_remap_index },
+   { 46833, TexStorage2DMultisample_remap_index },
+   { 34677, TexStorage3DMultisample_remap_index },
+   {  4290, BufferStorage_remap_index },
+   { 47377, ClearTexImage_remap_index },
+   { 16114, ClearTexSubImage_remap_index },
+   {  5260, BindBuffersBase_remap_index },
+   { 17973, BindBuffersRange_remap_index },
+   { 13371, BindImageTextures_remap_index },
    {  3490, BindSamplers_remap_index },
-   { 50537, BindTextures_remap_index },
-   { 30789, BindVertexBuffers_remap_index },
-   { 18530, GetImageHandleARB_remap_index },
-   { 24444, GetTextureHandleARB_remap_index },
-   { 52126, GetTextureSamplerHandleARB_remap_index },
-   { 46854, GetVertexAttribLui64vARB_remap_index },
-   { 47649, IsImageHandleResidentARB_remap_index },
-   { 49214, IsTextureHandleResidentARB_remap_index },
-   {  7100, MakeImageHandleNonResidentARB_remap_index },
-   { 19642, MakeImageHandleResidentARB_remap_index },
-   { 46581, MakeTextureHandleNonResidentARB_remap_index },
-   { 45941, MakeTextureHandleResidentARB_remap_index },
-   { 25416, ProgramUniformHandleui64ARB_remap_index },
-   { 29302, ProgramUniformHandleui64vARB_remap_index },
-   { 12714, UniformHandleui64ARB_remap_index },
-   { 27749, UniformHandleui64vARB_remap_index },
-   { 27165, VertexAttribL1ui64ARB_remap_index },
-   { 37446, VertexAttribL1ui64vARB_remap_index },
-   { 19773, DispatchComputeGroupSizeARB_remap_index },
-   { 23673, MultiDrawArraysIndirectCountARB_remap_index },
-   { 38930, MultiDrawElementsIndirectCountARB_remap_index },
-   { 44028, ClipControl_remap_index },
-   { 24248, BindTextureUnit_remap_index },
-   { 48247, BlitNamedFramebuffer_remap_index },
-   {  7942, CheckNamedFramebufferStatus_remap_index },
-   { 27677, ClearNamedBufferData_remap_index },
-   { 48500, ClearNamedBufferSubData_remap_index },
-   { 30577, ClearNamedFramebufferfi_remap_index },
-   { 30610, ClearNamedFramebufferfv_remap_index },
-   { 10003, ClearNamedFramebufferiv_remap_index },
-   { 44614, ClearNamedFramebufferuiv_remap_index },
-   { 47439, CompressedTextureSubImage1D_remap_index },
-   { 42708, CompressedTextureSubImage2D_remap_index },
-   { 40077, CompressedTextureSubImage3D_remap_index },
+   { 50570, BindTextures_remap_index },
+   { 30822, BindVertexBuffers_remap_index },
+   { 18563, GetImageHandleARB_remap_index },
+   { 24477, GetTextureHandleARB_remap_index },
+   { 52159, GetTextureSamplerHandleARB_remap_index },
+   { 46887, GetVertexAttribLui64vARB_remap_index },
+   { 47682, IsImageHandleResidentARB_remap_index },
+   { 49247, IsTextureHandleResidentARB_remap_index },
+   {  7133, MakeImageHandleNonResidentARB_remap_index },
+   { 19675, MakeImageHandleResidentARB_remap_index },
+   { 46614, MakeTextureHandleNonResidentARB_remap_index },
+   { 45974, MakeTextureHandleResidentARB_remap_index },
+   { 25449, ProgramUniformHandleui64ARB_remap_index },
+   { 29335, ProgramUniformHandleui64vARB_remap_index },
+   { 12747, UniformHandleui64ARB_remap_index },
+   { 27782, UniformHandleui64vARB_remap_index },
+   { 27198, VertexAttribL1ui64ARB_remap_index },
+   { 37479, VertexAttribL1ui64vARB_remap_index },
+   { 19806, DispatchComputeGroupSizeARB_remap_index },
+   { 23706, MultiDrawArraysIndirectCountARB_remap_index },
+   { 38963, MultiDrawElementsIndirectCountARB_remap_index },
+   { 44061, ClipControl_remap_index },
+   { 24281, BindTextureUnit_remap_index },
+   { 48280, BlitNamedFramebuffer_remap_index },
+   {  7975, CheckNamedFramebufferStatus_remap_index },
+   { 27710, ClearNamedBufferData_remap_index },
+   { 48533, ClearNamedBufferSubData_remap_index },
+   { 30610, ClearNamedFramebufferfi_remap_index },
+   { 30643, ClearNamedFramebufferfv_remap_index },
+   { 10036, ClearNamedFramebufferiv_remap_index },
+   { 44647, ClearNamedFramebufferuiv_remap_index },
+   { 47472, CompressedTextureSubImage1D_remap_index },
+   { 42741, CompressedTextureSubImage2D_remap_index },
+   { 40110, CompressedTextureSubImage3D_remap_index },
    {  3544, CopyNamedBufferSubData_remap_index },
-   { 43122, CopyTextureSubImage1D_remap_index },
-   { 38535, CopyTextureSubImage2D_remap_index },
-   { 49680, CopyTextureSubImage3D_remap_index },
-   {  6833, CreateBuffers_remap_index },
-   { 43524, CreateFramebuffers_remap_index },
+   { 43155, CopyTextureSubImage1D_remap_index },
+   { 38568, CopyTextureSubImage2D_remap_index },
+   { 49713, CopyTextureSubImage3D_remap_index },
+   {  6866, CreateBuffers_remap_index },
+   { 43557, CreateFramebuffers_remap_index },
    {  1207, CreateProgramPipelines_remap_index },
-   { 37969, CreateQueries_remap_index },
-   { 10758, CreateRenderbuffers_remap_index },
-   { 44781, CreateSamplers_remap_index },
-   { 34963, CreateTextures_remap_index },
+   { 38002, CreateQueries_remap_index },
+   { 10791, CreateRenderbuffers_remap_index },
+   { 44814, CreateSamplers_remap_index },
+   { 34996, CreateTextures_remap_index },
    {  1924, CreateTransformFeedbacks_remap_index },
-   { 25608, CreateVertexArrays_remap_index },
-   {  9500, DisableVertexArrayAttrib_remap_index },
-   { 49313, EnableVertexArrayAttrib_remap_index },
-   { 17046, FlushMappedNamedBufferRange_remap_index },
-   { 37883, GenerateTextureMipmap_remap_index },
+   { 25641, CreateVertexArrays_remap_index },
+   {  9533, DisableVertexArrayAttrib_remap_index },
+   { 49346, EnableVertexArrayAttrib_remap_index },
+   { 17079, FlushMappedNamedBufferRange_remap_index },
+   { 37916, GenerateTextureMipmap_remap_index },
    {   406, GetCompressedTextureImage_remap_index },
-   {  5577, GetNamedBufferParameteri64v_remap_index },
-   { 28316, GetNamedBufferParameteriv_remap_index },
-   { 34345, GetNamedBufferPointerv_remap_index },
-   { 13768, GetNamedBufferSubData_remap_index },
-   { 48633, GetNamedFramebufferAttachmentParameteriv_remap_index },
-   { 51365, GetNamedFramebufferParameteriv_remap_index },
-   { 36387, GetNamedRenderbufferParameteriv_remap_index },
-   { 30073, GetQueryBufferObjecti64v_remap_index },
-   { 52095, GetQueryBufferObjectiv_remap_index },
-   { 11138, GetQueryBufferObjectui64v_remap_index },
+   {  5610, GetNamedBufferParameteri64v_remap_index },
+   { 28349, GetNamedBufferParameteriv_remap_index },
+   { 34378, GetNamedBufferPointerv_remap_index },
+   { 13801, GetNamedBufferSubData_remap_index },
+   { 48666, GetNamedFramebufferAttachmentParameteriv_remap_index },
+   { 51398, GetNamedFramebufferParameteriv_remap_index },
+   { 36420, GetNamedRenderbufferParameteriv_remap_index },
+   { 30106, GetQueryBufferObjecti64v_remap_index },
+   { 52128, GetQueryBufferObjectiv_remap_index },
+   { 11171, GetQueryBufferObjectui64v_remap_index },
    {  3634, GetQueryBufferObjectuiv_remap_index },
    {  3732, GetTextureImage_remap_index },
-   { 39668, GetTextureLevelParameterfv_remap_index },
-   { 42897, GetTextureLevelParameteriv_remap_index },
-   { 17236, GetTextureParameterIiv_remap_index },
-   { 26503, GetTextureParameterIuiv_remap_index },
-   { 29144, GetTextureParameterfv_remap_index },
-   { 32795, GetTextureParameteriv_remap_index },
-   { 18664, GetTransformFeedbacki64_v_remap_index },
-   {  4517, GetTransformFeedbacki_v_remap_index },
-   { 29788, GetTransformFeedbackiv_remap_index },
-   {  6751, GetVertexArrayIndexed64iv_remap_index },
-   { 37647, GetVertexArrayIndexediv_remap_index },
-   { 19330, GetVertexArrayiv_remap_index },
-   { 36646, InvalidateNamedFramebufferData_remap_index },
-   { 31908, InvalidateNamedFramebufferSubData_remap_index },
-   { 11671, MapNamedBuffer_remap_index },
-   { 14644, MapNamedBufferRange_remap_index },
-   { 51653, NamedBufferData_remap_index },
-   { 13172, NamedBufferStorage_remap_index },
-   { 22352, NamedBufferSubData_remap_index },
-   { 13199, NamedFramebufferDrawBuffer_remap_index },
-   { 42172, NamedFramebufferDrawBuffers_remap_index },
-   { 30755, NamedFramebufferParameteri_remap_index },
-   { 25383, NamedFramebufferReadBuffer_remap_index },
-   { 37557, NamedFramebufferRenderbuffer_remap_index },
-   {  5612, NamedFramebufferTexture_remap_index },
-   { 13232, NamedFramebufferTextureLayer_remap_index },
-   { 10393, NamedRenderbufferStorage_remap_index },
-   { 32294, NamedRenderbufferStorageMultisample_remap_index },
-   { 26102, TextureBuffer_remap_index },
-   { 13585, TextureBufferRange_remap_index },
-   { 43031, TextureParameterIiv_remap_index },
-   { 32984, TextureParameterIuiv_remap_index },
-   { 41595, TextureParameterf_remap_index },
+   { 39701, GetTextureLevelParameterfv_remap_index },
+   { 42930, GetTextureLevelParameteriv_remap_index },
+   { 17269, GetTextureParameterIiv_remap_index },
+   { 26536, GetTextureParameterIuiv_remap_index },
+   { 29177, GetTextureParameterfv_remap_index },
+   { 32828, GetTextureParameteriv_remap_index },
+   { 18697, GetTransformFeedbacki64_v_remap_index },
+   {  4550, GetTransformFeedbacki_v_remap_index },
+   { 29821, GetTransformFeedbackiv_remap_index },
+   {  6784, GetVertexArrayIndexed64iv_remap_index },
+   { 37680, GetVertexArrayIndexediv_remap_index },
+   { 19363, GetVertexArrayiv_remap_index },
+   { 36679, InvalidateNamedFramebufferData_remap_index },
+   { 31941, InvalidateNamedFramebufferSubData_remap_index },
+   { 11704, MapNamedBuffer_remap_index },
+   { 14677, MapNamedBufferRange_remap_index },
+   { 51686, NamedBufferData_remap_index },
+   { 13205, NamedBufferStorage_remap_index },
+   { 22385, NamedBufferSubData_remap_index },
+   { 13232, NamedFramebufferDrawBuffer_remap_index },
+   { 42205, NamedFramebufferDrawBuffers_remap_index },
+   { 30788, NamedFramebufferParameteri_remap_index },
+   { 25416, NamedFramebufferReadBuffer_remap_index },
+   { 37590, NamedFramebufferRenderbuffer_remap_index },
+   {  5645, NamedFramebufferTexture_remap_index },
+   { 13265, NamedFramebufferTextureLayer_remap_index },
+   { 10426, NamedRenderbufferStorage_remap_index },
+   { 32327, NamedRenderbufferStorageMultisample_remap_index },
+   { 26135, TextureBuffer_remap_index },
+   { 13618, TextureBufferRange_remap_index },
+   { 43064, TextureParameterIiv_remap_index },
+   { 33017, TextureParameterIuiv_remap_index },
+   { 41628, TextureParameterf_remap_index },
    {  2649, TextureParameterfv_remap_index },
-   { 41676, TextureParameteri_remap_index },
-   { 29440, TextureParameteriv_remap_index },
-   { 12353, TextureStorage1D_remap_index },
-   { 17210, TextureStorage2D_remap_index },
-   { 48849, TextureStorage2DMultisample_remap_index },
-   { 21908, TextureStorage3D_remap_index },
+   { 41709, TextureParameteri_remap_index },
+   { 29473, TextureParameteriv_remap_index },
+   { 12386, TextureStorage1D_remap_index },
+   { 17243, TextureStorage2D_remap_index },
+   { 48882, TextureStorage2DMultisample_remap_index },
+   { 21941, TextureStorage3D_remap_index },
    {  3986, TextureStorage3DMultisample_remap_index },
-   { 31053, TextureSubImage1D_remap_index },
-   { 36112, TextureSubImage2D_remap_index },
-   { 39577, TextureSubImage3D_remap_index },
-   { 22546, TransformFeedbackBufferBase_remap_index },
-   { 17629, TransformFeedbackBufferRange_remap_index },
-   {  5314, UnmapNamedBuffer_remap_index },
-   { 29705, VertexArrayAttribBinding_remap_index },
-   { 14891, VertexArrayAttribFormat_remap_index },
-   { 18106, VertexArrayAttribIFormat_remap_index },
+   { 31086, TextureSubImage1D_remap_index },
+   { 36145, TextureSubImage2D_remap_index },
+   { 39610, TextureSubImage3D_remap_index },
+   { 22579, TransformFeedbackBufferBase_remap_index },
+   { 17662, TransformFeedbackBufferRange_remap_index },
+   {  5347, UnmapNamedBuffer_remap_index },
+   { 29738, VertexArrayAttribBinding_remap_index },
+   { 14924, VertexArrayAttribFormat_remap_index },
+   { 18139, VertexArrayAttribIFormat_remap_index },
    {  3191, VertexArrayAttribLFormat_remap_index },
-   { 19864, VertexArrayBindingDivisor_remap_index },
-   { 18401, VertexArrayElementBuffer_remap_index },
-   { 50338, VertexArrayVertexBuffer_remap_index },
-   { 20918, VertexArrayVertexBuffers_remap_index },
+   { 19897, VertexArrayBindingDivisor_remap_index },
+   { 18434, VertexArrayElementBuffer_remap_index },
+   { 50371, VertexArrayVertexBuffer_remap_index },
+   { 20951, VertexArrayVertexBuffers_remap_index },
    {  2391, GetCompressedTextureSubImage_remap_index },
-   {  8551, GetTextureSubImage_remap_index },
-   { 21832, BufferPageCommitmentARB_remap_index },
-   { 50032, NamedBufferPageCommitmentARB_remap_index },
-   { 23547, GetUniformi64vARB_remap_index },
-   { 41717, GetUniformui64vARB_remap_index },
-   { 25058, GetnUniformi64vARB_remap_index },
-   { 22001, GetnUniformui64vARB_remap_index },
-   { 28010, ProgramUniform1i64ARB_remap_index },
-   { 34519, ProgramUniform1i64vARB_remap_index },
-   {  7658, ProgramUniform1ui64ARB_remap_index },
-   { 52993, ProgramUniform1ui64vARB_remap_index },
-   { 25451, ProgramUniform2i64ARB_remap_index },
-   { 33474, ProgramUniform2i64vARB_remap_index },
-   { 47700, ProgramUniform2ui64ARB_remap_index },
-   { 43617, ProgramUniform2ui64vARB_remap_index },
-   { 52177, ProgramUniform3i64ARB_remap_index },
+   {  8584, GetTextureSubImage_remap_index },
+   { 21865, BufferPageCommitmentARB_remap_index },
+   { 50065, NamedBufferPageCommitmentARB_remap_index },
+   { 23580, GetUniformi64vARB_remap_index },
+   { 41750, GetUniformui64vARB_remap_index },
+   { 25091, GetnUniformi64vARB_remap_index },
+   { 22034, GetnUniformui64vARB_remap_index },
+   { 28043, ProgramUniform1i64ARB_remap_index },
+   { 34552, ProgramUniform1i64vARB_remap_index },
+   {  7691, ProgramUniform1ui64ARB_remap_index },
+   { 53026, ProgramUniform1ui64vARB_remap_index },
+   { 25484, ProgramUniform2i64ARB_remap_index },
+   { 33507, ProgramUniform2i64vARB_remap_index },
+   { 47733, ProgramUniform2ui64ARB_remap_index },
+   { 43650, ProgramUniform2ui64vARB_remap_index },
+   { 52210, ProgramUniform3i64ARB_remap_index },
    {    70, ProgramUniform3i64vARB_remap_index },
-   { 47993, ProgramUniform3ui64ARB_remap_index },
+   { 48026, ProgramUniform3ui64ARB_remap_index },
    {  3003, ProgramUniform3ui64vARB_remap_index },
-   { 17140, ProgramUniform4i64ARB_remap_index },
-   { 21191, ProgramUniform4i64vARB_remap_index },
-   { 25948, ProgramUniform4ui64ARB_remap_index },
-   { 34419, ProgramUniform4ui64vARB_remap_index },
-   { 28894, Uniform1i64ARB_remap_index },
-   { 41196, Uniform1i64vARB_remap_index },
+   { 17173, ProgramUniform4i64ARB_remap_index },
+   { 21224, ProgramUniform4i64vARB_remap_index },
+   { 25981, ProgramUniform4ui64ARB_remap_index },
+   { 34452, ProgramUniform4ui64vARB_remap_index },
+   { 28927, Uniform1i64ARB_remap_index },
+   { 41229, Uniform1i64vARB_remap_index },
    {  3710, Uniform1ui64ARB_remap_index },
-   {  8329, Uniform1ui64vARB_remap_index },
-   { 33146, Uniform2i64ARB_remap_index },
-   {  6903, Uniform2i64vARB_remap_index },
-   { 11364, Uniform2ui64ARB_remap_index },
-   { 22613, Uniform2ui64vARB_remap_index },
-   { 18482, Uniform3i64ARB_remap_index },
-   { 18010, Uniform3i64vARB_remap_index },
+   {  8362, Uniform1ui64vARB_remap_index },
+   { 33179, Uniform2i64ARB_remap_index },
+   {  6936, Uniform2i64vARB_remap_index },
+   { 11397, Uniform2ui64ARB_remap_index },
+   { 22646, Uniform2ui64vARB_remap_index },
+   { 18515, Uniform3i64ARB_remap_index },
+   { 18043, Uniform3i64vARB_remap_index },
    {  2924, Uniform3ui64ARB_remap_index },
-   { 21736, Uniform3ui64vARB_remap_index },
-   { 47931, Uniform4i64ARB_remap_index },
-   { 44067, Uniform4i64vARB_remap_index },
-   {  8945, Uniform4ui64ARB_remap_index },
-   { 35668, Uniform4ui64vARB_remap_index },
-   { 27327, SpecializeShaderARB_remap_index },
-   {  8223, InvalidateBufferData_remap_index },
-   { 47286, InvalidateBufferSubData_remap_index },
-   { 26240, InvalidateFramebuffer_remap_index },
-   { 19675, InvalidateSubFramebuffer_remap_index },
-   { 14830, InvalidateTexImage_remap_index },
-   { 31231, InvalidateTexSubImage_remap_index },
-   { 15663, PolygonOffsetEXT_remap_index },
-   { 44046, DrawTexfOES_remap_index },
-   { 30471, DrawTexfvOES_remap_index },
+   { 21769, Uniform3ui64vARB_remap_index },
+   { 47964, Uniform4i64ARB_remap_index },
+   { 44100, Uniform4i64vARB_remap_index },
+   {  8978, Uniform4ui64ARB_remap_index },
+   { 35701, Uniform4ui64vARB_remap_index },
+   {  4207, MaxShaderCompilerThreadsARB_remap_index },
+   { 27360, SpecializeShaderARB_remap_index },
+   {  8256, InvalidateBufferData_remap_index },
+   { 47319, InvalidateBufferSubData_remap_index },
+   { 26273, InvalidateFramebuffer_remap_index },
+   { 19708, InvalidateSubFramebuffer_remap_index },
+   { 14863, InvalidateTexImage_remap_index },
+   { 31264, InvalidateTexSubImage_remap_index },
+   { 15696, PolygonOffsetEXT_remap_index },
+   { 44079, DrawTexfOES_remap_index },
+   { 30504, DrawTexfvOES_remap_index },
    {  1113, DrawTexiOES_remap_index },
-   { 36582, DrawTexivOES_remap_index },
-   { 15011, DrawTexsOES_remap_index },
-   { 26434, DrawTexsvOES_remap_index },
-   { 31970, DrawTexxOES_remap_index },
-   { 46302, DrawTexxvOES_remap_index },
-   { 29835, PointSizePointerOES_remap_index },
+   { 36615, DrawTexivOES_remap_index },
+   { 15044, DrawTexsOES_remap_index },
+   { 26467, DrawTexsvOES_remap_index },
+   { 32003, DrawTexxOES_remap_index },
+   { 46335, DrawTexxvOES_remap_index },
+   { 29868, PointSizePointerOES_remap_index },
    {  1076, QueryMatrixxOES_remap_index },
-   { 23636, SampleMaskSGIS_remap_index },
-   { 40134, SamplePatternSGIS_remap_index },
-   { 50860, ColorPointerEXT_remap_index },
-   { 33623, EdgeFlagPointerEXT_remap_index },
-   { 15740, IndexPointerEXT_remap_index },
-   { 15948, NormalPointerEXT_remap_index },
-   { 32907, TexCoordPointerEXT_remap_index },
-   { 29545, VertexPointerEXT_remap_index },
-   { 50782, DiscardFramebufferEXT_remap_index },
-   { 13287, ActiveShaderProgram_remap_index },
-   { 20004, BindProgramPipeline_remap_index },
-   { 33675, CreateShaderProgramv_remap_index },
-   {  4428, DeleteProgramPipelines_remap_index },
-   { 30845, GenProgramPipelines_remap_index },
-   { 10069, GetProgramPipelineInfoLog_remap_index },
-   { 36821, GetProgramPipelineiv_remap_index },
-   { 30908, IsProgramPipeline_remap_index },
-   { 53161, LockArraysEXT_remap_index },
-   { 52333, ProgramUniform1d_remap_index },
-   { 36240, ProgramUniform1dv_remap_index },
-   { 52287, ProgramUniform1f_remap_index },
-   { 11848, ProgramUniform1fv_remap_index },
-   { 52241, ProgramUniform1i_remap_index },
-   { 18237, ProgramUniform1iv_remap_index },
-   { 40621, ProgramUniform1ui_remap_index },
-   { 51994, ProgramUniform1uiv_remap_index },
+   { 23669, SampleMaskSGIS_remap_index },
+   { 40167, SamplePatternSGIS_remap_index },
+   { 50893, ColorPointerEXT_remap_index },
+   { 33656, EdgeFlagPointerEXT_remap_index },
+   { 15773, IndexPointerEXT_remap_index },
+   { 15981, NormalPointerEXT_remap_index },
+   { 32940, TexCoordPointerEXT_remap_index },
+   { 29578, VertexPointerEXT_remap_index },
+   { 50815, DiscardFramebufferEXT_remap_index },
+   { 13320, ActiveShaderProgram_remap_index },
+   { 20037, BindProgramPipeline_remap_index },
+   { 33708, CreateShaderProgramv_remap_index },
+   {  4461, DeleteProgramPipelines_remap_index },
+   { 30878, GenProgramPipelines_remap_index },
+   { 10102, GetProgramPipelineInfoLog_remap_index },
+   { 36854, GetProgramPipelineiv_remap_index },
+   { 30941, IsProgramPipeline_remap_index },
+   { 53194, LockArraysEXT_remap_index },
+   { 52366, ProgramUniform1d_remap_index },
+   { 36273, ProgramUniform1dv_remap_index },
+   { 52320, ProgramUniform1f_remap_index },
+   { 11881, ProgramUniform1fv_remap_index },
+   { 52274, ProgramUniform1i_remap_index },
+   { 18270, ProgramUniform1iv_remap_index },
+   { 40654, ProgramUniform1ui_remap_index },
+   { 52027, ProgramUniform1uiv_remap_index },
    {  2831, ProgramUniform2d_remap_index },
-   { 11777, ProgramUniform2dv_remap_index },
+   { 11810, ProgramUniform2dv_remap_index },
    {  2784, ProgramUniform2f_remap_index },
-   { 42848, ProgramUniform2fv_remap_index },
+   { 42881, ProgramUniform2fv_remap_index },
    {  2856, ProgramUniform2i_remap_index },
-   { 25559, ProgramUniform2iv_remap_index },
+   { 25592, ProgramUniform2iv_remap_index },
    {   664, ProgramUniform2ui_remap_index },
-   { 11172, ProgramUniform2uiv_remap_index },
-   {  5644, ProgramUniform3d_remap_index },
-   {  5551, ProgramUniform3dv_remap_index },
-   {  5670, ProgramUniform3f_remap_index },
-   { 35585, ProgramUniform3fv_remap_index },
-   {  5718, ProgramUniform3i_remap_index },
-   { 15999, ProgramUniform3iv_remap_index },
-   { 18286, ProgramUniform3ui_remap_index },
-   { 21588, ProgramUniform3uiv_remap_index },
-   { 34160, ProgramUniform4d_remap_index },
-   { 36502, ProgramUniform4dv_remap_index },
-   { 34187, ProgramUniform4f_remap_index },
-   { 49594, ProgramUniform4fv_remap_index },
-   { 34236, ProgramUniform4i_remap_index },
+   { 11205, ProgramUniform2uiv_remap_index },
+   {  5677, ProgramUniform3d_remap_index },
+   {  5584, ProgramUniform3dv_remap_index },
+   {  5703, ProgramUniform3f_remap_index },
+   { 35618, ProgramUniform3fv_remap_index },
+   {  5751, ProgramUniform3i_remap_index },
+   { 16032, ProgramUniform3iv_remap_index },
+   { 18319, ProgramUniform3ui_remap_index },
+   { 21621, ProgramUniform3uiv_remap_index },
+   { 34193, ProgramUniform4d_remap_index },
+   { 36535, ProgramUniform4dv_remap_index },
+   { 34220, ProgramUniform4f_remap_index },
+   { 49627, ProgramUniform4fv_remap_index },
+   { 34269, ProgramUniform4i_remap_index },
    {  2312, ProgramUniform4iv_remap_index },
-   { 48047, ProgramUniform4ui_remap_index },
-   { 39220, ProgramUniform4uiv_remap_index },
-   { 16048, ProgramUniformMatrix2dv_remap_index },
-   { 23745, ProgramUniformMatrix2fv_remap_index },
-   { 19295, ProgramUniformMatrix2x3dv_remap_index },
-   { 26574, ProgramUniformMatrix2x3fv_remap_index },
+   { 48080, ProgramUniform4ui_remap_index },
+   { 39253, ProgramUniform4uiv_remap_index },
+   { 16081, ProgramUniformMatrix2dv_remap_index },
+   { 23778, ProgramUniformMatrix2fv_remap_index },
+   { 19328, ProgramUniformMatrix2x3dv_remap_index },
+   { 26607, ProgramUniformMatrix2x3fv_remap_index },
    {  2228, ProgramUniformMatrix2x4dv_remap_index },
-   {  9697, ProgramUniformMatrix2x4fv_remap_index },
-   { 53104, ProgramUniformMatrix3dv_remap_index },
-   { 45796, ProgramUniformMatrix3fv_remap_index },
-   { 31769, ProgramUniformMatrix3x2dv_remap_index },
-   { 40342, ProgramUniformMatrix3x2fv_remap_index },
-   { 27045, ProgramUniformMatrix3x4dv_remap_index },
-   { 32507, ProgramUniformMatrix3x4fv_remap_index },
-   { 46112, ProgramUniformMatrix4dv_remap_index },
-   { 38265, ProgramUniformMatrix4fv_remap_index },
-   { 47478, ProgramUniformMatrix4x2dv_remap_index },
+   {  9730, ProgramUniformMatrix2x4fv_remap_index },
+   { 53137, ProgramUniformMatrix3dv_remap_index },
+   { 45829, ProgramUniformMatrix3fv_remap_index },
+   { 31802, ProgramUniformMatrix3x2dv_remap_index },
+   { 40375, ProgramUniformMatrix3x2fv_remap_index },
+   { 27078, ProgramUniformMatrix3x4dv_remap_index },
+   { 32540, ProgramUniformMatrix3x4fv_remap_index },
+   { 46145, ProgramUniformMatrix4dv_remap_index },
+   { 38298, ProgramUniformMatrix4fv_remap_index },
+   { 47511, ProgramUniformMatrix4x2dv_remap_index },
    {  2718, ProgramUniformMatrix4x2fv_remap_index },
-   { 16723, ProgramUniformMatrix4x3dv_remap_index },
-   {  9182, ProgramUniformMatrix4x3fv_remap_index },
-   { 46834, UnlockArraysEXT_remap_index },
-   { 38219, UseProgramStages_remap_index },
+   { 16756, ProgramUniformMatrix4x3dv_remap_index },
+   {  9215, ProgramUniformMatrix4x3fv_remap_index },
+   { 46867, UnlockArraysEXT_remap_index },
+   { 38252, UseProgramStages_remap_index },
    {  1982, ValidateProgramPipeline_remap_index },
-   { 20080, DebugMessageCallback_remap_index },
-   { 38730, DebugMessageControl_remap_index },
-   { 19109, DebugMessageInsert_remap_index },
-   {  8730, GetDebugMessageLog_remap_index },
-   {  8463, GetObjectLabel_remap_index },
-   { 15032, GetObjectPtrLabel_remap_index },
-   {  7607, ObjectLabel_remap_index },
-   { 53248, ObjectPtrLabel_remap_index },
-   { 22216, PopDebugGroup_remap_index },
-   { 17667, PushDebugGroup_remap_index },
-   { 10494, SecondaryColor3fEXT_remap_index },
-   {  9915, SecondaryColor3fvEXT_remap_index },
-   { 35232, MultiDrawElementsEXT_remap_index },
-   { 13419, FogCoordfEXT_remap_index },
-   { 22581, FogCoordfvEXT_remap_index },
-   {  5205, ResizeBuffersMESA_remap_index },
-   { 41805, WindowPos4dMESA_remap_index },
-   { 33452, WindowPos4dvMESA_remap_index },
-   {  5363, WindowPos4fMESA_remap_index },
-   { 14146, WindowPos4fvMESA_remap_index },
-   { 11484, WindowPos4iMESA_remap_index },
-   {  4635, WindowPos4ivMESA_remap_index },
-   { 34451, WindowPos4sMESA_remap_index },
-   {  7585, WindowPos4svMESA_remap_index },
-   { 35332, MultiModeDrawArraysIBM_remap_index },
-   { 24524, MultiModeDrawElementsIBM_remap_index },
-   { 40253, AreProgramsResidentNV_remap_index },
-   { 48977, ExecuteProgramNV_remap_index },
-   { 36208, GetProgramParameterdvNV_remap_index },
-   { 44847, GetProgramParameterfvNV_remap_index },
-   { 23842, GetProgramStringNV_remap_index },
-   { 19546, GetProgramivNV_remap_index },
-   { 22865, GetTrackMatrixivNV_remap_index },
-   { 23360, GetVertexAttribdvNV_remap_index },
-   { 21164, GetVertexAttribfvNV_remap_index },
-   { 19897, GetVertexAttribivNV_remap_index },
-   { 44492, LoadProgramNV_remap_index },
-   { 24624, ProgramParameters4dvNV_remap_index },
-   { 25313, ProgramParameters4fvNV_remap_index },
-   {  7976, RequestResidentProgramsNV_remap_index },
-   { 35764, TrackMatrixNV_remap_index },
-   { 53574, VertexAttrib1dNV_remap_index },
-   { 34550, VertexAttrib1dvNV_remap_index },
-   { 35003, VertexAttrib1fNV_remap_index },
-   { 51242, VertexAttrib1fvNV_remap_index },
-   { 26030, VertexAttrib1sNV_remap_index },
-   {  8658, VertexAttrib1svNV_remap_index },
-   { 22841, VertexAttrib2dNV_remap_index },
-   { 42148, VertexAttrib2dvNV_remap_index },
-   { 33336, VertexAttrib2fNV_remap_index },
-   { 31804, VertexAttrib2fvNV_remap_index },
-   { 15836, VertexAttrib2sNV_remap_index },
-   {  7260, VertexAttrib2svNV_remap_index },
-   { 45256, VertexAttrib3dNV_remap_index },
-   { 47587, VertexAttrib3dvNV_remap_index },
-   {  6193, VertexAttrib3fNV_remap_index },
-   { 50446, VertexAttrib3fvNV_remap_index },
-   {  9126, VertexAttrib3sNV_remap_index },
-   { 22892, VertexAttrib3svNV_remap_index },
-   { 10810, VertexAttrib4dNV_remap_index },
-   {  4353, VertexAttrib4dvNV_remap_index },
-   { 10881, VertexAttrib4fNV_remap_index },
-   { 50584, VertexAttrib4fvNV_remap_index },
-   { 21694, VertexAttrib4sNV_remap_index },
-   { 13631, VertexAttrib4svNV_remap_index },
+   { 20113, DebugMessageCallback_remap_index },
+   { 38763, DebugMessageControl_remap_index },
+   { 19142, DebugMessageInsert_remap_index },
+   {  8763, GetDebugMessageLog_remap_index },
+   {  8496, GetObjectLabel_remap_index },
+   { 15065, GetObjectPtrLabel_remap_index },
+   {  7640, ObjectLabel_remap_index },
+   { 53281, ObjectPtrLabel_remap_index },
+   { 22249, PopDebugGroup_remap_index },
+   { 17700, PushDebugGroup_remap_index },
+   { 10527, SecondaryColor3fEXT_remap_index },
+   {  9948, SecondaryColor3fvEXT_remap_index },
+   { 35265, MultiDrawElementsEXT_remap_index },
+   { 13452, FogCoordfEXT_remap_index },
+   { 22614, FogCoordfvEXT_remap_index },
+   {  5238, ResizeBuffersMESA_remap_index },
+   { 41838, WindowPos4dMESA_remap_index },
+   { 33485, WindowPos4dvMESA_remap_index },
+   {  5396, WindowPos4fMESA_remap_index },
+   { 14179, WindowPos4fvMESA_remap_index },
+   { 11517, WindowPos4iMESA_remap_index },
+   {  4668, WindowPos4ivMESA_remap_index },
+   { 34484, WindowPos4sMESA_remap_index },
+   {  7618, WindowPos4svMESA_remap_index },
+   { 35365, MultiModeDrawArraysIBM_remap_index },
+   { 24557, MultiModeDrawElementsIBM_remap_index },
+   { 40286, AreProgramsResidentNV_remap_index },
+   { 49010, ExecuteProgramNV_remap_index },
+   { 36241, GetProgramParameterdvNV_remap_index },
+   { 44880, GetProgramParameterfvNV_remap_index },
+   { 23875, GetProgramStringNV_remap_index },
+   { 19579, GetProgramivNV_remap_index },
+   { 22898, GetTrackMatrixivNV_remap_index },
+   { 23393, GetVertexAttribdvNV_remap_index },
+   { 21197, GetVertexAttribfvNV_remap_index },
+   { 19930, GetVertexAttribivNV_remap_index },
+   { 44525, LoadProgramNV_remap_index },
+   { 24657, ProgramParameters4dvNV_remap_index },
+   { 25346, ProgramParameters4fvNV_remap_index },
+   {  8009, RequestResidentProgramsNV_remap_index },
+   { 35797, TrackMatrixNV_remap_index },
+   { 53607, VertexAttrib1dNV_remap_index },
+   { 34583, VertexAttrib1dvNV_remap_index },
+   { 35036, VertexAttrib1fNV_remap_index },
+   { 51275, VertexAttrib1fvNV_remap_index },
+   { 26063, VertexAttrib1sNV_remap_index },
+   {  8691, VertexAttrib1svNV_remap_index },
+   { 22874, VertexAttrib2dNV_remap_index },
+   { 42181, VertexAttrib2dvNV_remap_index },
+   { 33369, VertexAttrib2fNV_remap_index },
+   { 31837, VertexAttrib2fvNV_remap_index },
+   { 15869, VertexAttrib2sNV_remap_index },
+   {  7293, VertexAttrib2svNV_remap_index },
+   { 45289, VertexAttrib3dNV_remap_index },
+   { 47620, VertexAttrib3dvNV_remap_index },
+   {  6226, VertexAttrib3fNV_remap_index },
+   { 50479, VertexAttrib3fvNV_remap_index },
+   {  9159, VertexAttrib3sNV_remap_index },
+   { 22925, VertexAttrib3svNV_remap_index },
+   { 10843, VertexAttrib4dNV_remap_index },
+   {  4386, VertexAttrib4dvNV_remap_index },
+   { 10914, VertexAttrib4fNV_remap_index },
+   { 50617, VertexAttrib4fvNV_remap_index },
+   { 21727, VertexAttrib4sNV_remap_index },
+   { 13664, VertexAttrib4svNV_remap_index },
    {  1955, VertexAttrib4ubNV_remap_index },
-   { 13394, VertexAttrib4ubvNV_remap_index },
-   { 35483, VertexAttribPointerNV_remap_index },
-   { 33530, VertexAttribs1dvNV_remap_index },
-   { 49512, VertexAttribs1fvNV_remap_index },
-   {  7916, VertexAttribs1svNV_remap_index },
-   { 42122, VertexAttribs2dvNV_remap_index },
-   {  5387, VertexAttribs2fvNV_remap_index },
-   { 33649, VertexAttribs2svNV_remap_index },
+   { 13427, VertexAttrib4ubvNV_remap_index },
+   { 35516, VertexAttribPointerNV_remap_index },
+   { 33563, VertexAttribs1dvNV_remap_index },
+   { 49545, VertexAttribs1fvNV_remap_index },
+   {  7949, VertexAttribs1svNV_remap_index },
+   { 42155, VertexAttribs2dvNV_remap_index },
+   {  5420, VertexAttribs2fvNV_remap_index },
+   { 33682, VertexAttribs2svNV_remap_index },
    {  2202, VertexAttribs3dvNV_remap_index },
-   { 43577, VertexAttribs3fvNV_remap_index },
-   { 17414, VertexAttribs3svNV_remap_index },
-   {  6877, VertexAttribs4dvNV_remap_index },
-   { 29986, VertexAttribs4fvNV_remap_index },
-   { 12741, VertexAttribs4svNV_remap_index },
-   { 39444, VertexAttribs4ubvNV_remap_index },
-   { 51120, GetTexBumpParameterfvATI_remap_index },
-   { 13047, GetTexBumpParameterivATI_remap_index },
-   { 43709, TexBumpParameterfvATI_remap_index },
-   { 10853, TexBumpParameterivATI_remap_index },
-   { 11705, AlphaFragmentOp1ATI_remap_index },
-   {  4377, AlphaFragmentOp2ATI_remap_index },
-   { 23324, AlphaFragmentOp3ATI_remap_index },
-   { 40809, BeginFragmentShaderATI_remap_index },
-   {  4682, BindFragmentShaderATI_remap_index },
-   {  9151, ColorFragmentOp1ATI_remap_index },
-   { 15802, ColorFragmentOp2ATI_remap_index },
-   { 29466, ColorFragmentOp3ATI_remap_index },
-   { 20889, DeleteFragmentShaderATI_remap_index },
-   { 53717, EndFragmentShaderATI_remap_index },
-   { 28289, GenFragmentShadersATI_remap_index },
-   { 50666, PassTexCoordATI_remap_index },
-   { 43689, SampleMapATI_remap_index },
-   { 42796, SetFragmentShaderConstantATI_remap_index },
-   { 28915, DepthRangeArrayfvOES_remap_index },
+   { 43610, VertexAttribs3fvNV_remap_index },
+   { 17447, VertexAttribs3svNV_remap_index },
+   {  6910, VertexAttribs4dvNV_remap_index },
+   { 30019, VertexAttribs4fvNV_remap_index },
+   { 12774, VertexAttribs4svNV_remap_index },
+   { 39477, VertexAttribs4ubvNV_remap_index },
+   { 51153, GetTexBumpParameterfvATI_remap_index },
+   { 13080, GetTexBumpParameterivATI_remap_index },
+   { 43742, TexBumpParameterfvATI_remap_index },
+   { 10886, TexBumpParameterivATI_remap_index },
+   { 11738, AlphaFragmentOp1ATI_remap_index },
+   {  4410, AlphaFragmentOp2ATI_remap_index },
+   { 23357, AlphaFragmentOp3ATI_remap_index },
+   { 40842, BeginFragmentShaderATI_remap_index },
+   {  4715, BindFragmentShaderATI_remap_index },
+   {  9184, ColorFragmentOp1ATI_remap_index },
+   { 15835, ColorFragmentOp2ATI_remap_index },
+   { 29499, ColorFragmentOp3ATI_remap_index },
+   { 20922, DeleteFragmentShaderATI_remap_index },
+   { 53750, EndFragmentShaderATI_remap_index },
+   { 28322, GenFragmentShadersATI_remap_index },
+   { 50699, PassTexCoordATI_remap_index },
+   { 43722, SampleMapATI_remap_index },
+   { 42829, SetFragmentShaderConstantATI_remap_index },
+   { 28948, DepthRangeArrayfvOES_remap_index },
    {  1514, DepthRangeIndexedfOES_remap_index },
-   { 10784, ActiveStencilFaceEXT_remap_index },
-   { 43201, GetProgramNamedParameterdvNV_remap_index },
-   { 28039, GetProgramNamedParameterfvNV_remap_index },
-   { 51151, ProgramNamedParameter4dNV_remap_index },
-   { 46536, ProgramNamedParameter4dvNV_remap_index },
-   { 30166, ProgramNamedParameter4fNV_remap_index },
-   { 31331, ProgramNamedParameter4fvNV_remap_index },
-   { 29893, PrimitiveRestartNV_remap_index },
-   { 30431, GetTexGenxvOES_remap_index },
-   { 18088, TexGenxOES_remap_index },
-   { 39649, TexGenxvOES_remap_index },
-   { 10159, DepthBoundsEXT_remap_index },
-   { 46741, BindFramebufferEXT_remap_index },
-   { 50724, BindRenderbufferEXT_remap_index },
-   {  5438, StringMarkerGREMEDY_remap_index },
-   { 38124, BufferParameteriAPPLE_remap_index },
-   { 48395, FlushMappedBufferRangeAPPLE_remap_index },
-   { 33979, VertexAttribI1iEXT_remap_index },
-   { 14085, VertexAttribI1uiEXT_remap_index },
-   { 24957, VertexAttribI2iEXT_remap_index },
-   { 50189, VertexAttribI2ivEXT_remap_index },
-   { 31462, VertexAttribI2uiEXT_remap_index },
-   { 43298, VertexAttribI2uivEXT_remap_index },
-   { 23967, VertexAttribI3iEXT_remap_index },
-   { 52561, VertexAttribI3ivEXT_remap_index },
-   { 27963, VertexAttribI3uiEXT_remap_index },
-   { 46664, VertexAttribI3uivEXT_remap_index },
-   { 46618, VertexAttribI4iEXT_remap_index },
-   {  8613, VertexAttribI4ivEXT_remap_index },
+   { 10817, ActiveStencilFaceEXT_remap_index },
+   { 43234, GetProgramNamedParameterdvNV_remap_index },
+   { 28072, GetProgramNamedParameterfvNV_remap_index },
+   { 51184, ProgramNamedParameter4dNV_remap_index },
+   { 46569, ProgramNamedParameter4dvNV_remap_index },
+   { 30199, ProgramNamedParameter4fNV_remap_index },
+   { 31364, ProgramNamedParameter4fvNV_remap_index },
+   { 29926, PrimitiveRestartNV_remap_index },
+   { 30464, GetTexGenxvOES_remap_index },
+   { 18121, TexGenxOES_remap_index },
+   { 39682, TexGenxvOES_remap_index },
+   { 10192, DepthBoundsEXT_remap_index },
+   { 46774, BindFramebufferEXT_remap_index },
+   { 50757, BindRenderbufferEXT_remap_index },
+   {  5471, StringMarkerGREMEDY_remap_index },
+   { 38157, BufferParameteriAPPLE_remap_index },
+   { 48428, FlushMappedBufferRangeAPPLE_remap_index },
+   { 34012, VertexAttribI1iEXT_remap_index },
+   { 14118, VertexAttribI1uiEXT_remap_index },
+   { 24990, VertexAttribI2iEXT_remap_index },
+   { 50222, VertexAttribI2ivEXT_remap_index },
+   { 31495, VertexAttribI2uiEXT_remap_index },
+   { 43331, VertexAttribI2uivEXT_remap_index },
+   { 24000, VertexAttribI3iEXT_remap_index },
+   { 52594, VertexAttribI3ivEXT_remap_index },
+   { 27996, VertexAttribI3uiEXT_remap_index },
+   { 46697, VertexAttribI3uivEXT_remap_index },
+   { 46651, VertexAttribI4iEXT_remap_index },
+   {  8646, VertexAttribI4ivEXT_remap_index },
    {  3225, VertexAttribI4uiEXT_remap_index },
-   { 33836, VertexAttribI4uivEXT_remap_index },
+   { 33869, VertexAttribI4uivEXT_remap_index },
    {  3832, ClearColorIiEXT_remap_index },
    {  1316, ClearColorIuiEXT_remap_index },
-   { 29916, BindBufferOffsetEXT_remap_index },
-   { 27375, BeginPerfMonitorAMD_remap_index },
-   { 40211, DeletePerfMonitorsAMD_remap_index },
-   {  6785, EndPerfMonitorAMD_remap_index },
-   { 33046, GenPerfMonitorsAMD_remap_index },
-   { 15573, GetPerfMonitorCounterDataAMD_remap_index },
-   { 42628, GetPerfMonitorCounterInfoAMD_remap_index },
-   { 53677, GetPerfMonitorCounterStringAMD_remap_index },
-   { 53213, GetPerfMonitorCountersAMD_remap_index },
-   { 17758, GetPerfMonitorGroupStringAMD_remap_index },
-   { 36426, GetPerfMonitorGroupsAMD_remap_index },
-   { 17172, SelectPerfMonitorCountersAMD_remap_index },
-   { 17878, GetObjectParameterivAPPLE_remap_index },
-   { 52965, ObjectPurgeableAPPLE_remap_index },
+   { 29949, BindBufferOffsetEXT_remap_index },
+   { 27408, BeginPerfMonitorAMD_remap_index },
+   { 40244, DeletePerfMonitorsAMD_remap_index },
+   {  6818, EndPerfMonitorAMD_remap_index },
+   { 33079, GenPerfMonitorsAMD_remap_index },
+   { 15606, GetPerfMonitorCounterDataAMD_remap_index },
+   { 42661, GetPerfMonitorCounterInfoAMD_remap_index },
+   { 53710, GetPerfMonitorCounterStringAMD_remap_index },
+   { 53246, GetPerfMonitorCountersAMD_remap_index },
+   { 17791, GetPerfMonitorGroupStringAMD_remap_index },
+   { 36459, GetPerfMonitorGroupsAMD_remap_index },
+   { 17205, SelectPerfMonitorCountersAMD_remap_index },
+   { 17911, GetObjectParameterivAPPLE_remap_index },
+   { 52998, ObjectPurgeableAPPLE_remap_index },
    {  2361, ObjectUnpurgeableAPPLE_remap_index },
-   { 51743, ActiveProgramEXT_remap_index },
-   { 41844, CreateShaderProgramEXT_remap_index },
-   { 45364, UseShaderProgramEXT_remap_index },
-   { 37319, TextureBarrierNV_remap_index },
+   { 51776, ActiveProgramEXT_remap_index },
+   { 41877, CreateShaderProgramEXT_remap_index },
+   { 45397, UseShaderProgramEXT_remap_index },
+   { 37352, TextureBarrierNV_remap_index },
    {  2675, VDPAUFiniNV_remap_index },
    {   969, VDPAUGetSurfaceivNV_remap_index },
-   { 29339, VDPAUInitNV_remap_index },
-   { 26552, VDPAUIsSurfaceNV_remap_index },
-   { 26746, VDPAUMapSurfacesNV_remap_index },
+   { 29372, VDPAUInitNV_remap_index },
+   { 26585, VDPAUIsSurfaceNV_remap_index },
+   { 26779, VDPAUMapSurfacesNV_remap_index },
    {  3873, VDPAURegisterOutputSurfaceNV_remap_index },
-   { 15471, VDPAURegisterVideoSurfaceNV_remap_index },
-   { 13798, VDPAUSurfaceAccessNV_remap_index },
-   {  5957, VDPAUUnmapSurfacesNV_remap_index },
-   { 46406, VDPAUUnregisterSurfaceNV_remap_index },
-   { 11413, BeginPerfQueryINTEL_remap_index },
-   { 41219, CreatePerfQueryINTEL_remap_index },
-   { 20325, DeletePerfQueryINTEL_remap_index },
-   { 49982, EndPerfQueryINTEL_remap_index },
-   { 51713, GetFirstPerfQueryIdINTEL_remap_index },
-   { 37272, GetNextPerfQueryIdINTEL_remap_index },
-   { 39271, GetPerfCounterInfoINTEL_remap_index },
+   { 15504, VDPAURegisterVideoSurfaceNV_remap_index },
+   { 13831, VDPAUSurfaceAccessNV_remap_index },
+   {  5990, VDPAUUnmapSurfacesNV_remap_index },
+   { 46439, VDPAUUnregisterSurfaceNV_remap_index },
+   { 11446, BeginPerfQueryINTEL_remap_index },
+   { 41252, CreatePerfQueryINTEL_remap_index },
+   { 20358, DeletePerfQueryINTEL_remap_index },
+   { 50015, EndPerfQueryINTEL_remap_index },
+   { 51746, GetFirstPerfQueryIdINTEL_remap_index },
+   { 37305, GetNextPerfQueryIdINTEL_remap_index },
+   { 39304, GetPerfCounterInfoINTEL_remap_index },
    {   850, GetPerfQueryDataINTEL_remap_index },
-   { 27532, GetPerfQueryIdByNameINTEL_remap_index },
-   { 24718, GetPerfQueryInfoINTEL_remap_index },
-   { 47006, PolygonOffsetClampEXT_remap_index },
-   { 52652, WindowRectanglesEXT_remap_index },
-   { 10180, BufferStorageMemEXT_remap_index },
-   { 53776, CreateMemoryObjectsEXT_remap_index },
-   { 45858, DeleteMemoryObjectsEXT_remap_index },
+   { 27565, GetPerfQueryIdByNameINTEL_remap_index },
+   { 24751, GetPerfQueryInfoINTEL_remap_index },
+   { 47039, PolygonOffsetClampEXT_remap_index },
+   { 52685, WindowRectanglesEXT_remap_index },
+   { 10213, BufferStorageMemEXT_remap_index },
+   { 53809, CreateMemoryObjectsEXT_remap_index },
+   { 45891, DeleteMemoryObjectsEXT_remap_index },
    {  2156, DeleteSemaphoresEXT_remap_index },
-   { 14254, GenSemaphoresEXT_remap_index },
-   { 40453, GetMemoryObjectParameterivEXT_remap_index },
-   { 34607, GetSemaphoreParameterui64vEXT_remap_index },
-   { 46474, GetUnsignedBytei_vEXT_remap_index },
-   { 23906, GetUnsignedBytevEXT_remap_index },
-   { 42045, IsMemoryObjectEXT_remap_index },
-   { 21538, IsSemaphoreEXT_remap_index },
-   { 44458, MemoryObjectParameterivEXT_remap_index },
-   { 25867, NamedBufferStorageMemEXT_remap_index },
-   { 36684, SemaphoreParameterui64vEXT_remap_index },
-   { 26073, SignalSemaphoreEXT_remap_index },
-   {  7196, TexStorageMem1DEXT_remap_index },
-   {  6110, TexStorageMem2DEXT_remap_index },
-   { 48725, TexStorageMem2DMultisampleEXT_remap_index },
-   {  6536, TexStorageMem3DEXT_remap_index },
-   { 52741, TexStorageMem3DMultisampleEXT_remap_index },
-   { 25764, TextureStorageMem1DEXT_remap_index },
-   { 40957, TextureStorageMem2DEXT_remap_index },
-   { 22046, TextureStorageMem2DMultisampleEXT_remap_index },
-   { 10593, TextureStorageMem3DEXT_remap_index },
-   { 40030, TextureStorageMem3DMultisampleEXT_remap_index },
-   { 32437, WaitSemaphoreEXT_remap_index },
-   {  7135, ImportMemoryFdEXT_remap_index },
-   { 33556, ImportSemaphoreFdEXT_remap_index },
-   { 25196, StencilFuncSeparateATI_remap_index },
-   {  7161, ProgramEnvParameters4fvEXT_remap_index },
-   {  8269, ProgramLocalParameters4fvEXT_remap_index },
-   {  4871, EGLImageTargetRenderbufferStorageOES_remap_index },
-   {  4587, EGLImageTargetTexture2DOES_remap_index },
-   { 50156, AlphaFuncx_remap_index },
-   { 24012, ClearColorx_remap_index },
-   { 49279, ClearDepthx_remap_index },
-   { 44175, Color4x_remap_index },
-   { 29240, DepthRangex_remap_index },
+   { 14287, GenSemaphoresEXT_remap_index },
+   { 40486, GetMemoryObjectParameterivEXT_remap_index },
+   { 34640, GetSemaphoreParameterui64vEXT_remap_index },
+   { 46507, GetUnsignedBytei_vEXT_remap_index },
+   { 23939, GetUnsignedBytevEXT_remap_index },
+   { 42078, IsMemoryObjectEXT_remap_index },
+   { 21571, IsSemaphoreEXT_remap_index },
+   { 44491, MemoryObjectParameterivEXT_remap_index },
+   { 25900, NamedBufferStorageMemEXT_remap_index },
+   { 36717, SemaphoreParameterui64vEXT_remap_index },
+   { 26106, SignalSemaphoreEXT_remap_index },
+   {  7229, TexStorageMem1DEXT_remap_index },
+   {  6143, TexStorageMem2DEXT_remap_index },
+   { 48758, TexStorageMem2DMultisampleEXT_remap_index },
+   {  6569, TexStorageMem3DEXT_remap_index },
+   { 52774, TexStorageMem3DMultisampleEXT_remap_index },
+   { 25797, TextureStorageMem1DEXT_remap_index },
+   { 40990, TextureStorageMem2DEXT_remap_index },
+   { 22079, TextureStorageMem2DMultisampleEXT_remap_index },
+   { 10626, TextureStorageMem3DEXT_remap_index },
+   { 40063, TextureStorageMem3DMultisampleEXT_remap_index },
+   { 32470, WaitSemaphoreEXT_remap_index },
+   {  7168, ImportMemoryFdEXT_remap_index },
+   { 33589, ImportSemaphoreFdEXT_remap_index },
+   { 25229, StencilFuncSeparateATI_remap_index },
+   {  7194, ProgramEnvParameters4fvEXT_remap_index },
+   {  8302, ProgramLocalParameters4fvEXT_remap_index },
+   {  4904, EGLImageTargetRenderbufferStorageOES_remap_index },
+   {  4620, EGLImageTargetTexture2DOES_remap_index },
+   { 50189, AlphaFuncx_remap_index },
+   { 24045, ClearColorx_remap_index },
+   { 49312, ClearDepthx_remap_index },
+   { 44208, Color4x_remap_index },
+   { 29273, DepthRangex_remap_index },
    {  2903, Fogx_remap_index },
-   { 18432, Fogxv_remap_index },
-   { 11105, Frustumf_remap_index },
-   { 11236, Frustumx_remap_index },
-   { 23932, LightModelx_remap_index },
-   { 39489, LightModelxv_remap_index },
-   { 35559, Lightx_remap_index },
-   { 51003, Lightxv_remap_index },
-   {  4485, LineWidthx_remap_index },
-   {  4223, LoadMatrixx_remap_index },
-   { 52063, Materialx_remap_index },
-   { 31281, Materialxv_remap_index },
-   { 52707, MultMatrixx_remap_index },
-   { 12631, MultiTexCoord4x_remap_index },
-   { 31082, Normal3x_remap_index },
-   { 19186, Orthof_remap_index },
-   { 19426, Orthox_remap_index },
-   { 33883, PointSizex_remap_index },
+   { 18465, Fogxv_remap_index },
+   { 11138, Frustumf_remap_index },
+   { 11269, Frustumx_remap_index },
+   { 23965, LightModelx_remap_index },
+   { 39522, LightModelxv_remap_index },
+   { 35592, Lightx_remap_index },
+   { 51036, Lightxv_remap_index },
+   {  4518, LineWidthx_remap_index },
+   {  4256, LoadMatrixx_remap_index },
+   { 52096, Materialx_remap_index },
+   { 31314, Materialxv_remap_index },
+   { 52740, MultMatrixx_remap_index },
+   { 12664, MultiTexCoord4x_remap_index },
+   { 31115, Normal3x_remap_index },
+   { 19219, Orthof_remap_index },
+   { 19459, Orthox_remap_index },
+   { 33916, PointSizex_remap_index },
    {  1375, PolygonOffsetx_remap_index },
-   { 45689, Rotatex_remap_index },
-   { 24675, SampleCoveragex_remap_index },
-   { 15686, Scalex_remap_index },
-   { 47141, TexEnvx_remap_index },
-   { 52916, TexEnvxv_remap_index },
+   { 45722, Rotatex_remap_index },
+   { 24708, SampleCoveragex_remap_index },
+   { 15719, Scalex_remap_index },
+   { 47174, TexEnvx_remap_index },
+   { 52949, TexEnvxv_remap_index },
    {  2483, TexParameterx_remap_index },
-   { 38896, Translatex_remap_index },
-   { 40588, ClipPlanef_remap_index },
-   { 40490, ClipPlanex_remap_index },
+   { 38929, Translatex_remap_index },
+   { 40621, ClipPlanef_remap_index },
+   { 40523, ClipPlanex_remap_index },
    {   811, GetClipPlanef_remap_index },
    {   625, GetClipPlanex_remap_index },
-   { 24593, GetFixedv_remap_index },
+   { 24626, GetFixedv_remap_index },
    {  1416, GetLightxv_remap_index },
-   { 28076, GetMaterialxv_remap_index },
-   { 26398, GetTexEnvxv_remap_index },
-   { 20774, GetTexParameterxv_remap_index },
-   { 35836, PointParameterx_remap_index },
-   { 45644, PointParameterxv_remap_index },
-   { 23594, TexParameterxv_remap_index },
-   {  7225, BlendBarrier_remap_index },
-   { 42517, PrimitiveBoundingBox_remap_index },
+   { 28109, GetMaterialxv_remap_index },
+   { 26431, GetTexEnvxv_remap_index },
+   { 20807, GetTexParameterxv_remap_index },
+   { 35869, PointParameterx_remap_index },
+   { 45677, PointParameterxv_remap_index },
+   { 23627, TexParameterxv_remap_index },
+   {  7258, BlendBarrier_remap_index },
+   { 42550, PrimitiveBoundingBox_remap_index },
    {    -1, -1 }
 };
 
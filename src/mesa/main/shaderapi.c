@@ -41,6 +41,7 @@
 #include <c99_alloca.h>
 #include "main/glheader.h"
 #include "main/context.h"
+#include "main/debug_output.h"
 #include "main/dispatch.h"
 #include "main/enums.h"
 #include "main/glspirv.h"
@@ -63,6 +64,8 @@
 #include "util/hash_table.h"
 #include "util/mesa-sha1.h"
 #include "util/crc32.h"
+#include "util/u_atomic.h"
+#include "util/u_queue.h"
 
 /**
  * Return mask of GLSL_x flags by examining the MESA_GLSL env var.
@@ -657,8 +660,13 @@ static void
 get_programiv(struct gl_context *ctx, GLuint program, GLenum pname,
               GLint *params)
 {
-   struct gl_shader_program *shProg
-      = _mesa_lookup_shader_program_err(ctx, program, "glGetProgramiv(program)");
+   /* GL_COMPLETION_STATUS_ARB must not block on a link that is still
+    * running on a compiler thread.
+    */
+   struct gl_shader_program *shProg = pname == GL_COMPLETION_STATUS_ARB ?
+      _mesa_lookup_shader_program_err_nowait(ctx, program,
+                                             "glGetProgramiv(program)") :
+      _mesa_lookup_shader_program_err(ctx, program, "glGetProgramiv(program)");
 
    /* Is transform feedback available in this context?
     */
@@ -692,6 +700,11 @@ get_programiv(struct gl_context *ctx, GLuint program, GLenum pname,
    case GL_LINK_STATUS:
       *params = shProg->data->LinkStatus ? GL_TRUE : GL_FALSE;
       return;
+   case GL_COMPLETION_STATUS_ARB:
+      if (!_mesa_has_ARB_parallel_shader_compile(ctx))
+         break;
+      *params = util_queue_fence_is_signalled(&shProg->LinkFence);
+      return;
    case GL_VALIDATE_STATUS:
       *params = shProg->data->Validated;
       return;
@@ -961,9 +974,18 @@ get_shaderiv(struct gl_context *ctx, GLuint name, GLenum pname, GLint *params)
       *params = shader->DeletePending;
       break;
    case GL_COMPILE_STATUS:
+      util_queue_fence_wait(&shader->CompileFence);
       *params = shader->CompileStatus ? GL_TRUE : GL_FALSE;
       break;
+   case GL_COMPLETION_STATUS_ARB:
+      if (!_mesa_has_ARB_parallel_shader_compile(ctx)) {
+         _mesa_error(ctx, GL_INVALID_ENUM, "glGetShaderiv(pname)");
+         return;
+      }
+      *params = util_queue_fence_is_signalled(&shader->CompileFence);
+      break;
    case GL_INFO_LOG_LENGTH:
+      util_queue_fence_wait(&shader->CompileFence);
       *params = (shader->InfoLog && shader->InfoLog[0] != '\0') ?
          strlen(shader->InfoLog) + 1 : 0;
       break;
@@ -1029,6 +1051,8 @@ get_shader_info_log(struct gl_context *ctx, GLuint shader, GLsizei bufSize,
       return;
    }
 
+   util_queue_fence_wait(&sh->CompileFence);
+
    _mesa_copy_string(infoLog, bufSize, length, sh->InfoLog);
 }
 
@@ -1092,6 +1116,117 @@ set_shader_source(struct gl_shader *sh, const GLchar *source)
 }
 
 
+/**
+ * Return the share group's compiler queue if compile/link work for \p shProg
+ * (or a lone shader when \p shProg is NULL) may be moved off the calling
+ * thread, or NULL if it has to run synchronously.
+ *
+ * Anything that logs, dumps or captures needs the results right away, and so
+ * do compiler messages when debug output is synchronous.  A program that is
+ * current in this context has to be re-installed as part of the link.  All
+ * of those stay synchronous too.
+ */
+static struct util_queue *
+get_compiler_queue(struct gl_context *ctx,
+                   const struct gl_shader_program *shProg)
+{
+   struct gl_shared_state *shared = ctx->Shared;
+   const unsigned num_threads = MIN2(ctx->Const.MaxShaderCompilerThreads,
+                                     ctx->Hint.MaxShaderCompilerThreads);
+
+   if (num_threads == 0)
+      return NULL;
+
+   if (ctx->_Shader->Flags & (GLSL_DUMP | GLSL_LOG | GLSL_DUMP_ON_ERROR |
+                              GLSL_REPORT_ERRORS))
+      return NULL;
+
+   if (_mesa_get_shader_capture_path() != NULL)
+      return NULL;
+
+   if (_mesa_get_debug_state_int(ctx, GL_DEBUG_OUTPUT) &&
+       _mesa_get_debug_state_int(ctx, GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB))
+      return NULL;
+
+   if (shProg) {
+      if (ctx->_Shader->ActiveProgram == shProg)
+         return NULL;
+
+      for (unsigned stage = 0; stage < MESA_SHADER_STAGES; stage++) {
+         if (ctx->_Shader->CurrentProgram[stage] &&
+             ctx->_Shader->CurrentProgram[stage]->Id == shProg->Name)
+            return NULL;
+      }
+   }
+
+   if (!util_queue_is_initialized(&shared->ShaderCompilerQueue)) {
+      simple_mtx_lock(&shared->Mutex);
+      if (!util_queue_is_initialized(&shared->ShaderCompilerQueue)) {
+         util_queue_init(&shared->ShaderCompilerQueue, "glsl", 32,
+                         num_threads, UTIL_QUEUE_INIT_RESIZE_IF_FULL);
+      }
+      simple_mtx_unlock(&shared->Mutex);
+   }
+
+   return util_queue_is_initialized(&shared->ShaderCompilerQueue) ?
+      &shared->ShaderCompilerQueue : NULL;
+}
+
+
+struct compile_shader_job {
+   struct gl_context *ctx;
+   struct gl_shader *sh;
+};
+
+static void
+compile_shader_execute(void *data, int thread_index)
+{
+   struct compile_shader_job *job = data;
+
+   /* Always compile for real: a cache hit would leave nothing but the
+    * source behind, and a link running on another thread must not have to
+    * fall back to compiling it again.
+    */
+   _mesa_glsl_compile_shader(job->ctx, job->sh, false, false, true);
+}
+
+static void
+compile_shader_cleanup(void *data, int thread_index)
+{
+   free(data);
+}
+
+
+struct link_program_job {
+   struct gl_context *ctx;
+   struct gl_shader_program *shProg;
+};
+
+static void
+link_program_execute(void *data, int thread_index)
+{
+   struct link_program_job *job = data;
+   struct gl_shader_program *shProg = job->shProg;
+
+   /* The queue is FIFO, so any compile of an attached shader was queued
+    * before us and is already running or done.
+    */
+   for (unsigned i = 0; i < shProg->NumShaders; i++)
+      util_queue_fence_wait(&shProg->Shaders[i]->CompileFence);
+
+   _mesa_glsl_link_shader(job->ctx, shProg);
+
+   for (unsigned i = 0; i < shProg->NumShaders; i++)
+      p_atomic_dec(&shProg->Shaders[i]->PendingLinks);
+}
+
+static void
+link_program_cleanup(void *data, int thread_index)
+{
+   free(data);
+}
+
+
 /**
  * Compile a shader.
  */
@@ -1113,12 +1248,27 @@ _mesa_compile_shader(struct gl_context *ctx, struct gl_shader *sh)
       return;
    }
 
+   /* Don't touch the shader while a compiler thread still owns it. */
+   _mesa_wait_shader_idle(ctx, sh);
+
    if (!sh->Source) {
       /* If the user called glCompileShader without first calling
        * glShaderSource, we should fail to compile, but not raise a GL_ERROR.
        */
       sh->CompileStatus = compile_failure;
    } else {
+      struct util_queue *queue = get_compiler_queue(ctx, NULL);
+      struct compile_shader_job *job =
+         queue ? malloc(sizeof(*job)) : NULL;
+
+      if (job) {
+         job->ctx = ctx;
+         job->sh = sh;
+         util_queue_add_job(queue, job, &sh->CompileFence,
+                            compile_shader_execute, compile_shader_cleanup);
+         return;
+      }
+
       if (ctx->_Shader->Flags & GLSL_DUMP) {
          _mesa_log("GLSL source for %s shader %d:\n",
                  _mesa_shader_stage_to_string(sh->Stage), sh->Name);
@@ -1203,6 +1353,29 @@ link_program(struct gl_context *ctx, struct gl_shader_program *shProg,
    }
 
    FLUSH_VERTICES(ctx, 0);
+
+   struct util_queue *queue = programs_in_use ?
+      NULL : get_compiler_queue(ctx, shProg);
+   struct link_program_job *job = queue ? malloc(sizeof(*job)) : NULL;
+
+   if (job) {
+      /* Releasing the old executables may call into the driver's context,
+       * so do it here; the link on the compiler thread then starts from a
+       * clean program.  Lookups of the program block on LinkFence until the
+       * link is done.
+       */
+      _mesa_clear_shader_program_data(ctx, shProg);
+
+      for (unsigned i = 0; i < shProg->NumShaders; i++)
+         p_atomic_inc(&shProg->Shaders[i]->PendingLinks);
+
+      job->ctx = ctx;
+      job->shProg = shProg;
+      util_queue_add_job(queue, job, &shProg->LinkFence,
+                         link_program_execute, link_program_cleanup);
+      return;
+   }
+
    _mesa_glsl_link_shader(ctx, shProg);
 
    /* From section 7.3 (Program Objects) of the OpenGL 4.5 spec:
@@ -1978,6 +2151,7 @@ shader_source(struct gl_context *ctx, GLuint shaderObj, GLsizei count,
    }
 #endif /* ENABLE_SHADER_CACHE */
 
+   _mesa_wait_shader_idle(ctx, sh);
    set_shader_source(sh, source);
 
    free(offsets);
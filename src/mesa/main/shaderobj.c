@@ -91,6 +91,7 @@ static void
 _mesa_init_shader(struct gl_shader *shader)
 {
    shader->RefCount = 1;
+   util_queue_fence_init(&shader->CompileFence);
    shader->info.Geom.VerticesOut = -1;
    shader->info.Geom.InputType = GL_TRIANGLES;
    shader->info.Geom.OutputType = GL_TRIANGLE_STRIP;
@@ -122,6 +123,9 @@ _mesa_new_shader(GLuint name, gl_shader_stage stage)
 void
 _mesa_delete_shader(struct gl_context *ctx, struct gl_shader *sh)
 {
+   util_queue_fence_wait(&sh->CompileFence);
+   util_queue_fence_destroy(&sh->CompileFence);
+
    _mesa_shader_spirv_data_reference(&sh->spirv_data, NULL);
    free((void *)sh->Source);
    free((void *)sh->FallbackSource);
@@ -142,6 +146,23 @@ _mesa_delete_linked_shader(struct gl_context *ctx,
 }
 
 
+/**
+ * Wait until the compiler queue is done with a shader so that it can be
+ * changed: for the shader's own compile job and for links reading it.
+ */
+void
+_mesa_wait_shader_idle(struct gl_context *ctx, struct gl_shader *sh)
+{
+   util_queue_fence_wait(&sh->CompileFence);
+
+   /* Link jobs aren't tracked per shader, but applications seldom change
+    * the shaders of a program while it is being linked.
+    */
+   if (p_atomic_read(&sh->PendingLinks))
+      util_queue_finish(&ctx->Shared->ShaderCompilerQueue);
+}
+
+
 /**
  * Lookup a GLSL shader object.
  */
@@ -285,6 +306,8 @@ init_shader_program(struct gl_shader_program *prog)
    prog->Type = GL_SHADER_PROGRAM_MESA;
    prog->RefCount = 1;
 
+   util_queue_fence_init(&prog->LinkFence);
+
    prog->AttributeBindings = string_to_uint_map_ctor();
    prog->FragDataBindings = string_to_uint_map_ctor();
    prog->FragDataIndexBindings = string_to_uint_map_ctor();
@@ -405,13 +428,17 @@ void
 _mesa_delete_shader_program(struct gl_context *ctx,
                             struct gl_shader_program *shProg)
 {
+   util_queue_fence_wait(&shProg->LinkFence);
+   util_queue_fence_destroy(&shProg->LinkFence);
+
    _mesa_free_shader_program_data(ctx, shProg);
    ralloc_free(shProg);
 }
 
 
 /**
- * Lookup a GLSL program object.
+ * Lookup a GLSL program object.  If the compiler queue is linking the
+ * program, wait for it to finish so that the caller sees the results.
  */
 struct gl_shader_program *
 _mesa_lookup_shader_program(struct gl_context *ctx, GLuint name)
@@ -427,6 +454,8 @@ _mesa_lookup_shader_program(struct gl_context *ctx, GLuint name)
       if (shProg && shProg->Type != GL_SHADER_PROGRAM_MESA) {
          return NULL;
       }
+      if (shProg)
+         util_queue_fence_wait(&shProg->LinkFence);
       return shProg;
    }
    return NULL;
@@ -439,6 +468,23 @@ _mesa_lookup_shader_program(struct gl_context *ctx, GLuint name)
 struct gl_shader_program *
 _mesa_lookup_shader_program_err(struct gl_context *ctx, GLuint name,
                                 const char *caller)
+{
+   struct gl_shader_program *shProg =
+      _mesa_lookup_shader_program_err_nowait(ctx, name, caller);
+
+   if (shProg)
+      util_queue_fence_wait(&shProg->LinkFence);
+   return shProg;
+}
+
+
+/**
+ * As above, but return the program even if the compiler queue is still
+ * linking it.
+ */
+struct gl_shader_program *
+_mesa_lookup_shader_program_err_nowait(struct gl_context *ctx, GLuint name,
+                                       const char *caller)
 {
    if (!name) {
       _mesa_error(ctx, GL_INVALID_VALUE, "%s", caller);
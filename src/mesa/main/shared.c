@@ -353,6 +353,9 @@ free_shared_state(struct gl_context *ctx, struct gl_shared_state *shared)
       _mesa_DeleteHashTable(shared->BitmapAtlas);
    }
 
+   if (util_queue_is_initialized(&shared->ShaderCompilerQueue))
+      util_queue_destroy(&shared->ShaderCompilerQueue);
+
    if (shared->ShaderObjects) {
       _mesa_HashWalk(shared->ShaderObjects, free_shader_program_data_cb, ctx);
       _mesa_HashDeleteAll(shared->ShaderObjects, delete_shader_cb, ctx);
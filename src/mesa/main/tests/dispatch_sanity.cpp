@@ -1023,6 +1023,9 @@ const struct function common_desktop_functions_possible[] = {
    /* GL_ARB_gl_spirv */
    { "glSpecializeShaderARB", 45, -1 },
 
+   /* GL_ARB_parallel_shader_compile */
+   { "glMaxShaderCompilerThreadsARB", 20, -1 },
+
    { NULL, 0, -1 }
 };
 
@@ -0,0 +1,213 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \name hash_table.cpp
+ *
+ * Test the GL object name table, for both the direct-indexed names and the
+ * sparse ones in the hash table.
+ *
+ * The DISABLED_LookupBenchmark test measures the lookups done by bind calls
+ * from several threads sharing the table.  Run it with
+ * --gtest_also_run_disabled_tests --gtest_filter=HashTableTest.*Benchmark.
+ */
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include "main/hash.h"
+#include "util/macros.h"
+#include "util/os_time.h"
+
+static void *
+value(GLuint key)
+{
+   return (void *) (uintptr_t) (key * 2 + 1);
+}
+
+static void
+count_entry(GLuint key, void *data, void *userData)
+{
+   EXPECT_EQ(value(key), data);
+   (*(unsigned *) userData)++;
+}
+
+static void
+remove_entry(GLuint key, void *data, void *userData)
+{
+   _mesa_HashRemove((struct _mesa_HashTable *) userData, key);
+}
+
+class HashTableTest : public ::testing::Test {
+protected:
+   void SetUp()
+   {
+      table = _mesa_NewHashTable();
+      ASSERT_NE((void *) NULL, table);
+   }
+
+   void TearDown()
+   {
+      _mesa_HashWalk(table, remove_entry, table);
+      _mesa_DeleteHashTable(table);
+   }
+
+   struct _mesa_HashTable *table;
+};
+
+static const GLuint keys[] = {
+   DELETED_KEY_VALUE, 2, 3, HASH_DIRECT_PAGE_SIZE - 1, HASH_DIRECT_PAGE_SIZE,
+   5 * HASH_DIRECT_PAGE_SIZE + 17, HASH_DIRECT_MAX_KEY - 1, HASH_DIRECT_MAX_KEY,
+   HASH_DIRECT_MAX_KEY + 1, 0x7fffffff, 0xfffffffe, 0xffffffff,
+};
+
+TEST_F(HashTableTest, InsertLookupRemove)
+{
+   for (unsigned i = 0; i < ARRAY_SIZE(keys); i++) {
+      EXPECT_EQ((void *) NULL, _mesa_HashLookup(table, keys[i]));
+      _mesa_HashInsert(table, keys[i], value(keys[i]));
+   }
+   EXPECT_EQ(ARRAY_SIZE(keys), _mesa_HashNumEntries(table));
+
+   for (unsigned i = 0; i < ARRAY_SIZE(keys); i++) {
+      EXPECT_EQ(value(keys[i]), _mesa_HashLookup(table, keys[i]));
+      EXPECT_EQ(value(keys[i]), _mesa_HashLookupLocked(table, keys[i]));
+   }
+
+   /* Replacing an entry doesn't add one. */
+   _mesa_HashInsert(table, keys[0], value(keys[0]));
+   EXPECT_EQ(ARRAY_SIZE(keys), _mesa_HashNumEntries(table));
+
+   unsigned count = 0;
+   _mesa_HashWalk(table, count_entry, &count);
+   EXPECT_EQ(ARRAY_SIZE(keys), count);
+
+   for (unsigned i = 0; i < ARRAY_SIZE(keys); i += 2)
+      _mesa_HashRemove(table, keys[i]);
+
+   for (unsigned i = 0; i < ARRAY_SIZE(keys); i++) {
+      EXPECT_EQ(i % 2 ? value(keys[i]) : NULL,
+                _mesa_HashLookup(table, keys[i]));
+   }
+   EXPECT_EQ(ARRAY_SIZE(keys) / 2, _mesa_HashNumEntries(table));
+}
+
+TEST_F(HashTableTest, WalkCanRemove)
+{
+   for (GLuint key = 1; key <= 3 * HASH_DIRECT_PAGE_SIZE; key++)
+      _mesa_HashInsert(table, key, value(key));
+   _mesa_HashInsert(table, 0xffffffff, value(0xffffffff));
+
+   _mesa_HashWalk(table, remove_entry, table);
+   EXPECT_EQ(0u, _mesa_HashNumEntries(table));
+   EXPECT_EQ((void *) NULL, _mesa_HashLookup(table, 1));
+   EXPECT_EQ((void *) NULL, _mesa_HashLookup(table, 0xffffffff));
+}
+
+TEST_F(HashTableTest, DeleteAll)
+{
+   for (unsigned i = 0; i < ARRAY_SIZE(keys); i++)
+      _mesa_HashInsert(table, keys[i], value(keys[i]));
+
+   unsigned count = 0;
+   _mesa_HashDeleteAll(table, count_entry, &count);
+   EXPECT_EQ(ARRAY_SIZE(keys), count);
+   EXPECT_EQ(0u, _mesa_HashNumEntries(table));
+}
+
+TEST_F(HashTableTest, FindFreeKeyBlock)
+{
+   GLuint first = _mesa_HashFindFreeKeyBlock(table, 10);
+   EXPECT_EQ(1u, first);
+
+   for (GLuint key = first; key < first + 10; key++)
+      _mesa_HashInsert(table, key, value(key));
+   EXPECT_EQ(11u, _mesa_HashFindFreeKeyBlock(table, 10));
+}
+
+#define BENCH_OBJECTS 4096
+#define BENCH_LOOKUPS (1 << 24)
+
+struct bench_thread {
+   struct _mesa_HashTable *table;
+   bool locked;
+   uintptr_t sum;
+};
+
+static int
+bench_thread_func(void *data)
+{
+   struct bench_thread *t = (struct bench_thread *) data;
+   uintptr_t sum = 0;
+
+   /* Bind-like access: a handful of objects, revisited in a loop. */
+   for (unsigned i = 0; i < BENCH_LOOKUPS; i++) {
+      GLuint key = 1 + (i * 7) % BENCH_OBJECTS;
+
+      if (t->locked) {
+         /* What _mesa_HashLookup() used to do for every key. */
+         _mesa_HashLockMutex(t->table);
+         sum += (uintptr_t) _mesa_HashLookupLocked(t->table, key);
+         _mesa_HashUnlockMutex(t->table);
+      } else {
+         sum += (uintptr_t) _mesa_HashLookup(t->table, key);
+      }
+   }
+
+   t->sum = sum;
+   return 0;
+}
+
+static double
+run_bench(struct _mesa_HashTable *table, unsigned num_threads, bool locked)
+{
+   thrd_t threads[8];
+   struct bench_thread t[8];
+   int64_t start = os_time_get_nano();
+
+   for (unsigned i = 0; i < num_threads; i++) {
+      t[i].table = table;
+      t[i].locked = locked;
+      thrd_create(&threads[i], bench_thread_func, &t[i]);
+   }
+   for (unsigned i = 0; i < num_threads; i++)
+      thrd_join(threads[i], NULL);
+
+   return (double) (os_time_get_nano() - start) /
+          ((double) BENCH_LOOKUPS * num_threads);
+}
+
+TEST_F(HashTableTest, DISABLED_LookupBenchmark)
+{
+   for (GLuint key = 1; key <= BENCH_OBJECTS; key++)
+      _mesa_HashInsert(table, key, value(key));
+
+   /* Wall-clock time divided by the lookups done by all threads. */
+   printf("threads  mutex ns/lookup  lock-free ns/lookup\n");
+   for (unsigned num_threads = 1; num_threads <= 8; num_threads *= 2) {
+      double locked = run_bench(table, num_threads, true);
+      double unlocked = run_bench(table, num_threads, false);
+
+      printf("%7u  %15.2f  %19.2f\n", num_threads, locked, unlocked);
+   }
+}
@@ -0,0 +1,348 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \name parallel_shader_compile.cpp
+ *
+ * Compile and link GLSL programs on the share group's compiler threads
+ * (GL_ARB_parallel_shader_compile) while the application thread keeps
+ * querying them and rebinding program pipelines, and check that
+ * synchronous debug output is only ever delivered on the calling thread.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "GL/gl.h"
+#include "GL/glext.h"
+#include "main/compiler.h"
+#include "main/api_exec.h"
+#include "main/context.h"
+#include "main/debug_output.h"
+#include "main/enable.h"
+#include "main/pipelineobj.h"
+#include "main/shaderapi.h"
+#include "main/uniforms.h"
+#include "glapi/glapi.h"
+#include "drivers/common/driverfuncs.h"
+#include "vbo/vbo.h"
+#include "c11/threads.h"
+#include "util/u_atomic.h"
+
+#define NUM_PROGRAMS 16
+
+struct debug_messages {
+   thrd_t app_thread;
+   int count;
+   int off_thread;
+};
+
+static void GLAPIENTRY
+debug_callback(GLenum source, GLenum type, GLuint id, GLenum severity,
+               GLsizei length, const GLchar *message, const void *userParam)
+{
+   struct debug_messages *msgs = (struct debug_messages *) userParam;
+
+   if (type != GL_DEBUG_TYPE_ERROR)
+      return;
+
+   p_atomic_inc(&msgs->count);
+   if (!thrd_equal(thrd_current(), msgs->app_thread))
+      p_atomic_inc(&msgs->off_thread);
+}
+
+class ParallelShaderCompile_test : public ::testing::Test {
+public:
+   virtual void SetUp();
+   virtual void TearDown();
+
+   GLuint compile(GLenum type, const std::string &source);
+   GLuint link(GLuint vs, GLuint fs);
+
+   struct gl_config visual;
+   struct dd_function_table driver_functions;
+   struct gl_context ctx;
+};
+
+void
+ParallelShaderCompile_test::SetUp()
+{
+   memset(&visual, 0, sizeof(visual));
+   memset(&driver_functions, 0, sizeof(driver_functions));
+   memset(&ctx, 0, sizeof(ctx));
+
+   _mesa_init_driver_functions(&driver_functions);
+   _mesa_initialize_context(&ctx,
+                            API_OPENGL_COMPAT,
+                            &visual,
+                            NULL, // share_list
+                            &driver_functions);
+   _vbo_CreateContext(&ctx);
+
+   ctx.Extensions.ARB_fragment_shader = true;
+   ctx.Extensions.ARB_vertex_shader = true;
+   _mesa_override_extensions(&ctx);
+   ctx.Version = 21;
+   ctx.Const.MaxShaderCompilerThreads = 4;
+
+   _mesa_initialize_dispatch_tables(&ctx);
+   _glapi_set_context(&ctx);
+}
+
+void
+ParallelShaderCompile_test::TearDown()
+{
+   _mesa_free_context_data(&ctx);
+   _glapi_set_context(NULL);
+}
+
+GLuint
+ParallelShaderCompile_test::compile(GLenum type, const std::string &source)
+{
+   const GLchar *string = source.c_str();
+   GLuint shader = _mesa_CreateShader(type);
+
+   _mesa_ShaderSource(shader, 1, &string, NULL);
+   _mesa_CompileShader(shader);
+   return shader;
+}
+
+GLuint
+ParallelShaderCompile_test::link(GLuint vs, GLuint fs)
+{
+   GLuint prog = _mesa_CreateProgram();
+
+   _mesa_AttachShader(prog, vs);
+   _mesa_AttachShader(prog, fs);
+   _mesa_LinkProgram(prog);
+   return prog;
+}
+
+/**
+ * A vertex shader long enough that compiling and linking it takes a while,
+ * so that the queries below see jobs that are still running.
+ */
+static std::string
+long_vertex_shader(unsigned seed)
+{
+   std::string source =
+      "#version 120\n"
+      "uniform vec4 u[8];\n"
+      "attribute vec4 pos;\n"
+      "varying vec4 v;\n"
+      "void main()\n"
+      "{\n"
+      "   vec4 a = pos;\n"
+      "   vec4 b = pos.wzyx;\n";
+
+   for (unsigned i = 0; i < 200; i++) {
+      const unsigned j = (seed + i * 3) % 8, k = (seed + i * 5) % 8;
+
+      source += "   a = a * u[" + std::to_string(j) + "] + b;\n";
+      source += "   b = max(b, dot(a, u[" + std::to_string(k) + "]) * a);\n";
+   }
+
+   source +=
+      "   v = a + b;\n"
+      "   gl_Position = a;\n"
+      "}\n";
+   return source;
+}
+
+static const char fragment_shader[] =
+   "#version 120\n"
+   "uniform vec4 tint;\n"
+   "varying vec4 v;\n"
+   "void main()\n"
+   "{\n"
+   "   gl_FragColor = v * tint;\n"
+   "}\n";
+
+static const char bad_fragment_shader[] =
+   "#version 120\n"
+   "varying vec4 v;\n"
+   "void main()\n"
+   "{\n"
+   "   gl_FragColor = v * undeclared;\n"
+   "}\n";
+
+static bool
+program_complete(GLuint prog)
+{
+   GLint status;
+
+   _mesa_GetProgramiv(prog, GL_COMPLETION_STATUS_ARB, &status);
+   return status;
+}
+
+TEST_F(ParallelShaderCompile_test, QueriesRaceCompileAndLink)
+{
+   GLuint vs[NUM_PROGRAMS], fs[NUM_PROGRAMS], prog[NUM_PROGRAMS];
+
+   for (unsigned pass = 0; pass < 2; pass++) {
+      for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+         const bool bad = i % 5 == 4;
+
+         if (pass == 0) {
+            vs[i] = compile(GL_VERTEX_SHADER, long_vertex_shader(i));
+            fs[i] = compile(GL_FRAGMENT_SHADER,
+                            bad ? bad_fragment_shader : fragment_shader);
+            prog[i] = link(vs[i], fs[i]);
+         } else {
+            /* Relink while earlier jobs may still be running. */
+            _mesa_LinkProgram(prog[i]);
+         }
+      }
+
+      /* Poll the programs and rebind pipelines (which swaps ctx->_Shader)
+       * while the compiler threads work through the queue.
+       */
+      unsigned pending;
+      do {
+         pending = 0;
+         for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+            GLint status;
+
+            if (!program_complete(prog[i]))
+               pending++;
+
+            _mesa_GetShaderiv(vs[i], GL_COMPLETION_STATUS_ARB, &status);
+            _mesa_GetShaderiv(fs[i], GL_COMPLETION_STATUS_ARB, &status);
+         }
+
+         GLuint pipeline;
+         _mesa_GenProgramPipelines(1, &pipeline);
+         _mesa_BindProgramPipeline(pipeline);
+         _mesa_BindProgramPipeline(0);
+         _mesa_DeleteProgramPipelines(1, &pipeline);
+      } while (pending);
+
+      for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+         const bool bad = i % 5 == 4;
+         GLint status, length;
+
+         _mesa_GetShaderiv(vs[i], GL_COMPILE_STATUS, &status);
+         EXPECT_EQ(GL_TRUE, status) << "program " << i;
+
+         _mesa_GetShaderiv(fs[i], GL_COMPILE_STATUS, &status);
+         EXPECT_EQ(bad ? GL_FALSE : GL_TRUE, status) << "program " << i;
+
+         _mesa_GetShaderiv(fs[i], GL_INFO_LOG_LENGTH, &length);
+         if (bad) {
+            EXPECT_LT(1, length) << "program " << i;
+         }
+
+         _mesa_GetProgramiv(prog[i], GL_LINK_STATUS, &status);
+         EXPECT_EQ(bad ? GL_FALSE : GL_TRUE, status) << "program " << i;
+
+         if (!bad) {
+            EXPECT_NE(-1, _mesa_GetUniformLocation(prog[i], "tint"))
+               << "program " << i;
+         }
+      }
+   }
+
+   /* Queries that have to wait for the link must not just return early. */
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++)
+      _mesa_LinkProgram(prog[i]);
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+      GLint status;
+
+      _mesa_GetProgramiv(prog[i], GL_LINK_STATUS, &status);
+      EXPECT_EQ(i % 5 == 4 ? GL_FALSE : GL_TRUE, status) << "program " << i;
+      EXPECT_TRUE(program_complete(prog[i])) << "program " << i;
+   }
+
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+      _mesa_DeleteProgram(prog[i]);
+      _mesa_DeleteShader(vs[i]);
+      _mesa_DeleteShader(fs[i]);
+   }
+
+   EXPECT_EQ((GLenum) GL_NO_ERROR, ctx.ErrorValue);
+}
+
+TEST_F(ParallelShaderCompile_test, SynchronousDebugOutputStaysOnAppThread)
+{
+   struct debug_messages msgs = { thrd_current(), 0, 0 };
+
+   _mesa_DebugMessageCallback(debug_callback, &msgs);
+   _mesa_Enable(GL_DEBUG_OUTPUT);
+   _mesa_Enable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+      const int count = p_atomic_read(&msgs.count);
+      GLuint vs = compile(GL_VERTEX_SHADER, long_vertex_shader(i));
+      GLuint fs = compile(GL_FRAGMENT_SHADER, bad_fragment_shader);
+
+      /* The messages have to be out by the time glCompileShader returns. */
+      EXPECT_LT(count, p_atomic_read(&msgs.count));
+
+      GLint status;
+      _mesa_GetShaderiv(vs, GL_COMPLETION_STATUS_ARB, &status);
+      EXPECT_EQ(GL_TRUE, status);
+
+      GLuint prog = link(vs, fs);
+      EXPECT_TRUE(program_complete(prog));
+
+      _mesa_DeleteProgram(prog);
+      _mesa_DeleteShader(vs);
+      _mesa_DeleteShader(fs);
+   }
+
+   EXPECT_EQ(0, p_atomic_read(&msgs.off_thread));
+}
+
+TEST_F(ParallelShaderCompile_test, EnablingSynchronousOutputFlushesQueue)
+{
+   struct debug_messages msgs = { thrd_current(), 0, 0 };
+   GLuint vs[NUM_PROGRAMS], fs[NUM_PROGRAMS];
+
+   _mesa_DebugMessageCallback(debug_callback, &msgs);
+   _mesa_Enable(GL_DEBUG_OUTPUT);
+
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+      vs[i] = compile(GL_VERTEX_SHADER, long_vertex_shader(i));
+      fs[i] = compile(GL_FRAGMENT_SHADER, bad_fragment_shader);
+   }
+
+   /* Asynchronous output may arrive on any thread, but none of it may
+    * arrive after synchronous output has been turned on.
+    */
+   _mesa_Enable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+   const int count = p_atomic_read(&msgs.count);
+   EXPECT_LE(NUM_PROGRAMS, count);
+
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+      GLint status;
+
+      _mesa_GetShaderiv(fs[i], GL_COMPILE_STATUS, &status);
+      EXPECT_EQ(GL_FALSE, status);
+   }
+   EXPECT_EQ(count, p_atomic_read(&msgs.count));
+
+   for (unsigned i = 0; i < NUM_PROGRAMS; i++) {
+      _mesa_DeleteShader(vs[i]);
+      _mesa_DeleteShader(fs[i]);
+   }
+}
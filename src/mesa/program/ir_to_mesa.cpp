@@ -2933,7 +2933,7 @@ get_mesa_program(struct gl_context *ctx,
 
    set_branchtargets(&v, mesa_instructions, num_instructions);
 
-   if (ctx->_Shader->Flags & GLSL_DUMP) {
+   if (ctx->Shader.Flags & GLSL_DUMP) {
       fprintf(stderr, "\n");
       fprintf(stderr, "GLSL IR for linked %s program %d:\n", target_string,
 	      shader_program->Name);
@@ -3131,7 +3131,7 @@ _mesa_glsl_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
    if (prog->data->LinkStatus == linking_skipped)
       return;
 
-   if (ctx->_Shader->Flags & GLSL_DUMP) {
+   if (ctx->Shader.Flags & GLSL_DUMP) {
       if (!prog->data->LinkStatus) {
 	 fprintf(stderr, "GLSL shader program %d failed to link\n", prog->Name);
       }
@@ -161,6 +161,7 @@ st_program_string_notify( struct gl_context *ctx,
 {
    struct st_context *st = st_context(ctx);
    gl_shader_stage stage = _mesa_program_enum_to_shader_stage(target);
+   bool current = st_is_current(st);
 
    if (target == GL_FRAGMENT_PROGRAM_ARB) {
       struct st_fragment_program *stfp = (struct st_fragment_program *) prog;
@@ -169,7 +170,7 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_fragment_program(st, stfp))
          return false;
 
-      if (st->fp == stfp)
+      if (current && st->fp == stfp)
 	 st->dirty |= stfp->affected_states;
    }
    else if (target == GL_GEOMETRY_PROGRAM_NV) {
@@ -180,7 +181,7 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_geometry_program(st, stgp))
          return false;
 
-      if (st->gp == stgp)
+      if (current && st->gp == stgp)
 	 st->dirty |= stgp->affected_states;
    }
    else if (target == GL_VERTEX_PROGRAM_ARB) {
@@ -190,7 +191,7 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_vertex_program(st, stvp))
          return false;
 
-      if (st->vp == stvp)
+      if (current && st->vp == stvp)
 	 st->dirty |= ST_NEW_VERTEX_PROGRAM(st, stvp);
    }
    else if (target == GL_TESS_CONTROL_PROGRAM_NV) {
@@ -202,7 +203,7 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_tessctrl_program(st, sttcp))
          return false;
 
-      if (st->tcp == sttcp)
+      if (current && st->tcp == sttcp)
          st->dirty |= sttcp->affected_states;
    }
    else if (target == GL_TESS_EVALUATION_PROGRAM_NV) {
@@ -214,7 +215,7 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_tesseval_program(st, sttep))
          return false;
 
-      if (st->tep == sttep)
+      if (current && st->tep == sttep)
          st->dirty |= sttep->affected_states;
    }
    else if (target == GL_COMPUTE_PROGRAM_NV) {
@@ -225,7 +226,7 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_compute_program(st, stcp))
          return false;
 
-      if (st->cp == stcp)
+      if (current && st->cp == stcp)
          st->dirty |= stcp->affected_states;
    }
    else if (target == GL_FRAGMENT_SHADER_ATI) {
@@ -241,12 +242,14 @@ st_program_string_notify( struct gl_context *ctx,
       if (!st_translate_fragment_program(st, stfp))
          return false;
 
-      if (st->fp == stfp)
+      if (current && st->fp == stfp)
          st->dirty |= stfp->affected_states;
    }
 
-   if (ST_DEBUG & DEBUG_PRECOMPILE ||
-       st->shader_has_one_variant[stage])
+   /* Programs linked on a compiler thread get their variant at first draw. */
+   if (current &&
+       (ST_DEBUG & DEBUG_PRECOMPILE ||
+        st->shader_has_one_variant[stage]))
       st_precompile_shader_variant(st, prog);
 
    return GL_TRUE;
@@ -78,6 +78,7 @@
 #include "st_vdpau.h"
 #include "st_texture.h"
 #include "pipe/p_context.h"
+#include "util/u_cpu_detect.h"
 #include "util/u_inlines.h"
 #include "util/u_upload_mgr.h"
 #include "util/u_vbuf.h"
@@ -518,6 +519,17 @@ st_create_context_priv(struct gl_context *ctx, struct pipe_context *pipe,
          ctx->Const.ShaderCompilerOptions[i].EmitNoIndirectSampler = true;
    }
 
+   /* GLSL compiles and links can run on the share group's compiler
+    * threads.  Off the context's thread they translate through the screen
+    * and read only the context's constants, extensions and driver hooks.
+    * They leave the pipe context, st->dirty and the bound programs alone
+    * (see st_is_current()).  Compiler messages go through the debug output
+    * lock.
+    */
+   util_cpu_detect();
+   ctx->Const.MaxShaderCompilerThreads =
+      util_cpu_caps.nr_cpus > 1 ? MIN2(util_cpu_caps.nr_cpus, 16) : 0;
+
    /* Set which shader types can be compiled at link time. */
    st->shader_has_one_variant[MESA_SHADER_VERTEX] =
          st->has_shareable_shaders &&
@@ -635,6 +647,12 @@ st_destroy_context(struct st_context *st)
    /* This must be called first so that glthread has a chance to finish */
    _mesa_glthread_destroy(ctx);
 
+   /* Links queued from this context still use its st_context and pipe
+    * context, which are torn down below.
+    */
+   if (util_queue_is_initialized(&ctx->Shared->ShaderCompilerQueue))
+      util_queue_finish(&ctx->Shared->ShaderCompilerQueue);
+
    _mesa_HashWalk(ctx->Shared->TexObjects, destroy_tex_sampler_cb, st);
 
    st_reference_fragprog(st, &st->fp, NULL);
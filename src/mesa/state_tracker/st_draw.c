@@ -105,6 +105,40 @@ translate_prim(const struct gl_context *ctx, unsigned prim)
    return prim;
 }
 
+/** Maximum number of draws passed to one cso_multi_draw() call */
+#define ST_MAX_MULTI_DRAWS 64
+
+/**
+ * Gather the prims following prims[0] that can go in the same multi-draw,
+ * i.e. only differ in their vertex range and have consecutive draw ids.
+ *
+ * \return the number of prims gathered in \p draws
+ */
+static unsigned
+gather_multi_draw(const struct _mesa_prim *prims, unsigned nr_prims,
+                  unsigned start, struct pipe_draw_start_count *draws)
+{
+   unsigned n;
+
+   nr_prims = MIN2(nr_prims, ST_MAX_MULTI_DRAWS);
+
+   for (n = 0; n < nr_prims; n++) {
+      if (n > 0 &&
+          (prims[n].mode != prims[0].mode ||
+           prims[n].num_instances != prims[0].num_instances ||
+           prims[n].base_instance != prims[0].base_instance ||
+           prims[n].draw_id != prims[0].draw_id + n ||
+           !prims[n].count))
+         break;
+
+      draws[n].start = start + prims[n].start;
+      draws[n].count = prims[n].count;
+      draws[n].index_bias = prims[n].basevertex;
+   }
+
+   return n;
+}
+
 static inline void
 prepare_draw(struct st_context *st, struct gl_context *ctx)
 {
@@ -142,6 +176,7 @@ st_draw_vbo(struct gl_context *ctx,
 {
    struct st_context *st = st_context(ctx);
    struct pipe_draw_info info;
+   struct pipe_draw_start_count draws[ST_MAX_MULTI_DRAWS];
    unsigned i;
    unsigned start = 0;
 
@@ -223,6 +258,20 @@ st_draw_vbo(struct gl_context *ctx,
                       info.index_size);
       }
 
+      /* glMultiDraw*() and the like: pass the following draws that only
+       * differ in their range along, so that the driver can set up the
+       * pipeline once for all of them.
+       */
+      if (!tfb_vertcount && i + 1 < nr_prims) {
+         unsigned n = gather_multi_draw(&prims[i], nr_prims - i, start, draws);
+
+         if (n > 1) {
+            cso_multi_draw(st->cso_context, &info, draws, n);
+            i += n - 1;
+            continue;
+         }
+      }
+
       /* Don't call u_trim_pipe_prim. Drivers should do it if they need it. */
       cso_draw_vbo(st->cso_context, &info);
    }
@@ -377,7 +377,7 @@ st_glsl_to_nir_post_opts(struct st_context *st, struct gl_program *prog,
    NIR_PASS_V(nir, st_nir_lower_builtin);
    NIR_PASS_V(nir, nir_lower_atomics, shader_program);
 
-   if (st->ctx->_Shader->Flags & GLSL_DUMP) {
+   if (st->ctx->Shader.Flags & GLSL_DUMP) {
       _mesa_log("\n");
       _mesa_log("NIR IR for linked %s program %d:\n",
              _mesa_shader_stage_to_string(prog->info.stage),
@@ -473,7 +473,7 @@ st_nir_get_mesa_program(struct gl_context *ctx,
    _mesa_generate_parameters_list_for_uniforms(ctx, shader_program, shader,
                                                prog->Parameters);
 
-   if (ctx->_Shader->Flags & GLSL_DUMP) {
+   if (ctx->Shader.Flags & GLSL_DUMP) {
       _mesa_log("\n");
       _mesa_log("GLSL IR for linked %s program %d:\n",
              _mesa_shader_stage_to_string(shader->Stage),
@@ -536,6 +536,63 @@ st_nir_link_shaders(nir_shader **producer, nir_shader **consumer)
 
 extern "C" {
 
+/* Ask the driver whether it can compile each linked stage of the program
+ * from NIR.  This runs the lowering st_link_nir() and st_finalize_nir()
+ * would on a throwaway copy, as the program can still be linked through
+ * TGSI at this point.
+ */
+bool
+st_nir_is_supported(struct gl_context *ctx,
+                    struct gl_shader_program *shader_program)
+{
+   struct pipe_screen *pscreen = st_context(ctx)->pipe->screen;
+
+   if (!pscreen->is_nir_shader_supported)
+      return true;
+
+   for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
+      if (!shader_program->_LinkedShaders[i])
+         continue;
+
+      gl_shader_stage stage = (gl_shader_stage) i;
+      enum pipe_shader_type ptarget = pipe_shader_type_from_mesa(stage);
+      const nir_shader_compiler_options *options =
+         (const nir_shader_compiler_options *)
+         pscreen->get_compiler_options(pscreen, PIPE_SHADER_IR_NIR, ptarget);
+
+      nir_shader *nir = glsl_to_nir(shader_program, stage, options);
+      st_nir_opts(nir);
+
+      if (stage != MESA_SHADER_TESS_CTRL &&
+          stage != MESA_SHADER_TESS_EVAL) {
+         NIR_PASS_V(nir, nir_lower_io_to_temporaries,
+                    nir_shader_get_entrypoint(nir),
+                    true, true);
+      }
+      NIR_PASS_V(nir, nir_lower_global_vars_to_local);
+      NIR_PASS_V(nir, nir_split_var_copies);
+      NIR_PASS_V(nir, nir_lower_var_copies);
+      NIR_PASS_V(nir, nir_lower_system_values);
+      NIR_PASS_V(nir, st_nir_lower_builtin);
+      NIR_PASS_V(nir, nir_lower_atomics, shader_program);
+      NIR_PASS_V(nir, nir_lower_atomics_to_ssbo,
+                 ctx->Const.Program[stage].MaxAtomicBuffers);
+
+      if (pscreen->get_param(pscreen, PIPE_CAP_NIR_SAMPLERS_AS_DEREF))
+         NIR_PASS_V(nir, nir_lower_samplers_as_deref, shader_program);
+      else
+         NIR_PASS_V(nir, nir_lower_samplers, shader_program);
+
+      bool supported = pscreen->is_nir_shader_supported(pscreen, ptarget, nir);
+      ralloc_free(nir);
+
+      if (!supported)
+         return false;
+   }
+
+   return true;
+}
+
 bool
 st_link_nir(struct gl_context *ctx,
             struct gl_shader_program *shader_program)
@@ -6771,7 +6771,7 @@ get_mesa_program_tgsi(struct gl_context *ctx,
    /* Write the END instruction. */
    v->emit_asm(NULL, TGSI_OPCODE_END);
 
-   if (ctx->_Shader->Flags & GLSL_DUMP) {
+   if (ctx->Shader.Flags & GLSL_DUMP) {
       _mesa_log("\n");
       _mesa_log("GLSL IR for linked %s program %d:\n",
              _mesa_shader_stage_to_string(shader->Stage),
@@ -6925,7 +6925,10 @@ st_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
    struct pipe_screen *pscreen = ctx->st->pipe->screen;
    assert(prog->data->LinkStatus);
 
-   bool use_nir = false;
+   /* NIR is only used when every linked stage takes it, as drivers may
+    * accept NIR for some stages only.
+    */
+   bool use_nir = true;
    for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
       if (prog->_LinkedShaders[i] == NULL)
          continue;
@@ -6948,8 +6951,8 @@ st_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
       enum pipe_shader_ir preferred_ir = (enum pipe_shader_ir)
          pscreen->get_shader_param(pscreen, ptarget,
                                    PIPE_SHADER_CAP_PREFERRED_IR);
-      if (preferred_ir == PIPE_SHADER_IR_NIR)
-         use_nir = true;
+      if (preferred_ir != PIPE_SHADER_IR_NIR)
+         use_nir = false;
 
       /* If there are forms of indirect addressing that the driver
        * cannot handle, perform the lowering pass.
@@ -7059,7 +7062,8 @@ st_link_shader(struct gl_context *ctx, struct gl_shader_program *prog)
 
    build_program_resource_list(ctx, prog);
 
-   if (use_nir)
+   /* Shaders the driver can't compile from NIR go through TGSI instead. */
+   if (use_nir && st_nir_is_supported(ctx, prog))
       return st_link_nir(ctx, prog);
 
    for (unsigned i = 0; i < MESA_SHADER_STAGES; i++) {
@@ -41,6 +41,10 @@ void st_finalize_nir(struct st_context *st, struct gl_program *prog,
                      struct gl_shader_program *shader_program,
                      struct nir_shader *nir);
 
+bool
+st_nir_is_supported(struct gl_context *ctx,
+                    struct gl_shader_program *shader_program);
+
 bool
 st_link_nir(struct gl_context *ctx,
             struct gl_shader_program *shader_program);
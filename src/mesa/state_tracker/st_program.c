@@ -31,6 +31,7 @@
   */
 
 
+#include "main/context.h"
 #include "main/imports.h"
 #include "main/hash.h"
 #include "main/mtypes.h"
@@ -1954,3 +1955,18 @@ st_precompile_shader_variant(struct st_context *st,
       assert(0);
    }
 }
+
+
+/**
+ * Whether \p st is current on the calling thread.  When it isn't, the
+ * caller is linking on one of the share group's compiler threads: it must
+ * not use the pipe context or the dirty state, and the programs it creates
+ * aren't bound anywhere yet.
+ */
+bool
+st_is_current(struct st_context *st)
+{
+   GET_CURRENT_CONTEXT(ctx);
+
+   return ctx == st->ctx;
+}
@@ -449,6 +449,9 @@ extern void
 st_precompile_shader_variant(struct st_context *st,
                              struct gl_program *prog);
 
+extern bool
+st_is_current(struct st_context *st);
+
 #ifdef __cplusplus
 }
 #endif
@@ -126,7 +126,7 @@ st_store_tgsi_in_disk_cache(struct st_context *st, struct gl_program *prog)
 
    st_serialise_tgsi_program(st->ctx, prog);
 
-   if (st->ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+   if (st->ctx->Shader.Flags & GLSL_CACHE_INFO) {
       fprintf(stderr, "putting %s tgsi_tokens in cache\n",
               _mesa_shader_stage_to_string(prog->info.stage));
    }
@@ -157,6 +157,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
                             struct gl_program *prog)
 {
    struct st_context *st = st_context(ctx);
+   bool current = st_is_current(st);
    size_t size = prog->driver_cache_blob_size;
    uint8_t *buffer = (uint8_t *) prog->driver_cache_blob;
 
@@ -179,7 +180,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
       read_tgsi_from_cache(&blob_reader, &stvp->tgsi.tokens,
                            &stvp->num_tgsi_tokens);
 
-      if (st->vp == stvp)
+      if (current && st->vp == stvp)
          st->dirty |= ST_NEW_VERTEX_PROGRAM(st, stvp);
 
       break;
@@ -194,7 +195,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
       read_tgsi_from_cache(&blob_reader, &sttcp->tgsi.tokens,
                            &sttcp->num_tgsi_tokens);
 
-      if (st->tcp == sttcp)
+      if (current && st->tcp == sttcp)
          st->dirty |= sttcp->affected_states;
 
       break;
@@ -209,7 +210,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
       read_tgsi_from_cache(&blob_reader, &sttep->tgsi.tokens,
                            &sttep->num_tgsi_tokens);
 
-      if (st->tep == sttep)
+      if (current && st->tep == sttep)
          st->dirty |= sttep->affected_states;
 
       break;
@@ -224,7 +225,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
       read_tgsi_from_cache(&blob_reader, &stgp->tgsi.tokens,
                            &stgp->num_tgsi_tokens);
 
-      if (st->gp == stgp)
+      if (current && st->gp == stgp)
          st->dirty |= stgp->affected_states;
 
       break;
@@ -237,7 +238,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
       read_tgsi_from_cache(&blob_reader, &stfp->tgsi.tokens,
                            &stfp->num_tgsi_tokens);
 
-      if (st->fp == stfp)
+      if (current && st->fp == stfp)
          st->dirty |= stfp->affected_states;
 
       break;
@@ -255,7 +256,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
       stcp->tgsi.req_private_mem = 0;
       stcp->tgsi.req_input_mem = 0;
 
-      if (st->cp == stcp)
+      if (current && st->cp == stcp)
          st->dirty |= stcp->affected_states;
 
       break;
@@ -271,7 +272,7 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
    if (blob_reader.current != blob_reader.end || blob_reader.overrun) {
       assert(!"Invalid TGSI shader disk cache item!");
 
-      if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+      if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
          fprintf(stderr, "Error reading program from cache (invalid "
                  "TGSI cache item)\n");
       }
@@ -281,8 +282,9 @@ st_deserialise_tgsi_program(struct gl_context *ctx,
    _mesa_associate_uniform_storage(ctx, shProg, prog, false);
 
    /* Create Gallium shaders now instead of on demand. */
-   if (ST_DEBUG & DEBUG_PRECOMPILE ||
-       st->shader_has_one_variant[prog->info.stage])
+   if (current &&
+       (ST_DEBUG & DEBUG_PRECOMPILE ||
+        st->shader_has_one_variant[prog->info.stage]))
       st_precompile_shader_variant(st, prog);
 }
 
@@ -311,7 +313,7 @@ st_load_tgsi_from_disk_cache(struct gl_context *ctx,
       glprog->driver_cache_blob = NULL;
       glprog->driver_cache_blob_size = 0;
 
-      if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+      if (ctx->Shader.Flags & GLSL_CACHE_INFO) {
          fprintf(stderr, "%s tgsi_tokens retrieved from cache\n",
                  _mesa_shader_stage_to_string(i));
       }
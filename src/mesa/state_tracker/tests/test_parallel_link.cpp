@@ -0,0 +1,306 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \name test_parallel_link.cpp
+ *
+ * Link GLSL programs on the share group's compiler threads through st/mesa
+ * on softpipe, then draw with them.  This runs st_program_string_notify()
+ * and st_deserialise_tgsi_program() off the context's thread (where
+ * st_is_current() is false), and st_destroy_context() with links queued.
+ */
+
+#include <gtest/gtest.h>
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "GL/gl.h"
+#include "GL/glext.h"
+#include "main/context.h"
+#include "main/dispatch.h"
+#include "main/mtypes.h"
+#include "main/shaderapi.h"
+#include "main/shaderobj.h"
+#include "main/uniforms.h"
+#include "pipe/p_screen.h"
+#include "state_tracker/st_api.h"
+#include "softpipe/sp_public.h"
+#include "util/disk_cache.h"
+
+extern "C" {
+#include "main/fbobject.h"
+#include "main/readpix.h"
+#include "main/varray.h"
+#include "main/viewport.h"
+#include "state_tracker/st_gl_api.h"
+#include "sw/null/null_sw_winsys.h"
+}
+
+#define WIDTH 16
+#define HEIGHT 16
+
+static const char vertex_shader[] =
+   "#version 120\n"
+   "attribute vec4 pos;\n"
+   "void main()\n"
+   "{\n"
+   "   gl_Position = pos;\n"
+   "}\n";
+
+static const char fragment_shader[] =
+   "#version 120\n"
+   "uniform vec4 color;\n"
+   "void main()\n"
+   "{\n"
+   "   gl_FragColor = color;\n"
+   "}\n";
+
+static const GLfloat quad[4][2] = {
+   { -1.0f, -1.0f }, { 1.0f, -1.0f }, { -1.0f, 1.0f }, { 1.0f, 1.0f }
+};
+
+/** The disk cache the test hands to softpipe, which doesn't have one. */
+static struct disk_cache *test_disk_cache;
+
+static struct disk_cache *
+get_test_disk_cache(struct pipe_screen *screen)
+{
+   return test_disk_cache;
+}
+
+static int
+remove_cache_file(const char *path, const struct stat *sb, int type,
+                  struct FTW *ftw)
+{
+   return remove(path);
+}
+
+static int
+get_manager_param(struct st_manager *smapi, enum st_manager_param param)
+{
+   return 0;
+}
+
+class ParallelLink_test : public ::testing::Test {
+public:
+   virtual void SetUp();
+   virtual void TearDown();
+
+   void create_context();
+   void destroy_context();
+
+   GLuint link();
+   void draw(GLuint prog, GLfloat r, GLfloat g, GLfloat b);
+   void expect_color(GLubyte r, GLubyte g, GLubyte b);
+
+   struct st_api *stapi;
+   struct st_manager manager;
+   struct st_context_iface *stctx;
+   struct gl_context *ctx;
+   GLuint fbo, rb;
+};
+
+void
+ParallelLink_test::SetUp()
+{
+   memset(&manager, 0, sizeof(manager));
+   manager.screen = softpipe_create_screen(null_sw_create());
+   manager.screen->get_disk_shader_cache = get_test_disk_cache;
+   manager.get_param = get_manager_param;
+
+   stapi = st_gl_api_create();
+   stctx = NULL;
+}
+
+void
+ParallelLink_test::TearDown()
+{
+   if (stctx)
+      destroy_context();
+   if (manager.destroy)
+      manager.destroy(&manager);
+   manager.screen->destroy(manager.screen);
+}
+
+void
+ParallelLink_test::create_context()
+{
+   struct st_context_attribs attribs;
+   enum st_context_error error;
+
+   memset(&attribs, 0, sizeof(attribs));
+   attribs.profile = ST_PROFILE_DEFAULT;
+   attribs.major = 1;
+
+   stctx = stapi->create_context(stapi, &manager, &attribs, &error, NULL);
+   ASSERT_TRUE(stctx != NULL);
+   ASSERT_TRUE(stapi->make_current(stapi, stctx, NULL, NULL));
+
+   ctx = _mesa_get_current_context();
+
+   /* Don't depend on the number of CPUs this runs on. */
+   ctx->Const.MaxShaderCompilerThreads = 4;
+
+   _mesa_GenRenderbuffers(1, &rb);
+   _mesa_BindRenderbuffer(GL_RENDERBUFFER, rb);
+   _mesa_RenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, WIDTH, HEIGHT);
+   _mesa_GenFramebuffers(1, &fbo);
+   _mesa_BindFramebuffer(GL_FRAMEBUFFER, fbo);
+   _mesa_FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                 GL_RENDERBUFFER, rb);
+   ASSERT_EQ((GLenum) GL_FRAMEBUFFER_COMPLETE,
+             _mesa_CheckFramebufferStatus(GL_FRAMEBUFFER));
+   _mesa_Viewport(0, 0, WIDTH, HEIGHT);
+
+   _mesa_VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, quad);
+   _mesa_EnableVertexAttribArray(0);
+}
+
+void
+ParallelLink_test::destroy_context()
+{
+   /* Leave links queued for st_destroy_context() to wait on. */
+   link();
+
+   stctx->destroy(stctx);
+   stapi->make_current(stapi, NULL, NULL, NULL);
+   stctx = NULL;
+}
+
+/**
+ * Link a new program.  As it isn't current, the link is queued.
+ */
+GLuint
+ParallelLink_test::link()
+{
+   const GLchar *vs_source = vertex_shader, *fs_source = fragment_shader;
+   GLuint vs = _mesa_CreateShader(GL_VERTEX_SHADER);
+   GLuint fs = _mesa_CreateShader(GL_FRAGMENT_SHADER);
+   GLuint prog = _mesa_CreateProgram();
+
+   _mesa_ShaderSource(vs, 1, &vs_source, NULL);
+   _mesa_CompileShader(vs);
+   _mesa_ShaderSource(fs, 1, &fs_source, NULL);
+   _mesa_CompileShader(fs);
+
+   _mesa_AttachShader(prog, vs);
+   _mesa_AttachShader(prog, fs);
+   _mesa_BindAttribLocation(prog, 0, "pos");
+   _mesa_LinkProgram(prog);
+
+   _mesa_DeleteShader(vs);
+   _mesa_DeleteShader(fs);
+   return prog;
+}
+
+void
+ParallelLink_test::draw(GLuint prog, GLfloat r, GLfloat g, GLfloat b)
+{
+   GLint status;
+
+   _mesa_GetProgramiv(prog, GL_LINK_STATUS, &status);
+   ASSERT_EQ(GL_TRUE, status);
+
+   _mesa_UseProgram(prog);
+   _mesa_Uniform4f(_mesa_GetUniformLocation(prog, "color"), r, g, b, 1.0f);
+   CALL_DrawArrays(ctx->Exec, (GL_TRIANGLE_STRIP, 0, 4));
+}
+
+void
+ParallelLink_test::expect_color(GLubyte r, GLubyte g, GLubyte b)
+{
+   GLubyte pixel[4];
+
+   _mesa_ReadPixels(WIDTH / 2, HEIGHT / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                    pixel);
+   EXPECT_EQ(r, pixel[0]);
+   EXPECT_EQ(g, pixel[1]);
+   EXPECT_EQ(b, pixel[2]);
+}
+
+TEST_F(ParallelLink_test, DrawWithProgramLinkedOnCompilerThread)
+{
+   create_context();
+
+   GLuint red = link();
+   EXPECT_TRUE(util_queue_is_initialized(&ctx->Shared->ShaderCompilerQueue));
+   draw(red, 1.0f, 0.0f, 0.0f);
+   expect_color(255, 0, 0);
+
+   /* Link while another program is bound and its state is dirty. */
+   GLuint green = link();
+   draw(green, 0.0f, 1.0f, 0.0f);
+   expect_color(0, 255, 0);
+
+   /* Relink the program that isn't current, then switch back to it. */
+   _mesa_LinkProgram(red);
+   draw(red, 0.0f, 0.0f, 1.0f);
+   expect_color(0, 0, 255);
+
+   _mesa_DeleteProgram(red);
+   _mesa_DeleteProgram(green);
+   EXPECT_EQ((GLenum) GL_NO_ERROR, ctx->ErrorValue);
+}
+
+TEST_F(ParallelLink_test, DrawWithProgramLoadedFromCacheOnCompilerThread)
+{
+   char dir[] = "/tmp/st_parallel_link_XXXXXX";
+
+   ASSERT_TRUE(mkdtemp(dir) != NULL);
+   setenv("MESA_GLSL_CACHE_DIR", dir, 1);
+
+   test_disk_cache = disk_cache_create("softpipe", "parallel_link", 0);
+   if (!test_disk_cache) {
+      /* Built without the shader cache. */
+      unsetenv("MESA_GLSL_CACHE_DIR");
+      rmdir(dir);
+      return;
+   }
+
+   /* Fill the cache. */
+   create_context();
+   GLuint prog = link();
+   draw(prog, 1.0f, 0.0f, 0.0f);
+   expect_color(255, 0, 0);
+   destroy_context();
+
+   disk_cache_wait_for_idle(test_disk_cache);
+
+   create_context();
+   prog = link();
+   draw(prog, 0.0f, 1.0f, 0.0f);
+   expect_color(0, 255, 0);
+
+   struct gl_shader_program *shProg = _mesa_lookup_shader_program(ctx, prog);
+   EXPECT_EQ(linking_skipped, shProg->data->LinkStatus);
+   EXPECT_EQ((GLenum) GL_NO_ERROR, ctx->ErrorValue);
+
+   destroy_context();
+   disk_cache_destroy(test_disk_cache);
+   test_disk_cache = NULL;
+   unsetenv("MESA_GLSL_CACHE_DIR");
+   nftw(dir, remove_cache_file, 16, FTW_DEPTH | FTW_PHYS);
+}
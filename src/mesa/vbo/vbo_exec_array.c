@@ -718,6 +718,79 @@ vbo_exec_DrawArraysInstancedBaseInstance(GLenum mode, GLint first,
 }
 
 
+/**
+ * Draw all the arrays of a glMultiDrawArrays() call with one draw_prims()
+ * call, so that the driver can set up the pipeline once for all of them.
+ */
+static void
+vbo_validated_multidrawarrays(struct gl_context *ctx, GLenum mode,
+                              const GLint *first, const GLsizei *count,
+                              GLsizei primcount)
+{
+   struct vbo_context *vbo = vbo_context(ctx);
+   struct _mesa_prim *prim;
+   /* first[i] + count[i] - 1 doesn't always fit in a GLuint, and first[i]
+    * isn't checked to be non-negative.
+    */
+   int64_t min_index = INT64_MAX, max_index = 0;
+   GLuint nr_prims = 0;
+   GLint i;
+
+   if (primcount <= 0 || skip_validated_draw(ctx))
+      return;
+
+   prim = calloc(primcount, sizeof(*prim));
+   if (prim == NULL) {
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glMultiDrawArrays");
+      return;
+   }
+
+   for (i = 0; i < primcount; i++) {
+      if (count[i] <= 0)
+         continue;
+
+      if (0)
+         check_draw_arrays_data(ctx, first[i], count[i]);
+
+      /* The GL_ARB_shader_draw_parameters spec adds the following after the
+       * pseudo-code describing glMultiDrawArrays:
+       *
+       *    "The index of the draw (<i> in the above pseudo-code) may be
+       *     read by a vertex shader as <gl_DrawIDARB>, as described in
+       *     Section 11.1.3.9."
+       */
+      prim[nr_prims].begin = 1;
+      prim[nr_prims].end = 1;
+      prim[nr_prims].mode = mode;
+      prim[nr_prims].num_instances = 1;
+      prim[nr_prims].draw_id = i;
+      prim[nr_prims].start = first[i];
+      prim[nr_prims].count = count[i];
+      nr_prims++;
+
+      min_index = MIN2(min_index, first[i]);
+      max_index = MAX2(max_index, (int64_t) first[i] + count[i] - 1);
+
+      if (0)
+         print_draw_arrays(ctx, mode, first[i], count[i]);
+   }
+
+   if (nr_prims) {
+      vbo_bind_arrays(ctx);
+
+      vbo->draw_prims(ctx, prim, nr_prims, NULL, GL_TRUE,
+                      CLAMP(min_index, 0, UINT32_MAX),
+                      CLAMP(max_index, 0, UINT32_MAX), NULL, 0, NULL);
+
+      if (MESA_DEBUG_FLAGS & DEBUG_ALWAYS_FLUSH) {
+         _mesa_flush(ctx);
+      }
+   }
+
+   free(prim);
+}
+
+
 /**
  * Called from glMultiDrawArrays when in immediate mode.
  */
@@ -726,7 +799,6 @@ vbo_exec_MultiDrawArrays(GLenum mode, const GLint *first,
                          const GLsizei *count, GLsizei primcount)
 {
    GET_CURRENT_CONTEXT(ctx);
-   GLint i;
 
    if (MESA_VERBOSE & VERBOSE_DRAW)
       _mesa_debug(ctx,
@@ -743,24 +815,7 @@ vbo_exec_MultiDrawArrays(GLenum mode, const GLint *first,
          return;
    }
 
-   for (i = 0; i < primcount; i++) {
-      if (count[i] > 0) {
-         if (0)
-            check_draw_arrays_data(ctx, first[i], count[i]);
-
-         /* The GL_ARB_shader_draw_parameters spec adds the following after the
-          * pseudo-code describing glMultiDrawArrays:
-          *
-          *    "The index of the draw (<i> in the above pseudo-code) may be
-          *     read by a vertex shader as <gl_DrawIDARB>, as described in
-          *     Section 11.1.3.9."
-          */
-         vbo_draw_arrays(ctx, mode, first[i], count[i], 1, 0, i);
-
-         if (0)
-            print_draw_arrays(ctx, mode, first[i], count[i]);
-      }
-   }
+   vbo_validated_multidrawarrays(ctx, mode, first, count, primcount);
 }
 
 
@@ -41,15 +41,20 @@
 
 #include "util/crc32.h"
 #include "util/debug.h"
+#include "util/hash_table.h"
+#include "util/list.h"
 #include "util/rand_xor.h"
 #include "util/u_atomic.h"
 #include "util/u_queue.h"
 #include "util/mesa-sha1.h"
 #include "util/ralloc.h"
+#include "util/simple_mtx.h"
 #include "main/compiler.h"
 #include "main/errors.h"
 
 #include "disk_cache.h"
+#include "disk_cache_db.h"
+#include "disk_cache_image.h"
 
 /* Number of bits to mask off from a cache key to get an index. */
 #define CACHE_INDEX_KEY_BITS 16
@@ -72,7 +77,15 @@
  * - There is no strict requirement that cache versions be backwards
  *   compatible but effort should be taken to limit disruption where possible.
  */
-#define CACHE_VERSION 1
+#define CACHE_VERSION 2
+
+/* Entries smaller than this are stored uncompressed, setting up zlib costs
+ * more than it saves on them.
+ */
+#define CACHE_MIN_COMPRESS_SIZE 1024
+
+/* Default size of the in-memory cache of decompressed entries. */
+#define CACHE_DEFAULT_MEMORY_SIZE (16 * 1024 * 1024)
 
 struct disk_cache {
    /* The path to the cache directory. */
@@ -100,6 +113,36 @@ struct disk_cache {
    /* Driver cache keys. */
    uint8_t *driver_keys_blob;
    size_t driver_keys_blob_size;
+
+   /* Packed single-file storage, or NULL to use one file per entry. */
+   struct disk_cache_db *db;
+
+   /* Read-only prebuilt images, searched before the cache itself. */
+   struct disk_cache_image **images;
+   unsigned num_images;
+
+   /* zlib level for new entries, or 0 to store them uncompressed. */
+   int compression_level;
+
+   /* Entries this process has already read, decompressed, so that looking
+    * them up again doesn't go back to the file system.  mem_lru is ordered
+    * from most to least recently used.  mem_entries is NULL when disabled.
+    */
+   simple_mtx_t mem_mtx;
+   struct hash_table *mem_entries;
+   struct list_head mem_lru;
+   uint64_t mem_size;
+   uint64_t mem_max_size;
+};
+
+struct mem_cache_entry {
+   struct list_head link;
+
+   cache_key key;
+
+   /* Decompressed data, which follows the structure. */
+   void *data;
+   size_t size;
 };
 
 struct disk_cache_put_job {
@@ -178,6 +221,55 @@ concatenate_and_mkdir(void *ctx, const char *path, const char *name)
       return NULL;
 }
 
+/* Parse a size given as a number optionally followed by 'K', 'M', or 'G',
+ * (gigabytes if there is no suffix).
+ *
+ * Returns false if \str doesn't start with a number.
+ */
+static bool
+parse_size(const char *str, uint64_t *size)
+{
+   char *end;
+
+   *size = strtoul(str, &end, 10);
+   if (end == str)
+      return false;
+
+   switch (*end) {
+   case 'K':
+   case 'k':
+      *size *= 1024;
+      break;
+   case 'M':
+   case 'm':
+      *size *= 1024*1024;
+      break;
+   case '\0':
+   case 'G':
+   case 'g':
+   default:
+      *size *= 1024*1024*1024;
+      break;
+   }
+
+   return true;
+}
+
+/* Keys are SHA-1 signatures, so any four bytes of them are a good hash. */
+static uint32_t
+key_hash(const void *key)
+{
+   uint32_t hash;
+   memcpy(&hash, key, sizeof(hash));
+   return hash;
+}
+
+static bool
+key_equals(const void *a, const void *b)
+{
+   return memcmp(a, b, CACHE_KEY_SIZE) == 0;
+}
+
 #define DRV_KEY_CPY(_dst, _src, _src_size) \
 do {                                       \
    memcpy(_dst, _src, _src_size);          \
@@ -190,7 +282,7 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
 {
    void *local;
    struct disk_cache *cache = NULL;
-   char *path, *max_size_str;
+   char *path, *max_size_str, *str;
    uint64_t max_size;
    int fd = -1;
    struct stat sb;
@@ -273,7 +365,7 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
          goto fail;
    }
 
-   cache = ralloc(NULL, struct disk_cache);
+   cache = rzalloc(NULL, struct disk_cache);
    if (cache == NULL)
       goto fail;
 
@@ -328,30 +420,8 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
    max_size = 0;
 
    max_size_str = getenv("MESA_GLSL_CACHE_MAX_SIZE");
-   if (max_size_str) {
-      char *end;
-      max_size = strtoul(max_size_str, &end, 10);
-      if (end == max_size_str) {
-         max_size = 0;
-      } else {
-         switch (*end) {
-         case 'K':
-         case 'k':
-            max_size *= 1024;
-            break;
-         case 'M':
-         case 'm':
-            max_size *= 1024*1024;
-            break;
-         case '\0':
-         case 'G':
-         case 'g':
-         default:
-            max_size *= 1024*1024*1024;
-            break;
-         }
-      }
-   }
+   if (max_size_str && !parse_size(max_size_str, &max_size))
+      max_size = 0;
 
    /* Default to 1GB for maximum cache size. */
    if (max_size == 0) {
@@ -360,6 +430,41 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
 
    cache->max_size = max_size;
 
+   /* Optionally pack all entries into a single file, for file systems where
+    * opening many small files is expensive.
+    */
+   if (env_var_as_boolean("MESA_GLSL_CACHE_SINGLE_FILE", false)) {
+      cache->db = disk_cache_db_open(cache, cache->path, max_size);
+      if (cache->db == NULL)
+         goto fail;
+   }
+
+   /* Favour speed over size by default: decompression is equally fast
+    * either way, but compressing at the best level is several times slower.
+    */
+   cache->compression_level = Z_BEST_SPEED;
+   str = getenv("MESA_GLSL_CACHE_COMPRESSION");
+   if (str) {
+      if (strcmp(str, "none") == 0)
+         cache->compression_level = 0;
+      else if (strcmp(str, "best") == 0)
+         cache->compression_level = Z_BEST_COMPRESSION;
+   }
+
+   cache->mem_max_size = CACHE_DEFAULT_MEMORY_SIZE;
+   str = getenv("MESA_GLSL_CACHE_MEMORY_SIZE");
+   if (str && !parse_size(str, &cache->mem_max_size))
+      cache->mem_max_size = CACHE_DEFAULT_MEMORY_SIZE;
+
+   simple_mtx_init(&cache->mem_mtx, mtx_plain);
+   list_inithead(&cache->mem_lru);
+   if (cache->mem_max_size) {
+      cache->mem_entries = _mesa_hash_table_create(cache, key_hash,
+                                                   key_equals);
+      if (cache->mem_entries == NULL)
+         goto fail;
+   }
+
    /* 1 thread was chosen because we don't really care about getting things
     * to disk quickly just that it's not blocking other tasks.
     *
@@ -402,6 +507,38 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
    DRV_KEY_CPY(drv_key_blob, &ptr_size, ptr_size_size)
    DRV_KEY_CPY(drv_key_blob, &driver_flags, driver_flags_size)
 
+   /* Map the prebuilt images listed in $MESA_GLSL_CACHE_IMAGES, (separated
+    * by colons), in order of precedence.
+    */
+   char *images = getenv("MESA_GLSL_CACHE_IMAGES");
+   if (images) {
+      char *list = ralloc_strdup(local, images);
+      char *filename, *saveptr = NULL;
+
+      for (filename = list ? strtok_r(list, ":", &saveptr) : NULL;
+           filename != NULL;
+           filename = strtok_r(NULL, ":", &saveptr)) {
+         struct disk_cache_image *image =
+            disk_cache_image_open(cache, filename);
+         if (image == NULL) {
+            fprintf(stderr, "Cannot use %s as a shader cache image"
+                            "---ignoring.\n", filename);
+            continue;
+         }
+
+         struct disk_cache_image **tmp =
+            reralloc(cache, cache->images, struct disk_cache_image *,
+                     cache->num_images + 1);
+         if (tmp == NULL) {
+            disk_cache_image_close(image);
+            break;
+         }
+
+         cache->images = tmp;
+         cache->images[cache->num_images++] = image;
+      }
+   }
+
    /* Seed our rand function */
    s_rand_xorshift128plus(cache->seed_xorshift128plus, true);
 
@@ -412,6 +549,10 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
  fail:
    if (fd != -1)
       close(fd);
+   if (cache && cache->index_mmap && cache->index_mmap != MAP_FAILED)
+      munmap(cache->index_mmap, cache->index_mmap_size);
+   if (cache && cache->db)
+      disk_cache_db_close(cache->db);
    if (cache)
       ralloc_free(cache);
    ralloc_free(local);
@@ -425,11 +566,25 @@ disk_cache_destroy(struct disk_cache *cache)
    if (cache) {
       util_queue_destroy(&cache->cache_queue);
       munmap(cache->index_mmap, cache->index_mmap_size);
+      if (cache->db)
+         disk_cache_db_close(cache->db);
+      for (unsigned i = 0; i < cache->num_images; i++)
+         disk_cache_image_close(cache->images[i]);
+      list_for_each_entry_safe(struct mem_cache_entry, entry,
+                               &cache->mem_lru, link)
+         free(entry);
+      simple_mtx_destroy(&cache->mem_mtx);
    }
 
    ralloc_free(cache);
 }
 
+void
+disk_cache_wait_for_idle(struct disk_cache *cache)
+{
+   util_queue_finish(&cache->cache_queue);
+}
+
 /* Return a filename within the cache's directory corresponding to 'key'. The
  * returned filename is ralloced with 'cache' as the parent context.
  *
@@ -651,11 +806,122 @@ evict_lru_item(struct disk_cache *cache)
       p_atomic_add(cache->size, - (uint64_t)size);
 }
 
+/* Drop \entry from the in-memory cache.  Called with mem_mtx held. */
+static void
+mem_cache_evict(struct disk_cache *cache, struct mem_cache_entry *entry)
+{
+   struct hash_entry *he =
+      _mesa_hash_table_search(cache->mem_entries, entry->key);
+
+   _mesa_hash_table_remove(cache->mem_entries, he);
+   list_del(&entry->link);
+   cache->mem_size -= entry->size;
+   free(entry);
+}
+
+/* Return a malloc'ed copy of the in-memory entry for \key, if any. */
+static void *
+mem_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
+{
+   struct hash_entry *he;
+   void *data = NULL;
+
+   if (cache->mem_entries == NULL)
+      return NULL;
+
+   simple_mtx_lock(&cache->mem_mtx);
+
+   he = _mesa_hash_table_search(cache->mem_entries, key);
+   if (he) {
+      struct mem_cache_entry *entry = he->data;
+
+      list_del(&entry->link);
+      list_add(&entry->link, &cache->mem_lru);
+
+      data = malloc(entry->size);
+      if (data) {
+         memcpy(data, entry->data, entry->size);
+         if (size)
+            *size = entry->size;
+      }
+   }
+
+   simple_mtx_unlock(&cache->mem_mtx);
+
+   return data;
+}
+
+/* Keep a copy of \data in memory, evicting the least recently used entries
+ * to make room for it.
+ */
+static void
+mem_cache_put(struct disk_cache *cache, const cache_key key,
+              const void *data, size_t size)
+{
+   struct mem_cache_entry *entry;
+
+   if (cache->mem_entries == NULL || size > cache->mem_max_size)
+      return;
+
+   entry = malloc(sizeof(*entry) + size);
+   if (entry == NULL)
+      return;
+
+   memcpy(entry->key, key, CACHE_KEY_SIZE);
+   entry->data = entry + 1;
+   memcpy(entry->data, data, size);
+   entry->size = size;
+
+   simple_mtx_lock(&cache->mem_mtx);
+
+   if (_mesa_hash_table_search(cache->mem_entries, key)) {
+      /* Another thread read the same entry in the meantime. */
+      simple_mtx_unlock(&cache->mem_mtx);
+      free(entry);
+      return;
+   }
+
+   while (cache->mem_size + size > cache->mem_max_size) {
+      mem_cache_evict(cache, list_last_entry(&cache->mem_lru,
+                                             struct mem_cache_entry, link));
+   }
+
+   _mesa_hash_table_insert(cache->mem_entries, entry->key, entry);
+   list_add(&entry->link, &cache->mem_lru);
+   cache->mem_size += size;
+
+   simple_mtx_unlock(&cache->mem_mtx);
+}
+
+static void
+mem_cache_remove(struct disk_cache *cache, const cache_key key)
+{
+   struct hash_entry *he;
+
+   if (cache->mem_entries == NULL)
+      return;
+
+   simple_mtx_lock(&cache->mem_mtx);
+
+   he = _mesa_hash_table_search(cache->mem_entries, key);
+   if (he)
+      mem_cache_evict(cache, he->data);
+
+   simple_mtx_unlock(&cache->mem_mtx);
+}
+
 void
 disk_cache_remove(struct disk_cache *cache, const cache_key key)
 {
    struct stat sb;
 
+   mem_cache_remove(cache, key);
+
+   if (cache->db) {
+      disk_cache_db_remove(cache->db, key);
+      return;
+   }
+
    char *filename = get_cache_file(cache, key);
    if (filename == NULL) {
       return;
@@ -703,73 +969,29 @@ write_all(int fd, const void *buf, size_t count)
    return done;
 }
 
-/* From the zlib docs:
- *    "If the memory is available, buffers sizes on the order of 128K or 256K
- *    bytes should be used."
- */
-#define BUFSIZE 256 * 1024
-
 /**
- * Compresses cache entry in memory and writes it to disk. Returns the size
- * of the data written to disk.
+ * Writes the payload of a cache entry to \out_data, which must have room for
+ * compressBound(\in_data_size) bytes, and returns its size.
+ *
+ * The data is stored as is when compression is disabled or wouldn't make it
+ * any smaller.  Readers tell the two cases apart by comparing the size of
+ * the payload with the uncompressed size recorded in the entry.
  */
 static size_t
-deflate_and_write_to_disk(const void *in_data, size_t in_data_size, int dest,
-                          const char *filename)
+compress_cache_data(struct disk_cache *cache, const void *in_data,
+                    size_t in_data_size, uint8_t *out_data)
 {
-   unsigned char out[BUFSIZE];
-
-   /* allocate deflate state */
-   z_stream strm;
-   strm.zalloc = Z_NULL;
-   strm.zfree = Z_NULL;
-   strm.opaque = Z_NULL;
-   strm.next_in = (uint8_t *) in_data;
-   strm.avail_in = in_data_size;
-
-   int ret = deflateInit(&strm, Z_BEST_COMPRESSION);
-   if (ret != Z_OK)
-       return 0;
-
-   /* compress until end of in_data */
-   size_t compressed_size = 0;
-   int flush;
-   do {
-      int remaining = in_data_size - BUFSIZE;
-      flush = remaining > 0 ? Z_NO_FLUSH : Z_FINISH;
-      in_data_size -= BUFSIZE;
-
-      /* Run deflate() on input until the output buffer is not full (which
-       * means there is no more data to deflate).
-       */
-      do {
-         strm.avail_out = BUFSIZE;
-         strm.next_out = out;
-
-         ret = deflate(&strm, flush);    /* no bad return value */
-         assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-
-         size_t have = BUFSIZE - strm.avail_out;
-         compressed_size += have;
-
-         ssize_t written = write_all(dest, out, have);
-         if (written == -1) {
-            (void)deflateEnd(&strm);
-            return 0;
-         }
-      } while (strm.avail_out == 0);
-
-      /* all input should be used */
-      assert(strm.avail_in == 0);
-
-   } while (flush != Z_FINISH);
+   uLongf compressed_size = compressBound(in_data_size);
 
-   /* stream should be complete */
-   assert(ret == Z_STREAM_END);
+   if (cache->compression_level != 0 &&
+       in_data_size >= CACHE_MIN_COMPRESS_SIZE &&
+       compress2(out_data, &compressed_size, in_data, in_data_size,
+                 cache->compression_level) == Z_OK &&
+       compressed_size < in_data_size)
+      return compressed_size;
 
-   /* clean up and return */
-   (void)deflateEnd(&strm);
-   return compressed_size;
+   memcpy(out_data, in_data, in_data_size);
+   return in_data_size;
 }
 
 static struct disk_cache_put_job *
@@ -833,6 +1055,58 @@ struct cache_entry_file_data {
    uint32_t uncompressed_size;
 };
 
+/**
+ * Builds the same entry cache_put() writes to its own file in memory, and
+ * appends it to the packed database.
+ */
+static void
+cache_put_packed(struct disk_cache_put_job *dc_job)
+{
+   struct disk_cache *cache = dc_job->cache;
+   struct cache_entry_file_data cf_data;
+   uint32_t md_type = dc_job->cache_item_metadata.type;
+   size_t header_size, offset = 0;
+
+   header_size = cache->driver_keys_blob_size + sizeof(md_type);
+   if (md_type == CACHE_ITEM_TYPE_GLSL) {
+      header_size += sizeof(uint32_t) +
+         dc_job->cache_item_metadata.num_keys * sizeof(cache_key);
+   }
+   header_size += sizeof(cf_data);
+
+   uint8_t *entry = malloc(header_size + compressBound(dc_job->size));
+   if (!entry)
+      return;
+
+   memcpy(entry + offset, cache->driver_keys_blob,
+          cache->driver_keys_blob_size);
+   offset += cache->driver_keys_blob_size;
+
+   memcpy(entry + offset, &md_type, sizeof(md_type));
+   offset += sizeof(md_type);
+
+   if (md_type == CACHE_ITEM_TYPE_GLSL) {
+      memcpy(entry + offset, &dc_job->cache_item_metadata.num_keys,
+             sizeof(uint32_t));
+      offset += sizeof(uint32_t);
+
+      memcpy(entry + offset, dc_job->cache_item_metadata.keys[0],
+             dc_job->cache_item_metadata.num_keys * sizeof(cache_key));
+      offset += dc_job->cache_item_metadata.num_keys * sizeof(cache_key);
+   }
+
+   cf_data.crc32 = util_hash_crc32(dc_job->data, dc_job->size);
+   cf_data.uncompressed_size = dc_job->size;
+   memcpy(entry + offset, &cf_data, sizeof(cf_data));
+   offset += sizeof(cf_data);
+
+   offset += compress_cache_data(cache, dc_job->data, dc_job->size,
+                                 entry + offset);
+   disk_cache_db_put(cache->db, dc_job->key, entry, offset);
+
+   free(entry);
+}
+
 static void
 cache_put(void *job, int thread_index)
 {
@@ -841,8 +1115,14 @@ cache_put(void *job, int thread_index)
    int fd = -1, fd_final = -1, err, ret;
    unsigned i = 0;
    char *filename = NULL, *filename_tmp = NULL;
+   uint8_t *payload = NULL;
    struct disk_cache_put_job *dc_job = (struct disk_cache_put_job *) job;
 
+   if (dc_job->cache->db) {
+      cache_put_packed(dc_job);
+      return;
+   }
+
    filename = get_cache_file(dc_job->cache, dc_job->key);
    if (filename == NULL)
       goto done;
@@ -958,9 +1238,16 @@ cache_put(void *job, int thread_index)
     * rename them atomically to the destination filename, and also
     * perform an atomic increment of the total cache size.
     */
-   size_t file_size = deflate_and_write_to_disk(dc_job->data, dc_job->size,
-                                                fd, filename_tmp);
-   if (file_size == 0) {
+   payload = malloc(compressBound(dc_job->size));
+   if (payload == NULL) {
+      unlink(filename_tmp);
+      goto done;
+   }
+
+   size_t payload_size = compress_cache_data(dc_job->cache, dc_job->data,
+                                             dc_job->size, payload);
+   ret = write_all(fd, payload, payload_size);
+   if (ret == -1) {
       unlink(filename_tmp);
       goto done;
    }
@@ -987,6 +1274,7 @@ cache_put(void *job, int thread_index)
     */
    if (fd != -1)
       close(fd);
+   free(payload);
    free(filename_tmp);
    free(filename);
 }
@@ -1010,7 +1298,7 @@ disk_cache_put(struct disk_cache *cache, const cache_key key,
  * Decompresses cache entry, returns true if successful.
  */
 static bool
-inflate_cache_data(uint8_t *in_data, size_t in_data_size,
+inflate_cache_data(const uint8_t *in_data, size_t in_data_size,
                    uint8_t *out_data, size_t out_data_size)
 {
    z_stream strm;
@@ -1019,7 +1307,7 @@ inflate_cache_data(uint8_t *in_data, size_t in_data_size,
    strm.zalloc = Z_NULL;
    strm.zfree = Z_NULL;
    strm.opaque = Z_NULL;
-   strm.next_in = in_data;
+   strm.next_in = (uint8_t *) in_data;
    strm.avail_in = in_data_size;
    strm.next_out = out_data;
    strm.avail_out = out_data_size;
@@ -1045,64 +1333,40 @@ inflate_cache_data(uint8_t *in_data, size_t in_data_size,
    return true;
 }
 
-void *
-disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
+/**
+ * Checks the header of a cache entry read from disk and returns the
+ * decompressed payload, or NULL if the entry is invalid or corrupt.
+ */
+static void *
+unpack_cache_entry(struct disk_cache *cache, const uint8_t *entry,
+                   size_t entry_size, size_t *size)
 {
-   int fd = -1, ret;
-   struct stat sb;
-   char *filename = NULL;
-   uint8_t *data = NULL;
-   uint8_t *uncompressed_data = NULL;
-   uint8_t *file_header = NULL;
-
-   if (size)
-      *size = 0;
-
-   filename = get_cache_file(cache, key);
-   if (filename == NULL)
-      goto fail;
-
-   fd = open(filename, O_RDONLY | O_CLOEXEC);
-   if (fd == -1)
-      goto fail;
-
-   if (fstat(fd, &sb) == -1)
-      goto fail;
-
-   data = malloc(sb.st_size);
-   if (data == NULL)
-      goto fail;
-
    size_t ck_size = cache->driver_keys_blob_size;
-   file_header = malloc(ck_size);
-   if (!file_header)
-      goto fail;
+   size_t offset = 0;
+   uint8_t *uncompressed_data;
 
-   if (sb.st_size < ck_size)
-      goto fail;
-
-   ret = read_all(fd, file_header, ck_size);
-   if (ret == -1)
-      goto fail;
+   if (entry_size < ck_size)
+      return NULL;
 
    /* Check for extremely unlikely hash collisions */
-   if (memcmp(cache->driver_keys_blob, file_header, ck_size) != 0) {
+   if (memcmp(cache->driver_keys_blob, entry, ck_size) != 0) {
       assert(!"Mesa cache keys mismatch!");
-      goto fail;
+      return NULL;
    }
+   offset += ck_size;
 
-   size_t cache_item_md_size = sizeof(uint32_t);
    uint32_t md_type;
-   ret = read_all(fd, &md_type, cache_item_md_size);
-   if (ret == -1)
-      goto fail;
+   if (entry_size - offset < sizeof(md_type))
+      return NULL;
+   memcpy(&md_type, entry + offset, sizeof(md_type));
+   offset += sizeof(md_type);
 
    if (md_type == CACHE_ITEM_TYPE_GLSL) {
       uint32_t num_keys;
-      cache_item_md_size += sizeof(uint32_t);
-      ret = read_all(fd, &num_keys, sizeof(uint32_t));
-      if (ret == -1)
-         goto fail;
+      if (entry_size - offset < sizeof(num_keys))
+         return NULL;
+      memcpy(&num_keys, entry + offset, sizeof(num_keys));
+      offset += sizeof(num_keys);
 
       /* The cache item metadata is currently just used for distributing
        * precompiled shaders, they are not used by Mesa so just skip them for
@@ -1110,60 +1374,117 @@ disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
        * TODO: pass the metadata back to the caller and do some basic
        * validation.
        */
-      cache_item_md_size += num_keys * sizeof(cache_key);
-      ret = lseek(fd, num_keys * sizeof(cache_key), SEEK_CUR);
-      if (ret == -1)
-         goto fail;
+      if ((entry_size - offset) / sizeof(cache_key) < num_keys)
+         return NULL;
+      offset += num_keys * sizeof(cache_key);
    }
 
    /* Load the CRC that was created when the file was written. */
    struct cache_entry_file_data cf_data;
-   size_t cf_data_size = sizeof(cf_data);
-   ret = read_all(fd, &cf_data, cf_data_size);
-   if (ret == -1)
-      goto fail;
-
-   /* Load the actual cache data. */
-   size_t cache_data_size =
-      sb.st_size - cf_data_size - ck_size - cache_item_md_size;
-   ret = read_all(fd, data, cache_data_size);
-   if (ret == -1)
-      goto fail;
+   if (entry_size - offset < sizeof(cf_data))
+      return NULL;
+   memcpy(&cf_data, entry + offset, sizeof(cf_data));
+   offset += sizeof(cf_data);
 
-   /* Uncompress the cache data */
+   /* Uncompress the cache data, unless it was stored as is. */
    uncompressed_data = malloc(cf_data.uncompressed_size);
-   if (!inflate_cache_data(data, cache_data_size, uncompressed_data,
-                           cf_data.uncompressed_size))
+   if (!uncompressed_data)
+      return NULL;
+
+   if (entry_size - offset == cf_data.uncompressed_size) {
+      memcpy(uncompressed_data, entry + offset, cf_data.uncompressed_size);
+   } else if (!inflate_cache_data(entry + offset, entry_size - offset,
+                                  uncompressed_data,
+                                  cf_data.uncompressed_size)) {
       goto fail;
+   }
 
    /* Check the data for corruption */
    if (cf_data.crc32 != util_hash_crc32(uncompressed_data,
                                         cf_data.uncompressed_size))
       goto fail;
 
-   free(data);
-   free(filename);
-   free(file_header);
-   close(fd);
-
    if (size)
       *size = cf_data.uncompressed_size;
 
    return uncompressed_data;
 
  fail:
-   if (data)
-      free(data);
-   if (uncompressed_data)
-      free(uncompressed_data);
-   if (filename)
-      free(filename);
-   if (file_header)
-      free(file_header);
+   free(uncompressed_data);
+   return NULL;
+}
+
+void *
+disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
+{
+   int fd = -1, ret;
+   struct stat sb;
+   char *filename = NULL;
+   uint8_t *data = NULL;
+   size_t data_size, result_size = 0;
+   void *result = NULL;
+
+   if (size)
+      *size = 0;
+
+   result = mem_cache_get(cache, key, size);
+   if (result)
+      return result;
+
+   /* The images are mapped, so entries found there are decompressed
+    * straight out of the page cache.
+    */
+   for (unsigned i = 0; i < cache->num_images; i++) {
+      const void *entry = disk_cache_image_get(cache->images[i], key,
+                                               &data_size);
+      if (entry) {
+         result = unpack_cache_entry(cache, entry, data_size, &result_size);
+         if (result)
+            goto done;
+      }
+   }
+
+   if (cache->db) {
+      data = disk_cache_db_get(cache->db, key, &data_size);
+      if (data == NULL)
+         goto done;
+   } else {
+      filename = get_cache_file(cache, key);
+      if (filename == NULL)
+         goto done;
+
+      fd = open(filename, O_RDONLY | O_CLOEXEC);
+      if (fd == -1)
+         goto done;
+
+      if (fstat(fd, &sb) == -1)
+         goto done;
+
+      data_size = sb.st_size;
+      data = malloc(data_size);
+      if (data == NULL)
+         goto done;
+
+      ret = read_all(fd, data, data_size);
+      if (ret == -1)
+         goto done;
+   }
+
+   result = unpack_cache_entry(cache, data, data_size, &result_size);
+
+ done:
+   free(data);
+   free(filename);
    if (fd != -1)
       close(fd);
 
-   return NULL;
+   if (result) {
+      mem_cache_put(cache, key, result, result_size);
+      if (size)
+         *size = result_size;
+   }
+
+   return result;
 }
 
 void
@@ -1192,6 +1513,11 @@ disk_cache_has_key(struct disk_cache *cache, const cache_key key)
    int i = CPU_TO_LE32(*key_chunk) & CACHE_INDEX_KEY_MASK;
    unsigned char *entry;
 
+   for (unsigned j = 0; j < cache->num_images; j++) {
+      if (disk_cache_image_has_key(cache->images[j], key))
+         return true;
+   }
+
    entry = &cache->stored_keys[i * CACHE_KEY_SIZE];
 
    return memcmp(entry, key, CACHE_KEY_SIZE) == 0;
@@ -1210,4 +1536,141 @@ disk_cache_compute_key(struct disk_cache *cache, const void *data, size_t size,
    _mesa_sha1_final(&ctx, key);
 }
 
+static bool
+parse_hex_key(const char *hex, cache_key key)
+{
+   for (unsigned i = 0; i < CACHE_KEY_SIZE * 2; i++) {
+      int c = tolower(hex[i]), v;
+
+      if (c >= '0' && c <= '9')
+         v = c - '0';
+      else if (c >= 'a' && c <= 'f')
+         v = c - 'a' + 10;
+      else
+         return false;
+
+      if (i % 2 == 0)
+         key[i / 2] = v << 4;
+      else
+         key[i / 2] |= v;
+   }
+
+   return hex[CACHE_KEY_SIZE * 2] == '\0';
+}
+
+/* Add the files of one of the two-character subdirectories. */
+static void
+export_cache_directory(struct disk_cache_image_writer *writer,
+                       const char *path, unsigned index)
+{
+   char *dir_path, hex[CACHE_KEY_SIZE * 2 + 1];
+   struct dirent *entry;
+   DIR *dir;
+
+   if (asprintf(&dir_path, "%s/%02x", path, index) == -1)
+      return;
+
+   dir = opendir(dir_path);
+   free(dir_path);
+   if (dir == NULL)
+      return;
+
+   while ((entry = readdir(dir)) != NULL) {
+      cache_key key;
+      struct stat sb;
+
+      /* Skips ".", "..", and the ".tmp" files of unfinished writes. */
+      if (strlen(entry->d_name) != CACHE_KEY_SIZE * 2 - 2)
+         continue;
+
+      snprintf(hex, sizeof(hex), "%02x", index);
+      memcpy(hex + 2, entry->d_name, CACHE_KEY_SIZE * 2 - 1);
+      if (!parse_hex_key(hex, key))
+         continue;
+
+      int fd = openat(dirfd(dir), entry->d_name, O_RDONLY | O_CLOEXEC);
+      if (fd == -1)
+         continue;
+
+      if (fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0) {
+         uint8_t *data = malloc(sb.st_size);
+
+         if (data && read_all(fd, data, sb.st_size) != -1)
+            disk_cache_image_writer_add(writer, key, data, sb.st_size);
+         free(data);
+      }
+
+      close(fd);
+   }
+
+   closedir(dir);
+}
+
+static void
+export_db_entry(void *user_data, const cache_key key,
+                const void *data, size_t size)
+{
+   disk_cache_image_writer_add(user_data, key, data, size);
+}
+
+bool
+disk_cache_export_image(const char *path, const char *filename)
+{
+   void *local = ralloc_context(NULL);
+   struct disk_cache_image_writer *writer;
+   struct stat sb;
+   char *name;
+   int fd;
+
+   if (local == NULL)
+      return false;
+
+   writer = disk_cache_image_writer_create(local);
+   if (writer == NULL) {
+      ralloc_free(local);
+      return false;
+   }
+
+   /* Entries stored one file per entry. */
+   for (unsigned i = 0; i < 256; i++)
+      export_cache_directory(writer, path, i);
+
+   /* Entries in a packed database.  Opening one creates it, so check that
+    * it is there first.
+    */
+   name = ralloc_asprintf(local, "%s/%s", path, DISK_CACHE_DB_INDEX_NAME);
+   if (name && stat(name, &sb) == 0) {
+      struct disk_cache_db *db = disk_cache_db_open(local, path, UINT64_MAX);
+      if (db) {
+         disk_cache_db_foreach(db, export_db_entry, writer);
+         disk_cache_db_close(db);
+      }
+   }
+
+   /* Keys recorded with disk_cache_put_key(). */
+   name = ralloc_asprintf(local, "%s/index", path);
+   fd = name ? open(name, O_RDONLY | O_CLOEXEC) : -1;
+   if (fd != -1) {
+      size_t size = CACHE_INDEX_MAX_KEYS * CACHE_KEY_SIZE;
+      uint8_t *keys = ralloc_size(local, size);
+      static const cache_key zero_key;
+
+      if (keys && lseek(fd, sizeof(uint64_t), SEEK_SET) != -1 &&
+          read_all(fd, keys, size) != -1) {
+         for (unsigned i = 0; i < CACHE_INDEX_MAX_KEYS; i++) {
+            uint8_t *key = keys + i * CACHE_KEY_SIZE;
+            if (memcmp(key, zero_key, CACHE_KEY_SIZE) != 0)
+               disk_cache_image_writer_add_key(writer, key);
+         }
+      }
+
+      close(fd);
+   }
+
+   bool ret = disk_cache_image_writer_finish(writer, filename);
+
+   ralloc_free(local);
+   return ret;
+}
+
 #endif /* ENABLE_SHADER_CACHE */
@@ -139,6 +139,12 @@ disk_cache_create(const char *gpu_name, const char *timestamp,
 void
 disk_cache_destroy(struct disk_cache *cache);
 
+/**
+ * Wait until all items passed to disk_cache_put() so far have been written.
+ */
+void
+disk_cache_wait_for_idle(struct disk_cache *cache);
+
 /**
  * Remove the item in the cache under the name \key.
  */
@@ -207,6 +213,17 @@ void
 disk_cache_compute_key(struct disk_cache *cache, const void *data, size_t size,
                        cache_key key);
 
+/**
+ * Pack everything stored in the cache directory \path, (the
+ * mesa_shader_cache directory of a warmed cache), into a read-only image at
+ * \filename.  Listing the image in MESA_GLSL_CACHE_IMAGES then makes its
+ * entries available to every cache object, ahead of the writable cache.
+ *
+ * Return value: True on success.
+ */
+bool
+disk_cache_export_image(const char *path, const char *filename);
+
 #else
 
 static inline struct disk_cache *
@@ -221,6 +238,11 @@ disk_cache_destroy(struct disk_cache *cache) {
    return;
 }
 
+static inline void
+disk_cache_wait_for_idle(struct disk_cache *cache) {
+   return;
+}
+
 static inline void
 disk_cache_put(struct disk_cache *cache, const cache_key key,
                const void *data, size_t size,
@@ -260,6 +282,12 @@ disk_cache_compute_key(struct disk_cache *cache, const void *data, size_t size,
    return;
 }
 
+static inline bool
+disk_cache_export_image(const char *path, const char *filename)
+{
+   return false;
+}
+
 #endif /* ENABLE_SHADER_CACHE */
 
 #ifdef __cplusplus
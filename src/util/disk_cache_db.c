@@ -0,0 +1,753 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifdef ENABLE_SHADER_CACHE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "util/crc32.h"
+#include "util/hash_table.h"
+#include "util/macros.h"
+#include "util/rand_xor.h"
+#include "util/ralloc.h"
+#include "util/simple_mtx.h"
+
+#include "disk_cache_db.h"
+
+/* Bump whenever the layout of the headers or records below changes. */
+#define DB_FILE_VERSION 1
+
+/* Both files start with this header.  The uuid is regenerated whenever the
+ * files are reset or compacted.  The two files only belong together if their
+ * uuids match.
+ */
+struct db_file_header {
+   char magic[8];
+   uint32_t version;
+   uint32_t pad;
+   uint64_t uuid;
+};
+
+/* Each entry in the data file is this header followed by the payload. */
+struct db_entry_header {
+   uint8_t key[CACHE_KEY_SIZE];
+   uint32_t crc32;
+   uint32_t size;
+};
+
+/* The index file is a log of these records.  A record with a size of zero
+ * removes the key.
+ */
+struct db_index_record {
+   uint8_t key[CACHE_KEY_SIZE];
+   uint32_t size;
+   uint64_t offset;
+   uint64_t last_access;
+};
+
+/* In-memory copy of the live record for a key. */
+struct db_index_entry {
+   uint8_t key[CACHE_KEY_SIZE];
+   uint32_t size;
+   uint64_t offset;
+   uint64_t last_access;
+
+   /* Position of the record in the index file, for access time updates. */
+   uint64_t record_offset;
+};
+
+struct disk_cache_db {
+   int data_fd;
+   int index_fd;
+
+   /* uuid of the files the in-memory index was read from. */
+   uint64_t uuid;
+
+   /* How much of the index file has been read into the hash table. */
+   uint64_t index_read_offset;
+
+   /* Maximum size of the data file (in bytes). */
+   uint64_t max_size;
+
+   /* Maps keys to struct db_index_entry. */
+   struct hash_table *index;
+
+   uint64_t seed_xorshift128plus[2];
+
+   /* flock() doesn't serialize threads sharing the same file descriptor,
+    * and the cache is used both from the application threads and from the
+    * disk_cache writer thread.
+    */
+   simple_mtx_t mtx;
+};
+
+static const char db_data_magic[8] = { 'M', 'E', 'S', 'A', '_', 'C', 'D', 'B' };
+static const char db_index_magic[8] = { 'M', 'E', 'S', 'A', '_', 'C', 'I', 'X' };
+
+static ssize_t
+pread_all(int fd, void *buf, size_t count, uint64_t offset)
+{
+   char *in = buf;
+   ssize_t read_ret;
+   size_t done;
+
+   for (done = 0; done < count; done += read_ret) {
+      read_ret = pread(fd, in + done, count - done, offset + done);
+      if (read_ret == -1 || read_ret == 0)
+         return -1;
+   }
+   return done;
+}
+
+static ssize_t
+pwrite_all(int fd, const void *buf, size_t count, uint64_t offset)
+{
+   const char *out = buf;
+   ssize_t written;
+   size_t done;
+
+   for (done = 0; done < count; done += written) {
+      written = pwrite(fd, out + done, count - done, offset + done);
+      if (written == -1)
+         return -1;
+   }
+   return done;
+}
+
+/* Keys are SHA-1 signatures, so any four bytes of them are a good hash. */
+static uint32_t
+key_hash(const void *key)
+{
+   uint32_t hash;
+   memcpy(&hash, key, sizeof(hash));
+   return hash;
+}
+
+static bool
+key_equals(const void *a, const void *b)
+{
+   return memcmp(a, b, CACHE_KEY_SIZE) == 0;
+}
+
+static bool
+read_header(int fd, const char magic[8], uint64_t *uuid)
+{
+   struct db_file_header header;
+
+   if (pread_all(fd, &header, sizeof(header), 0) == -1)
+      return false;
+
+   if (memcmp(header.magic, magic, sizeof(header.magic)) != 0 ||
+       header.version != DB_FILE_VERSION)
+      return false;
+
+   *uuid = header.uuid;
+   return true;
+}
+
+static bool
+write_header(int fd, const char magic[8], uint64_t uuid)
+{
+   struct db_file_header header;
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, magic, sizeof(header.magic));
+   header.version = DB_FILE_VERSION;
+   header.uuid = uuid;
+
+   return pwrite_all(fd, &header, sizeof(header), 0) != -1;
+}
+
+static bool
+reset_index(struct disk_cache_db *db)
+{
+   ralloc_free(db->index);
+   db->index = _mesa_hash_table_create(db, key_hash, key_equals);
+   db->index_read_offset = sizeof(struct db_file_header);
+
+   return db->index != NULL;
+}
+
+static void
+apply_record(struct disk_cache_db *db, const struct db_index_record *record,
+             uint64_t record_offset)
+{
+   struct hash_entry *he = _mesa_hash_table_search(db->index, record->key);
+   struct db_index_entry *entry = he ? he->data : NULL;
+
+   if (record->size == 0) {
+      if (he) {
+         _mesa_hash_table_remove(db->index, he);
+         ralloc_free(entry);
+      }
+      return;
+   }
+
+   if (!entry) {
+      entry = ralloc(db->index, struct db_index_entry);
+      if (!entry)
+         return;
+
+      memcpy(entry->key, record->key, CACHE_KEY_SIZE);
+      _mesa_hash_table_insert(db->index, entry->key, entry);
+   }
+
+   entry->size = record->size;
+   entry->offset = record->offset;
+   entry->last_access = record->last_access;
+   entry->record_offset = record_offset;
+}
+
+/* Start both files over, empty.  Must be called with the exclusive lock
+ * held.
+ */
+static bool
+reset_files(struct disk_cache_db *db)
+{
+   uint64_t uuid = rand_xorshift128plus(db->seed_xorshift128plus);
+
+   if (ftruncate(db->data_fd, 0) == -1 ||
+       ftruncate(db->index_fd, 0) == -1)
+      return false;
+
+   /* The index header goes last, so that a reset that dies halfway leaves
+    * files that don't match and get reset again.
+    */
+   if (!write_header(db->data_fd, db_data_magic, uuid) ||
+       !write_header(db->index_fd, db_index_magic, uuid))
+      return false;
+
+   db->uuid = uuid;
+   return reset_index(db);
+}
+
+/* Bring the in-memory index up to date with the index file, which other
+ * processes may have appended to or compacted.  Must be called with the
+ * lock held.
+ */
+static bool
+sync_index(struct disk_cache_db *db)
+{
+   const uint64_t header_size = sizeof(struct db_file_header);
+   const uint64_t record_size = sizeof(struct db_index_record);
+   struct stat sb;
+   uint64_t uuid;
+
+   if (!read_header(db->index_fd, db_index_magic, &uuid))
+      return false;
+
+   if (uuid != db->uuid) {
+      if (!reset_index(db))
+         return false;
+      db->uuid = uuid;
+   }
+
+   if (fstat(db->index_fd, &sb) == -1 || (uint64_t) sb.st_size < header_size)
+      return false;
+
+   /* A writer that died halfway through a record leaves a partial one at
+    * the end of the file.  Ignore it; the next append overwrites it.
+    */
+   uint64_t end = header_size +
+      (sb.st_size - header_size) / record_size * record_size;
+   if (end <= db->index_read_offset)
+      return true;
+
+   size_t size = end - db->index_read_offset;
+   struct db_index_record *records = malloc(size);
+   if (!records)
+      return false;
+
+   if (pread_all(db->index_fd, records, size, db->index_read_offset) == -1) {
+      free(records);
+      return false;
+   }
+
+   for (unsigned i = 0; i < size / record_size; i++)
+      apply_record(db, &records[i], db->index_read_offset + i * record_size);
+
+   db->index_read_offset = end;
+   free(records);
+
+   return true;
+}
+
+static void
+db_unlock(struct disk_cache_db *db)
+{
+   flock(db->index_fd, LOCK_UN);
+   simple_mtx_unlock(&db->mtx);
+}
+
+static bool
+db_lock(struct disk_cache_db *db, int operation)
+{
+   simple_mtx_lock(&db->mtx);
+
+   if (flock(db->index_fd, operation) == -1) {
+      simple_mtx_unlock(&db->mtx);
+      return false;
+   }
+
+   if (sync_index(db))
+      return true;
+
+   /* The files are damaged.  Readers just miss; writers start over. */
+   if (operation == LOCK_EX && reset_files(db))
+      return true;
+
+   db_unlock(db);
+   return false;
+}
+
+static bool
+append_record(struct disk_cache_db *db, const struct db_index_record *record)
+{
+   uint64_t offset = db->index_read_offset;
+
+   /* A partially written record is ignored by sync_index() and overwritten
+    * by the next append.
+    */
+   if (pwrite_all(db->index_fd, record, sizeof(*record), offset) == -1)
+      return false;
+
+   apply_record(db, record, offset);
+   db->index_read_offset = offset + sizeof(*record);
+
+   return true;
+}
+
+static int
+compare_last_access(const void *a, const void *b)
+{
+   const struct db_index_entry *ea = *(const struct db_index_entry **) a;
+   const struct db_index_entry *eb = *(const struct db_index_entry **) b;
+
+   /* Most recently used first.  Access times only have a resolution of a
+    * second, so among equals prefer the most recently written.
+    */
+   if (ea->last_access != eb->last_access)
+      return ea->last_access > eb->last_access ? -1 : 1;
+   if (ea->offset != eb->offset)
+      return ea->offset > eb->offset ? -1 : 1;
+   return 0;
+}
+
+static int
+compare_offset(const void *a, const void *b)
+{
+   const struct db_index_entry *ea = *(const struct db_index_entry **) a;
+   const struct db_index_entry *eb = *(const struct db_index_entry **) b;
+
+   if (ea->offset != eb->offset)
+      return ea->offset < eb->offset ? -1 : 1;
+   return 0;
+}
+
+/* Drop the least recently used entries until the data file fits in
+ * \budget bytes, squeezing out the space of dropped, removed and partially
+ * written entries.  Returns the new size of the data file, or 0 on failure.
+ * Must be called with the exclusive lock held.
+ */
+static uint64_t
+compact(struct disk_cache_db *db, uint64_t budget)
+{
+   const uint64_t header_size = sizeof(struct db_file_header);
+   unsigned num_entries = _mesa_hash_table_num_entries(db->index);
+   struct db_index_entry **entries = NULL;
+   struct db_index_record *records = NULL;
+   uint8_t *index_file = NULL, *buf = NULL;
+   size_t buf_size = 0;
+   uint64_t end = header_size;
+   unsigned kept = 0, i = 0;
+   bool ok = false;
+
+   entries = malloc(MAX2(num_entries, 1) * sizeof(*entries));
+   records = malloc(MAX2(num_entries, 1) * sizeof(*records));
+   index_file = malloc(db->index_read_offset);
+   if (!entries || !records || !index_file)
+      goto done;
+
+   /* Every process updates access times in the file, so ours may be
+    * stale.
+    */
+   if (pread_all(db->index_fd, index_file, db->index_read_offset, 0) == -1)
+      goto done;
+
+   struct hash_entry *he;
+   hash_table_foreach(db->index, he) {
+      struct db_index_entry *entry = he->data;
+
+      memcpy(&entry->last_access,
+             index_file + entry->record_offset +
+             offsetof(struct db_index_record, last_access),
+             sizeof(entry->last_access));
+      entries[i++] = entry;
+   }
+
+   qsort(entries, num_entries, sizeof(*entries), compare_last_access);
+
+   uint64_t total = header_size;
+   for (kept = 0; kept < num_entries; kept++) {
+      uint64_t size = sizeof(struct db_entry_header) + entries[kept]->size;
+      if (total + size > budget)
+         break;
+      total += size;
+   }
+
+   /* Slide the survivors down in file order.  An entry only ever moves
+    * towards the start of the file, so nothing is overwritten before it has
+    * been copied.
+    */
+   qsort(entries, kept, sizeof(*entries), compare_offset);
+
+   for (i = 0; i < kept; i++) {
+      struct db_index_entry *entry = entries[i];
+      size_t size = sizeof(struct db_entry_header) + entry->size;
+
+      if (entry->offset != end) {
+         if (size > buf_size) {
+            uint8_t *tmp = realloc(buf, size);
+            if (!tmp)
+               goto done;
+            buf = tmp;
+            buf_size = size;
+         }
+
+         if (pread_all(db->data_fd, buf, size, entry->offset) == -1 ||
+             pwrite_all(db->data_fd, buf, size, end) == -1)
+            goto done;
+      }
+
+      memcpy(records[i].key, entry->key, CACHE_KEY_SIZE);
+      records[i].size = entry->size;
+      records[i].offset = end;
+      records[i].last_access = entry->last_access;
+
+      end += size;
+   }
+
+   if (ftruncate(db->data_fd, end) == -1)
+      goto done;
+
+   uint64_t uuid = rand_xorshift128plus(db->seed_xorshift128plus);
+   uint64_t index_size = header_size + kept * sizeof(*records);
+
+   if (pwrite_all(db->index_fd, records, kept * sizeof(*records),
+                  header_size) == -1 ||
+       ftruncate(db->index_fd, index_size) == -1 ||
+       !write_header(db->data_fd, db_data_magic, uuid) ||
+       !write_header(db->index_fd, db_index_magic, uuid))
+      goto done;
+
+   /* The entries array points into the old index, so rebuild from the
+    * records.
+    */
+   if (!reset_index(db))
+      goto done;
+
+   db->uuid = uuid;
+   for (i = 0; i < kept; i++)
+      apply_record(db, &records[i], header_size + i * sizeof(*records));
+   db->index_read_offset = index_size;
+
+   ok = true;
+
+ done:
+   free(buf);
+   free(index_file);
+   free(records);
+   free(entries);
+
+   if (ok)
+      return end;
+
+   /* A compaction that failed halfway may have overwritten live entries,
+    * so throw everything away.
+    */
+   return reset_files(db) ? header_size : 0;
+}
+
+struct disk_cache_db *
+disk_cache_db_open(void *mem_ctx, const char *path, uint64_t max_size)
+{
+   struct disk_cache_db *db;
+   char *filename;
+   uint64_t data_uuid, index_uuid;
+   bool ok;
+
+   db = rzalloc(mem_ctx, struct disk_cache_db);
+   if (db == NULL)
+      return NULL;
+
+   db->data_fd = -1;
+   db->index_fd = -1;
+   db->max_size = max_size;
+   simple_mtx_init(&db->mtx, mtx_plain);
+   s_rand_xorshift128plus(db->seed_xorshift128plus, true);
+
+   filename = ralloc_asprintf(db, "%s/%s", path, DISK_CACHE_DB_DATA_NAME);
+   if (filename == NULL)
+      goto fail;
+
+   db->data_fd = open(filename, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+   if (db->data_fd == -1)
+      goto fail;
+
+   filename = ralloc_asprintf(db, "%s/%s", path, DISK_CACHE_DB_INDEX_NAME);
+   if (filename == NULL)
+      goto fail;
+
+   db->index_fd = open(filename, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+   if (db->index_fd == -1)
+      goto fail;
+
+   if (!reset_index(db))
+      goto fail;
+
+   /* Read the index, or start over if the files are new, damaged, from a
+    * different version, or don't belong together.
+    */
+   if (flock(db->index_fd, LOCK_EX) == -1)
+      goto fail;
+
+   ok = read_header(db->data_fd, db_data_magic, &data_uuid) &&
+        read_header(db->index_fd, db_index_magic, &index_uuid) &&
+        data_uuid == index_uuid &&
+        sync_index(db);
+   if (!ok)
+      ok = reset_files(db);
+
+   flock(db->index_fd, LOCK_UN);
+
+   if (!ok)
+      goto fail;
+
+   return db;
+
+ fail:
+   disk_cache_db_close(db);
+   return NULL;
+}
+
+void
+disk_cache_db_close(struct disk_cache_db *db)
+{
+   if (db->data_fd != -1)
+      close(db->data_fd);
+   if (db->index_fd != -1)
+      close(db->index_fd);
+
+   simple_mtx_destroy(&db->mtx);
+   ralloc_free(db);
+}
+
+bool
+disk_cache_db_put(struct disk_cache_db *db, const cache_key key,
+                  const void *data, size_t size)
+{
+   const uint64_t header_size = sizeof(struct db_file_header);
+   uint64_t entry_size = sizeof(struct db_entry_header) + size;
+   struct db_entry_header entry_header;
+   struct db_index_record record;
+   struct stat sb;
+   bool ret = false;
+
+   if (size == 0 || size > UINT32_MAX ||
+       header_size + entry_size > db->max_size)
+      return false;
+
+   if (!db_lock(db, LOCK_EX))
+      return false;
+
+   /* Another process may have written it since we last looked. */
+   if (_mesa_hash_table_search(db->index, key)) {
+      ret = true;
+      goto done;
+   }
+
+   if (fstat(db->data_fd, &sb) == -1)
+      goto done;
+
+   uint64_t offset = sb.st_size;
+   if (offset + entry_size > db->max_size) {
+      /* Compact to somewhat below the limit so that we don't have to do it
+       * again on the very next put.
+       */
+      offset = compact(db, MIN2(db->max_size - entry_size,
+                                db->max_size / 4 * 3));
+      if (offset == 0)
+         goto done;
+   }
+
+   memcpy(entry_header.key, key, CACHE_KEY_SIZE);
+   entry_header.crc32 = util_hash_crc32(data, size);
+   entry_header.size = size;
+
+   /* The data goes in before the record that points at it, so that readers
+    * never see a record for a partially written entry.  A failed write just
+    * leaves unreferenced bytes for the next compaction to drop.
+    */
+   if (pwrite_all(db->data_fd, &entry_header, sizeof(entry_header),
+                  offset) == -1 ||
+       pwrite_all(db->data_fd, data, size,
+                  offset + sizeof(entry_header)) == -1)
+      goto done;
+
+   memcpy(record.key, key, CACHE_KEY_SIZE);
+   record.size = size;
+   record.offset = offset;
+   record.last_access = time(NULL);
+
+   ret = append_record(db, &record);
+
+ done:
+   db_unlock(db);
+   return ret;
+}
+
+void *
+disk_cache_db_get(struct disk_cache_db *db, const cache_key key,
+                  size_t *size)
+{
+   struct db_entry_header entry_header;
+   struct db_index_entry *entry;
+   struct hash_entry *he;
+   uint8_t *data = NULL;
+
+   if (!db_lock(db, LOCK_SH))
+      return NULL;
+
+   he = _mesa_hash_table_search(db->index, key);
+   if (he == NULL)
+      goto done;
+
+   entry = he->data;
+
+   if (pread_all(db->data_fd, &entry_header, sizeof(entry_header),
+                 entry->offset) == -1)
+      goto done;
+
+   if (memcmp(entry_header.key, key, CACHE_KEY_SIZE) != 0 ||
+       entry_header.size != entry->size)
+      goto done;
+
+   data = malloc(entry_header.size);
+   if (data == NULL)
+      goto done;
+
+   if (pread_all(db->data_fd, data, entry_header.size,
+                 entry->offset + sizeof(entry_header)) == -1 ||
+       util_hash_crc32(data, entry_header.size) != entry_header.crc32) {
+      free(data);
+      data = NULL;
+      goto done;
+   }
+
+   /* Record the access for compaction.  Other readers holding the shared
+    * lock may store the same field at the same time, which is harmless.
+    */
+   uint64_t now = time(NULL);
+   if (entry->last_access != now) {
+      entry->last_access = now;
+      pwrite_all(db->index_fd, &now, sizeof(now), entry->record_offset +
+                 offsetof(struct db_index_record, last_access));
+   }
+
+   if (size)
+      *size = entry_header.size;
+
+ done:
+   db_unlock(db);
+   return data;
+}
+
+void
+disk_cache_db_remove(struct disk_cache_db *db, const cache_key key)
+{
+   struct db_index_record record;
+
+   if (!db_lock(db, LOCK_EX))
+      return;
+
+   /* The entry's space is reclaimed at the next compaction. */
+   if (_mesa_hash_table_search(db->index, key)) {
+      memset(&record, 0, sizeof(record));
+      memcpy(record.key, key, CACHE_KEY_SIZE);
+      append_record(db, &record);
+   }
+
+   db_unlock(db);
+}
+
+void
+disk_cache_db_foreach(struct disk_cache_db *db,
+                      void (*callback)(void *user_data, const cache_key key,
+                                       const void *data, size_t size),
+                      void *user_data)
+{
+   struct db_entry_header entry_header;
+   struct hash_entry *he;
+   uint8_t *data = NULL;
+   size_t data_size = 0;
+
+   if (!db_lock(db, LOCK_SH))
+      return;
+
+   hash_table_foreach(db->index, he) {
+      struct db_index_entry *entry = he->data;
+
+      if (entry->size > data_size) {
+         uint8_t *tmp = realloc(data, entry->size);
+         if (tmp == NULL)
+            break;
+         data = tmp;
+         data_size = entry->size;
+      }
+
+      if (pread_all(db->data_fd, &entry_header, sizeof(entry_header),
+                    entry->offset) == -1 ||
+          memcmp(entry_header.key, entry->key, CACHE_KEY_SIZE) != 0 ||
+          entry_header.size != entry->size ||
+          pread_all(db->data_fd, data, entry->size,
+                    entry->offset + sizeof(entry_header)) == -1 ||
+          util_hash_crc32(data, entry->size) != entry_header.crc32)
+         continue;
+
+      callback(user_data, entry->key, data, entry->size);
+   }
+
+   db_unlock(db);
+   free(data);
+}
+
+#endif /* ENABLE_SHADER_CACHE */
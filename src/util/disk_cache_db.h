@@ -0,0 +1,103 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Packed storage backend for disk_cache.c.
+ *
+ * Instead of one file per cache entry, all entries are appended to a single
+ * data file, and an append-only index file maps each key to the offset of
+ * its entry.  The index is small enough to be read in one go when the cache
+ * is opened, so a lookup costs one pread() of the data file rather than an
+ * open()/fstat()/read()/close() of a file in one of 256 directories.
+ *
+ * Writers from any number of processes serialize on an flock() of the index
+ * file.  When the data file would grow beyond the maximum cache size, the
+ * writer compacts both files in place, keeping the most recently used
+ * entries, and stamps them with a new identifier so that other processes
+ * know to reload their copy of the index.
+ */
+
+#ifndef DISK_CACHE_DB_H
+#define DISK_CACHE_DB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "disk_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISK_CACHE_DB_DATA_NAME  "mesa_cache.db"
+#define DISK_CACHE_DB_INDEX_NAME "mesa_cache.idx"
+
+struct disk_cache_db;
+
+/**
+ * Open (creating them if needed) the packed cache files within the
+ * directory \path.  The returned object is ralloc'ed off of \mem_ctx.
+ *
+ * Returns NULL if the files cannot be opened or initialized.
+ */
+struct disk_cache_db *
+disk_cache_db_open(void *mem_ctx, const char *path, uint64_t max_size);
+
+void
+disk_cache_db_close(struct disk_cache_db *db);
+
+/**
+ * Append \size bytes of \data under \key, unless an entry for \key is
+ * already present.  May compact the files first to stay within the maximum
+ * cache size.
+ */
+bool
+disk_cache_db_put(struct disk_cache_db *db, const cache_key key,
+                  const void *data, size_t size);
+
+/**
+ * Return a malloc'ed copy of the data stored under \key, or NULL if there is
+ * no such entry or it fails its checksum.
+ */
+void *
+disk_cache_db_get(struct disk_cache_db *db, const cache_key key,
+                  size_t *size);
+
+void
+disk_cache_db_remove(struct disk_cache_db *db, const cache_key key);
+
+/**
+ * Call \callback for every entry in the database, with a pointer to a
+ * temporary copy of its data.
+ */
+void
+disk_cache_db_foreach(struct disk_cache_db *db,
+                      void (*callback)(void *user_data, const cache_key key,
+                                       const void *data, size_t size),
+                      void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISK_CACHE_DB_H */
@@ -0,0 +1,330 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifdef ENABLE_SHADER_CACHE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "util/ralloc.h"
+#include "util/u_dynarray.h"
+
+#include "disk_cache_image.h"
+
+/* Bump whenever the layout of the header or tables below changes. */
+#define IMAGE_FILE_VERSION 1
+
+struct image_header {
+   char magic[8];
+   uint32_t version;
+   uint32_t num_entries;
+   uint32_t num_keys;
+   uint32_t pad;
+   uint64_t entries_offset;
+   uint64_t keys_offset;
+};
+
+/* The entry table, sorted by key.  Entries are 8-byte aligned. */
+struct image_entry {
+   uint8_t key[CACHE_KEY_SIZE];
+   uint32_t size;
+   uint64_t offset;
+};
+
+struct disk_cache_image {
+   const uint8_t *map;
+   size_t map_size;
+
+   const struct image_entry *entries;
+   uint32_t num_entries;
+
+   const cache_key *keys;
+   uint32_t num_keys;
+};
+
+struct writer_entry {
+   cache_key key;
+   const void *data;
+   size_t size;
+};
+
+struct disk_cache_image_writer {
+   struct util_dynarray entries;
+   struct util_dynarray keys;
+};
+
+static const char image_magic[8] = { 'M', 'E', 'S', 'A', '_', 'C', 'I', 'M' };
+
+/* Both tables start with the key, so one comparison serves bsearch() and
+ * qsort() on either.
+ */
+static int
+compare_keys(const void *a, const void *b)
+{
+   return memcmp(a, b, CACHE_KEY_SIZE);
+}
+
+static bool
+table_fits(uint64_t offset, uint64_t count, uint64_t elem_size,
+           uint64_t file_size)
+{
+   return offset <= file_size && count <= (file_size - offset) / elem_size;
+}
+
+struct disk_cache_image *
+disk_cache_image_open(void *mem_ctx, const char *filename)
+{
+   struct disk_cache_image *image;
+   const struct image_header *header;
+   struct stat sb;
+   void *map;
+   int fd;
+
+   fd = open(filename, O_RDONLY | O_CLOEXEC);
+   if (fd == -1)
+      return NULL;
+
+   if (fstat(fd, &sb) == -1 || sb.st_size < sizeof(*header)) {
+      close(fd);
+      return NULL;
+   }
+
+   map = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED)
+      return NULL;
+
+   header = map;
+   if (memcmp(header->magic, image_magic, sizeof(header->magic)) != 0 ||
+       header->version != IMAGE_FILE_VERSION ||
+       header->entries_offset % 8 != 0 ||
+       !table_fits(header->entries_offset, header->num_entries,
+                   sizeof(struct image_entry), sb.st_size) ||
+       !table_fits(header->keys_offset, header->num_keys,
+                   sizeof(cache_key), sb.st_size))
+      goto fail;
+
+   image = ralloc(mem_ctx, struct disk_cache_image);
+   if (image == NULL)
+      goto fail;
+
+   image->map = map;
+   image->map_size = sb.st_size;
+   image->entries =
+      (const struct image_entry *) (image->map + header->entries_offset);
+   image->num_entries = header->num_entries;
+   image->keys = (const cache_key *) (image->map + header->keys_offset);
+   image->num_keys = header->num_keys;
+
+   return image;
+
+ fail:
+   munmap(map, sb.st_size);
+   return NULL;
+}
+
+void
+disk_cache_image_close(struct disk_cache_image *image)
+{
+   munmap((void *) image->map, image->map_size);
+   ralloc_free(image);
+}
+
+const void *
+disk_cache_image_get(const struct disk_cache_image *image,
+                     const cache_key key, size_t *size)
+{
+   const struct image_entry *entry =
+      bsearch(key, image->entries, image->num_entries, sizeof(*entry),
+              compare_keys);
+
+   if (entry == NULL ||
+       !table_fits(entry->offset, entry->size, 1, image->map_size))
+      return NULL;
+
+   *size = entry->size;
+   return image->map + entry->offset;
+}
+
+bool
+disk_cache_image_has_key(const struct disk_cache_image *image,
+                         const cache_key key)
+{
+   return bsearch(key, image->keys, image->num_keys, sizeof(cache_key),
+                  compare_keys) != NULL;
+}
+
+struct disk_cache_image_writer *
+disk_cache_image_writer_create(void *mem_ctx)
+{
+   struct disk_cache_image_writer *writer =
+      ralloc(mem_ctx, struct disk_cache_image_writer);
+
+   if (writer) {
+      util_dynarray_init(&writer->entries, writer);
+      util_dynarray_init(&writer->keys, writer);
+   }
+
+   return writer;
+}
+
+bool
+disk_cache_image_writer_add(struct disk_cache_image_writer *writer,
+                            const cache_key key,
+                            const void *data, size_t size)
+{
+   struct writer_entry entry;
+   void *copy;
+
+   if (size > UINT32_MAX)
+      return false;
+
+   copy = ralloc_size(writer, size);
+   if (copy == NULL)
+      return false;
+   memcpy(copy, data, size);
+
+   memcpy(entry.key, key, CACHE_KEY_SIZE);
+   entry.data = copy;
+   entry.size = size;
+   util_dynarray_append(&writer->entries, struct writer_entry, entry);
+
+   return true;
+}
+
+void
+disk_cache_image_writer_add_key(struct disk_cache_image_writer *writer,
+                                const cache_key key)
+{
+   memcpy(util_dynarray_grow(&writer->keys, sizeof(cache_key)), key,
+          CACHE_KEY_SIZE);
+}
+
+/* Sort a table by key and drop duplicates, returning the new count. */
+static unsigned
+sort_unique(void *table, unsigned count, size_t elem_size)
+{
+   uint8_t *elems = table;
+   unsigned i, n = 0;
+
+   if (count == 0)
+      return 0;
+
+   qsort(elems, count, elem_size, compare_keys);
+
+   for (i = 0; i < count; i++) {
+      if (n > 0 && compare_keys(elems + (n - 1) * elem_size,
+                                elems + i * elem_size) == 0)
+         continue;
+      if (n != i)
+         memcpy(elems + n * elem_size, elems + i * elem_size, elem_size);
+      n++;
+   }
+
+   return n;
+}
+
+bool
+disk_cache_image_writer_finish(struct disk_cache_image_writer *writer,
+                               const char *filename)
+{
+   struct writer_entry *entries = writer->entries.data;
+   unsigned num_entries = writer->entries.size / sizeof(*entries);
+   unsigned num_keys = writer->keys.size / sizeof(cache_key);
+   struct image_header header;
+   uint64_t offset;
+   char *filename_tmp;
+   FILE *file = NULL;
+   bool ok = false;
+   unsigned i;
+
+   num_entries = sort_unique(entries, num_entries, sizeof(*entries));
+   num_keys = sort_unique(writer->keys.data, num_keys, sizeof(cache_key));
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, image_magic, sizeof(header.magic));
+   header.version = IMAGE_FILE_VERSION;
+   header.num_entries = num_entries;
+   header.num_keys = num_keys;
+   header.entries_offset = sizeof(header);
+   header.keys_offset =
+      header.entries_offset + num_entries * sizeof(struct image_entry);
+
+   filename_tmp = ralloc_asprintf(writer, "%s.tmp", filename);
+   if (filename_tmp == NULL)
+      goto done;
+
+   file = fopen(filename_tmp, "wb");
+   if (file == NULL)
+      goto done;
+
+   if (fwrite(&header, sizeof(header), 1, file) != 1)
+      goto done;
+
+   offset = header.keys_offset + num_keys * sizeof(cache_key);
+   for (i = 0; i < num_entries; i++) {
+      struct image_entry entry;
+
+      memcpy(entry.key, entries[i].key, CACHE_KEY_SIZE);
+      entry.size = entries[i].size;
+      entry.offset = offset;
+      offset += entries[i].size;
+
+      if (fwrite(&entry, sizeof(entry), 1, file) != 1)
+         goto done;
+   }
+
+   if (num_keys &&
+       fwrite(writer->keys.data, sizeof(cache_key), num_keys, file) != num_keys)
+      goto done;
+
+   for (i = 0; i < num_entries; i++) {
+      if (fwrite(entries[i].data, 1, entries[i].size, file) != entries[i].size)
+         goto done;
+   }
+
+   if (fclose(file) != 0) {
+      file = NULL;
+      goto done;
+   }
+   file = NULL;
+
+   ok = rename(filename_tmp, filename) == 0;
+
+ done:
+   if (file)
+      fclose(file);
+   if (!ok && filename_tmp)
+      unlink(filename_tmp);
+   ralloc_free(writer);
+
+   return ok;
+}
+
+#endif /* ENABLE_SHADER_CACHE */
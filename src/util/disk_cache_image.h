@@ -0,0 +1,110 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Read-only, prebuilt cache images.
+ *
+ * An image is a single file holding the entries of a warmed cache, as
+ * written by the mesa_cache_export tool, so that it can be shipped along
+ * with an application.  disk_cache_create() maps the images listed in
+ * MESA_GLSL_CACHE_IMAGES and looks keys up in them ahead of the writable
+ * cache.
+ *
+ * The file is a header, a table of entries sorted by key, a sorted table of
+ * the keys recorded with disk_cache_put_key(), and then the entries
+ * themselves, stored exactly as disk_cache writes them.  Lookups are binary
+ * searches of the mapping, and the entry is decompressed straight out of
+ * it.
+ */
+
+#ifndef DISK_CACHE_IMAGE_H
+#define DISK_CACHE_IMAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "disk_cache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct disk_cache_image;
+struct disk_cache_image_writer;
+
+/**
+ * Map the image \filename.  The returned object is ralloc'ed off of
+ * \mem_ctx.  Returns NULL if the file can't be mapped or isn't a valid
+ * image.
+ */
+struct disk_cache_image *
+disk_cache_image_open(void *mem_ctx, const char *filename);
+
+void
+disk_cache_image_close(struct disk_cache_image *image);
+
+/**
+ * Return a pointer to the entry stored under \key within the mapping, or
+ * NULL if the image has no such entry.
+ */
+const void *
+disk_cache_image_get(const struct disk_cache_image *image,
+                     const cache_key key, size_t *size);
+
+bool
+disk_cache_image_has_key(const struct disk_cache_image *image,
+                         const cache_key key);
+
+/**
+ * Collect entries and keys to be written out as an image with
+ * disk_cache_image_writer_finish().  The writer is ralloc'ed off of
+ * \mem_ctx.
+ */
+struct disk_cache_image_writer *
+disk_cache_image_writer_create(void *mem_ctx);
+
+/**
+ * Add an entry, as stored in a cache file.  \data is copied.
+ */
+bool
+disk_cache_image_writer_add(struct disk_cache_image_writer *writer,
+                            const cache_key key,
+                            const void *data, size_t size);
+
+void
+disk_cache_image_writer_add_key(struct disk_cache_image_writer *writer,
+                                const cache_key key);
+
+/**
+ * Write the image to \filename, replacing it atomically, and free the
+ * writer.
+ */
+bool
+disk_cache_image_writer_finish(struct disk_cache_image_writer *writer,
+                               const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISK_CACHE_IMAGE_H */
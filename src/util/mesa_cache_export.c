@@ -0,0 +1,55 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Packs a warmed shader cache into a read-only image for
+ * MESA_GLSL_CACHE_IMAGES.
+ *
+ * Run an application with MESA_GLSL_CACHE_DIR pointing at an empty
+ * directory until it has compiled its shaders, then
+ *
+ *    mesa_cache_export <dir>/mesa_shader_cache app.mesa_cache
+ *
+ * and ship app.mesa_cache alongside the application.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "util/disk_cache.h"
+
+int
+main(int argc, char **argv)
+{
+   if (argc != 3) {
+      fprintf(stderr, "usage: %s <cache directory> <image file>\n", argv[0]);
+      return EXIT_FAILURE;
+   }
+
+   if (!disk_cache_export_image(argv[1], argv[2])) {
+      fprintf(stderr, "%s: failed to export %s to %s\n",
+              argv[0], argv[1], argv[2]);
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -126,11 +126,18 @@ struct ra_node {
     *
     * List of which nodes this node interferes with.  This should be
     * symmetric with the other node.
+    *
+    * Interferences are appended without checking for duplicates, as that
+    * would take a bitset of every node per node, which gets prohibitively
+    * big for graphs of tens of thousands of nodes.  Instead, duplicates
+    * are dropped by ra_compact_adjacency() when the list fills up and
+    * before the graph is used.  The first adjacency_unique entries are
+    * known to be distinct.
     */
-   BITSET_WORD *adjacency;
    unsigned int *adjacency_list;
    unsigned int adjacency_list_size;
    unsigned int adjacency_count;
+   unsigned int adjacency_unique;
    /** @} */
 
    unsigned int class;
@@ -148,7 +155,8 @@ struct ra_node {
 
    /**
     * The q total, as defined in the Runeson/Nyström paper, for all the
-    * interfering nodes not in the stack.
+    * interfering nodes not in the stack.  Until the adjacency list is
+    * compacted, this includes duplicate interferences.
     */
    unsigned int q_total;
 
@@ -166,6 +174,13 @@ struct ra_graph {
    struct ra_node *nodes;
    unsigned int count; /**< count of nodes. */
 
+   /**
+    * For each node, the value of seen_stamp when ra_compact_adjacency()
+    * last came across it.
+    */
+   unsigned int *seen;
+   unsigned int seen_stamp;
+
    unsigned int *stack;
    unsigned int stack_count;
 
@@ -391,23 +406,66 @@ ra_set_finalize(struct ra_regs *regs, unsigned int **q_values)
    }
 }
 
+/**
+ * Drops the duplicate entries from the adjacency list of a node, keeping the
+ * first occurrence of each neighbor, and takes them out of its q total.
+ */
 static void
-ra_add_node_adjacency(struct ra_graph *g, unsigned int n1, unsigned int n2)
+ra_compact_adjacency(struct ra_graph *g, unsigned int n)
 {
-   BITSET_SET(g->nodes[n1].adjacency, n2);
+   struct ra_node *node = &g->nodes[n];
+   int n_class = node->class;
+   unsigned int i, count = 0;
+
+   if (node->adjacency_unique == node->adjacency_count)
+      return;
+
+   if (++g->seen_stamp == 0) {
+      memset(g->seen, 0, g->count * sizeof(*g->seen));
+      g->seen_stamp = 1;
+   }
+
+   for (i = 0; i < node->adjacency_count; i++) {
+      unsigned int n2 = node->adjacency_list[i];
+
+      if (g->seen[n2] == g->seen_stamp) {
+         int n2_class = g->nodes[n2].class;
+         node->q_total -= g->regs->classes[n_class]->q[n2_class];
+         continue;
+      }
+
+      g->seen[n2] = g->seen_stamp;
+      node->adjacency_list[count++] = n2;
+   }
+
+   node->adjacency_count = count;
+   node->adjacency_unique = count;
+}
 
+static void
+ra_add_node_adjacency(struct ra_graph *g, unsigned int n1, unsigned int n2)
+{
    assert(n1 != n2);
 
    int n1_class = g->nodes[n1].class;
    int n2_class = g->nodes[n2].class;
    g->nodes[n1].q_total += g->regs->classes[n1_class]->q[n2_class];
 
+   /* Only grow the list if compacting it leaves it more than half full, so
+    * that compaction is amortized over at least as many insertions as it
+    * walks entries.
+    */
    if (g->nodes[n1].adjacency_count >=
        g->nodes[n1].adjacency_list_size) {
-      g->nodes[n1].adjacency_list_size *= 2;
-      g->nodes[n1].adjacency_list = reralloc(g, g->nodes[n1].adjacency_list,
-                                             unsigned int,
-                                             g->nodes[n1].adjacency_list_size);
+      ra_compact_adjacency(g, n1);
+
+      if (g->nodes[n1].adjacency_count >
+          g->nodes[n1].adjacency_list_size / 2) {
+         g->nodes[n1].adjacency_list_size *= 2;
+         g->nodes[n1].adjacency_list =
+            reralloc(g, g->nodes[n1].adjacency_list, unsigned int,
+                     g->nodes[n1].adjacency_list_size);
+      }
    }
 
    g->nodes[n1].adjacency_list[g->nodes[n1].adjacency_count] = n2;
@@ -425,16 +483,15 @@ ra_alloc_interference_graph(struct ra_regs *regs, unsigned int count)
    g->nodes = rzalloc_array(g, struct ra_node, count);
    g->count = count;
 
+   g->seen = rzalloc_array(g, unsigned int, count);
    g->stack = rzalloc_array(g, unsigned int, count);
 
    for (i = 0; i < count; i++) {
-      int bitset_count = BITSET_WORDS(count);
-      g->nodes[i].adjacency = rzalloc_array(g, BITSET_WORD, bitset_count);
-
       g->nodes[i].adjacency_list_size = 4;
       g->nodes[i].adjacency_list =
          ralloc_array(g, unsigned int, g->nodes[i].adjacency_list_size);
       g->nodes[i].adjacency_count = 0;
+      g->nodes[i].adjacency_unique = 0;
       g->nodes[i].q_total = 0;
 
       g->nodes[i].reg = NO_REG;
@@ -464,7 +521,7 @@ void
 ra_add_node_interference(struct ra_graph *g,
                          unsigned int n1, unsigned int n2)
 {
-   if (n1 != n2 && !BITSET_TEST(g->nodes[n1].adjacency, n2)) {
+   if (n1 != n2) {
       ra_add_node_adjacency(g, n1, n2);
       ra_add_node_adjacency(g, n2, n1);
    }
@@ -478,8 +535,94 @@ pq_test(struct ra_graph *g, unsigned int n)
    return g->nodes[n].q_total < g->regs->classes[n_class]->p;
 }
 
+/**
+ * State of ra_simplify(): the nodes still to be pushed on the stack, in a
+ * binary heap with the node to pick for optimistic coloring on top, and the
+ * subset of them that pass the pq test.
+ */
+struct ra_simplify_state {
+   unsigned int *heap;
+   unsigned int heap_count;
+
+   /** Index of each node within the heap, or ~0 if it isn't there. */
+   unsigned int *heap_pos;
+
+   BITSET_WORD *colorable;
+};
+
+/**
+ * Orders the heap by lowest q total first, and highest-numbered node first
+ * on ties.
+ */
+static bool
+heap_before(struct ra_graph *g, unsigned int n1, unsigned int n2)
+{
+   if (g->nodes[n1].q_total != g->nodes[n2].q_total)
+      return g->nodes[n1].q_total < g->nodes[n2].q_total;
+
+   return n1 > n2;
+}
+
+static void
+heap_set(struct ra_simplify_state *s, unsigned int i, unsigned int n)
+{
+   s->heap[i] = n;
+   s->heap_pos[n] = i;
+}
+
+static void
+heap_sift_up(struct ra_graph *g, struct ra_simplify_state *s, unsigned int i)
+{
+   unsigned int n = s->heap[i];
+
+   while (i > 0 && heap_before(g, n, s->heap[(i - 1) / 2])) {
+      heap_set(s, i, s->heap[(i - 1) / 2]);
+      i = (i - 1) / 2;
+   }
+
+   heap_set(s, i, n);
+}
+
+static void
+heap_sift_down(struct ra_graph *g, struct ra_simplify_state *s,
+               unsigned int i)
+{
+   unsigned int n = s->heap[i];
+
+   while (2 * i + 1 < s->heap_count) {
+      unsigned int child = 2 * i + 1;
+
+      if (child + 1 < s->heap_count &&
+          heap_before(g, s->heap[child + 1], s->heap[child]))
+         child++;
+
+      if (!heap_before(g, s->heap[child], n))
+         break;
+
+      heap_set(s, i, s->heap[child]);
+      i = child;
+   }
+
+   heap_set(s, i, n);
+}
+
 static void
-decrement_q(struct ra_graph *g, unsigned int n)
+heap_remove(struct ra_graph *g, struct ra_simplify_state *s, unsigned int n)
+{
+   unsigned int i = s->heap_pos[n];
+   unsigned int last = s->heap[--s->heap_count];
+
+   s->heap_pos[n] = ~0;
+   if (last == n)
+      return;
+
+   heap_set(s, i, last);
+   heap_sift_up(g, s, i);
+   heap_sift_down(g, s, s->heap_pos[last]);
+}
+
+static void
+decrement_q(struct ra_graph *g, unsigned int n, struct ra_simplify_state *s)
 {
    unsigned int i;
    int n_class = g->nodes[n].class;
@@ -491,22 +634,60 @@ decrement_q(struct ra_graph *g, unsigned int n)
       if (!g->nodes[n2].in_stack) {
          assert(g->nodes[n2].q_total >= g->regs->classes[n2_class]->q[n_class]);
          g->nodes[n2].q_total -= g->regs->classes[n2_class]->q[n_class];
+
+         if (s && s->heap_pos[n2] != ~0U) {
+            heap_sift_up(g, s, s->heap_pos[n2]);
+            if (pq_test(g, n2))
+               BITSET_SET(s->colorable, n2);
+         }
       }
    }
 }
 
 /**
- * Simplifies the interference graph by pushing all
- * trivially-colorable nodes into a stack of nodes to be colored,
- * removing them from the graph, and rinsing and repeating.
- *
- * If we encounter a case where we can't push any nodes on the stack, then
- * we optimistically choose a node and push it on the stack. We heuristically
- * push the node with the lowest total q value, since it has the fewest
- * neighbors and therefore is most likely to be allocated.
+ * Returns the highest-numbered node below \p limit in \p set, or -1 if
+ * there is none.
  */
+static int
+last_set_below(const BITSET_WORD *set, unsigned int limit)
+{
+   while (limit > 0) {
+      unsigned int word = (limit - 1) / BITSET_WORDBITS;
+      unsigned int bits = limit - word * BITSET_WORDBITS;
+      BITSET_WORD mask = set[word];
+
+      if (bits < BITSET_WORDBITS)
+         mask &= (1u << bits) - 1;
+
+      if (mask)
+         return word * BITSET_WORDBITS + util_last_bit(mask) - 1;
+
+      limit = word * BITSET_WORDBITS;
+   }
+
+   return -1;
+}
+
 static void
-ra_simplify(struct ra_graph *g)
+ra_push_node(struct ra_graph *g, unsigned int n, struct ra_simplify_state *s)
+{
+   if (s) {
+      heap_remove(g, s, n);
+      BITSET_CLEAR(s->colorable, n);
+   }
+
+   decrement_q(g, n, s);
+   g->stack[g->stack_count] = n;
+   g->stack_count++;
+   g->nodes[n].in_stack = true;
+}
+
+/**
+ * Does the same as ra_simplify() by testing every node on every sweep, which
+ * needs no memory beyond the graph.
+ */
+static unsigned int
+ra_simplify_sweep(struct ra_graph *g)
 {
    bool progress = true;
    unsigned int stack_optimistic_start = UINT_MAX;
@@ -519,36 +700,113 @@ ra_simplify(struct ra_graph *g)
       progress = false;
 
       for (i = g->count - 1; i >= 0; i--) {
-	 if (g->nodes[i].in_stack || g->nodes[i].reg != NO_REG)
-	    continue;
-
-	 if (pq_test(g, i)) {
-	    decrement_q(g, i);
-	    g->stack[g->stack_count] = i;
-	    g->stack_count++;
-	    g->nodes[i].in_stack = true;
-	    progress = true;
-	 } else {
-	    unsigned int new_q_total = g->nodes[i].q_total;
-	    if (new_q_total < lowest_q_total) {
-	       best_optimistic_node = i;
-	       lowest_q_total = new_q_total;
-	    }
-	 }
+         if (g->nodes[i].in_stack || g->nodes[i].reg != NO_REG)
+            continue;
+
+         if (pq_test(g, i)) {
+            ra_push_node(g, i, NULL);
+            progress = true;
+         } else if (g->nodes[i].q_total < lowest_q_total) {
+            best_optimistic_node = i;
+            lowest_q_total = g->nodes[i].q_total;
+         }
       }
 
       if (!progress && best_optimistic_node != ~0U) {
          if (stack_optimistic_start == UINT_MAX)
             stack_optimistic_start = g->stack_count;
 
-	 decrement_q(g, best_optimistic_node);
-	 g->stack[g->stack_count] = best_optimistic_node;
-	 g->stack_count++;
-	 g->nodes[best_optimistic_node].in_stack = true;
-	 progress = true;
+         ra_push_node(g, best_optimistic_node, NULL);
+         progress = true;
+      }
+   }
+
+   return stack_optimistic_start;
+}
+
+/**
+ * Simplifies the interference graph by pushing all
+ * trivially-colorable nodes into a stack of nodes to be colored,
+ * removing them from the graph, and rinsing and repeating.
+ *
+ * If we encounter a case where we can't push any nodes on the stack, then
+ * we optimistically choose a node and push it on the stack. We heuristically
+ * push the node with the lowest total q value, since it has the fewest
+ * neighbors and therefore is most likely to be allocated.
+ *
+ * Nodes are pushed in the order of sweeps over the graph from the highest
+ * numbered node down, each one pushing every node that passes the pq test by
+ * the time the sweep gets to it.  Rather than testing every node on every
+ * sweep, the nodes that pass are tracked in a bitset, and the candidates for
+ * optimistic coloring in a heap, both of which only need updating for the
+ * neighbors of a node when it is pushed.  If they can't be allocated, this
+ * falls back to ra_simplify_sweep().
+ */
+static void
+ra_simplify(struct ra_graph *g)
+{
+   unsigned int stack_optimistic_start = UINT_MAX;
+   struct ra_simplify_state s;
+   unsigned int sweep_start = g->count;
+   bool progress = false;
+   unsigned int i;
+
+   s.heap = malloc(g->count * sizeof(unsigned int));
+   s.heap_pos = malloc(g->count * sizeof(unsigned int));
+   s.colorable = calloc(BITSET_WORDS(g->count), sizeof(BITSET_WORD));
+   s.heap_count = 0;
+
+   if (!s.heap || !s.heap_pos || !s.colorable) {
+      free(s.heap);
+      free(s.heap_pos);
+      free(s.colorable);
+      g->stack_optimistic_start = ra_simplify_sweep(g);
+      return;
+   }
+
+   for (i = 0; i < g->count; i++) {
+      s.heap_pos[i] = ~0;
+
+      if (g->nodes[i].in_stack || g->nodes[i].reg != NO_REG)
+         continue;
+
+      heap_set(&s, s.heap_count++, i);
+      if (pq_test(g, i))
+         BITSET_SET(s.colorable, i);
+   }
+
+   for (i = s.heap_count / 2; i > 0; i--)
+      heap_sift_down(g, &s, i - 1);
+
+   while (s.heap_count > 0) {
+      int n = last_set_below(s.colorable, sweep_start);
+
+      if (n >= 0) {
+         ra_push_node(g, n, &s);
+         sweep_start = n;
+         progress = true;
+         continue;
       }
+
+      /* Nodes pushed during this sweep may have made higher-numbered ones
+       * colorable, so start another.
+       */
+      sweep_start = g->count;
+      if (progress) {
+         progress = false;
+         continue;
+      }
+
+      if (stack_optimistic_start == UINT_MAX)
+         stack_optimistic_start = g->stack_count;
+
+      ra_push_node(g, s.heap[0], &s);
    }
 
+   free(s.heap);
+   free(s.heap_pos);
+   free(s.colorable);
+
    g->stack_optimistic_start = stack_optimistic_start;
 }
 
@@ -677,9 +935,19 @@ ra_select(struct ra_graph *g)
    return true;
 }
 
+static void
+ra_compact_graph(struct ra_graph *g)
+{
+   unsigned int n;
+
+   for (n = 0; n < g->count; n++)
+      ra_compact_adjacency(g, n);
+}
+
 bool
 ra_allocate(struct ra_graph *g)
 {
+   ra_compact_graph(g);
    ra_simplify(g);
    return ra_select(g);
 }
@@ -743,6 +1011,8 @@ ra_get_best_spill_node(struct ra_graph *g)
    float best_benefit = 0.0;
    unsigned int n;
 
+   ra_compact_graph(g);
+
    /* Consider any nodes that we colored successfully or the node we failed to
     * color for spilling. When we failed to color a node in ra_select(), we
     * only considered these nodes, so spilling any other ones would not result
@@ -0,0 +1,600 @@
+/*
+ * Copyright © 2018 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/** @file ra_test.c
+ *
+ * Builds random interference graphs of live intervals over a register file
+ * with 1, 2 and 4 register wide classes, allocates them, and checks that
+ * the coloring is valid and identical to the one of a reference allocator.
+ * The reference is the allocator as it was before the adjacency lists
+ * stopped being deduplicated on insertion: a bitset of neighbors per node
+ * and a simplify loop that tests every node on every sweep.
+ *
+ * "./ra_test bench [nodes...]" instead times building and allocating
+ * graphs of 1k to 100k nodes.  The reference is only timed up to 30k
+ * nodes, as its bitsets take n^2/8 bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "util/bitset.h"
+#include "util/ralloc.h"
+#include "util/register_allocate.h"
+
+#define NO_REG ~0U
+#define BASE_REGS 64
+#define CLASS_COUNT 3
+
+static const unsigned class_width[CLASS_COUNT] = { 1, 2, 4 };
+
+/* The registers of each class, each covering class_width consecutive base
+ * registers starting at reg_start.
+ */
+static unsigned reg_count;
+static unsigned reg_start[3 * BASE_REGS];
+static unsigned reg_class[3 * BASE_REGS];
+static unsigned class_p[CLASS_COUNT];
+static unsigned class_q[CLASS_COUNT][CLASS_COUNT];
+
+static uint64_t rand_state;
+
+static unsigned
+rand_below(unsigned n)
+{
+   rand_state ^= rand_state << 13;
+   rand_state ^= rand_state >> 7;
+   rand_state ^= rand_state << 17;
+   return (rand_state >> 32) % n;
+}
+
+static double
+now_ms(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static bool
+regs_conflict(unsigned r1, unsigned r2)
+{
+   return reg_start[r1] < reg_start[r2] + class_width[reg_class[r2]] &&
+          reg_start[r2] < reg_start[r1] + class_width[reg_class[r1]];
+}
+
+static struct ra_regs *
+create_reg_set(bool round_robin)
+{
+   struct ra_regs *regs;
+   unsigned c, i, b, r;
+
+   reg_count = 0;
+   for (c = 0; c < CLASS_COUNT; c++) {
+      for (i = 0; i + class_width[c] <= BASE_REGS; i++) {
+         reg_start[reg_count] = i;
+         reg_class[reg_count] = c;
+         reg_count++;
+      }
+   }
+
+   regs = ra_alloc_reg_set(NULL, reg_count, true);
+   if (round_robin)
+      ra_set_allocate_round_robin(regs);
+
+   for (c = 0; c < CLASS_COUNT; c++)
+      ra_alloc_reg_class(regs);
+
+   for (r = 0; r < reg_count; r++) {
+      ra_class_add_reg(regs, reg_class[r], r);
+      if (r >= BASE_REGS) {
+         for (b = 0; b < class_width[reg_class[r]]; b++)
+            ra_add_transitive_reg_conflict(regs, reg_start[r] + b, r);
+      }
+   }
+
+   ra_set_finalize(regs, NULL);
+
+   /* The same q and p values, computed the way ra_set_finalize() does. */
+   memset(class_p, 0, sizeof(class_p));
+   memset(class_q, 0, sizeof(class_q));
+   for (r = 0; r < reg_count; r++)
+      class_p[reg_class[r]]++;
+
+   for (r = 0; r < reg_count; r++) {
+      unsigned conflicts[CLASS_COUNT] = { 0 };
+
+      for (i = 0; i < reg_count; i++) {
+         if (regs_conflict(r, i))
+            conflicts[reg_class[i]]++;
+      }
+      for (c = 0; c < CLASS_COUNT; c++) {
+         if (conflicts[c] > class_q[c][reg_class[r]])
+            class_q[c][reg_class[r]] = conflicts[c];
+      }
+   }
+
+   return regs;
+}
+
+/**
+ * A random graph: each node is an interval of instructions, and two nodes
+ * interfere if their intervals overlap.  Some interferences are added twice
+ * and in both directions, as the drivers do.
+ */
+struct graph {
+   unsigned count;
+   unsigned *node_class;
+   float *spill_cost;
+
+   unsigned *edges;
+   unsigned edge_count;
+};
+
+static void
+create_graph(struct graph *graph, unsigned count, unsigned pressure)
+{
+   unsigned *start = malloc(count * sizeof(unsigned));
+   unsigned *end = malloc(count * sizeof(unsigned));
+   unsigned *live = malloc(count * sizeof(unsigned));
+   unsigned live_count = 0, edge_size = count * 4;
+   unsigned i, j, k;
+
+   graph->count = count;
+   graph->node_class = malloc(count * sizeof(unsigned));
+   graph->spill_cost = malloc(count * sizeof(float));
+   graph->edges = malloc(edge_size * 2 * sizeof(unsigned));
+   graph->edge_count = 0;
+
+   /* Nodes are numbered in the order their intervals start, with about
+    * pressure of them live at a time and a few long ones.
+    */
+   for (i = 0; i < count; i++) {
+      unsigned len = 1 + rand_below(pressure * 2);
+
+      if (rand_below(50) == 0)
+         len *= 20;
+
+      start[i] = i;
+      end[i] = i + len;
+      graph->node_class[i] = (unsigned[]) { 0, 0, 0, 0, 0, 0, 0, 1, 1, 2 }
+                             [rand_below(10)];
+      graph->spill_cost[i] = 1.0f + rand_below(7);
+   }
+
+   for (i = 0; i < count; i++) {
+      for (j = 0, k = 0; j < live_count; j++) {
+         if (end[live[j]] > start[i])
+            live[k++] = live[j];
+      }
+      live_count = k;
+
+      for (j = 0; j < live_count; j++) {
+         unsigned copies = rand_below(8) == 0 ? 2 : 1;
+
+         for (k = 0; k < copies; k++) {
+            if (graph->edge_count == edge_size) {
+               edge_size *= 2;
+               graph->edges = realloc(graph->edges,
+                                      edge_size * 2 * sizeof(unsigned));
+            }
+            graph->edges[graph->edge_count * 2] = k ? i : live[j];
+            graph->edges[graph->edge_count * 2 + 1] = k ? live[j] : i;
+            graph->edge_count++;
+         }
+      }
+      live[live_count++] = i;
+   }
+
+   free(start);
+   free(end);
+   free(live);
+}
+
+static void
+destroy_graph(struct graph *graph)
+{
+   free(graph->node_class);
+   free(graph->spill_cost);
+   free(graph->edges);
+}
+
+static struct ra_graph *
+build_ra_graph(struct ra_regs *regs, const struct graph *graph)
+{
+   struct ra_graph *g = ra_alloc_interference_graph(regs, graph->count);
+   unsigned i;
+
+   for (i = 0; i < graph->count; i++) {
+      ra_set_node_class(g, i, graph->node_class[i]);
+      ra_set_node_spill_cost(g, i, graph->spill_cost[i]);
+   }
+
+   for (i = 0; i < graph->edge_count; i++) {
+      ra_add_node_interference(g, graph->edges[i * 2],
+                               graph->edges[i * 2 + 1]);
+   }
+
+   return g;
+}
+
+/** The reference allocator. */
+struct ref_node {
+   BITSET_WORD *adjacency;
+   unsigned *adjacency_list;
+   unsigned adjacency_count;
+   unsigned adjacency_size;
+   unsigned q_total;
+   unsigned reg;
+   bool in_stack;
+};
+
+struct ref_graph {
+   const struct graph *graph;
+   struct ref_node *nodes;
+   unsigned *stack;
+   unsigned stack_count;
+   unsigned stack_optimistic_start;
+   bool round_robin;
+};
+
+static void
+ref_add_adjacency(struct ref_graph *g, unsigned n1, unsigned n2)
+{
+   struct ref_node *node = &g->nodes[n1];
+
+   BITSET_SET(node->adjacency, n2);
+   node->q_total +=
+      class_q[g->graph->node_class[n1]][g->graph->node_class[n2]];
+
+   if (node->adjacency_count == node->adjacency_size) {
+      node->adjacency_size = node->adjacency_size ? node->adjacency_size * 2
+                                                  : 4;
+      node->adjacency_list = realloc(node->adjacency_list,
+                                     node->adjacency_size * sizeof(unsigned));
+   }
+   node->adjacency_list[node->adjacency_count++] = n2;
+}
+
+static void
+ref_build(struct ref_graph *g, const struct graph *graph, bool round_robin)
+{
+   unsigned i;
+
+   g->graph = graph;
+   g->nodes = calloc(graph->count, sizeof(struct ref_node));
+   g->stack = malloc(graph->count * sizeof(unsigned));
+   g->stack_count = 0;
+   g->round_robin = round_robin;
+
+   for (i = 0; i < graph->count; i++) {
+      g->nodes[i].adjacency = calloc(BITSET_WORDS(graph->count),
+                                     sizeof(BITSET_WORD));
+      g->nodes[i].reg = NO_REG;
+   }
+
+   for (i = 0; i < graph->edge_count; i++) {
+      unsigned n1 = graph->edges[i * 2], n2 = graph->edges[i * 2 + 1];
+
+      if (n1 != n2 && !BITSET_TEST(g->nodes[n1].adjacency, n2)) {
+         ref_add_adjacency(g, n1, n2);
+         ref_add_adjacency(g, n2, n1);
+      }
+   }
+}
+
+static void
+ref_destroy(struct ref_graph *g)
+{
+   unsigned i;
+
+   for (i = 0; i < g->graph->count; i++) {
+      free(g->nodes[i].adjacency);
+      free(g->nodes[i].adjacency_list);
+   }
+   free(g->nodes);
+   free(g->stack);
+}
+
+static bool
+ref_pq_test(struct ref_graph *g, unsigned n)
+{
+   return g->nodes[n].q_total < class_p[g->graph->node_class[n]];
+}
+
+static void
+ref_push(struct ref_graph *g, unsigned n)
+{
+   unsigned i;
+
+   for (i = 0; i < g->nodes[n].adjacency_count; i++) {
+      unsigned n2 = g->nodes[n].adjacency_list[i];
+
+      if (!g->nodes[n2].in_stack) {
+         g->nodes[n2].q_total -=
+            class_q[g->graph->node_class[n2]][g->graph->node_class[n]];
+      }
+   }
+
+   g->stack[g->stack_count++] = n;
+   g->nodes[n].in_stack = true;
+}
+
+static void
+ref_simplify(struct ref_graph *g)
+{
+   bool progress = true;
+   int i;
+
+   g->stack_optimistic_start = ~0U;
+
+   while (progress) {
+      unsigned best_optimistic_node = ~0U;
+      unsigned lowest_q_total = ~0U;
+
+      progress = false;
+
+      for (i = g->graph->count - 1; i >= 0; i--) {
+         if (g->nodes[i].in_stack)
+            continue;
+
+         if (ref_pq_test(g, i)) {
+            ref_push(g, i);
+            progress = true;
+         } else if (g->nodes[i].q_total < lowest_q_total) {
+            best_optimistic_node = i;
+            lowest_q_total = g->nodes[i].q_total;
+         }
+      }
+
+      if (!progress && best_optimistic_node != ~0U) {
+         if (g->stack_optimistic_start == ~0U)
+            g->stack_optimistic_start = g->stack_count;
+
+         ref_push(g, best_optimistic_node);
+         progress = true;
+      }
+   }
+}
+
+static bool
+ref_select(struct ref_graph *g)
+{
+   unsigned start_search_reg = 0;
+
+   while (g->stack_count != 0) {
+      unsigned n = g->stack[g->stack_count - 1];
+      unsigned ri, r = 0, i;
+
+      g->nodes[n].in_stack = false;
+
+      for (ri = 0; ri < reg_count; ri++) {
+         r = (start_search_reg + ri) % reg_count;
+         if (reg_class[r] != g->graph->node_class[n])
+            continue;
+
+         for (i = 0; i < g->nodes[n].adjacency_count; i++) {
+            unsigned n2 = g->nodes[n].adjacency_list[i];
+
+            if (!g->nodes[n2].in_stack && regs_conflict(r, g->nodes[n2].reg))
+               break;
+         }
+         if (i == g->nodes[n].adjacency_count)
+            break;
+      }
+
+      if (ri == reg_count)
+         return false;
+
+      g->nodes[n].reg = r;
+      g->stack_count--;
+
+      if (g->round_robin &&
+          g->stack_count - 1 <= g->stack_optimistic_start)
+         start_search_reg = r + 1;
+   }
+
+   return true;
+}
+
+static int
+ref_best_spill_node(struct ref_graph *g)
+{
+   unsigned best_node = -1;
+   float best_benefit = 0.0;
+   unsigned n, i;
+
+   for (n = 0; n < g->graph->count; n++) {
+      unsigned n_class = g->graph->node_class[n];
+      float cost = g->graph->spill_cost[n];
+      float benefit = 0;
+
+      if (g->nodes[n].in_stack)
+         continue;
+
+      for (i = 0; i < g->nodes[n].adjacency_count; i++) {
+         unsigned n2_class =
+            g->graph->node_class[g->nodes[n].adjacency_list[i]];
+         benefit += (float)class_q[n_class][n2_class] / class_p[n_class];
+      }
+
+      if (benefit / cost > best_benefit) {
+         best_benefit = benefit / cost;
+         best_node = n;
+      }
+   }
+
+   return best_node;
+}
+
+/**
+ * Allocates a random graph with both allocators and checks the results.
+ * Returns false and prints why on failure.
+ */
+static bool
+check_graph(unsigned count, unsigned pressure, bool round_robin)
+{
+   struct ra_regs *regs = create_reg_set(round_robin);
+   struct graph graph;
+   struct ref_graph ref;
+   struct ra_graph *g;
+   bool ok, ref_ok, pass = true;
+   unsigned i;
+
+   create_graph(&graph, count, pressure);
+   g = build_ra_graph(regs, &graph);
+   ok = ra_allocate(g);
+
+   ref_build(&ref, &graph, round_robin);
+   ref_simplify(&ref);
+   ref_ok = ref_select(&ref);
+
+   if (ok != ref_ok) {
+      fprintf(stderr, "%u nodes: allocation %s, reference %s\n", count,
+              ok ? "succeeded" : "failed", ref_ok ? "succeeded" : "failed");
+      pass = false;
+   }
+
+   for (i = 0; pass && i < count; i++) {
+      if (ra_get_node_reg(g, i) != ref.nodes[i].reg) {
+         fprintf(stderr, "%u nodes: node %u got reg %u, reference %u\n",
+                 count, i, ra_get_node_reg(g, i), ref.nodes[i].reg);
+         pass = false;
+      }
+   }
+
+   if (pass && ok) {
+      for (i = 0; i < count; i++) {
+         if (reg_class[ra_get_node_reg(g, i)] != graph.node_class[i]) {
+            fprintf(stderr, "%u nodes: node %u got reg %u of another class\n",
+                    count, i, ra_get_node_reg(g, i));
+            pass = false;
+         }
+      }
+      for (i = 0; pass && i < graph.edge_count; i++) {
+         unsigned n1 = graph.edges[i * 2], n2 = graph.edges[i * 2 + 1];
+
+         if (regs_conflict(ra_get_node_reg(g, n1), ra_get_node_reg(g, n2))) {
+            fprintf(stderr, "%u nodes: nodes %u and %u interfere but got "
+                    "conflicting regs\n", count, n1, n2);
+            pass = false;
+         }
+      }
+   }
+
+   if (pass && !ok &&
+       ra_get_best_spill_node(g) != ref_best_spill_node(&ref)) {
+      fprintf(stderr, "%u nodes: spill node %d, reference %d\n", count,
+              ra_get_best_spill_node(g), ref_best_spill_node(&ref));
+      pass = false;
+   }
+
+   ref_destroy(&ref);
+   ralloc_free(g);
+   destroy_graph(&graph);
+   ralloc_free(regs);
+
+   return pass;
+}
+
+static void
+bench(unsigned count)
+{
+   struct ra_regs *regs = create_reg_set(false);
+   struct graph graph;
+   struct ra_graph *g;
+   double start, built, allocated;
+   bool ok;
+
+   create_graph(&graph, count, 48);
+
+   start = now_ms();
+   g = build_ra_graph(regs, &graph);
+   built = now_ms();
+   ok = ra_allocate(g);
+   allocated = now_ms();
+   ralloc_free(g);
+
+   printf("%7u %9u %10.1f %10.1f %7s", count, graph.edge_count,
+          built - start, allocated - built, ok ? "yes" : "no");
+
+   if (count <= 30000) {
+      struct ref_graph ref;
+
+      start = now_ms();
+      ref_build(&ref, &graph, false);
+      built = now_ms();
+      ref_simplify(&ref);
+      ref_select(&ref);
+      allocated = now_ms();
+      ref_destroy(&ref);
+
+      printf(" %10.1f %10.1f", built - start, allocated - built);
+   }
+   printf("\n");
+
+   destroy_graph(&graph);
+   ralloc_free(regs);
+}
+
+int
+main(int argc, char **argv)
+{
+   unsigned i;
+
+   rand_state = 0x2545f4914f6cdd1dull;
+
+   if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+      static const unsigned sizes[] = { 1000, 10000, 30000, 100000 };
+
+      printf("%7s %9s %10s %10s %7s %10s %10s\n", "nodes", "edges",
+             "build ms", "alloc ms", "colored", "ref build", "ref alloc");
+
+      if (argc > 2) {
+         for (i = 2; i < argc; i++)
+            bench(atoi(argv[i]));
+      } else {
+         for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+            bench(sizes[i]);
+      }
+      return 0;
+   }
+
+   /* Pressures from well below to well above the 64 base registers, so that
+    * both trivially colorable and spilling graphs are covered.
+    */
+   for (i = 0; i < 200; i++) {
+      unsigned count = 50 + rand_below(2000);
+      unsigned pressure = 4 + rand_below(48);
+
+      if (!check_graph(count, pressure, i & 1))
+         return 1;
+   }
+
+   return 0;
+}
@@ -112,7 +112,10 @@ util_queue_fence_reset(struct util_queue_fence *fence)
 static inline bool
 util_queue_fence_is_signalled(struct util_queue_fence *fence)
 {
-   return fence->val == 0;
+   /* Acquire, so that a signalled fence also makes the job's results
+    * visible to the thread that checked it.
+    */
+   return p_atomic_read(&fence->val) == 0;
 }
 #endif
 
@@ -36,6 +36,10 @@
 #include <signal.h>
 #endif
 
+#if defined(HAVE_PTHREAD) && defined(__linux__) && defined(__GLIBC__)
+#include <sched.h>
+#endif
+
 
 static inline thrd_t u_thread_create(int (*routine)(void *), void *param)
 {
@@ -70,6 +74,35 @@ static inline void u_thread_setname( const char *name )
    (void)name;
 }
 
+/**
+ * Restrict the calling thread to the CPUs set in the given bitmask.
+ *
+ * \param mask  CPU bitmask, bit i of mask[i / 32] standing for CPU i
+ * \param num_mask_bits  number of valid bits in mask
+ * \return whether the affinity was changed
+ */
+static inline bool
+util_set_current_thread_affinity(const uint32_t *mask, unsigned num_mask_bits)
+{
+#if defined(HAVE_PTHREAD) && defined(__linux__) && defined(__GLIBC__) && \
+    defined(CPU_SETSIZE)
+   cpu_set_t cpuset;
+   unsigned i;
+
+   CPU_ZERO(&cpuset);
+   for (i = 0; i < num_mask_bits && i < CPU_SETSIZE; i++) {
+      if (mask[i / 32] & (1u << (i % 32)))
+         CPU_SET(i, &cpuset);
+   }
+
+   return pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == 0;
+#else
+   (void)mask;
+   (void)num_mask_bits;
+   return false;
+#endif
+}
+
 /*
  * Thread statistics.
  */